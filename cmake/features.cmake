@@ -7,9 +7,11 @@ option(ENABLE_GIL_PYTHON_API "Build Python API with Global Interpreter Lock" ON)
 option(ENABLE_JS "Enable JS API build" OFF)
 option(ENABLE_SAMPLES "Enable samples build" ON)
 option(ENABLE_TESTS "Enable tests build" ON)
+option(ENABLE_BENCHMARKS "Enable build of the microbenchmarks of the continuous batching internals, requires ENABLE_TESTS" OFF)
 option(ENABLE_TOOLS "Enable tools build" ON)
 option(ENABLE_GGUF "Enable support for GGUF format" ON)
 option(ENABLE_XGRAMMAR "Enable support for structured output generation with xgrammar backend" ON)
+option(ENABLE_TRACING "Enable the trace instrumentation of the pipelines, which is recorded if OV_GENAI_TRACE_FILE is set" ON)
 
 # Disable building samples for NPM package
 if(CPACK_GENERATOR STREQUAL "NPM")
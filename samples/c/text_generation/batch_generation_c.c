@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "openvino/genai/c/llm_pipeline.h"
+
+#define CHECK_STATUS(return_status)                                                      \
+    if (return_status != OK) {                                                           \
+        fprintf(stderr, "[ERROR] return status %d, line %d\n", return_status, __LINE__); \
+        goto err;                                                                        \
+    }
+
+#define MAX_NEW_TOKENS 100
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <MODEL_DIR> \"<PROMPT 1>\" \"<PROMPT 2>\" [\"<PROMPT 3>\" ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const char* model_dir = argv[1];
+    const char** prompts = (const char**)(argv + 2);
+    const size_t num_prompts = (size_t)(argc - 2);
+    const char* device = "CPU";  // GPU, NPU can be used as well
+
+    ov_genai_llm_pipeline* pipeline = NULL;
+    ov_genai_generation_config* config = NULL;
+    int64_t* tokens = NULL;     // num_prompts rows of MAX_NEW_TOKENS token ids
+    size_t* num_tokens = NULL;  // The number of the tokens generated in each row
+    char* output = NULL;        // The decoded strings placed one after another
+    size_t* output_offsets = NULL;
+    size_t output_size = 0;
+    ov_status_e status;
+    int exit_code = EXIT_FAILURE;
+
+    tokens = (int64_t*)malloc(num_prompts * MAX_NEW_TOKENS * sizeof(int64_t));
+    num_tokens = (size_t*)calloc(num_prompts, sizeof(size_t));
+    output_offsets = (size_t*)calloc(num_prompts, sizeof(size_t));
+    if (!tokens || !num_tokens || !output_offsets) {
+        fprintf(stderr, "Failed to allocate memory for the results\n");
+        goto err;
+    }
+
+    CHECK_STATUS(ov_genai_llm_pipeline_create(model_dir, device, 0, &pipeline));
+    CHECK_STATUS(ov_genai_generation_config_create(&config));
+    CHECK_STATUS(ov_genai_generation_config_set_max_new_tokens(config, MAX_NEW_TOKENS));
+
+    // The rows are checked to fit max_new_tokens before the generation starts.
+    status = ov_genai_llm_pipeline_generate_batch(pipeline, prompts, num_prompts, config, tokens, MAX_NEW_TOKENS - 1, num_tokens);
+    if (status != OUT_OF_BOUNDS) {
+        fprintf(stderr, "Rows shorter than max_new_tokens must be rejected, got status %d\n", status);
+        goto err;
+    }
+    // The prompts are generated as a single batch, the tokens of the i-th prompt start at i * MAX_NEW_TOKENS.
+    CHECK_STATUS(ov_genai_llm_pipeline_generate_batch(pipeline, prompts, num_prompts, config, tokens, MAX_NEW_TOKENS, num_tokens));
+
+    // The function is called with NULL as the output to determine the required buffer size.
+    CHECK_STATUS(ov_genai_llm_pipeline_decode_batch(pipeline, tokens, MAX_NEW_TOKENS, num_tokens, num_prompts, NULL, &output_size, NULL));
+    output = (char*)malloc(output_size);
+    if (!output) {
+        fprintf(stderr, "Failed to allocate memory for output\n");
+        goto err;
+    }
+
+    // A buffer smaller than the required size is rejected.
+    {
+        size_t small_output_size = output_size - 1;
+        status = ov_genai_llm_pipeline_decode_batch(pipeline, tokens, MAX_NEW_TOKENS, num_tokens, num_prompts, output, &small_output_size, output_offsets);
+        if (status != OUT_OF_BOUNDS) {
+            fprintf(stderr, "Too small output buffer must be rejected, got status %d\n", status);
+            goto err;
+        }
+        printf("Output buffer of %zu bytes is too small, %zu bytes are needed\n\n", small_output_size, output_size);
+    }
+
+    CHECK_STATUS(ov_genai_llm_pipeline_decode_batch(pipeline, tokens, MAX_NEW_TOKENS, num_tokens, num_prompts, output, &output_size, output_offsets));
+    for (size_t i = 0; i < num_prompts; i++) {
+        printf("Prompt: %s\nResult: %s\n\n", prompts[i], output + output_offsets[i]);
+    }
+    exit_code = EXIT_SUCCESS;
+
+err:
+    if (pipeline)
+        ov_genai_llm_pipeline_free(pipeline);
+    if (config)
+        ov_genai_generation_config_free(config);
+    if (tokens)
+        free(tokens);
+    if (num_tokens)
+        free(num_tokens);
+    if (output_offsets)
+        free(output_offsets);
+    if (output)
+        free(output);
+
+    return exit_code;
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "openvino/genai/c/continuous_batching_pipeline.h"
+
+#define CHECK_STATUS(return_status)                                                      \
+    if (return_status != OK) {                                                           \
+        fprintf(stderr, "[ERROR] return status %d, line %d\n", return_status, __LINE__); \
+        goto err;                                                                        \
+    }
+
+#define MAX_NEW_TOKENS 100
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <MODEL_DIR> \"<PROMPT 1>\" [\"<PROMPT 2>\" ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const char* model_dir = argv[1];
+    const size_t num_prompts = (size_t)(argc - 2);
+    const char* device = "CPU";  // GPU can be used as well
+
+    ov_genai_scheduler_config* scheduler_config = NULL;
+    ov_genai_continuous_batching_pipeline* pipeline = NULL;
+    ov_genai_generation_config* config = NULL;
+    ov_genai_generation_handle** handles = NULL;
+    int64_t** tokens = NULL;  // The tokens generated for each prompt
+    size_t* num_tokens = NULL;
+    char* output = NULL;
+    size_t output_size = 0;
+    bool has_requests = true;
+    ov_genai_pipeline_metrics metrics;
+    int exit_code = EXIT_FAILURE;
+
+    handles = (ov_genai_generation_handle**)calloc(num_prompts, sizeof(ov_genai_generation_handle*));
+    tokens = (int64_t**)calloc(num_prompts, sizeof(int64_t*));
+    num_tokens = (size_t*)calloc(num_prompts, sizeof(size_t));
+    if (!handles || !tokens || !num_tokens) {
+        fprintf(stderr, "Failed to allocate memory for the requests\n");
+        goto err;
+    }
+    for (size_t i = 0; i < num_prompts; i++) {
+        tokens[i] = (int64_t*)malloc(MAX_NEW_TOKENS * sizeof(int64_t));
+        if (!tokens[i]) {
+            fprintf(stderr, "Failed to allocate memory for the tokens\n");
+            goto err;
+        }
+    }
+
+    CHECK_STATUS(ov_genai_scheduler_config_create(&scheduler_config));
+    CHECK_STATUS(ov_genai_scheduler_config_set_cache_size(scheduler_config, 1));
+    CHECK_STATUS(ov_genai_continuous_batching_pipeline_create(model_dir, scheduler_config, device, 0, &pipeline));
+    CHECK_STATUS(ov_genai_generation_config_create(&config));
+    CHECK_STATUS(ov_genai_generation_config_set_max_new_tokens(config, MAX_NEW_TOKENS));
+
+    for (size_t i = 0; i < num_prompts; i++) {
+        CHECK_STATUS(ov_genai_continuous_batching_pipeline_add_request(pipeline,
+                                                                       (uint64_t)i,
+                                                                       argv[i + 2],
+                                                                       config,
+                                                                       NULL,
+                                                                       &handles[i]));
+    }
+
+    // The requests are processed together, the new tokens of each of them are read from its handle after every step.
+    // Alternatively, ov_genai_continuous_batching_pipeline_start_engine_loop() steps the pipeline on a background
+    // thread and calls the completion callbacks passed to add_request.
+    while (has_requests) {
+        CHECK_STATUS(ov_genai_continuous_batching_pipeline_step(pipeline));
+        for (size_t i = 0; i < num_prompts; i++) {
+            size_t new_tokens = MAX_NEW_TOKENS - num_tokens[i];
+            CHECK_STATUS(ov_genai_generation_handle_read(handles[i], tokens[i] + num_tokens[i], &new_tokens));
+            num_tokens[i] += new_tokens;
+        }
+        CHECK_STATUS(ov_genai_continuous_batching_pipeline_has_non_finished_requests(pipeline, &has_requests));
+    }
+
+    for (size_t i = 0; i < num_prompts; i++) {
+        // The function is called with NULL as the output to determine the required buffer size.
+        CHECK_STATUS(ov_genai_continuous_batching_pipeline_decode(pipeline, tokens[i], num_tokens[i], NULL, &output_size));
+        output = (char*)malloc(output_size);
+        if (!output) {
+            fprintf(stderr, "Failed to allocate memory for output\n");
+            goto err;
+        }
+        CHECK_STATUS(ov_genai_continuous_batching_pipeline_decode(pipeline, tokens[i], num_tokens[i], output, &output_size));
+        printf("Prompt: %s\nResult: %s\n\n", argv[i + 2], output);
+        free(output);
+        output = NULL;
+    }
+
+    CHECK_STATUS(ov_genai_continuous_batching_pipeline_get_metrics(pipeline, &metrics));
+    printf("Max cache usage: %.2f%%, mean cache usage: %.2f%%\n", metrics.max_cache_usage, metrics.avg_cache_usage);
+    exit_code = EXIT_SUCCESS;
+
+err:
+    if (handles) {
+        for (size_t i = 0; i < num_prompts; i++) {
+            if (handles[i])
+                ov_genai_generation_handle_free(handles[i]);
+        }
+        free(handles);
+    }
+    if (tokens) {
+        for (size_t i = 0; i < num_prompts; i++) {
+            if (tokens[i])
+                free(tokens[i]);
+        }
+        free(tokens);
+    }
+    if (num_tokens)
+        free(num_tokens);
+    if (pipeline)
+        ov_genai_continuous_batching_pipeline_free(pipeline);
+    if (scheduler_config)
+        ov_genai_scheduler_config_free(scheduler_config);
+    if (config)
+        ov_genai_generation_config_free(config);
+    if (output)
+        free(output);
+
+    return exit_code;
+}
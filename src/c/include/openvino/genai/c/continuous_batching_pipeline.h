@@ -0,0 +1,296 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief This is a header file for OpenVINO GenAI C API, which is a C wrapper for
+ * ov::genai::ContinuousBatchingPipeline class.
+ *
+ * @file continuous_batching_pipeline.h
+ */
+
+#pragma once
+#include "generation_config.h"
+
+/**
+ * @struct ov_genai_scheduler_config
+ * @brief type define ov_genai_scheduler_config from ov_genai_scheduler_config_opaque
+ */
+typedef struct ov_genai_scheduler_config_opaque ov_genai_scheduler_config;
+
+/**
+ * @brief Create ov_genai_scheduler_config with the default values.
+ * @param config A pointer to the newly created ov_genai_scheduler_config.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_scheduler_config_create(ov_genai_scheduler_config** config);
+
+/**
+ * @brief Release the memory allocated by ov_genai_scheduler_config.
+ * @param config A pointer to the ov_genai_scheduler_config to free memory.
+ */
+OPENVINO_GENAI_C_EXPORTS void ov_genai_scheduler_config_free(ov_genai_scheduler_config* config);
+
+/**
+ * @brief Set the size of the KV cache in GB, 0 means the size is taken from the free device memory.
+ * @param config A pointer to the ov_genai_scheduler_config instance.
+ * @param value The size of the KV cache in GB.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_scheduler_config_set_cache_size(ov_genai_scheduler_config* config,
+                                                                              const size_t value);
+
+/**
+ * @brief Set the maximum number of tokens batched by a generation step.
+ * @param config A pointer to the ov_genai_scheduler_config instance.
+ * @param value The maximum number of tokens.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_scheduler_config_set_max_num_batched_tokens(ov_genai_scheduler_config* config, const size_t value);
+
+/**
+ * @brief Set the maximum number of sequences processed by a generation step.
+ * @param config A pointer to the ov_genai_scheduler_config instance.
+ * @param value The maximum number of sequences.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_scheduler_config_set_max_num_seqs(ov_genai_scheduler_config* config,
+                                                                                const size_t value);
+
+/**
+ * @brief Set whether the KV cache of the prompts is reused by the requests with the same prefix.
+ * @param config A pointer to the ov_genai_scheduler_config instance.
+ * @param value If set to true, prefix caching is enabled.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_scheduler_config_set_enable_prefix_caching(ov_genai_scheduler_config* config, const bool value);
+
+/**
+ * @brief Set whether the prompts are split to chunks, which are batched with the generated tokens of other requests.
+ * @param config A pointer to the ov_genai_scheduler_config instance.
+ * @param value If set to true, dynamic split fuse is enabled.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_scheduler_config_set_dynamic_split_fuse(ov_genai_scheduler_config* config, const bool value);
+
+/**
+ * @brief Status of a request, see ov::genai::GenerationStatus.
+ */
+typedef enum {
+    OV_GENAI_GENERATION_STATUS_RUNNING = 0,  // Default status for ongoing generation
+    OV_GENAI_GENERATION_STATUS_FINISHED = 1,  // Status set when generation has been finished
+    OV_GENAI_GENERATION_STATUS_IGNORED = 2,  // Status set when generation run into out-of-memory condition and could not
+                                             // be continued
+    OV_GENAI_GENERATION_STATUS_CANCEL = 3,  // Status set when generation handle is cancelled, the prompt and the
+                                            // generated tokens are dropped from the history
+    OV_GENAI_GENERATION_STATUS_STOP = 4  // Status set when generation handle is stopped
+} ov_genai_generation_status_e;
+
+/**
+ * @brief Metrics of ov_genai_continuous_batching_pipeline as of the previous generation step.
+ */
+typedef struct {
+    size_t requests;               //!< Number of the non finished requests
+    size_t scheduled_requests;     //!< Number of the requests scheduled for the previous step
+    size_t scheduled_prompt_tokens;    //!< Number of the prompt tokens scheduled for the previous step
+    size_t scheduled_generate_tokens;  //!< Number of the generated tokens scheduled for the previous step
+    float cache_usage;             //!< KV cache usage in percent
+    float max_cache_usage;         //!< Max KV cache usage in percent over the previous generate() or the engine loop
+    float avg_cache_usage;         //!< Mean KV cache usage in percent over the previous generate() or the engine loop
+    float inference_duration;      //!< Duration of the inference of the previous step in microseconds
+    float prefix_cache_hit_rate;   //!< Percentage of the prompt tokens restored from the prefix cache
+} ov_genai_pipeline_metrics;
+
+/**
+ * @struct ov_genai_generation_handle
+ * @brief type define ov_genai_generation_handle from ov_genai_generation_handle_opaque
+ */
+typedef struct ov_genai_generation_handle_opaque ov_genai_generation_handle;
+
+/**
+ * @brief Release the memory allocated by ov_genai_generation_handle. The request keeps running in the pipeline until
+ * it is finished, unless it has been cancelled or stopped before.
+ * @param handle A pointer to the ov_genai_generation_handle to free memory.
+ */
+OPENVINO_GENAI_C_EXPORTS void ov_genai_generation_handle_free(ov_genai_generation_handle* handle);
+
+/**
+ * @brief Get the status of the request. Doesn't block.
+ * @param handle A pointer to the ov_genai_generation_handle instance.
+ * @param status A pointer to the status of the request.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_generation_handle_get_status(const ov_genai_generation_handle* handle,
+                                                                           ov_genai_generation_status_e* status);
+
+/**
+ * @brief Read the tokens generated since the previous read. Doesn't block. Only greedy or multinomial decoding with
+ * num_return_sequences=1 is supported by this function.
+ * @param handle A pointer to the ov_genai_generation_handle instance.
+ * @param tokens A pointer to the pre-allocated buffer of the tokens. It can be set to NULL, in which case *tokens_size
+ * provides the number of the new tokens, which are kept by the handle for the next call.
+ * @param tokens_size A pointer to the size of the buffer in tokens. If tokens is not NULL, *tokens_size should be
+ * greater than or equal to the number of the new tokens; otherwise, the function will return OUT_OF_BOUNDS(-6). Set to
+ * the number of the written tokens.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_generation_handle_read(ov_genai_generation_handle* handle,
+                                                                     int64_t* tokens,
+                                                                     size_t* tokens_size);
+
+/**
+ * @brief Stop the request, the generated tokens are kept in the history.
+ * @param handle A pointer to the ov_genai_generation_handle instance.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_generation_handle_stop(ov_genai_generation_handle* handle);
+
+/**
+ * @brief Cancel the request, the prompt and the generated tokens are dropped from the history.
+ * @param handle A pointer to the ov_genai_generation_handle instance.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_generation_handle_cancel(ov_genai_generation_handle* handle);
+
+/**
+ * @brief Structure for the completion callback of a request with arguments.
+ *
+ * The callback function is called on the engine loop thread once the request has finished, it takes the parameters:
+ * - `uint64_t request_id`: The id of the request passed to add_request.
+ * - `ov_genai_generation_status_e status`: The final status of the request.
+ * - `void* args`: A pointer to additional arguments, allowing flexible data passing.
+ */
+typedef struct {
+    void(OPENVINO_C_API_CALLBACK* callback_func)(uint64_t request_id,
+                                                 ov_genai_generation_status_e status,
+                                                 void* args);  //!< Pointer to the callback function
+    void* args;  //!< Pointer to the arguments passed to the callback function
+} ov_genai_completion_callback;
+
+/**
+ * @struct ov_genai_continuous_batching_pipeline
+ * @brief type define ov_genai_continuous_batching_pipeline from ov_genai_continuous_batching_pipeline_opaque
+ */
+typedef struct ov_genai_continuous_batching_pipeline_opaque ov_genai_continuous_batching_pipeline;
+
+/**
+ * @brief Construct ov_genai_continuous_batching_pipeline.
+ *
+ * Initializes a ov_genai_continuous_batching_pipeline instance from the specified model directory and device. Optional
+ * property parameters can be passed as key-value pairs.
+ *
+ * @param models_path Path to the directory containing the model files.
+ * @param scheduler_config A pointer to the ov_genai_scheduler_config, the default config is used if NULL.
+ * @param device Name of a device to load a model to.
+ * @param property_args_size How many properties args will be passed, each property contains 2 args: key and value.
+ * @param pipe A pointer to the newly created ov_genai_continuous_batching_pipeline.
+ * @param ... property parameter: Optional pack of pairs: <char* property_key, char* property_value> relevant only
+ * @return ov_status_e A status code, return OK(0) if successful.
+ *
+ * @example
+ * ov_genai_continuous_batching_pipeline_create(model_path, scheduler_config, "CPU", 0, &pipe);
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_create(const char* models_path,
+                                             const ov_genai_scheduler_config* scheduler_config,
+                                             const char* device,
+                                             const size_t property_args_size,
+                                             ov_genai_continuous_batching_pipeline** pipe,
+                                             ...);
+
+/**
+ * @brief Release the memory allocated by ov_genai_continuous_batching_pipeline. Stops the engine loop, if it's running.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline to free memory.
+ */
+OPENVINO_GENAI_C_EXPORTS void ov_genai_continuous_batching_pipeline_free(ov_genai_continuous_batching_pipeline* pipe);
+
+/**
+ * @brief Add a request to the pipeline. Blocks while the limits of the engine loop are reached, if it's running.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param request_id The id of the request, must be unique for every add_request call.
+ * @param prompt A pointer to the prompt string.
+ * @param config A pointer to the ov_genai_generation_config, the generation config of the model is used if NULL.
+ * @param on_completion A pointer to the completion callback, which requires the engine loop to be started. Set to NULL
+ * if no callback is needed.
+ * @param handle A pointer to the newly created ov_genai_generation_handle of the request.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_add_request(ov_genai_continuous_batching_pipeline* pipe,
+                                                  uint64_t request_id,
+                                                  const char* prompt,
+                                                  const ov_genai_generation_config* config,
+                                                  const ov_genai_completion_callback* on_completion,
+                                                  ov_genai_generation_handle** handle);
+
+/**
+ * @brief Run a generation step for all the non finished requests. Must not be called while the engine loop is running.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_step(ov_genai_continuous_batching_pipeline* pipe);
+
+/**
+ * @brief Check whether the pipeline has non finished requests.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param has_requests A pointer to the result.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_has_non_finished_requests(ov_genai_continuous_batching_pipeline* pipe,
+                                                                bool* has_requests);
+
+/**
+ * @brief Start the background thread, which steps the pipeline while it has non finished requests, so that the
+ * requests are only added and their handles are polled or their completion callbacks are waited for.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param max_num_requests Max number of non finished requests, above which add_request blocks, 0 means no limit.
+ * @param max_cache_usage KV cache usage in percent, above which add_request blocks, 100 means no limit.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_start_engine_loop(ov_genai_continuous_batching_pipeline* pipe,
+                                                        const size_t max_num_requests,
+                                                        const float max_cache_usage);
+
+/**
+ * @brief Stop the engine loop after the current step, the non finished requests stay in the pipeline.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @return ov_status_e A status code, return OK(0) if successful, or UNKNOW_EXCEPTION if a step of the engine loop has
+ * failed.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_stop_engine_loop(ov_genai_continuous_batching_pipeline* pipe);
+
+/**
+ * @brief Get the metrics of the pipeline. Thread safe.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param metrics A pointer to the metrics to fill.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_get_metrics(const ov_genai_continuous_batching_pipeline* pipe,
+                                                  ov_genai_pipeline_metrics* metrics);
+
+/**
+ * @brief Decode the tokens read from a handle to a string.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param tokens A pointer to the tokens.
+ * @param tokens_size The number of the tokens.
+ * @param output A pointer to the pre-allocated output string buffer. It can be set to NULL, in which case the
+ * *output_size will provide the needed buffer size.
+ * @param output_size A Pointer to the size of the output string, including the null terminator. If output is not NULL,
+ * *output_size should be greater than or equal to the string size; otherwise, the function will return
+ * OUT_OF_BOUNDS(-6).
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e
+ov_genai_continuous_batching_pipeline_decode(const ov_genai_continuous_batching_pipeline* pipe,
+                                             const int64_t* tokens,
+                                             const size_t tokens_size,
+                                             char* output,
+                                             size_t* output_size);
@@ -142,6 +142,56 @@ OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_llm_pipeline_generate(ov_genai_llm
                                                                     const ov_genai_generation_config* config,
                                                                     const streamer_callback* streamer,
                                                                     ov_genai_decoded_results** results);
+/**
+ * @brief Generate the token ids for a batch of prompts by ov_genai_llm_pipeline into a caller-provided buffer, without
+ * allocating the results or detokenizing them. The prompts are processed as a single batch, the chat template is applied
+ * as by ov_genai_llm_pipeline_generate.
+ * @param pipe A pointer to the ov_genai_llm_pipeline instance.
+ * @param inputs An array of the input strings.
+ * @param inputs_size The number of the input strings.
+ * @param config A pointer to the ov_genai_generation_config, the generation config of the pipeline is used if NULL.
+ * @param tokens A pointer to the pre-allocated buffer of inputs_size * num_return_sequences rows of max_tokens token ids,
+ * the tokens of the j-th sequence generated for the i-th input start at (i * num_return_sequences + j) * max_tokens.
+ * @param max_tokens The capacity of a row in tokens, it should be greater than or equal to max_new_tokens of the config;
+ * otherwise, the function will return OUT_OF_BOUNDS(-6) before generating.
+ * @param tokens_sizes A pointer to the pre-allocated array of inputs_size * num_return_sequences elements, set to the
+ * number of the tokens written to each row.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_llm_pipeline_generate_batch(ov_genai_llm_pipeline* pipe,
+                                                                          const char** inputs,
+                                                                          const size_t inputs_size,
+                                                                          const ov_genai_generation_config* config,
+                                                                          int64_t* tokens,
+                                                                          const size_t max_tokens,
+                                                                          size_t* tokens_sizes);
+
+/**
+ * @brief Decode a batch of token id rows, e.g. the ones written by ov_genai_llm_pipeline_generate_batch, to
+ * null-terminated strings placed one after another in a caller-provided buffer.
+ * @param pipe A pointer to the ov_genai_llm_pipeline instance.
+ * @param tokens A pointer to the rows of max_tokens token ids.
+ * @param max_tokens The capacity of a row in tokens.
+ * @param tokens_sizes A pointer to the number of the tokens in each row.
+ * @param rows The number of the rows.
+ * @param output A pointer to the pre-allocated output buffer. It can be set to NULL, in which case the *output_size
+ * will provide the needed buffer size.
+ * @param output_size A pointer to the size of the output buffer, including the null terminators of all the strings. If
+ * output is not NULL, *output_size should be greater than or equal to the needed size; otherwise, the function will
+ * return OUT_OF_BOUNDS(-6).
+ * @param output_offsets A pointer to the pre-allocated array of rows elements, set to the offset of each string in
+ * output. It can be set to NULL if the offsets aren't needed.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_llm_pipeline_decode_batch(const ov_genai_llm_pipeline* pipe,
+                                                                        const int64_t* tokens,
+                                                                        const size_t max_tokens,
+                                                                        const size_t* tokens_sizes,
+                                                                        const size_t rows,
+                                                                        char* output,
+                                                                        size_t* output_size,
+                                                                        size_t* output_offsets);
+
 /**
  * @brief Start chat with keeping history in kv cache.
  * @param pipe A pointer to the ov_genai_llm_pipeline instance.
@@ -0,0 +1,303 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/c/continuous_batching_pipeline.h"
+
+#include <stdarg.h>
+
+#include <filesystem>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "types_c.h"
+
+ov_status_e ov_genai_scheduler_config_create(ov_genai_scheduler_config** config) {
+    if (!config) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::unique_ptr<ov_genai_scheduler_config> _config = std::make_unique<ov_genai_scheduler_config>();
+        _config->object = std::make_shared<ov::genai::SchedulerConfig>();
+        *config = _config.release();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+void ov_genai_scheduler_config_free(ov_genai_scheduler_config* config) {
+    if (config) {
+        delete config;
+    }
+}
+ov_status_e ov_genai_scheduler_config_set_cache_size(ov_genai_scheduler_config* config, const size_t value) {
+    if (!config || !(config->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    config->object->cache_size = value;
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_scheduler_config_set_max_num_batched_tokens(ov_genai_scheduler_config* config,
+                                                                 const size_t value) {
+    if (!config || !(config->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    config->object->max_num_batched_tokens = value;
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_scheduler_config_set_max_num_seqs(ov_genai_scheduler_config* config, const size_t value) {
+    if (!config || !(config->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    config->object->max_num_seqs = value;
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_scheduler_config_set_enable_prefix_caching(ov_genai_scheduler_config* config, const bool value) {
+    if (!config || !(config->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    config->object->enable_prefix_caching = value;
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_scheduler_config_set_dynamic_split_fuse(ov_genai_scheduler_config* config, const bool value) {
+    if (!config || !(config->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    config->object->dynamic_split_fuse = value;
+    return ov_status_e::OK;
+}
+
+void ov_genai_generation_handle_free(ov_genai_generation_handle* handle) {
+    if (handle) {
+        delete handle;
+    }
+}
+ov_status_e ov_genai_generation_handle_get_status(const ov_genai_generation_handle* handle,
+                                                  ov_genai_generation_status_e* status) {
+    if (!handle || !(handle->object) || !status) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *status = static_cast<ov_genai_generation_status_e>(handle->object->get_status());
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_generation_handle_read(ov_genai_generation_handle* handle, int64_t* tokens, size_t* tokens_size) {
+    if (!handle || !(handle->object) || !tokens_size) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        // can_read() is checked since read() blocks until the next step otherwise
+        const ov::genai::GenerationHandle& generation_handle = handle->object;
+        while (!generation_handle->is_stopped() && !generation_handle->is_cancelled() && generation_handle->can_read()) {
+            ov::genai::GenerationOutputs outputs = generation_handle->read();
+            OPENVINO_ASSERT(outputs.size() <= 1,
+                            "ov_genai_generation_handle_read supports only one sequence per request, got ",
+                            outputs.size());
+            for (const auto& output : outputs) {
+                const std::vector<int64_t>& generated_ids = output.second.generated_ids;
+                handle->pending_tokens.insert(handle->pending_tokens.end(), generated_ids.begin(), generated_ids.end());
+            }
+        }
+        if (!tokens) {
+            *tokens_size = handle->pending_tokens.size();
+        } else {
+            if (*tokens_size < handle->pending_tokens.size()) {
+                return ov_status_e::OUT_OF_BOUNDS;
+            }
+            std::copy(handle->pending_tokens.begin(), handle->pending_tokens.end(), tokens);
+            *tokens_size = handle->pending_tokens.size();
+            handle->pending_tokens.clear();
+        }
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_generation_handle_stop(ov_genai_generation_handle* handle) {
+    if (!handle || !(handle->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        handle->object->stop();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_generation_handle_cancel(ov_genai_generation_handle* handle) {
+    if (!handle || !(handle->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        handle->object->cancel();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_continuous_batching_pipeline_create(const char* models_path,
+                                                         const ov_genai_scheduler_config* scheduler_config,
+                                                         const char* device,
+                                                         const size_t property_args_size,
+                                                         ov_genai_continuous_batching_pipeline** pipe,
+                                                         ...) {
+    if (!models_path || !device || !pipe || property_args_size % 2 != 0 ||
+        (scheduler_config && !(scheduler_config->object))) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        ov::AnyMap property = {};
+        va_list args_ptr;
+        va_start(args_ptr, pipe);
+        size_t property_size = property_args_size / 2;
+        for (size_t i = 0; i < property_size; i++) {
+            GET_PROPERTY_FROM_ARGS_LIST;
+        }
+        va_end(args_ptr);
+        ov::genai::SchedulerConfig config = scheduler_config ? *(scheduler_config->object) : ov::genai::SchedulerConfig{};
+        std::unique_ptr<ov_genai_continuous_batching_pipeline> _pipe =
+            std::make_unique<ov_genai_continuous_batching_pipeline>();
+        _pipe->object = std::make_shared<ov::genai::ContinuousBatchingPipeline>(std::filesystem::path(models_path),
+                                                                                 config,
+                                                                                 std::string(device),
+                                                                                 property);
+        *pipe = _pipe.release();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+void ov_genai_continuous_batching_pipeline_free(ov_genai_continuous_batching_pipeline* pipe) {
+    if (pipe) {
+        delete pipe;
+    }
+}
+ov_status_e ov_genai_continuous_batching_pipeline_add_request(ov_genai_continuous_batching_pipeline* pipe,
+                                                              uint64_t request_id,
+                                                              const char* prompt,
+                                                              const ov_genai_generation_config* config,
+                                                              const ov_genai_completion_callback* on_completion,
+                                                              ov_genai_generation_handle** handle) {
+    if (!pipe || !(pipe->object) || !prompt || !handle || (config && !(config->object)) ||
+        (on_completion && !(on_completion->callback_func))) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        ov::genai::GenerationConfig generation_config =
+            config ? *(config->object) : pipe->object->get_config();
+        std::unique_ptr<ov_genai_generation_handle> _handle = std::make_unique<ov_genai_generation_handle>();
+        if (on_completion) {
+            auto callback_func = on_completion->callback_func;
+            void* args = on_completion->args;
+            auto callback = [callback_func, args](uint64_t id, const ov::genai::GenerationHandle& generation_handle) {
+                callback_func(id, static_cast<ov_genai_generation_status_e>(generation_handle->get_status()), args);
+            };
+            _handle->object = pipe->object->add_request(request_id, std::string(prompt), generation_config, callback);
+        } else {
+            _handle->object = pipe->object->add_request(request_id, std::string(prompt), generation_config);
+        }
+        *handle = _handle.release();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_continuous_batching_pipeline_step(ov_genai_continuous_batching_pipeline* pipe) {
+    if (!pipe || !(pipe->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        pipe->object->step();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_continuous_batching_pipeline_has_non_finished_requests(ov_genai_continuous_batching_pipeline* pipe,
+                                                                            bool* has_requests) {
+    if (!pipe || !(pipe->object) || !has_requests) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *has_requests = pipe->object->has_non_finished_requests();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_continuous_batching_pipeline_start_engine_loop(ov_genai_continuous_batching_pipeline* pipe,
+                                                                    const size_t max_num_requests,
+                                                                    const float max_cache_usage) {
+    if (!pipe || !(pipe->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        ov::genai::EngineLoopConfig config;
+        config.max_num_requests = max_num_requests;
+        config.max_cache_usage = max_cache_usage;
+        pipe->object->start_engine_loop(config);
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_continuous_batching_pipeline_stop_engine_loop(ov_genai_continuous_batching_pipeline* pipe) {
+    if (!pipe || !(pipe->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        pipe->object->stop_engine_loop();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_continuous_batching_pipeline_get_metrics(const ov_genai_continuous_batching_pipeline* pipe,
+                                                              ov_genai_pipeline_metrics* metrics) {
+    if (!pipe || !(pipe->object) || !metrics) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        const ov::genai::PipelineMetrics pipeline_metrics = pipe->object->get_metrics();
+        metrics->requests = pipeline_metrics.requests;
+        metrics->scheduled_requests = pipeline_metrics.scheduled_requests;
+        metrics->scheduled_prompt_tokens = pipeline_metrics.scheduled_prompt_tokens;
+        metrics->scheduled_generate_tokens = pipeline_metrics.scheduled_generate_tokens;
+        metrics->cache_usage = pipeline_metrics.cache_usage;
+        metrics->max_cache_usage = pipeline_metrics.max_cache_usage;
+        metrics->avg_cache_usage = pipeline_metrics.avg_cache_usage;
+        metrics->inference_duration = pipeline_metrics.inference_duration;
+        metrics->prefix_cache_hit_rate = pipeline_metrics.prefix_cache_hit_rate;
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_continuous_batching_pipeline_decode(const ov_genai_continuous_batching_pipeline* pipe,
+                                                         const int64_t* tokens,
+                                                         const size_t tokens_size,
+                                                         char* output,
+                                                         size_t* output_size) {
+    if (!pipe || !(pipe->object) || (!tokens && tokens_size > 0) || !output_size) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::vector<int64_t> token_ids(tokens, tokens + tokens_size);
+        std::string str = pipe->object->get_tokenizer().decode(token_ids);
+        if (!output) {
+            *output_size = str.length() + 1;
+        } else {
+            if (*output_size < str.length() + 1) {
+                return ov_status_e::OUT_OF_BOUNDS;
+            }
+            strncpy(output, str.c_str(), str.length() + 1);
+            output[str.length()] = '\0';
+            *output_size = str.length() + 1;
+        }
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
@@ -7,6 +7,7 @@
 #include "openvino/genai/llm_pipeline.hpp"
 #include "types_c.h"
 #include <stdarg.h>
+#include <cstring>
 
 ov_status_e ov_genai_decoded_results_create(ov_genai_decoded_results** results) {
     if (!results) {
@@ -192,3 +193,99 @@ ov_status_e ov_genai_llm_pipeline_set_generation_config(ov_genai_llm_pipeline* p
     }
     return ov_status_e::OK;
 }
+ov_status_e ov_genai_llm_pipeline_generate_batch(ov_genai_llm_pipeline* pipe,
+                                                 const char** inputs,
+                                                 const size_t inputs_size,
+                                                 const ov_genai_generation_config* config,
+                                                 int64_t* tokens,
+                                                 const size_t max_tokens,
+                                                 size_t* tokens_sizes) {
+    if (!pipe || !(pipe->object) || !inputs || inputs_size == 0 || (config && !(config->object)) || !tokens ||
+        !tokens_sizes) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        ov::genai::GenerationConfig generation_config =
+            config ? *(config->object) : pipe->object->get_generation_config();
+        if (generation_config.get_max_new_tokens() > max_tokens) {
+            return ov_status_e::OUT_OF_BOUNDS;
+        }
+        ov::genai::Tokenizer tokenizer = pipe->object->get_tokenizer();
+        // the same encoding as LLMPipeline::generate() applies to a batch of strings
+        std::vector<std::string> prompts;
+        prompts.reserve(inputs_size);
+        const bool apply_chat_template = generation_config.apply_chat_template && !tokenizer.get_chat_template().empty();
+        for (size_t i = 0; i < inputs_size; i++) {
+            if (!inputs[i]) {
+                return ov_status_e::INVALID_C_PARAM;
+            }
+            if (apply_chat_template) {
+                ov::genai::ChatHistory history({{{"role", "user"}, {"content", std::string(inputs[i])}}});
+                constexpr bool add_generation_prompt = true;
+                prompts.push_back(tokenizer.apply_chat_template(history, add_generation_prompt));
+            } else {
+                prompts.emplace_back(inputs[i]);
+            }
+        }
+        ov::genai::TokenizedInputs encoded_inputs =
+            tokenizer.encode(prompts, ov::genai::add_special_tokens(!apply_chat_template));
+        ov::genai::EncodedResults results = pipe->object->generate(encoded_inputs, generation_config);
+        for (size_t row = 0; row < results.tokens.size(); row++) {
+            const std::vector<int64_t>& row_tokens = results.tokens[row];
+            if (row_tokens.size() > max_tokens) {
+                return ov_status_e::OUT_OF_BOUNDS;
+            }
+            std::copy(row_tokens.begin(), row_tokens.end(), tokens + row * max_tokens);
+            tokens_sizes[row] = row_tokens.size();
+        }
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+ov_status_e ov_genai_llm_pipeline_decode_batch(const ov_genai_llm_pipeline* pipe,
+                                               const int64_t* tokens,
+                                               const size_t max_tokens,
+                                               const size_t* tokens_sizes,
+                                               const size_t rows,
+                                               char* output,
+                                               size_t* output_size,
+                                               size_t* output_offsets) {
+    if (!pipe || !(pipe->object) || !tokens || !tokens_sizes || !output_size) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::vector<std::vector<int64_t>> batch_tokens(rows);
+        for (size_t row = 0; row < rows; row++) {
+            if (tokens_sizes[row] > max_tokens) {
+                return ov_status_e::INVALID_C_PARAM;
+            }
+            const int64_t* row_tokens = tokens + row * max_tokens;
+            batch_tokens[row].assign(row_tokens, row_tokens + tokens_sizes[row]);
+        }
+        const std::vector<std::string> texts = pipe->object->get_tokenizer().decode(batch_tokens);
+        size_t total_size = 0;
+        for (const std::string& text : texts) {
+            total_size += text.length() + 1;
+        }
+        if (!output) {
+            *output_size = total_size;
+        } else {
+            if (*output_size < total_size) {
+                return ov_status_e::OUT_OF_BOUNDS;
+            }
+            size_t offset = 0;
+            for (size_t row = 0; row < texts.size(); row++) {
+                if (output_offsets) {
+                    output_offsets[row] = offset;
+                }
+                std::memcpy(output + offset, texts[row].c_str(), texts[row].length() + 1);
+                offset += texts[row].length() + 1;
+            }
+            *output_size = total_size;
+        }
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
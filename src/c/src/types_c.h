@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_config.hpp"
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/whisper_pipeline.hpp"
@@ -111,3 +112,29 @@ struct ov_genai_whisper_generation_config_opaque {
 struct ov_genai_whisper_pipeline_opaque {
     std::shared_ptr<ov::genai::WhisperPipeline> object;
 };
+
+/**
+ * @struct ov_genai_scheduler_config_opaque
+ * @brief This is an interface of ov::genai::SchedulerConfig
+ */
+struct ov_genai_scheduler_config_opaque {
+    std::shared_ptr<ov::genai::SchedulerConfig> object;
+};
+
+/**
+ * @struct ov_genai_continuous_batching_pipeline_opaque
+ * @brief This is an interface of ov::genai::ContinuousBatchingPipeline
+ */
+struct ov_genai_continuous_batching_pipeline_opaque {
+    std::shared_ptr<ov::genai::ContinuousBatchingPipeline> object;
+};
+
+/**
+ * @struct ov_genai_generation_handle_opaque
+ * @brief This is an interface of ov::genai::GenerationHandle
+ */
+struct ov_genai_generation_handle_opaque {
+    ov::genai::GenerationHandle object;
+    // tokens read from the handle by a size query, which are returned by the next read
+    std::vector<int64_t> pending_tokens;
+};
@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Enables the caching of the compiled models in the directory for every model compiled by the library after the
+ * call, i.e. for the models of all pipelines together with the tokenizer, detokenizer and embedding models and the models
+ * built in memory (GGUF, transformed tokenizers), for which the cache entries are keyed by the hash of the graph.
+ * The directory is used unless a pipeline sets its own ov::cache_dir in the properties. An empty path disables caching.
+ * The default directory is taken from the OPENVINO_GENAI_CACHE_DIR environment variable, caching is disabled without it.
+ */
+OPENVINO_GENAI_EXPORTS void set_compiled_model_cache_dir(const std::filesystem::path& cache_dir);
+
+/**
+ * @brief Returns the directory set by set_compiled_model_cache_dir() or OPENVINO_GENAI_CACHE_DIR, empty if the caching
+ * of the compiled models is disabled.
+ */
+OPENVINO_GENAI_EXPORTS std::filesystem::path get_compiled_model_cache_dir();
+
+}  // namespace genai
+}  // namespace ov
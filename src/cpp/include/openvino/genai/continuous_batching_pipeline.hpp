@@ -4,9 +4,13 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include <openvino/runtime/tensor.hpp>
 
@@ -38,6 +42,16 @@ struct PipelineMetrics {
      */
     size_t scheduled_requests = 0;
 
+    /**
+     * Number of prompt tokens that were scheduled for processing at the previous step of the pipeline.
+     */
+    size_t scheduled_prompt_tokens = 0;
+
+    /**
+     * Number of generation phase tokens that were scheduled for processing at the previous step of the pipeline.
+     */
+    size_t scheduled_generate_tokens = 0;
+
     /**
     * Percentage of KV cache usage in the last generation step.
     */
@@ -57,8 +71,246 @@ struct PipelineMetrics {
      * Duration of the last generation step in microseconds.
      */
     float inference_duration = 0.0;
+
+    /**
+    * Percentage of the prompt tokens of all requests added to the pipeline, for which the KV cache was restored from the prefix cache
+    */
+    float prefix_cache_hit_rate = 0.0;
+
+    /**
+    * Max number of prompt tokens restored from the prefix cache for a single request
+    */
+    size_t max_prefix_cache_hit_depth = 0;
+
+    /**
+    * Peak size in bytes of the KV cache blocks used by the requests during the lifetime of the pipeline
+    */
+    size_t peak_kv_cache_used_bytes = 0;
+
+    /**
+    * Peak size in bytes of the allocated KV cache during the lifetime of the pipeline
+    */
+    size_t peak_kv_cache_allocated_bytes = 0;
+
+    /**
+    * Peak of the total memory of the memory report during the lifetime of the pipeline, see MemoryReport::get_total_bytes()
+    */
+    size_t peak_memory_bytes = 0;
+};
+
+/**
+ * @brief Snapshot of a histogram of the values recorded by the pipeline since its creation. Like in HDR histograms,
+ * each power of 2 is split into 8 buckets, so that the memory is bounded and the percentiles are within 12.5% of
+ * the recorded values.
+ */
+struct OPENVINO_GENAI_EXPORTS HistogramSnapshot {
+    /**
+     * Number of the recorded values
+     */
+    size_t count = 0;
+
+    /**
+     * Sum of the recorded values
+     */
+    double sum = 0.0;
+
+    float min = 0.0f;
+    float max = 0.0f;
+
+    /**
+     * Upper bounds of the non-empty buckets in the increasing order along with the number of the values in them
+     */
+    std::vector<std::pair<float, size_t>> buckets;
+
+    /**
+     * @param percent Percent of the values, e.g. 99 for p99.
+     * @return The upper bound of the bucket of the value, which isn't exceeded by the given percent of the values,
+     * 0 if no values were recorded.
+     */
+    float get_percentile(float percent) const;
+
+    float get_mean() const;
+};
+
+/**
+ * @brief Cumulative metrics for the monitoring of a long running server. Unlike PipelineMetrics they cover the whole
+ * lifetime of the pipeline, the latencies are in microseconds and the ratios are in percent.
+ */
+struct OPENVINO_GENAI_EXPORTS ServingMetrics {
+    /**
+     * Time from add_request() to the first generated token of a request
+     */
+    HistogramSnapshot ttft;
+
+    /**
+     * Time between the consecutive generated tokens of a request
+     */
+    HistogramSnapshot inter_token_latency;
+
+    /**
+     * Time from add_request() to the first scheduling of a request
+     */
+    HistogramSnapshot queue_time;
+
+    /**
+     * Percentage of the prompt tokens of a request restored from the prefix cache, recorded if prefix caching is enabled
+     */
+    HistogramSnapshot prefix_cache_hit_ratio;
+
+    /**
+     * KV cache usage at each generation step
+     */
+    HistogramSnapshot cache_usage;
+
+    /**
+     * Number of the times the KV cache of a request was preempted to free the blocks for other requests
+     */
+    size_t num_preemptions = 0;
+
+    /**
+     * Number of the requests finished, stopped or cancelled
+     */
+    size_t num_finished_requests = 0;
+
+    /**
+     * @return The metrics in Prometheus text exposition format, the histograms are exposed as summaries with 0.5, 0.9,
+     * 0.95 and 0.99 quantiles.
+     * @param prefix Prefix of the names of the metrics.
+     */
+    std::string to_prometheus(const std::string& prefix = "ov_genai") const;
 };
 
+/**
+ * @brief Breakdown of the memory taken by the pipeline in bytes, e.g. to size SchedulerConfig::cache_size so that
+ * the weights and the KV cache fit in the device memory.
+ */
+struct OPENVINO_GENAI_EXPORTS MemoryReport {
+    /**
+     * Size of the constants of the compiled models by the model names, e.g. "language" or "draft_language"
+     */
+    std::map<std::string, size_t> weights;
+
+    /**
+     * Size of the KV cache allocated on the device
+     */
+    size_t kv_cache_allocated = 0;
+
+    /**
+     * Size of the KV cache blocks used by the requests, a part of kv_cache_allocated
+     */
+    size_t kv_cache_used = 0;
+
+    /**
+     * Size of the free KV cache blocks holding the prefixes reusable by prefix caching, a part of kv_cache_allocated
+     */
+    size_t prefix_cache = 0;
+
+    /**
+     * Size of the host memory tier of the KV cache swap space
+     */
+    size_t kv_cache_swap_space = 0;
+
+    /**
+     * Size of the host buffers staging the inputs of the models
+     */
+    size_t input_buffers = 0;
+
+    /**
+     * Size of the cached embeddings of the images, see ov::genai::vision_embedding_cache_size
+     */
+    size_t vision_embedding_cache = 0;
+
+    /**
+     * @return The sum of the sizes of the weights, the allocated KV cache, the swap space, the input buffers and the vision
+     * embedding cache.
+     */
+    size_t get_total_bytes() const;
+};
+
+/**
+ * @brief Compact summary of the KV cache blocks kept by prefix caching of a pipeline, e.g. for a router to send a request
+ * to the replica of the pipeline with the longest cached prefix of its prompt. The hashes of the blocks are kept in
+ * a bloom filter, which may report a block not cached with a probability below 0.1%, but never misses a cached one.
+ */
+struct OPENVINO_GENAI_EXPORTS PrefixCacheDigest {
+    /**
+     * Number of tokens per KV cache block of the pipeline
+     */
+    size_t block_size = 0;
+
+    /**
+     * Number of the hashes of the KV cache blocks added to the bloom filter
+     */
+    size_t num_blocks = 0;
+
+    /**
+     * Bits of the bloom filter
+     */
+    std::vector<uint64_t> bloom_filter;
+
+    PrefixCacheDigest() = default;
+    PrefixCacheDigest(size_t block_size, const std::vector<uint64_t>& block_hashes);
+
+    /**
+     * Computes the hashes of the full KV cache blocks of a prompt the same way as the pipelines with this block size do,
+     * without a pipeline, e.g. once per request for the digests of all the replicas. The prompts of the requests applying
+     * LoRA adapters with AdapterConfig::MODE_POOL are hashed differently.
+     * @return The hashes of the blocks in the order of the prompt, each one depends on the tokens of the previous blocks.
+     */
+    static std::vector<uint64_t> get_block_hashes(const std::vector<int64_t>& token_ids, size_t block_size);
+
+    /**
+     * @return Whether the KV cache block with the hash is likely kept by prefix caching.
+     */
+    bool contains(uint64_t block_hash) const;
+
+    /**
+     * @param block_hashes The hashes of the blocks of a prompt, see get_block_hashes.
+     * @return The number of the leading blocks of the prompt likely kept by prefix caching.
+     */
+    size_t get_num_cached_blocks(const std::vector<uint64_t>& block_hashes) const;
+};
+
+/**
+ * @brief Limits of the engine loop of ContinuousBatchingPipeline, above which add_request blocks until some of the
+ * requests are finished. A single request is always admitted.
+ */
+struct EngineLoopConfig {
+    /**
+     * Max number of non finished requests, 0 means no limit
+     */
+    size_t max_num_requests = 0;
+
+    /**
+     * KV cache usage in percent, after which new requests are not admitted
+     */
+    float max_cache_usage = 100.0f;
+};
+
+/**
+ * @brief Called by the engine loop of ContinuousBatchingPipeline on its thread once the request has finished,
+ * e.g. to read the results from the handle.
+ */
+using GenerationCompletionCallback = std::function<void(uint64_t request_id, const GenerationHandle& handle)>;
+
+/**
+ * @brief New outputs of a request after a step of the engine loop of ContinuousBatchingPipeline.
+ */
+struct EngineStepOutput {
+    uint64_t request_id;
+    // the tokens generated by the step per sequence id, the scores and the finish reasons are the latest ones
+    GenerationOutputs outputs;
+    // the request has finished unless the status is RUNNING
+    GenerationStatus status;
+};
+
+/**
+ * @brief Called by the engine loop of ContinuousBatchingPipeline on its thread once per step with the new outputs of
+ * all the requests added without callbacks, so that a caller with a lock to take, e.g. a Python interpreter lock,
+ * takes it once per step rather than once per request or per token.
+ */
+using EngineStepCallback = std::function<void(const std::vector<EngineStepOutput>& outputs)>;
+
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
 protected:
     class IContinuousBatchingPipeline;
@@ -74,7 +326,11 @@ protected:
     friend class SpeculativeDecodingImpl;
     friend class PromptLookupImpl;
 
+    class EngineLoop;
+
     std::shared_ptr<IContinuousBatchingPipeline> m_impl;
+    // the background thread stepping the pipeline, set by start_engine_loop()
+    std::shared_ptr<EngineLoop> m_engine_loop;
 
     ContinuousBatchingPipeline() = default;
 
@@ -162,15 +418,101 @@ public:
      */
     ov::genai::PipelineMetrics get_metrics() const;
 
+    /**
+     * Allows to pull the cumulative serving metrics, e.g. by a monitoring endpoint. Thread safe.
+     * @return The histograms of the latencies and of the KV cache usage since the creation of the pipeline.
+     */
+    ov::genai::ServingMetrics get_serving_metrics() const;
+
+    /**
+     * Allows to get the memory taken by the weights, the KV cache and the host buffers of the pipeline. Thread safe.
+     * @return The memory report as of the previous generation step.
+     */
+    ov::genai::MemoryReport get_memory_report() const;
+
+    /**
+     * Exports the KV cache blocks of a processed prompt for disaggregated prefill and decode, e.g. after the generation
+     * of a single token from the prompt by this pipeline, so that another pipeline of the same model, device and KV cache
+     * configuration decodes it without recomputing the prompt, see import_kv_blocks. The blocks are transferred by
+     * the user, e.g. over a socket or a shared memory, in the format of SchedulerConfig::prefix_cache_path.
+     * Requires prefix caching, the blocks of the longest prefix of the prompt still kept in the prefix cache are exported.
+     * Must not be called concurrently with step() or while the engine loop is running.
+     * @param input_ids The tokens of the prompt, [1, sequence_length] tensor of i64.
+     * @return The serialized KV cache blocks.
+     */
+    std::vector<uint8_t> export_kv_blocks(const ov::Tensor& input_ids);
+
+    /**
+     * Imports the KV cache blocks exported by export_kv_blocks of another pipeline into the prefix cache, so that
+     * the KV cache of the prompts added afterwards is restored from them and only the rest of the prompt is computed.
+     * Requires prefix caching, the blocks are imported into the free KV cache blocks.
+     * Must not be called concurrently with step() or while the engine loop is running.
+     * @param kv_blocks The serialized KV cache blocks.
+     * @return The number of the imported blocks, the blocks already in the prefix cache are not counted.
+     */
+    size_t import_kv_blocks(const std::vector<uint8_t>& kv_blocks);
+
+    /**
+     * Summarizes the KV cache blocks kept by prefix caching, e.g. to be published to a router balancing the requests
+     * between the replicas of the pipeline by their cached prefixes, see PrefixCacheDigest::get_num_cached_blocks.
+     * Requires prefix caching. Must not be called concurrently with step() or while the engine loop is running.
+     * @return The digest of the hashes of the cached KV cache blocks.
+     */
+    PrefixCacheDigest get_prefix_cache_digest();
+
+    /**
+     * Moves the KV cache blocks in use to the beginning of the KV cache and releases the memory of the free blocks after
+     * them, e.g. after the load has dropped. The blocks reusable by prefix caching are kept. Has effect only with
+     * the dynamic KV cache allocation, i.e. if both num_kv_blocks and cache_size of SchedulerConfig are zero, the cache
+     * grows again on demand. Must not be called concurrently with step() or while the engine loop is running.
+     * @return The number of the KV cache blocks left.
+     */
+    size_t shrink_kv_cache();
+
     /// @param request_id must be unique for every add_request() call.
     GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const std::vector<ov::Tensor>& images, const ov::genai::GenerationConfig& sampling_params);
 
+    /// @param on_completion called on the engine loop thread once the request has finished, requires the engine loop to be started.
+    GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params, GenerationCompletionCallback on_completion);
+    GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params, GenerationCompletionCallback on_completion);
+
+    /// @param streamer called on the text streaming thread with the new text of the request, which is stopped or cancelled if the status returned is not RUNNING.
+    /// The new tokens of all the streamed requests are detokenized at once after each step of the engine loop, which reads the outputs of the request,
+    /// the handle is only meant for the status then. Streaming is possible only for greedy or multinomial decoding with num_return_sequences=1.
+    /// @param on_completion called on the text streaming thread after the last text of the request, may be empty.
+    GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params,
+                                 std::function<StreamingStatus(std::string)> streamer, GenerationCompletionCallback on_completion);
+    GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params,
+                                 std::function<StreamingStatus(std::string)> streamer, GenerationCompletionCallback on_completion);
+
     void step();
 
     bool has_non_finished_requests();
 
+    /**
+    * @brief Starts the background thread, which steps the pipeline while it has non finished requests, so that
+    * the requests are only added and their handles are read. While the engine loop is running, add_request
+    * blocks if the limits of the config are reached and step() must not be called.
+    * @param config limits of the number of non finished requests and of the KV cache usage.
+    */
+    void start_engine_loop(const EngineLoopConfig& config = {});
+
+    /**
+    * @brief Starts the engine loop, which reads the outputs of the requests added without callbacks and passes them to
+    * `on_step` after each step, the handles of such requests are only meant for the status then.
+    * @param config limits of the number of non finished requests and of the KV cache usage.
+    * @param on_step called on the engine loop thread once per step with the new outputs, if any.
+    */
+    void start_engine_loop(const EngineLoopConfig& config, EngineStepCallback on_step);
+
+    /**
+    * @brief Stops the engine loop after the current step, the non finished requests stay in the pipeline.
+    * Rethrows the exception thrown by a step of the engine loop, if any.
+    */
+    void stop_engine_loop();
+
     /// Higher level interface, which can process multiple prompts in continuous batching manner
     std::vector<EncodedGenerationResult> generate(const std::vector<ov::Tensor>& input_ids, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
     std::vector<GenerationResult> generate(const std::vector<std::string>& prompts, const std::vector<ov::genai::GenerationConfig>& sampling_params, const ov::genai::StreamerVariant& streamer=std::monostate{});
@@ -179,6 +521,13 @@ public:
              const std::vector<std::vector<ov::Tensor>>& images,
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer=std::monostate{});
+    /// @param videos uint8 RGB frames with [NHWC] layout, a tensor per video, for each of the prompts, see ov::genai::videos.
+    std::vector<VLMDecodedResults> generate(
+             const std::vector<std::string>& prompts,
+             const std::vector<std::vector<ov::Tensor>>& images,
+             const std::vector<std::vector<ov::Tensor>>& videos,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer=std::monostate{});
     /**
     * @brief start chat with keeping history in kv cache.
     * @param system_message optional system message.
@@ -189,5 +538,13 @@ public:
     * @brief finish chat and clear kv cache.
     */
     void finish_chat();
+
+    /**
+    * @brief Generates a few tokens greedily for the batches of dummy prompts of each combination of the prompt lengths
+    * and the batch sizes, so that the kernels for these shapes are compiled before the first real requests.
+    * Must not be called while the engine loop is running or in a chat.
+    * @param config the prompt lengths, the batch sizes and the number of the generated tokens.
+    */
+    void warmup(const WarmupConfig& config = {});
 };
 }
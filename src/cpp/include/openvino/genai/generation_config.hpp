@@ -146,6 +146,9 @@ public:
  * @param top_p - if set to float < 1, only the smallest set of most probable tokens with probabilities that add up to top_p or higher are kept for generation.
  * @param top_k the number of highest probability vocabulary tokens to keep for top-k-filtering.
  * @param rng_seed initializes random generator.
+ * @param best_of the number of sequences to sample from a single prompt, of which num_return_sequences with the highest cumulative
+ *        log probability are returned. The prompt is processed once for all of them, and the sequences which can no longer be
+ *        among the returned ones are stopped early. 0 means num_return_sequences.
  *
  * Assisting generation parameters:
  * @param assistant_confidence_threshold the lower token probability of candidate to be validated by main model in case of dynamic strategy candidates number update.
@@ -155,6 +158,16 @@ public:
  * @param structured_output_config if set, the output will be a string constrained by the specified json_schema, regex, or EBNF grammar.
  * 
  * @param apply_chat_template whether or not to apply chat_template for non-chat scenarios
+ * @param token_healing if set to true, the last prompt token is removed and the first generated token is constrained to the
+ *        tokens starting with its text, so that a prompt ending in the middle of a word isn't continued with an unlikely split.
+ *        The generated text then starts with the text of the removed token. Used by ContinuousBatchingPipeline, not supported by beam search.
+ *
+ * Scheduling parameters (used by ContinuousBatchingPipeline depending on SchedulerConfig::scheduling_policy):
+ * @param priority the priority of the request for SchedulingPolicy::PRIORITY. Requests with higher priority are scheduled first and preempted last.
+ * @param ttft_slo_ms the time-to-first-token objective of the request in milliseconds for SchedulingPolicy::DEADLINE. 0 means no objective.
+ * @param tenant_id the identifier of the tenant the request belongs to for SchedulingPolicy::FAIR_SHARE.
+ * @param deadline_ms the time in milliseconds since the request is added to ContinuousBatchingPipeline, after which the request
+ *        is cancelled, whether it is still waiting or already running, and its KV cache is released. 0 means no deadline.
  */
 
 class OPENVINO_GENAI_EXPORTS GenerationConfig {
@@ -198,6 +211,7 @@ public:
     size_t top_k = std::numeric_limits<size_t>::max();
     bool do_sample = false;
     size_t rng_seed = 0;
+    size_t best_of = 0;
 
     // Assisting generation parameters
     float assistant_confidence_threshold = 0.f;
@@ -212,6 +226,13 @@ public:
     // set to true if chat template should be applied for non-chat scenarios, set to false otherwise
     bool apply_chat_template = true;
 
+    bool token_healing = false;
+
+    // Scheduling parameters
+    int64_t priority = 0;
+    size_t ttft_slo_ms = 0;
+    std::string tenant_id;
+    size_t deadline_ms = 0;
 
     /** @brief sets eos_token_id to tokenizer_eos_token_id if eos_token_id is less than 0.
      * Otherwise verifies eos_token_id == tokenizer_eos_token_id.
@@ -266,6 +287,7 @@ static constexpr ov::Property<float> temperature{"temperature"};
 static constexpr ov::Property<float> top_p{"top_p"};
 static constexpr ov::Property<size_t> top_k{"top_k"};
 static constexpr ov::Property<bool> do_sample{"do_sample"};
+static constexpr ov::Property<size_t> best_of{"best_of"};
 static constexpr ov::Property<float> repetition_penalty{"repetition_penalty"};
 static constexpr ov::Property<int64_t> eos_token_id{"eos_token_id"};
 static constexpr ov::Property<float> presence_penalty{"presence_penalty"};
@@ -283,6 +305,12 @@ static constexpr ov::Property<std::string> grammar{"grammar"};
 static constexpr ov::Property<std::string> backend{"backend"};
 
 static constexpr ov::Property<bool> apply_chat_template{"apply_chat_template"};
+static constexpr ov::Property<bool> token_healing{"token_healing"};
+
+static constexpr ov::Property<int64_t> priority{"priority"};
+static constexpr ov::Property<size_t> ttft_slo_ms{"ttft_slo_ms"};
+static constexpr ov::Property<std::string> tenant_id{"tenant_id"};
+static constexpr ov::Property<size_t> deadline_ms{"deadline_ms"};
 
 // Predefined Configs
 
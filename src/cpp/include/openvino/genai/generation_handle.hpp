@@ -21,6 +21,29 @@ enum class GenerationStatus {
     DROPPED_BY_HANDLE OPENVINO_ENUM_DEPRECATED("Please, use `STOP` instead of `DROPPED_BY_HANDLE`.") = GenerationStatus::STOP // Status set when generation handle is dropped.
 };
 
+// Where the time of a single request went, e.g. to find out why a request was slow.
+// Durations are in microseconds, the counters are accumulated over the whole lifetime of the request.
+struct RequestMetrics {
+    // from adding the request to the pipeline till its first scheduling
+    float queue_time = 0.0f;
+    // from adding the request till its first generated token
+    float ttft = 0.0f;
+    // from the first scheduling of the request till its first generated token, i.e. the processing of the prompt chunks
+    // including the steps in between them
+    float prefill_time = 0.0f;
+    // from adding the request till it is finished
+    float total_time = 0.0f;
+    // number of steps, in which a part of the prompt was processed
+    size_t num_prefill_chunks = 0;
+    // number of times the request was preempted and the total time it had to wait to be scheduled again
+    size_t num_preemptions = 0;
+    float preempted_time = 0.0f;
+    // number of prompt tokens, which KV cache was restored by prefix caching instead of computing it
+    size_t num_prefix_cache_hit_tokens = 0;
+    // speculative decoding and prompt lookup: number of the validated candidate tokens and how many of them were accepted
+    size_t num_draft_tokens = 0;
+    size_t num_accepted_draft_tokens = 0;
+};
 
 struct EncodedGenerationResult {
     // request ID - obsolete when handle API is approved as handle will connect results with prompts.
@@ -43,6 +66,9 @@ struct EncodedGenerationResult {
     // To get metrics, it should be cast to corresponding class for extended perf metrics from pipeline
     // Cast to SDPerModelsPerfMetrics for SpeculativeDecoding
     std::shared_ptr<ExtendedPerfMetrics> extended_perf_metrics;
+
+    // Latency breakdown of the request
+    RequestMetrics request_metrics;
 };
 
 enum class GenerationFinishReason {
@@ -72,6 +98,9 @@ struct GenerationResult {
     // To get metrics, it should be cast to corresponding class for extended perf metrics from pipeline
     // Cast to SDPerModelsPerfMetrics for SpeculativeDecoding
     std::shared_ptr<ExtendedPerfMetrics> extended_perf_metrics;
+
+    // Latency breakdown of the request
+    RequestMetrics request_metrics;
 };
 
 struct GenerationOutput {
@@ -122,6 +151,9 @@ public:
     GenerationOutputs read();
     // Reads all generated tokens for all sequences
     std::vector<GenerationOutput> read_all();
+
+    // Latency breakdown of the request recorded so far, it is complete once the request is finished
+    RequestMetrics get_request_metrics();
 };
 
 using GenerationHandle = std::shared_ptr<GenerationHandleImpl>;
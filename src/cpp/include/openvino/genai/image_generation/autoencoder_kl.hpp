@@ -129,6 +129,17 @@ public:
         return compile(device, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * Enables tiled decoding and encoding: the images, which are larger than the tile, are processed by overlapping tiles
+     * and the tiles are blended, so the peak memory is bounded by the tile size. The tiles are inferred in parallel on
+     * the devices, which have several optimal infer requests.
+     * @param tile_sample_size Tile size in pixels, 0 selects it from the memory of the GPU device or uses 512 for other devices
+     * @note Tiling requires the model with dynamic height and width, it's not applied to the reshaped model
+     */
+    AutoencoderKL& enable_tiling(size_t tile_sample_size = 0);
+
+    AutoencoderKL& disable_tiling();
+
     ov::Tensor decode(ov::Tensor latent);
 
     ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator);
@@ -140,9 +151,16 @@ public:
 private:
     void merge_vae_image_post_processing() const;
 
+    size_t get_tile_sample_size();
+
     Config m_config;
     ov::InferRequest m_encoder_request, m_decoder_request;
     std::shared_ptr<ov::Model> m_encoder_model = nullptr, m_decoder_model = nullptr;
+
+    bool m_tiling = false;
+    size_t m_tile_sample_size = 0;
+    // infer requests of the tiles, which are inferred in parallel
+    std::vector<ov::InferRequest> m_encoder_tile_requests, m_decoder_tile_requests;
 };
 
 } // namespace genai
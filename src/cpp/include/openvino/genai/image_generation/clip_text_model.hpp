@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -96,6 +97,10 @@ private:
     AdapterController m_adapter_controller;
     Tokenizer m_clip_tokenizer;
     bool m_slice_batch1_output = false;
+    // the outputs of the shared text encoder cache, which are returned instead of the infer request outputs
+    size_t m_cache_model_id = 0;
+    bool m_adapters_applied = false;
+    std::vector<ov::Tensor> m_cached_outputs;
 
 protected:
     ov::InferRequest m_request;
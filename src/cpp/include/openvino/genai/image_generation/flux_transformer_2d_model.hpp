@@ -80,6 +80,14 @@ public:
 
     void set_adapters(const std::optional<AdapterConfig>& adapters);
 
+    /**
+     * Applies a separate LoRA adapter config to each row of the batch of the next inference, e.g. to denoise the images
+     * of several requests with different adapters by a single inference. The adapters must be passed to 'compile()'
+     * with AdapterConfig::MODE_POOL, the configs may refer to those adapters only.
+     * @param row_adapters Adapter configs of the rows of the model batch, including the rows of classifier-free guidance
+     */
+    void set_adapters_per_row(const std::vector<AdapterConfig>& row_adapters);
+
     ov::Tensor infer(const ov::Tensor latent, const ov::Tensor timestep);
 
 private:
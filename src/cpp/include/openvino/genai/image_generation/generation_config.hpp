@@ -122,6 +122,19 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationConfig {
      */
     std::optional<AdapterConfig> adapters;
 
+    /**
+     * Feature reuse (DeepCache) for UNet models: the deep UNet blocks are inferred every 'feature_reuse_interval' steps
+     * and the steps in between infer only the shallow blocks. 1 disables feature reuse.
+     */
+    size_t feature_reuse_interval = 1;
+
+    /**
+     * Inpainting pipeline denoises only the bounding box of the mask padded by 'mask_crop_padding' pixels at the native
+     * resolution and pastes it back with the mask feathered by 'mask_crop_padding / 2' pixels.
+     * It cuts the denoising cost of small masks. -1 (default) denoises the whole image.
+     */
+    int64_t mask_crop_padding = -1;
+
     /**
      * Checks whether image generation config is valid, otherwise throws an exception.
      */
@@ -236,6 +249,40 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
  */
 static constexpr ov::Property<int> max_sequence_length{"max_sequence_length"};
 
+/**
+ * Enables feature reuse (DeepCache) for UNet models: the features of the deep UNet blocks are computed every
+ * 'feature_reuse_interval' steps and reused by the steps in between, which infer the shallowest blocks only.
+ * It speeds up denoising at a slight cost of quality. 1 (default) runs the whole UNet at every step.
+ */
+static constexpr ov::Property<size_t> feature_reuse_interval{"feature_reuse_interval"};
+
+/**
+ * Makes inpainting pipeline denoise only the bounding box of the mask padded by the specified number of pixels,
+ * which is pasted back to the initial image with feathered blending. -1 (default) denoises the whole image.
+ */
+static constexpr ov::Property<int64_t> mask_crop_padding{"mask_crop_padding"};
+
+/**
+ * Devices of UNet replicas (e.g. {"GPU.1"}), which are passed to Stable Diffusion (XL) pipeline constructor or 'compile()'.
+ * The images of 'num_images_per_prompt' are split across UNet and its replicas, which denoise them in parallel with
+ * the shared text encoder outputs, and the results are merged in order, so they match the single device generation.
+ */
+static constexpr ov::Property<std::vector<std::string>> data_parallel_devices{"data_parallel_devices"};
+
+/**
+ * Candidate devices of the automatic device placement (e.g. {"CPU", "NPU"}), which is enabled by passing it
+ * to Text2ImagePipeline constructor along with the device, which is a candidate as well. Each candidate runs a short
+ * generation with all the models compiled on it, then the text encoders, the denoiser and VAE are compiled on
+ * the devices minimizing the latency of the default generation config, so that their weights fit the device memory.
+ */
+static constexpr ov::Property<std::vector<std::string>> placement_devices{"placement_devices"};
+
+/**
+ * JSON file to save the device placement selected for 'placement_devices' to, which is reused by the subsequent runs
+ * with the same candidate devices instead of benchmarking them again.
+ */
+static constexpr ov::Property<std::string> placement_cache_path{"placement_cache_path"};
+
 /**
  * User callback for image generation pipelines, which is called within a pipeline with the following arguments:
  * - Current inference step
@@ -244,6 +291,18 @@ static constexpr ov::Property<int> max_sequence_length{"max_sequence_length"};
  */
 static constexpr ov::Property<std::function<bool(size_t, size_t, ov::Tensor&)>> callback{"callback"};
 
+/**
+ * User callback receiving the previews of the intermediate latents with the following arguments:
+ * - Inference step of the latent
+ * - Total number of inference steps
+ * - u8 NHWC tensor of the preview image
+ * The previews are decoded by the tiny autoencoder (e.g. TAESD) from 'preview_vae_decoder' directory next to 'vae_decoder',
+ * which is required. They are decoded in background, so the denoising isn't stalled: the steps which are completed while
+ * the previous preview is being decoded are skipped. The callback is called within 'generate()' thread.
+ * Supported by Stable Diffusion and Stable Diffusion XL pipelines.
+ */
+static constexpr ov::Property<std::function<void(size_t, size_t, ov::Tensor&)>> preview_callback{"preview_callback"};
+
 /**
  * Function to pass 'ImageGenerationConfig' as property to 'generate()' call.
  * @param generation_config An image generation config to convert to property-like format
@@ -0,0 +1,59 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/runtime/tensor.hpp"
+
+#include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/visibility.hpp"
+
+namespace ov::genai {
+
+struct ImageGenerationRequestState;
+
+/**
+ * Handle of a request added to Text2ImagePipeline via 'add_request()'. The request is denoised by 'step()' calls
+ * together with other requests, the images are available once the status is GenerationStatus::FINISHED.
+ */
+class OPENVINO_GENAI_EXPORTS ImageGenerationHandleImpl {
+    std::shared_ptr<ImageGenerationRequestState> m_state;
+
+public:
+    explicit ImageGenerationHandleImpl(std::shared_ptr<ImageGenerationRequestState> state);
+
+    ~ImageGenerationHandleImpl();
+
+    // There can be only one handle for a request
+    ImageGenerationHandleImpl(const ImageGenerationHandleImpl&) = delete;
+    ImageGenerationHandleImpl& operator=(const ImageGenerationHandleImpl&) = delete;
+
+    /**
+     * @returns GenerationStatus::RUNNING until the request is finished, GenerationStatus::FINISHED when the images are
+     * generated or GenerationStatus::CANCEL when the request has been cancelled
+     */
+    GenerationStatus get_status() const;
+
+    /**
+     * Cancels the request, it's removed from the batch by the next 'step()'
+     */
+    void cancel();
+
+    /**
+     * Blocks until the request is finished or cancelled. It's intended for the requests of 'generate_async()', which
+     * are processed in background, while the requests of 'add_request()' are processed by 'step()' calls only
+     */
+    void wait() const;
+
+    /**
+     * @returns A tensor which has dimensions [num_images_per_prompt, height, width, 3]
+     * @note The request must be finished, the error of the failed request is rethrown
+     */
+    ov::Tensor get_image() const;
+};
+
+using ImageGenerationHandle = std::shared_ptr<ImageGenerationHandleImpl>;
+
+}  // namespace ov::genai
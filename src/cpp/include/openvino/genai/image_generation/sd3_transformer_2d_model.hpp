@@ -83,6 +83,17 @@ public:
 
     ov::Tensor infer(const ov::Tensor latent, const ov::Tensor timestep);
 
+    /**
+     * Infers the model with classifier-free guidance. The latent is repeated for the unconditional and text encoder
+     * hidden states and the noise predictions are combined within the model when possible, so that they don't leave
+     * the device.
+     * @param latent Latents with the batch of the images, not repeated for the guidance
+     * @param timestep Current timestep
+     * @param guidance_scale Guidance scale
+     * @returns Guided noise prediction with the batch of the latent
+     */
+    ov::Tensor infer(const ov::Tensor latent, const ov::Tensor timestep, float guidance_scale);
+
 private:
     class Inference;
     std::shared_ptr<Inference> m_impl;
@@ -95,6 +106,7 @@ private:
 
     class InferenceDynamic;
     class InferenceStaticBS1;
+    class InferenceStatic;
 };
 
 }  // namespace genai
@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -81,6 +82,10 @@ private:
     std::shared_ptr<ov::Model> m_model;
 
     Tokenizer m_tokenizer;
+
+    // the outputs of the shared text encoder cache, which are returned instead of the infer request outputs
+    size_t m_cache_model_id = 0;
+    std::vector<ov::Tensor> m_cached_outputs;
 };
 
 } // namespace genai
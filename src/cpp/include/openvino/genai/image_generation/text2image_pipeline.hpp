@@ -4,10 +4,15 @@
 #pragma once
 
 #include "openvino/genai/image_generation/image2image_pipeline.hpp"
+#include "openvino/genai/image_generation/image_generation_handle.hpp"
+#include "openvino/genai/warmup_config.hpp"
 
 namespace ov {
 namespace genai {
 
+class ImageGenerationEngine;
+class StagedImageGenerationExecutor;
+
 /**
  * Text to image pipelines which provides unified API to all supported models types.
  * Models specific aspects are hidden in image generation config, which includes multiple prompts support or
@@ -33,6 +38,7 @@ public:
      * @note If you want to compile each model on a dedicated device or with specific properties, you can create 
      * models individually and then combine a final pipeline using static methods like 'latent_consistency_model' or
      * 'stable_diffusion_3'. See 'samples/cpp/image_generation/heterogeneous_stable_diffusion.cpp' for example
+     * @note 'placement_devices' property makes the pipeline select the devices of the models automatically
      */
     Text2ImagePipeline(const std::filesystem::path& models_path, const std::string& device, const ov::AnyMap& properties = {});
 
@@ -244,6 +250,69 @@ public:
         return generate(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * Generates images of a single inference step for each of the batch sizes as the number of images per prompt, so
+     * that the kernels for these shapes are compiled before the first real requests
+     * @param config The batch sizes and the image size, 0 for the size of the generation config of the pipeline
+     */
+    void warmup(const WarmupConfig& config = {});
+
+    /**
+     * Adds a request to the batching engine of the pipeline. The requests are denoised together by 'step()' calls and
+     * the added requests are admitted at the beginning of each step, so they join the requests at other timesteps.
+     * The method can be called from other threads while 'step()' is running.
+     * @param positive_prompt Prompt to generate image(s) from
+     * @param properties Image generation parameters specified as properties. 'callback' is called after each denoising
+     * step of the request and cancels the request when it returns true
+     * @returns A handle to get the status and the images of the request
+     * @note Batching is supported by Stable Diffusion, Stable Diffusion XL and Latent Consistency Model pipelines created
+     * from a models path. Since each sample of the batch has its own timestep, UNet must not be reshaped and must be
+     * compiled on a device other than NPU. LoRA adapters of the pipeline generation config are applied to the whole
+     * batch, a request may have its own 'adapters' only if the pipeline is created with AdapterConfig::MODE_POOL, which
+     * applies the adapters to the rows of the batch. 'generate()' shares the models with the batch, so it must not be
+     * called while 'step()' is running.
+     */
+    ImageGenerationHandle add_request(const std::string& positive_prompt, const ov::AnyMap& properties = {});
+
+    template <typename... Properties>
+    ov::util::EnableIfAllStringAny<ImageGenerationHandle, Properties...> add_request(
+            const std::string& positive_prompt,
+            Properties&&... properties) {
+        return add_request(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    /**
+     * Performs a denoising step of the running requests: admits the added requests, infers UNet once per image size
+     * for all the requests of this size and decodes the images of the finished requests
+     */
+    void step();
+
+    /**
+     * @returns Whether there are added requests, which are not finished or cancelled yet
+     */
+    bool has_non_finished_requests();
+
+    /**
+     * Queues a request to the staged executor of the pipeline, which runs text encoding, denoising and VAE decoding in
+     * their own threads. The stages of different requests overlap: the text of the next request is encoded and the image
+     * of the previous one is decoded, while a request is denoised.
+     * @param positive_prompt Prompt to generate image(s) from
+     * @param properties Image generation parameters specified as properties. 'callback' is called from the denoising
+     * thread after each step and cancels the request when it returns true
+     * @returns A handle to wait for the request and get its images
+     * @note Staged execution is supported by Stable Diffusion, Stable Diffusion XL and Latent Consistency Model pipelines.
+     * LoRA adapters are taken from the pipeline generation config, when the first request is queued. The stages share
+     * the models with 'generate()' and 'step()', so they must not be called, while the queued requests are processed
+     */
+    ImageGenerationHandle generate_async(const std::string& positive_prompt, const ov::AnyMap& properties = {});
+
+    template <typename... Properties>
+    ov::util::EnableIfAllStringAny<ImageGenerationHandle, Properties...> generate_async(
+            const std::string& positive_prompt,
+            Properties&&... properties) {
+        return generate_async(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
+    }
+
     /**
      * Performs latent image decoding. It can be useful to use within 'callback' which accepts current latent image
      * @param latent A latent image
@@ -255,6 +324,10 @@ public:
 
 private:
     std::shared_ptr<DiffusionPipeline> m_impl;
+    // created by the first 'add_request()'
+    std::shared_ptr<ImageGenerationEngine> m_engine;
+    // created by the first 'generate_async()'
+    std::shared_ptr<StagedImageGenerationExecutor> m_staged_executor;
 
     explicit Text2ImagePipeline(const std::shared_ptr<DiffusionPipeline>& impl);
 };
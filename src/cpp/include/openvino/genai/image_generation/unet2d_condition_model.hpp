@@ -91,8 +91,39 @@ public:
 
     void set_adapters(const std::optional<AdapterConfig>& adapters);
 
+    /**
+     * Applies a separate LoRA adapter config to each row of the batch of the next inference, e.g. to denoise the images
+     * of several requests with different adapters by a single inference. The adapters must be passed to 'compile()'
+     * with AdapterConfig::MODE_POOL, the configs may refer to those adapters only.
+     * @param row_adapters Adapter configs of the rows of the model batch, including the rows of classifier-free guidance
+     */
+    void set_adapters_per_row(const std::vector<AdapterConfig>& row_adapters);
+
     ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep);
 
+    /**
+     * Infers the model with classifier-free guidance. The sample is repeated for the unconditional and text encoder
+     * hidden states and the noise predictions are combined within the model when possible, so that they don't leave
+     * the device.
+     * @param sample Latents with the batch of the images, not repeated for the guidance
+     * @param timestep Current timestep
+     * @param guidance_scale Guidance scale
+     * @returns Guided noise prediction with the batch of the sample
+     */
+    ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep, float guidance_scale);
+
+    /**
+     * Checks whether the deep features of the model can be reused between the denoising steps. Feature reuse requires
+     * the upsampler of the second last up block to be found in the compiled model and no LoRA adapters to be applied.
+     */
+    bool supports_feature_reuse() const;
+
+    /**
+     * Enables or disables feature reuse for the next 'infer()' calls. If enabled, only the shallow blocks of the model
+     * are inferred, while the deep features are taken from the last inference with disabled feature reuse.
+     */
+    void set_feature_reuse(bool reuse_features);
+
     bool do_classifier_free_guidance(float guidance_scale) const {
         return guidance_scale > 1.0f && m_config.time_cond_proj_dim < 0;
     }
@@ -108,6 +139,7 @@ private:
 
     class UNetInferenceDynamic;
     class UNetInferenceStaticBS1;
+    class UNetInferenceStatic;
 };
 
 } // namespace genai
@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "openvino/genai/text_streamer.hpp"
+
+namespace ov {
+namespace genai {
+
+enum class JsonEventType {
+    OBJECT_START = 0,
+    OBJECT_END = 1,
+    ARRAY_START = 2,
+    ARRAY_END = 3,
+    STRING_CHUNK = 4, // Characters of a string value decoded so far, emitted before the string is complete
+    VALUE = 5 // A complete string, number, boolean or null value
+};
+
+struct JsonEvent {
+    JsonEventType type;
+    // JSON Pointer (RFC 6901) of the value the event belongs to, e.g. "/tool_calls/0/name", empty for the root value
+    std::string path;
+    // STRING_CHUNK: the characters decoded since the previous chunk of the string, the chunks add up to the string
+    // VALUE: the decoded text for strings, the JSON text for numbers, booleans and null
+    std::string value;
+    // whether the value is a string, true for STRING_CHUNK
+    bool is_string = false;
+};
+
+class JsonEventParser;
+
+/**
+ * @brief JsonStreamer decodes tokens into text as TextStreamer does and parses it into JSON events as the tokens arrive,
+ * so that the fields of the generated JSON, e.g. the name of a tool call, can be used before the generation completes.
+ * The text is parsed incrementally, each character is parsed once. Meant for the generation constrained to JSON by
+ * GenerationConfig::structured_output_config, several JSON values separated by whitespace are parsed one by one.
+ * Throws if the text isn't JSON.
+ *
+ * @param tokenizer Tokenizer object to decode tokens into text.
+ * @param callback User-defined callback function to process the events, callback should return
+ * either boolean flag or StreamingStatus.
+ */
+class OPENVINO_GENAI_EXPORTS JsonStreamer : public StreamerBase {
+public:
+    StreamingStatus write(int64_t token) override;
+    StreamingStatus write(const std::vector<int64_t>& tokens) override;
+
+    void end() override;
+
+    JsonStreamer(const Tokenizer& tokenizer, std::function<CallbackTypeVariant(const JsonEvent&)> callback);
+
+private:
+    std::shared_ptr<JsonEventParser> m_parser;
+    std::function<CallbackTypeVariant(const JsonEvent&)> m_event_callback;
+    std::shared_ptr<TextStreamer> m_text_streamer;
+};
+
+}  // namespace genai
+}  // namespace ov
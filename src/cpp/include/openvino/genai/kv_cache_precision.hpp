@@ -0,0 +1,83 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/genai/visibility.hpp"
+
+namespace ov::genai {
+
+/**
+* @brief Represents the grouping of the quantized key cache values sharing a scale and a zero point
+*/
+enum class KVCacheQuantizationMode {
+    BY_TOKEN,  /**< The values of a token are grouped along the head size */
+    BY_CHANNEL /**< The values of a channel are grouped along the tokens, which keeps the outlier channels of the keys
+                * from spoiling the quantization of the other channels of the token */
+};
+
+/**
+* @brief Configuration struct for the mixed precision KV cache, i.e. the precisions of the key and the value cache of
+*        the individual decoder layers and the grouping of the quantized values.
+*/
+class KVCachePrecisionConfig {
+public:
+    /** Precisions of the key cache of the decoder layers by the layer index, e.g. f16 for the first and the last layers,
+     * which are the most sensitive to the quantization, and u8 for the rest of them. The layers past the end of the
+     * vector and the ones set to ov::element::dynamic keep the precision chosen by the plugin, e.g. by
+     * ov::hint::kv_cache_precision. */
+    std::vector<ov::element::Type> key_precisions;
+
+    /** Precisions of the value cache of the decoder layers by the layer index, same as key_precisions. The values
+     * tolerate the coarser quantization than the keys, e.g. u4. */
+    std::vector<ov::element::Type> value_precisions;
+
+    /** Grouping of the quantized key cache values. */
+    KVCacheQuantizationMode key_quantization_mode = KVCacheQuantizationMode::BY_TOKEN;
+
+    /** Number of the quantized key cache values sharing a scale and a zero point, 0 keeps the default of the plugin. */
+    size_t key_group_size = 0;
+
+    /** Number of the quantized value cache values of a token sharing a scale and a zero point, 0 keeps the default of
+     * the plugin. */
+    size_t value_group_size = 0;
+
+    /** @return Whether the plugin defaults are kept for all the layers. */
+    bool is_default() const {
+        return key_precisions.empty() && value_precisions.empty() && key_quantization_mode == KVCacheQuantizationMode::BY_TOKEN &&
+               key_group_size == 0 && value_group_size == 0;
+    }
+
+    bool operator==(const KVCachePrecisionConfig& other) const {
+        return key_precisions == other.key_precisions && value_precisions == other.value_precisions &&
+               key_quantization_mode == other.key_quantization_mode && key_group_size == other.key_group_size &&
+               value_group_size == other.value_group_size;
+    }
+};
+
+/**
+ * Chooses the mixed precisions of the KV cache, which fit a number of tokens into a memory budget with the least
+ * quantization: the value cache of the middle layers is quantized to u8 first, then their key cache to u8 by channel,
+ * then their value cache to u4, the layers closer to the middle ones before the outer ones. The first and the last
+ * num_f16_layers layers are kept in f16.
+ * The estimate assumes a scale and a zero point in f32 per token and head of the quantized layers.
+ * @param num_decoder_layers Number of the decoder layers of the model.
+ * @param num_kv_heads Number of the key / value heads of each layer.
+ * @param head_size Size of each head.
+ * @param num_tokens Number of the tokens the KV cache must fit, e.g. of the maximum context of all the sequences.
+ * @param budget_in_bytes Memory budget of the KV cache.
+ * @param num_f16_layers Number of the first and of the last layers kept in f16.
+ * @return The precisions of all the layers. Throws if the tokens do not fit even with the lowest precisions.
+ */
+OPENVINO_GENAI_EXPORTS KVCachePrecisionConfig calibrate_kv_cache_precisions(size_t num_decoder_layers,
+                                                                            size_t num_kv_heads,
+                                                                            size_t head_size,
+                                                                            size_t num_tokens,
+                                                                            size_t budget_in_bytes,
+                                                                            size_t num_f16_layers = 1);
+
+}  // namespace ov::genai
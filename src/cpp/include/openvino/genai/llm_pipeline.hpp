@@ -15,6 +15,7 @@
 #include "openvino/genai/perf_metrics.hpp"
 #include "openvino/genai/scheduler_config.hpp"
 #include "openvino/genai/common_types.hpp"
+#include "openvino/genai/warmup_config.hpp"
 
 namespace ov {
 namespace genai {
@@ -107,6 +108,10 @@ class LLMPipelineImplBase;
 
 /**
 * @brief This class is used for generation with LLMs.
+* generate() may be called from several threads concurrently. The calls are batched together by the paged attention
+* backend, except the streamed ones, the chat and the calls with echo or LoRA adapters, which wait for the others.
+* The stateful backend generates them on the replicas of the pipeline, which share the compiled model and have their
+* own KV caches, while a chat is started the calls are serialized.
  */
 class OPENVINO_GENAI_EXPORTS LLMPipeline {
 public:
@@ -270,6 +275,13 @@ public:
     GenerationConfig get_generation_config() const;
     void set_generation_config(const GenerationConfig& config);
 
+    /**
+    * @brief generates a few tokens greedily for dummy prompts of each combination of the prompt lengths and the batch sizes,
+    * so that the kernels for these shapes are compiled before the first real requests. Must not be called in a chat.
+    *
+    * @param config the prompt lengths, the batch sizes and the number of the generated tokens.
+    */
+    void warmup(const WarmupConfig& config = {});
 
     /**
     * @brief start chat with keeping history in kv cache.
@@ -286,6 +298,25 @@ public:
     */
     void finish_chat();
 
+    /**
+    * @brief suspend the current chat and store its history and KV cache in the pool of chat sessions of the pipeline under `session_id`.
+    * The pipeline can run other chats or generations afterwards, and the chat can be continued with resume_chat() without processing
+    * its history again. Only `max_cached_chat_sessions` most recently suspended chats keep their KV cache on the host,
+    * the history of older chats is processed again on resume.
+    * Supported by the stateful pipeline only.
+    *
+    * @param session_id id of the chat session to resume the chat later.
+    */
+    void suspend_chat(const std::string& session_id);
+
+    /**
+    * @brief resume the chat suspended with suspend_chat(), the current chat is finished.
+    * The session is removed from the pool of chat sessions, so the chat has to be suspended again to be resumed later.
+    *
+    * @param session_id id of the chat session passed to suspend_chat().
+    */
+    void resume_chat(const std::string& session_id);
+
 private:
     std::string m_device;
     std::unique_ptr<LLMPipelineImplBase> m_pimpl;
@@ -338,6 +369,14 @@ static constexpr ov::Property<SchedulerConfig> scheduler_config{"scheduler_confi
 */
 static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 
+/**
+* @brief self_speculative_num_layers property serves to activate self-speculative decoding, which drafts with the first
+* decoder layers of the model followed by its LM head, without a separate draft model.
+* Set the number of the first decoder layers to draft with to activate this mode.
+* And create LLMPipeline instance with this config.
+*/
+static constexpr ov::Property<size_t> self_speculative_num_layers{"self_speculative_num_layers"};
+
 /**
 * @brief enable enable_save_ov_model property serves to serialize ov model (xml/bin) generated from gguf model on disk for re-use.
 * Set `true` to activate this mode.
@@ -345,6 +384,57 @@ static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 */
 static constexpr ov::Property<bool> enable_save_ov_model{"enable_save_ov_model"};
 
+/**
+* @brief gguf_cache_dir property sets a directory, where the OpenVINO models converted from GGUF files are cached.
+* A cached model is reused while the GGUF file, its modification time and the GenAI and OpenVINO versions are unchanged,
+* so the following pipelines skip the GGUF conversion. The compiled models are cached in its 'compiled' subdirectory
+* unless ov::cache_dir is set.
+*/
+static constexpr ov::Property<std::string> gguf_cache_dir{"gguf_cache_dir"};
+
+/**
+* @brief max_cached_chat_sessions property sets the number of chats suspended with LLMPipeline::suspend_chat(), which keep their
+* KV cache in the host memory. 8 by default.
+*/
+static constexpr ov::Property<size_t> max_cached_chat_sessions{"max_cached_chat_sessions"};
+
+/**
+* @brief compress_cached_chat_sessions property enables quantization of the KV cache of suspended chats to int8,
+* which reduces its host memory footprint by 2-4 times at the cost of approximation error. Disabled by default.
+*/
+static constexpr ov::Property<bool> compress_cached_chat_sessions{"compress_cached_chat_sessions"};
+
+/**
+* @brief prompt_length_bucketing_ratio property makes the stateful pipeline split a batch of prompts passed to generate()
+* into buckets of prompts with similar lengths, where the longest prompt is at most this many times longer than the shortest
+* one. Buckets are generated one after another without the padding to the longest prompt of the whole batch.
+* This saves the compute spent on padding for the batches of prompts with very different lengths, but decreases the
+* batch size of the generation steps. 0 (default) disables the bucketing.
+*/
+static constexpr ov::Property<float> prompt_length_bucketing_ratio{"prompt_length_bucketing_ratio"};
+
+/**
+* @brief prefill_chunk_size property makes the stateful pipeline process the prompts longer than this number of tokens
+* in several inferences of at most this many tokens each, bounding the peak memory of intermediate activations at
+* the cost of some prefill performance. 0 (default) processes the whole prompt at once. Not supported for NPU device.
+*/
+static constexpr ov::Property<size_t> prefill_chunk_size{"prefill_chunk_size"};
+
+/**
+* @brief weights_streaming property enables the streaming of the weights of the stateful pipeline on CPU for the models,
+* which don't fit the host memory. The weights stay memory mapped from the IR .bin file and the ones of the next decoder
+* layers are read ahead while the model is inferred, the OS reclaims the pages of the other layers on demand.
+* This trades some throughput for being able to run the model at all. Disabled by default. Only the weights used by the
+* plugin in place benefit, the ones repacked by the plugin at compilation reside in its memory.
+*/
+static constexpr ov::Property<bool> weights_streaming{"weights_streaming"};
+
+/**
+* @brief weights_streaming_pinned_layers property sets the indices of the decoder layers, whose weights are locked in memory
+* when weights_streaming is enabled, e.g. the hot layers of a model. Locking is limited by the memory lock limit of the process.
+*/
+static constexpr ov::Property<std::vector<size_t>> weights_streaming_pinned_layers{"weights_streaming_pinned_layers"};
+
 
 }  // namespace genai
 }  // namespace ov
@@ -6,6 +6,7 @@
 #include <limits>
 #include <variant>
 #include <string>
+#include <vector>
 #include <optional>
 #include <filesystem>
 
@@ -50,9 +51,10 @@ struct OPENVINO_GENAI_EXPORTS AdapterConfig {
     enum Mode {
         MODE_AUTO,          // Automatically selected (depends on the place where this mode is applied and device selection)
         MODE_DYNAMIC,       // A, B, alpha are fully variable
-        MODE_STATIC_RANK,   // A and B have static shape, alpha is variable // FIXME: WA to unlock experiments, gives a unique perf level
+        MODE_STATIC_RANK,   // A and B have static shape, alpha is variable, the rank is rounded up to a bucket and the adapters are padded with zeros, see set_max_rank
         MODE_STATIC,        // A, B and alpha are constants. Use instead of MODE_FUSE if preserving weights precision is required at the cost of inference time
-        MODE_FUSE           // A, B and alpha are constants, fused to main matrix W
+        MODE_FUSE,          // A, B and alpha are constants, fused to main matrix W
+        MODE_POOL           // A and B of all adapters passed at the initialization stay in the model state, adapters are switched by alphas only, which can vary over the batch
     };
 
     Mode get_mode() const { return mode; }
@@ -68,6 +70,20 @@ struct OPENVINO_GENAI_EXPORTS AdapterConfig {
     const std::optional<std::string>& get_tensor_name_prefix() const { return tensor_name_prefix; }
     void set_tensor_name_prefix(const std::optional<std::string>& _tensor_name_prefix) { tensor_name_prefix = _tensor_name_prefix; }
 
+    // Methods to get and set the size in bytes of the host memory cache of the LoRA state tensors prepared for the recently
+    // used sets of adapters in MODE_DYNAMIC and MODE_STATIC_RANK. The least recently used tensors are evicted, and are
+    // prepared again from the memory mapped adapter files when the adapters are used next time.
+    // The size is taken into account when AdapterController is created. The default value 0 disables the cache.
+    size_t get_cache_size() const { return cache_size; }
+    void set_cache_size(size_t _cache_size) { cache_size = _cache_size; }
+
+    // Methods to get and set the maximum total rank of the adapters applied to a layer in MODE_STATIC_RANK. The static rank of
+    // the LoRA state of each layer is the power of 2, not less than 8, that fits this rank and the total rank of the adapters
+    // passed at the initialization. The adapters of a lower rank are padded with zeros, so a model compiled once serves
+    // any adapters up to this rank. The rank is taken into account when AdapterController is created. The default value is 0.
+    size_t get_max_rank() const { return max_rank; }
+    void set_max_rank(size_t _max_rank) { max_rank = _max_rank; }
+
     AdapterConfig (Mode mode = MODE_AUTO);
 
     AdapterConfig (const Adapter& adapter, float alpha, Mode mode = MODE_AUTO) : AdapterConfig(std::vector<std::pair<Adapter, float>>{{adapter, alpha}}, mode) {}
@@ -107,7 +123,20 @@ private:
     std::vector<Adapter> adapters;
     std::vector<float> alphas;
     std::optional<std::string> tensor_name_prefix;
+    size_t cache_size = 0;
+    size_t max_rank = 0;
+
+};
+
 
+// Statistics of the switches of the adapters by AdapterController with the cache enabled by AdapterConfig::set_cache_size
+struct OPENVINO_GENAI_EXPORTS AdapterCacheMetrics {
+    size_t num_hits = 0;        // switches to the cached or prefetched tensors
+    size_t num_misses = 0;      // switches that prepared the tensors
+    size_t num_evictions = 0;
+    size_t num_prefetches = 0;
+    size_t cached_bytes = 0;
+    std::vector<float> swap_durations;  // in ms, time to set the tensors of the new adapters to the model state
 };
 
 
@@ -198,6 +227,27 @@ public:
     // Helps to distinguish LoRA states from other states (e.g. KV cache state) in the model for a partial state reset.
     bool has_state_name(const std::string& name);
 
+    // Sets the tensors of all adapters of the current config regardless of the changes since the last `apply`,
+    // e.g. to another infer request of the same model, as `apply` tracks the changes for a single infer request
+    void apply_all(ov::InferRequest request);
+
+    // Applies a separate config to each row of the batch of the next inference, requires AdapterConfig::MODE_POOL.
+    // The configs may refer to the adapters passed in the constructor only, the adapters not used by a row have zero alpha.
+    // If `num_rows` is given, each config is applied to the given number of consecutive rows, e.g. to all the tokens of
+    // a sequence in a continuous batching model, whose batch dimension enumerates tokens.
+    void apply_per_row(ov::InferRequest request, const std::vector<AdapterConfig>& row_configs, const std::vector<size_t>& num_rows = {});
+
+    // Prepares the tensors of the adapters of `config` in background and puts them to the cache, e.g. for a queued request,
+    // so that the next `apply` of these adapters doesn't wait for their preparation. Does nothing if the cache is disabled.
+    void prefetch(const AdapterConfig& config);
+
+    AdapterCacheMetrics get_cache_metrics() const;
+
+    // Replaces the adapters fused into `model` in AdapterConfig::MODE_FUSE by the adapters of `config`: the original weights,
+    // which are kept by the fusion, are restored and fused with the new adapters. It's faster than reading the model again,
+    // the model should be compiled again to use the new adapters. Not supported for the adapters with constants.
+    void refuse(std::shared_ptr<ov::Model> model, const AdapterConfig& config);
+
     operator bool() const {
         return bool(m_pimpl);
     }
@@ -83,6 +83,7 @@ struct OPENVINO_GENAI_EXPORTS SummaryStats {
  * Preverable way to access values is via get functions. Getters calculate mean and std values from raw_metrics are return pairs.
  * If mean and std were already calculated getters return cached values.
  * @param get_load_time Returns the load time in milliseconds.
+ * @param get_model_load_times Returns a map with the load time of each model of the pipeline in milliseconds.
  * @param get_num_generated_tokens Returns the number of generated tokens.
  * @param get_num_input_tokens Returns the number of tokens in the input prompt.
  * @param get_ttft Returns the mean and standard deviation of TTFT.
@@ -102,6 +103,7 @@ struct OPENVINO_GENAI_EXPORTS SummaryStats {
  * @param operator+= Adds and assigns the right-hand PerfMetrics to the current object.
  * @param raw_metrics A structure of RawPerfMetrics type that holds raw metrics.
  * @param load_time Load time in milliseconds.
+ * @param model_load_times Load time of each model of the pipeline in milliseconds, the models are loaded concurrently.
  *
  * Cached mean and standard deviations.
  * @param ttft Mean and standard deviation of Time to the First Token (TTFT) in milliseconds.
@@ -115,6 +117,8 @@ struct OPENVINO_GENAI_EXPORTS SummaryStats {
  */
 struct OPENVINO_GENAI_EXPORTS PerfMetrics {
     float load_time;   // Load time in ms.
+    // Load time of each model in ms, e.g. "language_model" or "tokenizer", the models are loaded concurrently.
+    std::map<std::string, float> model_load_times;
     MeanStdPair ttft;  // Time to the first token (in ms) (TTFT).
     MeanStdPair tpot;  // Time (in ms) per output token (TPOT).
     MeanStdPair ipot;  // Inference time (in ms) per output token.
@@ -133,6 +137,7 @@ struct OPENVINO_GENAI_EXPORTS PerfMetrics {
     size_t num_input_tokens;
 
     float get_load_time();         // Load time in ms.
+    std::map<std::string, float> get_model_load_times();
     size_t get_num_generated_tokens();
     size_t get_num_input_tokens();
     MeanStdPair get_ttft();         // Time to the first token (in ms) (TTFT).
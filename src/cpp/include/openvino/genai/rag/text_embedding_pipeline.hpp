@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
 #include <optional>
 #include <variant>
 
@@ -16,6 +17,16 @@ using EmbeddingResult = std::variant<std::vector<float>, std::vector<int8_t>, st
 using EmbeddingResults =
     std::variant<std::vector<std::vector<float>>, std::vector<std::vector<int8_t>>, std::vector<std::vector<uint8_t>>>;
 
+/**
+ * @brief Pipeline computing embeddings of texts. The synchronous methods are thread safe: the calls of different threads
+ * share a pool of infer requests, which run in parallel on the streams of the device. The model is compiled with
+ * ov::hint::PerformanceMode::THROUGHPUT unless ov::hint::performance_mode is passed in the properties.
+ *
+ * NPU runs the model of static shapes: it's compiled for each shape of "BATCH_BUCKETS" x "SEQ_LEN_BUCKETS" properties,
+ * lists of the batch sizes and the sequence lengths, which default to 1 and 'window_length', 'max_length' or 512
+ * tokens. A batch is padded to the cheapest shape, which fits it, the texts are truncated to the largest sequence
+ * length. "BLOB_CACHE_DIR" property caches the compiled blobs. Sequence packing is not supported on NPU.
+ */
 class OPENVINO_GENAI_EXPORTS TextEmbeddingPipeline {
 public:
     enum class PoolingType {
@@ -29,6 +40,26 @@ public:
         MEAN = 1,
     };
 
+    enum class EmbeddingPrecision {
+        /**
+         * @brief f32 embeddings
+         */
+        F32 = 0,
+        /**
+         * @brief int8 embeddings, the normalized values are scaled by 127
+         */
+        INT8 = 1,
+        /**
+         * @brief uint8 embeddings, the normalized values are mapped from [-1, 1] to [0, 255]
+         */
+        UINT8 = 2,
+        /**
+         * @brief uint8 embeddings of the packed sign bits, a value has 8 dimensions with the first one in the most
+         * significant bit, so the embedding size is 8 times smaller
+         */
+        BINARY = 3,
+    };
+
     struct OPENVINO_GENAI_EXPORTS Config {
         /**
          * @brief Maximum length of tokens passed to the embedding model
@@ -40,11 +71,24 @@ public:
          */
         PoolingType pooling_type = PoolingType::CLS;
 
+        /**
+         * @brief Number of the first dimensions of the pooled embeddings kept in the results, so Matryoshka models
+         * return shorter embeddings. The truncated embeddings are normalized if the normalization is enabled. If not
+         * set, all the dimensions are kept.
+         */
+        std::optional<size_t> embedding_size;
+
         /**
          * @brief If 'true', L2 normalization is applied to embeddings
          */
         bool normalize = true;
 
+        /**
+         * @brief Precision of embeddings, the quantization is done by the model, so less data is copied from the
+         * device and stored in the results. INT8 and UINT8 require the normalization
+         */
+        EmbeddingPrecision embedding_precision = EmbeddingPrecision::F32;
+
         /**
          * @brief Instruction to use for embedding a query
          */
@@ -55,6 +99,35 @@ public:
          */
         std::optional<std::string> embed_instruction;
 
+        /**
+         * @brief Maximum number of tokens of a batch passed to the embedding model, including the padding. The texts are
+         * sorted by length and split into batches, which are inferred by all the infer requests of the compiled model.
+         * If not set, all the texts are embedded by a single batch.
+         */
+        std::optional<size_t> max_batch_tokens;
+
+        /**
+         * @brief If true, several texts are concatenated into a row of the batch instead of padding each text to the
+         * longest one. The texts of a row attend to themselves only and are pooled separately. Requires the model with
+         * ScaledDotProductAttention operations and the position embeddings, which are indexed by the positions of
+         * the tokens.
+         */
+        bool pack_sequences = false;
+
+        /**
+         * @brief If set, the texts longer than 'window_length' tokens are split into the overlapping windows of
+         * 'window_length' tokens instead of being truncated by 'max_length'. Each window has the special tokens of a
+         * text. 'embed_documents()' and 'embed_query()' pool the window embeddings of a text by the mean weighted by the
+         * number of the new tokens of each window, 'embed_document_windows()' returns the embeddings of the windows.
+         * Requires F32 embedding precision.
+         */
+        std::optional<size_t> window_length;
+
+        /**
+         * @brief Number of the tokens shared by the consecutive windows of a text
+         */
+        size_t window_overlap = 0;
+
         /**
          * @brief Constructs text embedding pipeline configuration
          */
@@ -117,7 +190,43 @@ public:
     EmbeddingResults embed_documents(const std::vector<std::string>& texts);
 
     /**
-     * @brief Asynchronously computes embeddings for a vector of texts. Only one method of async family can be active.
+     * @brief Computes embeddings for the documents pulled from a callback and writes them to a caller provided tensor.
+     * The documents are pulled and embedded by chunks, so only a chunk of documents is kept in memory and the
+     * embeddings tensor can wrap a memory mapped file.
+     *
+     * @param next_document Returns the next document or std::nullopt when the documents are exhausted
+     * @param embeddings Tensor of [max_num_documents, embedding_size] shape and the element type of the embedding
+     * precision: f32, i8 or u8. The embedding of the i-th pulled document is written to its i-th row. No more
+     * documents are pulled when the tensor is full
+     * @param chunk_size Number of documents embedded at once
+     * @returns Number of the embedded documents
+     */
+    size_t embed_documents(const std::function<std::optional<std::string>()>& next_document,
+                           ov::Tensor& embeddings,
+                           size_t chunk_size = 1024);
+
+    struct DocumentWindows {
+        /**
+         * @brief Embeddings of the windows, the windows of a document are consecutive and follow the order of the
+         * documents
+         */
+        EmbeddingResults embeddings;
+
+        /**
+         * @brief Index of the document of each window
+         */
+        std::vector<size_t> document_indices;
+    };
+
+    /**
+     * @brief Computes embeddings for the windows of a vector of texts, which are split by 'Config::window_length'. A
+     * text has a single window if 'Config::window_length' is not set or the text is shorter than it
+     */
+    DocumentWindows embed_document_windows(const std::vector<std::string>& texts);
+
+    /**
+     * @brief Asynchronously computes embeddings for a vector of texts. Only one method of async family can be active, the async family
+     * is not thread safe.
      */
     void start_embed_documents_async(const std::vector<std::string>& texts);
 
@@ -132,7 +241,8 @@ public:
     EmbeddingResult embed_query(const std::string& text);
 
     /**
-     * @brief Asynchronously computes embeddings for a query. Only one method of async family can be active.
+     * @brief Asynchronously computes embeddings for a query. Only one method of async family can be active, the async family
+     * is not thread safe.
      */
     void start_embed_query_async(const std::string& text);
 
@@ -148,6 +258,11 @@ private:
     std::unique_ptr<TextEmbeddingPipelineImpl> m_impl;
 };
 
+/**
+ * @brief Number of the first dimensions of the pooled embeddings kept in the results
+ */
+static constexpr ov::Property<size_t> embedding_size{"embedding_size"};
+
 /**
  * @brief If 'true', L2 normalization applied to embeddings
  */
@@ -158,6 +273,11 @@ static constexpr ov::Property<bool> normalize{"normalize"};
  */
 static constexpr ov::Property<TextEmbeddingPipeline::PoolingType> pooling_type{"pooling_type"};
 
+/**
+ * @brief Precision of embeddings
+ */
+static constexpr ov::Property<TextEmbeddingPipeline::EmbeddingPrecision> embedding_precision{"embedding_precision"};
+
 /**
  * @brief Instruction to use for embedding query
  */
@@ -168,5 +288,25 @@ static constexpr ov::Property<std::string> query_instruction{"query_instruction"
  */
 static constexpr ov::Property<std::string> embed_instruction{"embed_instruction"};
 
+/**
+ * @brief Maximum number of tokens of a batch passed to the embedding model, including the padding
+ */
+static constexpr ov::Property<size_t> max_batch_tokens{"max_batch_tokens"};
+
+/**
+ * @brief Whether several texts are concatenated into a row of the batch passed to the embedding model
+ */
+static constexpr ov::Property<bool> pack_sequences{"pack_sequences"};
+
+/**
+ * @brief Maximum number of tokens of a window of a long text passed to the embedding model
+ */
+static constexpr ov::Property<size_t> window_length{"window_length"};
+
+/**
+ * @brief Number of the tokens shared by the consecutive windows of a text
+ */
+static constexpr ov::Property<size_t> window_overlap{"window_overlap"};
+
 }  // namespace genai
 }  // namespace ov
@@ -3,11 +3,19 @@
 
 #pragma once
 
+#include <memory>
+
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
 #include "openvino/genai/tokenizer.hpp"
 
 namespace ov {
 namespace genai {
 
+/**
+ * @brief Pipeline scoring texts by their relevance to a query. 'rerank()' is thread safe: the calls of different threads
+ * share a pool of infer requests, which run in parallel on the streams of the device. The model is compiled with
+ * ov::hint::PerformanceMode::THROUGHPUT unless ov::hint::performance_mode is passed in the properties.
+ */
 class OPENVINO_GENAI_EXPORTS TextRerankPipeline {
 public:
     struct OPENVINO_GENAI_EXPORTS Config {
@@ -21,6 +29,19 @@ public:
          */
         std::optional<size_t> max_length;
 
+        /**
+         * @brief Maximum number of tokens of a batch passed to the rerank model, including the padding. The query-text
+         * pairs are sorted by length and split into batches, which are inferred by all the infer requests of the
+         * compiled model. If not set, all the pairs are scored by a single batch.
+         */
+        std::optional<size_t> max_batch_tokens;
+
+        /**
+         * @brief Maximum number of the cached scores of query-text pairs, the least recently used scores are evicted.
+         * The cached pairs aren't passed to the rerank model. 0 disables the cache.
+         */
+        size_t score_cache_size = 0;
+
         /**
          * @brief Constructs text rerank pipeline configuration
          */
@@ -82,7 +103,7 @@ public:
 
     /**
      * @brief Asynchronously reranks a vector of texts based on the query. Only one method of async family can be
-     * active.
+     * active, the async family is not thread safe.
      */
     void start_rerank_async(const std::string& query, const std::vector<std::string>& texts);
 
@@ -91,6 +112,16 @@ public:
      */
     std::vector<std::pair<size_t, float>> wait_rerank();
 
+    /**
+     * @brief Enables the cascade mode: the texts are prefiltered by the cosine similarity of their embeddings to the
+     * embedding of the query, and only 'num_candidates' most similar texts are scored by the rerank model. It must not
+     * be called concurrently with the other methods.
+     *
+     * @param embedding_pipeline Pipeline of a cheap embedding model, nullptr disables the prefiltering
+     * @param num_candidates Number of texts passed to the rerank model, it should not be less than top_n
+     */
+    void set_prefilter(std::shared_ptr<TextEmbeddingPipeline> embedding_pipeline, size_t num_candidates);
+
     ~TextRerankPipeline();
 
 private:
@@ -103,5 +134,10 @@ private:
  */
 static constexpr ov::Property<size_t> top_n{"top_n"};
 
+/**
+ * @brief Maximum number of the cached scores of query-text pairs
+ */
+static constexpr ov::Property<size_t> score_cache_size{"score_cache_size"};
+
 }  // namespace genai
 }  // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief In-process approximate nearest neighbor index of embeddings based on HNSW (Hierarchical Navigable Small World)
+ * graph. The embeddings get sequential ids in the order they are added, starting from 0.
+ */
+class OPENVINO_GENAI_EXPORTS VectorIndex {
+public:
+    enum class Metric {
+        L2,             // Squared euclidean distance
+        INNER_PRODUCT,  // Negated inner product
+        COSINE,         // 1 - cosine similarity, the embeddings and the queries are normalized
+    };
+
+    enum class Storage {
+        F32,   // The embeddings are stored as is
+        INT8,  // The embeddings are quantized to int8 with a scale per embedding, it takes 4x less memory
+    };
+
+    struct OPENVINO_GENAI_EXPORTS Config {
+        Metric metric = Metric::COSINE;
+
+        Storage storage = Storage::F32;
+
+        /**
+         * @brief Maximum number of neighbors of a node on the upper levels of the graph, the bottom level has twice
+         * as many. Larger values improve the recall at the cost of memory and the build time
+         */
+        size_t max_neighbors = 16;
+
+        /**
+         * @brief Number of the candidates considered for the neighbors of an added embedding
+         */
+        size_t ef_construction = 200;
+
+        /**
+         * @brief Number of the candidates considered by a search, it's increased to the number of the requested results
+         */
+        size_t ef_search = 64;
+    };
+
+    /**
+     * @brief Constructs an empty index
+     *
+     * @param dimension Size of the embeddings
+     * @param config Index configuration
+     */
+    explicit VectorIndex(size_t dimension, const Config& config = {});
+
+    /**
+     * @brief Loads the index saved by 'save()'. The embeddings are memory mapped from the file, the file must not be
+     * modified while the index is alive, the embeddings are copied once new embeddings are added
+     */
+    static VectorIndex load(const std::filesystem::path& path);
+
+    VectorIndex(VectorIndex&&);
+    VectorIndex& operator=(VectorIndex&&);
+    ~VectorIndex();
+
+    /**
+     * @brief Adds the embeddings, for example, the results of TextEmbeddingPipeline::embed_documents()
+     * @returns Id of the first added embedding
+     */
+    size_t add(const EmbeddingResults& embeddings);
+
+    /**
+     * @brief Adds the embedding
+     * @returns Id of the embedding
+     */
+    size_t add(const EmbeddingResult& embedding);
+
+    /**
+     * @brief Searches the nearest embeddings to the query, for example, the result of
+     * TextEmbeddingPipeline::embed_query()
+     *
+     * @param query Query embedding
+     * @param top_k Number of the results
+     * @returns Ids of the nearest embeddings and their distances to the query sorted by distance
+     */
+    std::vector<std::pair<size_t, float>> search(const EmbeddingResult& query, size_t top_k) const;
+
+    /**
+     * @brief Saves the index to a file
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @returns Number of the embeddings in the index
+     */
+    size_t size() const;
+
+    size_t get_dimension() const;
+
+    const Config& get_config() const;
+
+private:
+    class VectorIndexImpl;
+    explicit VectorIndex(std::unique_ptr<VectorIndexImpl> impl);
+    std::unique_ptr<VectorIndexImpl> m_impl;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -4,11 +4,41 @@
 #pragma once
 
 #include <cstddef>
+#include <filesystem>
 
 #include "openvino/genai/cache_eviction.hpp"
+#include "openvino/genai/kv_cache_precision.hpp"
 #include "openvino/genai/sparse_attention.hpp"
 
 namespace ov::genai {
+
+/**
+ * @brief Represents the policy by which the scheduler orders the sequence groups competing for the batch and the KV cache.
+ * The order determines which sequence groups get scheduled first and which ones are preempted first when the KV cache
+ * is exhausted (the ones that come last in the order).
+ */
+enum class SchedulingPolicy {
+    FCFS,        // sequence groups are served in order of arrival
+    PRIORITY,    // sequence groups with higher GenerationConfig::priority are served first, ties are broken by arrival
+    DEADLINE,    // sequence groups waiting for their first token are served in order of their TTFT deadline
+                 // (arrival time + GenerationConfig::ttft_slo_ms), the rest - in order of arrival
+    FAIR_SHARE,  // sequence groups of tenants (GenerationConfig::tenant_id) which were served the least tokens so far
+                 // are served first, ties are broken by arrival
+    PREFIX_CACHE_AWARE  // sequence groups which have been scheduled are served in order of arrival, followed by the groups
+                        // waiting longer than SchedulerConfig::max_reordering_delay_ms, followed by the rest of the groups
+                        // with the most prompt tokens restored from the prefix cache, next to the groups with the same
+                        // first block of the prompt. Requires prefix caching to have effect.
+};
+
+/**
+ * @brief Represents the queue by which the outputs of a request are passed from the pipeline to its GenerationHandle.
+ */
+enum class StreamingTransport {
+    SYNCHRONIZED_QUEUE,  // a queue guarded by a mutex, the reader is notified on each push
+    SPSC_RING_BUFFER     // a lock-free single-producer single-consumer ring buffer, the reader is notified only while it
+                         // waits in GenerationHandle::read, the handle of a request must be read by a single thread
+};
+
 struct SchedulerConfig {
     // a maximum number of tokens to batch
     // (in contrast to max_batch_size which combines independent sequences, we consider total amount of tokens in a batch)
@@ -21,19 +51,71 @@ struct SchedulerConfig {
 
     // total size of KV cache in GB
     // When both num_kv_blocks and cache_size are set, num_kv_blocks is used. 
-    // When both num_kv_blocks and cache_size are equal to zero dynamic KV-cache allocation is turned on.
+    // When both num_kv_blocks and cache_size are equal to zero dynamic KV-cache allocation is turned on, unless
+    // kv_cache_memory_utilization is set.
     std::size_t cache_size = 0;
 
+    // fraction of the total memory of the device that the pipeline may use, with the KV cache taking the rest of it
+    // When non-zero and both num_kv_blocks and cache_size are equal to zero, num_kv_blocks is derived at pipeline
+    // initialization: a dummy batch of max_num_batched_tokens tokens split into up to max_num_seqs sequences is inferred
+    // to allocate the peak activation memory, which is subtracted together with the weights from the fraction of the
+    // device memory. The memory used by the other processes is subtracted as well for CPU, but not for GPU.
+    // Must be in (0, 1] range, requires max_num_batched_tokens to be limited. Speculative decoding requires the scheduler
+    // config of the draft model to be set, as the KV cache of the main model is sized before the draft model is loaded.
+    float kv_cache_memory_utilization = 0.0f;
+
+    // total size of the host memory swap space for KV cache blocks in GB
+    // When non-zero, sequence groups that would otherwise be fully preempted (and have their KV cache recomputed
+    // from scratch once rescheduled) get their KV cache blocks copied out to host memory instead and copied back
+    // into the device KV cache when rescheduled.
+    std::size_t swap_space_size = 0;
+
+    // total size of the on-disk swap space tier for KV cache blocks in GB
+    // The disk tier is used once the host memory swap space is exhausted. Has effect only if swap_space_path is set.
+    std::size_t swap_space_disk_size = 0;
+
+    // path to the file backing the on-disk swap space tier
+    // The file is created (or truncated) at pipeline initialization and is intended to be located on a fast local drive.
+    std::filesystem::path swap_space_path;
+
     // whether to split prompt / generate to different scheduling phases
     // Allows to process prompt partially in case when batch size is limited. 
     // If dynamic_split_fuse is turned off any prompt that is longer than batch size will lead to error.
     bool dynamic_split_fuse = true;
 
+    // max number of prompt tokens to be scheduled at a single step, over all sequence groups
+    // Long prompts are processed in chunks of at most this size, interleaved with generation steps of running sequences,
+    // which bounds the inter-token latency spikes caused by the prompts. Has effect only if dynamic_split_fuse is turned on.
+    // When set to zero prompt tokens are limited by max_num_batched_tokens only.
+    std::size_t max_num_prefill_tokens_per_step = 0;
+
+    // max fraction of max_num_batched_tokens that prompt tokens can take at a step where some sequences are generating
+    // Must be in (0, 1] range. Has effect only if dynamic_split_fuse is turned on.
+    float max_prefill_fraction = 1.0f;
+
+    // policy used to order sequence groups for scheduling and for choosing the preemption victims
+    // With the default FCFS policy the sequence groups are served in order of arrival.
+    SchedulingPolicy scheduling_policy = SchedulingPolicy::FCFS;
+
+    // max time in milliseconds a sequence group waits for its first scheduling before it is served in order of arrival,
+    // which bounds the starvation of the groups with little of their prompts cached. Has effect only with
+    // SchedulingPolicy::PREFIX_CACHE_AWARE.
+    std::size_t max_reordering_delay_ms = 1000;
+
+    // queue by which the outputs of the requests are passed to their GenerationHandle's
+    // SPSC_RING_BUFFER reduces the locking and the wakeups of the readers at high aggregate streaming rates.
+    StreamingTransport streaming_transport = StreamingTransport::SYNCHRONIZED_QUEUE;
+
+    // max number of n-grams of the outputs of completed requests kept in the store shared by all the requests of prompt
+    // lookup decoding, which provides the candidates when the n-gram is not found in the request's own context.
+    // When set to zero the store is not used. Has effect only with prompt lookup decoding.
+    std::size_t prompt_lookup_store_size = 0;
 
     /**
      * Whether to use cache eviction for all sequences processed by this pipeline. When cache eviction is enabled,
      * the per-sequence KV cache usage is capped by a user-configurable value, leading to memory savings at cost
-     * to generation quality.
+     * to generation quality. If prefix caching is enabled as well, the blocks of each sequence before its first evicted
+     * block (at least the start area) remain available for reuse by other sequences with the same prefix.
      */
     bool use_cache_eviction = false;
 
@@ -60,7 +142,18 @@ struct SchedulerConfig {
     // When ContinuousBatching is invoked from LLMPipeline (client scenario) by default prefix caching is turned on.
     bool enable_prefix_caching = false;
 
-    /** Whether to apply block-wise sparse attention to the prefill stage.
+    // path to the file persisting the prefix cache across pipeline instances, e.g. process restarts
+    // Has effect only if enable_prefix_caching is turned on. The cached KV-blocks are loaded from the file at pipeline
+    // initialization, if it exists and was saved for the same model and KV-cache configuration, and are saved to it
+    // when the pipeline is destroyed.
+    std::filesystem::path prefix_cache_path;
+
+    // precisions of the KV-cache of the individual decoder layers and grouping of the quantized values, e.g. as chosen
+    // by calibrate_kv_cache_precisions for a memory budget. By default all layers use the precision chosen by the plugin.
+    KVCachePrecisionConfig kv_cache_precision_config;
+
+    /** Whether to apply block-wise sparse attention to the prefill stage, and to the generation stage if
+     * `sparse_attention_config.decode_threshold` is less than 1.
      */
     bool use_sparse_attention = false;
     /** Configuration struct for the sparse attention prefill functionality.
@@ -69,9 +162,18 @@ struct SchedulerConfig {
 
     bool operator==(const SchedulerConfig& other) const {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
-               cache_size == other.cache_size &&
-               dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               cache_size == other.cache_size && kv_cache_memory_utilization == other.kv_cache_memory_utilization &&
+               swap_space_size == other.swap_space_size &&
+               swap_space_disk_size == other.swap_space_disk_size && swap_space_path == other.swap_space_path &&
+               dynamic_split_fuse == other.dynamic_split_fuse &&
+               max_num_prefill_tokens_per_step == other.max_num_prefill_tokens_per_step &&
+               max_prefill_fraction == other.max_prefill_fraction && scheduling_policy == other.scheduling_policy &&
+               max_reordering_delay_ms == other.max_reordering_delay_ms &&
+               streaming_transport == other.streaming_transport &&
+               prompt_lookup_store_size == other.prompt_lookup_store_size &&
+               use_cache_eviction == other.use_cache_eviction &&
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               prefix_cache_path == other.prefix_cache_path && kv_cache_precision_config == other.kv_cache_precision_config;
     }
 };
 }
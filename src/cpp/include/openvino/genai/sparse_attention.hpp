@@ -30,14 +30,18 @@ public:
                           size_t num_retained_recent_tokens_in_cache_,
                           float xattention_threshold_,
                           size_t xattention_block_size_,
-                          size_t xattention_stride_)
+                          size_t xattention_stride_,
+                          float decode_threshold_ = 1.0f,
+                          size_t decode_dense_interval_ = 16)
         : mode(mode_),
           num_last_dense_tokens_in_prefill(num_last_dense_tokens_in_prefill_),
           num_retained_start_tokens_in_cache(num_retained_start_tokens_in_cache_),
           num_retained_recent_tokens_in_cache(num_retained_recent_tokens_in_cache_),
           xattention_threshold(xattention_threshold_),
           xattention_block_size(xattention_block_size_),
-          xattention_stride(xattention_stride_) {}
+          xattention_stride(xattention_stride_),
+          decode_threshold(decode_threshold_),
+          decode_dense_interval(decode_dense_interval_) {}
 
     /**  Sparse attention mode to be applied. */
     SparseAttentionMode mode;
@@ -53,11 +57,11 @@ public:
      * */
     size_t num_last_dense_tokens_in_prefill = 100;
 
-    /** TRISHAPE mode only - The number of tokens in the beginning of the cache (least recent) to be retained when
-     * applying sparse attention. Must be a multiple of block size. */
+    /** TRISHAPE mode and sparse decoding - The number of tokens in the beginning of the cache (least recent) to be
+     * retained when applying sparse attention. Must be a multiple of block size. */
     size_t num_retained_start_tokens_in_cache = 128;
 
-    /** TRISHAPE mode only - The number of most recent tokens in cache to be retained when
+    /** TRISHAPE mode and sparse decoding - The number of most recent tokens in cache to be retained when
      * applying sparse attention. Must be a multiple of block size. */
     size_t num_retained_recent_tokens_in_cache = 1920;
 
@@ -78,6 +82,17 @@ public:
      *  M time to be calculated, then the importance score calculation would be taking `M / xattention_stride` time as
      *  overhead. */
     size_t xattention_stride = 8;
+
+    /** Both modes - Cumulative importance score threshold for the block-sparse attention in the generation stage. The
+     * importance of each KV cache block between the retained start and recent areas is the sum of the attention scores
+     * of its tokens at the last densely computed generation step. Only the most important blocks with the importance sum
+     * reaching this fraction of the total are attended to, the rest are skipped. The value of 1 disables sparse decoding,
+     * i.e. the generation stage attention is dense. Cannot be used together with cache eviction. */
+    float decode_threshold = 1.0f;
+
+    /** Both modes - Every `decode_dense_interval`-th generation step of a sequence is computed with dense attention to
+     * refresh the block importance scores for sparse decoding. */
+    size_t decode_dense_interval = 16;
 };
 
 }  // namespace ov::genai
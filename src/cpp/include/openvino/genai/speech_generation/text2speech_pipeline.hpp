@@ -6,6 +6,7 @@
 #include "openvino/genai/generation_config.hpp"
 #include "openvino/genai/speech_generation/speech_generation_config.hpp"
 #include "openvino/genai/speech_generation/speech_generation_perf_metrics.hpp"
+#include "openvino/genai/streamer_base.hpp"
 
 namespace ov {
 namespace genai {
@@ -20,6 +21,17 @@ struct Text2SpeechDecodedResults {
     SpeechGenerationPerfMetrics perf_metrics;
 };
 
+/**
+ * User callback for streaming speech generation, which is called within a pipeline with the following arguments:
+ * - Index of the input text the audio belongs to
+ * - Tensor with the next chunk of the text waveform sampled at 16 kHz, the adjacent chunks are crossfaded
+ * The callback returns StreamingStatus::RUNNING to continue, STOP to finish the generation with the audio produced so
+ * far or CANCEL to drop it. The texts are decoded one by one when the callback is set.
+ */
+using SpeechStreamer = std::function<StreamingStatus(size_t, const ov::Tensor&)>;
+
+static constexpr ov::Property<SpeechStreamer> speech_streamer{"speech_streamer"};
+
 /**
  * Text to speech pipelines which provides unified API to all supported models types.
  */
@@ -57,11 +69,13 @@ public:
 
     /**
      * Generates speeches based on input texts
-     * @param texts input texts for which to generate speeches
+     * @param texts input texts for which to generate speeches, they are decoded together in batches and each speech is
+     * vocoded while the rest of them are decoded
      * @param speaker_embedding Optional speaker embedding tensor representing the unique characteristics of a speaker's
      * voice. If not provided for SpeechT5 TSS model, the 7306th vector from the validation set of the
      * `Matthijs/cmu-arctic-xvectors` dataset is used by default.
-     * @param properties Speech generation parameters specified as properties
+     * @param properties Speech generation parameters specified as properties, 'speech_streamer' delivers the audio in
+     * chunks as soon as they are vocoded
      * @returns raw audios of the input texts spoken in the specified speaker's voice, with a sample rate of 16 kHz
      */
     Text2SpeechDecodedResults generate(const std::vector<std::string>& texts,
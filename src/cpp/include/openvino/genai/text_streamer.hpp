@@ -11,6 +11,8 @@ namespace genai {
 
 using CallbackTypeVariant = std::variant<bool, StreamingStatus>;
 
+class IncrementalDetokenizer;
+
 /**
  * @brief TextStreamer is used to decode tokens into text and call a user-defined callback function.
  *
@@ -32,6 +34,8 @@ private:
     std::vector<int64_t> m_tokens_cache;
     std::vector<int64_t> m_decoded_lengths;
     size_t m_printed_len = 0;
+    // decodes the tokens by their vocab pieces instead of decoding the whole cache, if the tokenizer allows
+    std::shared_ptr<IncrementalDetokenizer> m_incremental_detokenizer;
 
     StreamingStatus set_streaming_status(CallbackTypeVariant callback_status);
 
@@ -9,6 +9,7 @@
 #include <filesystem>
 #include <optional>
 
+#include "openvino/core/except.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/genai/visibility.hpp"
 #include <openvino/runtime/properties.hpp>
@@ -25,9 +26,36 @@ struct TokenizedInputs {
     std::optional<ov::Tensor> token_type_ids;
 };
 
+/**
+ * @brief Token ids of a batch of prompts without padding. The token ids of all prompts are stored one after another in
+ * input_ids of shape [1, total_num_tokens], the token ids of the prompt i are in the range [offsets[i], offsets[i + 1]).
+ */
+struct RaggedTokenizedInputs {
+    ov::Tensor input_ids;
+    // i64 tensor of shape [batch_size + 1]
+    ov::Tensor offsets;
+
+    size_t get_batch_size() const {
+        return offsets.get_size() - 1;
+    }
+
+    /**
+    * @brief token ids of a prompt, e.g. to be passed to ContinuousBatchingPipeline::add_request().
+    * @return tensor of shape [1, prompt_length] sharing the memory of input_ids
+    */
+    ov::Tensor get_input_ids(size_t index) const {
+        OPENVINO_ASSERT(index < get_batch_size(), "Prompt index ", index, " is out of range of batch size ", get_batch_size());
+        const int64_t* offsets_data = offsets.data<int64_t>();
+        return ov::Tensor(input_ids, {0, static_cast<size_t>(offsets_data[index])}, {1, static_cast<size_t>(offsets_data[index + 1])});
+    }
+};
+
 /**
  * @brief The class is used to encode prompts and decode resulting tokens
  *
+ * The detokenizer model is compiled on the first decode. The compiled tokenizer models are cached in ov::cache_dir
+ * like the models of the pipelines, if it's passed in the properties.
+ *
  * Chat template is initialized from sources in the following order
  * overriding the previous value:
  * 1. chat_template entry from tokenizer_config.json
@@ -132,6 +160,24 @@ public:
     */
     TokenizedInputs encode(const std::vector<std::string>& prompt, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::initializer_list<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
+
+    /**
+    * @brief encode a large batch of prompts in parallel. The prompts are sorted by length and split into shards,
+    * which are encoded concurrently by the infer requests of the tokenizer, see num_tokenizer_infer_requests.
+    * @param prompts vector storing batch of prompts
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}}
+    * @return token ids of each prompt without padding
+    */
+    std::vector<std::vector<int64_t>> encode_parallel(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
+
+    /**
+    * @brief encode a batch of prompts without padding. Same as encode_parallel(), but the token ids are stored in a
+    * single buffer, so that the memory doesn't depend on the longest prompt of the batch.
+    * @param prompts vector storing batch of prompts
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}}
+    * @return token ids of all prompts with the offsets of each prompt
+    */
+    RaggedTokenizedInputs encode_ragged(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
    
     /**
     * @brief encode paired prompts.
@@ -309,6 +355,11 @@ public:
 private:
     class TokenizerImpl;
     std::shared_ptr<TokenizerImpl> m_pimpl;
+
+    friend class TextStreamer;
+    friend class BatchedTextStreamer;
+    // The bytes each token id is detokenized to, empty if the pieces can't be concatenated instead of decode() calls.
+    const std::vector<std::string>& get_detokenization_pieces() const;
 };
 
 static constexpr ov::Property<bool> add_second_input{"add_second_input"};
@@ -316,6 +367,18 @@ static constexpr ov::Property<bool> add_special_tokens{"add_special_tokens"};
 static constexpr ov::Property<bool> skip_special_tokens{"skip_special_tokens"};
 static constexpr ov::Property<bool> pad_to_max_length{"pad_to_max_length"};
 static constexpr ov::Property<std::string> padding_side{"padding_side"};
+/**
+ * @brief The number of the infer requests of the tokenizer model, each one compiled with its own CPU stream, so that
+ * encode_parallel() runs them on different cores. The threads of the streams can be pinned with ov::hint::enable_cpu_pinning.
+ * Defaults to the optimal number of infer requests of the compiled tokenizer.
+ */
+static constexpr ov::Property<size_t> num_tokenizer_infer_requests{"num_tokenizer_infer_requests"};
+/**
+ * @brief Encodes and decodes the byte-level BPE vocab of a GGUF file natively instead of building and compiling the
+ * OpenVINO tokenizer models from it. The prompts with characters the native pre-tokenizer can't classify are encoded
+ * by the tokenizer model, which is then built on the first such prompt. Ignored for the other tokenizers.
+ */
+static constexpr ov::Property<bool> native_gguf_tokenizer{"native_gguf_tokenizer"};
 
 }  // namespace genai
 }  // namespace ov
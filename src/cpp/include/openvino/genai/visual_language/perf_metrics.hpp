@@ -12,6 +12,10 @@ namespace ov::genai {
 struct OPENVINO_GENAI_EXPORTS VLMRawPerfMetrics {
     /** @brief Duration of preparation of embeddings */
     std::vector<MicroSeconds> prepare_embeddings_durations;
+    /** @brief Number of images, whose embeddings were taken from the vision embedding cache */
+    size_t vision_embedding_cache_hits = 0;
+    /** @brief Number of images encoded while the vision embedding cache is enabled */
+    size_t vision_embedding_cache_misses = 0;
 };
 
 struct OPENVINO_GENAI_EXPORTS VLMPerfMetrics : public PerfMetrics {
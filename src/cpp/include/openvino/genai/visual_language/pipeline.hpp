@@ -228,6 +228,14 @@ public:
     /// @param new_config A config to override default values with.
     void set_generation_config(const GenerationConfig& new_config);
 
+    /// @brief Generate a few tokens greedily for a dummy prompt of each of
+    /// the prompt lengths, with a dummy image if config.image_size is set,
+    /// so that the kernels for these shapes are compiled before the first
+    /// real requests. Must not be called in a chat.
+    /// @param config The prompt lengths, the image size and the number of
+    /// the generated tokens.
+    void warmup(const WarmupConfig& config = {});
+
 private:
     class VLMPipelineBase;
     class VLMPipelineImpl;
@@ -241,4 +249,43 @@ private:
 */
 static constexpr ov::Property<ov::Tensor> image{"image"};
 static constexpr ov::Property<std::vector<ov::Tensor>> images{"images"};
+
+/**
+ * @brief Videos to be prepended to a prompt, uint8 RGB frames with [NHWC] layout, a tensor per video. The frames are
+ * sampled uniformly, resized to fit the token budget and encoded in a single inference, see the video_* parameters of
+ * preprocessor_config.json. Only Qwen2-VL and Qwen2.5-VL support videos. A video is placed after the images and is
+ * referred to as the image of the next index, e.g. <ov_genai_image_1> refers to the video prompted with one image.
+ */
+static constexpr ov::Property<std::vector<ov::Tensor>> videos{"videos"};
+
+/**
+ * @brief Max total size in bytes of the image embeddings cached by VLMPipeline or ContinuousBatchingPipeline, so that
+ * the images repeated across the requests are encoded once. The embeddings are looked up by the content hash of the
+ * image, the least recently used ones are dropped once the size is exceeded. 0 (default) disables the cache.
+ */
+static constexpr ov::Property<size_t> vision_embedding_cache_size{"vision_embedding_cache_size"};
+
+/**
+ * @brief Ratio in (0, 1] of the image tokens passed to the language model by VLMPipeline or ContinuousBatchingPipeline,
+ * so that the prefill of the image heavy prompts is faster. The most similar adjacent image tokens are merged into their
+ * average until the ratio of them is left. Only LLaVA, LLaVA-Next and InternVL support it, the lower ratios trade the
+ * accuracy for the speed. 1 (default) keeps all the tokens.
+ */
+static constexpr ov::Property<float> visual_token_keep_ratio{"visual_token_keep_ratio"};
+
+/**
+ * @brief Lets ContinuousBatchingPipeline, also used as a VLMPipeline backend, generate a batch of prompts while encoding
+ * their images: the images of the prompts are encoded one prompt at a time by a worker thread, and the prefill of each
+ * prompt starts once it's encoded, overlapping with the encoding of the next prompts. Otherwise (default) the images of
+ * all the prompts are encoded together before the generation starts.
+ */
+static constexpr ov::Property<bool> overlap_vision_encoding{"overlap_vision_encoding"};
+
+/**
+ * @brief Lets ContinuousBatchingPipeline, also used as a VLMPipeline backend, look up the embeddings of the generated
+ * tokens within the language model: the text embeddings model is merged into it, so that the language model takes the
+ * ids of the generated tokens along with the embeddings of the prompts, and the embeddings model isn't inferred at each
+ * step. The language model holds its own copy of the embeddings table then. Disabled by default.
+ */
+static constexpr ov::Property<bool> embeddings_lookup_in_model{"embeddings_lookup_in_model"};
 }
@@ -0,0 +1,34 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief The shapes run by `warmup()` of the pipelines, so that the kernels for them are compiled and the caches are
+ * filled before the first real requests, e.g. on GPU, where the kernels for new shapes are compiled lazily.
+ * The outputs of the warm-up are discarded, the pipelines should be warmed up before a chat is started.
+ */
+struct WarmupConfig {
+    // lengths of the dummy prompts in tokens, a prompt is generated for each combination of a length and a batch size
+    // VLMPipeline builds the prompts of the words approximately tokenized to these lengths,
+    // WhisperPipeline and image generation pipelines ignore them
+    std::vector<size_t> prompt_lengths = {16, 128, 512};
+
+    // numbers of the prompts generated together, the number of images per prompt for image generation pipelines
+    // VLMPipeline and WhisperPipeline generate a prompt at a time and ignore them
+    std::vector<size_t> batch_sizes = {1};
+
+    // number of the tokens generated for each prompt, at least 2 to run the shapes of the generation stage as well
+    size_t max_new_tokens = 2;
+
+    // side of a square dummy RGB image passed with each prompt to VLMPipeline, 0 for text-only prompts
+    // side of the generated images for image generation pipelines, 0 for the size of their generation config
+    size_t image_size = 0;
+};
+
+}  // namespace ov::genai
@@ -91,6 +91,40 @@ public:
      */
     std::optional<std::string> hotwords = std::nullopt;
 
+    /*
+     * If set, long-form audio is split into 30 seconds windows which overlap by `stride_length` seconds on each side,
+     * instead of seeking each next window by the timestamps of the previous one. The windows are encoded and decoded
+     * as a batch, and the texts of the overlapping windows are merged by their matching tokens. The stride must be
+     * shorter than half of the window length.
+     *
+     * Example:
+     *  auto result = pipeline.generate(raw_speech, ov::genai::stride_length(5.0f));
+     */
+    std::optional<float> stride_length = std::nullopt;
+
+    /*
+     * If `true`, the silence of the audio is skipped before the encoding: the speech regions are detected by the energy
+     * of the audio frames and packed back to back, the timestamps of the segments are mapped back to the original audio.
+     * The recordings with long pauses are transcribed with fewer windows.
+     */
+    bool vad_filter = false;
+
+    /*
+     * If `true`, the pipeline returns the timestamps of each word of the text in WhisperDecodedResults::words. The
+     * tokens are aligned to the audio frames by dynamic time warping of the cross-attention weights of the
+     * `alignment_heads`. The weights are computed by the decoder model, so the pipeline must be created with the
+     * `ov::genai::word_timestamps(true)` property. Supported for the single inputs of the stateful decoder models.
+     *
+     * Example:
+     *  ov::genai::WhisperPipeline pipeline(models_path, "CPU", ov::genai::word_timestamps(true));
+     *  auto result = pipeline.generate(raw_speech, ov::genai::word_timestamps(true));
+     *  //  result.words: [{" He", 0.0, 0.24}, {" has", 0.24, 0.42}, ...]
+     */
+    bool word_timestamps = false;
+
+    // The (layer, head) pairs of the decoder cross-attention heads aligned with the speech, as of generation_config.json.
+    std::vector<std::pair<size_t, size_t>> alignment_heads;
+
     // A list containing tokens that will be suppressed at the beginning of the sampling process.
     std::vector<int64_t> begin_suppress_tokens;
 
@@ -127,6 +161,10 @@ static constexpr ov::Property<std::string> task{"task"};
 static constexpr ov::Property<bool> return_timestamps{"return_timestamps"};
 static constexpr ov::Property<std::string> initial_prompt{"initial_prompt"};
 static constexpr ov::Property<std::string> hotwords{"hotwords"};
+static constexpr ov::Property<float> stride_length{"stride_length"};
+static constexpr ov::Property<bool> vad_filter{"vad_filter"};
+static constexpr ov::Property<bool> word_timestamps{"word_timestamps"};
+static constexpr ov::Property<std::vector<std::pair<size_t, size_t>>> alignment_heads{"alignment_heads"};
 static constexpr ov::Property<std::map<std::string, int64_t>> lang_to_id{"lang_to_id"};
 
 }  // namespace genai
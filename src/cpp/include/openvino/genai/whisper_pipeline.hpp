@@ -109,10 +109,22 @@ struct WhisperDecodedResultChunk {
     std::string text;
 };
 
+struct WhisperWordTiming {
+    // the word with its leading space, if any
+    std::string word;
+    std::vector<int64_t> token_ids;
+
+    // start and end of the word in seconds
+    float start_ts;
+    float end_ts;
+};
+
 struct WhisperDecodedResults {
     std::vector<std::string> texts;
     std::vector<float> scores;
     std::optional<std::vector<WhisperDecodedResultChunk>> chunks = std::nullopt;
+    // the words of the text with their timings, if word_timestamps of WhisperGenerationConfig is set
+    std::optional<std::vector<WhisperWordTiming>> words = std::nullopt;
     WhisperPerfMetrics perf_metrics;
 
     operator std::string() const {
@@ -142,6 +154,16 @@ struct WhisperDecodedResults {
     }
 };
 
+/**
+ * @brief The transcription update of an audio stream after a pushed chunk of audio
+ */
+struct WhisperStreamingResult {
+    // the text confirmed by this update, it's not changed by the later audio and follows the previously stable text
+    std::string stable_text;
+    // the unconfirmed rest of the current hypothesis, it replaces the previous partial text
+    std::string partial_text;
+};
+
 /**
  * @brief Automatic speech recognition pipeline
  */
@@ -208,11 +230,65 @@ public:
     }
     WhisperDecodedResults generate(const RawSpeechInput& raw_speech_input, const ov::AnyMap& config_map);
 
+    /**
+     * @brief Transcribes several audio inputs together, e.g. concurrent audio streams, so that the encoder and decoder
+     * inferences process the inputs as a batch instead of one at a time.
+     *
+     * @param raw_speech_inputs raw speech inputs. Required to be normalized to near [-1, 1] range and have 16k Hz
+     * sampling rate.
+     * @param generation_config optional GenerationConfig used for all the inputs
+     * @return std::vector<WhisperDecodedResults> decoded resulting text transcription of each input
+     */
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                OptionalWhisperGenerationConfig generation_config = std::nullopt);
+
+    /**
+     * @brief Starts the transcription of an audio stream, e.g. for live captioning. The stream audio is pushed in
+     * chunks as it arrives, each push_audio() call decodes the buffered audio again and returns the text confirmed
+     * by two consecutive hypotheses as stable and the rest as partial. The buffer is trimmed at the end of the stable
+     * segments, so that the latency doesn't grow with the stream duration.
+     *
+     * @param generation_config optional GenerationConfig of the stream
+     */
+    void start_stream(OptionalWhisperGenerationConfig generation_config = std::nullopt);
+
+    /**
+     * @brief Appends a chunk of the stream audio and updates the transcription
+     *
+     * @param audio_chunk raw speech chunk. Required to be normalized to near [-1, 1] range and have 16k Hz sampling
+     * rate.
+     * @return WhisperStreamingResult the newly stable text and the partial text
+     */
+    WhisperStreamingResult push_audio(const RawSpeechInput& audio_chunk);
+
+    /**
+     * @brief Finishes the stream, the rest of the transcription is returned as stable
+     */
+    WhisperStreamingResult finish_stream();
+
     ov::genai::Tokenizer get_tokenizer();
     WhisperGenerationConfig get_generation_config() const;
     void set_generation_config(const WhisperGenerationConfig& config);
+
+    /**
+     * @brief Transcribes a second of silence generating up to config.max_new_tokens, so that the kernels of the
+     * encoder and the decoder are compiled before the first real requests.
+     *
+     * @param config the number of the generated tokens, the other fields are ignored
+     */
+    void warmup(const WarmupConfig& config = {});
 };
 
 OPENVINO_GENAI_EXPORTS std::pair<std::string, Any> generation_config(const WhisperGenerationConfig& config);
+
+/**
+ * @brief The dir of a smaller Whisper model with the same tokenizer and encoder hidden states size, e.g.
+ * distil-whisper, whose decoder drafts the tokens for assisted generation. The tokens are drafted from the encoder
+ * hidden states of the pipeline model and validated by its decoder, so that the transcription is the same. The draft
+ * decoder is compiled for the pipeline device with the pipeline properties. Assisted generation is enabled by
+ * num_assistant_tokens or assistant_confidence_threshold of WhisperGenerationConfig for the greedy decoding of single
+ * inputs.
+ */
+static constexpr ov::Property<std::string> draft_decoder_path{"draft_decoder_path"};
 }  // namespace genai
 }  // namespace ov
@@ -63,6 +63,17 @@ public:
         return idle_future;
     }
 
+    // returns an idle value or -1 without waiting for it
+    int try_get_idle() {
+        std::unique_lock<std::mutex> lk(m_front_mut);
+        int value = m_values[m_front_idx];
+        if (value >= 0) {
+            m_values[m_front_idx] = -1;
+            m_front_idx = (m_front_idx + 1) % m_values.size();
+        }
+        return value;
+    }
+
     void return_to(int value) {
         std::unique_lock<std::mutex> lk(m_queue_mutex);
         if (m_promises.size()) {
@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ov::genai {
+
+/// @brief 128 bit hash of a content, e.g. of an image or of an embedding of a prompt token.
+struct ContentHash {
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    bool operator==(const ContentHash& other) const {
+        return low == other.low && high == other.high;
+    }
+};
+
+struct ContentHashHasher {
+    size_t operator()(const ContentHash& hash) const {
+        return static_cast<size_t>(hash.low ^ (hash.high * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+namespace detail {
+inline uint64_t mix_hash(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+}  // namespace detail
+
+/// @brief Incrementally hashes a stream of words into two independent lanes, chained to the given hash. Hashing the words
+/// one by one gives the same hash as hash_bytes of the words stored contiguously, regardless of how the stream is split.
+class ContentHasher {
+public:
+    explicit ContentHasher(const ContentHash& hash = {}) : m_low(hash.low ^ 0x243F6A8885A308D3ull), m_high(hash.high ^ 0x13198A2E03707344ull) {}
+
+    void update(uint64_t word) {
+        m_low = (m_low ^ word) * 0x9E3779B97F4A7C15ull;
+        m_low = (m_low << 31) | (m_low >> 33);
+        m_high = (m_high + word) * 0xC2B2AE3D27D4EB4Full;
+        m_high ^= m_high >> 29;
+        m_size += sizeof(word);
+    }
+
+    void update(const ContentHash& hash) {
+        update(hash.low);
+        update(hash.high);
+    }
+
+    /// @param tail The bytes following the last word, fewer than a word, zero-padded.
+    /// @param tail_size The number of these bytes.
+    ContentHash finalize(uint64_t tail = 0, size_t tail_size = 0) const {
+        const uint64_t size = m_size + tail_size;
+        return {detail::mix_hash(m_low ^ tail ^ size), detail::mix_hash(m_high + tail + size)};
+    }
+
+private:
+    uint64_t m_low, m_high;
+    uint64_t m_size = 0;
+};
+
+/// @brief Hashes the bytes a word at a time into two independent lanes, chained to the given hash.
+inline void hash_bytes(const void* data, size_t size, ContentHash& hash) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    ContentHasher hasher(hash);
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= size; pos += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + pos, sizeof(word));
+        hasher.update(word);
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, bytes + pos, size - pos);
+    hash = hasher.finalize(tail, size - pos);
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,226 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/genai/tokenizer.hpp"
+#include "tokenizer/incremental_detokenizer.hpp"
+#include "synchronized_queue.hpp"
+#include "logger.hpp"
+
+namespace ov::genai {
+
+/**
+ * Streams the text of several requests on a worker thread, so that the detokenization doesn't delay the steps of the
+ * pipeline. The new tokens of all the streams written at once are detokenized together: by the vocab pieces if the
+ * tokenizer allows, otherwise by a single batched decode of the token caches of the streams, which are cleared after
+ * each new line like in TextStreamer.
+ */
+class BatchedTextStreamer {
+public:
+    using DecodeFunction = std::function<std::vector<std::string>(const std::vector<std::vector<int64_t>>&)>;
+    using TextCallback = std::function<void(const std::string&)>;
+
+    struct StreamTokens {
+        uint64_t stream_id;
+        std::vector<int64_t> tokens;
+        // ends the stream after its tokens
+        bool is_last = false;
+        // called on the worker thread after the last text of the stream, may be empty
+        std::function<void()> on_end;
+    };
+
+    explicit BatchedTextStreamer(const Tokenizer& tokenizer) :
+            BatchedTextStreamer([tokenizer = Tokenizer(tokenizer)](const std::vector<std::vector<int64_t>>& lines) mutable { return tokenizer.decode(lines); },
+                                tokenizer.get_detokenization_pieces()) {}
+
+    /**
+     * @param decode Decodes a batch of token sequences, called on the worker thread.
+     * @param pieces The bytes each token id is detokenized to, empty to use `decode`. Must outlive the streamer.
+     */
+    BatchedTextStreamer(DecodeFunction decode, const std::vector<std::string>& pieces) :
+            m_decode(std::move(decode)), m_pieces(pieces) {
+        m_worker_thread = std::thread(&BatchedTextStreamer::run, this);
+    }
+
+    ~BatchedTextStreamer() {
+        end();
+    }
+
+    /**
+     * @param callback Called on the worker thread with the new text of the stream.
+     */
+    void add_stream(uint64_t stream_id, TextCallback callback) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        OPENVINO_ASSERT(m_streams.count(stream_id) == 0, "Text stream ", stream_id, " already exists");
+        auto& stream = m_streams[stream_id];
+        stream.callback = std::move(callback);
+        if (!m_pieces.empty()) {
+            stream.detokenizer = std::make_unique<IncrementalDetokenizer>(m_pieces);
+        }
+    }
+
+    /**
+     * Queues the new tokens of the streams, each stream is expected once at most.
+     */
+    void write(std::vector<StreamTokens> new_tokens) {
+        if (!new_tokens.empty()) {
+            m_queue.push(std::move(new_tokens));
+        }
+    }
+
+    /**
+     * Waits for the written tokens to be streamed and stops the worker thread.
+     */
+    void end() {
+        if (m_worker_thread.joinable()) {
+            m_queue.push(std::monostate());
+            m_worker_thread.join();
+        }
+    }
+
+private:
+    struct Stream {
+        TextCallback callback;
+        std::unique_ptr<IncrementalDetokenizer> detokenizer;
+        std::vector<int64_t> tokens_cache;
+        // the number of cached tokens and the length of their text after a decode, -1 if the text is incomplete
+        std::vector<std::pair<size_t, int64_t>> decoded_lengths;
+        size_t printed_len = 0;
+    };
+
+    void run() {
+        while (true) {
+            auto item = m_queue.pull();
+            auto new_tokens = std::get_if<std::vector<StreamTokens>>(&item);
+            if (!new_tokens) {
+                break;
+            }
+            try {
+                stream(*new_tokens);
+            } catch (const std::exception& e) {
+                Logger::warn(std::string("Text streaming has failed: ") + e.what());
+            }
+        }
+    }
+
+    void stream(const std::vector<StreamTokens>& new_tokens) {
+        std::vector<Stream*> streams;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& stream_tokens : new_tokens) {
+                auto it = m_streams.find(stream_tokens.stream_id);
+                OPENVINO_ASSERT(it != m_streams.end(), "Text stream ", stream_tokens.stream_id, " doesn't exist");
+                streams.push_back(&it->second);
+            }
+        }
+
+        std::vector<std::string> texts(new_tokens.size());
+        if (!m_pieces.empty()) {
+            for (size_t i = 0; i < new_tokens.size(); ++i) {
+                for (int64_t token : new_tokens[i].tokens) {
+                    texts[i] += streams[i]->detokenizer->append(token);
+                }
+                if (new_tokens[i].is_last) {
+                    texts[i] += streams[i]->detokenizer->flush();
+                }
+            }
+        } else {
+            std::vector<std::vector<int64_t>> lines;
+            std::vector<size_t> line_indices;
+            for (size_t i = 0; i < new_tokens.size(); ++i) {
+                auto& tokens_cache = streams[i]->tokens_cache;
+                tokens_cache.insert(tokens_cache.end(), new_tokens[i].tokens.begin(), new_tokens[i].tokens.end());
+                if (!tokens_cache.empty()) {
+                    lines.push_back(tokens_cache);
+                    line_indices.push_back(i);
+                }
+            }
+            std::vector<std::string> decoded_lines = lines.empty() ? std::vector<std::string>{} : m_decode(lines);
+            OPENVINO_ASSERT(decoded_lines.size() == lines.size());
+            for (size_t i = 0; i < new_tokens.size(); ++i) {
+                auto line_it = std::find(line_indices.begin(), line_indices.end(), i);
+                const std::string text = line_it == line_indices.end() ? "" : decoded_lines[line_it - line_indices.begin()];
+                texts[i] = get_new_text(*streams[i], text, new_tokens[i].is_last);
+            }
+        }
+
+        for (size_t i = 0; i < new_tokens.size(); ++i) {
+            try {
+                if (!texts[i].empty() && streams[i]->callback) {
+                    streams[i]->callback(texts[i]);
+                }
+                if (new_tokens[i].is_last && new_tokens[i].on_end) {
+                    new_tokens[i].on_end();
+                }
+            } catch (const std::exception& e) {
+                Logger::warn("Text stream " + std::to_string(new_tokens[i].stream_id) + " callback has thrown: " + e.what());
+            }
+            if (new_tokens[i].is_last) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_streams.erase(new_tokens[i].stream_id);
+            }
+        }
+    }
+
+    // the text of the cached tokens which hasn't been printed yet and won't change with the following tokens
+    static std::string get_new_text(Stream& stream, const std::string& text, bool is_last) {
+        if (is_last || (!text.empty() && text.back() == '\n')) {
+            // flush the cache at the end of the stream and after the new line symbol
+            std::string new_text = text.size() > stream.printed_len ? text.substr(stream.printed_len) : "";
+            stream.tokens_cache.clear();
+            stream.decoded_lengths.clear();
+            stream.printed_len = 0;
+            return new_text;
+        }
+
+        // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
+        constexpr char replacement[] = "\xef\xbf\xbd";
+        const bool is_incomplete = text.size() >= 3 && text.compare(text.size() - 3, 3, replacement) == 0;
+        stream.decoded_lengths.emplace_back(stream.tokens_cache.size(), is_incomplete ? -1 : static_cast<int64_t>(text.size()));
+        if (is_incomplete) {
+            return {};
+        }
+
+        // adding the next tokens can shorten the text, e.g. when apostrophe removing regex has worked,
+        // so the text of the last tokens is delayed
+        constexpr size_t delay_n_tokens = 3;
+        auto printable = std::find_if(stream.decoded_lengths.rbegin(), stream.decoded_lengths.rend(), [&](const auto& decoded_length) {
+            return decoded_length.first + delay_n_tokens <= stream.tokens_cache.size();
+        });
+        if (printable == stream.decoded_lengths.rend()) {
+            return {};
+        }
+        const int64_t print_until = std::min(printable->second, static_cast<int64_t>(text.size()));
+        // the older lengths are not needed anymore
+        stream.decoded_lengths.erase(stream.decoded_lengths.begin(), printable.base() - 1);
+        if (print_until <= static_cast<int64_t>(stream.printed_len)) {
+            return {};
+        }
+        std::string new_text = text.substr(stream.printed_len, print_until - stream.printed_len);
+        stream.printed_len = print_until;
+        return new_text;
+    }
+
+    // holds the tokenizer owning the pieces, if constructed from it
+    DecodeFunction m_decode;
+    const std::vector<std::string>& m_pieces;
+
+    std::mutex m_mutex;
+    std::unordered_map<uint64_t, Stream> m_streams;
+    SynchronizedQueue<std::variant<std::vector<StreamTokens>, std::monostate>> m_queue;
+    std::thread m_worker_thread;
+};
+
+}  // namespace ov::genai
@@ -6,11 +6,16 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
 #include <fstream>
 #include <chrono>
+#include <limits>
 
 #include "sequence_group.hpp"
+#include "continuous_batching/prefix_tree.hpp"
 
 namespace ov::genai {
 
@@ -18,6 +23,8 @@ class KVCacheBlock {
     int m_ref_count;
     int m_index;
     size_t m_hash;
+    // whether the block contents correspond to the prefix identified by the hash, so that these may be reused
+    bool m_is_hashed = false;
     std::chrono::time_point<std::chrono::steady_clock> m_timestamp;
 public:
     using Ptr = std::shared_ptr<KVCacheBlock>;
@@ -32,6 +39,11 @@ public:
         return m_index;
     }
 
+    // moves the descriptor to another physical block, the contents are to be copied by the caller
+    void set_index(int index) {
+        m_index = index;
+    }
+
     bool is_free() const {
         return m_ref_count == 0;
     }
@@ -59,6 +71,15 @@ public:
 
     void set_hash(size_t hash) {
         m_hash = hash;
+        m_is_hashed = true;
+    }
+
+    bool is_hashed() const {
+        return m_is_hashed;
+    }
+
+    void reset_hash() {
+        m_is_hashed = false;
     }
 
     void set_timestamp(const std::chrono::time_point<std::chrono::steady_clock>& timestamp) {
@@ -79,8 +100,18 @@ using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
  * runs out of fresh blocks, or reused if their contents match to the prefix-based requested hash.
  */
 class OverwritableBlocksHashStore {
-    std::map<size_t, BlocksPerLayer> m_blocks;
+    using Timestamp = std::chrono::time_point<std::chrono::steady_clock>;
+    // (timestamp, hash) pairs ordered from the least to the most recently used block; the hash makes the keys unique
+    using LRUIndex = std::set<std::pair<Timestamp, size_t>>;
+    struct StoredBlocks {
+        BlocksPerLayer blocks_for_all_layers;
+        LRUIndex::iterator lru_position;
+    };
+    std::unordered_map<size_t, StoredBlocks> m_blocks;
+    LRUIndex m_lru_index;
     size_t m_num_layers;
+    // overwritten only if the store has no other blocks
+    std::unordered_set<size_t> m_pinned_hashes;
     public:
     /**
      * Constructs the BlockHashStore.
@@ -104,7 +135,8 @@ class OverwritableBlocksHashStore {
             }
         }
         OPENVINO_ASSERT(m_blocks.count(hash) == 0);
-        m_blocks[hash] = blocks_for_all_layers;
+        auto lru_position = m_lru_index.emplace(blocks_for_all_layers[0]->get_timestamp(), hash).first;
+        m_blocks.emplace(hash, StoredBlocks{blocks_for_all_layers, lru_position});
     }
 
 
@@ -120,12 +152,13 @@ class OverwritableBlocksHashStore {
         {
             return {};
         }
-        BlocksPerLayer blocks_for_all_layers = it->second;
+        BlocksPerLayer blocks_for_all_layers = std::move(it->second.blocks_for_all_layers);
         for (auto& block_ptr : blocks_for_all_layers) {
 
             block_ptr->set_timestamp(std::chrono::steady_clock::now());
             block_ptr->increment();
         }
+        m_lru_index.erase(it->second.lru_position);
         m_blocks.erase(it);
         return blocks_for_all_layers;
     }
@@ -137,18 +170,76 @@ class OverwritableBlocksHashStore {
      * based on the timestamp.
      */
     BlocksPerLayer get_lru_block_to_overwrite() {
-        if (m_blocks.empty()) {
-            return {};
+        // the pinned blocks are skipped, unless only they are left
+        const bool skip_pinned = m_pinned_hashes.size() < m_blocks.size() || std::any_of(m_blocks.begin(), m_blocks.end(), [this](const auto& stored) {
+            return m_pinned_hashes.count(stored.first) == 0;
+        });
+        for (auto lru_position = m_lru_index.begin(); lru_position != m_lru_index.end();) {
+            auto [indexed_timestamp, hash] = *lru_position;
+            auto it = m_blocks.find(hash);
+            OPENVINO_ASSERT(it != m_blocks.end());
+            Timestamp actual_timestamp = it->second.blocks_for_all_layers[0]->get_timestamp();
+            if (actual_timestamp != indexed_timestamp) {
+                // the block timestamp was updated while in the store - since timestamps only grow, re-index it lazily
+                // and look further, the remaining index keys are still lower bounds of the actual block timestamps
+                lru_position = m_lru_index.erase(lru_position);
+                it->second.lru_position = m_lru_index.emplace(actual_timestamp, hash).first;
+                continue;
+            }
+            if (skip_pinned && m_pinned_hashes.count(hash)) {
+                ++lru_position;
+                continue;
+            }
+            m_lru_index.erase(lru_position);
+            auto blocks_for_all_layers = std::move(it->second.blocks_for_all_layers);
+            m_blocks.erase(it);
+            auto timestamp = std::chrono::steady_clock::now();
+            for (auto& block_ptr : blocks_for_all_layers) {
+                block_ptr->set_timestamp(timestamp);
+                block_ptr->increment();
+            }
+            return blocks_for_all_layers;
         }
-        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [](const auto& lhs, const auto& rhs) -> bool { return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp(); });
-        auto blocks_for_all_layers = hash_and_blocks_for_all_layers->second;
-        auto timestamp = std::chrono::steady_clock::now();
-        for (auto& block_ptr : blocks_for_all_layers) {
-            block_ptr->set_timestamp(timestamp);
-            block_ptr->increment();
+        return {};
+    }
+
+    /**
+     * Pins the blocks, e.g. the ones of the history of an active chat, so that they are overwritten after all the other
+     * blocks of the store. Replaces the previously pinned hashes.
+     * @param hashes The hashes of the blocks to be pinned, may refer to the blocks, which are not in the store yet.
+     */
+    void set_pinned_hashes(std::unordered_set<size_t> hashes) {
+        m_pinned_hashes = std::move(hashes);
+    }
+
+    /**
+     * @param hash The hash value to look up in the store.
+     * @return Whether the blocks with this hash are present in the store.
+     */
+    bool contains(size_t hash) const {
+        return m_blocks.count(hash) > 0;
+    }
+
+    /**
+     * @param hash The hash value to look up in the store.
+     * @return The KV cache blocks (one for each decoder layer) stored under this hash, left in the store, or an empty
+     * vector if there are none.
+     */
+    BlocksPerLayer find(size_t hash) const {
+        auto it = m_blocks.find(hash);
+        return it == m_blocks.end() ? BlocksPerLayer{} : it->second.blocks_for_all_layers;
+    }
+
+    /**
+     * @return The hashes of the blocks currently in the store, from the least to the most recently used one.
+     */
+    std::vector<size_t> get_hashes() const {
+        std::vector<size_t> hashes;
+        hashes.reserve(m_blocks.size());
+        for (const auto& [timestamp, hash] : m_lru_index) {
+            hashes.push_back(hash);
         }
-        m_blocks.erase(hash_and_blocks_for_all_layers->first);
-        return blocks_for_all_layers;
+        return hashes;
     }
 
     /**
@@ -171,7 +262,8 @@ class OverwritableBlocksHashStore {
         for (uint64_t hash : hashes_to_discard) {
             auto it = m_blocks.find(hash);
             if (it != m_blocks.end()) {
-                retval.push_back(it->second);
+                retval.push_back(std::move(it->second.blocks_for_all_layers));
+                m_lru_index.erase(it->second.lru_position);
                 m_blocks.erase(it);
             }
         }
@@ -180,6 +272,7 @@ class OverwritableBlocksHashStore {
 };
 
 class CacheStateDumper;
+class CacheStateRecorder;
 
 /**
  * @brief Maintains a pool of KV cache block descriptors (layered as configured at initialization), freeing or allocating
@@ -192,6 +285,7 @@ class BlockAllocator {
     std::vector<size_t> m_free_blocks_num;
     size_t m_total_num_blocks;
     friend class CacheStateDumper;
+    friend class CacheStateRecorder;
     size_t m_num_layers;
     bool m_enable_prefix_caching;
     ov::genai::OverwritableBlocksHashStore m_overwriteable_blocks;
@@ -243,6 +337,111 @@ public:
         m_total_num_blocks = new_kv_blocks_count;
     }
 
+    /**
+     * Removes the blocks at the end of the pool, e.g. after the occupied blocks have been moved to the beginning of
+     * the pool by compact().
+     * @param new_kv_blocks_count The number of blocks left in the pool, the blocks past it must be free and hold no
+     * contents reusable by prefix caching, see get_min_number_of_kv_blocks.
+     */
+    void decrease_kv_blocks_number(size_t new_kv_blocks_count) {
+        OPENVINO_ASSERT(new_kv_blocks_count < m_total_num_blocks, "New blocks number should be less than previous blocks number.");
+        OPENVINO_ASSERT(new_kv_blocks_count >= get_min_number_of_kv_blocks(), "KV cache blocks past ", new_kv_blocks_count, " are in use");
+        size_t removed_blocks = m_total_num_blocks - new_kv_blocks_count;
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            m_free_blocks[layer_idx].remove_if([new_kv_blocks_count](const KVCacheBlock::Ptr& block) {
+                return static_cast<size_t>(block->get_index()) >= new_kv_blocks_count;
+            });
+            m_free_blocks_num[layer_idx] -= removed_blocks;
+        }
+        m_total_num_blocks = new_kv_blocks_count;
+    }
+
+    /**
+     * @return The number of blocks the pool can be decreased to, i.e. the number of blocks up to the last one, which is
+     * either occupied or holds the contents reusable by prefix caching, in any layer.
+     */
+    size_t get_min_number_of_kv_blocks() const {
+        size_t min_num_blocks = 0;
+        for (const auto& per_layer_block_list : m_free_blocks) {
+            std::vector<bool> is_free(m_total_num_blocks, false);
+            for (const auto& block : per_layer_block_list) {
+                is_free[block->get_index()] = true;
+            }
+            size_t num_blocks = m_total_num_blocks;
+            while (num_blocks > min_num_blocks && is_free[num_blocks - 1]) {
+                --num_blocks;
+            }
+            min_num_blocks = std::max(min_num_blocks, num_blocks);
+        }
+        return min_num_blocks;
+    }
+
+    /**
+     * Moves the contents of the occupied blocks with the highest indices into the free blocks with the lowest ones, so
+     * that the occupied blocks take the beginning of the pool and the free ones take a contiguous range after them,
+     * which is allocated from its beginning afterwards. The descriptors of the moved and of the free blocks exchange
+     * their indices, so the block tables and the prefix caching stores keep referring to the same descriptors.
+     * Only applicable if all layers have their blocks at the same indices, since the contents of all layers are
+     * copied by the same map.
+     * @param occupied_blocks_per_layer The distinct blocks owned by the sequences for each layer, in the order of
+     * the block tables, so that the moved blocks of a sequence end up next to each other. The blocks stored for reuse
+     * by prefix caching are added by the allocator.
+     * @param max_num_moved_blocks The max number of blocks to be moved.
+     * @return Map of the source block index to the destination block indices, by which the contents are to be copied,
+     * empty if no block has been moved.
+     */
+    std::map<size_t, std::list<size_t>> compact(std::vector<BlocksPerLayer> occupied_blocks_per_layer, size_t max_num_moved_blocks) {
+        OPENVINO_ASSERT(occupied_blocks_per_layer.size() == m_num_layers);
+        for (size_t hash : m_overwriteable_blocks.get_hashes()) {
+            BlocksPerLayer blocks_for_all_layers = m_overwriteable_blocks.find(hash);
+            for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                occupied_blocks_per_layer[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
+            }
+        }
+        std::vector<BlocksPerLayer> free_blocks_per_layer(m_num_layers);
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            free_blocks_per_layer[layer_idx].assign(m_free_blocks[layer_idx].begin(), m_free_blocks[layer_idx].end());
+            std::sort(free_blocks_per_layer[layer_idx].begin(), free_blocks_per_layer[layer_idx].end(),
+                      [](const KVCacheBlock::Ptr& lhs, const KVCacheBlock::Ptr& rhs) { return lhs->get_index() < rhs->get_index(); });
+        }
+
+        const size_t num_occupied_blocks = occupied_blocks_per_layer[0].size();
+        OPENVINO_ASSERT(num_occupied_blocks + m_free_blocks_num[0] == m_total_num_blocks,
+                        "Expected num occupied blocks: ", m_total_num_blocks - m_free_blocks_num[0], ", actual: ", num_occupied_blocks);
+        const auto has_same_indices = [](const BlocksPerLayer& lhs, const BlocksPerLayer& rhs) {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                              [](const KVCacheBlock::Ptr& lhs, const KVCacheBlock::Ptr& rhs) { return lhs->get_index() == rhs->get_index(); });
+        };
+        for (size_t layer_idx = 1; layer_idx < m_num_layers; layer_idx++) {
+            if (!has_same_indices(occupied_blocks_per_layer[layer_idx], occupied_blocks_per_layer[0]) ||
+                !has_same_indices(free_blocks_per_layer[layer_idx], free_blocks_per_layer[0])) {
+                return {};
+            }
+        }
+
+        // the free blocks before num_occupied_blocks are as many as the occupied ones past it
+        std::map<size_t, std::list<size_t>> block_copy_map;
+        size_t num_moved_blocks = 0;
+        for (size_t block_idx = 0; block_idx < num_occupied_blocks && num_moved_blocks < max_num_moved_blocks; block_idx++) {
+            const int src_block_id = occupied_blocks_per_layer[0][block_idx]->get_index();
+            if (static_cast<size_t>(src_block_id) < num_occupied_blocks) {
+                continue;
+            }
+            const int dst_block_id = free_blocks_per_layer[0][num_moved_blocks]->get_index();
+            for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                occupied_blocks_per_layer[layer_idx][block_idx]->set_index(dst_block_id);
+                free_blocks_per_layer[layer_idx][num_moved_blocks]->set_index(src_block_id);
+            }
+            block_copy_map[src_block_id].push_back(dst_block_id);
+            ++num_moved_blocks;
+        }
+
+        for (auto& per_layer_block_list : m_free_blocks) {
+            per_layer_block_list.sort([](const KVCacheBlock::Ptr& lhs, const KVCacheBlock::Ptr& rhs) { return lhs->get_index() < rhs->get_index(); });
+        }
+        return block_copy_map;
+    }
+
 
     /**
      * Returns the number of free blocks for a given layer.
@@ -261,6 +460,15 @@ public:
         return m_overwriteable_blocks.num_blocks();
     }
 
+    /**
+     * Returns the number of free blocks which do not hold any contents reusable by prefix caching, i.e. can be allocated
+     * without overwriting the blocks stored for the reuse.
+     * @return Number of such blocks for each layer.
+     */
+    size_t num_blank_blocks() const {
+        return m_free_blocks_num.empty() ? 0 : m_free_blocks_num[0];
+    }
+
     /**
      * Returns a boolean describing whether a given number of blocks can be allocated, based on the number of currently
      * available free blocks.
@@ -330,8 +538,10 @@ public:
                 for (const auto& block : blocks_for_all_layers) {
                     hashes_across_blocks.insert(block->get_hash());
                 }
+                bool is_all_hashed = std::all_of(blocks_for_all_layers.begin(), blocks_for_all_layers.end(),
+                                                 [](const KVCacheBlock::Ptr& block_ptr) { return block_ptr->is_hashed(); });
                 bool is_all_have_same_hash = (hashes_across_blocks.size() == 1);
-                if (is_all_have_same_hash) {
+                if (is_all_hashed && is_all_have_same_hash) {
                     // guard against hash collision
                     auto colliding_blocks = m_overwriteable_blocks.clean_store(hashes_across_blocks);
                     if (!colliding_blocks.empty()) {
@@ -357,7 +567,8 @@ public:
                     }
                     m_overwriteable_blocks.add(blocks_for_all_layers);
                 } else {
-                    // This set of blocks to be freed corresponds to blocks from different time steps, and thus not eligible for caching
+                    // This set of blocks to be freed corresponds to blocks from different time steps, or its contents no longer
+                    // correspond to a prefix (e.g. after cache eviction), and thus not eligible for caching
                     // TODO (vshampor): more fine-grained hash store control
                     for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
                         m_free_blocks[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
@@ -448,6 +659,39 @@ public:
         return {};
     }
 
+    /**
+     * Returns one block for each layer in the same way as `allocate_block(hash, cached_blocks)`, but without a hash, so that
+     * the blocks are not reused as prefix blocks and are not stored for reuse once freed. Can only be used if prefix caching
+     * is enabled.
+     * @param[in,out] cached_blocks The map of known hashes to already allocated and filled blocks. If the blocks are reused from
+     * the internal overwritable block store, the previous hash entry for these is deleted.
+     * @return A vector of blocks (one for each layer), either freshly allocated or reused for overwriting,
+     * or an empty vector if cache is exhausted.
+     */
+    BlocksPerLayer allocate_unhashed_block(std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+        OPENVINO_ASSERT(m_enable_prefix_caching);
+        OPENVINO_ASSERT(can_allocate_blocks(1));
+
+        BlocksPerLayer blocks_for_all_layers;
+        if (m_free_blocks_num[0] > 0) {
+            blocks_for_all_layers.reserve(m_num_layers);
+            for (size_t i = 0; i < m_num_layers; i++) {
+                KVCacheBlock::Ptr allocated_block = m_free_blocks[i].front();
+                allocated_block->increment();
+                blocks_for_all_layers.push_back(allocated_block);
+                m_free_blocks[i].pop_front();
+                --m_free_blocks_num[i];
+            }
+        } else if (m_overwriteable_blocks.num_blocks() > 0) {
+            blocks_for_all_layers = m_overwriteable_blocks.get_lru_block_to_overwrite();
+            cached_blocks.erase(blocks_for_all_layers[0]->get_hash());
+        }
+        for (auto& block : blocks_for_all_layers) {
+            block->reset_hash();
+        }
+        return blocks_for_all_layers;
+    }
+
     /**
      * Returns the blocks corresponding to a given hash either from the internal allocator store,
      * or from the supplied storage map, or nothing if there are no blocks corresponding to this hash.
@@ -475,6 +719,42 @@ public:
         return {};
     }
 
+    /**
+     * Checks whether the blocks corresponding to a given hash are known either to the internal allocator store
+     * or to the supplied storage map, without retrieving them.
+     *
+     * @param hash The hash of the blocks to be looked up.
+     * @param cached_blocks The map of known hashes to already allocated and filled blocks.
+     * @return Whether get_cached_block would return the blocks for this hash.
+     */
+    bool has_cached_block(size_t hash, const std::map<uint64_t, BlocksPerLayer>& cached_blocks) const {
+        return m_overwriteable_blocks.contains(hash) || cached_blocks.count(hash) > 0;
+    }
+
+    /**
+     * Looks up the blocks stored for reuse by prefix caching (i.e. not owned by any sequence) under a given hash,
+     * without retrieving them.
+     * @param hash The hash of the blocks to be looked up.
+     * @return A vector of blocks (one for each layer) corresponding to this hash, or an empty vector if there are none.
+     */
+    BlocksPerLayer find_overwriteable_block(size_t hash) const {
+        return m_overwriteable_blocks.find(hash);
+    }
+
+    /**
+     * @return The hashes of the blocks stored for reuse by prefix caching, from the least to the most recently used one.
+     */
+    std::vector<size_t> get_overwriteable_block_hashes() const {
+        return m_overwriteable_blocks.get_hashes();
+    }
+
+    /**
+     * Pins the blocks stored for reuse by prefix caching under the given hashes, see OverwritableBlocksHashStore::set_pinned_hashes.
+     */
+    void set_pinned_hashes(std::unordered_set<size_t> hashes) {
+        m_overwriteable_blocks.set_pinned_hashes(std::move(hashes));
+    }
+
     /**
      * @return The percentage of the allocator's free block pool utilization.
      */
@@ -492,6 +772,34 @@ public:
     }
 };
 
+/**
+ * @brief Cumulative statistics of the KV cache prefix reuse for the prompts of the incoming requests.
+ */
+struct PrefixCacheStats {
+    // number of requests looked up in the prefix cache
+    size_t num_lookups = 0;
+    // number of requests for which at least one token was restored from the prefix cache
+    size_t num_hits = 0;
+    // total number of prompt tokens of the looked up requests
+    size_t num_prompt_tokens = 0;
+    // total number of prompt tokens restored from the prefix cache
+    size_t num_restored_tokens = 0;
+    // max number of prompt tokens restored from the prefix cache for a single request
+    size_t max_restored_tokens = 0;
+};
+
+/**
+ * @brief A KV cache block reusable by prefix caching, along with the information required to reuse it.
+ */
+struct PrefixCacheBlock {
+    size_t hash = 0;
+    // hash of the previous block of the prefix, std::nullopt if the block is the first one or the previous block is unknown
+    std::optional<size_t> parent_hash;
+    // tokens stored in the block, empty for the blocks of the embeddings-based sequence groups
+    std::vector<int64_t> tokens;
+    BlocksPerLayer blocks;
+};
+
 /**
  * @brief Works with `ov::genai::SequenceGroup`s and individual `ov::genai::Sequence`s to assign KV cache blocks to these
  * at each pipeline generation step. A block table is kept for each sequence, storing the indices of "physical"
@@ -500,17 +808,32 @@ public:
  */
 class BlockManager {
     friend class CacheStateDumper;
+    friend class CacheStateRecorder;
     BlockAllocator m_allocator;
     bool m_enable_prefix_caching;
     size_t m_block_size;
     size_t m_num_layers;
-    // TODO: caching time can probably be improved if we use the prefix tree
     std::map<uint64_t, BlocksPerLayer> m_prefix_hash_to_occupied_block_map;
+    // token-level index of the cached blocks, used to match the prompt prefixes of the token-based sequence groups
+    PrefixTree m_prefix_tree;
+    PrefixCacheStats m_prefix_cache_stats;
 
     // stores blocks for each sequence (not sequence group)
     // the same block can be seen in multiple block_tables for different sequences
     std::map<uint64_t, std::vector<BlocksPerLayer>> m_block_table;
 
+    // stores swap block indices for each sequence swapped out of the KV cache, one per logical block
+    // the same swap block can be seen in multiple swapped block tables for different sequences
+    std::map<uint64_t, std::vector<size_t>> m_swapped_block_table;
+    // free swap blocks; std::set to always pick the lowest index first, i.e. prefer the host memory tier over the disk one
+    std::set<size_t> m_free_swap_blocks;
+    std::vector<size_t> m_swap_block_ref_counts;
+    // hashes of the KV cache blocks at the moment they were swapped out, used to restore these from prefix cache without copying
+    std::vector<size_t> m_swap_block_hashes;
+    // sequences with blocks freed by cache eviction, the logical blocks past the first evicted one no longer correspond
+    // to the token positions, so these and the blocks allocated afterwards are not hashed
+    std::set<uint64_t> m_evicted_sequence_ids;
+
     std::mutex m_cached_blocks_map_mutex;
 public:
     /**
@@ -531,6 +854,215 @@ public:
     ~BlockManager() {
         // sanity check that all sequences are freed
         OPENVINO_ASSERT(m_block_table.empty());
+        OPENVINO_ASSERT(m_swapped_block_table.empty());
+    }
+
+    /**
+     * Sets the number of swap blocks available for swapping out KV cache blocks of preempted sequences.
+     * @param num_swap_blocks The number of swap blocks, each able to store the contents of one KV cache block for each layer.
+     */
+    void set_num_swap_blocks(size_t num_swap_blocks) {
+        OPENVINO_ASSERT(m_swapped_block_table.empty(), "Cannot resize swap space while there are swapped out sequences");
+        m_free_swap_blocks.clear();
+        for (size_t swap_block_id = 0; swap_block_id < num_swap_blocks; ++swap_block_id) {
+            m_free_swap_blocks.insert(swap_block_id);
+        }
+        m_swap_block_ref_counts.assign(num_swap_blocks, 0);
+        m_swap_block_hashes.assign(num_swap_blocks, 0);
+    }
+
+    /**
+     * @return The number of swap blocks available for swapping out new sequences.
+     */
+    size_t num_free_swap_blocks() const {
+        return m_free_swap_blocks.size();
+    }
+
+    /**
+     * @param seq_id The identifier of an ov::genai::Sequence
+     * @return Whether this sequence is currently swapped out of the KV cache.
+     */
+    bool is_swapped_out(uint64_t seq_id) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        return m_swapped_block_table.count(seq_id) > 0;
+    }
+
+    /**
+     * @param sequence_group Pointer to a sequence group.
+     * @return Whether any sequence of this group is currently swapped out of the KV cache.
+     */
+    bool is_swapped_out(SequenceGroup::Ptr sequence_group) {
+        for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+            if (is_swapped_out(sequence->get_id())) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @param sequence_group Pointer to a sequence group.
+     * @return Whether all KV cache blocks of the sequence group can be swapped out at this time. Blocks shared
+     * between the sequences of the group only occupy a single swap block.
+     */
+    bool can_swap_out(SequenceGroup::Ptr sequence_group) {
+        if (m_free_swap_blocks.empty()) {
+            return false;
+        }
+        size_t num_blocks_occupied = get_number_of_blocks_occupied_by_sequence(sequence_group);
+        if (num_blocks_occupied == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+            auto it = m_block_table.find(sequence->get_id());
+            if (it == m_block_table.end()) {
+                // all sequences in the group must be swapped out at once
+                return false;
+            }
+            const auto& block_tables = it->second;
+            for (const auto& layer_block_table : block_tables) {
+                if (layer_block_table.size() != block_tables[0].size()) {
+                    // per-layer logical block spaces diverged (e.g. after cache eviction)
+                    return false;
+                }
+            }
+        }
+        return num_blocks_occupied <= m_free_swap_blocks.size();
+    }
+
+    /**
+     * Swaps out all KV cache blocks of a sequence group, releasing these in the KV cache. The block contents
+     * must be copied into the swap space by the CacheManager as reported in the returned map.
+     * @param sequence_group Pointer to a sequence group, for which can_swap_out returned `true`.
+     * @return For each layer, a map of *physical* KV cache block indices to the swap block indices to copy the block contents into.
+     */
+    std::vector<std::map<size_t, size_t>> swap_out(SequenceGroup::Ptr sequence_group) {
+        OPENVINO_ASSERT(can_swap_out(sequence_group), "Cannot swap out sequence group ", sequence_group->get_request_id());
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::vector<std::map<size_t, size_t>> swap_out_map(m_num_layers);
+        // assuming all layers always have equal sets of blocks
+        std::map<size_t, size_t> block_to_swap_block;
+        for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+            auto seq_id = sequence->get_id();
+            auto& block_tables = m_block_table[seq_id];
+            auto& swapped_block_table = m_swapped_block_table[seq_id];
+            swapped_block_table.reserve(block_tables[0].size());
+            for (size_t logical_block_idx = 0; logical_block_idx < block_tables[0].size(); logical_block_idx++) {
+                size_t block_idx = block_tables[0][logical_block_idx]->get_index();
+                auto it = block_to_swap_block.find(block_idx);
+                if (it == block_to_swap_block.end()) {
+                    size_t swap_block_idx = *m_free_swap_blocks.begin();
+                    m_free_swap_blocks.erase(m_free_swap_blocks.begin());
+                    m_swap_block_hashes[swap_block_idx] = block_tables[0][logical_block_idx]->get_hash();
+                    for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                        swap_out_map[layer_idx][block_tables[layer_idx][logical_block_idx]->get_index()] = swap_block_idx;
+                    }
+                    it = block_to_swap_block.emplace(block_idx, swap_block_idx).first;
+                }
+                ++m_swap_block_ref_counts[it->second];
+                swapped_block_table.push_back(it->second);
+            }
+
+            size_t num_allocated_blocks = block_tables[0].size();
+            for (size_t i = 0; i < num_allocated_blocks; i++) {
+                BlocksPerLayer blocks_to_free;
+                blocks_to_free.reserve(m_num_layers);
+                for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                    blocks_to_free.push_back(block_tables[layer_idx][i]);
+                }
+                m_allocator.free(blocks_to_free);
+            }
+            m_block_table.erase(seq_id);
+        }
+        return swap_out_map;
+    }
+
+    /**
+     * @param sequence_group Pointer to a sequence group.
+     * @return The number of KV cache blocks required to swap the sequence group back into the KV cache.
+     */
+    size_t required_blocks_count_for_swap_in(SequenceGroup::Ptr sequence_group) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::set<size_t> swap_block_ids;
+        for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+            auto it = m_swapped_block_table.find(sequence->get_id());
+            if (it != m_swapped_block_table.end()) {
+                swap_block_ids.insert(it->second.begin(), it->second.end());
+            }
+        }
+        return swap_block_ids.size();
+    }
+
+    /**
+     * Swaps a previously swapped out sequence group back into the KV cache, restoring the block tables (including
+     * the block sharing between sequences) to the state before the swap-out. If prefix caching is enabled, the blocks
+     * still present in the prefix cache are reused instead of being copied from the swap space.
+     * @param sequence_group Pointer to a sequence group.
+     * @return For each layer, a map of swap block indices to the *physical* KV cache block indices to copy the block contents into.
+     */
+    std::vector<std::map<size_t, size_t>> swap_in(SequenceGroup::Ptr sequence_group) {
+        OPENVINO_ASSERT(can_allocate_blocks(required_blocks_count_for_swap_in(sequence_group)),
+                        "Not enough free KV cache blocks to swap in sequence group ", sequence_group->get_request_id());
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::vector<std::map<size_t, size_t>> swap_in_map(m_num_layers);
+        std::map<size_t, BlocksPerLayer> swap_block_to_blocks;
+        for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+            auto seq_id = sequence->get_id();
+            auto swapped_it = m_swapped_block_table.find(seq_id);
+            if (swapped_it == m_swapped_block_table.end()) {
+                continue;
+            }
+            OPENVINO_ASSERT(m_block_table.count(seq_id) == 0);
+            auto& block_tables = m_block_table[seq_id];
+            block_tables.resize(m_num_layers);
+            for (size_t swap_block_idx : swapped_it->second) {
+                auto it = swap_block_to_blocks.find(swap_block_idx);
+                if (it != swap_block_to_blocks.end()) {
+                    // block shared between sequences before the swap-out
+                    for (auto& block : it->second) {
+                        block->increment();
+                    }
+                } else {
+                    BlocksPerLayer blocks_for_all_layers;
+                    if (m_enable_prefix_caching) {
+                        size_t hash = m_swap_block_hashes[swap_block_idx];
+                        blocks_for_all_layers = m_allocator.get_cached_block(hash, m_prefix_hash_to_occupied_block_map);
+                        if (blocks_for_all_layers.empty()) {
+                            blocks_for_all_layers = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
+                            for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                                swap_in_map[layer_idx][swap_block_idx] = blocks_for_all_layers[layer_idx]->get_index();
+                            }
+                        }
+                    } else {
+                        blocks_for_all_layers = m_allocator.allocate_block();
+                        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                            swap_in_map[layer_idx][swap_block_idx] = blocks_for_all_layers[layer_idx]->get_index();
+                        }
+                    }
+                    it = swap_block_to_blocks.emplace(swap_block_idx, blocks_for_all_layers).first;
+                }
+                for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+                    block_tables[layer_idx].push_back(it->second[layer_idx]);
+                }
+            }
+            _release_swap_blocks(swapped_it->second);
+            m_swapped_block_table.erase(swapped_it);
+        }
+        return swap_in_map;
+    }
+
+    /**
+     * Drops the swapped out KV cache contents of a given sequence without restoring them.
+     * @param seq_id Identifier of the sequence.
+     */
+    void free_swapped_sequence(uint64_t seq_id) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        auto it = m_swapped_block_table.find(seq_id);
+        OPENVINO_ASSERT(it != m_swapped_block_table.end(), "sequence with id ", seq_id,
+                        " is not swapped out in BlockManager, but requested to free");
+        _release_swap_blocks(it->second);
+        m_swapped_block_table.erase(it);
     }
 
     /**
@@ -698,7 +1230,14 @@ public:
         size_t num_hashed_tokens = allocated_blocks * m_block_size;
 
 
-        if (!m_enable_prefix_caching) {
+        if (m_enable_prefix_caching && m_evicted_sequence_ids.count(sequence_id)) {
+            for (size_t i = 0; i < num_blocks; ++i) {
+                auto blocks_for_all_layers = m_allocator.allocate_unhashed_block(m_prefix_hash_to_occupied_block_map);
+                for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
+                    m_block_table[sequence_id][layer_idx].push_back(blocks_for_all_layers[layer_idx]);
+                }
+            }
+        } else if (!m_enable_prefix_caching) {
             for (size_t layer_idx = 0; layer_idx < m_block_table[sequence_id].size(); layer_idx++) {
                 auto block_table = m_block_table[sequence_id][layer_idx];
                 for (size_t i = 0; i < num_blocks; ++i) {
@@ -725,6 +1264,8 @@ public:
                         last_blocks_vec.push_back(lst_blk);
                     }
                     m_prefix_hash_to_occupied_block_map[hash] = last_blocks_vec;
+                    m_prefix_tree.erase(prev_hash);
+                    _add_to_prefix_tree(sequence, block_table.size() - 1, block_table.size() * m_block_size);
                 }
             }
             for (size_t i = 0; i < num_blocks; ++i) {
@@ -737,6 +1278,7 @@ public:
                 for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
                     m_block_table[sequence_id][layer_idx].push_back(blocks_for_all_layers[layer_idx]);
                 }
+                _add_to_prefix_tree(sequence, block_table.size() - 1, num_hashed_tokens);
             }
         }
     }
@@ -756,6 +1298,46 @@ public:
         m_allocator.increase_kv_blocks_number(num_blocks);
     }
 
+    /**
+     * Decreases the number of KV blocks, see BlockAllocator::decrease_kv_blocks_number.
+     * @param num_blocks The new number of KV-blocks.
+     */
+    void decrease_kv_blocks_number(size_t num_blocks) {
+        m_allocator.decrease_kv_blocks_number(num_blocks);
+    }
+
+    /**
+     * @return The number of KV blocks up to the last one in use, which the number of KV blocks can be decreased to.
+     */
+    size_t get_min_number_of_kv_blocks() const {
+        return m_allocator.get_min_number_of_kv_blocks();
+    }
+
+    /**
+     * Moves the occupied KV cache blocks to the beginning of the cache, see BlockAllocator::compact. The blocks of each
+     * sequence are taken in the logical order, so that the moved ones end up in a contiguous range. Nothing is moved
+     * once the layers have their blocks at different indices, e.g. after cache eviction.
+     * @param max_num_moved_blocks The max number of blocks to be moved.
+     * @return Map of the source block index to the destination block indices, by which the contents of all layers are
+     * to be copied by CacheManager.
+     */
+    std::map<size_t, std::list<size_t>> compact_blocks(size_t max_num_moved_blocks = std::numeric_limits<size_t>::max()) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::vector<BlocksPerLayer> occupied_blocks_per_layer(m_num_layers);
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            // the blocks shared by the sequences are taken once
+            std::unordered_set<const KVCacheBlock*> visited_blocks;
+            for (const auto& [seq_id, block_tables] : m_block_table) {
+                for (const auto& block : block_tables[layer_idx]) {
+                    if (visited_blocks.insert(block.get()).second) {
+                        occupied_blocks_per_layer[layer_idx].push_back(block);
+                    }
+                }
+            }
+        }
+        return m_allocator.compact(std::move(occupied_blocks_per_layer), max_num_moved_blocks);
+    }
+
     /**
      * @return The total number of KV blocks .
      */
@@ -781,6 +1363,9 @@ public:
                 m_block_table[child_id][layer_idx].push_back(block);
             }
         }
+        if (m_evicted_sequence_ids.count(parent_id)) {
+            m_evicted_sequence_ids.insert(child_id);
+        }
     }
 
     /**
@@ -804,6 +1389,7 @@ public:
         }
 
         OPENVINO_ASSERT(m_block_table.erase(seq_id) == 1);
+        m_evicted_sequence_ids.erase(seq_id);
     }
 
     /**
@@ -844,6 +1430,7 @@ public:
             // must have the same size
             OPENVINO_ASSERT(all_freed_completely, "block tables across layers should only be empty all at once");
             OPENVINO_ASSERT(m_block_table.erase(seq_id) == 1);
+            m_evicted_sequence_ids.erase(seq_id);
         }
     }
 
@@ -908,6 +1495,28 @@ public:
 
             per_layer_block_table = new_sequence_blocks;
         }
+
+        if (m_enable_prefix_caching) {
+            // The blocks before the first evicted one (at least the start area, which is never evicted) still hold the KV cache
+            // of the sequence prefix and stay reusable. The kept blocks past it are shifted to other logical positions and
+            // may be rotated, so their contents no longer correspond to their hashes.
+            size_t first_evicted_block_idx = std::numeric_limits<size_t>::max();
+            for (const auto& index_set : logical_block_index_sets_to_free) {
+                first_evicted_block_idx = std::min(first_evicted_block_idx, *index_set.begin());
+            }
+            for (size_t layer_idx = 0; layer_idx < presumed_num_layers; layer_idx++) {
+                auto& per_layer_block_table = m_block_table[seq_id][layer_idx];
+                for (size_t logical_block_idx = first_evicted_block_idx; logical_block_idx < per_layer_block_table.size(); logical_block_idx++) {
+                    auto& block = per_layer_block_table[logical_block_idx];
+                    if (block->is_hashed()) {
+                        m_prefix_hash_to_occupied_block_map.erase(block->get_hash());
+                        m_prefix_tree.erase(block->get_hash());
+                        block->reset_hash();
+                    }
+                }
+            }
+            m_evicted_sequence_ids.insert(seq_id);
+        }
     }
 
     /**
@@ -989,7 +1598,12 @@ public:
         }
         for (const auto& sequence : seq_group->get_running_sequences()) {
             auto seq_id = sequence->get_id();
-            auto& block_table = m_block_table[seq_id];
+            auto it = m_block_table.find(seq_id);
+            if (it == m_block_table.end()) {
+                // e.g. the sequence is swapped out
+                continue;
+            }
+            auto& block_table = it->second;
             size_t num_physical_blocks = block_table[0].size();
             if (num_physical_blocks > num_logical_blocks) {
                 free_sequence_partially(seq_id, num_physical_blocks - num_logical_blocks);
@@ -1038,11 +1652,14 @@ public:
                 }
 
                 bool is_copy_on_write = last_blocks[0]->copy_on_write();
+                bool is_evicted_sequence = m_evicted_sequence_ids.count(seq_id) > 0;
 
                 if (is_copy_on_write) {
                     BlocksPerLayer new_blocks_for_all_layers;
                     new_blocks_for_all_layers.reserve(effective_num_layers);
-                    if (m_enable_prefix_caching) {
+                    if (m_enable_prefix_caching && is_evicted_sequence) {
+                        new_blocks_for_all_layers = m_allocator.allocate_unhashed_block(m_prefix_hash_to_occupied_block_map);
+                    } else if (m_enable_prefix_caching) {
                         auto hash = sequence->get_hash();
                         new_blocks_for_all_layers = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
                     } else {
@@ -1059,9 +1676,12 @@ public:
                         copy_blocks_map[last_block->get_index()].push_back(new_block->get_index());
                     }
                     m_allocator.free(last_blocks);
+                    if (m_enable_prefix_caching && !is_evicted_sequence) {
+                        _add_to_prefix_tree(sequence, num_physical_blocks - 1, seq_group->get_context_len());
+                    }
                 } else {
                     // we are the only users of this block
-                    if (m_enable_prefix_caching) {
+                    if (m_enable_prefix_caching && !is_evicted_sequence) {
                         // update hash of block
                         auto prev_hash = last_blocks[0]->get_hash();
                         auto hash = sequence->get_hash();
@@ -1071,6 +1691,10 @@ public:
                         }
                         m_prefix_hash_to_occupied_block_map.erase(prev_hash);
                         m_prefix_hash_to_occupied_block_map[hash] = last_blocks;
+                        if (prev_hash != hash) {
+                            m_prefix_tree.erase(prev_hash);
+                            _add_to_prefix_tree(sequence, num_physical_blocks - 1, seq_group->get_context_len());
+                        }
                     }
                 }
             }
@@ -1080,6 +1704,17 @@ public:
         return copy_blocks_map;
     }
 
+private:
+    void _release_swap_blocks(const std::vector<size_t>& swap_block_ids) {
+        for (size_t swap_block_idx : swap_block_ids) {
+            OPENVINO_ASSERT(m_swap_block_ref_counts[swap_block_idx] > 0);
+            if (--m_swap_block_ref_counts[swap_block_idx] == 0) {
+                m_free_swap_blocks.insert(swap_block_idx);
+            }
+        }
+    }
+
+public:
     void restore_cached_blocks(SequenceGroup::Ptr group) {
         // When add_request() is executed in multiple threads accessing to cached_blocks causes segfault.
         // The mutex is needed to prevent such segfaults.
@@ -1095,6 +1730,329 @@ public:
         }
         auto& block_table = m_block_table[seq_id];
 
+        size_t num_restored_tokens = group->get_sequence_group_type() == SequenceGroupType::TOKENS ?
+            _restore_cached_blocks_by_prefix_tree(sequence, prompt_len, block_table) :
+            _restore_cached_blocks_by_hash(sequence, prompt_len, block_table);
+        if (num_restored_tokens > 0) {
+            group->update_processed_tokens_num(num_restored_tokens == prompt_len ? num_restored_tokens - 1 : num_restored_tokens);
+            ++m_prefix_cache_stats.num_hits;
+        }
+        ++m_prefix_cache_stats.num_lookups;
+        m_prefix_cache_stats.num_prompt_tokens += prompt_len;
+        m_prefix_cache_stats.num_restored_tokens += num_restored_tokens;
+        m_prefix_cache_stats.max_restored_tokens = std::max(m_prefix_cache_stats.max_restored_tokens, num_restored_tokens);
+    }
+
+    /**
+     * Estimates the prefix cache hit of a group without restoring any blocks.
+     * @return The number of the prompt tokens covered by the cached full blocks of the longest prefix of the prompt.
+     */
+    size_t get_num_cached_prompt_tokens(const SequenceGroup::Ptr& group) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        const size_t prompt_len = group->get_prompt_len();
+        size_t content_len = 0;
+        if (group->get_sequence_group_type() == SequenceGroupType::TOKENS) {
+            const auto& prompt_ids = group->get_prompt_ids();
+            const PrefixTree::Node* node = m_prefix_tree.root();
+            for (; content_len + m_block_size <= prompt_len; content_len += m_block_size) {
+                node = m_prefix_tree.find_child(node, std::vector<int64_t>(prompt_ids.begin() + content_len, prompt_ids.begin() + content_len + m_block_size));
+                if (node == nullptr || !m_allocator.has_cached_block(node->hash, m_prefix_hash_to_occupied_block_map)) {
+                    break;
+                }
+            }
+        } else {
+            const auto& sequence = group->get_sequences()[0];
+            for (; content_len + m_block_size <= prompt_len; content_len += m_block_size) {
+                if (!m_allocator.has_cached_block(sequence->get_hash(content_len + m_block_size), m_prefix_hash_to_occupied_block_map)) {
+                    break;
+                }
+            }
+        }
+        return content_len;
+    }
+
+    /**
+     * Restores the cached blocks of a group, which hasn't been scheduled yet, once again, e.g. after the blocks of its
+     * prefix have been computed for another group. The prefix cache statistics count the lookup of the group once.
+     * @return The number of the additionally restored prompt tokens.
+     */
+    size_t restore_more_cached_blocks(SequenceGroup::Ptr group) {
+        const size_t prompt_len = group->get_prompt_len();
+        const size_t num_restored_tokens = group->get_num_processed_tokens();
+        OPENVINO_ASSERT(num_restored_tokens + 1 < prompt_len, "The whole prompt of the sequence group is already restored");
+        const auto seq_id = group->get_not_finished_sequences()[0]->get_id();
+        if (has_block_table(seq_id)) {
+            free_sequence(seq_id);
+        }
+        group->update_processed_tokens_num(0);
+        restore_cached_blocks(group);
+
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        --m_prefix_cache_stats.num_lookups;
+        m_prefix_cache_stats.num_prompt_tokens -= prompt_len;
+        m_prefix_cache_stats.num_restored_tokens -= num_restored_tokens;
+        if (num_restored_tokens > 0) {
+            --m_prefix_cache_stats.num_hits;
+        }
+        return group->get_num_processed_tokens() - num_restored_tokens;
+    }
+
+    /**
+     * Pins the blocks of the full blocks of the tokens known to the prefix tree, so that they are overwritten after the
+     * other blocks stored for reuse, e.g. to keep the history of an active chat between its turns. Replaces the
+     * previously pinned blocks, the empty tokens unpin them.
+     */
+    void pin_prefix(const TokenIds& tokens) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::unordered_set<size_t> hashes;
+        const PrefixTree::Node* node = m_prefix_tree.root();
+        for (size_t content_len = 0; content_len + m_block_size <= tokens.size(); content_len += m_block_size) {
+            node = m_prefix_tree.find_child(node, std::vector<int64_t>(tokens.begin() + content_len, tokens.begin() + content_len + m_block_size));
+            if (node == nullptr) {
+                break;
+            }
+            hashes.insert(node->hash);
+        }
+        m_allocator.set_pinned_hashes(std::move(hashes));
+    }
+
+    /**
+     * @return The blocks currently stored for reuse by prefix caching and not owned by any sequence. A block always comes
+     * after the previous block of its prefix, if the latter is returned as well.
+     */
+    std::vector<PrefixCacheBlock> get_reusable_prefix_blocks() {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::vector<PrefixCacheBlock> prefix_blocks;
+        std::set<size_t> visited_hashes;
+        const PrefixTree::Node* root = m_prefix_tree.root();
+        m_prefix_tree.visit([&](const PrefixTree::Node* node) {
+            BlocksPerLayer blocks = m_allocator.find_overwriteable_block(node->hash);
+            if (!blocks.empty() && visited_hashes.insert(node->hash).second) {
+                std::optional<size_t> parent_hash;
+                if (node->parent != root) {
+                    parent_hash = node->parent->hash;
+                }
+                prefix_blocks.push_back({node->hash, parent_hash, node->tokens, std::move(blocks)});
+            }
+            return true;
+        });
+        // blocks restored by hash only
+        for (size_t hash : m_allocator.get_overwriteable_block_hashes()) {
+            if (visited_hashes.count(hash) == 0) {
+                prefix_blocks.push_back({hash, std::nullopt, {}, m_allocator.find_overwriteable_block(hash)});
+            }
+        }
+        return prefix_blocks;
+    }
+
+    /**
+     * @return The hashes of the blocks known to prefix caching, owned by a sequence or reusable by prefix caching.
+     */
+    std::vector<size_t> get_cached_block_hashes() {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::vector<size_t> hashes = m_allocator.get_overwriteable_block_hashes();
+        hashes.reserve(hashes.size() + m_prefix_hash_to_occupied_block_map.size());
+        for (const auto& [hash, blocks] : m_prefix_hash_to_occupied_block_map) {
+            hashes.push_back(hash);
+        }
+        return hashes;
+    }
+
+    /**
+     * @return The cached blocks of the longest prefix of the tokens, owned by a sequence or reusable by prefix caching,
+     * in the order of the prefix. The last block may be partially filled, as in restore_cached_blocks.
+     */
+    std::vector<PrefixCacheBlock> get_prefix_blocks(const TokenIds& tokens) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::vector<PrefixCacheBlock> prefix_blocks;
+        const PrefixTree::Node* root = m_prefix_tree.root();
+        const PrefixTree::Node* node = root;
+        for (size_t content_len = 0; content_len < tokens.size(); content_len += m_block_size) {
+            const size_t block_end = std::min(content_len + m_block_size, tokens.size());
+            std::vector<int64_t> block_tokens(tokens.begin() + content_len, tokens.begin() + block_end);
+            const PrefixTree::Node* child = block_tokens.size() == m_block_size ? m_prefix_tree.find_child(node, block_tokens) : nullptr;
+            const bool is_last_block = child == nullptr;
+            if (is_last_block) {
+                child = m_prefix_tree.find_longest_prefix_child(node, std::move(block_tokens));
+            }
+            if (child == nullptr) {
+                break;
+            }
+            BlocksPerLayer blocks = m_allocator.find_overwriteable_block(child->hash);
+            auto occupied_it = m_prefix_hash_to_occupied_block_map.find(child->hash);
+            if (blocks.empty() && occupied_it != m_prefix_hash_to_occupied_block_map.end()) {
+                blocks = occupied_it->second;
+            }
+            if (blocks.empty()) {
+                break;
+            }
+            prefix_blocks.push_back({child->hash, node != root ? std::optional<size_t>(node->hash) : std::nullopt, child->tokens, std::move(blocks)});
+            if (is_last_block) {
+                break;
+            }
+            node = child;
+        }
+        return prefix_blocks;
+    }
+
+    /**
+     * @return The number of free blocks which can be allocated without overwriting the blocks reusable by prefix caching.
+     */
+    size_t num_blank_blocks() const {
+        return m_allocator.num_blank_blocks();
+    }
+
+    /**
+     * @return The number of free blocks holding the contents reusable by prefix caching.
+     */
+    size_t num_overwriteable_blocks() const {
+        return m_allocator.num_overwriteable_blocks();
+    }
+
+    /**
+     * Allocates blocks to be filled with the contents of a reusable prefix block coming from outside of the pipeline,
+     * e.g. from the prefix cache of the previous pipeline instance. Once filled, the blocks must be passed to
+     * release_restored_prefix_block, so that they become reusable by the new sequences. Blocks are only allocated if
+     * they do not overwrite the contents already reusable by prefix caching.
+     * @param prefix_block The block to be restored, the `blocks` field is ignored.
+     * @return A vector of blocks (one for each layer), or an empty vector if the block is already known or there are no
+     * blank blocks left.
+     */
+    BlocksPerLayer allocate_restored_prefix_block(const PrefixCacheBlock& prefix_block) {
+        OPENVINO_ASSERT(m_enable_prefix_caching);
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        if (m_allocator.num_blank_blocks() == 0 || m_allocator.has_cached_block(prefix_block.hash, m_prefix_hash_to_occupied_block_map)) {
+            return {};
+        }
+        BlocksPerLayer blocks = m_allocator.allocate_block(prefix_block.hash, m_prefix_hash_to_occupied_block_map);
+        if (!prefix_block.tokens.empty()) {
+            m_prefix_tree.insert(prefix_block.parent_hash, prefix_block.tokens, prefix_block.hash);
+        }
+        return blocks;
+    }
+
+    /**
+     * Stores the blocks allocated by allocate_restored_prefix_block for reuse by prefix caching.
+     * @param blocks The blocks (one for each layer) filled with the restored contents.
+     */
+    void release_restored_prefix_block(const BlocksPerLayer& blocks) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        auto timestamp = std::chrono::steady_clock::now();
+        for (const auto& block : blocks) {
+            block->set_timestamp(timestamp);
+        }
+        m_allocator.free(blocks);
+    }
+
+    /**
+     * @return Cumulative statistics of the prefix cache hits for the requests passed to restore_cached_blocks.
+     */
+    PrefixCacheStats get_prefix_cache_stats() {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        return m_prefix_cache_stats;
+    }
+
+private:
+    /**
+     * Adds the block at the given logical position of the sequence block table to the prefix tree, under the hash currently
+     * assigned to the block.
+     * @param sequence Pointer to the sequence owning the block.
+     * @param logical_block_idx The logical index of the block in the block table of the sequence.
+     * @param content_length The number of tokens of the sequence that the block contents correspond to.
+     */
+    void _add_to_prefix_tree(const Sequence::Ptr& sequence, size_t logical_block_idx, size_t content_length) {
+        if (sequence->get_sequence_group_ptr()->get_sequence_group_type() != SequenceGroupType::TOKENS) {
+            return;
+        }
+        const auto& block_table = m_block_table[sequence->get_id()][0];
+        OPENVINO_ASSERT(logical_block_idx < block_table.size());
+        std::optional<size_t> parent_hash;
+        if (logical_block_idx > 0) {
+            parent_hash = block_table[logical_block_idx - 1]->get_hash();
+        }
+        size_t block_start = logical_block_idx * m_block_size;
+        if (content_length <= block_start || content_length > block_start + m_block_size) {
+            // logical block positions no longer correspond to the token positions, e.g. after cache eviction
+            return;
+        }
+        m_prefix_tree.insert(parent_hash, _get_tokens(sequence, block_start, content_length), block_table[logical_block_idx]->get_hash());
+
+        // nodes of the overwritten blocks are dropped lazily, once the tree becomes significantly larger than the KV cache
+        if (m_prefix_tree.num_nodes() > 2 * m_allocator.get_total_number_of_kv_blocks()) {
+            m_prefix_tree.prune([this](size_t hash) { return m_allocator.has_cached_block(hash, m_prefix_hash_to_occupied_block_map); });
+        }
+    }
+
+    static std::vector<int64_t> _get_tokens(const Sequence::Ptr& sequence, size_t begin, size_t end) {
+        const auto& prompt_ids = sequence->get_sequence_group_ptr()->get_prompt_ids();
+        const auto& generated_ids = sequence->get_generated_ids();
+        OPENVINO_ASSERT(begin <= end && end <= prompt_ids.size() + generated_ids.size());
+        std::vector<int64_t> tokens;
+        tokens.reserve(end - begin);
+        if (begin < prompt_ids.size()) {
+            tokens.insert(tokens.end(), prompt_ids.begin() + begin, prompt_ids.begin() + std::min(prompt_ids.size(), end));
+        }
+        if (end > prompt_ids.size()) {
+            size_t start = begin < prompt_ids.size() ? 0 : begin - prompt_ids.size();
+            tokens.insert(tokens.end(), generated_ids.begin() + start, generated_ids.begin() + (end - prompt_ids.size()));
+        }
+        return tokens;
+    }
+
+    void _append_restored_blocks(std::vector<BlocksPerLayer>& block_table, BlocksPerLayer& blocks) {
+        auto timestamp = std::chrono::steady_clock::now();
+        for (size_t layer_idx = 0; layer_idx < block_table.size(); layer_idx++) {
+            auto& block = blocks[layer_idx];
+            block->set_timestamp(timestamp);
+            block_table[layer_idx].push_back(block);
+        }
+    }
+
+    /**
+     * Restores the cached blocks matching the longest prefix of the prompt by a single traversal of the prefix tree.
+     * @return The number of prompt tokens covered by the restored blocks.
+     */
+    size_t _restore_cached_blocks_by_prefix_tree(const Sequence::Ptr& sequence, size_t prompt_len, std::vector<BlocksPerLayer>& block_table) {
+        const auto& prompt_ids = sequence->get_sequence_group_ptr()->get_prompt_ids();
+        const PrefixTree::Node* node = m_prefix_tree.root();
+        size_t content_len = 0;
+        while (content_len < prompt_len) {
+            size_t block_end = std::min(content_len + m_block_size, prompt_len);
+            std::vector<int64_t> block_tokens(prompt_ids.begin() + content_len, prompt_ids.begin() + block_end);
+            // a full block match continues the traversal, otherwise the longest partially filled block is the last one to be restored
+            const PrefixTree::Node* child = block_tokens.size() == m_block_size ? m_prefix_tree.find_child(node, block_tokens) : nullptr;
+            bool is_last_block = false;
+            if (child == nullptr) {
+                child = m_prefix_tree.find_longest_prefix_child(node, std::move(block_tokens));
+                is_last_block = true;
+            }
+            if (child == nullptr) {
+                break;
+            }
+            auto blocks = m_allocator.get_cached_block(child->hash, m_prefix_hash_to_occupied_block_map);
+            if (blocks.empty()) {
+                // the block has been overwritten since
+                m_prefix_tree.erase(child->hash);
+                if (is_last_block) {
+                    break;
+                }
+                continue;
+            }
+            _append_restored_blocks(block_table, blocks);
+            content_len += child->tokens.size();
+            if (is_last_block) {
+                break;
+            }
+            node = child;
+        }
+        return content_len;
+    }
+
+    /**
+     * Restores the cached blocks matching the longest prefix of the prompt by looking up the hash of each prefix block.
+     * @return The number of prompt tokens covered by the restored blocks.
+     */
+    size_t _restore_cached_blocks_by_hash(const Sequence::Ptr& sequence, size_t prompt_len, std::vector<BlocksPerLayer>& block_table) {
         size_t content_len = 0;
         while (content_len < prompt_len) {
             size_t prev_iteration_content_len = content_len;
@@ -1105,14 +2063,8 @@ public:
             // restore fully filled blocks
             auto full_block_hash = sequence->get_hash(content_len);
             auto blocks = m_allocator.get_cached_block(full_block_hash, m_prefix_hash_to_occupied_block_map);
-            auto timestamp = std::chrono::steady_clock::now();
             if (!blocks.empty()) {
-                for (size_t layer_idx = 0; layer_idx < block_table.size(); layer_idx++) {
-                    auto& block = blocks[layer_idx];
-                    block->set_timestamp(timestamp);
-                    block_table[layer_idx].push_back(block);
-                }
-                group->update_processed_tokens_num(content_len == prompt_len ? content_len - 1 : content_len);
+                _append_restored_blocks(block_table, blocks);
             } else {
             // restore partially filled block
                 for (size_t i = 1; i < m_block_size; i++) {
@@ -1122,21 +2074,14 @@ public:
                     auto hash = sequence->get_hash(prev_iteration_content_len + i);
                     auto blocks = m_allocator.get_cached_block(hash, m_prefix_hash_to_occupied_block_map);
                     if (!blocks.empty()) {
-                        auto timestamp = std::chrono::steady_clock::now();
-
-                        for (size_t layer_idx = 0; layer_idx < block_table.size(); layer_idx++) {
-                            auto& block = blocks[layer_idx];
-                            block->set_timestamp(timestamp);
-                            block_table[layer_idx].push_back(block);
-                        }
-                        group->update_processed_tokens_num(prev_iteration_content_len + i == prompt_len ? prev_iteration_content_len + i - 1 : prev_iteration_content_len + i);
-
-                        break;
+                        _append_restored_blocks(block_table, blocks);
+                        return prev_iteration_content_len + i;
                     }
                 }
-                break;
+                return prev_iteration_content_len;
             }
         }
+        return content_len;
     }
 };
 
@@ -21,7 +21,7 @@ namespace ov::genai {
         auto new_size =
                 accumulated_scores_for_current_decoder_layer.size() - evicted_block_indices.size() * m_block_size;
 
-        std::vector<double> new_scores;
+        std::vector<float> new_scores;
         new_scores.reserve(new_size);
 
         std::vector<size_t> new_counter;
@@ -50,143 +50,151 @@ namespace ov::genai {
 
     void EvictionScoreManager::register_new_token_scores(
             const AttentionScoresForEachDecoderLayer &attention_scores_for_all_decoder_layers,
-            const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores) {
+            const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores, ThreadPool* thread_pool) {
 
         if (m_num_registered_snapkv_aggregated_scores < m_snapkv_window_size) {
             OPENVINO_ASSERT(num_snapkv_scores + m_num_registered_snapkv_aggregated_scores <= m_snapkv_window_size, "Total number of aggregated SnapKV scores during prefill phase may not be larger than the configured SnapKV window size");
             m_num_registered_snapkv_aggregated_scores += num_snapkv_scores;
         }
 
+        // the decoder layers only touch their own scores and counters, so these are aggregated independently
+        auto register_for_layer = [&](size_t decoder_layer_idx) {
+            register_new_token_scores_for_layer(decoder_layer_idx, attention_scores_for_all_decoder_layers[decoder_layer_idx],
+                                                skipped_logical_block_ids, num_snapkv_scores);
+        };
+        if (thread_pool) {
+            thread_pool->parallel_for(m_num_decoder_layers, register_for_layer);
+        } else {
+            for (size_t decoder_layer_idx = 0; decoder_layer_idx < m_num_decoder_layers; decoder_layer_idx++) {
+                register_for_layer(decoder_layer_idx);
+            }
+        }
+    }
+
+    void EvictionScoreManager::register_new_token_scores_for_layer(size_t decoder_layer_idx, const ov::Tensor& attention_scores,
+                                                                   const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores) {
         // FIXME (vshampor): currently in terms of counters we do not discern between the cases when the last chunk has been prefill-only
         // or last-prefill-chunk-plus-one-generation_token
-        for (size_t decoder_layer_idx = 0; decoder_layer_idx < m_num_decoder_layers; decoder_layer_idx++) {
-
-            const auto &attention_scores = attention_scores_for_all_decoder_layers[decoder_layer_idx];
-            // "Start" tokens are never evicted, won't track scores for these
-            // "Recent" tokens are also not evicted just yet, but need to accumulate their scores since they may
-            // ultimately move into the "intermediate" eviction region of cache
-            // Taking the [1, start_size:seq_len] span of the attention scores:
-            auto attn_shape = attention_scores.get_shape();
-            size_t scores_size_in_tokens = attn_shape[0];
-            if (scores_size_in_tokens <= m_ignore_first_n_blocks * m_block_size) {
-                return;
-            }
+        // "Start" tokens are never evicted, won't track scores for these
+        // "Recent" tokens are also not evicted just yet, but need to accumulate their scores since they may
+        // ultimately move into the "intermediate" eviction region of cache
+        // Taking the [1, start_size:seq_len] span of the attention scores:
+        auto attn_shape = attention_scores.get_shape();
+        size_t scores_size_in_tokens = attn_shape[0];
+        if (scores_size_in_tokens <= m_ignore_first_n_blocks * m_block_size) {
+            return;
+        }
 
-            std::set<size_t> skip_set_adjusted;
-            size_t num_skipped_blocks_in_ignore_area = 0;
-            for (size_t i = 0; i < m_ignore_first_n_blocks; i++) {
-                if (skipped_logical_block_ids.find(i) != skipped_logical_block_ids.end()) {
-                    num_skipped_blocks_in_ignore_area++;
-                }
+        std::set<size_t> skip_set_adjusted;
+        size_t num_skipped_blocks_in_ignore_area = 0;
+        for (size_t i = 0; i < m_ignore_first_n_blocks; i++) {
+            if (skipped_logical_block_ids.find(i) != skipped_logical_block_ids.end()) {
+                num_skipped_blocks_in_ignore_area++;
             }
+        }
 
-            OPENVINO_ASSERT(num_skipped_blocks_in_ignore_area <= m_ignore_first_n_blocks);
-            size_t start_token_offset_in_scores = (m_ignore_first_n_blocks - num_skipped_blocks_in_ignore_area) * m_block_size;
+        OPENVINO_ASSERT(num_skipped_blocks_in_ignore_area <= m_ignore_first_n_blocks);
+        size_t start_token_offset_in_scores = (m_ignore_first_n_blocks - num_skipped_blocks_in_ignore_area) * m_block_size;
 
-            for (size_t skipped_block_id : skipped_logical_block_ids) {
-                if (skipped_block_id >= m_ignore_first_n_blocks) {
-                    skip_set_adjusted.insert(skipped_block_id - m_ignore_first_n_blocks);
-                } // else do not include this block in the adjusted skip set since it is in the start area already
-            }
+        for (size_t skipped_block_id : skipped_logical_block_ids) {
+            if (skipped_block_id >= m_ignore_first_n_blocks) {
+                skip_set_adjusted.insert(skipped_block_id - m_ignore_first_n_blocks);
+            } // else do not include this block in the adjusted skip set since it is in the start area already
+        }
 
-            auto hh_score = ov::Tensor(
-                    attention_scores,
-                    ov::Coordinate{start_token_offset_in_scores},
-                    ov::Coordinate{scores_size_in_tokens}
-            );
-
-            std::vector<double> max_pooled_hh_scores(hh_score.get_size());
-            auto hh_score_data = hh_score.data<float>();
-            size_t num_hh_scores = hh_score.get_size();
-
-            for (size_t idx = 0; idx < num_hh_scores; idx++) {
-                size_t effective_window_size = m_max_pool_window_size;
-                size_t elements_left = num_hh_scores - idx;
-                if (elements_left < effective_window_size) {
-                    effective_window_size = elements_left;
-                }
-                auto max_val = hh_score_data[idx];
-                for (size_t window_idx = 1; window_idx < effective_window_size; window_idx++) {
-                    auto val = hh_score_data[idx + window_idx];
-                    max_val = std::max(val, max_val);
-                }
-                max_pooled_hh_scores[idx] = max_val;
+        auto hh_score = ov::Tensor(
+                attention_scores,
+                ov::Coordinate{start_token_offset_in_scores},
+                ov::Coordinate{scores_size_in_tokens}
+        );
+
+        auto hh_score_data = hh_score.data<float>();
+        size_t num_hh_scores = hh_score.get_size();
+        std::vector<float> max_pooled_hh_scores(hh_score_data, hh_score_data + num_hh_scores);
+
+        // The window is truncated at the end of the scores. Pooling is done with one pass over the contiguous scores
+        // per window offset instead of a window scan per score, so that the passes are vectorized
+        float* max_pooled_data = max_pooled_hh_scores.data();
+        for (size_t window_idx = 1; window_idx < std::min(m_max_pool_window_size, num_hh_scores); window_idx++) {
+            const float* shifted_data = hh_score_data + window_idx;
+            for (size_t idx = 0; idx < num_hh_scores - window_idx; idx++) {
+                max_pooled_data[idx] = std::max(max_pooled_data[idx], shifted_data[idx]);
             }
+        }
 
-            auto& accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
+        auto& accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
 
-            if (accumulated_scores_for_current_decoder_layer.empty()) {
-                if (m_snapkv_window_size != 0 && num_snapkv_scores == 0) {
-                    // SnapKV window not yet reached, no meaningful scores to accumulate
-                    continue;
+        if (accumulated_scores_for_current_decoder_layer.empty()) {
+            if (m_snapkv_window_size != 0 && num_snapkv_scores == 0) {
+                // SnapKV window not yet reached, no meaningful scores to accumulate
+                return;
+            }
+            // New sequence to track
+            if (skipped_logical_block_ids.empty()) {
+                accumulated_scores_for_current_decoder_layer = max_pooled_hh_scores;
+            }
+            else {
+                accumulated_scores_for_current_decoder_layer.resize(max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size(), 0.0);
+                size_t src_idx = 0;
+                for (size_t dst_idx = 0; dst_idx < accumulated_scores_for_current_decoder_layer.size(); dst_idx++) {
+                    size_t curr_logical_block_idx = dst_idx / m_block_size;
+                    if (skipped_logical_block_ids.find(curr_logical_block_idx) != skipped_logical_block_ids.end()) {
+                        dst_idx += m_block_size;
+                        continue;
+                    }
+                    accumulated_scores_for_current_decoder_layer[dst_idx] = accumulated_scores_for_current_decoder_layer[src_idx];
+                    src_idx++;
                 }
-                // New sequence to track
-                if (skipped_logical_block_ids.empty()) {
-                    accumulated_scores_for_current_decoder_layer = max_pooled_hh_scores;
+                OPENVINO_ASSERT(src_idx == max_pooled_hh_scores.size());
+            }
+
+            if (m_aggregation_mode == AggregationMode::NORM_SUM) {
+                std::size_t new_scores_size = num_hh_scores;
+                std::vector<std::size_t> counter(new_scores_size);
+                if (m_snapkv_window_size == 0) {
+                    // Will simulate that the tokens comprising the sequence were added one-by-one
+                    // from the standpoint of the occurrence tracker
+                    std::generate(counter.begin(), counter.begin() + new_scores_size,
+                                  [&new_scores_size] { return new_scores_size--; });
                 }
                 else {
-                    accumulated_scores_for_current_decoder_layer.resize(max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size(), 0.0);
-                    size_t src_idx = 0;
-                    for (size_t dst_idx = 0; dst_idx < accumulated_scores_for_current_decoder_layer.size(); dst_idx++) {
-                        size_t curr_logical_block_idx = dst_idx / m_block_size;
-                        if (skipped_logical_block_ids.find(curr_logical_block_idx) != skipped_logical_block_ids.end()) {
-                            dst_idx += m_block_size;
-                            continue;
-                        }
-                        accumulated_scores_for_current_decoder_layer[dst_idx] = accumulated_scores_for_current_decoder_layer[src_idx];
-                        src_idx++;
-                    }
-                    OPENVINO_ASSERT(src_idx == max_pooled_hh_scores.size());
+                    OPENVINO_ASSERT(num_snapkv_scores > 0);
+                    OPENVINO_ASSERT(new_scores_size >= num_snapkv_scores);
+                    std::fill(counter.begin(), counter.end() - num_snapkv_scores, num_snapkv_scores);
+                    std::iota(counter.rbegin(), counter.rbegin() + num_snapkv_scores, 1);
                 }
+                m_cache_counter[decoder_layer_idx] = counter;
+            }
+        } else {
+            size_t old_size_in_tokens = accumulated_scores_for_current_decoder_layer.size();
+            size_t new_size_in_tokens = max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size();
 
-                if (m_aggregation_mode == AggregationMode::NORM_SUM) {
-                    std::size_t new_scores_size = num_hh_scores;
-                    std::vector<std::size_t> counter(new_scores_size);
-                    if (m_snapkv_window_size == 0) {
-                        // Will simulate that the tokens comprising the sequence were added one-by-one
-                        // from the standpoint of the occurrence tracker
-                        std::generate(counter.begin(), counter.begin() + new_scores_size,
-                                      [&new_scores_size] { return new_scores_size--; });
+            OPENVINO_ASSERT(new_size_in_tokens >= old_size_in_tokens);
+            size_t num_new_tokens = new_size_in_tokens - old_size_in_tokens;
+            if (m_aggregation_mode == AggregationMode::NORM_SUM) {
+                auto &counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
+                counter_for_current_decoder_layer.resize(new_size_in_tokens);
+                if (m_snapkv_window_size == 0 || m_num_registered_snapkv_aggregated_scores == m_snapkv_window_size) {
+                    // Increment occurrence counts of all currently tracked cache blocks
+                    for (auto it = counter_for_current_decoder_layer.begin();
+                         it != counter_for_current_decoder_layer.end(); it++) {
+                        *it += num_new_tokens;
                     }
-                    else {
-                        OPENVINO_ASSERT(num_snapkv_scores > 0);
-                        OPENVINO_ASSERT(new_scores_size >= num_snapkv_scores);
-                        std::fill(counter.begin(), counter.end() - num_snapkv_scores, num_snapkv_scores);
-                        std::iota(counter.rbegin(), counter.rbegin() + num_snapkv_scores, 1);
+                    // Add occurrence counts for new tokens like above
+                    for (size_t i = 0; i < num_new_tokens; i++) {
+                        auto idx = old_size_in_tokens + i;
+                        counter_for_current_decoder_layer[idx] = num_new_tokens - i;
                     }
-                    m_cache_counter[decoder_layer_idx] = counter;
                 }
-            } else {
-                size_t old_size_in_tokens = accumulated_scores_for_current_decoder_layer.size();
-                size_t new_size_in_tokens = max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size();
-
-                OPENVINO_ASSERT(new_size_in_tokens >= old_size_in_tokens);
-                size_t num_new_tokens = new_size_in_tokens - old_size_in_tokens;
-                if (m_aggregation_mode == AggregationMode::NORM_SUM) {
-                    auto &counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
-                    counter_for_current_decoder_layer.resize(new_size_in_tokens);
-                    if (m_snapkv_window_size == 0 || m_num_registered_snapkv_aggregated_scores == m_snapkv_window_size) {
-                        // Increment occurrence counts of all currently tracked cache blocks
-                        for (auto it = counter_for_current_decoder_layer.begin();
-                             it != counter_for_current_decoder_layer.end(); it++) {
-                            *it += num_new_tokens;
-                        }
-                        // Add occurrence counts for new tokens like above
-                        for (size_t i = 0; i < num_new_tokens; i++) {
-                            auto idx = old_size_in_tokens + i;
-                            counter_for_current_decoder_layer[idx] = num_new_tokens - i;
-                        }
-                    }
-                    else {
-                        OPENVINO_ASSERT(new_size_in_tokens >= m_num_registered_snapkv_aggregated_scores);
-                        std::fill(counter_for_current_decoder_layer.begin(), counter_for_current_decoder_layer.end() - m_num_registered_snapkv_aggregated_scores, m_num_registered_snapkv_aggregated_scores);
-                        std::iota(counter_for_current_decoder_layer.rbegin(), counter_for_current_decoder_layer.rbegin() + m_num_registered_snapkv_aggregated_scores, 1);
-                    }
-
+                else {
+                    OPENVINO_ASSERT(new_size_in_tokens >= m_num_registered_snapkv_aggregated_scores);
+                    std::fill(counter_for_current_decoder_layer.begin(), counter_for_current_decoder_layer.end() - m_num_registered_snapkv_aggregated_scores, m_num_registered_snapkv_aggregated_scores);
+                    std::iota(counter_for_current_decoder_layer.rbegin(), counter_for_current_decoder_layer.rbegin() + m_num_registered_snapkv_aggregated_scores, 1);
                 }
-                accumulated_scores_for_current_decoder_layer.resize(new_size_in_tokens);
-                add_with_skips(accumulated_scores_for_current_decoder_layer, max_pooled_hh_scores, skip_set_adjusted);
+
             }
+            accumulated_scores_for_current_decoder_layer.resize(new_size_in_tokens);
+            add_with_skips(accumulated_scores_for_current_decoder_layer, max_pooled_hh_scores, skip_set_adjusted);
         }
     }
 
@@ -194,7 +202,7 @@ namespace ov::genai {
         return m_scores[layer_idx].size();
     }
 
-    const std::vector<std::vector<double>>& EvictionScoreManager::get_scores() const {
+    const std::vector<std::vector<float>>& EvictionScoreManager::get_scores() const {
         return m_scores;
     }
 
@@ -202,19 +210,30 @@ namespace ov::genai {
         return m_cache_counter;
     }
 
-    void EvictionScoreManager::add_with_skips(std::vector<double>& dst, const std::vector<double>& src, const std::set<size_t>& skipped_logical_block_ids) const {
+    void EvictionScoreManager::add_with_skips(std::vector<float>& dst, const std::vector<float>& src, const std::set<size_t>& skipped_logical_block_ids) const {
             OPENVINO_ASSERT(skipped_logical_block_ids.size() * m_block_size + src.size() == dst.size());
-            size_t src_idx = 0;
-            for (size_t dst_idx = 0; dst_idx < dst.size(); dst_idx++) {
-                size_t curr_logical_block_idx = dst_idx / m_block_size;
-                if (skipped_logical_block_ids.find(curr_logical_block_idx) != skipped_logical_block_ids.end()) {
-                    dst_idx = m_block_size * (curr_logical_block_idx + 1) - 1;
+            // Adds the contiguous spans between the skipped blocks, which are vectorized, instead of looking up the block of each score
+            auto add_span = [&dst, &src](size_t dst_idx, size_t src_idx, size_t span_size) {
+                float* dst_data = dst.data() + dst_idx;
+                const float* src_data = src.data() + src_idx;
+                for (size_t i = 0; i < span_size; i++) {
+                    dst_data[i] += src_data[i];
+                }
+            };
+            size_t src_idx = 0, dst_idx = 0;
+            for (size_t skipped_block_id : skipped_logical_block_ids) {
+                size_t skipped_block_begin = std::min(skipped_block_id * m_block_size, dst.size());
+                if (skipped_block_begin < dst_idx) {
                     continue;
                 }
-                dst[dst_idx] += src[src_idx];
-                src_idx++;
+                size_t span_size = skipped_block_begin - dst_idx;
+                OPENVINO_ASSERT(src_idx + span_size <= src.size());
+                add_span(dst_idx, src_idx, span_size);
+                src_idx += span_size;
+                dst_idx = std::min(skipped_block_begin + m_block_size, dst.size());
             }
-            OPENVINO_ASSERT(src_idx == src.size());
+            OPENVINO_ASSERT(src_idx + (dst.size() - dst_idx) == src.size());
+            add_span(dst_idx, src_idx, dst.size() - dst_idx);
     }
 
     CacheEvictionAlgorithm::CacheEvictionAlgorithm(const CacheEvictionConfig &eviction_config, size_t block_size,
@@ -299,8 +318,9 @@ namespace ov::genai {
     void CacheEvictionAlgorithm::register_new_token_scores(
             const AttentionScoresForEachDecoderLayer &attention_scores_for_all_decoder_layers,
             const std::set<size_t>& skipped_logical_block_ids,
-            size_t num_snapkv_scores_aggregated) {
-        m_score_manager.register_new_token_scores(attention_scores_for_all_decoder_layers, skipped_logical_block_ids, num_snapkv_scores_aggregated);
+            size_t num_snapkv_scores_aggregated,
+            ThreadPool* thread_pool) {
+        m_score_manager.register_new_token_scores(attention_scores_for_all_decoder_layers, skipped_logical_block_ids, num_snapkv_scores_aggregated, thread_pool);
     }
 
 
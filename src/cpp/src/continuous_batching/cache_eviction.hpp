@@ -4,6 +4,8 @@
 #pragma once
 
 
+#include <algorithm>
+#include <set>
 #include <vector>
 #include <cstdlib>
 #include <cmath>
@@ -11,6 +13,7 @@
 #include "openvino/openvino.hpp"
 #include "continuous_batching/attention_output.hpp"
 #include "openvino/genai/cache_eviction.hpp"
+#include "sampling/threadpool.hpp"
 
 namespace ov::genai {
 
@@ -51,8 +54,9 @@ public:
      * @param skipped_logical_block_ids Logical block indices which had been skipped during inference call that produced the new scores, and
      * which are missing from the new scores.
      * @param num_snapkv_scores Number of latest token scores that were aggregated together when computing the registered score. If SnapKV is not used, this should be set to 0.
+     * @param thread_pool If set, the scores of the decoder layers are aggregated in parallel on this pool.
      */
-    void register_new_token_scores(const AttentionScoresForEachDecoderLayer& attention_scores_for_all_decoder_layers, const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores = 0);
+    void register_new_token_scores(const AttentionScoresForEachDecoderLayer& attention_scores_for_all_decoder_layers, const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores = 0, ThreadPool* thread_pool = nullptr);
 
     /**
      * Removes the scores from tracking for given block indices and given decoder layer.
@@ -71,7 +75,7 @@ public:
      * and B is the block size.
      * @param skipped_logical_block_ids The set of logical block IDs that had been "skipped" from the src values.
      */
-    void add_with_skips(std::vector<double>& dst, const std::vector<double>& src, const std::set<size_t>& skipped_logical_block_ids) const;
+    void add_with_skips(std::vector<float>& dst, const std::vector<float>& src, const std::set<size_t>& skipped_logical_block_ids) const;
 
     /**
      * @param layer_idx The decoder layer index.
@@ -82,7 +86,7 @@ public:
     /**
      * @return Current scores for all decoder layers (0-th dimension) and tokens (1-st dimension).
      */
-    const std::vector<std::vector<double>>& get_scores() const;
+    const std::vector<std::vector<float>>& get_scores() const;
 
     /**
      * @return Current token occurence counters for all decoder layers (0-th dimension) and tokens (1-st dimension).
@@ -90,9 +94,11 @@ public:
     const std::vector<std::vector<size_t>>& get_counters() const;
 
 private:
+    void register_new_token_scores_for_layer(size_t decoder_layer_idx, const ov::Tensor& attention_scores, const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores);
+
     std::size_t m_block_size;
     std::size_t m_num_decoder_layers;
-    std::vector<std::vector<double>> m_scores;
+    std::vector<std::vector<float>> m_scores;
     std::vector<std::vector<size_t>> m_cache_counter;
     std::size_t m_max_pool_window_size;
     AggregationMode m_aggregation_mode;
@@ -187,8 +193,9 @@ public:
      * @param skipped_logical_block_ids The set of logical indices that have been skipped from the scores as part of the sparse attention prefill process
      * @param num_snapkv_scores The number of SnapKV-aggregated scores in this score chunk. Set to 0 if SnapKV is not used
      * (i.e. eviction_config.snapkv_window_size == 0)
+     * @param thread_pool If set, the scores of the decoder layers are aggregated in parallel on this pool.
      */
-    void register_new_token_scores(const AttentionScoresForEachDecoderLayer& attention_scores_for_all_decoder_layers, const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores = 0);
+    void register_new_token_scores(const AttentionScoresForEachDecoderLayer& attention_scores_for_all_decoder_layers, const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores = 0, ThreadPool* thread_pool = nullptr);
 
     void register_new_token_scores(const AttentionScoresForEachDecoderLayer& attention_scores_across_decoder_layers_for_current_sequence, size_t num_snapkv_scores = 0);
     /**
@@ -200,6 +207,15 @@ public:
      */
     std::vector<std::set<std::size_t>> evict_logical_blocks();
 
+    /**
+     * @param evicted_logical_block_indices The per-layer sets of logical block indices as returned by evict_logical_blocks.
+     * @return Whether any block is evicted in any of the layers, the remaining blocks only have to be rotated then.
+     */
+    static bool has_evicted_blocks(const std::vector<std::set<std::size_t>>& evicted_logical_block_indices) {
+        return std::any_of(evicted_logical_block_indices.begin(), evicted_logical_block_indices.end(),
+                           [](const std::set<std::size_t>& layer_blocks) { return !layer_blocks.empty(); });
+    }
+
 
 private:
     std::size_t get_num_blocks(std::size_t num_tokens) const;
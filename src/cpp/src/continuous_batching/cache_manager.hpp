@@ -5,8 +5,16 @@
 
 #include <vector>
 #include <list>
+#include <map>
+#include <memory>
+#include <filesystem>
+#include <fstream>
+#include <optional>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "continuous_batching/numa.hpp"
+#include "continuous_batching/reserved_memory.hpp"
 
 namespace ov::genai {
 
@@ -21,16 +29,230 @@ class CacheManager {
     ov::InferRequest m_request;
     ov::RemoteContext m_context;
 
+    // Swap space for KV cache blocks of preempted sequences. Swap block indices [0, m_num_host_swap_blocks) are stored
+    // in host memory, the following m_num_disk_swap_blocks ones - in the swap file.
+    size_t m_num_host_swap_blocks = 0, m_num_disk_swap_blocks = 0;
+    std::vector<ov::Tensor> m_key_swap_space, m_value_swap_space;
+    // single-block host buffers used to stage the transfers between the remote tensors and the swap file
+    std::vector<ov::Tensor> m_key_swap_staging, m_value_swap_staging;
+    std::vector<size_t> m_key_block_size_in_bytes, m_value_block_size_in_bytes;
+    std::fstream m_swap_file;
+
+    // Address space reserved for the CPU KV cache of each layer (see reserve_cache), allowing the cache to grow in place
+    // up to m_num_reserved_kv_blocks without copying the existing blocks.
+    size_t m_num_reserved_kv_blocks = 0;
+    std::vector<std::unique_ptr<ReservedMemory>> m_key_reserved_memory, m_value_reserved_memory;
+
+    // the NUMA node the host memory KV cache is placed on, see set_numa_node
+    std::optional<size_t> m_numa_node;
+
     static ov::Shape set_kv_blocks(ov::PartialShape pshape, size_t num_kv_blocks) {
         pshape[0] = num_kv_blocks;
         return pshape.get_shape();
     }
 
+    static size_t get_block_size_in_bytes(const ov::PartialShape& pshape, ov::element::Type precision) {
+        size_t num_elements = pshape[1].get_length() * pshape[2].get_length() * pshape[3].get_length();
+        return (num_elements * precision.bitwidth() + 7) / 8;
+    }
+
+    size_t get_swap_file_offset(size_t disk_swap_block_id, size_t decoder_layer_id, bool is_value) const {
+        size_t offset = disk_swap_block_id * m_block_size_in_bytes;
+        for (size_t layer_id = 0; layer_id < decoder_layer_id; ++layer_id) {
+            offset += m_key_block_size_in_bytes[layer_id] + m_value_block_size_in_bytes[layer_id];
+        }
+        return is_value ? offset + m_key_block_size_in_bytes[decoder_layer_id] : offset;
+    }
+
+    struct BlockCopyRun {
+        size_t src_block_id;
+        size_t dst_block_id;
+        size_t num_blocks;
+    };
+
+    // copies a single KV cache block between the device cache tensor and the swap file
+    void copy_disk_swap_block(ov::Tensor& cache, ov::Tensor& staging, size_t block_size_in_bytes, size_t decoder_layer_id,
+                              bool is_value, size_t block_id, size_t swap_block_id, bool to_swap_space) {
+        const bool is_remote = cache.is<ov::RemoteTensor>();
+        ov::Coordinate cache_start(cache.get_shape().size(), 0), cache_end = cache.get_shape();
+        cache_end[0] = (cache_start[0] = block_id) + 1;
+        uint8_t* host_ptr = is_remote ? static_cast<uint8_t*>(staging.data()) : static_cast<uint8_t*>(cache.data()) + block_id * block_size_in_bytes;
+        const size_t swap_file_offset = get_swap_file_offset(swap_block_id - m_num_host_swap_blocks, decoder_layer_id, is_value);
+
+        if (to_swap_space) {
+            if (is_remote) {
+                ov::RemoteTensor cache_roi(cache, cache_start, cache_end);
+                cache_roi.copy_to(staging);
+            }
+            m_swap_file.seekp(swap_file_offset);
+            m_swap_file.write(reinterpret_cast<const char*>(host_ptr), block_size_in_bytes);
+            OPENVINO_ASSERT(m_swap_file.good(), "Failed to write a KV cache block to the swap file");
+        } else {
+            m_swap_file.seekg(swap_file_offset);
+            m_swap_file.read(reinterpret_cast<char*>(host_ptr), block_size_in_bytes);
+            OPENVINO_ASSERT(m_swap_file.good(), "Failed to read a KV cache block from the swap file");
+            if (is_remote) {
+                ov::RemoteTensor cache_roi(cache, cache_start, cache_end);
+                cache_roi.copy_from(staging);
+            }
+        }
+    }
+
+    // copies a run of consecutive KV cache blocks (run.src_block_id) between the device cache tensor and consecutive blocks
+    // of the host memory tier of the swap space (run.dst_block_id) at once, i.e. with a single transfer for the remote tensors
+    void copy_host_swap_run(ov::Tensor& cache, ov::Tensor& swap_space, size_t block_size_in_bytes, const BlockCopyRun& run, bool to_swap_space) {
+        if (cache.is<ov::RemoteTensor>()) {
+            ov::Coordinate cache_start(cache.get_shape().size(), 0), cache_end = cache.get_shape();
+            ov::Coordinate swap_start(swap_space.get_shape().size(), 0), swap_end = swap_space.get_shape();
+            cache_end[0] = (cache_start[0] = run.src_block_id) + run.num_blocks;
+            swap_end[0] = (swap_start[0] = run.dst_block_id) + run.num_blocks;
+            ov::RemoteTensor cache_roi(cache, cache_start, cache_end);
+            ov::Tensor swap_roi(swap_space, swap_start, swap_end);
+            if (to_swap_space) {
+                cache_roi.copy_to(swap_roi);
+            } else {
+                cache_roi.copy_from(swap_roi);
+            }
+            return;
+        }
+        uint8_t* cache_ptr = static_cast<uint8_t*>(cache.data()) + run.src_block_id * block_size_in_bytes;
+        uint8_t* swap_ptr = static_cast<uint8_t*>(swap_space.data()) + run.dst_block_id * block_size_in_bytes;
+        if (to_swap_space) {
+            std::memcpy(swap_ptr, cache_ptr, run.num_blocks * block_size_in_bytes);
+        } else {
+            std::memcpy(cache_ptr, swap_ptr, run.num_blocks * block_size_in_bytes);
+        }
+    }
+
+    void copy_swap_blocks(const std::vector<std::map<size_t, size_t>>& per_layer_block_map, bool to_swap_space) {
+        OPENVINO_ASSERT(per_layer_block_map.empty() || per_layer_block_map.size() == m_num_decoder_layers,
+                        "Swap block mapping must be specified for each decoder layer");
+        std::vector<BlockCopyRun> host_swap_runs;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < per_layer_block_map.size(); ++decoder_layer_id) {
+            // the blocks of a preempted sequence are mostly swapped to consecutive swap blocks, so they are copied in runs
+            host_swap_runs.clear();
+            for (const auto& [first, second] : per_layer_block_map[decoder_layer_id]) {
+                size_t block_id = to_swap_space ? first : second, swap_block_id = to_swap_space ? second : first;
+                OPENVINO_ASSERT(block_id < m_num_allocated_kv_blocks, "KV cache block ", block_id, " is not allocated");
+                OPENVINO_ASSERT(swap_block_id < get_num_swap_blocks(), "Swap block ", swap_block_id, " is out of swap space bounds");
+                if (swap_block_id >= m_num_host_swap_blocks) {
+                    copy_disk_swap_block(m_key_cache[decoder_layer_id], m_key_swap_staging[decoder_layer_id], m_key_block_size_in_bytes[decoder_layer_id],
+                                         decoder_layer_id, false, block_id, swap_block_id, to_swap_space);
+                    copy_disk_swap_block(m_value_cache[decoder_layer_id], m_value_swap_staging[decoder_layer_id], m_value_block_size_in_bytes[decoder_layer_id],
+                                         decoder_layer_id, true, block_id, swap_block_id, to_swap_space);
+                    continue;
+                }
+                if (!host_swap_runs.empty()) {
+                    auto& last_run = host_swap_runs.back();
+                    if (last_run.src_block_id + last_run.num_blocks == block_id && last_run.dst_block_id + last_run.num_blocks == swap_block_id) {
+                        ++last_run.num_blocks;
+                        continue;
+                    }
+                }
+                host_swap_runs.push_back({block_id, swap_block_id, 1});
+            }
+            for (const auto& run : host_swap_runs) {
+                copy_host_swap_run(m_key_cache[decoder_layer_id], m_key_swap_space[decoder_layer_id], m_key_block_size_in_bytes[decoder_layer_id], run, to_swap_space);
+                copy_host_swap_run(m_value_cache[decoder_layer_id], m_value_swap_space[decoder_layer_id], m_value_block_size_in_bytes[decoder_layer_id], run, to_swap_space);
+            }
+        }
+    }
+
+    // Flattens the src -> dst block copy map into runs of consecutive source blocks to be copied into consecutive
+    // destination blocks, so that each run is copied at once. Destination blocks are always freshly allocated ones,
+    // so the runs never overlap.
+    static std::vector<BlockCopyRun> get_block_copy_runs(const std::map<size_t, std::list<size_t>>& block_copy_map) {
+        std::vector<std::pair<size_t, size_t>> block_pairs;
+        for (const auto& [src_block_id, dst_block_ids] : block_copy_map) {
+            for (size_t dst_block_id : dst_block_ids) {
+                block_pairs.emplace_back(src_block_id, dst_block_id);
+            }
+        }
+        std::sort(block_pairs.begin(), block_pairs.end());
+
+        std::vector<BlockCopyRun> runs;
+        for (const auto& [src_block_id, dst_block_id] : block_pairs) {
+            if (!runs.empty()) {
+                auto& last_run = runs.back();
+                if (last_run.src_block_id + last_run.num_blocks == src_block_id && last_run.dst_block_id + last_run.num_blocks == dst_block_id) {
+                    ++last_run.num_blocks;
+                    continue;
+                }
+            }
+            runs.push_back({src_block_id, dst_block_id, 1});
+        }
+        return runs;
+    }
+
+    void copy_host_blocks(ov::Tensor& cache, size_t block_size_in_bytes, const BlockCopyRun& run) {
+        OPENVINO_ASSERT(std::max(run.src_block_id, run.dst_block_id) + run.num_blocks <= m_num_allocated_kv_blocks);
+        uint8_t* cache_data = static_cast<uint8_t*>(cache.data());
+        std::memcpy(cache_data + run.dst_block_id * block_size_in_bytes, cache_data + run.src_block_id * block_size_in_bytes, run.num_blocks * block_size_in_bytes);
+    }
+
+    void copy_remote_blocks(ov::Tensor& cache, const BlockCopyRun& run) {
+        OPENVINO_ASSERT(std::max(run.src_block_id, run.dst_block_id) + run.num_blocks <= m_num_allocated_kv_blocks);
+        ov::Coordinate src_start(cache.get_shape().size(), 0), src_end = cache.get_shape();
+        ov::Coordinate dst_start(cache.get_shape().size(), 0), dst_end = cache.get_shape();
+        src_end[0] = (src_start[0] = run.src_block_id) + run.num_blocks;
+        dst_end[0] = (dst_start[0] = run.dst_block_id) + run.num_blocks;
+        ov::RemoteTensor src_roi(cache, src_start, src_end);
+        ov::RemoteTensor dst_roi(cache, dst_start, dst_end);
+        dst_roi.copy_from(src_roi);
+    }
+
+    void copy_block_with_host(ov::Tensor& cache, size_t block_size_in_bytes, size_t block_id, uint8_t* host_ptr, bool to_host) {
+        OPENVINO_ASSERT(block_id < m_num_allocated_kv_blocks, "KV cache block ", block_id, " is not allocated");
+        if (cache.is<ov::RemoteTensor>()) {
+            ov::Coordinate cache_start(cache.get_shape().size(), 0), cache_end = cache.get_shape();
+            cache_end[0] = (cache_start[0] = block_id) + 1;
+            ov::Shape block_shape = cache.get_shape();
+            block_shape[0] = 1;
+            ov::Tensor host_block(cache.get_element_type(), block_shape, host_ptr);
+            ov::RemoteTensor cache_roi(cache, cache_start, cache_end);
+            if (to_host) {
+                cache_roi.copy_to(host_block);
+            } else {
+                cache_roi.copy_from(host_block);
+            }
+            return;
+        }
+        uint8_t* cache_ptr = static_cast<uint8_t*>(cache.data()) + block_id * block_size_in_bytes;
+        if (to_host) {
+            std::memcpy(host_ptr, cache_ptr, block_size_in_bytes);
+        } else {
+            std::memcpy(cache_ptr, host_ptr, block_size_in_bytes);
+        }
+    }
+
     void update_request_tensor(size_t decoder_layer_id) {
         m_request.set_tensor(std::string("key_cache.") + std::to_string(decoder_layer_id), m_key_cache[decoder_layer_id]);
         m_request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
     }
 
+    // the first num_kv_blocks blocks of the cache in a smaller tensor, or in the same memory for the reserved one
+    ov::Tensor shrink_tensor(const ov::Tensor& cache, ov::element::Type precision, const ov::PartialShape& pshape, size_t block_size_in_bytes,
+                             ReservedMemory* reserved_memory, size_t num_kv_blocks) {
+        ov::Shape cache_shape = set_kv_blocks(pshape, num_kv_blocks);
+        if (reserved_memory) {
+            reserved_memory->decommit(block_size_in_bytes * num_kv_blocks);
+            return ov::Tensor(precision, cache_shape, reserved_memory->data());
+        }
+        if (m_context) {
+            ov::Tensor shrunk_cache = m_context.create_tensor(precision, cache_shape);
+            ov::RemoteTensor src_roi(cache, ov::Coordinate(cache_shape.size(), 0), ov::Coordinate(cache_shape));
+            src_roi.copy_to(shrunk_cache);
+            return shrunk_cache;
+        }
+        ov::Tensor shrunk_cache(precision, cache_shape);
+        if (m_numa_node.has_value()) {
+            bind_memory_to_numa_node(shrunk_cache.data(), shrunk_cache.get_byte_size(), *m_numa_node);
+        }
+        // the blocks are the outermost dimension, so the first blocks are the beginning of the memory
+        std::memcpy(shrunk_cache.data(), cache.data(), shrunk_cache.get_byte_size());
+        return shrunk_cache;
+    }
+
 public:
     explicit CacheManager(ov::InferRequest request) :
         m_request(request) {
@@ -42,7 +264,9 @@ public:
                 return device.find("GPU") != std::string::npos;
             });
         OPENVINO_ASSERT(all_gpu_device || execution_devices.size() == 1,
-                        "Continuous batching: execution device is expected to be single CPU / single GPU / multi GPUs");
+                        "Continuous batching: execution device is expected to be single CPU / single GPU / multi GPUs, "
+                        "got ", ov::Any(execution_devices).as<std::string>(), ". Pipeline-parallel splits across heterogeneous devices are not supported, "
+                        "since the KV cache of all layers is allocated in a single device context");
         m_device = execution_devices[0];
         // set block_size depending on device
         const size_t cpu_block_size = 32, gpu_block_size = 16;
@@ -63,12 +287,14 @@ public:
                     m_block_size_in_bytes += pshape[1].get_length() * pshape[2].get_length() * pshape[3].get_length() * cache_precision.size();
                     m_key_shapes.push_back(pshape);
                     m_key_precisions.push_back(cache_precision);
+                    m_key_block_size_in_bytes.push_back(get_block_size_in_bytes(pshape, cache_precision));
                     break;
                 } else if (name.find("value_cache.") == 0) {
                     pshape = input.get_partial_shape();
                     m_block_size_in_bytes += pshape[1].get_length() * pshape[2].get_length() * pshape[3].get_length() * cache_precision.size();
                     m_value_shapes.push_back(pshape);
                     m_value_precisions.push_back(cache_precision);
+                    m_value_block_size_in_bytes.push_back(get_block_size_in_bytes(pshape, cache_precision));
                     ++kv_input_index;
                     break;
                 }
@@ -105,12 +331,45 @@ public:
         return m_block_size_in_bytes;
     }
 
+    /**
+     * Places the host memory KV cache allocated afterwards on a NUMA node, e.g. the one the inference threads run on,
+     * so that the attention doesn't read the cache across the sockets. Has no effect on the remote tensors.
+     */
+    void set_numa_node(size_t numa_node) {
+        m_numa_node = numa_node;
+    }
+
     size_t sub_byte_data_type_multiplier(const ov::element::Type data_type) const {
         if (data_type == ov::element::i4 || data_type == ov::element::u4)
             return 2;
         return 1;
     }
 
+    /**
+     * Reserves the address space for the KV cache to grow up to a given number of blocks without reallocations, so that
+     * the subsequent allocate_cache_if_needed calls only commit the additional memory instead of allocating new
+     * tensors and copying the existing cache contents into them. Physical memory is committed on demand.
+     * Only applicable to the host memory caches and before the cache is allocated.
+     * @param max_num_kv_blocks The number of KV cache blocks to reserve the address space for.
+     * @return Whether the address space has been reserved.
+     */
+    bool reserve_cache(size_t max_num_kv_blocks) {
+        if (m_context || m_num_allocated_kv_blocks > 0 || max_num_kv_blocks == 0) {
+            return false;
+        }
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            m_key_reserved_memory.push_back(std::make_unique<ReservedMemory>(m_key_block_size_in_bytes[decoder_layer_id] * max_num_kv_blocks));
+            m_value_reserved_memory.push_back(std::make_unique<ReservedMemory>(m_value_block_size_in_bytes[decoder_layer_id] * max_num_kv_blocks));
+            if (m_numa_node.has_value()) {
+                // the policy of the range applies to the pages committed later
+                bind_memory_to_numa_node(m_key_reserved_memory.back()->data(), m_key_reserved_memory.back()->capacity(), *m_numa_node);
+                bind_memory_to_numa_node(m_value_reserved_memory.back()->data(), m_value_reserved_memory.back()->capacity(), *m_numa_node);
+            }
+        }
+        m_num_reserved_kv_blocks = max_num_kv_blocks;
+        return true;
+    }
+
     void allocate_cache_if_needed(size_t num_kv_blocks) {
         if (m_num_allocated_kv_blocks >= num_kv_blocks) {
             return;
@@ -118,6 +377,27 @@ public:
 
         m_num_allocated_kv_blocks = num_kv_blocks;
 
+        if (num_kv_blocks <= m_num_reserved_kv_blocks) {
+            // grow in place, the existing blocks stay where they are
+            for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+                m_key_reserved_memory[decoder_layer_id]->commit(m_key_block_size_in_bytes[decoder_layer_id] * num_kv_blocks);
+                m_value_reserved_memory[decoder_layer_id]->commit(m_value_block_size_in_bytes[decoder_layer_id] * num_kv_blocks);
+                ov::Tensor key_cache(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], num_kv_blocks),
+                                     m_key_reserved_memory[decoder_layer_id]->data());
+                ov::Tensor value_cache(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], num_kv_blocks),
+                                       m_value_reserved_memory[decoder_layer_id]->data());
+                if (m_key_cache.size() > decoder_layer_id) {
+                    m_key_cache[decoder_layer_id] = key_cache;
+                    m_value_cache[decoder_layer_id] = value_cache;
+                } else {
+                    m_key_cache.emplace_back(key_cache);
+                    m_value_cache.emplace_back(value_cache);
+                }
+                update_request_tensor(decoder_layer_id);
+            }
+            return;
+        }
+
         ov::Coordinate start_key{0,0,0,0};
         ov::Coordinate start_value{0,0,0,0};
 
@@ -158,6 +438,11 @@ public:
 
                 ov::Tensor key_cache(key_precision, key_cache_shape);
                 ov::Tensor value_cache(value_precision, value_cache_shape);
+                if (m_numa_node.has_value()) {
+                    // before the existing blocks are copied, so that the pages are allocated on the node right away
+                    bind_memory_to_numa_node(key_cache.data(), key_cache.get_byte_size(), *m_numa_node);
+                    bind_memory_to_numa_node(value_cache.data(), value_cache.get_byte_size(), *m_numa_node);
+                }
 
                 auto key_cache_roi_end = static_cast<unsigned char*>(key_cache.data());
                 auto value_cache_roi_end = static_cast<unsigned char*>(value_cache.data());
@@ -202,6 +487,34 @@ public:
 
                 update_request_tensor(decoder_layer_id);
             }
+
+            // the cache has outgrown the reserved address space and has been copied into the regular tensors above
+            m_num_reserved_kv_blocks = 0;
+            m_key_reserved_memory.clear();
+            m_value_reserved_memory.clear();
+        }
+    }
+
+    /**
+     * Releases the memory of the KV cache blocks past a given number, e.g. after the occupied blocks have been moved to
+     * the beginning of the cache, the contents of the remaining blocks are kept. The memory reserved by reserve_cache
+     * is decommitted in place, the other caches are copied into the smaller tensors.
+     * @param num_kv_blocks The number of KV cache blocks to be left.
+     */
+    void shrink_cache(size_t num_kv_blocks) {
+        if (num_kv_blocks >= m_num_allocated_kv_blocks) {
+            return;
+        }
+        m_num_allocated_kv_blocks = num_kv_blocks;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            const bool is_reserved = m_num_reserved_kv_blocks > 0;
+            m_key_cache[decoder_layer_id] = shrink_tensor(m_key_cache[decoder_layer_id], get_key_cache_precision(decoder_layer_id),
+                                                          m_key_shapes[decoder_layer_id], m_key_block_size_in_bytes[decoder_layer_id],
+                                                          is_reserved ? m_key_reserved_memory[decoder_layer_id].get() : nullptr, num_kv_blocks);
+            m_value_cache[decoder_layer_id] = shrink_tensor(m_value_cache[decoder_layer_id], get_value_cache_precision(decoder_layer_id),
+                                                            m_value_shapes[decoder_layer_id], m_value_block_size_in_bytes[decoder_layer_id],
+                                                            is_reserved ? m_value_reserved_memory[decoder_layer_id].get() : nullptr, num_kv_blocks);
+            update_request_tensor(decoder_layer_id);
         }
     }
 
@@ -219,62 +532,112 @@ public:
         return m_value_shapes[layer_id][3].get_length();
     }
 
-    void copy_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map) {
-        for (const auto & blocks_pair : block_copy_map) {
-            size_t src_block_id = blocks_pair.first;
-            const std::list<size_t>& dst_block_ids = blocks_pair.second;
-            for (size_t dst_block_id : dst_block_ids) {
-                for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
-                    ov::Shape key_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Shape value_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Coordinate key_src_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_src_end_roi = key_shape;
-                    ov::Coordinate key_dst_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_dst_end_roi = key_shape;
-
-                    ov::Coordinate value_src_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_src_end_roi = value_shape;
-                    ov::Coordinate value_dst_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_dst_end_roi = value_shape;
-                    key_src_end_roi[0] = (key_src_start_roi[0] = src_block_id) + 1;
-                    value_src_end_roi[0] = (value_src_start_roi[0] = src_block_id) + 1;
-                    key_dst_end_roi[0] = (key_dst_start_roi[0] = dst_block_id) + 1;
-                    value_dst_end_roi[0] = (value_dst_start_roi[0] = dst_block_id) + 1;
-
-                    auto copy_one_block = [&](ov::Tensor& dst, const ov::Tensor& src, size_t src_start, size_t dst_start, size_t stride) {
-                        const bool is_remote = dst.is<ov::RemoteTensor>() || src.is<ov::RemoteTensor>();
-                        if (is_remote) {
-                            return;
-                        }
-                        auto sub_byte_multipyer = sub_byte_data_type_multiplier(dst.get_element_type());
-                        OPENVINO_SUPPRESS_DEPRECATED_START
-                        const uint8_t* src_ptr = reinterpret_cast<const uint8_t*>(src.data()) + src_start * stride;
-                        uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dst.data()) + dst_start * stride;
-                        OPENVINO_SUPPRESS_DEPRECATED_END
-                        std::memcpy(dst_ptr, src_ptr, 1 * stride);
-                    };
-
-                    const auto& key_cache_prec = m_key_cache[decoder_layer_id].get_element_type();
-                    if (key_cache_prec == ov::element::u4 || key_cache_prec == ov::element::i4) {
-                        size_t stride = std::accumulate(std::next(key_shape.begin()), key_shape.end(), 1, std::multiplies<size_t>()) / 2;
-                        copy_one_block(m_key_cache[decoder_layer_id], m_key_cache[decoder_layer_id], key_src_start_roi[0], key_dst_start_roi[0], stride);
-                    } else {
-                        ov::Tensor key_src_cache_roi(m_key_cache[decoder_layer_id], key_src_start_roi, key_src_end_roi);
-                        ov::Tensor key_dst_cache_roi(m_key_cache[decoder_layer_id], key_dst_start_roi, key_dst_end_roi);
-                        key_src_cache_roi.copy_to(key_dst_cache_roi);
-                    }
+    /**
+     * Allocates the swap space for the KV cache blocks of preempted sequences.
+     * @param num_host_swap_blocks Number of KV cache blocks (for all layers) to be stored in host memory.
+     * @param num_disk_swap_blocks Number of KV cache blocks (for all layers) to be stored in the swap file.
+     * @param swap_file_path Path to the swap file. Must be set if num_disk_swap_blocks is non-zero.
+     */
+    void allocate_swap_space(size_t num_host_swap_blocks, size_t num_disk_swap_blocks = 0, const std::filesystem::path& swap_file_path = {}) {
+        OPENVINO_ASSERT(get_num_swap_blocks() == 0, "Swap space is already allocated");
+        OPENVINO_ASSERT(num_disk_swap_blocks == 0 || !swap_file_path.empty(), "Swap file path must be set to use on-disk swap space");
+        m_num_host_swap_blocks = num_host_swap_blocks;
+        m_num_disk_swap_blocks = num_disk_swap_blocks;
+
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            m_key_swap_space.emplace_back(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], num_host_swap_blocks));
+            m_value_swap_space.emplace_back(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], num_host_swap_blocks));
+            m_key_swap_staging.emplace_back(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], 1));
+            m_value_swap_staging.emplace_back(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], 1));
+        }
 
-                    const auto& value_cache_prec = m_value_cache[decoder_layer_id].get_element_type();
-                    if (value_cache_prec == ov::element::u4 || value_cache_prec == ov::element::i4) {
-                        size_t stride = std::accumulate(std::next(value_shape.begin()), value_shape.end(), 1, std::multiplies<size_t>()) / 2;
-                        copy_one_block(m_value_cache[decoder_layer_id], m_value_cache[decoder_layer_id], value_src_start_roi[0], value_dst_start_roi[0], stride);
-                    } else {
-                        ov::Tensor value_src_cache_roi(m_value_cache[decoder_layer_id], value_src_start_roi, value_src_end_roi);
-                        ov::Tensor value_dst_cache_roi(m_value_cache[decoder_layer_id], value_dst_start_roi, value_dst_end_roi);
-                        value_src_cache_roi.copy_to(value_dst_cache_roi);
-                    }
+        if (num_disk_swap_blocks > 0) {
+            m_swap_file.open(swap_file_path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+            OPENVINO_ASSERT(m_swap_file.is_open(), "Failed to open swap file ", swap_file_path);
+        }
+    }
+
+    /**
+     * @return Total number of KV cache blocks that can be stored in the swap space (host memory and disk tiers).
+     */
+    size_t get_num_swap_blocks() const {
+        return m_num_host_swap_blocks + m_num_disk_swap_blocks;
+    }
+
+    /**
+     * @return The size in bytes of the host memory tier of the swap space for all layers.
+     */
+    size_t get_host_swap_space_size_in_bytes() const {
+        return m_num_host_swap_blocks * m_block_size_in_bytes;
+    }
+
+    /**
+     * @return The size in bytes of the keys and values stored in a single KV cache block of a decoder layer.
+     */
+    size_t get_layer_block_size_in_bytes(size_t decoder_layer_id) const {
+        OPENVINO_ASSERT(decoder_layer_id < m_num_decoder_layers);
+        return m_key_block_size_in_bytes[decoder_layer_id] + m_value_block_size_in_bytes[decoder_layer_id];
+    }
+
+    /**
+     * Copies the keys followed by the values of a KV cache block of a decoder layer into a host buffer of
+     * get_layer_block_size_in_bytes(decoder_layer_id) bytes.
+     */
+    void copy_block_to_host(size_t decoder_layer_id, size_t block_id, uint8_t* dst) {
+        OPENVINO_ASSERT(decoder_layer_id < m_num_decoder_layers);
+        copy_block_with_host(m_key_cache[decoder_layer_id], m_key_block_size_in_bytes[decoder_layer_id], block_id, dst, true);
+        copy_block_with_host(m_value_cache[decoder_layer_id], m_value_block_size_in_bytes[decoder_layer_id], block_id,
+                             dst + m_key_block_size_in_bytes[decoder_layer_id], true);
+    }
+
+    /**
+     * Copies the keys followed by the values of a KV cache block of a decoder layer from a host buffer, as filled by
+     * copy_block_to_host.
+     */
+    void copy_block_from_host(size_t decoder_layer_id, size_t block_id, const uint8_t* src) {
+        OPENVINO_ASSERT(decoder_layer_id < m_num_decoder_layers);
+        uint8_t* host_ptr = const_cast<uint8_t*>(src);
+        copy_block_with_host(m_key_cache[decoder_layer_id], m_key_block_size_in_bytes[decoder_layer_id], block_id, host_ptr, false);
+        copy_block_with_host(m_value_cache[decoder_layer_id], m_value_block_size_in_bytes[decoder_layer_id], block_id,
+                             host_ptr + m_key_block_size_in_bytes[decoder_layer_id], false);
+    }
+
+    /**
+     * Copies KV cache blocks from the device KV cache into the swap space.
+     * @param per_layer_block_map For each decoder layer, a map of KV cache block indices to the swap block indices to copy these into.
+     */
+    void swap_out(const std::vector<std::map<size_t, size_t>>& per_layer_block_map) {
+        copy_swap_blocks(per_layer_block_map, /* to_swap_space = */ true);
+    }
+
+    /**
+     * Copies KV cache blocks from the swap space back into the device KV cache.
+     * @param per_layer_block_map For each decoder layer, a map of swap block indices to the KV cache block indices to copy these into.
+     */
+    void swap_in(const std::vector<std::map<size_t, size_t>>& per_layer_block_map) {
+        copy_swap_blocks(per_layer_block_map, /* to_swap_space = */ false);
+    }
+
+    void copy_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map) {
+        if (block_copy_map.empty()) {
+            return;
+        }
+        const auto block_copy_runs = get_block_copy_runs(block_copy_map);
+        if (m_context) {
+            // device-side copies between the regions of the same remote tensor, no transfers to host are involved
+            for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+                for (const auto& run : block_copy_runs) {
+                    copy_remote_blocks(m_key_cache[decoder_layer_id], run);
+                    copy_remote_blocks(m_value_cache[decoder_layer_id], run);
                 }
             }
+        } else {
+            ov::parallel_for(m_num_decoder_layers, [&](size_t decoder_layer_id) {
+                for (const auto& run : block_copy_runs) {
+                    copy_host_blocks(m_key_cache[decoder_layer_id], m_key_block_size_in_bytes[decoder_layer_id], run);
+                    copy_host_blocks(m_value_cache[decoder_layer_id], m_value_block_size_in_bytes[decoder_layer_id], run);
+                }
+            });
         }
     }
 };
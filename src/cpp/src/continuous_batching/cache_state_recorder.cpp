@@ -0,0 +1,172 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/cache_state_recorder.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "logger.hpp"
+
+namespace {
+
+template <typename T>
+void append(std::vector<uint8_t>& buffer, T value) {
+    const size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+void write_at(std::vector<uint8_t>& buffer, size_t offset, T value) {
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+CacheStateRecorder::CacheStateRecorder(const std::filesystem::path& file_path)
+    : m_file(file_path, std::ios::binary | std::ios::trunc) {
+    OPENVINO_ASSERT(m_file.is_open(), "Failed to open the cache state file ", file_path.string());
+    m_file.write(magic, sizeof(magic));
+    m_file.write(reinterpret_cast<const char*>(&format_version), sizeof(format_version));
+    m_writer = std::thread([this] {
+        write_loop();
+    });
+}
+
+CacheStateRecorder::~CacheStateRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_stopped = true;
+    }
+    m_cv.notify_one();
+    m_writer.join();
+    if (m_num_total_dropped > 0) {
+        Logger::warn("The cache state recorder dropped " + std::to_string(m_num_total_dropped) +
+                     " snapshots, since the file writing lagged behind the generation steps");
+    }
+}
+
+std::unique_ptr<CacheStateRecorder> CacheStateRecorder::create_from_env() {
+    const char* file_path = std::getenv("OV_GENAI_CACHE_STATE_FILE");
+    if (!file_path || std::strlen(file_path) == 0) {
+        return nullptr;
+    }
+    static std::atomic<size_t> num_recorders{0};
+    const size_t recorder_idx = num_recorders++;
+    std::string path = file_path;
+    if (recorder_idx > 0) {
+        path += "." + std::to_string(recorder_idx);
+    }
+    return std::make_unique<CacheStateRecorder>(path);
+}
+
+void CacheStateRecorder::record_step(const BlockManager& block_manager,
+                                     const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                                     const std::map<size_t, std::vector<std::set<size_t>>>& evicted_blocks) {
+    const uint64_t step = m_step++;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending_snapshots.size() >= max_pending_snapshots) {
+            ++m_num_dropped;
+            ++m_num_total_dropped;
+            return;
+        }
+    }
+
+    std::vector<uint8_t> snapshot;
+    // the size is written after the snapshot is serialized
+    append<uint32_t>(snapshot, 0);
+    append<uint64_t>(snapshot, step);
+    append<int64_t>(snapshot, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start_time).count());
+    append<uint32_t>(snapshot, m_num_dropped);
+    append<uint32_t>(snapshot, block_manager.m_block_size);
+    append<uint32_t>(snapshot, block_manager.m_allocator.m_total_num_blocks);
+    append<uint32_t>(snapshot, block_manager.num_free_blocks());
+    append<uint32_t>(snapshot, block_manager.m_allocator.num_overwriteable_blocks());
+    append<uint32_t>(snapshot, block_manager.m_prefix_hash_to_occupied_block_map.size());
+
+    append<uint32_t>(snapshot, sequence_groups.size());
+    for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+        append<uint64_t>(snapshot, sequence_group->get_request_id());
+        const auto& sequences = sequence_group->get_sequences();
+        append<uint32_t>(snapshot, sequences.size());
+        for (const Sequence::Ptr& sequence : sequences) {
+            append<uint64_t>(snapshot, sequence->get_id());
+            auto block_table_it = block_manager.m_block_table.find(sequence->get_id());
+            if (block_table_it == block_manager.m_block_table.end() || block_table_it->second.empty()) {
+                append<uint32_t>(snapshot, 0);
+                continue;
+            }
+            const auto& blocks = block_table_it->second[0];
+            append<uint32_t>(snapshot, blocks.size());
+            for (const auto& block : blocks) {
+                append<uint32_t>(snapshot, block->get_index());
+            }
+        }
+    }
+
+    // the blocks shared by sequences are recorded once
+    std::map<int, KVCacheBlock::Ptr> occupied_blocks;
+    for (const auto& [seq_id, blocks_per_layer] : block_manager.m_block_table) {
+        if (blocks_per_layer.empty()) {
+            continue;
+        }
+        for (const auto& block : blocks_per_layer[0]) {
+            occupied_blocks.emplace(block->get_index(), block);
+        }
+    }
+    append<uint32_t>(snapshot, occupied_blocks.size());
+    for (const auto& [block_idx, block] : occupied_blocks) {
+        append<uint32_t>(snapshot, block_idx);
+        append<uint32_t>(snapshot, block->get_references_count());
+        append<uint8_t>(snapshot, block->is_hashed());
+    }
+
+    append<uint32_t>(snapshot, evicted_blocks.size());
+    for (const auto& [seq_id, logical_blocks_per_layer] : evicted_blocks) {
+        append<uint64_t>(snapshot, seq_id);
+        if (logical_blocks_per_layer.empty()) {
+            append<uint32_t>(snapshot, 0);
+            continue;
+        }
+        append<uint32_t>(snapshot, logical_blocks_per_layer[0].size());
+        for (size_t logical_block_idx : logical_blocks_per_layer[0]) {
+            append<uint32_t>(snapshot, logical_block_idx);
+        }
+    }
+    write_at<uint32_t>(snapshot, 0, snapshot.size() - sizeof(uint32_t));
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending_snapshots.push_back(std::move(snapshot));
+    }
+    m_num_dropped = 0;
+    m_cv.notify_one();
+}
+
+void CacheStateRecorder::write_loop() {
+    while (true) {
+        std::vector<uint8_t> snapshot;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] {
+                return m_is_stopped || !m_pending_snapshots.empty();
+            });
+            // the pending snapshots are written before stopping
+            if (m_pending_snapshots.empty()) {
+                break;
+            }
+            snapshot = std::move(m_pending_snapshots.front());
+            m_pending_snapshots.pop_front();
+        }
+        m_file.write(reinterpret_cast<const char*>(snapshot.data()), snapshot.size());
+    }
+    m_file.flush();
+}
+
+}  // namespace ov::genai
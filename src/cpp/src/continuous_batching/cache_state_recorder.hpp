@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "continuous_batching/block_manager.hpp"
+#include "continuous_batching/scheduler.hpp"
+#include "sequence_group.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Records the state of the KV cache at each generation step to a single binary file for the offline analysis of
+ * the cache efficiency on long runs, see `tools/cacheviz/cache_snapshots.py`. Unlike CacheStateDumper, which writes a
+ * text file per layer and step on the step thread, a snapshot is serialized to a buffer on the step thread and written
+ * to the file by a background thread. If the writer lags behind by max_pending_snapshots, the new snapshots are dropped
+ * and their number is stored in the next recorded snapshot.
+ * Recording is enabled by OV_GENAI_CACHE_STATE_FILE environment variable, the pipelines created after the first one
+ * append their index to the file name.
+ *
+ * The file starts with the magic "OVCS" and the u32 format version, followed by the snapshots in the native byte order:
+ *   u32 size of the snapshot after this field
+ *   u64 step, i64 microseconds since the creation of the recorder, u32 number of the dropped preceding snapshots
+ *   u32 block size, u32 total blocks, u32 free blocks, u32 free blocks kept in the prefix cache hash store,
+ *   u32 occupied blocks registered in the prefix cache
+ *   u32 number of the sequence groups, for each: u64 request id, u32 number of sequences,
+ *       for each sequence: u64 sequence id, u32 number of blocks, u32 block index per block
+ *   u32 number of the occupied blocks, for each: u32 block index, u32 reference count, u8 whether the block is hashed
+ *   u32 number of the sequences with evicted blocks, for each: u64 sequence id, u32 number of the evicted blocks,
+ *       u32 logical block index per evicted block
+ * The block tables and the evicted blocks are recorded for the first layer only, the layers share the block indices
+ * unless the cache eviction selects different blocks per layer.
+ */
+class CacheStateRecorder {
+public:
+    static constexpr char magic[4] = {'O', 'V', 'C', 'S'};
+    static constexpr uint32_t format_version = 1;
+    // number of the snapshots waiting for the writer, above which the new snapshots are dropped
+    static constexpr size_t max_pending_snapshots = 64;
+
+    explicit CacheStateRecorder(const std::filesystem::path& file_path);
+    ~CacheStateRecorder();
+
+    CacheStateRecorder(const CacheStateRecorder&) = delete;
+    CacheStateRecorder& operator=(const CacheStateRecorder&) = delete;
+
+    // Creates the recorder if OV_GENAI_CACHE_STATE_FILE is set, returns nullptr otherwise
+    static std::unique_ptr<CacheStateRecorder> create_from_env();
+
+    /**
+     * Records the snapshot of the current step.
+     * @param evicted_blocks The logical block indices per layer evicted at this step for each sequence id.
+     */
+    void record_step(const BlockManager& block_manager,
+                     const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                     const std::map<size_t, std::vector<std::set<size_t>>>& evicted_blocks = {});
+
+    void record_step(const Scheduler& scheduler,
+                     const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                     const std::map<size_t, std::vector<std::set<size_t>>>& evicted_blocks = {}) {
+        record_step(*scheduler.m_block_manager, sequence_groups, evicted_blocks);
+    }
+
+    // number of the snapshots dropped because the writer lagged behind
+    size_t get_num_dropped_snapshots() const {
+        return m_num_total_dropped;
+    }
+
+private:
+    void write_loop();
+
+    std::ofstream m_file;
+    std::chrono::steady_clock::time_point m_start_time = std::chrono::steady_clock::now();
+    uint64_t m_step = 0;
+    // dropped since the last pushed snapshot, and overall
+    uint32_t m_num_dropped = 0;
+    size_t m_num_total_dropped = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::vector<uint8_t>> m_pending_snapshots;
+    bool m_is_stopped = false;
+    std::thread m_writer;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * Tokenizes the templated chat history incrementally. The templated history of a turn usually starts with the templated
+ * history of the previous turn followed by the answer, so only the text after them is encoded and appended to their
+ * token ids. The answer keeps the token ids it was generated with, so that its KV cache blocks are reused as they are.
+ * The history is encoded as a whole, if the chat template has changed the previous text, e.g. stripped the answer.
+ */
+class ChatHistoryEncoder {
+public:
+    using EncodeFunction = std::function<std::vector<int64_t>(const std::string&)>;
+
+    /**
+     * @param encode Encodes the text without adding special tokens.
+     */
+    explicit ChatHistoryEncoder(EncodeFunction encode) : m_encode(std::move(encode)) {}
+
+    /**
+     * @return The token ids of the templated history, which ends with the generation prompt of the new turn.
+     */
+    std::vector<int64_t> encode(const std::string& templated_history) {
+        std::vector<int64_t> token_ids;
+        if (!m_templated_history.empty() && templated_history.compare(0, m_templated_history.size(), m_templated_history) == 0) {
+            token_ids = m_token_ids;
+        } else if (m_templated_prompt_len > 0 && templated_history.compare(0, m_templated_prompt_len, m_templated_history, 0, m_templated_prompt_len) == 0) {
+            // the answer has been changed by the chat template
+            m_templated_history.resize(m_templated_prompt_len);
+            token_ids.assign(m_token_ids.begin(), m_token_ids.begin() + m_num_prompt_tokens);
+        } else {
+            m_templated_history.clear();
+        }
+        if (templated_history.size() > m_templated_history.size()) {
+            std::vector<int64_t> new_token_ids = m_encode(templated_history.substr(m_templated_history.size()));
+            token_ids.insert(token_ids.end(), new_token_ids.begin(), new_token_ids.end());
+        }
+        m_templated_history = templated_history;
+        m_templated_prompt_len = templated_history.size();
+        m_token_ids = token_ids;
+        m_num_prompt_tokens = token_ids.size();
+        return token_ids;
+    }
+
+    /**
+     * Appends the answer of the last encoded history. The trailing stop tokens are dropped, since the chat template
+     * adds its own end of the message.
+     */
+    void add_answer(const std::string& answer, std::vector<int64_t> answer_token_ids, const std::set<int64_t>& stop_token_ids) {
+        while (!answer_token_ids.empty() && stop_token_ids.count(answer_token_ids.back())) {
+            answer_token_ids.pop_back();
+        }
+        m_templated_history.resize(m_templated_prompt_len);
+        m_templated_history += answer;
+        m_token_ids.resize(m_num_prompt_tokens);
+        m_token_ids.insert(m_token_ids.end(), answer_token_ids.begin(), answer_token_ids.end());
+    }
+
+    /**
+     * @return The token ids of the last encoded history and its answer, if added.
+     */
+    const std::vector<int64_t>& get_token_ids() const {
+        return m_token_ids;
+    }
+
+    void reset() {
+        m_templated_history.clear();
+        m_templated_prompt_len = 0;
+        m_token_ids.clear();
+        m_num_prompt_tokens = 0;
+    }
+
+private:
+    EncodeFunction m_encode;
+    // the templated history of the last turn followed by its answer, if added
+    std::string m_templated_history;
+    size_t m_templated_prompt_len = 0;
+    std::vector<int64_t> m_token_ids;
+    size_t m_num_prompt_tokens = 0;
+};
+
+}  // namespace ov::genai
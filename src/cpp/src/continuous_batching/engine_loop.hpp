@@ -0,0 +1,291 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/generation_handle.hpp"
+#include "continuous_batching/batched_text_streamer.hpp"
+#include "logger.hpp"
+
+namespace ov::genai {
+
+/**
+ * Background thread stepping the pipeline while it has non finished requests. The requests are added through the
+ * engine loop, which blocks the callers while the number of the non finished requests or the KV cache usage is above
+ * the limits of EngineLoopConfig, and notifies the completion callbacks of the requests on its thread. The new tokens
+ * of the streamed requests are passed to the text streamer once per step, the new outputs of the requests added without
+callbacks are passed to the step callback once per step, if it's set.
+ * @tparam Pipeline Type providing `step()`, `has_non_finished_requests()` and `get_metrics()`.
+ */
+template <typename Pipeline>
+class PipelineEngineLoop {
+public:
+    /**
+     * @param text_streamer Streams the text of the requests added with a text callback, may be null.
+     * @param on_step Called on the engine loop thread after each step with the new outputs of the requests added
+     * without callbacks, may be empty. The outputs of such requests are read by the engine loop then.
+     */
+    PipelineEngineLoop(std::shared_ptr<Pipeline> pipeline, const EngineLoopConfig& config, std::shared_ptr<BatchedTextStreamer> text_streamer = nullptr,
+                       EngineStepCallback on_step = {}) :
+            m_pipeline(std::move(pipeline)), m_config(config), m_text_streamer(std::move(text_streamer)), m_on_step(std::move(on_step)) {
+        OPENVINO_ASSERT(m_config.max_cache_usage > 0.0f, "max_cache_usage must be positive, got ", m_config.max_cache_usage);
+        m_thread = std::thread(&PipelineEngineLoop::run, this);
+    }
+
+    ~PipelineEngineLoop() {
+        try {
+            stop();
+        } catch (const std::exception& e) {
+            Logger::warn(std::string("Engine loop of the pipeline has been stopped by the exception: ") + e.what());
+        }
+    }
+
+    /**
+     * Adds the request with `add`, after waiting for the pipeline to have room for it.
+     * @param on_completion Called on the engine loop thread once the request has finished, may be empty. Called on the
+     * text streamer thread after the last text instead, if the request is streamed.
+     * @param on_text Called on the text streamer thread with the new text of the request, which is stopped or cancelled
+     * if the status returned is not RUNNING. The outputs of the streamed request are read by the engine loop.
+     */
+    GenerationHandle add_request(uint64_t request_id, const std::function<GenerationHandle()>& add, GenerationCompletionCallback on_completion,
+                                 std::function<StreamingStatus(const std::string&)> on_text = {}) {
+        OPENVINO_ASSERT(!on_text || m_text_streamer, "Engine loop of the pipeline has no text streamer");
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_admission_cv.wait(lock, [this] { return m_is_stopped || can_admit(); });
+            OPENVINO_ASSERT(!m_is_stopped, "Engine loop of the pipeline is stopped");
+            // the slot is reserved, so that the concurrent callers don't exceed the limits while the request is being added
+            ++m_num_admitted_requests;
+        }
+
+        GenerationHandle handle;
+        try {
+            handle = add();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_num_admitted_requests;
+            m_admission_cv.notify_all();
+            throw;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Request request{request_id, handle, std::move(on_completion)};
+            request.is_step_streamed = m_on_step && !request.on_completion && !on_text;
+            if (on_text) {
+                request.stream_id = m_next_stream_id++;
+                m_text_streamer->add_stream(*request.stream_id, [handle, on_text](const std::string& text) {
+                    const StreamingStatus status = on_text(text);
+                    if (status == StreamingStatus::STOP) {
+                        handle->stop();
+                    } else if (status == StreamingStatus::CANCEL) {
+                        handle->cancel();
+                    }
+                });
+            }
+            m_requests.push_back(std::move(request));
+        }
+        m_step_cv.notify_one();
+        return handle;
+    }
+
+    /**
+     * Stops the engine loop after the current step. The non finished requests stay in the pipeline.
+     * Rethrows the exception, which has stopped the engine loop, if any.
+     */
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_is_stopped = true;
+        }
+        m_step_cv.notify_all();
+        m_admission_cv.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        if (m_exception) {
+            std::exception_ptr exception = m_exception;
+            m_exception = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    struct Request {
+        uint64_t request_id;
+        GenerationHandle handle;
+        GenerationCompletionCallback on_completion;
+        // set if the request is streamed by the text streamer
+        std::optional<uint64_t> stream_id;
+        // set if the outputs of the request are passed to the step callback
+        bool is_step_streamed = false;
+    };
+
+    bool can_admit() const {
+        // a single request is always admitted, otherwise a request which doesn't fit the limits would never be
+        if (m_num_admitted_requests == 0) {
+            return true;
+        }
+        return (m_config.max_num_requests == 0 || m_num_admitted_requests < m_config.max_num_requests) &&
+               m_cache_usage < m_config.max_cache_usage;
+    }
+
+    void run() {
+        while (true) {
+            size_t num_tracked_requests = 0;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_step_cv.wait(lock, [this] { return m_is_stopped || !m_requests.empty(); });
+                if (m_is_stopped) {
+                    return;
+                }
+                num_tracked_requests = m_requests.size();
+            }
+
+            const bool has_non_finished_requests = m_pipeline->has_non_finished_requests();
+            if (has_non_finished_requests) {
+                try {
+                    m_pipeline->step();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_exception = std::current_exception();
+                    m_is_stopped = true;
+                    m_admission_cv.notify_all();
+                    return;
+                }
+            }
+            // the requests tracked before the check have all been finished, if the pipeline has no requests left
+            complete_requests(has_non_finished_requests ? 0 : num_tracked_requests);
+        }
+    }
+
+    // notifies the callbacks of the finished requests and releases their slots, the first `num_finished_requests`
+    // tracked requests are considered finished regardless of their status
+    void complete_requests(size_t num_finished_requests) {
+        std::vector<Request> completed_requests;
+        std::vector<BatchedTextStreamer::StreamTokens> new_tokens;
+        std::vector<EngineStepOutput> step_outputs;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cache_usage = m_pipeline->get_metrics().cache_usage;
+            std::vector<Request> running_requests;
+            for (size_t i = 0; i < m_requests.size(); ++i) {
+                Request& request = m_requests[i];
+                const bool is_finished = i < num_finished_requests || request.handle->get_status() != GenerationStatus::RUNNING;
+                if (request.stream_id) {
+                    BatchedTextStreamer::StreamTokens stream_tokens{*request.stream_id, read_new_tokens(request.handle)};
+                    if (is_finished) {
+                        // the completion is notified after the last text of the request
+                        stream_tokens.is_last = true;
+                        stream_tokens.on_end = [on_completion = std::move(request.on_completion), request_id = request.request_id, handle = request.handle] {
+                            if (on_completion) {
+                                on_completion(request_id, handle);
+                            }
+                        };
+                        // a moved-from std::function is not guaranteed to be empty, the streamer calls it instead
+                        request.on_completion = nullptr;
+                    }
+                    if (!stream_tokens.tokens.empty() || stream_tokens.is_last) {
+                        new_tokens.push_back(std::move(stream_tokens));
+                    }
+                } else if (request.is_step_streamed) {
+                    EngineStepOutput step_output{request.request_id, read_new_outputs(request.handle), request.handle->get_status()};
+                    if (is_finished && step_output.status == GenerationStatus::RUNNING) {
+                        step_output.status = GenerationStatus::FINISHED;
+                    }
+                    if (!step_output.outputs.empty() || is_finished) {
+                        step_outputs.push_back(std::move(step_output));
+                    }
+                }
+                (is_finished ? completed_requests : running_requests).push_back(std::move(request));
+            }
+            m_requests = std::move(running_requests);
+            m_num_admitted_requests -= completed_requests.size();
+        }
+        if (!completed_requests.empty()) {
+            m_admission_cv.notify_all();
+        }
+        if (!new_tokens.empty()) {
+            m_text_streamer->write(std::move(new_tokens));
+        }
+        if (!step_outputs.empty()) {
+            try {
+                m_on_step(step_outputs);
+            } catch (const std::exception& e) {
+                Logger::warn(std::string("Step callback of the engine loop has thrown: ") + e.what());
+            }
+        }
+
+        for (auto& request : completed_requests) {
+            if (!request.on_completion) {
+                continue;
+            }
+            try {
+                request.on_completion(request.request_id, request.handle);
+            } catch (const std::exception& e) {
+                Logger::warn("Completion callback of request " + std::to_string(request.request_id) + " has thrown: " + e.what());
+            }
+        }
+    }
+
+    static std::vector<int64_t> read_new_tokens(const GenerationHandle& handle) {
+        std::vector<int64_t> tokens;
+        while (handle->can_read()) {
+            for (const auto& [sequence_id, output] : handle->read()) {
+                tokens.insert(tokens.end(), output.generated_ids.begin(), output.generated_ids.end());
+            }
+        }
+        return tokens;
+    }
+
+    // the outputs read since the previous step, merged per sequence
+    static GenerationOutputs read_new_outputs(const GenerationHandle& handle) {
+        GenerationOutputs outputs;
+        while (handle->can_read()) {
+            for (auto& [sequence_id, output] : handle->read()) {
+                auto [it, is_new] = outputs.try_emplace(sequence_id, std::move(output));
+                if (!is_new) {
+                    GenerationOutput& merged = it->second;
+                    merged.generated_ids.insert(merged.generated_ids.end(), output.generated_ids.begin(), output.generated_ids.end());
+                    merged.generated_log_probs.insert(merged.generated_log_probs.end(), output.generated_log_probs.begin(), output.generated_log_probs.end());
+                    merged.score = output.score;
+                    merged.finish_reason = output.finish_reason;
+                }
+            }
+        }
+        return outputs;
+    }
+
+    std::shared_ptr<Pipeline> m_pipeline;
+    EngineLoopConfig m_config;
+    std::shared_ptr<BatchedTextStreamer> m_text_streamer;
+    EngineStepCallback m_on_step;
+
+    std::mutex m_mutex;
+    // notified when a request is added or the loop is stopped
+    std::condition_variable m_step_cv;
+    // notified when the requests are completed or the loop is stopped
+    std::condition_variable m_admission_cv;
+    bool m_is_stopped = false;
+    // the requests, which are being added or are tracked in m_requests
+    size_t m_num_admitted_requests = 0;
+    std::vector<Request> m_requests;
+    uint64_t m_next_stream_id = 0;
+    float m_cache_usage = 0.0f;
+    std::exception_ptr m_exception;
+
+    std::thread m_thread;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+
+namespace ov::genai {
+
+/**
+ * KV cache memory budget shared by the schedulers of several pipelines, e.g. of the main and draft models in speculative
+ * decoding. The schedulers grow their caches on demand from the common budget instead of getting a static share of it,
+ * so that the memory is taken by the pipeline which needs it.
+ */
+class KVCacheBudget {
+public:
+    explicit KVCacheBudget(size_t total_bytes) : m_total_bytes(total_bytes) {}
+
+    size_t get_total_bytes() const {
+        return m_total_bytes;
+    }
+
+    size_t get_allocated_bytes() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_allocated_bytes;
+    }
+
+    /**
+     * Takes as many blocks as possible, but not more than `num_blocks` from the budget.
+     * @return The number of taken blocks.
+     */
+    size_t allocate_blocks(size_t num_blocks, size_t block_size_in_bytes) {
+        if (block_size_in_bytes == 0)
+            return num_blocks;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t num_allocated_blocks = std::min(num_blocks, (m_total_bytes - m_allocated_bytes) / block_size_in_bytes);
+        m_allocated_bytes += num_allocated_blocks * block_size_in_bytes;
+        return num_allocated_blocks;
+    }
+
+    /**
+     * Returns the blocks taken by allocate_blocks to the budget, e.g. after the KV cache has been shrunk.
+     */
+    void release_blocks(size_t num_blocks, size_t block_size_in_bytes) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_allocated_bytes -= std::min(m_allocated_bytes, num_blocks * block_size_in_bytes);
+    }
+
+private:
+    const size_t m_total_bytes;
+    size_t m_allocated_bytes = 0;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,83 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/kv_cache_precision.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+// the bytes of the cache of a layer per token
+size_t get_size_per_token(ov::element::Type precision, size_t num_kv_heads, size_t head_size) {
+    const size_t head_size_in_bytes = (head_size * precision.bitwidth() + 7) / 8;
+    // a scale and a zero point of each head of the quantized layers
+    const size_t quantization_params_size = precision.is_integral() ? 2 * sizeof(float) : 0;
+    return num_kv_heads * (head_size_in_bytes + quantization_params_size);
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+KVCachePrecisionConfig calibrate_kv_cache_precisions(size_t num_decoder_layers,
+                                                     size_t num_kv_heads,
+                                                     size_t head_size,
+                                                     size_t num_tokens,
+                                                     size_t budget_in_bytes,
+                                                     size_t num_f16_layers) {
+    OPENVINO_ASSERT(num_decoder_layers > 0 && num_kv_heads > 0 && head_size > 0, "The model dimensions must be non-zero");
+    KVCachePrecisionConfig config;
+    config.key_precisions.assign(num_decoder_layers, ov::element::f16);
+    config.value_precisions.assign(num_decoder_layers, ov::element::f16);
+
+    auto get_cache_size = [&] {
+        size_t size_per_token = 0;
+        for (size_t layer_idx = 0; layer_idx < num_decoder_layers; ++layer_idx) {
+            size_per_token += get_size_per_token(config.key_precisions[layer_idx], num_kv_heads, head_size) +
+                              get_size_per_token(config.value_precisions[layer_idx], num_kv_heads, head_size);
+        }
+        return size_per_token * num_tokens;
+    };
+
+    // the layers which may be quantized, from the middle one outwards
+    std::vector<size_t> quantized_layers;
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; ++layer_idx) {
+        if (layer_idx >= num_f16_layers && layer_idx + num_f16_layers < num_decoder_layers) {
+            quantized_layers.push_back(layer_idx);
+        }
+    }
+    const double middle = (num_decoder_layers - 1) / 2.0;
+    std::stable_sort(quantized_layers.begin(), quantized_layers.end(), [&](size_t lhs, size_t rhs) {
+        return std::abs(lhs - middle) < std::abs(rhs - middle);
+    });
+
+    struct Step {
+        std::vector<ov::element::Type>& precisions;
+        ov::element::Type precision;
+    };
+    const std::vector<Step> steps = {
+        {config.value_precisions, ov::element::u8},
+        {config.key_precisions, ov::element::u8},
+        {config.value_precisions, ov::element::u4},
+    };
+    for (const Step& step : steps) {
+        for (size_t layer_idx : quantized_layers) {
+            if (get_cache_size() <= budget_in_bytes) {
+                return config;
+            }
+            step.precisions[layer_idx] = step.precision;
+            if (&step.precisions == &config.key_precisions) {
+                config.key_quantization_mode = KVCacheQuantizationMode::BY_CHANNEL;
+            }
+        }
+    }
+    const size_t cache_size = get_cache_size();
+    OPENVINO_ASSERT(cache_size <= budget_in_bytes, "The KV cache of ", num_tokens, " tokens takes at least ", cache_size,
+                    " bytes with ", num_f16_layers, " first and last layers in f16, which exceeds the budget of ", budget_in_bytes, " bytes");
+    return config;
+}
+
+}  // namespace ov::genai
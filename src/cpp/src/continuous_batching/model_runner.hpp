@@ -9,6 +9,7 @@
 
 #include <openvino/runtime/infer_request.hpp>
 
+#include "openvino/genai/lora_adapter.hpp"
 #include "visual_language/embedding_model.hpp"
 #include "sequence_group.hpp"
 #include "continuous_batching/scheduler.hpp"
@@ -30,6 +31,8 @@ inline std::string get_paged_attention_score_output_for_decoder_layer(size_t dec
  */
 class ModelRunner {
     ov::InferRequest m_request;
+    // start of the inference started by start_forward, for the tracing
+    std::chrono::steady_clock::time_point m_infer_start_time;
     AttentionScoresForEachSubsequence m_last_attention_scores;
     size_t m_block_size;
     size_t m_num_decoder_layers;
@@ -40,15 +43,35 @@ class ModelRunner {
     std::vector<std::map<size_t, std::vector<size_t>>> m_rotated_block_logical_indices_per_sequence_for_each_layer;
     std::vector<ov::Tensor> m_cache_rotation_deltas_for_each_layer;
     ov::Tensor m_cache_rotation_trig_lut;
+    // the rotation data is set only at the steps following the evictions, the inputs are emptied once after them
+    bool m_is_cache_rotation_data_pending = false;
+    bool m_are_cache_rotation_inputs_empty = false;
 
     bool m_is_aggregate_attention_scores;
 
     bool m_is_use_xattention_inputs;
+
+    // whether the model computes greedy sampling results itself, see utils::apply_device_greedy_sampling_transformation
+    bool m_is_device_greedy_sampling_available = false;
+    // whether the model gathers the hidden states of the sampled tokens before the LM head, see utils::apply_gather_before_matmul_transformation
+    bool m_is_matmul_gathering_available = false;
+    // whether the model looks up the embeddings of the "input_ids" of the generated tokens, see utils::apply_embeddings_lookup_transformation
+    bool m_is_embeddings_lookup_in_model = false;
+
+    // host buffers backing the input tensors, which are grown on demand and reused across `forward` calls
+    // to avoid allocating the input tensors anew at each generation step
+    std::map<std::string, ov::Tensor> m_input_buffers;
+
     // A model to compute token embeddings.
     // Input shape: [N, conversation length].
     // Output shape: [1, conversation length, hidden_size].
     EmbeddingsModel::Ptr m_embedding;
 
+    // applies the adapters of each sequence group to its tokens, see `set_adapters_per_request`
+    std::optional<AdapterController> m_adapter_controller;
+    std::vector<AdapterConfig> m_row_adapters;
+    std::vector<size_t> m_num_rows_per_adapters;
+
 public:
     /**
      * Constructs the ModelRunner.
@@ -86,6 +109,16 @@ public:
           m_is_use_xattention_inputs(is_use_xattention_inputs) {
         OPENVINO_ASSERT(m_num_decoder_layers != 0, "num_decoder_layers must be non-zero");
         _reset_cache_rotation_coefficients();
+        for (const auto& output : m_request.get_compiled_model().outputs()) {
+            m_is_device_greedy_sampling_available |= output.get_names().count("sampled_token_ids") > 0;
+        }
+        bool has_input_ids = false, has_inputs_embeds = false;
+        for (const auto& input : m_request.get_compiled_model().inputs()) {
+            m_is_matmul_gathering_available |= input.get_names().count("sampled_tokens_indices") > 0;
+            has_input_ids |= input.get_names().count("input_ids") > 0;
+            has_inputs_embeds |= input.get_names().count("inputs_embeds") > 0;
+        }
+        m_is_embeddings_lookup_in_model = has_input_ids && has_inputs_embeds;
     }
 
     /**
@@ -95,10 +128,30 @@ public:
         return m_request;
     }
 
+    /**
+     * @return The total size in bytes of the host buffers backing the model inputs.
+     */
+    size_t get_input_buffers_byte_size() const {
+        size_t byte_size = 0;
+        for (const auto& [name, buffer] : m_input_buffers) {
+            byte_size += buffer.get_byte_size();
+        }
+        return byte_size;
+    }
+
     void set_embedding_model(const EmbeddingsModel::Ptr& embedder) {
         m_embedding = embedder;
     }
 
+    /**
+     * Makes each `forward` call apply the LoRA adapters of the sampling parameters of each scheduled sequence group to its tokens,
+     * so that the requests with different adapters share the batch. The batch dimension of the model enumerates the tokens,
+     * so alpha of the adapters is set per token. Requires AdapterConfig::MODE_POOL.
+     */
+    void set_adapters_per_request(const AdapterController& adapter_controller) {
+        m_adapter_controller = adapter_controller;
+    }
+
     /**
      * @return A map of sequence IDs to vectors of ov::Tensor per-token attention scores. Each vector element is associated with its own
      * decoder layer, in order of their execution in the model. Each ov::Tensor has a shape of {N_k}, where N_k is the length of
@@ -108,17 +161,49 @@ public:
         return m_last_attention_scores;
     }
 
+    /**
+     * @return Whether the model selects the greedy next tokens itself, so that the host may read
+     * `get_device_sampled_token_ids` and `get_device_sampled_token_log_probs` instead of the full logits.
+     */
+    bool is_device_greedy_sampling_available() const {
+        return m_is_device_greedy_sampling_available;
+    }
 
+    /**
+     * @return An ov::Tensor with the ID of the most probable next token for each sequence processed during the previous `forward` call,
+     * in the same layout as the logits, with the vocabulary dimension of size 1.
+     */
+    ov::Tensor get_device_sampled_token_ids() {
+        OPENVINO_ASSERT(m_is_device_greedy_sampling_available, "Device greedy sampling is not enabled for the model");
+        return m_request.get_tensor("sampled_token_ids");
+    }
+
+    /**
+     * @return An ov::Tensor with the log probabilities of the tokens returned by `get_device_sampled_token_ids`.
+     */
+    ov::Tensor get_device_sampled_token_log_probs() {
+        OPENVINO_ASSERT(m_is_device_greedy_sampling_available, "Device greedy sampling is not enabled for the model");
+        return m_request.get_tensor("sampled_token_log_probs");
+    }
+
+
+    // the LUT doesn't change, so it's set to the model once
     void set_cache_rotation_trig_lut(ov::Tensor&& rotation_trig_lut) {
         m_cache_rotation_trig_lut = std::move(rotation_trig_lut);
+        m_request.set_tensor("rotation_trig_lut", m_cache_rotation_trig_lut);
     }
 
+    /**
+     * Sets the blocks to be rotated by the next `forward` call, i.e. the ones following the blocks evicted at the previous step.
+     * The next `forward` calls without the new rotation data rotate no blocks, so the data is set only after the evictions.
+     */
     void set_cache_rotation_data(std::vector<std::map<size_t, std::vector<size_t>>>&&
                                      rotated_logical_block_indices_per_sequence_for_each_layer,
                                  std::vector<ov::Tensor>&& rotation_deltas_for_each_layer) {
         m_rotated_block_logical_indices_per_sequence_for_each_layer =
             std::move(rotated_logical_block_indices_per_sequence_for_each_layer);
         m_cache_rotation_deltas_for_each_layer = std::move(rotation_deltas_for_each_layer);
+        m_is_cache_rotation_data_pending = true;
     }
 
     /**
@@ -129,6 +214,19 @@ public:
      * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
      */
     ov::Tensor forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        start_forward(sequence_groups, scheduler_output);
+        return finish_forward(sequence_groups, scheduler_output);
+    }
+
+    /**
+     * Prepares the model inputs in the same way as `forward` does and starts the inference asynchronously, so that the caller
+     * can perform CPU-side work independent of the inference results while the model is being inferred.
+     * Has to be followed by a `finish_forward` call with the same arguments before the model inputs or the sequence groups are modified.
+     * @param sequence_groups A vector of pointers to sequence groups to be processed during this `forward` call
+     * @param scheduler_output The scheduler output struct with information on the specifics of the token scheduling during this forward call
+     */
+    void start_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        GENAI_TRACE_SCOPE("model_runner: prepare inputs", static_cast<int64_t>(scheduler_output.m_total_num_scheduled_tokens));
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
 
         size_t batch_size_in_sequences = 0;
@@ -153,19 +251,30 @@ public:
             max_context_len_val = std::max(max_context_len_val, sequence_group->get_context_len());
         }
 
+        ov::Tensor input_ids, inputs_embeds, token_type_ids;
+        if (sequence_group_type == SequenceGroupType::EMBEDDINGS) {
+            inputs_embeds = _get_input_tensor("inputs_embeds", ov::element::f32, {total_num_tokens, hidden_size});
+            token_type_ids = _get_input_tensor("token_type_ids", ov::element::i64, {1, total_num_tokens});
+            if (m_is_embeddings_lookup_in_model) {
+                input_ids = _get_input_tensor("input_ids", ov::element::i64, {total_num_tokens});
+            }
+        } else if (sequence_group_type == SequenceGroupType::TOKENS) {
+            input_ids = _get_input_tensor("input_ids", ov::element::i64, {total_num_tokens});
+        }
+
         ov::Tensor
-            input_ids(ov::element::i64, {total_num_tokens}),
-            inputs_embeds(ov::element::f32, {total_num_tokens, hidden_size}),
-            token_type_ids(ov::element::i64, {1, total_num_tokens}),
-            position_ids(ov::element::i64, {total_num_tokens}),
+            position_ids = _get_input_tensor("position_ids", ov::element::i64, {total_num_tokens}),
             // PA specific parameters
-            past_lens(ov::element::i32, {batch_size_in_sequences}),
-            subsequence_begins(ov::element::i32, {batch_size_in_sequences + 1}),
+            past_lens = _get_input_tensor("past_lens", ov::element::i32, {batch_size_in_sequences}),
+            subsequence_begins = _get_input_tensor("subsequence_begins", ov::element::i32, {batch_size_in_sequences + 1}),
             // block_indices are handled in a special fashion below
-            block_indices_begins(ov::element::i32, {batch_size_in_sequences + 1}),
-            max_context_len(ov::element::i32, {});
+            block_indices_begins = _get_input_tensor("block_indices_begins", ov::element::i32, {batch_size_in_sequences + 1}),
+            max_context_len = _get_input_tensor("max_context_len", ov::element::i32, {});
 
-        ov::Tensor score_aggregation_window(ov::element::i32, {batch_size_in_sequences});
+        ov::Tensor score_aggregation_window;
+        if (m_is_aggregate_attention_scores) {
+            score_aggregation_window = _get_input_tensor("score_aggregation_window", ov::element::i32, {batch_size_in_sequences});
+        }
 
         ov::Tensor generated_ids_embeds;
         float *generated_ids_embeds_data = nullptr;
@@ -180,6 +289,9 @@ public:
         if (sequence_group_type == SequenceGroupType::EMBEDDINGS) {
             inputs_embeds_data = inputs_embeds.data<float>();
             token_type_ids_data = token_type_ids.data<int64_t>();
+            if (m_is_embeddings_lookup_in_model) {
+                input_ids_data = input_ids.data<int64_t>();
+            }
         } else if (sequence_group_type == SequenceGroupType::TOKENS) {
             input_ids_data = input_ids.data<int64_t>();
         }
@@ -191,19 +303,22 @@ public:
             * past_lens_data = past_lens.data<int32_t>(),
             * subsequence_begins_data = subsequence_begins.data<int32_t>(),
             * block_indices_begins_data = block_indices_begins.data<int32_t>(),
-            * score_aggregation_window_data = score_aggregation_window.data<int32_t>();
+            * score_aggregation_window_data = m_is_aggregate_attention_scores ? score_aggregation_window.data<int32_t>() : nullptr;
 
         // sub-sequence data starts with 0
         subsequence_begins_data[0] = 0;
         block_indices_begins_data[0] = 0;
 
-        bool matmul_gathering_is_available = false;
+        const bool matmul_gathering_is_available = m_is_matmul_gathering_available;
         size_t gathering_current_index = 0;
-        std::vector<int64_t> gather_indices_values;
-        try {
-            std::ignore = m_request.get_tensor("sampled_tokens_indices");
-            matmul_gathering_is_available = true;
-        } catch (const ov::Exception&) {}
+        // the indices are written to the reused buffer directly, at most one per scheduled token
+        ov::Tensor gather_indices;
+        int64_t* gather_indices_data = nullptr;
+        size_t num_gathered_tokens = 0;
+        if (matmul_gathering_is_available) {
+            gather_indices = _get_input_tensor("sampled_tokens_indices", ov::element::i64, {total_num_tokens});
+            gather_indices_data = gather_indices.data<int64_t>();
+        }
 
         std::map<size_t, std::set<size_t>> seq_id_to_skipped_blocks_map;
 
@@ -215,6 +330,8 @@ public:
             size_t num_scheduled_tokens = sequence_group->get_num_scheduled_tokens();
             size_t group_position_id = sequence_group->get_num_processed_tokens();
             size_t prompt_len = sequence_group->get_prompt_len();
+            const float* prompt_embeds_data = sequence_group_type == SequenceGroupType::EMBEDDINGS ?
+                sequence_group->get_input_embeds().data<const float>() : nullptr;
 
             // Next variables are only for sliced matmul case
             size_t output_seq_len = 0;
@@ -242,9 +359,17 @@ public:
                         input_ids_data[token_id] = position_id < prompt_len ?
                             sequence_group->get_prompt_ids()[position_id] :
                             sequence->get_generated_ids()[position_id - prompt_len];
+                    } else if (sequence_group_type == SequenceGroupType::EMBEDDINGS && m_is_embeddings_lookup_in_model) {
+                        // the prompt embeddings are passed, while the ones of the generated tokens are looked up by the model
+                        if (position_id < prompt_len) {
+                            input_ids_data[token_id] = -1;
+                            std::copy_n(prompt_embeds_data + position_id * hidden_size, hidden_size, inputs_embeds_data + token_id * hidden_size);
+                        } else {
+                            input_ids_data[token_id] = sequence->get_generated_ids()[position_id - prompt_len];
+                        }
                     } else if (sequence_group_type == SequenceGroupType::EMBEDDINGS) {
                         const auto& generated_embeds = sequence->get_generated_ids_embeds();
-                        const float* src = position_id < prompt_len ? sequence_group->get_input_embeds()[position_id].data() :  generated_embeds[position_id - prompt_len].data();
+                        const float* src = position_id < prompt_len ? prompt_embeds_data + position_id * hidden_size : generated_embeds[position_id - prompt_len].data();
                         std::copy_n(src, hidden_size, inputs_embeds_data + token_id * hidden_size);
                     } else {
                         OPENVINO_THROW("Unknown model inputs type.");
@@ -261,7 +386,7 @@ public:
                             // Gather only the last scheduled token or 1 + num_tokens_to_validate tokens for SD
                             // In SD, tokens_to_sample_per_sequence may exceed num_scheduled_tokens
                             token_id + tokens_to_sample_per_sequence >= num_scheduled_tokens) {
-                            gather_indices_values.push_back(gathering_current_index);
+                            gather_indices_data[num_gathered_tokens++] = gathering_current_index;
                             output_seq_len++;
                         }
                     }
@@ -295,6 +420,8 @@ public:
                     inputs_embeds_data += num_scheduled_tokens * hidden_size;
                     if (have_token_type_ids)
                         token_type_ids_data += num_scheduled_tokens;
+                    if (m_is_embeddings_lookup_in_model)
+                        input_ids_data += num_scheduled_tokens;
                 }
 
 
@@ -315,9 +442,21 @@ public:
                 past_lens_data += 1;
                 subsequence_begins_data += 1;
                 block_indices_begins_data += 1;
-                score_aggregation_window_data += 1;
+                if (m_is_aggregate_attention_scores)
+                    score_aggregation_window_data += 1;
             }
             sequence_group->set_output_seq_len(matmul_gathering_is_available ? output_seq_len : num_scheduled_tokens);
+
+            if (m_adapter_controller) {
+                m_row_adapters.push_back(sequence_group->get_sampling_parameters().adapters.value_or(AdapterConfig{}));
+                m_num_rows_per_adapters.push_back(num_scheduled_tokens * num_running_sequences);
+            }
+        }
+
+        if (m_adapter_controller) {
+            m_adapter_controller->apply_per_row(m_request, m_row_adapters, m_num_rows_per_adapters);
+            m_row_adapters.clear();
+            m_num_rows_per_adapters.clear();
         }
 
         if (sequence_group_type == SequenceGroupType::TOKENS) {
@@ -325,6 +464,9 @@ public:
         }
         else if (sequence_group_type == SequenceGroupType::EMBEDDINGS) {
             m_request.set_tensor("inputs_embeds", inputs_embeds);
+            if (m_is_embeddings_lookup_in_model) {
+                m_request.set_tensor("input_ids", input_ids);
+            }
             if (have_token_type_ids) {
                 m_request.set_tensor("token_type_ids", token_type_ids);
             }
@@ -342,7 +484,6 @@ public:
         m_request.set_tensor("max_context_len", max_context_len);
 
         if (m_is_use_rotation_inputs) {
-            m_request.set_tensor("rotation_trig_lut", m_cache_rotation_trig_lut);
             _set_cache_rotation_coefficients(sequence_groups, scheduler_output);
         }
 
@@ -351,20 +492,38 @@ public:
         }
 
         if (matmul_gathering_is_available) {
-            ov::Tensor gather_indices(ov::element::i64, {gather_indices_values.size()});
-            std::memcpy(gather_indices.data(), gather_indices_values.data(), gather_indices_values.size() * sizeof(int64_t));
-            m_request.set_tensor("sampled_tokens_indices", gather_indices);
+            // no indices for the steps of the intermediate prompt chunks only, which makes the LM head empty,
+            // so the vocabulary projection is computed for none of the tokens of such steps
+            m_request.set_tensor("sampled_tokens_indices", ov::Tensor(ov::element::i64, {num_gathered_tokens}, gather_indices_data));
         }
 
         if (m_is_aggregate_attention_scores) {
             m_request.set_tensor("score_aggregation_window", score_aggregation_window);
         }
 
+        m_infer_start_time = std::chrono::steady_clock::now();
+        m_request.start_async();
+    }
+
+    /**
+     * Waits for the inference started by `start_forward` to complete.
+     * @param sequence_groups A vector of pointers to sequence groups passed to `start_forward`
+     * @param scheduler_output The scheduler output struct passed to `start_forward`
+     * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
+     */
+    ov::Tensor finish_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         {
             static ManualTimer timer("pure generate inference");
             timer.start();
-            m_request.infer();
+            m_request.wait();
             timer.end();
+#ifdef ENABLE_TRACING
+            if (Tracer::instance().is_enabled()) {
+                // the span of the asynchronous inference, which overlaps the work done between start_forward and finish_forward
+                Tracer::instance().record("model_runner: infer", m_infer_start_time, timer.get_end_time(),
+                                          static_cast<int64_t>(scheduler_output.m_total_num_scheduled_tokens));
+            }
+#endif
         }
 
         if (m_collect_attention_scores) {
@@ -378,6 +537,10 @@ public:
     }
 
     void append_embeddings(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        if (m_is_embeddings_lookup_in_model) {
+            // the model takes the ids of the generated tokens instead of their embeddings
+            return;
+        }
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
         size_t num_generated_ids_without_embeddings = 0;
         OPENVINO_ASSERT(sequence_groups.size() > 0);
@@ -421,7 +584,6 @@ public:
                 size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
                 SequenceGroup::Ptr sequence_group = sequence_groups[seq_group_id];
                 for (auto seq: sequence_group->get_running_sequences()) {
-                    auto generated_ids = seq->get_generated_ids();
                     size_t new_embeds_count = seq->get_generated_len() - seq->get_generated_ids_embeds().size();
                     ov::Coordinate start{0, embeds_pos, 0};
                     ov::Coordinate end{1, embeds_pos + new_embeds_count, hidden_size};
@@ -434,6 +596,22 @@ public:
     }
 
 private:
+    /**
+     * Returns a tensor of a given shape backed by the reusable host buffer associated with a given input name. The buffer is
+     * reallocated only if it is too small to hold the tensor, so the contents of the previously returned tensor for the same
+     * name are invalidated by this call.
+     */
+    ov::Tensor _get_input_tensor(const std::string& name, ov::element::Type type, const ov::Shape& shape) {
+        size_t size = std::max<size_t>(ov::shape_size(shape), 1);
+        ov::Tensor& buffer = m_input_buffers[name];
+        if (!buffer || buffer.get_element_type() != type || buffer.get_size() < size) {
+            // grow geometrically to amortize reallocations while the batch grows
+            size_t capacity = buffer && buffer.get_element_type() == type ? std::max(size, buffer.get_size() * 2) : size;
+            buffer = ov::Tensor(type, {capacity});
+        }
+        return ov::Tensor(type, shape, buffer.data());
+    }
+
     // Fills indices for sequences in the order defined by scheduler_output
     void _fill_indices_from_block_tables(
         const std::vector<std::string>& dst_tensor_names,
@@ -556,6 +734,16 @@ private:
 
         std::vector<size_t> num_blocks_per_layer(num_layers);
 
+        if (seq_id_to_skipped_blocks_map.empty()) {
+            // all logical blocks of all sequences are used, so the block indices can be copied from block tables directly,
+            // without building per-sequence selections of logical blocks
+            for (size_t i = 0; i < num_layers; i++) {
+                m_request.get_tensor(tensor_names[i]).set_shape({total_num_blocks});
+            }
+            _fill_indices_from_block_tables(tensor_names, sequence_groups, scheduler_output, {});
+            return;
+        }
+
         std::vector<std::map<size_t, std::vector<size_t>>> seq_id_to_select_logical_idx_map(m_num_decoder_layers);
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
         for (size_t layer_idx = 0; layer_idx < num_layers; layer_idx++) {
@@ -602,6 +790,20 @@ private:
 
     void _set_cache_rotation_coefficients(const std::vector<SequenceGroup::Ptr>& sequence_groups,
                                           const Scheduler::Output& scheduler_output) {
+        if (!m_is_cache_rotation_data_pending) {
+            // no blocks were evicted at the previous step, the inputs stay empty
+            if (!m_are_cache_rotation_inputs_empty) {
+                for (size_t i = 0; i < m_num_decoder_layers; i++) {
+                    m_request.get_tensor(std::string("rotated_block_indices.") + std::to_string(i)).set_shape({0});
+                    m_request.set_tensor(std::string("rotation_deltas.") + std::to_string(i), ov::Tensor(ov::element::i32, {0, 1}));
+                }
+                m_are_cache_rotation_inputs_empty = true;
+            }
+            return;
+        }
+        m_is_cache_rotation_data_pending = false;
+        m_are_cache_rotation_inputs_empty = false;
+
         std::vector<std::string> rotation_indices_tensor_names(m_num_decoder_layers);
         for (size_t i = 0; i < m_num_decoder_layers; i++) {
             auto tensor_name = std::string("rotated_block_indices.") + std::to_string(i);
@@ -694,14 +896,14 @@ private:
     void _set_xattention_tensors(const std::vector<SequenceGroup::Ptr>& sequence_groups,
                                  const Scheduler::Output& scheduler_output,
                                  size_t batch_size_in_sequences) {
-        ov::Tensor xattention_block_size(ov::element::i32, {});
-        ov::Tensor xattention_stride(ov::element::i32, {});
+        ov::Tensor xattention_block_size = _get_input_tensor("xattention_block_size", ov::element::i32, {});
+        ov::Tensor xattention_stride = _get_input_tensor("xattention_stride", ov::element::i32, {});
         xattention_block_size.data<int32_t>()[0] = scheduler_output.m_xattention_block_size;
         xattention_stride.data<int32_t>()[0] = scheduler_output.m_xattention_stride;
         m_request.set_tensor("xattention_block_size", xattention_block_size);
         m_request.set_tensor("xattention_stride", xattention_stride);
 
-        ov::Tensor xattention_thresholds(ov::element::f32, {batch_size_in_sequences});
+        ov::Tensor xattention_thresholds = _get_input_tensor("xattention_threshold", ov::element::f32, {batch_size_in_sequences});
         float* xattention_threshold_data = xattention_thresholds.data<float>();
         for (size_t i = 0; i < scheduler_output.m_scheduled_sequence_groups_ids.size(); i++) {
             size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
@@ -0,0 +1,131 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/numa.hpp"
+
+#ifdef __linux__
+#    include <sched.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+#ifdef __linux__
+// see linux/mempolicy.h, which isn't available without the kernel headers
+constexpr int MPOL_PREFERRED_MODE = 1;
+constexpr unsigned MPOL_MF_MOVE_FLAG = 1 << 1;
+constexpr size_t MAX_NUMA_NODES = 1024;
+
+std::vector<size_t> get_thread_cpus() {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    OPENVINO_ASSERT(sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0, "Failed to get the CPU affinity of the thread");
+    std::vector<size_t> cpus;
+    for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpu_set)) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+void set_thread_cpus(const std::vector<size_t>& cpus) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (size_t cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    OPENVINO_ASSERT(sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0, "Failed to set the CPU affinity of the thread");
+}
+#endif
+
+}  // namespace
+
+namespace ov::genai {
+
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list) {
+    std::vector<size_t> cpus;
+    std::stringstream stream(cpu_list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.find_first_not_of(" \n") == std::string::npos) {
+            continue;
+        }
+        const size_t dash = range.find('-');
+        try {
+            const size_t first = std::stoul(range.substr(0, dash));
+            const size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+            OPENVINO_ASSERT(first <= last, "Invalid CPU range '", range, "'");
+            for (size_t cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::logic_error&) {
+            OPENVINO_THROW("Invalid CPU list '", cpu_list, "'");
+        }
+    }
+    return cpus;
+}
+
+std::vector<size_t> get_numa_node_cpus(size_t numa_node) {
+#ifdef __linux__
+    std::ifstream cpu_list_file("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+    std::string cpu_list;
+    if (!std::getline(cpu_list_file, cpu_list)) {
+        return {};
+    }
+    return parse_cpu_list(cpu_list);
+#else
+    return {};
+#endif
+}
+
+bool bind_memory_to_numa_node(void* data, size_t size_in_bytes, size_t numa_node) {
+#ifdef __linux__
+    if (data == nullptr || size_in_bytes == 0 || numa_node >= MAX_NUMA_NODES) {
+        return false;
+    }
+    // the range has to start at a page boundary
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(data) / page_size * page_size;
+    const size_t size = reinterpret_cast<uintptr_t>(data) + size_in_bytes - begin;
+
+    constexpr size_t bits_per_word = sizeof(unsigned long) * 8;
+    unsigned long node_mask[MAX_NUMA_NODES / bits_per_word] = {};
+    node_mask[numa_node / bits_per_word] = 1UL << (numa_node % bits_per_word);
+    return syscall(SYS_mbind, begin, size, MPOL_PREFERRED_MODE, node_mask, MAX_NUMA_NODES, MPOL_MF_MOVE_FLAG) == 0;
+#else
+    return false;
+#endif
+}
+
+ScopedNumaAffinity::ScopedNumaAffinity(size_t numa_node) {
+#ifdef __linux__
+    const std::vector<size_t> cpus = get_numa_node_cpus(numa_node);
+    OPENVINO_ASSERT(!cpus.empty(), "NUMA node ", numa_node, " is not available");
+    m_previous_cpus = get_thread_cpus();
+    set_thread_cpus(cpus);
+#else
+    OPENVINO_THROW("NUMA affinity is only supported on Linux");
+#endif
+}
+
+ScopedNumaAffinity::~ScopedNumaAffinity() {
+#ifdef __linux__
+    try {
+        set_thread_cpus(m_previous_cpus);
+    } catch (const std::exception&) {
+        // the thread keeps running on the NUMA node
+    }
+#endif
+}
+
+}  // namespace ov::genai
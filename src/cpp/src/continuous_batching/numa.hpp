@@ -0,0 +1,46 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @param cpu_list The list of CPUs in the format of /sys/devices/system/node/node<N>/cpulist, e.g. "0-3,8,10-11".
+ * @return The ids of the listed CPUs.
+ */
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list);
+
+/**
+ * @return The ids of the CPUs of the NUMA node, empty if there is no such node or NUMA is not supported on the platform.
+ */
+std::vector<size_t> get_numa_node_cpus(size_t numa_node);
+
+/**
+ * Makes the NUMA node the preferred one for the physical memory of an address range, the pages already backed by
+ * the memory of the other nodes are moved there. Best effort, e.g. the policy may not be permitted in a container.
+ * @return Whether the policy has been applied, always false if NUMA is not supported on the platform.
+ */
+bool bind_memory_to_numa_node(void* data, size_t size_in_bytes, size_t numa_node);
+
+/**
+ * @brief Restricts the current thread to the CPUs of a NUMA node for the lifetime of the object, so that the threads
+ * started meanwhile, e.g. by the sampler or by an inference plugin, inherit the affinity. The previous affinity of
+ * the thread is restored on destruction.
+ */
+class ScopedNumaAffinity {
+    std::vector<size_t> m_previous_cpus;
+
+public:
+    explicit ScopedNumaAffinity(size_t numa_node);
+    ~ScopedNumaAffinity();
+
+    ScopedNumaAffinity(const ScopedNumaAffinity&) = delete;
+    ScopedNumaAffinity& operator=(const ScopedNumaAffinity&) = delete;
+};
+
+}  // namespace ov::genai
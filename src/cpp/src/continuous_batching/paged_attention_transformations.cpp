@@ -3,6 +3,12 @@
 
 #include "continuous_batching/paged_attention_transformations.hpp"
 
+#include <algorithm>
+#include <map>
+#include <unordered_set>
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/sdpa_to_paged_attention.hpp"
 
@@ -10,6 +16,41 @@ namespace ov {
 namespace genai {
 namespace utils {
 
+namespace {
+
+// the nodes computed from the outputs of `node`
+std::unordered_set<ov::Node*> get_descendants(const std::vector<std::shared_ptr<ov::Node>>& ordered_ops, const ov::Node* node) {
+    std::unordered_set<ov::Node*> descendants;
+    for (const auto& op : ordered_ops) {
+        for (const auto& input : op->input_values()) {
+            if (input.get_node() == node || descendants.count(input.get_node())) {
+                descendants.insert(op.get());
+                break;
+            }
+        }
+    }
+    return descendants;
+}
+
+// the nodes `node` is computed from, except for the ones it is computed from only through `excluded`
+std::unordered_set<ov::Node*> get_ancestors(ov::Node* node, const ov::Node* excluded = nullptr) {
+    std::unordered_set<ov::Node*> ancestors;
+    std::vector<ov::Node*> nodes_to_visit = {node};
+    while (!nodes_to_visit.empty()) {
+        ov::Node* current = nodes_to_visit.back();
+        nodes_to_visit.pop_back();
+        for (const auto& input : current->input_values()) {
+            ov::Node* input_node = input.get_node();
+            if (input_node != excluded && ancestors.insert(input_node).second) {
+                nodes_to_visit.push_back(input_node);
+            }
+        }
+    }
+    return ancestors;
+}
+
+}  // namespace
+
 void apply_paged_attention_transformations(std::shared_ptr<ov::Model> model, bool per_layer_cache_control, bool allow_cache_rotation, bool allow_xattention) {
     const ov::op::util::VariableVector& variables = model->get_variables();
     OPENVINO_ASSERT(!variables.empty(), "Model is supposed to be stateful");
@@ -63,6 +104,145 @@ void apply_paged_attention_transformations(std::shared_ptr<ov::Model> model, boo
     model->validate_nodes_and_infer_types();
 }
 
+void apply_kv_cache_precisions(std::shared_ptr<ov::Model> model, const KVCachePrecisionConfig& config) {
+    if (config.key_precisions.empty() && config.value_precisions.empty()) {
+        return;
+    }
+    size_t num_decoder_layers = 0;
+    for (const auto& param_ptr : model->get_parameters()) {
+        const auto& name = param_ptr->get_friendly_name();
+        const bool is_key = name.find("key_cache.") == 0;
+        if (!is_key && name.find("value_cache.") != 0) {
+            continue;
+        }
+        num_decoder_layers += is_key;
+        const size_t layer_idx = std::stoul(name.substr(name.find('.') + 1));
+        const auto& precisions = is_key ? config.key_precisions : config.value_precisions;
+        if (layer_idx < precisions.size() && precisions[layer_idx] != ov::element::dynamic) {
+            param_ptr->set_element_type(precisions[layer_idx]);
+        }
+    }
+    OPENVINO_ASSERT(config.key_precisions.size() <= num_decoder_layers && config.value_precisions.size() <= num_decoder_layers,
+                    "KV cache precisions are set for more layers than the ", num_decoder_layers, " decoder layers of the model");
+    model->validate_nodes_and_infer_types();
+}
+
+void apply_layer_skip_transformation(std::shared_ptr<ov::Model> model, size_t num_layers) {
+    std::map<size_t, ov::Node*> pa_ops;
+    for (const auto& param_ptr : model->get_parameters()) {
+        const auto& name = param_ptr->get_friendly_name();
+        if (name.find("key_cache.") == 0) {
+            pa_ops[std::stoul(name.substr(name.find('.') + 1))] = param_ptr->get_output_target_inputs(0).begin()->get_node();
+        }
+    }
+    const size_t num_decoder_layers = pa_ops.size();
+    OPENVINO_ASSERT(num_layers > 0 && num_layers < num_decoder_layers, "The number of the kept decoder layers must be positive and less than the ",
+                    num_decoder_layers, " decoder layers of the model, got ", num_layers);
+
+    const auto ordered_ops = model->get_ordered_ops();
+    ov::Node* logits = model->output("logits").get_node();
+
+    // the input of the first skipped layer is the latest residual sum of the previous layer, which the skipped layer
+    // attends from and also adds its output to
+    ov::Node* first_skipped_pa = pa_ops.at(num_layers);
+    const auto computed_by_last_kept_layer = get_descendants(ordered_ops, pa_ops.at(num_layers - 1));
+    const auto first_skipped_layer_inputs = get_ancestors(first_skipped_pa);
+    const auto passed_around_first_skipped_layer = get_ancestors(logits, first_skipped_pa);
+    std::shared_ptr<ov::Node> kept_hidden_states;
+    for (const auto& op : ordered_ops) {
+        if (ov::is_type<ov::op::v1::Add>(op) && computed_by_last_kept_layer.count(op.get()) &&
+            first_skipped_layer_inputs.count(op.get()) && passed_around_first_skipped_layer.count(op.get())) {
+            kept_hidden_states = op;
+        }
+    }
+    OPENVINO_ASSERT(kept_hidden_states, "The hidden states at the input of decoder layer ", num_layers, " are not found");
+
+    // the input of the final norm is the latest residual sum of the last layer, which adds the other sums of the layer,
+    // while the sums of the norm, e.g. the bias of LayerNorm, add the normalized states
+    const auto computed_by_last_layer = get_descendants(ordered_ops, pa_ops.rbegin()->second);
+    const auto logits_inputs = get_ancestors(logits);
+    auto is_last_layer_sum = [&] (ov::Node* node) {
+        return ov::is_type<ov::op::v1::Add>(node) && computed_by_last_layer.count(node) && logits_inputs.count(node) &&
+               node->get_output_partial_shape(0) == kept_hidden_states->get_output_partial_shape(0);
+    };
+    std::shared_ptr<ov::Node> hidden_states;
+    for (const auto& op : ordered_ops) {
+        if (!is_last_layer_sum(op.get())) {
+            continue;
+        }
+        const auto inputs = op->input_values();
+        if (std::any_of(inputs.begin(), inputs.end(), [&] (const ov::Output<ov::Node>& input) { return is_last_layer_sum(input.get_node()); })) {
+            hidden_states = op;
+        }
+    }
+    OPENVINO_ASSERT(hidden_states, "The hidden states at the output of the last decoder layer are not found");
+
+    hidden_states->output(0).replace(kept_hidden_states->output(0));
+
+    // the outputs of the skipped layers, e.g. their attention scores, and their inputs, e.g. KV cache, are removed
+    std::unordered_set<ov::Node*> skipped_pa_ops;
+    for (auto it = pa_ops.find(num_layers); it != pa_ops.end(); ++it) {
+        skipped_pa_ops.insert(it->second);
+    }
+    std::unordered_set<ov::Node*> used_nodes;
+    for (const auto& result : model->get_results()) {
+        const auto result_inputs = get_ancestors(result.get());
+        if (std::any_of(result_inputs.begin(), result_inputs.end(), [&] (ov::Node* node) { return skipped_pa_ops.count(node) > 0; })) {
+            model->remove_result(result);
+        } else {
+            used_nodes.insert(result_inputs.begin(), result_inputs.end());
+        }
+    }
+    for (const auto& param_ptr : model->get_parameters()) {
+        if (!used_nodes.count(param_ptr.get())) {
+            model->remove_parameter(param_ptr);
+        }
+    }
+
+    model->validate_nodes_and_infer_types();
+}
+
+size_t get_attention_window_size(std::shared_ptr<ov::Model> model) {
+    // the index of the sliding_window input of PagedAttention
+    constexpr size_t sliding_window_input_idx = 10;
+    size_t window_size = 0;
+    for (const auto& param_ptr : model->get_parameters()) {
+        if (param_ptr->get_friendly_name().find("key_cache.") != 0) {
+            continue;
+        }
+        auto pa_op = param_ptr->get_output_target_inputs(0).begin()->get_node();
+        if (pa_op->get_input_size() <= sliding_window_input_idx) {
+            return 0;
+        }
+        auto sliding_window = ov::as_type_ptr<ov::op::v0::Constant>(pa_op->get_input_node_shared_ptr(sliding_window_input_idx));
+        const std::vector<int64_t> layer_window_size = sliding_window ? sliding_window->cast_vector<int64_t>() : std::vector<int64_t>{};
+        if (layer_window_size.empty() || layer_window_size[0] <= 0) {
+            return 0;
+        }
+        window_size = std::max(window_size, static_cast<size_t>(layer_window_size[0]));
+    }
+    return window_size;
+}
+
+ov::AnyMap get_kv_cache_precision_properties(const KVCachePrecisionConfig& config, const ov::AnyMap& properties) {
+    ov::AnyMap kv_cache_properties;
+    auto set_if_missing = [&](const std::string& name, const ov::Any& value) {
+        if (!properties.count(name)) {
+            kv_cache_properties[name] = value;
+        }
+    };
+    if (config.key_quantization_mode == KVCacheQuantizationMode::BY_CHANNEL) {
+        set_if_missing("KEY_CACHE_QUANT_MODE", std::string("BY_CHANNEL"));
+    }
+    if (config.key_group_size > 0) {
+        set_if_missing("KEY_CACHE_GROUP_SIZE", config.key_group_size);
+    }
+    if (config.value_group_size > 0) {
+        set_if_missing("VALUE_CACHE_GROUP_SIZE", config.value_group_size);
+    }
+    return kv_cache_properties;
+}
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
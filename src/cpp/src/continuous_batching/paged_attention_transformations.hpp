@@ -7,6 +7,7 @@
 
 #include "openvino/core/any.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/genai/kv_cache_precision.hpp"
 
 namespace ov {
 namespace genai {
@@ -26,6 +27,33 @@ namespace utils {
  */
 void apply_paged_attention_transformations(std::shared_ptr<ov::Model> model, bool per_layer_cache_control = false, bool allow_cache_rotation = false, bool allow_xattention = false);
 
+/** Sets the precisions of the KV cache inputs of the individual decoder layers, which are left for the plugin to choose
+ * by apply_paged_attention_transformations otherwise.
+ * @param model Pointer to the ov::Model transformed by apply_paged_attention_transformations.
+ * @param config The precisions of the layers, the rest of the config is applied by get_kv_cache_precision_properties.
+ */
+void apply_kv_cache_precisions(std::shared_ptr<ov::Model> model, const KVCachePrecisionConfig& config);
+
+/** @return The compilation properties of the grouping of the quantized KV cache values of the config, except for
+ * the ones already set in the properties.
+ */
+ov::AnyMap get_kv_cache_precision_properties(const KVCachePrecisionConfig& config, const ov::AnyMap& properties);
+
+/** @return The largest sliding window of the attention of the decoder layers, i.e. the number of the last tokens the
+ * new tokens attend to, or 0 if any layer attends to the whole context, e.g. for the models interleaving the local and
+ * the global attention layers.
+ * @param model Pointer to the ov::Model transformed by apply_paged_attention_transformations.
+ */
+size_t get_attention_window_size(std::shared_ptr<ov::Model> model);
+
+/** Cuts the decoder layers after the first `num_layers` ones out of the model, so that the LM head is applied to their
+ * output, e.g. to draft with the early layers of the model in self-speculative decoding. The layers are found by their
+ * PagedAttention operations, the hidden states between them are the latest residual sums computed by the previous layer.
+ * @param model Pointer to the ov::Model transformed by apply_paged_attention_transformations.
+ * @param num_layers The number of the first decoder layers to keep.
+ */
+void apply_layer_skip_transformation(std::shared_ptr<ov::Model> model, size_t num_layers);
+
 void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
 }  // namespace utils
@@ -13,12 +13,24 @@
 #include "speculative_decoding/speculative_decoding_impl.hpp"
 #include "prompt_lookup/prompt_lookup_impl.hpp"
 #include "continuous_batching/timer.hpp"
+#include "continuous_batching/engine_loop.hpp"
 #include "utils.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
 using namespace ov::genai;
 
+class ContinuousBatchingPipeline::EngineLoop : public PipelineEngineLoop<ContinuousBatchingPipeline::IContinuousBatchingPipeline> {
+public:
+    using PipelineEngineLoop::PipelineEngineLoop;
+};
+
 namespace {
+void check_text_streaming(const std::function<StreamingStatus(std::string)>& streamer, const ov::genai::GenerationConfig& sampling_params) {
+    OPENVINO_ASSERT(streamer, "Text streamer callback must not be empty");
+    OPENVINO_ASSERT(sampling_params.num_return_sequences == 1 && (sampling_params.is_greedy_decoding() || sampling_params.is_multinomial()),
+        "Currently streaming is possible only for greedy or multinomial decoding with num_return_sequences=1");
+}
+
 ov::genai::ModelDesc
 extract_draft_model_from_config(ov::AnyMap& config) {
     ov::genai::ModelDesc draft_model;
@@ -39,6 +51,47 @@ extract_prompt_lookup_from_config(ov::AnyMap& config) {
     return res;
 }
 
+// the draft model of self-speculative decoding is a copy of the main model, whose decoder layers after the first ones
+// are cut out by SpeculativeDecodingImpl
+ov::genai::ModelDesc
+get_self_speculative_draft_model(const ov::genai::ModelDesc& draft_model, const std::shared_ptr<ov::Model>& model, const Tokenizer& tokenizer,
+                                 const ov::genai::GenerationConfig& generation_config, const ov::AnyMap& config) {
+    if (config.find(ov::genai::self_speculative_num_layers.name()) == config.end()) {
+        return draft_model;
+    }
+    OPENVINO_ASSERT(draft_model.model == nullptr, "Self-speculative decoding and speculative decoding with a draft model are mutually exclusive");
+    return ov::genai::ModelDesc(model->clone(), tokenizer, {}, {}, {}, generation_config);
+}
+
+bool
+extract_overlap_vision_encoding_from_config(ov::AnyMap& config) {
+    bool res = false;
+    if (config.find(ov::genai::overlap_vision_encoding.name()) != config.end()) {
+        res = config.at(ov::genai::overlap_vision_encoding.name()).as<bool>();
+        config.erase(ov::genai::overlap_vision_encoding.name());
+    }
+    return res;
+}
+
+bool
+extract_embeddings_lookup_in_model_from_config(ov::AnyMap& config) {
+    bool res = false;
+    if (config.find(ov::genai::embeddings_lookup_in_model.name()) != config.end()) {
+        res = config.at(ov::genai::embeddings_lookup_in_model.name()).as<bool>();
+        config.erase(ov::genai::embeddings_lookup_in_model.name());
+    }
+    return res;
+}
+
+// passes the text embeddings model to the pipeline implementation, which merges it into the language model,
+// see utils::apply_embeddings_lookup_transformation
+void
+set_embeddings_lookup_model(ov::AnyMap& config, const std::shared_ptr<InputsEmbedder>& embedder, bool is_embeddings_lookup_in_model) {
+    if (embedder && is_embeddings_lookup_in_model) {
+        config[utils::EMBEDDINGS_MODEL_ARG_NAME] = embedder->get_embedding_model()->get_model();
+    }
+}
+
 float get_load_time(std::chrono::steady_clock::time_point start_time) {
     auto stop_time = std::chrono::steady_clock::now();
     return std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
@@ -55,6 +108,8 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto is_vision_encoding_overlapped = extract_overlap_vision_encoding_from_config(properties_without_draft_model);
+    auto is_embeddings_lookup_in_model = extract_embeddings_lookup_in_model_from_config(properties_without_draft_model);
 
     auto model = utils::read_model(models_path, properties);
     auto [properties_without_draft_model_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties_without_draft_model);
@@ -63,17 +118,24 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
 
     std::shared_ptr<InputsEmbedder> embedder;
     if (std::filesystem::exists(models_path / "openvino_text_embeddings_model.xml")) {
-        embedder = std::make_shared<InputsEmbedder>(models_path, device, vision_encoder_properties);
+        // the vision embedding cache and the token reduction may be configured along with the language model, e.g. by VLMPipeline
+        auto embedder_properties = vision_encoder_properties;
+        for (const auto& name : {ov::genai::vision_embedding_cache_size.name(), ov::genai::visual_token_keep_ratio.name()}) {
+            if (properties.count(name)) {
+                embedder_properties.emplace(name, properties.at(name));
+            }
+        }
+        embedder = std::make_shared<InputsEmbedder>(models_path, device, embedder_properties);
     }
 
+    draft_model_desr = get_self_speculative_draft_model(draft_model_desr, model, tokenizer, generation_config, properties_without_draft_model);
+    set_embeddings_lookup_model(properties_without_draft_model_without_gguf, embedder, is_embeddings_lookup_in_model);
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
-        OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
-        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
+        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config, embedder);
     } else if (draft_model_desr.model != nullptr) {
-        OPENVINO_ASSERT(embedder == nullptr, "Speculative decoding is not supported for models with embeddings");
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model_without_gguf, scheduler_config, generation_config);
-        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
+        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr, embedder);
     } else if (embedder) {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, embedder, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
     }
@@ -81,6 +143,7 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
     }
 
+    m_impl->m_overlap_vision_encoding = is_vision_encoding_overlapped;
     m_impl->m_load_time_ms = get_load_time(start_time);
 }
 
@@ -94,6 +157,8 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto is_vision_encoding_overlapped = extract_overlap_vision_encoding_from_config(properties_without_draft_model);
+    auto is_embeddings_lookup_in_model = extract_embeddings_lookup_in_model_from_config(properties_without_draft_model);
 
     auto model = utils::read_model(models_path, properties_without_draft_model);
     auto [properties_without_draft_model_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties_without_draft_model);
@@ -105,20 +170,21 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
         embedder = std::make_shared<InputsEmbedder>(models_path, device, properties_without_draft_model_without_gguf);
     }
 
+    draft_model_desr = get_self_speculative_draft_model(draft_model_desr, model, tokenizer, generation_config, properties_without_draft_model);
+    set_embeddings_lookup_model(properties_without_draft_model_without_gguf, embedder, is_embeddings_lookup_in_model);
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
-        OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
-        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
+        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config, embedder);
     } else if (draft_model_desr.model != nullptr) {
-        OPENVINO_ASSERT(embedder == nullptr, "Speculative decoding is not supported for models with embeddings");
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model_without_gguf, scheduler_config, generation_config);
-        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
+        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr, embedder);
     } else if (embedder) {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, embedder, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
     }
 
+    m_impl->m_overlap_vision_encoding = is_vision_encoding_overlapped;
     m_impl->m_load_time_ms = get_load_time(start_time);
 }
 
@@ -135,6 +201,8 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto is_vision_encoding_overlapped = extract_overlap_vision_encoding_from_config(properties_without_draft_model);
+    auto is_embeddings_lookup_in_model = extract_embeddings_lookup_in_model_from_config(properties_without_draft_model);
     auto model = utils::singleton_core().read_model(model_str, weights_tensor);
 
     auto rt_info = model->get_rt_info();
@@ -148,20 +216,21 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
         }
     }
 
+    draft_model_desr = get_self_speculative_draft_model(draft_model_desr, model, tokenizer, generation_config, properties_without_draft_model);
+    set_embeddings_lookup_model(properties_without_draft_model, embedder, is_embeddings_lookup_in_model);
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
-        OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
-        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
+        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config, embedder);
     } else if (draft_model_desr.model != nullptr) {
-        OPENVINO_ASSERT(embedder == nullptr, "Speculative decoding is not supported for models with embeddings");
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
-        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
+        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr, embedder);
     } else if (embedder) {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, embedder, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     }
 
+    m_impl->m_overlap_vision_encoding = is_vision_encoding_overlapped;
     m_impl->m_load_time_ms = get_load_time(start_time);
 }
 
@@ -178,6 +247,8 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto is_vision_encoding_overlapped = extract_overlap_vision_encoding_from_config(properties_without_draft_model);
+    auto is_embeddings_lookup_in_model = extract_embeddings_lookup_in_model_from_config(properties_without_draft_model);
     auto model_pair = utils::get_model_weights_pair(models_map, "language");
     auto model = utils::singleton_core().read_model(model_pair.first, model_pair.second);
 
@@ -196,20 +267,21 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
         }
     }
 
+    draft_model_desr = get_self_speculative_draft_model(draft_model_desr, model, tokenizer, generation_config, properties_without_draft_model);
+    set_embeddings_lookup_model(properties_without_draft_model, embedder, is_embeddings_lookup_in_model);
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
-        OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
-        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
+        m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config, embedder);
     } else if (draft_model_desr.model != nullptr) {
-        OPENVINO_ASSERT(embedder == nullptr, "Speculative decoding is not supported for models with embeddings");
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
-        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
+        m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr, embedder);
     } else if (embedder) {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, embedder, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     }
 
+    m_impl->m_overlap_vision_encoding = is_vision_encoding_overlapped;
     m_impl->m_load_time_ms = get_load_time(start_time);
 }
 
@@ -229,27 +301,118 @@ PipelineMetrics ContinuousBatchingPipeline::get_metrics() const{
     return m_impl->get_metrics();
 }
 
+ServingMetrics ContinuousBatchingPipeline::get_serving_metrics() const {
+    return m_impl->get_serving_metrics();
+}
+
+MemoryReport ContinuousBatchingPipeline::get_memory_report() const {
+    return m_impl->get_memory_report();
+}
+
+std::vector<uint8_t> ContinuousBatchingPipeline::export_kv_blocks(const ov::Tensor& input_ids) {
+    OPENVINO_ASSERT(!m_engine_loop, "export_kv_blocks() can't be called while the engine loop is running");
+    return m_impl->export_kv_blocks(input_ids);
+}
+
+size_t ContinuousBatchingPipeline::import_kv_blocks(const std::vector<uint8_t>& kv_blocks) {
+    OPENVINO_ASSERT(!m_engine_loop, "import_kv_blocks() can't be called while the engine loop is running");
+    return m_impl->import_kv_blocks(kv_blocks);
+}
+
+PrefixCacheDigest ContinuousBatchingPipeline::get_prefix_cache_digest() {
+    OPENVINO_ASSERT(!m_engine_loop, "get_prefix_cache_digest() can't be called while the engine loop is running");
+    return m_impl->get_prefix_cache_digest();
+}
+
+size_t ContinuousBatchingPipeline::shrink_kv_cache() {
+    OPENVINO_ASSERT(!m_engine_loop, "shrink_kv_cache() can't be called while the engine loop is running");
+    return m_impl->shrink_kv_cache();
+}
+
+size_t MemoryReport::get_total_bytes() const {
+    size_t total_bytes = kv_cache_allocated + kv_cache_swap_space + input_buffers + vision_embedding_cache;
+    for (const auto& [model_name, byte_size] : weights) {
+        total_bytes += byte_size;
+    }
+    return total_bytes;
+}
+
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params) {
+    if (m_engine_loop) {
+        return m_engine_loop->add_request(request_id, [&] { return m_impl->add_request(request_id, prompt, sampling_params); }, {});
+    }
     return m_impl->add_request(request_id, prompt, sampling_params);
 }
 
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params) {
+    if (m_engine_loop) {
+        return m_engine_loop->add_request(request_id, [&] { return m_impl->add_request(request_id, input_ids, sampling_params); }, {});
+    }
     return m_impl->add_request(request_id, input_ids, sampling_params);
 }
 
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const std::vector<ov::Tensor>& images, const ov::genai::GenerationConfig& sampling_params) {
+    if (m_engine_loop) {
+        return m_engine_loop->add_request(request_id, [&] { return m_impl->add_request(request_id, prompt, images, sampling_params); }, {});
+    }
     return m_impl->add_request(request_id, prompt, images, sampling_params);
 }
 
+GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params, GenerationCompletionCallback on_completion) {
+    OPENVINO_ASSERT(m_engine_loop, "Completion callbacks require the engine loop to be started, see start_engine_loop()");
+    return m_engine_loop->add_request(request_id, [&] { return m_impl->add_request(request_id, input_ids, sampling_params); }, std::move(on_completion));
+}
+
+GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params, GenerationCompletionCallback on_completion) {
+    OPENVINO_ASSERT(m_engine_loop, "Completion callbacks require the engine loop to be started, see start_engine_loop()");
+    return m_engine_loop->add_request(request_id, [&] { return m_impl->add_request(request_id, prompt, sampling_params); }, std::move(on_completion));
+}
+
+GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params, std::function<StreamingStatus(std::string)> streamer, GenerationCompletionCallback on_completion) {
+    OPENVINO_ASSERT(m_engine_loop, "Text streaming requires the engine loop to be started, see start_engine_loop()");
+    check_text_streaming(streamer, sampling_params);
+    return m_engine_loop->add_request(request_id, [&] { return m_impl->add_request(request_id, input_ids, sampling_params); }, std::move(on_completion),
+                                      [streamer](const std::string& text) { return streamer(text); });
+}
+
+GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params, std::function<StreamingStatus(std::string)> streamer, GenerationCompletionCallback on_completion) {
+    OPENVINO_ASSERT(m_engine_loop, "Text streaming requires the engine loop to be started, see start_engine_loop()");
+    check_text_streaming(streamer, sampling_params);
+    return m_engine_loop->add_request(request_id, [&] { return m_impl->add_request(request_id, prompt, sampling_params); }, std::move(on_completion),
+                                      [streamer](const std::string& text) { return streamer(text); });
+}
+
 void ContinuousBatchingPipeline::step() {
+    OPENVINO_ASSERT(!m_engine_loop, "step() can't be called while the engine loop is running");
     m_impl->step();
 }
 
+void ContinuousBatchingPipeline::start_engine_loop(const EngineLoopConfig& config) {
+    OPENVINO_ASSERT(!m_engine_loop, "Engine loop is already running");
+    // the text of all the streamed requests is detokenized at once after each step
+    m_engine_loop = std::make_shared<EngineLoop>(m_impl, config, std::make_shared<BatchedTextStreamer>(m_impl->get_tokenizer()));
+}
+
+void ContinuousBatchingPipeline::start_engine_loop(const EngineLoopConfig& config, EngineStepCallback on_step) {
+    OPENVINO_ASSERT(!m_engine_loop, "Engine loop is already running");
+    OPENVINO_ASSERT(on_step, "Step callback of the engine loop must not be empty");
+    m_engine_loop = std::make_shared<EngineLoop>(m_impl, config, std::make_shared<BatchedTextStreamer>(m_impl->get_tokenizer()), std::move(on_step));
+}
+
+void ContinuousBatchingPipeline::stop_engine_loop() {
+    if (!m_engine_loop) {
+        return;
+    }
+    auto engine_loop = std::move(m_engine_loop);
+    engine_loop->stop();
+}
+
 bool ContinuousBatchingPipeline::has_non_finished_requests() {
     return m_impl->has_non_finished_requests();
 }
 
 std::vector<EncodedGenerationResult> ContinuousBatchingPipeline::generate(const std::vector<ov::Tensor>& input_ids, const std::vector<ov::genai::GenerationConfig>& sampling_params, const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!m_engine_loop, "generate() can't be called while the engine loop is running");
     auto encoded_results = m_impl->generate(input_ids, sampling_params, streamer);
 
     for (auto& encoded_result : encoded_results) {
@@ -260,6 +423,7 @@ std::vector<EncodedGenerationResult> ContinuousBatchingPipeline::generate(const
 }
 
 std::vector<GenerationResult> ContinuousBatchingPipeline::generate(const std::vector<std::string>& prompts, const std::vector<ov::genai::GenerationConfig>& sampling_params, const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!m_engine_loop, "generate() can't be called while the engine loop is running");
     auto decoded_results = m_impl->generate(prompts, sampling_params, streamer);
 
     for (auto& decoded_result : decoded_results) {
@@ -274,7 +438,18 @@ std::vector<VLMDecodedResults> ContinuousBatchingPipeline::generate(
              const std::vector<std::vector<ov::Tensor>>& images,
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer) {
-    return m_impl->generate(prompts, images, sampling_params, streamer);
+    OPENVINO_ASSERT(!m_engine_loop, "generate() can't be called while the engine loop is running");
+    return m_impl->generate(prompts, images, {}, sampling_params, streamer);
+}
+
+std::vector<VLMDecodedResults> ContinuousBatchingPipeline::generate(
+             const std::vector<std::string>& prompts,
+             const std::vector<std::vector<ov::Tensor>>& images,
+             const std::vector<std::vector<ov::Tensor>>& videos,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(!m_engine_loop, "generate() can't be called while the engine loop is running");
+    return m_impl->generate(prompts, images, videos, sampling_params, streamer);
 }
 
 
@@ -286,3 +461,18 @@ void ContinuousBatchingPipeline::start_chat(const std::string& system_message) {
 void ContinuousBatchingPipeline::finish_chat() {
     m_impl->finish_chat();
 }
+
+void ContinuousBatchingPipeline::warmup(const WarmupConfig& config) {
+    OPENVINO_ASSERT(!m_engine_loop, "warmup() can't be called while the engine loop is running");
+    const GenerationConfig generation_config = utils::get_warmup_generation_config(get_config(), config.max_new_tokens);
+    const Tokenizer tokenizer = get_tokenizer();
+    for (size_t batch_size : config.batch_sizes) {
+        for (size_t prompt_length : config.prompt_lengths) {
+            // the prompts of a batch are scheduled together, like the concurrent requests
+            const ov::Tensor prompt_ids = utils::get_warmup_input_ids(1, prompt_length, tokenizer);
+            m_impl->generate(std::vector<ov::Tensor>(batch_size, prompt_ids),
+                             std::vector<GenerationConfig>(batch_size, generation_config),
+                             std::monostate{});
+        }
+    }
+}
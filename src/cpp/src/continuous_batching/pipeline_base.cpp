@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "continuous_batching/pipeline_base.hpp"
+#include "continuous_batching/tracer.hpp"
 
 namespace ov::genai {
 
@@ -20,6 +21,31 @@ PipelineMetrics ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_met
     return m_pipeline_metrics;
 }
 
+ServingMetrics ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_serving_metrics() const {
+    return m_serving_metrics.get_metrics();
+}
+
+MemoryReport ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_memory_report() const {
+    std::lock_guard<std::mutex> lock(m_memory_report_mutex);
+    return m_memory_report;
+}
+
+std::vector<uint8_t> ContinuousBatchingPipeline::IContinuousBatchingPipeline::export_kv_blocks(const ov::Tensor& input_ids) {
+    OPENVINO_THROW("Export of KV cache blocks is not supported with speculative decoding and prompt lookup");
+}
+
+size_t ContinuousBatchingPipeline::IContinuousBatchingPipeline::import_kv_blocks(const std::vector<uint8_t>& kv_blocks) {
+    OPENVINO_THROW("Import of KV cache blocks is not supported with speculative decoding and prompt lookup");
+}
+
+PrefixCacheDigest ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_prefix_cache_digest() {
+    OPENVINO_THROW("Prefix cache digest is not supported with speculative decoding and prompt lookup");
+}
+
+size_t ContinuousBatchingPipeline::IContinuousBatchingPipeline::shrink_kv_cache() {
+    OPENVINO_THROW("Shrinking of the KV cache is not supported with speculative decoding and prompt lookup");
+}
+
 Tokenizer ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_tokenizer() {
     return m_tokenizer;
 }
@@ -28,12 +54,15 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::start_chat(const s
     if (!system_message.empty()) {
         m_history.push_back({{"role", "system"}, {"content", system_message}});
     }
+    m_chat_history_encoder.reset();
     m_is_chat_conversation = true;
 };
 
 void ContinuousBatchingPipeline::IContinuousBatchingPipeline::finish_chat() {
     m_is_chat_conversation = false;
     m_history.clear();
+    m_chat_history_encoder.reset();
+    pin_chat_history({});
     m_history_images.clear();
     m_history_image_ids.clear();
     if (m_inputs_embedder) {
@@ -51,7 +80,7 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         // TODO: remove this code and within model runner add check: if sequence group type is tokens, 
         // but embedding model is available => compute embeddings first, then pass to LLM
         std::vector<std::vector<ov::Tensor>> images(prompts.size());
-        auto results_vlm = generate(prompts, images, sampling_params, streamer);
+        auto results_vlm = generate(prompts, images, {}, sampling_params, streamer);
         std::vector<GenerationResult> resutls;
         for (auto& vlm_result : results_vlm) {
             GenerationResult result;
@@ -75,28 +104,44 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         timer.start();
         const auto encode_start = std::chrono::steady_clock::now();
         // ov::genai::add_special_tokens(false) is aligned with stateful pipeline
-        input_ids.push_back(m_tokenizer.encode(history, ov::genai::add_special_tokens(false)).input_ids);
+        std::vector<int64_t> history_ids = m_chat_history_encoder.encode(history);
+        input_ids.emplace_back(ov::element::i64, ov::Shape{1, history_ids.size()});
+        std::copy(history_ids.begin(), history_ids.end(), input_ids.back().data<int64_t>());
         tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
         timer.end();
     } else {
-        input_ids.reserve(prompts.size());
         timer.start();
+        // the prompts are encoded in a batch without padding per value of add_special_tokens
+        std::vector<std::string> templated_prompts[2];
+        std::vector<size_t> prompt_indices[2];
         for (size_t i = 0; i < prompts.size(); i++) {
             const std::string& prompt = prompts.at(i);
-            const auto encode_start = std::chrono::steady_clock::now();
-            ov::Tensor encoded_inputs;
             if (sampling_params.at(i).apply_chat_template && !m_tokenizer.get_chat_template().empty()) {
                 ChatHistory history({{{"role", "user"}, {"content", prompt}}});
                 constexpr bool add_generation_prompt = true;
-                auto templated_prompt = m_tokenizer.apply_chat_template(history, add_generation_prompt);
-                encoded_inputs = m_tokenizer.encode(templated_prompt, ov::genai::add_special_tokens(false)).input_ids;
+                templated_prompts[0].push_back(m_tokenizer.apply_chat_template(history, add_generation_prompt));
+                prompt_indices[0].push_back(i);
             } else {
                 // in case when chat_template was not found in tokenizer_config.json or set
-                std::string input_str(prompt);
-                encoded_inputs = m_tokenizer.encode(input_str, ov::genai::add_special_tokens(true)).input_ids;
+                templated_prompts[1].push_back(prompt);
+                prompt_indices[1].push_back(i);
+            }
+        }
+        input_ids.resize(prompts.size());
+        tokenization_durations.resize(prompts.size());
+        for (bool add_special_tokens : {false, true}) {
+            if (templated_prompts[add_special_tokens].empty()) {
+                continue;
+            }
+            const auto encode_start = std::chrono::steady_clock::now();
+            RaggedTokenizedInputs encoded_inputs = m_tokenizer.encode_ragged(templated_prompts[add_special_tokens], ov::genai::add_special_tokens(add_special_tokens));
+            // the duration of the batch is shared by its prompts
+            const MicroSeconds encode_duration(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start) /
+                                               templated_prompts[add_special_tokens].size());
+            for (size_t i = 0; i < prompt_indices[add_special_tokens].size(); ++i) {
+                input_ids[prompt_indices[add_special_tokens][i]] = encoded_inputs.get_input_ids(i);
+                tokenization_durations[prompt_indices[add_special_tokens][i]] = encode_duration;
             }
-            input_ids.push_back(encoded_inputs);
-            tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
         }
         timer.end();
     }
@@ -114,11 +159,21 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         std::vector<std::string> generated;
         generated.reserve(res.m_generation_ids.size());
         for (size_t idx = 0; idx < res.m_generation_ids.size(); ++idx) {
+            GENAI_TRACE_SCOPE("detokenize", static_cast<int64_t>(res.m_request_id));
             const auto decode_start = std::chrono::steady_clock::now();
             generated.push_back(m_tokenizer.decode(res.m_generation_ids.at(idx)));
             raw_counters.detokenization_durations.emplace_back(std::chrono::steady_clock::now() - decode_start);
             if (m_is_chat_conversation && 0 == idx && res.m_status != ov::genai::GenerationStatus::CANCEL) {
                 m_history.push_back({{"role", "assistant"}, {"content", generated.back()}});
+                const std::set<int64_t>& stop_token_ids = sampling_params[0].stop_token_ids.empty() ? m_generation_config.stop_token_ids
+                                                                                                     : sampling_params[0].stop_token_ids;
+                if (sampling_params[0].echo) {
+                    // the generated ids start with the prompt
+                    m_chat_history_encoder.reset();
+                } else {
+                    m_chat_history_encoder.add_answer(generated.back(), res.m_generation_ids.at(idx), stop_token_ids);
+                }
+                pin_chat_history(m_chat_history_encoder.get_token_ids());
             }
         }
 
@@ -135,7 +190,8 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
             std::move(res.m_scores),
             res.m_status,
             perf_metrics,
-            res.extended_perf_metrics
+            res.extended_perf_metrics,
+            res.request_metrics
         });
     }
 
@@ -150,6 +206,7 @@ std::vector<VLMDecodedResults>
 ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
              const std::vector<std::string>& prompts,
              const std::vector<std::vector<ov::Tensor>>& rgbs_vector,
+             const std::vector<std::vector<ov::Tensor>>& videos_vector,
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer)  {
     auto generate_start_time = std::chrono::steady_clock::now();
@@ -157,10 +214,18 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
 
     OPENVINO_ASSERT(prompts.size() == sampling_params.size(), "Number of prompts should be equal to the number of generation configs.");
     OPENVINO_ASSERT(prompts.size() == rgbs_vector.size(), "Number of prompts should be equal to the number of images vectors.");
+    OPENVINO_ASSERT(videos_vector.empty() || prompts.size() == videos_vector.size(), "Number of prompts should be equal to the number of videos vectors.");
+    const auto get_videos = [&](size_t i) {
+        return videos_vector.empty() ? std::vector<ov::Tensor>{} : videos_vector[i];
+    };
+
+    // the embeddings are moved into the requests once added, so a prompt doesn't keep a second copy while generating
+    std::vector<std::promise<PromptEmbeddings>> promises(prompts.size());
+    std::vector<std::future<PromptEmbeddings>> prompts_embeddings;
+    for (auto& promise : promises) {
+        prompts_embeddings.push_back(promise.get_future());
+    }
 
-    std::vector<ov::Tensor> input_embeds_list;
-    std::vector<ov::Tensor> token_type_ids_list;
-    
     std::vector<VLMPerfMetrics> vlm_perf_metrics(prompts.size());
     std::vector<EncodedImage> encoded_images = {};
 
@@ -169,7 +234,7 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         const auto& rgbs = rgbs_vector[0];
         const auto& prompt = prompts[0];
         auto start_get_inputs_embeds = std::chrono::steady_clock::now();
-        encoded_images = m_inputs_embedder->encode_images(rgbs);
+        encoded_images = m_inputs_embedder->encode_images(rgbs, vlm_perf_metrics[0], get_videos(0));
         m_history_images.insert(m_history_images.end(), encoded_images.begin(), encoded_images.end());
 
         const auto [unified_prompt, image_sequence] = m_inputs_embedder->normalize_prompt(prompt, m_image_id, encoded_images);
@@ -179,41 +244,65 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         std::string templated_history = m_tokenizer.apply_chat_template(m_history, true);
 
         m_inputs_embedder->set_apply_chat_template_status(false);
+        PromptEmbeddings prompt_embeddings;
         if (m_inputs_embedder->has_token_type_ids()) {
-            auto [embeds, tt_ids] = m_inputs_embedder->get_inputs_embeds_with_token_type_ids(templated_history, m_history_images, vlm_perf_metrics[0], rgbs.size() > 0, m_history_image_ids);
-            input_embeds_list.push_back(std::move(embeds));
-            token_type_ids_list.push_back(std::move(tt_ids));
+            std::tie(prompt_embeddings.inputs_embeds, prompt_embeddings.token_type_ids) =
+                m_inputs_embedder->get_inputs_embeds_with_token_type_ids(templated_history, m_history_images, vlm_perf_metrics[0], rgbs.size() > 0, m_history_image_ids);
         } else {
-            input_embeds_list.emplace_back(m_inputs_embedder->get_inputs_embeds(templated_history, m_history_images, vlm_perf_metrics[0], rgbs.size() > 0, m_history_image_ids));
+            prompt_embeddings.inputs_embeds = m_inputs_embedder->get_inputs_embeds(templated_history, m_history_images, vlm_perf_metrics[0], rgbs.size() > 0, m_history_image_ids);
         }
+        promises[0].set_value(std::move(prompt_embeddings));
 
         auto end_get_inputs_embeds = std::chrono::steady_clock::now();
         vlm_perf_metrics[0].vlm_raw_metrics.prepare_embeddings_durations.emplace_back(PerfMetrics::get_microsec(end_get_inputs_embeds - start_get_inputs_embeds));
 
+    }
+
+    const auto embed_prompt = [&](size_t i, const std::vector<EncodedImage>& encoded_images) {
+        auto [unified_prompt, image_sequence] = m_inputs_embedder->normalize_prompt(prompts[i], m_image_id, encoded_images);
+
+        auto start_get_inputs_embeds = std::chrono::steady_clock::now();
+        m_inputs_embedder->set_apply_chat_template_status(sampling_params[i].apply_chat_template);
+
+        PromptEmbeddings prompt_embeddings;
+        if (m_inputs_embedder->has_token_type_ids()) {
+            std::tie(prompt_embeddings.inputs_embeds, prompt_embeddings.token_type_ids) =
+                m_inputs_embedder->get_inputs_embeds_with_token_type_ids(unified_prompt, encoded_images, vlm_perf_metrics[i], true, image_sequence);
+        } else {
+            prompt_embeddings.inputs_embeds = m_inputs_embedder->get_inputs_embeds(unified_prompt, encoded_images, vlm_perf_metrics[i], true, image_sequence);
+        }
+
+        auto end_get_inputs_embeds = std::chrono::steady_clock::now();
+        vlm_perf_metrics[i].vlm_raw_metrics.prepare_embeddings_durations.emplace_back(PerfMetrics::get_microsec(end_get_inputs_embeds - start_get_inputs_embeds));
+        return prompt_embeddings;
+    };
+
+    std::vector<EncodedGenerationResult> encoded_results;
+    if (!m_is_chat_conversation && m_overlap_vision_encoding && prompts.size() > 1) {
+        // a worker encodes the prompts one by one, and the generation of each prompt starts once it's encoded
+        auto encoding = std::async(std::launch::async, [&] {
+            for (size_t i = 0; i < prompts.size(); i++) {
+                try {
+                    promises[i].set_value(embed_prompt(i, m_inputs_embedder->encode_images(rgbs_vector[i], vlm_perf_metrics[i], get_videos(i))));
+                } catch (...) {
+                    promises[i].set_exception(std::current_exception());
+                    return;
+                }
+            }
+        });
+        encoded_results = generate(prompts_embeddings, sampling_params, streamer);
+        encoding.wait();
     } else {
-        for (size_t i = 0; i < prompts.size(); i++) {
-            const auto& prompt = prompts[i];
-            const auto& rgbs = rgbs_vector[i];
-            const auto encoded_images = m_inputs_embedder->encode_images(rgbs);
-            auto [unified_prompt, image_sequence] = m_inputs_embedder->normalize_prompt(prompt, m_image_id, encoded_images);
-
-            auto start_get_inputs_embeds = std::chrono::steady_clock::now();
-            m_inputs_embedder->set_apply_chat_template_status(sampling_params[i].apply_chat_template);
-
-            if (m_inputs_embedder->has_token_type_ids()) {
-                auto [embeds, tt_ids] = m_inputs_embedder->get_inputs_embeds_with_token_type_ids(unified_prompt, encoded_images, vlm_perf_metrics[i], true, image_sequence);
-                input_embeds_list.push_back(std::move(embeds));
-                token_type_ids_list.push_back(std::move(tt_ids));
-            } else {
-                input_embeds_list.emplace_back(m_inputs_embedder->get_inputs_embeds(unified_prompt, encoded_images, vlm_perf_metrics[i], true, image_sequence));
+        if (!m_is_chat_conversation) {
+            // the images of all the prompts are encoded together
+            const auto encoded_images_per_prompt = m_inputs_embedder->encode_images(rgbs_vector, vlm_perf_metrics, videos_vector);
+            for (size_t i = 0; i < prompts.size(); i++) {
+                promises[i].set_value(embed_prompt(i, encoded_images_per_prompt[i]));
             }
-        
-            auto end_get_inputs_embeds = std::chrono::steady_clock::now();
-            vlm_perf_metrics[i].vlm_raw_metrics.prepare_embeddings_durations.emplace_back(PerfMetrics::get_microsec(end_get_inputs_embeds - start_get_inputs_embeds));
         }
+        encoded_results = generate(prompts_embeddings, sampling_params, streamer);
     }
     std::vector<VLMDecodedResults> results;
-    std::vector<EncodedGenerationResult> encoded_results = generate(input_embeds_list, sampling_params, streamer, token_type_ids_list);
     for (size_t i = 0; i < prompts.size(); i++) {
         auto result = encoded_results[i];
         VLMDecodedResults gen_result;
@@ -225,6 +314,7 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         
         auto decode_start_time = std::chrono::steady_clock::now();
         for (size_t idx = 0; idx < result.m_generation_ids.size(); ++idx) {
+            GENAI_TRACE_SCOPE("detokenize", static_cast<int64_t>(result.m_request_id));
             gen_result.texts.push_back(m_tokenizer.decode(result.m_generation_ids.at(idx)));
             gen_result.scores.push_back(result.m_scores.at(idx));
         }
@@ -253,6 +343,23 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     return results;
 }
 
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
+             std::vector<std::future<PromptEmbeddings>>& prompts_embeddings,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer) {
+    std::vector<ov::Tensor> input_embeds_list;
+    std::vector<ov::Tensor> token_type_ids_list;
+    for (auto& prompt_embeddings : prompts_embeddings) {
+        PromptEmbeddings ready_prompt_embeddings = prompt_embeddings.get();
+        input_embeds_list.push_back(std::move(ready_prompt_embeddings.inputs_embeds));
+        if (ready_prompt_embeddings.token_type_ids) {
+            token_type_ids_list.push_back(std::move(*ready_prompt_embeddings.token_type_ids));
+        }
+    }
+    return generate(input_embeds_list, sampling_params, streamer, token_type_ids_list);
+}
+
 GenerationHandle 
 ContinuousBatchingPipeline::IContinuousBatchingPipeline::add_request(uint64_t request_id,
                                         const std::string& prompt,
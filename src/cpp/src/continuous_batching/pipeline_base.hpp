@@ -3,13 +3,18 @@
 
 #pragma once
 
+#include <future>
+#include <mutex>
+
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
 #include "continuous_batching/cache_manager.hpp"
+#include "continuous_batching/chat_history_encoder.hpp"
 #include "sampling/sampler.hpp"
 #include "continuous_batching/model_runner.hpp"
 #include "continuous_batching/scheduler.hpp"
+#include "continuous_batching/serving_metrics.hpp"
 #include "continuous_batching/threaded_streamer.hpp"
 
 namespace ov::genai {
@@ -32,6 +37,11 @@ protected:
     GenerationConfig m_generation_config;
 
     PipelineMetrics m_pipeline_metrics;
+    // cumulative latencies of the requests, recorded by the pipelines stepping a model
+    ServingMetricsRecorder m_serving_metrics;
+    // the memory of the pipelines stepping a model as of the previous step
+    MemoryReport m_memory_report;
+    mutable std::mutex m_memory_report_mutex;
 
     std::string m_device;
 
@@ -51,12 +61,19 @@ protected:
 
     bool m_is_chat_conversation = false;
     ChatHistory m_history;
+    // only the new messages of the chat history are tokenized each turn
+    ChatHistoryEncoder m_chat_history_encoder{[this](const std::string& text) {
+        ov::Tensor input_ids = m_tokenizer.encode(text, ov::genai::add_special_tokens(false)).input_ids;
+        return std::vector<int64_t>(input_ids.data<int64_t>(), input_ids.data<int64_t>() + input_ids.get_size());
+    }};
     std::vector<ov::genai::EncodedImage> m_history_images;
     std::vector<size_t> m_history_image_ids;
     size_t m_image_id = 0;
 
     float m_load_time_ms = 0.0f;
-    // to access m_load_time_ms
+    // the images of the prompts of a batch are encoded while the prompts encoded before are generated
+    bool m_overlap_vision_encoding = false;
+    // to access m_load_time_ms and m_overlap_vision_encoding
     friend class ContinuousBatchingPipeline;
 
     ModelInputType m_model_input_type = ModelInputType::TOKENS;
@@ -64,10 +81,25 @@ protected:
     std::mutex m_embeddings_mutex;
 
     void stream_tokens(const std::shared_ptr<ThreadedStreamerWrapper>& streamer_ptr, const GenerationHandle& handle);
+
+    /**
+     * Keeps the KV cache blocks of the chat history for the next turn, the empty history releases them.
+     */
+    virtual void pin_chat_history(const std::vector<int64_t>& token_ids) {}
 public:
     GenerationConfig get_config() const;
     void set_config(const GenerationConfig& config);
     PipelineMetrics get_metrics() const;
+    virtual ServingMetrics get_serving_metrics() const;
+    virtual MemoryReport get_memory_report() const;
+    // see ContinuousBatchingPipeline::export_kv_blocks, only supported by ContinuousBatchingImpl
+    virtual std::vector<uint8_t> export_kv_blocks(const ov::Tensor& input_ids);
+    // see ContinuousBatchingPipeline::import_kv_blocks, only supported by ContinuousBatchingImpl
+    virtual size_t import_kv_blocks(const std::vector<uint8_t>& kv_blocks);
+    // see ContinuousBatchingPipeline::get_prefix_cache_digest, only supported by ContinuousBatchingImpl
+    virtual PrefixCacheDigest get_prefix_cache_digest();
+    // see ContinuousBatchingPipeline::shrink_kv_cache, only supported by ContinuousBatchingImpl
+    virtual size_t shrink_kv_cache();
     Tokenizer get_tokenizer();
 
     /**
@@ -114,6 +146,23 @@ public:
              const StreamerVariant& streamer,
              std::optional<std::vector<ov::Tensor>> token_type_ids = std::nullopt) = 0;
 
+    /**
+     * Embeddings of a prompt and its token type ids, if the model uses them
+     */
+    struct PromptEmbeddings {
+        ov::Tensor inputs_embeds;
+        std::optional<ov::Tensor> token_type_ids;
+    };
+
+    /**
+     * Performs monolitic generation based on the prompt embeddings computed asynchronously. The generation of a prompt
+     * may start once its embeddings are ready, before the embeddings of the next prompts are.
+     */
+    virtual std::vector<EncodedGenerationResult>
+    generate(std::vector<std::future<PromptEmbeddings>>& prompts_embeddings,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer);
+
     /**
      * Performs monolitic generation based on text prompts
      */
@@ -122,10 +171,14 @@ public:
              std::vector<GenerationConfig> sampling_params,
              const StreamerVariant& streamer);
 
+    /**
+     * Performs monolitic generation based on text prompts and their images and videos, the videos may be empty for all the prompts
+     */
     virtual std::vector<VLMDecodedResults>
     generate(
              const std::vector<std::string>& prompts,
              const std::vector<std::vector<ov::Tensor>>& rgbs,
+             const std::vector<std::vector<ov::Tensor>>& videos,
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer);
 
@@ -1,7 +1,11 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <atomic>
+#include <cstring>
+#include <limits>
+#include <string_view>
 #include <thread>
 #include <optional>
 
@@ -11,6 +15,11 @@
 #include "continuous_batching/paged_attention_transformations.hpp"
 #include "lora/helper.hpp"
 #include "continuous_batching/cache_state_dumper.hpp"
+#include "continuous_batching/cache_state_recorder.hpp"
+#include "continuous_batching/numa.hpp"
+#include "continuous_batching/prefix_cache_storage.hpp"
+#include "continuous_batching/reserved_memory.hpp"
+#include "logger.hpp"
 
 namespace {
 
@@ -25,6 +34,25 @@ ov::element::Type get_model_kv_cache_precision(std::shared_ptr<ov::Model> model)
     return ir_kv_cache_precision;
 }
 
+// Identifies the adapters of a request by their indices in the pool and their alphas, so that the prefix caching doesn't
+// share KV cache blocks among the requests with different adapters
+size_t get_pool_adapters_hash(const ov::genai::AdapterConfig& pool, const ov::genai::AdapterConfig& adapters) {
+    const auto& pool_adapters = pool.get_adapters();
+    std::vector<int64_t> content;
+    for (const auto& adapter : adapters.get_adapters()) {
+        auto it = std::find(pool_adapters.begin(), pool_adapters.end(), adapter);
+        OPENVINO_ASSERT(it != pool_adapters.end(),
+            "AdapterConfig::MODE_POOL can switch among the adapters passed to the pipeline constructor only");
+        const float alpha = adapters.get_alpha(adapter);
+        int32_t alpha_bits;
+        std::memcpy(&alpha_bits, &alpha, sizeof(alpha));
+        content.push_back(it - pool_adapters.begin());
+        content.push_back(alpha_bits);
+    }
+    const char* data = reinterpret_cast<const char*>(content.data());
+    return std::hash<std::string_view>{}(std::string_view(data, content.size() * sizeof(content[0])));
+}
+
 } // namespace
 
 namespace ov::genai {
@@ -43,10 +71,12 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
     m_generation_config = generation_config;
     m_is_validation_mode_enabled = is_validation_mode_enabled;
 
-    bool is_need_per_layer_cache_control = scheduler_config.use_cache_eviction;
+    // sparse decoding estimates the block importance from the attention scores, which are per-layer outputs
+    bool is_need_per_layer_cache_control = scheduler_config.use_cache_eviction || is_sparse_decoding_enabled(scheduler_config);
     bool allow_cache_rotation = scheduler_config.cache_eviction_config.apply_rotation;
     bool allow_xattention = scheduler_config.use_sparse_attention && scheduler_config.sparse_attention_config.mode == SparseAttentionMode::XATTENTION;
     utils::apply_paged_attention_transformations(model, is_need_per_layer_cache_control, allow_cache_rotation, allow_xattention);
+    utils::apply_kv_cache_precisions(model, scheduler_config.kv_cache_precision_config);
     utils::apply_gather_before_matmul_transformation(model);
 
     initialize_pipeline(model, scheduler_config, device, properties);
@@ -61,14 +91,28 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
     const ov::AnyMap& properties,
     const ov::genai::GenerationConfig& generation_config,
     bool is_validation_mode_enabled) : ContinuousBatchingImpl(model, tokenizer, scheduler_config, device, properties, generation_config, is_validation_mode_enabled){
+    set_inputs_embedder(inputs_embedder);
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_inputs_embedder(std::shared_ptr<InputsEmbedder> inputs_embedder) {
     m_inputs_embedder = inputs_embedder;
     m_model_runner->set_embedding_model(inputs_embedder->get_embedding_model());
     m_model_input_type = ModelInputType::EMBEDDINGS;
 }
 
 ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
-    // manually release all blocks, which can re-initialize OpenVINO plugins during destruction
-    if (m_model_runner) {
+    if (m_scheduler && m_prefix_cache_fingerprint.has_value() && !m_scheduler->get_config().prefix_cache_path.empty()) {
+        const auto& prefix_cache_path = m_scheduler->get_config().prefix_cache_path;
+        try {
+            m_scheduler->save_prefix_cache(prefix_cache_path, *m_prefix_cache_fingerprint);
+        } catch (const std::exception& e) {
+            Logger::warn("Failed to save prefix cache to " + prefix_cache_path.string() + ": " + e.what());
+        }
+    }
+
+    // manually release all blocks, which can re-initialize OpenVINO plugins during destruction,
+    // the compiled model shared with the other pipelines is released by the last one
+    if (m_model_runner && (!m_compiled_model || m_compiled_model.use_count() == 1)) {
         m_model_runner->get_infer_request().get_compiled_model().release_memory();
     }
 
@@ -95,23 +139,73 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
         m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
+        m_adapters_per_request = m_generation_config.adapters->get_mode() == AdapterConfig::MODE_POOL;
     }
     // Extract sampler_num_threads property if exists and remove it from properties
     size_t sampler_num_threads = std::thread::hardware_concurrency();
     auto sampler_num_threads_it = filtered_properties->find("sampler_num_threads");
-    if (sampler_num_threads_it != filtered_properties->end()) {
+    const bool is_sampler_num_threads_set = sampler_num_threads_it != filtered_properties->end();
+    if (is_sampler_num_threads_set) {
         sampler_num_threads = sampler_num_threads_it->second.as<size_t>();
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
+    // Extract numa_node property if exists and remove it from properties
+    std::optional<size_t> numa_node;
+    auto numa_node_it = filtered_properties->find("numa_node");
+    if (numa_node_it != filtered_properties->end()) {
+        numa_node = numa_node_it->second.as<size_t>();
+        filtered_properties.fork().erase("numa_node");
+    }
+    // Extract device_greedy_sampling property if exists and remove it from properties
+    auto device_greedy_sampling_it = filtered_properties->find("device_greedy_sampling");
+    if (device_greedy_sampling_it != filtered_properties->end()) {
+        // select greedy tokens within the model, so that the logits do not have to be read by the sampler for such requests
+        if (device_greedy_sampling_it->second.as<bool>()) {
+            utils::apply_device_greedy_sampling_transformation(model);
+        }
+        filtered_properties.fork().erase("device_greedy_sampling");
+    }
+    // Extract the text embeddings model if exists and merge it into the model, so that it looks up the embeddings of the generated tokens
+    auto embeddings_model_it = filtered_properties->find(utils::EMBEDDINGS_MODEL_ARG_NAME);
+    if (embeddings_model_it != filtered_properties->end()) {
+        utils::apply_embeddings_lookup_transformation(model, embeddings_model_it->second.as<std::shared_ptr<ov::Model>>());
+        filtered_properties.fork().erase(utils::EMBEDDINGS_MODEL_ARG_NAME);
+    }
+    for (const auto& [name, value] : utils::get_kv_cache_precision_properties(scheduler_config.kv_cache_precision_config, *filtered_properties)) {
+        filtered_properties.fork()[name] = value;
+    }
+    // the properties of the inputs embedder
+    for (const auto& name : {ov::genai::vision_embedding_cache_size.name(), ov::genai::visual_token_keep_ratio.name()}) {
+        if (filtered_properties->count(name)) {
+            filtered_properties.fork().erase(name);
+        }
+    }
+
+    // the threads started while the pipeline is initialized, i.e. the ones of the sampler and of the inference streams
+    // created at compilation, run on the NUMA node, and so does the thread initializing the KV cache
+    std::optional<ScopedNumaAffinity> numa_affinity;
+    if (numa_node.has_value()) {
+        numa_affinity.emplace(*numa_node);
+        if (!is_sampler_num_threads_set) {
+            sampler_num_threads = get_numa_node_cpus(*numa_node).size();
+        }
+    }
 
-    ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
+    {
+        std::lock_guard<std::mutex> lock(m_memory_report_mutex);
+        m_memory_report.weights["language"] = utils::get_weights_byte_size(model);
+    }
+    m_compiled_model = utils::compile_shared_model(model, device, *filtered_properties);
+    ov::CompiledModel& compiled_model = *m_compiled_model;
     std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
     const bool all_gpu_device =
         std::all_of(execution_devices.begin(), execution_devices.end(), [&](const std::string& device) {
             return device.find("GPU") != std::string::npos;
         });
     OPENVINO_ASSERT(all_gpu_device || execution_devices.size() == 1,
-                    "Continuous batching: execution device is expected to be single CPU / single GPU / multi GPUs");
+                    "Continuous batching: execution device is expected to be single CPU / single GPU / multi GPUs, "
+                    "got ", ov::Any(execution_devices).as<std::string>(), ". Pipeline-parallel splits across heterogeneous devices are not supported, "
+                    "since the KV cache of all layers is allocated in a single device context");
     const std::string execution_device = execution_devices[0];
 
     ov::genai::utils::print_compiled_model_properties(compiled_model, "LLM with Paged Attention");
@@ -119,9 +213,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
 
     // Cache manager
     std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request);
+    if (numa_node.has_value()) {
+        cache_manager->set_numa_node(*numa_node);
+    }
     m_num_decoder_layers = cache_manager->get_num_decoder_layers();
     m_block_size = cache_manager->get_block_size();
-
+    // cache eviction and sparse attention select the blocks by their logical indices, which the release would shift
+    if (!scheduler_config.use_cache_eviction && !scheduler_config.use_sparse_attention) {
+        m_attention_window_size = utils::get_attention_window_size(model);
+    }
 
     // Scheduler configuration
     SchedulerConfig normalized_config = scheduler_config;
@@ -137,38 +237,75 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         can_use_partial_preemption = false;
     }
 
-    // Scheduler and Model Runner instantiation
+    // Model Runner and Scheduler instantiation
     bool is_use_xattention = scheduler_config.use_sparse_attention && scheduler_config.sparse_attention_config.mode == SparseAttentionMode::XATTENTION;
     bool is_use_cache_eviction = scheduler_config.use_cache_eviction;
-    if (is_use_cache_eviction) {
-        const auto& eviction_config = scheduler_config.cache_eviction_config;
-        m_scheduler = std::make_shared<Scheduler>(m_block_size, cache_manager, normalized_config, m_num_decoder_layers, can_use_partial_preemption, eviction_config.snapkv_window_size);
-
-        bool is_apply_rotation = eviction_config.apply_rotation;
-        m_model_runner = std::make_shared<ModelRunner>(infer_request,
-                                                       m_block_size,
-                                                       m_num_decoder_layers,
-                                                       /* collect_attention_scores = */ true,
-                                                       /* is_use_per_layer_cache_control = */ true,
-                                                       /* is_use_rotation_inputs = */ is_apply_rotation,
-                                                       /* is_aggregate_attention_scores = */ true,
-                                                       is_use_xattention);
-        if (eviction_config.apply_rotation) {
-            _prepare_rotation_data_storage(normalized_config, cache_manager->get_v_head_size(0));
+    bool is_use_sparse_decoding = is_sparse_decoding_enabled(scheduler_config);
+    OPENVINO_ASSERT(!(is_use_cache_eviction && is_use_sparse_decoding),
+                    "Sparse attention in generation stage (sparse_attention_config.decode_threshold < 1) cannot be used together with cache eviction");
+    // both cache eviction and sparse decoding estimate the block importance from the per-layer attention scores
+    bool is_collect_attention_scores = is_use_cache_eviction || is_use_sparse_decoding;
+    bool is_apply_rotation = is_use_cache_eviction && scheduler_config.cache_eviction_config.apply_rotation;
+    m_model_runner = std::make_shared<ModelRunner>(infer_request,
+                                                   m_block_size,
+                                                   m_num_decoder_layers,
+                                                   /* collect_attention_scores = */ is_collect_attention_scores,
+                                                   /* is_use_per_layer_cache_control = */ is_collect_attention_scores,
+                                                   /* is_use_rotation_inputs = */ is_apply_rotation,
+                                                   /* is_aggregate_attention_scores = */ is_collect_attention_scores,
+                                                   is_use_xattention);
+    if (is_apply_rotation) {
+        _prepare_rotation_trig_lut(normalized_config, cache_manager->get_v_head_size(0));
+    }
+
+    if (m_adapters_per_request) {
+        OPENVINO_ASSERT(normalized_config.prefix_cache_path.empty(),
+                        "prefix_cache_path is not supported with AdapterConfig::MODE_POOL, as the cache fingerprint doesn't identify the adapters");
+        m_model_runner->set_adapters_per_request(*m_adapter_controller);
+    }
+
+    if (normalized_config.kv_cache_memory_utilization > 0.0f && normalized_config.num_kv_blocks == 0) {
+        normalized_config.num_kv_blocks = _profile_num_kv_blocks(normalized_config, cache_manager);
+    }
+
+    size_t snapkv_window_size = is_use_cache_eviction ? scheduler_config.cache_eviction_config.snapkv_window_size : 1;
+    m_scheduler = std::make_shared<Scheduler>(m_block_size, cache_manager, normalized_config, m_num_decoder_layers, can_use_partial_preemption, snapkv_window_size);
+    if (normalized_config.kv_cache_memory_utilization > 0.0f) {
+        // the KV cache is allocated upfront, so that the pipelines created afterwards, e.g. the draft one of speculative
+        // decoding, see the memory taken
+        cache_manager->allocate_cache_if_needed(normalized_config.num_kv_blocks);
+    }
+    if (is_apply_rotation) {
+        _prepare_rotation_deltas_stores(normalized_config.num_kv_blocks);
+    }
+
+    if (is_use_sparse_decoding) {
+        const auto& sparse_attention_config = scheduler_config.sparse_attention_config;
+        m_sparse_decoding_block_selector = std::make_shared<SparseDecodingBlockSelector>(m_block_size,
+                                                                                         sparse_attention_config.decode_threshold,
+                                                                                         sparse_attention_config.decode_dense_interval,
+                                                                                         sparse_attention_config.num_retained_start_tokens_in_cache,
+                                                                                         sparse_attention_config.num_retained_recent_tokens_in_cache);
+    }
+
+    if (normalized_config.enable_prefix_caching && !m_adapters_per_request) {
+        m_prefix_cache_fingerprint = get_prefix_cache_fingerprint(model, execution_device, *cache_manager);
+        if (!normalized_config.prefix_cache_path.empty() && std::filesystem::exists(normalized_config.prefix_cache_path)) {
+            try {
+                m_scheduler->load_prefix_cache(normalized_config.prefix_cache_path, *m_prefix_cache_fingerprint);
+            } catch (const std::exception& e) {
+                // the stale file is overwritten on destruction
+                Logger::warn("Prefix cache is not loaded from " + normalized_config.prefix_cache_path.string() + ": " + e.what());
+            }
         }
-    } else {
-        m_scheduler = std::make_shared<Scheduler>(m_block_size, cache_manager, normalized_config, m_num_decoder_layers, can_use_partial_preemption);
-        m_model_runner =
-            std::make_shared<ModelRunner>(infer_request, m_block_size, m_num_decoder_layers,
-                                                       /* collect_attention_scores = */ false,
-                                                       /* is_use_per_layer_cache_control = */ false,
-                                                       /* is_use_rotation_inputs = */ false,
-                                                       /* is_aggregate_attention_scores = */ false,
-                                                       is_use_xattention);
     }
 
     m_sampler = std::make_shared<Sampler>(m_tokenizer, sampler_num_threads);
     m_sampler->set_seed(m_generation_config.rng_seed);
+    // the tokens forced by structured output grammars are scheduled as a chunk along with the next generated token
+    m_sampler->set_jump_forward_enabled(true);
+
+    m_cache_state_recorder = CacheStateRecorder::create_from_env();
 
     // If eos_token_id was not provided, take value
     if (m_generation_config.eos_token_id == -1)
@@ -176,15 +313,17 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
 };
 
 
-void ContinuousBatchingPipeline::ContinuousBatchingImpl::_prepare_rotation_data_storage(const SchedulerConfig& normalized_config, size_t embedding_size) {
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_prepare_rotation_deltas_stores(size_t num_kv_blocks) {
     m_rotation_deltas_stores.reserve(m_num_decoder_layers);
-    ov::Shape rotation_deltas_store_shape{normalized_config.num_kv_blocks, 1}; // last dim can be later changed to BLOCK_SIZE for per-token granularity
+    ov::Shape rotation_deltas_store_shape{num_kv_blocks, 1}; // last dim can be later changed to BLOCK_SIZE for per-token granularity
     for (size_t i = 0; i < m_num_decoder_layers; i++) {
         ov::Tensor store(ov::element::i32, rotation_deltas_store_shape);
         std::memset(store.data(), 0, store.get_byte_size());
         m_rotation_deltas_stores.push_back(store);
     }
+}
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_prepare_rotation_trig_lut(const SchedulerConfig& normalized_config, size_t embedding_size) {
     size_t max_sequence_cache_occupation_length_in_blocks = normalized_config.max_num_batched_tokens / m_block_size  + 1;
     m_cache_rotation_calculator = std::make_shared<CacheRotationCalculator>(
         m_block_size,
@@ -208,6 +347,98 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_prepare_rotation_data_
     m_model_runner->set_cache_rotation_trig_lut(std::move(rotation_trig_lut));
 }
 
+size_t ContinuousBatchingPipeline::ContinuousBatchingImpl::_profile_num_kv_blocks(const SchedulerConfig& normalized_config,
+                                                                                   std::shared_ptr<CacheManager> cache_manager) {
+    const float memory_utilization = normalized_config.kv_cache_memory_utilization;
+    OPENVINO_ASSERT(memory_utilization > 0.0f && memory_utilization <= 1.0f,
+                    "kv_cache_memory_utilization must be in (0, 1] range, got ", memory_utilization);
+    OPENVINO_ASSERT(normalized_config.max_num_batched_tokens != std::numeric_limits<size_t>::max(),
+                    "kv_cache_memory_utilization requires max_num_batched_tokens to be limited, as the profile run infers a batch of that many tokens");
+
+    // the model is inferred with the biggest batch the scheduler may produce, so that the plugin allocates the peak
+    // activation memory, e.g. the memory of the logits grows with the number of the sequences
+    ov::CompiledModel compiled_model = m_model_runner->get_infer_request().get_compiled_model();
+    std::optional<size_t> hidden_size;
+    bool has_token_type_ids = false;
+    for (const auto& input : compiled_model.inputs()) {
+        if (input.get_names().count("inputs_embeds")) {
+            const ov::PartialShape& shape = input.get_partial_shape();
+            hidden_size = shape[shape.rank().get_length() - 1].get_length();
+        }
+        has_token_type_ids |= input.get_names().count("token_type_ids") > 0;
+    }
+
+    const size_t num_tokens = normalized_config.max_num_batched_tokens;
+    const size_t num_sequences = std::max<size_t>(std::min(normalized_config.max_num_seqs, num_tokens), 1);
+    GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = 1;
+    std::vector<SequenceGroup::Ptr> sequence_groups;
+    size_t num_profile_blocks = 0;
+    for (size_t i = 0; i < num_sequences; ++i) {
+        const size_t prompt_len = num_tokens / num_sequences + (i < num_tokens % num_sequences ? 1 : 0);
+        std::optional<ov::Tensor> token_type_ids;
+        ov::Tensor prompt;
+        if (hidden_size) {
+            prompt = ov::Tensor(ov::element::f32, {1, prompt_len, *hidden_size});
+            std::memset(prompt.data(), 0, prompt.get_byte_size());
+            if (has_token_type_ids) {
+                token_type_ids = ov::Tensor(ov::element::i64, {1, prompt_len});
+                std::memset(token_type_ids->data(), 0, token_type_ids->get_byte_size());
+            }
+        } else {
+            prompt = ov::Tensor(ov::element::i64, {1, prompt_len});
+            std::memset(prompt.data(), 0, prompt.get_byte_size());
+        }
+        sequence_groups.push_back(std::make_shared<SequenceGroup>(i, prompt, generation_config, m_block_size, token_type_ids));
+        // a spare block for the slot the scheduler may reserve for the next token
+        num_profile_blocks += (prompt_len + m_block_size - 1) / m_block_size + 1;
+    }
+
+    SchedulerConfig profile_config = normalized_config;
+    profile_config.num_kv_blocks = num_profile_blocks;
+    profile_config.enable_prefix_caching = false;
+    profile_config.prefix_cache_path.clear();
+    profile_config.swap_space_size = 0;
+    profile_config.swap_space_disk_size = 0;
+    profile_config.scheduling_policy = SchedulingPolicy::FCFS;
+    profile_config.max_num_prefill_tokens_per_step = 0;
+    profile_config.max_prefill_fraction = 1.0f;
+    Scheduler profile_scheduler(m_block_size, cache_manager, profile_config, m_num_decoder_layers);
+    const Scheduler::Output scheduler_output = profile_scheduler.schedule(sequence_groups);
+    OPENVINO_ASSERT(scheduler_output.m_total_num_scheduled_tokens == num_tokens,
+                    "Profile run scheduled ", scheduler_output.m_total_num_scheduled_tokens, " tokens instead of ", num_tokens);
+
+    if (m_adapter_controller && !m_adapters_per_request) {
+        m_adapter_controller->apply(m_model_runner->get_infer_request(), m_generation_config.adapters);
+    }
+    m_model_runner->forward(sequence_groups, scheduler_output);
+    for (const auto& sequence_group : sequence_groups) {
+        profile_scheduler.free_sequence(sequence_group->get_sequences()[0]->get_id());
+    }
+
+    // the memory taken by the weights, the activations and the KV cache of the profile run, which is reallocated by the
+    // scheduler of the pipeline
+    const std::string device = cache_manager->get_device();
+    size_t total_memory = 0, used_memory = 0;
+    if (device.find("GPU") != std::string::npos) {
+        total_memory = utils::singleton_core().get_property(device, ov::intel_gpu::device_total_mem_size);
+        used_memory = Scheduler::get_used_gpu_memory(device);
+    } else {
+        total_memory = ReservedMemory::get_total_physical_memory();
+        used_memory = total_memory - std::min(total_memory, ReservedMemory::get_available_physical_memory());
+    }
+    const size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+    used_memory -= std::min(used_memory, num_profile_blocks * block_size_in_bytes);
+
+    const size_t memory_budget = static_cast<size_t>(total_memory * static_cast<double>(memory_utilization));
+    OPENVINO_ASSERT(memory_budget > used_memory,
+                    "No memory is left for the KV cache: kv_cache_memory_utilization ", memory_utilization, " allows ",
+                    memory_budget, " bytes, while ", used_memory, " bytes are used after the profile run");
+    const size_t num_kv_blocks = (memory_budget - used_memory) / block_size_in_bytes;
+    OPENVINO_ASSERT(num_kv_blocks > 0, "No memory is left for a single KV cache block of ", block_size_in_bytes, " bytes");
+    return num_kv_blocks;
+}
+
 GenerationHandle
 ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
     uint64_t request_id,
@@ -229,7 +460,36 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
     }
     OPENVINO_ASSERT(sampling_params.max_length > prompt_len, "'max_length' must be greater than the number of prompt tokens");
 
-    auto sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params, m_block_size, token_type_ids);
+    // token healing: the model continues the prompt without its last token, which is generated again as the start of
+    // the first token, so that the first token isn't biased by the boundary the prompt was split at
+    const bool is_token_healing = sampling_params.token_healing && prompt_len > 1 && !token_type_ids;
+    ov::Tensor prompt_ids = input_ids;
+    if (is_token_healing) {
+        prompt_ids = ov::Tensor(ov::element::i64, {1, prompt_len - 1});
+        std::copy_n(input_ids.data<int64_t>(), prompt_len - 1, prompt_ids.data<int64_t>());
+    }
+
+    size_t adapters_hash = 0;
+    if (m_adapters_per_request) {
+        // the requests without adapters use the ones of the pipeline generation config
+        if (!sampling_params.adapters) {
+            sampling_params.adapters = m_generation_config.adapters;
+        }
+        adapters_hash = get_pool_adapters_hash(*m_generation_config.adapters, *sampling_params.adapters);
+    } else if (m_adapter_controller && sampling_params.adapters) {
+        // the adapters are applied once the request is generated, their tensors are prepared meanwhile
+        m_adapter_controller->prefetch(*sampling_params.adapters);
+    }
+
+    // the per-request objects are pooled, so that short requests at a high rate do not churn the allocator
+    auto sequence_group = make_pooled<SequenceGroup>(request_id, prompt_ids, sampling_params, m_block_size, token_type_ids);
+    sequence_group->set_prefix_hash_salt(adapters_hash);
+    if (m_scheduler->get_config().streaming_transport != StreamingTransport::SYNCHRONIZED_QUEUE) {
+        sequence_group->set_streaming_transport(m_scheduler->get_config().streaming_transport);
+    }
+    if (is_token_healing) {
+        sequence_group->set_token_healing_token_id(input_ids.data<int64_t>()[prompt_len - 1]);
+    }
 
     if (m_scheduler->get_config().enable_prefix_caching) {
         m_scheduler->restore_cached_blocks(sequence_group);
@@ -240,7 +500,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
         m_awaiting_requests.push_back(sequence_group);
     }
 
-    return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
+    return make_pooled<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
 }
 
 GenerationHandle
@@ -264,6 +524,38 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
     return add_request(request_id, inputs, sampling_params);
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::pin_chat_history(const std::vector<int64_t>& token_ids) {
+    if (m_scheduler->get_config().enable_prefix_caching) {
+        m_scheduler->pin_prefix(token_ids);
+    }
+}
+
+std::vector<uint8_t> ContinuousBatchingPipeline::ContinuousBatchingImpl::export_kv_blocks(const ov::Tensor& input_ids) {
+    OPENVINO_ASSERT(m_scheduler->get_config().enable_prefix_caching, "Prefix caching must be enabled to export KV cache blocks");
+    OPENVINO_ASSERT(m_prefix_cache_fingerprint.has_value(), "Export of KV cache blocks is not supported with AdapterConfig::MODE_POOL");
+    OPENVINO_ASSERT(input_ids.get_element_type() == ov::element::i64 && input_ids.get_shape().size() == 2 && input_ids.get_shape()[0] == 1,
+                    "input_ids must be a [1, sequence_length] tensor of i64");
+    const int64_t* data = input_ids.data<const int64_t>();
+    TokenIds tokens(data, data + input_ids.get_size());
+    return m_scheduler->export_prefix_blocks(tokens, *m_prefix_cache_fingerprint);
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingImpl::import_kv_blocks(const std::vector<uint8_t>& kv_blocks) {
+    OPENVINO_ASSERT(m_scheduler->get_config().enable_prefix_caching, "Prefix caching must be enabled to import KV cache blocks");
+    OPENVINO_ASSERT(m_prefix_cache_fingerprint.has_value(), "Import of KV cache blocks is not supported with AdapterConfig::MODE_POOL");
+    return m_scheduler->import_prefix_blocks(kv_blocks, *m_prefix_cache_fingerprint);
+}
+
+PrefixCacheDigest ContinuousBatchingPipeline::ContinuousBatchingImpl::get_prefix_cache_digest() {
+    return m_scheduler->get_prefix_cache_digest();
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingImpl::shrink_kv_cache() {
+    const size_t num_kv_blocks = m_scheduler->shrink_cache();
+    _update_memory_report();
+    return num_kv_blocks;
+}
+
 bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_requests() {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
     return !m_awaiting_requests.empty() || !m_requests.empty();
@@ -275,6 +567,12 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     _pull_awaiting_requests();
 
+    // the handles are stopped / cancelled from other threads by setting the status only, so the requests dropped since
+    // the previous step and the expired ones are released here, before their KV cache blocks are scheduled again
+    _cancel_expired_requests();
+    _notify_requests_dropped_by_handle();
+    _free_non_running_requests();
+
     Scheduler::Output scheduler_output;
 
     {
@@ -284,18 +582,36 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         scheduling_timer.end();
 
         m_pipeline_metrics.scheduled_requests = scheduler_output.m_scheduled_sequence_groups_ids.size();
+        m_pipeline_metrics.scheduled_prompt_tokens = scheduler_output.m_total_num_scheduled_prompt_tokens;
+        m_pipeline_metrics.scheduled_generate_tokens = scheduler_output.m_total_num_scheduled_tokens - scheduler_output.m_total_num_scheduled_prompt_tokens;
         m_pipeline_metrics.cache_usage = scheduler_output.m_cache_usage;
         m_pipeline_metrics.max_cache_usage = std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
         _register_step_cache_usage(scheduler_output.m_cache_usage);
         m_pipeline_metrics.avg_cache_usage = _get_current_running_average_cache_usage();
+        if (m_scheduler->get_config().enable_prefix_caching) {
+            auto prefix_cache_stats = m_scheduler->get_prefix_cache_stats();
+            if (prefix_cache_stats.num_prompt_tokens > 0) {
+                m_pipeline_metrics.prefix_cache_hit_rate = static_cast<float>(prefix_cache_stats.num_restored_tokens) / prefix_cache_stats.num_prompt_tokens * 100;
+            }
+            m_pipeline_metrics.max_prefix_cache_hit_depth = prefix_cache_stats.max_restored_tokens;
+        }
 
         const auto& sched_config = m_scheduler->get_config();
-        if (sched_config.use_cache_eviction && sched_config.cache_eviction_config.apply_rotation) {
-            _compute_cache_rotation_data(m_requests, scheduler_output);
+        // the blocks are rotated only at the steps following the evictions
+        if (sched_config.use_cache_eviction && sched_config.cache_eviction_config.apply_rotation &&
+            !m_previous_evicted_block_logical_indices_per_sequence.empty()) {
+            _compute_cache_rotation_data(scheduler_output);
             m_model_runner->set_cache_rotation_data(std::move(m_current_step_rotated_block_indices_per_sequence),
                                                     std::move(m_current_step_rotation_deltas));
         }
 
+        if (m_sparse_decoding_block_selector) {
+            _schedule_sparse_decoding_skipped_blocks(scheduler_output);
+        }
+
+        m_serving_metrics.on_scheduled(m_requests, scheduler_output.m_cache_usage, m_scheduler->get_prefix_cache_stats(),
+                                       m_scheduler->get_num_preemptions());
+        _update_memory_report();
     }
 
     // if no tokens were scheduled, we are out of memory => free all requests and return
@@ -312,11 +628,20 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     }
     ov::Tensor logits;
 
+    // the candidates of speculative decoding and prompt lookup are appended to the sequences after the previous step,
+    // so they are embedded before the inference
+    if (m_model_input_type == ModelInputType::EMBEDDINGS)
+        m_model_runner->append_embeddings(m_requests, scheduler_output);
+
     {
         static ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
         timer.start();
-        logits = m_model_runner->forward(m_requests, scheduler_output);
+        m_model_runner->start_forward(m_requests, scheduler_output);
+        // while the model is being inferred, set up sampling state of newly scheduled requests,
+        // e.g. compile structured output grammars, which would otherwise delay the first sampling of these requests
+        m_sampler->prepare(m_requests);
+        logits = m_model_runner->finish_forward(m_requests, scheduler_output);
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
         timer.end();
@@ -333,6 +658,20 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         _maybe_evict_cache_blocks(sched_config, scheduler_output);
     }
 
+    if (m_sparse_decoding_block_selector) {
+        _register_sparse_decoding_scores(scheduler_output);
+    }
+
+    if (m_attention_window_size > 0) {
+        m_scheduler->release_out_of_window_blocks(m_requests, scheduler_output, m_attention_window_size);
+    }
+
+    if (m_cache_state_recorder) {
+        static const std::map<size_t, std::vector<std::set<size_t>>> no_evicted_blocks;
+        m_cache_state_recorder->record_step(*m_scheduler, m_requests,
+                                            sched_config.use_cache_eviction ? m_previous_evicted_block_logical_indices_per_sequence : no_evicted_blocks);
+    }
+
 #ifdef DEBUG_CACHE_STATE_DUMP
     CacheStateDumper dumper_after(CacheStateDumper::get_run_id_for_generation_step(step_count, "eviction"));
     dumper_after.dump_cache_state(*m_scheduler, m_requests, step_count);
@@ -346,10 +685,17 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     {
         static ManualTimer timer("sample");
         timer.start();
-        sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
+        if (m_model_runner->is_device_greedy_sampling_available() && !m_is_validation_mode_enabled &&
+            m_sampler->can_use_device_greedy_sampling(m_requests)) {
+            sampler_output = m_sampler->sample(m_requests, m_model_runner->get_device_sampled_token_log_probs(), false,
+                                               m_model_runner->get_device_sampled_token_ids());
+        } else {
+            sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
+        }
         m_batch_size = sampler_output.num_generated_tokens;
         timer.end();
     }
+    m_serving_metrics.on_sampled(m_requests);
 
     // process sampler_output (e.g. fork or drop sequences from BlockScheduler)
     {
@@ -363,8 +709,12 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
                 m_scheduler->fork_sequence(parent_id, child_id);
         }
 
-        for (auto seq_id : sampler_output.m_dropped_sequences)
+        for (auto seq_id : sampler_output.m_dropped_sequences) {
             m_scheduler->free_sequence(seq_id);
+            if (m_sparse_decoding_block_selector) {
+                m_sparse_decoding_block_selector->remove_sequence(seq_id);
+            }
+        }
 
         free_fork_timer.end();
     }
@@ -390,6 +740,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         clean_up_requests_timer.end();
     }
 
+    // once the pipeline runs out of requests, the blocks left for prefix caching are moved to the beginning of the KV
+    // cache, so that the next requests get contiguous blocks and shrink_kv_cache() releases the rest
+    if (m_requests.empty()) {
+        static ManualTimer compact_cache_timer("compact cache");
+        compact_cache_timer.start();
+        m_scheduler->compact_cache();
+        compact_cache_timer.end();
+    }
+
     step_timer.end();
 }
 
@@ -404,49 +763,77 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
                                                              const std::vector<GenerationConfig>& sampling_params,
                                                              const StreamerVariant& streamer,
                                                              const std::optional<std::vector<ov::Tensor>> token_type_ids) {
+    std::vector<std::future<PromptEmbeddings>> prompts_embeddings;
+    for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
+        bool has_valid_token = token_type_ids.has_value() && request_id < token_type_ids->size();
+        std::promise<PromptEmbeddings> prompt_embeddings;
+        prompt_embeddings.set_value({input_ids[request_id], has_valid_token ? std::make_optional((*token_type_ids)[request_id]) : std::nullopt});
+        prompts_embeddings.push_back(prompt_embeddings.get_future());
+    }
+    return generate(prompts_embeddings, sampling_params, streamer);
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(std::vector<std::future<PromptEmbeddings>>& prompts_embeddings,
+                                                             const std::vector<GenerationConfig>& sampling_params,
+                                                             const StreamerVariant& streamer) {
 
     _reset_cache_usage_statistics();
     ManualTimer generate_timer("generate()");
     generate_timer.start();
 
     OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
-    OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+    OPENVINO_ASSERT(prompts_embeddings.size() == sampling_params.size());
 
     auto start_time =  std::chrono::steady_clock::now();
     PerfMetrics perf_metrics;
     auto& raw_perf_counters = perf_metrics.raw_metrics;
     raw_perf_counters.m_inference_durations =  {{ MicroSeconds(0.0f) }};
 
-    // checks that all requests has the same LoRA adapters property value
-    for (size_t i = 1; i < sampling_params.size(); ++i) {
-        OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
-            "LoRA adapters value must be the same for all requests");
+    // checks that all requests has the same LoRA adapters property value, unless each request has its own adapters
+    if (!m_adapters_per_request) {
+        for (size_t i = 1; i < sampling_params.size(); ++i) {
+            OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
+                "LoRA adapters value must be the same for all requests");
+        }
+        set_adapters(sampling_params[0].adapters);
     }
-    set_adapters(sampling_params[0].adapters);
 
     const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
 
-    OPENVINO_ASSERT(!streamer_ptr->has_callback() || input_ids.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
+    OPENVINO_ASSERT(!streamer_ptr->has_callback() || prompts_embeddings.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
         (sampling_params[0].is_greedy_decoding() || sampling_params[0].is_multinomial()),
         "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
 
     std::vector<GenerationHandle> generations;
-    for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
-        OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
-        bool has_valid_token = token_type_ids.has_value() && request_id < token_type_ids->size();
-        generations.push_back(
-            add_request(request_id, input_ids[request_id], sampling_params[request_id], has_valid_token ? std::make_optional((*token_type_ids)[request_id]) : std::nullopt)
-        );
-    }
-
-    auto all_requests = get_awaiting_requests(); // we need to store all requests to get results from them once generation has finished
+    std::vector<SequenceGroup::Ptr> all_requests; // we need to store all requests to get results from them once generation has finished
+    // the requests are added in order, a request waits for its embeddings only if no request is running meanwhile
+    const auto add_ready_requests = [&] {
+        while (generations.size() < prompts_embeddings.size()) {
+            const size_t request_id = generations.size();
+            if (has_non_finished_requests() &&
+                prompts_embeddings[request_id].wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                return;
+            }
+            PromptEmbeddings prompt_embeddings = prompts_embeddings[request_id].get();
+            OPENVINO_ASSERT(1 == prompt_embeddings.inputs_embeds.get_shape().at(0), "Use multiple tensors to pass a batch.");
+            generations.push_back(
+                add_request(request_id, prompt_embeddings.inputs_embeds, sampling_params[request_id], prompt_embeddings.token_type_ids)
+            );
+            // the request is awaiting until the next step
+            all_requests.push_back(get_awaiting_requests().back());
+        }
+    };
+    add_ready_requests();
 
-    GenerationHandle& generation = generations.at(0);
+    // a copy, since the handles of the requests added later may reallocate the vector
+    GenerationHandle generation = generations.at(0);
 
     streamer_ptr->start();
     m_sampler->clear_structured_output_compile_times();
-    while (has_non_finished_requests()) {
+    while (generations.size() < prompts_embeddings.size() || has_non_finished_requests()) {
         try {
+            add_ready_requests();
             const auto infer_start = std::chrono::steady_clock::now();
             step();
             
@@ -493,6 +880,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         result.m_generation_ids.resize(num_outputs);
         result.m_scores.resize(num_outputs);
         result.m_status = request->get_generation_stream()->get_status();
+        result.request_metrics = request->get_request_metrics();
 
         for (size_t i = 0; i < num_outputs; ++i) {
             const auto & sequence = sequences[i];
@@ -517,7 +905,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         results.push_back(std::move(result));
     }
 
-    OPENVINO_ASSERT(results.size() == input_ids.size());
+    OPENVINO_ASSERT(results.size() == prompts_embeddings.size());
 
     generate_timer.end();
     return results;
@@ -532,8 +920,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
                 if (m_scheduler->has_block_table(sequence->get_id())) {
                     m_scheduler->free_sequence(sequence->get_id());
                 }
+                if (m_scheduler->is_swapped_out(sequence->get_id())) {
+                    m_scheduler->free_swapped_sequence(sequence->get_id());
+                }
+                if (m_sparse_decoding_block_selector) {
+                    m_sparse_decoding_block_selector->remove_sequence(sequence->get_id());
+                }
             }
             m_sampler->clear_request_info(request->get_request_id());
+            m_serving_metrics.on_finished(request->get_request_id());
             requests_iterator = m_requests.erase(requests_iterator);
         } else {
             requests_iterator++;
@@ -550,6 +945,32 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_notify_requests_droppe
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_cancel_expired_requests() {
+    const auto now = std::chrono::steady_clock::now();
+    for (SequenceGroup::Ptr& request : m_requests) {
+        if (!request->has_finished() && !request->handle_stopped() && !request->handle_cancelled() && request->is_expired(now)) {
+            request->set_generation_status(GenerationStatus::CANCEL);
+        }
+    }
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_update_memory_report() {
+    std::lock_guard<std::mutex> lock(m_memory_report_mutex);
+    m_memory_report.kv_cache_allocated = m_scheduler->get_kv_cache_size_in_bytes();
+    m_memory_report.kv_cache_used = m_scheduler->get_used_kv_cache_size_in_bytes();
+    m_memory_report.prefix_cache = m_scheduler->get_prefix_cache_size_in_bytes();
+    m_memory_report.kv_cache_swap_space = m_scheduler->get_host_swap_space_size_in_bytes();
+    // the buffers of the inputs of the previous step, since the inputs of this step are not prepared yet
+    m_memory_report.input_buffers = m_model_runner->get_input_buffers_byte_size();
+    if (m_inputs_embedder) {
+        m_memory_report.vision_embedding_cache = m_inputs_embedder->get_vision_embedding_cache_byte_size();
+    }
+
+    m_pipeline_metrics.peak_kv_cache_used_bytes = std::max(m_pipeline_metrics.peak_kv_cache_used_bytes, m_memory_report.kv_cache_used);
+    m_pipeline_metrics.peak_kv_cache_allocated_bytes = std::max(m_pipeline_metrics.peak_kv_cache_allocated_bytes, m_memory_report.kv_cache_allocated);
+    m_pipeline_metrics.peak_memory_bytes = std::max(m_pipeline_metrics.peak_memory_bytes, m_memory_report.get_total_bytes());
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_step_cache_usage(float step_cache_usage) {
     if (m_previous_step_cache_usages.size() >= AVG_CACHE_USAGE_WINDOW_SIZE_IN_STEPS) {
         m_previous_step_cache_usages.pop_front();
@@ -573,32 +994,16 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests() {
             if (m_scheduler->has_block_table(sequence->get_id())) {
                 m_scheduler->free_sequence(sequence->get_id());
             }
+            if (m_scheduler->is_swapped_out(sequence->get_id())) {
+                m_scheduler->free_swapped_sequence(sequence->get_id());
+            }
         }
         m_sampler->clear_request_info(request->get_request_id());
     }
     m_requests.clear();
 }
 
-void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation_data(const std::vector<SequenceGroup::Ptr>& sequence_groups,
-        const Scheduler::Output& scheduler_output) {
-    size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
-    std::map<size_t, size_t> live_seq_ids_to_num_occupied_blocks;
-    for (size_t i = 0; i < num_sequence_groups; ++i) {
-        size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
-        SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
-        std::vector<Sequence::CPtr> running_sequences = sequence_group->get_running_sequences();
-        size_t num_running_sequences = running_sequences.size();
-
-        for (size_t i = 0; i < num_running_sequences; ++i) {
-            Sequence::CPtr sequence = running_sequences[i];
-            size_t num_blocks = sequence_group->get_num_logical_blocks();
-            size_t seq_id = sequence->get_id();
-            OPENVINO_ASSERT(live_seq_ids_to_num_occupied_blocks.find(seq_id) == live_seq_ids_to_num_occupied_blocks.end(),
-                    "duplicate seq_id ", seq_id, " among sequence groups");
-            live_seq_ids_to_num_occupied_blocks[seq_id] = num_blocks;
-        }
-    }
-
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation_data(const Scheduler::Output& scheduler_output) {
     // necessary since we move from these members during previous steps
     m_current_step_rotated_block_indices_per_sequence.clear();
     m_current_step_rotated_block_indices_per_sequence.resize(m_num_decoder_layers);
@@ -610,8 +1015,8 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation
     for (const auto& seq_id_and_evicted_blocks : m_previous_evicted_block_logical_indices_per_sequence) {
         size_t seq_id = seq_id_and_evicted_blocks.first;
         // Skip sequences that, in the meanwhile before previous step's forward execution and now,
-        // have left the cache (e.g. finished or were preempted)
-        if (live_seq_ids_to_num_occupied_blocks.find(seq_id) == live_seq_ids_to_num_occupied_blocks.end()) {
+        // have left the cache (e.g. finished or were preempted), i.e. aren't scheduled at this step
+        if (scheduler_output.m_block_tables.find(seq_id) == scheduler_output.m_block_tables.end()) {
             continue;
         }
 
@@ -651,6 +1056,36 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation
 }
 
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_schedule_sparse_decoding_skipped_blocks(Scheduler::Output& scheduler_output) {
+    for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+        const SequenceGroup::Ptr& sequence_group = m_requests[seq_group_id];
+        if (!sequence_group->can_generate_tokens()) {
+            // prefill is handled by the scheduler
+            continue;
+        }
+        for (const auto& sequence : sequence_group->get_running_sequences()) {
+            uint64_t seq_id = sequence->get_id();
+            auto skipped_blocks = m_sparse_decoding_block_selector->get_skipped_blocks(seq_id, sequence_group->get_num_processed_tokens());
+            if (!skipped_blocks.empty()) {
+                scheduler_output.m_sparse_attention_skipped_logical_blocks[seq_id] = std::move(skipped_blocks);
+                scheduler_output.m_apply_sparse_attention_mask = true;
+            }
+        }
+    }
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_sparse_decoding_scores(const Scheduler::Output& scheduler_output) {
+    const auto& skip_map = scheduler_output.m_sparse_attention_skipped_logical_blocks;
+    for (const auto& seq_id_and_attention_scores : m_model_runner->get_last_attention_scores()) {
+        auto seq_id = seq_id_and_attention_scores.first;
+        // the scores of sparse steps only cover the attended blocks, so only the dense steps refresh the estimates
+        auto it = skip_map.find(seq_id);
+        if (it == skip_map.end() || it->second.empty()) {
+            m_sparse_decoding_block_selector->register_scores(seq_id, seq_id_and_attention_scores.second);
+        }
+    }
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_maybe_evict_cache_blocks(const SchedulerConfig& sched_config, const Scheduler::Output& scheduler_output) {
     std::unordered_map<SequenceGroup::Ptr, size_t> seq_group_to_num_blocks_evicted_map;
     auto sequence_attention_scores = m_model_runner->get_last_attention_scores();
@@ -680,7 +1115,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_maybe_evict_cache_bloc
 
         if (skip_set.empty()) {
             // For now, will only register token scores from the dense attention stages
-            cache_eviction_algo.register_new_token_scores(attention_scores_for_all_decoder_layers, skip_set, scheduler_output.m_score_aggregation_windows.at(seq_id));
+            cache_eviction_algo.register_new_token_scores(attention_scores_for_all_decoder_layers, skip_set, scheduler_output.m_score_aggregation_windows.at(seq_id), &m_sampler->get_thread_pool());
         }
 
         auto seq_group_ptr_it = std::find_if(m_requests.begin(), m_requests.end(), [seq_id](const SequenceGroup::Ptr& val) { return val->has_sequence_with_id(seq_id); });
@@ -695,7 +1130,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_maybe_evict_cache_bloc
         m_previous_num_blocks_before_eviction_per_sequence[seq_id] = seq_group_ptr->get_num_logical_blocks();
 
         auto logical_blocks_to_evict = cache_eviction_algo.evict_logical_blocks();
-        m_previous_evicted_block_logical_indices_per_sequence[seq_id] = logical_blocks_to_evict;
+        // only the sequences with evicted blocks are kept, so that no rotation is set at the steps without evictions
+        if (CacheEvictionAlgorithm::has_evicted_blocks(logical_blocks_to_evict)) {
+            m_previous_evicted_block_logical_indices_per_sequence[seq_id] = logical_blocks_to_evict;
+        }
 
         m_scheduler->free_blocks_from_sequence(seq_id, logical_blocks_to_evict);
 
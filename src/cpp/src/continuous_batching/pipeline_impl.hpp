@@ -7,6 +7,8 @@
 
 #include "openvino/genai/lora_adapter.hpp"
 #include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/cache_state_recorder.hpp"
+#include "continuous_batching/sparse_attention.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
 namespace ov::genai {
@@ -15,7 +17,11 @@ class ContinuousBatchingPipeline::ContinuousBatchingImpl : public ContinuousBatc
 protected:
     std::shared_ptr<Scheduler> m_scheduler;
     std::shared_ptr<ModelRunner> m_model_runner;
+    // the compiled model shared with the other pipelines of the process
+    std::shared_ptr<ov::CompiledModel> m_compiled_model;
     std::optional<AdapterController> m_adapter_controller;
+    // whether each request is inferred with its own adapters, which requires AdapterConfig::MODE_POOL
+    bool m_adapters_per_request = false;
     std::shared_ptr<Sampler> m_sampler;
 
     // current requests to process
@@ -27,6 +33,15 @@ protected:
 
     std::map<size_t, CacheEvictionAlgorithm> m_seq_group_id_to_cache_eviction_algo_map;
 
+    // selects the KV cache blocks skipped in generation stage if sparse decoding is enabled, nullptr otherwise
+    std::shared_ptr<SparseDecodingBlockSelector> m_sparse_decoding_block_selector;
+    // set by OV_GENAI_CACHE_STATE_FILE environment variable
+    std::unique_ptr<CacheStateRecorder> m_cache_state_recorder;
+
+    // fingerprint of the KV cache blocks saved to SchedulerConfig::prefix_cache_path on destruction and of the exported
+    // ones, std::nullopt if prefix caching is disabled or the adapters are set per request
+    std::optional<uint64_t> m_prefix_cache_fingerprint;
+
     static const size_t AVG_CACHE_USAGE_WINDOW_SIZE_IN_STEPS = 1000;
     std::deque<float> m_previous_step_cache_usages;
 
@@ -40,6 +55,10 @@ protected:
     size_t m_num_decoder_layers = 0;
     size_t m_block_size = 0;
 
+    // the sliding window of the attention of all the decoder layers, the older blocks are released, see `Scheduler::release_out_of_window_blocks`,
+    // 0 if a layer attends to the whole context
+    size_t m_attention_window_size = 0;
+
     // Pre-allocated per-layer storages for the per-token cache re-rotation deltas used in cache eviction case
     std::vector<ov::Tensor> m_rotation_deltas_stores;
 
@@ -80,6 +99,11 @@ protected:
      */
     void _notify_requests_dropped_by_handle();
 
+    /**
+     * Cancels the requests, which run past their GenerationConfig::deadline_ms
+     */
+    void _cancel_expired_requests();
+
     /**
      * Handles 'echo' generation parameter
      */
@@ -90,14 +114,39 @@ protected:
      */
     void _maybe_evict_cache_blocks(const SchedulerConfig& sched_config, const Scheduler::Output& scheduler_output);
 
+    /**
+     * Adds the KV cache blocks to be skipped by the generation stage sequences at this step to the scheduler output
+     */
+    void _schedule_sparse_decoding_skipped_blocks(Scheduler::Output& scheduler_output);
+
+    /**
+     * Refreshes the block importance estimates of sparse decoding from the attention scores of dense steps
+     */
+    void _register_sparse_decoding_scores(const Scheduler::Output& scheduler_output);
+
+    /**
+     * Refreshes the memory report and the peaks of the memory in the pipeline metrics after scheduling a step
+     */
+    void _update_memory_report();
+
     void _register_step_cache_usage(float step_cache_usage);
     void _reset_cache_usage_statistics();
     float _get_current_running_average_cache_usage() const;
-    void _compute_cache_rotation_data(const std::vector<SequenceGroup::Ptr>& sequence_groups, const Scheduler::Output& scheduler_output);
-    void _prepare_rotation_data_storage(const SchedulerConfig& normalized_config, size_t embedding_size);
+    void _compute_cache_rotation_data(const Scheduler::Output& scheduler_output);
+
+    void _prepare_rotation_trig_lut(const SchedulerConfig& normalized_config, size_t embedding_size);
+    void _prepare_rotation_deltas_stores(size_t num_kv_blocks);
+
+    /**
+     * Infers a dummy batch of the max size and derives the number of KV cache blocks from the device memory left
+     * according to SchedulerConfig::kv_cache_memory_utilization
+     */
+    size_t _profile_num_kv_blocks(const SchedulerConfig& normalized_config, std::shared_ptr<CacheManager> cache_manager);
 
     virtual void drop_requests();
 
+    void pin_chat_history(const std::vector<int64_t>& token_ids) override;
+
 public:
     ContinuousBatchingImpl(const std::shared_ptr<ov::Model>& model,
                            const Tokenizer& tokenizer,
@@ -129,6 +178,14 @@ public:
 
     bool has_non_finished_requests() override;
 
+    std::vector<uint8_t> export_kv_blocks(const ov::Tensor& input_ids) override;
+
+    size_t import_kv_blocks(const std::vector<uint8_t>& kv_blocks) override;
+
+    PrefixCacheDigest get_prefix_cache_digest() override;
+
+    size_t shrink_kv_cache() override;
+
     void step() override;
 
     std::vector<EncodedGenerationResult>
@@ -137,11 +194,22 @@ public:
              const StreamerVariant& streamer,
              std::optional<std::vector<ov::Tensor>> token_type_ids = std::nullopt) override;
 
+    std::vector<EncodedGenerationResult>
+    generate(std::vector<std::future<PromptEmbeddings>>& prompts_embeddings,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer) override;
+
     /**
      * Updates LoRA adapters for current generation call
      */
     void set_adapters(const std::optional<AdapterConfig>& adapters);
 
+    /**
+     * Makes the pipeline run the model on the prompt embeddings, the generated tokens are embedded by the embedding
+     * model of the inputs embedder
+     */
+    void set_inputs_embedder(std::shared_ptr<InputsEmbedder> inputs_embedder);
+
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
 };
 } // namespace ov::genai
@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+#include <algorithm>
+
+#include "content_hash.hpp"
+#include "sequence_group.hpp"
+
+namespace {
+
+// 16 bits and 8 probes per block keep the false positive rate of the bloom filter at about 0.06%
+constexpr size_t BITS_PER_BLOCK = 16;
+constexpr size_t NUM_PROBES = 8;
+
+size_t get_num_bits(const std::vector<uint64_t>& bloom_filter) {
+    return bloom_filter.size() * 64;
+}
+
+// the probes are derived from two independent hashes of the block hash by double hashing
+template <typename Visitor>
+void visit_probes(uint64_t block_hash, size_t num_bits, Visitor visitor) {
+    const uint64_t first = ov::genai::detail::mix_hash(block_hash);
+    const uint64_t second = ov::genai::detail::mix_hash(block_hash ^ 0x9E3779B97F4A7C15ull) | 1;
+    for (size_t probe = 0; probe < NUM_PROBES; ++probe) {
+        visitor((first + probe * second) % num_bits);
+    }
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+PrefixCacheDigest::PrefixCacheDigest(size_t block_size, const std::vector<uint64_t>& block_hashes)
+    : block_size(block_size),
+      num_blocks(block_hashes.size()),
+      bloom_filter(std::max<size_t>(1, (block_hashes.size() * BITS_PER_BLOCK + 63) / 64), 0) {
+    const size_t num_bits = get_num_bits(bloom_filter);
+    for (uint64_t block_hash : block_hashes) {
+        visit_probes(block_hash, num_bits, [this] (size_t bit) {
+            bloom_filter[bit / 64] |= uint64_t{1} << (bit % 64);
+        });
+    }
+}
+
+std::vector<uint64_t> PrefixCacheDigest::get_block_hashes(const std::vector<int64_t>& token_ids, size_t block_size) {
+    OPENVINO_ASSERT(block_size > 0, "block_size must be positive");
+    std::vector<uint64_t> block_hashes;
+    if (token_ids.size() < block_size) {
+        return block_hashes;
+    }
+    auto sequence_group = std::make_shared<SequenceGroup>(0, TokenIds(token_ids.begin(), token_ids.end()), GenerationConfig{}, block_size);
+    const auto& sequence = sequence_group->get_sequences()[0];
+    block_hashes.reserve(token_ids.size() / block_size);
+    for (size_t content_len = block_size; content_len <= token_ids.size(); content_len += block_size) {
+        block_hashes.push_back(sequence->get_hash(content_len));
+    }
+    return block_hashes;
+}
+
+bool PrefixCacheDigest::contains(uint64_t block_hash) const {
+    if (num_blocks == 0) {
+        return false;
+    }
+    bool is_set = true;
+    visit_probes(block_hash, get_num_bits(bloom_filter), [&] (size_t bit) {
+        is_set = is_set && (bloom_filter[bit / 64] >> (bit % 64) & 1);
+    });
+    return is_set;
+}
+
+size_t PrefixCacheDigest::get_num_cached_blocks(const std::vector<uint64_t>& block_hashes) const {
+    size_t num_cached_blocks = 0;
+    while (num_cached_blocks < block_hashes.size() && contains(block_hashes[num_cached_blocks])) {
+        ++num_cached_blocks;
+    }
+    return num_cached_blocks;
+}
+
+}  // namespace ov::genai
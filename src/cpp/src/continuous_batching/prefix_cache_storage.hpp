@@ -0,0 +1,287 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "continuous_batching/block_manager.hpp"
+#include "continuous_batching/cache_manager.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+/**
+ * Header of the file persisting the KV cache blocks reusable by prefix caching. The blocks can only be reused by
+ * the pipeline with the same fingerprint (i.e. model, device and KV cache precisions) and the same KV cache layout.
+ *
+ * File layout: the header, followed by `num_blocks` records of
+ * [hash, has_parent_hash, parent_hash, num_tokens, tokens, contents of the block for each layer].
+ * The contents of a block for a layer are the keys followed by the values, `layer_block_sizes_in_bytes[layer]` bytes in total.
+ */
+struct PrefixCacheFileHeader {
+    static constexpr uint64_t MAGIC = 0x45484341435850ull;  // "PXCACHE"
+    // bumped whenever the block hashes change, e.g. 2 is for the 128 bit chained hashes, so that the older files are rejected
+    static constexpr uint64_t VERSION = 2;
+
+    uint64_t fingerprint = 0;
+    uint64_t block_size = 0;
+    std::vector<uint64_t> layer_block_sizes_in_bytes;
+    uint64_t num_blocks = 0;
+
+    bool is_compatible(const PrefixCacheFileHeader& other) const {
+        return fingerprint == other.fingerprint && block_size == other.block_size &&
+               layer_block_sizes_in_bytes == other.layer_block_sizes_in_bytes;
+    }
+
+    size_t get_block_size_in_bytes() const {
+        size_t block_size_in_bytes = 0;
+        for (uint64_t layer_block_size_in_bytes : layer_block_sizes_in_bytes) {
+            block_size_in_bytes += layer_block_size_in_bytes;
+        }
+        return block_size_in_bytes;
+    }
+};
+
+namespace detail {
+
+// appends the written bytes to the vector, so that the blocks are exported without the intermediate copies
+class VectorStreamBuf : public std::streambuf {
+public:
+    explicit VectorStreamBuf(std::vector<uint8_t>& data) : m_data(data) {}
+
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        m_data.insert(m_data.end(), reinterpret_cast<const uint8_t*>(s), reinterpret_cast<const uint8_t*>(s) + n);
+        return n;
+    }
+
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            m_data.push_back(static_cast<uint8_t>(traits_type::to_char_type(ch)));
+        }
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    std::vector<uint8_t>& m_data;
+};
+
+// reads the bytes in place, so that the blocks are imported without copying them into a string first
+class SpanStreamBuf : public std::streambuf {
+public:
+    SpanStreamBuf(const uint8_t* data, size_t size) {
+        // the get area is only read
+        char* begin = reinterpret_cast<char*>(const_cast<uint8_t*>(data));
+        setg(begin, begin, begin + size);
+    }
+};
+
+inline void write_u64(std::ostream& stream, uint64_t value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+inline uint64_t read_u64(std::istream& stream) {
+    uint64_t value = 0;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    OPENVINO_ASSERT(stream.good(), "Prefix cache file is truncated");
+    return value;
+}
+
+inline void hash_combine(uint64_t& seed, uint64_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+}  // namespace detail
+
+/**
+ * @return The fingerprint identifying the KV cache blocks computed with a model on a device, with the KV cache
+ * precisions of a cache manager.
+ */
+inline uint64_t get_prefix_cache_fingerprint(const std::shared_ptr<const ov::Model>& model, const std::string& device, const CacheManager& cache_manager) {
+    uint64_t fingerprint = utils::get_model_fingerprint(model);
+    std::hash<std::string> string_hash;
+    detail::hash_combine(fingerprint, string_hash(device));
+    for (size_t layer_idx = 0; layer_idx < cache_manager.get_num_decoder_layers(); ++layer_idx) {
+        detail::hash_combine(fingerprint, string_hash(cache_manager.get_key_cache_precision(layer_idx).get_type_name() +
+                                                      cache_manager.get_value_cache_precision(layer_idx).get_type_name()));
+    }
+    return fingerprint;
+}
+
+/**
+ * Writes the header and the block records of the prefix cache format to a stream, e.g. to a file or to a buffer of
+ * the KV cache blocks transferred to another pipeline.
+ */
+class PrefixCacheWriter {
+public:
+    PrefixCacheWriter(std::ostream& stream, const PrefixCacheFileHeader& header) : m_stream(stream), m_header(header) {
+        detail::write_u64(m_stream, PrefixCacheFileHeader::MAGIC);
+        detail::write_u64(m_stream, PrefixCacheFileHeader::VERSION);
+        detail::write_u64(m_stream, header.fingerprint);
+        detail::write_u64(m_stream, header.block_size);
+        detail::write_u64(m_stream, header.layer_block_sizes_in_bytes.size());
+        for (uint64_t layer_block_size_in_bytes : header.layer_block_sizes_in_bytes) {
+            detail::write_u64(m_stream, layer_block_size_in_bytes);
+        }
+        detail::write_u64(m_stream, header.num_blocks);
+    }
+
+    /**
+     * @param block The reusable prefix block, its `blocks` field is ignored.
+     * @param data The contents of the block for all layers, header.get_block_size_in_bytes() bytes.
+     */
+    void write_block(const PrefixCacheBlock& block, const std::vector<uint8_t>& data) {
+        OPENVINO_ASSERT(m_num_written_blocks < m_header.num_blocks, "Too many blocks written to the prefix cache file");
+        OPENVINO_ASSERT(data.size() == m_header.get_block_size_in_bytes());
+        detail::write_u64(m_stream, block.hash);
+        detail::write_u64(m_stream, block.parent_hash.has_value());
+        detail::write_u64(m_stream, block.parent_hash.value_or(0));
+        detail::write_u64(m_stream, block.tokens.size());
+        m_stream.write(reinterpret_cast<const char*>(block.tokens.data()), block.tokens.size() * sizeof(int64_t));
+        m_stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+        ++m_num_written_blocks;
+    }
+
+    bool is_complete() const {
+        return m_num_written_blocks == m_header.num_blocks;
+    }
+
+private:
+    std::ostream& m_stream;
+    PrefixCacheFileHeader m_header;
+    size_t m_num_written_blocks = 0;
+};
+
+/**
+ * Writes the prefix cache file to a temporary file next to the destination one, which replaces the destination file
+ * on commit, so that an interrupted write never leaves a corrupted file behind.
+ */
+class PrefixCacheFileWriter {
+public:
+    PrefixCacheFileWriter(const std::filesystem::path& path, const PrefixCacheFileHeader& header) :
+            m_path(path), m_tmp_path(path.string() + ".tmp") {
+        m_stream.open(m_tmp_path, std::ios::binary | std::ios::trunc);
+        OPENVINO_ASSERT(m_stream.is_open(), "Failed to open prefix cache file ", m_tmp_path, " for writing");
+        m_writer.emplace(m_stream, header);
+    }
+
+    ~PrefixCacheFileWriter() {
+        if (!m_is_committed) {
+            m_stream.close();
+            std::error_code ec;
+            std::filesystem::remove(m_tmp_path, ec);
+        }
+    }
+
+    // see PrefixCacheWriter::write_block
+    void write_block(const PrefixCacheBlock& block, const std::vector<uint8_t>& data) {
+        m_writer->write_block(block, data);
+    }
+
+    void commit() {
+        OPENVINO_ASSERT(m_writer->is_complete(), "Not all blocks were written to the prefix cache file");
+        m_stream.close();
+        OPENVINO_ASSERT(!m_stream.fail(), "Failed to write prefix cache file ", m_tmp_path);
+        std::filesystem::rename(m_tmp_path, m_path);
+        m_is_committed = true;
+    }
+
+private:
+    std::filesystem::path m_path, m_tmp_path;
+    std::ofstream m_stream;
+    std::optional<PrefixCacheWriter> m_writer;
+    bool m_is_committed = false;
+};
+
+/**
+ * Reads the prefix cache format written by PrefixCacheWriter from a stream block by block, so that the blocks are
+ * streamed into the KV cache without loading all of them into memory.
+ */
+class PrefixCacheReader {
+public:
+    explicit PrefixCacheReader(std::istream& stream) : m_stream(stream) {
+        OPENVINO_ASSERT(detail::read_u64(m_stream) == PrefixCacheFileHeader::MAGIC, "The data is not in the prefix cache format");
+        OPENVINO_ASSERT(detail::read_u64(m_stream) == PrefixCacheFileHeader::VERSION, "Unsupported version of the prefix cache format");
+        m_header.fingerprint = detail::read_u64(m_stream);
+        m_header.block_size = detail::read_u64(m_stream);
+        m_header.layer_block_sizes_in_bytes.resize(detail::read_u64(m_stream));
+        for (uint64_t& layer_block_size_in_bytes : m_header.layer_block_sizes_in_bytes) {
+            layer_block_size_in_bytes = detail::read_u64(m_stream);
+        }
+        m_header.num_blocks = detail::read_u64(m_stream);
+    }
+
+    const PrefixCacheFileHeader& get_header() const {
+        return m_header;
+    }
+
+    /**
+     * Reads the next block record.
+     * @param[out] block The reusable prefix block, its `blocks` field is left untouched.
+     * @param[out] data The contents of the block for all layers.
+     * @return Whether the block was read, false if all blocks have already been read.
+     */
+    bool read_block(PrefixCacheBlock& block, std::vector<uint8_t>& data) {
+        if (m_num_read_blocks == m_header.num_blocks) {
+            return false;
+        }
+        block.hash = detail::read_u64(m_stream);
+        const bool has_parent_hash = detail::read_u64(m_stream) != 0;
+        const uint64_t parent_hash = detail::read_u64(m_stream);
+        block.parent_hash = has_parent_hash ? std::optional<size_t>(parent_hash) : std::nullopt;
+        const uint64_t num_tokens = detail::read_u64(m_stream);
+        OPENVINO_ASSERT(num_tokens <= m_header.block_size, "Prefix cache file is corrupted");
+        block.tokens.resize(num_tokens);
+        m_stream.read(reinterpret_cast<char*>(block.tokens.data()), num_tokens * sizeof(int64_t));
+        data.resize(m_header.get_block_size_in_bytes());
+        m_stream.read(reinterpret_cast<char*>(data.data()), data.size());
+        OPENVINO_ASSERT(m_stream.good(), "Prefix cache file is truncated");
+        ++m_num_read_blocks;
+        return true;
+    }
+
+private:
+    std::istream& m_stream;
+    PrefixCacheFileHeader m_header;
+    size_t m_num_read_blocks = 0;
+};
+
+/**
+ * Reads the prefix cache file written by PrefixCacheFileWriter, see PrefixCacheReader.
+ */
+class PrefixCacheFileReader {
+public:
+    explicit PrefixCacheFileReader(const std::filesystem::path& path) : m_stream(path, std::ios::binary) {
+        OPENVINO_ASSERT(m_stream.is_open(), "Failed to open prefix cache file ", path);
+        m_reader.emplace(m_stream);
+    }
+
+    const PrefixCacheFileHeader& get_header() const {
+        return m_reader->get_header();
+    }
+
+    // see PrefixCacheReader::read_block
+    bool read_block(PrefixCacheBlock& block, std::vector<uint8_t>& data) {
+        return m_reader->read_block(block, data);
+    }
+
+private:
+    std::ifstream m_stream;
+    std::optional<PrefixCacheReader> m_reader;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,210 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief A radix tree over the token contents of KV cache blocks, allowing to find the longest cached prefix of a
+ * token sequence in a single traversal instead of computing and looking up the chained hash of each prefix block.
+ * Each node corresponds to a single KV cache block and is labeled with the tokens of that block. The node also stores the
+ * (prefix-based) hash under which the block is known to the ov::genai::BlockAllocator, so that the matched blocks can
+ * be retrieved from there. Nodes labeled with less than a block size worth of tokens (i.e. partially filled blocks)
+ * are always leaves. The tree does not own the blocks - the nodes may become stale once the corresponding blocks are
+ * overwritten, and are expected to be removed by the user with `erase` or `prune` in such case.
+ */
+class PrefixTree {
+public:
+    struct Node {
+        std::vector<int64_t> tokens;
+        size_t hash = 0;
+        Node* parent = nullptr;
+        std::map<std::vector<int64_t>, std::unique_ptr<Node>> children;
+    };
+
+    PrefixTree() = default;
+    PrefixTree(const PrefixTree&) = delete;
+    PrefixTree& operator=(const PrefixTree&) = delete;
+
+    /**
+     * @return The root node of the tree, which does not correspond to any block.
+     */
+    const Node* root() const {
+        return &m_root;
+    }
+
+    /**
+     * Adds a block node to the tree.
+     * @param parent_hash Hash of the previous block in the sequence, or std::nullopt if the block is the first one.
+     * @param tokens Tokens stored in the block.
+     * @param hash Hash of the block.
+     * @return Whether the node was added. The node is not added if the parent block is not known to the tree,
+     * since it would not be reachable by traversal anyway.
+     */
+    bool insert(std::optional<size_t> parent_hash, std::vector<int64_t> tokens, size_t hash) {
+        auto existing_it = m_nodes_by_hash.find(hash);
+        if (existing_it != m_nodes_by_hash.end()) {
+            Node* existing = existing_it->second;
+            if (existing->tokens == tokens && (parent_hash.has_value() ? existing->parent != &m_root && existing->parent->hash == *parent_hash : existing->parent == &m_root)) {
+                return true;
+            }
+            // hash collision or outdated node - the latest block wins
+            _erase_subtree(existing);
+        }
+
+        Node* parent = &m_root;
+        if (parent_hash.has_value()) {
+            auto parent_it = m_nodes_by_hash.find(*parent_hash);
+            if (parent_it == m_nodes_by_hash.end()) {
+                return false;
+            }
+            parent = parent_it->second;
+        }
+
+        auto child_it = parent->children.find(tokens);
+        if (child_it != parent->children.end()) {
+            // same contents, but the block is now known under a different hash
+            m_nodes_by_hash.erase(child_it->second->hash);
+            child_it->second->hash = hash;
+            m_nodes_by_hash[hash] = child_it->second.get();
+            return true;
+        }
+
+        auto node = std::make_unique<Node>();
+        node->tokens = tokens;
+        node->hash = hash;
+        node->parent = parent;
+        m_nodes_by_hash[hash] = node.get();
+        parent->children.emplace(std::move(tokens), std::move(node));
+        return true;
+    }
+
+    /**
+     * Removes the node with a given hash along with all its descendants, if present.
+     * @param hash Hash of the block.
+     */
+    void erase(size_t hash) {
+        auto it = m_nodes_by_hash.find(hash);
+        if (it != m_nodes_by_hash.end()) {
+            _erase_subtree(it->second);
+        }
+    }
+
+    /**
+     * Looks up the child of a node, labeled exactly with the given tokens.
+     * @param node The node to be searched for children.
+     * @param tokens The tokens of the child block.
+     * @return The child node or nullptr, if not found.
+     */
+    const Node* find_child(const Node* node, const std::vector<int64_t>& tokens) const {
+        OPENVINO_ASSERT(node != nullptr);
+        auto it = node->children.find(tokens);
+        return it == node->children.end() ? nullptr : it->second.get();
+    }
+
+    /**
+     * Looks up the child of a node, labeled with the longest prefix of the given tokens.
+     * @param node The node to be searched for children.
+     * @param tokens The tokens to be matched.
+     * @return The child node with the longest matching label or nullptr, if there is no such child.
+     */
+    const Node* find_longest_prefix_child(const Node* node, std::vector<int64_t> tokens) const {
+        OPENVINO_ASSERT(node != nullptr);
+        if (node->children.empty()) {
+            return nullptr;
+        }
+        while (!tokens.empty()) {
+            auto it = node->children.find(tokens);
+            if (it != node->children.end()) {
+                return it->second.get();
+            }
+            tokens.pop_back();
+        }
+        return nullptr;
+    }
+
+    /**
+     * Removes all nodes (along with their descendants) for which the blocks are no longer valid.
+     * @param is_valid Predicate accepting a block hash and returning whether the block is still valid.
+     */
+    template <typename Predicate>
+    void prune(Predicate is_valid) {
+        std::vector<Node*> nodes_to_visit{&m_root};
+        while (!nodes_to_visit.empty()) {
+            Node* node = nodes_to_visit.back();
+            nodes_to_visit.pop_back();
+            for (auto it = node->children.begin(); it != node->children.end();) {
+                Node* child = it->second.get();
+                if (!is_valid(child->hash)) {
+                    _unregister_subtree(child);
+                    it = node->children.erase(it);
+                } else {
+                    nodes_to_visit.push_back(child);
+                    ++it;
+                }
+            }
+        }
+    }
+
+    /**
+     * Visits the nodes of the tree so that each node is visited after its parent.
+     * @param visitor Callable accepting a node and returning whether the descendants of the node should be visited.
+     */
+    template <typename Visitor>
+    void visit(Visitor visitor) const {
+        std::vector<const Node*> nodes_to_visit{&m_root};
+        while (!nodes_to_visit.empty()) {
+            const Node* node = nodes_to_visit.back();
+            nodes_to_visit.pop_back();
+            for (const auto& child : node->children) {
+                if (visitor(child.second.get())) {
+                    nodes_to_visit.push_back(child.second.get());
+                }
+            }
+        }
+    }
+
+    /**
+     * @return The number of block nodes in the tree.
+     */
+    size_t num_nodes() const {
+        return m_nodes_by_hash.size();
+    }
+
+private:
+    void _unregister_subtree(Node* node) {
+        std::vector<Node*> nodes_to_visit{node};
+        while (!nodes_to_visit.empty()) {
+            Node* current = nodes_to_visit.back();
+            nodes_to_visit.pop_back();
+            m_nodes_by_hash.erase(current->hash);
+            for (auto& child : current->children) {
+                nodes_to_visit.push_back(child.second.get());
+            }
+        }
+    }
+
+    void _erase_subtree(Node* node) {
+        OPENVINO_ASSERT(node != &m_root && node->parent != nullptr);
+        _unregister_subtree(node);
+        auto& siblings = node->parent->children;
+        auto it = siblings.find(node->tokens);
+        OPENVINO_ASSERT(it != siblings.end() && it->second.get() == node);
+        // destroys the node and its descendants
+        siblings.erase(it);
+    }
+
+    Node m_root;
+    std::unordered_map<size_t, Node*> m_nodes_by_hash;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,130 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/reserved_memory.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+size_t get_page_size() {
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    return system_info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+size_t round_up_to_page_size(size_t size_in_bytes) {
+    const size_t page_size = get_page_size();
+    return (size_in_bytes + page_size - 1) / page_size * page_size;
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+ReservedMemory::ReservedMemory(size_t capacity_in_bytes) : m_capacity(round_up_to_page_size(capacity_in_bytes)) {
+    OPENVINO_ASSERT(m_capacity > 0, "Reserved memory capacity must be non-zero");
+#ifdef _WIN32
+    m_data = VirtualAlloc(nullptr, m_capacity, MEM_RESERVE, PAGE_NOACCESS);
+    OPENVINO_ASSERT(m_data != nullptr, "Failed to reserve ", m_capacity, " bytes of virtual memory");
+#else
+    m_data = mmap(nullptr, m_capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    OPENVINO_ASSERT(m_data != MAP_FAILED, "Failed to reserve ", m_capacity, " bytes of virtual memory");
+#endif
+}
+
+ReservedMemory::~ReservedMemory() {
+#ifdef _WIN32
+    VirtualFree(m_data, 0, MEM_RELEASE);
+#else
+    munmap(m_data, m_capacity);
+#endif
+}
+
+void ReservedMemory::commit(size_t size_in_bytes) {
+    if (size_in_bytes <= m_committed_size) {
+        return;
+    }
+    OPENVINO_ASSERT(size_in_bytes <= m_capacity, "Cannot commit ", size_in_bytes, " bytes, only ", m_capacity, " bytes are reserved");
+    size_t new_committed_size = round_up_to_page_size(size_in_bytes);
+    void* begin = static_cast<char*>(m_data) + m_committed_size;
+    size_t size = new_committed_size - m_committed_size;
+#ifdef _WIN32
+    OPENVINO_ASSERT(VirtualAlloc(begin, size, MEM_COMMIT, PAGE_READWRITE) != nullptr, "Failed to commit ", size, " bytes of reserved memory");
+#else
+    // pages are backed by physical memory on first access
+    OPENVINO_ASSERT(mprotect(begin, size, PROT_READ | PROT_WRITE) == 0, "Failed to commit ", size, " bytes of reserved memory");
+#endif
+    m_committed_size = new_committed_size;
+}
+
+void ReservedMemory::decommit(size_t size_in_bytes) {
+    size_t new_committed_size = round_up_to_page_size(size_in_bytes);
+    if (new_committed_size >= m_committed_size) {
+        return;
+    }
+    void* begin = static_cast<char*>(m_data) + new_committed_size;
+    size_t size = m_committed_size - new_committed_size;
+#ifdef _WIN32
+    OPENVINO_ASSERT(VirtualFree(begin, size, MEM_DECOMMIT) != 0, "Failed to decommit ", size, " bytes of reserved memory");
+#else
+    // the pages are zero-filled if committed and accessed again
+    OPENVINO_ASSERT(madvise(begin, size, MADV_DONTNEED) == 0 && mprotect(begin, size, PROT_NONE) == 0,
+                    "Failed to decommit ", size, " bytes of reserved memory");
+#endif
+    m_committed_size = new_committed_size;
+}
+
+size_t ReservedMemory::get_total_physical_memory() {
+#ifdef _WIN32
+    MEMORYSTATUSEX memory_status;
+    memory_status.dwLength = sizeof(memory_status);
+    OPENVINO_ASSERT(GlobalMemoryStatusEx(&memory_status), "Failed to query the physical memory size");
+    return static_cast<size_t>(memory_status.ullTotalPhys);
+#else
+    return static_cast<size_t>(sysconf(_SC_PHYS_PAGES)) * get_page_size();
+#endif
+}
+
+size_t ReservedMemory::get_available_physical_memory() {
+#ifdef _WIN32
+    MEMORYSTATUSEX memory_status;
+    memory_status.dwLength = sizeof(memory_status);
+    OPENVINO_ASSERT(GlobalMemoryStatusEx(&memory_status), "Failed to query the available physical memory size");
+    return static_cast<size_t>(memory_status.ullAvailPhys);
+#else
+#    ifdef __linux__
+    // unlike the free pages, MemAvailable counts the page cache which can be reclaimed, e.g. the one of the model files
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    size_t value_in_kb = 0;
+    while (meminfo >> key >> value_in_kb) {
+        if (key == "MemAvailable:") {
+            return value_in_kb * 1024;
+        }
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+#    endif
+    return static_cast<size_t>(sysconf(_SC_AVPHYS_PAGES)) * get_page_size();
+#endif
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,67 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov::genai {
+
+/**
+ * @brief A contiguous range of virtual address space reserved upfront, with the physical memory being committed on demand
+ * as the used part of the range grows. Allows buffers to grow in place, without reallocating and copying their contents.
+ */
+class ReservedMemory {
+    void* m_data = nullptr;
+    size_t m_capacity = 0;
+    size_t m_committed_size = 0;
+
+public:
+    /**
+     * Reserves the address space without committing any physical memory.
+     * @param capacity_in_bytes Size of the address space range to be reserved.
+     */
+    explicit ReservedMemory(size_t capacity_in_bytes);
+    ~ReservedMemory();
+
+    ReservedMemory(const ReservedMemory&) = delete;
+    ReservedMemory& operator=(const ReservedMemory&) = delete;
+
+    void* data() const {
+        return m_data;
+    }
+
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    size_t committed_size() const {
+        return m_committed_size;
+    }
+
+    /**
+     * Ensures that at least the first `size_in_bytes` bytes of the range are backed by physical memory. Previously committed
+     * memory and its contents are left intact.
+     * @param size_in_bytes Size of the range beginning to be usable for reading and writing.
+     */
+    void commit(size_t size_in_bytes);
+
+    /**
+     * Returns the physical memory past the first `size_in_bytes` bytes of the range to the system, the address space stays
+     * reserved. The contents of the released memory are lost.
+     * @param size_in_bytes Size of the range beginning to be left usable for reading and writing.
+     */
+    void decommit(size_t size_in_bytes);
+
+    /**
+     * @return Total amount of physical memory of the host, in bytes.
+     */
+    static size_t get_total_physical_memory();
+
+    /**
+     * @return Amount of physical memory of the host available for new allocations without swapping, in bytes.
+     */
+    static size_t get_available_physical_memory();
+};
+
+}  // namespace ov::genai
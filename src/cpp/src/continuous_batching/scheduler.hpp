@@ -4,14 +4,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdlib>
+#include <numeric>
+#include <istream>
+#include <ostream>
 #include <vector>
 
 #include "openvino/runtime/intel_gpu/properties.hpp"
+#include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/scheduler_config.hpp"
 #include "continuous_batching/block_manager.hpp"
 #include "sequence_group.hpp"
 #include "continuous_batching/cache_manager.hpp"
+#include "continuous_batching/kv_cache_budget.hpp"
+#include "continuous_batching/prefix_cache_storage.hpp"
 #include "continuous_batching/timer.hpp"
 #include "continuous_batching/sparse_attention.hpp"
 #include "utils.hpp"
@@ -24,16 +31,28 @@ class Scheduler {
     SchedulerConfig m_config;
     std::shared_ptr<BlockManager> m_block_manager;
     friend class CacheStateDumper;
+    friend class CacheStateRecorder;
 
     bool m_dynamic_memory_allocation = false;
 
+    // number of the preemptions of the sequence groups since the creation of the scheduler
+    size_t m_num_preemptions = 0;
+
     // Dynamic KV-cache allocation params
     size_t m_kv_blocks_initial_multiplier = 2;
     const float m_cache_growth_factor = 2; // commmon values 1.5 or 2
 
     std::shared_ptr<CacheManager> m_cache_manager;
+    // limits the dynamically allocated KV cache, if it's shared with other pipelines
+    std::shared_ptr<KVCacheBudget> m_kv_cache_budget;
 
     size_t m_snapkv_window_size = 1;
+
+    // map of block -> swap block copies for the groups swapped out at current step, which need to be performed by CacheManager per each layer
+    std::vector<std::map<size_t, size_t>> m_swap_out_map;
+
+    // number of tokens scheduled so far per each tenant of the active sequence groups, used by SchedulingPolicy::FAIR_SHARE
+    std::map<std::string, size_t> m_tenant_served_tokens;
 public:
     struct Output {
         // IDs of scheduled groups
@@ -55,6 +74,8 @@ public:
 
         // total number of scheduled tokens
         size_t m_total_num_scheduled_tokens = 0;
+        // number of scheduled prompt tokens, included into m_total_num_scheduled_tokens
+        size_t m_total_num_scheduled_prompt_tokens = 0;
         // dedicated prompt phase
         bool is_prompt = false;
         // current cache usage
@@ -68,52 +89,98 @@ public:
         m_snapkv_window_size(snapkv_window_size) {
         m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        OPENVINO_ASSERT(m_config.max_prefill_fraction > 0.0f && m_config.max_prefill_fraction <= 1.0f,
+                        "max_prefill_fraction must be in (0, 1] range, got ", m_config.max_prefill_fraction);
+        _initialize_swap_space();
     }
 
-    void release() {
-        m_cache_manager.reset();
-        m_block_manager.reset();
+    /**
+     * Makes the KV cache grow on demand from the budget shared with other schedulers. Dynamic KV cache allocation must
+     * be on, i.e. both num_kv_blocks and cache_size of the scheduler config must be zero.
+     */
+    void set_kv_cache_budget(std::shared_ptr<KVCacheBudget> kv_cache_budget) {
+        OPENVINO_ASSERT(m_config.num_kv_blocks == 0 && m_config.cache_size == 0,
+                        "KV cache budget requires dynamic KV cache allocation");
+        m_kv_cache_budget = std::move(kv_cache_budget);
     }
 
-    Output schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
-        Output scheduler_output;
-        // map of src -> dst blocks copies, which need to be performed by CacheManager
-        std::map<size_t, std::list<size_t>> block_copy_map;
+    std::shared_ptr<KVCacheBudget> get_kv_cache_budget() const {
+        return m_kv_cache_budget;
+    }
 
-        // free some blocks taken by non-confirmed condidates in SD / prompt look-up
-        clean_empty_blocks(sequence_groups);
+    size_t get_kv_cache_size_in_bytes() const {
+        return m_block_manager->get_total_number_of_kv_blocks() * m_cache_manager->get_block_size_in_bytes();
+    }
 
-        if (m_block_manager->get_total_number_of_kv_blocks() == 0) {
-            _initialize_cache(sequence_groups);
+    // the blocks of the prefix cache which aren't used by the sequences are not counted
+    size_t get_used_kv_cache_size_in_bytes() const {
+        const size_t num_used_blocks = m_block_manager->get_total_number_of_kv_blocks() - m_block_manager->num_free_blocks();
+        return num_used_blocks * m_cache_manager->get_block_size_in_bytes();
+    }
+
+    // the free blocks holding the contents reusable by prefix caching
+    size_t get_prefix_cache_size_in_bytes() const {
+        return m_block_manager->num_overwriteable_blocks() * m_cache_manager->get_block_size_in_bytes();
+    }
+
+    size_t get_host_swap_space_size_in_bytes() const {
+        return m_cache_manager->get_host_swap_space_size_in_bytes();
+    }
+
+    /**
+     * @return The device memory allocated by the GPU plugin in this process, in bytes. The host memory shared with
+     * an integrated GPU is counted as well.
+     */
+    static size_t get_used_gpu_memory(const std::string& device) {
+        ov::Core core = utils::singleton_core();
+        auto memory_statistics = core.get_property(device, ov::intel_gpu::memory_statistics);
+        auto device_type = core.get_property(device, ov::device::type);
+
+        // sum up all used device memory
+        std::vector<std::string> device_memory_types = {"cl_mem", "usm_device"};
+        size_t used_device_mem = 0;
+        for (auto mem_type: device_memory_types) {
+            used_device_mem += memory_statistics[mem_type];
         }
 
-        if (m_config.dynamic_split_fuse) {
-            // deepspeed-mii case
-            // generation phase is always scheduled first
-            _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
-            // some tokens from generation prompt are also scheduled
-            _schedule_prompt_phase_dynamic_split_fuse(sequence_groups, scheduler_output);
-        } else {
-            // vLLM case
-            // schedule prompt phase using whole prompt's input_ids
+        if (device_type == ov::device::Type::INTEGRATED) {
+            used_device_mem += memory_statistics["usm_host"];
+        }
+        return used_device_mem;
+    }
 
-            _schedule_prompt_phase_vllm(sequence_groups, scheduler_output);
+    void release() {
+        m_cache_manager.reset();
+        m_block_manager.reset();
+    }
 
-            if (!scheduler_output.is_prompt) {
-                // prompt sequences are not scheduler => scheduler generation phase by dynamic_split_fuse implementation
-                _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
-            }
+    Output schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        if (m_config.scheduling_policy == SchedulingPolicy::FCFS) {
+            return _schedule(sequence_groups);
         }
 
-        m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
-        _clear_waiting_sequences(sequence_groups);
-        scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
+        if (m_config.scheduling_policy == SchedulingPolicy::PREFIX_CACHE_AWARE && m_config.enable_prefix_caching) {
+            _restore_more_cached_blocks(sequence_groups);
+        }
 
-        static ManualTimer copy_blocks_timer("copy block");
-        copy_blocks_timer.start();
-        m_cache_manager->copy_blocks(block_copy_map);
-        copy_blocks_timer.end();
+        // scheduling phases serve sequence groups in the order of the vector and preempt them starting from its end,
+        // so it's enough to reorder the groups according to the policy and map the scheduled groups back
+        std::vector<size_t> order = _get_scheduling_order(sequence_groups);
+        std::vector<SequenceGroup::Ptr> ordered_sequence_groups;
+        ordered_sequence_groups.reserve(order.size());
+        for (size_t sequence_group_id : order) {
+            ordered_sequence_groups.push_back(sequence_groups[sequence_group_id]);
+        }
 
+        Output scheduler_output = _schedule(ordered_sequence_groups);
+        for (auto& sequence_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+            const auto& sequence_group = ordered_sequence_groups[sequence_group_id];
+            if (m_config.scheduling_policy == SchedulingPolicy::FAIR_SHARE) {
+                m_tenant_served_tokens[sequence_group->get_sampling_parameters().tenant_id] +=
+                    sequence_group->get_num_scheduled_tokens() * sequence_group->num_running_seqs();
+            }
+            sequence_group_id = order[sequence_group_id];
+        }
         return scheduler_output;
     }
 
@@ -142,6 +209,14 @@ public:
         return m_block_manager->has_block_table(seq_id);
     }
 
+    bool is_swapped_out(uint64_t seq_id) {
+        return m_block_manager->is_swapped_out(seq_id);
+    }
+
+    void free_swapped_sequence(uint64_t seq_id) {
+        m_block_manager->free_swapped_sequence(seq_id);
+    }
+
     void free_sequence(uint64_t seq_id) {
         m_block_manager->free_sequence(seq_id);
     }
@@ -151,7 +226,22 @@ public:
     }
 
     void restore_cached_blocks(const SequenceGroup::Ptr& sequence_group) {
+        const size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
         m_block_manager->restore_cached_blocks(sequence_group);
+        sequence_group->record_prefix_cache_hit(sequence_group->get_num_processed_tokens() - num_processed_tokens);
+    }
+
+    // see BlockManager::pin_prefix
+    void pin_prefix(const TokenIds& tokens) {
+        m_block_manager->pin_prefix(tokens);
+    }
+
+    PrefixCacheStats get_prefix_cache_stats() {
+        return m_block_manager->get_prefix_cache_stats();
+    }
+
+    size_t get_num_preemptions() const {
+        return m_num_preemptions;
     }
 
     const SchedulerConfig& get_config() const {
@@ -162,7 +252,350 @@ public:
         m_block_manager->free_blocks_from_sequence(seq_id, per_layer_logical_block_indices_to_free);
     }
 
+    /**
+     * Frees the KV cache blocks of the scheduled generating sequences, which are older than the sliding window of the attention
+     * of all the decoder layers, so that only the attended blocks occupy the cache. The freed tokens are accounted as evicted.
+     * @param attention_window_size The number of the last tokens attended by the next tokens.
+     */
+    void release_out_of_window_blocks(const std::vector<SequenceGroup::Ptr>& sequence_groups, const Output& scheduler_output,
+                                      size_t attention_window_size) {
+        const size_t block_size = m_block_manager->get_block_size();
+        for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[seq_group_id];
+            // the prompt is released at the generation stage only, as cache eviction does
+            if (!sequence_group->can_generate_tokens()) {
+                continue;
+            }
+            // a block is kept in reserve, as well as the tokens being validated, which may be rejected and shift the next
+            // tokens back
+            const size_t num_kept_tokens = attention_window_size + block_size + sequence_group->get_num_tokens_to_validate();
+            const size_t num_cached_tokens = sequence_group->get_context_len() - sequence_group->get_num_evicted_tokens();
+            if (num_cached_tokens < num_kept_tokens + block_size) {
+                continue;
+            }
+            const size_t num_blocks_to_release = (num_cached_tokens - num_kept_tokens) / block_size;
+
+            std::set<size_t> logical_blocks_to_release;
+            for (size_t logical_block_idx = 0; logical_block_idx < num_blocks_to_release; ++logical_block_idx) {
+                logical_blocks_to_release.insert(logical_block_idx);
+            }
+            for (const auto& sequence : sequence_group->get_running_sequences()) {
+                const size_t num_layers = m_block_manager->get_block_tables(sequence->get_id()).size();
+                m_block_manager->free_blocks_from_sequence(sequence->get_id(), std::vector<std::set<size_t>>(num_layers, logical_blocks_to_release));
+            }
+            sequence_group->register_token_eviction(num_blocks_to_release * block_size);
+        }
+    }
+
+    /**
+     * Saves the KV cache blocks currently reusable by prefix caching to a file, to be loaded with load_prefix_cache
+     * by another pipeline instance, e.g. after a restart of the process.
+     * @param path Path to the file, overwritten if exists.
+     * @param fingerprint Identifies the model, device and KV cache configuration the blocks are computed with.
+     * @return The number of saved blocks.
+     */
+    size_t save_prefix_cache(const std::filesystem::path& path, uint64_t fingerprint) {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix caching must be enabled to save the prefix cache");
+        std::vector<PrefixCacheBlock> prefix_blocks = m_block_manager->get_reusable_prefix_blocks();
+        PrefixCacheFileHeader header = _get_prefix_cache_file_header(fingerprint);
+        header.num_blocks = prefix_blocks.size();
+
+        PrefixCacheFileWriter writer(path, header);
+        _write_prefix_blocks(writer, header, prefix_blocks);
+        writer.commit();
+        return prefix_blocks.size();
+    }
+
+    /**
+     * Loads the KV cache blocks saved with save_prefix_cache and makes them reusable by prefix caching. Must be called
+     * before any sequence groups are added. Blocks are only loaded into the free KV cache blocks, the dynamically
+     * allocated KV cache is initialized to fit all saved blocks if possible.
+     * @param path Path to the file.
+     * @param fingerprint Identifies the model, device and KV cache configuration of this pipeline, must match the one
+     * the file was saved with.
+     * @return The number of loaded blocks.
+     */
+    size_t load_prefix_cache(const std::filesystem::path& path, uint64_t fingerprint) {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix caching must be enabled to load the prefix cache");
+        PrefixCacheFileReader reader(path);
+        OPENVINO_ASSERT(reader.get_header().is_compatible(_get_prefix_cache_file_header(fingerprint)),
+                        "Prefix cache file ", path, " was saved for a different model or KV cache configuration");
+        return _read_prefix_blocks(reader);
+    }
+
+    // see ContinuousBatchingPipeline::get_prefix_cache_digest
+    PrefixCacheDigest get_prefix_cache_digest() {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix caching must be enabled to get the prefix cache digest");
+        const std::vector<size_t> hashes = m_block_manager->get_cached_block_hashes();
+        return PrefixCacheDigest(get_block_size(), std::vector<uint64_t>(hashes.begin(), hashes.end()));
+    }
+
+    /**
+     * Exports the KV cache blocks of the longest cached prefix of the tokens in the format of save_prefix_cache, e.g. for
+     * the decoding of a prompt prefilled by another pipeline. Must not be called concurrently with schedule().
+     * @param tokens The tokens of the prefix, e.g. of a processed prompt.
+     * @param fingerprint Identifies the model, device and KV cache configuration the blocks are computed with.
+     */
+    std::vector<uint8_t> export_prefix_blocks(const TokenIds& tokens, uint64_t fingerprint) {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix caching must be enabled to export KV cache blocks");
+        std::vector<PrefixCacheBlock> prefix_blocks = m_block_manager->get_prefix_blocks(tokens);
+        PrefixCacheFileHeader header = _get_prefix_cache_file_header(fingerprint);
+        header.num_blocks = prefix_blocks.size();
+
+        // the blocks are written straight into the result, which may take several GB, the record of a block holds
+        // 4 numbers, up to block_size tokens and the block contents
+        std::vector<uint8_t> data;
+        data.reserve((6 + header.layer_block_sizes_in_bytes.size()) * sizeof(uint64_t) +
+                     header.num_blocks * ((4 + header.block_size) * sizeof(uint64_t) + header.get_block_size_in_bytes()));
+        detail::VectorStreamBuf buffer(data);
+        std::ostream stream(&buffer);
+        PrefixCacheWriter writer(stream, header);
+        _write_prefix_blocks(writer, header, prefix_blocks);
+        OPENVINO_ASSERT(stream.good(), "Failed to export KV cache blocks");
+        return data;
+    }
+
+    /**
+     * Imports the KV cache blocks exported with export_prefix_blocks by another pipeline and makes them reusable by
+     * prefix caching, so that the prompts starting with their tokens are restored from them. The blocks are imported
+     * into the free KV cache blocks, the dynamically allocated KV cache grows to fit them if possible. Must not be called
+     * concurrently with schedule().
+     * @param data The exported blocks.
+     * @param fingerprint Identifies the model, device and KV cache configuration of this pipeline, must match the one
+     * the blocks were exported with.
+     * @return The number of imported blocks, the blocks already known are not counted.
+     */
+    size_t import_prefix_blocks(const std::vector<uint8_t>& data, uint64_t fingerprint) {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix caching must be enabled to import KV cache blocks");
+        // the blocks are read in place
+        detail::SpanStreamBuf buffer(data.data(), data.size());
+        std::istream stream(&buffer);
+        PrefixCacheReader reader(stream);
+        OPENVINO_ASSERT(reader.get_header().is_compatible(_get_prefix_cache_file_header(fingerprint)),
+                        "KV cache blocks were exported by a pipeline with a different model or KV cache configuration");
+        return _read_prefix_blocks(reader);
+    }
+
+    /**
+     * Moves the occupied KV cache blocks to the beginning of the cache and copies their contents, see
+     * BlockManager::compact_blocks, so that the blocks allocated afterwards are contiguous. Must not be called
+     * concurrently with schedule() or between schedule() and the inference of its output.
+     * @param max_num_moved_blocks The max number of blocks to be moved.
+     * @return The number of moved blocks.
+     */
+    size_t compact_cache(size_t max_num_moved_blocks = std::numeric_limits<size_t>::max()) {
+        std::map<size_t, std::list<size_t>> block_copy_map = m_block_manager->compact_blocks(max_num_moved_blocks);
+        m_cache_manager->copy_blocks(block_copy_map);
+        return block_copy_map.size();
+    }
+
+    /**
+     * Compacts the KV cache and releases the free blocks after the occupied ones, e.g. after the load has dropped.
+     * The blocks reusable by prefix caching are kept. The dynamically allocated KV cache grows again on demand, the fixed
+     * size one is left as is. Must not be called concurrently with schedule().
+     * @return The number of KV cache blocks left.
+     */
+    size_t shrink_cache() {
+        const size_t num_kv_blocks = m_block_manager->get_total_number_of_kv_blocks();
+        if (!m_dynamic_memory_allocation || num_kv_blocks == 0) {
+            return num_kv_blocks;
+        }
+        compact_cache();
+        // a single block is kept, so that the cache grows as usual instead of being initialized anew
+        const size_t new_num_kv_blocks = std::max<size_t>(m_block_manager->get_min_number_of_kv_blocks(), 1);
+        if (new_num_kv_blocks < num_kv_blocks) {
+            m_block_manager->decrease_kv_blocks_number(new_num_kv_blocks);
+            m_cache_manager->shrink_cache(new_num_kv_blocks);
+            if (m_kv_cache_budget) {
+                m_kv_cache_budget->release_blocks(num_kv_blocks - new_num_kv_blocks, m_cache_manager->get_block_size_in_bytes());
+            }
+        }
+        return new_num_kv_blocks;
+    }
+
 private:
+    Output _schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        Output scheduler_output;
+        // map of src -> dst blocks copies, which need to be performed by CacheManager
+        std::map<size_t, std::list<size_t>> block_copy_map;
+
+        // free some blocks taken by non-confirmed condidates in SD / prompt look-up
+        clean_empty_blocks(sequence_groups);
+
+        if (m_block_manager->get_total_number_of_kv_blocks() == 0) {
+            _initialize_cache(sequence_groups);
+        }
+
+        // map of swap block -> block copies, which need to be performed by CacheManager per each layer
+        std::vector<std::map<size_t, size_t>> swap_in_map;
+        _schedule_swap_in(sequence_groups, swap_in_map);
+
+        if (m_config.dynamic_split_fuse) {
+            // deepspeed-mii case
+            // generation phase is always scheduled first
+            _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+            // some tokens from generation prompt are also scheduled
+            _schedule_prompt_phase_dynamic_split_fuse(sequence_groups, scheduler_output);
+        } else {
+            // vLLM case
+            // schedule prompt phase using whole prompt's input_ids
+
+            _schedule_prompt_phase_vllm(sequence_groups, scheduler_output);
+
+            if (!scheduler_output.is_prompt) {
+                // prompt sequences are not scheduler => scheduler generation phase by dynamic_split_fuse implementation
+                _schedule_generate_phase_dynamic_split_fuse(sequence_groups, scheduler_output, block_copy_map);
+            }
+        }
+
+        m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+        _clear_waiting_sequences(sequence_groups);
+        scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
+
+        const auto now = std::chrono::steady_clock::now();
+        for (size_t group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+            sequence_groups[group_id]->record_scheduled(now);
+        }
+
+        static ManualTimer swap_blocks_timer("swap blocks");
+        swap_blocks_timer.start();
+        // swap-ins go first: swap blocks released by them may be reused for the swap-outs from the same step
+        m_cache_manager->swap_in(swap_in_map);
+        m_cache_manager->swap_out(m_swap_out_map);
+        m_swap_out_map.clear();
+        swap_blocks_timer.end();
+
+        static ManualTimer copy_blocks_timer("copy block");
+        copy_blocks_timer.start();
+        m_cache_manager->copy_blocks(block_copy_map);
+        copy_blocks_timer.end();
+
+        return scheduler_output;
+    }
+
+    /**
+     * Restores the cached blocks of the groups, which haven't been scheduled yet, once again, if more of their prompts
+     * have been cached since their arrival, e.g. by the groups sharing the same prefix which were scheduled earlier.
+     */
+    void _restore_more_cached_blocks(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        const size_t block_size = get_block_size();
+        for (const auto& sequence_group : sequence_groups) {
+            const size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+            if (sequence_group->has_been_scheduled() || !sequence_group->is_waiting() || num_processed_tokens + 1 >= sequence_group->get_prompt_len()) {
+                continue;
+            }
+            if (m_block_manager->get_num_cached_prompt_tokens(sequence_group) >= num_processed_tokens + block_size) {
+                sequence_group->record_prefix_cache_hit(m_block_manager->restore_more_cached_blocks(sequence_group));
+            }
+        }
+    }
+
+    std::vector<size_t> _get_scheduling_order(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        // ties are broken by the order of arrival, which is the order of the vector
+        std::vector<size_t> order(sequence_groups.size());
+        std::iota(order.begin(), order.end(), 0);
+
+        switch (m_config.scheduling_policy) {
+        case SchedulingPolicy::PRIORITY:
+            std::stable_sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                return sequence_groups[lhs]->get_sampling_parameters().priority > sequence_groups[rhs]->get_sampling_parameters().priority;
+            });
+            break;
+        case SchedulingPolicy::DEADLINE: {
+            // only the groups still waiting for the first token can miss their TTFT objective, the rest are served by arrival
+            auto get_deadline = [] (const SequenceGroup::Ptr& sequence_group) {
+                size_t ttft_slo_ms = sequence_group->get_sampling_parameters().ttft_slo_ms;
+                if (ttft_slo_ms == 0 || sequence_group->has_generated_tokens()) {
+                    return std::chrono::steady_clock::time_point::max();
+                }
+                return sequence_group->get_arrival_time() + std::chrono::milliseconds(ttft_slo_ms);
+            };
+            std::vector<std::chrono::steady_clock::time_point> deadlines;
+            deadlines.reserve(sequence_groups.size());
+            for (const auto& sequence_group : sequence_groups) {
+                deadlines.push_back(get_deadline(sequence_group));
+            }
+            std::stable_sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                return deadlines[lhs] < deadlines[rhs];
+            });
+            break;
+        }
+        case SchedulingPolicy::FAIR_SHARE: {
+            // forget the tenants without active groups and let the new ones start on par with the least served active tenant,
+            // so that neither the past usage is held against a tenant nor a newcomer can monopolize the pipeline
+            std::map<std::string, size_t> tenant_served_tokens;
+            for (const auto& sequence_group : sequence_groups) {
+                const std::string& tenant_id = sequence_group->get_sampling_parameters().tenant_id;
+                auto it = m_tenant_served_tokens.find(tenant_id);
+                if (it != m_tenant_served_tokens.end()) {
+                    tenant_served_tokens.insert(*it);
+                }
+            }
+            size_t min_served_tokens = 0;
+            if (!tenant_served_tokens.empty()) {
+                min_served_tokens = std::min_element(tenant_served_tokens.begin(), tenant_served_tokens.end(), [] (const auto& lhs, const auto& rhs) {
+                    return lhs.second < rhs.second;
+                })->second;
+            }
+            for (const auto& sequence_group : sequence_groups) {
+                tenant_served_tokens.emplace(sequence_group->get_sampling_parameters().tenant_id, min_served_tokens);
+            }
+            m_tenant_served_tokens = std::move(tenant_served_tokens);
+
+            std::stable_sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                return m_tenant_served_tokens.at(sequence_groups[lhs]->get_sampling_parameters().tenant_id) <
+                       m_tenant_served_tokens.at(sequence_groups[rhs]->get_sampling_parameters().tenant_id);
+            });
+            break;
+        }
+        case SchedulingPolicy::PREFIX_CACHE_AWARE: {
+            // the scheduled groups keep the order of arrival not to be preempted by the newcomers, and so do the groups
+            // waiting for too long. The rest are clustered by the first block of the prompt, so that the groups sharing
+            // a prefix follow the first of them, which fills the cache, the clusters with the most restored tokens first
+            enum Rank : size_t { SCHEDULED, STARVING, WAITING };
+            const auto now = std::chrono::steady_clock::now();
+            const auto max_reordering_delay = std::chrono::milliseconds(m_config.max_reordering_delay_ms);
+            const size_t block_size = get_block_size();
+            std::vector<size_t> ranks(sequence_groups.size()), cluster_ids(sequence_groups.size());
+            std::map<size_t, size_t> first_block_hash_to_cluster_id;
+            std::vector<size_t> cluster_max_restored_tokens;
+            for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+                const auto& sequence_group = sequence_groups[sequence_group_id];
+                if (sequence_group->has_been_scheduled()) {
+                    ranks[sequence_group_id] = SCHEDULED;
+                } else if (now - sequence_group->get_arrival_time() >= max_reordering_delay) {
+                    ranks[sequence_group_id] = STARVING;
+                } else {
+                    ranks[sequence_group_id] = WAITING;
+                    const size_t first_block_hash = (*sequence_group)[0]->get_hash(std::min(block_size, sequence_group->get_prompt_len()));
+                    auto it = first_block_hash_to_cluster_id.emplace(first_block_hash, cluster_max_restored_tokens.size()).first;
+                    if (it->second == cluster_max_restored_tokens.size()) {
+                        cluster_max_restored_tokens.push_back(0);
+                    }
+                    cluster_ids[sequence_group_id] = it->second;
+                    cluster_max_restored_tokens[it->second] = std::max(cluster_max_restored_tokens[it->second], sequence_group->get_num_processed_tokens());
+                }
+            }
+            // the clusters are numbered in the order of arrival of their first groups
+            std::stable_sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                if (ranks[lhs] != ranks[rhs] || ranks[lhs] != WAITING) {
+                    return ranks[lhs] < ranks[rhs];
+                }
+                if (cluster_ids[lhs] != cluster_ids[rhs]) {
+                    const size_t lhs_restored_tokens = cluster_max_restored_tokens[cluster_ids[lhs]];
+                    const size_t rhs_restored_tokens = cluster_max_restored_tokens[cluster_ids[rhs]];
+                    return lhs_restored_tokens != rhs_restored_tokens ? lhs_restored_tokens > rhs_restored_tokens : cluster_ids[lhs] < cluster_ids[rhs];
+                }
+                return sequence_groups[lhs]->get_num_processed_tokens() > sequence_groups[rhs]->get_num_processed_tokens();
+            });
+            break;
+        }
+        default:
+            break;
+        }
+        return order;
+    }
+
     static size_t _num_running_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t num_running = 0;
         for (const SequenceGroup::CPtr& seq_group : sequence_groups) {
@@ -175,6 +608,8 @@ private:
 
 
     bool _preempt_by_recompute(SequenceGroup::Ptr sequence_group, size_t blocks_needed) {
+        ++m_num_preemptions;
+        sequence_group->record_preemption();
         size_t processed_tokens = sequence_group->get_num_processed_tokens();
         size_t prev_blocks_count = m_block_manager->num_free_blocks();
         size_t preempted_tokens = 0;
@@ -182,6 +617,10 @@ private:
         bool was_evicted_from = (sequence_group->get_num_evicted_tokens() != 0);
 
         if (num_blocks_occupied_by_sequence <= blocks_needed || !m_can_use_partial_preemption || was_evicted_from) {
+            // whole group has to be preempted, so try to keep its KV cache in the swap space instead of recomputing it later
+            if (!was_evicted_from && _try_swap_out(sequence_group)) {
+                return m_block_manager->num_free_blocks() > prev_blocks_count;
+            }
             auto sequences = sequence_group->get_not_finished_sequences();
             for (size_t s = 0; s < sequences.size(); ++s) {
                 auto seq_id = sequences[s]->get_id();
@@ -227,11 +666,11 @@ private:
         return m_block_manager->num_free_blocks() > prev_blocks_count;
     }
 
-    static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         for (size_t seq_group_id = 0, num_groups = sequence_groups.size(); seq_group_id < num_groups; ++seq_group_id) {
             size_t group_idx = num_groups - seq_group_id - 1;
-            SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
-            if (sequence_group->get_num_processed_tokens() > 0) {
+            SequenceGroup::Ptr sequence_group = sequence_groups[group_idx];
+            if (sequence_group->get_num_processed_tokens() > 0 && !m_block_manager->is_swapped_out(sequence_group)) {
                 // we are here, because current sequence group has some reserved KV blocks in block manager
                 // which can be freed
                 return group_idx;
@@ -269,19 +708,26 @@ private:
         //    greedy scheduling of prompt with higher priority
         // 2. The mechanism below performs greedy scheduling of high priority prompts
 
+        const size_t prefill_token_budget = _get_prefill_token_budget(scheduler_output);
+        if (prefill_token_budget == 0) {
+            return;
+        }
+
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
-            if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() &&
+                !sequence_group->is_expired() && !m_block_manager->is_swapped_out(sequence_group)) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
                 Sequence::Ptr sequence = (*sequence_group)[0];
                 uint64_t seq_id = sequence->get_id();
 
-                size_t num_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
+                size_t num_tokens_in_megabatch = std::min(m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens,
+                                                          prefill_token_budget - scheduler_output.m_total_num_scheduled_prompt_tokens);
                 size_t num_available_tokens = sequence_group->get_num_available_tokens_for_batching();
 
-                // apply megabatch limitations
+                // apply megabatch and prefill chunk limitations
                 size_t num_scheduled_tokens = std::min(num_tokens_in_megabatch, num_available_tokens);
 
                 // apply KV cache limitations
@@ -314,6 +760,7 @@ private:
                         scheduler_output.m_scheduled_sequence_groups_ids.push_back(sequence_group_id);
                         scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += num_scheduled_tokens * num_running_seqs;
+                        scheduler_output.m_total_num_scheduled_prompt_tokens += num_scheduled_tokens * num_running_seqs;
 
 
                         scheduler_output.m_score_aggregation_windows[seq_id] = _schedule_scores_to_aggregate(sequence_group);
@@ -332,12 +779,27 @@ private:
                 }
 
                 // if we added maximum amount of tokens to compute
-                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens)
+                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens ||
+                    scheduler_output.m_total_num_scheduled_prompt_tokens == prefill_token_budget)
                     break;
             }
         }
     }
 
+    size_t _get_prefill_token_budget(const Output& scheduler_output) const {
+        // generation phase is scheduled first, so the tokens scheduled so far are all generation phase ones
+        size_t prefill_token_budget = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
+        if (m_config.max_num_prefill_tokens_per_step > 0) {
+            prefill_token_budget = std::min(prefill_token_budget, m_config.max_num_prefill_tokens_per_step);
+        }
+        if (scheduler_output.m_total_num_scheduled_tokens > 0 && m_config.max_prefill_fraction < 1.0f) {
+            // keep at least a single token to let the prompts progress
+            size_t max_prefill_tokens = std::max<size_t>(1, m_config.max_prefill_fraction * m_config.max_num_batched_tokens);
+            prefill_token_budget = std::min(prefill_token_budget, max_prefill_tokens);
+        }
+        return prefill_token_budget;
+    }
+
     void _schedule_generate_phase_dynamic_split_fuse(const std::vector<SequenceGroup::Ptr>& sequence_groups,
                                                      Output& scheduler_output,
                                                      std::map<size_t, std::list<size_t>>& block_copy_map) {
@@ -348,7 +810,8 @@ private:
             // Question: do we need to schedule preeempted first as it's done in vLLM?
             // Answer: preempted sequences have low priority, so they should be after "running" ones. So, here we
             //         keep latencies for sequence groups of high priority
-            if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() &&
+                !m_block_manager->is_swapped_out(sequence_group)) {
                 OPENVINO_ASSERT(!sequence_group->has_finished());
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 OPENVINO_ASSERT(num_running_seqs);
@@ -435,7 +898,8 @@ private:
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             const bool recompute_evicted_sequences = sequence_group->get_num_processed_tokens() == 0 && !m_can_use_partial_preemption;
-            if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() &&
+                !sequence_group->is_expired() && !m_block_manager->is_swapped_out(sequence_group)) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
@@ -484,6 +948,7 @@ private:
                         uint64_t seq_id = sequence_group->get_running_sequences()[0]->get_id();
                         scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += sequence_len;
+                        scheduler_output.m_total_num_scheduled_prompt_tokens += sequence_len;
                         scheduler_output.m_score_aggregation_windows[seq_id] = _schedule_scores_to_aggregate(sequence_group);
                         scheduler_output.m_xattention_thresholds[seq_id] = _schedule_xattention_threshold(sequence_group);
                         scheduler_output.m_xattention_block_size = m_config.sparse_attention_config.xattention_block_size;
@@ -499,6 +964,112 @@ private:
         }
     }
 
+    template <typename Writer>
+    void _write_prefix_blocks(Writer& writer, const PrefixCacheFileHeader& header, const std::vector<PrefixCacheBlock>& prefix_blocks) {
+        std::vector<uint8_t> data(header.get_block_size_in_bytes());
+        for (const auto& prefix_block : prefix_blocks) {
+            size_t offset = 0;
+            for (size_t layer_idx = 0; layer_idx < header.layer_block_sizes_in_bytes.size(); ++layer_idx) {
+                m_cache_manager->copy_block_to_host(layer_idx, prefix_block.blocks[layer_idx]->get_index(), data.data() + offset);
+                offset += header.layer_block_sizes_in_bytes[layer_idx];
+            }
+            writer.write_block(prefix_block, data);
+        }
+    }
+
+    // reads the blocks of a compatible reader into the blank KV cache blocks, see load_prefix_cache
+    template <typename Reader>
+    size_t _read_prefix_blocks(Reader& reader) {
+        const PrefixCacheFileHeader& header = reader.get_header();
+        if (m_block_manager->get_total_number_of_kv_blocks() == 0 && header.num_blocks > 0) {
+            _initialize_dynamic_cache(header.num_blocks);
+        }
+        while (m_block_manager->num_blank_blocks() < header.num_blocks && _try_increase_cache()) {
+        }
+        m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+
+        size_t num_loaded_blocks = 0;
+        PrefixCacheBlock prefix_block;
+        std::vector<uint8_t> data;
+        while (m_block_manager->num_blank_blocks() > 0 && reader.read_block(prefix_block, data)) {
+            BlocksPerLayer blocks = m_block_manager->allocate_restored_prefix_block(prefix_block);
+            if (blocks.empty()) {
+                // already known block
+                continue;
+            }
+            size_t offset = 0;
+            for (size_t layer_idx = 0; layer_idx < header.layer_block_sizes_in_bytes.size(); ++layer_idx) {
+                m_cache_manager->copy_block_from_host(layer_idx, blocks[layer_idx]->get_index(), data.data() + offset);
+                offset += header.layer_block_sizes_in_bytes[layer_idx];
+            }
+            m_block_manager->release_restored_prefix_block(blocks);
+            ++num_loaded_blocks;
+        }
+        return num_loaded_blocks;
+    }
+
+    PrefixCacheFileHeader _get_prefix_cache_file_header(uint64_t fingerprint) const {
+        PrefixCacheFileHeader header;
+        header.fingerprint = fingerprint;
+        header.block_size = m_block_manager->get_block_size();
+        for (size_t layer_idx = 0; layer_idx < m_cache_manager->get_num_decoder_layers(); ++layer_idx) {
+            header.layer_block_sizes_in_bytes.push_back(m_cache_manager->get_layer_block_size_in_bytes(layer_idx));
+        }
+        return header;
+    }
+
+    void _initialize_swap_space() {
+        if (m_config.swap_space_size == 0 && m_config.swap_space_disk_size == 0) {
+            return;
+        }
+        OPENVINO_ASSERT(m_config.swap_space_disk_size == 0 || !m_config.swap_space_path.empty(),
+                        "SchedulerConfig::swap_space_path must be set to use on-disk swap space");
+        const size_t block_size_in_bytes = m_cache_manager->get_block_size_in_bytes();
+        OPENVINO_ASSERT(block_size_in_bytes > 0, "KV cache block size must be known to allocate swap space");
+        size_t num_host_swap_blocks = m_config.swap_space_size * 1024 * 1024 * 1024 / block_size_in_bytes; // convert GBs to bytes
+        size_t num_disk_swap_blocks = m_config.swap_space_disk_size * 1024 * 1024 * 1024 / block_size_in_bytes;
+        m_cache_manager->allocate_swap_space(num_host_swap_blocks, num_disk_swap_blocks, m_config.swap_space_path);
+        m_block_manager->set_num_swap_blocks(m_cache_manager->get_num_swap_blocks());
+    }
+
+    bool _try_swap_out(SequenceGroup::Ptr sequence_group) {
+        if (!m_block_manager->can_swap_out(sequence_group)) {
+            return false;
+        }
+        auto swap_out_map = m_block_manager->swap_out(sequence_group);
+        m_swap_out_map.resize(swap_out_map.size());
+        for (size_t layer_idx = 0; layer_idx < swap_out_map.size(); layer_idx++) {
+            m_swap_out_map[layer_idx].insert(swap_out_map[layer_idx].begin(), swap_out_map[layer_idx].end());
+        }
+        // processed tokens are kept as is, since the KV cache contents will be restored from the swap space
+        sequence_group->set_waiting();
+        return true;
+    }
+
+    void _schedule_swap_in(const std::vector<SequenceGroup::Ptr>& sequence_groups, std::vector<std::map<size_t, size_t>>& swap_in_map) {
+        for (const auto& sequence_group : sequence_groups) {
+            if (sequence_group->has_finished() || sequence_group->handle_stopped() || sequence_group->handle_cancelled() ||
+                !m_block_manager->is_swapped_out(sequence_group)) {
+                continue;
+            }
+            size_t num_required_blocks = m_block_manager->required_blocks_count_for_swap_in(sequence_group);
+            while (!m_block_manager->can_allocate_blocks(num_required_blocks)) {
+                if (!_try_increase_cache()) {
+                    break;
+                }
+            }
+            if (!m_block_manager->can_allocate_blocks(num_required_blocks)) {
+                // keep the priority order: groups after this one will not be swapped in before it
+                break;
+            }
+            auto group_swap_in_map = m_block_manager->swap_in(sequence_group);
+            swap_in_map.resize(group_swap_in_map.size());
+            for (size_t layer_idx = 0; layer_idx < group_swap_in_map.size(); layer_idx++) {
+                swap_in_map[layer_idx].insert(group_swap_in_map[layer_idx].begin(), group_swap_in_map[layer_idx].end());
+            }
+        }
+    }
+
     void _clear_waiting_sequences(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             sequence_groups[sequence_group_id]->clear_waiting_sequences();
@@ -509,29 +1080,14 @@ private:
         auto device = m_cache_manager->get_device();
         OPENVINO_ASSERT(device.find("GPU") != std::string::npos, "_get_available_gpu_memory() is applicable for GPU only.");
 
-        ov::Core core = utils::singleton_core();
-        auto memory_statistics = core.get_property(device, ov::intel_gpu::memory_statistics);
-        auto device_type = core.get_property(device, ov::device::type);
-
-        // sum up all used device memory
-        std::vector<std::string> device_memory_types = {"cl_mem", "usm_device"};
-        size_t used_device_mem = 0;
-        for (auto mem_type: device_memory_types) {
-            used_device_mem += memory_statistics[mem_type];
-        }
-
-        if (device_type == ov::device::Type::INTEGRATED) {
-            used_device_mem += memory_statistics["usm_host"];
-        }
-
         // there could be unaccounted extra memory reserved by kernels, kept
         // in memory pools, etc
         // therefore, add a threshold to account for this
         float used_memory_threshold = 1.1;
-        used_device_mem *= used_memory_threshold;
+        size_t used_device_mem = get_used_gpu_memory(device) * used_memory_threshold;
 
         // total device memory in bytes
-        auto total_device_memory = core.get_property(device, ov::intel_gpu::device_total_mem_size);
+        auto total_device_memory = utils::singleton_core().get_property(device, ov::intel_gpu::device_total_mem_size);
 
         return total_device_memory - used_device_mem;
     }
@@ -546,12 +1102,29 @@ private:
             if (gen_config.is_beam_search()) {
                 blocks_num *= gen_config.num_beams;
             } else if (gen_config.is_multinomial()) {
-                blocks_num *= gen_config.num_return_sequences;
+                blocks_num *= std::max(gen_config.num_return_sequences, gen_config.best_of);
             }
             blocks_sum += blocks_num;
         }
-        m_block_manager->increase_kv_blocks_number(blocks_sum);
+        _initialize_dynamic_cache(blocks_sum);
+    }
+
+    void _initialize_dynamic_cache(size_t num_kv_blocks) {
+        if (m_kv_cache_budget) {
+            num_kv_blocks = m_kv_cache_budget->allocate_blocks(num_kv_blocks, m_cache_manager->get_block_size_in_bytes());
+        }
+        m_block_manager->increase_kv_blocks_number(num_kv_blocks);
         m_dynamic_memory_allocation = true;
+
+        if (m_cache_manager->get_device().find("GPU") == std::string::npos && m_cache_manager->get_block_size_in_bytes() > 0) {
+            // the host KV cache can't grow beyond the physical memory anyway, so reserve the address space for that much
+            // to grow the cache in place
+            size_t max_cache_size_in_bytes = ReservedMemory::get_total_physical_memory();
+            if (m_kv_cache_budget) {
+                max_cache_size_in_bytes = std::min(max_cache_size_in_bytes, m_kv_cache_budget->get_total_bytes());
+            }
+            m_cache_manager->reserve_cache(max_cache_size_in_bytes / m_cache_manager->get_block_size_in_bytes());
+        }
     }
 
     bool _try_increase_cache() {
@@ -559,26 +1132,22 @@ private:
             return false;
         }
         auto device = m_cache_manager->get_device();
+        const size_t block_size_in_bytes = m_cache_manager->get_block_size_in_bytes();
         size_t current_num_of_kv_blocks = m_block_manager->get_total_number_of_kv_blocks();
         size_t new_blocks_num = current_num_of_kv_blocks * m_cache_growth_factor;
+        size_t blocks_to_add = new_blocks_num - current_num_of_kv_blocks;
 
-        if (device.find("GPU") == std::string::npos) {
-            m_block_manager->increase_kv_blocks_number(new_blocks_num);
-        } else {
+        if (device.find("GPU") != std::string::npos) {
             const size_t available_gpu_memory = _get_available_gpu_memory();
-            const size_t block_size_in_bytes = m_cache_manager->get_block_size_in_bytes();
-            size_t required_memory = (new_blocks_num - current_num_of_kv_blocks) * block_size_in_bytes;
-            if (required_memory <= available_gpu_memory) {
-                m_block_manager->increase_kv_blocks_number(new_blocks_num);
-            } else {
-                size_t possible_blocks_to_add = available_gpu_memory / block_size_in_bytes;
-                if (possible_blocks_to_add > 0) {
-                    m_block_manager->increase_kv_blocks_number(current_num_of_kv_blocks + possible_blocks_to_add);
-                } else {
-                    return false;
-                }
-            }
+            blocks_to_add = std::min(blocks_to_add, available_gpu_memory / block_size_in_bytes);
+        }
+        if (m_kv_cache_budget) {
+            blocks_to_add = m_kv_cache_budget->allocate_blocks(blocks_to_add, block_size_in_bytes);
+        }
+        if (blocks_to_add == 0) {
+            return false;
         }
+        m_block_manager->increase_kv_blocks_number(current_num_of_kv_blocks + blocks_to_add);
         return true;
     }
 
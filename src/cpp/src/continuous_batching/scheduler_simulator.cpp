@@ -0,0 +1,223 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/scheduler_simulator.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#include "openvino/op/concat.hpp"
+#include "openvino/op/parameter.hpp"
+#include "continuous_batching/cache_manager.hpp"
+#include "continuous_batching/scheduler.hpp"
+#include "continuous_batching/serving_metrics.hpp"
+#include "sequence_group.hpp"
+#include "utils.hpp"
+
+namespace {
+
+using namespace ov::genai;
+
+// The cache manager only needs the names, the shapes and the precisions of the KV cache inputs, so a single layer of
+// a single element per block keeps the simulated KV cache tiny.
+std::shared_ptr<CacheManager> create_dummy_cache_manager() {
+    const ov::PartialShape shape{ov::Dimension::dynamic(), 1, 1, 1};
+    auto key = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto value = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    key->get_output_tensor(0).set_names({"key_cache.0"});
+    value->get_output_tensor(0).set_names({"value_cache.0"});
+    auto concat = std::make_shared<ov::op::v0::Concat>(ov::NodeVector{key, value}, 1);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{concat}, ov::ParameterVector{key, value});
+    ov::InferRequest request = utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+    return std::make_shared<CacheManager>(request);
+}
+
+// the token ids are only hashed by the prefix cache, so they merely have to differ between the requests
+TokenIds get_prompt_ids(const SimulatedRequest& request, size_t request_index) {
+    TokenIds prompt_ids(request.prompt_len);
+    const size_t prefix_len = request.prefix_id != 0 ? std::min(request.prefix_len, request.prompt_len) : 0;
+    for (size_t i = 0; i < request.prompt_len; ++i) {
+        prompt_ids[i] = i < prefix_len ? -static_cast<int64_t>((request.prefix_id << 32) | i) - 1
+                                       : static_cast<int64_t>((request_index << 32) | i);
+    }
+    return prompt_ids;
+}
+
+struct RequestState {
+    float arrival_time_ms = 0.0f;
+    size_t output_len = 0;
+    bool is_scheduled = false;
+    size_t num_generated_tokens = 0;
+    float last_token_time_ms = 0.0f;
+};
+
+}  // namespace
+
+namespace ov::genai {
+
+SchedulerSimulator::SchedulerSimulator(const Config& config, CostModel cost_model)
+    : m_config(config),
+      m_cost_model(std::move(cost_model)) {
+    SchedulerConfig& scheduler_config = m_config.scheduler_config;
+    if (scheduler_config.num_kv_blocks == 0 && scheduler_config.cache_size > 0) {
+        OPENVINO_ASSERT(m_config.kv_cache_bytes_per_token > 0,
+                        "kv_cache_bytes_per_token is required to derive the number of the KV cache blocks from cache_size");
+        const size_t size_in_bytes = scheduler_config.cache_size * 1024 * 1024 * 1024;
+        scheduler_config.num_kv_blocks = size_in_bytes / (m_config.kv_cache_bytes_per_token * m_config.block_size);
+    }
+    OPENVINO_ASSERT(scheduler_config.num_kv_blocks > 0, "Dynamic KV cache allocation is not simulated, set num_kv_blocks or cache_size");
+    OPENVINO_ASSERT(scheduler_config.swap_space_size == 0 && scheduler_config.swap_space_disk_size == 0,
+                    "The swap space of the KV cache is not simulated");
+    OPENVINO_ASSERT(!scheduler_config.use_cache_eviction && !scheduler_config.use_sparse_attention,
+                    "Cache eviction and sparse attention are not simulated");
+    OPENVINO_ASSERT(scheduler_config.prefix_cache_path.empty(), "The persistent prefix cache is not simulated");
+    OPENVINO_ASSERT(m_config.block_size > 0, "block_size must be non-zero");
+    OPENVINO_ASSERT(m_cost_model, "The cost model is not set");
+}
+
+SimulationResults SchedulerSimulator::run(std::vector<SimulatedRequest> trace) const {
+    std::stable_sort(trace.begin(), trace.end(), [](const SimulatedRequest& lhs, const SimulatedRequest& rhs) {
+        return lhs.arrival_time_ms < rhs.arrival_time_ms;
+    });
+    for (const SimulatedRequest& request : trace) {
+        OPENVINO_ASSERT(request.prompt_len > 0 && request.output_len > 0, "Prompt and output lengths of a request must be non-zero");
+    }
+
+    Scheduler scheduler(m_config.block_size, create_dummy_cache_manager(), m_config.scheduler_config, 1, m_config.can_use_partial_preemption);
+    // the arrival times of the sequence groups are in the simulated time for the DEADLINE policy
+    const auto epoch = std::chrono::steady_clock::now();
+    auto to_time_point = [&](float time_ms) {
+        return epoch + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float, std::milli>(time_ms));
+    };
+
+    Histogram ttft, tpot, queue_time, e2e_latency, cache_usage;
+    SimulationResults results;
+    std::vector<RequestState> states(trace.size());
+    std::vector<SequenceGroup::Ptr> requests;
+    const float start_time_ms = trace.empty() ? 0.0f : trace.front().arrival_time_ms;
+    float time_ms = start_time_ms;
+    size_t next_request = 0;
+
+    auto free_request = [&](const SequenceGroup::Ptr& request) {
+        for (const auto& sequence : request->get_sequences()) {
+            if (scheduler.has_block_table(sequence->get_id())) {
+                scheduler.free_sequence(sequence->get_id());
+            }
+        }
+    };
+
+    while (next_request < trace.size() || !requests.empty()) {
+        if (requests.empty()) {
+            time_ms = std::max(time_ms, trace[next_request].arrival_time_ms);
+        }
+        for (; next_request < trace.size() && trace[next_request].arrival_time_ms <= time_ms; ++next_request) {
+            const SimulatedRequest& request = trace[next_request];
+            GenerationConfig generation_config = ov::genai::greedy();
+            generation_config.max_new_tokens = request.output_len;
+            generation_config.ignore_eos = true;
+            generation_config.priority = request.priority;
+            generation_config.ttft_slo_ms = request.ttft_slo_ms;
+            generation_config.tenant_id = request.tenant_id;
+
+            auto sequence_group = std::make_shared<SequenceGroup>(next_request, get_prompt_ids(request, next_request), generation_config, m_config.block_size);
+            sequence_group->set_arrival_time(to_time_point(request.arrival_time_ms));
+            if (m_config.scheduler_config.enable_prefix_caching) {
+                scheduler.restore_cached_blocks(sequence_group);
+            }
+            states[next_request].arrival_time_ms = request.arrival_time_ms;
+            states[next_request].output_len = request.output_len;
+            requests.push_back(sequence_group);
+        }
+
+        Scheduler::Output scheduler_output = scheduler.schedule(requests);
+        ++results.num_steps;
+        cache_usage.record(scheduler_output.m_cache_usage);
+
+        // the KV cache can't fit the requests, which the pipeline drops as out of memory
+        if (scheduler_output.m_total_num_scheduled_tokens == 0) {
+            const bool has_running_requests = std::any_of(requests.begin(), requests.end(), [](const SequenceGroup::Ptr& request) {
+                return !request->is_waiting();
+            });
+            auto dropped_end = std::stable_partition(requests.begin(), requests.end(), [&](const SequenceGroup::Ptr& request) {
+                // unlike the pipeline, the requests which are all waiting are dropped too, since nothing would change
+                return has_running_requests && request->is_waiting();
+            });
+            std::for_each(dropped_end, requests.end(), free_request);
+            results.num_dropped_requests += std::distance(dropped_end, requests.end());
+            requests.erase(dropped_end, requests.end());
+            continue;
+        }
+
+        SimulatedStep step;
+        step.num_scheduled_tokens = scheduler_output.m_total_num_scheduled_tokens;
+        for (uint64_t sequence_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+            const SequenceGroup::Ptr& request = requests[sequence_group_id];
+            const size_t num_sequences = request->num_running_seqs();
+            const size_t num_processed_tokens = request->get_num_processed_tokens();
+            if (num_processed_tokens < request->get_prompt_len()) {
+                step.num_prompt_tokens += std::min(request->get_num_scheduled_tokens(), request->get_prompt_len() - num_processed_tokens) * num_sequences;
+            }
+            step.num_scheduled_sequences += num_sequences;
+            step.num_context_tokens += request->get_context_len() * num_sequences;
+
+            RequestState& state = states[request->get_request_id()];
+            if (!state.is_scheduled) {
+                state.is_scheduled = true;
+                queue_time.record(time_ms - state.arrival_time_ms);
+            }
+        }
+        const float step_latency_ms = m_cost_model(step);
+        OPENVINO_ASSERT(step_latency_ms >= 0.0f, "The cost model returned a negative latency ", step_latency_ms);
+        time_ms += step_latency_ms;
+
+        // generates the tokens of the sequences, which have processed their prompts
+        for (uint64_t sequence_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+            const SequenceGroup::Ptr& request = requests[sequence_group_id];
+            RequestState& state = states[request->get_request_id()];
+            if (request->requires_sampling()) {
+                for (const auto& sequence : request->get_running_sequences()) {
+                    sequence->append_token(0, 0.0f);
+                }
+            }
+            request->finish_iteration();
+
+            const size_t num_generated_tokens = (*request)[0]->get_generated_len();
+            if (num_generated_tokens > state.num_generated_tokens) {
+                if (state.num_generated_tokens == 0) {
+                    ttft.record(time_ms - state.arrival_time_ms);
+                } else {
+                    tpot.record(time_ms - state.last_token_time_ms);
+                }
+                results.num_generated_tokens += num_generated_tokens - state.num_generated_tokens;
+                state.num_generated_tokens = num_generated_tokens;
+                state.last_token_time_ms = time_ms;
+            }
+            if (state.num_generated_tokens >= state.output_len) {
+                for (const auto& sequence : request->get_running_sequences()) {
+                    sequence->set_status(SequenceStatus::FINISHED);
+                }
+            }
+        }
+
+        auto finished_begin = std::stable_partition(requests.begin(), requests.end(), [](const SequenceGroup::Ptr& request) {
+            return !request->has_finished();
+        });
+        for (auto it = finished_begin; it != requests.end(); ++it) {
+            e2e_latency.record(time_ms - states[(*it)->get_request_id()].arrival_time_ms);
+            free_request(*it);
+        }
+        results.num_finished_requests += std::distance(finished_begin, requests.end());
+        requests.erase(finished_begin, requests.end());
+    }
+
+    results.ttft = ttft.get_snapshot();
+    results.tpot = tpot.get_snapshot();
+    results.queue_time = queue_time.get_snapshot();
+    results.e2e_latency = e2e_latency.get_snapshot();
+    results.cache_usage = cache_usage.get_snapshot();
+    results.num_preemptions = scheduler.get_num_preemptions();
+    results.duration_ms = time_ms - start_time_ms;
+    return results;
+}
+
+}  // namespace ov::genai
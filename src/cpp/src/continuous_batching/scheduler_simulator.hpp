@@ -0,0 +1,119 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/scheduler_config.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief A request of a trace replayed by SchedulerSimulator.
+ */
+struct SimulatedRequest {
+    // since the start of the trace
+    float arrival_time_ms = 0.0f;
+    size_t prompt_len = 0;
+    // number of the tokens to generate
+    size_t output_len = 0;
+    // the requests with the same non-zero prefix_id share the first prefix_len prompt tokens, e.g. a system prompt,
+    // which may be restored from the prefix cache
+    size_t prefix_id = 0;
+    size_t prefix_len = 0;
+    // for the scheduling policies, see GenerationConfig
+    int64_t priority = 0;
+    size_t ttft_slo_ms = 0;
+    std::string tenant_id;
+};
+
+/**
+ * @brief Batch of a simulated generation step, which the cost model estimates the forward latency of.
+ */
+struct SimulatedStep {
+    // over all scheduled sequences
+    size_t num_scheduled_tokens = 0;
+    // the scheduled tokens, which belong to the prompts
+    size_t num_prompt_tokens = 0;
+    size_t num_scheduled_sequences = 0;
+    // number of the tokens in the KV cache attended by the scheduled sequences, including the scheduled ones
+    size_t num_context_tokens = 0;
+};
+
+/**
+ * @brief Returns the forward latency of a step in milliseconds.
+ */
+using CostModel = std::function<float(const SimulatedStep&)>;
+
+/**
+ * @brief Cost model linear in the numbers of the tokens, which may be fitted to the latencies of a few benchmarked batches:
+ * the weights dominate the cost of the small batches, the compute of the prompt tokens and the attention over the
+ * context dominate the large ones.
+ */
+struct LinearCostModel {
+    // cost of a step regardless of the batch, e.g. reading the weights
+    float step_ms = 0.0f;
+    float per_token_ms = 0.0f;
+    float per_sequence_ms = 0.0f;
+    float per_context_token_ms = 0.0f;
+
+    float operator()(const SimulatedStep& step) const {
+        return step_ms + per_token_ms * step.num_scheduled_tokens + per_sequence_ms * step.num_scheduled_sequences +
+               per_context_token_ms * step.num_context_tokens;
+    }
+};
+
+struct SimulationResults {
+    // latencies in milliseconds, counted from the arrival of a request
+    HistogramSnapshot ttft;
+    // time per output token, i.e. between the consecutive generated tokens
+    HistogramSnapshot tpot;
+    HistogramSnapshot queue_time;
+    HistogramSnapshot e2e_latency;
+    // in percent at each step
+    HistogramSnapshot cache_usage;
+
+    size_t num_steps = 0;
+    size_t num_finished_requests = 0;
+    // the requests the KV cache was too small for, which the pipeline would drop as out of memory
+    size_t num_dropped_requests = 0;
+    size_t num_preemptions = 0;
+    size_t num_generated_tokens = 0;
+    // from the arrival of the first request to the end of the last step
+    float duration_ms = 0.0f;
+};
+
+/**
+ * @brief Replays request traces through the actual Scheduler and BlockManager in the simulated time, where each step
+ * lasts as long as the cost model estimates, so that the scheduler config (max_num_batched_tokens, num_kv_blocks,
+ * max_num_seqs, the scheduling policy, prefix caching etc.) may be tuned offline without a model and hardware.
+ * Each scheduled sequence generates a token when its prompt is processed, the way greedy decoding with ignore_eos does.
+ * The KV cache is backed by a dummy model, so the swap space is not simulated and the number of the KV cache blocks
+ * has to be set explicitly or derived from cache_size by the number of the bytes of the KV cache per token.
+ */
+class SchedulerSimulator {
+public:
+    struct Config {
+        SchedulerConfig scheduler_config;
+        // tokens per KV cache block, 32 on CPU and 16 on GPU
+        size_t block_size = 32;
+        // sum over the layers of the sizes of a key and a value of a token, used to derive num_kv_blocks from cache_size
+        size_t kv_cache_bytes_per_token = 0;
+        // the pipeline disables partial preemption for GPU without dynamic split fuse
+        bool can_use_partial_preemption = true;
+    };
+
+    SchedulerSimulator(const Config& config, CostModel cost_model);
+
+    SimulationResults run(std::vector<SimulatedRequest> trace) const;
+
+private:
+    Config m_config;
+    CostModel m_cost_model;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,196 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/serving_metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace {
+
+template <typename T, typename Compare>
+void update_extremum(std::atomic<T>& extremum, T value, Compare compare) {
+    T current = extremum.load(std::memory_order_relaxed);
+    while (compare(value, current) && !extremum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+float get_microseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<float, std::micro>(duration).count();
+}
+
+void write_summary(std::ostream& stream, const std::string& name, const std::string& help, const ov::genai::HistogramSnapshot& histogram) {
+    stream << "# HELP " << name << ' ' << help << '\n';
+    stream << "# TYPE " << name << " summary\n";
+    for (float quantile : {0.5f, 0.9f, 0.95f, 0.99f}) {
+        stream << name << "{quantile=\"" << quantile << "\"} " << histogram.get_percentile(quantile * 100) << '\n';
+    }
+    stream << name << "_sum " << histogram.sum << '\n';
+    stream << name << "_count " << histogram.count << '\n';
+}
+
+void write_counter(std::ostream& stream, const std::string& name, const std::string& help, size_t value) {
+    stream << "# HELP " << name << ' ' << help << '\n';
+    stream << "# TYPE " << name << " counter\n";
+    stream << name << ' ' << value << '\n';
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+float HistogramSnapshot::get_percentile(float percent) const {
+    if (count == 0) {
+        return 0.0f;
+    }
+    const size_t rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(percent / 100.0f * count)));
+    size_t num_values = 0;
+    for (const auto& [upper_bound, bucket_count] : buckets) {
+        num_values += bucket_count;
+        if (num_values >= rank) {
+            return std::clamp(upper_bound, min, max);
+        }
+    }
+    return max;
+}
+
+float HistogramSnapshot::get_mean() const {
+    return count == 0 ? 0.0f : static_cast<float>(sum / count);
+}
+
+std::string ServingMetrics::to_prometheus(const std::string& prefix) const {
+    std::stringstream stream;
+    write_summary(stream, prefix + "_ttft_microseconds", "Time to the first token of a request", ttft);
+    write_summary(stream, prefix + "_inter_token_latency_microseconds", "Time between the generated tokens of a request", inter_token_latency);
+    write_summary(stream, prefix + "_queue_time_microseconds", "Time from adding a request to its first scheduling", queue_time);
+    write_summary(stream, prefix + "_prefix_cache_hit_ratio_percent", "Percentage of the prompt tokens of a request restored from the prefix cache", prefix_cache_hit_ratio);
+    write_summary(stream, prefix + "_kv_cache_usage_percent", "KV cache usage at a generation step", cache_usage);
+    write_counter(stream, prefix + "_preemptions_total", "Number of the preemptions of the KV cache of the requests", num_preemptions);
+    write_counter(stream, prefix + "_finished_requests_total", "Number of the finished requests", num_finished_requests);
+    return stream.str();
+}
+
+size_t Histogram::get_bucket(float value) {
+    if (!(value >= std::ldexp(1.0f, min_exponent))) {
+        return 0;
+    }
+    int exponent = 0;
+    // value = mantissa * 2^exponent, mantissa is in [0.5, 1)
+    const float mantissa = std::frexp(value, &exponent);
+    const int power = exponent - 1;
+    if (power >= max_exponent) {
+        return num_buckets - 1;
+    }
+    const size_t sub_bucket = std::min(static_cast<size_t>((mantissa - 0.5f) * 2 * num_sub_buckets), num_sub_buckets - 1);
+    return 1 + static_cast<size_t>(power - min_exponent) * num_sub_buckets + sub_bucket;
+}
+
+float Histogram::get_upper_bound(size_t bucket) {
+    if (bucket == 0) {
+        return std::ldexp(1.0f, min_exponent);
+    }
+    const int power = static_cast<int>((bucket - 1) / num_sub_buckets) + min_exponent;
+    const size_t sub_bucket = (bucket - 1) % num_sub_buckets;
+    return std::ldexp(1.0f + static_cast<float>(sub_bucket + 1) / num_sub_buckets, power);
+}
+
+void Histogram::record(float value, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    m_counts[get_bucket(value)].fetch_add(count, std::memory_order_relaxed);
+    double sum = m_sum.load(std::memory_order_relaxed);
+    while (!m_sum.compare_exchange_weak(sum, sum + static_cast<double>(value) * count, std::memory_order_relaxed)) {
+    }
+    if (m_count.fetch_add(count, std::memory_order_relaxed) == 0) {
+        // the first value, the concurrent records are merged by the updates below
+        m_min.store(value, std::memory_order_relaxed);
+        m_max.store(value, std::memory_order_relaxed);
+    }
+    update_extremum(m_min, value, std::less<float>());
+    update_extremum(m_max, value, std::greater<float>());
+}
+
+HistogramSnapshot Histogram::get_snapshot() const {
+    HistogramSnapshot snapshot;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        if (const size_t count = m_counts[bucket].load(std::memory_order_relaxed)) {
+            snapshot.buckets.emplace_back(get_upper_bound(bucket), count);
+            snapshot.count += count;
+        }
+    }
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+    snapshot.min = m_min.load(std::memory_order_relaxed);
+    snapshot.max = m_max.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void ServingMetricsRecorder::on_scheduled(const std::vector<SequenceGroup::Ptr>& requests,
+                                          float cache_usage,
+                                          const PrefixCacheStats& prefix_cache_stats,
+                                          size_t num_preemptions) {
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& request : requests) {
+        if (request->is_scheduled() && m_requests.emplace(request->get_request_id(), RequestState{}).second) {
+            m_queue_time.record(get_microseconds(now - request->get_arrival_time()));
+        }
+    }
+    m_cache_usage.record(cache_usage);
+
+    // the requests looked up in the prefix cache at this step share the ratio of their restored tokens
+    const size_t num_lookups = prefix_cache_stats.num_lookups - m_prefix_cache_stats.num_lookups;
+    const size_t num_prompt_tokens = prefix_cache_stats.num_prompt_tokens - m_prefix_cache_stats.num_prompt_tokens;
+    if (num_lookups > 0 && num_prompt_tokens > 0) {
+        const size_t num_restored_tokens = prefix_cache_stats.num_restored_tokens - m_prefix_cache_stats.num_restored_tokens;
+        m_prefix_cache_hit_ratio.record(100.0f * num_restored_tokens / num_prompt_tokens, num_lookups);
+    }
+    m_prefix_cache_stats = prefix_cache_stats;
+    m_num_preemptions.store(num_preemptions, std::memory_order_relaxed);
+}
+
+void ServingMetricsRecorder::on_sampled(const std::vector<SequenceGroup::Ptr>& requests) {
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& request : requests) {
+        auto it = m_requests.find(request->get_request_id());
+        if (it == m_requests.end()) {
+            continue;
+        }
+        size_t num_generated_tokens = 0;
+        for (const auto& sequence : request->get_sequences()) {
+            num_generated_tokens = std::max(num_generated_tokens, sequence->get_generated_len());
+        }
+        RequestState& state = it->second;
+        if (num_generated_tokens <= state.num_generated_tokens) {
+            continue;
+        }
+        if (state.num_generated_tokens == 0) {
+            m_ttft.record(get_microseconds(now - request->get_arrival_time()));
+        } else {
+            // e.g. the tokens accepted by speculative decoding at a step share the latency
+            const size_t num_new_tokens = num_generated_tokens - state.num_generated_tokens;
+            m_inter_token_latency.record(get_microseconds(now - state.last_token_time) / num_new_tokens, num_new_tokens);
+        }
+        state.num_generated_tokens = num_generated_tokens;
+        state.last_token_time = now;
+    }
+}
+
+void ServingMetricsRecorder::on_finished(uint64_t request_id) {
+    m_requests.erase(request_id);
+    m_num_finished_requests.fetch_add(1, std::memory_order_relaxed);
+}
+
+ServingMetrics ServingMetricsRecorder::get_metrics() const {
+    ServingMetrics metrics;
+    metrics.ttft = m_ttft.get_snapshot();
+    metrics.inter_token_latency = m_inter_token_latency.get_snapshot();
+    metrics.queue_time = m_queue_time.get_snapshot();
+    metrics.prefix_cache_hit_ratio = m_prefix_cache_hit_ratio.get_snapshot();
+    metrics.cache_usage = m_cache_usage.get_snapshot();
+    metrics.num_preemptions = m_num_preemptions.load(std::memory_order_relaxed);
+    metrics.num_finished_requests = m_num_finished_requests.load(std::memory_order_relaxed);
+    return metrics;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,78 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "continuous_batching/block_manager.hpp"
+#include "sequence_group.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Histogram of bounded memory, which is recorded and read without locking. The positive values from 2^-8 to
+ * 2^40 are counted in 8 linear buckets per power of 2, the smaller values are counted in the first bucket and the
+ * larger ones in the last bucket.
+ */
+class Histogram {
+public:
+    static constexpr size_t num_sub_buckets = 8;
+    static constexpr int min_exponent = -8, max_exponent = 40;
+    // the bucket of zero and the values below 2^-8 goes first
+    static constexpr size_t num_buckets = 1 + (max_exponent - min_exponent) * num_sub_buckets;
+
+    void record(float value, size_t count = 1);
+
+    HistogramSnapshot get_snapshot() const;
+
+    static size_t get_bucket(float value);
+
+    // the largest value counted in the bucket
+    static float get_upper_bound(size_t bucket);
+
+private:
+    std::array<std::atomic<uint64_t>, num_buckets> m_counts{};
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<double> m_sum{0.0};
+    std::atomic<float> m_min{0.0f}, m_max{0.0f};
+};
+
+/**
+ * @brief Records the serving metrics of a continuous batching pipeline at its steps. The recording methods are called by
+ * the thread stepping the pipeline, get_metrics() may be called by any thread.
+ */
+class ServingMetricsRecorder {
+public:
+    // after scheduling, records the queue time of the requests scheduled for the first time
+    void on_scheduled(const std::vector<SequenceGroup::Ptr>& requests,
+                      float cache_usage,
+                      const PrefixCacheStats& prefix_cache_stats,
+                      size_t num_preemptions);
+
+    // after sampling, records the latencies of the generated tokens
+    void on_sampled(const std::vector<SequenceGroup::Ptr>& requests);
+
+    void on_finished(uint64_t request_id);
+
+    ServingMetrics get_metrics() const;
+
+private:
+    struct RequestState {
+        size_t num_generated_tokens = 0;
+        std::chrono::steady_clock::time_point last_token_time;
+    };
+    // the requests scheduled at least once
+    std::unordered_map<uint64_t, RequestState> m_requests;
+    PrefixCacheStats m_prefix_cache_stats;
+
+    Histogram m_ttft, m_inter_token_latency, m_queue_time, m_prefix_cache_hit_ratio, m_cache_usage;
+    std::atomic<size_t> m_num_preemptions{0}, m_num_finished_requests{0};
+};
+
+}  // namespace ov::genai
@@ -5,6 +5,8 @@
 #include <vector>
 #include <cstdlib>
 #include <cmath>
+#include <algorithm>
+#include <numeric>
 
 #include "continuous_batching/sparse_attention.hpp"
 
@@ -33,4 +35,88 @@ std::set<size_t> TriShapeSparseAttentionTokenSkipper::get_skipped_blocks(const S
     // else skip nothing, dense attention phase
     return skipped_logical_block_ids;
 }
+
+SparseDecodingBlockSelector::SparseDecodingBlockSelector(size_t block_size,
+                                                         float threshold,
+                                                         size_t dense_interval,
+                                                         size_t num_retained_start_tokens_in_cache,
+                                                         size_t num_retained_recent_tokens_in_cache)
+    : m_block_size(block_size),
+      m_threshold(threshold),
+      m_dense_interval(dense_interval),
+      m_num_retained_start_blocks(num_retained_start_tokens_in_cache / block_size),
+      m_num_retained_recent_blocks(num_retained_recent_tokens_in_cache / block_size) {
+    OPENVINO_ASSERT(threshold > 0.0f && threshold <= 1.0f, "decode_threshold must be in (0, 1] range, got ", threshold);
+    OPENVINO_ASSERT(dense_interval > 0, "decode_dense_interval must be non-zero");
+    OPENVINO_ASSERT(!(num_retained_start_tokens_in_cache % block_size),
+                    "num_retained_start_tokens_in_cache in tokens must be a multiple of block size ", block_size);
+    OPENVINO_ASSERT(!(num_retained_recent_tokens_in_cache % block_size),
+                    "num_retained_recent_tokens_in_cache in tokens must be a multiple of block size ", block_size);
+}
+
+void SparseDecodingBlockSelector::register_scores(uint64_t seq_id, const AttentionScoresForEachDecoderLayer& attention_scores_for_all_decoder_layers) {
+    auto& importance = m_block_importances[seq_id];
+    importance.num_steps_since_dense_step = 0;
+    importance.block_scores.clear();
+    for (const auto& attention_scores : attention_scores_for_all_decoder_layers) {
+        const float* scores_data = attention_scores.data<float>();
+        size_t num_tokens = attention_scores.get_size();
+        size_t num_blocks = (num_tokens + m_block_size - 1) / m_block_size;
+        if (importance.block_scores.size() < num_blocks) {
+            importance.block_scores.resize(num_blocks, 0.0f);
+        }
+        for (size_t token_idx = 0; token_idx < num_tokens; token_idx++) {
+            importance.block_scores[token_idx / m_block_size] += scores_data[token_idx];
+        }
+    }
+}
+
+std::set<size_t> SparseDecodingBlockSelector::get_skipped_blocks(uint64_t seq_id, size_t num_cached_tokens) {
+    std::set<size_t> skipped_logical_block_ids;
+    auto it = m_block_importances.find(seq_id);
+    if (it == m_block_importances.end()) {
+        // no estimates yet, the step is dense
+        return skipped_logical_block_ids;
+    }
+    auto& importance = it->second;
+    if (++importance.num_steps_since_dense_step >= m_dense_interval) {
+        return skipped_logical_block_ids;
+    }
+
+    // only full blocks between the retained areas, which were scored at the last dense step, may be skipped
+    size_t num_cached_full_blocks = num_cached_tokens / m_block_size;
+    size_t num_retained_blocks = m_num_retained_start_blocks + m_num_retained_recent_blocks;
+    if (num_cached_full_blocks <= num_retained_blocks) {
+        return skipped_logical_block_ids;
+    }
+    size_t end_block_idx = std::min(num_cached_full_blocks - m_num_retained_recent_blocks, importance.block_scores.size());
+    if (end_block_idx <= m_num_retained_start_blocks) {
+        return skipped_logical_block_ids;
+    }
+
+    std::vector<size_t> block_ids(end_block_idx - m_num_retained_start_blocks);
+    std::iota(block_ids.begin(), block_ids.end(), m_num_retained_start_blocks);
+    const auto& block_scores = importance.block_scores;
+    std::sort(block_ids.begin(), block_ids.end(), [&block_scores](size_t lhs, size_t rhs) {
+        return block_scores[lhs] > block_scores[rhs] || (block_scores[lhs] == block_scores[rhs] && lhs < rhs);
+    });
+    float total_score = 0.0f;
+    for (size_t block_id : block_ids) {
+        total_score += block_scores[block_id];
+    }
+
+    // attend to the most important blocks until their share of the total importance reaches the threshold
+    float attended_score = 0.0f;
+    size_t num_attended_blocks = 0;
+    while (num_attended_blocks < block_ids.size() && attended_score < m_threshold * total_score) {
+        attended_score += block_scores[block_ids[num_attended_blocks]];
+        num_attended_blocks++;
+    }
+    skipped_logical_block_ids.insert(block_ids.begin() + num_attended_blocks, block_ids.end());
+    return skipped_logical_block_ids;
+}
+
+void SparseDecodingBlockSelector::remove_sequence(uint64_t seq_id) {
+    m_block_importances.erase(seq_id);
+}
 }
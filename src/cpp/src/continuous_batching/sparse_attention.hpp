@@ -5,10 +5,13 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <map>
+#include <set>
 #include <vector>
 
 #include "continuous_batching/attention_output.hpp"
 #include "openvino/genai/cache_eviction.hpp"
+#include "openvino/genai/scheduler_config.hpp"
 #include "sequence_group.hpp"
 
 namespace ov::genai {
@@ -59,4 +62,66 @@ private:
     size_t m_num_retained_recent_tokens_in_cache;
 };
 
+inline bool is_sparse_decoding_enabled(const SchedulerConfig& scheduler_config) {
+    return scheduler_config.use_sparse_attention && scheduler_config.sparse_attention_config.decode_threshold < 1.0f;
+}
+
+/**
+ * @brief Selects the KV cache logical blocks to be skipped during the generation stage steps of each sequence. The importance
+ * of each block is estimated from the attention scores of a dense step, and the blocks with the lowest importance are skipped
+ * until the next dense step, which is done each `dense_interval` steps to refresh the estimates.
+ */
+class SparseDecodingBlockSelector {
+public:
+    SparseDecodingBlockSelector() = delete;
+
+    /**
+     * Constructs the SparseDecodingBlockSelector.
+     * @param block_size Block size in tokens.
+     * @param threshold The fraction of the total importance of the (non-retained) blocks which the attended blocks must reach.
+     * @param dense_interval Each `dense_interval`-th step of a sequence is dense.
+     * @param num_retained_start_tokens_in_cache The number of tokens in the beginning of the cache (least recent)
+     * which are never skipped. Must be a multiple of block size.
+     * @param num_retained_recent_tokens_in_cache The number of most recent tokens in cache which are never skipped.
+     * Must be a multiple of block size.
+     */
+    explicit SparseDecodingBlockSelector(size_t block_size,
+                                         float threshold,
+                                         size_t dense_interval,
+                                         size_t num_retained_start_tokens_in_cache,
+                                         size_t num_retained_recent_tokens_in_cache);
+
+    /**
+     * Registers the attention scores of a dense step of the sequence as the new block importance estimates.
+     * @param seq_id The sequence ID.
+     * @param attention_scores_for_all_decoder_layers Per-token attention scores over the whole KV cache of the sequence
+     * for each decoder layer.
+     */
+    void register_scores(uint64_t seq_id, const AttentionScoresForEachDecoderLayer& attention_scores_for_all_decoder_layers);
+
+    /**
+     * Should be called once per generation step of the sequence.
+     * @param seq_id The sequence ID.
+     * @param num_cached_tokens The number of tokens of the sequence in the KV cache before this step.
+     * @return The set of logical block IDs that should be skipped at this step of the sequence, empty if the step should be dense.
+     */
+    std::set<size_t> get_skipped_blocks(uint64_t seq_id, size_t num_cached_tokens);
+
+    void remove_sequence(uint64_t seq_id);
+
+private:
+    struct BlockImportance {
+        // { importance of each logical block at the last dense step }
+        std::vector<float> block_scores;
+        size_t num_steps_since_dense_step = 0;
+    };
+
+    size_t m_block_size;
+    float m_threshold;
+    size_t m_dense_interval;
+    size_t m_num_retained_start_blocks;
+    size_t m_num_retained_recent_blocks;
+    std::map<uint64_t, BlockImportance> m_block_importances;
+};
+
 }  // namespace ov::genai
@@ -8,6 +8,7 @@
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/text_streamer.hpp"
 #include "openvino/genai/tokenizer.hpp"
+#include "continuous_batching/tracer.hpp"
 #include "synchronized_queue.hpp"
 #include "utils.hpp"
 
@@ -77,6 +78,7 @@ private:
         while (m_status == StreamingStatus::RUNNING) {
             // wait for queue pull
             std::variant<int64_t, std::vector<int64_t>, std::monostate> token_variant = m_squeue.pull();
+            GENAI_TRACE_SCOPE("streamer: detokenize and stream");
 
             // wait for streamer_ptr result
             if (auto token = std::get_if<int64_t>(&token_variant)) {
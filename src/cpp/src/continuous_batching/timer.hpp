@@ -7,6 +7,8 @@
 #include <chrono>
 #include <iostream>
 
+#include "continuous_batching/tracer.hpp"
+
 class ManualTimer {
     double m_total;
     std::chrono::steady_clock::time_point m_start, m_end;
@@ -24,6 +26,11 @@ public:
     void end() {
         m_end = std::chrono::steady_clock::now();
         m_total += std::chrono::duration_cast<std::chrono::microseconds>(m_end - m_start).count();
+#ifdef ENABLE_TRACING
+        if (ov::genai::Tracer::instance().is_enabled()) {
+            ov::genai::Tracer::instance().record(m_title.c_str(), m_start, m_end);
+        }
+#endif
     }
 
     std::chrono::steady_clock::time_point get_start_time() {
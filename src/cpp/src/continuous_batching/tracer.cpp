@@ -0,0 +1,132 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/tracer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+#include "logger.hpp"
+#include "openvino/core/except.hpp"
+
+namespace {
+
+void write_escaped(std::ostream& stream, const char* text) {
+    for (; *text; ++text) {
+        if (*text == '"' || *text == '\\') {
+            stream << '\\';
+        }
+        stream << *text;
+    }
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::Tracer() : m_start_time(std::chrono::steady_clock::now()) {
+    if (const char* trace_file = std::getenv("OV_GENAI_TRACE_FILE")) {
+        m_trace_file = trace_file;
+        m_is_enabled = !m_trace_file.empty();
+    }
+}
+
+Tracer::~Tracer() {
+    if (m_trace_file.empty()) {
+        return;
+    }
+    try {
+        export_chrome_trace(m_trace_file);
+    } catch (const std::exception& e) {
+        Logger::warn(std::string("Failed to write the trace: ") + e.what());
+    }
+}
+
+std::vector<Tracer::Event> Tracer::ThreadBuffer::get_events() const {
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    const uint64_t num_events = std::min<uint64_t>(head, thread_capacity);
+    std::vector<Event> events;
+    events.reserve(num_events);
+    for (uint64_t i = head - num_events; i < head; ++i) {
+        events.push_back(m_events[i % thread_capacity]);
+    }
+    return events;
+}
+
+Tracer::ThreadBuffer& Tracer::get_thread_buffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        std::lock_guard<std::mutex> lock(m_buffers_mutex);
+        buffer = std::make_shared<ThreadBuffer>(m_buffers.size());
+        m_buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Tracer::record(const char* name,
+                    std::chrono::steady_clock::time_point begin,
+                    std::chrono::steady_clock::time_point end,
+                    int64_t value) {
+    Event event;
+    std::strncpy(event.name, name, sizeof(event.name) - 1);
+    event.name[sizeof(event.name) - 1] = '\0';
+    event.begin_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - m_start_time).count();
+    event.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    event.value = value;
+    get_thread_buffer().push(event);
+}
+
+void Tracer::export_chrome_trace(std::ostream& stream) const {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(m_buffers_mutex);
+        buffers = m_buffers;
+    }
+
+    const auto flags = stream.flags();
+    const auto precision = stream.precision();
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool is_first = true;
+    auto separate = [&]() {
+        stream << (is_first ? "\n" : ",\n");
+        is_first = false;
+    };
+    for (const auto& buffer : buffers) {
+        const size_t thread_id = buffer->get_thread_id();
+        separate();
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread_id
+               << ",\"args\":{\"name\":\"thread " << thread_id << "\"}}";
+        for (const Event& event : buffer->get_events()) {
+            separate();
+            // complete events with the timestamps in microseconds
+            stream << "{\"name\":\"";
+            write_escaped(stream, event.name);
+            stream << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread_id << ",\"ts\":" << event.begin_ns / 1e3
+                   << ",\"dur\":" << event.duration_ns / 1e3;
+            if (event.value >= 0) {
+                stream << ",\"args\":{\"value\":" << event.value << "}";
+            }
+            stream << "}";
+        }
+    }
+    stream << "\n]}\n";
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+void Tracer::export_chrome_trace(const std::filesystem::path& path) const {
+    std::ofstream stream(path);
+    OPENVINO_ASSERT(stream.is_open(), "Failed to open the trace file ", path);
+    export_chrome_trace(stream);
+}
+
+}  // namespace ov::genai
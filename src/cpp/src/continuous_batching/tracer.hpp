@@ -0,0 +1,146 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Timeline of the pipelines for debugging the latency spikes: the spans of the scheduler phases, the inferences,
+ * the sampling tasks, the detokenization and the streaming are recorded to the ring buffers of the threads, which keep
+ * the latest events without locking, and are exported in Chrome trace event format, which is opened by chrome://tracing
+ * and Perfetto UI.
+ * Tracing is enabled by OV_GENAI_TRACE_FILE environment variable, which sets the file the trace is written to at the exit
+ * of the process, and may be toggled at runtime by set_enabled(). The instrumentation of the pipelines is compiled in
+ * with ENABLE_TRACING CMake option.
+ */
+class Tracer {
+public:
+    struct Event {
+        // the names longer than the buffer are truncated
+        char name[48];
+        // since the creation of the tracer
+        int64_t begin_ns;
+        int64_t duration_ns;
+        // e.g. the number of the tokens or the request id, written to the arguments of the span unless negative
+        int64_t value;
+    };
+
+    // number of the latest events kept per thread
+    static constexpr size_t thread_capacity = 1 << 16;
+
+    static Tracer& instance();
+
+    ~Tracer();
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    bool is_enabled() const {
+        return m_is_enabled.load(std::memory_order_relaxed);
+    }
+
+    void set_enabled(bool is_enabled) {
+        m_is_enabled.store(is_enabled, std::memory_order_relaxed);
+    }
+
+    // Records a span of the calling thread
+    void record(const char* name,
+                std::chrono::steady_clock::time_point begin,
+                std::chrono::steady_clock::time_point end,
+                int64_t value = -1);
+
+    /**
+     * Writes the events recorded by the threads so far as Chrome trace JSON. The events recorded while exporting may be
+     * missed or torn, so the trace is expected to be exported when the pipelines are idle.
+     */
+    void export_chrome_trace(std::ostream& stream) const;
+    void export_chrome_trace(const std::filesystem::path& path) const;
+
+private:
+    Tracer();
+
+    // single producer ring buffer of a thread, which overwrites the oldest events
+    class ThreadBuffer {
+    public:
+        explicit ThreadBuffer(size_t thread_id) : m_thread_id(thread_id), m_events(thread_capacity) {}
+
+        void push(const Event& event) {
+            const uint64_t head = m_head.load(std::memory_order_relaxed);
+            m_events[head % thread_capacity] = event;
+            m_head.store(head + 1, std::memory_order_release);
+        }
+
+        std::vector<Event> get_events() const;
+
+        size_t get_thread_id() const {
+            return m_thread_id;
+        }
+
+    private:
+        size_t m_thread_id;
+        std::vector<Event> m_events;
+        std::atomic<uint64_t> m_head{0};
+    };
+
+    ThreadBuffer& get_thread_buffer();
+
+    std::atomic<bool> m_is_enabled{false};
+    std::chrono::steady_clock::time_point m_start_time;
+    std::filesystem::path m_trace_file;
+    // the buffers outlive their threads, so that the events of the finished threads are exported
+    mutable std::mutex m_buffers_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+};
+
+// Records the span of the scope if tracing is enabled
+class TraceScope {
+    const char* m_name;
+    int64_t m_value;
+    bool m_is_enabled;
+    std::chrono::steady_clock::time_point m_begin;
+
+public:
+    explicit TraceScope(const char* name, int64_t value = -1)
+        : m_name(name),
+          m_value(value),
+          m_is_enabled(Tracer::instance().is_enabled()) {
+        if (m_is_enabled) {
+            m_begin = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~TraceScope() {
+        if (m_is_enabled) {
+            Tracer::instance().record(m_name, m_begin, std::chrono::steady_clock::now(), m_value);
+        }
+    }
+
+    void set_value(int64_t value) {
+        m_value = value;
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+}  // namespace ov::genai
+
+#define GENAI_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define GENAI_TRACE_CONCAT(lhs, rhs) GENAI_TRACE_CONCAT_IMPL(lhs, rhs)
+
+#ifdef ENABLE_TRACING
+// GENAI_TRACE_SCOPE(name[, value]) records the span of the enclosing scope
+#    define GENAI_TRACE_SCOPE(...) ::ov::genai::TraceScope GENAI_TRACE_CONCAT(genai_trace_scope_, __LINE__)(__VA_ARGS__)
+#else
+#    define GENAI_TRACE_SCOPE(...)
+#endif
@@ -123,6 +123,7 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     read_anymap_param(properties, "num_return_sequences", num_return_sequences);
     read_anymap_param(properties, "adapters", adapters);
     read_anymap_param(properties, "apply_chat_template", apply_chat_template);
+    read_anymap_param(properties, "token_healing", token_healing);
 
     // penalties
     read_anymap_param(properties, "frequency_penalty", frequency_penalty);
@@ -144,6 +145,7 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     read_anymap_param(properties, "top_k", top_k);
     // TODO: add support of 'generator' property similar to Image generation
     read_anymap_param(properties, "rng_seed", rng_seed);
+    read_anymap_param(properties, "best_of", best_of);
 
     // assistant generation
     read_anymap_param(properties, "assistant_confidence_threshold", assistant_confidence_threshold);
@@ -152,6 +154,12 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
 
     // Structured output
     read_anymap_param(properties, "structured_output_config", structured_output_config);
+
+    // scheduling
+    read_anymap_param(properties, "priority", priority);
+    read_anymap_param(properties, "ttft_slo_ms", ttft_slo_ms);
+    read_anymap_param(properties, "tenant_id", tenant_id);
+    read_anymap_param(properties, "deadline_ms", deadline_ms);
 }
 
 
@@ -295,6 +303,7 @@ void GenerationConfig::validate() const {
         OPENVINO_ASSERT(presence_penalty >= -2.0f && presence_penalty <= 2.0f, "'presence_penalty' penalty must be within [-2.0; 2.0], but got ", presence_penalty);
         OPENVINO_ASSERT(repetition_penalty > 0.0f, "'repetition_penalty' must be a strictly positive float, but got ", repetition_penalty);
     } else {
+        OPENVINO_ASSERT(!token_healing, "'token_healing' is not currently supported by beam search");
         OPENVINO_ASSERT(frequency_penalty == 0.0f, "'frequency_penalty' is not currently supported by beam search and should be 0.0f, but got ", frequency_penalty);
         OPENVINO_ASSERT(presence_penalty == 0.0f, "'presence_penalty' is not currently supported by beam search and should be 0.0f, but got ", presence_penalty);
         OPENVINO_ASSERT(repetition_penalty == 1.0f, "'repetition_penalty' is not currently supported by beam search and should be 1.0f, but got ", repetition_penalty);
@@ -303,7 +312,9 @@ void GenerationConfig::validate() const {
     if (is_multinomial()) {
         OPENVINO_ASSERT(top_p > 0 && top_p <= 1.0f, "When 'do_sample' is true, top_p must be a positive float > 0.0 and <= 1.0, but got ", top_p);
         OPENVINO_ASSERT(temperature > 0, "When 'do_sample' is true, temperature must be a strictly positive float, but got ", temperature);
+        OPENVINO_ASSERT(best_of == 0 || best_of >= num_return_sequences, "'best_of' (", best_of, ") must be greater equal than 'num_return_sequences' (", num_return_sequences, ")");
     } else {
+        OPENVINO_ASSERT(best_of == 0, "'best_of' is supported only by multinomial sampling, but got ", best_of);
         // parameters requiring multinomial
         // OPENVINO_ASSERT(top_k == std::numeric_limits<size_t>::max(), "When 'do_sample' is false, top_k must be max of size_t, but got ", top_k);
         // OPENVINO_ASSERT(top_p == 1.0f, "When 'do_sample' is false, top_p must be 1.0f, but got ", top_p);
@@ -336,7 +347,7 @@ void GenerationConfig::validate() const {
     // assistant generation
 
     if (is_assisting_generation()) {
-        OPENVINO_ASSERT(!is_beam_search() && num_return_sequences == 1, "Beam search and parallel sampling are not compatible with assistant generation");
+        OPENVINO_ASSERT(!is_beam_search() && num_return_sequences == 1 && best_of <= 1, "Beam search and parallel sampling are not compatible with assistant generation");
         OPENVINO_ASSERT(assistant_confidence_threshold == 0.0f || num_assistant_tokens == 0, "Parameters `assistant_confidence_threshold` and `num_assistant_tokens` are mutually exclusive in `GenerationConfig`");
     }
 
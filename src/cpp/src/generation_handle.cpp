@@ -45,6 +45,10 @@ std::unordered_map<uint64_t, GenerationOutput> GenerationHandleImpl::read() {
     return m_generation_stream->read();
 }
 
+RequestMetrics GenerationHandleImpl::get_request_metrics() {
+    return m_generation_stream->get_request_metrics();
+}
+
 void add_partial_result(std::unordered_map<uint64_t, GenerationOutput>& partial_results, std::unordered_map<uint64_t, GenerationOutput>& iteration_results) {
     for (auto& iteration_result: iteration_results) {
         auto partial_result_iter = partial_results.find(iteration_result.first);
@@ -6,53 +6,74 @@
 #include <atomic>
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/scheduler_config.hpp"
 #include "synchronized_queue.hpp"
+#include "spsc_queue.hpp"
+#include "object_pool.hpp"
 
 namespace ov::genai {
 class GenerationStream {
-    std::mutex m_mutex;
-    GenerationStatus m_status = GenerationStatus::RUNNING;
+    std::atomic<GenerationStatus> m_status = GenerationStatus::RUNNING;
     SynchronizedQueue<GenerationOutputs> m_output_queue;
+    // used instead of m_output_queue, if set
+    std::unique_ptr<SPSCQueue<GenerationOutputs>> m_output_ring_buffer;
+    // published by the pipeline after each step of the request
+    std::mutex m_request_metrics_mutex;
+    RequestMetrics m_request_metrics;
 
 public:
     using Ptr = std::shared_ptr<GenerationStream>;
 
     // Don't use directly
-    GenerationStream() = default;
+    explicit GenerationStream(StreamingTransport transport = StreamingTransport::SYNCHRONIZED_QUEUE) {
+        if (transport == StreamingTransport::SPSC_RING_BUFFER) {
+            m_output_ring_buffer = std::make_unique<SPSCQueue<GenerationOutputs>>();
+        }
+    }
 
-    static GenerationStream::Ptr create() {
-        return std::make_shared<GenerationStream>();
+    static GenerationStream::Ptr create(StreamingTransport transport = StreamingTransport::SYNCHRONIZED_QUEUE) {
+        return make_pooled<GenerationStream>(transport);
     }
 
     void push(GenerationOutputs outputs) {
-        m_output_queue.push(std::move(outputs));
+        if (m_output_ring_buffer) {
+            m_output_ring_buffer->push(std::move(outputs));
+        } else {
+            m_output_queue.push(std::move(outputs));
+        }
     }
 
     GenerationOutputs read() {
-        return m_output_queue.pull();
+        return m_output_ring_buffer ? m_output_ring_buffer->pull() : m_output_queue.pull();
     }
 
     bool can_read() {
-        return !m_output_queue.empty();
+        return m_output_ring_buffer ? !m_output_ring_buffer->empty() : !m_output_queue.empty();
     }
 
     void set_generation_status(GenerationStatus status) {
-        std::lock_guard<std::mutex> lock(m_mutex);
         m_status = status;
     }
 
     GenerationStatus get_status() {
-        std::lock_guard<std::mutex> lock(m_mutex);
         return m_status;
     }
 
+    void set_request_metrics(const RequestMetrics& request_metrics) {
+        std::lock_guard<std::mutex> lock(m_request_metrics_mutex);
+        m_request_metrics = request_metrics;
+    }
+
+    RequestMetrics get_request_metrics() {
+        std::lock_guard<std::mutex> lock(m_request_metrics_mutex);
+        return m_request_metrics;
+    }
+
     void stop() {
-        std::lock_guard<std::mutex> lock(m_mutex);
         m_status = GenerationStatus::STOP;
     }
 
     void cancel() {
-        std::lock_guard<std::mutex> lock(m_mutex);
         m_status = GenerationStatus::CANCEL;
     }
 };
@@ -4,6 +4,7 @@
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <cmath>
 #include <unordered_map>
 #include <math.h>
 #include <iostream>
@@ -11,6 +12,7 @@
 #include <openvino/openvino.hpp>
 #include "openvino/runtime/core.hpp"
 #include "openvino/opsets/opset13.hpp"
+#include "openvino/core/parallel.hpp"
 
 #include "gguf_utils/building_blocks.hpp"
 
@@ -593,7 +595,9 @@ ov::Output<ov::Node> make_int8_weights(
     const ov::float16* scale_data = scales.data<ov::element_type_traits<ov::element::f16>::value_type>();
     uint8_t* bias_u8_data = biases_u8.data<uint8_t>();
     for (size_t i = 0; i < biases_u8.get_size(); ++i) {
-        bias_u8_data[i] = (uint8_t)std::round(-1.f * static_cast<float>(bias_data[i]) / static_cast<float>(scale_data[i]));
+        // the zero point doesn't matter for a zero scale, the zero points of Q5_K can exceed u8
+        float zero_point = -1.f * static_cast<float>(bias_data[i]) / static_cast<float>(scale_data[i]);
+        bias_u8_data[i] = std::isfinite(zero_point) ? (uint8_t)std::clamp(std::round(zero_point), 0.f, 255.f) : 0;
     }
 
     auto zero_point = std::make_shared<ov::op::v0::Constant>(biases_u8);
@@ -712,6 +716,10 @@ ov::Output<ov::Node> make_weights_subgraph(const std::string& key,
         return make_int4_weights(key, consts, reorder, head_size);
     case gguf_tensor_type::GGUF_TYPE_Q6_K:
         return make_int8_weights(key, consts, reorder, head_size, 16);
+    case gguf_tensor_type::GGUF_TYPE_Q5_K:
+    case gguf_tensor_type::GGUF_TYPE_IQ4_NL:
+    case gguf_tensor_type::GGUF_TYPE_IQ4_XS:
+        return make_int8_weights(key, consts, reorder, head_size);
     default:
         OPENVINO_THROW("Unsupported quantization type");
     }
@@ -721,11 +729,10 @@ ov::Output<ov::Node> make_fc(
     const std::string& key,
     const ov::Output<ov::Node>& input,
     const std::unordered_map<std::string, ov::Tensor>& consts,
-    gguf_tensor_type qtype,
-    bool reorder = false,
-    int head_size = -1) {
-    auto w_f32 = make_weights_subgraph(key, consts, qtype, reorder, head_size);
-    std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v0::MatMul>(input, w_f32, false, true);
+    const std::unordered_map<std::string, ov::Output<ov::Node>>& weights) {
+    auto it = weights.find(key);
+    OPENVINO_ASSERT(it != weights.end(), "Weights subgraph not found: ", key);
+    std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v0::MatMul>(input, it->second, false, true);
 
     // Add post-MatMul Add operation if exists
     if (consts.count(key + ".bias")) {
@@ -738,6 +745,38 @@ ov::Output<ov::Node> make_fc(
     return output;
 }
 
+std::unordered_map<std::string, ov::Output<ov::Node>> make_layers_weights(
+    const std::map<std::string, GGUFMetaData>& configs,
+    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const std::unordered_map<std::string, gguf_tensor_type>& qtypes) {
+    // check if it's llama structure, if so, q and k projections are reordered
+    const bool reorder = std::get<std::string>(configs.at("architecture")).find("llama") != std::string::npos;
+    const int head_size = std::get<int>(configs.at("head_size"));
+
+    std::vector<std::tuple<std::string, bool>> keys;
+    for (int i = 0; i < std::get<int>(configs.at("layer_num")); ++i) {
+        std::string layer_prefix = format("model.layers[%d]", i);
+        keys.emplace_back(layer_prefix + ".self_attn.q_proj", reorder);
+        keys.emplace_back(layer_prefix + ".self_attn.k_proj", reorder);
+        for (const char* projection : {".self_attn.v_proj", ".self_attn.o_proj", ".mlp.gate_proj", ".mlp.up_proj", ".mlp.down_proj"}) {
+            keys.emplace_back(layer_prefix + projection, false);
+        }
+    }
+
+    // the subgraphs don't share nodes, so they are safe to create concurrently
+    std::vector<ov::Output<ov::Node>> subgraphs(keys.size());
+    ov::parallel_for(keys.size(), [&](size_t i) {
+        const auto& [key, reorder_key] = keys[i];
+        subgraphs[i] = make_weights_subgraph(key, consts, qtypes.at(key + ".qtype"), reorder_key, reorder_key ? head_size : -1);
+    });
+
+    std::unordered_map<std::string, ov::Output<ov::Node>> weights;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        weights.emplace(std::get<0>(keys[i]), subgraphs[i]);
+    }
+    return weights;
+}
+
 ov::Output<ov::Node> make_lm_head(
     const std::string& key,
     const ov::Output<ov::Node>& input,
@@ -859,7 +898,7 @@ std::tuple<ov::Output<ov::Node>,
            std::shared_ptr<ov::Node>> 
     layer(const std::map<std::string, GGUFMetaData>& configs,
         std::unordered_map<std::string, ov::Tensor>& consts,
-        std::unordered_map<std::string, gguf_tensor_type>& qtypes,
+        const std::unordered_map<std::string, ov::Output<ov::Node>>& weights,
         int layer_idx,
         const ov::Output<ov::Node>& hidden_states,
         const ov::Output<ov::Node>& attn_mask,
@@ -883,32 +922,9 @@ std::tuple<ov::Output<ov::Node>,
                                          std::get<float>(configs.at("rms_norm_eps")));
 
     // Attention projections
-    // check if it's llama structure, if so, reorder= true
-    bool reorder = false;
-    if (std::get<std::string>(configs.at("architecture")).find("llama") != std::string::npos) {
-        reorder = true;
-    }
-    auto q = make_fc(
-        layer_prefix + ".self_attn.q_proj",
-        input_layernorm,
-        consts,
-        qtypes.at(layer_prefix + ".self_attn.q_proj.qtype"),
-        reorder,
-        std::get<int>(configs.at("head_size")));
-    
-    auto k = make_fc(
-        layer_prefix + ".self_attn.k_proj",
-        input_layernorm,
-        consts,
-        qtypes.at(layer_prefix + ".self_attn.k_proj.qtype"),
-        reorder,
-        std::get<int>(configs.at("head_size")));
-
-    auto v = make_fc(
-        layer_prefix + ".self_attn.v_proj",
-        input_layernorm,
-        consts,
-        qtypes.at(layer_prefix + ".self_attn.v_proj.qtype"));
+    auto q = make_fc(layer_prefix + ".self_attn.q_proj", input_layernorm, consts, weights);
+    auto k = make_fc(layer_prefix + ".self_attn.k_proj", input_layernorm, consts, weights);
+    auto v = make_fc(layer_prefix + ".self_attn.v_proj", input_layernorm, consts, weights);
 
     // Handle output shape
     std::shared_ptr<ov::Node> final_output_shape = output_shape;
@@ -944,11 +960,7 @@ std::tuple<ov::Output<ov::Node>,
         cos_sin_cached);
 
     // Output projection
-    auto o_proj = make_fc(
-        layer_prefix + ".self_attn.o_proj",
-        attn_output,
-        consts,
-        qtypes.at(layer_prefix + ".self_attn.o_proj.qtype"));
+    auto o_proj = make_fc(layer_prefix + ".self_attn.o_proj", attn_output, consts, weights);
 
     // Residual connection
     auto attn_add = std::make_shared<ov::op::v1::Add>(
@@ -963,25 +975,13 @@ std::tuple<ov::Output<ov::Node>,
         std::get<float>(configs.at("rms_norm_eps")));
 
     // MLP block
-    auto gate_proj = make_fc(
-        layer_prefix + ".mlp.gate_proj",
-        post_attn_norm,
-        consts,
-        qtypes.at(layer_prefix + ".mlp.gate_proj.qtype"));
+    auto gate_proj = make_fc(layer_prefix + ".mlp.gate_proj", post_attn_norm, consts, weights);
     auto silu = std::make_shared<ov::op::v4::Swish>(gate_proj);
-    auto up_proj = make_fc(
-        layer_prefix + ".mlp.up_proj",
-        post_attn_norm,
-        consts,
-        qtypes.at(layer_prefix + ".mlp.up_proj.qtype"));
+    auto up_proj = make_fc(layer_prefix + ".mlp.up_proj", post_attn_norm, consts, weights);
     auto mul = std::make_shared<ov::op::v1::Multiply>(
         silu, up_proj, ov::op::AutoBroadcastType::NUMPY);
     mul->set_friendly_name(name_prefix + ".mlp.mul" + name_suffix);
-    auto down_proj = make_fc(
-        layer_prefix + ".mlp.down_proj",
-        mul,
-        consts,
-        qtypes.at(layer_prefix + ".mlp.down_proj.qtype"));
+    auto down_proj = make_fc(layer_prefix + ".mlp.down_proj", mul, consts, weights);
 
     // Final residual connection
     auto output = std::make_shared<ov::op::v1::Add>(
@@ -32,6 +32,12 @@ std::tuple<ov::Output<ov::Node>, ov::Output<ov::Node>> make_embedding(
     const std::unordered_map<std::string, ov::Tensor>& consts,
     gguf_tensor_type qtype);
 
+// Creates the weights subgraphs of the fully connected layers of all the decoder layers in parallel
+std::unordered_map<std::string, ov::Output<ov::Node>> make_layers_weights(
+    const std::map<std::string, GGUFMetaData>& configs,
+    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const std::unordered_map<std::string, gguf_tensor_type>& qtypes);
+
 std::tuple<ov::Output<ov::Node>, 
            ov::SinkVector,
            ov::Output<ov::Node>,
@@ -39,7 +45,7 @@ std::tuple<ov::Output<ov::Node>,
            std::shared_ptr<ov::Node>> 
     layer(const std::map<std::string, GGUFMetaData>& configs,
         std::unordered_map<std::string, ov::Tensor>& consts,
-        std::unordered_map<std::string, gguf_tensor_type>& qtypes,
+        const std::unordered_map<std::string, ov::Output<ov::Node>>& weights,
         int layer_idx,
         const ov::Output<ov::Node>& hidden_states,
         const ov::Output<ov::Node>& attn_mask,
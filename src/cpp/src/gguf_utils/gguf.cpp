@@ -3,12 +3,18 @@
 
 #include "gguf_utils/gguf.hpp"
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <sstream>
+
+#include "openvino/core/parallel.hpp"
+#include "utils.hpp"
 
 // https://github.com/antirez/gguf-tools/blob/af7d88d808a7608a33723fba067036202910acb3/gguflib.h#L102-L108
 constexpr int gguf_array_header_size = 12;
@@ -80,28 +86,40 @@ ov::Shape get_shape(const gguf_tensor& tensor) {
     return shape;
 }
 
-ov::Tensor extract_tensor_data(gguf_tensor* tensor) {
+namespace {
+
+// Makes ov::Tensor use an existing buffer instead of allocating one. The holder keeps the buffer alive as long as the
+// tensor or any Constant created from it exists, which lets the tensors refer to the GGUF file mapping directly
+struct GGUFBufferAllocator {
+    void* data;
+    std::shared_ptr<void> holder;
+
+    void* allocate(size_t /*bytes*/, size_t /*alignment*/) {
+        return data;
+    }
+
+    void deallocate(void* /*ptr*/, size_t /*bytes*/, size_t /*alignment*/) {}
+
+    bool is_equal(const GGUFBufferAllocator& other) const {
+        return data == other.data;
+    }
+};
+
+}  // namespace
+
+ov::Tensor extract_tensor_data(gguf_tensor* tensor, const std::shared_ptr<gguf_ctx>& ctx) {
     std::optional<ov::element::Type> equivalent_dtype = gguf_type_to_dtype(tensor->type);
-    // If there's an equivalent type, we can simply copy.
+    // If there's an equivalent type, the tensor refers to the memory mapped file without copying.
     if (equivalent_dtype.has_value()) {
-        auto shape = get_shape(*tensor);
-        ov::Tensor weights(equivalent_dtype.value(), shape);
-
-        memcpy(weights.data(), tensor->weights_data, tensor->num_weights * equivalent_dtype.value().size());
-        return weights;
+        return ov::Tensor(equivalent_dtype.value(), get_shape(*tensor), GGUFBufferAllocator{tensor->weights_data, ctx});
     }
     // Otherwise, we convert to float16.
     // TODO: Add other dequantization options.
     int16_t* data = gguf_tensor_to_f16(tensor);
     OPENVINO_ASSERT(data != nullptr, "[load_gguf] gguf_tensor_to_f16 failed");
 
-    auto shape = get_shape(*tensor);
-    const size_t new_size = tensor->num_weights * sizeof(int16_t);
-    ov::Tensor weights(ov::element::f16, shape);
-    memcpy(weights.data(), data, new_size);
-    free(data);
-
-    return weights;
+    // the tensor takes the ownership of the converted data
+    return ov::Tensor(ov::element::f16, get_shape(*tensor), GGUFBufferAllocator{data, std::shared_ptr<void>(data, free)});
 }
 
 void set_value_from_gguf(gguf_ctx* ctx, uint32_t type, gguf_value* val, GGUFMetaData& value) {
@@ -263,10 +281,46 @@ std::unordered_map<std::string, GGUFMetaData> load_metadata(gguf_ctx* ctx) {
     return metadata;
 }
 
-void load_arrays(gguf_ctx* ctx,
+void load_array(const gguf_tensor& tensor,
+                const std::shared_ptr<gguf_ctx>& ctx,
+                std::unordered_map<std::string, ov::Tensor>& array_map,
+                std::unordered_map<std::string, gguf_tensor_type>& qtype_map) {
+    if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q8_0 ||
+        tensor.type == GGUF_TYPE_Q4_K || tensor.type == GGUF_TYPE_Q5_K || tensor.type == GGUF_TYPE_IQ4_NL ||
+        tensor.type == GGUF_TYPE_IQ4_XS) {
+        gguf_load_quantized(array_map, qtype_map, tensor);
+    } else {
+        std::string name(tensor.name, tensor.namelen);
+        gguf_tensor tensor_copy = tensor;
+        array_map.emplace(name, extract_tensor_data(&tensor_copy, ctx));
+
+        constexpr std::string_view weight_suffix = ".weight";
+        const std::string name_prefix = name.substr(0, name.length() - weight_suffix.length());
+        if (tensor.type == GGUF_TYPE_Q6_K) {
+            qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(GGUF_TYPE_F16)); //WA: Q6_K is not supported by platform because of group size 16, so we use F16 as a workaround
+        } else {
+            qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
+        }
+    }
+}
+
+// The tensor headers of all the files are read first, then the tensors are extracted in parallel
+void load_arrays(const std::vector<std::shared_ptr<gguf_ctx>>& ctxs,
                  std::unordered_map<std::string, ov::Tensor>& array_map,
                  std::unordered_map<std::string, gguf_tensor_type>& qtype_map) {
-    gguf_tensor tensor;
+    std::vector<std::pair<gguf_tensor, std::shared_ptr<gguf_ctx>>> tensors;
+    for (const auto& ctx : ctxs) {
+        gguf_tensor tensor;
+        while (gguf_get_tensor(ctx.get(), &tensor)) {
+            tensors.emplace_back(tensor, ctx);
+        }
+    }
+
+    std::vector<std::unordered_map<std::string, ov::Tensor>> arrays(tensors.size());
+    std::vector<std::unordered_map<std::string, gguf_tensor_type>> qtypes(tensors.size());
+    ov::parallel_for(tensors.size(), [&](size_t i) {
+        load_array(tensors[i].first, tensors[i].second, arrays[i], qtypes[i]);
+    });
 
     auto check_insert = [](const auto& inserted) {
         OPENVINO_ASSERT(inserted.second,
@@ -274,24 +328,11 @@ void load_arrays(gguf_ctx* ctx,
                         inserted.first->first,
                         "'. This can happen when loading quantized tensors.");
     };
-
-    while (gguf_get_tensor(ctx, &tensor)) {
-        if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q8_0 ||
-            tensor.type == GGUF_TYPE_Q4_K) {
-            gguf_load_quantized(array_map, qtype_map, tensor);
-        } else {
-            std::string name(tensor.name, tensor.namelen);
-            ov::Tensor loaded_array = extract_tensor_data(&tensor);
-            check_insert(array_map.emplace(name, loaded_array));
-
-            constexpr std::string_view weight_suffix = ".weight";
-            const std::string name_prefix = name.substr(0, name.length() - weight_suffix.length());
-            if (tensor.type == GGUF_TYPE_Q6_K) {
-                qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(GGUF_TYPE_F16)); //WA: Q6_K is not supported by platform because of group size 16, so we use F16 as a workaround
-            } else {
-                qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
-            }
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        for (auto& array : arrays[i]) {
+            check_insert(array_map.emplace(array.first, std::move(array.second)));
         }
+        qtype_map.insert(qtypes[i].begin(), qtypes[i].end());
     }
 }
 
@@ -323,14 +364,20 @@ std::vector<std::string> get_all_files(std::string file, int total_num) {
     return files;
 }
 
+// the file stays mapped until all the tensors referring to it are destroyed
+std::shared_ptr<gguf_ctx> open_gguf_file(const std::string& file) {
+    gguf_ctx* ctx = gguf_open(file.data());
+    OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
+    return std::shared_ptr<gguf_ctx>(ctx, gguf_close);
+}
+
 GGUFLoad get_gguf_data(const std::string& file) {
     std::unordered_map<std::string, ov::Tensor> arrays;
     std::unordered_map<std::string, gguf_tensor_type> qtype;
 
     check_file(file);
 
-    std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx(gguf_open(file.data()), gguf_close);
-    OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
+    std::shared_ptr<gguf_ctx> ctx = open_gguf_file(file);
 
     // get main config from first file or single file
     auto metadata = load_metadata(ctx.get());
@@ -338,11 +385,8 @@ GGUFLoad get_gguf_data(const std::string& file) {
     std::string split_flag = "split.count";
     auto it = metadata.find(split_flag);
 
-    if (it == metadata.end())  // single GGUF file
-    {
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
-    } else  // multi GGUF files
+    std::vector<std::shared_ptr<gguf_ctx>> ctxs{ctx};
+    if (it != metadata.end())  // multi GGUF files
     {
         auto total_num_tensor = std::get<ov::Tensor>(metadata.at(split_flag));
         int total_num = *(total_num_tensor.data<ov::element_type_traits<ov::element::u16>::value_type>());
@@ -350,16 +394,26 @@ GGUFLoad get_gguf_data(const std::string& file) {
         std::vector<std::string> files = get_all_files(file, total_num);
 
         for (size_t i = 1; i < files.size(); i++) {
-            std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx_i(gguf_open(files.at(i).data()), gguf_close);
-            OPENVINO_ASSERT(ctx_i, "Failed to open '", files.at(i), "' with gguf_open");
+            std::shared_ptr<gguf_ctx> ctx_i = open_gguf_file(files.at(i));
 
+            // skips the metadata of the file to its tensors
             auto metadata_tmp = load_metadata(ctx_i.get());
 
-            load_arrays(ctx_i.get(), arrays, qtype);
+            ctxs.push_back(ctx_i);
         }
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
     }
+    load_arrays(ctxs, arrays, qtype);
+    return {metadata, arrays, qtype};
+}
+
+std::unordered_map<std::string, GGUFMetaData> get_gguf_metadata(const std::string& file) {
+    check_file(file);
+
+    std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx(gguf_open(file.data()), gguf_close);
+    OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
+
+    // the metadata of a multi file model is stored in its first file
+    return load_metadata(ctx.get());
 }
 
 float metadata_to_float(const std::unordered_map<std::string, GGUFMetaData>& metadata, const std::string& key) {
@@ -575,11 +629,23 @@ std::tuple<std::map<std::string, GGUFMetaData>,
            std::unordered_map<std::string, ov::Tensor>,
            std::unordered_map<std::string, gguf_tensor_type>>
 load_gguf(const std::string& file) {
+    auto start_time = std::chrono::steady_clock::now();
     auto [metadata, weights, qtype] = get_gguf_data(file);
+    auto unpack_finish_time = std::chrono::steady_clock::now();
+
+    std::stringstream ss;
+    ss << "Unpacking " << weights.size() << " tensors done. Time: "
+       << std::chrono::duration_cast<std::chrono::milliseconds>(unpack_finish_time - start_time).count() << "ms";
+    ov::genai::utils::print_gguf_debug_info(ss.str());
 
     auto config = config_from_meta(metadata);
     auto consts = consts_from_weights(config, weights);
     auto qtypes = get_qtype_map(config, qtype);
 
+    ss.str("");
+    ss << "Mapping tensor names done. Time: "
+       << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - unpack_finish_time).count() << "ms";
+    ov::genai::utils::print_gguf_debug_info(ss.str());
+
     return {config, consts, qtypes};
 }
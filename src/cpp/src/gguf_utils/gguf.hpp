@@ -42,3 +42,6 @@ std::tuple<std::map<std::string, GGUFMetaData>,
 load_gguf(const std::string& file);
 
 GGUFLoad get_gguf_data(const std::string& file);
+
+// reads the metadata of the GGUF file without its tensors
+std::unordered_map<std::string, GGUFMetaData> get_gguf_metadata(const std::string& file);
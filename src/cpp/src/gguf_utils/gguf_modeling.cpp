@@ -6,11 +6,15 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <filesystem>
+#include <functional>
+#include <sstream>
 #include <stdexcept>
 
 #include <openvino/openvino.hpp>
 #include "openvino/runtime/core.hpp"
 #include "openvino/opsets/opset13.hpp"
+#include "openvino/genai/version.hpp"
 
 #include "gguf_utils/building_blocks.hpp"
 #include "gguf_utils/gguf_modeling.hpp"
@@ -73,6 +77,13 @@ std::shared_ptr<ov::Model> create_language_model(
     auto hidden_dim = std::make_shared<ov::op::v0::Constant>(
         ov::element::i64, ov::Shape{1}, 3);
 
+    auto weights_start_time = std::chrono::steady_clock::now();
+    auto layers_weights = make_layers_weights(configs, consts, qtypes);
+    std::stringstream ss;
+    ss << "Creating weights subgraphs done. Time: "
+       << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - weights_start_time).count() << "ms";
+    ov::genai::utils::print_gguf_debug_info(ss.str());
+
     // Process layers
     ov::SinkVector sinks;
     ov::Output<ov::Node> causal_mask;
@@ -83,7 +94,7 @@ std::shared_ptr<ov::Model> create_language_model(
         auto [new_hidden, layer_sinks, new_mask, new_cos_sin, new_shape] = layer(
             configs,
             consts,
-            qtypes,
+            layers_weights,
             i,
             hidden_states,
             attention_mask,
@@ -136,9 +147,72 @@ std::shared_ptr<ov::Model> create_language_model(
     return model;
 }
 
+// Bump it, when the conversion changes the generated models, to invalidate the cached models
+constexpr int gguf_converter_revision = 1;
+
+// The directory of the cached model is named after the GGUF file and the hash of its fingerprint, so a new directory is
+// used once the file or the conversion changes. The hash of the file content is not used, as it takes as long as the
+// conversion itself
+std::filesystem::path get_cached_model_dir(const std::filesystem::path& model_path, const std::filesystem::path& cache_dir) {
+    std::stringstream fingerprint;
+    fingerprint << std::filesystem::absolute(model_path).string() << ";"
+                << std::filesystem::file_size(model_path) << ";"
+                << std::filesystem::last_write_time(model_path).time_since_epoch().count() << ";"
+                << ov::genai::get_version().buildNumber << ";"
+                << ov::get_openvino_version().buildNumber << ";"
+                << gguf_converter_revision;
+
+    std::stringstream dir_name;
+    dir_name << model_path.stem().string() << "-" << std::hex << std::hash<std::string>{}(fingerprint.str());
+    return cache_dir / dir_name.str();
+}
+
+// The model is saved to a temporary directory, which is renamed afterwards, so a concurrently started pipeline never
+// reads a partially saved model. A failure to cache the model doesn't fail the pipeline
+void save_to_cache(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& cached_model_dir) {
+    std::stringstream ss;
+    std::filesystem::path temp_dir = cached_model_dir;
+    temp_dir += "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+    try {
+        std::filesystem::create_directories(temp_dir);
+        ov::genai::utils::save_openvino_model(model, (temp_dir / "openvino_model.xml").string(), false);
+        std::error_code error;
+        std::filesystem::rename(temp_dir, cached_model_dir, error);
+        if (error) {
+            // the model is cached by another pipeline
+            std::filesystem::remove_all(temp_dir, error);
+            ss << "Converted model is already cached to: " << cached_model_dir.string();
+        } else {
+            ss << "Cached converted model to: " << cached_model_dir.string();
+        }
+    } catch (const std::exception& exception) {
+        std::error_code error;
+        std::filesystem::remove_all(temp_dir, error);
+        ss << "Failed to cache converted model to: " << cached_model_dir.string() << ", " << exception.what();
+    }
+    ov::genai::utils::print_gguf_debug_info(ss.str());
+}
+
 } // namespace
 
-std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model) {
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const std::string& cache_dir) {
+    std::filesystem::path cached_model_dir;
+    if (!cache_dir.empty()) {
+        cached_model_dir = get_cached_model_dir(model_path, cache_dir);
+        const auto cached_model_path = cached_model_dir / "openvino_model.xml";
+        if (std::filesystem::exists(cached_model_path)) {
+            ov::genai::utils::print_gguf_debug_info("Reading cached converted model from: " + cached_model_path.string());
+            auto model = ov::genai::utils::singleton_core().read_model(cached_model_path);
+            if (enable_save_ov_model) {
+                std::filesystem::path save_path = std::filesystem::path(model_path).parent_path() / "openvino_model.xml";
+                ov::genai::utils::save_openvino_model(model, save_path.string(), true);
+            }
+            return model;
+        }
+    }
+
     auto start_time = std::chrono::high_resolution_clock::now();
     std::stringstream ss;
     ss << "Loading and unpacking model from: " << model_path;
@@ -171,5 +245,9 @@ std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const
     ss << "Model generation done. Time: " << duration << "ms";
     ov::genai::utils::print_gguf_debug_info(ss.str());
 
+    if (!cached_model_dir.empty()) {
+        save_to_cache(model, cached_model_dir);
+    }
+
     return model;
 }
@@ -7,4 +7,7 @@
 
 #include "openvino/openvino.hpp"
 
-std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model);
+// Converts the GGUF model to OpenVINO model. If 'cache_dir' isn't empty, the converted model is read from it or saved to it
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const std::string& cache_dir = {});
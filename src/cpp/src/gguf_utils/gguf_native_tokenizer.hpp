@@ -0,0 +1,576 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Regular expressions of the pre-tokenization of GGUF tokenizers, which are matched natively, see get_split_regex().
+ */
+enum class GGUFSplitPattern {
+    // (?:'[sS]|'[tT]|'[rR][eE]|'[vV][eE]|'[mM]|'[lL][lL]|'[dD])|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+
+    QWEN2,
+    // 's|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)
+    GPT2,
+    // \p{N}
+    NUMBER,
+    // \p{N}+
+    NUMBERS,
+    // [\p{P}\$\+<=>\^~\|]+
+    PUNCTUATION,
+    // [0-9][0-9][0-9]
+    THREE_DIGITS,
+};
+
+namespace gguf_native {
+
+// Unicode categories distinguished by the split patterns
+enum class CharClass : uint8_t {
+    LETTER,
+    NUMBER,
+    WHITESPACE,
+    PUNCTUATION,
+    OTHER,
+    // the category of the character is not known precisely enough, so the text is not tokenized natively
+    UNKNOWN,
+};
+
+struct CharRange {
+    uint32_t first, last;
+    CharClass char_class;
+};
+
+// non ASCII blocks, in which the letters, numbers, whitespaces and punctuation are listed exhaustively
+inline const std::vector<CharRange>& get_char_ranges() {
+    using C = CharClass;
+    static const std::vector<CharRange> ranges = {
+        // Latin-1 Supplement, NEL is white space in some regex engines only
+        {0x80, 0x84, C::OTHER}, {0x85, 0x85, C::UNKNOWN}, {0x86, 0x9F, C::OTHER}, {0xA0, 0xA0, C::WHITESPACE},
+        {0xA1, 0xA1, C::PUNCTUATION}, {0xA2, 0xA6, C::OTHER}, {0xA7, 0xA7, C::PUNCTUATION}, {0xA8, 0xA9, C::OTHER},
+        {0xAA, 0xAA, C::LETTER}, {0xAB, 0xAB, C::PUNCTUATION}, {0xAC, 0xB1, C::OTHER}, {0xB2, 0xB3, C::NUMBER},
+        {0xB4, 0xB4, C::OTHER}, {0xB5, 0xB5, C::LETTER}, {0xB6, 0xB7, C::PUNCTUATION}, {0xB8, 0xB8, C::OTHER},
+        {0xB9, 0xB9, C::NUMBER}, {0xBA, 0xBA, C::LETTER}, {0xBB, 0xBB, C::PUNCTUATION}, {0xBC, 0xBE, C::NUMBER},
+        {0xBF, 0xBF, C::PUNCTUATION}, {0xC0, 0xD6, C::LETTER}, {0xD7, 0xD7, C::OTHER}, {0xD8, 0xF6, C::LETTER},
+        {0xF7, 0xF7, C::OTHER},
+        // Latin Extended-A, Latin Extended-B, IPA Extensions, Spacing Modifier Letters, Combining Diacritical Marks
+        {0xF8, 0x2C1, C::LETTER}, {0x2C2, 0x2C5, C::OTHER}, {0x2C6, 0x2D1, C::LETTER}, {0x2D2, 0x2DF, C::OTHER},
+        {0x2E0, 0x2E4, C::LETTER}, {0x2E5, 0x2EB, C::OTHER}, {0x2EC, 0x2EC, C::LETTER}, {0x2ED, 0x2ED, C::OTHER},
+        {0x2EE, 0x2EE, C::LETTER}, {0x2EF, 0x36F, C::OTHER},
+        // Greek and Coptic, Cyrillic, Cyrillic Supplement
+        {0x370, 0x374, C::LETTER}, {0x375, 0x375, C::OTHER}, {0x376, 0x377, C::LETTER}, {0x378, 0x379, C::OTHER},
+        {0x37A, 0x37D, C::LETTER}, {0x37E, 0x37E, C::PUNCTUATION}, {0x37F, 0x37F, C::LETTER}, {0x380, 0x385, C::OTHER},
+        {0x386, 0x386, C::LETTER}, {0x387, 0x387, C::PUNCTUATION}, {0x388, 0x38A, C::LETTER}, {0x38B, 0x38B, C::OTHER},
+        {0x38C, 0x38C, C::LETTER}, {0x38D, 0x38D, C::OTHER}, {0x38E, 0x3A1, C::LETTER}, {0x3A2, 0x3A2, C::OTHER},
+        {0x3A3, 0x3F5, C::LETTER}, {0x3F6, 0x3F6, C::OTHER}, {0x3F7, 0x481, C::LETTER}, {0x482, 0x489, C::OTHER},
+        {0x48A, 0x52F, C::LETTER},
+        // General Punctuation, Superscripts and Subscripts, Currency Symbols, Combining Marks for Symbols
+        {0x2000, 0x200A, C::WHITESPACE}, {0x200B, 0x200F, C::OTHER}, {0x2010, 0x2027, C::PUNCTUATION},
+        {0x2028, 0x2029, C::WHITESPACE}, {0x202A, 0x202E, C::OTHER}, {0x202F, 0x202F, C::WHITESPACE},
+        {0x2030, 0x2043, C::PUNCTUATION}, {0x2044, 0x2044, C::OTHER}, {0x2045, 0x2051, C::PUNCTUATION},
+        {0x2052, 0x2052, C::OTHER}, {0x2053, 0x205E, C::PUNCTUATION}, {0x205F, 0x205F, C::WHITESPACE},
+        {0x2060, 0x206F, C::OTHER}, {0x2070, 0x2070, C::NUMBER}, {0x2071, 0x2071, C::LETTER}, {0x2072, 0x2073, C::OTHER},
+        {0x2074, 0x2079, C::NUMBER}, {0x207A, 0x207C, C::OTHER}, {0x207D, 0x207E, C::PUNCTUATION}, {0x207F, 0x207F, C::LETTER},
+        {0x2080, 0x2089, C::NUMBER}, {0x208A, 0x208C, C::OTHER}, {0x208D, 0x208E, C::PUNCTUATION}, {0x208F, 0x208F, C::OTHER},
+        {0x2090, 0x209C, C::LETTER}, {0x209D, 0x20FF, C::OTHER},
+        // Arrows, Mathematical Operators, Miscellaneous Technical, Control Pictures, Optical Character Recognition
+        {0x2190, 0x2307, C::OTHER}, {0x2308, 0x230B, C::PUNCTUATION}, {0x230C, 0x2328, C::OTHER},
+        {0x2329, 0x232A, C::PUNCTUATION}, {0x232B, 0x245F, C::OTHER},
+        // Enclosed Alphanumerics, Box Drawing, Block Elements, Geometric Shapes, Miscellaneous Symbols, Dingbats
+        {0x2460, 0x249B, C::NUMBER}, {0x249C, 0x24E9, C::OTHER}, {0x24EA, 0x24FF, C::NUMBER}, {0x2500, 0x2767, C::OTHER},
+        {0x2768, 0x2775, C::PUNCTUATION}, {0x2776, 0x2793, C::NUMBER}, {0x2794, 0x27BF, C::OTHER},
+        // Miscellaneous Symbols and Arrows
+        {0x2B00, 0x2BFF, C::OTHER},
+        // CJK Symbols and Punctuation, Hiragana, Katakana
+        {0x3000, 0x3000, C::WHITESPACE}, {0x3001, 0x3003, C::PUNCTUATION}, {0x3004, 0x3004, C::OTHER},
+        {0x3005, 0x3006, C::LETTER}, {0x3007, 0x3007, C::NUMBER}, {0x3008, 0x3011, C::PUNCTUATION}, {0x3012, 0x3013, C::OTHER},
+        {0x3014, 0x301F, C::PUNCTUATION}, {0x3020, 0x3020, C::OTHER}, {0x3021, 0x3029, C::NUMBER}, {0x302A, 0x302F, C::OTHER},
+        {0x3030, 0x3030, C::PUNCTUATION}, {0x3031, 0x3035, C::LETTER}, {0x3036, 0x3037, C::OTHER}, {0x3038, 0x303A, C::NUMBER},
+        {0x303B, 0x303C, C::LETTER}, {0x303D, 0x303D, C::PUNCTUATION}, {0x303E, 0x3040, C::OTHER}, {0x3041, 0x3096, C::LETTER},
+        {0x3097, 0x309C, C::OTHER}, {0x309D, 0x309F, C::LETTER}, {0x30A0, 0x30A0, C::PUNCTUATION}, {0x30A1, 0x30FA, C::LETTER},
+        {0x30FB, 0x30FB, C::PUNCTUATION}, {0x30FC, 0x30FF, C::LETTER},
+        // CJK Unified Ideographs of Unicode 8.0
+        {0x4E00, 0x9FD5, C::LETTER},
+        // Hangul Syllables
+        {0xAC00, 0xD7A3, C::LETTER},
+        // Variation Selectors
+        {0xFE00, 0xFE0F, C::OTHER},
+        // Zero Width No-Break Space, Halfwidth and Fullwidth Forms
+        {0xFEFF, 0xFEFF, C::OTHER}, {0xFF00, 0xFF00, C::OTHER}, {0xFF01, 0xFF03, C::PUNCTUATION}, {0xFF04, 0xFF04, C::OTHER},
+        {0xFF05, 0xFF0A, C::PUNCTUATION}, {0xFF0B, 0xFF0B, C::OTHER}, {0xFF0C, 0xFF0F, C::PUNCTUATION}, {0xFF10, 0xFF19, C::NUMBER},
+        {0xFF1A, 0xFF1B, C::PUNCTUATION}, {0xFF1C, 0xFF1E, C::OTHER}, {0xFF1F, 0xFF20, C::PUNCTUATION}, {0xFF21, 0xFF3A, C::LETTER},
+        {0xFF3B, 0xFF3D, C::PUNCTUATION}, {0xFF3E, 0xFF3E, C::OTHER}, {0xFF3F, 0xFF3F, C::PUNCTUATION}, {0xFF40, 0xFF40, C::OTHER},
+        {0xFF41, 0xFF5A, C::LETTER}, {0xFF5B, 0xFF5B, C::PUNCTUATION}, {0xFF5C, 0xFF5C, C::OTHER}, {0xFF5D, 0xFF5D, C::PUNCTUATION},
+        {0xFF5E, 0xFF5E, C::OTHER}, {0xFF5F, 0xFF65, C::PUNCTUATION}, {0xFF66, 0xFFBE, C::LETTER},
+        // Mahjong Tiles, Domino Tiles, Playing Cards, Enclosed Alphanumeric Supplement without numbers
+        {0x1F000, 0x1F0FF, C::OTHER}, {0x1F10D, 0x1F1FF, C::OTHER},
+        // emoji and pictographs
+        {0x1F300, 0x1FAFF, C::OTHER},
+    };
+    return ranges;
+}
+
+inline CharClass get_char_class(uint32_t code_point) {
+    if (code_point < 0x80) {
+        const char c = static_cast<char>(code_point);
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+            return CharClass::LETTER;
+        }
+        if (c >= '0' && c <= '9') {
+            return CharClass::NUMBER;
+        }
+        if (c == ' ' || (c >= '\t' && c <= '\r')) {
+            return CharClass::WHITESPACE;
+        }
+        // the separators are white space in some regex engines only
+        if (code_point >= 0x1C && code_point <= 0x1F) {
+            return CharClass::UNKNOWN;
+        }
+        // the ASCII symbols are not punctuation in Unicode
+        if (code_point > 0x20 && code_point < 0x7F && std::string("$+<=>^`|~").find(c) == std::string::npos) {
+            return CharClass::PUNCTUATION;
+        }
+        return CharClass::OTHER;
+    }
+    const auto& ranges = get_char_ranges();
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), code_point, [](uint32_t value, const CharRange& range) {
+        return value < range.first;
+    });
+    if (it == ranges.begin() || std::prev(it)->last < code_point) {
+        return CharClass::UNKNOWN;
+    }
+    return std::prev(it)->char_class;
+}
+
+// the code points of a text with their categories and the byte offsets in the text
+struct Text {
+    std::vector<uint32_t> code_points;
+    std::vector<CharClass> classes;
+    // offsets.size() == code_points.size() + 1
+    std::vector<size_t> offsets;
+
+    bool is(size_t pos, CharClass char_class) const {
+        return classes[pos] == char_class;
+    }
+
+    bool is_new_line(size_t pos) const {
+        return code_points[pos] == '\r' || code_points[pos] == '\n';
+    }
+
+    // [^\s\p{L}\p{N}]
+    bool is_other(size_t pos) const {
+        return classes[pos] == CharClass::PUNCTUATION || classes[pos] == CharClass::OTHER;
+    }
+};
+
+// decodes the UTF-8 text, std::nullopt if it's not valid or contains a character of the unknown category
+inline std::optional<Text> parse_text(const std::string& text) {
+    Text result;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        const unsigned char lead = static_cast<unsigned char>(text[pos]);
+        const size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+        if (length == 0 || pos + length > text.size()) {
+            return std::nullopt;
+        }
+        uint32_t code_point = length == 1 ? lead : lead & (0xFF >> (length + 1));
+        for (size_t i = 1; i < length; ++i) {
+            const unsigned char continuation = static_cast<unsigned char>(text[pos + i]);
+            if ((continuation >> 6) != 0x2) {
+                return std::nullopt;
+            }
+            code_point = (code_point << 6) | (continuation & 0x3F);
+        }
+        const CharClass char_class = get_char_class(code_point);
+        if (char_class == CharClass::UNKNOWN) {
+            return std::nullopt;
+        }
+        result.code_points.push_back(code_point);
+        result.classes.push_back(char_class);
+        result.offsets.push_back(pos);
+        pos += length;
+    }
+    result.offsets.push_back(pos);
+    return result;
+}
+
+inline size_t match_run(const Text& text, size_t pos, size_t end, CharClass char_class) {
+    size_t match_end = pos;
+    while (match_end < end && text.is(match_end, char_class)) {
+        ++match_end;
+    }
+    return match_end - pos;
+}
+
+inline size_t match_other_run(const Text& text, size_t pos, size_t end) {
+    size_t match_end = pos;
+    while (match_end < end && text.is_other(match_end)) {
+        ++match_end;
+    }
+    return match_end - pos;
+}
+
+// 's|'t|'re|'ve|'m|'ll|'d
+inline size_t match_contraction(const Text& text, size_t pos, size_t end, bool ignore_case) {
+    if (text.code_points[pos] != '\'' || pos + 1 == end) {
+        return 0;
+    }
+    auto is = [&](size_t i, char c) {
+        const uint32_t code_point = text.code_points[i];
+        return code_point == static_cast<uint32_t>(c) || (ignore_case && code_point == static_cast<uint32_t>(c - 'a' + 'A'));
+    };
+    if (is(pos + 1, 's') || is(pos + 1, 't') || is(pos + 1, 'm') || is(pos + 1, 'd')) {
+        return 2;
+    }
+    if (pos + 2 < end && ((is(pos + 1, 'r') && is(pos + 2, 'e')) || (is(pos + 1, 'v') && is(pos + 2, 'e')) || (is(pos + 1, 'l') && is(pos + 2, 'l')))) {
+        return 3;
+    }
+    return 0;
+}
+
+// ` ?` followed by a non empty run of the class
+inline size_t match_optional_space_run(const Text& text, size_t pos, size_t end, bool is_other) {
+    auto run = [&](size_t from) {
+        return is_other ? match_other_run(text, from, end) : match_run(text, from, end, CharClass::LETTER);
+    };
+    if (text.code_points[pos] == ' ' && pos + 1 < end) {
+        if (size_t length = run(pos + 1)) {
+            return length + 1;
+        }
+    }
+    return run(pos);
+}
+
+// \s+(?!\S)
+inline size_t match_trailing_whitespaces(const Text& text, size_t pos, size_t end) {
+    const size_t length = match_run(text, pos, end, CharClass::WHITESPACE);
+    if (pos + length == end) {
+        return length;
+    }
+    return length > 1 ? length - 1 : 0;
+}
+
+// the length of the leftmost alternative of the pattern matching at the position, 0 if none
+inline size_t match(GGUFSplitPattern pattern, const Text& text, size_t pos, size_t end) {
+    switch (pattern) {
+    case GGUFSplitPattern::QWEN2: {
+        if (size_t length = match_contraction(text, pos, end, true)) {
+            return length;
+        }
+        // [^\r\n\p{L}\p{N}]?\p{L}+
+        if (!text.is_new_line(pos) && !text.is(pos, CharClass::LETTER) && !text.is(pos, CharClass::NUMBER) && pos + 1 < end) {
+            if (size_t length = match_run(text, pos + 1, end, CharClass::LETTER)) {
+                return length + 1;
+            }
+        }
+        if (size_t length = match_run(text, pos, end, CharClass::LETTER)) {
+            return length;
+        }
+        if (text.is(pos, CharClass::NUMBER)) {
+            return 1;
+        }
+        // ?[^\s\p{L}\p{N}]+[\r\n]*
+        if (size_t length = match_optional_space_run(text, pos, end, true)) {
+            while (pos + length < end && text.is_new_line(pos + length)) {
+                ++length;
+            }
+            return length;
+        }
+        // \s*[\r\n]+ ends after the last new line of the whitespaces
+        const size_t num_whitespaces = match_run(text, pos, end, CharClass::WHITESPACE);
+        for (size_t length = num_whitespaces; length > 0; --length) {
+            if (text.is_new_line(pos + length - 1)) {
+                return length;
+            }
+        }
+        if (size_t length = match_trailing_whitespaces(text, pos, end)) {
+            return length;
+        }
+        return num_whitespaces;
+    }
+    case GGUFSplitPattern::GPT2: {
+        if (size_t length = match_contraction(text, pos, end, false)) {
+            return length;
+        }
+        if (size_t length = match_optional_space_run(text, pos, end, false)) {
+            return length;
+        }
+        // ?\p{N}+
+        if (text.code_points[pos] == ' ' && pos + 1 < end) {
+            if (size_t length = match_run(text, pos + 1, end, CharClass::NUMBER)) {
+                return length + 1;
+            }
+        }
+        if (size_t length = match_run(text, pos, end, CharClass::NUMBER)) {
+            return length;
+        }
+        if (size_t length = match_optional_space_run(text, pos, end, true)) {
+            return length;
+        }
+        return match_trailing_whitespaces(text, pos, end);
+    }
+    case GGUFSplitPattern::NUMBER:
+        return text.is(pos, CharClass::NUMBER) ? 1 : 0;
+    case GGUFSplitPattern::NUMBERS:
+        return match_run(text, pos, end, CharClass::NUMBER);
+    case GGUFSplitPattern::PUNCTUATION: {
+        size_t match_end = pos;
+        while (match_end < end && (text.is(match_end, CharClass::PUNCTUATION) ||
+                                   (text.code_points[match_end] < 0x80 && std::string("$+<=>^~|").find(static_cast<char>(text.code_points[match_end])) != std::string::npos))) {
+            ++match_end;
+        }
+        return match_end - pos;
+    }
+    case GGUFSplitPattern::THREE_DIGITS: {
+        auto is_digit = [&](size_t i) {
+            return i < end && text.code_points[i] >= '0' && text.code_points[i] <= '9';
+        };
+        return is_digit(pos) && is_digit(pos + 1) && is_digit(pos + 2) ? 3 : 0;
+    }
+    }
+    return 0;
+}
+
+// splits the code point ranges isolating the matches of the pattern as the pieces of their own, like RegexSplit
+inline std::vector<std::pair<size_t, size_t>> split(GGUFSplitPattern pattern, const Text& text, const std::vector<std::pair<size_t, size_t>>& pieces) {
+    std::vector<std::pair<size_t, size_t>> result;
+    for (const auto& [begin, end] : pieces) {
+        size_t gap_begin = begin;
+        size_t pos = begin;
+        while (pos < end) {
+            const size_t length = match(pattern, text, pos, end);
+            if (length == 0) {
+                ++pos;
+                continue;
+            }
+            if (gap_begin < pos) {
+                result.emplace_back(gap_begin, pos);
+            }
+            result.emplace_back(pos, pos + length);
+            pos += length;
+            gap_begin = pos;
+        }
+        if (gap_begin < end) {
+            result.emplace_back(gap_begin, end);
+        }
+    }
+    return result;
+}
+
+}  // namespace gguf_native
+
+/**
+ * Byte-level BPE tokenizer driven directly by the vocab and the merges of a GGUF file, which replaces the OpenVINO
+ * tokenizer and detokenizer models built from them by create_tokenizer_from_config(). The text is split by the special
+ * tokens and the split patterns, each piece is merged with the ranks of the merges.
+ */
+class GGUFNativeTokenizer {
+public:
+    /**
+     * @param vocab The bytes of each token.
+     * @param merges The bytes of the left and right tokens of each merge, in the order of their priority.
+     * @param special_token_ids The tokens, which are matched as a whole before the pre-tokenization and are skipped on decode.
+     * @param split_patterns The patterns applied one after another to pre-tokenize the text.
+     * @param max_length The number of the last tokens kept by encode(), 0 to keep all the tokens.
+     */
+    GGUFNativeTokenizer(std::vector<std::string> vocab,
+                        const std::vector<std::pair<std::string, std::string>>& merges,
+                        const std::vector<int64_t>& special_token_ids,
+                        std::vector<GGUFSplitPattern> split_patterns,
+                        std::optional<int64_t> unk_token_id = std::nullopt,
+                        size_t max_length = 0) :
+            m_vocab(std::move(vocab)), m_split_patterns(std::move(split_patterns)), m_unk_token_id(unk_token_id), m_max_length(max_length) {
+        m_token_ids.reserve(m_vocab.size());
+        for (size_t id = 0; id < m_vocab.size(); ++id) {
+            m_token_ids.emplace(m_vocab[id], static_cast<int64_t>(id));
+        }
+        for (size_t byte = 0; byte < 256; ++byte) {
+            auto it = m_token_ids.find(std::string(1, static_cast<char>(byte)));
+            m_byte_token_ids[byte] = it != m_token_ids.end() ? it->second : -1;
+        }
+        m_merges.reserve(merges.size());
+        for (size_t rank = 0; rank < merges.size(); ++rank) {
+            const auto& [left, right] = merges[rank];
+            auto left_it = m_token_ids.find(left), right_it = m_token_ids.find(right), merged_it = m_token_ids.find(left + right);
+            if (left_it != m_token_ids.end() && right_it != m_token_ids.end() && merged_it != m_token_ids.end()) {
+                // the first merge of the pair has the priority
+                m_merges.emplace(get_pair_key(left_it->second, right_it->second), Merge{rank, merged_it->second});
+            }
+        }
+        for (int64_t id : special_token_ids) {
+            OPENVINO_ASSERT(id >= 0 && static_cast<size_t>(id) < m_vocab.size(), "Special token id ", id, " is out of the vocab");
+            if (!m_vocab[id].empty()) {
+                m_special_tokens.emplace_back(m_vocab[id], id);
+                m_special_token_first_bytes[static_cast<unsigned char>(m_vocab[id][0])] = true;
+            }
+            m_special_token_ids.insert(id);
+        }
+        // the longest special token is matched if several ones start at the same position
+        std::stable_sort(m_special_tokens.begin(), m_special_tokens.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first.size() > rhs.first.size();
+        });
+    }
+
+    /**
+     * @return The token ids of the text, std::nullopt if the text contains characters, which can't be pre-tokenized
+     * natively, so that the text has to be encoded by the OpenVINO tokenizer model.
+     */
+    std::optional<std::vector<int64_t>> encode(const std::string& text) const {
+        std::optional<gguf_native::Text> parsed_text = gguf_native::parse_text(text);
+        if (!parsed_text) {
+            return std::nullopt;
+        }
+        const gguf_native::Text& code_points = *parsed_text;
+        std::vector<int64_t> token_ids;
+        size_t begin = 0;
+        while (begin < text.size()) {
+            // the text between the special tokens
+            size_t end = begin;
+            std::optional<std::pair<size_t, int64_t>> special_token;
+            for (; end < text.size() && !special_token; ++end) {
+                special_token = match_special_token(text, end);
+            }
+            if (special_token) {
+                --end;
+            }
+            encode_pieces(text, code_points, begin, end, token_ids);
+            if (special_token) {
+                token_ids.push_back(special_token->second);
+                end += special_token->first;
+            }
+            begin = end;
+        }
+        if (m_max_length > 0 && token_ids.size() > m_max_length) {
+            token_ids.erase(token_ids.begin(), token_ids.end() - m_max_length);
+        }
+        return token_ids;
+    }
+
+    std::string decode(const std::vector<int64_t>& token_ids, bool skip_special_tokens = true) const {
+        std::string text;
+        for (int64_t id : token_ids) {
+            if (id < 0 || static_cast<size_t>(id) >= m_vocab.size() || (skip_special_tokens && m_special_token_ids.count(id))) {
+                continue;
+            }
+            text += m_vocab[id];
+        }
+        return text;
+    }
+
+    /**
+     * @return The bytes of each token of the vocab, the special tokens are empty like for the detokenization, which
+     * skips them.
+     */
+    std::vector<std::string> get_detokenization_pieces() const {
+        std::vector<std::string> pieces = m_vocab;
+        for (int64_t id : m_special_token_ids) {
+            pieces[id].clear();
+        }
+        return pieces;
+    }
+
+    const std::vector<std::string>& get_vocab() const {
+        return m_vocab;
+    }
+
+private:
+    struct Merge {
+        size_t rank;
+        int64_t token_id;
+    };
+
+    static uint64_t get_pair_key(int64_t left, int64_t right) {
+        return (static_cast<uint64_t>(left) << 32) | static_cast<uint64_t>(right);
+    }
+
+    // the length and the id of the special token starting at the byte offset, if any
+    std::optional<std::pair<size_t, int64_t>> match_special_token(const std::string& text, size_t offset) const {
+        if (!m_special_token_first_bytes[static_cast<unsigned char>(text[offset])]) {
+            return std::nullopt;
+        }
+        for (const auto& [token, id] : m_special_tokens) {
+            if (text.compare(offset, token.size(), token) == 0) {
+                return std::make_pair(token.size(), id);
+            }
+        }
+        return std::nullopt;
+    }
+
+    // pre-tokenizes the bytes [begin, end) of the text, which start and end at character boundaries
+    void encode_pieces(const std::string& text, const gguf_native::Text& code_points, size_t begin, size_t end, std::vector<int64_t>& token_ids) const {
+        if (begin == end) {
+            return;
+        }
+        auto to_code_point = [&code_points](size_t offset) {
+            return static_cast<size_t>(std::lower_bound(code_points.offsets.begin(), code_points.offsets.end(), offset) - code_points.offsets.begin());
+        };
+        std::vector<std::pair<size_t, size_t>> pieces = {{to_code_point(begin), to_code_point(end)}};
+        for (GGUFSplitPattern pattern : m_split_patterns) {
+            pieces = gguf_native::split(pattern, code_points, pieces);
+        }
+        for (const auto& [piece_begin, piece_end] : pieces) {
+            const size_t offset = code_points.offsets[piece_begin];
+            merge(text.substr(offset, code_points.offsets[piece_end] - offset), token_ids);
+        }
+    }
+
+    // merges the bytes of the piece by the ranks of the merges, the lowest rank leftmost pair first
+    void merge(const std::string& piece, std::vector<int64_t>& token_ids) const {
+        std::vector<int64_t> symbols;
+        symbols.reserve(piece.size());
+        for (char byte : piece) {
+            const int64_t id = m_byte_token_ids[static_cast<unsigned char>(byte)];
+            if (id >= 0) {
+                symbols.push_back(id);
+            } else if (m_unk_token_id && (symbols.empty() || symbols.back() != *m_unk_token_id)) {
+                // the consecutive unknown bytes are fused into a single unknown token
+                symbols.push_back(*m_unk_token_id);
+            }
+        }
+        while (symbols.size() > 1) {
+            const Merge* best_merge = nullptr;
+            size_t best_pos = 0;
+            for (size_t pos = 0; pos + 1 < symbols.size(); ++pos) {
+                auto it = m_merges.find(get_pair_key(symbols[pos], symbols[pos + 1]));
+                if (it != m_merges.end() && (!best_merge || it->second.rank < best_merge->rank)) {
+                    best_merge = &it->second;
+                    best_pos = pos;
+                }
+            }
+            if (!best_merge) {
+                break;
+            }
+            symbols[best_pos] = best_merge->token_id;
+            symbols.erase(symbols.begin() + best_pos + 1);
+        }
+        token_ids.insert(token_ids.end(), symbols.begin(), symbols.end());
+    }
+
+    std::vector<std::string> m_vocab;
+    std::unordered_map<std::string, int64_t> m_token_ids;
+    int64_t m_byte_token_ids[256];
+    std::unordered_map<uint64_t, Merge> m_merges;
+    // sorted by length descending
+    std::vector<std::pair<std::string, int64_t>> m_special_tokens;
+    bool m_special_token_first_bytes[256] = {};
+    std::unordered_set<int64_t> m_special_token_ids;
+    std::vector<GGUFSplitPattern> m_split_patterns;
+    std::optional<int64_t> m_unk_token_id;
+    size_t m_max_length;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -75,7 +75,7 @@ void extract_q8_0_data(const gguf_tensor& tensor,
     auto weights = static_cast<uint8_t*>(weights_arr.data());
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
-    for (int64_t i = 0; i < scales_arr.get_size(); i++) {
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
         scales[i] = ov::float16::from_bits(*(uint16_t*)block_data);
         biases[i] = ov::float16(-128.f * static_cast<float>(scales[i]));
@@ -86,7 +86,7 @@ void extract_q8_0_data(const gguf_tensor& tensor,
             x ^= 1 << 7;
             weights[i * weights_per_block + j] = x;
         }
-    }
+    });
 }
 
 void unpack_256_4(const uint8_t* data, uint8_t* dst) {
@@ -158,6 +158,119 @@ void extract_q4_k_data(const gguf_tensor& tensor,
     });
 }
 
+// Extracts 6 bit scale and min of a sub block from the 12 bytes, where the 8 scales and mins of Q4_K and Q5_K
+// super blocks are packed.
+void get_scale_min_k4(size_t j, const uint8_t* q, uint8_t& scale, uint8_t& min) {
+    if (j < 4) {
+        scale = q[j] & 0b111111;
+        min = q[j + 4] & 0b111111;
+    } else {
+        scale = (q[j + 4] & 0b00001111) | ((q[j - 4] >> 6) << 4);
+        min = (q[j + 4] >> 4) | ((q[j] >> 6) << 4);
+    }
+}
+
+// Extracts (weight, scales, biases) from Q5_K tensors, the 5 bit weights are stored as u8.
+// Data layout is: |16 bit scale|16 bit min|12 bytes of 6 bit sub block scales and mins|32 bytes of the 5th bits|
+// |256 x 4bit weights|.
+void extract_q5_k_data(const gguf_tensor& tensor,
+                       ov::Tensor& weights_arr,
+                       ov::Tensor& scales_arr,
+                       ov::Tensor& biases_arr) {
+    const uint64_t bytes_per_block = 2 + 2 + 12 + 32 + 128;
+    const uint64_t n_super_block = tensor.bsize / bytes_per_block;
+    auto data = static_cast<uint8_t*>(tensor.weights_data);
+    auto weights = static_cast<uint8_t*>(weights_arr.data());
+    auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+
+    ov::parallel_for(n_super_block, [&](size_t i) {
+        uint8_t* block_data = data + i * bytes_per_block;
+
+        float scale_scales = static_cast<float>(ov::float16::from_bits(*((uint16_t*)block_data)));
+        float scale_biases = static_cast<float>(ov::float16::from_bits(*((uint16_t*)block_data + 1)));
+        const uint8_t* sub_block_scales = block_data + 4;
+        const uint8_t* qh = block_data + 16;
+        const uint8_t* ql = block_data + 48;
+
+        for (size_t j = 0; j < 8; ++j) {
+            uint8_t scale, min;
+            get_scale_min_k4(j, sub_block_scales, scale, min);
+            scales[i * 8 + j] = ov::float16(scale_scales * static_cast<float>(scale));
+            biases[i * 8 + j] = ov::float16(-1.f * scale_biases * static_cast<float>(min));
+        }
+
+        // every 64 weights take 32 bytes of 'ql': the lower nibbles, then the higher ones, and 2 bits of 'qh'
+        uint8_t* dst = weights + i * 256;
+        for (size_t j = 0; j < 4; ++j) {
+            for (size_t l = 0; l < 32; ++l) {
+                dst[j * 64 + l] = (ql[j * 32 + l] & 0xF) | (((qh[l] >> (2 * j)) & 1) << 4);
+                dst[j * 64 + 32 + l] = (ql[j * 32 + l] >> 4) | (((qh[l] >> (2 * j + 1)) & 1) << 4);
+            }
+        }
+    });
+}
+
+// Non-uniform 4 bit values of IQ4_NL and IQ4_XS, the weights are stored as u8 offset by 128.
+constexpr int8_t iq4_values[16] = {-127, -104, -83, -65, -49, -35, -22, -10, 1, 13, 25, 38, 53, 69, 89, 113};
+
+void unpack_32_iq4(const uint8_t* qs, uint8_t* dst) {
+    for (size_t j = 0; j < 16; ++j) {
+        dst[j] = static_cast<uint8_t>(iq4_values[qs[j] & 0xF] + 128);
+        dst[j + 16] = static_cast<uint8_t>(iq4_values[qs[j] >> 4] + 128);
+    }
+}
+
+// Extracts (weight, scales, biases) from IQ4_NL tensors.
+// Data layout is: |16 bit scale|32 x 4bit indices of 'iq4_values'|.
+void extract_iq4_nl_data(const gguf_tensor& tensor,
+                         ov::Tensor& weights_arr,
+                         ov::Tensor& scales_arr,
+                         ov::Tensor& biases_arr) {
+    const uint64_t bytes_per_block = 18;  // 2 bytes scale, 32x0.5 byte indices
+    auto data = static_cast<uint8_t*>(tensor.weights_data);
+    auto weights = static_cast<uint8_t*>(weights_arr.data());
+    auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
+        uint8_t* block_data = data + i * bytes_per_block;
+        scales[i] = ov::float16::from_bits(*((uint16_t*)block_data));
+        biases[i] = ov::float16(-128.f * static_cast<float>(scales[i]));
+        unpack_32_iq4(block_data + 2, weights + i * 32);
+    });
+}
+
+// Extracts (weight, scales, biases) from IQ4_XS tensors.
+// Data layout is: |16 bit scale|16 bit higher 2 bits of sub block scales|4 bytes of lower 4 bits of sub block scales|
+// |256 x 4bit indices of 'iq4_values'|.
+void extract_iq4_xs_data(const gguf_tensor& tensor,
+                         ov::Tensor& weights_arr,
+                         ov::Tensor& scales_arr,
+                         ov::Tensor& biases_arr) {
+    const uint64_t bytes_per_block = 2 + 2 + 4 + 128;
+    const uint64_t n_super_block = tensor.bsize / bytes_per_block;
+    auto data = static_cast<uint8_t*>(tensor.weights_data);
+    auto weights = static_cast<uint8_t*>(weights_arr.data());
+    auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+
+    ov::parallel_for(n_super_block, [&](size_t i) {
+        uint8_t* block_data = data + i * bytes_per_block;
+
+        float scale_factor = static_cast<float>(ov::float16::from_bits(*((uint16_t*)block_data)));
+        uint16_t scales_h = *((uint16_t*)block_data + 1);
+        const uint8_t* scales_l = block_data + 4;
+
+        for (size_t j = 0; j < 8; ++j) {
+            int sub_block_scale = ((scales_l[j / 2] >> (4 * (j % 2))) & 0xF) | (((scales_h >> (2 * j)) & 3) << 4);
+            scales[i * 8 + j] = ov::float16(scale_factor * static_cast<float>(sub_block_scale - 32));
+            biases[i * 8 + j] = ov::float16(-128.f * static_cast<float>(scales[i * 8 + j]));
+            unpack_32_iq4(block_data + 8 + j * 16, weights + i * 256 + j * 32);
+        }
+    });
+}
+
 void extract_q6_k_data(const gguf_tensor& tensor,
                        ov::Tensor& weights_arr,
                        ov::Tensor& scales_arr,
@@ -205,7 +318,7 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
     uint64_t weights_per_byte;
     if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q4_K) {
         weights_per_byte = 2;
-    } else {  // tensor.type == GGUF_TYPE_Q8_0 || tensor.type == GGUF_TYPE_Q6_K
+    } else {  // Q8_0, Q6_K and the types, whose weights don't fit the linear u4, are stored as u8
         weights_per_byte = 1;
     }
 
@@ -247,6 +360,12 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
         extract_q6_k_data(tensor, weights, scales, biases);
     } else if (tensor.type == GGUF_TYPE_Q4_K) {
         extract_q4_k_data(tensor, weights, scales, biases);
+    } else if (tensor.type == GGUF_TYPE_Q5_K) {
+        extract_q5_k_data(tensor, weights, scales, biases);
+    } else if (tensor.type == GGUF_TYPE_IQ4_NL) {
+        extract_iq4_nl_data(tensor, weights, scales, biases);
+    } else if (tensor.type == GGUF_TYPE_IQ4_XS) {
+        extract_iq4_xs_data(tensor, weights, scales, biases);
     } else {
         OPENVINO_ASSERT("Unsupported tensor type in 'gguf_load_quantized'");
     }
@@ -166,6 +166,17 @@ std::vector<std::string> get_split_regex(const std::string& pre) {
     return default_regex_exprs;
 }
 
+// the native counterparts of get_split_regex()
+std::vector<GGUFSplitPattern> get_split_patterns(const std::string& pre) {
+    if (pre == "qwen2") {
+        return {GGUFSplitPattern::QWEN2};
+    }
+    if (pre == "smollm") {
+        return {GGUFSplitPattern::NUMBER, GGUFSplitPattern::GPT2};
+    }
+    return {GGUFSplitPattern::PUNCTUATION, GGUFSplitPattern::GPT2, GGUFSplitPattern::NUMBERS, GGUFSplitPattern::THREE_DIGITS};
+}
+
 ov::OutputVector create_string_constant(const std::vector<std::string>& input_strings) {
     std::vector<int32_t> begins{};
     std::vector<int32_t> ends{};
@@ -307,7 +318,7 @@ std::vector<std::string> split_utf8_chars(const std::string& input) {
 }
 
 std::vector<uint8_t> apply_unicode_to_bytes(const std::string& token) {
-    auto bytes_encoder = unicode_to_bytes();
+    const auto& bytes_encoder = unicode_to_bytes();
 
     std::vector<uint8_t> res{};
     bool return_original = false;
@@ -425,12 +436,13 @@ ov::OutputVector parse_bbpe_config(const std::map<std::string, GGUFMetaData>& to
     return create_func("BPETokenizer", inputs, attributes);
 }
 
-std::tuple<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>, std::map<std::string, GGUFMetaData>>
-create_tokenizer_from_config(const std::shared_ptr<void>& shared_object_ov_tokenizers,
-                             const std::filesystem::path& gguf_model_path) {
-    auto gguf_metadata = std::get<0>(get_gguf_data(gguf_model_path.string()));
-    auto tokenizer_config = tokenizer_config_from_meta(gguf_metadata);
+std::map<std::string, GGUFMetaData> read_tokenizer_config(const std::filesystem::path& gguf_model_path) {
+    return tokenizer_config_from_meta(get_gguf_metadata(gguf_model_path.string()));
+}
 
+std::pair<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>>
+create_tokenizer_from_config(const std::shared_ptr<void>& shared_object_ov_tokenizers,
+                             const std::map<std::string, GGUFMetaData>& tokenizer_config) {
     auto tokenizer_input = std::make_shared<v0::Parameter>(element::string, PartialShape{Dimension::dynamic()});
 
     FactoryCreateType create_func =
@@ -561,7 +573,52 @@ create_tokenizer_from_config(const std::shared_ptr<void>& shared_object_ov_token
     packed_output[0].get_tensor().add_names({"string_output"});
     auto detokenizer = std::make_shared<Model>(packed_output, ParameterVector{detokenizer_input}, "detokenizer");
 
-    return {tokenizer, detokenizer, tokenizer_config};
+    return {tokenizer, detokenizer};
+}
+
+std::shared_ptr<GGUFNativeTokenizer> create_native_tokenizer_from_config(const std::map<std::string, GGUFMetaData>& tokenizer_config) {
+    const std::string* model = get_if_exist<std::string>(tokenizer_config, "model");
+    const std::vector<std::string>* tokens = get_if_exist<std::vector<std::string>>(tokenizer_config, "tokens");
+    const std::vector<std::string>* merges = get_if_exist<std::vector<std::string>>(tokenizer_config, "merges");
+    const ov::Tensor* token_types = get_if_exist<ov::Tensor>(tokenizer_config, "token_type");
+    // only the byte-level BPE is supported, like by create_tokenizer_from_config()
+    if (!model || *model != "gpt2" || !tokens || !merges || !token_types) {
+        return nullptr;
+    }
+
+    std::vector<std::string> vocab;
+    vocab.reserve(tokens->size());
+    for (const auto& token : *tokens) {
+        auto bytes = apply_unicode_to_bytes(token);
+        vocab.emplace_back(bytes.begin(), bytes.end());
+    }
+
+    std::vector<std::pair<std::string, std::string>> merge_pairs;
+    merge_pairs.reserve(merges->size());
+    for (const auto& merge : *merges) {
+        size_t space = merge.find(' ');
+        auto left = apply_unicode_to_bytes(merge.substr(0, space));
+        auto right = apply_unicode_to_bytes(merge.substr(space + 1));
+        merge_pairs.emplace_back(std::string(left.begin(), left.end()), std::string(right.begin(), right.end()));
+    }
+
+    std::vector<int64_t> special_token_ids;
+    for (size_t i = 0; i < token_types->get_size(); ++i) {
+        if (is_special_token(token_types->data<int32_t>()[i])) {
+            special_token_ids.push_back(static_cast<int64_t>(i));
+        }
+    }
+
+    std::optional<int64_t> unk_token_id;
+    if (auto val = get_if_exist<ov::Tensor>(tokenizer_config, "unknown_token_id")) {
+        unk_token_id = static_cast<int64_t>(val->data<uint32_t>()[0]);
+    }
+
+    std::string pre{};
+    if (auto val = get_if_exist<std::string>(tokenizer_config, "pre")) {
+        pre = *val;
+    }
+    return std::make_shared<GGUFNativeTokenizer>(std::move(vocab), merge_pairs, special_token_ids, get_split_patterns(pre), unk_token_id, MAX_LENGTH);
 }
 
 std::string patch_gguf_chat_template(const std::string& chat_template) {
@@ -6,6 +6,7 @@
 #include <filesystem>
 
 #include "gguf.hpp"
+#include "gguf_native_tokenizer.hpp"
 
 using FactoryCreateType = ov::OutputVector (*)(const std::string& op_type,
                                                const ov::OutputVector& inputs,
@@ -18,9 +19,18 @@ bool is_gguf_model(const std::filesystem::path& file_path);
 std::map<std::string, GGUFMetaData> tokenizer_config_from_meta(
     const std::unordered_map<std::string, GGUFMetaData>& metadata);
 
-std::tuple<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>, std::map<std::string, GGUFMetaData>>
+// reads the tokenizer entries of the GGUF metadata, without the tensors of the model
+std::map<std::string, GGUFMetaData> read_tokenizer_config(const std::filesystem::path& gguf_model_path);
+
+std::pair<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>>
 create_tokenizer_from_config(const std::shared_ptr<void>& shared_object_ov_tokenizers,
-                             const std::filesystem::path& gguf_model_path);
+                             const std::map<std::string, GGUFMetaData>& tokenizer_config);
+
+/**
+ * @return The native tokenizer encoding and decoding with the vocab and the merges of the tokenizer config, nullptr if the
+ * tokenizer model of the config is not supported natively.
+ */
+std::shared_ptr<GGUFNativeTokenizer> create_native_tokenizer_from_config(const std::map<std::string, GGUFMetaData>& tokenizer_config);
 
 std::shared_ptr<void> load_shared_object(const std::filesystem::path& path);
 
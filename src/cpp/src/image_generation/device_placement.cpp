@@ -0,0 +1,96 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/device_placement.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#include <nlohmann/json.hpp>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+const char* const STAGE_NAMES[NUM_PLACEMENT_STAGES] = {"text_encode_device", "denoise_device", "vae_device"};
+
+}  // namespace
+
+std::optional<DevicePlacement> select_device_placement(const std::map<std::string, DeviceProfile>& profiles,
+                                                       const std::array<size_t, NUM_PLACEMENT_STAGES>& weights_sizes,
+                                                       size_t num_inference_steps) {
+    std::vector<std::string> devices;
+    for (const auto& [device, profile] : profiles) {
+        devices.push_back(device);
+    }
+
+    std::optional<DevicePlacement> best_placement;
+    float best_latency = std::numeric_limits<float>::max();
+    // the placements are enumerated as the numbers of 'devices.size()' base, there are few devices and three stages
+    std::array<size_t, NUM_PLACEMENT_STAGES> indices{};
+    size_t num_placements = 1;
+    for (size_t stage = 0; stage < NUM_PLACEMENT_STAGES; ++stage) {
+        num_placements *= devices.size();
+    }
+    for (size_t placement_index = 0; placement_index < num_placements && !devices.empty(); ++placement_index) {
+        for (size_t stage = 0, rest = placement_index; stage < NUM_PLACEMENT_STAGES; ++stage, rest /= devices.size()) {
+            indices[stage] = rest % devices.size();
+        }
+
+        float latency = 0.0f;
+        std::map<std::string, size_t> pool_usages;
+        for (size_t stage = 0; stage < NUM_PLACEMENT_STAGES; ++stage) {
+            const DeviceProfile& profile = profiles.at(devices[indices[stage]]);
+            const size_t num_runs = stage == DENOISE ? num_inference_steps : 1;
+            latency += profile.latencies_ms[stage] * num_runs;
+            pool_usages[profile.memory_pool] += weights_sizes[stage];
+        }
+
+        const bool fits = std::all_of(indices.begin(), indices.end(), [&](size_t index) {
+            const DeviceProfile& profile = profiles.at(devices[index]);
+            return profile.memory_limit == 0 || pool_usages[profile.memory_pool] <= profile.memory_limit;
+        });
+        if (fits && latency < best_latency) {
+            best_latency = latency;
+            best_placement = DevicePlacement{devices[indices[TEXT_ENCODE]], devices[indices[DENOISE]], devices[indices[VAE_DECODE]]};
+        }
+    }
+    return best_placement;
+}
+
+std::optional<DevicePlacement> load_device_placement(const std::filesystem::path& path, const std::vector<std::string>& devices) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+
+    nlohmann::json data = nlohmann::json::parse(file);
+    if (!data.contains("devices") || data["devices"].get<std::vector<std::string>>() != devices) {
+        return std::nullopt;
+    }
+    DevicePlacement placement;
+    for (size_t stage = 0; stage < NUM_PLACEMENT_STAGES; ++stage) {
+        OPENVINO_ASSERT(data.contains(STAGE_NAMES[stage]), "Device placement ", path, " doesn't have '", STAGE_NAMES[stage], "'");
+        placement[stage] = data[STAGE_NAMES[stage]].get<std::string>();
+    }
+    return placement;
+}
+
+void save_device_placement(const std::filesystem::path& path, const std::vector<std::string>& devices, const DevicePlacement& placement) {
+    nlohmann::json data;
+    data["devices"] = devices;
+    for (size_t stage = 0; stage < NUM_PLACEMENT_STAGES; ++stage) {
+        data[STAGE_NAMES[stage]] = placement[stage];
+    }
+
+    std::ofstream file(path);
+    OPENVINO_ASSERT(file.is_open(), "Failed to open ", path, " to save the device placement");
+    file << data.dump(4);
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+// the stages of image generation, whose models are compiled on their own devices by 'compile()'
+enum PlacementStage : size_t { TEXT_ENCODE = 0, DENOISE = 1, VAE_DECODE = 2 };
+constexpr size_t NUM_PLACEMENT_STAGES = 3;
+
+// devices of the stages, indexed by 'PlacementStage'
+using DevicePlacement = std::array<std::string, NUM_PLACEMENT_STAGES>;
+
+struct DeviceProfile {
+    // latencies of the stages on the device, the denoising one is per step, ms
+    std::array<float, NUM_PLACEMENT_STAGES> latencies_ms{};
+    // the devices of the same memory pool (e.g. CPU and NPU using the host memory) share its limit
+    std::string memory_pool;
+    // bytes available for the weights of the stages in the memory pool, 0 is unlimited
+    size_t memory_limit = 0;
+};
+
+/**
+ * Selects the devices of the stages minimizing the latency of text encoding, 'num_inference_steps' denoising steps
+ * and VAE decoding, so that the weights placed in each memory pool fit its limit. The latencies are measured with the
+ * inputs and outputs in host memory, so they include the transfers between the stages on different devices.
+ * @param weights_sizes Sizes of the weights of the stages, bytes
+ * @return std::nullopt, if no placement fits the memory limits
+ */
+std::optional<DevicePlacement> select_device_placement(const std::map<std::string, DeviceProfile>& profiles,
+                                                       const std::array<size_t, NUM_PLACEMENT_STAGES>& weights_sizes,
+                                                       size_t num_inference_steps);
+
+/**
+ * Loads the placement saved by 'save_device_placement()' for the same candidate devices.
+ * @return std::nullopt, if the file doesn't exist or it's saved for the other devices
+ */
+std::optional<DevicePlacement> load_device_placement(const std::filesystem::path& path, const std::vector<std::string>& devices);
+
+void save_device_placement(const std::filesystem::path& path, const std::vector<std::string>& devices, const DevicePlacement& placement);
+
+}  // namespace genai
+}  // namespace ov
@@ -9,8 +9,10 @@
 #include <tuple>
 
 #include "image_generation/schedulers/ischeduler.hpp"
+#include "image_generation/schedulers/device_scheduler_step.hpp"
 #include "image_generation/numpy_utils.hpp"
 #include "image_generation/image_processor.hpp"
+#include "image_generation/latent_preview.hpp"
 
 #include "openvino/genai/image_generation/generation_config.hpp"
 #include "openvino/genai/image_generation/autoencoder_kl.hpp"
@@ -145,39 +147,45 @@ protected:
         return get_config_in_channels() == (m_vae->get_config().latent_channels * 2 + 1);
     }
 
+    // loads the optional tiny autoencoder of 'preview_callback', which is placed next to 'vae_decoder'
+    void load_preview_vae(const std::filesystem::path& root_dir) {
+        const std::filesystem::path preview_vae_path = root_dir / "preview_vae_decoder";
+        if (std::filesystem::exists(preview_vae_path)) {
+            m_preview_vae = std::make_shared<AutoencoderKL>(preview_vae_path);
+        }
+    }
+
+    std::unique_ptr<LatentPreviewDecoder> create_preview_decoder(const ov::AnyMap& properties) const {
+        auto preview_callback_iter = properties.find(ov::genai::preview_callback.name());
+        if (preview_callback_iter == properties.end()) {
+            return nullptr;
+        }
+        OPENVINO_ASSERT(m_preview_vae != nullptr, "'", ov::genai::preview_callback.name(), "' requires the tiny autoencoder in ",
+                        m_root_dir / "preview_vae_decoder");
+        return std::make_unique<LatentPreviewDecoder>(
+            m_preview_vae, preview_callback_iter->second.as<std::function<void(size_t, size_t, ov::Tensor&)>>());
+    }
+
     virtual size_t get_config_in_channels() const = 0;
 
     virtual void blend_latents(ov::Tensor image_latent, ov::Tensor noise, ov::Tensor mask, ov::Tensor latent, size_t inference_step) {
         OPENVINO_ASSERT(m_pipeline_type == PipelineType::INPAINTING, "'blend_latents' can be called for inpainting pipeline only");
         OPENVINO_ASSERT(image_latent.get_shape() == latent.get_shape(), "Shapes for current", latent.get_shape(), "and initial image latents ", image_latent.get_shape(), " must match");
 
-        ov::Tensor noised_image_latent(image_latent.get_element_type(), {});
+        ov::Tensor noised_image_latent = image_latent;
         std::vector<std::int64_t> timesteps = m_scheduler->get_timesteps();
 
         if (inference_step < timesteps.size() - 1) {
-            image_latent.copy_to(noised_image_latent);
+            // the buffer of the noised image latent is reused by the denoising steps
+            image_latent.copy_to(m_noised_image_latent);
+            noised_image_latent = m_noised_image_latent;
 
             int64_t noise_timestep = timesteps[inference_step + 1];
             m_scheduler->add_noise(noised_image_latent, noise, noise_timestep);
-        } else {
-            noised_image_latent = image_latent;
         }
 
-        ov::Shape shape = image_latent.get_shape();
-        size_t batch_size = shape[0], in_channels = shape[1], channel_size = shape[2] * shape[3];
-        OPENVINO_ASSERT(batch_size == 1, "Batch size 1 is supported for now");
-
-        const float * mask_data = mask.data<const float>();
-        const float * noised_image_latent_data = noised_image_latent.data<const float>();
-        float * latent_data = latent.data<float>();
-
         // blend initial noised and processed latents
-        for (size_t i = 0; i < channel_size; ++i) {
-            float mask_value = mask_data[i];
-            for (size_t j = 0; j < in_channels; ++j) {
-                latent_data[j * channel_size + i] = (1.0f - mask_value) * noised_image_latent_data[j * channel_size + i] + mask_value * latent_data[j * channel_size + i];
-            }
-        }
+        numpy_utils::blend(latent, noised_image_latent, mask);
     }
 
     static std::optional<AdapterConfig> derived_adapters(const AdapterConfig& adapters) {
@@ -227,14 +235,43 @@ protected:
         return std::make_tuple(mask, masked_image_latent);
     }
 
+    // linear scheduler steps are computed on the denoising device, so that the latents stay there during denoising
+    void init_device_scheduler_step(const std::string& denoise_device, const ov::AnyMap& properties) {
+        if (denoise_device != "CPU" && denoise_device != "NPU") {
+            m_scheduler_step = std::make_shared<DeviceSchedulerStep>(denoise_device, properties);
+        }
+    }
+
+    // inpainting blends and concatenates the latents with the mask on host, so it keeps the host scheduler steps
+    bool use_device_scheduler_step() const {
+        return m_scheduler_step && m_scheduler->has_linear_step() && m_pipeline_type != PipelineType::INPAINTING;
+    }
+
+    std::map<std::string, ov::Tensor> device_scheduler_step(ov::Tensor noise_pred,
+                                                            ov::Tensor latent,
+                                                            size_t inference_step,
+                                                            size_t num_inference_steps) {
+        const LinearStep linear_step = m_scheduler->get_linear_step(inference_step);
+        // the next input of the denoising model is scaled within the same step
+        const float model_input_scale = inference_step + 1 < num_inference_steps ? m_scheduler->get_model_input_scale(inference_step + 1) : 1.0f;
+        return m_scheduler_step->step(noise_pred, latent, linear_step, model_input_scale);
+    }
+
     PipelineType m_pipeline_type;
     std::shared_ptr<IScheduler> m_scheduler;
+    // buffer of 'blend_latents', which is reused by the denoising steps
+    ov::Tensor m_noised_image_latent = ov::Tensor(ov::element::f32, {});
+    std::shared_ptr<DeviceSchedulerStep> m_scheduler_step = nullptr;
     ImageGenerationConfig m_generation_config;
     float m_load_time_ms = 0.0f;
+    // load time of each model, filled by the pipelines loading the models concurrently
+    std::map<std::string, float> m_model_load_times_ms;
     ImageGenerationPerfMetrics m_perf_metrics;
     std::filesystem::path m_root_dir;
 
     std::shared_ptr<AutoencoderKL> m_vae = nullptr;
+    // optional tiny autoencoder decoding the previews for 'preview_callback'
+    std::shared_ptr<AutoencoderKL> m_preview_vae = nullptr;
     std::shared_ptr<IImageProcessor> m_image_processor = nullptr, m_mask_processor_rgb = nullptr, m_mask_processor_gray = nullptr;
     std::shared_ptr<ImageResizer> m_image_resizer = nullptr, m_mask_resizer = nullptr;
 };
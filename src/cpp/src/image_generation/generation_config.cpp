@@ -66,6 +66,8 @@ void ImageGenerationConfig::update_generation_config(const ov::AnyMap& propertie
     read_anymap_param(properties, "strength", strength);
     read_anymap_param(properties, "adapters", adapters);
     read_anymap_param(properties, "max_sequence_length", max_sequence_length);
+    read_anymap_param(properties, "feature_reuse_interval", feature_reuse_interval);
+    read_anymap_param(properties, "mask_crop_padding", mask_crop_padding);
 
     // 'generator' has higher priority than 'seed' parameter
     const bool have_generator_param = properties.find(ov::genai::generator.name()) != properties.end();
@@ -93,6 +95,8 @@ void ImageGenerationConfig::validate() const {
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_2 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 2");
     OPENVINO_ASSERT(guidance_scale > 1.0f || negative_prompt_3 == std::nullopt, "Guidance scale <= 1.0 ignores negative prompt 3");
+    OPENVINO_ASSERT(feature_reuse_interval > 0, "'feature_reuse_interval' must be positive");
+    OPENVINO_ASSERT(mask_crop_padding >= -1, "'mask_crop_padding' must be non-negative or -1 to disable mask cropping");
 }
 
 }  // namespace genai
@@ -0,0 +1,308 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/image_generation_engine.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "image_generation/models/classifier_free_guidance.hpp"
+#include "image_generation/numpy_utils.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+// concatenates the tensors along the batch dimension
+ov::Tensor concat_batches(const std::vector<ov::Tensor>& tensors) {
+    OPENVINO_ASSERT(!tensors.empty(), "Nothing to concatenate");
+
+    ov::Shape shape = tensors.front().get_shape();
+    shape[0] = 0;
+    for (const ov::Tensor& tensor : tensors) {
+        const ov::Shape tensor_shape = tensor.get_shape();
+        OPENVINO_ASSERT(tensor.get_element_type() == tensors.front().get_element_type() &&
+                        tensor_shape.size() == shape.size() &&
+                        std::equal(tensor_shape.begin() + 1, tensor_shape.end(), shape.begin() + 1),
+                        "Tensors of shapes ", tensors.front().get_shape(), " and ", tensor_shape, " cannot be batched");
+        shape[0] += tensor_shape[0];
+    }
+
+    ov::Tensor batched(tensors.front().get_element_type(), shape);
+    uint8_t* batched_data = static_cast<uint8_t*>(batched.data());
+    for (const ov::Tensor& tensor : tensors) {
+        std::memcpy(batched_data, tensor.data(), tensor.get_byte_size());
+        batched_data += tensor.get_byte_size();
+    }
+    return batched;
+}
+
+// copies 'num_rows' batches starting from 'begin_row' to a new tensor
+ov::Tensor slice_batches(const ov::Tensor& tensor, size_t begin_row, size_t num_rows) {
+    ov::Shape shape = tensor.get_shape();
+    const size_t row_byte_size = tensor.get_byte_size() / shape[0];
+    shape[0] = num_rows;
+
+    ov::Tensor sliced(tensor.get_element_type(), shape);
+    std::memcpy(sliced.data(), static_cast<const uint8_t*>(tensor.data()) + begin_row * row_byte_size, sliced.get_byte_size());
+    return sliced;
+}
+
+}  // namespace
+
+ImageGenerationHandleImpl::ImageGenerationHandleImpl(std::shared_ptr<ImageGenerationRequestState> state)
+    : m_state(std::move(state)) {}
+
+ImageGenerationHandleImpl::~ImageGenerationHandleImpl() = default;
+
+GenerationStatus ImageGenerationHandleImpl::get_status() const {
+    return m_state->status;
+}
+
+void ImageGenerationHandleImpl::cancel() {
+    m_state->cancelled = true;
+}
+
+void ImageGenerationHandleImpl::wait() const {
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->status_changed.wait(lock, [this] {
+        return m_state->status != GenerationStatus::RUNNING;
+    });
+}
+
+ov::Tensor ImageGenerationHandleImpl::get_image() const {
+    if (m_state->error) {
+        std::rethrow_exception(m_state->error);
+    }
+    OPENVINO_ASSERT(m_state->status == GenerationStatus::FINISHED, "Image generation request is not finished");
+    return m_state->image;
+}
+
+ImageGenerationEngine::ImageGenerationEngine(std::shared_ptr<StableDiffusionPipeline> pipeline)
+    : m_pipeline(std::move(pipeline)) {
+    OPENVINO_ASSERT(m_pipeline->m_pipeline_type == PipelineType::TEXT_2_IMAGE, "Request batching supports text to image generation only");
+    OPENVINO_ASSERT(!m_pipeline->m_root_dir.empty(), "Request batching requires a pipeline created from a models path, "
+                    "since each request creates its own scheduler");
+}
+
+ImageGenerationHandle ImageGenerationEngine::add_request(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    Request request;
+    request.positive_prompt = positive_prompt;
+    request.config = m_pipeline->get_generation_config();
+    request.config.update_generation_config(properties);
+
+    if (properties.find(ov::genai::adapters.name()) != properties.end()) {
+        // the adapters of the request are applied to its rows of the batch, see 'denoise()'
+        request.adapters = request.config.adapters.value_or(AdapterConfig());
+        if (auto updated_adapters = StableDiffusionPipeline::derived_adapters(*request.adapters)) {
+            request.adapters = updated_adapters;
+        }
+    }
+    OPENVINO_ASSERT(request.config.feature_reuse_interval == 1, "Feature reuse is not supported by request batching, "
+                    "since the requests of a batch are at different timesteps");
+
+    auto callback_iter = properties.find(ov::genai::callback.name());
+    if (callback_iter != properties.end()) {
+        request.callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
+    }
+
+    m_pipeline->compute_dim(request.config.height, {}, 1 /* assume NHWC */);
+    m_pipeline->compute_dim(request.config.width, {}, 2 /* assume NHWC */);
+    m_pipeline->check_inputs(request.config, {});
+
+    request.state = std::make_shared<ImageGenerationRequestState>();
+    ImageGenerationHandle handle = std::make_shared<ImageGenerationHandleImpl>(request.state);
+
+    ++m_num_non_finished_requests;
+    std::lock_guard<std::mutex> lock(m_awaiting_requests_mutex);
+    m_awaiting_requests.push_back(std::move(request));
+
+    return handle;
+}
+
+bool ImageGenerationEngine::has_non_finished_requests() {
+    return m_num_non_finished_requests > 0;
+}
+
+void ImageGenerationEngine::admit(Request& request) {
+    const ImageGenerationConfig& config = request.config;
+
+    request.scheduler = std::dynamic_pointer_cast<IScheduler>(
+        Scheduler::from_config(m_pipeline->m_root_dir / "scheduler/scheduler_config.json"));
+    request.scheduler->set_timesteps(config.num_inference_steps, config.strength);
+    request.timesteps = request.scheduler->get_timesteps();
+    request.batch_size_multiplier = m_pipeline->m_unet->do_classifier_free_guidance(config.guidance_scale) ? 2 : 1;
+
+    // the hidden states refer to the outputs of the text encoders, so they are copied before the next request is admitted
+    m_pipeline->m_unet_hidden_states.clear();
+    if (m_adapters_per_row) {
+        // the prompt is encoded with the adapters of the request
+        std::optional<AdapterConfig> adapters = request.adapters;
+        if (!adapters) {
+            adapters = m_pipeline->get_generation_config().adapters.value_or(AdapterConfig());
+        }
+        m_pipeline->set_lora_adapters(adapters);
+    }
+    m_pipeline->compute_hidden_states(request.positive_prompt, config);
+
+    const size_t num_rows = config.num_images_per_prompt * request.batch_size_multiplier;
+    for (const auto& [name, hidden_states] : m_pipeline->m_unet_hidden_states) {
+        const size_t hidden_states_rows = hidden_states.get_shape()[0];
+        if (hidden_states_rows == num_rows) {
+            request.hidden_states[name] = slice_batches(hidden_states, 0, num_rows);
+        } else {
+            // e.g. LCM 'timestep_cond' is shared by the whole batch
+            OPENVINO_ASSERT(hidden_states_rows == 1, "Unexpected batch of '", name, "' hidden states: ", hidden_states_rows);
+            request.hidden_states[name] = numpy_utils::repeat(slice_batches(hidden_states, 0, 1), num_rows);
+        }
+    }
+
+    const size_t vae_scale_factor = m_pipeline->m_vae->get_vae_scale_factor();
+    const ov::Shape latent_shape{config.num_images_per_prompt, m_pipeline->m_vae->get_config().latent_channels,
+                                 config.height / vae_scale_factor, config.width / vae_scale_factor};
+    request.latent = config.generator->randn_tensor(latent_shape);
+
+    // pure noise is scaled by the scheduler's init sigma
+    float* latent_data = request.latent.data<float>();
+    for (size_t i = 0; i < request.latent.get_size(); ++i) {
+        latent_data[i] *= request.scheduler->get_init_noise_sigma();
+    }
+}
+
+void ImageGenerationEngine::denoise(const std::vector<Request*>& batch) {
+    std::vector<ov::Tensor> samples;
+    std::vector<std::int64_t> timesteps;
+    std::map<std::string, std::vector<ov::Tensor>> hidden_states;
+
+    for (Request* request : batch) {
+        ov::Tensor latent_scaled(ov::element::f32, request->latent.get_shape());
+        request->latent.copy_to(latent_scaled);
+        request->scheduler->scale_model_input(latent_scaled, request->inference_step);
+
+        // the unconditional and text rows of the request denoise the same latents
+        for (size_t i = 0; i < request->batch_size_multiplier; ++i) {
+            samples.push_back(latent_scaled);
+        }
+
+        const size_t num_rows = latent_scaled.get_shape()[0] * request->batch_size_multiplier;
+        timesteps.insert(timesteps.end(), num_rows, request->timesteps[request->inference_step]);
+
+        for (const auto& [name, tensor] : request->hidden_states) {
+            hidden_states[name].push_back(tensor);
+        }
+    }
+
+    for (const auto& [name, tensors] : hidden_states) {
+        m_pipeline->m_unet->set_hidden_states(name, concat_batches(tensors));
+    }
+
+    if (m_adapters_per_row) {
+        // the requests without adapters use the ones of the pipeline generation config
+        std::optional<AdapterConfig> default_adapters = m_pipeline->get_generation_config().adapters;
+        if (default_adapters) {
+            if (auto updated_adapters = StableDiffusionPipeline::derived_adapters(*default_adapters)) {
+                default_adapters = updated_adapters;
+            }
+        }
+
+        std::vector<AdapterConfig> row_adapters;
+        for (Request* request : batch) {
+            const size_t num_rows = request->latent.get_shape()[0] * request->batch_size_multiplier;
+            const AdapterConfig& adapters = request->adapters ? *request->adapters : default_adapters.value_or(AdapterConfig());
+            row_adapters.insert(row_adapters.end(), num_rows, adapters);
+        }
+        m_pipeline->m_unet->set_adapters_per_row(row_adapters);
+    }
+    ov::Tensor timestep(ov::element::i64, {timesteps.size()});
+    std::copy(timesteps.begin(), timesteps.end(), timestep.data<std::int64_t>());
+
+    // the samples already hold the rows of classifier-free guidance, so the raw noise prediction is returned
+    ov::Tensor noise_pred = m_pipeline->m_unet->infer(concat_batches(samples), timestep);
+
+    size_t begin_row = 0;
+    for (Request* request : batch) {
+        const ImageGenerationConfig& config = request->config;
+        const size_t num_rows = request->latent.get_shape()[0] * request->batch_size_multiplier;
+
+        ov::Tensor request_noise_pred = slice_batches(noise_pred, begin_row, num_rows);
+        begin_row += num_rows;
+        if (request->batch_size_multiplier > 1) {
+            request_noise_pred = apply_classifier_free_guidance(request_noise_pred, config.guidance_scale);
+        }
+
+        auto scheduler_step_result = request->scheduler->step(request_noise_pred, request->latent, request->inference_step, config.generator);
+        request->latent = scheduler_step_result["latent"];
+
+        // check whether scheduler returns "denoised" image, which should be passed to VAE decoder
+        const auto it = scheduler_step_result.find("denoised");
+        request->denoised = it != scheduler_step_result.end() ? it->second : request->latent;
+
+        if (request->callback && request->callback(request->inference_step, request->timesteps.size(), request->denoised)) {
+            request->state->cancelled = true;
+        }
+        ++request->inference_step;
+    }
+}
+
+void ImageGenerationEngine::step() {
+    {
+        std::lock_guard<std::mutex> lock(m_awaiting_requests_mutex);
+        for (Request& request : m_awaiting_requests) {
+            m_running_requests.push_back(std::move(request));
+        }
+        m_awaiting_requests.clear();
+    }
+
+    // LoRA adapters of the pipeline generation config are applied to the whole batch, unless a request has its own ones
+    m_adapters_per_row = std::any_of(m_running_requests.begin(), m_running_requests.end(), [](const Request& request) {
+        return request.adapters.has_value();
+    });
+    m_pipeline->set_lora_adapters(m_pipeline->get_generation_config().adapters);
+
+    std::map<std::pair<int64_t, int64_t>, std::vector<Request*>> batches;
+    for (auto it = m_running_requests.begin(); it != m_running_requests.end();) {
+        if (it->state->cancelled) {
+            it->state->set_status(GenerationStatus::CANCEL);
+            --m_num_non_finished_requests;
+            it = m_running_requests.erase(it);
+            continue;
+        }
+
+        if (!it->latent) {
+            try {
+                admit(*it);
+            } catch (...) {
+                it->state->error = std::current_exception();
+                it->state->set_status(GenerationStatus::CANCEL);
+                --m_num_non_finished_requests;
+                m_running_requests.erase(it);
+                throw;
+            }
+        }
+
+        batches[{it->config.height, it->config.width}].push_back(&*it);
+        ++it;
+    }
+
+    for (const auto& [image_size, batch] : batches) {
+        denoise(batch);
+    }
+
+    for (auto it = m_running_requests.begin(); it != m_running_requests.end();) {
+        if (it->state->cancelled) {
+            it->state->set_status(GenerationStatus::CANCEL);
+        } else if (it->inference_step == it->timesteps.size()) {
+            it->state->image = m_pipeline->decode(it->denoised);
+            it->state->set_status(GenerationStatus::FINISHED);
+        } else {
+            ++it;
+            continue;
+        }
+        --m_num_non_finished_requests;
+        it = m_running_requests.erase(it);
+    }
+}
+
+}  // namespace genai
+}  // namespace ov
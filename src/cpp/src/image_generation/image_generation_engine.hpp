@@ -0,0 +1,96 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "openvino/genai/image_generation/image_generation_handle.hpp"
+
+#include "image_generation/stable_diffusion_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+struct ImageGenerationRequestState {
+    std::atomic<GenerationStatus> status{GenerationStatus::RUNNING};
+    std::atomic<bool> cancelled{false};
+    // set before the status becomes FINISHED
+    ov::Tensor image;
+    // set before the status becomes CANCEL, if the request is failed
+    std::exception_ptr error = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable status_changed;
+
+    void set_status(GenerationStatus new_status) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            status = new_status;
+        }
+        status_changed.notify_all();
+    }
+};
+
+/**
+ * Denoises the requests of Stable Diffusion (XL) pipeline in batches: all the running requests of the same image size
+ * are passed to a single UNet inference, where each sample has the timestep of its request. The requests are admitted
+ * between the steps, so a new request doesn't wait until the running ones are finished.
+ */
+class ImageGenerationEngine {
+public:
+    explicit ImageGenerationEngine(std::shared_ptr<StableDiffusionPipeline> pipeline);
+
+    ImageGenerationHandle add_request(const std::string& positive_prompt, const ov::AnyMap& properties);
+
+    void step();
+
+    bool has_non_finished_requests();
+
+private:
+    struct Request {
+        std::string positive_prompt;
+        ImageGenerationConfig config;
+        std::function<bool(size_t, size_t, ov::Tensor&)> callback = nullptr;
+        // adapters of the request's rows of the batch, which require AdapterConfig::MODE_POOL
+        std::optional<AdapterConfig> adapters;
+        std::shared_ptr<ImageGenerationRequestState> state;
+
+        // denoising state, initialized by 'admit()'
+        std::shared_ptr<IScheduler> scheduler;
+        std::vector<std::int64_t> timesteps;
+        size_t inference_step = 0;
+        size_t batch_size_multiplier = 1;
+        ov::Tensor latent, denoised;
+        // UNet hidden states of 'latent.get_shape()[0] * batch_size_multiplier' rows
+        std::map<std::string, ov::Tensor> hidden_states;
+    };
+
+    void admit(Request& request);
+
+    // performs a denoising step of the requests, which have the same latent shape
+    void denoise(const std::vector<Request*>& batch);
+
+    std::shared_ptr<StableDiffusionPipeline> m_pipeline;
+
+    std::mutex m_awaiting_requests_mutex;
+    std::vector<Request> m_awaiting_requests;
+    std::list<Request> m_running_requests;
+    // number of the requests, which are added and not finished or cancelled yet
+    std::atomic<size_t> m_num_non_finished_requests{0};
+    // whether the adapters are applied per request instead of the whole batch
+    bool m_adapters_per_row = false;
+};
+
+}  // namespace genai
+}  // namespace ov
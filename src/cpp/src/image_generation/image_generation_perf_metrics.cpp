@@ -36,6 +36,7 @@ ov::genai::MeanStdPair calculation(const std::vector<ov::genai::MicroSeconds>& d
 void ImageGenerationPerfMetrics::clean_up() {
     m_evaluated = false;
     load_time = 0.f;
+    model_load_times.clear();
     generate_duration = 0.f;
     vae_encoder_inference_duration = 0.f;
     vae_decoder_inference_duration = 0.f;
@@ -155,6 +156,10 @@ float ImageGenerationPerfMetrics::get_load_time() const {
     return load_time;
 }
 
+std::map<std::string, float> ImageGenerationPerfMetrics::get_model_load_times() const {
+    return model_load_times;
+}
+
 float ImageGenerationPerfMetrics::get_generate_duration() {
     return generate_duration;
 }
@@ -13,12 +13,20 @@
 #include "image_generation/stable_diffusion_3_pipeline.hpp"
 #include "image_generation/flux_pipeline.hpp"
 #include "image_generation/flux_fill_pipeline.hpp"
+#include "image_generation/mask_crop.hpp"
 
 #include "utils.hpp"
 
 namespace ov {
 namespace genai {
 
+namespace {
+
+// the crop sizes are divisible by VAE scale factor and the patch sizes of all the supported models
+constexpr size_t MASK_CROP_ALIGNMENT = 64;
+
+}  // namespace
+
 InpaintingPipeline::InpaintingPipeline(const std::filesystem::path& root_dir) {
     const std::string class_name = get_class_name(root_dir);
 
@@ -215,7 +223,39 @@ void InpaintingPipeline::compile(const std::string& text_encode_device,
 ov::Tensor InpaintingPipeline::generate(const std::string& positive_prompt, ov::Tensor initial_image, ov::Tensor mask, const ov::AnyMap& properties) {
     OPENVINO_ASSERT(initial_image, "Initial image cannot be empty when passed to InpaintingPipeline::generate");
     OPENVINO_ASSERT(mask, "Mask image cannot be empty when passed to InpaintingPipeline::generate");
-    return m_impl->generate(positive_prompt, initial_image, mask, properties);
+
+    ImageGenerationConfig generation_config = m_impl->get_generation_config();
+    generation_config.update_generation_config(properties);
+    if (generation_config.mask_crop_padding < 0) {
+        return m_impl->generate(positive_prompt, initial_image, mask, properties);
+    }
+
+    const ov::Shape& image_shape = initial_image.get_shape();
+    const ov::Shape& mask_shape = mask.get_shape();
+    OPENVINO_ASSERT(image_shape.size() == 4 && image_shape[0] == 1 && mask_shape.size() == 4 &&
+                    mask_shape[1] == image_shape[1] && mask_shape[2] == image_shape[2],
+                    "Mask cropping requires the mask of the initial image size, got image of ", image_shape,
+                    " and mask of ", mask_shape, " shapes");
+    OPENVINO_ASSERT((generation_config.height < 0 || generation_config.height == static_cast<int64_t>(image_shape[1])) &&
+                    (generation_config.width < 0 || generation_config.width == static_cast<int64_t>(image_shape[2])),
+                    "Mask cropping inpaints at the initial image resolution, 'height' and 'width' must match it");
+
+    const size_t padding = static_cast<size_t>(generation_config.mask_crop_padding);
+    std::optional<MaskCrop> crop = compute_mask_crop(mask, padding, MASK_CROP_ALIGNMENT);
+    if (!crop) {
+        return m_impl->generate(positive_prompt, initial_image, mask, properties);
+    }
+
+    ov::Tensor cropped_mask = crop_image(mask, *crop);
+    ov::AnyMap crop_properties = properties;
+    crop_properties[ov::genai::height.name()] = static_cast<int64_t>(crop->height);
+    crop_properties[ov::genai::width.name()] = static_cast<int64_t>(crop->width);
+    ov::Tensor inpainted = m_impl->generate(positive_prompt, crop_image(initial_image, *crop), cropped_mask, crop_properties);
+    if (inpainted.get_size() == 0) {
+        // cancelled by the callback
+        return inpainted;
+    }
+    return paste_mask_crop(initial_image, inpainted, cropped_mask, *crop, padding / 2);
 }
 
 ov::Tensor InpaintingPipeline::decode(const ov::Tensor latent) {
@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/latent_preview.hpp"
+
+#include <chrono>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+LatentPreviewDecoder::LatentPreviewDecoder(std::shared_ptr<AutoencoderKL> vae, Callback callback)
+    : m_vae(std::move(vae)), m_callback(std::move(callback)) {
+    OPENVINO_ASSERT(m_vae != nullptr, "Preview decoder requires a VAE");
+    OPENVINO_ASSERT(m_callback, "Preview decoder requires a callback");
+}
+
+LatentPreviewDecoder::~LatentPreviewDecoder() {
+    if (m_preview.valid()) {
+        m_preview.wait();
+    }
+}
+
+bool LatentPreviewDecoder::is_busy() const {
+    return m_preview.valid() && m_preview.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+void LatentPreviewDecoder::submit(size_t inference_step, size_t num_inference_steps, const ov::Tensor& latent) {
+    if (is_busy()) {
+        return;
+    }
+    if (m_preview.valid()) {
+        deliver();
+    }
+
+    // the denoising loop may overwrite the latent, while it's being decoded
+    ov::Tensor latent_copy(latent.get_element_type(), latent.get_shape());
+    latent.copy_to(latent_copy);
+
+    m_inference_step = inference_step;
+    m_num_inference_steps = num_inference_steps;
+    m_preview = std::async(std::launch::async, [vae = m_vae, latent_copy] {
+        return vae->decode(latent_copy);
+    });
+}
+
+void LatentPreviewDecoder::finish() {
+    if (m_preview.valid()) {
+        deliver();
+    }
+}
+
+void LatentPreviewDecoder::deliver() {
+    ov::Tensor preview = m_preview.get();
+    m_callback(m_inference_step, m_num_inference_steps, preview);
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "openvino/genai/image_generation/autoencoder_kl.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Decodes the previews of the intermediate latents by a tiny autoencoder (e.g. TAESD) in background, so the denoising
+ * loop is not stalled by them. The latents which are submitted while the previous preview is still being decoded are
+ * skipped. The decoded previews are passed to the callback on the thread submitting the latents, i.e. the decoding
+ * thread never calls the user code.
+ */
+class LatentPreviewDecoder {
+public:
+    using Callback = std::function<void(size_t, size_t, ov::Tensor&)>;
+
+    LatentPreviewDecoder(std::shared_ptr<AutoencoderKL> vae, Callback callback);
+
+    // the pending preview is waited for, but it's not passed to the callback
+    ~LatentPreviewDecoder();
+
+    /**
+     * Passes the decoded preview to the callback if it's ready and starts decoding of the copy of `latent`,
+     * unless the previous preview is still being decoded.
+     */
+    void submit(size_t inference_step, size_t num_inference_steps, const ov::Tensor& latent);
+
+    // waits for the pending preview and passes it to the callback
+    void finish();
+
+    // whether the previous preview is still being decoded, so that the latent of the current step would be skipped
+    bool is_busy() const;
+
+private:
+    void deliver();
+
+    std::shared_ptr<AutoencoderKL> m_vae;
+    Callback m_callback;
+    std::future<ov::Tensor> m_preview;
+    size_t m_inference_step = 0, m_num_inference_steps = 0;
+};
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,159 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/mask_crop.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+// grows [begin, end) around its center to the multiple of 'alignment', which fits [0, size)
+void align_range(size_t& begin, size_t& end, size_t size, size_t alignment) {
+    const size_t length = end - begin;
+    const size_t aligned_length = std::min((length + alignment - 1) / alignment * alignment, size);
+    begin = std::min(begin - std::min(begin, (aligned_length - length) / 2), size - aligned_length);
+    end = begin + aligned_length;
+}
+
+// sums of the values within [i - radius, i + radius] window, the values out of the range are zeros
+std::vector<float> box_sums(const std::vector<float>& values, size_t radius) {
+    std::vector<float> prefix_sums(values.size() + 1, 0.0f);
+    for (size_t i = 0; i < values.size(); ++i) {
+        prefix_sums[i + 1] = prefix_sums[i] + values[i];
+    }
+    std::vector<float> sums(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        sums[i] = prefix_sums[std::min(i + radius + 1, values.size())] - prefix_sums[i - std::min(i, radius)];
+    }
+    return sums;
+}
+
+bool is_masked(const uint8_t* pixel, size_t channels) {
+    return std::any_of(pixel, pixel + channels, [](uint8_t value) {
+        return value >= 128;
+    });
+}
+
+}  // namespace
+
+std::optional<MaskCrop> compute_mask_crop(const ov::Tensor& mask, size_t padding, size_t alignment) {
+    const ov::Shape& shape = mask.get_shape();
+    OPENVINO_ASSERT(shape.size() == 4 && shape[0] == 1, "Mask must have [1, height, width, channels] shape, got ", shape);
+    OPENVINO_ASSERT(mask.get_element_type() == ov::element::u8, "Mask must be u8 tensor");
+    OPENVINO_ASSERT(alignment > 0, "Crop alignment must be positive");
+    const size_t height = shape[1], width = shape[2], channels = shape[3];
+
+    size_t top = height, bottom = 0, left = width, right = 0;
+    const uint8_t* mask_data = mask.data<const uint8_t>();
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            if (is_masked(mask_data + (y * width + x) * channels, channels)) {
+                top = std::min(top, y);
+                bottom = std::max(bottom, y + 1);
+                left = std::min(left, x);
+                right = std::max(right, x + 1);
+            }
+        }
+    }
+    if (top >= bottom) {
+        return std::nullopt;
+    }
+
+    top -= std::min(top, padding);
+    left -= std::min(left, padding);
+    bottom = std::min(bottom + padding, height);
+    right = std::min(right + padding, width);
+    align_range(top, bottom, height, alignment);
+    align_range(left, right, width, alignment);
+    return MaskCrop{top, left, bottom - top, right - left};
+}
+
+ov::Tensor crop_image(const ov::Tensor& image, const MaskCrop& crop) {
+    const ov::Shape& shape = image.get_shape();
+    OPENVINO_ASSERT(shape.size() == 4 && crop.top + crop.height <= shape[1] && crop.left + crop.width <= shape[2],
+                    "Crop is out of the image of ", shape, " shape");
+    const size_t width = shape[2], channels = shape[3];
+
+    ov::Tensor cropped(image.get_element_type(), {shape[0], crop.height, crop.width, channels});
+    const size_t pixel_size = image.get_element_type().size() * channels;
+    const uint8_t* image_data = static_cast<const uint8_t*>(image.data());
+    uint8_t* cropped_data = static_cast<uint8_t*>(cropped.data());
+    for (size_t n = 0; n < shape[0]; ++n) {
+        for (size_t y = 0; y < crop.height; ++y) {
+            const size_t image_row = (n * shape[1] + crop.top + y) * width + crop.left;
+            const size_t cropped_row = (n * crop.height + y) * crop.width;
+            std::memcpy(cropped_data + cropped_row * pixel_size, image_data + image_row * pixel_size, crop.width * pixel_size);
+        }
+    }
+    return cropped;
+}
+
+ov::Tensor paste_mask_crop(const ov::Tensor& image, const ov::Tensor& inpainted, const ov::Tensor& cropped_mask,
+                           const MaskCrop& crop, size_t feather) {
+    const ov::Shape& image_shape = image.get_shape();
+    const ov::Shape& inpainted_shape = inpainted.get_shape();
+    const ov::Shape& mask_shape = cropped_mask.get_shape();
+    OPENVINO_ASSERT(image_shape.size() == 4 && image_shape[0] == 1, "Image must have [1, height, width, 3] shape, got ", image_shape);
+    OPENVINO_ASSERT(inpainted_shape == ov::Shape({inpainted_shape[0], crop.height, crop.width, image_shape[3]}),
+                    "Inpainted images of ", inpainted_shape, " shape don't match the crop");
+    OPENVINO_ASSERT(mask_shape.size() == 4 && mask_shape[1] == crop.height && mask_shape[2] == crop.width,
+                    "Cropped mask of ", mask_shape, " shape doesn't match the crop");
+    const size_t height = image_shape[1], width = image_shape[2], channels = image_shape[3];
+    const size_t num_images = inpainted_shape[0];
+
+    // the weights of the inpainted pixels: the mask is blurred by separable box filter
+    const uint8_t* mask_data = cropped_mask.data<const uint8_t>();
+    std::vector<float> weights(crop.height * crop.width);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = is_masked(mask_data + i * mask_shape[3], mask_shape[3]) ? 1.0f : 0.0f;
+    }
+    if (feather > 0) {
+        std::vector<float> line;
+        for (size_t y = 0; y < crop.height; ++y) {
+            line.assign(weights.begin() + y * crop.width, weights.begin() + (y + 1) * crop.width);
+            std::copy_n(box_sums(line, feather).begin(), crop.width, weights.begin() + y * crop.width);
+        }
+        const float window_area = static_cast<float>((2 * feather + 1) * (2 * feather + 1));
+        for (size_t x = 0; x < crop.width; ++x) {
+            line.resize(crop.height);
+            for (size_t y = 0; y < crop.height; ++y) {
+                line[y] = weights[y * crop.width + x];
+            }
+            const std::vector<float> sums = box_sums(line, feather);
+            for (size_t y = 0; y < crop.height; ++y) {
+                weights[y * crop.width + x] = sums[y] / window_area;
+            }
+        }
+    }
+
+    ov::Tensor result(ov::element::u8, {num_images, height, width, channels});
+    const uint8_t* image_data = image.data<const uint8_t>();
+    const uint8_t* inpainted_data = inpainted.data<const uint8_t>();
+    uint8_t* result_data = result.data<uint8_t>();
+    for (size_t n = 0; n < num_images; ++n) {
+        std::memcpy(result_data + n * image.get_byte_size(), image_data, image.get_byte_size());
+        for (size_t y = 0; y < crop.height; ++y) {
+            for (size_t x = 0; x < crop.width; ++x) {
+                const float weight = weights[y * crop.width + x];
+                const uint8_t* inpainted_pixel = inpainted_data + ((n * crop.height + y) * crop.width + x) * channels;
+                uint8_t* result_pixel = result_data + ((n * height + crop.top + y) * width + crop.left + x) * channels;
+                for (size_t c = 0; c < channels; ++c) {
+                    const float value = result_pixel[c] * (1.0f - weight) + inpainted_pixel[c] * weight;
+                    result_pixel[c] = static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 255.0f)));
+                }
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,37 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <optional>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+
+// region of the image, which is inpainted instead of the whole image
+struct MaskCrop {
+    size_t top = 0, left = 0, height = 0, width = 0;
+};
+
+/**
+ * Computes the bounding box of the masked pixels (>= 128 in any channel) of u8 NHWC mask, padded by 'padding' pixels
+ * and grown to the multiples of 'alignment' within the image.
+ * @return std::nullopt, if nothing is masked
+ */
+std::optional<MaskCrop> compute_mask_crop(const ov::Tensor& mask, size_t padding, size_t alignment);
+
+// copies the region of u8 NHWC image
+ov::Tensor crop_image(const ov::Tensor& image, const MaskCrop& crop);
+
+/**
+ * Pastes the inpainted regions of [num_images, crop.height, crop.width, 3] shape to the copies of [1, height, width, 3]
+ * image. The pixels are blended with the weights of the cropped mask blurred by the box filter of 'feather' radius,
+ * so that the seams around the mask are smooth.
+ */
+ov::Tensor paste_mask_crop(const ov::Tensor& image, const ov::Tensor& inpainted, const ov::Tensor& cropped_mask,
+                           const MaskCrop& crop, size_t feather);
+
+}  // namespace genai
+}  // namespace ov
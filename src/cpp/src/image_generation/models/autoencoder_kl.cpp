@@ -3,10 +3,14 @@
 
 #include "openvino/genai/image_generation/autoencoder_kl.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <fstream>
 #include <memory>
 
 #include "openvino/runtime/core.hpp"
+#include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/op/clamp.hpp"
 #include "openvino/op/add.hpp"
@@ -85,6 +89,188 @@ ov::AnyMap handle_scale_factor(std::shared_ptr<ov::Model> model, const std::stri
     return properties;
 }
 
+// the tiles overlap by a quarter of their size to hide the seams
+constexpr size_t tile_overlap_denominator = 4;
+// default tile size, when it cannot be selected from the device memory
+constexpr size_t default_tile_sample_size = 512;
+// maximum number of the tiles, which are inferred in parallel
+constexpr size_t max_parallel_tiles = 4;
+
+// splits 'size' into tiles of 'tile_size' overlapped by 'overlap' at least, the last tile is aligned to the end
+std::vector<size_t> get_tile_offsets(size_t size, size_t tile_size, size_t overlap) {
+    if (size <= tile_size) {
+        return {0};
+    }
+
+    std::vector<size_t> offsets;
+    for (size_t offset = 0; offset + tile_size < size; offset += tile_size - overlap) {
+        offsets.push_back(offset);
+    }
+    offsets.push_back(size - tile_size);
+    return offsets;
+}
+
+// linear blending weights of a tile, which ramp up over the overlap with the neighbour tiles
+std::vector<float> get_tile_weights(size_t offset, size_t tile_size, size_t size, size_t overlap) {
+    std::vector<float> weights(tile_size, 1.0f);
+    for (size_t i = 0; i < tile_size; ++i) {
+        if (offset > 0) {
+            weights[i] = std::min(weights[i], static_cast<float>(i + 1) / (overlap + 1));
+        }
+        if (offset + tile_size < size) {
+            weights[i] = std::min(weights[i], static_cast<float>(tile_size - i) / (overlap + 1));
+        }
+    }
+    return weights;
+}
+
+struct Tile {
+    size_t y = 0, x = 0;
+};
+
+// strides of NCHW or NHWC tensor in elements: batch, channels, height, width
+std::array<size_t, 4> get_strides(const ov::Shape& shape, bool nhwc) {
+    if (nhwc) {
+        return {shape[1] * shape[2] * shape[3], 1, shape[2] * shape[3], shape[3]};
+    }
+    return {shape[1] * shape[2] * shape[3], shape[2] * shape[3], shape[3], 1};
+}
+
+/**
+ * Infers the model by overlapping spatial tiles of NCHW f32 input and blends the tile outputs. The output spatial size is
+ * 'scale_num / scale_den' of the input size, the output is NCHW or NHWC tensor of f32 or u8 precision.
+ */
+ov::Tensor infer_tiled(std::vector<ov::InferRequest>& requests, ov::Tensor input, size_t tile_size, size_t scale_num, size_t scale_den) {
+    const ov::Shape input_shape = input.get_shape();
+    const size_t batch_size = input_shape[0], channels = input_shape[1], height = input_shape[2], width = input_shape[3];
+    // the tile offsets must be divisible by the downscale factor to map them to the output
+    const size_t overlap = tile_size / tile_overlap_denominator / scale_den * scale_den;
+    const size_t tile_height = std::min(tile_size, height), tile_width = std::min(tile_size, width);
+
+    std::vector<Tile> tiles;
+    for (size_t y : get_tile_offsets(height, tile_height, overlap)) {
+        for (size_t x : get_tile_offsets(width, tile_width, overlap)) {
+            tiles.push_back({y, x});
+        }
+    }
+
+    ov::Tensor output, weights_sum;
+    std::vector<float> output_sum;
+    bool nhwc = false;
+    size_t out_height = 0, out_width = 0, out_channels = 0;
+
+    for (size_t begin = 0; begin < tiles.size(); begin += requests.size()) {
+        const size_t end = std::min(tiles.size(), begin + requests.size());
+        for (size_t i = begin; i < end; ++i) {
+            ov::Tensor tile_input(ov::element::f32, {batch_size, channels, tile_height, tile_width});
+            const float* input_data = input.data<const float>();
+            float* tile_data = tile_input.data<float>();
+            for (size_t b = 0; b < batch_size; ++b) {
+                for (size_t c = 0; c < channels; ++c) {
+                    for (size_t y = 0; y < tile_height; ++y) {
+                        const float* row = input_data + ((b * channels + c) * height + tiles[i].y + y) * width + tiles[i].x;
+                        std::copy_n(row, tile_width, tile_data + ((b * channels + c) * tile_height + y) * tile_width);
+                    }
+                }
+            }
+            requests[i - begin].set_input_tensor(tile_input);
+            requests[i - begin].start_async();
+        }
+
+        for (size_t i = begin; i < end; ++i) {
+            ov::InferRequest& request = requests[i - begin];
+            request.wait();
+            const ov::Tensor tile_output = request.get_output_tensor();
+            const ov::Shape tile_output_shape = tile_output.get_shape();
+
+            if (!output) {
+                // the last dimension of the output is channels, if it's NHWC image
+                nhwc = tile_output.get_element_type() == ov::element::u8;
+                out_channels = nhwc ? tile_output_shape[3] : tile_output_shape[1];
+                out_height = height * scale_num / scale_den;
+                out_width = width * scale_num / scale_den;
+                output = nhwc ? ov::Tensor(ov::element::u8, {batch_size, out_height, out_width, out_channels})
+                              : ov::Tensor(ov::element::f32, {batch_size, out_channels, out_height, out_width});
+                output_sum.assign(output.get_size(), 0.0f);
+                weights_sum = ov::Tensor(ov::element::f32, {out_height * out_width});
+                std::fill_n(weights_sum.data<float>(), out_height * out_width, 0.0f);
+            }
+
+            const size_t out_tile_height = tile_height * scale_num / scale_den, out_tile_width = tile_width * scale_num / scale_den;
+            const size_t out_y = tiles[i].y * scale_num / scale_den, out_x = tiles[i].x * scale_num / scale_den;
+            const std::vector<float> weights_y = get_tile_weights(out_y, out_tile_height, out_height, overlap * scale_num / scale_den);
+            const std::vector<float> weights_x = get_tile_weights(out_x, out_tile_width, out_width, overlap * scale_num / scale_den);
+
+            const auto tile_strides = get_strides(tile_output_shape, nhwc);
+            const auto output_strides = get_strides(output.get_shape(), nhwc);
+            float* weights_sum_data = weights_sum.data<float>();
+
+            for (size_t y = 0; y < out_tile_height; ++y) {
+                for (size_t x = 0; x < out_tile_width; ++x) {
+                    const float weight = weights_y[y] * weights_x[x];
+                    weights_sum_data[(out_y + y) * out_width + out_x + x] += weight;
+                    for (size_t b = 0; b < batch_size; ++b) {
+                        for (size_t c = 0; c < out_channels; ++c) {
+                            const size_t tile_index = b * tile_strides[0] + c * tile_strides[1] + y * tile_strides[2] + x * tile_strides[3];
+                            const size_t output_index = b * output_strides[0] + c * output_strides[1] +
+                                                        (out_y + y) * output_strides[2] + (out_x + x) * output_strides[3];
+                            const float value = nhwc ? static_cast<float>(tile_output.data<const uint8_t>()[tile_index])
+                                                     : tile_output.data<const float>()[tile_index];
+                            output_sum[output_index] += weight * value;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    const auto output_strides = get_strides(output.get_shape(), nhwc);
+    const float* weights_sum_data = weights_sum.data<const float>();
+    for (size_t b = 0; b < batch_size; ++b) {
+        for (size_t c = 0; c < out_channels; ++c) {
+            for (size_t y = 0; y < out_height; ++y) {
+                for (size_t x = 0; x < out_width; ++x) {
+                    const size_t index = b * output_strides[0] + c * output_strides[1] + y * output_strides[2] + x * output_strides[3];
+                    const float value = output_sum[index] / weights_sum_data[y * out_width + x];
+                    if (nhwc) {
+                        output.data<uint8_t>()[index] = static_cast<uint8_t>(std::clamp(std::round(value), 0.0f, 255.0f));
+                    } else {
+                        output.data<float>()[index] = value;
+                    }
+                }
+            }
+        }
+    }
+
+    return output;
+}
+
+// the model can be inferred by tiles, if its spatial dimensions are dynamic
+bool has_dynamic_spatial_dims(const ov::InferRequest& request) {
+    const ov::PartialShape input_shape = request.get_compiled_model().input().get_partial_shape();
+    return input_shape.rank().is_static() && input_shape.rank().get_length() == 4 &&
+           input_shape[2].is_dynamic() && input_shape[3].is_dynamic();
+}
+
+// creates the infer requests for parallel tiles, 'request' is the first one
+std::vector<ov::InferRequest>& get_tile_requests(ov::InferRequest& request, std::vector<ov::InferRequest>& tile_requests) {
+    if (tile_requests.empty()) {
+        ov::CompiledModel compiled_model = request.get_compiled_model();
+        size_t num_requests = 1;
+        try {
+            num_requests = compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        } catch (const ov::Exception&) {
+            // the property is not supported by the device
+        }
+
+        tile_requests.push_back(request);
+        for (size_t i = 1; i < std::min(num_requests, max_parallel_tiles); ++i) {
+            tile_requests.push_back(compiled_model.create_infer_request());
+        }
+    }
+    return tile_requests;
+}
+
 } // namespace
 
 size_t get_vae_scale_factor(const std::filesystem::path& vae_config_path) {
@@ -188,6 +374,8 @@ AutoencoderKL AutoencoderKL::clone() {
     OPENVINO_ASSERT((m_decoder_model != nullptr) ^ static_cast<bool>(m_decoder_request), "AutoencoderKL must have exactly one of m_decoder_model or m_decoder_request initialized");  // encoder is optional
 
     AutoencoderKL cloned = *this;
+    cloned.m_encoder_tile_requests.clear();
+    cloned.m_decoder_tile_requests.clear();
 
     // Required, decoder model
     if (m_decoder_model) {
@@ -258,9 +446,51 @@ AutoencoderKL& AutoencoderKL::compile(const std::string& device, const ov::AnyMa
     return *this;
 }
 
+AutoencoderKL& AutoencoderKL::enable_tiling(size_t tile_sample_size) {
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    OPENVINO_ASSERT(tile_sample_size % vae_scale_factor == 0, "Tile size must be divisible by ", vae_scale_factor);
+    m_tiling = true;
+    m_tile_sample_size = tile_sample_size;
+    return *this;
+}
+
+AutoencoderKL& AutoencoderKL::disable_tiling() {
+    m_tiling = false;
+    return *this;
+}
+
+size_t AutoencoderKL::get_tile_sample_size() {
+    if (m_tile_sample_size > 0) {
+        return m_tile_sample_size;
+    }
+
+    m_tile_sample_size = default_tile_sample_size;
+    const std::vector<std::string> devices = m_decoder_request.get_compiled_model().get_property(ov::execution_devices);
+    if (devices.size() == 1 && devices[0].find("GPU") != std::string::npos) {
+        // the peak memory of VAE decoder is dominated by the activations of the last up block at the image resolution,
+        // the tiles inferred in parallel share a half of the device memory
+        const size_t total_device_memory = utils::singleton_core().get_property(devices[0], ov::intel_gpu::device_total_mem_size);
+        const size_t num_parallel_tiles = get_tile_requests(m_decoder_request, m_decoder_tile_requests).size();
+        const size_t bytes_per_pixel = m_config.block_out_channels.front() * sizeof(float) * 8;
+        const size_t tile_pixels = total_device_memory / 2 / num_parallel_tiles / bytes_per_pixel;
+
+        const size_t tile_alignment = get_vae_scale_factor() * 8;
+        m_tile_sample_size = std::max(tile_alignment, static_cast<size_t>(std::sqrt(tile_pixels)) / tile_alignment * tile_alignment);
+    }
+    return m_tile_sample_size;
+}
+
 ov::Tensor AutoencoderKL::decode(ov::Tensor latent) {
     OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
 
+    if (m_tiling && has_dynamic_spatial_dims(m_decoder_request)) {
+        const size_t tile_latent_size = get_tile_sample_size() / get_vae_scale_factor();
+        const ov::Shape latent_shape = latent.get_shape();
+        if (latent_shape[2] > tile_latent_size || latent_shape[3] > tile_latent_size) {
+            return infer_tiled(get_tile_requests(m_decoder_request, m_decoder_tile_requests), latent, tile_latent_size, get_vae_scale_factor(), 1);
+        }
+    }
+
     m_decoder_request.set_input_tensor(latent);
     m_decoder_request.infer();
     return m_decoder_request.get_output_tensor();
@@ -270,10 +500,17 @@ ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> ge
     OPENVINO_ASSERT(m_encoder_request || m_encoder_model, "AutoencoderKL is created without 'VAE encoder' capability. Please, pass extra argument to constructor to create 'VAE encoder'");
     OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
 
-    m_encoder_request.set_input_tensor(image);
-    m_encoder_request.infer();
-
-    ov::Tensor output = m_encoder_request.get_output_tensor(), latent;
+    ov::Tensor output, latent;
+    const ov::Shape image_shape = image.get_shape();
+    if (m_tiling && has_dynamic_spatial_dims(m_encoder_request) &&
+        (image_shape[2] > get_tile_sample_size() || image_shape[3] > get_tile_sample_size())) {
+        // the distribution parameters are blended, so the latent is sampled once for the whole image
+        output = infer_tiled(get_tile_requests(m_encoder_request, m_encoder_tile_requests), image, get_tile_sample_size(), 1, get_vae_scale_factor());
+    } else {
+        m_encoder_request.set_input_tensor(image);
+        m_encoder_request.infer();
+        output = m_encoder_request.get_output_tensor();
+    }
 
     ov::CompiledModel compiled_model = m_encoder_request.get_compiled_model();
     auto outputs = compiled_model.outputs();
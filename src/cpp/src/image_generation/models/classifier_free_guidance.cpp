@@ -0,0 +1,134 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/models/classifier_free_guidance.hpp"
+
+#include <limits>
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert_like.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/tile.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+bool has_input(const std::shared_ptr<ov::Model>& model, const std::string& input_name) {
+    for (const auto& input : model->inputs()) {
+        if (input.get_names().count(input_name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+bool can_fuse_classifier_free_guidance(const std::shared_ptr<ov::Model>& model, const std::string& latent_input_name) {
+    if (!has_input(model, latent_input_name) || !has_input(model, "encoder_hidden_states") ||
+        has_input(model, guidance_scale_input_name) || model->get_results().size() != 1) {
+        return false;
+    }
+
+    const ov::PartialShape& latent_shape = model->input(latent_input_name).get_partial_shape();
+    return latent_shape.rank().is_static() && latent_shape.size() > 0 && latent_shape[0].is_dynamic();
+}
+
+void fuse_classifier_free_guidance(const std::shared_ptr<ov::Model>& model, const std::string& latent_input_name) {
+    OPENVINO_ASSERT(can_fuse_classifier_free_guidance(model, latent_input_name),
+                    "Classifier-free guidance cannot be fused into the model with '", latent_input_name, "' input");
+
+    using namespace ov::op;
+
+    const auto latent = model->input(latent_input_name);
+    const auto encoder_hidden_states = model->input("encoder_hidden_states");
+    const auto latent_consumers = latent.get_node()->output(0).get_target_inputs();
+
+    auto zero = v0::Constant::create(ov::element::i64, ov::Shape{1}, {0});
+    auto one = v0::Constant::create(ov::element::i64, ov::Shape{1}, {1});
+    auto axis = v0::Constant::create(ov::element::i64, ov::Shape{}, {0});
+
+    // the number of the hidden states batches: 2 with guidance, 1 when the latents are already repeated
+    auto latent_batch = std::make_shared<v8::Gather>(std::make_shared<v3::ShapeOf>(latent), zero, axis);
+    auto hidden_states_batch =
+        std::make_shared<v8::Gather>(std::make_shared<v3::ShapeOf>(encoder_hidden_states), zero, axis);
+    auto num_batches = std::make_shared<v1::Divide>(hidden_states_batch, latent_batch);
+
+    // repeat the latents for each batch of the hidden states
+    const size_t latent_rank = latent.get_partial_shape().size();
+    auto repeats = std::make_shared<v0::Concat>(
+        ov::OutputVector{num_batches,
+                         v0::Constant::create(ov::element::i64,
+                                              ov::Shape{latent_rank - 1},
+                                              std::vector<int64_t>(latent_rank - 1, 1))},
+        0);
+    auto repeated_latent = std::make_shared<v0::Tile>(latent, repeats);
+    for (auto& consumer : latent_consumers) {
+        consumer.replace_source_output(repeated_latent);
+    }
+
+    // split the noise prediction to [num_batches, latent_batch, ...] and combine the first and the last batches
+    const auto result = model->get_results().at(0);
+    const auto noise_pred = result->input_value(0);
+    auto noise_pred_dims = std::make_shared<v8::Slice>(
+        std::make_shared<v3::ShapeOf>(noise_pred),
+        one,
+        v0::Constant::create(ov::element::i64, ov::Shape{1}, {std::numeric_limits<int64_t>::max()}),
+        one);
+    auto split_shape = std::make_shared<v0::Concat>(ov::OutputVector{num_batches, latent_batch, noise_pred_dims}, 0);
+    auto split_noise_pred = std::make_shared<v1::Reshape>(noise_pred, split_shape, false);
+
+    auto last_batch = std::make_shared<v0::Squeeze>(std::make_shared<v1::Subtract>(num_batches, one));
+    auto noise_pred_uncond = std::make_shared<v8::Gather>(split_noise_pred, axis, axis);
+    auto noise_pred_text = std::make_shared<v8::Gather>(split_noise_pred, last_batch, axis);
+
+    auto guidance_scale = std::make_shared<v0::Parameter>(ov::element::f32, ov::Shape{});
+    guidance_scale->set_friendly_name(guidance_scale_input_name);
+    guidance_scale->output(0).get_tensor().set_names({guidance_scale_input_name});
+
+    auto guided_noise_pred = std::make_shared<v1::Add>(
+        noise_pred_uncond,
+        std::make_shared<v1::Multiply>(std::make_shared<v1::ConvertLike>(guidance_scale, noise_pred),
+                                       std::make_shared<v1::Subtract>(noise_pred_text, noise_pred_uncond)));
+
+    // the output keeps its name
+    guided_noise_pred->output(0).get_tensor().set_names(noise_pred.get_names());
+    noise_pred.get_tensor().set_names({});
+    result->input(0).replace_source_output(guided_noise_pred);
+
+    model->add_parameters({guidance_scale});
+    model->validate_nodes_and_infer_types();
+}
+
+ov::Tensor apply_classifier_free_guidance(const ov::Tensor& noise_pred, const float guidance_scale) {
+    ov::Shape guided_shape = noise_pred.get_shape();
+    OPENVINO_ASSERT(guided_shape.at(0) % 2 == 0, "Noise prediction must hold unconditional and text batches");
+    guided_shape[0] /= 2;
+
+    ov::Tensor guided_noise_pred(ov::element::f32, guided_shape);
+    float* guided = guided_noise_pred.data<float>();
+    const float* noise_pred_uncond = noise_pred.data<const float>();
+    const float* noise_pred_text = noise_pred_uncond + guided_noise_pred.get_size();
+
+    for (size_t i = 0; i < guided_noise_pred.get_size(); ++i) {
+        guided[i] = noise_pred_uncond[i] + guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
+    }
+
+    return guided_noise_pred;
+}
+
+}  // namespace genai
+}  // namespace ov
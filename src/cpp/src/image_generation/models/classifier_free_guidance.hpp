@@ -0,0 +1,44 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+
+// name of the input, which is added by 'fuse_classifier_free_guidance'
+inline const std::string guidance_scale_input_name = "guidance_scale";
+
+/**
+ * Checks that classifier-free guidance can be fused into the denoising model: the batch of the latent input must be
+ * dynamic, because the fused model takes the latents not repeated for the unconditional and text hidden states.
+ */
+bool can_fuse_classifier_free_guidance(const std::shared_ptr<ov::Model>& model, const std::string& latent_input_name);
+
+/**
+ * Appends classifier-free guidance to a denoising model (UNet or transformer):
+ * - the latent input is repeated inside the model up to the batch of 'encoder_hidden_states', which holds the
+ *   unconditional hidden states followed by the text ones
+ * - the noise prediction is combined as 'uncond + guidance_scale * (text - uncond)', the scale is a new scalar
+ *   'guidance_scale' input
+ * If the latent input already has the batch of 'encoder_hidden_states', the fused model returns the raw noise prediction,
+ * so it is still inferred as the original one.
+ */
+void fuse_classifier_free_guidance(const std::shared_ptr<ov::Model>& model, const std::string& latent_input_name);
+
+/**
+ * Applies classifier-free guidance on host for the models, which are not fused
+ * @param noise_pred raw noise prediction of the unconditional and text batches
+ * @param guidance_scale guidance scale
+ * @returns guided noise prediction of a half of the batch
+ */
+ov::Tensor apply_classifier_free_guidance(const ov::Tensor& noise_pred, const float guidance_scale);
+
+}  // namespace genai
+}  // namespace ov
@@ -10,6 +10,7 @@
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
 #include "utils.hpp"
+#include "image_generation/models/text_encoder_cache.hpp"
 
 namespace ov {
 namespace genai {
@@ -110,6 +111,7 @@ CLIPTextModel& CLIPTextModel::compile(const std::string& device, const ov::AnyMa
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(m_model, device, *filtered_properties);
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Clip Text model");
     m_request = compiled_model.create_infer_request();
+    m_cache_model_id = TextEncoderCache::generate_model_id();
     // release the original model
     m_model.reset();
 
@@ -119,6 +121,8 @@ CLIPTextModel& CLIPTextModel::compile(const std::string& device, const ov::AnyMa
 void CLIPTextModel::set_adapters(const std::optional<AdapterConfig>& adapters) {
     if (adapters) {
         m_adapter_controller.apply(m_request, *adapters);
+        // the cache is keyed by the input only, so it's not used for the text encoder with LoRA adapters
+        m_adapters_applied = !adapters->get_adapters().empty();
     }
 }
 
@@ -173,7 +177,17 @@ ov::Tensor CLIPTextModel::infer(const std::string& pos_prompt, const std::string
                                                {current_batch_idx + 1, m_config.max_position_embeddings}));
 
     // text embeddings
-    m_request.infer();
+    m_cached_outputs.clear();
+    if (m_adapters_applied || !TextEncoderCache::get_instance().get(m_cache_model_id, input_ids, m_cached_outputs)) {
+        m_request.infer();
+        if (!m_adapters_applied) {
+            std::vector<ov::Tensor> outputs;
+            for (size_t i = 0; i < m_request.get_compiled_model().outputs().size(); ++i) {
+                outputs.push_back(m_request.get_output_tensor(i));
+            }
+            TextEncoderCache::get_instance().put(m_cache_model_id, input_ids, outputs);
+        }
+    }
 
     // This is true when text_embedding_batch_size is 1, but model was reshaped / compiled as batch size 2.
     m_slice_batch1_output = (text_embedding_batch_size != input_ids.get_shape()[0]);
@@ -182,7 +196,7 @@ ov::Tensor CLIPTextModel::infer(const std::string& pos_prompt, const std::string
 }
 
 ov::Tensor CLIPTextModel::get_output_tensor(const size_t idx) {
-    auto infer_out_tensor = m_request.get_output_tensor(idx);
+    auto infer_out_tensor = m_cached_outputs.empty() ? m_request.get_output_tensor(idx) : m_cached_outputs.at(idx);
     if (m_slice_batch1_output) {
         //Slice and return batch index 1 output.
         auto out_shape = infer_out_tensor.get_shape();
@@ -0,0 +1,127 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/models/feature_reuse.hpp"
+
+#include <cctype>
+#include <unordered_set>
+
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+const std::string up_blocks_prefix = "up_blocks.";
+
+// returns the index of the up block, which the node belongs to, or -1
+int get_up_block_index(const std::string& friendly_name) {
+    const size_t pos = friendly_name.find(up_blocks_prefix);
+    if (pos == std::string::npos) {
+        return -1;
+    }
+
+    int index = -1;
+    for (size_t i = pos + up_blocks_prefix.size(); i < friendly_name.size() && std::isdigit(friendly_name[i]); ++i) {
+        index = (index < 0 ? 0 : index * 10) + (friendly_name[i] - '0');
+    }
+    return index;
+}
+
+// finds the last node of the upsampler of the second last up block, its output is consumed by the last up block
+std::shared_ptr<ov::Node> find_deep_features(const std::shared_ptr<ov::Model>& model) {
+    int num_up_blocks = 0;
+    for (const auto& node : model->get_ops()) {
+        num_up_blocks = std::max(num_up_blocks, get_up_block_index(node->get_friendly_name()) + 1);
+    }
+    if (num_up_blocks < 2) {
+        return nullptr;
+    }
+
+    const std::string upsampler_prefix = up_blocks_prefix + std::to_string(num_up_blocks - 2) + ".upsamplers.0.";
+    std::shared_ptr<ov::Node> deep_features = nullptr;
+    for (const auto& node : model->get_ops()) {
+        if (node->get_friendly_name().find(upsampler_prefix) == std::string::npos || node->get_output_size() != 1) {
+            continue;
+        }
+        for (const auto& consumer : node->output(0).get_target_inputs()) {
+            if (consumer.get_node()->get_friendly_name().find(upsampler_prefix) == std::string::npos) {
+                // the upsampler must have a single output
+                if (deep_features && deep_features != node) {
+                    return nullptr;
+                }
+                deep_features = node;
+            }
+        }
+    }
+    return deep_features;
+}
+
+// collects the parameters, which the results depend on
+ov::ParameterVector get_used_parameters(const ov::ResultVector& results) {
+    ov::ParameterVector parameters;
+    std::unordered_set<ov::Node*> visited;
+    std::vector<ov::Node*> nodes;
+    for (const auto& result : results) {
+        nodes.push_back(result.get());
+    }
+
+    while (!nodes.empty()) {
+        ov::Node* node = nodes.back();
+        nodes.pop_back();
+        if (!visited.insert(node).second) {
+            continue;
+        }
+        if (auto parameter = ov::as_type_ptr<ov::op::v0::Parameter>(node->shared_from_this())) {
+            parameters.push_back(parameter);
+        }
+        for (const auto& input : node->input_values()) {
+            nodes.push_back(input.get_node());
+        }
+    }
+    return parameters;
+}
+
+}  // namespace
+
+std::shared_ptr<ov::Model> split_deep_features(const std::shared_ptr<ov::Model>& model) {
+    const std::shared_ptr<ov::Node> deep_features = find_deep_features(model);
+    if (!deep_features) {
+        return nullptr;
+    }
+
+    // the shallow model is cut from a copy, where the deep features are replaced with a parameter
+    const std::shared_ptr<ov::Model> shallow_model = model->clone();
+    std::shared_ptr<ov::Node> shallow_deep_features = nullptr;
+    for (const auto& node : shallow_model->get_ops()) {
+        if (node->get_friendly_name() == deep_features->get_friendly_name()) {
+            shallow_deep_features = node;
+            break;
+        }
+    }
+    OPENVINO_ASSERT(shallow_deep_features, "Internal error: deep features are not found in the copy of the model");
+
+    auto deep_features_input = std::make_shared<ov::op::v0::Parameter>(deep_features->get_output_element_type(0),
+                                                                       deep_features->get_output_partial_shape(0));
+    deep_features_input->set_friendly_name(deep_features_name);
+    for (auto& consumer : shallow_deep_features->output(0).get_target_inputs()) {
+        consumer.replace_source_output(deep_features_input);
+    }
+    deep_features_input->output(0).get_tensor().set_names({deep_features_name});
+
+    // the deep blocks are not reachable from the results anymore, so they are dropped with their parameters
+    ov::ResultVector results = shallow_model->get_results();
+    ov::ParameterVector parameters = get_used_parameters(results);
+    auto split_model = std::make_shared<ov::Model>(results, parameters, shallow_model->get_friendly_name() + "_shallow");
+
+    auto deep_features_output = std::make_shared<ov::op::v0::Result>(deep_features->output(0));
+    deep_features->output(0).get_tensor().add_names({deep_features_name});
+    model->add_results({deep_features_output});
+
+    return split_model;
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,28 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace genai {
+
+// name of the deep features, which are an output of the full UNet and an input of the shallow one
+inline const std::string deep_features_name = "deep_features";
+
+/**
+ * Splits UNet for feature reuse (DeepCache, https://arxiv.org/abs/2312.00858). The cache point is the output of the
+ * upsampler of the second last up block, which is found by the friendly names of the exported model:
+ * - the deep features are added to the outputs of 'model'
+ * - the returned shallow model takes the deep features as an input and infers only the first down block and the last
+ *   up block, which depend on the current sample besides the deep features
+ * @returns The shallow model or nullptr, if the model doesn't have the cache point
+ */
+std::shared_ptr<ov::Model> split_deep_features(const std::shared_ptr<ov::Model>& model);
+
+}  // namespace genai
+}  // namespace ov
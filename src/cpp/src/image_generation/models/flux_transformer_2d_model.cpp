@@ -148,6 +148,11 @@ void FluxTransformer2DModel::set_adapters(const std::optional<AdapterConfig>& ad
     }
 }
 
+void FluxTransformer2DModel::set_adapters_per_row(const std::vector<AdapterConfig>& row_adapters) {
+    OPENVINO_ASSERT(m_request, "Transformer model must be compiled first");
+    m_adapter_controller.apply_per_row(m_request, row_adapters);
+}
+
 ov::Tensor FluxTransformer2DModel::infer(const ov::Tensor latent_model_input, const ov::Tensor timestep) {
     OPENVINO_ASSERT(m_request, "Transformer model must be compiled first. Cannot infer non-compiled model");
 
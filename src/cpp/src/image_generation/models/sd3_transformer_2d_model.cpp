@@ -4,6 +4,7 @@
 #include "openvino/genai/image_generation/sd3_transformer_2d_model.hpp"
 #include "image_generation/models/sd3transformer_2d_inference_dynamic.hpp"
 #include "image_generation/models/sd3transformer_2d_inference_static_bs1.hpp"
+#include "image_generation/models/sd3transformer_2d_inference_static.hpp"
 
 #include <fstream>
 
@@ -110,8 +111,10 @@ SD3Transformer2DModel& SD3Transformer2DModel::compile(const std::string& device,
 
     if (device.find("NPU") != std::string::npos) {
         m_impl = std::make_shared<SD3Transformer2DModel::InferenceStaticBS1>();
-    }
-    else {
+    } else if (!m_model->is_dynamic()) {
+        // the reshaped model is compiled for the other shapes on demand instead of the dynamic shapes
+        m_impl = std::make_shared<SD3Transformer2DModel::InferenceStatic>();
+    } else {
         m_impl = std::make_shared<SD3Transformer2DModel::InferenceDynamic>();
     }
 
@@ -140,5 +143,12 @@ ov::Tensor SD3Transformer2DModel::infer(const ov::Tensor latent_model_input, con
     return m_impl->infer(latent_model_input, timestep);
 }
 
+ov::Tensor SD3Transformer2DModel::infer(const ov::Tensor latent_model_input,
+                                        const ov::Tensor timestep,
+                                        float guidance_scale) {
+    OPENVINO_ASSERT(m_impl, "Transformer model must be compiled first. Cannot infer non-compiled model");
+    return m_impl->infer(latent_model_input, timestep, guidance_scale);
+}
+
 }  // namespace genai
 }  // namespace ov
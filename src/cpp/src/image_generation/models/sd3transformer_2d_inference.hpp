@@ -7,6 +7,8 @@
 #include <optional>
 #include "openvino/core/model.hpp"
 #include "openvino/genai/image_generation/sd3_transformer_2d_model.hpp"
+#include "image_generation/models/classifier_free_guidance.hpp"
+#include "image_generation/numpy_utils.hpp"
 
 namespace ov {
 namespace genai {
@@ -19,6 +21,12 @@ public:
     virtual void set_adapters(AdapterController& m_adapter_controller, const AdapterConfig& adapters) = 0;
     virtual ov::Tensor infer(ov::Tensor latent_model_input, ov::Tensor timestep) = 0;
 
+    // repeats the latent and combines the noise prediction on host, if guidance is not fused into the model
+    virtual ov::Tensor infer(ov::Tensor latent_model_input, ov::Tensor timestep, float guidance_scale) {
+        ov::Tensor noise_pred = infer(numpy_utils::repeat(latent_model_input, 2), timestep);
+        return apply_classifier_free_guidance(noise_pred, guidance_scale);
+    }
+
     // utility function to resize model given optional dimensions.
     static void reshape(std::shared_ptr<ov::Model> model,
                         std::optional<int> batch_size = {},
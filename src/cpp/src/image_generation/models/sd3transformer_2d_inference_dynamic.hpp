@@ -21,6 +21,12 @@ public:
     virtual void compile(std::shared_ptr<ov::Model> model,
                          const std::string& device,
                          const ov::AnyMap& properties) override {
+        // the latents are repeated and the noise prediction is guided on device
+        m_guidance_fused = can_fuse_classifier_free_guidance(model, "hidden_states");
+        if (m_guidance_fused) {
+            fuse_classifier_free_guidance(model, "hidden_states");
+        }
+
         ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, properties);
         ov::genai::utils::print_compiled_model_properties(compiled_model, "SD3 Transformer 2D model");
         m_request = compiled_model.create_infer_request();
@@ -41,13 +47,37 @@ public:
 
         m_request.set_tensor("hidden_states", latent_model_input);
         m_request.set_tensor("timestep", timestep);
+        if (m_guidance_fused) {
+            // the latent is repeated by the caller, so the guidance scale doesn't affect the output
+            set_guidance_scale(1.0f);
+        }
         m_request.infer();
 
-        return m_request.get_output_tensor();
+        return m_request.get_output_tensor(0);
+    }
+
+    virtual ov::Tensor infer(ov::Tensor latent_model_input, ov::Tensor timestep, float guidance_scale) override {
+        if (!m_guidance_fused) {
+            return Inference::infer(latent_model_input, timestep, guidance_scale);
+        }
+        OPENVINO_ASSERT(m_request, "Transformer model must be compiled first. Cannot infer non-compiled model");
+
+        m_request.set_tensor("hidden_states", latent_model_input);
+        m_request.set_tensor("timestep", timestep);
+        set_guidance_scale(guidance_scale);
+        m_request.infer();
+
+        return m_request.get_output_tensor(0);
     }
 
 private:
+    void set_guidance_scale(float guidance_scale) {
+        ov::Tensor guidance_scale_tensor = m_request.get_tensor(guidance_scale_input_name);
+        *guidance_scale_tensor.data<float>() = guidance_scale;
+    }
+
     ov::InferRequest m_request;
+    bool m_guidance_fused = false;
 };
 
 }  // namespace genai
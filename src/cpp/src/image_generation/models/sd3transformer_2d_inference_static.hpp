@@ -0,0 +1,96 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "lora/helper.hpp"
+#include "image_generation/models/sd3transformer_2d_inference.hpp"
+#include "image_generation/models/static_shape_buckets.hpp"
+
+namespace ov {
+namespace genai {
+
+// Static shape variant of SD3Transformer2DModel::Inference for arbitrary batch sizes, the other resolutions and batch
+// sizes are compiled as separate buckets, so a reshaped model is not limited to the shapes passed to 'reshape()'
+class SD3Transformer2DModel::InferenceStatic : public SD3Transformer2DModel::Inference {
+public:
+    virtual std::shared_ptr<Inference> clone() override {
+        auto cloned = std::make_shared<InferenceStatic>(*this);
+        cloned->m_buckets = m_buckets.clone();
+        cloned->m_hidden_states.clear();
+        // the adapter controller belongs to the original model, the clone applies the adapters by its own 'set_adapters()'
+        cloned->m_adapter_controller = nullptr;
+        cloned->m_adapters = std::nullopt;
+        return cloned;
+    }
+
+    virtual void compile(std::shared_ptr<ov::Model> model, const std::string& device, const ov::AnyMap& properties) override {
+        for (auto& input : model->inputs()) {
+            OPENVINO_ASSERT(!input.get_partial_shape().is_dynamic(),
+                            "SD3Transformer2DModel::InferenceStatic::compile: input tensor " + input.get_any_name() +
+                                " shape is dynamic. Tensors must be reshaped to be static before compile is invoked.");
+        }
+
+        m_buckets.init(model, device, properties, "SD3 Transformer 2D static model");
+        // the shapes of the reshaped model are compiled eagerly
+        bool created = false;
+        m_buckets.get_request(m_buckets.get_model_shapes(), created);
+    }
+
+    virtual void set_hidden_states(const std::string& tensor_name, ov::Tensor encoder_hidden_states) override {
+        // the hidden states are set to the bucket, which is selected by the next inference
+        m_hidden_states[tensor_name] = encoder_hidden_states;
+    }
+
+    virtual void set_adapters(AdapterController& adapter_controller, const AdapterConfig& adapters) override {
+        m_adapter_controller = &adapter_controller;
+        m_adapters = adapters;
+        // the adapter controller tracks the changes for a single infer request, the other buckets get all the tensors
+        bool applied = false;
+        m_buckets.for_each_request([&](ov::InferRequest& request) {
+            if (applied) {
+                adapter_controller.apply_all(request);
+            } else {
+                adapter_controller.apply(request, adapters);
+                applied = true;
+            }
+        });
+    }
+
+    virtual ov::Tensor infer(ov::Tensor latent_model_input, ov::Tensor timestep) override {
+        StaticShapeBuckets::InputShapes shapes{{"hidden_states", latent_model_input.get_shape()}, {"timestep", timestep.get_shape()}};
+        for (const auto& [tensor_name, hidden_states] : m_hidden_states) {
+            shapes[tensor_name] = hidden_states.get_shape();
+        }
+
+        bool created = false;
+        ov::InferRequest& request = m_buckets.get_request(shapes, created);
+        if (created && m_adapters) {
+            m_adapter_controller->apply_all(request);
+        }
+
+        for (const auto& [tensor_name, hidden_states] : m_hidden_states) {
+            request.set_tensor(tensor_name, hidden_states);
+        }
+        request.set_tensor("hidden_states", latent_model_input);
+        request.set_tensor("timestep", timestep);
+
+        request.infer();
+
+        return request.get_output_tensor(0);
+    }
+
+private:
+    StaticShapeBuckets m_buckets;
+    std::map<std::string, ov::Tensor> m_hidden_states;
+    // the adapters are applied to the buckets compiled after 'set_adapters()'
+    AdapterController* m_adapter_controller = nullptr;
+    std::optional<AdapterConfig> m_adapters;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,112 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/infer_request.hpp"
+
+#include "utils.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Cache of the denoiser models compiled for static shapes. Each bucket is a copy of the model reshaped to the shapes of
+ * the actual inputs, e.g. another resolution or batch size, and it's compiled on the first inference with these shapes.
+ * The least recently used bucket is released, when the number of buckets exceeds the limit.
+ */
+class StaticShapeBuckets {
+public:
+    using InputShapes = std::map<std::string, ov::Shape>;
+
+    // maximum number of the compiled models kept at the same time
+    static constexpr size_t max_num_buckets = 4;
+
+    void init(std::shared_ptr<ov::Model> model, const std::string& device, const ov::AnyMap& properties, const char* model_title) {
+        m_model = model;
+        m_device = device;
+        m_properties = properties;
+        m_model_title = model_title;
+        m_buckets.clear();
+    }
+
+    // the shapes of the model passed to 'init()'
+    InputShapes get_model_shapes() const {
+        InputShapes shapes;
+        for (const auto& input : m_model->inputs()) {
+            shapes[input.get_any_name()] = input.get_shape();
+        }
+        return shapes;
+    }
+
+    /**
+     * @returns The infer request of the bucket for the shapes, the inputs which are not listed keep the shapes of the model
+     * @param created Set to true, if the bucket is compiled by this call
+     */
+    ov::InferRequest& get_request(const InputShapes& shapes, bool& created) {
+        OPENVINO_ASSERT(m_model, "Static shape model must be compiled first");
+
+        created = false;
+        for (auto it = m_buckets.begin(); it != m_buckets.end(); ++it) {
+            if (it->shapes == shapes) {
+                m_buckets.splice(m_buckets.begin(), m_buckets, it);
+                return m_buckets.front().request;
+            }
+        }
+
+        std::shared_ptr<ov::Model> bucket_model = m_model->clone();
+        std::map<std::string, ov::PartialShape> partial_shapes;
+        for (const auto& [name, shape] : shapes) {
+            partial_shapes[name] = shape;
+        }
+        bucket_model->reshape(partial_shapes);
+
+        ov::CompiledModel compiled_model = utils::singleton_core().compile_model(bucket_model, m_device, m_properties);
+        ov::genai::utils::print_compiled_model_properties(compiled_model, m_model_title.c_str());
+
+        if (m_buckets.size() == max_num_buckets) {
+            m_buckets.pop_back();
+        }
+        m_buckets.push_front({shapes, compiled_model.create_infer_request()});
+        created = true;
+        return m_buckets.front().request;
+    }
+
+    // the copy shares the compiled models and creates its own infer requests
+    StaticShapeBuckets clone() const {
+        StaticShapeBuckets cloned(*this);
+        for (Bucket& bucket : cloned.m_buckets) {
+            bucket.request = bucket.request.get_compiled_model().create_infer_request();
+        }
+        return cloned;
+    }
+
+    template <typename Func>
+    void for_each_request(Func&& func) {
+        for (Bucket& bucket : m_buckets) {
+            func(bucket.request);
+        }
+    }
+
+private:
+    struct Bucket {
+        InputShapes shapes;
+        ov::InferRequest request;
+    };
+
+    std::shared_ptr<ov::Model> m_model = nullptr;
+    std::string m_device;
+    ov::AnyMap m_properties;
+    std::string m_model_title;
+    // the most recently used buckets are at the front
+    std::list<Bucket> m_buckets;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -8,6 +8,7 @@
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
 #include "utils.hpp"
+#include "image_generation/models/text_encoder_cache.hpp"
 
 namespace ov {
 namespace genai {
@@ -75,6 +76,7 @@ T5EncoderModel& T5EncoderModel::compile(const std::string& device, const ov::Any
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(m_model, device, *extract_adapters_from_properties(properties));
     ov::genai::utils::print_compiled_model_properties(compiled_model, "T5 encoder model");
     m_request = compiled_model.create_infer_request();
+    m_cache_model_id = TextEncoderCache::generate_model_id();
     // release the original model
     m_model.reset();
 
@@ -129,13 +131,21 @@ ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::strin
                                                {current_batch_idx + 1, input_ids.get_shape()[1]}));
 
     // text embeddings
-    m_request.infer();
+    m_cached_outputs.clear();
+    if (!TextEncoderCache::get_instance().get(m_cache_model_id, input_ids, m_cached_outputs)) {
+        m_request.infer();
+        std::vector<ov::Tensor> outputs;
+        for (size_t i = 0; i < m_request.get_compiled_model().outputs().size(); ++i) {
+            outputs.push_back(m_request.get_output_tensor(i));
+        }
+        TextEncoderCache::get_instance().put(m_cache_model_id, input_ids, outputs);
+    }
 
-    return m_request.get_output_tensor(0);
+    return get_output_tensor(0);
 }
 
 ov::Tensor T5EncoderModel::get_output_tensor(const size_t idx) {
-    return m_request.get_output_tensor(idx);
+    return m_cached_outputs.empty() ? m_request.get_output_tensor(idx) : m_cached_outputs.at(idx);
 }
 
 } // namespace genai
@@ -0,0 +1,97 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/models/text_encoder_cache.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <sstream>
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+constexpr size_t default_cache_size_mb = 64;
+
+size_t get_cache_capacity() {
+    const char* env_var_value = std::getenv("OPENVINO_GENAI_TEXT_ENCODER_CACHE_SIZE");
+    const size_t cache_size_mb = env_var_value != nullptr ? std::strtoull(env_var_value, nullptr, 10) : default_cache_size_mb;
+    return cache_size_mb * 1024 * 1024;
+}
+
+}  // namespace
+
+TextEncoderCache::TextEncoderCache()
+    : m_capacity(get_cache_capacity()) {}
+
+TextEncoderCache& TextEncoderCache::get_instance() {
+    static TextEncoderCache cache;
+    return cache;
+}
+
+size_t TextEncoderCache::generate_model_id() {
+    static std::atomic<size_t> next_model_id{1};
+    return next_model_id++;
+}
+
+TextEncoderCache::Key TextEncoderCache::make_key(size_t model_id, const ov::Tensor& input_ids) {
+    std::ostringstream input_key;
+    input_key << input_ids.get_element_type() << input_ids.get_shape();
+    input_key.write(static_cast<const char*>(input_ids.data()), input_ids.get_byte_size());
+    return {model_id, input_key.str()};
+}
+
+bool TextEncoderCache::get(size_t model_id, const ov::Tensor& input_ids, std::vector<ov::Tensor>& outputs) {
+    if (m_capacity == 0) {
+        return false;
+    }
+
+    const Key key = make_key(model_id, input_ids);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        return false;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    outputs = it->second->outputs;
+    return true;
+}
+
+void TextEncoderCache::put(size_t model_id, const ov::Tensor& input_ids, const std::vector<ov::Tensor>& outputs) {
+    size_t byte_size = 0;
+    for (const ov::Tensor& output : outputs) {
+        byte_size += output.get_byte_size();
+    }
+    if (byte_size > m_capacity) {
+        return;
+    }
+
+    Entry entry;
+    entry.key = make_key(model_id, input_ids);
+    entry.byte_size = byte_size;
+    for (const ov::Tensor& output : outputs) {
+        ov::Tensor output_copy(output.get_element_type(), output.get_shape());
+        output.copy_to(output_copy);
+        entry.outputs.push_back(output_copy);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_index.count(entry.key)) {
+        return;
+    }
+
+    while (m_size + byte_size > m_capacity) {
+        m_size -= m_entries.back().byte_size;
+        m_index.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+
+    m_size += byte_size;
+    m_entries.push_front(std::move(entry));
+    m_index[m_entries.front().key] = m_entries.begin();
+}
+
+}  // namespace genai
+}  // namespace ov
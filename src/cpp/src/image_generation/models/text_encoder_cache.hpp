@@ -0,0 +1,57 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * LRU cache of text encoder outputs shared by all the pipelines. The entries are keyed by the compiled text encoder and
+ * its tokenized input, so the templated prompts and the repeated negative prompts are encoded once.
+ * The cache size is bounded by OPENVINO_GENAI_TEXT_ENCODER_CACHE_SIZE environment variable in megabytes (64 by default),
+ * 0 disables the cache.
+ */
+class TextEncoderCache {
+public:
+    static TextEncoderCache& get_instance();
+
+    // returns a unique identifier of a compiled text encoder, the clones of the encoder share the identifier
+    static size_t generate_model_id();
+
+    // copies the cached outputs to 'outputs', the returned tensors must not be modified
+    bool get(size_t model_id, const ov::Tensor& input_ids, std::vector<ov::Tensor>& outputs);
+
+    // stores the copies of the outputs
+    void put(size_t model_id, const ov::Tensor& input_ids, const std::vector<ov::Tensor>& outputs);
+
+private:
+    TextEncoderCache();
+
+    using Key = std::pair<size_t, std::string>;
+    struct Entry {
+        Key key;
+        std::vector<ov::Tensor> outputs;
+        size_t byte_size = 0;
+    };
+
+    static Key make_key(size_t model_id, const ov::Tensor& input_ids);
+
+    std::mutex m_mutex;
+    size_t m_capacity = 0, m_size = 0;
+    // the most recently used entries are at the front
+    std::list<Entry> m_entries;
+    std::map<Key, std::list<Entry>::iterator> m_index;
+};
+
+}  // namespace genai
+}  // namespace ov
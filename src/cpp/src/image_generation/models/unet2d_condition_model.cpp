@@ -4,6 +4,7 @@
 #include "openvino/genai/image_generation/unet2d_condition_model.hpp"
 #include "image_generation/models/unet_inference_dynamic.hpp"
 #include "image_generation/models/unet_inference_static_bs1.hpp"
+#include "image_generation/models/unet_inference_static.hpp"
 
 #include <fstream>
 
@@ -95,6 +96,9 @@ UNet2DConditionModel& UNet2DConditionModel::compile(const std::string& device, c
 
     if (device == "NPU") {
         m_impl = std::make_shared<UNet2DConditionModel::UNetInferenceStaticBS1>();
+    } else if (!m_model->is_dynamic()) {
+        // the reshaped model is compiled for the other shapes on demand instead of the dynamic shapes
+        m_impl = std::make_shared<UNet2DConditionModel::UNetInferenceStatic>();
     } else {
         m_impl = std::make_shared<UNet2DConditionModel::UNetInferenceDynamic>();
     }
@@ -125,10 +129,30 @@ void UNet2DConditionModel::set_adapters(const std::optional<AdapterConfig>& adap
     }
 }
 
+void UNet2DConditionModel::set_adapters_per_row(const std::vector<AdapterConfig>& row_adapters) {
+    OPENVINO_ASSERT(m_impl, "UNet model must be compiled first");
+    m_impl->set_adapters_per_row(m_adapter_controller, row_adapters);
+}
+
 ov::Tensor UNet2DConditionModel::infer(ov::Tensor sample, ov::Tensor timestep) {
     OPENVINO_ASSERT(m_impl, "UNet model must be compiled first. Cannot infer non-compiled model");
     return m_impl->infer(sample, timestep);
 }
 
+ov::Tensor UNet2DConditionModel::infer(ov::Tensor sample, ov::Tensor timestep, float guidance_scale) {
+    OPENVINO_ASSERT(m_impl, "UNet model must be compiled first. Cannot infer non-compiled model");
+    return m_impl->infer(sample, timestep, guidance_scale);
+}
+
+bool UNet2DConditionModel::supports_feature_reuse() const {
+    OPENVINO_ASSERT(m_impl, "UNet model must be compiled first");
+    return m_impl->supports_feature_reuse();
+}
+
+void UNet2DConditionModel::set_feature_reuse(bool reuse_features) {
+    OPENVINO_ASSERT(m_impl, "UNet model must be compiled first");
+    m_impl->set_feature_reuse(reuse_features);
+}
+
 } // namespace genai
 } // namespace ov
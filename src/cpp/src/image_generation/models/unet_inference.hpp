@@ -6,6 +6,8 @@
 #include <memory>
 
 #include "openvino/genai/image_generation/unet2d_condition_model.hpp"
+#include "image_generation/models/classifier_free_guidance.hpp"
+#include "image_generation/numpy_utils.hpp"
 
 namespace ov {
 namespace genai {
@@ -19,6 +21,26 @@ public:
     virtual void set_adapters(AdapterController& adapter_controller, const AdapterConfig& adapters) = 0;
     virtual ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep) = 0;
 
+    // repeats the sample and combines the noise prediction on host, if guidance is not fused into the model
+    virtual ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep, float guidance_scale) {
+        ov::Tensor noise_pred = infer(numpy_utils::repeat(sample, 2), timestep);
+        return apply_classifier_free_guidance(noise_pred, guidance_scale);
+    }
+
+    // the models, which are not split for feature reuse, infer the whole UNet at every step
+    virtual bool supports_feature_reuse() const {
+        return false;
+    }
+
+    virtual void set_feature_reuse(bool reuse_features) {
+        OPENVINO_ASSERT(!reuse_features, "UNet model doesn't support feature reuse");
+    }
+
+    // the adapters of the rows are applied to the request of the next inference, which must have a batch of 'row_adapters.size()'
+    virtual void set_adapters_per_row(AdapterController& adapter_controller, const std::vector<AdapterConfig>& row_adapters) {
+        OPENVINO_THROW("UNet model doesn't support various LoRA adapters over the batch on this device");
+    }
+
     // utility function to resize model given optional dimensions.
     static void reshape(std::shared_ptr<ov::Model> model,
                         std::optional<int> batch_size = {},
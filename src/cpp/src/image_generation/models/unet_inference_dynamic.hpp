@@ -4,9 +4,11 @@
 #pragma once
 
 #include <iostream>
+#include <map>
 #include <memory>
 
 #include "image_generation/models/unet_inference.hpp"
+#include "image_generation/models/feature_reuse.hpp"
 #include "utils.hpp"
 
 namespace ov {
@@ -18,10 +20,26 @@ public:
         OPENVINO_ASSERT(static_cast<bool>(m_request), "UNet2DConditionModel must have m_request initialized");
         UNetInferenceDynamic cloned(*this);
         cloned.m_request = m_request.get_compiled_model().create_infer_request();
+        if (m_shallow_request) {
+            cloned.m_shallow_request = m_shallow_request.get_compiled_model().create_infer_request();
+        }
+        cloned.m_hidden_states.clear();
+        cloned.m_reuse_features = false;
         return std::make_shared<UNetInferenceDynamic>(cloned);
     }
 
     virtual void compile(std::shared_ptr<ov::Model> model, const std::string& device, const ov::AnyMap& properties) override {
+        // the latents are repeated and the noise prediction is guided on device
+        m_guidance_fused = can_fuse_classifier_free_guidance(model, "sample");
+        if (m_guidance_fused) {
+            fuse_classifier_free_guidance(model, "sample");
+        }
+
+        // the shallow model is compiled on the first step, which reuses the features
+        m_shallow_model = split_deep_features(model);
+        m_device = device;
+        m_properties = properties;
+
         ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, properties);
         ov::genai::utils::print_compiled_model_properties(compiled_model, "UNet 2D Condition dynamic model");
         m_request = compiled_model.create_infer_request();
@@ -30,26 +48,112 @@ public:
     virtual void set_hidden_states(const std::string& tensor_name, ov::Tensor encoder_hidden_states) override {
         OPENVINO_ASSERT(m_request, "UNet model must be compiled first");
         m_request.set_tensor(tensor_name, encoder_hidden_states);
+        m_hidden_states[tensor_name] = encoder_hidden_states;
+        if (m_shallow_request) {
+            set_shallow_hidden_states(tensor_name, encoder_hidden_states);
+        }
     }
 
     virtual void set_adapters(AdapterController &adapter_controller, const AdapterConfig& adapters) override {
         OPENVINO_ASSERT(m_request, "UNet model must be compiled first");
         adapter_controller.apply(m_request, adapters);
+        // the adapter controller tracks the state of a single infer request
+        m_adapters_applied = true;
+    }
+
+    virtual void set_adapters_per_row(AdapterController& adapter_controller, const std::vector<AdapterConfig>& row_adapters) override {
+        OPENVINO_ASSERT(m_request, "UNet model must be compiled first");
+        adapter_controller.apply_per_row(m_request, row_adapters);
+        m_adapters_applied = true;
+    }
+
+    virtual bool supports_feature_reuse() const override {
+        return (m_shallow_model || m_shallow_request) && !m_adapters_applied;
+    }
+
+    virtual void set_feature_reuse(bool reuse_features) override {
+        OPENVINO_ASSERT(!reuse_features || supports_feature_reuse(),
+                        "UNet model doesn't support feature reuse: the upsampler of the second last up block is not found or LoRA adapters are applied");
+        if (reuse_features && !m_shallow_request) {
+            ov::CompiledModel compiled_model = utils::singleton_core().compile_model(m_shallow_model, m_device, m_properties);
+            ov::genai::utils::print_compiled_model_properties(compiled_model, "UNet 2D Condition shallow model");
+            m_shallow_request = compiled_model.create_infer_request();
+            m_shallow_model.reset();
+            for (const auto& [tensor_name, hidden_states] : m_hidden_states) {
+                set_shallow_hidden_states(tensor_name, hidden_states);
+            }
+        }
+        m_reuse_features = reuse_features;
     }
 
     virtual ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep) override {
         OPENVINO_ASSERT(m_request, "UNet model must be compiled first. Cannot infer non-compiled model");
 
-        m_request.set_tensor("sample", sample);
-        m_request.set_tensor("timestep", timestep);
+        ov::InferRequest& request = get_step_request();
+        request.set_tensor("sample", sample);
+        request.set_tensor("timestep", timestep);
+        if (m_guidance_fused) {
+            // the sample is repeated by the caller, so the guidance scale doesn't affect the output
+            set_guidance_scale(request, 1.0f);
+        }
+
+        request.infer();
+
+        return request.get_output_tensor(0);
+    }
+
+    virtual ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep, float guidance_scale) override {
+        if (!m_guidance_fused) {
+            return UNetInference::infer(sample, timestep, guidance_scale);
+        }
+        OPENVINO_ASSERT(m_request, "UNet model must be compiled first. Cannot infer non-compiled model");
+
+        ov::InferRequest& request = get_step_request();
+        request.set_tensor("sample", sample);
+        request.set_tensor("timestep", timestep);
+        set_guidance_scale(request, guidance_scale);
 
-        m_request.infer();
+        request.infer();
 
-        return m_request.get_output_tensor();
+        return request.get_output_tensor(0);
     }
 
 private:
+    // the shallow request reuses the deep features of the last full inference
+    ov::InferRequest& get_step_request() {
+        if (!m_reuse_features) {
+            return m_request;
+        }
+        m_shallow_request.set_tensor(deep_features_name, m_request.get_tensor(deep_features_name));
+        return m_shallow_request;
+    }
+
+    void set_guidance_scale(ov::InferRequest& request, float guidance_scale) {
+        ov::Tensor guidance_scale_tensor = request.get_tensor(guidance_scale_input_name);
+        *guidance_scale_tensor.data<float>() = guidance_scale;
+    }
+
+    // the shallow model doesn't have the inputs, which only the deep blocks depend on
+    void set_shallow_hidden_states(const std::string& tensor_name, ov::Tensor hidden_states) {
+        for (const auto& input : m_shallow_request.get_compiled_model().inputs()) {
+            if (input.get_names().count(tensor_name)) {
+                m_shallow_request.set_tensor(tensor_name, hidden_states);
+                return;
+            }
+        }
+    }
+
     ov::InferRequest m_request;
+    bool m_guidance_fused = false;
+
+    // feature reuse state
+    std::shared_ptr<ov::Model> m_shallow_model = nullptr;
+    std::string m_device;
+    ov::AnyMap m_properties;
+    ov::InferRequest m_shallow_request;
+    std::map<std::string, ov::Tensor> m_hidden_states;
+    bool m_adapters_applied = false;
+    bool m_reuse_features = false;
 };
 
 }  // namespace genai
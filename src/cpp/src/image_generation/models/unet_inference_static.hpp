@@ -0,0 +1,109 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "lora/helper.hpp"
+#include "image_generation/models/unet_inference.hpp"
+#include "image_generation/models/static_shape_buckets.hpp"
+
+namespace ov {
+namespace genai {
+
+// Static shape variant of UNetInference for arbitrary batch sizes, the other resolutions and batch sizes are compiled as
+// separate buckets, so a reshaped model is not limited to the shapes passed to 'reshape()'
+class UNet2DConditionModel::UNetInferenceStatic : public UNet2DConditionModel::UNetInference {
+public:
+    virtual std::shared_ptr<UNetInference> clone() override {
+        auto cloned = std::make_shared<UNetInferenceStatic>(*this);
+        cloned->m_buckets = m_buckets.clone();
+        cloned->m_hidden_states.clear();
+        // the adapter controller belongs to the original model, the clone applies the adapters by its own 'set_adapters()'
+        cloned->m_adapter_controller = nullptr;
+        cloned->m_adapters = std::nullopt;
+        cloned->m_row_adapters.clear();
+        return cloned;
+    }
+
+    virtual void compile(std::shared_ptr<ov::Model> model, const std::string& device, const ov::AnyMap& properties) override {
+        for (auto& input : model->inputs()) {
+            OPENVINO_ASSERT(!input.get_partial_shape().is_dynamic(),
+                            "UNetInferenceStatic::compile: input tensor " + input.get_any_name() +
+                                " shape is dynamic. Tensors must be reshaped to be static before compile is invoked.");
+        }
+
+        m_buckets.init(model, device, properties, "UNet 2D Condition static model");
+        // the shapes of the reshaped model are compiled eagerly
+        bool created = false;
+        m_buckets.get_request(m_buckets.get_model_shapes(), created);
+    }
+
+    virtual void set_hidden_states(const std::string& tensor_name, ov::Tensor encoder_hidden_states) override {
+        // the hidden states are set to the bucket, which is selected by the next inference
+        m_hidden_states[tensor_name] = encoder_hidden_states;
+    }
+
+    virtual void set_adapters(AdapterController& adapter_controller, const AdapterConfig& adapters) override {
+        m_adapter_controller = &adapter_controller;
+        m_adapters = adapters;
+        m_row_adapters.clear();
+        // the adapter controller tracks the changes for a single infer request, the other buckets get all the tensors
+        bool applied = false;
+        m_buckets.for_each_request([&](ov::InferRequest& request) {
+            if (applied) {
+                adapter_controller.apply_all(request);
+            } else {
+                adapter_controller.apply(request, adapters);
+                applied = true;
+            }
+        });
+    }
+
+    virtual void set_adapters_per_row(AdapterController& adapter_controller, const std::vector<AdapterConfig>& row_adapters) override {
+        // the batch of the rows selects the bucket, so they are applied by the next inference
+        m_adapter_controller = &adapter_controller;
+        m_row_adapters = row_adapters;
+    }
+
+    virtual ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep) override {
+        StaticShapeBuckets::InputShapes shapes{{"sample", sample.get_shape()}, {"timestep", timestep.get_shape()}};
+        for (const auto& [tensor_name, hidden_states] : m_hidden_states) {
+            shapes[tensor_name] = hidden_states.get_shape();
+        }
+
+        bool created = false;
+        ov::InferRequest& request = m_buckets.get_request(shapes, created);
+        if (created && m_adapter_controller) {
+            m_adapter_controller->apply_all(request);
+        }
+        if (!m_row_adapters.empty()) {
+            m_adapter_controller->apply_per_row(request, m_row_adapters);
+        }
+
+        for (const auto& [tensor_name, hidden_states] : m_hidden_states) {
+            request.set_tensor(tensor_name, hidden_states);
+        }
+        request.set_tensor("sample", sample);
+        request.set_tensor("timestep", timestep);
+
+        request.infer();
+
+        return request.get_output_tensor(0);
+    }
+
+private:
+    StaticShapeBuckets m_buckets;
+    std::map<std::string, ov::Tensor> m_hidden_states;
+    // the adapters are applied to the buckets compiled after 'set_adapters()'
+    AdapterController* m_adapter_controller = nullptr;
+    std::optional<AdapterConfig> m_adapters;
+    std::vector<AdapterConfig> m_row_adapters;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -1,10 +1,30 @@
 #include "image_generation/numpy_utils.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 
 namespace ov {
 namespace genai {
 namespace numpy_utils {
 
+namespace {
+
+// the smaller tensors are processed by the calling thread, since the latents of a single image are copied faster than
+// the threads are woken up
+constexpr size_t parallel_threshold_bytes = 1 << 20;
+
+template <typename Func>
+void for_each_chunk(size_t num_chunks, size_t total_byte_size, Func&& func) {
+    if (num_chunks < 2 || total_byte_size < parallel_threshold_bytes) {
+        for (size_t i = 0; i < num_chunks; ++i) {
+            func(i);
+        }
+    } else {
+        ov::parallel_for(num_chunks, func);
+    }
+}
+
+}  // namespace
+
 void rescale_zero_terminal_snr(std::vector<float>& betas) {
     // Convert betas to alphas_bar_sqrt
     std::vector<float> alphas, alphas_bar_sqrt;
@@ -75,50 +95,61 @@ std::vector<float> interp(const std::vector<std::int64_t>& x, const std::vector<
 }
 
 ov::Tensor concat(ov::Tensor tensor_1, ov::Tensor tensor_2, int axis) {
-    ov::Shape shape_1 = tensor_1.get_shape(), shape_2 = tensor_2.get_shape();
-    size_t rank = shape_1.size();
-
-    OPENVINO_ASSERT(rank == shape_2.size(), "Shapes for concatenated tensors must have the same rank");
     OPENVINO_ASSERT(tensor_1.get_element_type() == ov::element::f32 && tensor_2.get_element_type() == ov::element::f32,
         "Concat supports only tensor of fp32 data type");
 
+    ov::Tensor dst_tensor;
+    concat({tensor_1, tensor_2}, axis, dst_tensor);
+    return dst_tensor;
+}
+
+void concat(const std::vector<ov::Tensor>& tensors, int axis, ov::Tensor& dst) {
+    OPENVINO_ASSERT(!tensors.empty(), "Nothing to concat");
+    const ov::Shape shape_0 = tensors.front().get_shape();
+    const ov::element::Type element_type = tensors.front().get_element_type();
+    const size_t rank = shape_0.size();
+
     if (axis < 0) {
         axis += rank;
     }
 
-    ov::Shape dst_shape(rank);
-    for (size_t d = 0; d < rank; ++d) {
-        OPENVINO_ASSERT(d == axis || shape_1[d] == shape_2[d], "Dimension ", d, " must be the same for tensor_1 (", shape_1[d], ") and tensor_2 (", shape_2[d], ")");
-        dst_shape[d] = d == axis ? shape_1[d] + shape_2[d] : shape_1[d];
-    }
-
-    size_t num_iterations = 1;
-    for (size_t d = 0; d < axis; ++d) {
-        num_iterations *= shape_1[d];
+    ov::Shape dst_shape = shape_0;
+    dst_shape[axis] = 0;
+    std::vector<size_t> chunk_sizes;
+    for (const ov::Tensor& tensor : tensors) {
+        const ov::Shape shape = tensor.get_shape();
+        OPENVINO_ASSERT(rank == shape.size(), "Shapes for concatenated tensors must have the same rank");
+        OPENVINO_ASSERT(element_type == tensor.get_element_type(), "Concatenated tensors must have the same element type");
+
+        size_t chunk_size = element_type.size();
+        for (size_t d = 0; d < rank; ++d) {
+            OPENVINO_ASSERT(d == axis || shape_0[d] == shape[d], "Dimension ", d, " must be the same for concatenated tensors (", shape_0[d], " and ", shape[d], ")");
+            if (d >= axis) {
+                chunk_size *= shape[d];
+            }
+        }
+        dst_shape[axis] += shape[axis];
+        chunk_sizes.push_back(chunk_size);
     }
 
-    size_t chunk_1 = 1, chunk_2 = 1;
-    for (size_t d = axis; d < shape_1.size(); ++d) {
-        chunk_1 *= shape_1[d];
-        chunk_2 *= shape_2[d];
+    if (!dst || dst.get_shape() != dst_shape || dst.get_element_type() != element_type) {
+        dst = ov::Tensor(element_type, dst_shape);
     }
 
-    ov::Tensor dst_tensor(tensor_1.get_element_type(), dst_shape);
-    float * res = dst_tensor.data<float>();
-
-    const float * data_1 = tensor_1.data<const float>();
-    const float * data_2 = tensor_2.data<const float>();
-
-    for (size_t i = 0; i < num_iterations; ++i) {
-        std::memcpy(res          , data_1, chunk_1 * sizeof(float));
-        std::memcpy(res + chunk_1, data_2, chunk_2 * sizeof(float));
-
-        res += chunk_1 + chunk_2;
-        data_1 += chunk_1;
-        data_2 += chunk_2;
+    size_t num_iterations = 1;
+    for (size_t d = 0; d < axis; ++d) {
+        num_iterations *= shape_0[d];
     }
-
-    return dst_tensor;
+    const size_t dst_chunk_size = dst.get_byte_size() / num_iterations;
+
+    uint8_t* dst_data = static_cast<uint8_t*>(dst.data());
+    for_each_chunk(num_iterations, dst.get_byte_size(), [&](size_t i) {
+        uint8_t* res = dst_data + i * dst_chunk_size;
+        for (size_t t = 0; t < tensors.size(); ++t) {
+            std::memcpy(res, static_cast<const uint8_t*>(tensors[t].data()) + i * chunk_sizes[t], chunk_sizes[t]);
+            res += chunk_sizes[t];
+        }
+    });
 }
 
 void batch_copy(ov::Tensor src, ov::Tensor dst, size_t src_batch, size_t dst_batch, size_t batch_size) {
@@ -139,14 +170,52 @@ ov::Tensor repeat(const ov::Tensor input, const size_t n_times) {
     if (n_times == 1)
         return input;
 
-    ov::Shape input_shape = input.get_shape(), repeated_shape = input_shape;
+    ov::Tensor tensor_repeated;
+    repeat(input, n_times, tensor_repeated);
+    return tensor_repeated;
+}
+
+void repeat(const ov::Tensor& input, size_t n_times, ov::Tensor& dst) {
+    ov::Shape repeated_shape = input.get_shape();
     repeated_shape[0] *= n_times;
+    if (!dst || dst.get_shape() != repeated_shape || dst.get_element_type() != input.get_element_type()) {
+        dst = ov::Tensor(input.get_element_type(), repeated_shape);
+    }
 
-    ov::Tensor tensor_repeated(input.get_element_type(), repeated_shape);
-    for (size_t n = 0; n < n_times; ++n) {
-        batch_copy(input, tensor_repeated, 0, n, input_shape[0]);
+    if (input.is_continuous()) {
+        uint8_t* dst_data = static_cast<uint8_t*>(dst.data());
+        const size_t input_byte_size = input.get_byte_size();
+        for_each_chunk(n_times, dst.get_byte_size(), [&](size_t n) {
+            std::memcpy(dst_data + n * input_byte_size, input.data(), input_byte_size);
+        });
+    } else {
+        for (size_t n = 0; n < n_times; ++n) {
+            batch_copy(input, dst, 0, n * input.get_shape()[0], input.get_shape()[0]);
+        }
     }
-    return tensor_repeated;
+}
+
+void blend(ov::Tensor latent, const ov::Tensor& image_latent, const ov::Tensor& mask) {
+    const ov::Shape shape = latent.get_shape(), mask_shape = mask.get_shape();
+    OPENVINO_ASSERT(shape.size() == 4 && image_latent.get_shape() == shape, "Shapes for current ", shape, " and initial image latents ",
+                    image_latent.get_shape(), " must match");
+    OPENVINO_ASSERT(mask_shape.size() == 4 && mask_shape[1] == 1 && mask_shape[2] == shape[2] && mask_shape[3] == shape[3] &&
+                    (mask_shape[0] == 1 || mask_shape[0] == shape[0]), "Mask of shape ", mask_shape, " cannot be broadcast to latents of shape ", shape);
+
+    const size_t batch_size = shape[0], channels = shape[1], channel_size = shape[2] * shape[3];
+    const float* mask_data = mask.data<const float>();
+    const float* image_latent_data = image_latent.data<const float>();
+    float* latent_data = latent.data<float>();
+
+    // the planes are blended by contiguous loops, which are vectorized by the compiler
+    for_each_chunk(batch_size * channels, latent.get_byte_size(), [&](size_t plane) {
+        const float* plane_mask = mask_data + (mask_shape[0] == 1 ? 0 : plane / channels) * channel_size;
+        const float* plane_image_latent = image_latent_data + plane * channel_size;
+        float* plane_latent = latent_data + plane * channel_size;
+        for (size_t i = 0; i < channel_size; ++i) {
+            plane_latent[i] = plane_image_latent[i] + plane_mask[i] * (plane_latent[i] - plane_image_latent[i]);
+        }
+    });
 }
 
 
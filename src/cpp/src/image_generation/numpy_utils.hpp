@@ -49,9 +49,20 @@ std::vector<float> interp(const std::vector<std::int64_t>& x, const std::vector<
 // concats two tensors by a given dimension
 ov::Tensor concat(ov::Tensor tensor_1, ov::Tensor tensor_2, int axis);
 
+// concats the tensors by a given dimension to 'dst', which is allocated by the first call and reused by the next ones,
+// e.g. to concat the latents once per denoising step without memory allocations
+void concat(const std::vector<ov::Tensor>& tensors, int axis, ov::Tensor& dst);
+
 void batch_copy(ov::Tensor src, ov::Tensor dst, size_t src_batch, size_t dst_batch, size_t batch_size = 1);
 ov::Tensor repeat(const ov::Tensor input, const size_t num_images_per_prompt);
 
+// repeats the tensor along the batch dimension to 'dst', which is allocated by the first call and reused by the next ones
+void repeat(const ov::Tensor& input, size_t n_times, ov::Tensor& dst);
+
+// blends NCHW f32 latents in place: latent = mask * latent + (1 - mask) * image_latent, where the mask of a single
+// channel is broadcast over the channels and its batch is either 1 or the batch of the latents
+void blend(ov::Tensor latent, const ov::Tensor& image_latent, const ov::Tensor& mask);
+
 } // namespace ov
 } // namespace genai
 } // namespace numpy_utils
@@ -197,6 +197,57 @@ std::map<std::string, ov::Tensor> DDIMScheduler::step(ov::Tensor noise_pred, ov:
     return result;
 }
 
+bool DDIMScheduler::has_linear_step() const {
+    return !m_config.thresholding && !m_config.clip_sample;
+}
+
+LinearStep DDIMScheduler::get_linear_step(size_t inference_step) {
+    size_t timestep = m_timesteps[inference_step];
+
+    // get previous step value (=t-1)
+    int prev_timestep = timestep - m_config.num_train_timesteps / m_num_inference_steps;
+
+    // compute alphas, betas
+    float alpha_prod_t = m_alphas_cumprod[timestep];
+    float alpha_prod_t_prev = (prev_timestep >= 0) ? m_alphas_cumprod[prev_timestep] : m_final_alpha_cumprod;
+    float beta_prod_t = 1 - alpha_prod_t;
+
+    // predicted original sample and predicted epsilon as linear combinations of the sample and the model output
+    float pos_latents_scale, pos_noise_pred_scale, pe_latents_scale, pe_noise_pred_scale;
+    switch (m_config.prediction_type) {
+        case PredictionType::EPSILON:
+            pos_latents_scale = 1.0f / std::sqrt(alpha_prod_t);
+            pos_noise_pred_scale = -std::sqrt(beta_prod_t) / std::sqrt(alpha_prod_t);
+            pe_latents_scale = 0.0f;
+            pe_noise_pred_scale = 1.0f;
+            break;
+        case PredictionType::SAMPLE:
+            pos_latents_scale = 0.0f;
+            pos_noise_pred_scale = 1.0f;
+            pe_latents_scale = 1.0f / std::sqrt(beta_prod_t);
+            pe_noise_pred_scale = -std::sqrt(alpha_prod_t) / std::sqrt(beta_prod_t);
+            break;
+        case PredictionType::V_PREDICTION:
+            pos_latents_scale = std::sqrt(alpha_prod_t);
+            pos_noise_pred_scale = -std::sqrt(beta_prod_t);
+            pe_latents_scale = std::sqrt(beta_prod_t);
+            pe_noise_pred_scale = std::sqrt(alpha_prod_t);
+            break;
+        default:
+            OPENVINO_THROW("Unsupported value for 'PredictionType'");
+    }
+
+    // compute x_t without "random noise" of formula (12) from https://arxiv.org/pdf/2010.02502.pdf
+    LinearStep linear_step;
+    linear_step.latents_scale = std::sqrt(alpha_prod_t_prev) * pos_latents_scale + std::sqrt(1 - alpha_prod_t_prev) * pe_latents_scale;
+    linear_step.noise_pred_scale = std::sqrt(alpha_prod_t_prev) * pos_noise_pred_scale + std::sqrt(1 - alpha_prod_t_prev) * pe_noise_pred_scale;
+    // the step doesn't return the denoised latent separately
+    linear_step.denoised_latents_scale = linear_step.latents_scale;
+    linear_step.denoised_noise_pred_scale = linear_step.noise_pred_scale;
+
+    return linear_step;
+}
+
 std::vector<int64_t> DDIMScheduler::get_timesteps() const {
     OPENVINO_ASSERT(!m_timesteps.empty(), "'timesteps' have not yet been set.");
 
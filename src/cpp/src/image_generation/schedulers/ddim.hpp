@@ -47,6 +47,10 @@ public:
 
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t timestep) const override;
 
+    bool has_linear_step() const override;
+
+    LinearStep get_linear_step(size_t inference_step) override;
+
 private:
     Config m_config;
 
@@ -0,0 +1,142 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/schedulers/device_scheduler_step.hpp"
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+#include "utils.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+// the order of the coefficients in the 'coefficients' input
+enum Coefficient : int64_t {
+    LATENTS_SCALE,
+    NOISE_PRED_SCALE,
+    DENOISED_LATENTS_SCALE,
+    DENOISED_NOISE_PRED_SCALE,
+    MODEL_INPUT_SCALE,
+    NUM_COEFFICIENTS
+};
+
+const std::array<std::string, 3> output_names = {"latent", "denoised", "model_input"};
+
+std::shared_ptr<ov::Model> create_step_model() {
+    using namespace ov::op;
+
+    auto latents = std::make_shared<v0::Parameter>(ov::element::f32, ov::PartialShape::dynamic());
+    latents->output(0).set_names({"latents"});
+    auto noise_pred = std::make_shared<v0::Parameter>(ov::element::f32, ov::PartialShape::dynamic());
+    noise_pred->output(0).set_names({"noise_pred"});
+    auto coefficients = std::make_shared<v0::Parameter>(ov::element::f32, ov::Shape{NUM_COEFFICIENTS});
+    coefficients->output(0).set_names({"coefficients"});
+
+    auto axis = v0::Constant::create(ov::element::i64, ov::Shape{}, {0});
+    auto coefficient = [&](Coefficient idx) {
+        return std::make_shared<v8::Gather>(coefficients, v0::Constant::create(ov::element::i64, ov::Shape{}, {static_cast<int64_t>(idx)}), axis);
+    };
+    auto linear_combination = [&](Coefficient latents_scale, Coefficient noise_pred_scale) {
+        return std::make_shared<v1::Add>(std::make_shared<v1::Multiply>(latents, coefficient(latents_scale)),
+                                         std::make_shared<v1::Multiply>(noise_pred, coefficient(noise_pred_scale)));
+    };
+
+    auto latent = linear_combination(LATENTS_SCALE, NOISE_PRED_SCALE);
+    auto denoised = linear_combination(DENOISED_LATENTS_SCALE, DENOISED_NOISE_PRED_SCALE);
+    auto model_input = std::make_shared<v1::Multiply>(latent, coefficient(MODEL_INPUT_SCALE));
+
+    ov::ResultVector results;
+    for (const auto& [output, name] : {std::make_pair(latent->output(0), output_names[0]),
+                                       std::make_pair(denoised->output(0), output_names[1]),
+                                       std::make_pair(model_input->output(0), output_names[2])}) {
+        output.get_tensor().set_names({name});
+        results.push_back(std::make_shared<v0::Result>(output));
+    }
+
+    return std::make_shared<ov::Model>(results, ov::ParameterVector{latents, noise_pred, coefficients}, "scheduler_step");
+}
+
+} // namespace
+
+DeviceSchedulerStep::DeviceSchedulerStep(const std::string& device, const ov::AnyMap& properties) {
+    ov::CompiledModel compiled_model = utils::singleton_core().compile_model(create_step_model(), device, properties);
+    ov::genai::utils::print_compiled_model_properties(compiled_model, "Scheduler step model");
+    m_request = compiled_model.create_infer_request();
+
+    // the devices without remote tensors keep the outputs allocated by the plugin
+    try {
+        m_context = compiled_model.get_context();
+    } catch (const ov::Exception&) {
+        m_context = std::nullopt;
+    }
+}
+
+std::shared_ptr<DeviceSchedulerStep> DeviceSchedulerStep::clone() const {
+    std::shared_ptr<DeviceSchedulerStep> cloned(new DeviceSchedulerStep());
+    cloned->m_request = m_request.get_compiled_model().create_infer_request();
+    cloned->m_context = m_context;
+    return cloned;
+}
+
+std::map<std::string, ov::Tensor> DeviceSchedulerStep::step(ov::Tensor noise_pred,
+                                                            ov::Tensor latents,
+                                                            const LinearStep& linear_step,
+                                                            float model_input_scale) {
+    OPENVINO_ASSERT(noise_pred.get_shape() == latents.get_shape(),
+                    "Noise prediction shape ", noise_pred.get_shape(), " doesn't match latents shape ", latents.get_shape());
+
+    ov::Tensor coefficients = m_request.get_tensor("coefficients");
+    float* coefficients_data = coefficients.data<float>();
+    coefficients_data[LATENTS_SCALE] = linear_step.latents_scale;
+    coefficients_data[NOISE_PRED_SCALE] = linear_step.noise_pred_scale;
+    coefficients_data[DENOISED_LATENTS_SCALE] = linear_step.denoised_latents_scale;
+    coefficients_data[DENOISED_NOISE_PRED_SCALE] = linear_step.denoised_noise_pred_scale;
+    coefficients_data[MODEL_INPUT_SCALE] = model_input_scale;
+
+    m_request.set_tensor("latents", latents);
+    m_request.set_tensor("noise_pred", noise_pred);
+
+    // alternate the output tensors, so that the latents of the previous step are not overwritten
+    std::map<std::string, ov::Tensor>& outputs = m_outputs[m_step_idx++ % m_outputs.size()];
+    if (m_context) {
+        for (const std::string& name : output_names) {
+            auto it = outputs.find(name);
+            if (it == outputs.end() || it->second.get_shape() != latents.get_shape()) {
+                outputs[name] = m_context->create_tensor(ov::element::f32, latents.get_shape());
+            }
+            m_request.set_tensor(name, outputs[name]);
+        }
+    }
+
+    m_request.infer();
+
+    if (!m_context) {
+        // the plugin reuses its output tensors, so they are copied
+        for (const std::string& name : output_names) {
+            ov::Tensor output = m_request.get_tensor(name);
+            auto it = outputs.find(name);
+            if (it == outputs.end() || it->second.get_shape() != output.get_shape()) {
+                outputs[name] = ov::Tensor(output.get_element_type(), output.get_shape());
+            }
+            output.copy_to(outputs[name]);
+        }
+    }
+
+    return outputs;
+}
+
+ov::Tensor copy_to_host(const ov::Tensor& tensor) {
+    ov::Tensor host_tensor(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(host_tensor);
+    return host_tensor;
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/remote_context.hpp"
+
+#include "image_generation/schedulers/ischeduler.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Computes the linear scheduler steps by a small model compiled on the denoising device. The latents are kept in device
+ * tensors during the denoising loop: the outputs of a step are the inputs of the next step and of the denoising model.
+ */
+class DeviceSchedulerStep {
+public:
+    DeviceSchedulerStep(const std::string& device, const ov::AnyMap& properties);
+
+    std::shared_ptr<DeviceSchedulerStep> clone() const;
+
+    /**
+     * Computes the step
+     * @param noise_pred Noise prediction of the denoising model
+     * @param latents Current latents
+     * @param linear_step Coefficients of the step
+     * @param model_input_scale Scale of the next input of the denoising model
+     * @returns "latent", "denoised" and the scaled "model_input" device tensors, which are valid until the step after
+     * the next one
+     */
+    std::map<std::string, ov::Tensor> step(ov::Tensor noise_pred,
+                                           ov::Tensor latents,
+                                           const LinearStep& linear_step,
+                                           float model_input_scale);
+
+private:
+    DeviceSchedulerStep() = default;
+
+    ov::InferRequest m_request;
+    std::optional<ov::RemoteContext> m_context;
+    // the outputs of the two consecutive steps, since the outputs of a step are the inputs of the next one
+    std::array<std::map<std::string, ov::Tensor>, 2> m_outputs;
+    size_t m_step_idx = 0;
+};
+
+// copies a device tensor to host memory, e.g. before it's passed to a user callback or decoded
+ov::Tensor copy_to_host(const ov::Tensor& tensor);
+
+} // namespace genai
+} // namespace ov
@@ -269,6 +269,58 @@ std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_
     return {{"latent", prev_sample}, {"denoised", pred_original_sample}};
 }
 
+bool EulerDiscreteScheduler::has_linear_step() const {
+    return true;
+}
+
+LinearStep EulerDiscreteScheduler::get_linear_step(size_t inference_step) {
+    if (m_step_index == -1)
+        m_step_index = m_begin_index;
+
+    float sigma = m_sigmas[m_step_index];
+    // TODO: hardcoded gamma
+    float gamma = 0.0f;
+    float sigma_hat = sigma * (gamma + 1);
+
+    LinearStep linear_step;
+
+    // 1. compute predicted original sample (x_0) from sigma-scaled predicted noise
+    switch (m_config.prediction_type) {
+    case PredictionType::EPSILON:
+        linear_step.denoised_latents_scale = 1.0f;
+        linear_step.denoised_noise_pred_scale = -sigma_hat;
+        break;
+    case PredictionType::SAMPLE:
+        linear_step.denoised_latents_scale = 0.0f;
+        linear_step.denoised_noise_pred_scale = 1.0f;
+        break;
+    case PredictionType::V_PREDICTION:
+        linear_step.denoised_latents_scale = 1.0f / (std::pow(sigma, 2) + 1);
+        linear_step.denoised_noise_pred_scale = -sigma / std::pow((std::pow(sigma, 2) + 1), 0.5);
+        break;
+    default:
+        OPENVINO_THROW("Unsupported value for 'PredictionType'");
+    }
+
+    float dt = m_sigmas[m_step_index + 1] - sigma_hat;
+
+    // 2. Convert to an ODE derivative: prev_sample = (sample - pred_original_sample) / sigma_hat * dt + sample
+    linear_step.latents_scale = 1.0f + (1.0f - linear_step.denoised_latents_scale) * dt / sigma_hat;
+    linear_step.noise_pred_scale = -linear_step.denoised_noise_pred_scale * dt / sigma_hat;
+
+    m_step_index += 1;
+
+    return linear_step;
+}
+
+float EulerDiscreteScheduler::get_model_input_scale(size_t inference_step) {
+    if (m_step_index == -1)
+        m_step_index = m_begin_index;
+
+    float sigma = m_sigmas[m_step_index];
+    return 1.0f / std::pow((std::pow(sigma, 2) + 1), 0.5);
+}
+
 std::vector<int64_t> EulerDiscreteScheduler::get_timesteps() const {
     OPENVINO_ASSERT(!m_timesteps.empty(), "'timesteps' have not yet been set.");
 
@@ -49,6 +49,12 @@ public:
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
+    bool has_linear_step() const override;
+
+    LinearStep get_linear_step(size_t inference_step) override;
+
+    float get_model_input_scale(size_t inference_step) override;
+
 private:
     Config m_config;
 
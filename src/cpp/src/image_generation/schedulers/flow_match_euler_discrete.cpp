@@ -126,6 +126,25 @@ std::map<std::string, ov::Tensor> FlowMatchEulerDiscreteScheduler::step(ov::Tens
     return {{"latent", prev_sample}};
 }
 
+bool FlowMatchEulerDiscreteScheduler::has_linear_step() const {
+    return true;
+}
+
+LinearStep FlowMatchEulerDiscreteScheduler::get_linear_step(size_t inference_step) {
+    if (m_step_index == -1)
+        init_step_index();
+
+    float sigma_diff = m_sigmas[m_step_index + 1] - m_sigmas[m_step_index];
+
+    m_step_index++;
+
+    // the step doesn't return the denoised latent separately
+    LinearStep linear_step;
+    linear_step.latents_scale = linear_step.denoised_latents_scale = 1.0f;
+    linear_step.noise_pred_scale = linear_step.denoised_noise_pred_scale = sigma_diff;
+    return linear_step;
+}
+
 std::vector<float> FlowMatchEulerDiscreteScheduler::get_float_timesteps() {
     OPENVINO_ASSERT(m_strength != -1,
                     "Parameter 'strength' was not yes passed to Scheduler.");
@@ -42,6 +42,10 @@ public:
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
+    bool has_linear_step() const override;
+
+    LinearStep get_linear_step(size_t inference_step) override;
+
     void scale_noise(ov::Tensor sample, float timestep, ov::Tensor noise) override;
 
     void set_begin_index(size_t begin_index) override;
@@ -15,6 +15,15 @@
 namespace ov {
 namespace genai {
 
+/**
+ * Coefficients of a scheduler step, which is linear in the latents and the noise prediction:
+ * latent = latents_scale * latents + noise_pred_scale * noise_pred, and the same for the denoised latent
+ */
+struct LinearStep {
+    float latents_scale = 1.0f, noise_pred_scale = 0.0f;
+    float denoised_latents_scale = 1.0f, denoised_noise_pred_scale = 0.0f;
+};
+
 class IScheduler : public Scheduler {
 public:
     virtual void set_timesteps(size_t num_inference_steps, float strength) = 0;
@@ -46,6 +55,21 @@ public:
 
     virtual void set_begin_index(size_t begin_index) {};
 
+    // whether the steps are linear, so that they can be computed on the denoising device via 'get_linear_step'
+    virtual bool has_linear_step() const {
+        return false;
+    }
+
+    // computes the coefficients of the step instead of the step itself, the scheduler state is updated as by 'step'
+    virtual LinearStep get_linear_step(size_t inference_step) {
+        OPENVINO_THROW("Scheduler doesn't support linear steps");
+    }
+
+    // the scale applied to the latents by 'scale_model_input'
+    virtual float get_model_input_scale(size_t inference_step) {
+        return 1.0f;
+    }
+
 };
 
 } // namespace genai
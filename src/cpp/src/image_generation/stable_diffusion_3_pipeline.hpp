@@ -184,6 +184,8 @@ public:
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
         update_adapters_from_properties(properties, m_generation_config.adapters);
+
+        init_device_scheduler_step(device, properties);
     }
 
     StableDiffusion3Pipeline(PipelineType pipeline_type,
@@ -276,6 +278,7 @@ public:
         }
         m_transformer->compile(denoise_device, properties);
         m_vae->compile(vae_device, properties);
+        init_device_scheduler_step(denoise_device, properties);
     }
 
     std::shared_ptr<DiffusionPipeline> clone() override {
@@ -306,6 +309,9 @@ public:
         pipeline->m_root_dir = m_root_dir;
         pipeline->set_scheduler(Scheduler::from_config(m_root_dir / "scheduler/scheduler_config.json"));
         pipeline->set_generation_config(m_generation_config);
+        if (m_scheduler_step) {
+            pipeline->m_scheduler_step = m_scheduler_step->clone();
+        }
         return pipeline;
     }
 
@@ -555,70 +561,49 @@ public:
             std::tie(mask, masked_image_latent) = prepare_mask_latents(mask_image, processed_image, generation_config, batch_size_multiplier);
         }
 
-        ov::Shape latent_shape_cfg = latent.get_shape();
-        latent_shape_cfg[0] *= batch_size_multiplier;
-        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg);
-
         // 7. Denoising loop
-        ov::Tensor noisy_residual_tensor(ov::element::f32, {});
+        ov::Tensor noisy_residual_tensor;
+        // the flow matching latents are passed to the transformer without scaling, so they stay on device between the steps
+        const bool use_device_step = use_device_scheduler_step();
 
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
-            // concat the same latent twice along a batch dimension in case of CFG
-            if (batch_size_multiplier > 1) {
-                numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
-                numpy_utils::batch_copy(latent, latent_cfg, 0, generation_config.num_images_per_prompt, generation_config.num_images_per_prompt);
-            } else {
-                // just assign to save memory copy
-                latent_cfg = latent;
-            }
             ov::Tensor timestep(ov::element::f32, {1}, &timesteps[inference_step]);
             auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_transformer->infer(latent_cfg, timestep);
+            // the latent is repeated for CFG and guidance is performed within the model
+            noisy_residual_tensor = batch_size_multiplier > 1 ?
+                m_transformer->infer(latent, timestep, generation_config.guidance_scale) :
+                m_transformer->infer(latent, timestep);
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
-
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
-
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
-            } else {
-                noisy_residual_tensor = noise_pred_tensor;
-            }
-
-            auto scheduler_step_result = m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
+            auto scheduler_step_result = use_device_step ?
+                device_scheduler_step(noisy_residual_tensor, latent, inference_step, timesteps.size()) :
+                m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
             latent = scheduler_step_result["latent"];
 
             if (m_pipeline_type == PipelineType::INPAINTING && !is_inpainting_model()) {
                 blend_latents(image_latent, noise, mask, latent, inference_step);
             }
 
-            if (callback && callback(inference_step, timesteps.size(), latent)) {
-                auto step_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
-                m_perf_metrics.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_ms));
-
-                auto image = ov::Tensor(ov::element::u8, {});
-                m_perf_metrics.generate_duration =
-                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gen_start)
-                        .count();
-                return image;
+            if (callback) {
+                ov::Tensor callback_latent = use_device_step ? copy_to_host(latent) : latent;
+                if (callback(inference_step, timesteps.size(), callback_latent)) {
+                    auto step_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
+                    m_perf_metrics.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_ms));
+
+                    auto image = ov::Tensor(ov::element::u8, {});
+                    m_perf_metrics.generate_duration =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gen_start)
+                            .count();
+                    return image;
+                }
             }
             auto step_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
             m_perf_metrics.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_ms));
         }
         auto decode_start = std::chrono::steady_clock::now();
-        auto image = decode(latent);
+        auto image = decode(use_device_step ? copy_to_host(latent) : latent);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -652,33 +637,20 @@ private:
         OPENVINO_ASSERT(m_pipeline_type == PipelineType::INPAINTING, "'blend_latents' can be called for inpainting pipeline only");
         OPENVINO_ASSERT(image_latent.get_shape() == latent.get_shape(), "Shapes for current", latent.get_shape(), "and initial image latents ", image_latent.get_shape(), " must match");
 
-        ov::Tensor noised_image_latent(image_latent.get_element_type(), {});
+        ov::Tensor noised_image_latent = image_latent;
 
         std::vector<float> timesteps = m_scheduler->get_float_timesteps();
         if (inference_step < timesteps.size() - 1) {
-            image_latent.copy_to(noised_image_latent);
+            // the buffer of the noised image latent is reused by the denoising steps
+            image_latent.copy_to(m_noised_image_latent);
+            noised_image_latent = m_noised_image_latent;
 
             float noise_timestep = timesteps[inference_step + 1];
             m_scheduler->scale_noise(noised_image_latent, noise_timestep, noise);
-        } else {
-            noised_image_latent = image_latent;
         }
 
-        ov::Shape shape = image_latent.get_shape();
-        size_t batch_size = shape[0], in_channels = shape[1], channel_size = shape[2] * shape[3];
-        OPENVINO_ASSERT(batch_size == 1, "Batch size 1 is supported for now");
-
-        const float * mask_data = mask.data<const float>();
-        const float * noised_image_latent_data = noised_image_latent.data<const float>();
-        float * latent_data = latent.data<float>();
-
         // blend initial noised and processed latents
-        for (size_t i = 0; i < channel_size; ++i) {
-            float mask_value = mask_data[i];
-            for (size_t j = 0; j < in_channels; ++j) {
-                latent_data[j * channel_size + i] = (1.0f - mask_value) * noised_image_latent_data[j * channel_size + i] + mask_value * latent_data[j * channel_size + i];
-            }
-        }
+        numpy_utils::blend(latent, noised_image_latent, mask);
     }
 
     void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) {
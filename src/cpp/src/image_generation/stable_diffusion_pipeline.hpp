@@ -7,6 +7,7 @@
 #include <iostream>
 #include <memory>
 #include <filesystem>
+#include <future>
 
 #include "image_generation/diffusion_pipeline.hpp"
 
@@ -66,6 +67,7 @@ public:
         } else {
             OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
         }
+        load_preview_vae(root_dir);
 
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
@@ -84,38 +86,55 @@ public:
         set_scheduler(Scheduler::from_config(root_dir / "scheduler/scheduler_config.json"));
 
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
+        const std::vector<std::string> data_parallel_devices = extract_data_parallel_devices(updated_properties);
+        const ov::AnyMap& model_properties = *updated_properties;
 
         const std::string text_encoder = data["text_encoder"][1].get<std::string>();
-        if (text_encoder == "CLIPTextModel") {
-            m_clip_text_encoder = std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, *updated_properties);
-        } else {
+        if (text_encoder != "CLIPTextModel") {
             OPENVINO_THROW("Unsupported '", text_encoder, "' text encoder type");
         }
 
         const std::string unet = data["unet"][1].get<std::string>();
-        if (unet == "UNet2DConditionModel") {
-            m_unet = std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, *updated_properties);
-        } else {
+        if (unet != "UNet2DConditionModel") {
             OPENVINO_THROW("Unsupported '", unet, "' UNet type");
         }
 
         const std::string vae = data["vae"][1].get<std::string>();
-        if (vae == "AutoencoderKL") {
-            if (m_pipeline_type == PipelineType::TEXT_2_IMAGE)
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, *updated_properties);
-            else if (m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING) {
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, *updated_properties);
-            } else {
-                OPENVINO_ASSERT("Unsupported pipeline type");
-            }
-        } else {
+        if (vae != "AutoencoderKL") {
             OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
         }
 
+        // the models are independent, so they are compiled concurrently
+        utils::AsyncModelLoad<std::shared_ptr<CLIPTextModel>> text_encoder_load("text_encoder", [&] {
+            return std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, model_properties);
+        });
+        utils::AsyncModelLoad<std::shared_ptr<UNet2DConditionModel>> unet_load("unet", [&] {
+            return std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, model_properties);
+        });
+        utils::AsyncModelLoad<std::shared_ptr<AutoencoderKL>> vae_load("vae", [&] {
+            if (m_pipeline_type == PipelineType::TEXT_2_IMAGE)
+                return std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, model_properties);
+            OPENVINO_ASSERT(m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING,
+                            "Unsupported pipeline type");
+            return std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, model_properties);
+        });
+        m_clip_text_encoder = text_encoder_load.get(m_model_load_times_ms);
+        m_unet = unet_load.get(m_model_load_times_ms);
+        m_vae = vae_load.get(m_model_load_times_ms);
+        for (const std::string& replica_device : data_parallel_devices) {
+            m_unet_replicas.push_back(std::make_shared<UNet2DConditionModel>(root_dir / "unet", replica_device, model_properties));
+        }
+        load_preview_vae(root_dir);
+        if (m_preview_vae) {
+            m_preview_vae->compile(device, model_properties);
+        }
+
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
 
         update_adapters_from_properties(properties, m_generation_config.adapters);
+
+        init_device_scheduler_step(device, *updated_properties);
     }
 
     StableDiffusionPipeline(
@@ -142,9 +161,18 @@ public:
 
         m_clip_text_encoder = std::make_shared<CLIPTextModel>(*pipe.m_clip_text_encoder);
         m_unet = std::make_shared<UNet2DConditionModel>(*pipe.m_unet);
+        m_unet_replicas.clear();
+        for (const auto& unet_replica : pipe.m_unet_replicas) {
+            m_unet_replicas.push_back(std::make_shared<UNet2DConditionModel>(*unet_replica));
+        }
         m_vae = std::make_shared<AutoencoderKL>(*pipe.m_vae);
+        if (pipe.m_preview_vae) {
+            m_preview_vae = std::make_shared<AutoencoderKL>(*pipe.m_preview_vae);
+        }
 
         m_pipeline_type = pipeline_type;
+        // the copied pipeline must not share the buffers with the original one
+        m_noised_image_latent = ov::Tensor(ov::element::f32, {});
 
         const bool is_lcm = m_unet->get_config().time_cond_proj_dim > 0;
         const char * const pipeline_name = is_lcm ? "LatentConsistencyModelPipeline" : "StableDiffusionPipeline";
@@ -158,6 +186,9 @@ public:
         m_clip_text_encoder->reshape(batch_size_multiplier);
         m_unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
         m_vae->reshape(num_images_per_prompt, height, width);
+        if (m_preview_vae) {
+            m_preview_vae->reshape(num_images_per_prompt, height, width);
+        }
     }
 
     void compile(const std::string& text_encode_device,
@@ -166,10 +197,21 @@ public:
         const ov::AnyMap& properties) override {
         update_adapters_from_properties(properties, m_generation_config.adapters);
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
+        const std::vector<std::string> data_parallel_devices = extract_data_parallel_devices(updated_properties);
 
         m_clip_text_encoder->compile(text_encode_device, *updated_properties);
+        // the replicas are cloned before the model is compiled
+        for (const std::string& replica_device : data_parallel_devices) {
+            auto unet_replica = std::make_shared<UNet2DConditionModel>(m_unet->clone());
+            unet_replica->compile(replica_device, *updated_properties);
+            m_unet_replicas.push_back(unet_replica);
+        }
         m_unet->compile(denoise_device, *updated_properties);
         m_vae->compile(vae_device, *updated_properties);
+        if (m_preview_vae) {
+            m_preview_vae->compile(vae_device, *updated_properties);
+        }
+        init_device_scheduler_step(denoise_device, *updated_properties);
     }
 
     std::shared_ptr<DiffusionPipeline> clone() override {
@@ -185,8 +227,17 @@ public:
             *vae);
 
         pipeline->m_root_dir = m_root_dir;
+        for (const auto& unet_replica : m_unet_replicas) {
+            pipeline->m_unet_replicas.push_back(std::make_shared<UNet2DConditionModel>(unet_replica->clone()));
+        }
+        if (m_preview_vae) {
+            pipeline->m_preview_vae = std::make_shared<AutoencoderKL>(m_preview_vae->clone());
+        }
         pipeline->set_scheduler(Scheduler::from_config(m_root_dir / "scheduler/scheduler_config.json"));
         pipeline->set_generation_config(m_generation_config);
+        if (m_scheduler_step) {
+            pipeline->m_scheduler_step = m_scheduler_step->clone();
+        }
         return pipeline;
     }
 
@@ -204,7 +255,7 @@ public:
         // replicate encoder hidden state to UNet model
         if (generation_config.num_images_per_prompt == 1) {
             // reuse output of text encoder directly w/o extra memory copy
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
+            set_unet_hidden_states("encoder_hidden_states", encoder_hidden_states);
         } else {
             ov::Shape enc_shape = encoder_hidden_states.get_shape();
             enc_shape[0] *= generation_config.num_images_per_prompt;
@@ -218,12 +269,12 @@ public:
                 }
             }
 
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
+            set_unet_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
         }
 
         if (unet_config.time_cond_proj_dim >= 0) { // LCM
             ov::Tensor timestep_cond = get_guidance_scale_embedding(generation_config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
-            m_unet->set_hidden_states("timestep_cond", timestep_cond);
+            set_unet_hidden_states("timestep_cond", timestep_cond);
         }
     }
 
@@ -288,6 +339,9 @@ public:
             }
             m_clip_text_encoder->set_adapters(adapters);
             m_unet->set_adapters(adapters);
+            for (const auto& unet_replica : m_unet_replicas) {
+                unet_replica->set_adapters(adapters);
+            }
         }
     }
 
@@ -307,6 +361,7 @@ public:
         if (callback_iter != properties.end()) {
             callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
         }
+        std::unique_ptr<LatentPreviewDecoder> preview_decoder = create_preview_decoder(properties);
 
         // Stable Diffusion pipeline
         // see https://huggingface.co/docs/diffusers/using-diffusers/write_own_pipeline#deconstruct-the-stable-diffusion-pipeline
@@ -330,6 +385,13 @@ public:
         // compute text encoders and set hidden states
         compute_hidden_states(positive_prompt, generation_config);
 
+        // the images are split across UNet and its replicas, the latents scaled on device by the scheduler step are not
+        const bool use_unet_replicas = !m_unet_replicas.empty() && generation_config.num_images_per_prompt > 1 &&
+                                       !use_device_scheduler_step();
+        if (use_unet_replicas) {
+            split_unet_hidden_states(generation_config.num_images_per_prompt, batch_size_multiplier);
+        }
+
         // preparate initial / image latents
         ov::Tensor latent, processed_image, image_latent, noise;
         std::tie(latent, processed_image, image_latent, noise) = prepare_latents(initial_image, generation_config);
@@ -337,53 +399,61 @@ public:
         // prepare mask latents
         ov::Tensor mask, masked_image_latent;
         if (m_pipeline_type == PipelineType::INPAINTING) {
-            std::tie(mask, masked_image_latent) = prepare_mask_latents(mask_image, processed_image, generation_config, batch_size_multiplier);
+            // the mask latents are repeated for CFG together with the latents by UNet
+            std::tie(mask, masked_image_latent) = prepare_mask_latents(mask_image, processed_image, generation_config, 1);
         }
 
-        // prepare latents passed to models taking into account guidance scale (batch size multipler)
-        ov::Shape latent_shape_cfg = latent.get_shape();
-        latent_shape_cfg[0] *= batch_size_multiplier;
+        // the scaled latents passed to the model, the latents are repeated for CFG (batch size multiplier) by UNet
+        ov::Tensor latent_scaled(ov::element::f32, latent.get_shape()), denoised, noisy_residual_tensor, model_input;
+        const bool use_device_step = use_device_scheduler_step();
 
-        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised, noisy_residual_tensor(ov::element::f32, {}), latent_model_input;
+        // the deep features are computed by the full UNet inference every 'feature_reuse_interval' steps
+        const bool reuse_features = generation_config.feature_reuse_interval > 1;
+        OPENVINO_ASSERT(!reuse_features || m_unet->supports_feature_reuse(),
+                        "Feature reuse is not supported by the UNet model: it requires the upsampler of the second last up block and no LoRA adapters");
 
+        // the input of the inpainting model is concatenated to the same buffer at each step
+        ov::Tensor inpainting_model_input(ov::element::f32, {});
         for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
             auto step_start = std::chrono::steady_clock::now();
-            numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
-            // concat the same latent twice along a batch dimension in case of CFG
-            if (batch_size_multiplier > 1) {
-                numpy_utils::batch_copy(latent, latent_cfg, 0, generation_config.num_images_per_prompt, generation_config.num_images_per_prompt);
+            ov::Tensor latent_model_input;
+            if (model_input) {
+                // the latents are scaled on device by the scheduler step of the previous iteration
+                latent_model_input = model_input;
+            } else {
+                latent.copy_to(latent_scaled);
+                m_scheduler->scale_model_input(latent_scaled, inference_step);
+                if (is_inpainting_model()) {
+                    numpy_utils::concat({latent_scaled, mask, masked_image_latent}, 1, inpainting_model_input);
+                    latent_model_input = inpainting_model_input;
+                } else {
+                    latent_model_input = latent_scaled;
+                }
             }
 
-            m_scheduler->scale_model_input(latent_cfg, inference_step);
-
-            ov::Tensor latent_model_input = is_inpainting_model() ? numpy_utils::concat(numpy_utils::concat(latent_cfg, mask, 1), masked_image_latent, 1) : latent_cfg;
             ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
             auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
-            auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
-            m_perf_metrics.raw_metrics.unet_inference_durations.emplace_back(MicroSeconds(infer_duration));
-
-            ov::Shape noise_pred_shape = noise_pred_tensor.get_shape();
-            noise_pred_shape[0] /= batch_size_multiplier;
-
-            if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
-
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
-                }
+            if (reuse_features) {
+                set_unet_feature_reuse(inference_step % generation_config.feature_reuse_interval != 0);
+            }
+            // perform guidance within the model
+            const std::optional<float> guidance_scale = batch_size_multiplier > 1 ? std::make_optional(generation_config.guidance_scale) : std::nullopt;
+            if (use_unet_replicas) {
+                noisy_residual_tensor = infer_unet_replicas(latent_model_input, timestep, guidance_scale);
             } else {
-                noisy_residual_tensor = noise_pred_tensor;
+                noisy_residual_tensor = guidance_scale ? m_unet->infer(latent_model_input, timestep, *guidance_scale) :
+                                                         m_unet->infer(latent_model_input, timestep);
             }
+            auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+            m_perf_metrics.raw_metrics.unet_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
-            auto scheduler_step_result = m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
+            auto scheduler_step_result = use_device_step ?
+                device_scheduler_step(noisy_residual_tensor, latent, inference_step, timesteps.size()) :
+                m_scheduler->step(noisy_residual_tensor, latent, inference_step, generation_config.generator);
             latent = scheduler_step_result["latent"];
+            if (use_device_step) {
+                model_input = scheduler_step_result["model_input"];
+            }
 
             // in case of non-specialized inpainting model, we need manually mask current denoised latent and initial image latent
             if (m_pipeline_type == PipelineType::INPAINTING && !is_inpainting_model()) {
@@ -394,22 +464,38 @@ public:
             const auto it = scheduler_step_result.find("denoised");
             denoised = it != scheduler_step_result.end() ? it->second : latent;
 
-            if (callback && callback(inference_step, timesteps.size(), denoised)) {
-                auto step_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
-                m_perf_metrics.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_ms));
+            if (preview_decoder && !preview_decoder->is_busy()) {
+                preview_decoder->submit(inference_step, timesteps.size(), use_device_step ? copy_to_host(denoised) : denoised);
+            }
 
-                auto image = ov::Tensor(ov::element::u8, {});
-                m_perf_metrics.generate_duration =
-                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gen_start)
-                        .count();
-                return image;
+            if (callback) {
+                ov::Tensor callback_latent = use_device_step ? copy_to_host(denoised) : denoised;
+                if (callback(inference_step, timesteps.size(), callback_latent)) {
+                    if (reuse_features) {
+                        set_unet_feature_reuse(false);
+                    }
+                    auto step_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
+                    m_perf_metrics.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_ms));
+
+                    auto image = ov::Tensor(ov::element::u8, {});
+                    m_perf_metrics.generate_duration =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gen_start)
+                            .count();
+                    return image;
+                }
             }
 
             auto step_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
             m_perf_metrics.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_ms));
         }
+        if (reuse_features) {
+            set_unet_feature_reuse(false);
+        }
+        if (preview_decoder) {
+            preview_decoder->finish();
+        }
         auto decode_start = std::chrono::steady_clock::now();
-        auto image = decode(denoised);
+        auto image = decode(use_device_step ? copy_to_host(denoised) : denoised);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -424,10 +510,104 @@ public:
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
         m_perf_metrics.load_time = m_load_time_ms;
+        m_perf_metrics.model_load_times = m_model_load_times_ms;
         return m_perf_metrics;
     }
 
 protected:
+    // sets the hidden states to UNet and keeps them, so that the batching engine collects them for each request
+    void set_unet_hidden_states(const std::string& tensor_name, ov::Tensor hidden_states) {
+        if (!m_defer_unet_hidden_states) {
+            m_unet->set_hidden_states(tensor_name, hidden_states);
+        }
+        m_unet_hidden_states[tensor_name] = hidden_states;
+    }
+
+    // extracts 'data_parallel_devices', so that it's not passed to the models
+    static std::vector<std::string> extract_data_parallel_devices(utils::SharedOptional<const ov::AnyMap>& properties) {
+        auto it = properties->find(ov::genai::data_parallel_devices.name());
+        if (it == properties->end()) {
+            return {};
+        }
+        std::vector<std::string> devices = it->second.as<std::vector<std::string>>();
+        properties.fork().erase(ov::genai::data_parallel_devices.name());
+        return devices;
+    }
+
+    void set_unet_feature_reuse(bool reuse_features) {
+        m_unet->set_feature_reuse(reuse_features);
+        for (const auto& unet_replica : m_unet_replicas) {
+            unet_replica->set_feature_reuse(reuse_features);
+        }
+    }
+
+    // splits the images across UNet and its replicas and sets the hidden states of their rows of the batch
+    void split_unet_hidden_states(size_t num_images, size_t batch_size_multiplier) {
+        const size_t num_unets = std::min(m_unet_replicas.size() + 1, num_images);
+        m_unet_replica_rows.assign(num_unets, num_images / num_unets);
+        for (size_t i = 0; i < num_images % num_unets; ++i) {
+            ++m_unet_replica_rows[i];
+        }
+
+        size_t begin_row = 0;
+        for (size_t i = 0; i < num_unets; ++i) {
+            UNet2DConditionModel& unet = i == 0 ? *m_unet : *m_unet_replicas[i - 1];
+            const size_t num_rows = m_unet_replica_rows[i];
+            for (const auto& [name, hidden_states] : m_unet_hidden_states) {
+                ov::Shape shape = hidden_states.get_shape();
+                if (shape[0] == 1) {
+                    // e.g. LCM 'timestep_cond' is shared by the whole batch
+                    unet.set_hidden_states(name, hidden_states);
+                    continue;
+                }
+                OPENVINO_ASSERT(shape[0] == num_images * batch_size_multiplier, "Unexpected batch of '", name, "' hidden states: ", shape[0]);
+                shape[0] = num_rows * batch_size_multiplier;
+                ov::Tensor replica_hidden_states(hidden_states.get_element_type(), shape);
+                // the rows of classifier-free guidance are in two halves of the batch
+                for (size_t half = 0; half < batch_size_multiplier; ++half) {
+                    numpy_utils::batch_copy(hidden_states, replica_hidden_states, half * num_images + begin_row, half * num_rows, num_rows);
+                }
+                unet.set_hidden_states(name, replica_hidden_states);
+            }
+            begin_row += num_rows;
+        }
+    }
+
+    // infers UNet and its replicas on their rows of the batch in parallel and merges the noise predictions in order
+    ov::Tensor infer_unet_replicas(ov::Tensor sample, ov::Tensor timestep, std::optional<float> guidance_scale) {
+        std::vector<std::future<ov::Tensor>> noise_preds;
+        size_t begin_row = 0;
+        for (size_t i = 0; i < m_unet_replica_rows.size(); ++i) {
+            ov::Shape shape = sample.get_shape();
+            shape[0] = m_unet_replica_rows[i];
+            ov::Tensor replica_sample(sample.get_element_type(), shape);
+            numpy_utils::batch_copy(sample, replica_sample, begin_row, 0, shape[0]);
+            begin_row += shape[0];
+
+            // the main UNet is inferred by the current thread
+            std::shared_ptr<UNet2DConditionModel> unet = i == 0 ? m_unet : m_unet_replicas[i - 1];
+            noise_preds.push_back(std::async(i == 0 ? std::launch::deferred : std::launch::async,
+                [unet, replica_sample, timestep, guidance_scale] {
+                    return guidance_scale ? unet->infer(replica_sample, timestep, *guidance_scale) : unet->infer(replica_sample, timestep);
+                }));
+        }
+
+        std::vector<ov::Tensor> replica_noise_preds;
+        for (auto& noise_pred : noise_preds) {
+            replica_noise_preds.push_back(noise_pred.get());
+        }
+        ov::Shape shape = replica_noise_preds.front().get_shape();
+        shape[0] = sample.get_shape()[0];
+        ov::Tensor noise_pred(replica_noise_preds.front().get_element_type(), shape);
+        begin_row = 0;
+        for (const ov::Tensor& replica_noise_pred : replica_noise_preds) {
+            const size_t num_rows = replica_noise_pred.get_shape()[0];
+            numpy_utils::batch_copy(replica_noise_pred, noise_pred, 0, begin_row, num_rows);
+            begin_row += num_rows;
+        }
+        return noise_pred;
+    }
+
     size_t get_config_in_channels() const override {
         assert(m_unet != nullptr);
         return m_unet->get_config().in_channels;
@@ -513,9 +693,19 @@ protected:
 
     friend class Text2ImagePipeline;
     friend class Image2ImagePipeline;
+    friend class ImageGenerationEngine;
+    friend class StagedImageGenerationExecutor;
 
     std::shared_ptr<CLIPTextModel> m_clip_text_encoder = nullptr;
     std::shared_ptr<UNet2DConditionModel> m_unet = nullptr;
+    // the replicas of UNet on 'data_parallel_devices', which denoise the images of a batch in parallel with 'm_unet'
+    std::vector<std::shared_ptr<UNet2DConditionModel>> m_unet_replicas;
+    // the numbers of images denoised by 'm_unet' and the replicas, set by 'split_unet_hidden_states()'
+    std::vector<size_t> m_unet_replica_rows;
+    // the hidden states set by the last 'compute_hidden_states()'
+    std::map<std::string, ov::Tensor> m_unet_hidden_states;
+    // the hidden states are only kept, while UNet is inferred by another stage of the staged executor
+    bool m_defer_unet_hidden_states = false;
 };
 
 }  // namespace genai
@@ -60,6 +60,7 @@ public:
         } else {
             OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
         }
+        load_preview_vae(root_dir);
 
         // initialize generation config
         initialize_generation_config(data["_class_name"].get<std::string>());
@@ -81,54 +82,66 @@ public:
         set_scheduler(Scheduler::from_config(root_dir / "scheduler/scheduler_config.json"));
 
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
+        const std::vector<std::string> data_parallel_devices = extract_data_parallel_devices(updated_properties);
         // updated_properies are for passing to the pipeline subcomponents only, not for the generation config
+        const ov::AnyMap text_encoder_properties = *properties_for_text_encoder(*updated_properties, "lora_te1");
+        const ov::AnyMap text_encoder_2_properties = *properties_for_text_encoder(*updated_properties, "lora_te2");
+        const ov::AnyMap unet_properties = *updated_properties;
+
+        // Temporary fix for GPU
+        if (device.find("GPU") != std::string::npos &&
+            updated_properties->find("INFERENCE_PRECISION_HINT") == updated_properties->end()) {
+            updated_properties.fork()["WA_INFERENCE_PRECISION_HINT"] = ov::element::f32;
+        }
+        const ov::AnyMap& vae_properties = *updated_properties;
 
         const std::string text_encoder = data["text_encoder"][1].get<std::string>();
-        if (text_encoder == "CLIPTextModel") {
-            m_clip_text_encoder = std::make_shared<CLIPTextModel>(
-                root_dir / "text_encoder",
-                device,
-                *properties_for_text_encoder(*updated_properties, "lora_te1")
-            );
-        } else {
+        if (text_encoder != "CLIPTextModel") {
             OPENVINO_THROW("Unsupported '", text_encoder, "' text encoder type");
         }
 
         const std::string text_encoder_2 = data["text_encoder_2"][1].get<std::string>();
-        if (text_encoder_2 == "CLIPTextModelWithProjection") {
-            m_clip_text_encoder_with_projection = std::make_shared<CLIPTextModelWithProjection>(
-                root_dir / "text_encoder_2",
-                device,
-                *properties_for_text_encoder(*updated_properties, "lora_te2")
-            );
-        } else {
+        if (text_encoder_2 != "CLIPTextModelWithProjection") {
             OPENVINO_THROW("Unsupported '", text_encoder_2, "' text encoder type");
         }
 
         const std::string unet = data["unet"][1].get<std::string>();
-        if (unet == "UNet2DConditionModel") {
-            m_unet = std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, *updated_properties);
-        } else {
+        if (unet != "UNet2DConditionModel") {
             OPENVINO_THROW("Unsupported '", unet, "' UNet type");
         }
 
-        // Temporary fix for GPU
-        if (device.find("GPU") != std::string::npos &&
-            updated_properties->find("INFERENCE_PRECISION_HINT") == updated_properties->end()) {
-            updated_properties.fork()["WA_INFERENCE_PRECISION_HINT"] = ov::element::f32;
+        const std::string vae = data["vae"][1].get<std::string>();
+        if (vae != "AutoencoderKL") {
+            OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
         }
 
-        const std::string vae = data["vae"][1].get<std::string>();
-        if (vae == "AutoencoderKL") {
+        // the models are independent, so they are compiled concurrently
+        utils::AsyncModelLoad<std::shared_ptr<CLIPTextModel>> text_encoder_load("text_encoder", [&] {
+            return std::make_shared<CLIPTextModel>(root_dir / "text_encoder", device, text_encoder_properties);
+        });
+        utils::AsyncModelLoad<std::shared_ptr<CLIPTextModelWithProjection>> text_encoder_2_load("text_encoder_2", [&] {
+            return std::make_shared<CLIPTextModelWithProjection>(root_dir / "text_encoder_2", device, text_encoder_2_properties);
+        });
+        utils::AsyncModelLoad<std::shared_ptr<UNet2DConditionModel>> unet_load("unet", [&] {
+            return std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, unet_properties);
+        });
+        utils::AsyncModelLoad<std::shared_ptr<AutoencoderKL>> vae_load("vae", [&] {
             if (m_pipeline_type == PipelineType::TEXT_2_IMAGE)
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, *updated_properties);
-            else if (m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING) {
-                m_vae = std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, *updated_properties);
-            } else {
-                OPENVINO_ASSERT("Unsupported pipeline type");
-            }
-        } else {
-            OPENVINO_THROW("Unsupported '", vae, "' VAE decoder type");
+                return std::make_shared<AutoencoderKL>(root_dir / "vae_decoder", device, vae_properties);
+            OPENVINO_ASSERT(m_pipeline_type == PipelineType::IMAGE_2_IMAGE || m_pipeline_type == PipelineType::INPAINTING,
+                            "Unsupported pipeline type");
+            return std::make_shared<AutoencoderKL>(root_dir / "vae_encoder", root_dir / "vae_decoder", device, vae_properties);
+        });
+        m_clip_text_encoder = text_encoder_load.get(m_model_load_times_ms);
+        m_clip_text_encoder_with_projection = text_encoder_2_load.get(m_model_load_times_ms);
+        m_unet = unet_load.get(m_model_load_times_ms);
+        m_vae = vae_load.get(m_model_load_times_ms);
+        for (const std::string& replica_device : data_parallel_devices) {
+            m_unet_replicas.push_back(std::make_shared<UNet2DConditionModel>(root_dir / "unet", replica_device, unet_properties));
+        }
+        load_preview_vae(root_dir);
+        if (m_preview_vae) {
+            m_preview_vae->compile(device, vae_properties);
         }
 
         // initialize generation config
@@ -138,6 +151,8 @@ public:
         read_json_param(data, "force_zeros_for_empty_prompt", m_force_zeros_for_empty_prompt);
 
         update_adapters_from_properties(properties, m_generation_config.adapters);
+
+        init_device_scheduler_step(device, *updated_properties);
     }
 
     StableDiffusionXLPipeline(
@@ -164,7 +179,14 @@ public:
         m_clip_text_encoder = std::make_shared<CLIPTextModel>(*pipe.m_clip_text_encoder);
         m_clip_text_encoder_with_projection = std::make_shared<CLIPTextModelWithProjection>(*pipe.m_clip_text_encoder_with_projection);
         m_unet = std::make_shared<UNet2DConditionModel>(*pipe.m_unet);
+        m_unet_replicas.clear();
+        for (const auto& unet_replica : pipe.m_unet_replicas) {
+            m_unet_replicas.push_back(std::make_shared<UNet2DConditionModel>(*unet_replica));
+        }
         m_vae = std::make_shared<AutoencoderKL>(*pipe.m_vae);
+        if (pipe.m_preview_vae) {
+            m_preview_vae = std::make_shared<AutoencoderKL>(*pipe.m_preview_vae);
+        }
 
         m_pipeline_type = pipeline_type;
         initialize_generation_config("StableDiffusionXLPipeline");
@@ -179,6 +201,9 @@ public:
 
         m_unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
         m_vae->reshape(num_images_per_prompt, height, width);
+        if (m_preview_vae) {
+            m_preview_vae->reshape(num_images_per_prompt, height, width);
+        }
     }
 
     void compile(const std::string& text_encode_device,
@@ -187,11 +212,22 @@ public:
                  const ov::AnyMap& properties) override {
         update_adapters_from_properties(properties, m_generation_config.adapters);
         auto updated_properties = update_adapters_in_properties(properties, &DiffusionPipeline::derived_adapters);
+        const std::vector<std::string> data_parallel_devices = extract_data_parallel_devices(updated_properties);
         // updated_properies are for passing to the pipeline subcomponents only, not for the generation config
         m_clip_text_encoder->compile(text_encode_device, *updated_properties);
         m_clip_text_encoder_with_projection->compile(text_encode_device, *updated_properties);
+        // the replicas are cloned before the model is compiled
+        for (const std::string& replica_device : data_parallel_devices) {
+            auto unet_replica = std::make_shared<UNet2DConditionModel>(m_unet->clone());
+            unet_replica->compile(replica_device, *updated_properties);
+            m_unet_replicas.push_back(unet_replica);
+        }
         m_unet->compile(denoise_device, *updated_properties);
         m_vae->compile(vae_device, *updated_properties);
+        if (m_preview_vae) {
+            m_preview_vae->compile(vae_device, *updated_properties);
+        }
+        init_device_scheduler_step(denoise_device, *updated_properties);
     }
 
     std::shared_ptr<DiffusionPipeline> clone() override {
@@ -209,8 +245,17 @@ public:
             *vae);
 
         pipeline->m_root_dir = m_root_dir;
+        for (const auto& unet_replica : m_unet_replicas) {
+            pipeline->m_unet_replicas.push_back(std::make_shared<UNet2DConditionModel>(unet_replica->clone()));
+        }
+        if (m_preview_vae) {
+            pipeline->m_preview_vae = std::make_shared<AutoencoderKL>(m_preview_vae->clone());
+        }
         pipeline->set_scheduler(Scheduler::from_config(m_root_dir / "scheduler/scheduler_config.json"));
         pipeline->set_generation_config(m_generation_config);
+        if (m_scheduler_step) {
+            pipeline->m_scheduler_step = m_scheduler_step->clone();
+        }
         return pipeline;
     }
 
@@ -317,9 +362,9 @@ public:
         // replicate encoder hidden state to UNet model
         if (generation_config.num_images_per_prompt == 1) {
             // reuse output of text encoder directly w/o extra memory copy
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
-            m_unet->set_hidden_states("text_embeds", add_text_embeds);
-            m_unet->set_hidden_states("time_ids", add_time_ids);
+            set_unet_hidden_states("encoder_hidden_states", encoder_hidden_states);
+            set_unet_hidden_states("text_embeds", add_text_embeds);
+            set_unet_hidden_states("time_ids", add_time_ids);
         } else {
             ov::Shape enc_shape = encoder_hidden_states.get_shape();
             enc_shape[0] *= generation_config.num_images_per_prompt;
@@ -333,7 +378,7 @@ public:
                 }
             }
 
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
+            set_unet_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
 
             ov::Shape t_emb_shape = add_text_embeds.get_shape();
             t_emb_shape[0] *= generation_config.num_images_per_prompt;
@@ -347,7 +392,7 @@ public:
                 }
             }
 
-            m_unet->set_hidden_states("text_embeds", add_text_embeds_repeated);
+            set_unet_hidden_states("text_embeds", add_text_embeds_repeated);
 
             ov::Shape t_ids_shape = add_time_ids.get_shape();
             t_ids_shape[0] *= generation_config.num_images_per_prompt;
@@ -360,12 +405,12 @@ public:
                 }
             }
 
-            m_unet->set_hidden_states("time_ids", add_time_ids_repeated);
+            set_unet_hidden_states("time_ids", add_time_ids_repeated);
         }
 
         if (unet_config.time_cond_proj_dim >= 0) { // LCM
             ov::Tensor timestep_cond = get_guidance_scale_embedding(generation_config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
-            m_unet->set_hidden_states("timestep_cond", timestep_cond);
+            set_unet_hidden_states("timestep_cond", timestep_cond);
         }
     }
 
@@ -377,6 +422,9 @@ public:
             m_clip_text_encoder->set_adapters(adapters);
             m_clip_text_encoder_with_projection->set_adapters(adapters);
             m_unet->set_adapters(adapters);
+            for (const auto& unet_replica : m_unet_replicas) {
+                unet_replica->set_adapters(adapters);
+            }
         }
     }
 
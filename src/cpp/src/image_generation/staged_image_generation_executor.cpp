@@ -0,0 +1,174 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/staged_image_generation_executor.hpp"
+
+namespace ov {
+namespace genai {
+
+StagedImageGenerationExecutor::StagedImageGenerationExecutor(std::shared_ptr<StableDiffusionPipeline> pipeline)
+    : m_pipeline(std::move(pipeline)) {
+    OPENVINO_ASSERT(m_pipeline->m_pipeline_type == PipelineType::TEXT_2_IMAGE, "Staged execution supports text to image generation only");
+
+    // the stages use the text encoders and UNet concurrently, so the adapters are applied once
+    m_pipeline->set_lora_adapters(m_pipeline->get_generation_config().adapters);
+
+    m_encode_thread = std::thread([this] {
+        run_stage(m_encode_queue, &m_denoise_queue, [this](Request& request) {
+            encode(request);
+            return true;
+        });
+    });
+    m_denoise_thread = std::thread([this] {
+        run_stage(m_denoise_queue, &m_decode_queue, [this](Request& request) {
+            return denoise(request);
+        });
+    });
+    m_decode_thread = std::thread([this] {
+        run_stage(m_decode_queue, nullptr, [this](Request& request) {
+            request.state->image = m_pipeline->decode(request.denoised);
+            request.state->set_status(GenerationStatus::FINISHED);
+            return true;
+        });
+    });
+}
+
+StagedImageGenerationExecutor::~StagedImageGenerationExecutor() {
+    m_encode_queue.push(nullptr);
+    m_encode_thread.join();
+    m_denoise_thread.join();
+    m_decode_thread.join();
+}
+
+ImageGenerationHandle StagedImageGenerationExecutor::add_request(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    OPENVINO_ASSERT(properties.find(ov::genai::adapters.name()) == properties.end(),
+                    "LoRA adapters are shared by the stages, set them to the pipeline generation config");
+
+    auto request = std::make_shared<Request>();
+    request->positive_prompt = positive_prompt;
+    request->config = m_pipeline->get_generation_config();
+    request->config.update_generation_config(properties);
+
+    auto callback_iter = properties.find(ov::genai::callback.name());
+    if (callback_iter != properties.end()) {
+        request->callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
+    }
+
+    m_pipeline->compute_dim(request->config.height, {}, 1 /* assume NHWC */);
+    m_pipeline->compute_dim(request->config.width, {}, 2 /* assume NHWC */);
+    m_pipeline->check_inputs(request->config, {});
+    OPENVINO_ASSERT(request->config.feature_reuse_interval == 1 || m_pipeline->m_unet->supports_feature_reuse(),
+                    "Feature reuse is not supported by the UNet model: it requires the upsampler of the second last up block and no LoRA adapters");
+
+    request->state = std::make_shared<ImageGenerationRequestState>();
+    ImageGenerationHandle handle = std::make_shared<ImageGenerationHandleImpl>(request->state);
+    m_encode_queue.push(request);
+
+    return handle;
+}
+
+void StagedImageGenerationExecutor::run_stage(SynchronizedQueue<RequestPtr>& input,
+                                              SynchronizedQueue<RequestPtr>* output,
+                                              const std::function<bool(Request&)>& process) {
+    for (RequestPtr request = input.pull(); request; request = input.pull()) {
+        if (request->state->cancelled) {
+            request->state->set_status(GenerationStatus::CANCEL);
+            continue;
+        }
+
+        bool processed = false;
+        try {
+            processed = process(*request);
+        } catch (...) {
+            request->state->error = std::current_exception();
+        }
+
+        if (!processed) {
+            request->state->set_status(GenerationStatus::CANCEL);
+        } else if (output) {
+            output->push(request);
+        }
+    }
+
+    if (output) {
+        output->push(nullptr);
+    }
+}
+
+void StagedImageGenerationExecutor::encode(Request& request) {
+    // UNet may be inferred by the denoising stage, so the hidden states are only collected
+    m_pipeline->m_unet_hidden_states.clear();
+    m_pipeline->m_defer_unet_hidden_states = true;
+    try {
+        m_pipeline->compute_hidden_states(request.positive_prompt, request.config);
+    } catch (...) {
+        m_pipeline->m_defer_unet_hidden_states = false;
+        throw;
+    }
+    m_pipeline->m_defer_unet_hidden_states = false;
+
+    // the hidden states may refer to the outputs of the text encoders, which are overwritten by the next request
+    for (const auto& [name, hidden_states] : m_pipeline->m_unet_hidden_states) {
+        ov::Tensor hidden_states_copy(hidden_states.get_element_type(), hidden_states.get_shape());
+        hidden_states.copy_to(hidden_states_copy);
+        request.hidden_states[name] = hidden_states_copy;
+    }
+}
+
+bool StagedImageGenerationExecutor::denoise(Request& request) {
+    const ImageGenerationConfig& config = request.config;
+    const std::shared_ptr<UNet2DConditionModel>& unet = m_pipeline->m_unet;
+    const bool do_classifier_free_guidance = unet->do_classifier_free_guidance(config.guidance_scale);
+
+    for (const auto& [name, hidden_states] : request.hidden_states) {
+        unet->set_hidden_states(name, hidden_states);
+    }
+
+    const std::shared_ptr<IScheduler>& scheduler = m_pipeline->m_scheduler;
+    scheduler->set_timesteps(config.num_inference_steps, config.strength);
+    std::vector<std::int64_t> timesteps = scheduler->get_timesteps();
+
+    ov::Tensor latent = std::get<0>(m_pipeline->prepare_latents({}, config));
+    ov::Tensor latent_scaled(ov::element::f32, latent.get_shape());
+
+    const bool reuse_features = config.feature_reuse_interval > 1;
+    for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
+        latent.copy_to(latent_scaled);
+        scheduler->scale_model_input(latent_scaled, inference_step);
+
+        ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
+        if (reuse_features) {
+            unet->set_feature_reuse(inference_step % config.feature_reuse_interval != 0);
+        }
+        ov::Tensor noise_pred = do_classifier_free_guidance ? unet->infer(latent_scaled, timestep, config.guidance_scale)
+                                                            : unet->infer(latent_scaled, timestep);
+
+        auto scheduler_step_result = scheduler->step(noise_pred, latent, inference_step, config.generator);
+        latent = scheduler_step_result["latent"];
+
+        // check whether scheduler returns "denoised" image, which should be passed to VAE decoder
+        const auto it = scheduler_step_result.find("denoised");
+        request.denoised = it != scheduler_step_result.end() ? it->second : latent;
+
+        if (request.state->cancelled ||
+            (request.callback && request.callback(inference_step, timesteps.size(), request.denoised))) {
+            if (reuse_features) {
+                unet->set_feature_reuse(false);
+            }
+            return false;
+        }
+    }
+    if (reuse_features) {
+        unet->set_feature_reuse(false);
+    }
+
+    // the scheduler may reuse its output for the next request, while the image is decoded
+    ov::Tensor denoised(request.denoised.get_element_type(), request.denoised.get_shape());
+    request.denoised.copy_to(denoised);
+    request.denoised = denoised;
+
+    return true;
+}
+
+}  // namespace genai
+}  // namespace ov
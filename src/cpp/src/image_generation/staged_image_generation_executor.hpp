@@ -0,0 +1,67 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "openvino/genai/image_generation/image_generation_handle.hpp"
+
+#include "image_generation/image_generation_engine.hpp"
+#include "image_generation/stable_diffusion_pipeline.hpp"
+#include "synchronized_queue.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * Processes the requests of Stable Diffusion (XL) pipeline by three stages running in their own threads: text encoding,
+ * denoising and VAE decoding. Each model is used by a single stage, so while a request is denoised, the text of
+ * the next request is encoded and the image of the previous request is decoded, which hides the text encoders and VAE
+ * latency, when they are compiled on other devices than UNet.
+ */
+class StagedImageGenerationExecutor {
+public:
+    explicit StagedImageGenerationExecutor(std::shared_ptr<StableDiffusionPipeline> pipeline);
+
+    // waits for the stages to process the queued requests
+    ~StagedImageGenerationExecutor();
+
+    ImageGenerationHandle add_request(const std::string& positive_prompt, const ov::AnyMap& properties);
+
+private:
+    struct Request {
+        std::string positive_prompt;
+        ImageGenerationConfig config;
+        std::function<bool(size_t, size_t, ov::Tensor&)> callback = nullptr;
+        std::shared_ptr<ImageGenerationRequestState> state;
+
+        // the copies of UNet hidden states computed by the text encoding stage
+        std::map<std::string, ov::Tensor> hidden_states;
+        // the denoised latent passed to the decoding stage
+        ov::Tensor denoised;
+    };
+    // nullptr stops the stage and the next ones
+    using RequestPtr = std::shared_ptr<Request>;
+
+    void encode(Request& request);
+    // returns false, if the request is cancelled by the callback
+    bool denoise(Request& request);
+
+    // runs 'process' for the requests from 'input' and passes them to 'output', if it's not nullptr
+    void run_stage(SynchronizedQueue<RequestPtr>& input,
+                   SynchronizedQueue<RequestPtr>* output,
+                   const std::function<bool(Request&)>& process);
+
+    std::shared_ptr<StableDiffusionPipeline> m_pipeline;
+
+    SynchronizedQueue<RequestPtr> m_encode_queue, m_denoise_queue, m_decode_queue;
+    std::thread m_encode_thread, m_denoise_thread, m_decode_thread;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -1,9 +1,12 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <array>
 #include <ctime>
 #include <cstdlib>
 #include <filesystem>
+#include <mutex>
 
 #include "openvino/genai/image_generation/text2image_pipeline.hpp"
 
@@ -11,12 +14,106 @@
 #include "image_generation/stable_diffusion_xl_pipeline.hpp"
 #include "image_generation/stable_diffusion_3_pipeline.hpp"
 #include "image_generation/flux_pipeline.hpp"
+#include "image_generation/image_generation_engine.hpp"
+#include "image_generation/staged_image_generation_executor.hpp"
+#include "image_generation/device_placement.hpp"
 
+#include "openvino/runtime/intel_gpu/properties.hpp"
+
+#include "continuous_batching/reserved_memory.hpp"
+#include "logger.hpp"
 #include "utils.hpp"
 
 namespace ov {
 namespace genai {
 
+namespace {
+
+// guards the creation of the batching engines and the staged executors by concurrent 'add_request()' and
+// 'generate_async()' calls
+std::mutex engine_creation_mutex;
+
+// sizes of the weights of the models of the placement stages
+std::array<size_t, NUM_PLACEMENT_STAGES> get_weights_sizes(const std::filesystem::path& root_dir) {
+    auto get_weights_size = [&root_dir](std::initializer_list<const char*> model_dirs) {
+        size_t weights_size = 0;
+        for (const char* model_dir : model_dirs) {
+            const std::filesystem::path weights_path = root_dir / model_dir / "openvino_model.bin";
+            if (std::filesystem::exists(weights_path)) {
+                weights_size += std::filesystem::file_size(weights_path);
+            }
+        }
+        return weights_size;
+    };
+    return {get_weights_size({"text_encoder", "text_encoder_2", "text_encoder_3"}),
+            get_weights_size({"unet", "transformer"}),
+            get_weights_size({"vae_decoder"})};
+}
+
+// measures the latencies of the stages of a short generation with all the models compiled on the device
+DeviceProfile profile_device(const std::filesystem::path& root_dir, const std::string& device, const ov::AnyMap& properties) {
+    Text2ImagePipeline pipe(root_dir);
+    pipe.compile(device, properties);
+    // the first generation compiles the dynamic shapes and allocates the buffers
+    pipe.generate("device placement", ov::genai::num_inference_steps(1));
+    pipe.generate("device placement", ov::genai::num_inference_steps(2));
+    ImageGenerationPerfMetrics perf_metrics = pipe.get_performance_metrics();
+
+    DeviceProfile profile;
+    for (const auto& [name, duration] : perf_metrics.get_text_encoder_infer_duration()) {
+        profile.latencies_ms[TEXT_ENCODE] += duration;
+    }
+    const RawImageGenerationPerfMetrics& raw_metrics = perf_metrics.raw_metrics;
+    const std::vector<MicroSeconds>& step_durations = raw_metrics.unet_inference_durations.empty() ?
+        raw_metrics.transformer_inference_durations : raw_metrics.unet_inference_durations;
+    for (const MicroSeconds& duration : step_durations) {
+        profile.latencies_ms[DENOISE] += duration.count() / 1000.0f / step_durations.size();
+    }
+    profile.latencies_ms[VAE_DECODE] = perf_metrics.get_vae_decoder_infer_duration();
+
+    if (device.find("GPU") != std::string::npos) {
+        profile.memory_pool = device;
+        profile.memory_limit = utils::singleton_core().get_property(device, ov::intel_gpu::device_total_mem_size);
+    } else {
+        // e.g. CPU and NPU share the host memory
+        profile.memory_pool = "HOST";
+        profile.memory_limit = ReservedMemory::get_total_physical_memory();
+    }
+    return profile;
+}
+
+DevicePlacement plan_device_placement(const std::filesystem::path& root_dir,
+                                      const std::vector<std::string>& devices,
+                                      const std::optional<std::filesystem::path>& cache_path,
+                                      const ov::AnyMap& properties) {
+    if (cache_path) {
+        if (std::optional<DevicePlacement> placement = load_device_placement(*cache_path, devices)) {
+            return *placement;
+        }
+    }
+
+    std::map<std::string, DeviceProfile> profiles;
+    for (const std::string& device : devices) {
+        try {
+            profiles[device] = profile_device(root_dir, device, properties);
+        } catch (const std::exception& e) {
+            Logger::warn("Device " + device + " is excluded from the device placement: " + e.what());
+        }
+    }
+    OPENVINO_ASSERT(!profiles.empty(), "None of the placement devices can run the pipeline");
+
+    const size_t num_inference_steps = Text2ImagePipeline(root_dir).get_generation_config().num_inference_steps;
+    std::optional<DevicePlacement> placement = select_device_placement(profiles, get_weights_sizes(root_dir), num_inference_steps);
+    OPENVINO_ASSERT(placement, "The models don't fit the memory of the placement devices");
+
+    if (cache_path) {
+        save_device_placement(*cache_path, devices, *placement);
+    }
+    return *placement;
+}
+
+}  // namespace
+
 Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir) {
     const std::string class_name = get_class_name(root_dir);
 
@@ -37,6 +134,31 @@ Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir) {
 }
 
 Text2ImagePipeline::Text2ImagePipeline(const std::filesystem::path& root_dir, const std::string& device, const ov::AnyMap& properties) {
+    auto placement_devices_iter = properties.find(ov::genai::placement_devices.name());
+    if (placement_devices_iter != properties.end()) {
+        // the device is a candidate as well, the candidates are deduplicated to match the saved placement
+        std::vector<std::string> devices = placement_devices_iter->second.as<std::vector<std::string>>();
+        devices.push_back(device);
+        std::sort(devices.begin(), devices.end());
+        devices.erase(std::unique(devices.begin(), devices.end()), devices.end());
+
+        ov::AnyMap model_properties = properties;
+        model_properties.erase(ov::genai::placement_devices.name());
+        std::optional<std::filesystem::path> cache_path;
+        auto cache_path_iter = model_properties.find(ov::genai::placement_cache_path.name());
+        if (cache_path_iter != model_properties.end()) {
+            cache_path = cache_path_iter->second.as<std::string>();
+            model_properties.erase(cache_path_iter);
+        }
+
+        const DevicePlacement placement = plan_device_placement(root_dir, devices, cache_path, model_properties);
+        m_impl = Text2ImagePipeline(root_dir).m_impl;
+        auto start_time = std::chrono::steady_clock::now();
+        m_impl->compile(placement[TEXT_ENCODE], placement[DENOISE], placement[VAE_DECODE], model_properties);
+        m_impl->save_load_time(start_time);
+        return;
+    }
+
     const std::string class_name = get_class_name(root_dir);
 
     auto start_time = std::chrono::steady_clock::now();
@@ -181,6 +303,19 @@ void Text2ImagePipeline::set_generation_config(const ImageGenerationConfig& gene
     m_impl->set_generation_config(generation_config);
 }
 
+void Text2ImagePipeline::warmup(const WarmupConfig& config) {
+    ov::AnyMap properties{ov::genai::num_inference_steps(1)};
+    if (config.image_size > 0) {
+        properties[ov::genai::height.name()] = static_cast<int64_t>(config.image_size);
+        properties[ov::genai::width.name()] = static_cast<int64_t>(config.image_size);
+    }
+    for (size_t batch_size : config.batch_sizes) {
+        OPENVINO_ASSERT(batch_size > 0, "WarmupConfig batch sizes must be positive");
+        properties[ov::genai::num_images_per_prompt.name()] = batch_size;
+        m_impl->generate("warm up", {}, {}, properties);
+    }
+}
+
 void Text2ImagePipeline::set_scheduler(std::shared_ptr<Scheduler> scheduler) {
     m_impl->set_scheduler(scheduler);
 }
@@ -219,6 +354,52 @@ ov::Tensor Text2ImagePipeline::generate(const std::string& positive_prompt, cons
     return m_impl->generate(positive_prompt, {}, {}, properties);
 }
 
+ImageGenerationHandle Text2ImagePipeline::add_request(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    std::shared_ptr<ImageGenerationEngine> engine;
+    {
+        std::lock_guard<std::mutex> lock(engine_creation_mutex);
+        if (!m_engine) {
+            auto stable_diffusion = std::dynamic_pointer_cast<StableDiffusionPipeline>(m_impl);
+            OPENVINO_ASSERT(stable_diffusion != nullptr,
+                            "Request batching is supported by Stable Diffusion, Stable Diffusion XL and Latent Consistency Model pipelines only");
+            m_engine = std::make_shared<ImageGenerationEngine>(stable_diffusion);
+        }
+        engine = m_engine;
+    }
+    return engine->add_request(positive_prompt, properties);
+}
+
+void Text2ImagePipeline::step() {
+    std::shared_ptr<ImageGenerationEngine> engine;
+    {
+        std::lock_guard<std::mutex> lock(engine_creation_mutex);
+        engine = m_engine;
+    }
+    if (engine) {
+        engine->step();
+    }
+}
+
+bool Text2ImagePipeline::has_non_finished_requests() {
+    std::lock_guard<std::mutex> lock(engine_creation_mutex);
+    return m_engine && m_engine->has_non_finished_requests();
+}
+
+ImageGenerationHandle Text2ImagePipeline::generate_async(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    std::shared_ptr<StagedImageGenerationExecutor> staged_executor;
+    {
+        std::lock_guard<std::mutex> lock(engine_creation_mutex);
+        if (!m_staged_executor) {
+            auto stable_diffusion = std::dynamic_pointer_cast<StableDiffusionPipeline>(m_impl);
+            OPENVINO_ASSERT(stable_diffusion != nullptr,
+                            "Staged execution is supported by Stable Diffusion, Stable Diffusion XL and Latent Consistency Model pipelines only");
+            m_staged_executor = std::make_shared<StagedImageGenerationExecutor>(stable_diffusion);
+        }
+        staged_executor = m_staged_executor;
+    }
+    return staged_executor->add_request(positive_prompt, properties);
+}
+
 ov::Tensor Text2ImagePipeline::decode(const ov::Tensor latent) {
     return m_impl->decode(latent);
 }
@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/json_streamer.hpp"
+
+#include "sampling/structured_output/json_event_parser.hpp"
+
+namespace {
+
+ov::genai::StreamingStatus get_streaming_status(const ov::genai::CallbackTypeVariant& callback_status) {
+    if (auto res = std::get_if<ov::genai::StreamingStatus>(&callback_status))
+        return *res;
+    else
+        return std::get<bool>(callback_status) ? ov::genai::StreamingStatus::STOP : ov::genai::StreamingStatus::RUNNING;
+}
+
+ov::genai::StreamingStatus run_callbacks(const std::function<ov::genai::CallbackTypeVariant(const ov::genai::JsonEvent&)>& callback,
+                                         const std::vector<ov::genai::JsonEvent>& events) {
+    for (const ov::genai::JsonEvent& event : events) {
+        ov::genai::StreamingStatus status = get_streaming_status(callback(event));
+        if (status != ov::genai::StreamingStatus::RUNNING) {
+            return status;
+        }
+    }
+    return ov::genai::StreamingStatus::RUNNING;
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+JsonStreamer::JsonStreamer(const Tokenizer& tokenizer, std::function<CallbackTypeVariant(const JsonEvent&)> callback)
+    : m_parser(std::make_shared<JsonEventParser>()),
+      m_event_callback(std::move(callback)) {
+    // the text is parsed as soon as TextStreamer decodes it
+    m_text_streamer = std::make_shared<TextStreamer>(tokenizer,
+        [parser = m_parser, callback = m_event_callback](std::string text) -> CallbackTypeVariant {
+            return run_callbacks(callback, parser->feed(text));
+        });
+}
+
+StreamingStatus JsonStreamer::write(int64_t token) {
+    return m_text_streamer->write(token);
+}
+
+StreamingStatus JsonStreamer::write(const std::vector<int64_t>& tokens) {
+    return m_text_streamer->write(tokens);
+}
+
+void JsonStreamer::end() {
+    m_text_streamer->end();
+    run_callbacks(m_event_callback, m_parser->finish());
+}
+
+}  // namespace genai
+}  // namespace ov
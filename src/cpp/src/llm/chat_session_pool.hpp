@@ -0,0 +1,196 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::genai {
+
+/**
+ * Host-side copy of a KV cache variable state of the model. If compressed, the values are quantized to u8 with a scale
+ * and a zero point per group of `group_size` consecutive values, the last dimension (head size) of the state.
+ */
+struct KVStateSnapshot {
+    std::string name;
+    ov::element::Type element_type;
+    ov::Shape shape;
+    ov::Tensor data;
+    size_t group_size = 0;
+    std::vector<float> scales;
+    std::vector<float> zero_points;
+
+    bool is_compressed() const {
+        return group_size != 0;
+    }
+
+    size_t get_byte_size() const {
+        return data.get_byte_size() + (scales.size() + zero_points.size()) * sizeof(float);
+    }
+};
+
+namespace detail {
+
+template <typename T>
+void quantize_to_u8(const T* src, size_t size, size_t group_size, uint8_t* dst, std::vector<float>& scales, std::vector<float>& zero_points) {
+    const size_t num_groups = size / group_size;
+    scales.resize(num_groups);
+    zero_points.resize(num_groups);
+    for (size_t group_idx = 0; group_idx < num_groups; ++group_idx) {
+        const T* group = src + group_idx * group_size;
+        float min_value = static_cast<float>(group[0]), max_value = min_value;
+        for (size_t i = 1; i < group_size; ++i) {
+            min_value = std::min(min_value, static_cast<float>(group[i]));
+            max_value = std::max(max_value, static_cast<float>(group[i]));
+        }
+        const float scale = (max_value - min_value) / 255.f;
+        scales[group_idx] = scale;
+        zero_points[group_idx] = min_value;
+        uint8_t* dst_group = dst + group_idx * group_size;
+        for (size_t i = 0; i < group_size; ++i) {
+            dst_group[i] = scale > 0.f ? static_cast<uint8_t>(std::lround((static_cast<float>(group[i]) - min_value) / scale)) : 0;
+        }
+    }
+}
+
+template <typename T>
+void dequantize_from_u8(const uint8_t* src, size_t size, size_t group_size, const std::vector<float>& scales, const std::vector<float>& zero_points, T* dst) {
+    for (size_t i = 0; i < size; ++i) {
+        const size_t group_idx = i / group_size;
+        dst[i] = static_cast<T>(src[i] * scales[group_idx] + zero_points[group_idx]);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Copies the KV cache variable state to the host memory, quantizing it to u8 if `compress` is true and the state has
+ * a floating point type. Other types are copied as is.
+ */
+inline KVStateSnapshot make_kv_state_snapshot(const std::string& name, const ov::Tensor& state, bool compress) {
+    KVStateSnapshot snapshot;
+    snapshot.name = name;
+    snapshot.element_type = state.get_element_type();
+    snapshot.shape = state.get_shape();
+
+    const bool is_compressible = snapshot.element_type == ov::element::f32 || snapshot.element_type == ov::element::f16 ||
+                                 snapshot.element_type == ov::element::bf16;
+    if (!compress || !is_compressible || snapshot.shape.empty() || state.get_size() == 0) {
+        snapshot.data = ov::Tensor(snapshot.element_type, snapshot.shape);
+        state.copy_to(snapshot.data);
+        return snapshot;
+    }
+
+    snapshot.group_size = snapshot.shape.back();
+    snapshot.data = ov::Tensor(ov::element::u8, snapshot.shape);
+    uint8_t* dst = snapshot.data.data<uint8_t>();
+    // the state may be a non-contiguous view of the plugin memory
+    ov::Tensor contiguous_state = state;
+    if (!state.is_continuous()) {
+        contiguous_state = ov::Tensor(snapshot.element_type, snapshot.shape);
+        state.copy_to(contiguous_state);
+    }
+    if (snapshot.element_type == ov::element::f32) {
+        detail::quantize_to_u8(contiguous_state.data<const float>(), state.get_size(), snapshot.group_size, dst, snapshot.scales, snapshot.zero_points);
+    } else if (snapshot.element_type == ov::element::f16) {
+        detail::quantize_to_u8(contiguous_state.data<const ov::float16>(), state.get_size(), snapshot.group_size, dst, snapshot.scales, snapshot.zero_points);
+    } else {
+        detail::quantize_to_u8(contiguous_state.data<const ov::bfloat16>(), state.get_size(), snapshot.group_size, dst, snapshot.scales, snapshot.zero_points);
+    }
+    return snapshot;
+}
+
+/**
+ * @return The tensor with the state stored in the snapshot, to be set to the variable state of the model.
+ */
+inline ov::Tensor restore_kv_state(const KVStateSnapshot& snapshot) {
+    if (!snapshot.is_compressed()) {
+        return snapshot.data;
+    }
+
+    ov::Tensor state(snapshot.element_type, snapshot.shape);
+    const uint8_t* src = snapshot.data.data<const uint8_t>();
+    if (snapshot.element_type == ov::element::f32) {
+        detail::dequantize_from_u8(src, state.get_size(), snapshot.group_size, snapshot.scales, snapshot.zero_points, state.data<float>());
+    } else if (snapshot.element_type == ov::element::f16) {
+        detail::dequantize_from_u8(src, state.get_size(), snapshot.group_size, snapshot.scales, snapshot.zero_points, state.data<ov::float16>());
+    } else {
+        detail::dequantize_from_u8(src, state.get_size(), snapshot.group_size, snapshot.scales, snapshot.zero_points, state.data<ov::bfloat16>());
+    }
+    return state;
+}
+
+/**
+ * Pool of suspended chat sessions with the LRU policy: only the `max_num_sessions_with_kv_cache` most recently suspended
+ * sessions keep their KV cache, the older ones are released with `Session::release_kv_cache()`, so that they keep only
+ * their history, which has to be processed again after the session is resumed.
+ */
+template <typename Session>
+class ChatSessionPool {
+public:
+    explicit ChatSessionPool(size_t max_num_sessions_with_kv_cache) : m_max_num_sessions_with_kv_cache(max_num_sessions_with_kv_cache) {}
+
+    void put(const std::string& session_id, Session session) {
+        erase(session_id);
+        m_sessions.emplace(session_id, std::move(session));
+        m_sessions_with_kv_cache.push_front(session_id);
+        while (m_sessions_with_kv_cache.size() > m_max_num_sessions_with_kv_cache) {
+            m_sessions.at(m_sessions_with_kv_cache.back()).release_kv_cache();
+            m_sessions_with_kv_cache.pop_back();
+        }
+    }
+
+    /**
+     * Removes the session from the pool.
+     * @return The session, std::nullopt if there is no session with such id in the pool.
+     */
+    std::optional<Session> take(const std::string& session_id) {
+        auto it = m_sessions.find(session_id);
+        if (it == m_sessions.end()) {
+            return std::nullopt;
+        }
+        std::optional<Session> session = std::move(it->second);
+        erase(session_id);
+        return session;
+    }
+
+    bool contains(const std::string& session_id) const {
+        return m_sessions.count(session_id) != 0;
+    }
+
+    bool has_kv_cache(const std::string& session_id) const {
+        return std::find(m_sessions_with_kv_cache.begin(), m_sessions_with_kv_cache.end(), session_id) != m_sessions_with_kv_cache.end();
+    }
+
+    size_t size() const {
+        return m_sessions.size();
+    }
+
+    void clear() {
+        m_sessions.clear();
+        m_sessions_with_kv_cache.clear();
+    }
+
+private:
+    void erase(const std::string& session_id) {
+        m_sessions.erase(session_id);
+        m_sessions_with_kv_cache.remove(session_id);
+    }
+
+    size_t m_max_num_sessions_with_kv_cache;
+    std::map<std::string, Session> m_sessions;
+    // ids of the sessions which keep their KV cache, the most recently suspended first
+    std::list<std::string> m_sessions_with_kv_cache;
+};
+
+}  // namespace ov::genai
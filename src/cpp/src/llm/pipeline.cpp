@@ -11,6 +11,7 @@
 
 #include "llm/pipeline_static.hpp"
 #include "llm/pipeline_stateful.hpp"
+#include "llm/pipeline_stateful_pool.hpp"
 #include "llm/pipeline_continuous_batching_adapter.hpp"
 #include "speculative_decoding/speculative_decoding_impl.hpp"
 #include "utils.hpp"
@@ -102,7 +103,8 @@ ov::genai::LLMPipeline::LLMPipeline(
     }
 
     if (m_pimpl == nullptr) {
-        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, tokenizer, device, properties);
+        // the concurrent generate() calls are multiplexed over the replicas of the stateful pipeline
+        m_pimpl = make_stateful_pipeline_pool(std::make_unique<StatefulLLMPipeline>(models_path, tokenizer, device, properties));
     }
 
     m_pimpl->save_load_time(start_time);
@@ -139,7 +141,7 @@ ov::genai::LLMPipeline::LLMPipeline(
     }
 
     if (m_pimpl == nullptr) {
-        m_pimpl = std::make_unique<StatefulLLMPipeline>(models_path, device, properties);
+        m_pimpl = make_stateful_pipeline_pool(std::make_unique<StatefulLLMPipeline>(models_path, device, properties));
     }
 
     m_pimpl->save_load_time(start_time);
@@ -190,12 +192,12 @@ ov::genai::LLMPipeline::LLMPipeline(
     }
 
     if (m_pimpl == nullptr) {
-        m_pimpl = std::make_unique<StatefulLLMPipeline>(
+        m_pimpl = make_stateful_pipeline_pool(std::make_unique<StatefulLLMPipeline>(
             utils::singleton_core().read_model(model_str, weights_tensor),
             tokenizer,
             device,
             properties,
-            generation_config);
+            generation_config));
     }
 
     m_pimpl->save_load_time(start_time);
@@ -247,10 +249,31 @@ void ov::genai::LLMPipeline::finish_chat() {
     m_pimpl->finish_chat();
 }
 
+void ov::genai::LLMPipeline::suspend_chat(const std::string& session_id) {
+    m_pimpl->suspend_chat(session_id);
+}
+
+void ov::genai::LLMPipeline::resume_chat(const std::string& session_id) {
+    m_pimpl->resume_chat(session_id);
+}
+
 void ov::genai::LLMPipeline::set_generation_config(const GenerationConfig& config) {
     m_pimpl->set_generation_config(config);
 }
 
+void ov::genai::LLMPipeline::warmup(const WarmupConfig& config) {
+    const GenerationConfig generation_config = utils::get_warmup_generation_config(get_generation_config(), config.max_new_tokens);
+    const Tokenizer tokenizer = get_tokenizer();
+    for (size_t batch_size : config.batch_sizes) {
+        for (size_t prompt_length : config.prompt_lengths) {
+            ov::Tensor input_ids = utils::get_warmup_input_ids(batch_size, prompt_length, tokenizer);
+            ov::Tensor attention_mask(ov::element::i64, input_ids.get_shape());
+            std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 1);
+            m_pimpl->generate(TokenizedInputs{input_ids, attention_mask}, generation_config, std::monostate{});
+        }
+    }
+}
+
 ov::genai::LLMPipeline::~LLMPipeline() {
     m_pimpl.reset();
     utils::release_core_plugin(m_device);
@@ -54,6 +54,14 @@ public:
     virtual void start_chat(const std::string& system_message) = 0;
     virtual void finish_chat() = 0;
 
+    virtual void suspend_chat(const std::string& session_id) {
+        OPENVINO_THROW("Suspending chat sessions is supported by the stateful pipeline only");
+    }
+
+    virtual void resume_chat(const std::string& session_id) {
+        OPENVINO_THROW("Resuming chat sessions is supported by the stateful pipeline only");
+    }
+
     virtual ~LLMPipelineImplBase() = default;
 
     void save_load_time(std::chrono::steady_clock::time_point start_time) {
@@ -67,6 +75,8 @@ protected:
     std::optional<AdapterController> m_adapter_controller;
 
     float m_load_time_ms = 0.0f;
+    // load time of each model in ms
+    std::map<std::string, float> m_model_load_times_ms;
 };
 
 }  // namespace genai
@@ -4,7 +4,12 @@
 #include "llm/pipeline_base.hpp"
 
 #include "openvino/genai/continuous_batching_pipeline.hpp"
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
 
 namespace ov::genai {
 
@@ -18,6 +23,131 @@ template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 
 class ContinuousBatchingAdapter final : public LLMPipelineImplBase {
     std::unique_ptr<ContinuousBatchingPipeline> m_impl;
+
+    // The concurrent generate() calls are multiplexed: each call adds its requests to the pipeline and the callers step
+    // it in turn, so that the requests of all of them are batched together. The calls, which can't share the pipeline
+    // (streaming, chat, echo or LoRA adapters), lock it exclusively and wait for the multiplexed requests to finish.
+    std::shared_mutex m_generate_mutex;
+    std::mutex m_step_mutex;
+    std::atomic<uint64_t> m_next_request_id{0};
+    std::atomic<bool> m_is_chat_conversation{false};
+
+    bool can_multiplex(const GenerationConfig& config, const StreamerVariant& streamer) const {
+        return std::holds_alternative<std::monostate>(streamer) && !m_is_chat_conversation && !config.echo && !config.adapters;
+    }
+
+    std::unique_lock<std::shared_mutex> lock_exclusively() {
+        std::unique_lock<std::shared_mutex> lock(m_generate_mutex);
+        // the requests of a failed multiplexed call are cancelled, they are released by the next step
+        while (m_impl->has_non_finished_requests()) {
+            m_impl->step();
+        }
+        return lock;
+    }
+
+    // the perf metrics are derived from the request metrics, since the steps are shared with the other calls
+    EncodedResults generate_multiplexed(const std::vector<ov::Tensor>& input_ids, const GenerationConfig& config) {
+        OPENVINO_ASSERT(!input_ids.empty(), "At least one prompt is required");
+        std::shared_lock<std::shared_mutex> lock(m_generate_mutex);
+        std::vector<GenerationHandle> handles;
+        handles.reserve(input_ids.size());
+        for (const ov::Tensor& prompt_ids : input_ids) {
+            handles.push_back(m_impl->add_request(m_next_request_id++, prompt_ids, config));
+        }
+
+        const auto is_running = [&handles] {
+            return std::any_of(handles.begin(), handles.end(), [](const GenerationHandle& handle) {
+                return handle->get_status() == GenerationStatus::RUNNING;
+            });
+        };
+        // the durations of the steps taken by this caller
+        std::vector<MicroSeconds> step_durations;
+        while (is_running()) {
+            std::lock_guard<std::mutex> step_lock(m_step_mutex);
+            // the requests may have been finished by the other callers, while this one was waiting for the lock
+            if (!is_running()) {
+                break;
+            }
+            const auto infer_start = std::chrono::steady_clock::now();
+            try {
+                m_impl->step();
+            } catch (...) {
+                for (const GenerationHandle& handle : handles) {
+                    handle->cancel();
+                }
+                throw;
+            }
+            step_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start));
+        }
+
+        EncodedResults results;
+        PerfMetrics& perf_metrics = results.perf_metrics;
+        auto& raw_metrics = perf_metrics.raw_metrics;
+        raw_metrics.m_inference_durations = {std::accumulate(step_durations.begin(), step_durations.end(), MicroSeconds{0.0f})};
+        raw_metrics.m_token_infer_durations = std::move(step_durations);
+        for (size_t i = 0; i < handles.size(); ++i) {
+            const GenerationHandle& handle = handles[i];
+            const GenerationStatus status = handle->get_status();
+            OPENVINO_ASSERT(status == GenerationStatus::FINISHED, "Got unfinished GenerationStatus");
+            size_t num_generated_tokens = 0;
+            for (GenerationOutput& output : handle->read_all()) {
+                num_generated_tokens = std::max(num_generated_tokens, output.generated_ids.size());
+                results.tokens.push_back(std::move(output.generated_ids));
+                results.scores.push_back(output.score);
+            }
+            const RequestMetrics request_metrics = handle->get_request_metrics();
+            if (num_generated_tokens > 0) {
+                raw_metrics.m_times_to_first_token.emplace_back(request_metrics.ttft);
+            }
+            for (size_t token = 1; token < num_generated_tokens; ++token) {
+                raw_metrics.m_durations.emplace_back((request_metrics.total_time - request_metrics.ttft) / (num_generated_tokens - 1));
+            }
+            perf_metrics.num_generated_tokens += num_generated_tokens;
+            perf_metrics.num_input_tokens += input_ids[i].get_size();
+        }
+        perf_metrics.load_time = m_load_time_ms;
+        return results;
+    }
+
+    DecodedResults generate_multiplexed(const std::vector<std::string>& prompts,
+                                        const GenerationConfig& config,
+                                        std::chrono::steady_clock::time_point start_time) {
+        std::vector<ov::Tensor> input_ids;
+        std::vector<MicroSeconds> tokenization_durations;
+        for (const std::string& prompt : prompts) {
+            const auto encode_start = std::chrono::steady_clock::now();
+            // the prompts are encoded like by ContinuousBatchingPipeline::generate()
+            if (config.apply_chat_template && !m_tokenizer.get_chat_template().empty()) {
+                ChatHistory history({{{"role", "user"}, {"content", prompt}}});
+                constexpr bool add_generation_prompt = true;
+                const std::string templated_prompt = m_tokenizer.apply_chat_template(history, add_generation_prompt);
+                input_ids.push_back(m_tokenizer.encode(templated_prompt, {ov::genai::add_special_tokens(false)}).input_ids);
+            } else {
+                input_ids.push_back(m_tokenizer.encode(prompt, {ov::genai::add_special_tokens(true)}).input_ids);
+            }
+            tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
+        }
+
+        EncodedResults encoded = generate_multiplexed(input_ids, config);
+        DecodedResults decoded;
+        decoded.perf_metrics = std::move(encoded.perf_metrics);
+        auto& raw_metrics = decoded.perf_metrics.raw_metrics;
+        raw_metrics.tokenization_durations = std::move(tokenization_durations);
+        for (const std::vector<int64_t>& tokens : encoded.tokens) {
+            const auto decode_start = std::chrono::steady_clock::now();
+            decoded.texts.push_back(m_tokenizer.decode(tokens));
+            raw_metrics.detokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start));
+        }
+        decoded.scores = std::move(encoded.scores);
+        finish_perf_metrics(decoded.perf_metrics, start_time);
+        return decoded;
+    }
+
+    static void finish_perf_metrics(PerfMetrics& perf_metrics, std::chrono::steady_clock::time_point start_time) {
+        perf_metrics.raw_metrics.generate_durations = {MicroSeconds(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - start_time))};
+        perf_metrics.m_evaluated = false;
+        perf_metrics.evaluate_statistics(start_time);
+    }
 public:
     ContinuousBatchingAdapter(
         const ov::InferRequest& request,
@@ -82,6 +212,10 @@ public:
             }
         }, inputs);
         const GenerationConfig& config = generation_config.has_value() ? *generation_config : m_generation_config;
+        if (can_multiplex(config, streamer)) {
+            return generate_multiplexed(prompts, config, start_time);
+        }
+        auto lock = lock_exclusively();
         // -1 == config.eos_token_id and config.validate() are handled in m_impl.
         std::vector<GenerationResult> generated = m_impl->generate(prompts,
             std::vector<GenerationConfig>{prompts.size(), config},
@@ -175,6 +309,12 @@ public:
         }, inputs);
 
         const GenerationConfig& config = generation_config.has_value() ? *generation_config : m_generation_config;
+        if (can_multiplex(config, streamer)) {
+            EncodedResults results = generate_multiplexed(input_ids, config);
+            finish_perf_metrics(results.perf_metrics, start_time);
+            return results;
+        }
+        auto lock = lock_exclusively();
         // -1 == config.eos_token_id and config.validate() are handled in m_impl.
         std::vector<EncodedGenerationResult> generated = m_impl->generate(input_ids, 
             std::vector<GenerationConfig>{input_ids.size(), config}, 
@@ -206,11 +346,15 @@ public:
     }
 
     void start_chat(const std::string& system_message) override {
+        auto lock = lock_exclusively();
         m_impl->start_chat(system_message);
+        m_is_chat_conversation = true;
     }
 
     void finish_chat() override {
+        auto lock = lock_exclusively();
         m_impl->finish_chat();
+        m_is_chat_conversation = false;
     }
 };
 
@@ -49,14 +49,134 @@ StatefulLLMPipeline::StatefulLLMPipeline(
     const ov::AnyMap& properties,
     const ov::genai::GenerationConfig& generation_config)
     : LLMPipelineImplBase(tokenizer, generation_config), m_sampler(m_tokenizer) {
+    init_language_model(model, device, properties);
+
+    // If eos_token_id was not provided, take value
+    if (m_generation_config.eos_token_id == -1)
+        m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
+
+    m_sampler.set_seed(m_generation_config.rng_seed);
+}
+
+StatefulLLMPipeline::StatefulLLMPipeline(
+    const std::filesystem::path& models_path,
+    const std::string& device,
+    const ov::AnyMap& plugin_config)
+    : StatefulLLMPipeline{
+        utils::AsyncModelLoad<Tokenizer>("tokenizer", [models_path, plugin_config] {
+            return Tokenizer(models_path, plugin_config);
+        }),
+        models_path,
+        device,
+        plugin_config
+    } {}
+
+StatefulLLMPipeline::StatefulLLMPipeline(
+    utils::AsyncModelLoad<Tokenizer>&& tokenizer_load,
+    const std::filesystem::path& models_path,
+    const std::string& device,
+    const ov::AnyMap& plugin_config)
+    : LLMPipelineImplBase(Tokenizer{}, utils::from_config_json_if_exists(models_path)) {
+    const auto start_time = std::chrono::steady_clock::now();
+    init_language_model(utils::read_model(models_path, plugin_config), device, plugin_config);
+    m_model_load_times_ms["language_model"] = std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - start_time).count();
+
+    m_tokenizer = tokenizer_load.get(m_model_load_times_ms);
+    m_sampler.set_tokenizer(m_tokenizer);
+
+    // If eos_token_id was not provided, take value
+    if (m_generation_config.eos_token_id == -1)
+        m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
+
+    m_sampler.set_seed(m_generation_config.rng_seed);
+}
+
+StatefulLLMPipeline::StatefulLLMPipeline(const StatefulLLMPipeline& other, ov::InferRequest request)
+    : LLMPipelineImplBase(other.m_tokenizer, other.m_generation_config),
+    m_compiled_model(other.m_compiled_model),
+    m_model_runner(std::move(request)),
+    m_sampler(m_tokenizer),
+    m_use_full_chat_history(other.m_use_full_chat_history),
+    m_max_prompt_len(other.m_max_prompt_len),
+    m_max_kv_cache_size(other.m_max_kv_cache_size),
+    m_is_npu(other.m_is_npu),
+    m_is_prompt_lookup_enabled(other.m_is_prompt_lookup_enabled),
+    m_compress_chat_sessions(other.m_compress_chat_sessions),
+    m_prompt_length_bucketing_ratio(other.m_prompt_length_bucketing_ratio),
+    m_prefill_chunk_size(other.m_prefill_chunk_size) {
+    m_kv_cache_state.seq_length_axis = other.m_kv_cache_state.seq_length_axis;
+    m_load_time_ms = other.m_load_time_ms;
+    m_model_load_times_ms = other.m_model_load_times_ms;
+    m_sampler.set_seed(m_generation_config.rng_seed);
+}
+
+bool StatefulLLMPipeline::can_replicate() const {
+    return m_compiled_model && !m_adapter_controller && !m_weights_streamer;
+}
+
+std::unique_ptr<StatefulLLMPipeline> StatefulLLMPipeline::create_replica() const {
+    OPENVINO_ASSERT(can_replicate(), "The pipeline can't be replicated");
+    // the constructor is private, so std::make_unique can't be used
+    return std::unique_ptr<StatefulLLMPipeline>(new StatefulLLMPipeline(*this, m_compiled_model->create_infer_request()));
+}
+
+void StatefulLLMPipeline::init_language_model(const std::shared_ptr<ov::Model>& model,
+                                              const std::string& device,
+                                              const ov::AnyMap& properties) {
     if (device.find("NPU") != std::string::npos) {
         m_is_npu = true;
         m_use_full_chat_history = true;
     }
 
+    auto [filtered_properties_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties);
+    // Extract prompt_lookup property if exists and remove it from properties
+    auto prompt_lookup_it = filtered_properties_without_gguf.find("prompt_lookup");
+    if (prompt_lookup_it != filtered_properties_without_gguf.end()) {
+        m_is_prompt_lookup_enabled = prompt_lookup_it->second.as<bool>();
+        filtered_properties_without_gguf.erase(prompt_lookup_it);
+    }
+    if (auto max_cached_chat_sessions = utils::pop_option(filtered_properties_without_gguf, ov::genai::max_cached_chat_sessions.name())) {
+        // NB: Integer value coming from python has int64_t datatype
+        size_t max_num_sessions = max_cached_chat_sessions->is<int64_t>() ? max_cached_chat_sessions->as<int64_t>() : max_cached_chat_sessions->as<size_t>();
+        m_chat_sessions = ChatSessionPool<ChatSession>(max_num_sessions);
+    }
+    m_compress_chat_sessions = utils::pop_or_default(filtered_properties_without_gguf, ov::genai::compress_cached_chat_sessions.name(), false);
+    if (auto bucketing_ratio = utils::pop_option(filtered_properties_without_gguf, ov::genai::prompt_length_bucketing_ratio.name())) {
+        // NB: Floating point value coming from python has double datatype
+        m_prompt_length_bucketing_ratio = bucketing_ratio->is<double>() ? static_cast<float>(bucketing_ratio->as<double>()) : bucketing_ratio->as<float>();
+        OPENVINO_ASSERT(m_prompt_length_bucketing_ratio == 0.0f || m_prompt_length_bucketing_ratio >= 1.0f,
+                        "prompt_length_bucketing_ratio must be either 0 or at least 1, got ", m_prompt_length_bucketing_ratio);
+    }
+    if (auto prefill_chunk_size = utils::pop_option(filtered_properties_without_gguf, ov::genai::prefill_chunk_size.name())) {
+        // NB: Integer value coming from python has int64_t datatype
+        m_prefill_chunk_size = prefill_chunk_size->is<int64_t>() ? prefill_chunk_size->as<int64_t>() : prefill_chunk_size->as<size_t>();
+    }
+    const bool weights_streaming = utils::pop_or_default(filtered_properties_without_gguf, ov::genai::weights_streaming.name(), false);
+    std::vector<size_t> pinned_layers;
+    if (auto pinned = utils::pop_option(filtered_properties_without_gguf, ov::genai::weights_streaming_pinned_layers.name())) {
+        // NB: Integer values coming from python have int64_t datatype
+        if (pinned->is<std::vector<int64_t>>()) {
+            for (int64_t layer : pinned->as<std::vector<int64_t>>()) {
+                OPENVINO_ASSERT(layer >= 0, "weights_streaming_pinned_layers must be non-negative, got ", layer);
+                pinned_layers.push_back(static_cast<size_t>(layer));
+            }
+        } else {
+            pinned_layers = pinned->as<std::vector<size_t>>();
+        }
+    }
+    OPENVINO_ASSERT(!weights_streaming || device == "CPU", "Weights streaming is supported only for CPU device, got ", device);
+    // NPU compiles the prefill stage of the model for a fixed prompt length
+    OPENVINO_ASSERT(!m_is_npu || m_prefill_chunk_size == 0, "Chunked prefill is not supported for NPU device");
+    // NPU compiles the generation stage of the model for a single input token
+    OPENVINO_ASSERT(!m_is_npu || !m_is_prompt_lookup_enabled, "Prompt lookup decoding is not supported for NPU device");
+
     // FIXME: slicing produces incorrect results for some models on NPU.
     // On NPU, applying slice the safe way is done by the underlying plugin
-    if (!m_is_npu) {
+    if (m_is_prompt_lookup_enabled) {
+        // logits are required for all candidates, which are validated at a generation step
+        utils::apply_gather_before_matmul_transformation(model);
+    } else if (!m_is_npu) {
         utils::apply_slice_before_matmul_transformation(model);
     }
 
@@ -65,7 +185,6 @@ StatefulLLMPipeline::StatefulLLMPipeline(
     if (!m_use_full_chat_history)
         m_kv_cache_state.seq_length_axis = kv_pos.seq_len;
 
-    auto [filtered_properties_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties);
     auto filtered_properties = extract_adapters_from_properties(filtered_properties_without_gguf, &m_generation_config.adapters);
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
@@ -78,24 +197,17 @@ StatefulLLMPipeline::StatefulLLMPipeline(
         m_max_prompt_len = kv_desc.max_prompt_len;
         m_max_kv_cache_size = kv_desc.max_prompt_len + kv_desc.min_response_len;
     } else {
-       compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
+        m_compiled_model = utils::compile_shared_model(model, device, *filtered_properties);
+        compiled_model = *m_compiled_model;
     }
     m_model_runner = compiled_model.create_infer_request();
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Stateful LLM model");
-
-    // If eos_token_id was not provided, take value
-    if (m_generation_config.eos_token_id == -1)
-        m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
-
-    m_sampler.set_seed(m_generation_config.rng_seed);
+    if (weights_streaming) {
+        // the compiled model shares the memory mapped constants of the model
+        m_weights_streamer = std::make_unique<WeightsStreamer>(model, pinned_layers);
+    }
 }
 
-StatefulLLMPipeline::StatefulLLMPipeline(
-    const std::filesystem::path& models_path,
-    const std::string& device,
-    const ov::AnyMap& plugin_config)
-    : StatefulLLMPipeline{models_path, Tokenizer(models_path, plugin_config), device, plugin_config} {}
-
 DecodedResults StatefulLLMPipeline::generate(
     StringInputs inputs,
     OptionalGenerationConfig generation_config,
@@ -211,6 +323,17 @@ EncodedResults StatefulLLMPipeline::generate(
         OPENVINO_ASSERT(m_chat_input_type == ov::genai::utils::GenerationChatInputsType::ENCODED_INPUTS || m_history.back()["role"] == "user",
                         "Chat doesn't support switching between input types. Please, continue using StringInputs or restart the chat.");
 
+    // streaming is not supported for batches, so the streamer is left to be rejected by the regular path
+    if (!is_chat_conversation && m_prompt_length_bucketing_ratio > 0.0f && std::holds_alternative<std::monostate>(streamer)) {
+        auto data = std::get_if<TokenizedInputs>(&inputs);
+        if (data && data->input_ids.get_shape().at(0) > 1) {
+            auto buckets = get_prompt_length_buckets(data->attention_mask, m_prompt_length_bucketing_ratio);
+            if (buckets.size() > 1) {
+                return generate_length_buckets(*data, buckets, generation_config);
+            }
+        }
+    }
+
     if (!is_chat_conversation) {
         reset_kv_state();
         m_model_runner.get_tensor("attention_mask").set_shape({1, 0});
@@ -288,6 +411,12 @@ EncodedResults StatefulLLMPipeline::generate(
     // Stateful pipeline does not provide logprobs for prompt tokens
     OPENVINO_ASSERT(config.echo == false, "Echo is not supported in the stateful pipeline");
 
+    if (config.is_prompt_lookup()) {
+        OPENVINO_ASSERT(m_is_prompt_lookup_enabled, "Prompt lookup decoding has to be enabled by `prompt_lookup` property of the pipeline");
+        OPENVINO_ASSERT(batch_size == 1u && config.num_return_sequences == 1u && (config.is_greedy_decoding() || config.is_multinomial()),
+            "Currently prompt lookup decoding is possible only with batch size=1 and only for greedy or multinomial decoding");
+    }
+
     std::shared_ptr<StreamerBase> streamer_ptr = ov::genai::utils::create_streamer(streamer, m_tokenizer);
 
     OPENVINO_ASSERT(streamer_ptr == nullptr || batch_size == 1 && config.num_return_sequences == 1 &&
@@ -371,9 +500,20 @@ EncodedResults StatefulLLMPipeline::generate(
         m_sampler.set_seed(config.rng_seed);
     }
 
+    std::optional<WeightsStreamer::Session> weights_streaming_session;
+    if (m_weights_streamer) {
+        weights_streaming_session.emplace(m_weights_streamer.get());
+    }
     ov::genai::utils::GenerationFinishInfo finish_info = get_lm_encoded_results(m_model_runner, input_ids, concatenated_attention_mask, streamer_ptr, m_sampler,
-                                                                                requests, position_ids, std::nullopt, m_kv_cache_state, nullptr, std::nullopt, m_max_kv_cache_size);
+                                                                                requests, position_ids, std::nullopt, m_kv_cache_state, nullptr, std::nullopt, m_max_kv_cache_size,
+                                                                                m_adapter_controller, m_prefill_chunk_size);
+    weights_streaming_session.reset();
     ov::genai::EncodedResults& result = finish_info.results;
+    const auto& token_durations = result.perf_metrics.raw_metrics.m_durations;
+    if (m_weights_streamer && token_durations.size() > 1) {
+        // the first duration includes the prefill, the read-ahead is paced by the generation steps
+        m_weights_streamer->set_forward_duration(token_durations.back().count());
+    }
     m_chat_generation_finish_status = finish_info.streaming_finish_status;
 
     if (is_chat_conversation) {
@@ -397,11 +537,51 @@ EncodedResults StatefulLLMPipeline::generate(
     auto& metrics = result.perf_metrics;
     metrics.num_input_tokens = batch_size * input_ids.get_shape().at(1);
     metrics.load_time = m_load_time_ms;
+    metrics.model_load_times = m_model_load_times_ms;
     metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
     metrics.evaluate_statistics(start_time);
     return result;
 }
 
+EncodedResults StatefulLLMPipeline::generate_length_buckets(
+    const TokenizedInputs& inputs,
+    const std::vector<std::vector<size_t>>& buckets,
+    OptionalGenerationConfig generation_config) {
+    const size_t batch_size = inputs.input_ids.get_shape().at(0);
+    std::vector<std::vector<int64_t>> tokens(batch_size);
+    std::vector<float> scores(batch_size);
+    size_t num_outputs_per_prompt = 0;
+    std::optional<PerfMetrics> perf_metrics;
+
+    for (const auto& bucket : buckets) {
+        EncodedResults bucket_results = generate(get_batch_rows(inputs, bucket), generation_config, std::monostate());
+        if (num_outputs_per_prompt == 0) {
+            num_outputs_per_prompt = bucket_results.tokens.size() / bucket.size();
+            tokens.resize(batch_size * num_outputs_per_prompt);
+            scores.resize(batch_size * num_outputs_per_prompt);
+        }
+        OPENVINO_ASSERT(bucket_results.tokens.size() == bucket.size() * num_outputs_per_prompt,
+                        "Each prompt of the batch is expected to have the same number of generation results");
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            for (size_t output_idx = 0; output_idx < num_outputs_per_prompt; ++output_idx) {
+                tokens[bucket[i] * num_outputs_per_prompt + output_idx] = std::move(bucket_results.tokens[i * num_outputs_per_prompt + output_idx]);
+                scores[bucket[i] * num_outputs_per_prompt + output_idx] = bucket_results.scores[i * num_outputs_per_prompt + output_idx];
+            }
+        }
+        if (perf_metrics.has_value()) {
+            *perf_metrics += bucket_results.perf_metrics;
+        } else {
+            perf_metrics = bucket_results.perf_metrics;
+        }
+    }
+
+    EncodedResults results;
+    results.tokens = std::move(tokens);
+    results.scores = std::move(scores);
+    results.perf_metrics = *perf_metrics;
+    return results;
+}
+
 void StatefulLLMPipeline::start_chat(const std::string& system_message) {
     finish_chat();
     is_chat_conversation = true;
@@ -437,8 +617,66 @@ void StatefulLLMPipeline::finish_chat() {
     }
 }
 
+void StatefulLLMPipeline::suspend_chat(const std::string& session_id) {
+    OPENVINO_ASSERT(is_chat_conversation, "Only a chat started with start_chat() can be suspended");
+
+    ChatSession session;
+    session.history = std::move(m_history);
+    session.tokenized_chat_history = std::move(m_tokenized_chat_history);
+    session.chat_input_type = m_chat_input_type;
+    session.chat_generation_finish_status = m_chat_generation_finish_status;
+    session.kv_cache_state = m_kv_cache_state;
+    m_history.clear();
+    m_tokenized_chat_history.clear();
+
+    // KV cache is not kept between generate calls if full history is used as prompt
+    if (!m_use_full_chat_history && !m_kv_cache_state.get_state().empty()) {
+        for (auto& state : m_model_runner.query_state()) {
+            if (m_adapter_controller && m_adapter_controller->has_state_name(state.get_name()))
+                continue;
+            session.kv_states.push_back(make_kv_state_snapshot(state.get_name(), state.get_state(), m_compress_chat_sessions));
+        }
+        // attention mask of the tokens in KV cache is taken from the last inference on the next generate call
+        auto attention_mask = m_model_runner.get_tensor("attention_mask");
+        session.attention_mask = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
+        attention_mask.copy_to(session.attention_mask);
+    } else {
+        session.release_kv_cache();
+    }
+
+    finish_chat();
+    m_chat_sessions.put(session_id, std::move(session));
+}
+
+void StatefulLLMPipeline::resume_chat(const std::string& session_id) {
+    auto session = m_chat_sessions.take(session_id);
+    OPENVINO_ASSERT(session.has_value(), "There is no suspended chat session with id '", session_id, "'");
+
+    finish_chat();
+    is_chat_conversation = true;
+    m_history = std::move(session->history);
+    m_tokenized_chat_history = std::move(session->tokenized_chat_history);
+    m_chat_input_type = session->chat_input_type;
+    m_chat_generation_finish_status = session->chat_generation_finish_status;
+    m_kv_cache_state = session->kv_cache_state;
+
+    if (session->kv_states.empty())
+        return;
+
+    for (auto& state : m_model_runner.query_state()) {
+        auto it = std::find_if(session->kv_states.begin(), session->kv_states.end(),
+                               [&state](const KVStateSnapshot& snapshot) { return snapshot.name == state.get_name(); });
+        if (it != session->kv_states.end())
+            state.set_state(restore_kv_state(*it));
+    }
+    m_model_runner.set_tensor("attention_mask", session->attention_mask);
+}
+
 StatefulLLMPipeline::~StatefulLLMPipeline() {
-    m_model_runner.get_compiled_model().release_memory();
+    // the memory of the compiled model shared with the other pipelines is released by the last one
+    if (!m_compiled_model || m_compiled_model.use_count() == 1) {
+        m_model_runner.get_compiled_model().release_memory();
+    }
 }
 
 } // namespace ov::genai
@@ -1,10 +1,13 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#pragma once
 
 #include <limits>
 
+#include "llm/chat_session_pool.hpp"
 #include "llm/pipeline_base.hpp"
+#include "llm/weights_streamer.hpp"
 #include "lm_encoding.hpp"
 #include "sampling/sampler.hpp"
 #include "utils.hpp"
@@ -12,7 +15,11 @@
 namespace ov::genai {
 
 class StatefulLLMPipeline final : public LLMPipelineImplBase {
+    // the compiled model shared with the other pipelines of the process, nullptr for NPU
+    std::shared_ptr<ov::CompiledModel> m_compiled_model;
     ov::InferRequest m_model_runner;
+    // streams the memory mapped weights while generating, enabled by `weights_streaming` property
+    std::unique_ptr<WeightsStreamer> m_weights_streamer;
     Sampler m_sampler;
 
     // Chat scenario specific parameters
@@ -27,10 +34,59 @@ class StatefulLLMPipeline final : public LLMPipelineImplBase {
     size_t m_max_prompt_len = std::numeric_limits<size_t>::max();
     size_t m_max_kv_cache_size = std::numeric_limits<size_t>::max();
     bool m_is_npu = false;
+    // whether the model computes logits for all candidates of prompt lookup decoding, enabled by `prompt_lookup` property
+    bool m_is_prompt_lookup_enabled = false;
     // include reflection of tokens contained in the kv cache and amount of tokens, which are needed to trim from kv cache on the next step of chat
     utils::KVCacheState m_kv_cache_state;
 
+    // state of a chat suspended with suspend_chat()
+    struct ChatSession {
+        ChatHistory history;
+        std::vector<int64_t> tokenized_chat_history;
+        ov::genai::utils::GenerationChatInputsType chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
+        ov::genai::GenerationStatus chat_generation_finish_status = ov::genai::GenerationStatus::RUNNING;
+        utils::KVCacheState kv_cache_state;
+        ov::Tensor attention_mask;
+        std::vector<KVStateSnapshot> kv_states;
+
+        // after the release the history is processed again on resume
+        void release_kv_cache() {
+            kv_states.clear();
+            kv_cache_state.reset_state();
+            attention_mask = ov::Tensor();
+        }
+    };
+    ChatSessionPool<ChatSession> m_chat_sessions{8};
+    // whether the KV cache of suspended chats is quantized, enabled by `compress_cached_chat_sessions` property
+    bool m_compress_chat_sessions = false;
+
+    // max ratio of the prompt lengths within a bucket of a batch, set by `prompt_length_bucketing_ratio` property, 0 if disabled
+    float m_prompt_length_bucketing_ratio = 0.0f;
+    // max number of prompt tokens processed by a single inference, set by `prefill_chunk_size` property, 0 if not limited
+    size_t m_prefill_chunk_size = 0;
+
     void reset_kv_state();
+
+    // parses the pipeline properties, compiles the language model and creates its infer request
+    void init_language_model(const std::shared_ptr<ov::Model>& model, const std::string& device, const ov::AnyMap& properties);
+
+    // the tokenizer is loaded on a separate thread while the language model is read and compiled
+    StatefulLLMPipeline(
+        utils::AsyncModelLoad<Tokenizer>&& tokenizer_load,
+        const std::filesystem::path& models_path,
+        const std::string& device,
+        const ov::AnyMap& plugin_config
+    );
+
+    // a pipeline with its own infer request of the compiled model of the other one, see create_replica()
+    StatefulLLMPipeline(const StatefulLLMPipeline& other, ov::InferRequest request);
+
+    // generates the buckets of prompts of the batch one after another, see get_prompt_length_buckets
+    EncodedResults generate_length_buckets(
+        const TokenizedInputs& inputs,
+        const std::vector<std::vector<size_t>>& buckets,
+        OptionalGenerationConfig generation_config
+    );
 public:
 
     StatefulLLMPipeline(
@@ -76,6 +132,22 @@ public:
 
     void finish_chat() override;
 
+    void suspend_chat(const std::string& session_id) override;
+
+    void resume_chat(const std::string& session_id) override;
+
+    /**
+     * Whether create_replica() is supported: the compiled model must be shared by the pipelines of the process, and the
+     * pipeline must have no state shared by its infer requests, i.e. no LoRA adapters or weights streaming.
+     */
+    bool can_replicate() const;
+
+    /**
+     * Creates a pipeline with the same configuration, which has its own infer request of the same compiled model, so
+     * that the pipelines may generate concurrently. The chat state isn't copied.
+     */
+    std::unique_ptr<StatefulLLMPipeline> create_replica() const;
+
     ~StatefulLLMPipeline();
 };
 
@@ -0,0 +1,128 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "llm/pipeline_stateful_pool.hpp"
+
+#include <algorithm>
+
+namespace ov::genai {
+
+// returns the pipeline to the pool once the call using it is finished
+class StatefulLLMPipelinePool::Lease {
+    StatefulLLMPipelinePool& m_pool;
+    StatefulLLMPipeline* m_pipeline;
+public:
+    Lease(StatefulLLMPipelinePool& pool, bool primary) : m_pool(pool), m_pipeline(pool.acquire(primary)) {}
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    ~Lease() {
+        m_pool.release(m_pipeline);
+    }
+    StatefulLLMPipeline* operator->() const {
+        return m_pipeline;
+    }
+};
+
+StatefulLLMPipelinePool::StatefulLLMPipelinePool(std::unique_ptr<StatefulLLMPipeline> pipeline)
+    : LLMPipelineImplBase(pipeline->get_tokenizer(), pipeline->get_generation_config()),
+    m_primary(pipeline.get()) {
+    m_idle_pipelines.push_back(m_primary);
+    m_pipelines.push_back(std::move(pipeline));
+}
+
+StatefulLLMPipeline* StatefulLLMPipelinePool::acquire(bool primary) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (primary || m_is_chat_conversation) {
+        m_primary_released.wait(lock, [this] {
+            return std::find(m_idle_pipelines.begin(), m_idle_pipelines.end(), m_primary) != m_idle_pipelines.end();
+        });
+        m_idle_pipelines.erase(std::find(m_idle_pipelines.begin(), m_idle_pipelines.end(), m_primary));
+        return m_primary;
+    }
+    if (!m_idle_pipelines.empty()) {
+        // the replicas are taken first, so that the primary pipeline stays available for a chat
+        auto pipeline = std::find_if(m_idle_pipelines.begin(), m_idle_pipelines.end(), [this](StatefulLLMPipeline* idle) {
+            return idle != m_primary;
+        });
+        if (pipeline == m_idle_pipelines.end()) {
+            pipeline = m_idle_pipelines.begin();
+        }
+        StatefulLLMPipeline* acquired = *pipeline;
+        m_idle_pipelines.erase(pipeline);
+        return acquired;
+    }
+    // the configuration of the primary pipeline isn't changed after its construction, so it's read without the lock
+    lock.unlock();
+    std::unique_ptr<StatefulLLMPipeline> replica = m_primary->create_replica();
+    lock.lock();
+    m_pipelines.push_back(std::move(replica));
+    return m_pipelines.back().get();
+}
+
+void StatefulLLMPipelinePool::release(StatefulLLMPipeline* pipeline) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_idle_pipelines.push_back(pipeline);
+    }
+    if (pipeline == m_primary) {
+        m_primary_released.notify_all();
+    }
+}
+
+DecodedResults StatefulLLMPipelinePool::generate(
+    StringInputs inputs,
+    OptionalGenerationConfig generation_config,
+    StreamerVariant streamer) {
+    Lease pipeline(*this, false);
+    // the replicas keep the generation config of their construction, the config of the pool is passed explicitly
+    DecodedResults results = pipeline->generate(inputs, generation_config.has_value() ? generation_config : m_generation_config, streamer);
+    results.perf_metrics.load_time = m_load_time_ms;
+    return results;
+}
+
+EncodedResults StatefulLLMPipelinePool::generate(
+    const EncodedInputs& inputs,
+    OptionalGenerationConfig generation_config,
+    StreamerVariant streamer) {
+    Lease pipeline(*this, false);
+    EncodedResults results = pipeline->generate(inputs, generation_config.has_value() ? generation_config : m_generation_config, streamer);
+    results.perf_metrics.load_time = m_load_time_ms;
+    return results;
+}
+
+void StatefulLLMPipelinePool::start_chat(const std::string& system_message) {
+    Lease pipeline(*this, true);
+    pipeline->start_chat(system_message);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_is_chat_conversation = true;
+}
+
+void StatefulLLMPipelinePool::finish_chat() {
+    Lease pipeline(*this, true);
+    pipeline->finish_chat();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_is_chat_conversation = false;
+}
+
+void StatefulLLMPipelinePool::suspend_chat(const std::string& session_id) {
+    Lease pipeline(*this, true);
+    pipeline->suspend_chat(session_id);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_is_chat_conversation = false;
+}
+
+void StatefulLLMPipelinePool::resume_chat(const std::string& session_id) {
+    Lease pipeline(*this, true);
+    pipeline->resume_chat(session_id);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_is_chat_conversation = true;
+}
+
+std::unique_ptr<LLMPipelineImplBase> make_stateful_pipeline_pool(std::unique_ptr<StatefulLLMPipeline> pipeline) {
+    if (!pipeline->can_replicate()) {
+        return pipeline;
+    }
+    return std::make_unique<StatefulLLMPipelinePool>(std::move(pipeline));
+}
+
+}  // namespace ov::genai
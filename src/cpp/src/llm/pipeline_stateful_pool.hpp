@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "llm/pipeline_base.hpp"
+#include "llm/pipeline_stateful.hpp"
+
+namespace ov::genai {
+
+/**
+ * Multiplexes the concurrent generate() calls over the replicas of a stateful pipeline, which share its compiled model
+ * and have their own infer requests. A replica is created once all of the existing ones are busy, so the number of KV
+ * caches allocated is the max number of the concurrent calls. The chat is kept by the original pipeline, the calls are
+ * serialized on it while a chat is started.
+ */
+class StatefulLLMPipelinePool final : public LLMPipelineImplBase {
+    // the pipeline the pool was created from, it keeps the chat state
+    StatefulLLMPipeline* m_primary;
+    std::vector<std::unique_ptr<StatefulLLMPipeline>> m_pipelines;
+    std::vector<StatefulLLMPipeline*> m_idle_pipelines;
+    std::mutex m_mutex;
+    std::condition_variable m_primary_released;
+    bool m_is_chat_conversation = false;
+
+    class Lease;
+
+    StatefulLLMPipeline* acquire(bool primary);
+    void release(StatefulLLMPipeline* pipeline);
+
+public:
+    explicit StatefulLLMPipelinePool(std::unique_ptr<StatefulLLMPipeline> pipeline);
+
+    DecodedResults generate(
+        StringInputs inputs,
+        OptionalGenerationConfig generation_config,
+        StreamerVariant streamer
+    ) override;
+
+    EncodedResults generate(
+        const EncodedInputs& inputs,
+        OptionalGenerationConfig generation_config,
+        StreamerVariant streamer
+    ) override;
+
+    void start_chat(const std::string& system_message) override;
+
+    void finish_chat() override;
+
+    void suspend_chat(const std::string& session_id) override;
+
+    void resume_chat(const std::string& session_id) override;
+};
+
+/**
+ * Wraps the pipeline into StatefulLLMPipelinePool, if it can be replicated, see StatefulLLMPipeline::can_replicate().
+ */
+std::unique_ptr<LLMPipelineImplBase> make_stateful_pipeline_pool(std::unique_ptr<StatefulLLMPipeline> pipeline);
+
+}  // namespace ov::genai
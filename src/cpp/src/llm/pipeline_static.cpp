@@ -6,7 +6,9 @@
 #include "sampling/sampler.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <future>
 
 #include "openvino/runtime/core.hpp"
 #include "openvino/core/parallel.hpp"
@@ -14,18 +16,6 @@
 
 namespace {
 
-template <typename T>
-void fill_tensor(ov::Tensor tensor, T fill_val, size_t offset = 0u) {
-    T* tensor_data = tensor.data<T>();
-    std::fill(tensor_data + offset, tensor_data + tensor.get_size(), fill_val);
-}
-
-void copy_with_offset(const ov::Tensor& orig, const std::size_t offset, ov::Tensor& padded) {
-    auto orig_data = orig.data<int64_t>();
-    int64_t* padded_data = padded.data<int64_t>();
-    std::copy(orig_data, orig_data + orig.get_size(), padded_data + offset);
-}
-
 ov::Tensor make_tensor_slice(ov::Tensor tensor, size_t dim, size_t start_pos, size_t end_pos) {
     ov::Shape start_shape(std::vector<size_t>(tensor.get_shape().size(), 0u));
     start_shape[dim] = start_pos;
@@ -34,36 +24,6 @@ ov::Tensor make_tensor_slice(ov::Tensor tensor, size_t dim, size_t start_pos, si
     return ov::Tensor(tensor, start_shape, end_shape);
 }
 
-void copy_columns_by_row_chunks(const ov::Tensor& src, ov::Tensor& dst) {
-    const auto src_shape = src.get_shape();
-
-    OPENVINO_ASSERT(src_shape.size() == 4u);
-    OPENVINO_ASSERT(src_shape == dst.get_shape());
-    OPENVINO_ASSERT(src.get_byte_size() == dst.get_byte_size());
-
-    const auto src_strides = src.get_strides();
-    const auto dst_strides = dst.get_strides();
-    const auto elem_size   = src.get_byte_size() / src.get_size();
-
-    const auto C = src_shape[1];
-    const auto H = src_shape[2];
-    const auto W = src_shape[3];
-
-    const auto IS_H = src_strides[2];
-    const auto OS_H = dst_strides[2];
-
-    const size_t chunk_byte_size = W * elem_size;
-
-    const auto* src_p = static_cast<const uint8_t*>(src.data());
-    auto* dst_p = static_cast<uint8_t*>(dst.data());
-
-    for (size_t i = 0; i < C*H; ++i) {
-        const size_t src_offset = i * IS_H;
-        const size_t dst_offset = i * OS_H;
-        std::copy_n(src_p + src_offset, chunk_byte_size, dst_p + dst_offset);
-    }
-}
-
 void stream_generated_tokens(std::shared_ptr<ov::genai::StreamerBase> streamer_ptr,
                              ov::genai::GenerationHandle& handle) {
     if (streamer_ptr && handle->can_read()) {
@@ -111,10 +71,32 @@ StatefulLLMPipeline::StatefulLLMPipeline(
 ) : LLMPipelineImplBase(tokenizer, generation_config),
     m_sampler(m_tokenizer) {
     auto kv_pos = ov::genai::utils::get_kv_axes_pos(model);
-    auto [compiled, kv_desc] = utils::compile_decoder_for_npu(model, properties, kv_pos);
-    m_max_prompt_len = kv_desc.max_prompt_len;
-    m_kvcache_total = kv_desc.max_prompt_len + kv_desc.min_response_len;
-    m_request = compiled.create_infer_request();
+    auto properties_copy = properties;
+    const auto prefill_buckets = utils::pop_buckets(properties_copy, "PREFILL_BUCKETS");
+    if (prefill_buckets.empty()) {
+        auto [compiled, kv_desc] = utils::compile_decoder_for_npu(model, properties_copy, kv_pos);
+        m_buckets.push_back({kv_desc.max_prompt_len, kv_desc.max_prompt_len + kv_desc.min_response_len, compiled.create_infer_request()});
+    } else {
+        // NB: NPU pads the prompt to MAX_PROMPT_LEN the model is compiled for, so the model is compiled for each
+        //     of the prompt lengths to process the short prompts without the cost of the longest one
+        OPENVINO_ASSERT(properties_copy.count("MAX_PROMPT_LEN") == 0u,
+                        "\"MAX_PROMPT_LEN\" can't be used together with \"PREFILL_BUCKETS\", the largest bucket is the prompt length limit");
+        OPENVINO_ASSERT(properties_copy.count("BLOB_PATH") == 0u && properties_copy.count("EXPORT_BLOB") == 0u,
+                        "Import and export of the blob is not supported together with \"PREFILL_BUCKETS\", use \"BLOB_CACHE_DIR\" instead");
+        // NB: The buckets are compiled in parallel, as compilation of each of them takes a while
+        std::vector<std::future<std::pair<ov::CompiledModel, utils::KVDesc>>> compilations;
+        for (uint32_t max_prompt_len : prefill_buckets) {
+            auto bucket_properties = properties_copy;
+            bucket_properties["MAX_PROMPT_LEN"] = static_cast<int64_t>(max_prompt_len);
+            compilations.push_back(std::async(std::launch::async, [&model, &kv_pos, bucket_properties]() {
+                return utils::compile_decoder_for_npu(model, bucket_properties, kv_pos);
+            }));
+        }
+        for (auto& compilation : compilations) {
+            auto [compiled, kv_desc] = compilation.get();
+            m_buckets.push_back({kv_desc.max_prompt_len, kv_desc.max_prompt_len + kv_desc.min_response_len, compiled.create_infer_request()});
+        }
+    }
     m_sampler.set_seed(m_generation_config.rng_seed);
 }
 
@@ -230,22 +212,33 @@ EncodedResults StatefulLLMPipeline::generate(
 
     // NB: Check if there is enough space in KV-cache to process input prompt
     auto prompt_len = input_ids.get_size();
-    if (prompt_len > m_max_prompt_len) {
+    if (prompt_len > m_buckets.back().max_prompt_len) {
         OPENVINO_THROW("Static Stateful LLM pipeline may only process prompts up to "
-                       + std::to_string(m_max_prompt_len) + " tokens. "
-                       + "Set the \"MAX_PROMPT_LEN\" config option to increase the limit.");
+                       + std::to_string(m_buckets.back().max_prompt_len) + " tokens. "
+                       + "Set the \"MAX_PROMPT_LEN\" or \"PREFILL_BUCKETS\" config option to increase the limit.");
     }
+    // NB: Select the smallest bucket the whole generation fits in, so a long generation isn't cut by the KV-cache
+    //     of a short prompt bucket, or the largest one if none of them is enough
+    const size_t max_new_tokens = config.get_max_new_tokens(prompt_len);
+    auto bucket_it = std::find_if(m_buckets.begin(), m_buckets.end(), [prompt_len, max_new_tokens](const PrefillBucket& bucket) {
+        return prompt_len <= bucket.max_prompt_len && max_new_tokens <= bucket.kvcache_total - prompt_len;
+    });
+    if (bucket_it == m_buckets.end()) {
+        bucket_it = std::prev(m_buckets.end());
+    }
+    ov::InferRequest& request = bucket_it->request;
+    const uint32_t kvcache_total = bucket_it->kvcache_total;
 
     ov::Tensor position_ids{ov::element::i64, input_ids.get_shape()};
     utils::initialize_position_ids(position_ids, attention_mask);
 
-    m_request.set_tensor("input_ids", input_ids);
-    m_request.set_tensor("attention_mask", attention_mask);
-    m_request.set_tensor("position_ids", position_ids);
+    request.set_tensor("input_ids", input_ids);
+    request.set_tensor("attention_mask", attention_mask);
+    request.set_tensor("position_ids", position_ids);
 
-    m_request.infer();
+    request.infer();
 
-    auto padded_logits = m_request.get_tensor("logits");
+    auto padded_logits = request.get_tensor("logits");
     // FIXME: Here is workaround to get only useful units of returned logits.
     //        If SliceOut is applied, there will be only 1 useful logit returned,
     //        nothing is required here.
@@ -277,12 +270,12 @@ EncodedResults StatefulLLMPipeline::generate(
     int64_t input_ids_data = -1;
     int64_t position_ids_data = prompt_len - 1;
     std::vector<int64_t> attention_mask_data(prompt_len, 1);
-    m_request.set_tensor("input_ids", ov::Tensor(ov::element::i64, ov::Shape{1,1},  reinterpret_cast<void*>(&input_ids_data)));
-    m_request.set_tensor("position_ids", ov::Tensor(ov::element::i64, ov::Shape{1,1}, reinterpret_cast<void*>(&position_ids_data)));
+    request.set_tensor("input_ids", ov::Tensor(ov::element::i64, ov::Shape{1,1},  reinterpret_cast<void*>(&input_ids_data)));
+    request.set_tensor("position_ids", ov::Tensor(ov::element::i64, ov::Shape{1,1}, reinterpret_cast<void*>(&position_ids_data)));
 
     while (sequence_group->is_running() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
         // KV Cache is full, no further generation is possible
-        if (position_ids_data + 1 == m_kvcache_total) {
+        if (position_ids_data + 1 == kvcache_total) {
             sequence_group->set_out_of_memory();
             break;
         }
@@ -297,14 +290,14 @@ EncodedResults StatefulLLMPipeline::generate(
         ++position_ids_data;
         // However, attention_mask changes its shape on each iteration, it should be re-set explicitly
         attention_mask_data.push_back(1);
-        m_request.set_tensor("attention_mask", ov::Tensor(ov::element::i64, ov::Shape{1,attention_mask_data.size()}, (void*)&attention_mask_data[0]));
+        request.set_tensor("attention_mask", ov::Tensor(ov::element::i64, ov::Shape{1,attention_mask_data.size()}, (void*)&attention_mask_data[0]));
 
-        m_request.infer();
+        request.infer();
 
         raw_perf_counters.m_new_token_times.emplace_back(std::chrono::steady_clock::now());
         raw_perf_counters.m_batch_sizes.emplace_back(batch_size);
 
-        SamplerOutput sampler_output = m_sampler.sample({sequence_group}, m_request.get_tensor("logits"));
+        SamplerOutput sampler_output = m_sampler.sample({sequence_group}, request.get_tensor("logits"));
         stream_generated_tokens(streamer_ptr, handle);
     }
 
@@ -342,7 +335,9 @@ void StatefulLLMPipeline::finish_chat() {
 };
 
 StatefulLLMPipeline::~StatefulLLMPipeline() {
-    m_request.get_compiled_model().release_memory();
+    for (auto& bucket : m_buckets) {
+        bucket.request.get_compiled_model().release_memory();
+    }
 }
 
 std::unique_ptr<LLMPipelineImplBase>
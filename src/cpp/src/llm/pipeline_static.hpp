@@ -58,9 +58,14 @@ public:
     ~StatefulLLMPipeline();
 
 private:
-    uint32_t m_max_prompt_len = 0u;
-    uint32_t m_kvcache_total = 0u;
-    ov::InferRequest m_request;
+    // the model compiled for prompts up to `max_prompt_len` tokens
+    struct PrefillBucket {
+        uint32_t max_prompt_len = 0u;
+        uint32_t kvcache_total = 0u;
+        ov::InferRequest request;
+    };
+    // sorted by max_prompt_len, a single bucket unless "PREFILL_BUCKETS" property is set
+    std::vector<PrefillBucket> m_buckets;
 
     Sampler m_sampler;
 
@@ -0,0 +1,215 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "llm/weights_streamer.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <regex>
+#include <string>
+
+#include "logger.hpp"
+#include "openvino/op/constant.hpp"
+
+namespace {
+
+size_t get_page_size() {
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    return system_info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// e.g. "model.layers.12.self_attn.q_proj.weight" or "transformer.h.3.mlp.c_fc.weight"
+std::optional<size_t> get_layer_index(const std::string& name) {
+    static const std::regex layer_pattern(R"((?:^|[._/])(?:layers|layer|blocks|block|h)[._](\d+)(?:[._/]|$))");
+    std::smatch match;
+    if (std::regex_search(name, match, layer_pattern)) {
+        return std::stoul(match[1].str());
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+WeightsStreamer::WeightsStreamer(const std::shared_ptr<const ov::Model>& model,
+                                 const std::vector<size_t>& pinned_layers,
+                                 size_t read_ahead_layers)
+    : m_model(model),
+      m_read_ahead_layers(std::max<size_t>(read_ahead_layers, 1)) {
+    const size_t page_size = get_page_size();
+    // the small constants, e.g. the shapes, aren't worth a system call
+    const size_t min_constant_size = page_size;
+
+    std::map<size_t, std::vector<Range>> layers;
+    size_t layer = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        auto constant = std::dynamic_pointer_cast<const ov::op::v0::Constant>(op);
+        if (!constant) {
+            continue;
+        }
+        if (auto index = get_layer_index(constant->get_friendly_name())) {
+            layer = *index;
+        }
+        if (constant->get_byte_size() < min_constant_size) {
+            continue;
+        }
+        const auto data = reinterpret_cast<uintptr_t>(constant->get_data_ptr());
+        const uintptr_t begin = data / page_size * page_size;
+        const uintptr_t end = (data + constant->get_byte_size() + page_size - 1) / page_size * page_size;
+        layers[layer].push_back({reinterpret_cast<char*>(begin), end - begin});
+    }
+
+    for (auto& [index, ranges] : layers) {
+        // the constants of a layer are usually adjacent in the .bin file, so their ranges are merged
+        std::sort(ranges.begin(), ranges.end(), [](const Range& lhs, const Range& rhs) {
+            return lhs.begin < rhs.begin;
+        });
+        std::vector<Range> merged;
+        for (const Range& range : ranges) {
+            if (!merged.empty() && range.begin <= merged.back().begin + merged.back().size) {
+                merged.back().size = std::max(merged.back().size, static_cast<size_t>(range.begin + range.size - merged.back().begin));
+            } else {
+                merged.push_back(range);
+            }
+        }
+        if (std::find(pinned_layers.begin(), pinned_layers.end(), index) != pinned_layers.end()) {
+            for (const Range& range : merged) {
+#ifdef _WIN32
+                const bool is_locked = VirtualLock(range.begin, range.size);
+#else
+                const bool is_locked = mlock(range.begin, range.size) == 0;
+#endif
+                if (is_locked) {
+                    m_pinned.push_back(range);
+                } else {
+                    // e.g. RLIMIT_MEMLOCK is exceeded, the layer is streamed like the others
+                    Logger::warn("Failed to pin " + std::to_string(range.size) + " bytes of the weights of layer " +
+                                 std::to_string(index) + " in memory");
+                }
+            }
+        }
+        m_layers.push_back(std::move(merged));
+    }
+}
+
+WeightsStreamer::~WeightsStreamer() {
+    stop();
+    for (const Range& range : m_pinned) {
+#ifdef _WIN32
+        VirtualUnlock(range.begin, range.size);
+#else
+        munlock(range.begin, range.size);
+#endif
+    }
+}
+
+WeightsStreamer::Session::Session(WeightsStreamer* streamer) : m_streamer(streamer) {
+    if (m_streamer) {
+        m_streamer->start();
+    }
+}
+
+WeightsStreamer::Session::~Session() {
+    if (m_streamer) {
+        m_streamer->stop();
+    }
+}
+
+void WeightsStreamer::set_forward_duration(float duration_us) {
+    m_forward_duration_us = duration_us;
+}
+
+size_t WeightsStreamer::get_pinned_size() const {
+    size_t size = 0;
+    for (const Range& range : m_pinned) {
+        size += range.size;
+    }
+    return size;
+}
+
+void WeightsStreamer::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_is_streaming || m_layers.empty()) {
+        return;
+    }
+    m_is_streaming = true;
+    m_thread = std::thread(&WeightsStreamer::stream, this);
+}
+
+void WeightsStreamer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_streaming = false;
+    }
+    m_stop_condition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void WeightsStreamer::read_ahead(size_t layer) const {
+    for (const Range& range : m_layers[layer]) {
+#ifdef _WIN32
+        WIN32_MEMORY_RANGE_ENTRY entry{range.begin, range.size};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+#else
+        madvise(range.begin, range.size, MADV_WILLNEED);
+#endif
+    }
+}
+
+void WeightsStreamer::stream() {
+    const size_t num_layers = m_layers.size();
+    const size_t window = std::min(m_read_ahead_layers, num_layers);
+    for (size_t layer = 0; layer < window; ++layer) {
+        read_ahead(layer);
+    }
+
+    // the layer expected to be executed, the window of the layers after it is read ahead
+    size_t layer = 0, num_steps = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_is_streaming) {
+        const float forward_duration_us = m_forward_duration_us;
+        if (forward_duration_us <= 0.0f && num_steps >= num_layers) {
+            // the pace is unknown, the whole model is read ahead once
+            m_stop_condition.wait(lock, [this] {
+                return !m_is_streaming;
+            });
+            break;
+        }
+        if (forward_duration_us > 0.0f) {
+            const auto layer_duration = std::chrono::duration<float, std::micro>(forward_duration_us / num_layers);
+            if (m_stop_condition.wait_for(lock, layer_duration, [this] {
+                    return !m_is_streaming;
+                })) {
+                break;
+            }
+        }
+        lock.unlock();
+        layer = (layer + 1) % num_layers;
+        read_ahead((layer + window - 1) % num_layers);
+        ++num_steps;
+        lock.lock();
+    }
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Streams the weights of a model, whose constants are memory mapped from the IR .bin file, for the models which
+ * don't fit the host memory. The constants are grouped by the decoder layers in the execution order. While the model is
+ * inferred, the pages of the next layers are requested to be read ahead, keeping a window of layers ahead of the layer
+ * expected to be executed, which is estimated from the duration of a forward pass. The pages of the other layers are left
+ * to be reclaimed by the OS, except for the pinned layers, which are locked in memory.
+ * Read-ahead is a hint to the OS, the weights repacked by the plugin into its own buffers are not affected.
+ */
+class WeightsStreamer {
+public:
+    /**
+     * @param model The model, whose constants are streamed, it's kept by the streamer to keep the constants mapped.
+     * @param pinned_layers Indices of the decoder layers locked in memory, e.g. the layers executed by each pass of the
+     *        early-exit decoding. The constants, which don't belong to a layer, are streamed with the nearest previous layer.
+     * @param read_ahead_layers Number of the layers read ahead of the expected one.
+     */
+    WeightsStreamer(const std::shared_ptr<const ov::Model>& model,
+                    const std::vector<size_t>& pinned_layers,
+                    size_t read_ahead_layers = 2);
+    ~WeightsStreamer();
+
+    WeightsStreamer(const WeightsStreamer&) = delete;
+    WeightsStreamer& operator=(const WeightsStreamer&) = delete;
+
+    // Streams the weights on a background thread while the session is alive, e.g. during a generate() call
+    class Session {
+        WeightsStreamer* m_streamer;
+
+    public:
+        explicit Session(WeightsStreamer* streamer);
+        ~Session();
+
+        Session(const Session&) = delete;
+        Session& operator=(const Session&) = delete;
+    };
+
+    /**
+     * Sets the duration of a forward pass, which paces the read-ahead. Until it's known, the layers are read ahead one
+     * after another as fast as the OS accepts the hints, once per session.
+     */
+    void set_forward_duration(float duration_us);
+
+    size_t get_num_layers() const {
+        return m_layers.size();
+    }
+
+    // number of the bytes of the pinned layers locked in memory
+    size_t get_pinned_size() const;
+
+private:
+    // page aligned range of the memory of the constants
+    struct Range {
+        char* begin;
+        size_t size;
+    };
+
+    void start();
+    void stop();
+    void stream();
+    void read_ahead(size_t layer) const;
+
+    std::shared_ptr<const ov::Model> m_model;
+    std::vector<std::vector<Range>> m_layers;
+    std::vector<Range> m_pinned;
+    size_t m_read_ahead_layers;
+    std::atomic<float> m_forward_duration_us{0.0f};
+
+    std::mutex m_mutex;
+    std::condition_variable m_stop_condition;
+    bool m_is_streaming = false;
+    std::thread m_thread;
+};
+
+}  // namespace ov::genai
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <numeric>
 #include <random>
@@ -10,30 +11,13 @@
 
 #include "utils.hpp"
 #include "lm_encoding.hpp"
+#include "prompt_lookup/ngram_index.hpp"
 #include "openvino/genai/perf_metrics.hpp"
 #include "openvino/genai/streamer_base.hpp"
 
 namespace {
 
-/**
- * Set position ids tensor data for next token inference based on provided attention mask
- * Supports multi batch
- * Supports sparse attention_mask
- */
-void update_position_ids(ov::Tensor&& position_ids, const ov::Tensor&& attention_mask) {
-    const size_t batch_size = attention_mask.get_shape().at(0);
-    const size_t sequence_length = attention_mask.get_shape().at(1);
-    position_ids.set_shape({batch_size, 1});
-
-    for (size_t batch = 0; batch < batch_size; batch++) {
-        auto mask_start = attention_mask.data<int64_t>() + batch * sequence_length;
-        position_ids.data<int64_t>()[batch] = std::accumulate(mask_start, mask_start + sequence_length - 1, 0);
-    }
-}
-
-void update_3d_position_ids(ov::Tensor&& position_ids, const ov::Tensor& attention_mask, const int64_t rope_delta) {
-    const size_t batch_size = attention_mask.get_shape().at(0);
-    const size_t sequence_length = attention_mask.get_shape().at(1);
+void update_3d_position_ids(ov::Tensor&& position_ids, const size_t batch_size, const size_t sequence_length, const int64_t rope_delta) {
     const size_t thw_dim_size = 3;
 
     position_ids.set_shape({thw_dim_size, batch_size, 1});
@@ -48,30 +32,139 @@ void update_3d_position_ids(ov::Tensor&& position_ids, const ov::Tensor& attenti
     }
 }
 
-void update_attention_mask_with_beams(ov::Tensor&& attention_mask, std::vector<int32_t> next_beams) {
-    ov::Tensor original_mask{ov::element::i64, attention_mask.get_shape()};
-    ov::Shape original_shape = original_mask.get_shape();
-    attention_mask.copy_to(original_mask);
+/**
+ * Appends the tokens, which followed the previous occurrence of the last n-gram of the sequence, to the sequence as
+ * candidates to be validated by the model at the next inference. Only accepted tokens are added to the n-gram index.
+ * @return The number of candidates.
+ */
+size_t append_prompt_lookup_candidates(const ov::genai::SequenceGroup::Ptr& sequence_group, ov::genai::NgramIndex& ngram_index) {
+    const auto& sampling_params = sequence_group->get_sampling_parameters();
+    const auto& prompt = sequence_group->get_prompt_ids();
+    ov::genai::Sequence::Ptr sequence = sequence_group->get_running_sequences().at(0);
+    const auto& generated_tokens = sequence->get_generated_ids();
+
+    for (size_t pos = ngram_index.get_tokens().size(); pos < prompt.size() + generated_tokens.size(); ++pos) {
+        ngram_index.append(pos < prompt.size() ? prompt[pos] : generated_tokens[pos - prompt.size()]);
+    }
+
+    const size_t generated_len = sequence->get_generated_len();
+    const size_t left_generated_len = sampling_params.get_max_new_tokens(prompt.size()) > generated_len + 1 ?
+        sampling_params.get_max_new_tokens(prompt.size()) - generated_len - 1 : 0;
+    const auto candidates = ngram_index.find_candidates(std::min(sampling_params.num_assistant_tokens, left_generated_len));
+    for (int64_t candidate : candidates) {
+        sequence->append_token(candidate, 0);
+    }
+    sequence_group->set_num_validated_tokens(candidates.size());
+    return candidates.size();
+}
 
-    ov::Shape new_shape{next_beams.size(), original_mask.get_shape().at(1) + 1};
-    attention_mask.set_shape(new_shape);
+// copies the [begin, end) range of the second (sequence length) dimension of a tensor, e.g. a chunk of the prompt
+ov::Tensor slice_sequence(const ov::Tensor& tensor, size_t begin, size_t end) {
+    ov::Shape shape = tensor.get_shape();
+    const size_t batch_size = shape.at(0), sequence_length = shape.at(1);
+    OPENVINO_ASSERT(begin <= end && end <= sequence_length);
+    const size_t token_size_in_bytes = tensor.get_byte_size() / (batch_size * sequence_length);
+    shape[1] = end - begin;
+    ov::Tensor slice(tensor.get_element_type(), shape);
+    const uint8_t* src = static_cast<const uint8_t*>(tensor.data());
+    uint8_t* dst = static_cast<uint8_t*>(slice.data());
+    for (size_t batch = 0; batch < batch_size; ++batch) {
+        std::memcpy(dst + batch * (end - begin) * token_size_in_bytes,
+                    src + (batch * sequence_length + begin) * token_size_in_bytes,
+                    (end - begin) * token_size_in_bytes);
+    }
+    return slice;
+}
 
-    for (size_t beam_id = 0; beam_id < next_beams.size(); beam_id++) {
-        const size_t original_prompt_offset = next_beams.at(beam_id) * original_shape.at(1);
-        const size_t result_prompt_offset = beam_id * new_shape.at(1);
+// removes the last tokens from the model state and the attention mask, e.g. candidates which were not accepted
+void trim_last_tokens(ov::InferRequest& llm, size_t num_tokens, ov::genai::utils::KVCacheState& kv_cache_state,
+                      ov::genai::GenerationInputs& generation_inputs, const std::optional<ov::genai::AdapterController>& adapter_controller) {
+    ov::genai::utils::KVCacheState tokens_to_trim;
+    tokens_to_trim.seq_length_axis = kv_cache_state.seq_length_axis;
+    tokens_to_trim.num_tokens_to_trim = num_tokens;
+    ov::genai::utils::trim_kv_cache(llm, tokens_to_trim, adapter_controller);
 
-        int64_t* dest = attention_mask.data<int64_t>() + result_prompt_offset;
-        const int64_t* src = original_mask.data<int64_t>() + original_prompt_offset;
+    std::vector<int64_t>& state = kv_cache_state.get_state();
+    state.resize(state.size() - std::min(num_tokens, state.size()));
 
-        std::memcpy(dest, src, original_shape.at(1) * sizeof(int64_t));
-        attention_mask.data<int64_t>()[result_prompt_offset + new_shape.at(1) - 1] = 1;
-    }
+    generation_inputs.trim(num_tokens);
+    llm.set_tensor("attention_mask", generation_inputs.get_attention_mask());
 }
 }
 
 namespace ov {
 namespace genai {
 
+GenerationInputs::GenerationInputs(const ov::Tensor& attention_mask) :
+        m_batch_size(attention_mask.get_shape().at(0)),
+        m_sequence_length(attention_mask.get_shape().at(1)),
+        m_num_attended_tokens(m_batch_size) {
+    const int64_t* attention_mask_data = attention_mask.data<const int64_t>();
+    m_attention_mask.assign(attention_mask_data, attention_mask_data + attention_mask.get_size());
+    for (size_t batch = 0; batch < m_batch_size; ++batch) {
+        const int64_t* row = attention_mask_data + batch * m_sequence_length;
+        m_num_attended_tokens[batch] = std::accumulate(row, row + m_sequence_length, int64_t(0));
+    }
+}
+
+void GenerationInputs::append(const std::vector<int32_t>& next_beams, size_t num_new_tokens) {
+    const size_t new_sequence_length = m_sequence_length + num_new_tokens;
+    if (next_beams.size() == 1 && m_batch_size == 1) {
+        // the only row grows in place, the vector doubles its capacity when it's exhausted
+        m_attention_mask.resize(new_sequence_length, 1);
+    } else {
+        m_next_attention_mask.resize(next_beams.size() * new_sequence_length);
+        for (size_t beam_id = 0; beam_id < next_beams.size(); ++beam_id) {
+            const int64_t* src = m_attention_mask.data() + next_beams[beam_id] * m_sequence_length;
+            int64_t* dst = m_next_attention_mask.data() + beam_id * new_sequence_length;
+            std::copy_n(src, m_sequence_length, dst);
+            std::fill_n(dst + m_sequence_length, num_new_tokens, 1);
+        }
+        std::swap(m_attention_mask, m_next_attention_mask);
+    }
+
+    std::vector<int64_t> num_attended_tokens(next_beams.size());
+    for (size_t beam_id = 0; beam_id < next_beams.size(); ++beam_id) {
+        num_attended_tokens[beam_id] = m_num_attended_tokens.at(next_beams[beam_id]);
+    }
+    if (!m_position_ids || m_position_ids.get_shape() != ov::Shape{next_beams.size(), num_new_tokens}) {
+        m_position_ids = ov::Tensor(ov::element::i64, {next_beams.size(), num_new_tokens});
+    }
+    int64_t* position_ids_data = m_position_ids.data<int64_t>();
+    for (size_t beam_id = 0; beam_id < next_beams.size(); ++beam_id) {
+        std::iota(position_ids_data + beam_id * num_new_tokens, position_ids_data + (beam_id + 1) * num_new_tokens, num_attended_tokens[beam_id]);
+        num_attended_tokens[beam_id] += num_new_tokens;
+    }
+    m_num_attended_tokens = std::move(num_attended_tokens);
+
+    m_batch_size = next_beams.size();
+    m_sequence_length = new_sequence_length;
+    m_num_new_tokens = num_new_tokens;
+}
+
+void GenerationInputs::trim(size_t num_tokens) {
+    OPENVINO_ASSERT(num_tokens <= m_sequence_length);
+    const size_t new_sequence_length = m_sequence_length - num_tokens;
+    // rows move towards the beginning of the buffer, so the ones which are not moved yet are never overwritten
+    for (size_t batch = 1; batch < m_batch_size; ++batch) {
+        std::copy_n(m_attention_mask.data() + batch * m_sequence_length, new_sequence_length,
+                    m_attention_mask.data() + batch * new_sequence_length);
+    }
+    m_attention_mask.resize(m_batch_size * new_sequence_length);
+    for (int64_t& num_attended_tokens : m_num_attended_tokens) {
+        num_attended_tokens -= static_cast<int64_t>(num_tokens);
+    }
+    m_sequence_length = new_sequence_length;
+}
+
+ov::Tensor GenerationInputs::get_attention_mask() {
+    return ov::Tensor(ov::element::i64, {m_batch_size, m_sequence_length}, m_attention_mask.data());
+}
+
+ov::Tensor GenerationInputs::get_position_ids() {
+    return m_position_ids;
+}
+
 ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     ov::InferRequest& m_llm,
     const ov::Tensor& input_ids,
@@ -84,7 +177,9 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     utils::KVCacheState& kv_cache_state,
     EmbeddingsModel::Ptr m_embedding,
     std::optional<int64_t> rope_delta,
-    const size_t max_kv_cache_size
+    const size_t max_kv_cache_size,
+    const std::optional<AdapterController>& adapter_controller,
+    const size_t prefill_chunk_size
 ) {
     std::vector<GenerationHandle> generations;
     for (SequenceGroup::Ptr sequence_group : sequence_groups) {
@@ -125,6 +220,27 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     ov::Shape prompts_shape = input_ids.get_shape();
     const size_t batch_size = prompts_shape[0];
 
+    // prompt lookup decoding validates several candidate tokens per inference and trims the rejected ones from the state
+    const bool is_prompt_lookup = !m_embedding && sequence_groups.at(0)->get_sampling_parameters().is_prompt_lookup();
+    OPENVINO_ASSERT(!is_prompt_lookup || sequence_groups.size() == 1, "Prompt lookup decoding is supported only for batch size equal to 1");
+    std::optional<NgramIndex> ngram_index;
+    if (is_prompt_lookup) {
+        ngram_index.emplace(sequence_groups.at(0)->get_sampling_parameters().max_ngram_size);
+    }
+
+    // the model computes logits only for the positions passed as `sampled_tokens_indices`, if it has such input
+    const auto& llm_inputs = m_llm.get_compiled_model().inputs();
+    const bool has_sampled_tokens_indices = std::any_of(llm_inputs.begin(), llm_inputs.end(), [](const ov::Output<const ov::Node>& input) {
+        return input.get_names().count("sampled_tokens_indices") > 0;
+    });
+    auto set_sampled_tokens_indices = [&m_llm, has_sampled_tokens_indices](size_t begin, size_t end) {
+        if (!has_sampled_tokens_indices)
+            return;
+        ov::Tensor sampled_tokens_indices(ov::element::i64, {end - begin});
+        std::iota(sampled_tokens_indices.data<int64_t>(), sampled_tokens_indices.data<int64_t>() + (end - begin), int64_t(begin));
+        m_llm.set_tensor("sampled_tokens_indices", sampled_tokens_indices);
+    };
+
     // Initialize results and performance metrics.
 
     ov::genai::utils::GenerationFinishInfo finish_info;
@@ -133,30 +249,48 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 
     // Initialize inputs
 
-    if (m_embedding) {
-        m_llm.set_tensor("inputs_embeds", input_ids);
-        if (token_type_ids.has_value())
-            m_llm.set_tensor("token_type_ids", *token_type_ids);
-    } else {
+    if (!m_embedding) {
         kv_cache_state.add_inputs(input_ids);
-        m_llm.set_tensor("input_ids", input_ids);
     }
-    m_llm.set_tensor("attention_mask", attention_mask);
-    if (position_ids.has_value())
-        m_llm.set_tensor("position_ids", *position_ids);
-
     ov::Tensor beam_idx = ov::Tensor(ov::element::i32, {batch_size});
     std::fill_n(beam_idx.data<int32_t>(), batch_size, 0);
     m_llm.set_tensor("beam_idx", beam_idx);
 
     // "Prompt" phase
 
-    const auto infer_start = std::chrono::steady_clock::now();
-    m_llm.infer();
-    const auto infer_end = std::chrono::steady_clock::now();
-    const auto infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
-    raw_perf_counters.m_inference_durations[0] += MicroSeconds(infer_ms);
-    raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
+    // long prompts are processed in chunks against the model state to bound the size of the intermediate activations,
+    // the models with 3D position ids or token type ids are not chunked
+    const size_t prompt_len = prompts_shape[1];
+    const size_t history_len = attention_mask.get_shape().at(1) - prompt_len;
+    const bool is_chunked_prefill = prefill_chunk_size > 0 && prompt_len > prefill_chunk_size && !token_type_ids.has_value() &&
+                                    (!position_ids.has_value() || position_ids->get_shape().size() == 2);
+    const size_t chunk_size = is_chunked_prefill ? prefill_chunk_size : prompt_len;
+
+    float prefill_ms = 0.0f;
+    std::chrono::steady_clock::time_point infer_end;
+    for (size_t chunk_begin = 0; chunk_begin < prompt_len; chunk_begin += chunk_size) {
+        const size_t chunk_end = std::min(chunk_begin + chunk_size, prompt_len);
+        const bool is_whole_prompt = chunk_begin == 0 && chunk_end == prompt_len;
+        m_llm.set_tensor(m_embedding ? "inputs_embeds" : "input_ids", is_whole_prompt ? input_ids : slice_sequence(input_ids, chunk_begin, chunk_end));
+        m_llm.set_tensor("attention_mask", is_whole_prompt ? attention_mask : slice_sequence(attention_mask, 0, history_len + chunk_end));
+        if (m_embedding && token_type_ids.has_value())
+            m_llm.set_tensor("token_type_ids", *token_type_ids);
+        if (position_ids.has_value())
+            m_llm.set_tensor("position_ids", is_whole_prompt ? *position_ids : slice_sequence(*position_ids, chunk_begin, chunk_end));
+        set_sampled_tokens_indices(chunk_end - chunk_begin - 1, chunk_end - chunk_begin);
+        if (chunk_begin == chunk_size) {
+            // the state holds a row per prompt after the first chunk, each row has to be kept in place
+            std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + batch_size, 0);
+            m_llm.set_tensor("beam_idx", beam_idx);
+        }
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        m_llm.infer();
+        infer_end = std::chrono::steady_clock::now();
+        prefill_ms += PerfMetrics::get_microsec(infer_end - infer_start);
+    }
+    raw_perf_counters.m_inference_durations[0] += MicroSeconds(prefill_ms);
+    raw_perf_counters.m_token_infer_durations.emplace_back(prefill_ms);
     raw_perf_counters.m_new_token_times.emplace_back(infer_end);
     raw_perf_counters.m_batch_sizes.emplace_back(batch_size);
 
@@ -172,22 +306,29 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     for (size_t i = 0; i < sequence_groups.size(); i++)
         beam_offets.insert({sequence_groups.at(i)->get_request_id(), i});
 
-    SamplerOutput sampler_output = sampler.sample(sequence_groups, logits);
+    SamplerOutput sampler_output = sampler.sample(sequence_groups, logits, is_prompt_lookup);
     free_non_running_requests(); // handle sampler output
 
     // "Generation" phase
 
+    GenerationInputs generation_inputs(attention_mask);
+
     while (!active_sequence_groups.empty()) {
         size_t total_num_tokens = 0;
+        // the last generated token and the candidates, if any
+        size_t num_tokens_per_sequence = 1;
+        if (is_prompt_lookup) {
+            num_tokens_per_sequence += append_prompt_lookup_candidates(active_sequence_groups.at(0), *ngram_index);
+        }
 
         for (auto& sequence_group : active_sequence_groups) {
-            sequence_group->schedule_tokens(1);
+            sequence_group->schedule_tokens(num_tokens_per_sequence);
             // compute aggregated values
             size_t num_sequences = sequence_group->num_running_seqs();
             total_num_tokens += sequence_group->get_num_scheduled_tokens() * num_sequences;
         }
 
-        ov::Tensor new_input_ids(ov::element::i64, {total_num_tokens, 1});
+        ov::Tensor new_input_ids(ov::element::i64, {total_num_tokens / num_tokens_per_sequence, num_tokens_per_sequence});
         int64_t * input_ids_data = new_input_ids.data<int64_t>();
 
         std::vector<int32_t> next_beams;
@@ -221,8 +362,12 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
             current_batch_size += num_running_sequences;
         }
 
-        for (size_t i = 0; i < active_sequence_groups.size(); i++) {
-            beam_offets[active_sequence_groups.at(i)->get_request_id()] = i == 0 ? 0 : (active_sequence_groups.at(i - 1)->num_running_seqs() + beam_offets[i - 1]);
+        // rows of the finished sequence groups are dropped from the next batch (and from the model state by beam_idx),
+        // so the offsets of the remaining groups are recomputed over the compacted batch
+        size_t beam_offset = 0;
+        for (auto& sequence_group : active_sequence_groups) {
+            beam_offets[sequence_group->get_request_id()] = beam_offset;
+            beam_offset += sequence_group->num_running_seqs();
         }
 
         if (m_embedding) {
@@ -244,20 +389,27 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
         // we don't need to keep state for non chat mode and for beam_search in chat mode
         // in case of beam_search in chat mode, kv cache contains info about longest generated result among all sequences
         // last answer will be removed from kv_cache and will be included to the prompt on the next step
-        if (new_input_ids.get_size() == 1)
+        if (new_input_ids.get_shape().at(0) == 1)
             kv_cache_state.add_inputs(new_input_ids);
 
-        update_attention_mask_with_beams(m_llm.get_tensor("attention_mask"), next_beams);
+        generation_inputs.append(next_beams, num_tokens_per_sequence);
+        m_llm.set_tensor("attention_mask", generation_inputs.get_attention_mask());
 
         if (position_ids.has_value()) {
             if (position_ids->get_shape().size() == 3 && rope_delta.has_value()) {
-                update_3d_position_ids(m_llm.get_tensor("position_ids"), m_llm.get_tensor("attention_mask"), rope_delta.value());
+                update_3d_position_ids(m_llm.get_tensor("position_ids"), next_beams.size(), generation_inputs.get_sequence_length(), rope_delta.value());
             } else {
-                update_position_ids(m_llm.get_tensor("position_ids"), m_llm.get_tensor("attention_mask"));
+                m_llm.set_tensor("position_ids", generation_inputs.get_position_ids());
             }
         }
 
-        m_llm.set_tensor("beam_idx", ov::Tensor{ov::element::i32, {total_num_tokens}, next_beams.data()});
+        m_llm.set_tensor("beam_idx", ov::Tensor{ov::element::i32, {next_beams.size()}, next_beams.data()});
+        set_sampled_tokens_indices(0, num_tokens_per_sequence);
+
+        // number of tokens in the model state after the inference
+        SequenceGroup::Ptr prompt_lookup_sequence_group = is_prompt_lookup ? active_sequence_groups.at(0) : nullptr;
+        const size_t num_state_tokens = prompt_lookup_sequence_group ?
+            prompt_lookup_sequence_group->get_num_processed_tokens() + num_tokens_per_sequence : 0;
 
         const auto infer_start = std::chrono::steady_clock::now();
         m_llm.start_async();
@@ -274,10 +426,26 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
         raw_perf_counters.m_new_token_times.emplace_back(infer_end);
         raw_perf_counters.m_batch_sizes.emplace_back(current_batch_size);
 
-        sampler_output = sampler.sample(active_sequence_groups, m_llm.get_tensor("logits"));
+        OPENVINO_ASSERT(!is_prompt_lookup || m_llm.get_tensor("logits").get_shape().at(1) == num_tokens_per_sequence,
+                        "Prompt lookup decoding requires the model to compute logits for all candidates");
+        // the sequence group is not sampled, if its generation has been stopped by the streamer
+        const bool is_prompt_lookup_sampled = prompt_lookup_sequence_group && !active_sequence_groups.empty();
+        sampler_output = sampler.sample(active_sequence_groups, m_llm.get_tensor("logits"), is_prompt_lookup);
+        if (is_prompt_lookup_sampled && prompt_lookup_sequence_group->get_num_processed_tokens() < num_state_tokens) {
+            // the sampler has rolled the sequence back to the last accepted token
+            trim_last_tokens(m_llm, num_state_tokens - prompt_lookup_sequence_group->get_num_processed_tokens(), kv_cache_state,
+                             generation_inputs, adapter_controller);
+        }
         free_non_running_requests(); // handle sampler output
     }
 
+    // the attention mask of the model is the view of the buffer of the generation inputs, the pipelines use it as
+    // the history after the generation, so it's replaced by an owning copy
+    ov::Tensor final_attention_mask = m_llm.get_tensor("attention_mask");
+    ov::Tensor owned_attention_mask(final_attention_mask.get_element_type(), final_attention_mask.get_shape());
+    final_attention_mask.copy_to(owned_attention_mask);
+    m_llm.set_tensor("attention_mask", owned_attention_mask);
+
     stream_generated_tokens();
     if (streamer_ptr) { // push streamer's cache
         streamer_ptr->end();
@@ -307,6 +475,61 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 }
 
 
+std::vector<std::vector<size_t>> get_prompt_length_buckets(const ov::Tensor& attention_mask, float max_length_ratio) {
+    OPENVINO_ASSERT(max_length_ratio >= 1.0f, "max_length_ratio must be at least 1, got ", max_length_ratio);
+    const size_t batch_size = attention_mask.get_shape().at(0), sequence_length = attention_mask.get_shape().at(1);
+    const int64_t* mask_data = attention_mask.data<const int64_t>();
+    std::vector<size_t> lengths(batch_size);
+    for (size_t row = 0; row < batch_size; ++row) {
+        lengths[row] = std::accumulate(mask_data + row * sequence_length, mask_data + (row + 1) * sequence_length, size_t(0));
+    }
+    std::vector<size_t> rows(batch_size);
+    std::iota(rows.begin(), rows.end(), 0);
+    std::stable_sort(rows.begin(), rows.end(), [&lengths](size_t lhs, size_t rhs) { return lengths[lhs] < lengths[rhs]; });
+
+    std::vector<std::vector<size_t>> buckets;
+    for (size_t row : rows) {
+        if (buckets.empty() || lengths[row] > std::max<size_t>(lengths[buckets.back().front()], 1) * max_length_ratio) {
+            buckets.emplace_back();
+        }
+        buckets.back().push_back(row);
+    }
+    return buckets;
+}
+
+TokenizedInputs get_batch_rows(const TokenizedInputs& inputs, const std::vector<size_t>& rows) {
+    OPENVINO_ASSERT(!rows.empty());
+    const size_t sequence_length = inputs.input_ids.get_shape().at(1);
+    const int64_t* mask_data = inputs.attention_mask.data<const int64_t>();
+    // the range of columns attended by any of the rows, the rest is padding common to all of them
+    size_t begin = sequence_length, end = 0;
+    for (size_t row : rows) {
+        const int64_t* row_mask = mask_data + row * sequence_length;
+        for (size_t column = 0; column < sequence_length; ++column) {
+            if (row_mask[column] != 0) {
+                begin = std::min(begin, column);
+                end = std::max(end, column + 1);
+            }
+        }
+    }
+    if (begin >= end) {
+        begin = 0;
+        end = sequence_length;
+    }
+
+    TokenizedInputs result;
+    result.input_ids = ov::Tensor(ov::element::i64, {rows.size(), end - begin});
+    result.attention_mask = ov::Tensor(ov::element::i64, {rows.size(), end - begin});
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const size_t offset = rows[i] * sequence_length;
+        std::copy(inputs.input_ids.data<const int64_t>() + offset + begin, inputs.input_ids.data<const int64_t>() + offset + end,
+                  result.input_ids.data<int64_t>() + i * (end - begin));
+        std::copy(mask_data + offset + begin, mask_data + offset + end, result.attention_mask.data<int64_t>() + i * (end - begin));
+    }
+    return result;
+}
+
+
 TokenizedInputs get_chat_encoded_input(const ov::Tensor& new_chat_tokens, utils::KVCacheState& kv_cache_state) {
     TokenizedInputs encoded_input;
     size_t kv_cache_len = kv_cache_state.get_state().size();
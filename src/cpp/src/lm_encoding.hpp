@@ -8,15 +8,71 @@
 namespace ov {
 namespace genai {
 
+/**
+ * Attention mask and position ids of the generation phase of the stateful model, updated in place so that the host
+ * overhead per generated token doesn't grow with the context. The attention mask buffer grows by doubling its
+ * capacity and the position ids are computed from the number of attended tokens of each sequence instead of the
+ * attention mask. The tensors returned by the getters are views of the internal buffers, valid until the next update.
+ */
+class GenerationInputs {
+public:
+    explicit GenerationInputs(const ov::Tensor& attention_mask);
+
+    /**
+     * Reorders the sequences according to `next_beams`, rows of the current batch, and appends `num_new_tokens`
+     * attended tokens to each of them.
+     */
+    void append(const std::vector<int32_t>& next_beams, size_t num_new_tokens);
+
+    /**
+     * Removes the last `num_tokens` tokens of each sequence, e.g. candidates which were not accepted.
+     */
+    void trim(size_t num_tokens);
+
+    ov::Tensor get_attention_mask();
+
+    /**
+     * @return Position ids of the tokens appended by the last `append` call.
+     */
+    ov::Tensor get_position_ids();
+
+    size_t get_sequence_length() const {
+        return m_sequence_length;
+    }
+
+private:
+    size_t m_batch_size = 0;
+    size_t m_sequence_length = 0;
+    size_t m_num_new_tokens = 0;
+    std::vector<int64_t> m_attention_mask, m_next_attention_mask;
+    std::vector<int64_t> m_num_attended_tokens;
+    ov::Tensor m_position_ids;
+};
+
 ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(ov::InferRequest& m_llm, const ov::Tensor& input_ids, const ov::Tensor& attention_mask,
                                                               const std::shared_ptr<StreamerBase>& streamer_ptr, Sampler& sampler, std::vector<SequenceGroup::Ptr> sequence_groups,
                                                               std::optional<ov::Tensor> position_ids, std::optional<ov::Tensor> token_type_ids, utils::KVCacheState& m_kv_cache_state, EmbeddingsModel::Ptr m_embedding,
-                                                              std::optional<int64_t> rope_delta = std::nullopt, const size_t max_kv_cache_size = std::numeric_limits<size_t>::max());
+                                                              std::optional<int64_t> rope_delta = std::nullopt, const size_t max_kv_cache_size = std::numeric_limits<size_t>::max(),
+                                                              const std::optional<AdapterController>& adapter_controller = std::nullopt,
+                                                              const size_t prefill_chunk_size = 0);
 
 
 void align_kv_cache_and_history(const ov::Tensor& new_chat_tokens, utils::KVCacheState& kv_cache_state);
 
 
+/**
+ * Splits the rows of a batch of padded prompts into buckets of prompts with similar lengths, to be generated separately
+ * with less padding. Prompts are ordered by length and a new bucket is started by the prompt, which is more than
+ * `max_length_ratio` times longer than the shortest prompt of the current bucket.
+ * @return Row indices of the prompts of each bucket.
+ */
+std::vector<std::vector<size_t>> get_prompt_length_buckets(const ov::Tensor& attention_mask, float max_length_ratio);
+
+/**
+ * @return The given rows of a batch of padded prompts, without the padding columns which are common to all these rows.
+ */
+TokenizedInputs get_batch_rows(const TokenizedInputs& inputs, const std::vector<size_t>& rows);
+
 TokenizedInputs get_chat_encoded_input(const ov::Tensor& new_chat_tokens, utils::KVCacheState& kv_cache_state);
 
 }
@@ -15,6 +15,11 @@
 #include <functional>
 #include <memory>
 #include <cmath>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <list>
+#include <mutex>
 
 #include "openvino/op/add.hpp"
 #include "openvino/op/multiply.hpp"
@@ -31,6 +36,8 @@
 #include "openvino/op/gather.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/shape_of.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/core/rt_info.hpp"
 #include "openvino/op/util/variable.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
@@ -41,6 +48,7 @@
 
 #include "utils.hpp"
 #include "lora/common.hpp"
+#include "lora/fusion.hpp"
 #include "lora/names_mapping.hpp"
 
 extern "C" {
@@ -216,6 +224,24 @@ NodePtr unsqueeze (const ov::Output<ov::Node>& input, unsigned int rank) {
 }
 
 
+// Batched alpha has a dynamic batch dimension, while alpha of a single row has shape [1, rank].
+bool is_batched_alpha (const ov::Output<ov::Node>& alpha) {
+    const auto& shape = alpha.get_partial_shape();
+    return shape.rank().is_static() && shape.rank().get_length() == 2 && shape[0].is_dynamic();
+}
+
+
+// Inserts dimensions between the batch and the LoRA rank dimensions of batched alpha [batch, rank]
+// to broadcast it to the activations of a given rank, e.g. [batch, 1, rank] for activations [batch, tokens, rank].
+NodePtr unsqueeze_batched_alpha (const ov::Output<ov::Node>& alpha, size_t rank) {
+    std::vector<int64_t> dims(rank, 1);
+    dims.front() = 0;   // batch is copied from alpha
+    dims.back() = -1;   // LoRA rank
+    auto shape = v0::Constant::create(ov::element::i64, {rank}, dims);
+    return std::make_shared<v1::Reshape>(alpha, shape->output(0), true);
+}
+
+
 using LoRAWeightGetter = std::function<std::optional<LoRANode>(const std::string&)>;
 using LoRAConstantGetter = std::function<std::optional<NodePtr>(const std::string&)>;
 using LoRAWeightByNodeGetter = std::function<std::optional<LoRANode>(NodePtr)>;
@@ -229,7 +255,7 @@ struct LoRAParameters {
     ov::Dimension rank;         // accumulated LoRA rank, could be dynamic if rank is not known or DYNAMIC mode is applied
     ov::element::Type type;     // element type of a tensor that will be applied to the model, negotiated based on multiple LoRA adapters
     bool fine_grained_alpha;    // use 1D tensor of the same rank for alpha instead of a scalar to blend multiple weighted LoRAs
-    // TODO: flag to have various alphas over the batch
+    bool batched_alpha;         // alpha has a row per batch row to apply various adapters over the batch, requires fine_grained_alpha
 };
 
 using LoRAParametersGetter = std::function<std::optional<LoRAParameters>(NodePtr node)>;
@@ -304,13 +330,26 @@ struct LoRAWeightGetterDefault {
 };
 
 
+// Static LoRA rank that fits a given rank: a power of 2, not less than 8, so that the adapters of similar ranks share the shapes
+size_t get_rank_bucket(size_t rank) {
+    size_t bucket = 8;
+    while (bucket < rank) {
+        bucket *= 2;
+    }
+    return bucket;
+}
+
+
 // Maps a node in the base model to LoRA parameters object that describes how the LoRA tensors should be injected for that node.
 // Works with multiple LoRAs accumulating their properties into a single LoRAParameter instance.
 // Returns std::nullopt, if there is no LoRA adapter for a given node.
 struct LoRAParametersByWeightGetter {
     std::vector<LoRAWeightGetter> weight_getter;
     bool dynamic_lora_rank = true;
+    // the minimal static rank if the rank is not dynamic
+    size_t max_lora_rank = 0;
     bool fine_grained_alpha = true;
+    bool batched_alpha = false;
     ov::element::Type type;
 
     std::optional<LoRAParameters> operator() (NodePtr node) const {
@@ -340,13 +379,14 @@ struct LoRAParametersByWeightGetter {
                 // as LoRA adapters with 0 rank cannot exist, 0 means there are no adapters for a given node
                 return std::nullopt;
             }
-            rank = size;
+            rank = get_rank_bucket(std::max<size_t>(size, max_lora_rank));
         }
 
         LoRAParameters result;
         result.rank = rank;
         result.type = type;
         result.fine_grained_alpha = fine_grained_alpha;
+        result.batched_alpha = batched_alpha;
         return result;
     }
 };
@@ -435,7 +475,7 @@ struct LoRAWeightStateGetter {
             // FIXME: No guarantees on ordering of state in InferRequest makes impossible using indices of variables later, forced to use variable_id instead
             //indices.A = model->get_variables().size();
             var_ids.alpha = ov::op::util::VariableInfo{
-                params->fine_grained_alpha ? ov::PartialShape{1, params->rank} : ov::PartialShape{},
+                params->fine_grained_alpha ? ov::PartialShape{params->batched_alpha ? ov::Dimension::dynamic() : ov::Dimension(1), params->rank} : ov::PartialShape{},
                 ov::element::f32,   // alpha is always f32 because it is set from host as float data type
                 variable_id_prefix + ".alpha"
             };
@@ -677,6 +717,11 @@ NodePtr tensors_multiplication(NodePtr input,
         if (input) {
             if (i == alpha_pos) {  // Multiply for alpha
                 // TODO: Apply alpha multiplication separately
+                // Transposed activations of Convolution have the batch dimension right before the LoRA rank, so they are broadcast as is
+                const auto input_rank = input->get_output_partial_shape(0).rank().get_length();
+                if (!transpose_in_end && input_rank > 2 && is_batched_alpha(normalized)) {
+                    normalized = unsqueeze_batched_alpha(normalized, input_rank);
+                }
                 input = std::make_shared<v1::Multiply>(input, normalized);
             } else {  // MatMul for A and B
                 input = std::make_shared<v0::MatMul>(input,
@@ -821,15 +866,152 @@ private:
 };
 
 
+// The key of the runtime info of the node that replaces the original weights fused with LoRA adapters, holds the original
+// weights output to restore it by `unfuse_lora_weights`.
+const char* const lora_fused_weights_key = "__lora_fused_weights_origin";
+
+// Detected weight decompression pattern Constant(u8/i8) -> Convert [-> Subtract(zero points)] -> Multiply(scales)
+// [-> Reshape] [-> Convert], where the scales and the zero points are given per output channel or per group.
+struct CompressedWeightsPattern {
+    std::shared_ptr<v0::Constant> weights, scales, zero_points;
+};
+
+std::optional<CompressedWeightsPattern> match_compressed_weights(NodePtr node) {
+    if (auto convert = ov::as_type_ptr<v0::Convert>(node)) {
+        node = convert->get_input_node_shared_ptr(0);
+    }
+    if (auto reshape = ov::as_type_ptr<v1::Reshape>(node)) {
+        node = reshape->get_input_node_shared_ptr(0);
+    }
+    auto multiply = ov::as_type_ptr<v1::Multiply>(node);
+    if (!multiply) {
+        return std::nullopt;
+    }
+    CompressedWeightsPattern pattern;
+    for (size_t i = 0; i < 2 && !pattern.scales; ++i) {
+        pattern.scales = ov::as_type_ptr<v0::Constant>(multiply->get_input_node_shared_ptr(i));
+        node = multiply->get_input_node_shared_ptr(1 - i);
+    }
+    if (!pattern.scales || !pattern.scales->get_element_type().is_real()) {
+        return std::nullopt;
+    }
+    if (auto subtract = ov::as_type_ptr<v1::Subtract>(node)) {
+        NodePtr zero_points = subtract->get_input_node_shared_ptr(1);
+        if (auto convert = ov::as_type_ptr<v0::Convert>(zero_points)) {
+            zero_points = convert->get_input_node_shared_ptr(0);
+        }
+        pattern.zero_points = ov::as_type_ptr<v0::Constant>(zero_points);
+        if (!pattern.zero_points) {
+            return std::nullopt;
+        }
+        node = subtract->get_input_node_shared_ptr(0);
+    }
+    auto convert = ov::as_type_ptr<v0::Convert>(node);
+    pattern.weights = convert ? ov::as_type_ptr<v0::Constant>(convert->get_input_node_shared_ptr(0)) : nullptr;
+    if (!pattern.weights || (pattern.weights->get_element_type() != ov::element::u8 && pattern.weights->get_element_type() != ov::element::i8)) {
+        return std::nullopt;
+    }
+    // the scales are broadcast over the last dimension of the weights only: [out, 1] or [out, num_groups, 1]
+    const auto& weights_shape = pattern.weights->get_shape();
+    const auto& scales_shape = pattern.scales->get_shape();
+    if (scales_shape.size() != weights_shape.size() || scales_shape[0] != weights_shape[0] || scales_shape.back() != 1 ||
+        !std::equal(scales_shape.begin(), scales_shape.end() - 1, weights_shape.begin())) {
+        return std::nullopt;
+    }
+    return pattern;
+}
+
+// Clones the subgraph that computes `output` with the constants replaced by the given ones, other constants are shared
+ov::Output<ov::Node> clone_with_constants(const ov::Output<ov::Node>& output, const std::map<NodePtr, NodePtr>& replacements) {
+    auto node = output.get_node_shared_ptr();
+    auto replacement = replacements.find(node);
+    if (replacement != replacements.end()) {
+        return replacement->second->output(output.get_index());
+    }
+    if (ov::as_type_ptr<v0::Constant>(node)) {
+        return output;
+    }
+    ov::OutputVector inputs;
+    for (const auto& input : node->input_values()) {
+        inputs.push_back(clone_with_constants(input, replacements));
+    }
+    auto clone = node->clone_with_new_inputs(inputs);
+    ov::copy_runtime_info(node, clone);
+    return clone->output(output.get_index());
+}
+
+// Restores the original weights replaced by LoRAFuseTransform
+void unfuse_lora_weights(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& node : model->get_ops()) {
+        auto origin = node->get_rt_info().find(lora_fused_weights_key);
+        if (origin != node->get_rt_info().end()) {
+            node->output(0).replace(origin->second.as<ov::Output<ov::Node>>());
+        }
+    }
+}
+
+
 // Transformation that modifies existing weights in the base model fusing an arbitrary number of LoRA adapters.
-// This is one-way LoRA fusion that cannot be undone.
-// By default it uses CPU plugin to modify the base model weights.
-// TODO: This transformation unpacks potentially compressed to f16/bf16 weights to f32,
+// The original weights are kept in the runtime info of the fused ones, and can be restored by `unfuse_lora_weights`.
+// f32/f16/bf16 weights and u8/i8 compressed weights with the scales per channel or per group are fused directly by
+// row blocks in parallel, keeping the weights precision. Other weights are modified by CPU plugin.
+// TODO: The plugin path unpacks potentially compressed to f16/bf16 weights to f32,
 // we should pack it back into the original precision to maintain the same weight size.
 // But it will work well if all plugins equally support fp-compressed weights and can unpack them on-line.
 class LoRAFuseTransform : public LoRATransformBase {
 
     InferRequestSignatureCache fusers;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    void report_progress(const NodePtr& node) const {
+        // every 32nd layer is printed to track the fusion of large models
+        if (applied % 32 == 0 && ov::genai::utils::env_setup_for_print_debug_info()) {
+            const std::chrono::duration<float> duration = std::chrono::steady_clock::now() - start;
+            std::cout << "[LoRA] Fusing layer " << applied + 1 << ": " << node->get_friendly_name() << ", "
+                      << duration.count() << " s elapsed" << std::endl;
+        }
+    }
+
+    // Returns the output with the adapter fused into the weights, if the weights are supported by the direct fusion
+    std::optional<ov::Output<ov::Node>> fuse_directly(NodePtr node, const ConstantVector& adapter) const {
+        auto weights_input = node->input_value(1);
+        auto matmul = ov::as_type_ptr<v0::MatMul>(node);
+        // LoRA gives [out, rank] x [rank, in], so the weights of MatMul should be transposed
+        if ((matmul && !matmul->get_transpose_b()) || weights_input.get_partial_shape().is_dynamic()) {
+            return std::nullopt;
+        }
+        const ov::Tensor alpha = adapter[0]->get_tensor_view(), B = adapter[1]->get_tensor_view(), A = adapter[2]->get_tensor_view();
+
+        std::map<NodePtr, NodePtr> replacements;
+        auto weights_node = weights_input.get_node_shared_ptr();
+        auto weights_convert = ov::as_type_ptr<v0::Convert>(weights_node);
+        auto weights_constant = ov::as_type_ptr<v0::Constant>(weights_convert ? weights_convert->get_input_node_shared_ptr(0) : weights_node);
+        if (weights_constant && weights_constant->get_element_type().is_real()) {
+            if (!is_fusable(weights_constant->get_shape(), alpha, A, B)) {
+                return std::nullopt;
+            }
+            replacements[weights_constant] = std::make_shared<v0::Constant>(
+                fuse_lora_weights(weights_constant->get_tensor_view(), alpha, A, B));
+        } else if (auto pattern = match_compressed_weights(weights_node)) {
+            if (!is_fusable(pattern->weights->get_shape(), alpha, A, B)) {
+                return std::nullopt;
+            }
+            const ov::Tensor zero_points = pattern->zero_points ? pattern->zero_points->get_tensor_view() : ov::Tensor();
+            const auto fused = fuse_lora_weights(
+                CompressedWeights{pattern->weights->get_tensor_view(), pattern->scales->get_tensor_view(), zero_points}, alpha, A, B);
+            replacements[pattern->weights] = std::make_shared<v0::Constant>(fused.weights);
+            replacements[pattern->scales] = std::make_shared<v0::Constant>(fused.scales);
+            if (zero_points && fused.zero_points.data() != zero_points.data()) {
+                replacements[pattern->zero_points] = std::make_shared<v0::Constant>(fused.zero_points);
+            }
+        } else {
+            return std::nullopt;
+        }
+        for (const auto& [original, replacement] : replacements) {
+            ov::copy_runtime_info(original, replacement);
+        }
+        return clone_with_constants(weights_input, replacements);
+    }
 
     void signature_push_back(InferRequestSignatureCache::Signature& signature, ov::Output<ov::Node> input) const {
         // TODO: Define hash function on vector<tuple<element_type, PartialShape>> to make it C++ish
@@ -847,13 +1029,23 @@ public:
 
     bool apply (NodePtr node, const LoRANode& lora_weight) override {
         auto weights_input = node->input_value(1);
-        auto weights_input_type = weights_input.get_element_type();
-        auto weights_convert = decompression_convert(weights_input.get_node_shared_ptr());
-        auto weights_constant = weights_convert ? weights_convert->input_value(0) : weights_input;
         ConstantVector adapter = {
             std::dynamic_pointer_cast<v0::Constant>(lora_weight.alpha),
             std::dynamic_pointer_cast<v0::Constant>(lora_weight.B),
             std::dynamic_pointer_cast<v0::Constant>(lora_weight.A)};
+        report_progress(node);
+
+        if (auto fused = fuse_directly(node, adapter)) {
+            fused->get_node()->get_rt_info()[lora_fused_weights_key] = weights_input;
+            for (auto consumer : weights_input.get_target_inputs()) {
+                consumer.replace_source_output(*fused);
+            }
+            return true;
+        }
+
+        auto weights_input_type = weights_input.get_element_type();
+        auto weights_convert = decompression_convert(weights_input.get_node_shared_ptr());
+        auto weights_constant = weights_convert ? weights_convert->input_value(0) : weights_input;
         InferRequestSignatureCache::Signature signature;
         signature_push_back(signature, weights_input);
         for(auto multiplier : adapter) {
@@ -904,6 +1096,7 @@ public:
             inputs.push_back(adapter[i]->get_tensor_view());
         }
         fusers.evaluate(signature, inputs, outputs);
+        replacement_const->get_rt_info()[lora_fused_weights_key] = weights_input;
 
         for (auto consumer : consumers) {
             consumer.replace_source_output(replacement_const->output(0));
@@ -1147,6 +1340,33 @@ struct AdapterControllerImpl {
     // Needed to track which LoRA tensors were actually applied to suppress unused tensor warnings
     std::shared_ptr<LoRAWeightGetterDefault<NodePtr, NodePtr>> const_getter_impl;
 
+    // MODE_POOL: A and B of all the adapters passed to the constructor are concatenated once per LoRA variable and
+    // the adapters are switched by alphas only, which are zero for the adapters not used by a batch row
+    struct PoolTensors {
+        ov::Tensor A, B;
+        // index of the pool adapter and its LoRA rank for each part of the concatenated rank dimension
+        std::vector<std::pair<size_t, size_t>> segments;
+        size_t rank = 0;
+    };
+    std::vector<Adapter> pool_adapters;
+    std::map<std::string, PoolTensors> pool_tensors;
+
+    // LRU cache of the state tensors prepared for the recently used adapters and alphas, see AdapterConfig::set_cache_size.
+    // The adapters stay memory mapped from their files, so an evicted entry is prepared again without reading the files.
+    using CachedTensors = std::map<std::string, LoRAParts<ov::Tensor>>;
+    struct CacheEntry {
+        std::vector<std::pair<Adapter, float>> adapters;
+        std::shared_ptr<const CachedTensors> tensors;
+        size_t byte_size = 0;
+    };
+    size_t cache_capacity = 0;
+    std::list<CacheEntry> cache;    // the most recently used entry is the first
+    AdapterCacheMetrics cache_metrics;
+    // guards cache, cache_metrics and prefetches
+    mutable std::mutex cache_mutex;
+    // guards lora_state_evaluators, which are used to prepare the tensors on a prefetch as well
+    std::mutex evaluators_mutex;
+
     AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config) :
         current_config(config),  // FIXME: Compare current and passed configs and change incrementally
         lora_state_evaluators("CPU")    // FIXME: Try to run on the same device that is used for model inference
@@ -1155,9 +1375,17 @@ struct AdapterControllerImpl {
         LoRAParametersByWeightGetter params_getter;
         params_getter.type = ov::element::dynamic;
 
+        const bool pool = current_config.get_mode() == AdapterConfig::MODE_POOL;
+        params_getter.batched_alpha = pool;
+        cache_capacity = current_config.get_cache_size();
+        if (pool) {
+            pool_adapters = current_config.get_adapters();
+        }
+
         for(auto const& adapter : current_config.get_adapters()) {
             auto adapter_impl = get_adapter_impl(adapter);
             if (!adapter_impl->get_constant_tensors().empty()) {
+                OPENVINO_ASSERT(!pool, "AdapterConfig::MODE_POOL does not support LoRA adapters with constants");
                 OPENVINO_ASSERT(!const_getter, "OpenVINO.GenAI does not support several LoRA adapters with constants!");
                 const_getter_impl = std::make_shared<LoRAWeightGetterDefault<NodePtr, NodePtr>>(
                     &adapter_impl->get_constant_tensors(),
@@ -1193,7 +1421,7 @@ struct AdapterControllerImpl {
                 ov::Tensor(params_getter.type, ov::Shape{0})
             };
             auto name = node->get_friendly_name();
-            auto lora_weight = prepare_lora_tensors(name, params_getter.weight_getter, lora_placeholder, /*set_empty_tensors=*/false, /*alpha_only=*/false);
+            auto lora_weight = prepare_lora_tensors(current_config, name, params_getter.weight_getter, lora_placeholder, /*set_empty_tensors=*/false, /*alpha_only=*/false);
             if(lora_weight.alpha) {
                 return LoRANode(
                     // TODO: Make sure that tensors will not be disposed during constant life time
@@ -1216,9 +1444,10 @@ struct AdapterControllerImpl {
 
         ov::pass::Manager pm;
         auto mode = current_config.get_mode();
-        if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO) {
+        if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO || mode == AdapterConfig::MODE_POOL) {
             // State mode
             params_getter.dynamic_lora_rank = (mode != AdapterConfig::MODE_STATIC_RANK);
+            params_getter.max_lora_rank = current_config.get_max_rank();
             pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids));
             if (const_getter) {
                 LoRAStateGetterForConst getter = LoRAStateGetterForConst(const_getter, model, constant_variable_ids);
@@ -1293,11 +1522,15 @@ struct AdapterControllerImpl {
                 !diff.mode || config->get_mode() == AdapterConfig::MODE_AUTO,  // MODE_AUTO in this call means that mode is not changed
                 "AdapterConfig::mode cannot be changed and should be configured once for a model at the initialization");
             OPENVINO_ASSERT(
-                config->get_mode() == AdapterConfig::MODE_AUTO || config->get_mode() == AdapterConfig::MODE_DYNAMIC || config->get_mode() == AdapterConfig::MODE_STATIC_RANK || (!diff.alpha && !diff.adapter),
+                config->get_mode() == AdapterConfig::MODE_AUTO || config->get_mode() == AdapterConfig::MODE_DYNAMIC || config->get_mode() == AdapterConfig::MODE_STATIC_RANK || config->get_mode() == AdapterConfig::MODE_POOL || (!diff.alpha && !diff.adapter),
                 "Cannot change adapters and/or the alphas when not one of the dynamic modes are used.");
             current_config.update(*config);
         }
-        if(need_full_apply) {
+        if(is_pool()) {
+            // alphas are set regardless of the changes, since they are a few small tensors
+            set_pool_tensors(infer_request, {current_config}, /*alpha_only=*/!need_full_apply);
+            need_full_apply = false;
+        } else if(need_full_apply) {
             need_full_apply = false;
             set_new_adapter_tensors(infer_request);
         } else if(diff) {
@@ -1309,10 +1542,121 @@ struct AdapterControllerImpl {
         }
     }
 
+    void apply_all(ov::InferRequest& infer_request) {
+        need_full_apply = false;
+        if(is_pool()) {
+            set_pool_tensors(infer_request, {current_config}, /*alpha_only=*/false);
+        } else {
+            set_new_adapter_tensors(infer_request);
+        }
+    }
+
+    void apply_per_row(ov::InferRequest& infer_request, const std::vector<AdapterConfig>& row_configs, const std::vector<size_t>& num_rows) {
+        OPENVINO_ASSERT(is_pool(), "Various adapters over the batch require AdapterConfig::MODE_POOL to be set in the constructor");
+        OPENVINO_ASSERT(!row_configs.empty(), "Adapters must be set for at least one row of the batch");
+        OPENVINO_ASSERT(num_rows.empty() || num_rows.size() == row_configs.size(),
+            "The number of rows must be given for each adapter config, got ", num_rows.size(), " for ", row_configs.size(), " configs");
+        set_pool_tensors(infer_request, row_configs, /*alpha_only=*/!need_full_apply, num_rows);
+        need_full_apply = false;
+    }
+
     bool has_state_name(const std::string& name) {
         return variable_names.count(name);
     }
 
+    bool is_pool() const {
+        return current_config.get_mode() == AdapterConfig::MODE_POOL;
+    }
+
+    void prepare_pool_tensors() {
+        const std::string prefix = current_config.get_tensor_name_prefix().value_or("");
+        std::vector<LoRAWeightGetter> weight_getters;
+        weight_getters.reserve(pool_adapters.size());
+        for (const auto& adapter : pool_adapters) {
+            weight_getters.emplace_back(LoRAWeightGetterDefault<LoRAWeight, LoRANode>(&get_adapter_impl(adapter)->get_tensors(), prefix));
+        }
+
+        for (const auto& [name, lora_var_ids] : variable_ids) {
+            PoolTensors tensors;
+            std::vector<LoRAWeight> lora_weights;
+            for (size_t i = 0; i < weight_getters.size(); ++i) {
+                if (auto lora_tensors = weight_getters[i](name)) {
+                    auto A = std::dynamic_pointer_cast<v0::Constant>(lora_tensors->A);
+                    auto B = std::dynamic_pointer_cast<v0::Constant>(lora_tensors->B);
+                    OPENVINO_ASSERT(A && B);
+                    // alpha doesn't matter here, it is set per row by set_pool_tensors
+                    lora_weights.push_back(LoRAWeight(alpha_as_constant(1.0f), A, B));
+                    const size_t rank = A->get_shape()[0];
+                    tensors.segments.emplace_back(i, rank);
+                    tensors.rank += rank;
+                }
+            }
+            OPENVINO_ASSERT(!lora_weights.empty(), "Internal error: no pool adapters for LoRA variable ", name);
+
+            LoRAParts<ov::Tensor> output{
+                ov::Tensor(lora_var_ids.alpha.data_type, dynamic_to_static(lora_var_ids.alpha.data_shape)),
+                ov::Tensor(lora_var_ids.A.data_type, dynamic_to_static(lora_var_ids.A.data_shape)),
+                ov::Tensor(lora_var_ids.B.data_type, dynamic_to_static(lora_var_ids.B.data_shape))
+            };
+            auto concatenated = concat_adapters(lora_weights, output, /*alpha_only=*/false);
+            tensors.A = concatenated.A;
+            tensors.B = concatenated.B;
+            pool_tensors.emplace(name, std::move(tensors));
+        }
+    }
+
+    void set_pool_tensors(ov::InferRequest& infer_request, const std::vector<AdapterConfig>& row_configs, bool alpha_only, const std::vector<size_t>& num_rows = {}) {
+        if (pool_tensors.empty()) {
+            prepare_pool_tensors();
+        }
+
+        // alphas of the pool adapters for each row of the batch
+        std::vector<std::vector<float>> row_alphas;
+        row_alphas.reserve(row_configs.size());
+        for (const auto& row_config : row_configs) {
+            std::vector<float> alphas(pool_adapters.size(), 0.0f);
+            for (const auto& adapter : row_config.get_adapters()) {
+                auto it = std::find(pool_adapters.begin(), pool_adapters.end(), adapter);
+                OPENVINO_ASSERT(it != pool_adapters.end(),
+                    "AdapterConfig::MODE_POOL can switch among the adapters passed to the constructor only");
+                alphas[it - pool_adapters.begin()] = row_config.get_alpha(adapter);
+            }
+            row_alphas.push_back(std::move(alphas));
+        }
+
+        auto state = infer_request.query_state();
+        std::map<std::string, size_t> state_name_to_index;
+        for(size_t i = 0; i < state.size(); ++i) {
+            state_name_to_index[state[i].get_name()] = i;
+        }
+
+        const size_t batch_size = num_rows.empty() ? row_alphas.size() : std::accumulate(num_rows.begin(), num_rows.end(), size_t(0));
+        for (const auto& [name, lora_var_ids] : variable_ids) {
+            const PoolTensors& tensors = pool_tensors.at(name);
+            ov::Tensor alpha(ov::element::f32, {batch_size, tensors.rank});
+            float* alpha_data = alpha.data<float>();
+            for (size_t i = 0; i < row_alphas.size(); ++i) {
+                const size_t config_rows = num_rows.empty() ? 1 : num_rows[i];
+                if (config_rows == 0) {
+                    continue;
+                }
+                // the first row of the config is filled, then it's copied to the rest of its rows
+                const float* first_row = alpha_data;
+                for (const auto& [adapter_index, rank] : tensors.segments) {
+                    alpha_data = std::fill_n(alpha_data, rank, row_alphas[i][adapter_index]);
+                }
+                for (size_t row = 1; row < config_rows; ++row) {
+                    alpha_data = std::copy_n(first_row, tensors.rank, alpha_data);
+                }
+            }
+            state[state_name_to_index.at(lora_var_ids.alpha.variable_id)].set_state(alpha);
+            if (!alpha_only) {
+                state[state_name_to_index.at(lora_var_ids.A.variable_id)].set_state(tensors.A);
+                state[state_name_to_index.at(lora_var_ids.B.variable_id)].set_state(tensors.B);
+            }
+        }
+    }
+
     void set_new_adapter_alphas (ov::InferRequest& infer_request) {
         set_new_adapter_tensors(infer_request, /*alpha_only=*/true);
     }
@@ -1324,6 +1668,12 @@ struct AdapterControllerImpl {
             return;
         }
 
+        const auto swap_start = std::chrono::steady_clock::now();
+        std::shared_ptr<const CachedTensors> cached_tensors;
+        if (!alpha_only && cache_capacity > 0) {
+            cached_tensors = get_cached_tensors(current_config);
+        }
+
         std::vector<LoRAWeightGetter> weight_getters;
         LoRAConstantGetter const_getter;
         const auto& adapters = current_config.get_adapters();
@@ -1359,7 +1709,14 @@ struct AdapterControllerImpl {
             lora_indices.alpha = state_name_to_index.at(lora_var_ids.second.alpha.variable_id);
             lora_indices.A = state_name_to_index.at(lora_var_ids.second.A.variable_id);
             lora_indices.B = state_name_to_index.at(lora_var_ids.second.B.variable_id);
-            set_lora_tensors(state, lora_var_ids.first, lora_var_ids.second, lora_indices, weight_getters, alpha_only);
+            if (cached_tensors) {
+                const auto& tensors = cached_tensors->at(lora_var_ids.first);
+                state[lora_indices.alpha].set_state(tensors.alpha);
+                state[lora_indices.A].set_state(tensors.A);
+                state[lora_indices.B].set_state(tensors.B);
+            } else {
+                set_lora_tensors(state, lora_var_ids.first, lora_var_ids.second, lora_indices, weight_getters, alpha_only);
+            }
         }
 
         for (const auto& [const_name, var_info] : constant_variable_ids) {
@@ -1387,10 +1744,16 @@ struct AdapterControllerImpl {
             }
         }
 
+        if (!alpha_only) {
+            const std::chrono::duration<float, std::milli> swap_duration = std::chrono::steady_clock::now() - swap_start;
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            cache_metrics.swap_durations.push_back(swap_duration.count());
+        }
+
     }
 
-    std::vector<LoRAWeight> collect_applicable_tensors (const std::string& lora_name, const std::vector<LoRAWeightGetter>& weight_getters) {
-        const auto& adapters = current_config.get_adapters();
+    std::vector<LoRAWeight> collect_applicable_tensors (const AdapterConfig& config, const std::string& lora_name, const std::vector<LoRAWeightGetter>& weight_getters) {
+        const auto& adapters = config.get_adapters();
         OPENVINO_ASSERT(weight_getters.size() == adapters.size());
         std::vector<LoRAWeight> result;
         result.reserve(weight_getters.size());
@@ -1399,7 +1762,7 @@ struct AdapterControllerImpl {
                 // TODO: Is it practical to use alpha from the adapter file itself. In the current code it is ignored and only alpha from config is used.
                 OPENVINO_ASSERT(lora_tensors->A);
                 OPENVINO_ASSERT(lora_tensors->B);
-                lora_tensors->alpha = alpha_as_constant(current_config.get_alpha(adapters[i]));
+                lora_tensors->alpha = alpha_as_constant(config.get_alpha(adapters[i]));
                 result.push_back(LoRAWeight(
                     std::dynamic_pointer_cast<v0::Constant>(lora_tensors->alpha),
                     std::dynamic_pointer_cast<v0::Constant>(lora_tensors->A),
@@ -1520,6 +1883,8 @@ struct AdapterControllerImpl {
     LoRAParts<ov::Tensor> concat_adapters(const std::vector<LoRAWeight>& inputs, LoRAParts<ov::Tensor>& outputs, bool alpha_only) {
         auto signature = get_lora_signature(inputs, outputs);
         size_t inputs_per_adapter = alpha_only ? 1 : 3;
+        // the tensors may be prepared by a prefetch in background
+        std::lock_guard<std::mutex> lock(evaluators_mutex);
         if(!lora_state_evaluators.exist(signature)) {
             // Prepare LoRA state evaluate model
             ov::ParameterVector parameters(inputs_per_adapter*inputs.size());
@@ -1588,7 +1953,9 @@ struct AdapterControllerImpl {
             alpha_only ? ov::Tensor() : ov::Tensor(lora_var_ids.A.data_type, dynamic_to_static(lora_var_ids.A.data_shape)),
             alpha_only ? ov::Tensor() : ov::Tensor(lora_var_ids.B.data_type, dynamic_to_static(lora_var_ids.B.data_shape))
         };
-        auto new_tensors = prepare_lora_tensors(name, weight_getters, lora_state_tensors, /*set_empty_adapters=*/true, alpha_only);
+        auto new_tensors = pad_to_static_rank(
+            prepare_lora_tensors(current_config, name, weight_getters, lora_state_tensors, /*set_empty_adapters=*/true, alpha_only),
+            name, lora_var_ids, alpha_only);
         state[lora_indices.alpha].set_state(new_tensors.alpha);
         if(!alpha_only) {
             state[lora_indices.A].set_state(new_tensors.A);
@@ -1596,14 +1963,48 @@ struct AdapterControllerImpl {
         }
     }
 
+    // Pads a 2D tensor with zeros along the axis up to the given size
+    static ov::Tensor pad_with_zeros(const ov::Tensor& tensor, size_t axis, size_t size) {
+        const auto& shape = tensor.get_shape();
+        ov::Shape padded_shape = shape;
+        padded_shape[axis] = size;
+        ov::Tensor padded(tensor.get_element_type(), padded_shape);
+        std::memset(padded.data(), 0, padded.get_byte_size());
+        const size_t row_size = shape[1] * tensor.get_element_type().size(), padded_row_size = padded_shape[1] * tensor.get_element_type().size();
+        for (size_t row = 0; row < shape[0]; ++row) {
+            std::memcpy(static_cast<char*>(padded.data()) + row * padded_row_size, static_cast<const char*>(tensor.data()) + row * row_size, row_size);
+        }
+        return padded;
+    }
+
+    // MODE_STATIC_RANK: the adapters of a lower total rank than the static rank of the state are padded with zero alphas, A and B,
+    // which don't contribute to the result
+    LoRAParts<ov::Tensor> pad_to_static_rank(const LoRAParts<ov::Tensor>& tensors, const std::string& name, const LoRAVarIDs& lora_var_ids, bool alpha_only) {
+        const auto& rank_dimension = lora_var_ids.A.data_shape[0];
+        if (rank_dimension.is_dynamic() || tensors.alpha.get_shape().size() != 2) {
+            return tensors;
+        }
+        const size_t static_rank = rank_dimension.get_length(), rank = tensors.alpha.get_shape()[1];
+        if (rank == static_rank) {
+            return tensors;
+        }
+        OPENVINO_ASSERT(rank < static_rank, "The total rank ", rank, " of LoRA adapters for ", name, " exceeds the static rank ", static_rank,
+            " of AdapterConfig::MODE_STATIC_RANK set at the initialization, use AdapterConfig::set_max_rank to increase it");
+        return LoRAParts<ov::Tensor>(
+            pad_with_zeros(tensors.alpha, 1, static_rank),
+            alpha_only ? ov::Tensor() : pad_with_zeros(tensors.A, 0, static_rank),
+            alpha_only ? ov::Tensor() : pad_with_zeros(tensors.B, 1, static_rank));
+    }
+
     LoRAParts<ov::Tensor> prepare_lora_tensors (
+        const AdapterConfig& config,
         const std::string& name,
         const std::vector<LoRAWeightGetter>& weight_getters,
         LoRAParts<ov::Tensor>& output,
         bool set_empty_adapters,
         bool alpha_only
     ) {
-        auto lora_tensors = collect_applicable_tensors(name, weight_getters);  // request A and B regardless of alpha_only, because it is a way to get lora_rank later when alpha is broadcasted
+        auto lora_tensors = collect_applicable_tensors(config, name, weight_getters);  // request A and B regardless of alpha_only, because it is a way to get lora_rank later when alpha is broadcasted
         LoRAParts<ov::Tensor> new_tensors;
         if(!lora_tensors.empty()) {
             new_tensors = concat_adapters(lora_tensors, output, alpha_only);
@@ -1612,6 +2013,128 @@ struct AdapterControllerImpl {
         }
         return new_tensors;
     }
+
+    // Prepares the state tensors of all LoRA variables for the adapters and alphas of `config`, may run in background
+    std::shared_ptr<const CachedTensors> prepare_cached_tensors(const AdapterConfig& config, const std::string& prefix) {
+        std::vector<LoRAWeightGetter> weight_getters;
+        weight_getters.reserve(config.get_adapters().size());
+        for (const auto& adapter : config.get_adapters()) {
+            weight_getters.emplace_back(LoRAWeightGetterDefault<LoRAWeight, LoRANode>(&get_adapter_impl(adapter)->get_tensors(), prefix));
+        }
+
+        auto tensors = std::make_shared<CachedTensors>();
+        for (const auto& [name, lora_var_ids] : variable_ids) {
+            LoRAParts<ov::Tensor> lora_state_tensors{
+                ov::Tensor(lora_var_ids.alpha.data_type, dynamic_to_static(lora_var_ids.alpha.data_shape)),
+                ov::Tensor(lora_var_ids.A.data_type, dynamic_to_static(lora_var_ids.A.data_shape)),
+                ov::Tensor(lora_var_ids.B.data_type, dynamic_to_static(lora_var_ids.B.data_shape))
+            };
+            (*tensors)[name] = pad_to_static_rank(
+                prepare_lora_tensors(config, name, weight_getters, lora_state_tensors, /*set_empty_adapters=*/true, /*alpha_only=*/false),
+                name, lora_var_ids, /*alpha_only=*/false);
+        }
+        return tensors;
+    }
+
+    static size_t get_byte_size(const CachedTensors& tensors) {
+        size_t byte_size = 0;
+        for (const auto& [name, lora_tensors] : tensors) {
+            byte_size += lora_tensors.alpha.get_byte_size() + lora_tensors.A.get_byte_size() + lora_tensors.B.get_byte_size();
+        }
+        return byte_size;
+    }
+
+    // Should be called under cache_mutex
+    void insert_to_cache(const std::vector<std::pair<Adapter, float>>& adapters, const std::shared_ptr<const CachedTensors>& tensors) {
+        const size_t byte_size = get_byte_size(*tensors);
+        cache.push_front(CacheEntry{adapters, tensors, byte_size});
+        cache_metrics.cached_bytes += byte_size;
+        while (!cache.empty() && cache_metrics.cached_bytes > cache_capacity) {
+            cache_metrics.cached_bytes -= cache.back().byte_size;
+            cache.pop_back();
+            ++cache_metrics.num_evictions;
+        }
+    }
+
+    // Should be called under cache_mutex, moves the completed prefetches to the cache
+    void collect_prefetches() {
+        for (auto it = prefetches.begin(); it != prefetches.end();) {
+            if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                ++it;
+                continue;
+            }
+            try {
+                insert_to_cache(it->first, it->second.get());
+            } catch (const std::exception&) {
+                // the failed prefetch is dropped, the error is reported once the adapters are applied
+            }
+            it = prefetches.erase(it);
+        }
+    }
+
+    std::shared_ptr<const CachedTensors> get_cached_tensors(const AdapterConfig& config) {
+        const auto adapters = config.get_adapters_and_alphas();
+        std::shared_future<std::shared_ptr<const CachedTensors>> prefetch;
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            collect_prefetches();
+            auto cached = std::find_if(cache.begin(), cache.end(), [&](const CacheEntry& entry) { return entry.adapters == adapters; });
+            if (cached != cache.end()) {
+                cache.splice(cache.begin(), cache, cached);
+                ++cache_metrics.num_hits;
+                return cached->tensors;
+            }
+            auto pending = std::find_if(prefetches.begin(), prefetches.end(), [&](const auto& entry) { return entry.first == adapters; });
+            if (pending != prefetches.end()) {
+                prefetch = pending->second;
+                prefetches.erase(pending);
+            }
+        }
+
+        // the tensors are prepared without holding the lock to let the prefetches be added meanwhile
+        auto tensors = prefetch.valid() ? prefetch.get() : prepare_cached_tensors(config, config.get_tensor_name_prefix().value_or(""));
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (prefetch.valid()) {
+            ++cache_metrics.num_hits;
+        } else {
+            ++cache_metrics.num_misses;
+        }
+        insert_to_cache(adapters, tensors);
+        return tensors;
+    }
+
+    void prefetch(const AdapterConfig& config) {
+        const auto mode = current_config.get_mode();
+        if (cache_capacity == 0 || !config ||
+            (mode != AdapterConfig::MODE_AUTO && mode != AdapterConfig::MODE_DYNAMIC && mode != AdapterConfig::MODE_STATIC_RANK)) {
+            return;
+        }
+        const auto adapters = config.get_adapters_and_alphas();
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        collect_prefetches();
+        auto is_same = [&](const auto& entry) { return entry.first == adapters; };
+        if (std::any_of(prefetches.begin(), prefetches.end(), is_same) ||
+            std::any_of(cache.begin(), cache.end(), [&](const CacheEntry& entry) { return entry.adapters == adapters; })) {
+            return;
+        }
+        // the derived adapters compute their tensors on the first access, which isn't thread safe
+        for (const auto& adapter : config.get_adapters()) {
+            get_adapter_impl(adapter)->get_tensors();
+        }
+        const std::string prefix = config.get_tensor_name_prefix().value_or(current_config.get_tensor_name_prefix().value_or(""));
+        prefetches.emplace_back(adapters, std::async(std::launch::async, [this, config, prefix] {
+            return prepare_cached_tensors(config, prefix);
+        }).share());
+        ++cache_metrics.num_prefetches;
+    }
+
+    AdapterCacheMetrics get_cache_metrics() const {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        return cache_metrics;
+    }
+
+    // The last member to wait for the prefetches in background before the rest of the members are destroyed
+    std::list<std::pair<std::vector<std::pair<Adapter, float>>, std::shared_future<std::shared_ptr<const CachedTensors>>>> prefetches;
 };
 
 
@@ -1661,6 +2184,41 @@ void AdapterController::apply(ov::InferRequest request, const std::optional<Adap
     }
 }
 
+void AdapterController::apply_all(ov::InferRequest request) {
+    if (m_pimpl) {
+        m_pimpl->apply_all(request);
+    }
+}
+
+void AdapterController::apply_per_row(ov::InferRequest request, const std::vector<AdapterConfig>& row_configs, const std::vector<size_t>& num_rows) {
+    OPENVINO_ASSERT(m_pimpl,
+        "Adapters are passed to AdapterController but it was not configured to use adapters. "
+        "Enable using adapters by pass them in the constructor first.");
+    m_pimpl->apply_per_row(request, row_configs, num_rows);
+}
+
+void AdapterController::prefetch(const AdapterConfig& config) {
+    if (m_pimpl) {
+        m_pimpl->prefetch(config);
+    }
+}
+
+AdapterCacheMetrics AdapterController::get_cache_metrics() const {
+    return m_pimpl ? m_pimpl->get_cache_metrics() : AdapterCacheMetrics{};
+}
+
+void AdapterController::refuse(std::shared_ptr<ov::Model> model, const AdapterConfig& config) {
+    OPENVINO_ASSERT(m_pimpl && m_pimpl->current_config.get_mode() == AdapterConfig::MODE_FUSE,
+        "AdapterController::refuse requires the adapters to be fused by AdapterConfig::MODE_FUSE in the constructor");
+    OPENVINO_ASSERT(config.get_mode() == AdapterConfig::MODE_AUTO || config.get_mode() == AdapterConfig::MODE_FUSE,
+        "AdapterConfig::mode cannot be changed and should be configured once for a model at the initialization");
+    OPENVINO_ASSERT(!m_pimpl->const_getter_impl, "AdapterController::refuse does not support LoRA adapters with constants");
+    unfuse_lora_weights(model);
+    AdapterConfig fuse_config = m_pimpl->current_config;
+    fuse_config.update(config);
+    m_pimpl = std::make_shared<AdapterControllerImpl>(model, fuse_config);
+}
+
 bool AdapterController::has_state_name(const std::string& name) {
     return m_pimpl->has_state_name(name);
 }
@@ -0,0 +1,247 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "lora/fusion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+
+namespace {
+
+// number of the rows of W updated by a parallel task, the rows share a buffer of the accumulated product
+constexpr size_t rows_per_block = 16;
+
+std::vector<float> to_f32(const ov::Tensor& tensor) {
+    std::vector<float> result(tensor.get_size());
+    switch (tensor.get_element_type()) {
+    case ov::element::f32:
+        std::copy_n(tensor.data<const float>(), result.size(), result.begin());
+        break;
+    case ov::element::f16:
+        std::copy_n(tensor.data<const ov::float16>(), result.size(), result.begin());
+        break;
+    case ov::element::bf16:
+        std::copy_n(tensor.data<const ov::bfloat16>(), result.size(), result.begin());
+        break;
+    case ov::element::u8:
+        std::copy_n(tensor.data<const uint8_t>(), result.size(), result.begin());
+        break;
+    case ov::element::i8:
+        std::copy_n(tensor.data<const int8_t>(), result.size(), result.begin());
+        break;
+    default:
+        OPENVINO_THROW("LoRA fusion: not supported element type ", tensor.get_element_type());
+    }
+    return result;
+}
+
+void store(ov::Tensor& tensor, size_t index, float value) {
+    switch (tensor.get_element_type()) {
+    case ov::element::f32:
+        tensor.data<float>()[index] = value;
+        break;
+    case ov::element::f16:
+        tensor.data<ov::float16>()[index] = ov::float16(value);
+        break;
+    case ov::element::bf16:
+        tensor.data<ov::bfloat16>()[index] = ov::bfloat16(value);
+        break;
+    case ov::element::u8:
+        tensor.data<uint8_t>()[index] = static_cast<uint8_t>(std::clamp(std::nearbyint(value), 0.0f, 255.0f));
+        break;
+    case ov::element::i8:
+        tensor.data<int8_t>()[index] = static_cast<int8_t>(std::clamp(std::nearbyint(value), -128.0f, 127.0f));
+        break;
+    default:
+        OPENVINO_THROW("LoRA fusion: not supported element type ", tensor.get_element_type());
+    }
+}
+
+// alpha * B x A, which is computed by the row blocks
+class LoRAProduct {
+public:
+    LoRAProduct(const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B)
+        : m_rank(A.get_shape()[0]),
+          m_in(A.get_size() / m_rank),
+          m_out(B.get_shape()[0]),
+          m_A(to_f32(A)),
+          m_scaled_B(to_f32(B)) {
+        const std::vector<float> alphas = to_f32(alpha);
+        OPENVINO_ASSERT(alphas.size() == m_rank && m_scaled_B.size() == m_out * m_rank,
+            "LoRA fusion: inconsistent shapes of alpha ", alpha.get_shape(), ", A ", A.get_shape(), " and B ", B.get_shape());
+        for (size_t row = 0; row < m_out; ++row) {
+            for (size_t r = 0; r < m_rank; ++r) {
+                m_scaled_B[row * m_rank + r] *= alphas[r];
+            }
+        }
+    }
+
+    size_t get_in() const {
+        return m_in;
+    }
+
+    size_t get_out() const {
+        return m_out;
+    }
+
+    // Calls `func(row, delta_row)` for each row of the product, the rows are processed by blocks in parallel
+    template <typename Func>
+    void for_each_row(Func func) const {
+        const size_t num_blocks = (m_out + rows_per_block - 1) / rows_per_block;
+        ov::parallel_for(num_blocks, [&](size_t block) {
+            const size_t begin = block * rows_per_block, end = std::min(begin + rows_per_block, m_out);
+            std::vector<float> delta((end - begin) * m_in, 0.0f);
+            for (size_t row = begin; row < end; ++row) {
+                float* delta_row = delta.data() + (row - begin) * m_in;
+                for (size_t r = 0; r < m_rank; ++r) {
+                    const float coefficient = m_scaled_B[row * m_rank + r];
+                    const float* A_row = m_A.data() + r * m_in;
+                    for (size_t i = 0; i < m_in; ++i) {
+                        delta_row[i] += coefficient * A_row[i];
+                    }
+                }
+                func(row, delta_row);
+            }
+        });
+    }
+
+private:
+    size_t m_rank, m_in, m_out;
+    std::vector<float> m_A, m_scaled_B;
+};
+
+template <typename T>
+void add_product(const ov::Tensor& weights, ov::Tensor& fused, const LoRAProduct& product) {
+    const T* src = weights.data<const T>();
+    T* dst = fused.data<T>();
+    const size_t in = product.get_in();
+    product.for_each_row([&](size_t row, const float* delta) {
+        for (size_t i = 0; i < in; ++i) {
+            dst[row * in + i] = static_cast<T>(static_cast<float>(src[row * in + i]) + delta[i]);
+        }
+    });
+}
+
+template <typename Q>
+void add_product(const ov::genai::utils::CompressedWeights& weights,
+                 ov::genai::utils::CompressedWeights& fused,
+                 const LoRAProduct& product) {
+    constexpr float q_min = std::numeric_limits<Q>::min(), q_max = std::numeric_limits<Q>::max();
+    const size_t in = product.get_in(), out = product.get_out();
+    const size_t num_groups = weights.scales.get_size() / out;
+    OPENVINO_ASSERT(num_groups * out == weights.scales.get_size() && in % num_groups == 0,
+        "LoRA fusion: not supported shape of the scales ", weights.scales.get_shape(), " for the weights ", weights.weights.get_shape());
+    const size_t group_size = in / num_groups;
+
+    const bool per_group_zero_points = weights.zero_points && weights.zero_points.get_size() == weights.scales.get_size();
+    OPENVINO_ASSERT(!weights.zero_points || per_group_zero_points || weights.zero_points.get_size() == 1,
+        "LoRA fusion: not supported shape of the zero points ", weights.zero_points.get_shape());
+    const std::vector<float> scales = to_f32(weights.scales);
+    const std::vector<float> zero_points = weights.zero_points ? to_f32(weights.zero_points) : std::vector<float>{0.0f};
+
+    const Q* src = weights.weights.data<const Q>();
+    Q* dst = fused.weights.data<Q>();
+    product.for_each_row([&](size_t row, float* delta) {
+        for (size_t group = 0, index = row * num_groups; group < num_groups; ++group, ++index) {
+            float* values = delta + group * group_size;
+            const Q* src_group = src + row * in + group * group_size;
+            const float zero_point = zero_points[per_group_zero_points ? index : 0];
+            float min_value = std::numeric_limits<float>::max(), max_value = std::numeric_limits<float>::lowest();
+            for (size_t i = 0; i < group_size; ++i) {
+                values[i] += (static_cast<float>(src_group[i]) - zero_point) * scales[index];
+                min_value = std::min(min_value, values[i]);
+                max_value = std::max(max_value, values[i]);
+            }
+
+            float scale, new_zero_point = zero_point;
+            if (per_group_zero_points) {
+                scale = (max_value - min_value) / (q_max - q_min);
+                scale = scale > 0.0f ? scale : 1.0f;
+                new_zero_point = std::clamp(std::nearbyint(q_min - min_value / scale), q_min, q_max);
+                store(fused.zero_points, index, new_zero_point);
+            } else {
+                // the range of the group is fitted to the kept zero point
+                scale = std::max(max_value > 0.0f && q_max > zero_point ? max_value / (q_max - zero_point) : 0.0f,
+                                 min_value < 0.0f && q_min < zero_point ? min_value / (q_min - zero_point) : 0.0f);
+                scale = scale > 0.0f ? scale : 1.0f;
+            }
+            store(fused.scales, index, scale);
+
+            Q* dst_group = dst + row * in + group * group_size;
+            for (size_t i = 0; i < group_size; ++i) {
+                dst_group[i] = static_cast<Q>(std::clamp(std::nearbyint(values[i] / scale + new_zero_point), q_min, q_max));
+            }
+        }
+    });
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+bool is_fusable(const ov::Shape& weights_shape, const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B) {
+    if (weights_shape.empty() || A.get_shape().empty() || B.get_shape().empty() || A.get_shape()[0] == 0) {
+        return false;
+    }
+    const size_t rank = A.get_shape()[0], out = weights_shape[0];
+    return B.get_shape()[0] == out && B.get_size() == out * rank && alpha.get_size() == rank &&
+           ov::shape_size(weights_shape) == out * (A.get_size() / rank);
+}
+
+ov::Tensor fuse_lora_weights(const ov::Tensor& weights, const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B) {
+    OPENVINO_ASSERT(is_fusable(weights.get_shape(), alpha, A, B),
+        "LoRA fusion: not supported shapes of the weights ", weights.get_shape(), ", A ", A.get_shape(), " and B ", B.get_shape());
+    const LoRAProduct product(alpha, A, B);
+    ov::Tensor fused(weights.get_element_type(), weights.get_shape());
+    switch (weights.get_element_type()) {
+    case ov::element::f32:
+        add_product<float>(weights, fused, product);
+        break;
+    case ov::element::f16:
+        add_product<ov::float16>(weights, fused, product);
+        break;
+    case ov::element::bf16:
+        add_product<ov::bfloat16>(weights, fused, product);
+        break;
+    default:
+        OPENVINO_THROW("LoRA fusion: not supported element type of the weights ", weights.get_element_type());
+    }
+    return fused;
+}
+
+CompressedWeights fuse_lora_weights(const CompressedWeights& weights, const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B) {
+    OPENVINO_ASSERT(is_fusable(weights.weights.get_shape(), alpha, A, B),
+        "LoRA fusion: not supported shapes of the weights ", weights.weights.get_shape(), ", A ", A.get_shape(), " and B ", B.get_shape());
+    const LoRAProduct product(alpha, A, B);
+    CompressedWeights fused{
+        ov::Tensor(weights.weights.get_element_type(), weights.weights.get_shape()),
+        ov::Tensor(weights.scales.get_element_type(), weights.scales.get_shape()),
+        weights.zero_points && weights.zero_points.get_size() == weights.scales.get_size()
+            ? ov::Tensor(weights.zero_points.get_element_type(), weights.zero_points.get_shape())
+            : weights.zero_points};
+    switch (weights.weights.get_element_type()) {
+    case ov::element::u8:
+        add_product<uint8_t>(weights, fused, product);
+        break;
+    case ov::element::i8:
+        add_product<int8_t>(weights, fused, product);
+        break;
+    default:
+        OPENVINO_THROW("LoRA fusion: not supported element type of the compressed weights ", weights.weights.get_element_type());
+    }
+    return fused;
+}
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,35 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+// Kernels of MODE_FUSE that compute W + alpha * B x A directly, row blocks of W are processed in parallel.
+// W is interpreted as a matrix of [out, in] shape, where `in` is a product of the trailing dimensions of W,
+// A is [rank, in], B is [out, rank] and alpha is [1, rank], the trailing unit dimensions of A and B are ignored.
+// The product is accumulated in f32, the result has the shape and the element type of the given weights.
+
+// Returns true if the shapes of the weights and the adapter are supported by `fuse_lora_weights`
+bool is_fusable(const ov::Shape& weights_shape, const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B);
+
+// Fuses the adapter into f32/f16/bf16 weights
+ov::Tensor fuse_lora_weights(const ov::Tensor& weights, const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B);
+
+struct CompressedWeights {
+    ov::Tensor weights;         // u8 or i8 of [out, num_groups, group_size] or [out, in] shape
+    ov::Tensor scales;          // f32/f16/bf16 of out * num_groups elements
+    ov::Tensor zero_points;     // optional, u8/i8/f32/f16 of the same size as `scales` or a single element
+};
+
+// Fuses the adapter into compressed weights: each group is decompressed, updated and compressed back with a new scale,
+// and a new zero point if they are given per group. A single zero point is kept and the scales are fitted to it.
+CompressedWeights fuse_lora_weights(const CompressedWeights& weights, const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B);
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
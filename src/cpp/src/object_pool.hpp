@@ -0,0 +1,169 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * Process-wide free list of the memory blocks of a single size, which keeps the blocks of the destroyed per-request objects,
+ * e.g. of SequenceGroup and its shared_ptr control block, for the next requests instead of returning them to the heap.
+ * At most MaxFreeBlocks blocks are kept, so the memory held after a burst of requests is bounded.
+ */
+template <size_t BlockSize, size_t MaxFreeBlocks = 1024>
+class FixedSizeMemoryPool {
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    static_assert(BlockSize >= sizeof(FreeBlock), "The block has to fit a pointer to the next free block");
+
+    std::mutex m_mutex;
+    FreeBlock* m_free_blocks = nullptr;
+    size_t m_num_free_blocks = 0;
+
+    FixedSizeMemoryPool() = default;
+
+public:
+    FixedSizeMemoryPool(const FixedSizeMemoryPool&) = delete;
+    FixedSizeMemoryPool& operator=(const FixedSizeMemoryPool&) = delete;
+
+    // never destroyed, so that the objects destroyed at exit after the pool still return their blocks to it
+    static FixedSizeMemoryPool& get_instance() {
+        static FixedSizeMemoryPool* pool = new FixedSizeMemoryPool();
+        return *pool;
+    }
+
+    void* allocate() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_free_blocks != nullptr) {
+                --m_num_free_blocks;
+                return std::exchange(m_free_blocks, m_free_blocks->next);
+            }
+        }
+        return ::operator new(BlockSize);
+    }
+
+    void deallocate(void* block) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_num_free_blocks < MaxFreeBlocks) {
+                m_free_blocks = new (block) FreeBlock{m_free_blocks};
+                ++m_num_free_blocks;
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    size_t get_num_free_blocks() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_num_free_blocks;
+    }
+};
+
+/**
+ * Stateless allocator of the single objects from FixedSizeMemoryPool, arrays are allocated on the heap. Meant for
+ * std::allocate_shared, which allocates the object and its control block at once with the allocator rebound to the control
+ * block, so the whole allocation is pooled. The classes with private constructors befriend PoolAllocator<Class>, which
+ * constructs the object.
+ */
+template <typename T>
+class PoolAllocator {
+    using Pool = FixedSizeMemoryPool<(sizeof(T) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t)>;
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types aren't pooled");
+
+public:
+    using value_type = T;
+
+    PoolAllocator() = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(n == 1 ? Pool::get_instance().allocate() : ::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (n == 1) {
+            Pool::get_instance().deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U* p) {
+        p->~U();
+    }
+
+    template <typename U>
+    friend bool operator==(const PoolAllocator&, const PoolAllocator<U>&) { return true; }
+    template <typename U>
+    friend bool operator!=(const PoolAllocator&, const PoolAllocator<U>&) { return false; }
+};
+
+// std::make_shared of the object and its control block from FixedSizeMemoryPool
+template <typename T, typename... Args>
+std::shared_ptr<T> make_pooled(Args&&... args) {
+    return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+/**
+ * Process-wide free list of the vectors of the destroyed objects, e.g. of the prompt ids of the finished requests, which
+ * are reused with their capacity, so that the vectors of the next requests of a similar length aren't reallocated.
+ * The vectors longer than MaxCapacity aren't kept.
+ */
+template <typename T, size_t MaxFreeVectors = 1024, size_t MaxCapacity = 64 * 1024>
+class VectorPool {
+    std::mutex m_mutex;
+    std::vector<std::vector<T>> m_free_vectors;
+
+    VectorPool() = default;
+
+public:
+    VectorPool(const VectorPool&) = delete;
+    VectorPool& operator=(const VectorPool&) = delete;
+
+    // never destroyed as FixedSizeMemoryPool
+    static VectorPool& get_instance() {
+        static VectorPool* pool = new VectorPool();
+        return *pool;
+    }
+
+    // an empty vector, which may have the capacity of a released one
+    std::vector<T> acquire() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_free_vectors.empty()) {
+            return {};
+        }
+        std::vector<T> values = std::move(m_free_vectors.back());
+        m_free_vectors.pop_back();
+        return values;
+    }
+
+    void release(std::vector<T>&& values) {
+        if (values.capacity() == 0 || values.capacity() > MaxCapacity) {
+            return;
+        }
+        values.clear();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_free_vectors.size() < MaxFreeVectors) {
+            m_free_vectors.push_back(std::move(values));
+        }
+    }
+};
+
+}  // namespace ov::genai
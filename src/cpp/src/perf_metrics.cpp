@@ -43,6 +43,10 @@ float PerfMetrics::get_load_time() {
     return load_time;
 }
 
+std::map<std::string, float> PerfMetrics::get_model_load_times() {
+    return model_load_times;
+}
+
 size_t PerfMetrics::get_num_generated_tokens() {
     evaluate_statistics();
     return num_generated_tokens;
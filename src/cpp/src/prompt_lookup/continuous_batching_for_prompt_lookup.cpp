@@ -17,63 +17,142 @@ ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_generated
     return result;
 }
 
-TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
-    if (num_pred_tokens == 0) {
-        return std::vector<int64_t>{};
-    }
-
-    const size_t input_length = input_ids.size();
-
-    for (int32_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
-        // extract last ngram_size tokens as search ngram
-        std::vector<int64_t> ngram = std::vector<int64_t>{input_ids.cend() - ngram_size, input_ids.cend()};
+void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::set_prompt_lookup_ids(uint64_t request_id,
+                                                                                           TokenIds prompt_lookup_ids) {
+    m_prompt_lookup_ids[request_id] = std::move(prompt_lookup_ids);
+}
 
-        // find ngram match in input_ids
-        size_t ngram_i = 0;
-        for (size_t input_i = 0; input_i < input_length - ngram_size; input_i++) {
-            if (ngram[ngram_i] != input_ids[input_i]) {
-                ngram_i = 0;
-                continue;
-            }
+void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::clear_prompt_lookup_ids() {
+    m_prompt_lookup_ids.clear();
+}
 
-            ngram_i++;
+const TokenIds& ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_prompt_lookup_ids(const SequenceGroup::Ptr& request) const {
+    if (request->get_sequence_group_type() != SequenceGroupType::EMBEDDINGS) {
+        return request->get_prompt_ids();
+    }
+    // the n-grams of the generated tokens only are matched without the text of the prompt
+    static const TokenIds no_prompt_lookup_ids;
+    auto it = m_prompt_lookup_ids.find(request->get_request_id());
+    return it != m_prompt_lookup_ids.end() ? it->second : no_prompt_lookup_ids;
+}
 
-            if (ngram_i < ngram_size) {
-                continue;
-            }
+NgramIndex& ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::update_ngram_index(const SequenceGroup::Ptr& request,
+                                                                                               const Sequence::Ptr& sequence) {
+    const auto& prompt = get_prompt_lookup_ids(request);
+    const auto& generated_tokens = sequence->get_generated_ids();
+    const size_t input_length = prompt.size() + generated_tokens.size();
+    auto token_at = [&](size_t pos) {
+        return pos < prompt.size() ? prompt[pos] : generated_tokens[pos - prompt.size()];
+    };
+
+    auto it = m_ngram_indexes.find(sequence->get_id());
+    if (it != m_ngram_indexes.end()) {
+        // candidates are not indexed, so the indexed tokens are expected to be a prefix of the sequence; rebuild otherwise
+        const auto& indexed_tokens = it->second.get_tokens();
+        if (indexed_tokens.size() > input_length ||
+            (!indexed_tokens.empty() && indexed_tokens.back() != token_at(indexed_tokens.size() - 1))) {
+            m_ngram_indexes.erase(it);
+            it = m_ngram_indexes.end();
+        }
+    }
+    if (it == m_ngram_indexes.end()) {
+        it = m_ngram_indexes.emplace(sequence->get_id(), NgramIndex(request->get_sampling_parameters().max_ngram_size)).first;
+    }
+    NgramIndex& ngram_index = it->second;
+    for (size_t pos = ngram_index.get_tokens().size(); pos < input_length; ++pos) {
+        ngram_index.append(token_at(pos));
+    }
+    return ngram_index;
+}
 
-            // match found with the end at input_i
-            size_t avaliable_num_pred = std::min(input_length - (input_i + 1), num_pred_tokens);
+ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::LookaheadState&
+ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::update_lookahead_state(const SequenceGroup::Ptr& request,
+                                                                                      const Sequence::Ptr& sequence) {
+    auto it = m_lookahead_states.find(sequence->get_id());
+    if (it == m_lookahead_states.end()) {
+        const size_t ngram_size = request->get_sampling_parameters().num_assistant_tokens + 1;
+        it = m_lookahead_states.emplace(sequence->get_id(), LookaheadState{LookaheadPool(ngram_size), {}}).first;
+    }
+    LookaheadState& state = it->second;
+
+    // the sampler leaves the predictions after the rejected candidates of the previous step, otherwise the guess is used up
+    state.guess = sequence->get_lookahead_tokens();
+    sequence->set_lookahead_tokens({});
+    if (!state.guess.empty()) {
+        TokenIds trajectory{sequence->get_generated_ids().back()};
+        trajectory.insert(trajectory.end(), state.guess.begin(), state.guess.end());
+        state.pool.add_trajectory(trajectory);
+    }
+    return state;
+}
 
-            // return candidates with length of avaliable_num_pred
-            return std::vector<int64_t>{input_ids.cbegin() + input_i + 1,
-                                        input_ids.cbegin() + input_i + 1 + avaliable_num_pred};
+TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_lookahead_candidates(const LookaheadState& state,
+                                                                                                    const NgramIndex& ngram_index,
+                                                                                                    size_t num_candidates) {
+    const auto& tokens = ngram_index.get_tokens();
+    TokenIds candidates = state.pool.find_candidates(tokens.back(), num_candidates);
+    if (candidates.empty()) {
+        // Jacobi iteration converges from any guess, it starts with the last tokens of the context
+        auto guess_begin = state.guess.begin(), guess_end = state.guess.end();
+        if (state.guess.empty()) {
+            guess_begin = tokens.end() - std::min(tokens.size(), num_candidates);
+            guess_end = tokens.end();
         }
+        candidates.assign(guess_begin, guess_begin + std::min<size_t>(guess_end - guess_begin, num_candidates));
     }
+    return candidates;
+}
 
-    return std::vector<int64_t>{};
+void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::update_ngram_store() {
+    for (const auto& request : m_previous_requests) {
+        if (!request->has_finished()) {
+            continue;
+        }
+        const auto& sampling_params = request->get_sampling_parameters();
+        const auto& prompt = get_prompt_lookup_ids(request);
+        // the end of the prompt is the context of the n-grams starting the output
+        const size_t context_len = std::min(prompt.size(), sampling_params.max_ngram_size > 0 ? sampling_params.max_ngram_size - 1 : 0);
+        for (const auto& sequence : request->get_finished_sequences()) {
+            const auto& generated_ids = sequence->get_generated_ids();
+            TokenIds tokens(prompt.end() - context_len, prompt.end());
+            tokens.insert(tokens.end(), generated_ids.begin(), generated_ids.end());
+            m_ngram_store->add(tokens, context_len, sampling_params.max_ngram_size, sampling_params.num_assistant_tokens);
+        }
+    }
+    m_previous_requests = m_requests;
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates() {
+    if (m_ngram_store) {
+        update_ngram_store();
+    }
+
+    std::set<uint64_t> running_sequence_ids;
     for (auto& request : m_requests) {
-        const auto prompt = request->get_prompt_ids();
         size_t max_validation_len = 0;
         for (auto& running_sequence : request->get_running_sequences()) {
-            const auto generated_tokens = running_sequence->get_generated_ids();
-            if (generated_tokens.empty()) {
+            running_sequence_ids.insert(running_sequence->get_id());
+            if (running_sequence->get_generated_ids().empty()) {
                 continue;
             }
-            TokenIds full_input_ids = prompt;
-            full_input_ids.insert(full_input_ids.end(), generated_tokens.begin(), generated_tokens.end());
+            // the index is extended by the tokens accepted since the previous step only
+            const NgramIndex& ngram_index = update_ngram_index(request, running_sequence);
+            const LookaheadState& lookahead_state = update_lookahead_state(request, running_sequence);
 
             size_t min_num_assistant_tokens = 0;
-            const auto sampling_params = request->get_sampling_parameters();
+            const auto& sampling_params = request->get_sampling_parameters();
             {
                 const auto generated_len = running_sequence->get_generated_len();
                 const auto left_generated_len = request->get_max_new_tokens() - generated_len - 1;
                 min_num_assistant_tokens = std::min(sampling_params.num_assistant_tokens, left_generated_len);
             }
-            TokenIds candidates = generate_candidates(full_input_ids, min_num_assistant_tokens, sampling_params.max_ngram_size);
+            TokenIds candidates = ngram_index.find_candidates(min_num_assistant_tokens);
+            if (candidates.empty() && m_ngram_store) {
+                candidates = m_ngram_store->find_candidates(ngram_index.get_tokens(), sampling_params.max_ngram_size, min_num_assistant_tokens);
+            }
+            if (candidates.empty()) {
+                candidates = get_lookahead_candidates(lookahead_state, ngram_index, min_num_assistant_tokens);
+            }
 
             if (!candidates.empty()) {
                 for (const auto& candidate : candidates) {
@@ -84,6 +163,14 @@ void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate
         }
         request->set_num_validated_tokens(max_validation_len);
     }
+
+    // drop indexes and lookahead states of finished sequences
+    for (auto it = m_ngram_indexes.begin(); it != m_ngram_indexes.end();) {
+        it = running_sequence_ids.count(it->first) ? std::next(it) : m_ngram_indexes.erase(it);
+    }
+    for (auto it = m_lookahead_states.begin(); it != m_lookahead_states.end();) {
+        it = running_sequence_ids.count(it->first) ? std::next(it) : m_lookahead_states.erase(it);
+    }
 }
 
 bool ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::is_requests_empty() {
@@ -6,6 +6,9 @@
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 
 #include "continuous_batching/pipeline_impl.hpp"
+#include "prompt_lookup/lookahead_pool.hpp"
+#include "prompt_lookup/ngram_index.hpp"
+#include "prompt_lookup/ngram_store.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
@@ -26,7 +29,11 @@ public:
                             device,
                             properties,
                             generation_config,
-                            true } {};
+                            true } {
+        if (scheduler_config.prompt_lookup_store_size > 0) {
+            m_ngram_store = std::make_unique<NgramStore>(scheduler_config.prompt_lookup_store_size);
+        }
+    };
                             
     void generate_candidates();
 
@@ -38,8 +45,43 @@ public:
 
     size_t get_processed_tokens_per_iteration();
 
+    // sets the text tokens of the prompt of the request with embeddings, which n-grams are matched instead of the prompt ids
+    void set_prompt_lookup_ids(uint64_t request_id, TokenIds prompt_lookup_ids);
+    void clear_prompt_lookup_ids();
+
     using ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests;
 protected:
-    TokenIds generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size);
+    // the prompt ids or, for the requests with embeddings, the text tokens of the prompt, if set
+    const TokenIds& get_prompt_lookup_ids(const SequenceGroup::Ptr& request) const;
+
+    // { request_id, text tokens of the prompt }
+    std::map<uint64_t, TokenIds> m_prompt_lookup_ids;
+
+    // extends the n-gram index of the sequence with its tokens, which are not indexed yet
+    NgramIndex& update_ngram_index(const SequenceGroup::Ptr& request, const Sequence::Ptr& sequence);
+
+    // { sequence_id, n-gram index of prompt and generated tokens }
+    std::map<uint64_t, NgramIndex> m_ngram_indexes;
+
+    // adds the outputs of the requests, which have finished since the previous step, to the shared n-gram store
+    void update_ngram_store();
+
+    // n-grams of the outputs of completed requests, shared by all the requests; nullptr if disabled
+    std::unique_ptr<NgramStore> m_ngram_store;
+    // requests at the previous step, to find the completed ones
+    std::vector<SequenceGroup::Ptr> m_previous_requests;
+
+    struct LookaheadState {
+        LookaheadPool pool;
+        TokenIds guess;
+    };
+    // { sequence_id, n-gram pool and Jacobi guess of lookahead decoding }
+    std::map<uint64_t, LookaheadState> m_lookahead_states;
+
+    // takes the predictions of the previous step as the next Jacobi guess and adds their n-grams to the pool
+    LookaheadState& update_lookahead_state(const SequenceGroup::Ptr& request, const Sequence::Ptr& sequence);
+    // candidates of lookahead decoding for the sequences without a match in their context: the n-gram from the pool,
+    // which starts with the last token, or the current Jacobi guess
+    TokenIds get_lookahead_candidates(const LookaheadState& state, const NgramIndex& ngram_index, size_t num_candidates);
 };
 }
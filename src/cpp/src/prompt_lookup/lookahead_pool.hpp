@@ -0,0 +1,66 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * N-gram pool of lookahead decoding. Each step the model predicts the tokens following every candidate in the same forward
+ * pass, which verifies the candidates. The predictions after the first rejected candidate are one Jacobi iteration over
+ * the rejected guess: they are the next guess, and their n-grams are collected in the pool, keyed by the first token, as
+ * candidates for the later steps at which the sequence ends with that token.
+ */
+class LookaheadPool {
+public:
+    explicit LookaheadPool(size_t ngram_size = 0, size_t max_ngrams_per_token = 8) :
+        m_ngram_size(ngram_size), m_max_ngrams_per_token(max_ngrams_per_token) {}
+
+    /**
+     * Adds the n-grams of the Jacobi trajectory, i.e. of the token generated after the accepted candidates followed by
+     * the predictions at the positions of the rejected ones.
+     */
+    void add_trajectory(const std::vector<int64_t>& tokens) {
+        if (m_ngram_size < 2) {
+            return;
+        }
+        for (size_t start = 0; start + m_ngram_size <= tokens.size(); ++start) {
+            auto& continuations = m_continuations[tokens[start]];
+            std::vector<int64_t> continuation(tokens.begin() + start + 1, tokens.begin() + start + m_ngram_size);
+            // the most recently added continuation is the first one
+            auto it = std::find(continuations.begin(), continuations.end(), continuation);
+            if (it != continuations.end()) {
+                continuations.erase(it);
+            } else if (continuations.size() == m_max_ngrams_per_token) {
+                continuations.pop_back();
+            }
+            continuations.push_front(std::move(continuation));
+        }
+    }
+
+    /**
+     * @return Up to `num_pred_tokens` tokens of the most recent n-gram starting with `last_token`, empty if there is none.
+     */
+    std::vector<int64_t> find_candidates(int64_t last_token, size_t num_pred_tokens) const {
+        auto it = m_continuations.find(last_token);
+        if (it == m_continuations.end() || num_pred_tokens == 0) {
+            return {};
+        }
+        const auto& continuation = it->second.front();
+        return {continuation.begin(), continuation.begin() + std::min(continuation.size(), num_pred_tokens)};
+    }
+
+private:
+    size_t m_ngram_size;
+    size_t m_max_ngrams_per_token;
+    // { first token of n-gram, the rest of the n-grams starting with it, the most recent first }
+    std::unordered_map<int64_t, std::deque<std::vector<int64_t>>> m_continuations;
+};
+
+}  // namespace ov::genai
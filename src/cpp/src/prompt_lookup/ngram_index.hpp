@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * Index of the first occurrences of all n-grams (n <= max_ngram_size) of a token sequence which is extended at the end,
+ * as the input ids of a sequence are during generation. Appending a token costs O(max_ngram_size), so candidates can be
+ * looked up in O(max_ngram_size) per step instead of rescanning the whole context for each n-gram size.
+ */
+class NgramIndex {
+public:
+    explicit NgramIndex(size_t max_ngram_size = 0) : m_max_ngram_size(max_ngram_size), m_first_ngram_ends(max_ngram_size) {}
+
+    size_t get_max_ngram_size() const {
+        return m_max_ngram_size;
+    }
+
+    const std::vector<int64_t>& get_tokens() const {
+        return m_tokens;
+    }
+
+    void append(int64_t token) {
+        m_tokens.push_back(token);
+        const size_t end = m_tokens.size() - 1;
+        uint64_t hash = 0;
+        for (size_t ngram_size = 1; ngram_size <= std::min(m_max_ngram_size, m_tokens.size()); ++ngram_size) {
+            hash = combine(hash, m_tokens[end + 1 - ngram_size]);
+            // only the first occurrence is kept, so that the earliest match is found as by the linear search
+            m_first_ngram_ends[ngram_size - 1].emplace(hash, end);
+        }
+    }
+
+    /**
+     * Looks up the tokens which followed an earlier occurrence of the longest possible suffix n-gram of the sequence
+     * (n <= max_ngram_size), the earliest one among the occurrences of the n-gram, which end before the suffix starts.
+     * @return Up to `num_pred_tokens` tokens, empty if no match is found.
+     */
+    std::vector<int64_t> find_candidates(size_t num_pred_tokens) const {
+        const size_t length = m_tokens.size();
+        if (num_pred_tokens == 0) {
+            return {};
+        }
+        std::vector<uint64_t> suffix_hashes;
+        uint64_t hash = 0;
+        for (size_t ngram_size = 1; ngram_size <= std::min(m_max_ngram_size, length); ++ngram_size) {
+            hash = combine(hash, m_tokens[length - ngram_size]);
+            suffix_hashes.push_back(hash);
+        }
+        for (size_t ngram_size = suffix_hashes.size(); ngram_size > 0; --ngram_size) {
+            const auto& first_ngram_ends = m_first_ngram_ends[ngram_size - 1];
+            auto it = first_ngram_ends.find(suffix_hashes[ngram_size - 1]);
+            if (it == first_ngram_ends.end())
+                continue;
+            const size_t end = it->second;
+            // the first occurrence is the suffix itself or overlaps it, there are no earlier ones
+            if (end + ngram_size >= length)
+                continue;
+            // hashes may collide
+            if (!std::equal(m_tokens.begin() + (end + 1 - ngram_size), m_tokens.begin() + (end + 1), m_tokens.end() - ngram_size))
+                continue;
+            const size_t num_candidates = std::min(length - (end + 1), num_pred_tokens);
+            return {m_tokens.begin() + (end + 1), m_tokens.begin() + (end + 1 + num_candidates)};
+        }
+        return {};
+    }
+
+    // extends the hash of an n-gram by the token preceding it
+    static uint64_t combine(uint64_t hash, int64_t token) {
+        uint64_t value = hash ^ (static_cast<uint64_t>(token) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+private:
+    size_t m_max_ngram_size;
+    std::vector<int64_t> m_tokens;
+    // { hash of n-gram, position of the last token of its first occurrence } for each n-gram size
+    std::vector<std::unordered_map<uint64_t, size_t>> m_first_ngram_ends;
+};
+
+}  // namespace ov::genai
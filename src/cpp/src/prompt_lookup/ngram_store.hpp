@@ -0,0 +1,106 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "prompt_lookup/ngram_index.hpp"
+
+namespace ov::genai {
+
+/**
+ * Bounded store of the n-grams of the outputs of completed requests and of the tokens which followed them, shared by
+ * prompt lookup decoding of all the requests of a pipeline. Concurrent requests often produce overlapping outputs, e.g.
+ * the same API calls and boilerplate of code completion, which are not in their own contexts. The least recently added
+ * or matched n-grams are evicted first.
+ */
+class NgramStore {
+public:
+    explicit NgramStore(size_t max_num_ngrams) : m_max_num_ngrams(max_num_ngrams) {}
+
+    size_t size() const {
+        return m_entries.size();
+    }
+
+    /**
+     * Adds the n-grams (n <= max_ngram_size) of `tokens` followed by the tokens from `start` on, i.e. the generated ones,
+     * the tokens before `start` are the context they are preceded by. Up to `max_continuation_len` following tokens are
+     * kept for each n-gram, the ones of its latest occurrence.
+     */
+    void add(const std::vector<int64_t>& tokens, size_t start, size_t max_ngram_size, size_t max_continuation_len) {
+        if (m_max_num_ngrams == 0 || max_continuation_len == 0) {
+            return;
+        }
+        for (size_t end = std::max<size_t>(start, 1) - 1; end + 1 < tokens.size(); ++end) {
+            const auto continuation_begin = tokens.begin() + (end + 1);
+            const auto continuation_end = continuation_begin + std::min(tokens.size() - (end + 1), max_continuation_len);
+            uint64_t hash = 0;
+            for (size_t ngram_size = 1; ngram_size <= std::min(max_ngram_size, end + 1); ++ngram_size) {
+                hash = NgramIndex::combine(hash, tokens[end + 1 - ngram_size]);
+                Entry entry{std::vector<int64_t>(tokens.begin() + (end + 1 - ngram_size), continuation_begin),
+                            std::vector<int64_t>(continuation_begin, continuation_end)};
+                auto it = m_index.find(hash);
+                if (it != m_index.end()) {
+                    m_entries.erase(it->second);
+                } else if (m_entries.size() == m_max_num_ngrams) {
+                    m_index.erase(m_entries.back().hash);
+                    m_entries.pop_back();
+                }
+                m_entries.push_front({hash, std::move(entry)});
+                m_index[hash] = m_entries.begin();
+            }
+        }
+    }
+
+    /**
+     * Looks up the tokens which followed the longest suffix n-gram of `tokens` (n <= max_ngram_size) in the store.
+     * @return Up to `num_pred_tokens` tokens, empty if no match is found.
+     */
+    std::vector<int64_t> find_candidates(const std::vector<int64_t>& tokens, size_t max_ngram_size, size_t num_pred_tokens) {
+        if (num_pred_tokens == 0) {
+            return {};
+        }
+        std::vector<uint64_t> suffix_hashes;
+        uint64_t hash = 0;
+        for (size_t ngram_size = 1; ngram_size <= std::min(max_ngram_size, tokens.size()); ++ngram_size) {
+            hash = NgramIndex::combine(hash, tokens[tokens.size() - ngram_size]);
+            suffix_hashes.push_back(hash);
+        }
+        for (size_t ngram_size = suffix_hashes.size(); ngram_size > 0; --ngram_size) {
+            auto it = m_index.find(suffix_hashes[ngram_size - 1]);
+            if (it == m_index.end())
+                continue;
+            const Entry& entry = it->second->entry;
+            // hashes may collide
+            if (entry.ngram.size() != ngram_size || !std::equal(entry.ngram.begin(), entry.ngram.end(), tokens.end() - ngram_size))
+                continue;
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            const size_t num_candidates = std::min(entry.continuation.size(), num_pred_tokens);
+            return {entry.continuation.begin(), entry.continuation.begin() + num_candidates};
+        }
+        return {};
+    }
+
+private:
+    struct Entry {
+        std::vector<int64_t> ngram;
+        std::vector<int64_t> continuation;
+    };
+    struct HashedEntry {
+        uint64_t hash;
+        Entry entry;
+    };
+
+    size_t m_max_num_ngrams;
+    // the most recently added or matched n-gram is the first one
+    std::list<HashedEntry> m_entries;
+    // { hash of n-gram, its entry }
+    std::unordered_map<uint64_t, std::list<HashedEntry>::iterator> m_index;
+};
+
+}  // namespace ov::genai
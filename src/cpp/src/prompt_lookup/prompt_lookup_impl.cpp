@@ -6,6 +6,7 @@
 #include "utils.hpp"
 #include "prompt_lookup_impl.hpp"
 #include "openvino/genai/text_streamer.hpp"
+#include "visual_language/inputs_embedder.hpp"
 
 
 namespace ov::genai {
@@ -121,7 +122,9 @@ ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<ov::Ten
     for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
         OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");   
         OPENVINO_ASSERT(sampling_params[request_id].is_prompt_lookup(), "`max_ngram_size` && `num_assistant_tokens` should be specified for `prompt lookup decoding`"); 
-        generations.push_back(m_pipeline->add_request(request_id, input_ids[request_id], sampling_params[request_id]));
+        const bool has_token_type_ids = token_type_ids.has_value() && request_id < token_type_ids->size();
+        generations.push_back(m_pipeline->add_request(request_id, input_ids[request_id], sampling_params[request_id],
+                                                      has_token_type_ids ? std::make_optional((*token_type_ids)[request_id]) : std::nullopt));
     }
     auto all_requests = m_pipeline->get_awaiting_requests();
 
@@ -159,6 +162,7 @@ ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<ov::Ten
         result.m_generation_ids.resize(num_outputs);
         result.m_scores.resize(num_outputs);
         result.m_status = request->get_generation_stream()->get_status();
+        result.request_metrics = request->get_request_metrics();
 
         for (size_t i = 0; i < num_outputs; ++i) {
             const auto & sequence = sequences[i];
@@ -191,6 +195,25 @@ ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<ov::Ten
     return results;
 }
 
+std::vector<VLMDecodedResults>
+ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<std::string>& prompts,
+                                                       const std::vector<std::vector<ov::Tensor>>& rgbs,
+                                                       const std::vector<std::vector<ov::Tensor>>& videos,
+                                                       const std::vector<GenerationConfig>& sampling_params,
+                                                       const StreamerVariant& streamer) {
+    // the request ids of generate() are the indices of the prompts, whose image tags are removed, so that the n-grams
+    // of the image tokens aren't matched
+    m_pipeline->clear_prompt_lookup_ids();
+    for (size_t request_id = 0; request_id < prompts.size(); ++request_id) {
+        const std::string text = std::regex_replace(prompts[request_id], UNIVERSAL_PATTERN, "");
+        const ov::Tensor text_ids = m_tokenizer.encode(text, ov::genai::add_special_tokens(false)).input_ids;
+        m_pipeline->set_prompt_lookup_ids(request_id, TokenIds(text_ids.data<const int64_t>(), text_ids.data<const int64_t>() + text_ids.get_size()));
+    }
+    auto results = IContinuousBatchingPipeline::generate(prompts, rgbs, videos, sampling_params, streamer);
+    m_pipeline->clear_prompt_lookup_ids();
+    return results;
+}
+
 SpeculativeDecodingMetrics
 ContinuousBatchingPipeline::PromptLookupImpl::get_metrics() {
     return m_sd_metrics;
@@ -25,10 +25,16 @@ public:
                      const SchedulerConfig& scheduler_config,
                      const std::string& device,
                      const ov::AnyMap& properties,
-                     const ov::genai::GenerationConfig& generation_config) {
+                     const ov::genai::GenerationConfig& generation_config,
+                     std::shared_ptr<InputsEmbedder> inputs_embedder = nullptr) {
         m_tokenizer = tokenizer;
         m_perf_metrics.raw_metrics.m_inference_durations = {{ MicroSeconds(0.0f) }};
         m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
+        if (inputs_embedder) {
+            m_pipeline->set_inputs_embedder(inputs_embedder);
+            m_inputs_embedder = inputs_embedder;
+            m_model_input_type = ModelInputType::EMBEDDINGS;
+        }
     };
 
     GenerationHandle add_request(uint64_t request_id,
@@ -49,7 +55,27 @@ public:
              const StreamerVariant& streamer,
              std::optional<std::vector<ov::Tensor>> token_type_ids = std::nullopt) override;
 
+    // the n-grams of the text of the prompts are matched, the image tokens are excluded
+    std::vector<VLMDecodedResults>
+    generate(const std::vector<std::string>& prompts,
+             const std::vector<std::vector<ov::Tensor>>& rgbs,
+             const std::vector<std::vector<ov::Tensor>>& videos,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer) override;
+
     SpeculativeDecodingMetrics get_metrics();
+
+    ServingMetrics get_serving_metrics() const override {
+        return m_pipeline->get_serving_metrics();
+    }
+
+    MemoryReport get_memory_report() const override {
+        MemoryReport memory_report = m_pipeline->get_memory_report();
+        if (m_inputs_embedder) {
+            memory_report.vision_embedding_cache = m_inputs_embedder->get_vision_embedding_cache_byte_size();
+        }
+        return memory_report;
+    }
 };
 
 }
@@ -3,11 +3,23 @@
 
 #include "openvino/genai/rag/text_embedding_pipeline.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <future>
+#include <limits>
+#include <map>
+#include <numeric>
+
 #include "openvino/genai/tokenizer.hpp"
+#include "openvino/op/round.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/op/util/gather_base.hpp"
 #include "openvino/opsets/opset.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "circular_buffer_queue.hpp"
 #include "utils.hpp"
 
 namespace {
@@ -19,9 +31,15 @@ ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
 
     properties_copy.erase(max_length.name());
     properties_copy.erase(pooling_type.name());
+    properties_copy.erase(embedding_size.name());
     properties_copy.erase(normalize.name());
+    properties_copy.erase(embedding_precision.name());
     properties_copy.erase(embed_instruction.name());
     properties_copy.erase(query_instruction.name());
+    properties_copy.erase(max_batch_tokens.name());
+    properties_copy.erase(pack_sequences.name());
+    properties_copy.erase(window_length.name());
+    properties_copy.erase(window_overlap.name());
 
     return properties_copy;
 }
@@ -76,11 +94,193 @@ std::shared_ptr<op::Op> get_mean_pooling_op(std::shared_ptr<Model> model,
     return std::make_shared<op::v1::Divide>(sum_hidden_state, max_expanded_mask);
 }
 
+/**
+ * Packed pooling multiplies the hidden states of a row by the pooling weights of its texts: 1 / text_length for the
+ * tokens of a text with MEAN pooling and 1 for the first token of a text with CLS pooling
+ * [batch_size, max_texts_per_row, seq_length] x [batch_size, seq_length, hidden_size]
+ * -> [batch_size * max_texts_per_row, hidden_size]
+ */
+std::shared_ptr<op::Op> get_packed_pooling_op(const std::shared_ptr<op::v0::Parameter>& pooling_weights,
+                                              const ov::Output<ov::Node>& last_hidden_state_node) {
+    auto weights = std::make_shared<op::v0::Convert>(pooling_weights, last_hidden_state_node.get_element_type());
+    auto pooled = std::make_shared<op::v0::MatMul>(weights, last_hidden_state_node);
+
+    auto shape_of = std::make_shared<op::v3::ShapeOf>(last_hidden_state_node);
+    auto hidden_size_index = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+    auto gather_axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{0});
+    auto hidden_size = std::make_shared<op::v8::Gather>(shape_of, hidden_size_index, gather_axis);
+    auto all_texts = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{-1});
+    auto output_shape = std::make_shared<op::v0::Concat>(ov::OutputVector{all_texts, hidden_size}, 0);
+
+    return std::make_shared<op::v1::Reshape>(pooled, output_shape, false);
+}
+
+/**
+ * Truncation keeps the first dimensions of Matryoshka embeddings
+ * [batch_size, hidden_size] -> [batch_size, embedding_size]
+ */
+std::shared_ptr<op::Op> get_truncation_op(const ov::Output<ov::Node>& embeddings_node, size_t embedding_size) {
+    auto start = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{0});
+    auto stop = std::make_shared<op::v0::Constant>(ov::element::i64,
+                                                   ov::Shape{1},
+                                                   std::vector<int64_t>{static_cast<int64_t>(embedding_size)});
+    auto step = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+    auto axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+
+    return std::make_shared<op::v8::Slice>(embeddings_node, start, stop, step, axis);
+}
+
+/**
+ * Scalar quantization maps the normalized values to int8 or uint8 range, binary quantization packs the sign bits
+ * [batch_size, hidden_size] -> [batch_size, hidden_size / 8]
+ */
+std::shared_ptr<op::Op> get_quantization_op(const ov::Output<ov::Node>& embeddings_node,
+                                            TextEmbeddingPipeline::EmbeddingPrecision precision) {
+    using EmbeddingPrecision = TextEmbeddingPipeline::EmbeddingPrecision;
+    auto constant = [](float value) {
+        return std::make_shared<op::v0::Constant>(ov::element::f32, ov::Shape{}, std::vector<float>{value});
+    };
+    auto embeddings = std::make_shared<op::v0::Convert>(embeddings_node, ov::element::f32);
+
+    if (precision == EmbeddingPrecision::INT8) {
+        auto scaled = std::make_shared<op::v1::Multiply>(embeddings, constant(127.0f));
+        auto rounded = std::make_shared<op::v5::Round>(scaled, op::v5::Round::RoundMode::HALF_TO_EVEN);
+        auto clamped = std::make_shared<op::v0::Clamp>(rounded, -127.0, 127.0);
+        return std::make_shared<op::v0::Convert>(clamped, ov::element::i8);
+    } else if (precision == EmbeddingPrecision::UINT8) {
+        auto shifted = std::make_shared<op::v1::Add>(embeddings, constant(1.0f));
+        auto scaled = std::make_shared<op::v1::Multiply>(shifted, constant(127.5f));
+        auto rounded = std::make_shared<op::v5::Round>(scaled, op::v5::Round::RoundMode::HALF_TO_EVEN);
+        auto clamped = std::make_shared<op::v0::Clamp>(rounded, 0.0, 255.0);
+        return std::make_shared<op::v0::Convert>(clamped, ov::element::u8);
+    } else if (precision == EmbeddingPrecision::BINARY) {
+        auto bits = std::make_shared<op::v0::Convert>(std::make_shared<op::v1::Greater>(embeddings, constant(0.0f)),
+                                                      ov::element::i32);
+        // [batch_size, hidden_size / 8, 8]
+        auto bytes_shape = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{3}, std::vector<int64_t>{0, -1, 8});
+        auto bytes = std::make_shared<op::v1::Reshape>(bits, bytes_shape, true);
+        auto bit_values = std::make_shared<op::v0::Constant>(ov::element::i32,
+                                                             ov::Shape{8},
+                                                             std::vector<int32_t>{128, 64, 32, 16, 8, 4, 2, 1});
+        auto axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+        auto packed = std::make_shared<op::v1::ReduceSum>(std::make_shared<op::v1::Multiply>(bytes, bit_values), axis);
+        return std::make_shared<op::v0::Convert>(packed, ov::element::u8);
+    }
+
+    OPENVINO_THROW("Embedding precision is not supported");
+}
+
+bool is_position_embeddings(const std::shared_ptr<ov::Node>& node) {
+    return node->get_friendly_name().find("position_embeddings") != std::string::npos;
+}
+
+/**
+ * Prepares the model for the rows of several texts: the attention masks of ScaledDotProductAttention are replaced by
+ * the block-diagonal mask of the new 'segment_ids' input, so a token attends to the tokens of its own text only, and
+ * the position embeddings are indexed by the 'position_ids' input, which restarts for each text of a row
+ */
+void enable_sequence_packing(std::shared_ptr<Model> model) {
+    auto segment_ids = std::make_shared<op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1, -1});
+    segment_ids->set_friendly_name("segment_ids");
+    segment_ids->output(0).get_tensor().set_names({"segment_ids"});
+
+    // [batch_size, 1, seq_length, seq_length]
+    auto query_axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+    auto key_axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+    auto same_segment = std::make_shared<op::v1::Equal>(std::make_shared<op::v0::Unsqueeze>(segment_ids, query_axis),
+                                                        std::make_shared<op::v0::Unsqueeze>(segment_ids, key_axis));
+    auto heads_axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+    ov::Output<ov::Node> block_mask = std::make_shared<op::v0::Unsqueeze>(same_segment, heads_axis);
+
+    // the additive masks of each element type, the padding tokens share segment 0, so no row of a mask is fully masked
+    std::map<ov::element::Type, ov::Output<ov::Node>> masks{{ov::element::boolean, block_mask}};
+    auto get_mask = [&](const ov::element::Type& type) {
+        auto it = masks.find(type);
+        if (it == masks.end()) {
+            auto zero = std::make_shared<op::v0::Constant>(ov::element::f32, ov::Shape{}, std::vector<float>{0.0f});
+            auto lowest = std::make_shared<op::v0::Constant>(ov::element::f32,
+                                                             ov::Shape{},
+                                                             std::vector<float>{std::numeric_limits<float>::lowest()});
+            auto mask = std::make_shared<op::v1::Select>(block_mask, zero, lowest);
+            it = masks.emplace(type, std::make_shared<op::v0::Convert>(mask, type)).first;
+        }
+        return it->second;
+    };
+
+    size_t num_attentions = 0;
+    for (const auto& node : model->get_ordered_ops()) {
+        auto attention = ov::as_type_ptr<op::v13::ScaledDotProductAttention>(node);
+        if (!attention) {
+            continue;
+        }
+        OPENVINO_ASSERT(!attention->get_causal() && attention->get_input_size() > 3,
+                        "Sequence packing requires the bidirectional attention with the attention mask, '",
+                        attention->get_friendly_name(),
+                        "' doesn't have it");
+        attention->input(3).replace_source_output(get_mask(attention->get_input_element_type(3)));
+        ++num_attentions;
+    }
+    OPENVINO_ASSERT(num_attentions > 0, "Sequence packing requires the model with ScaledDotProductAttention operations");
+
+    ov::ParameterVector new_parameters{segment_ids};
+    const auto& inputs = model->inputs();
+    const bool has_position_ids = std::any_of(inputs.begin(), inputs.end(), [](const ov::Output<ov::Node>& input) {
+        return input.get_names().count("position_ids");
+    });
+    if (!has_position_ids) {
+        auto position_ids = std::make_shared<op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1, -1});
+        position_ids->set_friendly_name("position_ids");
+        position_ids->output(0).get_tensor().set_names({"position_ids"});
+
+        // the positions of the position embeddings are a constant range of the sequence length
+        size_t num_position_embeddings = 0;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (!ov::as_type_ptr<op::util::GatherBase>(node) ||
+                ov::as_type_ptr<op::v0::Parameter>(node->get_input_node_shared_ptr(1)) ||
+                !(is_position_embeddings(node) || is_position_embeddings(node->get_input_node_shared_ptr(0)))) {
+                continue;
+            }
+            node->input(1).replace_source_output(
+                std::make_shared<op::v0::Convert>(position_ids, node->get_input_element_type(1)));
+            ++num_position_embeddings;
+        }
+        OPENVINO_ASSERT(num_position_embeddings > 0,
+                        "Sequence packing requires the model with 'position_ids' input or the position embeddings");
+        new_parameters.push_back(position_ids);
+    }
+
+    model->add_parameters(new_parameters);
+    model->validate_nodes_and_infer_types();
+}
+
 std::shared_ptr<Model> apply_postprocessing(std::shared_ptr<Model> model, const TextEmbeddingPipeline::Config& config) {
+    if (config.embedding_size) {
+        const ov::Dimension hidden_size = model->get_output_partial_shape(0)[2];
+        OPENVINO_ASSERT(*config.embedding_size > 0 &&
+                            (hidden_size.is_dynamic() || *config.embedding_size <= static_cast<size_t>(hidden_size.get_length())),
+                        "Embedding size must be in [1, ",
+                        hidden_size,
+                        "] range, got ",
+                        *config.embedding_size);
+        OPENVINO_ASSERT(config.embedding_precision != TextEmbeddingPipeline::EmbeddingPrecision::BINARY ||
+                            *config.embedding_size % 8 == 0,
+                        "Embedding size must be a multiple of 8 for BINARY embedding precision");
+    }
+
     ov::preprocess::PrePostProcessor processor(model);
 
-    processor.output().postprocess().custom([model, &config](const ov::Output<ov::Node>& node) {
-        if (config.pooling_type == TextEmbeddingPipeline::PoolingType::CLS) {
+    // [batch_size, max_texts_per_row, seq_length]
+    std::shared_ptr<op::v0::Parameter> pooling_weights;
+    if (config.pack_sequences) {
+        pooling_weights = std::make_shared<op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, -1});
+        pooling_weights->set_friendly_name("pooling_weights");
+        pooling_weights->output(0).get_tensor().set_names({"pooling_weights"});
+    }
+
+    processor.output().postprocess().custom([model, &config, &pooling_weights](const ov::Output<ov::Node>& node) {
+        if (pooling_weights) {
+            return get_packed_pooling_op(pooling_weights, node);
+        } else if (config.pooling_type == TextEmbeddingPipeline::PoolingType::CLS) {
             return get_cls_pooling_op(node);
         } else if (config.pooling_type == TextEmbeddingPipeline::PoolingType::MEAN) {
             return get_mean_pooling_op(model, node);
@@ -89,6 +289,13 @@ std::shared_ptr<Model> apply_postprocessing(std::shared_ptr<Model> model, const
         OPENVINO_THROW("Pooling type is not supported");
     });
 
+    // the embeddings are truncated before the normalization, so the kept dimensions are renormalized
+    if (config.embedding_size) {
+        processor.output().postprocess().custom([&config](const ov::Output<ov::Node>& node) {
+            return get_truncation_op(node, *config.embedding_size);
+        });
+    }
+
     if (config.normalize) {
         processor.output().postprocess().custom([](const ov::Output<ov::Node>& node) {
             auto axis_const = std::make_shared<op::v0::Constant>(ov::element::i32, ov::Shape{1}, std::vector{1});
@@ -96,7 +303,17 @@ std::shared_ptr<Model> apply_postprocessing(std::shared_ptr<Model> model, const
         });
     }
 
-    return processor.build();
+    if (config.embedding_precision != TextEmbeddingPipeline::EmbeddingPrecision::F32) {
+        processor.output().postprocess().custom([&config](const ov::Output<ov::Node>& node) {
+            return get_quantization_op(node, config.embedding_precision);
+        });
+    }
+
+    model = processor.build();
+    if (pooling_weights) {
+        model->add_parameters({pooling_weights});
+    }
+    return model;
 }
 }  // namespace
 
@@ -107,9 +324,15 @@ using utils::read_anymap_param;
 TextEmbeddingPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
     read_anymap_param(properties, ov::genai::pooling_type.name(), pooling_type);
+    read_anymap_param(properties, ov::genai::embedding_size.name(), embedding_size);
     read_anymap_param(properties, ov::genai::normalize.name(), normalize);
+    read_anymap_param(properties, ov::genai::embedding_precision.name(), embedding_precision);
     read_anymap_param(properties, ov::genai::embed_instruction.name(), embed_instruction);
     read_anymap_param(properties, ov::genai::query_instruction.name(), query_instruction);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
+    read_anymap_param(properties, ov::genai::pack_sequences.name(), pack_sequences);
+    read_anymap_param(properties, ov::genai::window_length.name(), window_length);
+    read_anymap_param(properties, ov::genai::window_overlap.name(), window_overlap);
 };
 
 class TextEmbeddingPipeline::TextEmbeddingPipelineImpl {
@@ -120,47 +343,146 @@ public:
                               const ov::AnyMap& properties = {})
         : m_config{config},
           m_tokenizer{models_path} {
-        ov::Core core = utils::singleton_core();
-
-        auto model = core.read_model(models_path / "openvino_model.xml", {}, properties);
-
+        auto model = utils::read_model(models_path, properties);
+
+        using EmbeddingPrecision = TextEmbeddingPipeline::EmbeddingPrecision;
+        OPENVINO_ASSERT(m_config.normalize || m_config.embedding_precision == EmbeddingPrecision::F32 ||
+                            m_config.embedding_precision == EmbeddingPrecision::BINARY,
+                        "INT8 and UINT8 embedding precisions require the normalization");
+        if (m_config.pack_sequences) {
+            enable_sequence_packing(model);
+        }
         model = apply_postprocessing(model, m_config);
-        if (m_config.max_length) {
-            m_tokenization_params.insert({max_length.name(), *m_config.max_length});
+        if (m_config.window_length) {
+            OPENVINO_ASSERT(m_config.embedding_precision == EmbeddingPrecision::F32,
+                            "Windows of the texts require F32 embedding precision");
+            init_window_special_tokens();
+            const size_t num_special_tokens = m_window_prefix.size() + m_window_suffix.size();
+            OPENVINO_ASSERT(*m_config.window_length > num_special_tokens + m_config.window_overlap,
+                            "Window length must be greater than the window overlap and ",
+                            num_special_tokens,
+                            " special tokens");
         }
 
-        ov::CompiledModel compiled_model = core.compile_model(model, device, properties);
+        std::optional<size_t> tokenization_max_length = m_config.window_length ? std::nullopt : m_config.max_length;
+
+        // the requests of the pool run in parallel on the streams of the device, which are created by the throughput hint
+        ov::AnyMap compile_properties = properties;
+        compile_properties.insert({ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT});
+        if (device == "NPU") {
+            compile_buckets_for_npu(model, compile_properties);
+            // the texts are truncated to the longest compiled sequence length unless they are split into the windows
+            const size_t max_seq_length =
+                std::max_element(m_buckets.begin(), m_buckets.end(), [](const Bucket& lhs, const Bucket& rhs) {
+                    return lhs.seq_length < rhs.seq_length;
+                })->seq_length;
+            OPENVINO_ASSERT(!m_config.window_length || *m_config.window_length <= max_seq_length,
+                            "Window length must not exceed the largest SEQ_LEN_BUCKETS value ",
+                            max_seq_length);
+            if (!m_config.window_length) {
+                tokenization_max_length = std::min(tokenization_max_length.value_or(max_seq_length), max_seq_length);
+            }
+        } else {
+            m_shared_compiled_model = utils::compile_shared_model(model, device, compile_properties);
+            ov::CompiledModel& compiled_model = *m_shared_compiled_model;
+            utils::print_compiled_model_properties(compiled_model, "text embedding model");
+            add_bucket(compiled_model, 0, 0);
+        }
+        if (tokenization_max_length) {
+            m_tokenization_params.insert({max_length.name(), *tokenization_max_length});
+        }
 
-        utils::print_compiled_model_properties(compiled_model, "text embedding model");
-        m_request = compiled_model.create_infer_request();
+        const ov::CompiledModel& compiled_model = m_buckets.front().compiled_model;
+        m_output_type = compiled_model.output().get_element_type();
+        for (auto& input : compiled_model.inputs()) {
+            if (input.get_any_name() == "token_type_ids") {
+                m_has_token_type_ids = true;
+            }
+        }
     };
 
+    ~TextEmbeddingPipelineImpl() {
+        if (m_async_call) {
+            release(*m_async_call);
+        }
+    }
+
     EmbeddingResults embed_documents(const std::vector<std::string>& texts) {
-        start_embed_documents_async(texts);
-        return wait_embed_documents();
+        auto formatted_texts = format_texts(texts);
+        EmbedCall call = start_embed(formatted_texts);
+        return wait_embed(call);
     };
 
+    DocumentWindows embed_document_windows(const std::vector<std::string>& texts) {
+        auto formatted_texts = format_texts(texts);
+        EmbedCall call = start_embed(formatted_texts, {}, 0, false);
+        DocumentWindows windows{wait_embed(call), std::move(call.window_texts)};
+        if (windows.document_indices.empty()) {
+            windows.document_indices.resize(texts.size());
+            std::iota(windows.document_indices.begin(), windows.document_indices.end(), 0);
+        }
+        return windows;
+    }
+
+    size_t embed_documents(const std::function<std::optional<std::string>()>& next_document,
+                           ov::Tensor& embeddings,
+                           size_t chunk_size) {
+        OPENVINO_ASSERT(embeddings.get_element_type() == m_output_type && embeddings.get_shape().size() == 2,
+                        "Embeddings tensor must be ",
+                        m_output_type,
+                        " tensor of [max_num_documents, embedding_size] shape");
+        OPENVINO_ASSERT(chunk_size > 0, "Chunk size must be positive");
+
+        const size_t max_num_documents = embeddings.get_shape()[0];
+        size_t num_documents = 0;
+        std::vector<std::string> chunk;
+        chunk.reserve(std::min(chunk_size, max_num_documents));
+        while (num_documents < max_num_documents) {
+            chunk.clear();
+            while (chunk.size() < std::min(chunk_size, max_num_documents - num_documents)) {
+                std::optional<std::string> document = next_document();
+                if (!document) {
+                    break;
+                }
+                chunk.push_back(m_config.embed_instruction ? *m_config.embed_instruction + *document : std::move(*document));
+            }
+            if (chunk.empty()) {
+                break;
+            }
+
+            EmbedCall call = start_embed(chunk, embeddings, num_documents);
+            wait_embed(call);
+            num_documents += chunk.size();
+        }
+        return num_documents;
+    }
+
     void start_embed_documents_async(const std::vector<std::string>& texts) {
         auto formatted_texts = format_texts(texts);
-        start_embed_async(formatted_texts);
+        start_async_call(formatted_texts);
     };
 
     EmbeddingResults wait_embed_documents() {
-        return wait_embed();
+        return wait_async_call();
     };
 
     EmbeddingResult embed_query(const std::string& text) {
-        start_embed_query_async(text);
-        return wait_embed_query();
+        std::vector<std::string> formatted_query{format_query(text)};
+        EmbedCall call = start_embed(formatted_query);
+        return get_query_result(wait_embed(call));
     };
 
     void start_embed_query_async(const std::string& text) {
         std::vector<std::string> formatted_query{format_query(text)};
-        start_embed_async(formatted_query);
+        start_async_call(formatted_query);
     };
 
     EmbeddingResult wait_embed_query() {
-        const EmbeddingResults results = wait_embed();
+        return get_query_result(wait_async_call());
+    };
+
+private:
+    static EmbeddingResult get_query_result(const EmbeddingResults& results) {
         if (auto floats = std::get_if<std::vector<std::vector<float>>>(&results)) {
             return (*floats)[0];
         } else if (auto int8s = std::get_if<std::vector<std::vector<int8_t>>>(&results)) {
@@ -169,42 +491,523 @@ public:
             return (*uint8s)[0];
         }
         OPENVINO_THROW("Embedding result type is not supported");
+    }
+
+    // compiled model of the shape, which the batches are padded to, and the pool of its infer requests
+    struct Bucket {
+        // 0 for the dynamic shape
+        size_t batch_size = 0;
+        size_t seq_length = 0;
+        ov::CompiledModel compiled_model;
+        // the batches of a call are distributed among the idle requests, the calls of different threads share the pool
+        std::unique_ptr<CircularBufferQueue<ov::InferRequest>> requests;
     };
 
-private:
     Tokenizer m_tokenizer;
-    InferRequest m_request;
+    // the buckets from the cheapest one
+    std::vector<Bucket> m_buckets;
+    // the compiled model of the dynamic shape, which is shared with the other pipelines of the process
+    std::shared_ptr<ov::CompiledModel> m_shared_compiled_model;
+    // the largest batch size of the buckets of the static shapes
+    std::optional<size_t> m_max_batch_size;
     Config m_config;
     AnyMap m_tokenization_params;
+    bool m_has_token_type_ids = false;
+    ov::element::Type m_output_type;
+    // special tokens added before and after a text, which are repeated in each window of a long text
+    std::vector<int64_t> m_window_prefix, m_window_suffix;
+
+    struct Batch {
+        // indices of the texts of each row, a row has a single text unless the sequences are packed
+        std::vector<std::vector<size_t>> rows;
+        // the longest row
+        size_t seq_length = 1;
+        size_t max_texts_per_row = 1;
+        size_t bucket = 0;
+    };
+
+    struct RunningBatch {
+        size_t bucket;
+        int request_index;
+        size_t batch;
+    };
 
-    void start_embed_async(std::vector<std::string>& texts) {
-        const auto encoded = m_tokenizer.encode(texts, m_tokenization_params);
+    // state of a call, the calls are independent, so the threads embed the texts concurrently
+    struct EmbedCall {
+        size_t num_texts = 0;
+        // tokens of the texts or their windows
+        std::vector<std::vector<int64_t>> tokens;
+        // text of each window and its weight in the pooling, empty unless 'window_length' is set
+        std::vector<size_t> window_texts;
+        std::vector<float> window_weights;
+        bool pool_windows = true;
+        std::vector<Batch> batches;
+        size_t next_batch = 0;
+        // the requests taken from the pools in the order they are started and their batches
+        std::deque<RunningBatch> running;
+        EmbeddingResults embeddings;
+        // rows of the streaming call, which the embeddings are written to instead of 'embeddings'
+        ov::Tensor output;
+        size_t output_offset = 0;
+    };
 
-        m_request.set_tensor("input_ids", encoded.input_ids);
-        m_request.set_tensor("attention_mask", encoded.attention_mask);
+    // the call of the async methods, only one of them can be active
+    std::optional<EmbedCall> m_async_call;
+
+    EmbedCall start_embed(std::vector<std::string>& texts,
+                          const ov::Tensor& output = {},
+                          size_t output_offset = 0,
+                          bool pool_windows = true) {
+        EmbedCall call;
+        call.num_texts = texts.size();
+        call.tokens = tokenize(texts);
+        if (m_config.window_length) {
+            call.tokens = split_into_windows(call, call.tokens);
+        }
+        call.pool_windows = pool_windows;
+        call.batches = m_config.pack_sequences ? split_into_packed_batches(call.tokens) : split_into_batches(call.tokens);
+        for (Batch& batch : call.batches) {
+            batch.bucket = select_bucket(batch);
+        }
+        // the window embeddings are pooled before they are written to the output
+        call.embeddings = make_embedding_results(output && call.window_texts.empty() ? 0 : call.tokens.size());
+        call.output = output;
+        call.output_offset = output_offset;
+        try {
+            start_batches(call);
+        } catch (...) {
+            release(call);
+            throw;
+        }
+        return call;
+    }
 
-        // fill token_type_ids
-        // todo: pass token_type_ids from tokenizer
-        for (auto& input : m_request.get_compiled_model().inputs()) {
-            if (input.get_any_name() == "token_type_ids") {
-                ov::Tensor token_type_ids{ov::element::i64, encoded.input_ids.get_shape()};
-                std::fill_n(token_type_ids.data<int64_t>(), encoded.input_ids.get_size(), 0);
-                m_request.set_tensor("token_type_ids", token_type_ids);
+    EmbeddingResults wait_embed(EmbedCall& call) {
+        try {
+            while (!call.running.empty()) {
+                const RunningBatch running = call.running.front();
+                CircularBufferQueue<ov::InferRequest>& requests = *m_buckets[running.bucket].requests;
+                InferRequest& request = requests.get(running.request_index);
+                request.wait();
+                collect_batch(call, request, call.batches[running.batch]);
+                call.running.pop_front();
+                requests.return_to(running.request_index);
+                start_batches(call);
+            }
+        } catch (...) {
+            release(call);
+            throw;
+        }
+
+        if (!call.window_texts.empty() && call.pool_windows) {
+            std::vector<std::vector<float>> pooled = pool_windows(call);
+            if (call.output) {
+                for (size_t text = 0; text < pooled.size(); ++text) {
+                    std::copy(pooled[text].begin(),
+                              pooled[text].end(),
+                              call.output.data<float>() + (call.output_offset + text) * pooled[text].size());
+                }
+            }
+            call.embeddings = std::move(pooled);
+        }
+        return std::move(call.embeddings);
+    }
+
+    // finds the special tokens, which the tokenizer adds before and after a text, by the tokens of an empty text and
+    // a probe text
+    void init_window_special_tokens() {
+        const std::vector<std::vector<int64_t>> tokens = tokenize({"", "a"});
+        const std::vector<int64_t>& empty = tokens[0];
+        const std::vector<int64_t>& probe = tokens[1];
+        size_t prefix_length = 0;
+        while (prefix_length < empty.size() && prefix_length < probe.size() && empty[prefix_length] == probe[prefix_length]) {
+            ++prefix_length;
+        }
+        m_window_prefix.assign(empty.begin(), empty.begin() + prefix_length);
+        m_window_suffix.assign(empty.begin() + prefix_length, empty.end());
+    }
+
+    // splits the tokens of the texts longer than 'window_length' into the windows, the consecutive windows share
+    // 'window_overlap' tokens. The weight of a window is the number of its tokens, which aren't in the previous window
+    std::vector<std::vector<int64_t>> split_into_windows(EmbedCall& call, const std::vector<std::vector<int64_t>>& tokens) const {
+        const size_t window_length = *m_config.window_length;
+        const size_t prefix_length = m_window_prefix.size(), suffix_length = m_window_suffix.size();
+        const size_t content_length = window_length - prefix_length - suffix_length;
+
+        std::vector<std::vector<int64_t>> windows;
+        for (size_t text = 0; text < tokens.size(); ++text) {
+            const std::vector<int64_t>& text_tokens = tokens[text];
+            if (text_tokens.size() <= window_length) {
+                windows.push_back(text_tokens);
+                call.window_texts.push_back(text);
+                call.window_weights.push_back(1.0f);
+                continue;
+            }
+
+            const auto content = text_tokens.begin() + prefix_length;
+            const size_t text_length = text_tokens.size() - prefix_length - suffix_length;
+            for (size_t begin = 0, covered = 0; covered < text_length; begin += content_length - m_config.window_overlap) {
+                const size_t end = std::min(begin + content_length, text_length);
+                std::vector<int64_t>& window = windows.emplace_back(m_window_prefix);
+                window.insert(window.end(), content + begin, content + end);
+                window.insert(window.end(), m_window_suffix.begin(), m_window_suffix.end());
+                call.window_texts.push_back(text);
+                call.window_weights.push_back(static_cast<float>(end - covered));
+                covered = end;
+            }
+        }
+        return windows;
+    }
+
+    // pools the window embeddings of each text by the weighted mean, which is normalized if the normalization is enabled
+    std::vector<std::vector<float>> pool_windows(const EmbedCall& call) const {
+        const auto& windows = std::get<std::vector<std::vector<float>>>(call.embeddings);
+        std::vector<std::vector<float>> pooled(call.num_texts);
+        std::vector<float> total_weights(call.num_texts, 0.0f);
+        for (size_t window = 0; window < windows.size(); ++window) {
+            std::vector<float>& embedding = pooled[call.window_texts[window]];
+            embedding.resize(windows[window].size(), 0.0f);
+            const float weight = call.window_weights[window];
+            for (size_t i = 0; i < embedding.size(); ++i) {
+                embedding[i] += weight * windows[window][i];
+            }
+            total_weights[call.window_texts[window]] += weight;
+        }
+
+        for (size_t text = 0; text < pooled.size(); ++text) {
+            std::vector<float>& embedding = pooled[text];
+            float scale = 1.0f / total_weights[text];
+            if (m_config.normalize) {
+                const float norm = std::sqrt(std::inner_product(embedding.begin(), embedding.end(), embedding.begin(), 0.0f));
+                scale = 1.0f / std::max(norm, 1e-12f);
+            }
+            for (float& value : embedding) {
+                value *= scale;
+            }
+        }
+        return pooled;
+    }
+
+    void start_async_call(std::vector<std::string>& texts) {
+        if (m_async_call) {
+            release(*m_async_call);
+            m_async_call.reset();
+        }
+        m_async_call = start_embed(texts);
+    }
+
+    EmbeddingResults wait_async_call() {
+        OPENVINO_ASSERT(m_async_call, "Embedding is not started, call start_embed_documents_async() or start_embed_query_async() first");
+        EmbedCall call = std::move(*m_async_call);
+        m_async_call.reset();
+        return wait_embed(call);
+    }
+
+    // starts the next batches of the call on the idle requests of their buckets. The call waits for an idle request
+    // only if it runs none, so the calls, which wait for each other's requests, don't deadlock
+    void start_batches(EmbedCall& call) {
+        while (call.next_batch < call.batches.size()) {
+            const Batch& batch = call.batches[call.next_batch];
+            CircularBufferQueue<ov::InferRequest>& requests = *m_buckets[batch.bucket].requests;
+            const int request_index = call.running.empty() ? requests.get_idle().get() : requests.try_get_idle();
+            if (request_index < 0) {
                 break;
             }
+            call.running.push_back({batch.bucket, request_index, call.next_batch++});
+            start_batch(call, requests.get(request_index), m_buckets[batch.bucket], batch);
         }
+    }
 
-        m_request.start_async();
-    };
+    // waits for the running batches of the failed call and returns their requests to the pools
+    void release(EmbedCall& call) {
+        for (const RunningBatch& running : call.running) {
+            CircularBufferQueue<ov::InferRequest>& requests = *m_buckets[running.bucket].requests;
+            try {
+                requests.get(running.request_index).wait();
+            } catch (...) {
+                // the error of the call is already propagated
+            }
+            requests.return_to(running.request_index);
+        }
+        call.running.clear();
+    }
 
-    EmbeddingResults wait_embed() {
-        m_request.wait();
+    void add_bucket(const ov::CompiledModel& compiled_model, size_t batch_size, size_t seq_length) {
+        const size_t num_requests = std::max<uint32_t>(compiled_model.get_property(ov::optimal_number_of_infer_requests), 1);
+        auto requests = std::make_unique<CircularBufferQueue<ov::InferRequest>>(num_requests, [&compiled_model]() {
+            return compiled_model.create_infer_request();
+        });
+        m_buckets.push_back({batch_size, seq_length, compiled_model, std::move(requests)});
+    }
 
-        // [batch_size, hidden_size]
-        const Tensor last_hidden_state = m_request.get_tensor("last_hidden_state");
+    // NPU runs the static shapes only, so the model is compiled for each shape of "BATCH_BUCKETS" x "SEQ_LEN_BUCKETS"
+    // grid and a batch is padded to the cheapest shape, which fits it. "BLOB_CACHE_DIR" caches the compiled blobs
+    void compile_buckets_for_npu(const std::shared_ptr<ov::Model>& model, ov::AnyMap& properties) {
+        OPENVINO_ASSERT(!m_config.pack_sequences, "Sequence packing is not supported on NPU");
+        std::vector<uint32_t> batch_sizes = utils::pop_buckets(properties, "BATCH_BUCKETS");
+        std::vector<uint32_t> seq_lengths = utils::pop_buckets(properties, "SEQ_LEN_BUCKETS");
+        if (batch_sizes.empty()) {
+            batch_sizes = {1};
+        }
+        if (seq_lengths.empty()) {
+            seq_lengths = {static_cast<uint32_t>(m_config.window_length.value_or(m_config.max_length.value_or(512)))};
+        }
 
-        return to_embedding_result(last_hidden_state);
-    };
+        std::vector<std::pair<size_t, size_t>> shapes;
+        for (uint32_t seq_length : seq_lengths) {
+            for (uint32_t batch_size : batch_sizes) {
+                shapes.emplace_back(batch_size, seq_length);
+            }
+        }
+        std::stable_sort(shapes.begin(), shapes.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first * lhs.second < rhs.first * rhs.second;
+        });
+
+        // NB: The buckets are compiled in parallel, as compilation of each of them takes a while
+        std::vector<std::future<ov::CompiledModel>> compilations;
+        for (const auto& [batch_size, seq_length] : shapes) {
+            auto bucket_model = model->clone();
+            std::map<std::string, ov::PartialShape> input_shapes;
+            for (const auto& input : bucket_model->inputs()) {
+                input_shapes.emplace(input.get_any_name(), ov::PartialShape{int64_t(batch_size), int64_t(seq_length)});
+            }
+            bucket_model->reshape(input_shapes);
+            compilations.push_back(std::async(std::launch::async, [bucket_model, properties]() {
+                return utils::compile_model_for_npu(bucket_model, properties);
+            }));
+        }
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            add_bucket(compilations[i].get(), shapes[i].first, shapes[i].second);
+        }
+        utils::print_compiled_model_properties(m_buckets.front().compiled_model, "text embedding model");
+        m_max_batch_size = batch_sizes.back();
+    }
+
+    // the cheapest bucket, which fits the batch
+    size_t select_bucket(const Batch& batch) const {
+        for (size_t i = 0; i < m_buckets.size(); ++i) {
+            const Bucket& bucket = m_buckets[i];
+            if (bucket.batch_size == 0 || (batch.rows.size() <= bucket.batch_size && batch.seq_length <= bucket.seq_length)) {
+                return i;
+            }
+        }
+        OPENVINO_THROW("Batch of ", batch.rows.size(), " texts of ", batch.seq_length, " tokens doesn't fit the compiled shapes");
+    }
+
+    // tokenizes the texts by chunks, so the padded output of the tokenizer stays small, and returns the tokens of each
+    // text without the padding
+    std::vector<std::vector<int64_t>> tokenize(const std::vector<std::string>& texts) {
+        const size_t chunk_size = 256;
+
+        std::vector<std::vector<int64_t>> tokens;
+        tokens.reserve(texts.size());
+        for (size_t begin = 0; begin < texts.size(); begin += chunk_size) {
+            const std::vector<std::string> chunk(texts.begin() + begin, texts.begin() + std::min(begin + chunk_size, texts.size()));
+            const auto encoded = m_tokenizer.encode(chunk, m_tokenization_params);
+
+            const size_t seq_length = encoded.input_ids.get_shape()[1];
+            const int64_t* input_ids = encoded.input_ids.data<const int64_t>();
+            const int64_t* attention_mask = encoded.attention_mask.data<const int64_t>();
+            for (size_t row = 0; row < chunk.size(); ++row) {
+                std::vector<int64_t>& text_tokens = tokens.emplace_back();
+                for (size_t i = row * seq_length; i < (row + 1) * seq_length; ++i) {
+                    if (attention_mask[i]) {
+                        text_tokens.push_back(input_ids[i]);
+                    }
+                }
+            }
+        }
+        return tokens;
+    }
+
+    // returns the indices of the texts from the longest to the shortest one
+    static std::vector<size_t> sort_by_length(const std::vector<std::vector<int64_t>>& tokens) {
+        std::vector<size_t> order(tokens.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&tokens](size_t lhs, size_t rhs) {
+            return tokens[lhs].size() > tokens[rhs].size();
+        });
+        return order;
+    }
+
+    // sorts the texts by length, so a batch is padded to a similar length, and splits them into the batches, which
+    // don't exceed 'max_batch_tokens' with the padding. A text longer than 'max_batch_tokens' has its own batch
+    std::vector<Batch> split_into_batches(const std::vector<std::vector<int64_t>>& tokens) {
+        std::vector<Batch> batches;
+        for (size_t index : sort_by_length(tokens)) {
+            if (!batches.empty()) {
+                const size_t padded_length = batches.back().seq_length;
+                const size_t batch_size = batches.back().rows.size() + 1;
+                if ((!m_config.max_batch_tokens || batch_size * padded_length <= *m_config.max_batch_tokens) &&
+                    (!m_max_batch_size || batch_size <= *m_max_batch_size)) {
+                    batches.back().rows.push_back({index});
+                    continue;
+                }
+            }
+            batches.push_back({{{index}}, std::max<size_t>(tokens[index].size(), 1), 1});
+        }
+        return batches;
+    }
+
+    // packs the texts into the rows of the longest text length by best fit decreasing, so the rows are nearly full, and
+    // splits the rows into the batches, which don't exceed 'max_batch_tokens' with the padding
+    std::vector<Batch> split_into_packed_batches(const std::vector<std::vector<int64_t>>& tokens) {
+        const std::vector<size_t> order = sort_by_length(tokens);
+        const size_t row_length = order.empty() ? 1 : std::max<size_t>(tokens[order.front()].size(), 1);
+
+        std::vector<std::vector<size_t>> rows;
+        std::vector<size_t> row_lengths;
+        // free space of the rows -> row index
+        std::multimap<size_t, size_t> free_space;
+        for (size_t index : order) {
+            const size_t length = tokens[index].size();
+            auto it = free_space.lower_bound(length);
+            size_t row = rows.size();
+            if (it != free_space.end()) {
+                row = it->second;
+                free_space.erase(it);
+            } else {
+                rows.emplace_back();
+                row_lengths.push_back(0);
+            }
+            rows[row].push_back(index);
+            row_lengths[row] += length;
+            free_space.emplace(row_length - row_lengths[row], row);
+        }
+
+        std::vector<Batch> batches;
+        for (size_t row = 0; row < rows.size(); ++row) {
+            if (batches.empty() ||
+                (m_config.max_batch_tokens && (batches.back().rows.size() + 1) * row_length > *m_config.max_batch_tokens)) {
+                batches.emplace_back();
+            }
+            Batch& batch = batches.back();
+            batch.seq_length = std::max(batch.seq_length, row_lengths[row]);
+            batch.max_texts_per_row = std::max(batch.max_texts_per_row, rows[row].size());
+            batch.rows.push_back(std::move(rows[row]));
+        }
+        return batches;
+    }
+
+    void start_batch(const EmbedCall& call, InferRequest& request, const Bucket& bucket, const Batch& batch) {
+        // the batch is padded to the shape of a static bucket with the masked out rows and tokens
+        const size_t batch_size = bucket.batch_size ? bucket.batch_size : batch.rows.size();
+        const size_t seq_length = bucket.seq_length ? bucket.seq_length : batch.seq_length;
+        const int64_t pad_token_id = std::max<int64_t>(m_tokenizer.get_pad_token_id(), 0);
+
+        // the texts are padded on the right, the padding is masked out by the pooling
+        ov::Tensor input_ids{ov::element::i64, {batch_size, seq_length}};
+        ov::Tensor attention_mask{ov::element::i64, {batch_size, seq_length}};
+        std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), pad_token_id);
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 0);
+        for (size_t row = 0; row < batch.rows.size(); ++row) {
+            size_t offset = row * seq_length;
+            for (size_t index : batch.rows[row]) {
+                const std::vector<int64_t>& text_tokens = call.tokens[index];
+                std::copy(text_tokens.begin(), text_tokens.end(), input_ids.data<int64_t>() + offset);
+                std::fill_n(attention_mask.data<int64_t>() + offset, text_tokens.size(), 1);
+                offset += text_tokens.size();
+            }
+        }
+
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("attention_mask", attention_mask);
+        if (m_config.pack_sequences) {
+            set_packing_tensors(call, request, batch);
+        }
+
+        // fill token_type_ids
+        // todo: pass token_type_ids from tokenizer
+        if (m_has_token_type_ids) {
+            ov::Tensor token_type_ids{ov::element::i64, input_ids.get_shape()};
+            std::fill_n(token_type_ids.data<int64_t>(), token_type_ids.get_size(), 0);
+            request.set_tensor("token_type_ids", token_type_ids);
+        }
+
+        request.start_async();
+    }
+
+    // sets the segments, the positions and the pooling weights of the texts of each row
+    void set_packing_tensors(const EmbedCall& call, InferRequest& request, const Batch& batch) {
+        const size_t batch_size = batch.rows.size(), seq_length = batch.seq_length;
+
+        // the padding tokens have segment 0 and position 0
+        ov::Tensor segment_ids{ov::element::i64, {batch_size, seq_length}};
+        ov::Tensor position_ids{ov::element::i64, {batch_size, seq_length}};
+        ov::Tensor pooling_weights{ov::element::f32, {batch_size, batch.max_texts_per_row, seq_length}};
+        std::fill_n(segment_ids.data<int64_t>(), segment_ids.get_size(), 0);
+        std::fill_n(position_ids.data<int64_t>(), position_ids.get_size(), 0);
+        std::fill_n(pooling_weights.data<float>(), pooling_weights.get_size(), 0.0f);
+
+        for (size_t row = 0; row < batch_size; ++row) {
+            size_t position = 0;
+            for (size_t text = 0; text < batch.rows[row].size(); ++text) {
+                const size_t length = call.tokens[batch.rows[row][text]].size();
+                const size_t offset = row * seq_length + position;
+                std::fill_n(segment_ids.data<int64_t>() + offset, length, static_cast<int64_t>(text + 1));
+                std::iota(position_ids.data<int64_t>() + offset, position_ids.data<int64_t>() + offset + length, 0);
+
+                float* weights =
+                    pooling_weights.data<float>() + (row * batch.max_texts_per_row + text) * seq_length + position;
+                if (length == 0) {
+                    // nothing to pool, the embedding is zeros like the mean pooling of an empty text
+                } else if (m_config.pooling_type == TextEmbeddingPipeline::PoolingType::CLS) {
+                    weights[0] = 1.0f;
+                } else if (m_config.pooling_type == TextEmbeddingPipeline::PoolingType::MEAN) {
+                    std::fill_n(weights, length, 1.0f / length);
+                } else {
+                    OPENVINO_THROW("Pooling type is not supported");
+                }
+                position += length;
+            }
+        }
+
+        request.set_tensor("segment_ids", segment_ids);
+        request.set_tensor("position_ids", position_ids);
+        request.set_tensor("pooling_weights", pooling_weights);
+    }
+
+    EmbeddingResults make_embedding_results(size_t size) const {
+        if (m_output_type == ov::element::i8) {
+            return std::vector<std::vector<int8_t>>(size);
+        } else if (m_output_type == ov::element::u8) {
+            return std::vector<std::vector<uint8_t>>(size);
+        }
+        return std::vector<std::vector<float>>(size);
+    }
+
+    // copies the embeddings of a finished batch to the positions of its texts
+    void collect_batch(EmbedCall& call, InferRequest& request, const Batch& batch) {
+        // [batch_size * max_texts_per_row, embedding_size]
+        const Tensor last_hidden_state = request.get_tensor("last_hidden_state");
+        const size_t hidden_size = last_hidden_state.get_shape()[1];
+
+        const ov::Tensor& output = call.output;
+        OPENVINO_ASSERT(!output || output.get_shape()[1] == hidden_size,
+                        "Embeddings tensor has ",
+                        output ? output.get_shape()[1] : 0,
+                        " columns, while the embedding size is ",
+                        hidden_size);
+
+        std::visit(
+            [&](auto& embeddings) {
+                using T = typename std::decay_t<decltype(embeddings)>::value_type::value_type;
+                const T* last_hidden_state_data = last_hidden_state.data<const T>();
+                for (size_t row = 0; row < batch.rows.size(); ++row) {
+                    for (size_t text = 0; text < batch.rows[row].size(); ++text) {
+                        const size_t index = batch.rows[row][text];
+                        const T* text_data =
+                            last_hidden_state_data + (row * batch.max_texts_per_row + text) * hidden_size;
+                        if (output && call.window_texts.empty()) {
+                            std::copy_n(text_data, hidden_size, output.data<T>() + (call.output_offset + index) * hidden_size);
+                        } else {
+                            embeddings[index].assign(text_data, text_data + hidden_size);
+                        }
+                    }
+                }
+            },
+            call.embeddings);
+    }
 
     std::vector<std::string> format_texts(const std::vector<std::string>& texts) {
         if (!m_config.embed_instruction) {
@@ -227,25 +1030,6 @@ private:
 
         return *m_config.query_instruction + text;
     }
-
-    EmbeddingResults to_embedding_result(const Tensor& last_hidden_state) {
-        const auto last_hidden_state_data = last_hidden_state.data<float>();
-
-        std::vector<std::vector<float>> result;
-        const auto shape = last_hidden_state.get_shape();
-
-        const size_t batch_size = shape[0];
-        const size_t hidden_size = shape[1];
-
-        for (size_t batch = 0; batch < batch_size; batch++) {
-            const auto batch_offset = batch * hidden_size;
-            const auto batch_data = last_hidden_state_data + batch_offset;
-            const std::vector<float> batch_result(batch_data, batch_data + hidden_size);
-            result.push_back(batch_result);
-        }
-
-        return result;
-    }
 };
 
 TextEmbeddingPipeline::TextEmbeddingPipeline(const std::filesystem::path& models_path,
@@ -267,6 +1051,16 @@ EmbeddingResults TextEmbeddingPipeline::embed_documents(const std::vector<std::s
     return m_impl->embed_documents(texts);
 }
 
+size_t TextEmbeddingPipeline::embed_documents(const std::function<std::optional<std::string>()>& next_document,
+                                              ov::Tensor& embeddings,
+                                              size_t chunk_size) {
+    return m_impl->embed_documents(next_document, embeddings, chunk_size);
+}
+
+TextEmbeddingPipeline::DocumentWindows TextEmbeddingPipeline::embed_document_windows(const std::vector<std::string>& texts) {
+    return m_impl->embed_document_windows(texts);
+}
+
 void TextEmbeddingPipeline::start_embed_documents_async(const std::vector<std::string>& texts) {
     return m_impl->start_embed_documents_async(texts);
 }
@@ -3,11 +3,21 @@
 
 #include "openvino/genai/rag/text_rerank_pipeline.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+
 #include "openvino/core/except.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/opsets/opset.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "circular_buffer_queue.hpp"
 #include "utils.hpp"
 
 namespace {
@@ -19,6 +29,8 @@ ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
 
     properties_copy.erase(top_n.name());
     properties_copy.erase(max_length.name());
+    properties_copy.erase(max_batch_tokens.name());
+    properties_copy.erase(score_cache_size.name());
 
     return properties_copy;
 }
@@ -59,6 +71,8 @@ using utils::read_anymap_param;
 TextRerankPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::top_n.name(), top_n);
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
+    read_anymap_param(properties, ov::genai::score_cache_size.name(), score_cache_size);
 };
 
 class TextRerankPipeline::TextRerankPipelineImpl {
@@ -79,45 +93,152 @@ public:
             m_tokenization_params.insert({max_length.name(), *m_config.max_length});
         }
 
-        ov::CompiledModel compiled_model = core.compile_model(model, device, properties);
+        // the requests of the pool run in parallel on the streams of the device, which are created by the throughput hint
+        ov::AnyMap compile_properties = properties;
+        compile_properties.insert({ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT});
+        ov::CompiledModel compiled_model = core.compile_model(model, device, compile_properties);
 
         utils::print_compiled_model_properties(compiled_model, "text rerank model");
-        m_request = compiled_model.create_infer_request();
+
+        // the batches of a call are distributed among the idle requests, the calls of different threads share the pool
+        const size_t num_requests = std::max<uint32_t>(compiled_model.get_property(ov::optimal_number_of_infer_requests), 1);
+        m_requests = std::make_unique<CircularBufferQueue<ov::InferRequest>>(num_requests, [&compiled_model]() {
+            return compiled_model.create_infer_request();
+        });
+        for (auto& input : compiled_model.inputs()) {
+            if (input.get_any_name() == "token_type_ids") {
+                m_has_token_type_ids = true;
+            }
+        }
     };
 
+    ~TextRerankPipelineImpl() {
+        if (m_async_call) {
+            release(*m_async_call);
+        }
+    }
+
     std::vector<std::pair<size_t, float>> rerank(const std::string& query, const std::vector<std::string>& texts) {
-        start_rerank_async(query, texts);
-        return wait_rerank();
+        RerankCall call = start_rerank(query, texts);
+        return wait_rerank(call);
     }
 
     void start_rerank_async(const std::string& query, const std::vector<std::string>& texts) {
-        const auto encoded = m_tokenizer.encode({query}, texts, m_tokenization_params);
+        if (m_async_call) {
+            release(*m_async_call);
+            m_async_call.reset();
+        }
+        m_async_call = start_rerank(query, texts);
+    }
 
-        m_request.set_tensor("input_ids", encoded.input_ids);
-        m_request.set_tensor("attention_mask", encoded.attention_mask);
+    std::vector<std::pair<size_t, float>> wait_rerank() {
+        OPENVINO_ASSERT(m_async_call, "Reranking is not started, call start_rerank_async() first");
+        RerankCall call = std::move(*m_async_call);
+        m_async_call.reset();
+        return wait_rerank(call);
+    }
+
+    void set_prefilter(std::shared_ptr<TextEmbeddingPipeline> embedding_pipeline, size_t num_candidates) {
+        OPENVINO_ASSERT(!embedding_pipeline || num_candidates > 0, "Number of candidates must be positive");
+        m_prefilter = std::move(embedding_pipeline);
+        m_num_candidates = num_candidates;
+    }
+
+private:
+    struct Pair {
+        // index of the text in the call
+        size_t index;
+        size_t hash;
+        // tokens of the pair without the padding
+        std::vector<int64_t> input_ids, token_type_ids;
+    };
 
-        if (encoded.token_type_ids.has_value()) {
-            m_request.set_tensor("token_type_ids", *encoded.token_type_ids);
+    Tokenizer m_tokenizer;
+    std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_requests;
+    Config m_config;
+    AnyMap m_tokenization_params;
+    bool m_has_token_type_ids = false;
+
+    std::shared_ptr<TextEmbeddingPipeline> m_prefilter;
+    size_t m_num_candidates = 0;
+
+    // the most recently used scores are at the front, the cache is shared by the calls of different threads
+    std::mutex m_cache_mutex;
+    std::list<std::pair<size_t, float>> m_cached_scores;
+    std::unordered_map<size_t, std::list<std::pair<size_t, float>>::iterator> m_cache_index;
+
+    // state of a call, the calls are independent, so the threads rerank the texts concurrently
+    struct RerankCall {
+        std::vector<float> scores;
+        std::vector<bool> is_candidate;
+        // the pairs scored by the rerank model
+        std::vector<Pair> pairs;
+        // indices of the pairs of each batch, the longest pair is the first one
+        std::vector<std::vector<size_t>> batches;
+        size_t next_batch = 0;
+        // the requests taken from the pool in the order they are started and their batches
+        std::deque<std::pair<int, size_t>> running;
+    };
+
+    // the call of the async methods, only one of them can be active
+    std::optional<RerankCall> m_async_call;
+
+    RerankCall start_rerank(const std::string& query, const std::vector<std::string>& texts) {
+        RerankCall call;
+        call.scores.assign(texts.size(), 0.0f);
+        const size_t query_hash = std::hash<std::string>{}(query);
+
+        // the scored texts, the pruned and the cached ones aren't passed to the rerank model
+        std::vector<size_t> candidates = prefilter(query, texts);
+        call.is_candidate.assign(texts.size(), false);
+        std::vector<std::string> uncached_texts;
+        for (size_t index : candidates) {
+            call.is_candidate[index] = true;
+            const size_t hash = hash_pair(query_hash, texts[index]);
+            if (!get_cached_score(hash, call.scores[index])) {
+                call.pairs.push_back({index, hash, {}, {}});
+                uncached_texts.push_back(texts[index]);
+            }
         }
 
-        m_request.start_async();
+        tokenize(call, query, uncached_texts);
+        call.batches = split_into_batches(call.pairs);
+        try {
+            start_batches(call);
+        } catch (...) {
+            release(call);
+            throw;
+        }
+        return call;
     }
 
-    std::vector<std::pair<size_t, float>> wait_rerank() {
-        m_request.wait();
-
-        // postprocessing applied to output, it's the scores tensor
-        auto scores_tensor = m_request.get_tensor("logits");
-        auto scores_tensor_shape = scores_tensor.get_shape();
-        const size_t batch_size = scores_tensor_shape[0];
+    std::vector<std::pair<size_t, float>> wait_rerank(RerankCall& call) {
+        try {
+            while (!call.running.empty()) {
+                const auto [request_index, batch_index] = call.running.front();
+                InferRequest& request = m_requests->get(request_index);
+                request.wait();
+                collect_batch(call, request, call.batches[batch_index]);
+                call.running.pop_front();
+                m_requests->return_to(request_index);
+                start_batches(call);
+            }
+        } catch (...) {
+            release(call);
+            throw;
+        }
 
-        auto scores_data = scores_tensor.data<float>();
+        for (const Pair& pair : call.pairs) {
+            put_cached_score(pair.hash, call.scores[pair.index]);
+        }
 
         std::vector<std::pair<size_t, float>> results;
-        results.reserve(batch_size);
+        results.reserve(call.scores.size());
 
-        for (size_t batch = 0; batch < batch_size; batch++) {
-            results.emplace_back(batch, scores_data[batch]);
+        for (size_t index = 0; index < call.scores.size(); index++) {
+            if (call.is_candidate[index]) {
+                results.emplace_back(index, call.scores[index]);
+            }
         }
 
         const size_t top_n = m_config.top_n;
@@ -137,11 +258,184 @@ public:
         return results;
     }
 
-private:
-    Tokenizer m_tokenizer;
-    InferRequest m_request;
-    Config m_config;
-    AnyMap m_tokenization_params;
+    // starts the next batches of the call on the idle requests of the pool. The call waits for an idle request only if
+    // it runs none, so the calls, which wait for each other's requests, don't deadlock
+    void start_batches(RerankCall& call) {
+        while (call.next_batch < call.batches.size()) {
+            const int request_index = call.running.empty() ? m_requests->get_idle().get() : m_requests->try_get_idle();
+            if (request_index < 0) {
+                break;
+            }
+            call.running.emplace_back(request_index, call.next_batch);
+            start_batch(call, m_requests->get(request_index), call.batches[call.next_batch++]);
+        }
+    }
+
+    // waits for the running batches of the failed call and returns their requests to the pool
+    void release(RerankCall& call) {
+        for (const auto& [request_index, batch_index] : call.running) {
+            try {
+                m_requests->get(request_index).wait();
+            } catch (...) {
+                // the error of the call is already propagated
+            }
+            m_requests->return_to(request_index);
+        }
+        call.running.clear();
+    }
+
+    static size_t hash_pair(size_t query_hash, const std::string& text) {
+        const size_t text_hash = std::hash<std::string>{}(text);
+        return query_hash ^ (text_hash + 0x9e3779b97f4a7c15 + (query_hash << 6) + (query_hash >> 2));
+    }
+
+    bool get_cached_score(size_t hash, float& score) {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        auto it = m_cache_index.find(hash);
+        if (it == m_cache_index.end()) {
+            return false;
+        }
+        m_cached_scores.splice(m_cached_scores.begin(), m_cached_scores, it->second);
+        score = it->second->second;
+        return true;
+    }
+
+    void put_cached_score(size_t hash, float score) {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        if (m_config.score_cache_size == 0 || m_cache_index.count(hash)) {
+            return;
+        }
+        m_cached_scores.emplace_front(hash, score);
+        m_cache_index[hash] = m_cached_scores.begin();
+        if (m_cached_scores.size() > m_config.score_cache_size) {
+            m_cache_index.erase(m_cached_scores.back().first);
+            m_cached_scores.pop_back();
+        }
+    }
+
+    // returns the indices of the texts passed to the rerank model, which are the most similar texts to the query by
+    // the embeddings of the prefilter pipeline
+    std::vector<size_t> prefilter(const std::string& query, const std::vector<std::string>& texts) {
+        std::vector<size_t> candidates(texts.size());
+        std::iota(candidates.begin(), candidates.end(), 0);
+        if (!m_prefilter || texts.size() <= m_num_candidates) {
+            return candidates;
+        }
+
+        const EmbeddingResult query_result = m_prefilter->embed_query(query);
+        const EmbeddingResults text_results = m_prefilter->embed_documents(texts);
+        auto query_embedding = std::get_if<std::vector<float>>(&query_result);
+        auto text_embeddings = std::get_if<std::vector<std::vector<float>>>(&text_results);
+        OPENVINO_ASSERT(query_embedding && text_embeddings, "Prefilter pipeline must return f32 embeddings");
+
+        auto norm = [](const std::vector<float>& embedding) {
+            return std::sqrt(std::inner_product(embedding.begin(), embedding.end(), embedding.begin(), 0.0f));
+        };
+        const float query_norm = norm(*query_embedding);
+        std::vector<float> similarities(texts.size());
+        for (size_t i = 0; i < texts.size(); ++i) {
+            const std::vector<float>& text_embedding = (*text_embeddings)[i];
+            OPENVINO_ASSERT(text_embedding.size() == query_embedding->size(), "Embedding sizes of query and text differ");
+            const float dot = std::inner_product(text_embedding.begin(), text_embedding.end(), query_embedding->begin(), 0.0f);
+            similarities[i] = dot / std::max(query_norm * norm(text_embedding), 1e-12f);
+        }
+
+        std::partial_sort(candidates.begin(),
+                          candidates.begin() + m_num_candidates,
+                          candidates.end(),
+                          [&similarities](size_t lhs, size_t rhs) {
+                              return similarities[lhs] > similarities[rhs];
+                          });
+        candidates.resize(m_num_candidates);
+        return candidates;
+    }
+
+    // tokenizes the pairs of the query and the texts by chunks, so the padded output of the tokenizer stays small, and
+    // stores the tokens of each pair without the padding
+    void tokenize(RerankCall& call, const std::string& query, const std::vector<std::string>& texts) {
+        const size_t chunk_size = 256;
+
+        for (size_t begin = 0; begin < texts.size(); begin += chunk_size) {
+            const std::vector<std::string> chunk(texts.begin() + begin, texts.begin() + std::min(begin + chunk_size, texts.size()));
+            const auto encoded = m_tokenizer.encode({query}, chunk, m_tokenization_params);
+
+            const size_t seq_length = encoded.input_ids.get_shape()[1];
+            const int64_t* input_ids = encoded.input_ids.data<const int64_t>();
+            const int64_t* attention_mask = encoded.attention_mask.data<const int64_t>();
+            const int64_t* token_type_ids =
+                encoded.token_type_ids.has_value() ? encoded.token_type_ids->data<const int64_t>() : nullptr;
+            for (size_t row = 0; row < chunk.size(); ++row) {
+                Pair& pair = call.pairs[begin + row];
+                for (size_t i = row * seq_length; i < (row + 1) * seq_length; ++i) {
+                    if (attention_mask[i]) {
+                        pair.input_ids.push_back(input_ids[i]);
+                        pair.token_type_ids.push_back(token_type_ids ? token_type_ids[i] : 0);
+                    }
+                }
+            }
+        }
+    }
+
+    // sorts the pairs by length, so a batch is padded to a similar length, and splits them into the batches, which
+    // don't exceed 'max_batch_tokens' with the padding. A pair longer than 'max_batch_tokens' has its own batch
+    std::vector<std::vector<size_t>> split_into_batches(const std::vector<Pair>& pairs) const {
+        std::vector<size_t> order(pairs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&pairs](size_t lhs, size_t rhs) {
+            return pairs[lhs].input_ids.size() > pairs[rhs].input_ids.size();
+        });
+
+        std::vector<std::vector<size_t>> batches;
+        for (size_t index : order) {
+            if (!batches.empty()) {
+                const size_t padded_length = std::max<size_t>(pairs[batches.back().front()].input_ids.size(), 1);
+                if (!m_config.max_batch_tokens || (batches.back().size() + 1) * padded_length <= *m_config.max_batch_tokens) {
+                    batches.back().push_back(index);
+                    continue;
+                }
+            }
+            batches.push_back({index});
+        }
+        return batches;
+    }
+
+    void start_batch(const RerankCall& call, InferRequest& request, const std::vector<size_t>& batch) {
+        const size_t seq_length = std::max<size_t>(call.pairs[batch.front()].input_ids.size(), 1);
+        const int64_t pad_token_id = std::max<int64_t>(m_tokenizer.get_pad_token_id(), 0);
+
+        // the pairs are padded on the right
+        ov::Tensor input_ids{ov::element::i64, {batch.size(), seq_length}};
+        ov::Tensor attention_mask{ov::element::i64, {batch.size(), seq_length}};
+        ov::Tensor token_type_ids{ov::element::i64, {batch.size(), seq_length}};
+        std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), pad_token_id);
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 0);
+        std::fill_n(token_type_ids.data<int64_t>(), token_type_ids.get_size(), 0);
+        for (size_t row = 0; row < batch.size(); ++row) {
+            const Pair& pair = call.pairs[batch[row]];
+            std::copy(pair.input_ids.begin(), pair.input_ids.end(), input_ids.data<int64_t>() + row * seq_length);
+            std::copy(pair.token_type_ids.begin(), pair.token_type_ids.end(), token_type_ids.data<int64_t>() + row * seq_length);
+            std::fill_n(attention_mask.data<int64_t>() + row * seq_length, pair.input_ids.size(), 1);
+        }
+
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("attention_mask", attention_mask);
+        if (m_has_token_type_ids) {
+            request.set_tensor("token_type_ids", token_type_ids);
+        }
+
+        request.start_async();
+    }
+
+    // copies the scores of a finished batch to the positions of its texts
+    void collect_batch(RerankCall& call, InferRequest& request, const std::vector<size_t>& batch) {
+        // postprocessing applied to output, it's the scores tensor
+        const Tensor scores_tensor = request.get_tensor("logits");
+        const float* scores_data = scores_tensor.data<const float>();
+
+        for (size_t row = 0; row < batch.size(); ++row) {
+            call.scores[call.pairs[batch[row]].index] = scores_data[row];
+        }
+    }
 };
 
 TextRerankPipeline::TextRerankPipeline(const std::filesystem::path& models_path,
@@ -171,6 +465,10 @@ std::vector<std::pair<size_t, float>> TextRerankPipeline::wait_rerank() {
     return m_impl->wait_rerank();
 }
 
+void TextRerankPipeline::set_prefilter(std::shared_ptr<TextEmbeddingPipeline> embedding_pipeline, size_t num_candidates) {
+    m_impl->set_prefilter(std::move(embedding_pipeline), num_candidates);
+}
+
 TextRerankPipeline::~TextRerankPipeline() = default;
 
 }  // namespace genai
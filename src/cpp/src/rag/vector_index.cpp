@@ -0,0 +1,613 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/rag/vector_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <queue>
+#include <random>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace {
+
+/**
+ * Distance kernels process the embeddings in fixed-size chunks with independent per-lane accumulators, so that the
+ * compiler is able to vectorize them for whichever instruction set the library is built for without fast-math
+ */
+constexpr size_t LANES = 16;
+
+template <typename T>
+float dot(const float* query, const T* embedding, size_t dimension) {
+    float accumulators[LANES] = {};
+    size_t i = 0;
+    for (; i + LANES <= dimension; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            accumulators[lane] += query[i + lane] * static_cast<float>(embedding[i + lane]);
+        }
+    }
+    for (; i < dimension; ++i) {
+        accumulators[0] += query[i] * static_cast<float>(embedding[i]);
+    }
+
+    float sum = 0.0f;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        sum += accumulators[lane];
+    }
+    return sum;
+}
+
+float squared_l2(const float* query, const float* embedding, size_t dimension) {
+    float accumulators[LANES] = {};
+    size_t i = 0;
+    for (; i + LANES <= dimension; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const float diff = query[i + lane] - embedding[i + lane];
+            accumulators[lane] += diff * diff;
+        }
+    }
+    for (; i < dimension; ++i) {
+        const float diff = query[i] - embedding[i];
+        accumulators[0] += diff * diff;
+    }
+
+    float sum = 0.0f;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        sum += accumulators[lane];
+    }
+    return sum;
+}
+
+std::vector<float> to_floats(const ov::genai::EmbeddingResult& embedding) {
+    return std::visit(
+        [](const auto& values) {
+            return std::vector<float>(values.begin(), values.end());
+        },
+        embedding);
+}
+
+// marks of the visited nodes of a search, the marks are reset by a new tag instead of clearing the whole list
+class VisitedList {
+public:
+    void reset(size_t size) {
+        if (m_marks.size() < size) {
+            m_marks.resize(size, 0);
+        }
+        if (++m_tag == 0) {
+            std::fill(m_marks.begin(), m_marks.end(), 0);
+            m_tag = 1;
+        }
+    }
+
+    // returns false if the node has been visited already
+    bool visit(uint32_t node) {
+        if (m_marks[node] == m_tag) {
+            return false;
+        }
+        m_marks[node] = m_tag;
+        return true;
+    }
+
+private:
+    std::vector<uint32_t> m_marks;
+    uint32_t m_tag = 0;
+};
+
+constexpr char index_magic[8] = {'O', 'V', 'G', 'A', 'I', 'V', 'I', '\0'};
+constexpr uint32_t index_version = 1;
+// the embeddings are aligned in the file, so the memory mapped ones are aligned too
+constexpr size_t embeddings_alignment = 64;
+
+struct IndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t metric;
+    uint32_t storage;
+    uint32_t reserved;
+    uint64_t dimension;
+    uint64_t max_neighbors;
+    uint64_t ef_construction;
+    uint64_t ef_search;
+    uint64_t size;
+    uint64_t entry_point;
+    uint64_t max_level;
+};
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+class VectorIndex::VectorIndexImpl {
+public:
+    VectorIndexImpl(size_t dimension, const Config& config) : m_dimension{dimension}, m_config{config} {
+        OPENVINO_ASSERT(dimension > 0, "Dimension of the vector index must be positive");
+        OPENVINO_ASSERT(config.max_neighbors > 1, "Maximum number of neighbors must be greater than 1");
+        m_level_multiplier = 1.0 / std::log(static_cast<double>(config.max_neighbors));
+    }
+
+    size_t add(const std::vector<float>& embedding) {
+        OPENVINO_ASSERT(embedding.size() == m_dimension,
+                        "Embedding has ",
+                        embedding.size(),
+                        " values, while the dimension of the vector index is ",
+                        m_dimension);
+        OPENVINO_ASSERT(m_size < std::numeric_limits<uint32_t>::max(), "Vector index is full");
+        if (m_mapped) {
+            // the memory mapped embeddings are read only
+            copy_mapped_embeddings();
+        }
+
+        const uint32_t node = static_cast<uint32_t>(m_size);
+        const Query query = make_query(prepare(embedding));
+        store(query.values);
+
+        const size_t level = generate_level();
+        m_levels.push_back(static_cast<uint32_t>(level));
+        m_links0.resize(m_links0.size() + links_size(0), 0);
+        m_upper_links.emplace_back(level * links_size(1), 0);
+        ++m_size;
+
+        if (node == 0) {
+            m_entry_point = node;
+            m_max_level = level;
+            return node;
+        }
+
+        uint32_t entry_point = m_entry_point;
+        for (size_t l = m_max_level; l > level; --l) {
+            entry_point = search_layer(query, {entry_point}, 1, l).front().second;
+        }
+
+        std::vector<uint32_t> entry_points{entry_point};
+        for (size_t l = std::min(level, m_max_level) + 1; l-- > 0;) {
+            const auto candidates = search_layer(query, entry_points, m_config.ef_construction, l);
+            const std::vector<uint32_t> neighbors = select_neighbors(candidates, max_links(l));
+            set_links(node, l, neighbors);
+            for (uint32_t neighbor : neighbors) {
+                connect(neighbor, node, l);
+            }
+
+            entry_points.clear();
+            for (const auto& candidate : candidates) {
+                entry_points.push_back(candidate.second);
+            }
+        }
+
+        if (level > m_max_level) {
+            m_entry_point = node;
+            m_max_level = level;
+        }
+        return node;
+    }
+
+    std::vector<std::pair<size_t, float>> search(const std::vector<float>& embedding, size_t top_k) const {
+        OPENVINO_ASSERT(embedding.size() == m_dimension,
+                        "Query has ",
+                        embedding.size(),
+                        " values, while the dimension of the vector index is ",
+                        m_dimension);
+        if (m_size == 0 || top_k == 0) {
+            return {};
+        }
+
+        const Query query = make_query(prepare(embedding));
+        uint32_t entry_point = m_entry_point;
+        for (size_t l = m_max_level; l > 0; --l) {
+            entry_point = search_layer(query, {entry_point}, 1, l).front().second;
+        }
+
+        const auto candidates = search_layer(query, {entry_point}, std::max(m_config.ef_search, top_k), 0);
+        std::vector<std::pair<size_t, float>> results;
+        results.reserve(std::min(top_k, candidates.size()));
+        for (size_t i = 0; i < candidates.size() && i < top_k; ++i) {
+            results.emplace_back(candidates[i].second, candidates[i].first);
+        }
+        return results;
+    }
+
+    void save(const std::filesystem::path& path) const {
+        std::ofstream file(path, std::ios::binary);
+        OPENVINO_ASSERT(file.is_open(), "Cannot open ", path, " for writing");
+
+        IndexHeader header{};
+        std::memcpy(header.magic, index_magic, sizeof(index_magic));
+        header.version = index_version;
+        header.metric = static_cast<uint32_t>(m_config.metric);
+        header.storage = static_cast<uint32_t>(m_config.storage);
+        header.dimension = m_dimension;
+        header.max_neighbors = m_config.max_neighbors;
+        header.ef_construction = m_config.ef_construction;
+        header.ef_search = m_config.ef_search;
+        header.size = m_size;
+        header.entry_point = m_entry_point;
+        header.max_level = m_max_level;
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        const std::vector<char> padding(embeddings_alignment - sizeof(header) % embeddings_alignment, 0);
+        file.write(padding.data(), padding.size());
+
+        write(file, embeddings_data(), m_size * m_dimension * embedding_element_size());
+        write(file, m_scales.data(), m_scales.size() * sizeof(float));
+        write(file, m_squared_norms.data(), m_squared_norms.size() * sizeof(float));
+        write(file, m_levels.data(), m_levels.size() * sizeof(uint32_t));
+        write(file, m_links0.data(), m_links0.size() * sizeof(uint32_t));
+        for (const auto& links : m_upper_links) {
+            write(file, links.data(), links.size() * sizeof(uint32_t));
+        }
+        OPENVINO_ASSERT(file.good(), "Failed to write the vector index to ", path);
+    }
+
+    static std::unique_ptr<VectorIndexImpl> load(const std::filesystem::path& path) {
+        OPENVINO_ASSERT(std::filesystem::exists(path), "Vector index file ", path, " doesn't exist");
+        ov::Tensor mapped = ov::read_tensor_data(path);
+        const uint8_t* data = mapped.data<const uint8_t>();
+        const size_t file_size = mapped.get_byte_size();
+
+        IndexHeader header;
+        OPENVINO_ASSERT(file_size >= sizeof(header), "Vector index file ", path, " is truncated");
+        std::memcpy(&header, data, sizeof(header));
+        OPENVINO_ASSERT(std::memcmp(header.magic, index_magic, sizeof(index_magic)) == 0 &&
+                            header.version == index_version,
+                        "File ",
+                        path,
+                        " is not a vector index of version ",
+                        index_version);
+
+        Config config;
+        config.metric = static_cast<Metric>(header.metric);
+        config.storage = static_cast<Storage>(header.storage);
+        config.max_neighbors = header.max_neighbors;
+        config.ef_construction = header.ef_construction;
+        config.ef_search = header.ef_search;
+        auto impl = std::make_unique<VectorIndexImpl>(header.dimension, config);
+        impl->m_size = header.size;
+        impl->m_entry_point = static_cast<uint32_t>(header.entry_point);
+        impl->m_max_level = header.max_level;
+
+        size_t offset = sizeof(header) + embeddings_alignment - sizeof(header) % embeddings_alignment;
+        auto take = [&](size_t byte_size) {
+            OPENVINO_ASSERT(offset + byte_size <= file_size, "Vector index file ", path, " is truncated");
+            const uint8_t* begin = data + offset;
+            offset += byte_size;
+            return begin;
+        };
+
+        impl->m_mapped_embeddings = take(impl->m_size * impl->m_dimension * impl->embedding_element_size());
+        impl->m_mapped = mapped;
+        if (config.storage == Storage::INT8) {
+            read(take(impl->m_size * sizeof(float)), impl->m_size, impl->m_scales);
+            read(take(impl->m_size * sizeof(float)), impl->m_size, impl->m_squared_norms);
+        }
+        read(take(impl->m_size * sizeof(uint32_t)), impl->m_size, impl->m_levels);
+        read(take(impl->m_size * impl->links_size(0) * sizeof(uint32_t)), impl->m_size * impl->links_size(0), impl->m_links0);
+        for (size_t node = 0; node < impl->m_size; ++node) {
+            const size_t size = impl->m_levels[node] * impl->links_size(1);
+            read(take(size * sizeof(uint32_t)), size, impl->m_upper_links.emplace_back());
+        }
+        return impl;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    size_t get_dimension() const {
+        return m_dimension;
+    }
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    // the query values with the precomputed squared norm, which is used by L2 distance to the int8 embeddings
+    struct Query {
+        std::vector<float> values;
+        float squared_norm = 0.0f;
+    };
+
+    size_t m_dimension;
+    Config m_config;
+    double m_level_multiplier;
+    std::mt19937 m_generator{42};
+
+    size_t m_size = 0;
+    std::vector<float> m_f32_embeddings;
+    std::vector<int8_t> m_int8_embeddings;
+    // scales and squared norms of the dequantized int8 embeddings
+    std::vector<float> m_scales, m_squared_norms;
+    // the embeddings of the loaded index, which are copied to the vectors above by the first 'add()'
+    ov::Tensor m_mapped;
+    const void* m_mapped_embeddings = nullptr;
+
+    // the links of a node on a level are the number of neighbors followed by 'max_links(level)' neighbors
+    std::vector<uint32_t> m_levels;
+    std::vector<uint32_t> m_links0;
+    std::vector<std::vector<uint32_t>> m_upper_links;
+    uint32_t m_entry_point = 0;
+    size_t m_max_level = 0;
+
+    template <typename T>
+    static void write(std::ofstream& file, const T* data, size_t byte_size) {
+        file.write(reinterpret_cast<const char*>(data), byte_size);
+    }
+
+    template <typename T>
+    static void read(const uint8_t* data, size_t size, std::vector<T>& values) {
+        values.resize(size);
+        std::memcpy(values.data(), data, size * sizeof(T));
+    }
+
+    size_t embedding_element_size() const {
+        return m_config.storage == Storage::INT8 ? sizeof(int8_t) : sizeof(float);
+    }
+
+    const void* embeddings_data() const {
+        if (m_mapped_embeddings) {
+            return m_mapped_embeddings;
+        }
+        return m_config.storage == Storage::INT8 ? static_cast<const void*>(m_int8_embeddings.data())
+                                                 : static_cast<const void*>(m_f32_embeddings.data());
+    }
+
+    void copy_mapped_embeddings() {
+        const size_t size = m_size * m_dimension;
+        if (m_config.storage == Storage::INT8) {
+            const int8_t* data = static_cast<const int8_t*>(m_mapped_embeddings);
+            m_int8_embeddings.assign(data, data + size);
+        } else {
+            const float* data = static_cast<const float*>(m_mapped_embeddings);
+            m_f32_embeddings.assign(data, data + size);
+        }
+        m_mapped_embeddings = nullptr;
+        m_mapped = {};
+    }
+
+    size_t max_links(size_t level) const {
+        return level == 0 ? 2 * m_config.max_neighbors : m_config.max_neighbors;
+    }
+
+    size_t links_size(size_t level) const {
+        return max_links(level) + 1;
+    }
+
+    const uint32_t* links(uint32_t node, size_t level) const {
+        if (level == 0) {
+            return m_links0.data() + node * links_size(0);
+        }
+        return m_upper_links[node].data() + (level - 1) * links_size(1);
+    }
+
+    void set_links(uint32_t node, size_t level, const std::vector<uint32_t>& neighbors) {
+        uint32_t* node_links = const_cast<uint32_t*>(links(node, level));
+        node_links[0] = static_cast<uint32_t>(neighbors.size());
+        std::copy(neighbors.begin(), neighbors.end(), node_links + 1);
+    }
+
+    size_t generate_level() {
+        std::uniform_real_distribution<double> distribution(std::numeric_limits<double>::min(), 1.0);
+        return static_cast<size_t>(-std::log(distribution(m_generator)) * m_level_multiplier);
+    }
+
+    // the cosine metric compares the normalized embeddings
+    std::vector<float> prepare(std::vector<float> embedding) const {
+        if (m_config.metric == Metric::COSINE) {
+            const float norm = std::sqrt(dot(embedding.data(), embedding.data(), embedding.size()));
+            for (float& value : embedding) {
+                value /= std::max(norm, 1e-12f);
+            }
+        }
+        return embedding;
+    }
+
+    void store(const std::vector<float>& embedding) {
+        if (m_config.storage == Storage::F32) {
+            m_f32_embeddings.insert(m_f32_embeddings.end(), embedding.begin(), embedding.end());
+            return;
+        }
+
+        // symmetric quantization with a scale per embedding
+        float max_abs = 0.0f;
+        for (float value : embedding) {
+            max_abs = std::max(max_abs, std::abs(value));
+        }
+        const float scale = max_abs > 0.0f ? max_abs / 127.0f : 1.0f;
+        float squared_norm = 0.0f;
+        for (float value : embedding) {
+            const float quantized = std::clamp(std::round(value / scale), -127.0f, 127.0f);
+            m_int8_embeddings.push_back(static_cast<int8_t>(quantized));
+            squared_norm += quantized * scale * quantized * scale;
+        }
+        m_scales.push_back(scale);
+        m_squared_norms.push_back(squared_norm);
+    }
+
+    Query make_query(std::vector<float> values) const {
+        const float squared_norm = dot(values.data(), values.data(), values.size());
+        return {std::move(values), squared_norm};
+    }
+
+    // the query of a stored embedding, which is dequantized for int8 storage
+    Query make_query(uint32_t node) const {
+        std::vector<float> values(m_dimension);
+        if (m_config.storage == Storage::INT8) {
+            const int8_t* embedding = static_cast<const int8_t*>(embeddings_data()) + node * m_dimension;
+            for (size_t i = 0; i < m_dimension; ++i) {
+                values[i] = embedding[i] * m_scales[node];
+            }
+        } else {
+            const float* embedding = static_cast<const float*>(embeddings_data()) + node * m_dimension;
+            std::copy_n(embedding, m_dimension, values.begin());
+        }
+        return make_query(std::move(values));
+    }
+
+    float distance(const Query& query, uint32_t node) const {
+        if (m_config.storage == Storage::F32) {
+            const float* embedding = static_cast<const float*>(embeddings_data()) + node * m_dimension;
+            if (m_config.metric == Metric::L2) {
+                return squared_l2(query.values.data(), embedding, m_dimension);
+            }
+            const float product = dot(query.values.data(), embedding, m_dimension);
+            return m_config.metric == Metric::COSINE ? 1.0f - product : -product;
+        }
+
+        const int8_t* embedding = static_cast<const int8_t*>(embeddings_data()) + node * m_dimension;
+        const float product = m_scales[node] * dot(query.values.data(), embedding, m_dimension);
+        if (m_config.metric == Metric::L2) {
+            return std::max(query.squared_norm - 2.0f * product + m_squared_norms[node], 0.0f);
+        }
+        return m_config.metric == Metric::COSINE ? 1.0f - product : -product;
+    }
+
+    // returns up to 'ef' nearest nodes of the level to the query sorted by distance
+    std::vector<std::pair<float, uint32_t>> search_layer(const Query& query,
+                                                         const std::vector<uint32_t>& entry_points,
+                                                         size_t ef,
+                                                         size_t level) const {
+        thread_local VisitedList visited;
+        visited.reset(m_size);
+
+        using Candidate = std::pair<float, uint32_t>;
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+        // the farthest result is at the top
+        std::priority_queue<Candidate> results;
+        for (uint32_t entry_point : entry_points) {
+            if (visited.visit(entry_point)) {
+                const float entry_distance = distance(query, entry_point);
+                candidates.emplace(entry_distance, entry_point);
+                results.emplace(entry_distance, entry_point);
+            }
+        }
+        while (results.size() > ef) {
+            results.pop();
+        }
+
+        while (!candidates.empty()) {
+            const Candidate nearest = candidates.top();
+            if (results.size() >= ef && nearest.first > results.top().first) {
+                break;
+            }
+            candidates.pop();
+
+            const uint32_t* node_links = links(nearest.second, level);
+            for (uint32_t i = 1; i <= node_links[0]; ++i) {
+                const uint32_t neighbor = node_links[i];
+                if (!visited.visit(neighbor)) {
+                    continue;
+                }
+                const float neighbor_distance = distance(query, neighbor);
+                if (results.size() < ef || neighbor_distance < results.top().first) {
+                    candidates.emplace(neighbor_distance, neighbor);
+                    results.emplace(neighbor_distance, neighbor);
+                    if (results.size() > ef) {
+                        results.pop();
+                    }
+                }
+            }
+        }
+
+        std::vector<Candidate> sorted(results.size());
+        for (size_t i = sorted.size(); i-- > 0;) {
+            sorted[i] = results.top();
+            results.pop();
+        }
+        return sorted;
+    }
+
+    // selects the neighbors by the heuristic of HNSW: a candidate is skipped if it's closer to a selected neighbor than
+    // to the base node, so the neighbors point to different directions
+    std::vector<uint32_t> select_neighbors(const std::vector<std::pair<float, uint32_t>>& candidates,
+                                           size_t max_neighbors) const {
+        std::vector<uint32_t> neighbors;
+        for (const auto& [candidate_distance, candidate] : candidates) {
+            if (neighbors.size() >= max_neighbors) {
+                break;
+            }
+            const Query candidate_query = make_query(candidate);
+            const bool is_diverse = std::all_of(neighbors.begin(), neighbors.end(), [&](uint32_t neighbor) {
+                return distance(candidate_query, neighbor) >= candidate_distance;
+            });
+            if (is_diverse) {
+                neighbors.push_back(candidate);
+            }
+        }
+        return neighbors;
+    }
+
+    // adds the link from the node to the new neighbor, the links are reselected if there are too many
+    void connect(uint32_t node, uint32_t new_neighbor, size_t level) {
+        const uint32_t* node_links = links(node, level);
+        std::vector<uint32_t> neighbors(node_links + 1, node_links + 1 + node_links[0]);
+        neighbors.push_back(new_neighbor);
+        if (neighbors.size() > max_links(level)) {
+            const Query query = make_query(node);
+            std::vector<std::pair<float, uint32_t>> candidates;
+            for (uint32_t neighbor : neighbors) {
+                candidates.emplace_back(distance(query, neighbor), neighbor);
+            }
+            std::sort(candidates.begin(), candidates.end());
+            neighbors = select_neighbors(candidates, max_links(level));
+        }
+        set_links(node, level, neighbors);
+    }
+};
+
+VectorIndex::VectorIndex(size_t dimension, const Config& config)
+    : m_impl{std::make_unique<VectorIndexImpl>(dimension, config)} {}
+
+VectorIndex::VectorIndex(std::unique_ptr<VectorIndexImpl> impl) : m_impl{std::move(impl)} {}
+
+VectorIndex VectorIndex::load(const std::filesystem::path& path) {
+    return VectorIndex(VectorIndexImpl::load(path));
+}
+
+VectorIndex::VectorIndex(VectorIndex&&) = default;
+
+VectorIndex& VectorIndex::operator=(VectorIndex&&) = default;
+
+VectorIndex::~VectorIndex() = default;
+
+size_t VectorIndex::add(const EmbeddingResults& embeddings) {
+    const size_t first_id = m_impl->size();
+    std::visit(
+        [this](const auto& values) {
+            for (const auto& embedding : values) {
+                m_impl->add(std::vector<float>(embedding.begin(), embedding.end()));
+            }
+        },
+        embeddings);
+    return first_id;
+}
+
+size_t VectorIndex::add(const EmbeddingResult& embedding) {
+    return m_impl->add(to_floats(embedding));
+}
+
+std::vector<std::pair<size_t, float>> VectorIndex::search(const EmbeddingResult& query, size_t top_k) const {
+    return m_impl->search(to_floats(query), top_k);
+}
+
+void VectorIndex::save(const std::filesystem::path& path) const {
+    m_impl->save(path);
+}
+
+size_t VectorIndex::size() const {
+    return m_impl->size();
+}
+
+size_t VectorIndex::get_dimension() const {
+    return m_impl->get_dimension();
+}
+
+const VectorIndex::Config& VectorIndex::get_config() const {
+    return m_impl->get_config();
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+
+namespace ov::genai {
+
+/**
+ * Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+ * Each output is a pure function of the key and the counter, so the generator has no state to share or lock between
+ * threads, and values may be computed in any order.
+ */
+inline std::array<uint32_t, 4> philox4x32(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+    constexpr uint32_t multiplier_0 = 0xD2511F53u, multiplier_1 = 0xCD9E8D57u;
+    constexpr uint32_t weyl_0 = 0x9E3779B9u, weyl_1 = 0xBB67AE85u;
+    for (size_t round = 0; round < 10; ++round) {
+        const uint64_t product_0 = static_cast<uint64_t>(multiplier_0) * counter[0];
+        const uint64_t product_1 = static_cast<uint64_t>(multiplier_1) * counter[2];
+        counter = {static_cast<uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(product_1),
+                   static_cast<uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(product_0)};
+        key[0] += weyl_0;
+        key[1] += weyl_1;
+    }
+    return counter;
+}
+
+/**
+ * A stream of uniformly distributed random values identified by a seed and a list of ids, e.g. { request id, sequence
+ * id, position }. Values of the stream do not depend on which other streams were used before, so the results of
+ * sampling with a given seed do not depend on the composition of batches or on the order sequences are processed in.
+ */
+class CounterBasedRandom {
+public:
+    CounterBasedRandom(uint64_t seed, std::initializer_list<uint64_t> stream_ids) {
+        uint64_t key = mix(seed);
+        for (uint64_t stream_id : stream_ids) {
+            key = mix(key ^ stream_id);
+        }
+        m_key = {static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)};
+    }
+
+    /**
+     * @return The value in [0, 1) with 53 random bits at position `counter` of the stream.
+     */
+    double uniform(uint64_t counter) const {
+        const auto bits = philox4x32({static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), 0, 0}, m_key);
+        const uint64_t mantissa = ((static_cast<uint64_t>(bits[0]) << 32) | bits[1]) >> 11;
+        return static_cast<double>(mantissa) * (1.0 / static_cast<double>(uint64_t(1) << 53));
+    }
+
+private:
+    // splitmix64 finalizer, hashes the seed and the stream ids into the Philox key
+    static uint64_t mix(uint64_t value) {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    std::array<uint32_t, 2> m_key;
+};
+
+}  // namespace ov::genai
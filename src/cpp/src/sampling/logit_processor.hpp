@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <optional>
 
 #include "openvino/genai/generation_config.hpp"
 #include "sampling/logit_transformers.hpp"
@@ -16,8 +17,13 @@ protected:
     std::vector<std::shared_ptr<LogitTransformers::ILogitTransformer>> m_logit_transformers;
     std::vector<std::shared_ptr<LogitTransformers::IStatefulLogitTransformer>> m_stateful_logit_transformers;
     
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
+    // penalty transformers, which are pointed to the generated token counts of the sequence the logits belong to
+    std::vector<std::shared_ptr<LogitTransformers::IPenaltyTransformer>> m_penalty_transformers;
+
+    // { sequence_id, counts of the tokens generated by the sequence }; the counts are updated incrementally with each
+    // registered or removed token, so applying the penalties costs O(unique tokens) rather than O(sequence length)
+    std::map<uint64_t, std::shared_ptr<LogitTransformers::TokenCounts>> m_generated_token_counts;
+    std::shared_ptr<std::unordered_set<int64_t>> m_unique_prompt_token_ids = std::shared_ptr<std::unordered_set<int64_t>>(new std::unordered_set<int64_t>);
     size_t m_generated_tokens = 0;
 
     // speculative decoding parameters
@@ -27,12 +33,17 @@ protected:
 public:
     LogitProcessor(const ov::genai::GenerationConfig& sampling_params,
                    const LogitTransformers::TokenIds& input_ids,
-                   std::shared_ptr<ov::genai::StructuredOutputController> structured_output_controller = nullptr
+                   std::shared_ptr<ov::genai::StructuredOutputController> structured_output_controller = nullptr,
+                   std::optional<std::vector<int64_t>> token_healing_ids = std::nullopt
     ) {
         for (const auto& input_id : input_ids) {
             m_unique_prompt_token_ids->insert(input_id);
         }
 
+        if (token_healing_ids) {
+            m_logit_transformers.emplace_back(new LogitTransformers::TokenHealingFilter(std::move(*token_healing_ids)));
+        }
+
         if (sampling_params.min_new_tokens > 0) {
             m_logit_transformers.emplace_back(
                 new LogitTransformers::EOSPenaltyTransform(sampling_params.stop_token_ids, sampling_params.min_new_tokens)
@@ -51,26 +62,37 @@ public:
                 std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform> transformer =
                     std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform>(new LogitTransformers::RepetitionPenaltyTransform(sampling_params.repetition_penalty));
                 transformer->set_unique_prompt_token_ids(m_unique_prompt_token_ids);
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
+                m_penalty_transformers.push_back(transformer);
                 m_logit_transformers.push_back(transformer);
             }
             if (sampling_params.presence_penalty != 0.0f) {
                 std::shared_ptr<LogitTransformers::PresencePenaltyTransform> transformer = 
                     std::shared_ptr<LogitTransformers::PresencePenaltyTransform>(new LogitTransformers::PresencePenaltyTransform(sampling_params.presence_penalty)); 
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
+                m_penalty_transformers.push_back(transformer);
                 m_logit_transformers.push_back(transformer);
                 
             }
             if (sampling_params.frequency_penalty != 0.0f) {
                 std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform> transformer = 
                     std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform>(new LogitTransformers::FrequencyPenaltyTransform(sampling_params.frequency_penalty));
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
+                m_penalty_transformers.push_back(transformer);
                 m_logit_transformers.push_back(transformer);
             }
 
-            if (sampling_params.is_multinomial()) {
+            const bool has_top_p = sampling_params.top_p != 1.0f;
+            if (sampling_params.is_multinomial() && sampling_params.top_k > 0 &&
+                sampling_params.top_k <= LogitTransformers::FusedTemperatureTopKFilter<true>::max_top_k) {
+                // the common configurations with a small top_k are sampled with a single fused transform
+                if (has_top_p) {
+                    m_logit_transformers.emplace_back(new LogitTransformers::FusedTemperatureTopKFilter<true>(
+                        sampling_params.temperature, sampling_params.top_k, sampling_params.top_p));
+                } else {
+                    m_logit_transformers.emplace_back(new LogitTransformers::FusedTemperatureTopKFilter<false>(
+                        sampling_params.temperature, sampling_params.top_k));
+                }
+            } else if (sampling_params.is_multinomial()) {
                 m_logit_transformers.emplace_back(new LogitTransformers::TemperatureLogitTransform(sampling_params.temperature));
-                if (sampling_params.top_p != 1.0f) {
+                if (has_top_p) {
                     m_logit_transformers.emplace_back(new LogitTransformers::TopPFilter(sampling_params.top_p));
                 }
                 if (sampling_params.top_k > 0 && sampling_params.top_k < std::numeric_limits<size_t>::max()) {
@@ -87,7 +109,13 @@ public:
         return m_assistant_confidence_threshold;
     }
 
-    void apply(Logits& logits) {
+    void apply(Logits& logits, uint64_t sequence_id) {
+        if (!m_penalty_transformers.empty()) {
+            const auto& generated_token_counts = get_generated_token_counts(sequence_id);
+            for (const auto& transformer : m_penalty_transformers) {
+                transformer->set_unique_generated_token_ids(generated_token_counts);
+            }
+        }
         for (const auto& transformer : m_logit_transformers) {
             if (transformer->is_applicable(m_generated_tokens)) {
                 transformer->apply(logits);
@@ -95,6 +123,29 @@ public:
         }
     }
 
+    // whether there are transformers, which precompute data for the next `apply` in `prepare`
+    bool has_stateful_transformers() const {
+        return !m_stateful_logit_transformers.empty();
+    }
+
+    void prepare() {
+        for (const auto& transformer : m_stateful_logit_transformers) {
+            if (transformer->is_applicable(m_generated_tokens)) {
+                transformer->prepare();
+            }
+        }
+    }
+
+    // whether `apply` may change the logits at the current generation step
+    bool has_applicable_transformers() {
+        for (const auto& transformer : m_logit_transformers) {
+            if (transformer->is_applicable(m_generated_tokens)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void update_generated_len(size_t updated_len) {
         m_generated_tokens = updated_len;
     }
@@ -103,13 +154,8 @@ public:
         return m_generated_tokens;
     }
 
-    void register_new_generated_token(int64_t new_token_id) {
-        auto it = m_unique_generated_token_ids->find(new_token_id);
-        if (it == m_unique_generated_token_ids->end()) {
-            m_unique_generated_token_ids->insert({new_token_id, 1});
-        } else {
-            it->second++;
-        }
+    void register_new_generated_token(int64_t new_token_id, uint64_t sequence_id) {
+        (*get_generated_token_counts(sequence_id))[new_token_id]++;
         for (const auto& transformer : m_stateful_logit_transformers) {
             if (transformer->is_applicable(m_generated_tokens)) {
                 transformer->accept_tokens({new_token_id});
@@ -117,11 +163,45 @@ public:
         }
     }
 
-    void decrease_generated_token_occurance(int64_t token_id) {
-        OPENVINO_ASSERT(m_unique_generated_token_ids->count(token_id) > 0);
-        m_unique_generated_token_ids->at(token_id)--;
+    // appends the tokens forced by the stateful transformer (see IStatefulLogitTransformer::jump_forward) to the state
+    // of the processor, as if they had been generated by the sequence; returns the forced tokens
+    LogitTransformers::TokenIds jump_forward(uint64_t sequence_id, size_t max_num_tokens) {
+        // the tokens forced by one transformer would have to be accepted by the others, which may reject them
+        if (m_stateful_logit_transformers.size() != 1 || !m_stateful_logit_transformers[0]->is_applicable(m_generated_tokens)) {
+            return {};
+        }
+        LogitTransformers::TokenIds forced_tokens = m_stateful_logit_transformers[0]->jump_forward(max_num_tokens);
+        auto& generated_token_counts = *get_generated_token_counts(sequence_id);
+        for (int64_t token_id : forced_tokens) {
+            generated_token_counts[token_id]++;
+        }
+        return forced_tokens;
     }
 
+    void decrease_generated_token_occurance(int64_t token_id, uint64_t sequence_id) {
+        auto& generated_token_counts = *get_generated_token_counts(sequence_id);
+        auto it = generated_token_counts.find(token_id);
+        // tokens may be appended to sequences without registering them (e.g. candidates of assisting pipelines)
+        if (it != generated_token_counts.end() && --it->second == 0) {
+            generated_token_counts.erase(it);
+        }
+    }
+
+    // makes the forked sequence start with a copy of the generated token counts of the parent one; sequences are
+    // forked before generating their first tokens, so the copy is usually empty
+    void fork_sequence(uint64_t parent_sequence_id, uint64_t forked_sequence_id) {
+        m_generated_token_counts[forked_sequence_id] =
+            std::make_shared<LogitTransformers::TokenCounts>(*get_generated_token_counts(parent_sequence_id));
+    }
+
+protected:
+    const std::shared_ptr<LogitTransformers::TokenCounts>& get_generated_token_counts(uint64_t sequence_id) {
+        auto& generated_token_counts = m_generated_token_counts[sequence_id];
+        if (!generated_token_counts) {
+            generated_token_counts = std::make_shared<LogitTransformers::TokenCounts>();
+        }
+        return generated_token_counts;
+    }
 };
 
 } // namespace ov::genai
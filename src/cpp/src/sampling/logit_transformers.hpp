@@ -5,8 +5,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "openvino/genai/generation_config.hpp"
+#include "sampling/sampling_kernels.hpp"
 
 namespace ov::genai {
 
@@ -34,6 +38,15 @@ struct Logits {
             m_vector.emplace_back(m_data[i], i);
     }
 
+    // Initializes the vector with the tokens with values not less than min_value only
+    void initialize_vector(float min_value) {
+        OPENVINO_ASSERT(m_vector.size() == 0, "Logits vector already initialized");
+        for (size_t i = 0; i < m_size; i++)
+            if (!(m_data[i] < min_value))
+                m_vector.emplace_back(m_data[i], i);
+        m_size = m_vector.size();
+    }
+
     bool is_vector_initialized() const {
         return m_vector.size() > 0;
     }
@@ -47,6 +60,8 @@ struct Logits {
 namespace LogitTransformers {
 
 using TokenIds = std::vector<int64_t>;
+// { token_id, number of occurrences }, holds the tokens with a non-zero count only
+using TokenCounts = std::unordered_map<int64_t, size_t>;
 
 class ILogitTransformer {
 public:
@@ -62,10 +77,20 @@ public:
  * 
  * ILogitTransformer interface is used for logit transformers that do not maintain state across token generations.
  * accept_tokens method is used to accept a sequence of token ids, which can be used to update the internal state of the transformer.
+ * prepare method may be used to precompute whatever the next apply call needs for the current state in advance, e.g. while
+ * the model is being inferred; the precomputed data is expected to be dropped when new tokens are accepted.
  */
 class IStatefulLogitTransformer: public ILogitTransformer {
 public:
     virtual void accept_tokens(const TokenIds& input_ids) = 0;
+
+    virtual void prepare() {}
+
+    // accepts and returns up to `max_num_tokens` tokens, which are the only continuation the transformer allows
+    // in the current state, e.g. the keys and punctuation enforced by a grammar
+    virtual TokenIds jump_forward(size_t /* max_num_tokens */) {
+        return {};
+    }
 };
 
 
@@ -73,46 +98,29 @@ class TopPFilter : public ILogitTransformer {
 public:
     TopPFilter(double top_p) : m_top_p(top_p) {}
 
-    bool partial_sort_and_resize(Logits& logits) {
-        // Since most of the time huge part of logits vector contains minimal values
-        // expensive sorting of entire vector might be unnecessary, especially for low values of top_p.
-        // This method partially sorts vector finding M top elements and stops when top_p condition is met.
-        // It iterates a few times starting with M = 16 and multiplying it by 2 each iteration until M = 1024.
-        // If top_p is found in considered scope it resizes logits vector and returns true. Otherwise it returns false.
-        // Note that it can we less performant than standard approach if logits value are more evenly distributed across the vector.
-        for (size_t step = 16; step <= 1024; step *= 2) {
-            if (logits.m_vector.size() <= step)
-                break;
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + step, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-            float sum = 0.0;
-            for (int i = 0; i < step; i++) {
-                sum += logits.m_vector[i].m_log_prob;
-                if (sum > m_top_p) {
-                    logits.resize(i+1);
-                    return true;
+    void apply(Logits& logits) override {
+        // Tokens with probability below (1 - top_p) / vocab_size cannot get into the nucleus: their total probability is
+        // less than 1 - top_p, so the remaining ones sum up to more than top_p. For the typical peaked distributions this
+        // leaves a small fraction of the vocabulary as candidates.
+        logits.initialize_vector(static_cast<float>((1.0 - m_top_p) / logits.m_size));
+
+        // Most of the time the nucleus is small, so instead of sorting all candidates they are selected in batches of
+        // growing size, each batch is sorted and accumulated until top_p condition is met.
+        auto greater = [](const Token& lhs, const Token& rhs) { return lhs.m_log_prob > rhs.m_log_prob; };
+        auto& candidates = logits.m_vector;
+        float probability_sum = 0.0f;
+        for (size_t num_sorted = 0, batch_end = 16; num_sorted < candidates.size(); num_sorted = batch_end, batch_end *= 2) {
+            batch_end = std::min(batch_end, candidates.size());
+            std::nth_element(candidates.begin() + num_sorted, candidates.begin() + batch_end, candidates.end(), greater);
+            std::sort(candidates.begin() + num_sorted, candidates.begin() + batch_end, greater);
+            for (size_t i = num_sorted; i < batch_end; i++) {
+                probability_sum += candidates[i].m_log_prob;
+                if (probability_sum > m_top_p) {
+                    logits.resize(i + 1);
+                    return;
                 }
             }
         }
-        return false;
-    }
-
-    void full_sort_and_resize(Logits& logits) {
-        std::sort(logits.m_vector.begin(), logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-        float probability_sum = 0.0f;
-        size_t nucleus_size = 0;
-        for (const auto& logit : logits.m_vector) {
-            probability_sum += logit.m_log_prob;
-            nucleus_size += 1;
-            if (probability_sum > m_top_p) break;
-        }
-        logits.resize(nucleus_size);
-    }
-
-    void apply(Logits& logits) override {
-        // Initialize and sort vector. Try partial sorting first and if it's not enough, sort entire vector.
-        logits.initialize_vector();
-        if(!partial_sort_and_resize(logits))
-            full_sort_and_resize(logits);
     }
 
 protected:
@@ -123,7 +131,7 @@ class TopKFilter : public ILogitTransformer {
 public:
     TopKFilter(size_t top_k) : m_top_k(top_k) {}
 
-    // If this transform is used along with top_p, it should be applied after it since top_p sorts entire vector and top_k does it only partially
+    // If this transform is used along with top_p, it should be applied after it since top_p sorts the nucleus and top_k does it only partially
     void apply(Logits& logits) override {
 
         if (m_top_k >= logits.m_size)
@@ -131,52 +139,112 @@ public:
 
         // If top_p is also used vector is already initialized and sorted
         if (!logits.is_vector_initialized()) {
-            // Initialize and partially sort vector
-            logits.initialize_vector();
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
+            if (m_top_k <= m_max_top_k_to_select) {
+                // Select top_k tokens from the buffer in a single pass without initializing the vector for the entire vocabulary
+                float top_values[m_max_top_k_to_select];
+                size_t top_indexes[m_max_top_k_to_select];
+                // a candidate is kept even if all the logits are masked, as the following transforms expect one
+                const size_t num_selected = std::max<size_t>(sampling_kernels::top_m(logits.m_data, logits.m_size, m_top_k, top_values, top_indexes), 1);
+                logits.m_vector.reserve(num_selected);
+                for (size_t i = 0; i < num_selected; i++)
+                    logits.m_vector.emplace_back(top_values[i], top_indexes[i]);
+            } else {
+                auto greater = [](const Token& lhs, const Token& rhs) { return lhs.m_log_prob > rhs.m_log_prob; };
+                logits.initialize_vector();
+                std::nth_element(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), greater);
+                std::sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, greater);
+                // the masked logits sorted after the selected ones are not candidates, except the first one if all are masked
+                auto masked = std::find_if(logits.m_vector.begin() + 1, logits.m_vector.begin() + m_top_k, [](const Token& token) {
+                    return token.m_log_prob == -std::numeric_limits<float>::infinity();
+                });
+                logits.m_vector.erase(masked, logits.m_vector.end());
+            }
         }
-        logits.resize(m_top_k);
+        // fewer than top_k tokens may be left, e.g. by top_p or by the masking of the logits
+        logits.resize(std::min(m_top_k, logits.m_vector.size()));
     }
 
 protected:
+    // top_m selection does insertion into a sorted array, which is efficient for small arrays only
+    static constexpr size_t m_max_top_k_to_select = 64;
+
     size_t m_top_k = 0;
 };
 
+
 class TemperatureLogitTransform : public ILogitTransformer {
 public:
     TemperatureLogitTransform(double temperature) : m_temperature(temperature) {};
 
     void apply(Logits& logits) override {
-        float max_logit = -std::numeric_limits<float>::infinity();
-        for (size_t i = 0; i < logits.m_size; i++) {
-            if (logits.m_data[i] > max_logit) {
-                max_logit = logits.m_data[i];
-            }
-        }
+        float max_logit = sampling_kernels::reduce_max(logits.m_data, logits.m_size);
+        float norm_sum = sampling_kernels::exp_inplace(logits.m_data, logits.m_size, max_logit, 1.0f / m_temperature);
+        sampling_kernels::multiply_inplace(logits.m_data, logits.m_size, 1.0f / norm_sum);
+    }
 
-        float norm_sum = 0.0;
-        for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] = expf((logits.m_data[i] - max_logit) / this->m_temperature);
-            norm_sum += logits.m_data[i];
-        }
+protected:
+    float m_temperature = 0.f;
+};
+
+/**
+ * @brief Temperature, top_p and top_k transforms fused into a single transform for the top_k small enough to be selected
+ * with sampling_kernels::top_m. Temperature preserves the order of the tokens, so the top_k tokens are selected by their
+ * logits along with the max logit, and only their probabilities are computed, the rest of the vocabulary is just read
+ * once more for the normalization sum. This makes two read-only passes over the logits instead of the four or five of
+ * the separate transforms, two of which write the probabilities of the whole vocabulary.
+ * @tparam with_top_p Whether top_p is applied, i.e. the tokens after the first ones of total probability above top_p are
+ * filtered out as well.
+ */
+template <bool with_top_p>
+class FusedTemperatureTopKFilter : public ILogitTransformer {
+public:
+    // top_m selection does insertion into a sorted array, which is efficient for small arrays only
+    static constexpr size_t max_top_k = 64;
 
-        for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] /= norm_sum;
+    FusedTemperatureTopKFilter(double temperature, size_t top_k, double top_p = 1.0) :
+        m_temperature(temperature), m_top_k(top_k), m_top_p(top_p) {
+        OPENVINO_ASSERT(top_k > 0 && top_k <= max_top_k, "top_k of the fused transform must be in [1, ", max_top_k, "], got ", top_k);
+    }
+
+    void apply(Logits& logits) override {
+        const size_t top_k = std::min(m_top_k, logits.m_size);
+        float top_values[max_top_k];
+        size_t top_indexes[max_top_k];
+        // the masked logits aren't selected, so fewer than top_k tokens may be left, and at least one is kept
+        const size_t num_selected = std::max<size_t>(sampling_kernels::top_m(logits.m_data, logits.m_size, top_k, top_values, top_indexes), 1);
+
+        // the same probabilities as TemperatureLogitTransform computes, the max logit is the first selected one
+        const float scale = 1.0f / m_temperature;
+        const float norm_factor = 1.0f / sampling_kernels::sum_exp(logits.m_data, logits.m_size, top_values[0], scale);
+        logits.m_vector.reserve(num_selected);
+        float probability_sum = 0.0f;
+        for (size_t i = 0; i < num_selected; i++) {
+            const float probability = sampling_kernels::fast_exp((top_values[i] - top_values[0]) * scale) * norm_factor;
+            logits.m_vector.emplace_back(probability, top_indexes[i]);
+            if constexpr (with_top_p) {
+                probability_sum += probability;
+                if (probability_sum > m_top_p) {
+                    break;
+                }
+            }
         }
+        logits.m_size = logits.m_vector.size();
     }
 
 protected:
     float m_temperature = 0.f;
+    size_t m_top_k = 0;
+    double m_top_p = 1.f;
 };
 
 
 class IPenaltyTransformer : public ILogitTransformer {
 public:
-    void set_unique_generated_token_ids(const std::shared_ptr<std::map<int64_t, size_t>>& unique_generated_token_ids) {
+    void set_unique_generated_token_ids(const std::shared_ptr<TokenCounts>& unique_generated_token_ids) {
         if (unique_generated_token_ids != nullptr) {
             m_unique_generated_token_ids = unique_generated_token_ids;
         } else {
-            m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
+            m_unique_generated_token_ids = std::shared_ptr<TokenCounts>(new TokenCounts);
         }
     }
 
@@ -184,16 +252,12 @@ public:
         set_unique_generated_token_ids(m_unique_generated_token_ids);
 
         for (const auto& input_id : input_ids) {
-            if (m_unique_generated_token_ids->count(input_id)) {
-                m_unique_generated_token_ids->at(input_id)++;
-            } else {
-                m_unique_generated_token_ids->insert({input_id, 1});
-            }
+            (*m_unique_generated_token_ids)[input_id]++;
         }
     }
 
 protected:
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = nullptr;
+    std::shared_ptr<TokenCounts> m_unique_generated_token_ids = nullptr;
     double m_penalty = 0.f;
 };
 
@@ -235,16 +299,45 @@ public:
         apply(logits);
     }
 
-    void set_unique_prompt_token_ids(const std::shared_ptr<std::set<int64_t>>& unique_prompt_token_ids) {
+    void set_unique_prompt_token_ids(const std::shared_ptr<std::unordered_set<int64_t>>& unique_prompt_token_ids) {
         if (unique_prompt_token_ids != nullptr) {
             m_unique_prompt_token_ids = unique_prompt_token_ids;
         } else {
-            m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
+            m_unique_prompt_token_ids = std::shared_ptr<std::unordered_set<int64_t>>(new std::unordered_set<int64_t>);
+        }
+    }
+
+protected:
+    std::shared_ptr<std::unordered_set<int64_t>> m_unique_prompt_token_ids = nullptr;
+};
+
+/**
+ * @brief Constrains the first generated token to the given tokens. Used for token healing, which removes the last prompt
+ * token, so that the first generated token has to start with its text.
+ */
+class TokenHealingFilter : public ILogitTransformer {
+public:
+    // the token ids are expected in ascending order
+    TokenHealingFilter(std::vector<int64_t> allowed_token_ids) : m_allowed_token_ids(std::move(allowed_token_ids)) {}
+
+    void apply(Logits& logits) override {
+        // applied first, so the vector is not initialized yet and the element order matches the token ids
+        auto allowed_it = m_allowed_token_ids.begin();
+        for (size_t token_id = 0; token_id < logits.m_size; ++token_id) {
+            if (allowed_it != m_allowed_token_ids.end() && *allowed_it == static_cast<int64_t>(token_id)) {
+                ++allowed_it;
+            } else {
+                logits.m_data[token_id] = -std::numeric_limits<float>::infinity();
+            }
         }
     }
 
+    bool is_applicable(size_t generated_tokens_cnt = 0) override {
+        return generated_tokens_cnt == 0;
+    }
+
 protected:
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = nullptr;
+    std::vector<int64_t> m_allowed_token_ids;
 };
 
 class EOSPenaltyTransform : public ILogitTransformer {
@@ -4,6 +4,7 @@
 #include <future>
 
 #include "sampling/sampler.hpp"
+#include "continuous_batching/tracer.hpp"
 
 namespace ov::genai {
 // Modified Knuth–Morris–Pratt algorithm which returns tokens following after every needle occurrence in haystack
@@ -55,11 +56,8 @@ std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
 
     size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
     const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
-    float max_logit = *std::max_element(beam_logits, beam_logits + vocab_size);
-    float log_sum = std::log(std::accumulate(
-        beam_logits, beam_logits + vocab_size, 0.0f, [max_logit](float accumulated, float to_add) {
-            return accumulated + std::exp(to_add - max_logit);
-    }));
+    float max_logit = sampling_kernels::reduce_max(beam_logits, vocab_size);
+    float log_sum = std::log(sampling_kernels::sum_exp(beam_logits, vocab_size, max_logit));
 
     std::vector<Token> tokens;
     tokens.reserve(vocab_size);
@@ -69,28 +67,48 @@ std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
     return tokens;
 }
 
-std::vector<int64_t> wrap_tokens(const std::vector<int64_t>& tokens, const std::vector<int64_t>& prefix_tokens, const std::vector<int64_t>& suffix_tokens) {
-    std::vector<int64_t> all_tokens = prefix_tokens;
-    all_tokens.insert(all_tokens.end(), tokens.begin(), tokens.end());
-    all_tokens.insert(all_tokens.end(), suffix_tokens.begin(), suffix_tokens.end());
-    return all_tokens;
-}
+// Returns `num_tokens` tokens with the highest log probabilities after subtracting `log_prob_penalties`, in descending
+// order. Unlike log_softmax, only the candidates are materialized: the penalized tokens and the top ones among the rest.
+std::vector<Token> log_softmax_top_tokens(const ov::Tensor& logits, size_t batch_idx, size_t num_tokens,
+                                          const std::unordered_map<int64_t, float>& log_prob_penalties) {
+    ov::Shape shape = logits.get_shape();
+    OPENVINO_ASSERT(shape.size() == 3);
+    size_t batch = shape[0], seq_len = shape[1], vocab_size = shape[2];
+    OPENVINO_ASSERT(batch_idx < batch, "Logits batch size doesn't match the number of beams");
+
+    size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
+    const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
+    float max_logit = sampling_kernels::reduce_max(beam_logits, vocab_size);
+    float log_norm = max_logit + std::log(sampling_kernels::sum_exp(beam_logits, vocab_size, max_logit));
+
+    // penalties only decrease log probabilities, so the top tokens without a penalty are among the top
+    // num_tokens + (number of penalized tokens) ones by logit
+    const size_t num_to_select = std::min(vocab_size, num_tokens + log_prob_penalties.size());
+    std::vector<float> top_values(num_to_select);
+    std::vector<size_t> top_indexes(num_to_select);
+    sampling_kernels::top_m(beam_logits, vocab_size, num_to_select, top_values.data(), top_indexes.data());
+
+    std::vector<Token> tokens;
+    tokens.reserve(num_to_select + log_prob_penalties.size());
+    for (size_t i = 0; i < num_to_select; ++i) {
+        if (!log_prob_penalties.count(top_indexes[i]))
+            tokens.push_back({top_values[i] - log_norm, int64_t(top_indexes[i])});
+    }
+    for (const auto& [token_id, penalty] : log_prob_penalties) {
+        OPENVINO_ASSERT(token_id >= 0 && static_cast<size_t>(token_id) < vocab_size, "Penalized token id is out of vocabulary");
+        tokens.push_back({beam_logits[token_id] - log_norm - penalty, token_id});
+    }
 
-std::string clean_wrapped_text(const std::string& wrapped_text, const std::string& prefix, const std::string& suffix) {
-    auto prefix_pos = wrapped_text.find(prefix);
-    OPENVINO_ASSERT(prefix_pos != std::string::npos);
-    auto suffix_pos = wrapped_text.rfind(suffix);
-    OPENVINO_ASSERT(suffix_pos != std::string::npos);
-    auto clean_text_start = prefix_pos + prefix.size();
-    auto clean_text_length = suffix_pos - clean_text_start;
-    std::string clean_text = wrapped_text.substr(clean_text_start, clean_text_length);
-    return clean_text;
+    num_tokens = std::min(num_tokens, tokens.size());
+    std::partial_sort(tokens.begin(), tokens.begin() + num_tokens, tokens.end(), [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob;
+    });
+    tokens.resize(num_tokens);
+    return tokens;
 }
 
 std::vector<int64_t> encode_and_process_string(const std::string& stop_string, ov::genai::Tokenizer& tokenizer) {
-    // encode stop_string
-    std::string stop_string_copy = stop_string;
-    ov::Tensor ov_encoded_stop_string = tokenizer.encode(stop_string_copy, ov::genai::add_special_tokens(false)).input_ids;
+    ov::Tensor ov_encoded_stop_string = tokenizer.encode(stop_string, ov::genai::add_special_tokens(false)).input_ids;
     size_t tensor_size = ov_encoded_stop_string.get_size();
     std::vector<int64_t> encoded_stop_string(tensor_size);
     std::copy_n(ov_encoded_stop_string.data<int64_t>(), tensor_size, encoded_stop_string.begin());
@@ -105,81 +123,50 @@ struct MatchStopStringResult {
 };
 
 // Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
+// The tokens are either TokenIds or the SharedHistory of a sequence, only the last ones are copied.
+template <typename TokenContainer>
 MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
-                      const TokenIds& generated_tokens,
-                      const std::pair<size_t, std::set<std::string>>& stop_strings,
+                      const TokenContainer& generated_tokens,
+                      const StopStringMatcher& stop_strings,
                       bool is_include_to_output,
                       size_t draft_generated_tokens = 0) {
     MatchStopStringResult result;
-    if (generated_tokens.size() >= stop_strings.first) {
+    if (generated_tokens.size() >= stop_strings.get_max_encoded_len()) {
         // draft_generated_tokens is to handle case with >= 1 generated tokens per step
         size_t offset = generated_tokens.size() - draft_generated_tokens;
-        if (offset < stop_strings.first) {
+        if (offset < stop_strings.get_max_encoded_len()) {
             return result;
         }
-        offset -= stop_strings.first;
+        offset -= stop_strings.get_max_encoded_len();
         TokenIds buffer(generated_tokens.begin() + offset, generated_tokens.end());
         std::string decoded_buffer = tokenizer.decode(buffer);
-        for (const auto& stop_string : stop_strings.second) {
-            auto pos = decoded_buffer.find(stop_string);
-            if (pos != std::string::npos) {
-                result.is_matched = true;
-
-                auto stop_string_len = is_include_to_output ? stop_string.length() : 0;
-                decoded_buffer = decoded_buffer.substr(0, pos + stop_string_len);
-                // to remove word splitting symbols from tail
-                while (decoded_buffer.back() == ' ' || decoded_buffer.back() == '\n') {
-                    decoded_buffer.pop_back();
-                }
-                if (decoded_buffer.empty()) {
-                    result.to_remove = buffer.size();
-                    return result;
-                }
-
-                // find token cnt to be removed from sequence by decoding token by token
-                std::string decoded_partially_string;
-                for (size_t i = 0; i < buffer.size(); ++i) {
-                    decoded_partially_string = tokenizer.decode(TokenIds{buffer.begin(), buffer.begin() + i + 1});
-                    if (decoded_partially_string.find(decoded_buffer) != std::string::npos) {
-                        result.to_remove = buffer.size() - i - 1;
-                        break;
-                    }
-                }
+        const auto match = stop_strings.find(decoded_buffer);
+        if (match.pos != std::string::npos) {
+            result.is_matched = true;
+
+            auto stop_string_len = is_include_to_output ? match.length : 0;
+            decoded_buffer = decoded_buffer.substr(0, match.pos + stop_string_len);
+            // to remove word splitting symbols from tail
+            while (!decoded_buffer.empty() && (decoded_buffer.back() == ' ' || decoded_buffer.back() == '\n')) {
+                decoded_buffer.pop_back();
+            }
+            if (decoded_buffer.empty()) {
+                result.to_remove = buffer.size();
                 return result;
             }
-        }
-    }
-    return result;
-}
-
-// Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
-// Number of tokens might not be exact as if there's no direct token match, we decode generated tokens incrementally expanding decoding scope
-// with 4 next tokens with each iteration until we check all tokens.
-int match_stop_string2(Tokenizer & tokenizer, const TokenIds & generated_tokens, const std::set<std::string> & stop_strings) {
-    for (auto stop_string: stop_strings) {
-        auto stop_tokens_ov = tokenizer.encode(stop_string).input_ids;
-        size_t num_tokens = stop_tokens_ov.get_size();
-        if(num_tokens > generated_tokens.size())
-            continue;
 
-        // Check direct token match
-        std::vector<int64_t> stop_tokens(stop_tokens_ov.data<int64_t>(), stop_tokens_ov.data<int64_t>() + num_tokens);
-        std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-        if (stop_tokens == last_generated_tokens)
-            return num_tokens;
-        
-        // Continue checking chunks of 4 tokens
-        num_tokens += 4;
-        while (num_tokens <= generated_tokens.size()) {
-            std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-            std::string decoded_last_tokens = tokenizer.decode(last_generated_tokens);
-            if (decoded_last_tokens.find(stop_string) != std::string::npos) {
-                return num_tokens;
+            // find token cnt to be removed from sequence by decoding token by token
+            std::string decoded_partially_string;
+            for (size_t i = 0; i < buffer.size(); ++i) {
+                decoded_partially_string = tokenizer.decode(TokenIds{buffer.begin(), buffer.begin() + i + 1});
+                if (decoded_partially_string.find(decoded_buffer) != std::string::npos) {
+                    result.to_remove = buffer.size() - i - 1;
+                    break;
+                }
             }
-            num_tokens += 4;
         }
     }
-    return 0;
+    return result;
 }
 
 void Sampler::GroupBeamSearcher::finalize(SamplerOutput& sampler_output) {
@@ -258,7 +245,7 @@ void Sampler::clear_structured_output_compile_times() {
 
 void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     SamplerOutput& sampler_output,
-    const std::pair<size_t, std::set<std::string>>& stop_strings) {
+    const StopStringMatcher& stop_strings) {
     assert(m_parameters.num_beams % m_parameters.num_beam_groups == 0 &&
         "number of beams should be divisible by number of groups");
     size_t group_size = m_parameters.num_beams / m_parameters.num_beam_groups;
@@ -270,6 +257,7 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     // parent sequence ID -> number of child sequences
     std::map<uint64_t, uint64_t> parent_2_num_childs_map;
 
+    const std::vector<Sequence::Ptr> running_seqs = m_sequence_group->get_running_sequences();
     for (Group& group : m_groups) {
         if (!group.done) {
             for (Beam& beam : group.ongoing) {
@@ -277,8 +265,7 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
                 uint64_t parent_seq_id = beam.m_sequence->get_id();
 
                 // here we need to map index of sequence in beam search group(s) and sequence group
-                beam.m_global_beam_idx = [this] (uint64_t seq_id) -> size_t {
-                    std::vector<Sequence::Ptr> running_seqs = m_sequence_group->get_running_sequences();
+                beam.m_global_beam_idx = [&running_seqs] (uint64_t seq_id) -> size_t {
                     for (size_t seq_global_index = 0; seq_global_index < running_seqs.size(); ++seq_global_index) {
                         if (seq_id == running_seqs[seq_global_index]->get_id())
                             return seq_global_index;
@@ -340,29 +327,29 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
         std::vector<Beam> candidates;
         candidates.reserve(group_size * 2 * group_size);
         for (const Beam& beam : group.ongoing) {
-            std::vector<Token> tokens = log_softmax(logits, beam.m_global_beam_idx);
-
-            // apply diversity penalty
+            // diversity penalty and n-gram blocking decrease log probabilities of a few tokens only
+            std::unordered_map<int64_t, float> log_prob_penalties;
             for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
                 for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
-                    tokens[prev_beam.m_token_id].m_log_prob -= m_parameters.diversity_penalty;
+                    log_prob_penalties[prev_beam.m_token_id] += m_parameters.diversity_penalty;
                 }
             }
 
             // apply n_gramm
-            std::vector<int64_t> full_text{m_sequence_group->get_prompt_ids()};
-            full_text.insert(full_text.end(), beam.m_sequence->get_generated_ids().begin(), beam.m_sequence->get_generated_ids().end());
-            if (full_text.size() > 1 && full_text.size() >= m_parameters.no_repeat_ngram_size) {
+            const auto& prompt_ids = m_sequence_group->get_prompt_ids();
+            const auto& generated_ids = beam.m_sequence->get_generated_ids();
+            const size_t full_text_len = prompt_ids.size() + generated_ids.size();
+            if (full_text_len > 1 && full_text_len >= m_parameters.no_repeat_ngram_size) {
+                std::vector<int64_t> full_text{prompt_ids};
+                full_text.insert(full_text.end(), generated_ids.begin(), generated_ids.end());
                 auto tail_start = full_text.end() - ptrdiff_t(m_parameters.no_repeat_ngram_size) + 1;
                 for (int64_t banned_token : kmp_search(full_text, {tail_start, full_text.end()})) {
-                    tokens[banned_token].m_log_prob = -std::numeric_limits<float>::infinity();
+                    log_prob_penalties[banned_token] = std::numeric_limits<float>::infinity();
                 }
             }
 
-            // sort tokens
-            std::sort(tokens.begin(), tokens.end(), [](Token left, Token right) {
-                return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
-            });
+            // most probable tokens in front
+            std::vector<Token> tokens = log_softmax_top_tokens(logits, beam.m_global_beam_idx, 2 * group_size, log_prob_penalties);
 
             size_t add_count = 0;
             for (Token token : tokens) {
@@ -402,9 +389,11 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
             }
 
             if (!m_parameters.stop_strings.empty()) {
-                // We need to include candidate token to already generated tokens to check if stop string has been generated
-                // There's probably a better way to do that, than copying whole vector...
-                std::vector<int64_t> token_ids = candidate.m_sequence->get_generated_ids();
+                // We need to include candidate token to already generated tokens to check if stop string has been generated.
+                // Only the last tokens are decoded by match_stop_string, so the rest of the sequence is not copied
+                const auto& generated_ids = candidate.m_sequence->get_generated_ids();
+                const size_t num_tail_tokens = std::min(generated_ids.size(), stop_strings.get_max_encoded_len());
+                std::vector<int64_t> token_ids(generated_ids.end() - num_tail_tokens, generated_ids.end());
                 token_ids.push_back(candidate.m_token_id);
                 auto match_result = match_stop_string(m_tokenizer, token_ids, stop_strings, m_parameters.include_stop_str_in_output);
                 if (match_result.is_matched) {
@@ -506,56 +495,52 @@ Logits Sampler::_get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t to
 
 Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
     // For greedy sampling we do not expect sorting or shrinking considered tokens
-    // so we can operate directly on the data buffer
-    size_t m = std::max(size_t(1), top_logprobs); // ensure m is at least 1
-    std::vector<float> top_values(m, -std::numeric_limits<float>::infinity());
-    std::vector<size_t> top_indexes(m, 0);
-
-    for (size_t i = 0; i < logits.m_size; ++i) {
-        if (logits.m_data[i] > top_values.back()) {
-            top_values.back() = logits.m_data[i];
-            top_indexes.back() = i;
-
-            for (size_t j = top_values.size() - 1; j > 0 && top_values[j] > top_values[j - 1]; --j) {
-                std::swap(top_values[j], top_values[j - 1]);
-                std::swap(top_indexes[j], top_indexes[j - 1]);
-            }
-        }
-    }
+    // so we can operate directly on the data buffer.
+    // Only the log probability of the selected token is returned (logprobs > 1 is treated as 1), so there is no need
+    // to select top_logprobs tokens.
+    float top_value;
+    size_t top_index;
+    sampling_kernels::top_m(logits.m_data, logits.m_size, 1, &top_value, &top_index);
 
-    size_t max_index = top_indexes.front();
     float max_value = 0.0;
-
     if (top_logprobs) {
         // apply log softmax to max value
-        max_value = top_values.front();
-        float log_sum = std::log(std::accumulate(
-            logits.m_data, logits.m_data + logits.m_size, 0.0f, [max_value](float accumulated, float to_add) {
-                return accumulated + std::exp(to_add - max_value);
-        }));
-        max_value = -log_sum;
+        max_value = -std::log(sampling_kernels::sum_exp(logits.m_data, logits.m_size, top_value));
     }
 
-    return Token(max_value, max_index);
+    return Token(max_value, top_index);
 }
 
-std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence) {
+std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence, const CounterBasedRandom& rng) {
     // If top_p or top_k was applied we use sorted vector, if not we go with original buffer.
-    std::vector<float> multinomial_weights;
-    multinomial_weights.reserve(logits.m_size);
-    if (logits.is_vector_initialized())
-        for (auto& logit: logits.m_vector) multinomial_weights.emplace_back(logit.m_log_prob);
-    else
-        multinomial_weights.assign(logits.m_data, logits.m_data + logits.m_size);
-
-    // std::discrete_distribution returns corrupted results when applied to log probabilities
-    // which result returning NAN only logprobs.
-    // so log() is applied after this line
-    auto dist = std::discrete_distribution<size_t>(multinomial_weights.begin(), multinomial_weights.end()); // equivalent to multinomial with number of trials == 1
+    // Tokens are drawn by inverse transform sampling over cumulative weights. Unlike std::discrete_distribution,
+    // it needs neither normalized nor copied weights, and the cumulative weights buffer is reused across calls.
+    // Log probabilities cannot be used as weights, so log() is applied to the weight of a picked token.
+    thread_local std::vector<double> cumulative_weights;
+    const size_t num_weights = logits.is_vector_initialized() ? logits.m_vector.size() : logits.m_size;
+    cumulative_weights.resize(num_weights);
+    double weights_sum = 0.0;
+    if (logits.is_vector_initialized()) {
+        for (size_t i = 0; i < num_weights; ++i) {
+            weights_sum += logits.m_vector[i].m_log_prob;
+            cumulative_weights[i] = weights_sum;
+        }
+    } else {
+        for (size_t i = 0; i < num_weights; ++i) {
+            weights_sum += logits.m_data[i];
+            cumulative_weights[i] = weights_sum;
+        }
+    }
 
     std::vector<Token> out_tokens;
     for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx) {
-        size_t element_to_pick = dist(rng_engine);
+        // the first token with cumulative weight above the drawn value; tokens with zero weight are never picked
+        auto picked_it = std::upper_bound(cumulative_weights.begin(), cumulative_weights.end(), rng.uniform(token_idx) * weights_sum);
+        if (picked_it == cumulative_weights.end()) {
+            // the drawn value may be rounded up to the sum, pick the last token with non-zero weight then
+            picked_it = std::lower_bound(cumulative_weights.begin(), cumulative_weights.end(), weights_sum);
+        }
+        size_t element_to_pick = std::min<size_t>(picked_it - cumulative_weights.begin(), num_weights - 1);
         if (logits.is_vector_initialized()) {
             auto logit = logits.m_vector[element_to_pick];
             logit.m_log_prob = std::log(logit.m_log_prob);
@@ -608,7 +593,7 @@ void register_new_token(const Token& sampled_token,
                         LogitProcessor& logit_processor,
                         bool is_extend_sequence,
                         bool is_validation_mode_enabled) {
-    logit_processor.register_new_generated_token(sampled_token.m_index);
+    logit_processor.register_new_generated_token(sampled_token.m_index, running_sequence->get_id());
     if (is_extend_sequence) {
         running_sequence->append_token(sampled_token.m_index, sampled_token.m_log_prob);
     }
@@ -649,11 +634,41 @@ create_n_forked_sequences(SequenceGroup::Ptr sequence_group,
         const auto forked_sequence = sequence_group->fork_sequence(sequence_to_fork);
         const auto forked_seq_id = forked_sequence->get_id();
         forked_seq_ids.push_back(forked_seq_id);
+        logit_processor.fork_sequence(sequence_to_fork->get_id(), forked_seq_id);
         register_new_token(sampled_tokens[i], forked_sequence, logit_processor, true, false);
     }
     return forked_seq_ids;
 }
 
+// stops the running sequences of best_of sampling, which can no longer be among the returned ones: the cumulative log
+// probability of a sequence only decreases, so a sequence below num_return_sequences finished ones is never returned
+std::vector<int64_t> prune_best_of_sequences(SequenceGroup::Ptr sequence_group) {
+    const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
+    std::vector<int64_t> pruned_seq_ids;
+    if (sampling_params.best_of <= sampling_params.num_return_sequences) {
+        return pruned_seq_ids;
+    }
+    std::vector<float> finished_scores;
+    for (const auto& sequence : sequence_group->get_sequences()) {
+        if (sequence->has_finished()) {
+            finished_scores.push_back(sequence->get_cumulative_log_prob());
+        }
+    }
+    if (finished_scores.size() < sampling_params.num_return_sequences) {
+        return pruned_seq_ids;
+    }
+    auto threshold_it = finished_scores.begin() + (sampling_params.num_return_sequences - 1);
+    std::nth_element(finished_scores.begin(), threshold_it, finished_scores.end(), std::greater<float>());
+    for (const auto& sequence : sequence_group->get_running_sequences()) {
+        if (sequence->get_cumulative_log_prob() < *threshold_it) {
+            sequence->set_status(SequenceStatus::FINISHED);
+            sequence->set_finish_reason(GenerationFinishReason::STOP);
+            pruned_seq_ids.push_back(sequence->get_id());
+        }
+    }
+    return pruned_seq_ids;
+}
+
 void
 stop_sample_tokens(Sequence::Ptr running_sequence,
                    size_t token_idx,
@@ -673,7 +688,7 @@ align_all_sequence_len(SequenceGroup::Ptr& sequence_group,
         if (generated_len > min_generated_tokens) {
             auto removed_token_cnt = generated_len - min_generated_tokens;
             for (size_t i = min_generated_tokens + 1; i < generated_len; ++i) {
-                logit_processor.decrease_generated_token_occurance(generated_token_ids[i]);
+                logit_processor.decrease_generated_token_occurance(generated_token_ids[i], sequence->get_id());
             }
             sequence->remove_last_tokens(removed_token_cnt);
         }
@@ -706,9 +721,12 @@ bool Sampler::validate_candidate(
                 q_i = std::exp(sampled_token.m_log_prob),
                 probability_ratio = p_i / q_i;
         
-        auto dist = std::uniform_int_distribution<>(0, 100); // equivalent to multinomial with number of trials == 1
-        float r_i = dist(rng_engine);
-        r_i /= 100;
+        // a separate stream from the one used to sample the token at the same position
+        constexpr uint64_t validation_stream_id = 1;
+        const auto sequence_group = running_sequence->get_sequence_group_ptr();
+        const CounterBasedRandom rng(seed, {sequence_group->get_request_id(), running_sequence->get_grouped_id(),
+                                            generated_tokens.size() - token_idx, validation_stream_id});
+        float r_i = rng.uniform(0);
         is_candidate_accepted = r_i <= probability_ratio;
     } else {
         is_candidate_accepted = *it_token_id == sampled_token.m_index;
@@ -756,22 +774,23 @@ float get_p_prime(Sequence::Ptr& running_sequence,
     return p_prime;
 }
 
-std::pair<size_t, std::set<std::string>>
-process_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& tokenizer) {
-    std::pair<size_t, std::set<std::string>> result;
+// the stop strings are encoded once per tokenizer, `encoded_lens` holds the lengths of the already encoded ones
+StopStringMatcher
+process_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& tokenizer, std::unordered_map<std::string, size_t>& encoded_lens) {
+    size_t max_encoded_len = 0;
     for (const auto& stop_string : stop_strings) {
-        auto encoded_stop_string = encode_and_process_string(stop_string, tokenizer);
-        if (result.first < encoded_stop_string.size()) {
-            result.first = encoded_stop_string.size();
+        auto it = encoded_lens.find(stop_string);
+        if (it == encoded_lens.end()) {
+            it = encoded_lens.emplace(stop_string, encode_and_process_string(stop_string, tokenizer).size()).first;
         }
-        result.second.insert(stop_string);
+        max_encoded_len = std::max(max_encoded_len, it->second);
     }
-    return result;
+    return StopStringMatcher(stop_strings, max_encoded_len);
 }
 
 SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits, 
-                                                              LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings, 
-                                                              bool is_validation_mode_enabled) {
+                                                              LogitProcessor& logit_processor, const StopStringMatcher& stop_strings, 
+                                                              bool is_validation_mode_enabled, ov::Tensor sequence_group_token_ids) {
     SequenceGroupSamplingInfo sg_sampling_info;
     // Assistant pipeline info is relevant for speculative and prompt lookup decoding
     AssistingPipelineInfo& assisting_pipeline_info = sg_sampling_info.get_assisting_pipeline_info();
@@ -821,18 +840,29 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                 }
 
                 auto logit_vector = _get_logit_vector(sequence_group_logits, running_sequence_id, logit_token_offset);
-                logit_processor.apply(logit_vector);
+                if (!sequence_group_token_ids) {
+                    logit_processor.apply(logit_vector, running_sequence->get_id());
+                }
                 
                 Token sampled_token;
                 bool is_generate_n_tokens = false;
                 if (sampling_params.is_greedy_decoding()) {
-                    sampled_token = { _greedy_sample(logit_vector, sampling_params.logprobs) };
+                    if (sequence_group_token_ids) {
+                        // the token was selected by the model, the logit vector holds its log probability
+                        size_t token_id_idx = running_sequence_id * output_seq_len + output_seq_len - logit_token_offset - 1;
+                        int64_t token_id = sequence_group_token_ids.data<const int64_t>()[token_id_idx];
+                        sampled_token = Token(sampling_params.logprobs ? logit_vector.m_data[0] : 0.0f, token_id);
+                    } else {
+                        sampled_token = { _greedy_sample(logit_vector, sampling_params.logprobs) };
+                    }
                 } else {
+                    OPENVINO_ASSERT(!sequence_group_token_ids, "Only greedy decoding is supported for device sampled tokens");
                     // is_multinomial()
                     is_generate_n_tokens = sequence_group->num_total_seqs() == 1;
-                    const size_t num_tokens_per_sequence = is_generate_n_tokens ? sampling_params.num_return_sequences : 1;
+                    const size_t num_tokens_per_sequence = is_generate_n_tokens ? std::max(sampling_params.num_return_sequences, sampling_params.best_of) : 1;
                     is_generate_n_tokens &= (num_tokens_per_sequence > 1);
-                    auto sampled_token_ids = _multinomial_sample(logit_vector, num_tokens_per_sequence);
+                    const CounterBasedRandom rng(seed, {sequence_group->get_request_id(), running_sequence->get_grouped_id(), generated_and_verified_len});
+                    auto sampled_token_ids = _multinomial_sample(logit_vector, num_tokens_per_sequence, rng);
                     OPENVINO_ASSERT(sampled_token_ids.size(), num_tokens_per_sequence);
                     // to create n sequence just in case of `sequence_group->num_total_seqs() == 1` and `sampling_params.num_return_sequences > 1`
                     if (is_generate_n_tokens) {
@@ -873,6 +903,14 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                                
                 // to exit from sampling in case of failed token validation
                 if (!is_validation_passed) {
+                    // the predictions at the positions of the rejected candidates are the next guess of lookahead decoding
+                    if (sampling_params.is_prompt_lookup()) {
+                        TokenIds lookahead_tokens;
+                        for (size_t offset = logit_token_offset; offset-- > 0;) {
+                            lookahead_tokens.push_back(_greedy_sample(_get_logit_vector(sequence_group_logits, running_sequence_id, offset), 0).m_index);
+                        }
+                        running_sequence->set_lookahead_tokens(std::move(lookahead_tokens));
+                    }
                     break;
                 } else {
                     auto sampling_params = sequence_group->get_sampling_parameters();
@@ -883,12 +921,28 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                     }
                 }
             }
+            // the grammar state is shared by the sequences of the group, so only a single sequence can jump forward;
+            // the forced tokens are validated by the next step, which skips sampling at their positions
+            if (m_is_jump_forward_enabled && !is_validation_mode_enabled && !running_sequence->has_finished() &&
+                sequence_group->num_total_seqs() == 1 && !sampling_params.is_assisting_generation() &&
+                sampling_params.stop_strings.empty() && !sequence_group_token_ids) {
+                const size_t max_num_forced_tokens = std::min(m_max_jump_forward_len,
+                    sequence_group->get_max_new_tokens() - running_sequence->get_generated_len());
+                const auto forced_tokens = logit_processor.jump_forward(running_sequence->get_id(), max_num_forced_tokens);
+                for (int64_t forced_token_id : forced_tokens) {
+                    running_sequence->append_token(forced_token_id, 0.0f);
+                }
+                sg_sampling_info.num_jump_forward_tokens = forced_tokens.size();
+            }
             assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, running_sequence->get_generated_len());
         }
         align_all_sequence_len(sequence_group, assisting_pipeline_info.min_generated_len, logit_processor);
         for (const auto& dropped_seq_id : _try_finish_generation(sequence_group)) {
             sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
         }
+        for (const auto& dropped_seq_id : prune_best_of_sequences(sequence_group)) {
+            sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
+        }
     } else if (sampling_params.is_beam_search()) {
         uint64_t request_id = sequence_group->get_request_id();
 
@@ -920,16 +974,102 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
     return sg_sampling_info;
 }
 
+const StopStringMatcher& Sampler::_get_stop_strings(const SequenceGroup::Ptr& sequence_group) {
+    const auto request_id = sequence_group->get_request_id();
+    auto it = m_stop_strings.find(request_id);
+    if (it == m_stop_strings.end()) {
+        auto processed_stop_string = process_stop_strings(sequence_group->get_sampling_parameters().stop_strings, m_tokenizer, m_stop_string_encoded_lens);
+        it = m_stop_strings.insert({request_id, processed_stop_string}).first;
+        sequence_group->set_stream_window_size(processed_stop_string.get_max_encoded_len());
+    }
+    return it->second;
+}
+
+std::optional<std::vector<int64_t>> Sampler::_get_token_healing_ids(const SequenceGroup::Ptr& sequence_group) {
+    const std::optional<int64_t>& token_id = sequence_group->get_token_healing_token_id();
+    if (!token_id) {
+        return std::nullopt;
+    }
+    if (!m_vocab_prefix_index) {
+        m_vocab_prefix_index = std::make_shared<VocabPrefixIndex>(m_tokenizer.get_vocab_vector());
+    }
+    // the removed token itself is among the tokens starting with its text
+    return m_vocab_prefix_index->find_tokens_with_prefix(m_vocab_prefix_index->get_token_text(*token_id));
+}
+
+LogitProcessor Sampler::_create_logit_processor(const SequenceGroup::Ptr& sequence_group) {
+    return LogitProcessor(sequence_group->get_sampling_parameters(), sequence_group->get_prompt_ids(), m_structured_output_controller,
+                          _get_token_healing_ids(sequence_group));
+}
+
+void Sampler::prepare(const std::vector<SequenceGroup::Ptr> & sequence_groups) {
+    std::vector<LogitProcessor*> stateful_logit_processors;
+    for (const auto& sequence_group : sequence_groups) {
+        if (!sequence_group->is_scheduled())
+            continue;
+
+        const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
+        const auto request_id = sequence_group->get_request_id();
+        // structured output controller is created by `sample`, since it requires a vocab size of the logits
+        auto logit_processor_it = m_logit_processors.find(request_id);
+        if (logit_processor_it == m_logit_processors.end() && (m_structured_output_controller || !sampling_params.is_structured_output_generation())) {
+            logit_processor_it = m_logit_processors.emplace(request_id, _create_logit_processor(sequence_group)).first;
+        }
+        if (logit_processor_it != m_logit_processors.end() && logit_processor_it->second.has_stateful_transformers() &&
+            sequence_group->requires_sampling()) {
+            stateful_logit_processors.push_back(&logit_processor_it->second);
+        }
+        _get_stop_strings(sequence_group);
+    }
+
+    // e.g. token bitmasks of structured output requests are filled for all of them at once on the thread pool
+    m_thread_pool.parallel_for(stateful_logit_processors.size(), [&](size_t i) {
+        stateful_logit_processors[i]->prepare();
+    });
+}
+
+bool Sampler::can_use_device_greedy_sampling(const std::vector<SequenceGroup::Ptr> & sequence_groups) {
+    for (const auto& sequence_group : sequence_groups) {
+        if (!sequence_group->is_scheduled())
+            continue;
+        // logit processors of all scheduled groups have to be created, since the logits' vocab size cannot be used for it
+        auto logit_processor_it = m_logit_processors.find(sequence_group->get_request_id());
+        if (logit_processor_it == m_logit_processors.end())
+            return false;
+        // echo requires log probabilities of the prompt tokens computed from the logits
+        if (sequence_group->get_sampling_parameters().echo)
+            return false;
+        if (sequence_group->requires_sampling() &&
+            (!sequence_group->get_sampling_parameters().is_greedy_decoding() || sequence_group->get_num_tokens_to_validate() > 0 ||
+             logit_processor_it->second.has_applicable_transformers()))
+            return false;
+    }
+    return true;
+}
+
 SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_groups,
                               ov::Tensor logits,
-                              bool is_validation_mode_enabled) {
+                              bool is_validation_mode_enabled,
+                              ov::Tensor device_sampled_token_ids) {
     const float * logits_data = logits.data<float>();
     ov::Shape logits_shape = logits.get_shape();
     OPENVINO_ASSERT(logits_shape.size() == 3);
     size_t vocab_size = logits_shape[2];
+    OPENVINO_ASSERT(!device_sampled_token_ids || (vocab_size == 1 && device_sampled_token_ids.get_size() == logits.get_size()),
+                    "Device sampled token ids are expected to correspond to the log probabilities passed as logits");
+
+    struct SamplingTask {
+        SequenceGroup::Ptr sequence_group;
+        ov::Tensor logits;
+        LogitProcessor* logit_processor;
+        const StopStringMatcher* stop_strings;
+        ov::Tensor token_ids;
+    };
+    std::vector<SamplingTask> sampling_tasks;
+    // index of the sampling task of each sequence group, if any
+    std::vector<size_t> sampling_task_ids(sequence_groups.size(), std::numeric_limits<size_t>::max());
 
     SamplerOutput sampler_output;
-    std::unordered_map<uint64_t, std::future<SequenceGroupSamplingInfo>> sg_sampling_future_map;
     for (size_t sequence_group_id = 0, currently_processed_tokens = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
@@ -941,24 +1081,24 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
 
         const auto request_id = sequence_group->get_request_id();
         if (!m_logit_processors.count(request_id)) {
+            OPENVINO_ASSERT(!device_sampled_token_ids, "Sequence groups have to be prepared for sampling with device sampled tokens");
             if (!m_structured_output_controller) {
                 m_structured_output_controller = std::make_shared<StructuredOutputController>(m_tokenizer, vocab_size);
             }
-            m_logit_processors.insert({request_id, LogitProcessor(sampling_params, sequence_group->get_prompt_ids(), m_structured_output_controller)});
+            m_logit_processors.insert({request_id, _create_logit_processor(sequence_group)});
         }
-        if (!m_stop_strings.count(request_id)) {
-            auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
-            m_stop_strings.insert({request_id, processed_stop_string});
-            sequence_group->set_stream_window_size(processed_stop_string.first);
-        }
-        const auto& stop_strings = m_stop_strings.at(request_id);
-        auto& logit_processor = m_logit_processors.at(request_id);
-        const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
-        ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
+        const auto& stop_strings = _get_stop_strings(sequence_group);
         if (sequence_group->requires_sampling()) {
-            // Call sample_from_sequence_group asynchronously
-            sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
-                                                                      logit_processor, stop_strings, is_validation_mode_enabled);
+            const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
+            ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
+            ov::Tensor sequence_group_token_ids;
+            if (device_sampled_token_ids) {
+                sequence_group_token_ids = ov::Tensor(ov::element::i64, ov::Shape{num_running_sequences, output_seq_len, 1},
+                                                      device_sampled_token_ids.data<int64_t>() + currently_processed_tokens);
+            }
+            sampling_task_ids[sequence_group_id] = sampling_tasks.size();
+            sampling_tasks.push_back({sequence_group, sequence_group_logits, &m_logit_processors.at(request_id),
+                                      &stop_strings, sequence_group_token_ids});
         } else {
             // we are in prompt processing phase when prompt is split into chunks and processed step by step
         }
@@ -966,15 +1106,23 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         currently_processed_tokens += output_seq_len * num_running_sequences;
     }
 
+    // Sample sequence groups in parallel, submitting the whole batch to the thread pool at once
+    std::vector<SequenceGroupSamplingInfo> sg_sampling_infos(sampling_tasks.size());
+    m_thread_pool.parallel_for(sampling_tasks.size(), [&](size_t task_id) {
+        const SamplingTask& task = sampling_tasks[task_id];
+        GENAI_TRACE_SCOPE("sampler: sample sequence group", static_cast<int64_t>(task.sequence_group->get_request_id()));
+        sg_sampling_infos[task_id] = sample_from_sequence_group(task.sequence_group, task.logits, *task.logit_processor, *task.stop_strings,
+                                                                is_validation_mode_enabled, task.token_ids);
+    });
+
     // Update sequence groups internal states after sampling is done
-    for (auto& sequence_group : sequence_groups) {
+    for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+        const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
             continue;
         SequenceGroupSamplingInfo sg_sampling_info;
-        const auto request_id = sequence_group->get_request_id();
-        if (sg_sampling_future_map.find(request_id) != sg_sampling_future_map.end()) {
-            // If there is a future assigned to a sequence group we read it's result (blocking if results not available yet)
-            sg_sampling_info = sg_sampling_future_map[request_id].get();
+        if (sampling_task_ids[sequence_group_id] < sampling_tasks.size()) {
+            sg_sampling_info = std::move(sg_sampling_infos[sampling_task_ids[sequence_group_id]]);
             sampler_output.num_generated_tokens += sg_sampling_info.sampler_output.num_generated_tokens;
 
             // Merge sampler output from sequence group to the main one
@@ -995,6 +1143,11 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         // NOTE: it should be before 'get_num_scheduled_tokens' is used
         // update internal state of sequence group to reset scheduler tokens and update currently processed ones
         const AssistingPipelineInfo& assisting_pipeline_info = std::as_const(sg_sampling_info.get_assisting_pipeline_info());
+        if (is_validation_mode_enabled && sequence_group->get_num_tokens_to_validate() > 0) {
+            const size_t num_draft_tokens = sequence_group->get_num_tokens_to_validate();
+            sequence_group->record_draft_validation(num_draft_tokens,
+                num_draft_tokens - std::min(num_draft_tokens, assisting_pipeline_info.max_removed_tokens_per_request));
+        }
         sequence_group->finish_iteration();
         // decrease sequence_group context in case of candidates generated by draft_model were not accepted by main_model
         if (assisting_pipeline_info.max_removed_tokens_per_request) {
@@ -1006,6 +1159,10 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         if (assisting_pipeline_info.updated_validation_len) {
             sequence_group->set_num_validated_tokens(assisting_pipeline_info.updated_validation_len);
         }
+        // the forced tokens have to be taken to KV cache along with the sampled one by the next step
+        if (sg_sampling_info.num_jump_forward_tokens && !sequence_group->has_finished()) {
+            sequence_group->set_num_validated_tokens(sg_sampling_info.num_jump_forward_tokens);
+        }
     }
     return sampler_output;
 }
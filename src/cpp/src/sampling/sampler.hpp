@@ -18,8 +18,12 @@
 
 #include "sampling/logit_transformers.hpp"
 #include "sampling/logit_processor.hpp"
+#include "sampling/counter_based_random.hpp"
+#include "sampling/stop_string_matcher.hpp"
+#include "sampling/vocab_prefix_index.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include "sequence_group.hpp"
+#include "object_pool.hpp"
 #include "threadpool.hpp"
 #include "sampling/structured_output/structured_output_controller.hpp"
 
@@ -35,7 +39,7 @@ inline bool is_stop_token_id_hit(int64_t generated_token, const std::set<int64_t
 
 inline bool is_stop_token_id_hit_in_sequence_group(SequenceGroup::Ptr sequence_group, const std::set<int64_t>& stop_token_ids) {
     for (auto& sequence : sequence_group->get_running_sequences()) {
-        const TokenIds& generated_tokens = sequence->get_generated_ids();
+        const auto& generated_tokens = sequence->get_generated_ids();
         if (!generated_tokens.empty() && is_stop_token_id_hit(generated_tokens.back(), stop_token_ids)) {
             return true;
         }
@@ -64,6 +68,8 @@ struct AssistingPipelineInfo {
 struct SequenceGroupSamplingInfo {
     SamplerOutput sampler_output;
     AssistingPipelineInfo assisting_pipeline_info;
+    // number of tokens forced by the structured output grammar, which were appended after the sampled one
+    size_t num_jump_forward_tokens = 0;
 
     AssistingPipelineInfo& get_assisting_pipeline_info() {
         return assisting_pipeline_info;
@@ -75,46 +81,81 @@ class Sampler {
 
     Logits _get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx);
     Token _greedy_sample(const Logits& logits, size_t top_logprobs) const;
-    std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence);
+    std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence, const CounterBasedRandom& rng);
     std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group);
+    const StopStringMatcher& _get_stop_strings(const SequenceGroup::Ptr& sequence_group);
+    std::optional<std::vector<int64_t>> _get_token_healing_ids(const SequenceGroup::Ptr& sequence_group);
+    LogitProcessor _create_logit_processor(const SequenceGroup::Ptr& sequence_group);
 
     bool validate_candidate(Sequence::Ptr running_sequence, size_t& token_idx, Token& sampled_token,
                             bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample, bool has_real_probolities);
 
     SequenceGroupSamplingInfo sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits,
-                                                        LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings,
-                                                        bool is_validation_mode_enabled);
+                                                        LogitProcessor& logit_processor, const StopStringMatcher& stop_strings,
+                                                        bool is_validation_mode_enabled, ov::Tensor sequence_group_token_ids);
 
     // request ID => beam search tracking information
     std::map<uint64_t, GroupBeamSearcher> m_beam_search_info;
     std::mutex m_beam_search_info_mutex;
 
-    std::mt19937 rng_engine;
-    size_t seed = rng_engine.default_seed;
+    // random values are drawn from streams identified by the seed, request id, id of the sequence within the request
+    // and token position (see CounterBasedRandom), so the sequences may be sampled in parallel, in any order and
+    // regardless of the other requests of the batch
+    size_t seed = std::mt19937::default_seed;
     // { request_id, logit_processor }
-    std::map<uint64_t, LogitProcessor> m_logit_processors;
-    // { request_id, { max_encoded_len, { stop_strings }}}
-    std::map<int64_t, std::pair<size_t, std::set<std::string>>> m_stop_strings;
+    // the map nodes of the requests are pooled
+    std::map<uint64_t, LogitProcessor, std::less<uint64_t>, PoolAllocator<std::pair<const uint64_t, LogitProcessor>>> m_logit_processors;
+    // { request_id, stop strings matcher }
+    std::map<int64_t, StopStringMatcher> m_stop_strings;
+    // { stop string, its length in tokens }, shared by the requests, since encoding the stop strings is expensive
+    std::unordered_map<std::string, size_t> m_stop_string_encoded_lens;
+    // lazily created for the first request with token healing
+    std::shared_ptr<VocabPrefixIndex> m_vocab_prefix_index;
 
     Tokenizer m_tokenizer;
 
     ThreadPool m_thread_pool;
     std::shared_ptr<ov::genai::StructuredOutputController> m_structured_output_controller;
+
+    // whether the tokens forced by structured output grammars are appended to the sequences at once (jump-forward decoding);
+    // requires a pipeline, which processes them as a chunk scheduled along with the next generated token
+    bool m_is_jump_forward_enabled = false;
+    static constexpr size_t m_max_jump_forward_len = 32;
 public:
     Sampler(const Sampler& rhs) = delete;
     Sampler(Sampler&& rhs) = delete;
     Sampler(size_t num_threads = 1): m_thread_pool(num_threads) {};
     explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads) {};
 
-    SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false);
+    // if `device_sampled_token_ids` are passed, the next tokens were already selected by the model (see `can_use_device_greedy_sampling`)
+    // and `logits` hold their log probabilities instead of scores over the whole vocabulary
+    SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false,
+                         ov::Tensor device_sampled_token_ids = {});
+    // whether the next tokens of scheduled sequence groups may be the ones selected by the model with greedy sampling
+    // (see utils::apply_device_greedy_sampling_transformation), i.e. all of them use greedy decoding and have no logit
+    // transformations to apply; expects the sequence groups to be prepared
+    bool can_use_device_greedy_sampling(const std::vector<SequenceGroup::Ptr> & sequence_groups);
+    // sets up per-request sampling state of scheduled sequence groups (logit processors including structured output grammars, stop strings)
+    // which is otherwise done by the first `sample` call for a request; allows to do it while the model is being inferred
+    void prepare(const std::vector<SequenceGroup::Ptr> & sequence_groups);
     void set_seed(size_t new_seed) {
-        rng_engine.seed(new_seed);
         seed = new_seed;
     }
     size_t get_seed() { return seed; }
 
+    void set_jump_forward_enabled(bool is_enabled) {
+        m_is_jump_forward_enabled = is_enabled;
+    }
+
+    // the pool is also used by the pipeline for other per-step work which is done while sampling is idle
+    ThreadPool& get_thread_pool() {
+        return m_thread_pool;
+    }
+
     void set_tokenizer(const Tokenizer& tokenizer) {
         m_tokenizer = tokenizer;
+        m_stop_string_encoded_lens.clear();
+        m_vocab_prefix_index.reset();
     }
 
     void clear_request_info(uint64_t request_id);
@@ -168,7 +209,7 @@ class Sampler::GroupBeamSearcher {
 public:
     explicit GroupBeamSearcher(SequenceGroup::Ptr sequence_group, Tokenizer tokenizer);
 
-    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings);
+    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const StopStringMatcher& stop_strings);
     void finalize(SamplerOutput& sampler_output);
     std::map<size_t, int32_t> get_beam_idxs();
 };
@@ -0,0 +1,201 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace ov::genai {
+
+/**
+ * Kernels over the vocabulary-sized logit buffers used on the sampling hot path. The loops process the data in fixed-size
+ * chunks with independent per-lane accumulators and avoid calls to libm, so that the compiler is able to vectorize them
+ * for whichever instruction set the library is built for (SSE / AVX2 / AVX-512 / NEON) without relying on fast-math.
+ */
+namespace sampling_kernels {
+
+constexpr size_t LANES = 16;
+
+/**
+ * Computes exp(x) with a polynomial approximation (max relative error ~1e-7), which, unlike std::exp, can be inlined
+ * and vectorized. Expects x <= 88, arguments below the smallest normal float result (including -inf) produce 0.
+ * The clamping is done on the bit representation - floating point comparisons may raise exceptions, which prevents
+ * the compiler from turning them into a branchless select unless built with -fno-trapping-math.
+ */
+inline float fast_exp(float x) {
+    constexpr uint32_t min_x_bits = 0xC2AEAC50u;  // -87.33654f, the bit patterns of smaller negative values are larger
+    constexpr float log2e = 1.44269504088896341f, ln2_hi = 0.693359375f, ln2_lo = -2.12194440e-4f;
+    constexpr float round_magic = 12582912.0f;  // 1.5 * 2^23
+
+    uint32_t x_bits;
+    std::memcpy(&x_bits, &x, sizeof(x));
+    const uint32_t in_range_mask = x_bits > min_x_bits ? 0u : ~0u;
+    x_bits = (x_bits & in_range_mask) | (min_x_bits & ~in_range_mask);
+    std::memcpy(&x, &x_bits, sizeof(x));
+
+    // x = n * ln2 + r, |r| <= ln2 / 2
+    const float n = (x * log2e + round_magic) - round_magic;
+    const float r = x - n * ln2_hi - n * ln2_lo;
+
+    float p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    p = p * r * r + r + 1.0f;
+
+    const int32_t exponent_bits = (static_cast<int32_t>(n) + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &exponent_bits, sizeof(scale));
+    float result = p * scale;
+
+    uint32_t result_bits;
+    std::memcpy(&result_bits, &result, sizeof(result));
+    result_bits &= in_range_mask;
+    std::memcpy(&result, &result_bits, sizeof(result));
+    return result;
+}
+
+/**
+ * @return The maximum of the values, or -inf for an empty range.
+ */
+inline float reduce_max(const float* data, size_t size) {
+    float lane_max[LANES];
+    std::fill_n(lane_max, LANES, -std::numeric_limits<float>::infinity());
+    const size_t chunked_size = size - size % LANES;
+    for (size_t i = 0; i < chunked_size; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            lane_max[lane] = data[i + lane] > lane_max[lane] ? data[i + lane] : lane_max[lane];
+        }
+    }
+    for (size_t i = chunked_size; i < size; ++i) {
+        lane_max[0] = data[i] > lane_max[0] ? data[i] : lane_max[0];
+    }
+    return *std::max_element(lane_max, lane_max + LANES);
+}
+
+/**
+ * @return The sum of exp((x - shift) * scale) over the values, computed without modifying them.
+ */
+inline float sum_exp(const float* data, size_t size, float shift, float scale = 1.0f) {
+    float lane_sum[LANES] = {};
+    const size_t chunked_size = size - size % LANES;
+    for (size_t i = 0; i < chunked_size; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            lane_sum[lane] += fast_exp((data[i + lane] - shift) * scale);
+        }
+    }
+    for (size_t i = chunked_size; i < size; ++i) {
+        lane_sum[0] += fast_exp((data[i] - shift) * scale);
+    }
+    float sum = 0.0f;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        sum += lane_sum[lane];
+    }
+    return sum;
+}
+
+/**
+ * Replaces each value x with exp((x - shift) * scale) in place.
+ * @return The sum of the new values.
+ */
+inline float exp_inplace(float* data, size_t size, float shift, float scale = 1.0f) {
+    float lane_sum[LANES] = {};
+    const size_t chunked_size = size - size % LANES;
+    for (size_t i = 0; i < chunked_size; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            data[i + lane] = fast_exp((data[i + lane] - shift) * scale);
+            lane_sum[lane] += data[i + lane];
+        }
+    }
+    for (size_t i = chunked_size; i < size; ++i) {
+        data[i] = fast_exp((data[i] - shift) * scale);
+        lane_sum[0] += data[i];
+    }
+    float sum = 0.0f;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        sum += lane_sum[lane];
+    }
+    return sum;
+}
+
+inline void multiply_inplace(float* data, size_t size, float factor) {
+    for (size_t i = 0; i < size; ++i) {
+        data[i] *= factor;
+    }
+}
+
+/**
+ * @return Whether any of the LANES values starting at `data` is greater than `threshold`.
+ */
+inline bool any_greater(const float* data, float threshold) {
+    // compares the bit patterns mapped to integers of the same order as the floats, see fast_exp for the reason
+    auto to_ordered_int = [](float value) {
+        int32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits ^ ((bits >> 31) & 0x7FFFFFFF);
+    };
+    const int32_t ordered_threshold = to_ordered_int(threshold);
+    // per-lane flags are combined word-wise rather than with a reduction loop, which is vectorized more reliably
+    static_assert(LANES % 2 == 0);
+    int32_t is_greater[LANES];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        is_greater[lane] = to_ordered_int(data[lane]) > ordered_threshold;
+    }
+    uint64_t any = 0;
+    for (size_t lane = 0; lane < LANES; lane += 2) {
+        uint64_t two_flags;
+        std::memcpy(&two_flags, is_greater + lane, sizeof(two_flags));
+        any |= two_flags;
+    }
+    return any != 0;
+}
+
+/**
+ * Selects the `m` largest values in descending order; among equal values the one with the lower index goes first.
+ * Each chunk is first compared against the current m-th value as a whole, so that the chunks which cannot contribute
+ * to the top-m are skipped without the scalar insertion - for m << size this is the case for almost all of them.
+ * @param values Output buffer of size `m`, receiving the selected values (-inf if size < m).
+ * @param indexes Output buffer of size `m`, receiving the indexes of the selected values (0 if size < m).
+ * @return The number of the selected values, i.e. the ones above -inf: the masked values are never selected, so the slots
+ * after them are left with -inf and 0 index.
+ */
+inline size_t top_m(const float* data, size_t size, size_t m, float* values, size_t* indexes) {
+    std::fill_n(values, m, -std::numeric_limits<float>::infinity());
+    std::fill_n(indexes, m, 0);
+    if (m == 0) {
+        return 0;
+    }
+
+    auto insert = [&](size_t idx) {
+        if (data[idx] > values[m - 1]) {
+            values[m - 1] = data[idx];
+            indexes[m - 1] = idx;
+            for (size_t j = m - 1; j > 0 && values[j] > values[j - 1]; --j) {
+                std::swap(values[j], values[j - 1]);
+                std::swap(indexes[j], indexes[j - 1]);
+            }
+        }
+    };
+
+    const size_t chunked_size = size - size % LANES;
+    for (size_t i = 0; i < chunked_size; i += LANES) {
+        if (any_greater(data + i, values[m - 1])) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                insert(i + lane);
+            }
+        }
+    }
+    for (size_t i = chunked_size; i < size; ++i) {
+        insert(i);
+    }
+    return std::find(values, values + m, -std::numeric_limits<float>::infinity()) - values;
+}
+
+}  // namespace sampling_kernels
+}  // namespace ov::genai
@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * Matches a set of stop strings against decoded text with an Aho-Corasick automaton, which is built once per request
+ * and finds the first occurrence of any of the stop strings in a single pass over the text, instead of searching the
+ * text for each stop string separately.
+ */
+class StopStringMatcher {
+public:
+    struct Match {
+        size_t pos = std::string::npos;
+        size_t length = 0;
+    };
+
+    StopStringMatcher() : m_nodes(1) {}
+
+    /**
+     * @param stop_strings Strings to match, empty ones are ignored.
+     * @param max_encoded_len The maximum length of the stop strings in tokens, it defines the number of last generated
+     * tokens to be decoded to look for the stop strings.
+     */
+    StopStringMatcher(const std::set<std::string>& stop_strings, size_t max_encoded_len)
+        : m_nodes(1), m_max_encoded_len(max_encoded_len) {
+        for (const auto& stop_string : stop_strings) {
+            if (stop_string.empty())
+                continue;
+            size_t node_id = 0;
+            for (char c : stop_string) {
+                auto it = m_nodes[node_id].children.find(c);
+                if (it != m_nodes[node_id].children.end()) {
+                    node_id = it->second;
+                } else {
+                    m_nodes[node_id].children.emplace(c, m_nodes.size());
+                    node_id = m_nodes.size();
+                    m_nodes.emplace_back();
+                }
+            }
+            m_nodes[node_id].match_length = stop_string.size();
+            m_num_stop_strings++;
+        }
+
+        // breadth-first traversal, so that the failure links point to already processed nodes
+        std::queue<size_t> nodes_to_process;
+        for (const auto& [c, child_id] : m_nodes[0].children) {
+            nodes_to_process.push(child_id);
+        }
+        while (!nodes_to_process.empty()) {
+            size_t node_id = nodes_to_process.front();
+            nodes_to_process.pop();
+            for (const auto& [c, child_id] : m_nodes[node_id].children) {
+                m_nodes[child_id].failure = next(m_nodes[node_id].failure, c);
+                // the stop string ending at the node itself is longer than any of its suffixes
+                if (m_nodes[child_id].match_length == 0) {
+                    m_nodes[child_id].match_length = m_nodes[m_nodes[child_id].failure].match_length;
+                }
+                nodes_to_process.push(child_id);
+            }
+        }
+    }
+
+    bool empty() const {
+        return m_num_stop_strings == 0;
+    }
+
+    size_t get_max_encoded_len() const {
+        return m_max_encoded_len;
+    }
+
+    /**
+     * @return The stop string occurrence which ends first in the text (the longest one if several end at the same
+     * position), i.e. the one which would be detected first if the text was checked after each generated character.
+     * Match::pos is std::string::npos if there are no occurrences.
+     */
+    Match find(const std::string& text) const {
+        Match match;
+        if (empty())
+            return match;
+        size_t node_id = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            node_id = next(node_id, text[i]);
+            if (size_t match_length = m_nodes[node_id].match_length) {
+                match.pos = i + 1 - match_length;
+                match.length = match_length;
+                return match;
+            }
+        }
+        return match;
+    }
+
+private:
+    struct Node {
+        std::map<char, size_t> children;
+        size_t failure = 0;
+        // length of the longest stop string which is a suffix of the node's prefix, 0 if none
+        size_t match_length = 0;
+    };
+
+    size_t next(size_t node_id, char c) const {
+        while (true) {
+            auto it = m_nodes[node_id].children.find(c);
+            if (it != m_nodes[node_id].children.end())
+                return it->second;
+            if (node_id == 0)
+                return 0;
+            node_id = m_nodes[node_id].failure;
+        }
+    }
+
+    std::vector<Node> m_nodes;
+    size_t m_num_stop_strings = 0;
+    size_t m_max_encoded_len = 0;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,293 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sampling/structured_output/json_event_parser.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+// MSVC with /utf-8 fails to compile � directly with newline in string literal error.
+constexpr char replacement[] = "\xef\xbf\xbd";
+
+bool is_whitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool is_literal_char(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '+' || c == '-' || c == '.';
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+std::vector<JsonEvent> JsonEventParser::feed(std::string_view text) {
+    for (char c : text) {
+        process(c);
+    }
+    if (m_state == State::STRING && !m_is_key) {
+        emit_string_chunk();
+    }
+    return std::exchange(m_events, {});
+}
+
+std::vector<JsonEvent> JsonEventParser::finish() {
+    if (m_state == State::LITERAL) {
+        complete_literal();
+    }
+    return std::exchange(m_events, {});
+}
+
+bool JsonEventParser::is_complete() const {
+    return m_frames.empty() && m_state == State::AFTER_VALUE;
+}
+
+void JsonEventParser::process(char c) {
+    if (m_state == State::STRING) {
+        process_string(c);
+        return;
+    }
+    if (m_state == State::LITERAL) {
+        if (is_literal_char(c)) {
+            m_text += c;
+            return;
+        }
+        // the character after a number or a literal is parsed in the state after the value
+        complete_literal();
+    }
+    if (is_whitespace(c)) {
+        return;
+    }
+
+    switch (m_state) {
+    case State::VALUE:
+        start_value(c);
+        break;
+    case State::ARRAY_VALUE_OR_END:
+        if (c == ']') {
+            end_container(JsonEventType::ARRAY_END);
+        } else {
+            start_value(c);
+        }
+        break;
+    case State::OBJECT_KEY_OR_END:
+    case State::OBJECT_KEY:
+        if (c == '}' && m_state == State::OBJECT_KEY_OR_END) {
+            end_container(JsonEventType::OBJECT_END);
+        } else {
+            OPENVINO_ASSERT(c == '"', "JsonStreamer: expected an object key, got '", c, "'");
+            m_is_key = true;
+            m_text.clear();
+            m_state = State::STRING;
+        }
+        break;
+    case State::COLON:
+        OPENVINO_ASSERT(c == ':', "JsonStreamer: expected ':' after an object key, got '", c, "'");
+        m_state = State::VALUE;
+        break;
+    case State::AFTER_VALUE:
+        if (m_frames.empty()) {
+            // the next value of a sequence of JSON values
+            start_value(c);
+        } else if (m_frames.back().is_object) {
+            if (c == ',') {
+                m_state = State::OBJECT_KEY;
+            } else {
+                OPENVINO_ASSERT(c == '}', "JsonStreamer: expected ',' or '}' after an object value, got '", c, "'");
+                end_container(JsonEventType::OBJECT_END);
+            }
+        } else {
+            if (c == ',') {
+                ++m_frames.back().index;
+                m_state = State::VALUE;
+            } else {
+                OPENVINO_ASSERT(c == ']', "JsonStreamer: expected ',' or ']' after an array value, got '", c, "'");
+                end_container(JsonEventType::ARRAY_END);
+            }
+        }
+        break;
+    default:
+        OPENVINO_THROW("JsonStreamer: internal error, unexpected parser state");
+    }
+}
+
+void JsonEventParser::start_value(char c) {
+    if (c == '{') {
+        m_events.push_back({JsonEventType::OBJECT_START, get_path(), {}, false});
+        m_frames.push_back({true, {}, 0});
+        m_state = State::OBJECT_KEY_OR_END;
+    } else if (c == '[') {
+        m_events.push_back({JsonEventType::ARRAY_START, get_path(), {}, false});
+        m_frames.push_back({false, {}, 0});
+        m_state = State::ARRAY_VALUE_OR_END;
+    } else if (c == '"') {
+        m_is_key = false;
+        m_value_path = get_path();
+        m_text.clear();
+        m_num_emitted_chars = 0;
+        m_state = State::STRING;
+    } else {
+        OPENVINO_ASSERT(c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n',
+            "JsonStreamer: unexpected character '", c, "' at the start of a JSON value");
+        m_value_path = get_path();
+        m_text = c;
+        m_state = State::LITERAL;
+    }
+}
+
+void JsonEventParser::end_container(JsonEventType type) {
+    m_frames.pop_back();
+    m_events.push_back({type, get_path(), {}, false});
+    end_value();
+}
+
+void JsonEventParser::end_value() {
+    m_state = State::AFTER_VALUE;
+}
+
+void JsonEventParser::process_string(char c) {
+    if (m_num_hex_digits_left > 0) {
+        uint32_t digit;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            OPENVINO_THROW("JsonStreamer: invalid hex digit '", c, "' in a \\u escape");
+        }
+        m_code_point = m_code_point * 16 + digit;
+        if (--m_num_hex_digits_left == 0) {
+            append_code_point(m_code_point);
+        }
+        return;
+    }
+
+    if (m_is_escape) {
+        m_is_escape = false;
+        if (c == 'u') {
+            m_num_hex_digits_left = 4;
+            m_code_point = 0;
+            return;
+        }
+        flush_high_surrogate();
+        switch (c) {
+        case '"': case '\\': case '/': m_text += c; break;
+        case 'b': m_text += '\b'; break;
+        case 'f': m_text += '\f'; break;
+        case 'n': m_text += '\n'; break;
+        case 'r': m_text += '\r'; break;
+        case 't': m_text += '\t'; break;
+        default: OPENVINO_THROW("JsonStreamer: invalid escape '\\", c, "'");
+        }
+        return;
+    }
+
+    if (c == '\\') {
+        m_is_escape = true;
+        return;
+    }
+    flush_high_surrogate();
+    if (c == '"') {
+        complete_string();
+    } else {
+        // the bytes of the text are UTF-8 already
+        m_text += c;
+    }
+}
+
+void JsonEventParser::flush_high_surrogate() {
+    // a high surrogate, which isn't followed by a low one
+    if (m_high_surrogate != 0) {
+        m_high_surrogate = 0;
+        m_text += replacement;
+    }
+}
+
+void JsonEventParser::append_code_point(uint32_t code_point) {
+    if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+        flush_high_surrogate();
+        m_high_surrogate = code_point;
+        return;
+    }
+    if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+        code_point = m_high_surrogate != 0 ? 0x10000 + ((m_high_surrogate - 0xD800) << 10) + (code_point - 0xDC00) : 0xFFFD;
+        m_high_surrogate = 0;
+    } else {
+        flush_high_surrogate();
+    }
+
+    if (code_point < 0x80) {
+        m_text += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        m_text += static_cast<char>(0xC0 | (code_point >> 6));
+        m_text += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        m_text += static_cast<char>(0xE0 | (code_point >> 12));
+        m_text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        m_text += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+        m_text += static_cast<char>(0xF0 | (code_point >> 18));
+        m_text += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        m_text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        m_text += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+void JsonEventParser::complete_string() {
+    if (m_is_key) {
+        m_frames.back().key = m_text;
+        m_state = State::COLON;
+        return;
+    }
+    emit_string_chunk();
+    m_events.push_back({JsonEventType::VALUE, m_value_path, m_text, true});
+    end_value();
+}
+
+void JsonEventParser::complete_literal() {
+    if (m_text[0] == 't' || m_text[0] == 'f' || m_text[0] == 'n') {
+        OPENVINO_ASSERT(m_text == "true" || m_text == "false" || m_text == "null", "JsonStreamer: invalid literal '", m_text, "'");
+    } else {
+        OPENVINO_ASSERT(std::all_of(m_text.begin(), m_text.end(), [](char c) {
+            return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+        }), "JsonStreamer: invalid number '", m_text, "'");
+    }
+    m_events.push_back({JsonEventType::VALUE, m_value_path, m_text, false});
+    end_value();
+}
+
+void JsonEventParser::emit_string_chunk() {
+    if (m_num_emitted_chars < m_text.size()) {
+        m_events.push_back({JsonEventType::STRING_CHUNK, m_value_path, m_text.substr(m_num_emitted_chars), true});
+        m_num_emitted_chars = m_text.size();
+    }
+}
+
+std::string JsonEventParser::get_path() const {
+    std::string path;
+    for (const Frame& frame : m_frames) {
+        path += '/';
+        if (!frame.is_object) {
+            path += std::to_string(frame.index);
+            continue;
+        }
+        for (char c : frame.key) {
+            if (c == '~') {
+                path += "~0";
+            } else if (c == '/') {
+                path += "~1";
+            } else {
+                path += c;
+            }
+        }
+    }
+    return path;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,83 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "openvino/genai/json_streamer.hpp"
+
+namespace ov::genai {
+
+/**
+ * Parses JSON text fed by parts into JsonEvent-s, keeping the state of the parsing between the parts, so that each
+ * character is parsed once however the text is split. Throws on the characters, which can't continue JSON.
+ */
+class JsonEventParser {
+public:
+    /**
+     * @return The events completed by the text, and a STRING_CHUNK event for a string left incomplete.
+     */
+    std::vector<JsonEvent> feed(std::string_view text);
+
+    /**
+     * @return The event of a number or a literal at the end of the text, which isn't followed by a delimiter.
+     */
+    std::vector<JsonEvent> finish();
+
+    /**
+     * @return Whether a JSON value was parsed and no other value is started after it.
+     */
+    bool is_complete() const;
+
+private:
+    enum class State {
+        VALUE,
+        ARRAY_VALUE_OR_END,
+        OBJECT_KEY_OR_END,
+        OBJECT_KEY,
+        COLON,
+        AFTER_VALUE,
+        STRING,
+        LITERAL
+    };
+
+    struct Frame {
+        bool is_object;
+        // the key of the current value of an object
+        std::string key;
+        // the index of the current value of an array
+        size_t index = 0;
+    };
+
+    void process(char c);
+    void start_value(char c);
+    void end_container(JsonEventType type);
+    void end_value();
+    void process_string(char c);
+    void flush_high_surrogate();
+    void append_code_point(uint32_t code_point);
+    void complete_string();
+    void complete_literal();
+    void emit_string_chunk();
+    std::string get_path() const;
+
+    std::vector<Frame> m_frames;
+    State m_state = State::VALUE;
+    std::vector<JsonEvent> m_events;
+
+    // the string or the literal being parsed
+    std::string m_text;
+    bool m_is_key = false;
+    std::string m_value_path;
+    size_t m_num_emitted_chars = 0;
+    bool m_is_escape = false;
+    size_t m_num_hex_digits_left = 0;
+    uint32_t m_code_point = 0;
+    uint32_t m_high_surrogate = 0;
+};
+
+}  // namespace ov::genai
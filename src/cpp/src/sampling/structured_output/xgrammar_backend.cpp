@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "xgrammar_backend.hpp"
+#include <algorithm>
 #include <iostream>
 
 namespace ov {
@@ -31,33 +32,63 @@ XGrammarStructuredOutput::get_logits_transformer(const GenerationConfig& samplin
     auto& structured_output_config = *sampling_parameters.structured_output_config;
     structured_output_config.validate();
 
-    // Default constructor for xgrammar::Grammar is not enabled,
-    // create explicitly an empty grammar.
-    xgrammar::Grammar grammar = xgrammar::Grammar::FromEBNF("root ::= root");
-
+    // The cache key is the grammar definition prefixed with its kind, since e.g. the same string may be both a regex and EBNF
+    std::string grammar_key;
     if (structured_output_config.json_schema.has_value()) {
-        grammar = xgrammar::Grammar::FromJSONSchema(*structured_output_config.json_schema);
+        grammar_key = "json_schema:" + *structured_output_config.json_schema;
     } else if (structured_output_config.regex.has_value()) {
-        grammar = xgrammar::Grammar::FromRegex(*structured_output_config.regex);
+        grammar_key = "regex:" + *structured_output_config.regex;
     } else if (structured_output_config.grammar.has_value()) {
-        grammar = xgrammar::Grammar::FromEBNF(*structured_output_config.grammar);
+        grammar_key = "ebnf:" + *structured_output_config.grammar;
     } else if (structured_output_config.structural_tags_config.has_value()) {
-        std::vector<xgrammar::StructuralTagItem> xgrammar_structural_tags;
+        grammar_key = "structural_tags:";
         for (const auto& tag : structured_output_config.structural_tags_config->structural_tags) {
-            auto structural_tag = xgrammar::StructuralTagItem{tag.begin, tag.schema, tag.end};
-            xgrammar_structural_tags.push_back(std::move(structural_tag));
+            for (const auto& part : {tag.begin, tag.schema, tag.end}) {
+                grammar_key += std::to_string(part.size()) + ":" + part;
+            }
+        }
+        for (const auto& trigger : structured_output_config.structural_tags_config->triggers) {
+            grammar_key += std::to_string(trigger.size()) + ":" + trigger;
         }
-        grammar = xgrammar::Grammar::FromStructuralTag(
-            xgrammar_structural_tags, structured_output_config.structural_tags_config->triggers
-        );
     } else {
         OPENVINO_THROW("No grammar definition provided for structured output generation.");
     }
 
-    auto compiled_grammar = m_grammar_compiler->CompileGrammar(grammar);
+    auto compiled_grammar_it = m_compiled_grammars.find(grammar_key);
+    if (compiled_grammar_it == m_compiled_grammars.end()) {
+        // Default constructor for xgrammar::Grammar is not enabled,
+        // create explicitly an empty grammar.
+        xgrammar::Grammar grammar = xgrammar::Grammar::FromEBNF("root ::= root");
+
+        if (structured_output_config.json_schema.has_value()) {
+            grammar = xgrammar::Grammar::FromJSONSchema(*structured_output_config.json_schema);
+        } else if (structured_output_config.regex.has_value()) {
+            grammar = xgrammar::Grammar::FromRegex(*structured_output_config.regex);
+        } else if (structured_output_config.grammar.has_value()) {
+            grammar = xgrammar::Grammar::FromEBNF(*structured_output_config.grammar);
+        } else {
+            std::vector<xgrammar::StructuralTagItem> xgrammar_structural_tags;
+            for (const auto& tag : structured_output_config.structural_tags_config->structural_tags) {
+                auto structural_tag = xgrammar::StructuralTagItem{tag.begin, tag.schema, tag.end};
+                xgrammar_structural_tags.push_back(std::move(structural_tag));
+            }
+            grammar = xgrammar::Grammar::FromStructuralTag(
+                xgrammar_structural_tags, structured_output_config.structural_tags_config->triggers
+            );
+        }
+
+        if (m_compiled_grammars.size() == m_max_compiled_grammars) {
+            m_compiled_grammars.erase(m_compiled_grammars_order.front());
+            m_compiled_grammars_order.pop_front();
+        }
+        compiled_grammar_it = m_compiled_grammars.emplace(grammar_key, m_grammar_compiler->CompileGrammar(grammar)).first;
+        m_compiled_grammars_order.push_back(grammar_key);
+    }
+    const xgrammar::CompiledGrammar& compiled_grammar = compiled_grammar_it->second;
+
     std::vector<int> override_stop_tokens(sampling_parameters.stop_token_ids.begin(), sampling_parameters.stop_token_ids.end());
     
-    return std::make_shared<LogitTransformers::XGrammarLogitsTransformer>(std::move(compiled_grammar), override_stop_tokens);
+    return std::make_shared<LogitTransformers::XGrammarLogitsTransformer>(compiled_grammar, override_stop_tokens);
 }
 
 namespace LogitTransformers {
@@ -72,7 +103,7 @@ XGrammarLogitsTransformer::XGrammarLogitsTransformer(
       override_stop_tokens,
       terminate_without_stop_token,
       max_rollback_tokens
-  ) {
+  ), m_stop_token_ids(override_stop_tokens.value_or(std::vector<int>{})) {
     m_vocab_size = compiled_grammar.GetTokenizerInfo().GetVocabSize();
     
     // Divide vocab into 32 for bitmask and ceil to the nearest integer
@@ -108,17 +139,63 @@ void XGrammarLogitsTransformer::accept_tokens(const TokenIds& input_ids) {
     for (const auto& token : input_ids) {
         m_grammar_matcher.AcceptToken(token);
     }
+    m_is_bitmask_filled = false;
+}
+
+void XGrammarLogitsTransformer::prepare() {
+    if (!m_is_bitmask_filled) {
+        m_grammar_matcher.FillNextTokenBitmask(m_token_bitmask.get());
+        m_is_bitmask_filled = true;
+    }
 }
 
 void XGrammarLogitsTransformer::apply(Logits& logits) {
     m_next_token_logits->data = logits.m_data;
 
-    m_grammar_matcher.FillNextTokenBitmask(m_token_bitmask.get());
+    prepare();
     if (!m_grammar_matcher.IsTerminated()) {
         xgrammar::ApplyTokenBitmaskInplaceCPU(m_next_token_logits.get(), *m_token_bitmask, m_vocab_size);
     }
 }
 
+TokenIds XGrammarLogitsTransformer::jump_forward(size_t max_num_tokens) {
+    TokenIds forced_tokens;
+    const uint32_t* bitmask = reinterpret_cast<const uint32_t*>(m_token_bitmask_ov.data<int32_t>());
+    const size_t bitmask_size = m_token_bitmask_ov.get_size();
+    while (forced_tokens.size() < max_num_tokens && !m_grammar_matcher.IsTerminated()) {
+        prepare();
+        // the continuation is forced, if exactly one bit within the vocabulary is set
+        int64_t forced_token_id = -1;
+        for (size_t i = 0; i < bitmask_size; ++i) {
+            uint32_t word = bitmask[i];
+            if (i + 1 == bitmask_size && m_vocab_size % 32 != 0) {
+                word &= (uint32_t{1} << (m_vocab_size % 32)) - 1;
+            }
+            if (word == 0) {
+                continue;
+            }
+            if (forced_token_id != -1 || (word & (word - 1)) != 0) {
+                forced_token_id = -1;
+                break;
+            }
+            size_t bit = 0;
+            while ((word >> bit & 1) == 0) {
+                ++bit;
+            }
+            forced_token_id = static_cast<int64_t>(i * 32 + bit);
+        }
+        // a forced stop token is left to the sampler, which finishes the sequence
+        if (forced_token_id == -1 ||
+            std::find(m_stop_token_ids.begin(), m_stop_token_ids.end(), forced_token_id) != m_stop_token_ids.end()) {
+            break;
+        }
+        m_grammar_matcher.AcceptToken(static_cast<int32_t>(forced_token_id));
+        m_is_bitmask_filled = false;
+        forced_tokens.push_back(forced_token_id);
+    }
+    return forced_tokens;
+}
+
 } // namespace LogitTransformers
 
 } // namespace genai
@@ -8,8 +8,11 @@
 #include <xgrammar/tokenizer_info.h>
 #include "structured_output_controller.hpp"
 #include "dlpack/dlpack.h"
+#include <list>
+#include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace ov {
@@ -35,9 +38,18 @@ public:
 
     void accept_tokens(const TokenIds& input_ids) override;
 
+    // fills the token bitmask for the current matcher state, so that apply does not have to
+    void prepare() override;
+
     void apply(Logits& logits) override;
+
+    // accepts the tokens while the bitmask allows a single one, which is not a stop token
+    TokenIds jump_forward(size_t max_num_tokens) override;
 protected:
     xgrammar::GrammarMatcher m_grammar_matcher;
+    std::vector<int> m_stop_token_ids;
+    // whether m_token_bitmask corresponds to the current matcher state
+    bool m_is_bitmask_filled = false;
 
     ov::Tensor m_token_bitmask_ov;
     std::shared_ptr<DLTensor> m_token_bitmask;
@@ -80,6 +92,13 @@ public:
     std::shared_ptr<LogitTransformers::ILogitTransformer> get_logits_transformer(const GenerationConfig& sampling_parameters) override;
 private:
     std::unique_ptr<xgrammar::GrammarCompiler> m_grammar_compiler;
+
+    // { grammar definition, compiled grammar }, requests with the same schema / regex / EBNF reuse the compiled grammar
+    // instead of compiling it again, which may take seconds for large JSON schemas
+    std::map<std::string, xgrammar::CompiledGrammar> m_compiled_grammars;
+    // grammar definitions in the order of insertion to evict the oldest ones
+    std::list<std::string> m_compiled_grammars_order;
+    static constexpr size_t m_max_compiled_grammars = 64;
 };
 
 
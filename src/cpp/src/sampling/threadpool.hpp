@@ -1,4 +1,5 @@
 #include <condition_variable>
+#include <exception>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -6,7 +7,9 @@
 #include <queue>
 #include <thread>
 #include <utility>
+#include <algorithm>
 #include <atomic>
+#include <vector>
 
 class ThreadPool {
 
@@ -70,4 +73,64 @@ public:
         cv.notify_one();
         return result;
     }
+
+    /**
+     * Calls `f(i)` for each i in [0, count) and blocks until all calls are done. Instead of a task and a future per
+     * index, each pool thread gets a single task which takes the next chunk of `chunk_size` indexes until there are none
+     * left, so the queue is locked once per call. The first exception thrown by `f` is rethrown after all calls finish.
+     * With a single pool thread or a single chunk the calls are made serially in the calling thread, which is
+     * equivalent to them being serialized by the pool but avoids the hand-off.
+     */
+    template <typename F>
+    void parallel_for(size_t count, F&& f, size_t chunk_size = 1)
+    {
+        chunk_size = std::max<size_t>(chunk_size, 1);
+        const size_t num_chunks = (count + chunk_size - 1) / chunk_size;
+        if (threads.size() <= 1 || num_chunks <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                f(i);
+            }
+            return;
+        }
+
+        std::atomic<size_t> next_chunk{0};
+        std::exception_ptr error;
+        std::mutex done_mutex;
+        std::condition_variable done_cv;
+        const size_t num_tasks = std::min(threads.size(), num_chunks);
+        size_t num_running_tasks = num_tasks;
+
+        auto task = [&] {
+            for (size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++) {
+                try {
+                    for (size_t i = chunk * chunk_size, end = std::min(count, i + chunk_size); i < end; ++i) {
+                        f(i);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(done_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+            std::lock_guard<std::mutex> lock(done_mutex);
+            if (--num_running_tasks == 0) {
+                done_cv.notify_one();
+            }
+        };
+
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            for (size_t i = 0; i < num_tasks; ++i) {
+                tasks.emplace(task);
+            }
+        }
+        cv.notify_all();
+
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [&] { return num_running_tasks == 0; });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
 };
@@ -0,0 +1,53 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * Finds the tokens of the vocab, which start with a given text. The tokens are sorted by their text, so that the
+ * tokens sharing a prefix form a contiguous range, like the subtree of the prefix in a trie of the vocab.
+ */
+class VocabPrefixIndex {
+public:
+    explicit VocabPrefixIndex(const std::vector<std::string>& vocab) : m_vocab(vocab) {
+        m_sorted_token_ids.resize(m_vocab.size());
+        for (size_t token_id = 0; token_id < m_vocab.size(); ++token_id) {
+            m_sorted_token_ids[token_id] = static_cast<int64_t>(token_id);
+        }
+        std::sort(m_sorted_token_ids.begin(), m_sorted_token_ids.end(), [this](int64_t lhs, int64_t rhs) {
+            return m_vocab[lhs] < m_vocab[rhs];
+        });
+    }
+
+    /**
+     * @return The ids of the tokens starting with the prefix in ascending order.
+     */
+    std::vector<int64_t> find_tokens_with_prefix(const std::string& prefix) const {
+        auto begin = std::lower_bound(m_sorted_token_ids.begin(), m_sorted_token_ids.end(), prefix, [this](int64_t token_id, const std::string& text) {
+            return m_vocab[token_id] < text;
+        });
+        auto end = std::find_if(begin, m_sorted_token_ids.end(), [this, &prefix](int64_t token_id) {
+            return m_vocab[token_id].compare(0, prefix.size(), prefix) != 0;
+        });
+        std::vector<int64_t> token_ids(begin, end);
+        std::sort(token_ids.begin(), token_ids.end());
+        return token_ids;
+    }
+
+    const std::string& get_token_text(int64_t token_id) const {
+        return m_vocab.at(token_id);
+    }
+
+private:
+    std::vector<std::string> m_vocab;
+    std::vector<int64_t> m_sorted_token_ids;
+};
+
+}  // namespace ov::genai
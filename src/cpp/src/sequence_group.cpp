@@ -1,15 +1,16 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
-#include <string_view>
+#include <algorithm>
 #include "sequence_group.hpp"
+#include "content_hash.hpp"
 
 namespace ov {
 namespace genai {
 
 std::mutex Sequence::m_counter_mutex;
 
-size_t Sequence::_make_hash(size_t content_length) {
+ContentHash Sequence::_make_hash(size_t content_length) {
         auto sequence_group = get_sequence_group_ptr();
         auto block_size = sequence_group->get_block_size();
         size_t block_start_idx = content_length - (content_length % block_size);
@@ -17,69 +18,66 @@ size_t Sequence::_make_hash(size_t content_length) {
             block_start_idx -= block_size;
         }
 
-        // hash of current block depends on prefix hashes
-        std::vector<int64_t> content;
+        // hash of current block is chained to the hash of its prefix
         size_t filled_blocks_count = block_start_idx / block_size;
         OPENVINO_ASSERT(filled_blocks_count <= m_prefix_hashes.size());
-        if (filled_blocks_count > 0) {
-            content.emplace_back(m_prefix_hashes[filled_blocks_count - 1]);
-        }
+        ContentHasher hasher(filled_blocks_count > 0 ? m_prefix_hashes[filled_blocks_count - 1] : ContentHash{sequence_group->get_prefix_hash_salt(), 0});
 
-        // get tokens corresponding to current block
+        // hash tokens corresponding to current block
         if (sequence_group->get_sequence_group_type() == SequenceGroupType::TOKENS) {
-            const auto prompt_ids = sequence_group->get_prompt_ids();
+            const auto& prompt_ids = sequence_group->get_prompt_ids();
             OPENVINO_ASSERT(content_length <= prompt_ids.size() + m_generated_ids.size());
-            if (block_start_idx < prompt_ids.size()) {
-                content.insert(content.end(), prompt_ids.begin() + block_start_idx, prompt_ids.begin() + std::min(prompt_ids.size(), content_length));
+            for (size_t idx = block_start_idx; idx < std::min(prompt_ids.size(), content_length); idx++) {
+                hasher.update(static_cast<uint64_t>(prompt_ids[idx]));
             }
             if (content_length > prompt_ids.size()) {
                 size_t start = block_start_idx < prompt_ids.size() ? 0 : block_start_idx - prompt_ids.size();
-                // Use parentheses around (content_length - prompt_ids.size()) to suppress MSVC debug assert: "cannot seek vector iterator after end"
-                content.insert(content.end(), m_generated_ids.begin() + start, m_generated_ids.begin() + (content_length - prompt_ids.size()));
+                for (size_t idx = start; idx < content_length - prompt_ids.size(); idx++) {
+                    hasher.update(static_cast<uint64_t>(m_generated_ids[idx]));
+                }
             }
         }
         else if (sequence_group->get_sequence_group_type() == SequenceGroupType::EMBEDDINGS) {
-            const auto& input_embeds = sequence_group->get_input_embeds();
-            const auto generated_embeds = m_generated_ids_embeds;
-            OPENVINO_ASSERT(content_length <= input_embeds.size() + generated_embeds.size());
+            const size_t prompt_len = sequence_group->get_prompt_len();
+            const size_t hidden_size = sequence_group->get_hidden_size();
+            const float* input_embeds_data = sequence_group->get_input_embeds().data<const float>();
+            const auto& generated_embeds = m_generated_ids_embeds;
+            OPENVINO_ASSERT(content_length <= prompt_len + m_generated_ids.size());
 
-            // get inputs embeddings
-            if (block_start_idx < input_embeds.size()) {
-                for (size_t idx = block_start_idx; idx < std::min(input_embeds.size(), content_length); idx++) {
-                    auto embed = _reduce_embedding(input_embeds[idx]);
-                    content.insert(content.end(), embed.begin(), embed.end());
-                }
+            // hash inputs embeddings
+            for (size_t idx = block_start_idx; idx < std::min(prompt_len, content_length); idx++) {
+                hasher.update(_hash_embedding(input_embeds_data + idx * hidden_size, hidden_size));
             }
 
-            // get generated ids embeddings
-            if (content_length > input_embeds.size()) {
-                size_t start = block_start_idx < input_embeds.size() ? 0 : block_start_idx - input_embeds.size();
-                for (size_t idx = start; idx < content_length - input_embeds.size(); idx++) {
-                    auto embed = _reduce_embedding(generated_embeds[idx]);
-                    content.insert(content.end(), embed.begin(), embed.end());
+            // hash generated ids embeddings, the generated ids are hashed themselves if the language model looks up
+            // their embeddings, see utils::apply_embeddings_lookup_transformation
+            if (content_length > prompt_len) {
+                size_t start = block_start_idx < prompt_len ? 0 : block_start_idx - prompt_len;
+                for (size_t idx = start; idx < content_length - prompt_len; idx++) {
+                    if (idx < generated_embeds.size()) {
+                        hasher.update(_hash_embedding(generated_embeds[idx].data(), generated_embeds[idx].size()));
+                    } else {
+                        hasher.update(static_cast<uint64_t>(m_generated_ids[idx]));
+                    }
                 }
             }
         }
         else {
             OPENVINO_THROW("Hash calculation is not supported for this sequence type.");
         }
-        const char* data = reinterpret_cast<const char*>(content.data());
-        std::size_t size = content.size() * sizeof(content[0]);
-        return std::hash<std::string_view>{}(std::string_view(data, size));
+        return hasher.finalize();
 }
 
-std::vector<int64_t> Sequence::_reduce_embedding(const std::vector<float>& embedding) {
-    size_t res_size = std::min((size_t)ceil(float(embedding.size()) / m_embeddings_hash_calculation_stride), m_embeddings_hash_max_num_values);
-    std::vector<int64_t> res(res_size, 0);
-    for (size_t i = 0, idx=0; idx < res_size; i+= m_embeddings_hash_calculation_stride, idx++) {
-        std::memcpy(&(res[idx]), &(embedding[i]), sizeof(embedding[i]));
-    }
-    return res;
+ContentHash Sequence::_hash_embedding(const float* embedding, size_t size) {
+    ContentHash hash;
+    hash_bytes(embedding, size * sizeof(float), hash);
+    return hash;
 }
 
 // Each KV block can be uniquely identified by 
 // the tokens within the block and the tokens in the prefix before the block.
 // hash(prefix tokens + block tokens) <--> KV Block
+// The 128 bit hashes of the filled blocks are computed once, the KV blocks are identified by their 64 bit folds.
 size_t Sequence::get_hash(size_t content_length) {
 
     auto sequence_group = get_sequence_group_ptr();
@@ -93,10 +91,10 @@ size_t Sequence::get_hash(size_t content_length) {
         cur_content += block_size;
     }
     if (content_len % block_size == 0) {
-        return m_prefix_hashes[content_len / block_size - 1];
+        return ContentHashHasher{}(m_prefix_hashes[content_len / block_size - 1]);
     }
     
-    return _make_hash(content_len);
+    return ContentHashHasher{}(_make_hash(content_len));
 }
 }  // namespace genai
 }  // namespace ov
\ No newline at end of file
@@ -10,10 +10,14 @@
 #include <string_view>
 #include <memory>
 #include <optional>
+#include <chrono>
 
 #include "openvino/genai/generation_handle.hpp"
 #include "openvino/genai/generation_config.hpp"
+#include "content_hash.hpp"
 #include "generation_stream.hpp"
+#include "object_pool.hpp"
+#include "shared_history.hpp"
 
 namespace ov::genai {
 enum class SequenceStatus {
@@ -40,51 +44,70 @@ class Sequence {
         return m_counter++;
     }
 
-    TokenIds m_generated_ids;
-    LogProbs m_generated_log_probs;
+    // shared with the forks of the sequence, e.g. the beams of beam search, so that forking doesn't copy them
+    SharedHistory<int64_t> m_generated_ids;
+    SharedHistory<float> m_generated_log_probs;
     uint64_t m_grouped_id;
     uint64_t m_id = _get_next_global_sequence_id();
     SequenceStatus m_status = SequenceStatus::RUNNING;
     GenerationFinishReason m_finish_reason = GenerationFinishReason::NONE;
     float m_cumulative_log_prob = 0.0f;
-    std::vector<int64_t> m_prefix_hashes;
+    // 128 bit hashes of the filled blocks, each chained to the hash of the previous one
+    std::vector<ContentHash> m_prefix_hashes;
     SequenceGroup* m_sequence_group = nullptr;
     static std::mutex m_counter_mutex;
-    std::vector<std::vector<float>> m_generated_ids_embeds;
+    SharedHistory<std::vector<float>> m_generated_ids_embeds;
     SequenceGroupType m_type;
     size_t m_hidden_size;
+    // predictions of the model at the positions following the first rejected candidate, i.e. conditioned on the rejected
+    // candidates, which are the next guess of lookahead (Jacobi) decoding
+    TokenIds m_lookahead_tokens;
 
-    // Embeddings hash calculation params
-    static constexpr size_t m_embeddings_hash_max_num_values = 10; // max number of values used for embeddings hash calculation
-    static constexpr size_t m_embeddings_hash_calculation_stride = 50; // the stride with which values are taken from embeddings vector
+    ContentHash _make_hash(size_t content_length);
 
-    size_t _make_hash(size_t content_length);
+    // the content hash of all the values of the embedding, so that the blocks of the prompts differing in any value,
+    // e.g. in a pixel of an image, don't share the hash
+    static ContentHash _hash_embedding(const float* embedding, size_t size);
 
-    static std::vector<int64_t> _reduce_embedding(const std::vector<float>& embedding);
-
-    explicit Sequence(const uint64_t id, const SequenceGroupType type, const size_t hidden_size) : m_grouped_id(id), m_type(type), m_hidden_size(hidden_size) {}
+    explicit Sequence(const uint64_t id, const SequenceGroupType type, const size_t hidden_size) :
+        m_generated_ids(VectorPool<int64_t>::get_instance().acquire()),
+        m_generated_log_probs(VectorPool<float>::get_instance().acquire()),
+        m_grouped_id(id),
+        m_type(type),
+        m_hidden_size(hidden_size) {}
 
     Sequence(const Sequence& seq, const uint64_t id) :
-        m_generated_ids(seq.m_generated_ids),
+        m_generated_ids(seq.m_generated_ids.fork()),
+        m_generated_log_probs(seq.m_generated_log_probs.fork()),
         m_grouped_id(id),
         m_status(seq.m_status),
         m_cumulative_log_prob(seq.m_cumulative_log_prob),
         m_sequence_group(seq.m_sequence_group),
+        m_generated_ids_embeds(seq.m_generated_ids_embeds.fork()),
         m_type(seq.m_type),
         m_hidden_size(seq.m_hidden_size) {
         OPENVINO_ASSERT(seq.m_id != m_id);
     }
 
+    // constructs the pooled sequences
+    friend class PoolAllocator<Sequence>;
+
 public:
     using Ptr = std::shared_ptr<Sequence>;
     using CPtr = std::shared_ptr<const Sequence>;
 
     static Sequence::Ptr create(const uint64_t id, const SequenceGroupType type = SequenceGroupType::TOKENS, const size_t hidden_size = 0) {
-        return Sequence::Ptr(new Sequence(id, type, hidden_size));
+        return make_pooled<Sequence>(id, type, hidden_size);
     }
 
     static Sequence::Ptr fork(Sequence::CPtr sequence, const uint64_t id) {
-        return Sequence::Ptr(new Sequence(*sequence, id));
+        return make_pooled<Sequence>(*sequence, id);
+    }
+
+    // the token vectors are reused by the next sequences with their capacity
+    ~Sequence() {
+        VectorPool<int64_t>::get_instance().release(m_generated_ids.release_storage());
+        VectorPool<float>::get_instance().release(m_generated_log_probs.release_storage());
     }
 
     bool operator ==(const Sequence& other) const {
@@ -127,6 +150,14 @@ public:
         m_finish_reason = finish_reason;
     }
 
+    const TokenIds& get_lookahead_tokens() const {
+        return m_lookahead_tokens;
+    }
+
+    void set_lookahead_tokens(TokenIds lookahead_tokens) {
+        m_lookahead_tokens = std::move(lookahead_tokens);
+    }
+
     // appends new tokens to a generated part
     void append_token(int64_t token_id, float log_prob) {
         m_cumulative_log_prob += log_prob;
@@ -143,6 +174,10 @@ public:
             m_generated_log_probs.pop_back();
             m_generated_ids.pop_back();
         }
+        // the embeddings of the removed tokens are computed already
+        while (m_generated_ids_embeds.size() > m_generated_ids.size()) {
+            m_generated_ids_embeds.pop_back();
+        }
     }
 
     GenerationOutput get_last_generation_output(size_t token_cnt = 1, size_t num_token_to_ignore = 0) {
@@ -151,19 +186,17 @@ public:
             OPENVINO_ASSERT(m_generated_ids.size());
             output.score = get_cumulative_log_prob();
 
-            auto generated_token_id = get_generated_ids();
-            auto generated_log_probs = get_generated_log_probs();
+            // only the last tokens are copied to the output, not the whole generated sequence
+            const auto& generated_token_id = get_generated_ids();
+            const auto& generated_log_probs = get_generated_log_probs();
 
             OPENVINO_ASSERT(get_generated_len() >= token_cnt);
             if (get_generated_len() > num_token_to_ignore) {
                 auto offset = get_generated_len() - token_cnt - num_token_to_ignore;
                 auto offset_back = get_generated_len() - num_token_to_ignore;
 
-                std::vector<int64_t> token_id(generated_token_id.begin() + offset, generated_token_id.begin() + offset_back);
-                std::vector<float> log_probs(generated_log_probs.begin() + offset, generated_log_probs.begin() + offset_back);
-
-                output.generated_ids = token_id;
-                output.generated_log_probs = log_probs;
+                output.generated_ids.assign(generated_token_id.begin() + offset, generated_token_id.begin() + offset_back);
+                output.generated_log_probs.assign(generated_log_probs.begin() + offset, generated_log_probs.begin() + offset_back);
                 output.finish_reason = get_finish_reason();
             }
         }
@@ -174,11 +207,11 @@ public:
         return m_generated_ids.size();
     }
 
-    const TokenIds & get_generated_ids() const {
+    const SharedHistory<int64_t>& get_generated_ids() const {
         return m_generated_ids;
     }
 
-    const LogProbs & get_generated_log_probs() const {
+    const SharedHistory<float>& get_generated_log_probs() const {
         return m_generated_log_probs;
     }
 
@@ -188,7 +221,7 @@ public:
 
     void update_generated_log_prob(size_t idx, float log_prob) {
         OPENVINO_ASSERT(idx < m_generated_log_probs.size());
-        m_generated_log_probs[idx] = log_prob;
+        m_generated_log_probs.set(idx, log_prob);
     }
 
     float get_beam_search_score(const ov::genai::GenerationConfig& sampling_params) const {
@@ -203,7 +236,7 @@ public:
         m_sequence_group = sequence_group;
     }
 
-    const std::vector<std::vector<float>>& get_generated_ids_embeds() const {
+    const SharedHistory<std::vector<float>>& get_generated_ids_embeds() const {
         OPENVINO_ASSERT(m_type == ov::genai::SequenceGroupType::EMBEDDINGS);
         return m_generated_ids_embeds;
     }
@@ -213,12 +246,9 @@ public:
         auto embeds_count = generated_ids_embeds.get_shape()[1];
         OPENVINO_ASSERT(m_hidden_size == generated_ids_embeds.get_shape()[2]);
 
-        auto current_embeds_size = m_generated_ids_embeds.size();
-        for (size_t i = current_embeds_size, idx = 0; i < current_embeds_size + embeds_count; i++, idx++) {
-            m_generated_ids_embeds.emplace_back(std::vector<float>());
-            m_generated_ids_embeds[i].resize(m_hidden_size);
-            std::copy_n(generated_ids_embeds.data<float>() + idx * m_hidden_size, m_hidden_size, m_generated_ids_embeds[i].begin());
-
+        for (size_t idx = 0; idx < embeds_count; idx++) {
+            const float* embeds_data = generated_ids_embeds.data<float>() + idx * m_hidden_size;
+            m_generated_ids_embeds.push_back(std::vector<float>(embeds_data, embeds_data + m_hidden_size));
         }
     }
 
@@ -240,7 +270,8 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
     ov::genai::GenerationConfig m_sampling_params;
     std::size_t m_block_size;
     TokenIds m_prompt_ids;
-    std::vector<std::vector<float>> m_input_embeds;
+    // [prompt_len, hidden_size] embeddings of the prompt, the model inputs are gathered from its rows
+    ov::Tensor m_input_embeds;
     std::optional<std::vector<int64_t>> m_token_type_ids;
     std::vector<float> m_prompt_log_probs;
     GenerationStream::Ptr m_generation_stream;
@@ -266,11 +297,45 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // the last prompt token removed by token healing, the first generated token has to start with its text
+    std::optional<int64_t> m_token_healing_token_id;
+
+    // mixed into the hash of the first KV cache block, if not zero, e.g. to identify the LoRA adapters of the request
+    size_t m_prefix_hash_salt = 0;
+
+    // time when the request was added, used by deadline-based scheduling policies
+    std::chrono::steady_clock::time_point m_arrival_time;
+
+    // latency breakdown of the request, published to the generation stream by notify_handle
+    RequestMetrics m_request_metrics;
+    std::optional<std::chrono::steady_clock::time_point> m_first_scheduled_time, m_first_token_time, m_preemption_time;
+
+    static float get_microsec(std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::duration<float, std::micro>>(duration).count();
+    }
+
+    void update_request_metrics() {
+        if (!m_first_token_time && has_generated_tokens()) {
+            m_first_token_time = std::chrono::steady_clock::now();
+            m_request_metrics.ttft = get_microsec(*m_first_token_time - m_arrival_time);
+            if (m_first_scheduled_time) {
+                m_request_metrics.prefill_time = get_microsec(*m_first_token_time - *m_first_scheduled_time);
+            }
+        }
+        if (has_finished() || out_of_memory()) {
+            m_request_metrics.total_time = get_microsec(std::chrono::steady_clock::now() - m_arrival_time);
+        }
+        m_generation_stream->set_request_metrics(m_request_metrics);
+    }
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
           m_block_size(block_size),
-          m_generation_stream(GenerationStream::create()) { }
+          m_prompt_ids(VectorPool<int64_t>::get_instance().acquire()),
+          m_prompt_log_probs(VectorPool<float>::get_instance().acquire()),
+          m_generation_stream(GenerationStream::create()),
+          m_arrival_time(std::chrono::steady_clock::now()) { }
 
     bool out_of_memory() const {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
@@ -285,6 +350,12 @@ public:
     using Ptr = std::shared_ptr<SequenceGroup>;
     using CPtr = std::shared_ptr<const SequenceGroup>;
 
+    // the prompt vectors are reused by the next requests with their capacity
+    ~SequenceGroup() {
+        VectorPool<int64_t>::get_instance().release(std::move(m_prompt_ids));
+        VectorPool<float>::get_instance().release(std::move(m_prompt_log_probs));
+    }
+
     SequenceGroup(uint64_t request_id, const TokenIds& input_ids, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : SequenceGroup(request_id, ov::Tensor(ov::element::i64, ov::Shape{input_ids.size()}, (void *)input_ids.data()), sampling_params, block_size, std::nullopt) {
     }
@@ -309,13 +380,10 @@ public:
             m_sequence_group_type = SequenceGroupType::TOKENS;
         } else if (input_ids.get_element_type() == ov::element::f32) {
             hidden_size = input_ids.get_shape()[2];
-            m_input_embeds.resize(prompt_len);
-            for (size_t i = 0; i < prompt_len; i++) {
-                m_input_embeds[i].resize(hidden_size);
-                OPENVINO_SUPPRESS_DEPRECATED_START
-                std::copy_n(input_ids.data<float>() + i * hidden_size, hidden_size, m_input_embeds[i].begin());
-                OPENVINO_SUPPRESS_DEPRECATED_END
-            }
+            m_input_embeds = ov::Tensor(ov::element::f32, {prompt_len, hidden_size});
+            OPENVINO_SUPPRESS_DEPRECATED_START
+            std::copy_n(input_ids.data<float>(), prompt_len * hidden_size, m_input_embeds.data<float>());
+            OPENVINO_SUPPRESS_DEPRECATED_END
             if (token_type_ids.has_value()) {
                 const ov::Tensor& tokens = token_type_ids.value();
                 m_token_type_ids = std::vector<int64_t>(tokens.get_size());
@@ -349,7 +417,7 @@ public:
 
     size_t get_prompt_len() const {
         if (m_sequence_group_type == SequenceGroupType::EMBEDDINGS) {
-            return m_input_embeds.size();
+            return m_input_embeds.get_shape()[0];
         }
         else if (m_sequence_group_type == SequenceGroupType::TOKENS) {
             return m_prompt_ids.size();
@@ -605,7 +673,26 @@ public:
         return m_prompt_ids;
     }
 
-    const std::vector<std::vector<float>>& get_input_embeds() const {
+    void set_token_healing_token_id(int64_t token_id) {
+        m_token_healing_token_id = token_id;
+    }
+
+    const std::optional<int64_t>& get_token_healing_token_id() const {
+        return m_token_healing_token_id;
+    }
+
+    void set_prefix_hash_salt(size_t salt) {
+        m_prefix_hash_salt = salt;
+    }
+
+    size_t get_prefix_hash_salt() const {
+        return m_prefix_hash_salt;
+    }
+
+    /**
+     * @return [prompt_len, hidden_size] embeddings of the prompt.
+     */
+    const ov::Tensor& get_input_embeds() const {
         OPENVINO_ASSERT(m_sequence_group_type == SequenceGroupType::EMBEDDINGS);
         return m_input_embeds;
     }
@@ -616,8 +703,8 @@ public:
 
     size_t get_hidden_size() const {
         OPENVINO_ASSERT(m_sequence_group_type == SequenceGroupType::EMBEDDINGS);
-        OPENVINO_ASSERT(m_input_embeds.size() > 0, "Embeddings should be set to get hidden size.");
-        return m_input_embeds[0].size();
+        OPENVINO_ASSERT(m_input_embeds.get_size() > 0, "Embeddings should be set to get hidden size.");
+        return m_input_embeds.get_shape()[1];
     }
 
     void append_prompt_log_prob(float log_prob) {
@@ -662,6 +749,61 @@ public:
         return m_sampling_params;
     }
 
+    std::chrono::steady_clock::time_point get_arrival_time() const {
+        return m_arrival_time;
+    }
+
+    // e.g. to replay the arrival times of a trace in the simulated time
+    void set_arrival_time(std::chrono::steady_clock::time_point arrival_time) {
+        m_arrival_time = arrival_time;
+    }
+
+    const RequestMetrics& get_request_metrics() const {
+        return m_request_metrics;
+    }
+
+    // called by the scheduler for each group scheduled at the current step
+    void record_scheduled(std::chrono::steady_clock::time_point now) {
+        if (!m_first_scheduled_time) {
+            m_first_scheduled_time = now;
+            m_request_metrics.queue_time = get_microsec(now - m_arrival_time);
+        }
+        if (m_preemption_time) {
+            m_request_metrics.preempted_time += get_microsec(now - *m_preemption_time);
+            m_preemption_time.reset();
+        }
+        if (m_num_processed_tokens < get_prompt_len()) {
+            ++m_request_metrics.num_prefill_chunks;
+        }
+    }
+
+    bool has_been_scheduled() const {
+        return m_first_scheduled_time.has_value();
+    }
+
+    void record_preemption() {
+        ++m_request_metrics.num_preemptions;
+        // a group can be preempted several times before it is scheduled again
+        if (!m_preemption_time) {
+            m_preemption_time = std::chrono::steady_clock::now();
+        }
+    }
+
+    void record_prefix_cache_hit(size_t num_tokens) {
+        m_request_metrics.num_prefix_cache_hit_tokens += num_tokens;
+    }
+
+    void record_draft_validation(size_t num_draft_tokens, size_t num_accepted_tokens) {
+        m_request_metrics.num_draft_tokens += num_draft_tokens;
+        m_request_metrics.num_accepted_draft_tokens += num_accepted_tokens;
+    }
+
+    bool has_generated_tokens() const {
+        return std::any_of(m_sequences.begin(), m_sequences.end(), [] (Sequence::CPtr seq) {
+            return seq->get_generated_len() > 0;
+        });
+    }
+
     void set_out_of_memory() {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
             if (m_sequences[seq_id]->is_running()) {
@@ -691,6 +833,11 @@ public:
         return m_generation_stream;
     }
 
+    // recreates the generation stream, has to be called before the stream is passed to the handle
+    void set_streaming_transport(StreamingTransport transport) {
+        m_generation_stream = GenerationStream::create(transport);
+    }
+
     void set_generation_status(GenerationStatus status) {
         m_generation_stream->set_generation_status(status);
     }
@@ -703,13 +850,25 @@ public:
         return m_generation_stream->get_status() == GenerationStatus::CANCEL;
     }
 
+    // whether GenerationConfig::deadline_ms has passed since the arrival of the request
+    bool is_expired(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) const {
+        const size_t deadline_ms = m_sampling_params.deadline_ms;
+        return deadline_ms != 0 && now - m_arrival_time > std::chrono::milliseconds(deadline_ms);
+    }
+
     void push_empty_outputs() {
         m_generation_stream->push({});
     }
 
     void push_outputs() {
         GenerationOutputs outputs;
-        for (auto& sequence: m_sequences) {
+        std::vector<Sequence::CPtr> sequences(m_sequences.begin(), m_sequences.end());
+        if (m_sampling_params.best_of > m_sampling_params.num_return_sequences) {
+            // only the best of the sampled sequences are returned
+            sequences = get_finished_sequences();
+            sequences.resize(std::min(sequences.size(), m_sampling_params.num_return_sequences));
+        }
+        for (auto& sequence: sequences) {
             GenerationOutput output;
             output.generated_ids = sequence->get_generated_ids();
             output.generated_log_probs = sequence->get_generated_log_probs();
@@ -741,6 +900,7 @@ public:
     }
 
     void notify_handle() {
+        update_request_metrics();
         if (out_of_memory()) {
             set_generation_status(GenerationStatus::IGNORED);
         } else if (has_finished()) {
@@ -800,6 +960,7 @@ public:
             set_generation_status(GenerationStatus::FINISHED);
             m_sequences[0]->set_status(SequenceStatus::FINISHED); // for cleanup
         }
+        update_request_metrics();
         GenerationOutputs outputs;
         outputs.emplace(0, output);
         m_generation_stream->push(std::move(outputs));
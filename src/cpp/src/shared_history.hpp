@@ -0,0 +1,220 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * An append-mostly sequence of values, e.g. the tokens generated by a Sequence, which shares its prefix with the
+ * histories it's forked into. The prefix is kept as immutable ref-counted chunks, each history owns its tail only,
+ * so a fork copies O(log(size)) chunk pointers instead of the values. The chunks are merged so that each chunk is more
+ * than twice as long as the next one, which keeps their number logarithmic and copies each value O(log(size)) times.
+ */
+template <typename T>
+class SharedHistory {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+        const_iterator(const SharedHistory* history, size_t index) : m_history(history), m_index(index) {}
+
+        reference operator*() const { return (*m_history)[m_index]; }
+        pointer operator->() const { return &(*m_history)[m_index]; }
+        reference operator[](difference_type n) const { return (*m_history)[m_index + n]; }
+
+        const_iterator& operator++() { ++m_index; return *this; }
+        const_iterator operator++(int) { const_iterator it = *this; ++m_index; return it; }
+        const_iterator& operator--() { --m_index; return *this; }
+        const_iterator operator--(int) { const_iterator it = *this; --m_index; return it; }
+        const_iterator& operator+=(difference_type n) { m_index += n; return *this; }
+        const_iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+        friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) {
+            return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index);
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) { return lhs.m_index == rhs.m_index; }
+        friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.m_index != rhs.m_index; }
+        friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) { return lhs.m_index < rhs.m_index; }
+        friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) { return lhs.m_index > rhs.m_index; }
+        friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.m_index <= rhs.m_index; }
+        friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.m_index >= rhs.m_index; }
+
+    private:
+        const SharedHistory* m_history = nullptr;
+        size_t m_index = 0;
+    };
+
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SharedHistory() = default;
+    SharedHistory(std::initializer_list<T> values) : m_tail(values) {}
+    // an empty history, which appends to the storage, e.g. to a recycled vector with a capacity
+    explicit SharedHistory(std::vector<T>&& storage) : m_tail(std::move(storage)) {
+        m_tail.clear();
+    }
+
+    /**
+     * @return A history with the same values, which shares them with this one. The tail of this history becomes a shared
+     * chunk, which doesn't change the values, so the method is const.
+     */
+    SharedHistory fork() const {
+        freeze_tail();
+        return *this;
+    }
+
+    size_t size() const {
+        return get_prefix_size() + m_tail.size();
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    const T& operator[](size_t index) const {
+        const size_t prefix_size = get_prefix_size();
+        if (index >= prefix_size) {
+            return m_tail[index - prefix_size];
+        }
+        const size_t chunk_idx = std::upper_bound(m_chunk_ends.begin(), m_chunk_ends.end(), index) - m_chunk_ends.begin();
+        const size_t chunk_start = chunk_idx == 0 ? 0 : m_chunk_ends[chunk_idx - 1];
+        return (*m_chunks[chunk_idx])[index - chunk_start];
+    }
+
+    const T& back() const {
+        OPENVINO_ASSERT(!empty(), "SharedHistory is empty");
+        return (*this)[size() - 1];
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    void push_back(T value) {
+        m_tail.push_back(std::move(value));
+    }
+
+    void pop_back() {
+        OPENVINO_ASSERT(!empty(), "SharedHistory is empty");
+        if (m_tail.empty()) {
+            own_last_chunk();
+        }
+        m_tail.pop_back();
+    }
+
+    // the shared chunks starting from the one with the value are copied to the tail, the values are expected to be recent
+    void set(size_t index, T value) {
+        OPENVINO_ASSERT(index < size(), "SharedHistory index ", index, " is out of range ", size());
+        while (index < get_prefix_size()) {
+            own_last_chunk();
+        }
+        m_tail[index - get_prefix_size()] = std::move(value);
+    }
+
+    // a contiguous copy of the values, e.g. for the results of the generation
+    operator std::vector<T>() const {
+        std::vector<T> values;
+        values.reserve(size());
+        for (const auto& chunk : m_chunks) {
+            values.insert(values.end(), chunk->begin(), chunk->end());
+        }
+        values.insert(values.end(), m_tail.begin(), m_tail.end());
+        return values;
+    }
+
+    friend bool operator==(const SharedHistory& lhs, const SharedHistory& rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+    friend bool operator==(const SharedHistory& lhs, const std::vector<T>& rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+    friend bool operator==(const std::vector<T>& lhs, const SharedHistory& rhs) {
+        return rhs == lhs;
+    }
+    friend bool operator!=(const SharedHistory& lhs, const SharedHistory& rhs) { return !(lhs == rhs); }
+    friend bool operator!=(const SharedHistory& lhs, const std::vector<T>& rhs) { return !(lhs == rhs); }
+    friend bool operator!=(const std::vector<T>& lhs, const SharedHistory& rhs) { return !(rhs == lhs); }
+
+    // the vector of the tail for recycling, the history becomes empty
+    std::vector<T> release_storage() {
+        m_chunks.clear();
+        m_chunk_ends.clear();
+        return std::exchange(m_tail, {});
+    }
+
+    // the number of the shared chunks, for tests
+    size_t get_num_chunks() const {
+        return m_chunks.size();
+    }
+
+private:
+    size_t get_prefix_size() const {
+        return m_chunk_ends.empty() ? 0 : m_chunk_ends.back();
+    }
+
+    size_t get_chunk_size(size_t chunk_idx) const {
+        return m_chunks[chunk_idx]->size();
+    }
+
+    void freeze_tail() const {
+        if (m_tail.empty()) {
+            return;
+        }
+        const size_t history_size = size();
+        m_chunks.push_back(std::make_shared<const std::vector<T>>(std::move(m_tail)));
+        m_chunk_ends.push_back(history_size);
+        m_tail.clear();
+
+        // keeps each chunk more than twice as long as the next one
+        while (m_chunks.size() > 1 && get_chunk_size(m_chunks.size() - 2) <= 2 * get_chunk_size(m_chunks.size() - 1)) {
+            auto merged = std::make_shared<std::vector<T>>();
+            merged->reserve(get_chunk_size(m_chunks.size() - 2) + get_chunk_size(m_chunks.size() - 1));
+            for (size_t chunk_idx : {m_chunks.size() - 2, m_chunks.size() - 1}) {
+                merged->insert(merged->end(), m_chunks[chunk_idx]->begin(), m_chunks[chunk_idx]->end());
+            }
+            m_chunks.pop_back();
+            m_chunk_ends.pop_back();
+            m_chunks.back() = std::move(merged);
+            m_chunk_ends.back() = history_size;
+        }
+    }
+
+    void own_last_chunk() {
+        std::vector<T> tail(*m_chunks.back());
+        tail.insert(tail.end(), std::make_move_iterator(m_tail.begin()), std::make_move_iterator(m_tail.end()));
+        m_tail = std::move(tail);
+        m_chunks.pop_back();
+        m_chunk_ends.pop_back();
+    }
+
+    // the values are immutable once shared, fork() moves the tail to a chunk without changing the values
+    mutable std::vector<std::shared_ptr<const std::vector<T>>> m_chunks;
+    // the index past the last value of each chunk
+    mutable std::vector<size_t> m_chunk_ends;
+    mutable std::vector<T> m_tail;
+};
+
+}  // namespace ov::genai
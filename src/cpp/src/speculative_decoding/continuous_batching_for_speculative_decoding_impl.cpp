@@ -16,6 +16,8 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::Contin
     m_generation_config = generation_config;
     m_is_validation_mode_enabled = is_validation_mode_enabled;
     initialize_pipeline(model, scheduler_config, device, plugin_config);
+    // the candidates of several steps may be rejected, so the blocks older than the attention window may be attended again
+    m_attention_window_size = 0;
 }
 
 void
@@ -24,6 +26,9 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::finish
         if (m_scheduler->has_block_table(sequence->get_id())) {
             m_scheduler->free_sequence(sequence->get_id());
         }
+        if (m_scheduler->is_swapped_out(sequence->get_id())) {
+            m_scheduler->free_swapped_sequence(sequence->get_id());
+        }
     }
     m_sampler->clear_request_info(request->get_request_id());
     request->set_generation_status(GenerationStatus::STOP);
@@ -110,7 +115,7 @@ remove_tokens_from_sequence(Sequence::Ptr& sequence,
 
     size_t removed_token_cnt = sequence_generated_len - min_generated_tokens;
     for (size_t i = min_generated_tokens; i < sequence_generated_len; ++i) {
-        logit_proccessor.decrease_generated_token_occurance(generated_token_ids[i]);
+        logit_proccessor.decrease_generated_token_occurance(generated_token_ids[i], sequence->get_id());
     }
     sequence->remove_last_tokens(removed_token_cnt);
     return (sequence_generated_len - min_generated_tokens);
@@ -127,7 +132,7 @@ insert_tokens_to_sequence(Sequence::Ptr& sequence,
     for (size_t i = generated_len; i < candidate_len; ++i) {
         sequence->append_token(token_ids[i], token_log_probs[i]);
         if (is_update_sampler) {
-            logit_proccessor.register_new_generated_token(token_ids[i]);
+            logit_proccessor.register_new_generated_token(token_ids[i], sequence->get_id());
         }
     }
     return (candidate_len - generated_len);
@@ -178,7 +183,7 @@ init_request(
         for (size_t i = 0; i < min_candidate_len; ++i) {
             sequence->append_token(token_ids[i], log_probs[i]);
             if (is_update_logit_processor) {
-                logit_processor.register_new_generated_token(token_ids[i]);
+                logit_processor.register_new_generated_token(token_ids[i], sequence->get_id());
                 logit_processor.update_generated_len(sequence->get_generated_len());
             }
         }
@@ -222,6 +227,8 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
         std::vector<Sequence::Ptr> running_sequences = request->get_running_sequences();
         OPENVINO_ASSERT(running_sequences.size() > 0);
         size_t min_generated_tokens, min_candidate_len;
+        // whether the sequence generated by the draft model ahead of the main one starts with the tokens of the latter
+        bool is_ahead = false;
         if (running_sequences.front()->get_generated_len() == 0 && !request->get_num_tokens_to_validate()) {
             m_sampler->create_logit_processor(request_id, request->get_sampling_parameters(), request->get_prompt_ids());
             auto& logit_processor = m_sampler->get_logit_processor(request_id);
@@ -233,9 +240,10 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
             // update existing sequences by the candidates
             auto& logit_processor = m_sampler->get_logit_processor(request_id);
             std::tie(min_generated_tokens, min_candidate_len) = get_prefix_len(running_sequences, candidates);
+            is_ahead = m_is_overlapped && running_sequences.size() == 1 && min_generated_tokens == min_candidate_len;
 
             for (auto& running_sequence : running_sequences) {
-                if (!candidates.count(running_sequence->get_grouped_id())) {
+                if (is_ahead || !candidates.count(running_sequence->get_grouped_id())) {
                     continue;
                 }
 
@@ -250,7 +258,7 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
             }
             // we should update a logit processor just for draft model to generate the same tokens
             // logit processors of main model will be updated in sampler while validation mode
-            if (is_update_logit_processor) {
+            if (is_update_logit_processor && !is_ahead) {
                 logit_processor.update_generated_len(min_candidate_len);
             }
         }
@@ -272,7 +280,7 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
             bool pause_gen_status = false;
             generated_len -= result.removed_tokens_cnt;
             generated_len += result.inserted_tokens_cnt;
-            if (generated_len >= max_new_tokens - 1 || generated_len != 0 && result.inserted_tokens_cnt == 0) {
+            if (generated_len >= max_new_tokens - 1 || generated_len != 0 && result.inserted_tokens_cnt == 0 && !is_ahead) {
                 pause_gen_status = true;
             }
             request->pause_generation(pause_gen_status);
@@ -302,10 +310,39 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_a
     m_awaiting_requests.clear();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::set_kv_cache_budget(std::shared_ptr<KVCacheBudget> kv_cache_budget) {
+    m_scheduler->set_kv_cache_budget(std::move(kv_cache_budget));
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_kv_cache_size_in_bytes() const {
+    return m_scheduler->get_kv_cache_size_in_bytes();
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::set_draft_length_controller(
+    std::shared_ptr<const DraftLengthController> draft_length_controller) {
+    m_draft_length_controller = std::move(draft_length_controller);
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
     bool to_generate = true;
     size_t generated_tokens_cnt = 0;
 
+    // { request_id, num_assistant_tokens }, the draft length limits of requests which are tuned by the controller
+    std::map<uint64_t, size_t> num_assistant_tokens;
+    if (m_draft_length_controller) {
+        for (const auto& request : m_requests) {
+            const auto& sampling_params = request->get_sampling_parameters();
+            const size_t request_id = request->get_request_id();
+            if (!sampling_params.is_assisting_generation()) {
+                continue;
+            }
+            // dynamic strategy is only limited under load
+            num_assistant_tokens[request_id] = sampling_params.assistant_confidence_threshold == 0.f ?
+                m_draft_length_controller->get_draft_length(request_id, sampling_params.num_assistant_tokens, m_requests.size()) :
+                m_draft_length_controller->get_max_draft_length(m_requests.size());
+        }
+    }
+
     // cycle to generate several tokens per one iteration for speculative decoding case
     while (to_generate) {
         generated_tokens_cnt++;
@@ -337,6 +374,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
                 request->pause_generation(true);
             } else if (sampling_params.num_assistant_tokens <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
                 request->pause_generation(true);
+            } else if (num_assistant_tokens.count(request->get_request_id()) &&
+                       num_assistant_tokens.at(request->get_request_id()) <= generated_tokens_cnt) {
+                request->pause_generation(true);
             } else if (request->get_max_new_tokens() == 0) {
                 request->pause_generation(true);
             } else if (request->get_num_processed_tokens() == request->get_prompt_len()) {
@@ -7,6 +7,7 @@
 
 #include "continuous_batching/pipeline_impl.hpp"
 #include "speculative_decoding/update_request_structs.hpp"
+#include "speculative_decoding/draft_length_controller.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
@@ -33,10 +34,26 @@ public:
 
     UpdateRequestResult init_request_by_candidate(uint64_t request_id, const GeneratedSequences& candidates);
 
+    // makes the KV cache of the pipeline grow from the budget shared with the other pipeline of speculative decoding
+    void set_kv_cache_budget(std::shared_ptr<KVCacheBudget> kv_cache_budget);
+    size_t get_kv_cache_size_in_bytes() const;
+
+    // tunes the number of candidates generated by multistep(), which is fixed by the generation config otherwise
+    void set_draft_length_controller(std::shared_ptr<const DraftLengthController> draft_length_controller);
+
+    // the draft pipeline generates the next candidates while the main pipeline validates the previous ones, so that its
+    // sequences get ahead of the main ones; the tokens ahead are kept by update_request, if the main ones are their prefix
+    void set_overlapped(bool is_overlapped) {
+        m_is_overlapped = is_overlapped;
+    }
+
     RawPerfMetrics raw_perf_metrics;
 
 protected:
     void finish_request(SequenceGroup::Ptr request);
     void _pull_awaiting_requests() override {};
+
+    std::shared_ptr<const DraftLengthController> m_draft_length_controller;
+    bool m_is_overlapped = false;
 };
 }
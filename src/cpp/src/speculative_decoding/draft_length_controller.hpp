@@ -0,0 +1,125 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+
+namespace ov::genai {
+
+/**
+ * Tunes the number of candidates generated by the draft model per step from the acceptance history of each request
+ * and from the measured durations of draft and main model steps.
+ *
+ * The probability that a candidate is accepted is estimated per request with exponentially decaying counts, assuming
+ * candidates are accepted independently until the first rejection. The draft length maximizes the expected number of
+ * tokens generated per step divided by the step duration. Under load, the draft length is limited so that the main
+ * model validates at most `max_num_scheduled_tokens` tokens per step, as speculation does not pay off once the main
+ * model step is compute-bound.
+ */
+class DraftLengthController {
+public:
+    explicit DraftLengthController(size_t max_num_scheduled_tokens = std::numeric_limits<size_t>::max(), float decay = 0.9f)
+        : m_max_num_scheduled_tokens(max_num_scheduled_tokens), m_decay(decay) {}
+
+    /**
+     * @param num_candidates The number of candidates validated by the main model in the last step.
+     * @param num_accepted The number of the candidates accepted by the main model.
+     */
+    void update_acceptance(uint64_t request_id, size_t num_candidates, size_t num_accepted) {
+        if (num_candidates == 0)
+            return;
+        num_accepted = std::min(num_accepted, num_candidates);
+        auto& history = m_acceptance_histories[request_id];
+        history.num_accepted = history.num_accepted * m_decay + num_accepted;
+        // the rejected candidate is the last trial, the ones after it were not evaluated
+        history.num_trials = history.num_trials * m_decay + num_accepted + (num_accepted < num_candidates ? 1 : 0);
+    }
+
+    /**
+     * @param draft_token_duration Duration of the draft model step generating one candidate.
+     * @param main_step_duration Duration of the main model step validating the candidates.
+     */
+    void update_durations(float draft_token_duration, float main_step_duration) {
+        if (main_step_duration <= 0.f)
+            return;
+        const float duration_ratio = std::max(draft_token_duration, 0.f) / main_step_duration;
+        m_duration_ratio = m_has_durations ? m_duration_ratio * m_decay + duration_ratio * (1.f - m_decay) : duration_ratio;
+        m_has_durations = true;
+    }
+
+    void remove_request(uint64_t request_id) {
+        m_acceptance_histories.erase(request_id);
+    }
+
+    /**
+     * @return The estimated probability of a candidate of the request to be accepted, 1 if there is no history yet.
+     */
+    float get_acceptance_probability(uint64_t request_id) const {
+        auto it = m_acceptance_histories.find(request_id);
+        if (it == m_acceptance_histories.end() || it->second.num_trials <= 0.f)
+            return 1.f;
+        return std::min(it->second.num_accepted / it->second.num_trials, 1.f);
+    }
+
+    /**
+     * @return The draft length limit for the case of `num_requests` requests generated together, 1 disables
+     * speculation as the draft model generates at least one candidate per step.
+     */
+    size_t get_max_draft_length(size_t num_requests) const {
+        if (num_requests == 0 || m_max_num_scheduled_tokens == std::numeric_limits<size_t>::max())
+            return std::numeric_limits<size_t>::max();
+        // the main model processes the candidates and one more token per request
+        const size_t num_tokens_per_request = m_max_num_scheduled_tokens / num_requests;
+        return num_tokens_per_request > 2 ? num_tokens_per_request - 1 : 1;
+    }
+
+    /**
+     * @return The draft length in [1, max_draft_length] for the request, which is generated together with
+     * `num_requests` requests.
+     */
+    size_t get_draft_length(uint64_t request_id, size_t max_draft_length, size_t num_requests = 1) const {
+        max_draft_length = std::max<size_t>(std::min(max_draft_length, get_max_draft_length(num_requests)), 1);
+        const float acceptance_probability = get_acceptance_probability(request_id);
+        if (acceptance_probability >= 1.f || !m_has_durations)
+            return max_draft_length;
+
+        size_t best_draft_length = 1;
+        float best_throughput = 0.f;
+        // expected number of generated tokens is 1 + p + ... + p^k for k candidates
+        float expected_num_tokens = 1.f, acceptance_power = 1.f;
+        for (size_t draft_length = 1; draft_length <= max_draft_length; ++draft_length) {
+            acceptance_power *= acceptance_probability;
+            expected_num_tokens += acceptance_power;
+            const float throughput = expected_num_tokens / (1.f + draft_length * m_duration_ratio);
+            if (throughput > best_throughput) {
+                best_throughput = throughput;
+                best_draft_length = draft_length;
+            }
+            // further candidates add less than the precision
+            if (acceptance_power < 1e-4f)
+                break;
+        }
+        return best_draft_length;
+    }
+
+private:
+    struct AcceptanceHistory {
+        float num_accepted = 0.f;
+        float num_trials = 0.f;
+    };
+
+    size_t m_max_num_scheduled_tokens;
+    float m_decay;
+    // { request_id, decayed counts of accepted candidates and of evaluated candidates }
+    std::map<uint64_t, AcceptanceHistory> m_acceptance_histories;
+    // ratio of the draft model duration per candidate to the main model step duration
+    float m_duration_ratio = 0.f;
+    bool m_has_durations = false;
+};
+
+}  // namespace ov::genai
@@ -1,12 +1,14 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <future>
 #include <thread>
 
 #include "openvino/genai/text_streamer.hpp"
 #include "speculative_decoding_impl.hpp"
 #include "continuous_batching/paged_attention_transformations.hpp"
 #include "utils.hpp"
+#include "logger.hpp"
 
 
 namespace ov::genai {
@@ -26,15 +28,51 @@ bool are_tokenizers_equal(Tokenizer& lhs, Tokenizer& rhs) {
 }
 
 ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(const ov::genai::ModelDesc& main_model_desc, 
-                                                                             const ov::genai::ModelDesc& draft_model_desc) {
+                                                                             const ov::genai::ModelDesc& draft_model_desc,
+                                                                             std::shared_ptr<InputsEmbedder> inputs_embedder) {
     auto main_model = main_model_desc.model;
     auto draft_model = draft_model_desc.model;
 
+    if (inputs_embedder) {
+        const auto get_hidden_size = [] (const std::shared_ptr<ov::Model>& model) {
+            for (const auto& input : model->inputs()) {
+                if (input.get_names().count("inputs_embeds")) {
+                    return input.get_partial_shape().rbegin()->get_max_length();
+                }
+            }
+            OPENVINO_THROW("The draft model of the pipeline with embeddings must have 'inputs_embeds' input");
+        };
+        OPENVINO_ASSERT(get_hidden_size(main_model) == get_hidden_size(draft_model),
+                        "The draft model must accept the embeddings of the main model");
+    }
+
     auto main_scheduler_config = main_model_desc.scheduler_config;
     auto main_device = main_model_desc.device;
 
-    utils::apply_paged_attention_transformations(main_model, main_model_desc.scheduler_config.use_cache_eviction);
-    utils::apply_paged_attention_transformations(draft_model, main_model_desc.scheduler_config.use_cache_eviction);
+    ov::AnyMap main_properties = main_model_desc.properties;
+    ov::AnyMap draft_properties = draft_model_desc.properties.empty() ? main_model_desc.properties : draft_model_desc.properties;
+
+    // Extract self_speculative_num_layers property if exists and remove it from properties
+    size_t self_speculative_num_layers = 0;
+    for (auto properties : {&main_properties, &draft_properties}) {
+        auto num_layers_it = properties->find(ov::genai::self_speculative_num_layers.name());
+        if (num_layers_it != properties->end()) {
+            self_speculative_num_layers = num_layers_it->second.is<int64_t>() ? num_layers_it->second.as<int64_t>() : num_layers_it->second.as<size_t>();
+            properties->erase(num_layers_it);
+        }
+    }
+
+    // sparse decoding needs the per-layer attention score outputs of the model it is enabled for
+    const auto& draft_model_scheduler_config = draft_model_desc.scheduler_config == SchedulerConfig() ? main_model_desc.scheduler_config : draft_model_desc.scheduler_config;
+    utils::apply_paged_attention_transformations(main_model, main_model_desc.scheduler_config.use_cache_eviction || is_sparse_decoding_enabled(main_model_desc.scheduler_config));
+    utils::apply_paged_attention_transformations(draft_model, main_model_desc.scheduler_config.use_cache_eviction || is_sparse_decoding_enabled(draft_model_scheduler_config));
+    if (self_speculative_num_layers > 0) {
+        // the draft model is the copy of the main model, which drafts with its first layers followed by the LM head
+        utils::apply_layer_skip_transformation(draft_model, self_speculative_num_layers);
+    }
+    utils::apply_kv_cache_precisions(main_model, main_model_desc.scheduler_config.kv_cache_precision_config);
+    // the per-layer precisions of the main model aren't applied to the draft one, which has the other layers
+    utils::apply_kv_cache_precisions(draft_model, draft_model_desc.scheduler_config.kv_cache_precision_config);
 
     utils::apply_gather_before_matmul_transformation(main_model);
     utils::apply_gather_before_matmul_transformation(draft_model);
@@ -45,7 +83,19 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     ov::genai::SchedulerConfig main_scheduler_config_updated = main_scheduler_config,
                                draft_scheduler_config = is_draft_scheduler_undefined ? main_scheduler_config : draft_model_desc.scheduler_config;
 
-    if (is_draft_scheduler_undefined) {
+    OPENVINO_ASSERT(!is_draft_scheduler_undefined || main_scheduler_config.kv_cache_memory_utilization == 0.0f ||
+                    main_scheduler_config.num_kv_blocks > 0 || main_scheduler_config.cache_size > 0,
+                    "SchedulerConfig::kv_cache_memory_utilization requires the scheduler config of the draft model to be set, ",
+                    "as the KV cache of the main model is sized before the draft model is loaded");
+    std::shared_ptr<KVCacheBudget> kv_cache_budget;
+    if (is_draft_scheduler_undefined && main_scheduler_config.num_kv_blocks == 0 && main_scheduler_config.cache_size > 0 &&
+        !main_scheduler_config.use_cache_eviction) {
+        // main and draft models grow their KV caches on demand from the common budget, so that the one under load
+        // is not limited by a static share, while the other one has free blocks
+        kv_cache_budget = std::make_shared<KVCacheBudget>(main_scheduler_config.cache_size * 1024 * 1024 * 1024);
+        main_scheduler_config_updated.cache_size = 0;
+        draft_scheduler_config.cache_size = 0;
+    } else if (is_draft_scheduler_undefined) {
         // split KV cache to 2 caches for main and draft models
         auto compute_total_hidden_size = [] (const std::shared_ptr<ov::Model>& model) -> size_t {
             size_t total_hidden_size = 0;
@@ -79,7 +129,33 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
         draft_scheduler_config.max_num_batched_tokens = main_scheduler_config_updated.max_num_batched_tokens;
     }
 
-    ov::AnyMap draft_properties = draft_model_desc.properties.empty() ? main_model_desc.properties : draft_model_desc.properties;
+    if (!main_scheduler_config_updated.prefix_cache_path.empty() || !draft_scheduler_config.prefix_cache_path.empty()) {
+        // the KV caches of the main and draft models grow from the common budget, which is only known after both
+        // pipelines are created, while the persisted prefix cache is loaded on pipeline creation
+        Logger::warn("SchedulerConfig::prefix_cache_path is not supported by speculative decoding, the prefix cache is not persisted");
+        main_scheduler_config_updated.prefix_cache_path.clear();
+        draft_scheduler_config.prefix_cache_path.clear();
+    }
+
+    // Extract adaptive_draft_length property if exists and remove it from properties
+    bool is_adaptive_draft_length = false;
+    for (auto properties : {&main_properties, &draft_properties}) {
+        auto adaptive_draft_length_it = properties->find("adaptive_draft_length");
+        if (adaptive_draft_length_it != properties->end()) {
+            is_adaptive_draft_length |= adaptive_draft_length_it->second.as<bool>();
+            properties->erase(adaptive_draft_length_it);
+        }
+    }
+
+    // Extract overlap_draft_model property if exists and remove it from properties
+    m_is_draft_overlapped = draft_device != main_device;
+    for (auto properties : {&main_properties, &draft_properties}) {
+        auto overlap_draft_model_it = properties->find("overlap_draft_model");
+        if (overlap_draft_model_it != properties->end()) {
+            m_is_draft_overlapped = overlap_draft_model_it->second.as<bool>();
+            properties->erase(overlap_draft_model_it);
+        }
+    }
 
     // main and draft model can have different tokenizers
     // to do: support retokenization: 154103
@@ -94,11 +170,32 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     // to create `main_pipeline` with enabled validation_mode and `draft_pipeline` with disabled validation mode
     m_main_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         main_model, main_model_tokenizer, main_model_desc.generation_config,
-        main_scheduler_config_updated, main_device, main_model_desc.properties, true);
+        main_scheduler_config_updated, main_device, main_properties, true);
     m_draft_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         draft_model, draft_model_tokenizer, draft_model_desc.generation_config,
         draft_scheduler_config, draft_device, draft_properties, false);
 
+    if (inputs_embedder) {
+        m_main_pipeline->set_inputs_embedder(inputs_embedder);
+        m_draft_pipeline->set_inputs_embedder(inputs_embedder);
+        m_inputs_embedder = inputs_embedder;
+        m_model_input_type = ModelInputType::EMBEDDINGS;
+    }
+
+    m_draft_pipeline->set_overlapped(m_is_draft_overlapped);
+
+    if (kv_cache_budget) {
+        m_main_pipeline->set_kv_cache_budget(kv_cache_budget);
+        m_draft_pipeline->set_kv_cache_budget(kv_cache_budget);
+    }
+
+    if (is_adaptive_draft_length) {
+        // the main model step validating more tokens than a batch takes with split fuse is considered to be compute-bound
+        m_draft_length_controller = std::make_shared<DraftLengthController>(main_scheduler_config_updated.dynamic_split_fuse ?
+            main_scheduler_config_updated.max_num_batched_tokens : std::numeric_limits<size_t>::max());
+        m_draft_pipeline->set_draft_length_controller(m_draft_length_controller);
+    }
+
     m_perf_metrics = ov::genai::SDPerModelsPerfMetrics();
     m_draft_pipeline->raw_perf_metrics.m_inference_durations =  {{ MicroSeconds(0.0f) }};
 }
@@ -158,30 +255,50 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     m_draft_pipeline->pull_awaiting_requests(true);
     m_main_pipeline->pull_awaiting_requests();
 
-    // generate candidates by draft model
     ManualTimer draft_timer("speculative_decoding: draft_model: multistep()");
-    draft_timer.start();
-    m_draft_pipeline->multistep();
-    draft_timer.end();
-    m_sd_metrics.draft_duration += draft_timer.get_duration();
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
+    ManualTimer main_timer("speculative_decoding: main_model: step()");
+    auto generate_candidates = [&] {
+        draft_timer.start();
+        m_draft_pipeline->multistep();
+        draft_timer.end();
+    };
 
     // to generate num_matches statistic
     std::map<int64_t, UpdateRequestResult> update_sequence_info;
+    GeneratedRequests draft_generated_requests;
     // put candidates to model KV cache
-    auto draft_generated_requests = m_draft_pipeline->get_generated_requests();
-    for (const auto& candidate : m_draft_pipeline->get_generated_requests()) {
-        auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
-        update_sequence_info.insert({{candidate.first, update_result}});
+    auto put_candidates = [&] {
+        draft_generated_requests = m_draft_pipeline->get_generated_requests();
+        for (const auto& candidate : draft_generated_requests) {
+            auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
+            update_sequence_info.insert({{candidate.first, update_result}});
+        }
+    };
+
+    if (m_is_draft_overlapped) {
+        // the candidates generated at the previous step are validated, while the draft model extends them on its device
+        // assuming they are accepted; the tokens generated after a rejected candidate are removed by update_request
+        put_candidates();
+        auto draft_future = std::async(std::launch::async, generate_candidates);
+        main_timer.start();
+        m_main_pipeline->step();
+        main_timer.end();
+        draft_future.get();
+    } else {
+        // generate candidates by draft model
+        generate_candidates();
+        put_candidates();
+        main_timer.start();
+        m_main_pipeline->step();
+        main_timer.end();
     }
-
-    ManualTimer main_timer("speculative_decoding: main_model: step()");
-    main_timer.start();
-    m_main_pipeline->step();
-    main_timer.end();
+    m_sd_metrics.draft_duration += draft_timer.get_duration();
     m_sd_metrics.main_duration += main_timer.get_duration();
     m_pipeline_metrics = m_main_pipeline->get_metrics();
 
+    m_sd_metrics.update_cache_occupancy(m_main_pipeline->get_kv_cache_size_in_bytes(), m_pipeline_metrics.cache_usage,
+                                        m_draft_pipeline->get_kv_cache_size_in_bytes(), m_draft_pipeline->get_metrics().cache_usage);
+
     auto main_generated_requests = m_main_pipeline->get_generated_requests();
     for (const auto& checked_sequence : main_generated_requests) {
         auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true);
@@ -189,12 +306,16 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     }
 
     // finish draft request if the generation was completed
+    size_t max_inserted_tokens_cnt = 0;
     for (const auto& draft_request : draft_generated_requests) {
         auto request_id = draft_request.first;
         if (!main_generated_requests.count(request_id)) {
             m_draft_pipeline->finish_request(request_id);
             // remove draft_generation_handle from queue
             m_draft_generations.erase(request_id);
+            if (m_draft_length_controller) {
+                m_draft_length_controller->remove_request(request_id);
+            }
         }
         auto updated_seq_info = update_sequence_info[request_id];
         m_sd_metrics.update_draft_generated_len(request_id, updated_seq_info.inserted_tokens_cnt);
@@ -206,6 +327,15 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         float acceptance_rate = 1 - static_cast<float>(updated_seq_info.removed_tokens_cnt) / updated_seq_info.inserted_tokens_cnt;
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
+        if (m_draft_length_controller) {
+            m_draft_length_controller->update_acceptance(request_id, updated_seq_info.inserted_tokens_cnt,
+                                                         updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt);
+            max_inserted_tokens_cnt = std::max(max_inserted_tokens_cnt, updated_seq_info.inserted_tokens_cnt);
+        }
+    }
+    if (m_draft_length_controller && max_inserted_tokens_cnt > 0) {
+        // the draft model makes as many steps as the longest candidate has tokens
+        m_draft_length_controller->update_durations(draft_timer.get_duration() / max_inserted_tokens_cnt, main_timer.get_duration());
     }
 
     step_timer.end();
@@ -240,7 +370,6 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<
                                                               const std::vector<GenerationConfig>& sampling_params,
                                                               const StreamerVariant& streamer,
                                                               std::optional<std::vector<ov::Tensor>> token_type_ids) {
-    OPENVINO_ASSERT(!token_type_ids.has_value());
     m_perf_metrics = ov::genai::SDPerModelsPerfMetrics();
     m_draft_pipeline->raw_perf_metrics.m_inference_durations =  {{ MicroSeconds(0.0f) }};
 
@@ -266,14 +395,16 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<
     std::vector<GenerationHandle> main_generations;
     for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
         OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
-        main_generations.push_back(m_main_pipeline->add_request(request_id, input_ids[request_id], sampling_params[request_id]));
+        const bool has_token_type_ids = token_type_ids.has_value() && request_id < token_type_ids->size();
+        const auto request_token_type_ids = has_token_type_ids ? std::make_optional((*token_type_ids)[request_id]) : std::nullopt;
+        main_generations.push_back(m_main_pipeline->add_request(request_id, input_ids[request_id], sampling_params[request_id], request_token_type_ids));
 
         auto draft_sampling_params = sampling_params[request_id];
         // set the parameters do not stop draft generation without stopping of the same request for main pipeline
         draft_sampling_params.ignore_eos = true;
         draft_sampling_params.stop_strings = {};
         std::lock_guard<std::mutex> lock(m_draft_generations_mutex);
-        m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids[request_id], draft_sampling_params)});
+        m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids[request_id], draft_sampling_params, request_token_type_ids)});
     }
     auto all_requests = get_awaiting_requests();
 
@@ -315,6 +446,7 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<
         result.m_generation_ids.resize(num_outputs);
         result.m_scores.resize(num_outputs);
         result.m_status = request->get_generation_stream()->get_status();
+        result.request_metrics = request->get_request_metrics();
 
         for (size_t i = 0; i < num_outputs; ++i) {
             const auto & sequence = sequences[i];
@@ -40,6 +40,11 @@ protected:
     std::shared_ptr<ContinuousBatchingForSpeculativeDecodingImpl> m_main_pipeline, m_draft_pipeline;
     // Metrics
     SpeculativeDecodingMetrics m_sd_metrics;
+    // tunes the draft length from the acceptance of candidates, enabled by `adaptive_draft_length` property
+    std::shared_ptr<DraftLengthController> m_draft_length_controller;
+    // whether the draft model generates the next candidates while the main model validates the previous ones, enabled
+    // by `overlap_draft_model` property, by default if the models are on different devices
+    bool m_is_draft_overlapped = false;
     ov::genai::SDPerModelsPerfMetrics m_perf_metrics;
 
     // Mutex protecting access to m_draft_generations, so add_request and step methods can be called from different threads
@@ -51,7 +56,11 @@ protected:
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
     
 public:
-    SpeculativeDecodingImpl(const ov::genai::ModelDesc& main_model_desc, const ov::genai::ModelDesc& draft_model_desc);
+    // the draft model of the pipeline with the inputs embedder is run on the embeddings of the main model, so it's
+    // expected to share them, e.g. to be the self-speculative draft model
+    SpeculativeDecodingImpl(const ov::genai::ModelDesc& main_model_desc,
+                            const ov::genai::ModelDesc& draft_model_desc,
+                            std::shared_ptr<InputsEmbedder> inputs_embedder = nullptr);
 
     GenerationHandle add_request(uint64_t request_id,
                                  const ov::Tensor& input_ids,
@@ -72,6 +81,29 @@ public:
              std::optional<std::vector<ov::Tensor>> token_type_ids = std::nullopt) override;
 
     SpeculativeDecodingMetrics get_speculative_decoding_metrics();
+
+    // the latencies of the requests of the main pipeline
+    ServingMetrics get_serving_metrics() const override {
+        return m_main_pipeline->get_serving_metrics();
+    }
+
+    // the memory of the main and the draft pipelines, the weights of the draft models are prefixed with "draft_"
+    MemoryReport get_memory_report() const override {
+        MemoryReport memory_report = m_main_pipeline->get_memory_report();
+        const MemoryReport draft_memory_report = m_draft_pipeline->get_memory_report();
+        for (const auto& [model_name, byte_size] : draft_memory_report.weights) {
+            memory_report.weights["draft_" + model_name] = byte_size;
+        }
+        memory_report.kv_cache_allocated += draft_memory_report.kv_cache_allocated;
+        memory_report.kv_cache_used += draft_memory_report.kv_cache_used;
+        memory_report.prefix_cache += draft_memory_report.prefix_cache;
+        memory_report.kv_cache_swap_space += draft_memory_report.kv_cache_swap_space;
+        memory_report.input_buffers += draft_memory_report.input_buffers;
+        if (m_inputs_embedder) {
+            memory_report.vision_embedding_cache = m_inputs_embedder->get_vision_embedding_cache_byte_size();
+        }
+        return memory_report;
+    }
 };
 
 }
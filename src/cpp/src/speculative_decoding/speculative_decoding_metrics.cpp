@@ -103,6 +103,13 @@ void SpeculativeDecodingMetrics::update_generated_len(size_t generated_len) {
     m_generated_len += generated_len;
 }
 
+void SpeculativeDecodingMetrics::update_cache_occupancy(size_t main_cache_size, float main_usage, size_t draft_cache_size, float draft_usage) {
+    main_cache_size_in_bytes = main_cache_size;
+    main_cache_usage = main_usage;
+    draft_cache_size_in_bytes = draft_cache_size;
+    draft_cache_usage = draft_usage;
+}
+
 std::vector<int64_t> SpeculativeDecodingMetrics::get_requests_id() {
     std::vector<int64_t> result;
     for (const auto& req : m_draft_generated_len) {
@@ -134,6 +141,8 @@ void SpeculativeDecodingMetrics::print(bool is_printing_per_request) {
     std::cout << "Main model duration, %: " << get_main_duration_percentage() << std::endl;
     std::cout << "Token per sec: " << float(m_generated_len) / total_duration << std::endl;
     std::cout << "AVG acceptance rate, %: " << get_avg_acceptance_rate(-1) << std::endl;
+    std::cout << "Main model KV cache, MB: " << main_cache_size_in_bytes / (1024 * 1024) << ", used %: " << main_cache_usage << std::endl;
+    std::cout << "Draft model KV cache, MB: " << draft_cache_size_in_bytes / (1024 * 1024) << ", used %: " << draft_cache_usage << std::endl;
     std::cout << "=============================== " << std::endl;
     if (is_printing_per_request) {
         for (const auto& i : get_requests_id()) {
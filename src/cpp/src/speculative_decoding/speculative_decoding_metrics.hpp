@@ -20,6 +20,11 @@ class SpeculativeDecodingMetrics {
 public:
     float draft_duration = 0, main_duration = 0, total_duration = 0;
     size_t m_generated_len = 0;
+    // KV cache occupancy of the main and draft models at the last step: allocated memory and % of it used
+    size_t main_cache_size_in_bytes = 0, draft_cache_size_in_bytes = 0;
+    float main_cache_usage = 0, draft_cache_usage = 0;
+
+    void update_cache_occupancy(size_t main_cache_size, float main_usage, size_t draft_cache_size, float draft_usage);
 
     float get_avg_acceptance_rate(int64_t request_id);
     void update_acceptance_rate(int64_t request_id, float acceptance_rate);
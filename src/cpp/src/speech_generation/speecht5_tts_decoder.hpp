@@ -19,13 +19,18 @@ public:
                        const std::string& device,
                        const ov::AnyMap& properties);
 
+    /**
+     * @param beam_idx The rows of the previous batch whose key values are kept by each row of the batch, so that the
+     * finished utterances are dropped from the batch.
+     */
     void start_async(const Tensor& inputs_embeds,
                      const Tensor& speaker_embeddings,
                      const Tensor& encoder_hidden_states,
                      const Tensor& encoder_attention_mask,
-                     const Tensor& spectrogram);
+                     const Tensor& beam_idx);
 
-    std::tuple<Tensor, Tensor, Tensor, Tensor> wait();
+    // the output sequence, the [batch_size, reduction_factor, num_mel_bins] spectrum and the stop probabilities
+    std::tuple<Tensor, Tensor, Tensor> wait();
 
     void reset_state();
 
@@ -33,6 +38,5 @@ public:
 
 private:
     ov::InferRequest m_request;
-    Tensor m_beam_idx_tensor;
 };
 }  // namespace ov::genai
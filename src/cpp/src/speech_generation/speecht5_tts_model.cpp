@@ -4,10 +4,14 @@
 #include "speecht5_tts_model.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <numeric>
 #include <openvino/openvino.hpp>
+#include <optional>
+#include <type_traits>
 #include <variant>
 
 #include "default_speaker_embedding.hpp"
@@ -17,6 +21,17 @@
 #include "utils.hpp"
 
 namespace {
+// the utterances decoded together, bounding the memory of the padded encoder hidden states
+constexpr size_t max_batch_size = 8;
+
+// the decoder steps vocoded together while streaming, each step generates reduction_factor spectrum frames
+constexpr size_t streaming_chunk_steps = 16;
+// the steps preceding and following a streamed chunk, which are vocoded as its context and dropped
+constexpr size_t streaming_context_steps = 8;
+constexpr size_t streaming_lookahead_steps = 4;
+// the audio of the first steps of a chunk is crossfaded with the lookahead audio of the previous chunk
+constexpr size_t streaming_crossfade_steps = 2;
+static_assert(streaming_crossfade_steps <= streaming_lookahead_steps);
 
 ov::InferRequest init_model(const std::filesystem::path& models_path,
                             const std::string& model_file_name,
@@ -70,15 +85,396 @@ ov::Tensor postnet(ov::InferRequest& request,
     return postnet_spectrogram;
 }
 
-ov::Tensor vocoder(ov::InferRequest& request, const ov::Tensor& spectrogram, ov::genai::RawPerfMetrics& raw_metrics) {
-    request.set_tensor("spectrogram", spectrogram);
+ov::Tensor copy_to_host(const ov::Tensor& tensor) {
+    ov::Tensor host_tensor(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(host_tensor);
+    return host_tensor;
+}
 
-    const auto infer_start = std::chrono::steady_clock::now();
-    request.infer();
-    const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+// stacks the [1, seq_len, ...] tensors into a batch, the shorter sequences are padded by zeros
+ov::Tensor stack_padded(const std::vector<ov::Tensor>& tensors) {
+    ov::Shape shape = tensors.at(0).get_shape();
+    shape[0] = tensors.size();
+    for (const ov::Tensor& tensor : tensors) {
+        shape[1] = std::max(shape[1], tensor.get_shape().at(1));
+    }
+
+    ov::Tensor stacked(tensors[0].get_element_type(), shape);
+    std::memset(stacked.data(), 0, stacked.get_byte_size());
+    const size_t row_byte_size = stacked.get_byte_size() / tensors.size();
+    for (size_t row = 0; row < tensors.size(); ++row) {
+        std::memcpy(static_cast<uint8_t*>(stacked.data()) + row * row_byte_size,
+                    tensors[row].data(),
+                    tensors[row].get_byte_size());
+    }
+    return stacked;
+}
+
+ov::Tensor gather_rows(const ov::Tensor& tensor, const std::vector<size_t>& rows) {
+    ov::Shape shape = tensor.get_shape();
+    const size_t row_byte_size = tensor.get_byte_size() / shape.at(0);
+    shape[0] = rows.size();
+
+    ov::Tensor gathered(tensor.get_element_type(), shape);
+    for (size_t row = 0; row < rows.size(); ++row) {
+        std::memcpy(static_cast<uint8_t*>(gathered.data()) + row * row_byte_size,
+                    static_cast<const uint8_t*>(tensor.data()) + rows[row] * row_byte_size,
+                    row_byte_size);
+    }
+    return gathered;
+}
+
+// vocodes the spectrograms of the finished utterances one by one, while the decoder generates the rest of them
+class AsyncVocoder {
+public:
+    AsyncVocoder(ov::InferRequest& request, std::vector<ov::Tensor>& waveforms)
+        : m_request(request),
+          m_waveforms(waveforms) {}
+
+    void push(const size_t utterance_idx, const ov::Tensor& spectrogram) {
+        m_pending.emplace_back(utterance_idx, spectrogram);
+        poll();
+    }
+
+    // collects the waveform of the finished inference, if any, and starts the next one
+    void poll() {
+        if (m_running_idx.has_value()) {
+            if (!m_request.wait_for(std::chrono::milliseconds(0))) {
+                return;
+            }
+            collect();
+        }
+        start_next();
+    }
+
+    void finish() {
+        while (m_running_idx.has_value()) {
+            m_request.wait();
+            collect();
+            start_next();
+        }
+    }
+
+private:
+    void collect() {
+        // the output tensor is reused by the next inference
+        m_waveforms[*m_running_idx] = copy_to_host(m_request.get_tensor("waveform"));
+        m_running_idx.reset();
+    }
+
+    void start_next() {
+        if (m_pending.empty()) {
+            return;
+        }
+        const auto [utterance_idx, spectrogram] = m_pending.front();
+        m_pending.pop_front();
+
+        m_request.set_tensor("spectrogram", spectrogram);
+        m_request.start_async();
+        m_running_idx = utterance_idx;
+    }
+
+    ov::InferRequest& m_request;
+    std::vector<ov::Tensor>& m_waveforms;
+    std::deque<std::pair<size_t, ov::Tensor>> m_pending;
+    std::optional<size_t> m_running_idx;
+};
+
+/**
+ * Vocodes the spectrogram of a single utterance in chunks as the decoder generates it and delivers the audio to the
+ * streamer. The postnet and the vocoder of a chunk see the context steps around it, which are cut from the audio, and
+ * the chunk boundaries are crossfaded, so that the chunks join without clicks.
+ */
+class StreamingVocoder {
+public:
+    StreamingVocoder(ov::InferRequest& postnet_request,
+                     ov::InferRequest& vocoder_request,
+                     const ov::genai::SpeechStreamer& streamer,
+                     const size_t utterance_idx,
+                     const size_t reduction_factor,
+                     const size_t num_mel_bins,
+                     ov::genai::RawPerfMetrics& raw_metrics)
+        : m_postnet_request(postnet_request),
+          m_vocoder_request(vocoder_request),
+          m_streamer(streamer),
+          m_utterance_idx(utterance_idx),
+          m_reduction_factor(reduction_factor),
+          m_num_mel_bins(num_mel_bins),
+          m_raw_metrics(raw_metrics) {}
+
+    /**
+     * Starts vocoding the next chunk once the spectrogram has enough steps after it
+     * @param spectrogram the spectrum frames generated so far
+     * @param is_last whether the decoder has finished, then the remaining steps are vocoded
+     * @returns false if the streamer has stopped the generation
+     */
+    bool push(const std::vector<float>& spectrogram, const bool is_last) {
+        poll();
+        const size_t num_steps = spectrogram.size() / (m_reduction_factor * m_num_mel_bins);
+        const size_t chunk_start = m_scheduled_steps;
+        const bool is_ready = is_last ? chunk_start < num_steps
+                                      : num_steps >= chunk_start + streaming_chunk_steps + streaming_lookahead_steps;
+        if (!is_running() || !is_ready) {
+            return is_running();
+        }
+
+        // the vocoder request is reused by the chunk
+        wait();
+        if (!is_running()) {
+            return false;
+        }
+
+        Chunk chunk;
+        chunk.window_start = chunk_start - std::min(chunk_start, streaming_context_steps);
+        chunk.start = chunk_start;
+        chunk.end = is_last ? num_steps : chunk_start + streaming_chunk_steps;
+        chunk.window_end = is_last ? num_steps : chunk.end + streaming_lookahead_steps;
+
+        const size_t frame_size = m_reduction_factor * m_num_mel_bins;
+        ov::Tensor raw_spectrogram(ov::element::f32,
+                                   ov::Shape{chunk.window_end - chunk.window_start, 1, m_reduction_factor, m_num_mel_bins},
+                                   const_cast<float*>(spectrogram.data()) + chunk.window_start * frame_size);
+        // the postnet output tensor is reused by the next inference
+        m_vocoder_request.set_tensor("spectrogram",
+                                     copy_to_host(postnet(m_postnet_request, raw_spectrogram, m_raw_metrics)));
+        m_vocoder_request.start_async();
+        m_running_chunk = chunk;
+        m_scheduled_steps = chunk.end;
+        return true;
+    }
+
+    // delivers the audio of the finished chunk, if any
+    void poll() {
+        if (m_running_chunk.has_value() && m_vocoder_request.wait_for(std::chrono::milliseconds(0))) {
+            collect();
+        }
+    }
+
+    void wait() {
+        if (m_running_chunk.has_value()) {
+            m_vocoder_request.wait();
+            collect();
+        }
+    }
+
+    ov::genai::StreamingStatus get_status() const {
+        return m_status;
+    }
+
+    // the audio delivered to the streamer
+    ov::Tensor get_speech() const {
+        ov::Tensor speech(ov::element::f32, ov::Shape{m_speech.size()});
+        std::copy(m_speech.begin(), m_speech.end(), speech.data<float>());
+        return speech;
+    }
 
-    auto waveform = request.get_tensor("waveform");
-    return waveform;
+private:
+    // the decoder steps of a chunk and of its context
+    struct Chunk {
+        size_t window_start;
+        size_t start;
+        size_t end;
+        size_t window_end;
+    };
+
+    bool is_running() const {
+        return m_status == ov::genai::StreamingStatus::RUNNING;
+    }
+
+    void collect() {
+        const Chunk chunk = *m_running_chunk;
+        m_running_chunk.reset();
+
+        // the output tensor is reused by the next inference
+        const ov::Tensor waveform = copy_to_host(m_vocoder_request.get_tensor("waveform"));
+        const size_t samples_per_step = waveform.get_size() / (chunk.window_end - chunk.window_start);
+        const float* samples = waveform.data<float>();
+        const float* chunk_samples = samples + (chunk.start - chunk.window_start) * samples_per_step;
+        const float* chunk_samples_end = samples + (chunk.end - chunk.window_start) * samples_per_step;
+
+        ov::Tensor audio(ov::element::f32, ov::Shape{static_cast<size_t>(chunk_samples_end - chunk_samples)});
+        float* audio_data = audio.data<float>();
+        std::copy(chunk_samples, chunk_samples_end, audio_data);
+
+        // linear crossfade with the lookahead audio of the previous chunk
+        const size_t crossfade_size = std::min(m_lookahead.size(), audio.get_size());
+        for (size_t i = 0; i < crossfade_size; ++i) {
+            const float weight = static_cast<float>(i + 1) / static_cast<float>(crossfade_size + 1);
+            audio_data[i] = m_lookahead[i] * (1.0f - weight) + audio_data[i] * weight;
+        }
+        const float* samples_end = samples + waveform.get_size();
+        m_lookahead.assign(chunk_samples_end,
+                           std::min(chunk_samples_end + streaming_crossfade_steps * samples_per_step, samples_end));
+
+        m_speech.insert(m_speech.end(), audio_data, audio_data + audio.get_size());
+        m_status = m_streamer(m_utterance_idx, audio);
+    }
+
+    ov::InferRequest& m_postnet_request;
+    ov::InferRequest& m_vocoder_request;
+    const ov::genai::SpeechStreamer& m_streamer;
+    const size_t m_utterance_idx;
+    const size_t m_reduction_factor;
+    const size_t m_num_mel_bins;
+    ov::genai::RawPerfMetrics& m_raw_metrics;
+
+    ov::genai::StreamingStatus m_status = ov::genai::StreamingStatus::RUNNING;
+    size_t m_scheduled_steps = 0;
+    std::optional<Chunk> m_running_chunk;
+    std::vector<float> m_lookahead;
+    std::vector<float> m_speech;
+};
+
+// the utterances decoded together
+struct UtteranceBatch {
+    std::vector<size_t> utterance_idxs;
+    // the decoder steps bounds of each utterance
+    std::vector<int64_t> minlens;
+    std::vector<int64_t> maxlens;
+    ov::Tensor encoder_hidden_states;
+    ov::Tensor encoder_attention_mask;
+    ov::Tensor speaker_embeddings;
+};
+
+/**
+ * Decodes the spectrograms of the batch until each row meets the stop probability threshold or its maximum length. The
+ * finished rows are refined by the postnet, passed to the vocoder and dropped from the batch and the decoder states.
+ */
+void decode_batch(ov::genai::SpeechT5TTSDecoder& decoder,
+                  ov::InferRequest& postnet_request,
+                  AsyncVocoder& vocoder,
+                  UtteranceBatch batch,
+                  const float threshold,
+                  const size_t reduction_factor,
+                  const size_t num_mel_bins,
+                  ov::genai::RawPerfMetrics& raw_metrics) {
+    const size_t frame_size = reduction_factor * num_mel_bins;
+    size_t batch_size = batch.utterance_idxs.size();
+
+    // the spectrum frames generated for each row
+    std::vector<std::vector<float>> spectrograms(batch_size);
+
+    ov::Tensor inputs_embeds = decoder.create_host_tensor(ov::element::f32, {batch_size, 1, num_mel_bins});
+    std::fill_n(inputs_embeds.data<float>(), inputs_embeds.get_size(), 0.0f);
+    ov::Tensor beam_idx = decoder.create_host_tensor(ov::element::i32, {batch_size});
+    std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + batch_size, 0);
+
+    for (int64_t iter = 1; batch_size > 0; ++iter) {
+        decoder.start_async(inputs_embeds,
+                            batch.speaker_embeddings,
+                            batch.encoder_hidden_states,
+                            batch.encoder_attention_mask,
+                            beam_idx);
+        vocoder.poll();
+        auto [out_seq, spectrum, prob] = decoder.wait();
+
+        const float* spectrum_data = spectrum.data<float>();
+        const float* prob_data = prob.data<float>();
+        const size_t row_prob_size = prob.get_size() / batch_size;
+
+        std::vector<size_t> kept_rows;
+        for (size_t row = 0; row < batch_size; ++row) {
+            spectrograms[row].insert(spectrograms[row].end(),
+                                     spectrum_data + row * frame_size,
+                                     spectrum_data + (row + 1) * frame_size);
+            if (iter < batch.minlens[row]) {
+                kept_rows.push_back(row);
+                continue;
+            }
+
+            const float prob_sum = std::accumulate(prob_data + row * row_prob_size,
+                                                   prob_data + (row + 1) * row_prob_size,
+                                                   0.0f);
+            if (prob_sum < threshold && iter < batch.maxlens[row]) {
+                kept_rows.push_back(row);
+                continue;
+            }
+
+            // refine spectrogram using postnet, the raw spectrogram is [num_steps, 1, reduction_factor, num_mel_bins]
+            ov::Tensor raw_spectrogram(ov::element::f32,
+                                       ov::Shape{spectrograms[row].size() / frame_size, 1, reduction_factor, num_mel_bins},
+                                       spectrograms[row].data());
+            // the postnet output tensor is reused by the next inference
+            vocoder.push(batch.utterance_idxs[row], copy_to_host(postnet(postnet_request, raw_spectrogram, raw_metrics)));
+        }
+
+        if (kept_rows.size() == batch_size) {
+            inputs_embeds = out_seq;
+            std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + batch_size, 0);
+            continue;
+        }
+
+        batch_size = kept_rows.size();
+        if (batch_size == 0) {
+            break;
+        }
+
+        inputs_embeds = gather_rows(out_seq, kept_rows);
+        batch.encoder_hidden_states = gather_rows(batch.encoder_hidden_states, kept_rows);
+        batch.encoder_attention_mask = gather_rows(batch.encoder_attention_mask, kept_rows);
+        batch.speaker_embeddings = gather_rows(batch.speaker_embeddings, kept_rows);
+
+        auto keep_rows = [&kept_rows](auto& values) {
+            std::decay_t<decltype(values)> kept_values;
+            for (const size_t row : kept_rows) {
+                kept_values.push_back(std::move(values[row]));
+            }
+            values = std::move(kept_values);
+        };
+        keep_rows(batch.utterance_idxs);
+        keep_rows(batch.minlens);
+        keep_rows(batch.maxlens);
+        keep_rows(spectrograms);
+
+        // the next inference keeps the key values of the kept rows only
+        beam_idx = decoder.create_host_tensor(ov::element::i32, {batch_size});
+        std::copy(kept_rows.begin(), kept_rows.end(), beam_idx.data<int32_t>());
+    }
+
+    decoder.reset_state();
+}
+
+/**
+ * Decodes the spectrogram of a single utterance and streams it through the vocoder chunk by chunk, the vocoder of a
+ * chunk runs while the decoder generates the next steps.
+ */
+void decode_streaming(ov::genai::SpeechT5TTSDecoder& decoder,
+                      StreamingVocoder& vocoder,
+                      const UtteranceBatch& batch,
+                      const float threshold,
+                      const size_t reduction_factor,
+                      const size_t num_mel_bins,
+                      ov::genai::RawPerfMetrics& raw_metrics) {
+    const size_t frame_size = reduction_factor * num_mel_bins;
+    std::vector<float> spectrogram;
+
+    ov::Tensor inputs_embeds = decoder.create_host_tensor(ov::element::f32, {1, 1, num_mel_bins});
+    std::fill_n(inputs_embeds.data<float>(), inputs_embeds.get_size(), 0.0f);
+    ov::Tensor beam_idx = decoder.create_host_tensor(ov::element::i32, {1});
+    beam_idx.data<int32_t>()[0] = 0;
+
+    for (int64_t iter = 1;; ++iter) {
+        decoder.start_async(inputs_embeds,
+                            batch.speaker_embeddings,
+                            batch.encoder_hidden_states,
+                            batch.encoder_attention_mask,
+                            beam_idx);
+        vocoder.poll();
+        auto [out_seq, spectrum, prob] = decoder.wait();
+
+        const float* spectrum_data = spectrum.data<float>();
+        spectrogram.insert(spectrogram.end(), spectrum_data, spectrum_data + frame_size);
+
+        const float prob_sum = std::accumulate(prob.data<float>(), prob.data<float>() + prob.get_size(), 0.0f);
+        const bool is_last = iter >= batch.maxlens[0] || (iter >= batch.minlens[0] && prob_sum >= threshold);
+        if (!vocoder.push(spectrogram, is_last) || is_last) {
+            break;
+        }
+        inputs_embeds = out_seq;
+    }
+    vocoder.wait();
+
+    decoder.reset_state();
 }
 
 const ov::Tensor get_default_speaker_embedding() {
@@ -127,72 +523,95 @@ void SpeechT5TTSImpl::init_model_config_params(const std::filesystem::path& root
 
 Text2SpeechDecodedResults SpeechT5TTSImpl::generate(const std::vector<std::string>& texts,
                                                     const ov::Tensor& speaker_embedding,
-                                                    const SpeechGenerationConfig& generation_config) {
+                                                    const SpeechGenerationConfig& generation_config,
+                                                    const SpeechStreamer& streamer) {
     const ov::Tensor& used_speaker_embedding = speaker_embedding ? speaker_embedding : get_default_speaker_embedding();
 
+    OPENVINO_ASSERT(used_speaker_embedding.get_shape().size() == 2 && used_speaker_embedding.get_shape()[0] == 1,
+                    "Speaker embedding is expected to have [1, embedding_size] shape");
+
     Text2SpeechDecodedResults gen_speech_res;
+    gen_speech_res.speeches.resize(texts.size());
+    AsyncVocoder vocoder(m_vocoder, gen_speech_res.speeches);
+    RawPerfMetrics raw_perf_metrics;
 
     auto& tokenization_durations = gen_speech_res.perf_metrics.raw_metrics.tokenization_durations;
     const auto generation_start = std::chrono::steady_clock::now();
-    for (const auto& text : texts) {
-        const auto tokenization_start = std::chrono::steady_clock::now();
-        auto tokens = m_tokenizer.encode(text);
-        const auto tokenization_end = std::chrono::steady_clock::now();
-        tokenization_durations.emplace_back(PerfMetrics::get_microsec(tokenization_end - tokenization_start));
-        auto input_ids = tokens.input_ids;
-        uint64_t bsz = 1;  // process per batch
-
-        const auto infer_start = std::chrono::steady_clock::now();
-        RawPerfMetrics raw_perf_metrics;
-        auto [last_hidden_state, encoder_attention_mask] = encode(m_encoder, input_ids, raw_perf_metrics);
-
-        auto last_hidden_state_len = static_cast<float>(last_hidden_state.get_shape()[1]);
-        auto reduction_factor = static_cast<float>(m_reduction_factor);
-
-        int64_t maxlen = static_cast<int64_t>(last_hidden_state_len * generation_config.maxlenratio / reduction_factor);
-        int64_t minlen = static_cast<int64_t>(last_hidden_state_len * generation_config.minlenratio / reduction_factor);
-
-        // prepare inputs for decoder
-        std::vector<float> zeros(bsz * 1 * m_num_mel_bins, 0.0f);
-        ov::Tensor inputs_embeds(ov::element::f32, ov::Shape{bsz, 1, m_num_mel_bins}, zeros.data());
-        ov::Tensor spectrogram(ov::element::f32, ov::Shape{0, bsz, 2, m_num_mel_bins}, std::vector<float>{}.data());
-
-        int64_t iter = 0;
-        // decoder loop
-        while (true) {
-            iter += 1;
-            m_decoder->start_async(inputs_embeds,
-                                   used_speaker_embedding,
-                                   last_hidden_state,
-                                   encoder_attention_mask,
-                                   spectrogram);
-            auto [out_seq, spectrum, prob, spectrogram_out] = m_decoder->wait();
-            inputs_embeds = out_seq;
-            spectrogram = spectrogram_out;
-
-            if (iter < minlen) {
-                continue;
-            }
-
-            // if the generation loop is less than maximum length time, check the ones in the batch that have met
-            // the prob threshold.Otherwise, assume all have met thresholds and fill other spectrograms for the batch.
-            auto prob_values = prob.data<float>();
-            float prob_sum = std::accumulate(prob_values, prob_values + prob.get_size(), 0.0f);
-            bool found_spectrum = ((prob_sum >= generation_config.threshold) || (iter >= maxlen));
+    // the streamed texts are decoded one by one, so that their audio is delivered in order
+    const size_t batch_size = streamer ? 1 : max_batch_size;
+    for (size_t batch_start = 0; batch_start < texts.size(); batch_start += batch_size) {
+        const size_t batch_end = std::min(batch_start + batch_size, texts.size());
+
+        // the texts are encoded one by one, so that the hidden states don't depend on the padding
+        UtteranceBatch batch;
+        std::vector<ov::Tensor> last_hidden_states;
+        std::vector<ov::Tensor> encoder_attention_masks;
+        for (size_t text_idx = batch_start; text_idx < batch_end; ++text_idx) {
+            const auto tokenization_start = std::chrono::steady_clock::now();
+            auto tokens = m_tokenizer.encode(texts[text_idx]);
+            const auto tokenization_end = std::chrono::steady_clock::now();
+            tokenization_durations.emplace_back(PerfMetrics::get_microsec(tokenization_end - tokenization_start));
+
+            auto [last_hidden_state, encoder_attention_mask] = encode(m_encoder, tokens.input_ids, raw_perf_metrics);
+            // the output tensors are reused by the next inference
+            last_hidden_states.push_back(copy_to_host(last_hidden_state));
+            encoder_attention_masks.push_back(copy_to_host(encoder_attention_mask));
+
+            auto last_hidden_state_len = static_cast<float>(last_hidden_state.get_shape()[1]);
+            auto reduction_factor = static_cast<float>(m_reduction_factor);
+            batch.utterance_idxs.push_back(text_idx);
+            batch.maxlens.push_back(
+                static_cast<int64_t>(last_hidden_state_len * generation_config.maxlenratio / reduction_factor));
+            batch.minlens.push_back(
+                static_cast<int64_t>(last_hidden_state_len * generation_config.minlenratio / reduction_factor));
+        }
 
-            if (found_spectrum) {
-                // refine spectrogram using postnet
-                auto postnet_spectrogram = postnet(m_postnet, spectrogram, raw_perf_metrics);
-                spectrogram = postnet_spectrogram;
+        // the padding of the shorter texts is masked out of the decoder cross-attention
+        batch.encoder_hidden_states = stack_padded(last_hidden_states);
+        batch.encoder_attention_mask = stack_padded(encoder_attention_masks);
+        batch.speaker_embeddings =
+            gather_rows(copy_to_host(used_speaker_embedding), std::vector<size_t>(batch_end - batch_start, 0));
+
+        if (streamer) {
+            StreamingVocoder streaming_vocoder(m_postnet,
+                                               m_vocoder,
+                                               streamer,
+                                               batch_start,
+                                               m_reduction_factor,
+                                               m_num_mel_bins,
+                                               raw_perf_metrics);
+            decode_streaming(*m_decoder,
+                             streaming_vocoder,
+                             batch,
+                             generation_config.threshold,
+                             m_reduction_factor,
+                             m_num_mel_bins,
+                             raw_perf_metrics);
+            gen_speech_res.speeches[batch_start] = streaming_vocoder.get_speech();
+
+            // the stopped generation returns the speeches streamed so far
+            const StreamingStatus status = streaming_vocoder.get_status();
+            if (status != StreamingStatus::RUNNING) {
+                gen_speech_res.speeches.resize(status == StreamingStatus::CANCEL ? 0 : batch_start + 1);
                 break;
             }
+            continue;
         }
-        auto waveform = vocoder(m_vocoder, spectrogram, raw_perf_metrics);
 
-        gen_speech_res.perf_metrics.num_generated_samples += waveform.get_size();
+        // the vocoder of the previous batch runs while this batch is decoded
+        decode_batch(*m_decoder,
+                     m_postnet,
+                     vocoder,
+                     std::move(batch),
+                     generation_config.threshold,
+                     m_reduction_factor,
+                     m_num_mel_bins,
+                     raw_perf_metrics);
+    }
+    vocoder.finish();
 
-        gen_speech_res.speeches.push_back(waveform);
-        m_decoder->reset_state();
+    for (const ov::Tensor& waveform : gen_speech_res.speeches) {
+        gen_speech_res.perf_metrics.num_generated_samples += waveform.get_size();
     }
 
     const auto generation_end = std::chrono::steady_clock::now();
@@ -23,7 +23,8 @@ public:
 
     Text2SpeechDecodedResults generate(const std::vector<std::string>& texts,
                                        const ov::Tensor& speaker_embedding,
-                                       const SpeechGenerationConfig& generation_config) override;
+                                       const SpeechGenerationConfig& generation_config,
+                                       const SpeechStreamer& streamer) override;
 
     SpeechGenerationPerfMetrics get_performance_metrics() override;
 
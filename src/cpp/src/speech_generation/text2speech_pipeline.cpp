@@ -56,7 +56,16 @@ Text2SpeechPipeline::Text2SpeechPipeline(const std::filesystem::path& root_dir,
 Text2SpeechDecodedResults Text2SpeechPipeline::generate(const std::vector<std::string>& texts,
                                                         const ov::Tensor& speaker_embedding,
                                                         const ov::AnyMap& properties) {
-    return m_impl->generate(texts, speaker_embedding, m_speech_gen_config);
+    SpeechGenerationConfig config = m_speech_gen_config;
+    config.update_generation_config(properties);
+    config.validate();
+
+    SpeechStreamer streamer;
+    if (auto it = properties.find(speech_streamer.name()); it != properties.end()) {
+        streamer = it->second.as<SpeechStreamer>();
+    }
+
+    return m_impl->generate(texts, speaker_embedding, config, streamer);
 }
 
 SpeechGenerationConfig Text2SpeechPipeline::get_generation_config() const {
@@ -23,7 +23,8 @@ public:
 
     virtual Text2SpeechDecodedResults generate(const std::vector<std::string>& texts,
                                                const ov::Tensor& speaker_embedding,
-                                               const SpeechGenerationConfig& generation_config) = 0;
+                                               const SpeechGenerationConfig& generation_config,
+                                               const SpeechStreamer& streamer) = 0;
 
     virtual SpeechGenerationPerfMetrics get_performance_metrics();
 
@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+/**
+ * Unbounded queue of a single producer thread and a single consumer thread, a list of ring buffer segments. Pushing and
+ * reading the items don't take a lock. The consumer waiting for an item sleeps on a condition variable, which the producer
+ * notifies only while the consumer sleeps, so the producer pushing once per step wakes the consumer at most once per step,
+ * and doesn't wake the consumer polling with empty() at all.
+ * @tparam SegmentSize Number of items of a segment, a new segment is allocated once the last one is full.
+ */
+template <typename T, size_t SegmentSize = 32>
+class SPSCQueue
+{
+    struct Segment {
+        std::array<T, SegmentSize> items;
+        // published by the producer after the item is written
+        std::atomic<size_t> num_written{0};
+        std::atomic<Segment*> next{nullptr};
+    };
+
+    // owned by the consumer
+    Segment* m_head;
+    size_t m_read_pos = 0;
+    // owned by the producer
+    Segment* m_tail;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::atomic<bool> m_is_consumer_waiting{false};
+
+    bool has_item() const {
+        return m_read_pos < m_head->num_written.load() || (m_read_pos == SegmentSize && m_head->next.load() != nullptr);
+    }
+
+public:
+    SPSCQueue() : m_head(new Segment), m_tail(m_head) {}
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    ~SPSCQueue() {
+        while (m_head != nullptr) {
+            Segment* next = m_head->next.load();
+            delete m_head;
+            m_head = next;
+        }
+    }
+
+    /**
+     * Called by the producer.
+     */
+    void push(T item) {
+        const size_t write_pos = m_tail->num_written.load(std::memory_order_relaxed);
+        if (write_pos == SegmentSize) {
+            Segment* segment = new Segment;
+            segment->items[0] = std::move(item);
+            segment->num_written.store(1, std::memory_order_relaxed);
+            m_tail->next.store(segment);
+            m_tail = segment;
+        } else {
+            m_tail->items[write_pos] = std::move(item);
+            m_tail->num_written.store(write_pos + 1);
+        }
+        // the item is published before the check, and the consumer marks itself waiting before checking for the item,
+        // so either the consumer finds the item or the producer finds the consumer waiting
+        if (m_is_consumer_waiting.load()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_one();
+        }
+    }
+
+    /**
+     * Called by the consumer, blocks until an item is pushed.
+     */
+    T pull() {
+        if (!has_item()) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_is_consumer_waiting.store(true);
+            m_cv.wait(lock, [this] { return has_item(); });
+            m_is_consumer_waiting.store(false);
+        }
+        if (m_read_pos == SegmentSize) {
+            Segment* next = m_head->next.load();
+            delete m_head;
+            m_head = next;
+            m_read_pos = 0;
+        }
+        return std::move(m_head->items[m_read_pos++]);
+    }
+
+    /**
+     * Called by the consumer.
+     */
+    bool empty() const {
+        return !has_item();
+    }
+};
@@ -3,6 +3,8 @@
 
 #include "openvino/genai/text_streamer.hpp"
 
+#include "tokenizer/incremental_detokenizer.hpp"
+
 namespace {
 bool is_incomplete(std::string& text) {
     // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
@@ -18,9 +20,17 @@ TextStreamer::TextStreamer(const Tokenizer& tokenizer,
                            std::function<ov::genai::CallbackTypeVariant(std::string)> callback) {
     m_tokenizer = tokenizer;
     m_subword_callback = callback;
+    const std::vector<std::string>& pieces = m_tokenizer.get_detokenization_pieces();
+    if (!pieces.empty()) {
+        m_incremental_detokenizer = std::make_shared<IncrementalDetokenizer>(pieces);
+    }
 }
 
 StreamingStatus TextStreamer::write(int64_t token) {
+    if (m_incremental_detokenizer) {
+        return run_callback_if_needed(m_incremental_detokenizer->append(token));
+    }
+
     std::stringstream res;
     m_tokens_cache.push_back(token);
     std::string text = m_tokenizer.decode(m_tokens_cache);
@@ -83,6 +93,14 @@ StreamingStatus TextStreamer::write(const std::vector<int64_t>& tokens) {
         return StreamingStatus::RUNNING;
     }
 
+    if (m_incremental_detokenizer) {
+        std::string text;
+        for (int64_t token : tokens) {
+            text += m_incremental_detokenizer->append(token);
+        }
+        return run_callback_if_needed(text);
+    }
+
     if (tokens.size() > 1) {
         m_tokens_cache.insert(m_tokens_cache.end(), tokens.begin(), tokens.end() - 1);
         // -2 means no decode was done for this token position
@@ -108,6 +126,14 @@ StreamingStatus TextStreamer::run_callback_if_needed(const std::string& text) {
 }
 
 void TextStreamer::end() {
+    if (m_incremental_detokenizer) {
+        std::string text = m_incremental_detokenizer->flush();
+        if (!text.empty()) {
+            m_subword_callback(text);
+        }
+        return;
+    }
+
     std::stringstream res;
     std::string text = m_tokenizer.decode(m_tokens_cache);
     if (text.size() <= m_printed_len)
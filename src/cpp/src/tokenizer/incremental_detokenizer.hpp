@@ -0,0 +1,83 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * Detokenizes the tokens one by one by concatenating their pieces, which is only equivalent to the detokenizer model
+ * when the latter doesn't post-process the text of the pieces. The bytes of an incomplete UTF-8 character are kept
+ * until the following pieces complete it, so that the text returned for a token is always valid UTF-8.
+ */
+class IncrementalDetokenizer {
+public:
+    /**
+     * @param pieces The bytes each token id is detokenized to, empty for the skipped tokens. Must outlive the detokenizer.
+     */
+    explicit IncrementalDetokenizer(const std::vector<std::string>& pieces) : m_pieces(pieces) {}
+
+    /**
+     * @return The text completed by the token, empty if the token only continues an incomplete character.
+     */
+    std::string append(int64_t token) {
+        if (token >= 0 && static_cast<size_t>(token) < m_pieces.size()) {
+            m_pending_bytes += m_pieces[token];
+        }
+        return pop_complete_text(false);
+    }
+
+    /**
+     * @return The bytes of the trailing incomplete character, replaced with U+FFFD as the detokenizer model does.
+     */
+    std::string flush() {
+        return pop_complete_text(true);
+    }
+
+private:
+    std::string pop_complete_text(bool is_final) {
+        // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
+        constexpr char replacement[] = "\xef\xbf\xbd";
+        std::string text;
+        size_t pos = 0;
+        while (pos < m_pending_bytes.size()) {
+            const auto lead = static_cast<unsigned char>(m_pending_bytes[pos]);
+            const size_t char_len = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+            if (char_len == 0) {
+                // a stray continuation byte or an invalid lead byte
+                text += replacement;
+                ++pos;
+                continue;
+            }
+            const size_t num_available = std::min(char_len, m_pending_bytes.size() - pos);
+            size_t num_valid = 1;
+            while (num_valid < num_available && (static_cast<unsigned char>(m_pending_bytes[pos + num_valid]) >> 6) == 0x2) {
+                ++num_valid;
+            }
+            if (num_valid < num_available || (num_valid < char_len && is_final)) {
+                // the character is interrupted by a byte which doesn't continue it
+                text += replacement;
+                pos += num_valid;
+                continue;
+            }
+            if (num_valid < char_len) {
+                // the following pieces may complete the character
+                break;
+            }
+            text.append(m_pending_bytes, pos, char_len);
+            pos += char_len;
+        }
+        m_pending_bytes.erase(0, pos);
+        return text;
+    }
+
+    const std::vector<std::string>& m_pieces;
+    std::string m_pending_bytes;
+};
+
+}  // namespace ov::genai
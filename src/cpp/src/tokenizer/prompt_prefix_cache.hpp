@@ -0,0 +1,132 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * Token ids of the prompt prefixes shared by many prompts, e.g. a system prompt rendered by the chat template, so that
+ * only the rest of a prompt is tokenized. A tokenizer may merge the tokens across the end of the prefix, so a prefix is
+ * only reused after the ids of the prefix followed by the ids of the rest of a prompt have been checked to be equal
+ * to the ids of the whole prompt. Whether the tokens are merged depends on the rest of each prompt, so the end of
+ * the prefix is also checked for each prompt on the short window of the text around it (see boundary_window).
+ */
+class PromptPrefixCache {
+public:
+    explicit PromptPrefixCache(size_t capacity) : m_capacity(capacity) {}
+
+    /**
+     * Registers the prefix to be checked by the next encode of a prompt starting with it.
+     */
+    void add_candidate(const std::string& prefix, bool add_special_tokens) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (find_entry(prefix, add_special_tokens) != m_entries.end()) {
+            return;
+        }
+        m_entries.push_front(Entry{prefix, add_special_tokens});
+        if (m_entries.size() > m_capacity) {
+            m_entries.pop_back();
+        }
+    }
+
+    /**
+     * @return The length of the longest reusable prefix of the prompt and the token ids of the prefix.
+     */
+    std::optional<std::pair<size_t, std::vector<int64_t>>> find(const std::string& prompt, bool add_special_tokens) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto longest = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->token_ids && it->add_special_tokens == add_special_tokens && is_prefix_of(it->prefix, prompt) &&
+                (longest == m_entries.end() || it->prefix.size() > longest->prefix.size())) {
+                longest = it;
+            }
+        }
+        if (longest == m_entries.end()) {
+            return std::nullopt;
+        }
+        // the most recently used entries are kept first
+        m_entries.splice(m_entries.begin(), m_entries, longest);
+        return std::make_pair(longest->prefix.size(), *longest->token_ids);
+    }
+
+    /**
+     * @return A prefix of the prompt, which hasn't been checked yet.
+     */
+    std::optional<std::string> find_candidate(const std::string& prompt, bool add_special_tokens) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& entry : m_entries) {
+            if (!entry.is_checked && entry.add_special_tokens == add_special_tokens && is_prefix_of(entry.prefix, prompt)) {
+                return entry.prefix;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @param token_ids The token ids of the prefix, nullopt if the prefix can't be reused.
+     */
+    void set_checked(const std::string& prefix, bool add_special_tokens, std::optional<std::vector<int64_t>> token_ids) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = find_entry(prefix, add_special_tokens);
+        if (it != m_entries.end()) {
+            it->is_checked = true;
+            it->token_ids = std::move(token_ids);
+        }
+    }
+
+    /**
+     * @return The begin and the end of the text around the end of the prefix, which are checked to be tokenized
+     * separately. Up to `size` bytes are taken on each side, the window isn't split inside of an UTF-8 character.
+     */
+    static std::pair<size_t, size_t> boundary_window(const std::string& prompt, size_t prefix_len, size_t size = 16) {
+        auto is_continuation_byte = [&prompt](size_t pos) {
+            return pos < prompt.size() && (static_cast<unsigned char>(prompt[pos]) & 0xC0) == 0x80;
+        };
+        size_t begin = prefix_len - std::min(prefix_len, size);
+        while (begin < prefix_len && is_continuation_byte(begin)) {
+            ++begin;
+        }
+        size_t end = std::min(prompt.size(), prefix_len + size);
+        while (end > prefix_len && is_continuation_byte(end)) {
+            --end;
+        }
+        return {begin, end};
+    }
+
+private:
+    struct Entry {
+        std::string prefix;
+        bool add_special_tokens;
+        bool is_checked = false;
+        std::optional<std::vector<int64_t>> token_ids;
+    };
+
+    static bool is_prefix_of(const std::string& prefix, const std::string& prompt) {
+        return prefix.size() <= prompt.size() && prompt.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    std::list<Entry>::iterator find_entry(const std::string& prefix, bool add_special_tokens) {
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->prefix == prefix && it->add_special_tokens == add_special_tokens) {
+                return it;
+            }
+        }
+        return m_entries.end();
+    }
+
+    size_t m_capacity;
+    std::mutex m_mutex;
+    std::list<Entry> m_entries;
+};
+
+}  // namespace ov::genai
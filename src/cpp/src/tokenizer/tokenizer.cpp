@@ -1,13 +1,24 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
+#include <future>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <thread>
 
 #include "minja/minja.hpp"
 #include "minja/chat-template.hpp"
 
+#include "openvino/op/slice.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -15,6 +26,7 @@
 #include "gguf_utils/gguf_tokenizer.hpp"
 #include "tokenizer/chat_template_fallback_map.hpp"
 #include "tokenizer/make_tokenizer_stateful.hpp"
+#include "tokenizer/prompt_prefix_cache.hpp"
 #include "tokenizer/tokenizers_path.hpp"
 #include "add_second_input_pass.hpp"
 #include "circular_buffer_queue.hpp"
@@ -36,7 +48,8 @@ constexpr char eos_token_key_name[] = "eos_token";
 constexpr char pad_token_key_name[] = "pad_token";
 
 ov::Core core_with_extension() {
-    ov::Core core;
+    // the tokenizer models share the plugins with the pipeline models
+    ov::Core core = utils::singleton_core();
 
 #ifdef _WIN32
     const wchar_t* ov_tokenizer_path_w = _wgetenv(ScopedVar::ENVIRONMENT_VARIABLE_NAME_W);
@@ -159,6 +172,58 @@ std::vector<std::string> read_vocab_from_detokenizer_model(const std::shared_ptr
     return vocab_vector;
 }
 
+/**
+ * @return The bytes each token id is detokenized to with the skipped special tokens, if the detokenizer model only
+ * concatenates the vocab pieces, i.e. its VocabDecoder is only followed by the ops which don't change the text of
+ * valid UTF-8. Empty otherwise, e.g. for the space symbol replacement or the clean up of the tokenization spaces.
+ */
+std::vector<std::string> read_detokenization_pieces(const std::shared_ptr<ov::Model>& model, const std::vector<std::string>& vocab) {
+    std::shared_ptr<ov::Node> vocab_decoder_node;
+    for (auto node : model->get_ordered_ops()) {
+        if (strcmp(node->get_type_info().name, "VocabDecoder") == 0) {
+            vocab_decoder_node = node;
+        }
+    }
+    if (!vocab_decoder_node || vocab.empty()) {
+        return {};
+    }
+
+    const std::set<std::string> text_preserving_ops = {"FuzeRagged", "UTF8Validate", "StringTensorPack", "Result"};
+    std::vector<ov::Node*> nodes_to_visit = {vocab_decoder_node.get()};
+    while (!nodes_to_visit.empty()) {
+        ov::Node* node = nodes_to_visit.back();
+        nodes_to_visit.pop_back();
+        for (const auto& output : node->outputs()) {
+            for (const auto& target_input : output.get_target_inputs()) {
+                ov::Node* consumer = target_input.get_node();
+                if (text_preserving_ops.count(consumer->get_type_info().name) == 0) {
+                    return {};
+                }
+                nodes_to_visit.push_back(consumer);
+            }
+        }
+    }
+
+    std::vector<std::string> pieces = vocab;
+    if (vocab_decoder_node->get_input_size() >= 5) {
+        // the skip tokens are sliced by MakeVocabDecoderSatateful, all of them are skipped by default
+        auto skip_tokens_node = vocab_decoder_node->get_input_node_shared_ptr(4);
+        if (ov::as_type_ptr<ov::op::v8::Slice>(skip_tokens_node)) {
+            skip_tokens_node = skip_tokens_node->get_input_node_shared_ptr(0);
+        }
+        auto skip_tokens_const = ov::as_type_ptr<ov::op::v0::Constant>(skip_tokens_node);
+        if (!skip_tokens_const) {
+            return {};
+        }
+        for (int64_t token : skip_tokens_const->cast_vector<int64_t>()) {
+            if (token >= 0 && static_cast<size_t>(token) < pieces.size()) {
+                pieces[token].clear();
+            }
+        }
+    }
+    return pieces;
+}
+
 }  // namespace
 
 namespace ov {
@@ -167,7 +232,12 @@ namespace genai {
 class Tokenizer::TokenizerImpl {
 public:
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_tokenizer;
+    size_t m_num_tokenizer_infer_requests = 1;
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_detokenizer;
+    // the detokenizer model is compiled on the first decode, e.g. it's never used by the embedding pipelines
+    std::shared_ptr<ov::Model> m_detokenizer_model;
+    ov::AnyMap m_detokenizer_properties;
+    std::once_flag m_detokenizer_model_flag;
 
     // To change the adding special tokens mode we use a statefull subgraph,
     // this flag holds the current state value of the CompiledModel.
@@ -192,6 +262,21 @@ public:
 
     std::vector<std::string> m_vocab = {};
 
+    // the token ids of the system prompts rendered by apply_chat_template()
+    mutable PromptPrefixCache m_prompt_prefix_cache{16};
+    mutable std::mutex m_minja_template_mutex;
+    mutable std::shared_ptr<const minja::chat_template> m_minja_template;
+    mutable std::string m_minja_template_source;
+    // empty if the detokenizer model post-processes the text of the vocab pieces
+    std::vector<std::string> m_detokenization_pieces = {};
+
+    // encodes and decodes instead of the models, if the tokenizer is created from a GGUF file with native_gguf_tokenizer
+    std::shared_ptr<GGUFNativeTokenizer> m_native_tokenizer;
+    // creates the tokenizer model, which is only compiled for the first prompt the native tokenizer can't encode
+    std::function<std::shared_ptr<ov::Model>()> m_create_tokenizer_model;
+    ov::AnyMap m_tokenizer_properties;
+    std::once_flag m_tokenizer_model_flag;
+
     template <typename T>
     void set_state_value(ov::VariableState& state, std::optional<T> value, ov::AnyMap& state_flags) {
         // better to store which value is in the state locally so that get_state is not called every infer request
@@ -299,11 +384,12 @@ public:
         std::shared_ptr<ov::Model> ov_tokenizer = nullptr;
         std::shared_ptr<ov::Model> ov_detokenizer = nullptr;
         auto [filtered_properties, enable_save_ov_model] = utils::extract_gguf_properties(properties);
+        bool use_native_tokenizer = false;
+        ov::genai::utils::read_anymap_param(filtered_properties, native_gguf_tokenizer.name(), use_native_tokenizer);
+        filtered_properties.erase(native_gguf_tokenizer.name());
 
         if (is_gguf_model(models_path)) {
-            std::map<std::string, GGUFMetaData> tokenizer_config{};
-            std::tie(ov_tokenizer, ov_detokenizer, tokenizer_config) =
-                create_tokenizer_from_config(m_shared_object_ov_tokenizers, models_path);
+            std::map<std::string, GGUFMetaData> tokenizer_config = read_tokenizer_config(models_path);
 
             if (auto val = get_if_exist<ov::Tensor>(tokenizer_config, "padding_token_id")) {
                 m_pad_token_id = static_cast<int64_t>((*val).data<uint32_t>()[0]);
@@ -321,6 +407,16 @@ public:
                 m_chat_template = patch_gguf_chat_template(m_chat_template);
             }
 
+            // the models are built anyway, if they are saved
+            if (use_native_tokenizer && !enable_save_ov_model) {
+                m_native_tokenizer = create_native_tokenizer_from_config(tokenizer_config);
+            }
+            if (m_native_tokenizer) {
+                setup_native_tokenizer(tokenizer_config, filtered_properties);
+                return;
+            }
+            std::tie(ov_tokenizer, ov_detokenizer) = create_tokenizer_from_config(m_shared_object_ov_tokenizers, tokenizer_config);
+
             if (enable_save_ov_model){
                 std::filesystem::path gguf_model_path(models_path);
                 std::filesystem::path save_ov_tokenizer_path = gguf_model_path.parent_path() / "openvino_tokenizer.xml";
@@ -370,8 +466,13 @@ public:
             properties.erase(it);
         }
 
-        // Pass no addtional properties to tokenizer/detokenizer models since it was not used by default
+        auto [tokenizer_properties, num_tokenizer_infer_requests] = get_tokenizer_properties(properties);
+
+        // Pass no addtional properties to detokenizer model since it was not used by default, except for the cache dir
         properties = {};
+        if (tokenizer_properties.count(ov::cache_dir.name())) {
+            properties[ov::cache_dir.name()] = tokenizer_properties.at(ov::cache_dir.name());
+        }
         
         is_paired_input = ov_tokenizer && ov_tokenizer->get_parameters().size() == 2;
         
@@ -396,25 +497,11 @@ public:
 
         OPENVINO_ASSERT(ov_tokenizer || ov_detokenizer, "Neither tokenizer nor detokenzier models were provided");
 
-        auto core = get_core_singleton();
-        std::string device = "CPU";  // only CPU is supported for now
-
         // Saving IR version was added only in 24.5, so if it's missing, then it's older than 24.5
         m_older_than_24_5 = !(ov_tokenizer ? ov_tokenizer : ov_detokenizer)->has_rt_info("openvino_tokenizers_version");
 
         if (ov_tokenizer) {
-            ov::pass::Manager manager;
-            manager.register_pass<MakeAddSpecialTokensSatateful>();
-            manager.register_pass<MakePaddingSatateful>();
-            manager.run_passes(ov_tokenizer);
-            ov::CompiledModel tokenizer = core.compile_model(ov_tokenizer, device, properties);
-            ov::genai::utils::print_compiled_model_properties(tokenizer, "OV Tokenizer");
-
-            m_ireq_queue_tokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
-                tokenizer.get_property(ov::optimal_number_of_infer_requests),
-                [&tokenizer]() -> ov::InferRequest {
-                    return tokenizer.create_infer_request();
-                });
+            m_num_tokenizer_infer_requests = compile_tokenizer(ov_tokenizer, tokenizer_properties, num_tokenizer_infer_requests);
 
             const ov::AnyMap& rt_info = ov_tokenizer->get_rt_info();
             m_pad_token_id = find_or_fallback(rt_info, "pad_token_id", m_pad_token_id);
@@ -434,8 +521,23 @@ public:
             ov::pass::Manager manager_detok;
             manager_detok.register_pass<MakeVocabDecoderSatateful>();
             manager_detok.run_passes(ov_detokenizer);
-            ov::CompiledModel detokenizer = core.compile_model(ov_detokenizer, device, properties);
+
+            m_vocab = read_vocab_from_detokenizer_model(ov_detokenizer);
+            m_detokenization_pieces = read_detokenization_pieces(ov_detokenizer, m_vocab);
+            m_detokenizer_model = ov_detokenizer;
+            m_detokenizer_properties = properties;
+        }
+    }
+
+    // compiles the detokenizer model on the first use and decodes the special tokens missing in the configs with it
+    void compile_detokenizer_if_necessary() {
+        std::call_once(m_detokenizer_model_flag, [this] {
+            if (!m_detokenizer_model) {
+                return;
+            }
+            ov::CompiledModel detokenizer = get_core_singleton().compile_model(m_detokenizer_model, "CPU", m_detokenizer_properties);
             ov::genai::utils::print_compiled_model_properties(detokenizer, "OV Detokenizer");
+            m_detokenizer_model = nullptr;
 
             m_ireq_queue_detokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
                 detokenizer.get_property(ov::optimal_number_of_infer_requests),
@@ -445,16 +547,122 @@ public:
 
             // Unset/-1 token causes exception in SentencePiece detokenization.
             if (m_pad_token_id != -1 && m_pad_token.empty())
-                m_pad_token = decode(std::vector{m_pad_token_id}, {ov::genai::skip_special_tokens(false)});
+                m_pad_token = infer_detokenizer(std::vector{m_pad_token_id}, {ov::genai::skip_special_tokens(false)});
             if (m_bos_token_id != -1 && m_bos_token.empty())
-                m_bos_token = decode(std::vector{m_bos_token_id}, {ov::genai::skip_special_tokens(false)});
+                m_bos_token = infer_detokenizer(std::vector{m_bos_token_id}, {ov::genai::skip_special_tokens(false)});
             if (m_eos_token_id != -1 && m_eos_token.empty())
-                m_eos_token = decode(std::vector{m_eos_token_id}, {ov::genai::skip_special_tokens(false)});
-            // Initialize detokenizer's cache to save time later.
-            decode({1, 33, 199, 42, 42});
+                m_eos_token = infer_detokenizer(std::vector{m_eos_token_id}, {ov::genai::skip_special_tokens(false)});
+        });
+    }
 
-            m_vocab = read_vocab_from_detokenizer_model(ov_detokenizer);
+    // the properties of the tokenizer model and the number of its infer requests, 0 for the optimal number
+    std::pair<ov::AnyMap, size_t> get_tokenizer_properties(const ov::AnyMap& properties) const {
+        // The tokenizer infer requests are compiled with a CPU stream each, so that encode_parallel() runs them concurrently
+        size_t num_tokenizer_infer_requests = 0;
+        auto it = properties.find(ov::genai::num_tokenizer_infer_requests.name());
+        if (it != properties.end()) {
+            num_tokenizer_infer_requests = it->second.is<int64_t>() ? static_cast<size_t>(it->second.as<int64_t>()) : it->second.as<size_t>();
+        }
+        ov::AnyMap tokenizer_properties;
+        if (num_tokenizer_infer_requests > 0) {
+            tokenizer_properties[ov::num_streams.name()] = ov::streams::Num(static_cast<int32_t>(num_tokenizer_infer_requests));
+        }
+        // the threading of the tokenizer, e.g. to pin its threads to the cores, and the cache of the compiled models
+        for (const std::string& name : {ov::hint::enable_cpu_pinning.name(), ov::inference_num_threads.name(), ov::cache_dir.name()}) {
+            if (properties.count(name)) {
+                tokenizer_properties[name] = properties.at(name);
+            }
+        }
+        return {tokenizer_properties, num_tokenizer_infer_requests};
+    }
+
+    // compiles the tokenizer model into the queue of the infer requests, returns the number of the infer requests
+    size_t compile_tokenizer(std::shared_ptr<ov::Model> ov_tokenizer, const ov::AnyMap& tokenizer_properties, size_t num_tokenizer_infer_requests) {
+        ov::pass::Manager manager;
+        manager.register_pass<MakeAddSpecialTokensSatateful>();
+        manager.register_pass<MakePaddingSatateful>();
+        manager.run_passes(ov_tokenizer);
+        ov::CompiledModel tokenizer = get_core_singleton().compile_model(ov_tokenizer, "CPU", tokenizer_properties);
+        ov::genai::utils::print_compiled_model_properties(tokenizer, "OV Tokenizer");
+
+        if (num_tokenizer_infer_requests == 0) {
+            num_tokenizer_infer_requests = tokenizer.get_property(ov::optimal_number_of_infer_requests);
         }
+        m_ireq_queue_tokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
+            num_tokenizer_infer_requests,
+            [&tokenizer]() -> ov::InferRequest {
+                return tokenizer.create_infer_request();
+            });
+        return num_tokenizer_infer_requests;
+    }
+
+    // sets the native tokenizer up without the models, like setup_tokenizer() does for the models created from the GGUF file
+    void setup_native_tokenizer(const std::map<std::string, GGUFMetaData>& tokenizer_config, const ov::AnyMap& properties) {
+        size_t num_tokenizer_infer_requests = 0;
+        std::tie(m_tokenizer_properties, num_tokenizer_infer_requests) = get_tokenizer_properties(properties);
+        // the shards of encode_parallel() are encoded natively on a thread each
+        m_num_tokenizer_infer_requests = num_tokenizer_infer_requests > 0 ? num_tokenizer_infer_requests
+                                                                          : std::max(1u, std::thread::hardware_concurrency());
+        m_create_tokenizer_model = [shared_object_ov_tokenizers = m_shared_object_ov_tokenizers, tokenizer_config] {
+            return create_tokenizer_from_config(shared_object_ov_tokenizers, tokenizer_config).first;
+        };
+        // the tokenizer models created from the GGUF file have no version, see setup_tokenizer()
+        m_older_than_24_5 = true;
+        m_chat_template = remap_template(m_chat_template);
+
+        if (m_pad_token_id != -1 && m_pad_token.empty())
+            m_pad_token = m_native_tokenizer->decode({m_pad_token_id}, false);
+        if (m_bos_token_id != -1 && m_bos_token.empty())
+            m_bos_token = m_native_tokenizer->decode({m_bos_token_id}, false);
+        if (m_eos_token_id != -1 && m_eos_token.empty())
+            m_eos_token = m_native_tokenizer->decode({m_eos_token_id}, false);
+
+        m_vocab = m_native_tokenizer->get_vocab();
+        m_detokenization_pieces = m_native_tokenizer->get_detokenization_pieces();
+    }
+
+    void compile_tokenizer_if_necessary() {
+        if (!m_create_tokenizer_model) {
+            return;
+        }
+        std::call_once(m_tokenizer_model_flag, [this] {
+            compile_tokenizer(m_create_tokenizer_model(), m_tokenizer_properties, m_num_tokenizer_infer_requests);
+        });
+    }
+
+    /**
+     * Encodes the prompts natively like the tokenizer model created from the GGUF file, which ignores the tokenization
+     * parameters and pads the prompts on the left with 0.
+     * @return std::nullopt if the tokenizer is not native or a prompt can't be encoded natively.
+     */
+    std::optional<TokenizedInputs> encode_natively(const std::vector<std::string>& prompts) {
+        if (!m_native_tokenizer) {
+            return std::nullopt;
+        }
+        std::vector<std::vector<int64_t>> token_ids;
+        token_ids.reserve(prompts.size());
+        size_t max_length = 0;
+        for (const std::string& prompt : prompts) {
+            std::optional<std::vector<int64_t>> prompt_token_ids = m_native_tokenizer->encode(prompt);
+            if (!prompt_token_ids) {
+                compile_tokenizer_if_necessary();
+                return std::nullopt;
+            }
+            max_length = std::max(max_length, prompt_token_ids->size());
+            token_ids.push_back(std::move(*prompt_token_ids));
+        }
+
+        TokenizedInputs result{ov::Tensor(ov::element::i64, {prompts.size(), max_length}), ov::Tensor(ov::element::i64, {prompts.size(), max_length})};
+        for (size_t row = 0; row < prompts.size(); ++row) {
+            int64_t* ids = result.input_ids.data<int64_t>() + row * max_length;
+            int64_t* mask = result.attention_mask.data<int64_t>() + row * max_length;
+            const size_t padding = max_length - token_ids[row].size();
+            std::fill_n(ids, padding, 0);
+            std::fill_n(mask, padding, 0);
+            std::copy(token_ids[row].begin(), token_ids[row].end(), ids + padding);
+            std::fill_n(mask + padding, token_ids[row].size(), 1);
+        }
+        return result;
     }
 
     // load special tokens ids from config.json
@@ -578,6 +786,66 @@ public:
     }
 
     TokenizedInputs encode(const std::string& prompt, const ov::AnyMap& tokenization_params = {}) {
+        // the prefixes are only reused for the prompts, which are neither truncated nor padded
+        if (m_older_than_24_5 || std::any_of(tokenization_params.begin(), tokenization_params.end(), [](const auto& param) {
+                const bool is_not_padded = param.first == ov::genai::pad_to_max_length.name() && !param.second.template as<bool>();
+                return param.first != ov::genai::add_special_tokens.name() && !is_not_padded;
+            })) {
+            return encode_without_prefix_cache(prompt, tokenization_params);
+        }
+        bool add_special_tokens_flag = true;
+        ov::genai::utils::read_anymap_param(tokenization_params, add_special_tokens.name(), add_special_tokens_flag);
+        const ov::AnyMap suffix_tokenization_params = {ov::genai::add_special_tokens(false)};
+        auto get_ids = [](const TokenizedInputs& inputs) {
+            const int64_t* ids = inputs.input_ids.data<int64_t>();
+            return std::vector<int64_t>(ids, ids + inputs.input_ids.get_size());
+        };
+
+        // the tokens of the text around the end of the prefix must not be merged for this prompt either
+        auto is_prefix_boundary_kept = [&](size_t prefix_len) {
+            auto [begin, end] = PromptPrefixCache::boundary_window(prompt, prefix_len);
+            if (begin == prefix_len || end == prefix_len) {
+                return true;
+            }
+            std::vector<int64_t> ids = get_ids(encode_without_prefix_cache(prompt.substr(begin, prefix_len - begin), suffix_tokenization_params));
+            std::vector<int64_t> suffix_ids = get_ids(encode_without_prefix_cache(prompt.substr(prefix_len, end - prefix_len), suffix_tokenization_params));
+            ids.insert(ids.end(), suffix_ids.begin(), suffix_ids.end());
+            return ids == get_ids(encode_without_prefix_cache(prompt.substr(begin, end - begin), suffix_tokenization_params));
+        };
+
+        auto prefix = m_prompt_prefix_cache.find(prompt, add_special_tokens_flag);
+        if (prefix && is_prefix_boundary_kept(prefix->first)) {
+            auto& [prefix_len, ids] = *prefix;
+            if (prefix_len < prompt.size()) {
+                std::vector<int64_t> suffix_ids = get_ids(encode_without_prefix_cache(prompt.substr(prefix_len), suffix_tokenization_params));
+                ids.insert(ids.end(), suffix_ids.begin(), suffix_ids.end());
+            }
+            TokenizedInputs result{ov::Tensor(ov::element::i64, {1, ids.size()}), ov::Tensor(ov::element::i64, {1, ids.size()})};
+            std::copy(ids.begin(), ids.end(), result.input_ids.data<int64_t>());
+            std::fill_n(result.attention_mask.data<int64_t>(), ids.size(), 1);
+            return result;
+        }
+
+        TokenizedInputs result = encode_without_prefix_cache(prompt, tokenization_params);
+        if (prefix) {
+            return result;
+        }
+        std::optional<std::string> candidate = m_prompt_prefix_cache.find_candidate(prompt, add_special_tokens_flag);
+        if (candidate && candidate->size() < prompt.size()) {
+            std::vector<int64_t> prefix_ids = get_ids(encode_without_prefix_cache(*candidate, tokenization_params));
+            std::vector<int64_t> ids = prefix_ids;
+            std::vector<int64_t> suffix_ids = get_ids(encode_without_prefix_cache(prompt.substr(candidate->size()), suffix_tokenization_params));
+            ids.insert(ids.end(), suffix_ids.begin(), suffix_ids.end());
+            const bool is_reusable = !result.token_type_ids && ids == get_ids(result);
+            m_prompt_prefix_cache.set_checked(*candidate, add_special_tokens_flag, is_reusable ? std::make_optional(prefix_ids) : std::nullopt);
+        }
+        return result;
+    }
+
+    TokenizedInputs encode_without_prefix_cache(const std::string& prompt, const ov::AnyMap& tokenization_params) {
+        if (std::optional<TokenizedInputs> inputs = encode_natively({prompt})) {
+            return *inputs;
+        }
         OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                                 "Tokenizer::encode is not available");
 
@@ -604,6 +872,7 @@ public:
     }
 
     TokenizedInputs encode(const std::vector<std::pair<std::string, std::string>>& prompts_pairs, const ov::AnyMap& tokenization_params = {}) {
+        compile_tokenizer_if_necessary();
         OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                                 "Tokenizer::encode is not available");
         size_t batch_size = prompts_pairs.size();
@@ -618,6 +887,7 @@ public:
     }
 
     TokenizedInputs encode(const std::vector<std::string>& prompts_1, const std::vector<std::string>& prompts_2, const ov::AnyMap& tokenization_params = {}) {
+        compile_tokenizer_if_necessary();
         OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                                 "Tokenizer::encode is not available");
         OPENVINO_ASSERT(prompts_1.size() == prompts_2.size() || prompts_1.size() == 1 || prompts_2.size() == 1,
@@ -652,6 +922,9 @@ public:
     }
 
     TokenizedInputs encode(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
+        if (std::optional<TokenizedInputs> inputs = encode_natively(prompts)) {
+            return *inputs;
+        }
         OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                                 "Tokenizer::encode is not available");
 
@@ -681,6 +954,88 @@ public:
         return {unpadded.input_ids, unpadded.attention_mask};
     }
 
+    std::vector<std::vector<int64_t>> encode_parallel(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
+        RaggedTokenizedInputs inputs = encode_ragged(prompts, tokenization_params);
+        const int64_t* ids = inputs.input_ids.data<int64_t>();
+        const int64_t* offsets = inputs.offsets.data<int64_t>();
+        std::vector<std::vector<int64_t>> token_ids(prompts.size());
+        for (size_t i = 0; i < prompts.size(); ++i) {
+            token_ids[i].assign(ids + offsets[i], ids + offsets[i + 1]);
+        }
+        return token_ids;
+    }
+
+    RaggedTokenizedInputs encode_ragged(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
+        OPENVINO_ASSERT(m_native_tokenizer || m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
+                                                "Tokenizer::encode is not available");
+
+        // the shards of the prompts of similar lengths need less padding
+        std::vector<size_t> order(prompts.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&prompts](size_t lhs, size_t rhs) {
+            return prompts[lhs].size() < prompts[rhs].size();
+        });
+        // several shards per infer request balance the load when the prompts are tokenized at different speed
+        constexpr size_t num_shards_per_infer_request = 4;
+        const size_t shard_size = std::max<size_t>(1, (prompts.size() + m_num_tokenizer_infer_requests * num_shards_per_infer_request - 1) /
+                                                          (m_num_tokenizer_infer_requests * num_shards_per_infer_request));
+        const size_t num_shards = (prompts.size() + shard_size - 1) / shard_size;
+
+        std::vector<TokenizedInputs> shard_inputs(num_shards);
+        std::vector<int64_t> lengths(prompts.size(), 0);
+        std::atomic<size_t> next_shard = 0;
+        auto encode_shards = [&] {
+            for (size_t shard = next_shard++; shard < num_shards; shard = next_shard++) {
+                const size_t begin = shard * shard_size, end = std::min(begin + shard_size, prompts.size());
+                std::vector<std::string> shard_prompts;
+                for (size_t i = begin; i < end; ++i) {
+                    shard_prompts.push_back(prompts[order[i]]);
+                }
+                TokenizedInputs& inputs = shard_inputs[shard];
+                inputs = encode(shard_prompts, tokenization_params);
+                const size_t seq_len = inputs.input_ids.get_shape().at(1);
+                const int64_t* mask = inputs.attention_mask.data<int64_t>();
+                for (size_t row = 0; row < shard_prompts.size(); ++row) {
+                    lengths[order[begin + row]] = std::count_if(mask + row * seq_len, mask + (row + 1) * seq_len, [](int64_t value) {
+                        return value != 0;
+                    });
+                }
+            }
+        };
+
+        std::vector<std::future<void>> workers;
+        for (size_t worker = 1; worker < std::min(m_num_tokenizer_infer_requests, num_shards); ++worker) {
+            workers.push_back(std::async(std::launch::async, encode_shards));
+        }
+        encode_shards();
+        for (auto& worker : workers) {
+            worker.get();
+        }
+
+        RaggedTokenizedInputs result;
+        result.offsets = ov::Tensor(ov::element::i64, {prompts.size() + 1});
+        int64_t* offsets = result.offsets.data<int64_t>();
+        offsets[0] = 0;
+        std::partial_sum(lengths.begin(), lengths.end(), offsets + 1);
+        result.input_ids = ov::Tensor(ov::element::i64, {1, static_cast<size_t>(offsets[prompts.size()])});
+        int64_t* ids = result.input_ids.data<int64_t>();
+        for (size_t shard = 0; shard < num_shards; ++shard) {
+            const TokenizedInputs& inputs = shard_inputs[shard];
+            const size_t seq_len = inputs.input_ids.get_shape().at(1);
+            const int64_t* shard_ids = inputs.input_ids.data<int64_t>();
+            const int64_t* mask = inputs.attention_mask.data<int64_t>();
+            for (size_t row = 0; row < inputs.input_ids.get_shape().at(0); ++row) {
+                int64_t* prompt_ids = ids + offsets[order[shard * shard_size + row]];
+                for (size_t column = row * seq_len; column < (row + 1) * seq_len; ++column) {
+                    if (mask[column] != 0) {
+                        *prompt_ids++ = shard_ids[column];
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask) {
         ov::Tensor input_ids_ = ov::Tensor(input_ids.get_element_type(), input_ids.get_shape());
         ov::Tensor attention_mask_ = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
@@ -691,8 +1046,15 @@ public:
     }
 
     std::string decode(const std::vector<int64_t>& tokens, const ov::AnyMap& detokenization_params = {}) {
+        if (m_native_tokenizer) {
+            return decode_natively(tokens, detokenization_params);
+        }
+        compile_detokenizer_if_necessary();
         OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
+        return infer_detokenizer(tokens, detokenization_params);
+    }
 
+    std::string infer_detokenizer(const std::vector<int64_t>& tokens, const ov::AnyMap& detokenization_params) {
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
         set_state_if_necessary(infer_request_guard, detokenization_params);
         size_t batch_size = 1;
@@ -702,6 +1064,18 @@ public:
     }
 
     std::vector<std::string> decode(const ov::Tensor& tokens, const ov::AnyMap& detokenization_params = {}) {
+        if (m_native_tokenizer) {
+            OPENVINO_ASSERT(tokens.get_element_type() == ov::element::i64, "tokens tensor element type should be an i64");
+            OPENVINO_ASSERT(tokens.get_shape().size() == 2, "tokens tensor should of rank 2 with shape [batch_size, seq_len]");
+            const size_t seq_len = tokens.get_shape()[1];
+            std::vector<std::string> texts;
+            for (size_t row = 0; row < tokens.get_shape()[0]; ++row) {
+                const int64_t* row_tokens = tokens.data<int64_t>() + row * seq_len;
+                texts.push_back(decode_natively(std::vector<int64_t>(row_tokens, row_tokens + seq_len), detokenization_params));
+            }
+            return texts;
+        }
+        compile_detokenizer_if_necessary();
         OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
         OPENVINO_ASSERT(tokens.get_element_type() == ov::element::i64, "tokens tensor element type should be an i64");
         OPENVINO_ASSERT(tokens.get_shape().size() == 2, "tokens tensor should of rank 2 with shape [batch_size, seq_len]");
@@ -717,6 +1091,14 @@ public:
     }
 
     std::vector<std::string> decode(const std::vector<std::vector<int64_t>>& lines, const ov::AnyMap& detokenization_params = {}) {
+        if (m_native_tokenizer) {
+            std::vector<std::string> texts;
+            for (const auto& line : lines) {
+                texts.push_back(decode_natively(line, detokenization_params));
+            }
+            return texts;
+        }
+        compile_detokenizer_if_necessary();
         OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
 
         auto compare_lengths = [](const std::vector<int64_t>& a, const std::vector<int64_t>& b) {
@@ -743,6 +1125,12 @@ public:
         return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
     }
 
+    std::string decode_natively(const std::vector<int64_t>& tokens, const ov::AnyMap& detokenization_params) const {
+        bool skip_special_tokens_flag = true;
+        ov::genai::utils::read_anymap_param(detokenization_params, skip_special_tokens.name(), skip_special_tokens_flag);
+        return m_native_tokenizer->decode(tokens, skip_special_tokens_flag);
+    }
+
     std::string apply_chat_template(ChatHistory history,
                                     bool add_generation_prompt,
                                     const std::string& chat_template) const {
@@ -752,8 +1140,36 @@ public:
                         " Please add 'chat_template' to tokenizer_config.json to use the model in chat scenario."
                         " For more information see the section Troubleshooting in README.md");
 
-        minja::chat_template minja_template(chat_tpl, m_bos_token, m_eos_token);
+        std::shared_ptr<const minja::chat_template> minja_template = get_minja_template(chat_tpl);
+        std::string result = render_chat_template(*minja_template, history, add_generation_prompt);
+
+        // the prompts of the chats with the same system message start with the same text, which is tokenized once
+        if (history.size() > 1 && history[0].count("role") && history[0].at("role") == "system") {
+            std::string system_prompt;
+            try {
+                system_prompt = render_chat_template(*minja_template, {history[0]}, false);
+            } catch (const ov::Exception&) {
+                // some templates require a user message, the prompt is tokenized as a whole then
+            }
+            if (!system_prompt.empty() && result.compare(0, system_prompt.size(), system_prompt) == 0) {
+                m_prompt_prefix_cache.add_candidate(system_prompt, true);
+                m_prompt_prefix_cache.add_candidate(system_prompt, false);
+            }
+        }
+        return result;
+    }
+
+    // parses the chat template once while it's being used
+    std::shared_ptr<const minja::chat_template> get_minja_template(const std::string& chat_template) const {
+        std::lock_guard<std::mutex> lock(m_minja_template_mutex);
+        if (!m_minja_template || m_minja_template_source != chat_template) {
+            m_minja_template = std::make_shared<const minja::chat_template>(chat_template, m_bos_token, m_eos_token);
+            m_minja_template_source = chat_template;
+        }
+        return m_minja_template;
+    }
 
+    std::string render_chat_template(const minja::chat_template& minja_template, const ChatHistory& history, bool add_generation_prompt) const {
         nlohmann::ordered_json messages = nlohmann::ordered_json::array();
         for (const auto& message : history) {
             nlohmann::ordered_json msg;
@@ -864,6 +1280,22 @@ TokenizedInputs Tokenizer::encode(const std::vector<std::string>& prompts, const
     return m_pimpl->encode(prompts, tokenization_params);
 }
 
+std::vector<std::vector<int64_t>> Tokenizer::encode_parallel(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params) {
+    check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(),
+                                          ov::genai::max_length.name(),
+                                          ov::genai::pad_to_max_length.name(),
+                                          ov::genai::padding_side.name()});
+    return m_pimpl->encode_parallel(prompts, tokenization_params);
+}
+
+RaggedTokenizedInputs Tokenizer::encode_ragged(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params) {
+    check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(),
+                                          ov::genai::max_length.name(),
+                                          ov::genai::pad_to_max_length.name(),
+                                          ov::genai::padding_side.name()});
+    return m_pimpl->encode_ragged(prompts, tokenization_params);
+}
+
 TokenizedInputs Tokenizer::encode(const std::initializer_list<std::string>& text, const ov::AnyMap& tokenization_params) {
     check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(),
                                           ov::genai::max_length.name(),
@@ -900,20 +1332,25 @@ int64_t Tokenizer::get_pad_token_id() const {
 }
 
 std::string Tokenizer::get_pad_token() const {
+    m_pimpl->compile_detokenizer_if_necessary();
     return m_pimpl->m_pad_token;
 }
 
 std::string Tokenizer::get_bos_token() const {
+    m_pimpl->compile_detokenizer_if_necessary();
     return m_pimpl->m_bos_token;
 }
 
 std::string Tokenizer::get_eos_token() const {
+    m_pimpl->compile_detokenizer_if_necessary();
     return m_pimpl->m_eos_token;
 }
 
 std::string Tokenizer::apply_chat_template(ChatHistory history,
                                            bool add_generation_prompt,
                                            const std::string& chat_template) const {
+    // the special tokens rendered by the template may be decoded by the detokenizer
+    m_pimpl->compile_detokenizer_if_necessary();
     return m_pimpl->apply_chat_template(history, add_generation_prompt, chat_template);
 }
 
@@ -941,6 +1378,11 @@ const std::vector<std::string>& Tokenizer::get_vocab_vector() const {
     return m_pimpl->m_vocab;
 }
 
+const std::vector<std::string>& Tokenizer::get_detokenization_pieces() const {
+    static const std::vector<std::string> no_pieces;
+    return m_pimpl ? m_pimpl->m_detokenization_pieces : no_pieces;
+}
+
 bool Tokenizer::supports_paired_input() const {
     return m_pimpl->is_paired_input;
 }
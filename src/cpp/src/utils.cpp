@@ -4,28 +4,61 @@
 #include "utils.hpp"
 
 #include <variant>
+#include <algorithm>
 #include <fstream>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
 
+#include "openvino/core/version.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/divide.hpp"
+#include "openvino/op/exp.hpp"
 #include "openvino/op/gather.hpp"
+#include "openvino/op/greater_eq.hpp"
+#include "openvino/op/log.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/matmul.hpp"
+#include "openvino/op/maximum.hpp"
+#include "openvino/op/negative.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/shape_of.hpp"
 #include "openvino/op/slice.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/op/tanh.hpp"
+#include "openvino/op/topk.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/genai/compiled_model_cache.hpp"
 #include "openvino/genai/text_streamer.hpp"
 #include "gguf_utils/gguf_modeling.hpp"
 
 
 #include "sampling/sampler.hpp"
+#include "logger.hpp"
 
 namespace ov {
 
 namespace genai {
 const std::string PA_BACKEND = "PA";
 const std::string SDPA_BACKEND = "SDPA";
+
+void set_compiled_model_cache_dir(const std::filesystem::path& cache_dir) {
+    // the core level cache dir applies to every compile_model() of the core, which has no cache dir in its properties
+    utils::singleton_core().set_property(ov::cache_dir(cache_dir.string()));
+}
+
+std::filesystem::path get_compiled_model_cache_dir() {
+    return utils::singleton_core().get_property(ov::cache_dir);
+}
 }
 }
 
@@ -97,6 +130,70 @@ void update_npu_config(ov::AnyMap& config,
     rename_key(config, "++SHARED_HEAD_CONFIG", "++NPUW_LLM_SHARED_HEAD_CONFIG");
 }
 
+void hash_combine(uint64_t& seed, uint64_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+// the path of the blob compiled for the model with the given NPU config in "BLOB_CACHE_DIR",
+// std::nullopt if the config can't be serialized to build the key
+std::optional<std::filesystem::path> get_cached_blob_path(const std::filesystem::path& blob_cache_dir,
+                                                          const std::shared_ptr<ov::Model>& model,
+                                                          const ov::AnyMap& config) {
+    std::hash<std::string> string_hash;
+    uint64_t key = ov::genai::utils::get_model_fingerprint(model);
+    hash_combine(key, string_hash(ov::get_openvino_version().buildNumber));
+    // NB: The blob compiled with one driver can't be imported with another one
+    try {
+        hash_combine(key, string_hash(ov::genai::utils::singleton_core().get_property("NPU", "NPU_DRIVER_VERSION").as<std::string>()));
+    } catch (const ov::Exception&) {
+        // the driver version is not reported by the plugin, the blob is keyed by the OpenVINO build only
+    }
+    for (const auto& [name, value] : config) {
+        try {
+            hash_combine(key, string_hash(name + "=" + value.as<std::string>()));
+        } catch (const ov::Exception&) {
+            ov::genai::Logger::warn("Compiled blob caching is disabled: \"" + name + "\" config option can't be serialized");
+            return std::nullopt;
+        }
+    }
+    std::stringstream file_name;
+    file_name << std::hex << key << ".blob";
+    return blob_cache_dir / file_name.str();
+}
+
+std::optional<ov::CompiledModel> import_cached_blob(const std::filesystem::path& blob_path, const ov::AnyMap& config) {
+    if (!std::filesystem::exists(blob_path)) {
+        return std::nullopt;
+    }
+    std::ifstream fin(blob_path, std::ios::in | std::ios::binary);
+    try {
+        return ov::genai::utils::singleton_core().import_model(fin, "NPU", config);
+    } catch (const ov::Exception& e) {
+        // e.g. the blob file is corrupted, the model is compiled and exported again
+        ov::genai::Logger::warn("Failed to import cached blob " + blob_path.string() + ": " + e.what());
+        return std::nullopt;
+    }
+}
+
+// exports to a temporary file first, so that an interrupted export never leaves a corrupted blob in the cache
+void export_cached_blob(ov::CompiledModel& compiled, const std::filesystem::path& blob_path) {
+    const std::filesystem::path tmp_blob_path = blob_path.string() + ".tmp";
+    try {
+        std::filesystem::create_directories(blob_path.parent_path());
+        {
+            std::ofstream fout(tmp_blob_path, std::ios::out | std::ios::binary);
+            OPENVINO_ASSERT(fout.is_open(), "Failed to open ", tmp_blob_path, " for writing");
+            compiled.export_model(fout);
+            OPENVINO_ASSERT(fout.good(), "Failed to write ", tmp_blob_path);
+        }
+        std::filesystem::rename(tmp_blob_path, blob_path);
+    } catch (const std::exception& e) {
+        std::error_code ec;
+        std::filesystem::remove(tmp_blob_path, ec);
+        ov::genai::Logger::warn("Failed to export compiled blob to the cache: " + std::string(e.what()));
+    }
+}
+
 inline bool is_paged_attention_available() {
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     return true;
@@ -202,6 +299,10 @@ ProcessorConfig from_any_map(
     read_anymap_param(config_map, "max_slice_nums", extracted_config.max_slice_nums);
     read_anymap_param(config_map, "norm_mean", extracted_config.norm_mean);
     read_anymap_param(config_map, "norm_std", extracted_config.norm_std);
+    read_anymap_param(config_map, "video_max_frames", extracted_config.video_max_frames);
+    read_anymap_param(config_map, "video_max_pixels", extracted_config.video_max_pixels);
+    read_anymap_param(config_map, "video_max_tokens", extracted_config.video_max_tokens);
+    read_anymap_param(config_map, "video_frame_difference_threshold", extracted_config.video_frame_difference_threshold);
     return extracted_config;
 }
 
@@ -295,8 +396,76 @@ void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model)
     }
 }
 
+void apply_device_greedy_sampling_transformation(std::shared_ptr<ov::Model> model) {
+    auto logits = model->output("logits").get_node()->input_value(0);
+
+    // the most probable token id and its log probability, i.e. -log(sum(exp(logits - max_logit)))
+    auto k = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{1});
+    auto top_k = std::make_shared<ov::op::v11::TopK>(logits, k, -1, ov::op::TopKMode::MAX, ov::op::TopKSortType::NONE, ov::element::i64);
+    auto axis = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{-1});
+    auto exp = std::make_shared<ov::op::v0::Exp>(std::make_shared<ov::op::v1::Subtract>(logits, top_k->output(0)));
+    auto exp_sum = std::make_shared<ov::op::v1::ReduceSum>(exp, axis, true);
+    std::shared_ptr<ov::Node> log_prob = std::make_shared<ov::op::v0::Negative>(std::make_shared<ov::op::v0::Log>(exp_sum));
+    if (log_prob->get_output_element_type(0) != ov::element::f32) {
+        log_prob = std::make_shared<ov::op::v0::Convert>(log_prob, ov::element::f32);
+    }
+
+    auto token_ids_result = std::make_shared<ov::op::v0::Result>(top_k->output(1));
+    token_ids_result->output(0).get_tensor().set_names({"sampled_token_ids"});
+    auto log_probs_result = std::make_shared<ov::op::v0::Result>(log_prob);
+    log_probs_result->output(0).get_tensor().set_names({"sampled_token_log_probs"});
+    model->add_results({token_ids_result, log_probs_result});
+}
+
+void apply_embeddings_lookup_transformation(std::shared_ptr<ov::Model> model, const std::shared_ptr<ov::Model>& embeddings_model) {
+    // the nodes of the embeddings model become the part of the language model, so the copy of it is merged
+    std::shared_ptr<ov::Model> embeddings = embeddings_model->clone();
+    OPENVINO_ASSERT(embeddings->get_parameters().size() == 1 && embeddings->get_results().size() == 1,
+                    "Text embeddings model is expected to have a single input and a single output");
+    auto inputs_embeds = model->input("inputs_embeds");
+    const auto inputs_embeds_consumers = inputs_embeds.get_target_inputs();
+
+    auto input_ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{-1});
+    input_ids->set_friendly_name("input_ids");
+    input_ids->output(0).get_tensor().set_names({"input_ids"});
+
+    // the negative ids are clamped, so that something is looked up for the tokens, whose embeddings are passed
+    auto zero = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{0});
+    auto is_looked_up = std::make_shared<ov::op::v1::GreaterEqual>(input_ids, zero);
+    std::shared_ptr<ov::Node> ids = std::make_shared<ov::op::v1::Maximum>(input_ids, zero);
+    // the embeddings model takes [batch, sequence length] ids
+    auto batch_axis = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{0});
+    ids = std::make_shared<ov::op::v0::Unsqueeze>(ids, batch_axis);
+    auto embeddings_input = embeddings->get_parameters()[0];
+    if (embeddings_input->get_element_type() != ov::element::i64) {
+        ids = std::make_shared<ov::op::v0::Convert>(ids, embeddings_input->get_element_type());
+    }
+    embeddings_input->output(0).replace(ids);
+
+    std::shared_ptr<ov::Node> looked_up_embeds = std::make_shared<ov::op::v1::Reshape>(
+        embeddings->get_results()[0]->input_value(0), std::make_shared<ov::op::v3::ShapeOf>(inputs_embeds), false);
+    if (looked_up_embeds->get_output_element_type(0) != inputs_embeds.get_element_type()) {
+        looked_up_embeds = std::make_shared<ov::op::v0::Convert>(looked_up_embeds, inputs_embeds.get_element_type());
+    }
+    auto hidden_axis = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+    auto embeds = std::make_shared<ov::op::v1::Select>(
+        std::make_shared<ov::op::v0::Unsqueeze>(is_looked_up, hidden_axis), looked_up_embeds, inputs_embeds);
+    for (auto consumer : inputs_embeds_consumers) {
+        consumer.replace_source_output(embeds);
+    }
+    model->add_parameters({input_ids});
+    model->validate_nodes_and_infer_types();
+}
+
 ov::Core singleton_core() {
-    static ov::Core core;
+    static ov::Core core = [] {
+        ov::Core core;
+        const char* cache_dir = std::getenv("OPENVINO_GENAI_CACHE_DIR");
+        if (cache_dir != nullptr && cache_dir[0] != '\0') {
+            core.set_property(ov::cache_dir(cache_dir));
+        }
+        return core;
+    }();
     return core;
 }
 
@@ -318,6 +487,12 @@ std::pair<ov::AnyMap, bool> extract_gguf_properties(const ov::AnyMap& external_p
         properties.erase(it);
     }
 
+    if (auto gguf_cache_dir = pop_option(properties, ov::genai::gguf_cache_dir.name())) {
+        if (!properties.count(ov::cache_dir.name())) {
+            properties[ov::cache_dir.name()] = (std::filesystem::path(gguf_cache_dir->as<std::string>()) / "compiled").string();
+        }
+    }
+
     return {properties, enable_save_ov_model};
 }
 
@@ -336,11 +511,16 @@ void save_openvino_model(const std::shared_ptr<ov::Model>& model, const std::str
     }
 }
 
-std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_dir,  const ov::AnyMap& properties) {
+namespace {
+
+std::shared_ptr<ov::Model> read_model_from_disk(const std::filesystem::path& model_dir,  const ov::AnyMap& properties) {
     auto [filtered_properties, enable_save_ov_model] = extract_gguf_properties(properties);
     if (is_gguf_model(model_dir)) {
 #ifdef ENABLE_GGUF
-        return create_from_gguf(model_dir.string(), enable_save_ov_model);
+        auto cache_dir = properties.find(ov::genai::gguf_cache_dir.name());
+        return create_from_gguf(model_dir.string(),
+                                enable_save_ov_model,
+                                cache_dir != properties.end() ? cache_dir->second.as<std::string>() : std::string{});
 #else
         OPENVINO_ASSERT("GGUF support is switched off. Please, recompile with 'cmake -DENABLE_GGUF=ON'");
 #endif
@@ -359,6 +539,125 @@ std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_dir,  c
     }
 }
 
+// the key of the properties, std::nullopt if some of them can't be serialized
+std::optional<std::string> serialize_properties(const ov::AnyMap& properties) {
+    std::string serialized;
+    for (const auto& [name, value] : properties) {
+        try {
+            serialized += name + "=" + value.as<std::string>() + ";";
+        } catch (const ov::Exception&) {
+            return std::nullopt;
+        }
+    }
+    return serialized;
+}
+
+// The models read by read_model() and compiled by compile_shared_model(), which are shared by the pipelines of the
+// process. The entries are weak, a model is released once the last pipeline using it is destroyed.
+struct ModelRegistry {
+    std::mutex mutex;
+    std::map<std::string, std::weak_ptr<ov::Model>> read_models;
+    std::map<std::string, std::weak_ptr<ov::CompiledModel>> compiled_models;
+
+    static ModelRegistry& get() {
+        static ModelRegistry registry;
+        return registry;
+    }
+
+    template <typename T>
+    static void erase_expired(std::map<std::string, std::weak_ptr<T>>& models) {
+        for (auto it = models.begin(); it != models.end();) {
+            it = it->second.expired() ? models.erase(it) : std::next(it);
+        }
+    }
+};
+
+// a clone returned by read_model(), which keeps the read model alive to be cloned by the next read_model() calls
+struct ClonedModel {
+    std::shared_ptr<ov::Model> read_model;
+    std::shared_ptr<ov::Model> clone;
+};
+
+// the compiled model keeps the compiled ov::Model, so that the data pointers of its constants, which are a part of
+// the key of the compiled model, aren't reused by other constants while it's registered
+struct SharedCompiledModel {
+    ov::CompiledModel compiled_model;
+    std::shared_ptr<ov::Model> model;
+};
+
+} // namespace
+
+std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_dir,  const ov::AnyMap& properties) {
+    const std::optional<std::string> serialized_properties = serialize_properties(properties);
+    std::error_code error;
+    const auto last_write_time = std::filesystem::last_write_time(model_dir, error);
+    if (!serialized_properties || error) {
+        return read_model_from_disk(model_dir, properties);
+    }
+    const std::string key = std::filesystem::absolute(model_dir).lexically_normal().string() + "|" +
+                            std::to_string(last_write_time.time_since_epoch().count()) + "|" + *serialized_properties;
+
+    ModelRegistry& registry = ModelRegistry::get();
+    std::shared_ptr<ov::Model> model;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        model = registry.read_models[key].lock();
+    }
+    if (!model) {
+        // the registry isn't locked for reading, the models of the other pipelines are read in parallel
+        model = read_model_from_disk(model_dir, properties);
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        ModelRegistry::erase_expired(registry.read_models);
+        if (auto read_concurrently = registry.read_models[key].lock()) {
+            model = read_concurrently;
+        } else {
+            registry.read_models[key] = model;
+        }
+    }
+    // the pipelines transform their models, the clones share the constant buffers of the read model
+    auto cloned = std::make_shared<ClonedModel>(ClonedModel{model, model->clone()});
+    return std::shared_ptr<ov::Model>(cloned, cloned->clone.get());
+}
+
+std::shared_ptr<ov::CompiledModel> compile_shared_model(const std::shared_ptr<ov::Model>& model,
+                                                        const std::string& device,
+                                                        const ov::AnyMap& properties) {
+    auto compile = [&]() {
+        auto shared = std::make_shared<SharedCompiledModel>(
+            SharedCompiledModel{singleton_core().compile_model(model, device, properties), model});
+        return std::shared_ptr<ov::CompiledModel>(shared, &shared->compiled_model);
+    };
+    const std::optional<std::string> serialized_properties = serialize_properties(properties);
+    if (!serialized_properties) {
+        return compile();
+    }
+    // the models cloned from the same read model share the constant buffers unless they are transformed,
+    // e.g. by fusing LoRA adapters, so the same buffers identify the same weights without hashing their contents
+    uint64_t fingerprint = get_model_fingerprint(model);
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            hash_combine(fingerprint, reinterpret_cast<uintptr_t>(constant->get_data_ptr()));
+        }
+    }
+    const std::string key = std::to_string(fingerprint) + "|" + device + "|" + *serialized_properties;
+
+    ModelRegistry& registry = ModelRegistry::get();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        if (auto compiled_model = registry.compiled_models[key].lock()) {
+            return compiled_model;
+        }
+    }
+    std::shared_ptr<ov::CompiledModel> compiled_model = compile();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    ModelRegistry::erase_expired(registry.compiled_models);
+    if (auto compiled_concurrently = registry.compiled_models[key].lock()) {
+        return compiled_concurrently;
+    }
+    registry.compiled_models[key] = compiled_model;
+    return compiled_model;
+}
+
 size_t get_first_history_difference(const ov::Tensor& encoded_history, const std::vector<int64_t> tokenized_history) {
     size_t idx = 0;
     auto encoded_history_data = encoded_history.data<int64_t>();
@@ -513,6 +812,7 @@ compile_decoder_for_npu(const std::shared_ptr<ov::Model>& model,
 
     auto blob_path = pop_or_default(properties, "BLOB_PATH", std::string{});
     const auto export_blob = pop_or_default(properties, "EXPORT_BLOB", false);
+    const auto blob_cache_dir = pop_or_default(properties, "BLOB_CACHE_DIR", std::string{});
     const bool do_import = (!blob_path.empty() && !export_blob);
 
     if (do_import) {
@@ -530,7 +830,20 @@ compile_decoder_for_npu(const std::shared_ptr<ov::Model>& model,
         kv_desc.max_prompt_len = pop_int_and_cast(properties, "MAX_PROMPT_LEN").value_or(1024u);
         kv_desc.min_response_len = pop_int_and_cast(properties, "MIN_RESPONSE_LEN").value_or(128u);
         update_npu_config(properties, model, kv_pos, kv_desc);
+        // NB: Explicit BLOB_PATH takes precedence over the cache
+        std::optional<std::filesystem::path> cached_blob_path;
+        if (!blob_cache_dir.empty() && blob_path.empty()) {
+            cached_blob_path = get_cached_blob_path(blob_cache_dir, model, properties);
+            if (cached_blob_path.has_value()) {
+                if (auto cached = import_cached_blob(*cached_blob_path, properties)) {
+                    return { *cached, kv_desc };
+                }
+            }
+        }
         compiled = ov::genai::utils::singleton_core().compile_model(model, "NPU", properties);
+        if (cached_blob_path.has_value()) {
+            export_cached_blob(compiled, *cached_blob_path);
+        }
         // Also export compiled model if required
         if (export_blob) {
             if (blob_path.empty()) {
@@ -554,6 +867,56 @@ compile_decoder_for_npu(const std::shared_ptr<ov::Model>& model,
     return { compiled, kv_desc };
 }
 
+ov::CompiledModel compile_model_for_npu(const std::shared_ptr<ov::Model>& model, const ov::AnyMap& config) {
+    ov::AnyMap properties = config;
+    const auto blob_cache_dir = pop_or_default(properties, "BLOB_CACHE_DIR", std::string{});
+
+    std::optional<std::filesystem::path> cached_blob_path;
+    if (!blob_cache_dir.empty()) {
+        cached_blob_path = get_cached_blob_path(blob_cache_dir, model, properties);
+        if (cached_blob_path.has_value()) {
+            if (auto cached = import_cached_blob(*cached_blob_path, properties)) {
+                return *cached;
+            }
+        }
+    }
+    ov::CompiledModel compiled = ov::genai::utils::singleton_core().compile_model(model, "NPU", properties);
+    if (cached_blob_path.has_value()) {
+        export_cached_blob(compiled, *cached_blob_path);
+    }
+    return compiled;
+}
+
+uint64_t get_model_fingerprint(const std::shared_ptr<const ov::Model>& model) {
+    uint64_t fingerprint = 0;
+    std::hash<std::string> string_hash;
+    for (const auto& op : model->get_ordered_ops()) {
+        std::string op_description = op->get_type_name();
+        for (const auto& output : op->outputs()) {
+            op_description += output.get_element_type().get_type_name() + output.get_partial_shape().to_string();
+        }
+        hash_combine(fingerprint, string_hash(op_description));
+        if (auto constant = std::dynamic_pointer_cast<const ov::op::v0::Constant>(op)) {
+            // hashing the contents of the whole weights would take too long for the large models
+            const size_t sample_size = std::min<size_t>(constant->get_byte_size(), 64);
+            const char* data = static_cast<const char*>(constant->get_data_ptr());
+            hash_combine(fingerprint, string_hash(std::string(data, sample_size)));
+            hash_combine(fingerprint, constant->get_byte_size());
+        }
+    }
+    return fingerprint;
+}
+
+size_t get_weights_byte_size(const std::shared_ptr<const ov::Model>& model) {
+    size_t byte_size = 0;
+    for (const auto& op : model->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<const ov::op::v0::Constant>(op)) {
+            byte_size += constant->get_byte_size();
+        }
+    }
+    return byte_size;
+}
+
 std::optional<ov::Any> pop_option(ov::AnyMap& config, const std::string& option_name) {
     if (auto it = config.find(option_name); it != config.end()) {
         std::optional<ov::Any> found = std::make_optional(it->second);
@@ -563,6 +926,61 @@ std::optional<ov::Any> pop_option(ov::AnyMap& config, const std::string& option_
     return std::nullopt;
 }
 
+std::vector<uint32_t> pop_buckets(ov::AnyMap& config, const std::string& option_name) {
+    std::vector<uint32_t> buckets;
+    auto anyopt = pop_option(config, option_name);
+    if (!anyopt.has_value()) {
+        return buckets;
+    }
+    std::vector<int64_t> values;
+    // NB: Integer values coming from python have int64_t datatype
+    if (anyopt->is<std::vector<int64_t>>()) {
+        values = anyopt->as<std::vector<int64_t>>();
+    } else if (anyopt->is<std::vector<int>>()) {
+        const auto int_values = anyopt->as<std::vector<int>>();
+        values.assign(int_values.begin(), int_values.end());
+    } else if (anyopt->is<std::vector<size_t>>()) {
+        const auto size_values = anyopt->as<std::vector<size_t>>();
+        values.assign(size_values.begin(), size_values.end());
+    } else {
+        OPENVINO_THROW("Failed to extract " + option_name + ". Type mismatch: expected a list of integers");
+    }
+    for (int64_t value : values) {
+        OPENVINO_ASSERT(value > 0, option_name, " must be positive, got ", value);
+        buckets.push_back(static_cast<uint32_t>(value));
+    }
+    std::sort(buckets.begin(), buckets.end());
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+    return buckets;
+}
+
+GenerationConfig get_warmup_generation_config(const GenerationConfig& default_config, size_t max_new_tokens) {
+    OPENVINO_ASSERT(max_new_tokens > 0, "WarmupConfig::max_new_tokens must be positive");
+    GenerationConfig config;
+    config.max_new_tokens = max_new_tokens;
+    config.ignore_eos = true;
+    config.apply_chat_template = false;
+    config.adapters = default_config.adapters;
+    if (default_config.eos_token_id != -1) {
+        config.set_eos_token_id(default_config.eos_token_id);
+    }
+    return config;
+}
+
+ov::Tensor get_warmup_input_ids(size_t batch_size, size_t prompt_length, const Tokenizer& tokenizer) {
+    OPENVINO_ASSERT(batch_size > 0 && prompt_length > 0, "WarmupConfig prompt lengths and batch sizes must be positive");
+    // the values of the tokens don't matter for the shapes, but the special ones may be handled by the model differently
+    const int64_t bos_token_id = tokenizer.get_bos_token_id();
+    ov::Tensor input_ids(ov::element::i64, {batch_size, prompt_length});
+    std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), bos_token_id == 0 ? 1 : 0);
+    if (bos_token_id != -1) {
+        for (size_t batch = 0; batch < batch_size; ++batch) {
+            input_ids.data<int64_t>()[batch * prompt_length] = bos_token_id;
+        }
+    }
+    return input_ids;
+}
+
 const ModelsMap::mapped_type& get_model_weights_pair(const ModelsMap& models_map, const std::string& key) {
     auto it = models_map.find(key);
     if (it != models_map.end()) {
@@ -602,7 +1020,8 @@ bool explicitly_requires_paged_attention(const ov::AnyMap& properties) {
             OPENVINO_THROW("Continuous batching backend requires PagedAttention operation support, which is available on x86_64 or ARM64 platforms only");
         }
     }
-    if (properties.find(utils::DRAFT_MODEL_ARG_NAME) != properties.end()) {
+    if (properties.find(utils::DRAFT_MODEL_ARG_NAME) != properties.end() ||
+        properties.find(ov::genai::self_speculative_num_layers.name()) != properties.end()) {
         if (is_paged_attention_available()) {
             return true;
         } else {
@@ -612,11 +1031,9 @@ bool explicitly_requires_paged_attention(const ov::AnyMap& properties) {
 
     auto prompt_lookup_prop = properties.find("prompt_lookup");
     if (prompt_lookup_prop != properties.end() && prompt_lookup_prop->second.as<bool>() == true) {
-        if (is_paged_attention_available()) {
-            return true;
-        } else {
-            OPENVINO_THROW("Prompt lookup decoding requires PagedAttention operation support, which is available on x86_64 or ARM64 platforms only");
-        }
+        // stateful pipeline runs prompt lookup decoding without PagedAttention operation
+        return is_paged_attention_available() &&
+               (attention_backend_it == properties.end() || attention_backend_it->second.as<std::string>() == PA_BACKEND);
     }
     return false;
 }
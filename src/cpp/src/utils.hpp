@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include <chrono>
+#include <future>
+#include <map>
 #include <type_traits>
 #include <optional>
 #include <stdexcept>
@@ -78,6 +81,9 @@ void read_anymap_param(const ov::AnyMap& config_map, const std::string& name, T&
 const std::string STREAMER_ARG_NAME = "streamer";
 const std::string CONFIG_ARG_NAME = "generation_config";
 const std::string DRAFT_MODEL_ARG_NAME = "draft_model";
+// the text embeddings model passed to the continuous batching pipeline to be merged into the language model,
+// see apply_embeddings_lookup_transformation
+const std::string EMBEDDINGS_MODEL_ARG_NAME = "embeddings_model";
 
 template<typename Config = ov::genai::GenerationConfig>
 Config from_config_json_if_exists(const std::filesystem::path& models_path, const char config_name[] = "generation_config.json") {
@@ -100,14 +106,44 @@ void apply_slice_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
 void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
+/**
+ * Adds "sampled_token_ids" and "sampled_token_log_probs" outputs to the model, holding the argmax of the logits
+ * and its log probability for each logits row, so that greedy sampling may be done without reading the logits.
+ * The "logits" output is kept for the requests which cannot be sampled this way.
+ */
+void apply_device_greedy_sampling_transformation(std::shared_ptr<ov::Model> model);
+
+/**
+ * Merges the text embeddings model into the language model with the paged attention transformations applied, so that
+ * the language model takes the "input_ids" of [total_num_tokens] shape along with "inputs_embeds" of
+ * [total_num_tokens, hidden_size] one: the embeddings of the tokens with non-negative ids are looked up within the model,
+ * while the rows of "inputs_embeds" are taken for the tokens with negative ids, e.g. the prompt ones.
+ */
+void apply_embeddings_lookup_transformation(std::shared_ptr<ov::Model> model, const std::shared_ptr<ov::Model>& embeddings_model);
+
 ov::Core singleton_core();
 
 std::pair<ov::AnyMap, bool> extract_gguf_properties(const ov::AnyMap& external_properties);
 
 std::pair<ov::AnyMap, bool> extract_paired_input_props(const ov::AnyMap& external_properties);
 
+/**
+ * Reads the model from the directory or the GGUF file. The model read for the same path and properties is shared by
+ * the pipelines of the process: it's kept while any of its clones is alive, and each call returns a new clone, which
+ * shares the constant buffers with the other clones and may be transformed by the pipeline.
+ */
 std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_dir,  const ov::AnyMap& config);
 
+/**
+ * Compiles the model or returns the model compiled by another pipeline of the process for the same device and properties,
+ * if it has the same topology and the same constant buffers, e.g. if both models are the clones returned by read_model()
+ * and are transformed the same way. The compiled model is shared until the last pipeline holding it is destroyed, the
+ * pipelines create their own infer requests.
+ */
+std::shared_ptr<ov::CompiledModel> compile_shared_model(const std::shared_ptr<ov::Model>& model,
+                                                        const std::string& device,
+                                                        const ov::AnyMap& properties);
+
 void release_core_plugin(const std::string& device);
 
 size_t get_first_history_difference(const ov::Tensor& encoded_history, const std::vector<int64_t> tokenized_history);
@@ -158,10 +194,32 @@ struct KVDesc {
     uint32_t min_response_len;
 };
 
+/**
+ * Compiles the decoder for NPU. If "BLOB_CACHE_DIR" is set, the compiled blob is imported from the directory if it was
+ * exported there for the same model, driver and config before, otherwise the compiled model is exported there.
+ */
 std::pair<ov::CompiledModel, KVDesc> compile_decoder_for_npu(const std::shared_ptr<ov::Model>& model,
                                                              const ov::AnyMap& config,
                                                              const KVAxesPosition& kv_pos);
 
+/**
+ * Compiles the model of static shapes for NPU. "BLOB_CACHE_DIR" caches the compiled blob like in
+ * compile_decoder_for_npu().
+ */
+ov::CompiledModel compile_model_for_npu(const std::shared_ptr<ov::Model>& model, const ov::AnyMap& config);
+
+/**
+ * Computes the fingerprint of a model, e.g. to identify the artifacts computed with it. The fingerprint is built from
+ * the topology of the model and a sample of the contents of its constants, and is only stable within the same build of
+ * the library.
+ */
+uint64_t get_model_fingerprint(const std::shared_ptr<const ov::Model>& model);
+
+/**
+ * @return The total size of the constants of a model in bytes, which approximates the memory taken by its weights once compiled.
+ */
+size_t get_weights_byte_size(const std::shared_ptr<const ov::Model>& model);
+
 /// @brief SharedOptional is a wrapper around a reference to an existing object and an optional shared alternative value.
 /// The difference from std::optional is that the default state is not empty and contains a reference to an existing object outside the class.
 /// Another difference is that the alternative value is shared between all instances of SharedOptional like std::shared_ptr.
@@ -230,6 +288,12 @@ std::shared_ptr<StreamerBase> create_streamer(StreamerVariant streamer, Tokenize
 
 std::optional<ov::Any> pop_option(ov::AnyMap& config, const std::string& option_name);
 
+/**
+ * Pops the option of a list of positive integers, e.g. the shapes the model is compiled for, and returns them sorted
+ * without duplicates. Returns an empty list if the option is not set.
+ */
+std::vector<uint32_t> pop_buckets(ov::AnyMap& config, const std::string& option_name);
+
 template <typename T>
 T pop_or_default(ov::AnyMap& config, const std::string& key, const T& default_value) {
     auto anyopt = pop_option(config, key);
@@ -242,6 +306,44 @@ T pop_or_default(ov::AnyMap& config, const std::string& key, const T& default_va
     return default_value;
 }
 
+/**
+ * Loads a model of a pipeline on a separate thread, so that the independent models of the pipeline are compiled
+ * concurrently through singleton_core(). The loads are joined by get() in the order of their creation, which rethrows
+ * the exception of the load and stores its duration in ms to load_times under the name of the model.
+ */
+template <typename T>
+class AsyncModelLoad {
+public:
+    template <typename F>
+    AsyncModelLoad(std::string name, F&& load) :
+        m_name(std::move(name)),
+        m_future(std::async(std::launch::async, [load = std::forward<F>(load)]() mutable {
+            const auto start_time = std::chrono::steady_clock::now();
+            T model = load();
+            const auto duration = std::chrono::steady_clock::now() - start_time;
+            return std::pair<T, float>{std::move(model), std::chrono::duration<float, std::milli>(duration).count()};
+        })) {}
+
+    T get(std::map<std::string, float>& load_times) {
+        auto [model, load_time] = m_future.get();
+        load_times[m_name] = load_time;
+        return std::move(model);
+    }
+
+private:
+    std::string m_name;
+    std::future<std::pair<T, float>> m_future;
+};
+
+/**
+ * Returns the greedy config of the warm-up generations, which generates exactly max_new_tokens tokens. The adapters of
+ * the default config are kept, so that the kernels of LoRA are compiled as well.
+ */
+GenerationConfig get_warmup_generation_config(const GenerationConfig& default_config, size_t max_new_tokens);
+
+// returns the {batch_size, prompt_length} input ids of a warm-up generation
+ov::Tensor get_warmup_input_ids(size_t batch_size, size_t prompt_length, const Tokenizer& tokenizer);
+
 const ModelsMap::mapped_type& get_model_weights_pair(const ModelsMap& models_map, const std::string& key);
 
 std::pair<ov::AnyMap, SchedulerConfig> extract_scheduler_config(const ov::AnyMap& properties, std::optional<SchedulerConfig> default_config = std::nullopt);
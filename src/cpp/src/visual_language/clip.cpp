@@ -4,8 +4,11 @@
 // Based on clip.cpp
 
 #include "clip.hpp"
+#include <array>
 #include <cmath>
 
+#include "openvino/core/parallel.hpp"
+
 clip_image_u8 tensor_to_clip_image_u8(const ov::Tensor& image_tensor) {
     clip_image_u8 image{
         int(image_tensor.get_shape().at(2)),
@@ -39,30 +42,32 @@ void bilinear_resize(const clip_image_u8& src, clip_image_u8& dst, int target_wi
     float x_ratio = static_cast<float>(src.nx - 1) / target_width;
     float y_ratio = static_cast<float>(src.ny - 1) / target_height;
 
-    for (int y = 0; y < target_height; y++) {
-        for (int x = 0; x < target_width; x++) {
-            float px = x_ratio * x;
-            float py = y_ratio * y;
-            int x_floor = static_cast<int>(px);
-            int y_floor = static_cast<int>(py);
-            float x_lerp = px - x_floor;
-            float y_lerp = py - y_floor;
+    // the source columns and the weights are shared by all the rows
+    std::vector<int> x_floors(target_width);
+    std::vector<float> x_lerps(target_width);
+    for (int x = 0; x < target_width; x++) {
+        float px = x_ratio * x;
+        x_floors[x] = static_cast<int>(px);
+        x_lerps[x] = px - x_floors[x];
+    }
 
+    ov::parallel_for(target_height, [&](size_t y) {
+        float py = y_ratio * y;
+        int y_floor = static_cast<int>(py);
+        float y_lerp = py - y_floor;
+        const uint8_t* top_row = src.buf.data() + 3 * y_floor * src.nx;
+        const uint8_t* bottom_row = src.buf.data() + 3 * std::min(y_floor + 1, src.ny - 1) * src.nx;
+        uint8_t* dst_row = dst.buf.data() + 3 * y * target_width;
+
+        for (int x = 0; x < target_width; x++) {
+            const int left = 3 * x_floors[x], right = 3 * std::min(x_floors[x] + 1, src.nx - 1);
             for (int c = 0; c < 3; c++) {
-                float top = clip_lerp(
-                    static_cast<float>(src.buf[3 * (y_floor * src.nx + x_floor) + c]),
-                    static_cast<float>(src.buf[3 * (y_floor * src.nx + (x_floor + 1)) + c]),
-                    x_lerp
-                );
-                float bottom = clip_lerp(
-                    static_cast<float>(src.buf[3 * ((y_floor + 1) * src.nx + x_floor) + c]),
-                    static_cast<float>(src.buf[3 * ((y_floor + 1) * src.nx + (x_floor + 1)) + c]),
-                    x_lerp
-                );
-                dst.buf[3 * (y * target_width + x) + c] = static_cast<uint8_t>(clip_lerp(top, bottom, y_lerp));
+                float top = clip_lerp(top_row[left + c], top_row[right + c], x_lerps[x]);
+                float bottom = clip_lerp(bottom_row[left + c], bottom_row[right + c], x_lerps[x]);
+                dst_row[3 * x + c] = static_cast<uint8_t>(clip_lerp(top, bottom, y_lerp));
             }
         }
-    }
+    });
 }
 
 template<typename NUM>
@@ -70,6 +75,18 @@ NUM clip(NUM x, NUM lower, NUM upper) {
     return std::max(lower, std::min(x, upper));
 }
 
+// Interpolates the cubic through the points -1, 0, 1 and 2 at t in [0, 1)
+static float cubic_interpolate(float p_1, float p0, float p1, float p2, float t) {
+    float d0 = p_1 - p0;
+    float d2 = p1 - p0;
+    float d3 = p2 - p0;
+    float a0 = p0;
+    float a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
+    float a2 =  1.0 / 2 * d0 +      1.0 / 2 * d2;
+    float a3 = -1.0 / 6 * d0 -      1.0 / 2 * d2 + 1.0 / 6 * d3;
+    return a0 + a1 * t + a2 * t * t + a3 * t * t * t;
+}
+
 void bicubic_resize(const clip_image_u8 &img, clip_image_u8 &dst, int target_width, int target_height) {
     const int nx = img.nx;
     const int ny = img.ny;
@@ -78,57 +95,70 @@ void bicubic_resize(const clip_image_u8 &img, clip_image_u8 &dst, int target_wid
     dst.ny = target_height;
     dst.buf.resize(3 * target_width * target_height);
 
-    float Cc;
-    float C[5];
-    float d0, d2, d3, a0, a1, a2, a3;
-    int i, j, k, jj;
-    int x, y;
-    float dx, dy;
-    float tx, ty;
-
-    tx = (float)nx / (float)target_width;
-    ty = (float)ny / (float)target_height;
+    float tx = (float)nx / (float)target_width;
+    float ty = (float)ny / (float)target_height;
 
     // Bicubic interpolation; adapted from ViT.cpp, inspired from :
     //    -> https://github.com/yglukhov/bicubic-interpolation-image-processing/blob/master/libimage.c#L36
     //    -> https://en.wikipedia.org/wiki/Bicubic_interpolation
+    // The interpolation is separable: the source rows are interpolated horizontally once, and the results are
+    // interpolated vertically, instead of interpolating 4 source rows for each destination pixel.
+
+    // the 4 clipped source columns and the offset of each destination column
+    std::vector<int> src_columns(4 * target_width);
+    std::vector<float> dxs(target_width);
+    for (int j = 0; j < target_width; j++) {
+        int x = (int)(tx * j);
+        dxs[j] = tx * j - x;
+        for (int jj = 0; jj <= 3; jj++) {
+            src_columns[4 * j + jj] = 3 * clip(x - 1 + jj, 0, nx - 1);
+        }
+    }
 
-    for (i = 0; i < target_height; i++) {
-        for (j = 0; j < target_width; j++) {
-            x = (int)(tx * j);
-            y = (int)(ty * i);
-
-            dx = tx * j - x;
-            dy = ty * i - y;
-
-            for (k = 0; k < 3; k++) {
-                for (jj = 0; jj <= 3; jj++) {
-                    d0 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x - 1, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    d2 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x + 1, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    d3 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x + 2, 0, nx - 1)) * 3 + k] - img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-                    a0 = img.buf[(clip(y - 1 + jj, 0, ny - 1) * nx + clip(x, 0, nx - 1)) * 3 + k];
-
-                    a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
-                    a2 =  1.0 / 2 * d0 +      1.0 / 2 * d2;
-                    a3 = -1.0 / 6 * d0 -      1.0 / 2 * d2 + 1.0 / 6 * d3;
-
-                    C[jj] = a0 + a1 * dx + a2 * dx * dx + a3 * dx * dx * dx;
-
-                    d0 = C[0] - C[1];
-                    d2 = C[2] - C[1];
-                    d3 = C[3] - C[1];
-                    a0 = C[1];
-                    a1 = -1.0 / 3 * d0 + d2 - 1.0 / 6 * d3;
-                    a2 =  1.0 / 2 * d0 +      1.0 / 2 * d2;
-                    a3 = -1.0 / 6 * d0 -      1.0 / 2 * d2 + 1.0 / 6 * d3;
-                    Cc = a0 + a1 * dy + a2 * dy * dy + a3 * dy * dy * dy;
-
-                    const uint8_t Cc2 = std::min(std::max(std::round(Cc), 0.0f), 255.0f);
-                    dst.buf[(i * target_width + j) * 3 + k] = float(Cc2);
-                }
+    // the 4 clipped source rows and the offset of each destination row
+    std::vector<int> src_rows(4 * target_height);
+    std::vector<float> dys(target_height);
+    // the position of the source row among the horizontally interpolated rows, if used
+    std::vector<int> interpolated_row_ids(ny, -1);
+    std::vector<int> used_rows;
+    for (int i = 0; i < target_height; i++) {
+        int y = (int)(ty * i);
+        dys[i] = ty * i - y;
+        for (int jj = 0; jj <= 3; jj++) {
+            int row = clip(y - 1 + jj, 0, ny - 1);
+            if (interpolated_row_ids[row] < 0) {
+                interpolated_row_ids[row] = static_cast<int>(used_rows.size());
+                used_rows.push_back(row);
             }
+            src_rows[4 * i + jj] = interpolated_row_ids[row];
         }
     }
+
+    const size_t interpolated_row_size = 3 * static_cast<size_t>(target_width);
+    std::vector<float> interpolated_rows(used_rows.size() * interpolated_row_size);
+    ov::parallel_for(used_rows.size(), [&](size_t row_id) {
+        const uint8_t* src_row = img.buf.data() + 3 * static_cast<size_t>(used_rows[row_id]) * nx;
+        float* interpolated_row = interpolated_rows.data() + row_id * interpolated_row_size;
+        for (int j = 0; j < target_width; j++) {
+            const int* columns = src_columns.data() + 4 * j;
+            for (int k = 0; k < 3; k++) {
+                interpolated_row[3 * j + k] = cubic_interpolate(
+                    src_row[columns[0] + k], src_row[columns[1] + k], src_row[columns[2] + k], src_row[columns[3] + k], dxs[j]);
+            }
+        }
+    });
+
+    ov::parallel_for(target_height, [&](size_t i) {
+        const float* rows[4];
+        for (int jj = 0; jj <= 3; jj++) {
+            rows[jj] = interpolated_rows.data() + src_rows[4 * i + jj] * interpolated_row_size;
+        }
+        uint8_t* dst_row = dst.buf.data() + i * interpolated_row_size;
+        for (size_t pos = 0; pos < interpolated_row_size; pos++) {
+            float Cc = cubic_interpolate(rows[0][pos], rows[1][pos], rows[2][pos], rows[3][pos], dys[i]);
+            dst_row[pos] = std::min(std::max(std::round(Cc), 0.0f), 255.0f);
+        }
+    });
 }
 
 // llava-1.6 type of resize_and_pad (black)
@@ -163,11 +193,9 @@ static clip_image_u8 resize_and_pad_image(const clip_image_u8& image, const std:
 
     // Copy the resized image into the center of the padded buffer
     for (int y = 0; y < new_height; ++y) {
-        for (int x = 0; x < new_width; ++x) {
-            for (int c = 0; c < 3; ++c) {
-                padded_image.buf[3 * ((y + pad_y) * target_width + (x + pad_x)) + c] = resized_image.buf[3 * (y * new_width + x) + c];
-            }
-        }
+        std::memcpy(padded_image.buf.data() + 3 * ((y + pad_y) * target_width + pad_x),
+                    resized_image.buf.data() + 3 * y * new_width,
+                    3 * new_width);
     }
     return padded_image;
 }
@@ -207,72 +235,35 @@ std::pair<int, int> select_best_resolution(const std::pair<int, int> & original_
 
 // returns the normalized float tensor for llava-1.5, for spatial_unpad with anyres processing for llava-1.6 it returns the normalized image patch tensors as a vector
 clip_image_f32 clip_image_preprocess(clip_ctx& ctx, const clip_image_u8& img) {
-    bool pad_to_square = true;
-
-    clip_image_u8 temp;  // we will keep the input image data here temporarily
-    temp.nx = img.nx;
-    temp.ny = img.ny;
-    temp.buf.resize(img.buf.size());
-    memcpy(temp.buf.data(), img.buf.data(), temp.buf.size());
-
-
-    const int nx = temp.nx;
-    const int ny = temp.ny;
-
-    const int nx2 = temp.nx;
-    const int ny2 = temp.ny;
+    const int nx = img.nx;
+    const int ny = img.ny;
 
     clip_image_f32 res;
-    res.nx = nx2;
-    res.ny = ny2;
-    res.buf.resize(3 * nx2 * ny2);
-
-    const int nx3 = nx;
-    const int ny3 = ny;
+    res.nx = nx;
+    res.ny = ny;
+    res.buf.resize(3 * nx * ny);
 
     const auto& m3 = ctx.image_mean; // {0.48145466f, 0.4578275f, 0.40821073f};
     const auto& s3 = ctx.image_std;  // {0.26862954f, 0.26130258f, 0.27577711f};
 
-    for (int y = 0; y < ny3; y++) {
-        for (int x = 0; x < nx3; x++) {
-            for (int c = 0; c < 3; c++) {
-                // linear interpolation
-                const float sx = x;
-                const float sy = y;
-
-                const int x0 = std::max(0, (int)std::floor(sx));
-                const int y0 = std::max(0, (int)std::floor(sy));
-
-                const int x1 = std::min(x0 + 1, nx - 1);
-                const int y1 = std::min(y0 + 1, ny - 1);
-
-                const float dx = sx - x0;
-                const float dy = sy - y0;
-
-                const int j00 = 3 * (y0 * nx + x0) + c;
-                const int j01 = 3 * (y0 * nx + x1) + c;
-                const int j10 = 3 * (y1 * nx + x0) + c;
-                const int j11 = 3 * (y1 * nx + x1) + c;
-
-                const float v00 = temp.buf[j00];
-                const float v01 = temp.buf[j01];
-                const float v10 = temp.buf[j10];
-                const float v11 = temp.buf[j11];
-
-                const float v0 = v00 * (1.0f - dx) + v01 * dx;
-                const float v1 = v10 * (1.0f - dx) + v11 * dx;
-
-                const float v = v0 * (1.0f - dy) + v1 * dy;
-
-                const uint8_t v2 = std::min(std::max(std::round(v), 0.0f), 255.0f);
-
-                //rgb hwc ->chw
-                const int i = (y * nx3 + x) + c * nx3 * ny3;
-
-                res.buf[i] = ((float(v2) / 255.0f) - m3[c]) / s3[c];
-            }
+    // normalized values of each channel by pixel value
+    std::array<std::array<float, 256>, 3> normalized_values;
+    for (int c = 0; c < 3; c++) {
+        for (int v = 0; v < 256; v++) {
+            normalized_values[c][v] = ((float(v) / 255.0f) - m3[c]) / s3[c];
         }
     }
+
+    //rgb hwc ->chw
+    const size_t num_pixels = static_cast<size_t>(nx) * ny;
+    ov::parallel_for(3, [&](size_t c) {
+        const uint8_t* src = img.buf.data() + c;
+        float* dst = res.buf.data() + c * num_pixels;
+        const float* values = normalized_values[c].data();
+        for (size_t i = 0; i < num_pixels; i++) {
+            dst[i] = values[src[3 * i]];
+        }
+    });
     return res;
 }
 
@@ -317,15 +308,10 @@ std::vector<clip_image_u8> get_image_patches(
             patch.buf.resize(3 * patch_size * patch_size);
 
             for (int y = 0; y < patch_size; ++y) {
-                for (int x = 0; x < patch_size; ++x) {
-                    for (int c = 0; c < 3; ++c) {
-                        int src_y = h * patch_size + y;
-                        int src_x = w * patch_size + x;
-                        int src_idx = (src_y * width + src_x) * 3 + c;
-                        int dst_idx = (y * patch_size + x) * 3 + c;
-                        patch.buf[dst_idx] = resized_image.buf[src_idx];
-                    }
-                }
+                int src_y = h * patch_size + y;
+                std::memcpy(patch.buf.data() + y * patch_size * 3,
+                            resized_image.buf.data() + (src_y * width + w * patch_size) * 3,
+                            patch_size * 3);
             }
             patches.push_back(patch);
         }
@@ -65,9 +65,12 @@ public:
     // Tensor produced by infer is stored in the request and used further in the pipeline, so we can't free it right after infer call
     std::unique_ptr<CircularBufferQueue<EmbeddingsRequest>>& get_request_queue();
     ov::Tensor infer(EmbeddingsRequest& req, const ov::Tensor& input_idx, bool return_remote_tensor=false);
+    // The model with the embedding postprocessing merged, e.g. to merge it into the language model in turn
+    std::shared_ptr<ov::Model> get_model() const;
 private:
     void merge_postprocess(std::shared_ptr<ov::Model> model, float scale_emb) const;
 
+    std::shared_ptr<ov::Model> m_model;
     std::unique_ptr<CircularBufferQueue<EmbeddingsRequest>> m_embeddings_requests_queue;
 };
 
@@ -72,17 +72,10 @@ bool InputsEmbedderGemma3::has_token_type_ids() const {
 }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedderGemma3::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> embeds;
-
     ov::AnyMap vision_config = {{"patch_size", m_vlm_config.vision_config_patch_size}};
 
     std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
-    embeds.reserve(single_images.size());
-    for (const ov::Tensor& image : single_images) {
-        embeds.emplace_back(m_vision_encoder->encode(image, vision_config));
-    }
-    
-    return embeds;
+    return encode_image_batch(single_images, vision_config);
 }
 
 std::pair<std::string, std::vector<size_t>> InputsEmbedderGemma3::normalize_prompt(const std::string& prompt, size_t base_id, const std::vector<EncodedImage>& images) const {
@@ -4,6 +4,8 @@
 #include "openvino/genai/visual_language/perf_metrics.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
+#include <numeric>
+
 #include "visual_language/clip.hpp"
 #include "visual_language/vision_encoder.hpp"
 #include "visual_language/embedding_model.hpp"
@@ -165,12 +167,46 @@ std::vector<ov::Tensor> InputsEmbedder::IInputsEmbedder::to_single_image_tensors
 }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedder::IInputsEmbedder::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> embeds;
-    std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
-    for (const ov::Tensor& image : single_images) {
-        embeds.emplace_back(m_vision_encoder->encode(image));
+    return encode_image_batch(to_single_image_tensors(images));
+}
+
+std::vector<ov::genai::EncodedImage> InputsEmbedder::IInputsEmbedder::encode_videos(const std::vector<ov::Tensor>& videos) {
+    std::vector<EncodedImage> encoded_videos;
+    encoded_videos.reserve(videos.size());
+    for (const ov::Tensor& video : videos) {
+        encoded_videos.push_back(m_vision_encoder->encode_video(video));
+    }
+    return encoded_videos;
+}
+
+std::vector<EncodedImage> InputsEmbedder::IInputsEmbedder::encode_image_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map) {
+    if (images.empty()) {
+        return {};
+    }
+    if (!m_vision_embedding_cache) {
+        return m_vision_encoder->encode_batch(images, config_map);
+    }
+    std::vector<EncodedImage> encoded_images(images.size());
+    std::vector<ImageContentHash> hashes(images.size());
+    std::vector<size_t> uncached_ids;
+    std::vector<ov::Tensor> uncached_images;
+    for (size_t image_id = 0; image_id < images.size(); ++image_id) {
+        hashes[image_id] = hash_image(images[image_id], config_map);
+        if (std::optional<EncodedImage> cached = m_vision_embedding_cache->get(hashes[image_id])) {
+            encoded_images[image_id] = std::move(*cached);
+        } else {
+            uncached_ids.push_back(image_id);
+            uncached_images.push_back(images[image_id]);
+        }
+    }
+    if (!uncached_images.empty()) {
+        std::vector<EncodedImage> uncached_encoded_images = m_vision_encoder->encode_batch(uncached_images, config_map);
+        for (size_t idx = 0; idx < uncached_ids.size(); ++idx) {
+            m_vision_embedding_cache->add(hashes[uncached_ids[idx]], uncached_encoded_images[idx]);
+            encoded_images[uncached_ids[idx]] = std::move(uncached_encoded_images[idx]);
+        }
     }
-    return embeds;
+    return encoded_images;
 }
 
 ov::Tensor InputsEmbedder::IInputsEmbedder::get_inputs_embeds(const std::string& prompt, const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics, const std::vector<size_t>& image_sequence) {
@@ -198,9 +234,38 @@ bool InputsEmbedder::IInputsEmbedder::has_token_type_ids() const { return false;
 
 /// Public InputsEmbedder class
 
+namespace {
+// removes the property of the embedder, so that the rest is passed to the models
+size_t extract_vision_embedding_cache_size(ov::AnyMap& device_config) {
+    auto it = device_config.find(ov::genai::vision_embedding_cache_size.name());
+    if (it == device_config.end()) {
+        return 0;
+    }
+    // python integers are passed as int64_t
+    const size_t max_byte_size = it->second.is<int64_t>() ? static_cast<size_t>(it->second.as<int64_t>()) : it->second.as<size_t>();
+    device_config.erase(it);
+    return max_byte_size;
+}
+
+float extract_visual_token_keep_ratio(ov::AnyMap& device_config) {
+    auto it = device_config.find(ov::genai::visual_token_keep_ratio.name());
+    if (it == device_config.end()) {
+        return 1.0f;
+    }
+    const float keep_ratio = it->second.is<double>() ? static_cast<float>(it->second.as<double>()) : it->second.as<float>();
+    device_config.erase(it);
+    return keep_ratio;
+}
+}  // namespace
+
 InputsEmbedder::InputsEmbedder(const std::filesystem::path& model_dir,
                                const std::string& device,
-                               const ov::AnyMap device_config) {
+                               ov::AnyMap device_config) {
+    const size_t vision_embedding_cache_size = extract_vision_embedding_cache_size(device_config);
+    const float visual_token_keep_ratio = extract_visual_token_keep_ratio(device_config);
+    // the options of the pipeline using the embedder
+    device_config.erase(ov::genai::overlap_vision_encoding.name());
+    device_config.erase(ov::genai::embeddings_lookup_in_model.name());
     auto vlm_config = utils::from_config_json_if_exists<VLMConfig>(model_dir, "config.json");
 
     if (vlm_config.model_type == VLMModelType::MINICPM) {
@@ -224,13 +289,20 @@ InputsEmbedder::InputsEmbedder(const std::filesystem::path& model_dir,
     } else {
         OPENVINO_THROW("Unsupported model type in VLM InputsEmbedder class. Please, create feature request on new model support");
     }
+    m_impl->set_vision_embedding_cache_size(vision_embedding_cache_size);
+    m_impl->set_visual_token_keep_ratio(visual_token_keep_ratio);
 }
 
 InputsEmbedder::InputsEmbedder(const ModelsMap& models_map,
                                const Tokenizer& tokenizer,
                                const std::filesystem::path& config_dir_path,
                                const std::string& device,
-                               const ov::AnyMap device_config) {
+                               ov::AnyMap device_config) {
+    const size_t vision_embedding_cache_size = extract_vision_embedding_cache_size(device_config);
+    const float visual_token_keep_ratio = extract_visual_token_keep_ratio(device_config);
+    // the options of the pipeline using the embedder
+    device_config.erase(ov::genai::overlap_vision_encoding.name());
+    device_config.erase(ov::genai::embeddings_lookup_in_model.name());
     auto vlm_config = utils::from_config_json_if_exists<VLMConfig>(config_dir_path, "config.json");
 
     if (vlm_config.model_type == VLMModelType::MINICPM) {
@@ -254,6 +326,8 @@ InputsEmbedder::InputsEmbedder(const ModelsMap& models_map,
     } else {
         OPENVINO_THROW("Unsupported model type in VLM InputsEmbedder class. Please, create feature request on new model support");
     }
+    m_impl->set_vision_embedding_cache_size(vision_embedding_cache_size);
+    m_impl->set_visual_token_keep_ratio(visual_token_keep_ratio);
 }
 
 ov::Tensor InputsEmbedder::get_inputs_embeds(const std::string& prompt, const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics, const std::vector<size_t>& image_sequence) {
@@ -291,6 +365,53 @@ std::vector<ov::genai::EncodedImage> InputsEmbedder::encode_images(const std::ve
     return m_impl->encode_images(images);
 }
 
+std::vector<ov::genai::EncodedImage> InputsEmbedder::encode_images(const std::vector<ov::Tensor>& images, VLMPerfMetrics& metrics, const std::vector<ov::Tensor>& videos) {
+    std::vector<EncodedImage> encoded_images = m_impl->encode_images(images);
+    if (m_impl->has_vision_embedding_cache()) {
+        for (const EncodedImage& encoded_image : encoded_images) {
+            ++(encoded_image.is_cached ? metrics.vlm_raw_metrics.vision_embedding_cache_hits : metrics.vlm_raw_metrics.vision_embedding_cache_misses);
+        }
+    }
+    std::vector<EncodedImage> encoded_videos = m_impl->encode_videos(videos);
+    encoded_images.insert(encoded_images.end(), std::make_move_iterator(encoded_videos.begin()), std::make_move_iterator(encoded_videos.end()));
+    return encoded_images;
+}
+
+std::vector<std::vector<ov::genai::EncodedImage>> InputsEmbedder::encode_images(const std::vector<std::vector<ov::Tensor>>& images_per_prompt, std::vector<VLMPerfMetrics>& metrics, const std::vector<std::vector<ov::Tensor>>& videos_per_prompt) {
+    OPENVINO_ASSERT(images_per_prompt.size() == metrics.size(), "Number of images vectors should be equal to the number of metrics.");
+    OPENVINO_ASSERT(videos_per_prompt.empty() || videos_per_prompt.size() == images_per_prompt.size(), "Number of videos vectors should be equal to the number of images vectors.");
+    std::vector<ov::Tensor> images;
+    // images of [NHWC] layout are encoded as N images
+    std::vector<size_t> num_single_images(images_per_prompt.size(), 0);
+    for (size_t prompt_id = 0; prompt_id < images_per_prompt.size(); ++prompt_id) {
+        for (const ov::Tensor& image : images_per_prompt[prompt_id]) {
+            images.push_back(image);
+            num_single_images[prompt_id] += image.get_shape().size() == 4 ? image.get_shape().at(0) : 1;
+        }
+    }
+    std::vector<EncodedImage> encoded_images = m_impl->encode_images(images);
+    OPENVINO_ASSERT(encoded_images.size() == std::accumulate(num_single_images.begin(), num_single_images.end(), size_t(0)));
+
+    std::vector<std::vector<EncodedImage>> encoded_images_per_prompt(images_per_prompt.size());
+    auto encoded_image_it = encoded_images.begin();
+    for (size_t prompt_id = 0; prompt_id < images_per_prompt.size(); ++prompt_id) {
+        auto prompt_end = encoded_image_it + num_single_images[prompt_id];
+        if (m_impl->has_vision_embedding_cache()) {
+            for (auto it = encoded_image_it; it != prompt_end; ++it) {
+                ++(it->is_cached ? metrics[prompt_id].vlm_raw_metrics.vision_embedding_cache_hits : metrics[prompt_id].vlm_raw_metrics.vision_embedding_cache_misses);
+            }
+        }
+        encoded_images_per_prompt[prompt_id].assign(std::make_move_iterator(encoded_image_it), std::make_move_iterator(prompt_end));
+        encoded_image_it = prompt_end;
+        if (!videos_per_prompt.empty()) {
+            std::vector<EncodedImage> encoded_videos = m_impl->encode_videos(videos_per_prompt[prompt_id]);
+            encoded_images_per_prompt[prompt_id].insert(encoded_images_per_prompt[prompt_id].end(),
+                std::make_move_iterator(encoded_videos.begin()), std::make_move_iterator(encoded_videos.end()));
+        }
+    }
+    return encoded_images_per_prompt;
+}
+
 std::pair<ov::Tensor, std::optional<int64_t>> InputsEmbedder::get_position_ids(const size_t inputs_embeds_size, const size_t history_size) {
     return m_impl->get_position_ids(inputs_embeds_size, history_size);
 }
@@ -323,6 +444,10 @@ void InputsEmbedder::finish_chat() {
     return m_impl->finish_chat();
 }
 
+size_t InputsEmbedder::get_vision_embedding_cache_byte_size() const {
+    return m_impl->get_vision_embedding_cache_byte_size();
+}
+
 std::pair<std::string, std::vector<size_t>> InputsEmbedder::normalize_prompt(
     const std::string& prompt,
     size_t base_id,
@@ -17,6 +17,7 @@
 #include "visual_language/vlm_config.hpp"
 #include "visual_language/embedding_model.hpp"
 #include "visual_language/vision_encoder.hpp"
+#include "visual_language/vision_embedding_cache.hpp"
 
 namespace ov::genai {
 struct VLMPerfMetrics;
@@ -24,15 +25,17 @@ const static std::regex UNIVERSAL_PATTERN{R"(<ov_genai_image_(\d+)>)"};
 
 class InputsEmbedder {
 public:
+    // device_config may contain ov::genai::vision_embedding_cache_size and ov::genai::visual_token_keep_ratio, which aren't
+    // passed to the models
     InputsEmbedder(const std::filesystem::path& model_dir,
                    const std::string& device,
-                   const ov::AnyMap device_config);
+                   ov::AnyMap device_config);
 
     InputsEmbedder(const ModelsMap& models_map,
                    const Tokenizer& tokenizer,
                    const std::filesystem::path& config_dir_path,
                    const std::string& device,
-                   const ov::AnyMap device_config);
+                   ov::AnyMap device_config);
 
     // compute input embedding for prompt and multiple images
     ov::Tensor get_inputs_embeds(const std::string& prompt, const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics, const std::vector<size_t>& image_sequence);
@@ -48,6 +51,14 @@ public:
     
     std::vector<ov::genai::EncodedImage> encode_images(const std::vector<ov::Tensor>& images);
 
+    // encodes the images and counts the hits and the misses of the vision embedding cache, if enabled,
+    // the videos are encoded after the images
+    std::vector<ov::genai::EncodedImage> encode_images(const std::vector<ov::Tensor>& images, ov::genai::VLMPerfMetrics& metrics, const std::vector<ov::Tensor>& videos = {});
+
+    // encodes the images of all the prompts at once, the metrics of each prompt count its images,
+    // the videos of each prompt, if given, are encoded after its images
+    std::vector<std::vector<ov::genai::EncodedImage>> encode_images(const std::vector<std::vector<ov::Tensor>>& images_per_prompt, std::vector<ov::genai::VLMPerfMetrics>& metrics, const std::vector<std::vector<ov::Tensor>>& videos_per_prompt = {});
+
     // compute position ids for language model input
     std::pair<ov::Tensor, std::optional<int64_t>> get_position_ids(const size_t inputs_embeds_size, const size_t history_size);
 
@@ -72,6 +83,9 @@ public:
     // finishes chat and clears a chat history 
     void finish_chat();
 
+    // the total size of the embeddings in the vision embedding cache, 0 if the cache is disabled
+    size_t get_vision_embedding_cache_byte_size() const;
+
     virtual std::pair<std::string, std::vector<size_t>> normalize_prompt(
         const std::string& prompt,
         size_t base_id,
@@ -103,6 +117,10 @@ private:
         utils::KVCacheState m_kv_cache_state;
         // length of attention_mask/kv cache at the beginning of generation()
         size_t m_prev_hist_length = 0;
+        // the embeddings of the images repeated across the requests, null if disabled
+        std::shared_ptr<VisionEmbeddingCache> m_vision_embedding_cache;
+        // the ratio of the visual tokens kept by the models supporting the token reduction, 1 disables it
+        float m_visual_token_keep_ratio = 1.0f;
         virtual ~IInputsEmbedder() = default;
 
     public:
@@ -117,6 +135,27 @@ private:
         virtual bool has_token_type_ids() const;
 
         virtual std::vector<ov::genai::EncodedImage> encode_images(const std::vector<ov::Tensor>& images);
+
+        // a video is encoded into a single EncodedImage, if the model supports videos
+        std::vector<ov::genai::EncodedImage> encode_videos(const std::vector<ov::Tensor>& videos);
+
+        // 0 disables the cache
+        void set_vision_embedding_cache_size(size_t max_byte_size) {
+            m_vision_embedding_cache = max_byte_size > 0 ? std::make_shared<VisionEmbeddingCache>(max_byte_size) : nullptr;
+        }
+
+        bool has_vision_embedding_cache() const {
+            return m_vision_embedding_cache != nullptr;
+        }
+
+        size_t get_vision_embedding_cache_byte_size() const {
+            return m_vision_embedding_cache ? m_vision_embedding_cache->get_byte_size() : 0;
+        }
+
+        void set_visual_token_keep_ratio(float keep_ratio) {
+            OPENVINO_ASSERT(keep_ratio > 0.0f && keep_ratio <= 1.0f, "visual_token_keep_ratio must be in (0, 1], got ", keep_ratio);
+            m_visual_token_keep_ratio = keep_ratio;
+        }
     
         virtual std::pair<ov::Tensor, std::optional<int64_t>> get_position_ids(const size_t inputs_embeds_size, const size_t history_size);
     
@@ -149,6 +188,9 @@ private:
         ) const = 0;
     
     protected:
+        // encodes the images, which embeddings aren't cached, with the vision encoder at once
+        std::vector<EncodedImage> encode_image_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map = {});
+
         IInputsEmbedder(
             const VLMConfig& vlm_config,
             const std::filesystem::path& model_dir,
@@ -17,6 +17,8 @@ public:
     using VisionEncoder::VisionEncoder;
 
     EncodedImage encode(const ov::Tensor& image, const ov::AnyMap& config_map) override;
+
+    std::vector<EncodedImage> encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map) override;
 };
 
 class InputsEmbedderInternVLChat : public InputsEmbedder::IInputsEmbedder {
@@ -37,6 +39,8 @@ public:
 
     ov::Tensor get_inputs_embeds(const std::string& prompt, const std::vector<ov::genai::EncodedImage>& images, ov::genai::VLMPerfMetrics& metrics, bool recalculate_merged_embeddings = true, const std::vector<size_t>& image_sequence = {}) override;
 
+    std::vector<ov::genai::EncodedImage> encode_images(const std::vector<ov::Tensor>& images) override;
+
     std::pair<std::string, std::vector<size_t>> normalize_prompt(
         const std::string& prompt,
         size_t base_id,
@@ -4,6 +4,7 @@
 #include "visual_language/llava/classes.hpp"
 
 #include "visual_language/clip.hpp"
+#include "visual_language/visual_token_reduction.hpp"
 
 #include "utils.hpp"
 
@@ -58,22 +59,29 @@ ov::Tensor get_pixel_values_llava(const ov::Tensor& image, const ProcessorConfig
 } // namespace
 
 EncodedImage VisionEncoderLLaVA::encode( const ov::Tensor& image, const ov::AnyMap& config_map) {
+    return encode_batch({image}, config_map).at(0);
+}
+
+std::vector<EncodedImage> VisionEncoderLLaVA::encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map) {
     CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_vision_encoder.get());
     ov::InferRequest& encoder = infer_request_guard.get();
     ProcessorConfig config = utils::from_any_map(config_map, m_processor_config);
 
-    ov::Tensor pixel_values = get_pixel_values_llava(image, config);
-
-    encoder.set_tensor("pixel_values", pixel_values);
-    encoder.infer();
-
-    const ov::Tensor& infer_output = encoder.get_output_tensor();
-    ov::Tensor image_features(infer_output.get_element_type(), infer_output.get_shape());
-    std::memcpy(image_features.data(), infer_output.data(), infer_output.get_byte_size());
+    std::vector<ov::Tensor> pixel_values;
+    pixel_values.reserve(images.size());
+    for (const ov::Tensor& image : images) {
+        pixel_values.push_back(get_pixel_values_llava(image, config));
+    }
+    std::vector<ov::Tensor> images_features = infer_batched(encoder, pixel_values);
 
     ImageSize resized_source_size{config.crop_size_height / config.patch_size, config.crop_size_width / config.patch_size};
 
-    return {std::move(image_features), resized_source_size};
+    std::vector<EncodedImage> encoded_images;
+    encoded_images.reserve(images.size());
+    for (ov::Tensor& image_features : images_features) {
+        encoded_images.push_back({std::move(image_features), resized_source_size});
+    }
+    return encoded_images;
 }
 
 InputsEmbedderLLaVA::InputsEmbedderLLaVA(
@@ -93,14 +101,16 @@ InputsEmbedderLLaVA::InputsEmbedderLLaVA(
     IInputsEmbedder(vlm_config, models_map, tokenizer, config_dir_path, device, device_config) { }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedderLLaVA::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> embeds;
     ov::AnyMap vision_config = {{"patch_size", m_vlm_config.vision_config_patch_size}};
     std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
-    embeds.reserve(single_images.size());
-    for (const ov::Tensor& image : single_images) {
-        embeds.emplace_back(m_vision_encoder->encode(image, vision_config));
+    std::vector<EncodedImage> encoded_images = encode_image_batch(single_images, vision_config);
+    // the cached embeddings are shared, so the tokens are reduced into a new tensor
+    if (m_visual_token_keep_ratio < 1.0f) {
+        for (EncodedImage& encoded_image : encoded_images) {
+            encoded_image.resized_source = reduce_visual_tokens(encoded_image.resized_source, m_visual_token_keep_ratio);
+        }
     }
-    return embeds;
+    return encoded_images;
 }
 
 std::pair<std::string, std::vector<size_t>> InputsEmbedderLLaVA::normalize_prompt(const std::string& prompt, size_t base_id, const std::vector<EncodedImage>& images) const {
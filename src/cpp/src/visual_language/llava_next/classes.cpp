@@ -5,6 +5,7 @@
 #include "visual_language/llava_next/classes.hpp"
 
 #include "visual_language/clip.hpp"
+#include "visual_language/visual_token_reduction.hpp"
 
 #include "utils.hpp"
 
@@ -50,33 +51,39 @@ ov::Tensor get_pixel_values_llava_next(const ov::Tensor& image, const ProcessorC
 } // namespace
 
 EncodedImage VisionEncoderLLaVANext::encode(const ov::Tensor& image, const ov::AnyMap& config_map) {
+    return encode_batch({image}, config_map).at(0);
+}
+
+std::vector<EncodedImage> VisionEncoderLLaVANext::encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map) {
     CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_vision_encoder.get());
     ov::InferRequest& encoder = infer_request_guard.get();
     ProcessorConfig config = utils::from_any_map(config_map, m_processor_config);
 
-    ov::Tensor pixel_values = get_pixel_values_llava_next(image, config);
-
-    encoder.set_tensor("pixel_values", pixel_values);
-    encoder.infer();
-
-    const ov::Tensor& infer_output = encoder.get_output_tensor();
-    ov::Tensor image_features(infer_output.get_element_type(), infer_output.get_shape());
-    std::memcpy(image_features.data(), infer_output.data(), infer_output.get_byte_size());
+    // the patches of all the images are encoded at once
+    std::vector<ov::Tensor> pixel_values;
+    pixel_values.reserve(images.size());
+    for (const ov::Tensor& image : images) {
+        pixel_values.push_back(get_pixel_values_llava_next(image, config));
+    }
+    std::vector<ov::Tensor> images_features = infer_batched(encoder, pixel_values);
 
     ImageSize resized_source_size{config.crop_size_height / config.patch_size, config.crop_size_width / config.patch_size};
 
-    // Gen number of patches
-    ImageSize original_image_size{image.get_shape().at(1), image.get_shape().at(2)};
-    auto best_resolution = select_best_resolution({original_image_size.width, original_image_size.height}, config.image_grid_pinpoints);
-    int num_patches_w = best_resolution.first / config.size_shortest_edge;
-    int num_patches_h = best_resolution.second / config.size_shortest_edge;
-
-    EncodedImage encoded_image;
-    encoded_image.resized_source = std::move(image_features);
-    encoded_image.resized_source_size = resized_source_size;
-    encoded_image.patches_grid = {num_patches_h, num_patches_w};
-    encoded_image.original_image_size = original_image_size;
-    return encoded_image;
+    std::vector<EncodedImage> encoded_images(images.size());
+    for (size_t image_idx = 0; image_idx < images.size(); ++image_idx) {
+        // Gen number of patches
+        ImageSize original_image_size{images[image_idx].get_shape().at(1), images[image_idx].get_shape().at(2)};
+        auto best_resolution = select_best_resolution({original_image_size.width, original_image_size.height}, config.image_grid_pinpoints);
+        int num_patches_w = best_resolution.first / config.size_shortest_edge;
+        int num_patches_h = best_resolution.second / config.size_shortest_edge;
+
+        EncodedImage& encoded_image = encoded_images[image_idx];
+        encoded_image.resized_source = std::move(images_features[image_idx]);
+        encoded_image.resized_source_size = resized_source_size;
+        encoded_image.patches_grid = {num_patches_h, num_patches_w};
+        encoded_image.original_image_size = original_image_size;
+    }
+    return encoded_images;
 }
 
 namespace {
@@ -259,11 +266,13 @@ ov::Tensor add_image_newline(const ov::Tensor& image_feature, const ov::Tensor&
  * @param encoded_image An encoded image retrieved from vision encoder
  * @param original_image_size A size of the original image
  * @param image_newline An image newline tensor with a shape (embed_dim)
+ * @param keep_ratio A ratio of the kept tokens, the newline tokens are never merged, see reduce_visual_tokens()
  * @return A tensor with a shape (1, new_seq_len, embed_dim)
  */
 ov::Tensor pack_image_features_llava_next(
     const EncodedImage& encoded_image,
-    const ov::Tensor& image_newline) {
+    const ov::Tensor& image_newline,
+    float keep_ratio) {
     auto image_feature = encoded_image.resized_source;
     auto image_feature_shape = image_feature.get_shape();
     size_t num_patches = image_feature_shape[0];
@@ -315,7 +324,7 @@ ov::Tensor pack_image_features_llava_next(
         std::copy(processed_data,
                 processed_data + processed_shape[0] * embed_dim,
                 result.data<float>() + base_shape[1] * embed_dim);
-        return result;
+        return keep_ratio < 1.0f ? reduce_visual_tokens(result, keep_ratio, newline_data) : result;
     } else {
         // If there is only one patch, return the original (base) image feature concatenated with image_newline
         ov::Tensor result(image_feature.get_element_type(), {1, patch_seq_len + 1, embed_dim});
@@ -327,20 +336,16 @@ ov::Tensor pack_image_features_llava_next(
         std::copy(newline_data,
                 newline_data + embed_dim,
                 result.data<float>() + patch_seq_len * embed_dim);
-        return result;
+        return keep_ratio < 1.0f ? reduce_visual_tokens(result, keep_ratio, newline_data) : result;
     }
 }
 
 } // namespace
 
 std::vector<ov::genai::EncodedImage> InputsEmbedderLLaVANext::encode_images(const std::vector<ov::Tensor>& images) {
-    std::vector<EncodedImage> embeds;
     ov::AnyMap vision_config = {{"patch_size", m_vlm_config.vision_config_patch_size}};
     std::vector<ov::Tensor> single_images = to_single_image_tensors(images);
-    for (const ov::Tensor& image : single_images) {
-        embeds.emplace_back(m_vision_encoder->encode(image, vision_config));
-    }
-    return embeds;
+    return encode_image_batch(single_images, vision_config);
 }
 
 std::pair<std::string, std::vector<size_t>> InputsEmbedderLLaVANext::normalize_prompt(const std::string& prompt, size_t base_id, const std::vector<EncodedImage>& images) const {
@@ -359,7 +364,7 @@ std::pair<std::string, std::vector<size_t>> InputsEmbedderLLaVANext::normalize_p
             std::copy(m_vlm_config.image_newline.begin(), m_vlm_config.image_newline.end(), image_newline_data);
         }
 
-        image_embeds.push_back(pack_image_features_llava_next(encoded_image, image_newline));
+        image_embeds.push_back(pack_image_features_llava_next(encoded_image, image_newline, m_visual_token_keep_ratio));
         std::string expanded_tag;
         for (size_t idx = 0; idx < image_embeds.back().get_shape().at(1); ++idx) {
             expanded_tag += image_token;
@@ -389,7 +394,7 @@ ov::Tensor InputsEmbedderLLaVANext::get_inputs_embeds(const std::string& unified
             std::copy(m_vlm_config.image_newline.begin(), m_vlm_config.image_newline.end(), image_newline_data);
         }
 
-        image_embeds.push_back(pack_image_features_llava_next(encoded_image, image_newline));
+        image_embeds.push_back(pack_image_features_llava_next(encoded_image, image_newline, m_visual_token_keep_ratio));
     }
     
     ov::Tensor input_ids = get_encoded_input_ids(unified_prompt, metrics);
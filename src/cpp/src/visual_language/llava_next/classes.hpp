@@ -16,6 +16,8 @@ public:
     using VisionEncoder::VisionEncoder;
 
     EncodedImage encode(const ov::Tensor& image, const ov::AnyMap& config_map) override;
+
+    std::vector<EncodedImage> encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map) override;
 };
 
 class InputsEmbedderLLaVANext : public InputsEmbedderLLaVA {
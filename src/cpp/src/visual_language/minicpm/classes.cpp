@@ -136,13 +136,9 @@ std::vector<std::vector<clip_image_u8>> slice_image(const clip_image_u8& img, co
                 patch.ny = grid_y;
                 patch.buf.resize(3 * patch.nx * patch.ny);
                 for (int y = patches_i; y < patches_i + grid_y; ++y) {
-                    for (int x = patches_j; x < patches_j + grid_x; ++x) {
-                        const int i = 3 * (y * refine_image.nx + x);
-                        const int j = 3 * ((y - patches_i) * patch.nx + (x - patches_j));
-                        patch.buf[j] = refine_image.buf[i];
-                        patch.buf[j + 1] = refine_image.buf[i + 1];
-                        patch.buf[j + 2] = refine_image.buf[i + 2];
-                    }
+                    std::memcpy(patch.buf.data() + 3 * (y - patches_i) * patch.nx,
+                                refine_image.buf.data() + 3 * (y * refine_image.nx + patches_j),
+                                3 * patch.nx);
                 }
             }
         }
@@ -466,127 +462,22 @@ ResampledImage VisionEncoderMiniCPM::resample_encoded_image(const EncodedImage&
 
 namespace {
 
-ov::Tensor concatenate_last_dim(const ov::Tensor& first, const ov::Tensor& second) {
-    size_t res_d_0 = first.get_shape().at(0);
-    size_t res_d_1 = first.get_shape().at(1);
-    OPENVINO_ASSERT(second.get_shape().at(0) == res_d_0);
-    OPENVINO_ASSERT(second.get_shape().at(1) == res_d_1);
-    size_t res_d_2 = first.get_shape().at(2) + second.get_shape().at(2);
-    ov::Tensor res{first.get_element_type(), {res_d_0, res_d_1, res_d_2}};
-    auto first_data = first.data<float>();
-    auto second_data = second.data<float>();
-    float* res_data = res.data<float>();
-    for (size_t i = 0; i < res_d_0; ++i) {
-        for (size_t j = 0; j < res_d_1; ++j) {
-            size_t k = 0;
-            for (; k < first.get_shape().at(2); ++k) {
-                res_data[i * res_d_1 * res_d_2 + j * res_d_2 + k]
-                    = first_data[i * res_d_1 * first.get_shape().at(2) + j * first.get_shape().at(2) + k];
-            }
-            for (size_t l = 0; l < second.get_shape().at(2); ++l, ++k) {
-                res_data[i * res_d_1 * res_d_2 + j * res_d_2 + k]
-                    = second_data[i * res_d_1 * second.get_shape().at(2) + j * second.get_shape().at(2) + l];
-            }
-        }
-    }
-    return res;
-}
-
-/// embed_dim: output dimension for each position
-/// pos: a list of positions to be encoded: size (H, W)
-/// out: (H, W, D)
-ov::Tensor get_1d_sincos_pos_embed_from_grid_new(size_t embed_dim, const ov::Tensor& pos) {
-    OPENVINO_ASSERT(embed_dim % 2 == 0);
-    ov::Shape pos_shape = pos.get_shape();
-    size_t H = pos_shape[0];
-    size_t W = pos_shape[1];
-
-    std::vector<float> omega(embed_dim / 2);
+/// The row of a position of an axis is its 1d sincos embedding [sin(omega * pos), cos(omega * pos)] of embed_dim / 2
+/// floats, the 2d embedding of the grid position (h, w) is the row of w followed by the row of h.
+std::unique_ptr<PositionEmbeddingTable> create_2d_sincos_pos_embed_table(size_t embed_dim) {
+    OPENVINO_ASSERT(embed_dim % 4 == 0);
+    const size_t row_size = embed_dim / 2;
+    std::vector<float> omega(row_size / 2);
     for (size_t i = 0; i < omega.size(); ++i) {
-        omega[i] = 1.0f / std::pow(10000.0f, float(i) / (embed_dim / 2));
+        omega[i] = 1.0f / std::pow(10000.0f, float(i) / (row_size / 2));
     }
-
-    std::vector<size_t> out_shape = {H, W, embed_dim};
-    ov::Tensor emb(ov::element::f32, out_shape);
-
-    auto pos_data = pos.data<float>();
-    auto emb_data = emb.data<float>();
-
-    size_t counter = 0;
-    for (size_t h = 0; h < H; ++h) {
-        for (size_t w = 0; w < W; ++w) {
-            for (size_t d = 0; d < embed_dim / 2; ++d) {
-                // Correctly access the 2D position grid
-                float value = omega[d] * pos_data[h * W + w];
-                emb_data[h * W * embed_dim + w * embed_dim + d] = std::sin(value);
-                emb_data[h * W * embed_dim + w * embed_dim + d + (embed_dim / 2)] = std::cos(value);
-            }
+    return std::make_unique<PositionEmbeddingTable>(row_size, [omega](size_t position, float* row) {
+        for (size_t d = 0; d < omega.size(); ++d) {
+            float value = omega[d] * static_cast<float>(position);
+            row[d] = std::sin(value);
+            row[d + omega.size()] = std::cos(value);
         }
-    }
-    return emb;
-}
-
-ov::Tensor get_2d_sincos_pos_embed_from_grid(size_t embed_dim, const ov::Tensor& grid) {
-    OPENVINO_ASSERT(embed_dim % 2 == 0);
-    ov::Shape grid_shape = grid.get_shape();
-    auto grid_data = grid.data<float>();
-    ov::Shape plane_shape{grid_shape.at(1), grid_shape.at(2)};
-    ov::Tensor emb_h = get_1d_sincos_pos_embed_from_grid_new(embed_dim / 2, ov::Tensor{
-        ov::element::f32,
-        plane_shape,
-        grid_data
-    });  // (H, W, D/2)
-    ov::Tensor emb_w = get_1d_sincos_pos_embed_from_grid_new(embed_dim / 2, ov::Tensor{
-        ov::element::f32,
-        plane_shape,
-        grid_data + plane_shape.at(0) * plane_shape.at(1)
-    });  // (H, W, D/2)
-    return concatenate_last_dim(emb_h, emb_w);
-}
-
-/// image_size: image_size or (image_height, image_width)
-/// return:
-/// pos_embed: [image_height, image_width, embed_dim]
-ov::Tensor get_2d_sincos_pos_embed(size_t embed_dim, const ImageSize& image_size) {
-    size_t grid_h_size = image_size.height, grid_w_size = image_size.width;
-    ov::Tensor grid(ov::element::f32, {2, grid_h_size, grid_w_size});
-    float* data = grid.data<float>();
-    for (size_t y = 0; y < grid_h_size; ++y) {
-        std::iota(data, data + grid_w_size, 0.0f);
-        data += grid_w_size;
-    }
-    for (float y = 0.0f; y < grid_h_size; ++y) {
-        std::fill(data, data + grid_w_size, y);
-        data += grid_w_size;
-    }
-    return get_2d_sincos_pos_embed_from_grid(embed_dim, grid);
-}
-
-void adjust_pos_cache(
-    const std::vector<ImageSize>& target_sizes,
-    size_t hidden_size,
-    ov::Tensor& pos_embed_cache) {
-    size_t max_h = std::max_element(target_sizes.begin(), target_sizes.end(), [](const ImageSize& left, const ImageSize& right) {
-        return left.height < right.height;
-    })->height;
-    size_t max_w = std::max_element(target_sizes.begin(), target_sizes.end(), [](const ImageSize& left, const ImageSize& right) {
-        return left.width < right.width;
-    })->width;
-    size_t allocated_height, allocated_width;
-    if (pos_embed_cache) {
-        const ov::Shape& allocated_shape = pos_embed_cache.get_shape();
-        allocated_height = allocated_shape.at(0);
-        allocated_width = allocated_shape.at(1);
-    } else {
-        allocated_height = allocated_width = 70;
-    }
-    if (max_h > allocated_height || max_w > allocated_width) {
-        allocated_height = std::max(max_h, allocated_height);
-        allocated_width = std::max(max_w, allocated_width);
-        pos_embed_cache = get_2d_sincos_pos_embed(
-            hidden_size, {allocated_height, allocated_width}
-        );
-    }
+    });
 }
 
 } // namespace
@@ -703,30 +594,27 @@ ov::Tensor VisionEncoderMiniCPM::resample(const ov::Tensor& encoded_image, const
     std::transform(target_sizes.begin(), target_sizes.end(), patch_len.begin(), [](const ImageSize& height_width) {
         return height_width.height * height_width.width;
     });
-    adjust_pos_cache(
-        target_sizes,
-        m_vlm_config.hidden_size,
-        m_pos_embed_cache
-    );
+    size_t max_grid_size = 0;
+    for (const ImageSize& target_size : target_sizes) {
+        max_grid_size = std::max({max_grid_size, target_size.height, target_size.width});
+    }
+    const std::shared_ptr<const std::vector<float>> pos_embed_rows = m_pos_embed_table->get(max_grid_size);
+    const float* rows_data = pos_embed_rows->data();
+    const size_t row_size = m_pos_embed_table->get_row_size();
     size_t max_patch_len = *std::max_element(patch_len.begin(), patch_len.end());
     ov::Tensor key_padding_mask(ov::element::f32, {bs, max_patch_len});
     float* mask_data = key_padding_mask.data<float>();
-    size_t embed_len = m_pos_embed_cache.get_shape().at(2);
+    size_t embed_len = 2 * row_size;
     ov::Tensor pos_embed(ov::element::f32, {max_patch_len, bs, embed_len});  // BLD => L * B * D
     float* pos_embed_data = pos_embed.data<float>();
-    float* cache_data = m_pos_embed_cache.data<float>();
-    size_t _d0 = m_pos_embed_cache.get_shape().at(0);
-    size_t _d1 = m_pos_embed_cache.get_shape().at(1);
     for (size_t i = 0; i < bs; ++i) {
         size_t target_h = target_sizes.at(i).height;
         size_t target_w = target_sizes.at(i).width;
         for (size_t h_idx = 0; h_idx < target_h; ++h_idx) {
             for (size_t w_idx = 0; w_idx < target_w; ++w_idx) {
-                std::copy_n(
-                    cache_data + (h_idx * _d1 + w_idx) * embed_len,
-                    embed_len,
-                    pos_embed_data + (h_idx * target_w + w_idx) * bs * embed_len + i * embed_len
-                );
+                float* token_pos_embed = pos_embed_data + (h_idx * target_w + w_idx) * bs * embed_len + i * embed_len;
+                std::copy_n(rows_data + w_idx * row_size, row_size, token_pos_embed);
+                std::copy_n(rows_data + h_idx * row_size, row_size, token_pos_embed + row_size);
             }
         }
         for (size_t flat = target_h * target_w; flat < max_patch_len; ++flat) {
@@ -761,7 +649,7 @@ VisionEncoderMiniCPM::VisionEncoderMiniCPM(
         [&compiled_model]() -> ov::InferRequest {
             return compiled_model.create_infer_request();
         }); 
-    m_pos_embed_cache = get_2d_sincos_pos_embed(m_vlm_config.hidden_size, {70, 70});
+    m_pos_embed_table = create_2d_sincos_pos_embed_table(m_vlm_config.hidden_size);
 }
 
 VisionEncoderMiniCPM::VisionEncoderMiniCPM(
@@ -779,7 +667,7 @@ VisionEncoderMiniCPM::VisionEncoderMiniCPM(
         [&compiled_model]() -> ov::InferRequest {
             return compiled_model.create_infer_request();
         }); 
-    m_pos_embed_cache = get_2d_sincos_pos_embed(m_vlm_config.hidden_size, {70, 70});
+    m_pos_embed_table = create_2d_sincos_pos_embed_table(m_vlm_config.hidden_size);
 }
 
 
@@ -9,6 +9,7 @@
 
 #include "visual_language/vision_encoder.hpp"
 #include "visual_language/inputs_embedder.hpp"
+#include "visual_language/position_embedding_table.hpp"
 
 namespace ov::genai {
 
@@ -17,10 +18,9 @@ class VisionEncoderMiniCPM : public VisionEncoder {
     // [N, H*W, old_hidden_size] is the input shape.
     // [N, query_num, hidden_size] is the output shape.
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_resampler;
-    // Precomputed positional embeddings for the resampler.
-    // [70, 70, hidden_size]. 70 is the initial guess of the image
-    // height and width after dividing by patch_size.
-    ov::Tensor m_pos_embed_cache;
+    // Positional embeddings of the resampler computed once for the
+    // image heights and widths seen so far after dividing by patch_size.
+    std::unique_ptr<PositionEmbeddingTable> m_pos_embed_table;
     // VLM config
     VLMConfig m_vlm_config;
 
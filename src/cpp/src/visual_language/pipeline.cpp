@@ -78,11 +78,23 @@ public:
         auto lm_properties = device_propertes.empty()
             ? properties_copy
             : utils::pop_or_default<ov::AnyMap>(device_propertes, device, {});
+        lm_properties.erase(ov::genai::vision_embedding_cache_size.name());
+        lm_properties.erase(ov::genai::visual_token_keep_ratio.name());
+        lm_properties.erase(ov::genai::overlap_vision_encoding.name());
+        lm_properties.erase(ov::genai::embeddings_lookup_in_model.name());
 
+        const std::string embedder_device = m_is_npu ? "CPU" : device;
+        auto embedder_properties = device_propertes.empty()
+            ? properties_copy
+            : utils::pop_or_default<ov::AnyMap>(device_propertes, embedder_device, {});
+        // the vision encoder, the embeddings model and the tokenizer are compiled while the language model is compiled
+        utils::AsyncModelLoad<std::shared_ptr<InputsEmbedder>> inputs_embedder_load("inputs_embedder", [&] {
+            return std::make_shared<InputsEmbedder>(models_dir, embedder_device, embedder_properties);
+        });
+
+        const auto language_model_start_time = std::chrono::steady_clock::now();
         ov::CompiledModel compiled_language_model;
-        auto embedder_device = device;
         if (m_is_npu) {
-            embedder_device = "CPU";
             utils::KVDesc kv_desc;
             // disable chunking as at the moment it is not supported for VLMs
             lm_properties.insert({"NPUW_LLM_PREFILL_HINT", "STATIC"});
@@ -96,12 +108,10 @@ public:
 
         m_language = compiled_language_model.create_infer_request();
         m_language.get_tensor("attention_mask").set_shape({1, 0});
+        m_model_load_times_ms["language_model"] = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - language_model_start_time).count();
 
-        auto embedder_properties = device_propertes.empty()
-            ? properties_copy
-            : utils::pop_or_default<ov::AnyMap>(device_propertes, embedder_device, {});
-
-        m_inputs_embedder = std::make_shared<InputsEmbedder>(models_dir, embedder_device, embedder_properties);
+        m_inputs_embedder = inputs_embedder_load.get(m_model_load_times_ms);
         m_tokenizer = m_inputs_embedder->get_tokenizer();
         m_embedding = m_inputs_embedder->get_embedding_model();
 
@@ -137,8 +147,13 @@ public:
         m_embedding = m_inputs_embedder->get_embedding_model();
 
         auto m_language_pair = utils::get_model_weights_pair(models_map, "language");
+        auto lm_properties = properties;
+        lm_properties.erase(ov::genai::vision_embedding_cache_size.name());
+        lm_properties.erase(ov::genai::visual_token_keep_ratio.name());
+        lm_properties.erase(ov::genai::overlap_vision_encoding.name());
+        lm_properties.erase(ov::genai::embeddings_lookup_in_model.name());
         m_language = utils::singleton_core().compile_model(
-            m_language_pair.first, m_language_pair.second, device, properties
+            m_language_pair.first, m_language_pair.second, device, lm_properties
         ).create_infer_request();
 
         m_language.get_tensor("attention_mask").set_shape({1, 0});
@@ -155,6 +170,7 @@ public:
     VLMDecodedResults generate(
         const std::string& prompt,
         const std::vector<ov::Tensor>& rgbs,
+        const std::vector<ov::Tensor>& videos,
         GenerationConfig generation_config,
         const StreamerVariant& streamer
     ) override {
@@ -186,7 +202,7 @@ public:
                 "Currently only \"num_return_sequences\" equal to 1 is supported for NPU device!");
         }
 
-        const auto encoded_images = m_inputs_embedder->encode_images(rgbs);
+        const auto encoded_images = m_inputs_embedder->encode_images(rgbs, perf_metrics, videos);
         auto [unified_prompt, image_sequence] = m_inputs_embedder->normalize_prompt(prompt, m_image_id, encoded_images);
 
         if (m_is_chat_conversation) {
@@ -292,6 +308,7 @@ public:
         auto& res_raw_counters = decoded.perf_metrics.raw_metrics;
         decoded.perf_metrics.num_input_tokens = prompt_ids.get_size();
         decoded.perf_metrics.load_time = this->get_load_time();
+        decoded.perf_metrics.model_load_times = m_model_load_times_ms;
         res_raw_counters.generate_durations.emplace_back(PerfMetrics::get_microsec(generate_end_time - generate_start_time));
         res_raw_counters.detokenization_durations.emplace_back(PerfMetrics::get_microsec(decode_end_time - decode_start_time));
         res_raw_counters.tokenization_durations.insert(res_raw_counters.tokenization_durations.end(), raw_counters.tokenization_durations.begin(), raw_counters.tokenization_durations.end());
@@ -457,7 +474,7 @@ VLMDecodedResults VLMPipeline::generate(
     const GenerationConfig& generation_config,
     const StreamerVariant& streamer
 ) {
-    return m_pimpl->generate(prompt, rgbs, generation_config, streamer);
+    return m_pimpl->generate(prompt, rgbs, {}, generation_config, streamer);
 }
 
 VLMDecodedResults VLMPipeline::generate(
@@ -466,7 +483,7 @@ VLMDecodedResults VLMPipeline::generate(
     const GenerationConfig& generation_config,
     const StreamerVariant& streamer
 ) {
-    return m_pimpl->generate(prompt, {rgb}, generation_config, streamer);
+    return m_pimpl->generate(prompt, {rgb}, {}, generation_config, streamer);
 }
 
 VLMDecodedResults VLMPipeline::generate(
@@ -500,3 +517,22 @@ GenerationConfig VLMPipeline::get_generation_config() const {
 void VLMPipeline::set_generation_config(const GenerationConfig& new_config) {
     m_pimpl->set_generation_config(new_config);
 }
+
+void VLMPipeline::warmup(const WarmupConfig& config) {
+    const GenerationConfig generation_config = utils::get_warmup_generation_config(get_generation_config(), config.max_new_tokens);
+    std::vector<ov::Tensor> images;
+    if (config.image_size > 0) {
+        ov::Tensor image(ov::element::u8, {1, config.image_size, config.image_size, 3});
+        std::fill_n(image.data<uint8_t>(), image.get_size(), uint8_t{127});
+        images.push_back(image);
+    }
+    for (size_t prompt_length : config.prompt_lengths) {
+        OPENVINO_ASSERT(prompt_length > 0, "WarmupConfig prompt lengths must be positive");
+        // a word per token for the common tokenizers, the image tokens are added to the prompt
+        std::string prompt;
+        for (size_t word = 0; word < prompt_length; ++word) {
+            prompt += word == 0 ? "a" : " a";
+        }
+        m_pimpl->generate(prompt, images, {}, generation_config, std::monostate{});
+    }
+}
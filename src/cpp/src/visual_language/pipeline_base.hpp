@@ -16,6 +16,9 @@ namespace ov::genai {
 class ov::genai::VLMPipeline::VLMPipelineBase {
     // Load pipeline time
     float m_load_time_ms = 0;
+protected:
+    // Load time of each model
+    std::map<std::string, float> m_model_load_times_ms;
 public:
 
     virtual ~VLMPipelineBase() = default;
@@ -23,6 +26,7 @@ public:
     virtual VLMDecodedResults generate(
         const std::string& prompt,
         const std::vector<ov::Tensor>& rgbs,
+        const std::vector<ov::Tensor>& videos,
         GenerationConfig generation_config,
         const StreamerVariant& streamer
     ) = 0;
@@ -52,6 +56,20 @@ public:
             }
         }
 
+        std::vector<ov::Tensor> videos;
+        auto videos_it = config_map.find(ov::genai::videos.name());
+        if (config_map.end() != videos_it) {
+            if (videos_it->second.is<std::vector<ov::Tensor>>()) {
+                videos = videos_it->second.as<std::vector<ov::Tensor>>();
+            }
+            else if (videos_it->second.is<ov::Tensor>()){
+                videos = {videos_it->second.as<ov::Tensor>()};
+            }
+            else {
+                OPENVINO_THROW("Unknown videos type.");
+            }
+        }
+
         ov::genai::OptionalGenerationConfig config_arg = utils::get_config_from_map(config_map);
         GenerationConfig config = (config_arg.has_value()) ? *config_arg : get_generation_config();
         config.update_generation_config(config_map);
@@ -59,6 +77,7 @@ public:
         return generate(
             prompt,
             rgbs,
+            videos,
             config,
             utils::get_streamer_from_map(config_map)
         );
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov::genai {
+
+/// @brief Table of the position embeddings of a single axis of the image grid, computed once for the positions up to
+/// the largest requested one. The embeddings of a grid are gathered from the rows of its height and width positions,
+/// so that the images of the seen sizes copy them instead of computing the sines, cosines and powers again. The table
+/// grows into a new buffer, so the returned ones stay valid and immutable.
+class PositionEmbeddingTable {
+public:
+    using ComputeRow = std::function<void(size_t position, float* row)>;
+
+    /// @param compute_row Fills the row_size floats of the embedding of the position.
+    PositionEmbeddingTable(size_t row_size, ComputeRow compute_row) : m_row_size(row_size), m_compute_row(std::move(compute_row)) {}
+
+    /// @return The rows of at least num_positions positions, [num_positions, row_size] floats.
+    std::shared_ptr<const std::vector<float>> get(size_t num_positions) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const size_t num_computed_positions = m_rows ? m_rows->size() / m_row_size : 0;
+        if (num_positions <= num_computed_positions) {
+            return m_rows;
+        }
+        auto rows = std::make_shared<std::vector<float>>(num_positions * m_row_size);
+        if (m_rows) {
+            std::copy(m_rows->begin(), m_rows->end(), rows->begin());
+        }
+        for (size_t position = num_computed_positions; position < num_positions; ++position) {
+            m_compute_row(position, rows->data() + position * m_row_size);
+        }
+        m_rows = rows;
+        return m_rows;
+    }
+
+    size_t get_row_size() const {
+        return m_row_size;
+    }
+
+private:
+    const size_t m_row_size;
+    const ComputeRow m_compute_row;
+    std::mutex m_mutex;
+    std::shared_ptr<std::vector<float>> m_rows;
+};
+
+}  // namespace ov::genai
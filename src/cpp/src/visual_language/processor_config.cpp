@@ -51,6 +51,10 @@ ov::genai::ProcessorConfig::ProcessorConfig(const std::filesystem::path& json_pa
     read_json_param(parsed, "max_pixels", max_pixels);
     read_json_param(parsed, "temporal_patch_size", temporal_patch_size);
     read_json_param(parsed, "merge_size", merge_size);
+    read_json_param(parsed, "video_max_frames", video_max_frames);
+    read_json_param(parsed, "video_max_pixels", video_max_pixels);
+    read_json_param(parsed, "video_max_tokens", video_max_tokens);
+    read_json_param(parsed, "video_frame_difference_threshold", video_frame_difference_threshold);
 
     // Setting gemma3-4b-it config params
     if (parsed.contains("size") && parsed.at("size").contains("height")) {
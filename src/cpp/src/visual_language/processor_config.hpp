@@ -59,6 +59,19 @@ public:
     size_t max_pixels = 12845056;
     size_t temporal_patch_size = 2;
     size_t merge_size = 2;
+    /// @brief Max number of the frames sampled uniformly from a video.
+    /// 0 keeps all the frames.
+    size_t video_max_frames = 32;
+    /// @brief Max number of pixels of a resized video frame, replaces
+    /// max_pixels if smaller.
+    size_t video_max_pixels = 602112;
+    /// @brief Max number of tokens of a video. The frames are resized
+    /// and then fewer frames are sampled to fit. 0 disables the limit.
+    size_t video_max_tokens = 0;
+    /// @brief The groups of temporal_patch_size frames differing from
+    /// the previous kept group by less mean absolute pixel difference
+    /// relative to 255 are dropped. 0 keeps all the frames.
+    float video_frame_difference_threshold = 0.0f;
 
     /// @brief Default constructor
     ProcessorConfig() = default;
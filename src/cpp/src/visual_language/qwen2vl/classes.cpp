@@ -4,7 +4,10 @@
 
 #include "visual_language/qwen2vl/classes.hpp"
 
+#include "openvino/core/parallel.hpp"
+
 #include "visual_language/clip.hpp"
+#include "visual_language/video_sampling.hpp"
 
 #include "utils.hpp"
 #include "visual_language/vl_sdpa_transformations.hpp"
@@ -16,6 +19,22 @@ namespace {
 // Chat template hardcodes char sequence instead of referring to tag values, so NATIVE_TAG is hardcoded as well.
 std::string NATIVE_TAG = "<|vision_start|><|image_pad|><|vision_end|>";
 
+/// The row of a position of an axis is its rotary frequencies [pos * inv_freq] of dim / 2 floats, the rotary embedding
+/// of the grid position (h, w) is the row of h followed by the row of w.
+std::unique_ptr<PositionEmbeddingTable> create_rotary_pos_emb_table(const std::shared_ptr<ov::Model>& vision_embeddings_merger) {
+    const size_t dim = vision_embeddings_merger->input("rotary_pos_emb").get_partial_shape()[1].get_length();
+    const float theta = 10000.0f;
+    std::vector<float> inv_freq(dim / 2);
+    for (size_t i = 0; i < dim / 2; ++i) {
+        inv_freq[i] = 1.0f / std::pow(theta, static_cast<float>(i) / static_cast<float>(dim / 2));
+    }
+    return std::make_unique<PositionEmbeddingTable>(dim / 2, [inv_freq](size_t position, float* row) {
+        for (size_t j = 0; j < inv_freq.size(); ++j) {
+            row[j] = static_cast<float>(position) * inv_freq[j];
+        }
+    });
+}
+
 } // namespace
 
 namespace qwen2_vl_utils {
@@ -66,43 +85,10 @@ ov::Tensor reshape_image_patches(
         patch_size                   
     };
     
+    // the row-major order of the elements is kept, so the data is copied as it is
     ov::Tensor reshaped_patches(patches.get_element_type(), output_shape);
-
-    const float* input_data = patches.data<float>();
-    float* output_data = reshaped_patches.data<float>();
-
-    size_t input_idx = 0;
-    
-    for (size_t gt = 0; gt < output_shape.at(0); ++gt) {
-        for (size_t tp = 0; tp < output_shape.at(1); ++tp) {
-            for (size_t c = 0; c < output_shape.at(2); ++c) {
-                for (size_t gh = 0; gh < output_shape.at(3); ++gh) {
-                    for (size_t ms1 = 0; ms1 < output_shape.at(4); ++ms1) {
-                        for (size_t p1 = 0; p1 < output_shape.at(5); ++p1) {
-                            for (size_t gw = 0; gw < output_shape.at(6); ++gw) {
-                                for (size_t ms2 = 0; ms2 < output_shape.at(7); ++ms2) {
-                                    for (size_t p2 = 0; p2 < output_shape.at(8); ++p2) {
-                                        size_t output_idx = gt;
-                                        output_idx = output_idx * output_shape.at(1) + tp;
-                                        output_idx = output_idx * output_shape.at(2) + c;
-                                        output_idx = output_idx * output_shape.at(3) + gh;
-                                        output_idx = output_idx * output_shape.at(4) + ms1;
-                                        output_idx = output_idx * output_shape.at(5) + p1;
-                                        output_idx = output_idx * output_shape.at(6) + gw;
-                                        output_idx = output_idx * output_shape.at(7) + ms2;
-                                        output_idx = output_idx * output_shape.at(8) + p2;
-
-                                        output_data[output_idx] = input_data[input_idx];
-                                        input_idx++;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
+    OPENVINO_ASSERT(reshaped_patches.get_byte_size() == patches.get_byte_size(), "Image patches can't be reshaped to the grid");
+    std::memcpy(reshaped_patches.data(), patches.data(), patches.get_byte_size());
 
     return reshaped_patches;
 }
@@ -125,50 +111,42 @@ ov::Tensor transpose_image_patches(const ov::Tensor& reshaped_patches) {
     };
 
     ov::Tensor transposed_patches(reshaped_patches.get_element_type(), output_shape);
-    
+
     const float* src = reshaped_patches.data<float>();
     float* dst = transposed_patches.data<float>();
-    
-    size_t shape_size = input_shape.size();
-    std::vector<size_t> input_strides(shape_size);
-    std::vector<size_t> output_strides(shape_size);
-    
-    input_strides[shape_size - 1] = 1;
-    output_strides[shape_size - 1] = 1;
-    for(int i = 7; i >= 0; i--) {
-        input_strides[i] = input_strides[i+1] * input_shape[i+1];
-        output_strides[i] = output_strides[i+1] * output_shape[i+1];
+
+    std::vector<size_t> input_strides(input_shape.size());
+    input_strides.back() = 1;
+    for (size_t i = input_shape.size() - 1; i > 0; i--) {
+        input_strides[i - 1] = input_strides[i] * input_shape[i];
     }
 
-    size_t total_elements = reshaped_patches.get_size();
-    for(size_t idx = 0; idx < total_elements; idx++) {
-        size_t remaining = idx;
-        std::vector<size_t> input_indices(shape_size);
-        for(int i = 0; i < shape_size; i++) {
-            input_indices[i] = remaining / input_strides[i];
-            remaining %= input_strides[i];
-        }
-        
-        std::vector<size_t> output_indices = {
-            input_indices.at(0),
-            input_indices.at(3),
-            input_indices.at(6),
-            input_indices.at(4),
-            input_indices.at(7),
-            input_indices.at(2),
-            input_indices.at(1),
-            input_indices.at(5),
-            input_indices.at(8)
-        };
-        
-        size_t dst_idx = 0;
-        for(int i = 0; i < shape_size; i++) {
-            dst_idx += output_indices[i] * output_strides[i];
+    // the last dimension is kept, so its rows are copied as a whole
+    const size_t row_size = input_shape.at(8);
+    const size_t num_blocks = output_shape.at(0) * output_shape.at(1) * output_shape.at(2);
+    const size_t block_size = transposed_patches.get_size() / num_blocks;
+    ov::parallel_for(num_blocks, [&](size_t block) {
+        const size_t gt = block / (output_shape.at(1) * output_shape.at(2));
+        const size_t gh = block / output_shape.at(2) % output_shape.at(1);
+        const size_t gw = block % output_shape.at(2);
+        float* dst_row = dst + block * block_size;
+        for (size_t ms1 = 0; ms1 < output_shape.at(3); ++ms1) {
+            for (size_t ms2 = 0; ms2 < output_shape.at(4); ++ms2) {
+                for (size_t c = 0; c < output_shape.at(5); ++c) {
+                    for (size_t tp = 0; tp < output_shape.at(6); ++tp) {
+                        for (size_t p1 = 0; p1 < output_shape.at(7); ++p1) {
+                            const float* src_row = src + gt * input_strides[0] + tp * input_strides[1] + c * input_strides[2] +
+                                                   gh * input_strides[3] + ms1 * input_strides[4] + p1 * input_strides[5] +
+                                                   gw * input_strides[6] + ms2 * input_strides[7];
+                            std::memcpy(dst_row, src_row, row_size * sizeof(float));
+                            dst_row += row_size;
+                        }
+                    }
+                }
+            }
         }
-        
-        dst[dst_idx] = src[idx];
-    }
-    
+    });
+
     return transposed_patches;
 }
 
@@ -185,7 +163,7 @@ std::pair<std::vector<ov::Tensor>, std::vector<std::array<size_t, 3>>> reorder_i
         ov::Tensor single_image_embeds = encoded_image.resized_source;
         image_embeds.push_back(std::move(single_image_embeds));
 
-        size_t grid_t = 1;
+        size_t grid_t = encoded_image.num_temporal_patches;
         size_t grid_h = encoded_image.resized_source_size.height;
         size_t grid_w = encoded_image.resized_source_size.width;
         images_grid_thw.push_back({grid_t, grid_h, grid_w});
@@ -315,8 +293,6 @@ ov::Tensor merge_text_and_image_embeddings(
 } // namespace qwen2vl_utils
 
 EncodedImage VisionEncoderQwen2VL::encode(const ov::Tensor& image, const ov::AnyMap& config_map) {
-    CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_vision_encoder.get());
-    ov::InferRequest& encoder = infer_request_guard.get();
     ProcessorConfig config = utils::from_any_map(config_map, m_processor_config);
 
     ov::Shape image_shape = image.get_shape();
@@ -358,6 +334,71 @@ EncodedImage VisionEncoderQwen2VL::encode(const ov::Tensor& image, const ov::Any
         patches = std::move(tiled_patches);
     }
 
+    return encode_patches(patches, target_image_size, config);
+}
+
+EncodedImage VisionEncoderQwen2VL::encode_video(const ov::Tensor& video, const ov::AnyMap& config_map) {
+    ProcessorConfig config = utils::from_any_map(config_map, m_processor_config);
+
+    ov::Shape video_shape = video.get_shape();
+    OPENVINO_ASSERT(video_shape.size() == 4 && video_shape.at(3) == 3, "Video must have [NHWC] layout with RGB frames, given video shape is ", video_shape);
+    const size_t num_frames = video_shape.at(0), height = video_shape.at(1), width = video_shape.at(2);
+    const size_t frame_size = height * width * 3;
+    const uint8_t* video_data = video.data<const uint8_t>();
+
+    std::vector<size_t> frame_indices = sample_frame_indices(num_frames, config.video_max_frames, config.temporal_patch_size);
+    if (config.video_frame_difference_threshold > 0.0f) {
+        frame_indices = drop_similar_frame_groups(video_data, frame_size, frame_indices, config.temporal_patch_size, config.video_frame_difference_threshold);
+    }
+
+    const size_t factor = config.patch_size * config.merge_size;
+    size_t num_groups = frame_indices.size() / config.temporal_patch_size;
+    size_t max_pixels = std::min(config.max_pixels, config.video_max_pixels);
+    ImageSize target_image_size = qwen2_vl_utils::smart_resize(height, width, factor, config.min_pixels, max_pixels);
+    if (config.video_max_tokens > 0) {
+        // the frames are made smaller first, then fewer frames are kept, if they are still too many tokens
+        size_t num_group_tokens = (target_image_size.height / factor) * (target_image_size.width / factor);
+        if (num_groups * num_group_tokens > config.video_max_tokens) {
+            max_pixels = std::max(config.min_pixels, config.video_max_tokens / num_groups * factor * factor);
+            target_image_size = qwen2_vl_utils::smart_resize(height, width, factor, config.min_pixels, max_pixels);
+            num_group_tokens = (target_image_size.height / factor) * (target_image_size.width / factor);
+        }
+        if (num_groups * num_group_tokens > config.video_max_tokens) {
+            const size_t max_groups = std::max(config.video_max_tokens / num_group_tokens, size_t(1));
+            std::vector<size_t> kept_frame_indices;
+            for (size_t group : sample_frame_indices(num_groups, max_groups, 1)) {
+                kept_frame_indices.insert(kept_frame_indices.end(),
+                    frame_indices.begin() + group * config.temporal_patch_size,
+                    frame_indices.begin() + (group + 1) * config.temporal_patch_size);
+            }
+            frame_indices = std::move(kept_frame_indices);
+            num_groups = max_groups;
+        }
+    }
+
+    clip_ctx ctx;
+    std::copy(config.image_mean.begin(), config.image_mean.end(), ctx.image_mean);
+    std::copy(config.image_std.begin(), config.image_std.end(), ctx.image_std);
+
+    // the frames are stacked to be encoded in a single inference
+    ov::Tensor patches(ov::element::f32, {frame_indices.size(), 3, target_image_size.height, target_image_size.width});
+    const size_t normalized_frame_size = 3 * target_image_size.height * target_image_size.width;
+    for (size_t i = 0; i < frame_indices.size(); ++i) {
+        const uint8_t* frame_data = video_data + frame_indices[i] * frame_size;
+        clip_image_u8 frame{int(width), int(height), {frame_data, frame_data + frame_size}};
+        clip_image_u8 resized_frame;
+        bicubic_resize(frame, resized_frame, target_image_size.width, target_image_size.height);
+        clip_image_f32 normalized_frame = clip_image_preprocess(ctx, resized_frame);
+        std::memcpy(patches.data<float>() + i * normalized_frame_size, normalized_frame.buf.data(), normalized_frame_size * sizeof(float));
+    }
+
+    return encode_patches(patches, target_image_size, config);
+}
+
+EncodedImage VisionEncoderQwen2VL::encode_patches(const ov::Tensor& patches, const ImageSize& target_image_size, const ProcessorConfig& config) {
+    CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_vision_encoder.get());
+    ov::InferRequest& encoder = infer_request_guard.get();
+
     auto patches_shape = patches.get_shape();
     size_t channel = patches_shape.at(1);
     
@@ -386,7 +427,9 @@ EncodedImage VisionEncoderQwen2VL::encode(const ov::Tensor& image, const ov::Any
 
     ImageSize resized_source_size{grid_h, grid_w};
 
-    return {std::move(image_features), resized_source_size};
+    EncodedImage encoded_image{std::move(image_features), resized_source_size};
+    encoded_image.num_temporal_patches = grid_t;
+    return encoded_image;
 }
 
 InputsEmbedderQwen2VL::InputsEmbedderQwen2VL(
@@ -397,6 +440,7 @@ InputsEmbedderQwen2VL::InputsEmbedderQwen2VL(
     IInputsEmbedder(vlm_config, model_dir, device, device_config) {
     auto model = utils::singleton_core().read_model(model_dir / "openvino_vision_embeddings_merger_model.xml");
     utils::request_vl_sdpa_transformations(model);
+    m_rotary_pos_emb_table = create_rotary_pos_emb_table(model);
 
     auto compiled_model = utils::singleton_core().compile_model(model, device, device_config);
 
@@ -424,6 +468,7 @@ InputsEmbedderQwen2VL::InputsEmbedderQwen2VL(
         utils::get_model_weights_pair(models_map, "vision_embeddings_merger").first,
         utils::get_model_weights_pair(models_map, "vision_embeddings_merger").second);
     utils::request_vl_sdpa_transformations(model);
+    m_rotary_pos_emb_table = create_rotary_pos_emb_table(model);
 
     auto compiled_model = utils::singleton_core().compile_model(model,
         device,
@@ -448,7 +493,7 @@ std::pair<std::string, std::vector<size_t>> InputsEmbedderQwen2VL::normalize_pro
     images_grid_thw.reserve(images.size());
     
     for (const auto& encoded_image : images) {
-        size_t grid_t = 1;
+        size_t grid_t = encoded_image.num_temporal_patches;
         size_t grid_h = encoded_image.resized_source_size.height;
         size_t grid_w = encoded_image.resized_source_size.width;
         images_grid_thw.push_back({grid_t, grid_h, grid_w});
@@ -473,7 +518,7 @@ ov::Tensor InputsEmbedderQwen2VL::get_inputs_embeds(const std::string& unified_p
     std::vector<std::array<size_t, 3>> images_grid_thw;
     images_grid_thw.reserve(images.size());
     for (const auto& encoded_image : images) {
-        size_t grid_t = 1;
+        size_t grid_t = encoded_image.num_temporal_patches;
         size_t grid_h = encoded_image.resized_source_size.height;
         size_t grid_w = encoded_image.resized_source_size.width;
         images_grid_thw.push_back({grid_t, grid_h, grid_w});
@@ -493,10 +538,9 @@ ov::Tensor InputsEmbedderQwen2VL::get_inputs_embeds(const std::string& unified_p
     int64_t vision_start_token_id = encoded_vision_start_token.data<int64_t>()[encoded_vision_start_token.get_size() - 1];
     int64_t image_pad_token_id = encoded_image_pad_token.data<int64_t>()[encoded_image_pad_token.get_size() - 1];
 
-    m_position_ids = create_position_ids(input_ids, images_grid_thw, images_sequence, 0, vision_start_token_id);
-
-    int64_t position_ids_max_element = *std::max_element(m_position_ids.data<int64_t>(), m_position_ids.data<int64_t>() + m_position_ids.get_size());
-    m_rope_delta = position_ids_max_element + 1 - static_cast<int64_t>(input_ids.get_shape().at(1));
+    int64_t next_position_id = 0;
+    m_position_ids = create_position_ids(input_ids, images_grid_thw, images_sequence, 0, vision_start_token_id, next_position_id);
+    m_rope_delta = next_position_id - static_cast<int64_t>(input_ids.get_shape().at(1));
 
     if (images.empty()) {
         ov::Tensor inputs_embeds(text_embeds.get_element_type(), text_embeds.get_shape());
@@ -569,104 +613,53 @@ ov::Tensor InputsEmbedderQwen2VL::run_image_embeddings_merger(
 ov::Tensor InputsEmbedderQwen2VL::get_rotary_pos_emb(const std::vector<std::array<size_t, 3>>& grids_thw) {
     const size_t spatial_merge_size = m_vision_encoder->get_processor_config().merge_size;
 
-    std::vector<std::vector<size_t>> all_pos_ids;
     size_t total_positions = 0;
     size_t max_grid_size = 0;
-
     for (const auto& grid_thw : grids_thw) {
         size_t t = grid_thw.at(0);
         size_t h = grid_thw.at(1);
         size_t w = grid_thw.at(2);
-
-        total_positions += t * h * w;
+        total_positions += t * (h / spatial_merge_size) * (w / spatial_merge_size) * spatial_merge_size * spatial_merge_size;
         max_grid_size = std::max({max_grid_size, h, w});
-        
-        // Create height position IDs
-        std::vector<size_t> hpos_ids(h * w);
-        for (size_t hi = 0; hi < h; ++hi) {
-            for (size_t wi = 0; wi < w; ++wi) {
-                size_t idx = hi * w + wi;
-                hpos_ids[idx] = hi;
-            }
-        }
+    }
 
-        // Reshape hpos_ids according to spatial merge size
-        std::vector<size_t> reshaped_hpos;
-        size_t h_blocks = h / spatial_merge_size;
-        size_t w_blocks = w / spatial_merge_size;
-        reshaped_hpos.reserve(h * w);
+    // Rotary frequencies of the positions up to max_grid_size
+    const std::shared_ptr<const std::vector<float>> freqs = m_rotary_pos_emb_table->get(max_grid_size);
+    const float* freqs_data = freqs->data();
+    const size_t half_dim = m_rotary_pos_emb_table->get_row_size();
+    const size_t dim = 2 * half_dim;
 
-        for (size_t hb = 0; hb < h_blocks; ++hb) {
-            for (size_t wb = 0; wb < w_blocks; ++wb) {
-                for (size_t hs = 0; hs < spatial_merge_size; ++hs) {
-                    for (size_t ws = 0; ws < spatial_merge_size; ++ws) {
-                        reshaped_hpos.push_back(hb * spatial_merge_size + hs);
-                    }
-                }
-            }
-        }
-
-        // Create width position IDs
-        std::vector<size_t> wpos_ids(h * w);
-        for (size_t hi = 0; hi < h; ++hi) {
-            for (size_t wi = 0; wi < w; ++wi) {
-                size_t idx = hi * w + wi;
-                wpos_ids[idx] = wi;
-            }
-        }
+    ov::Tensor rotary_pos_emb(ov::element::f32, {total_positions, dim});
+    float* output_data = rotary_pos_emb.data<float>();
 
-        // Reshape wpos_ids according to spatial merge size
-        std::vector<size_t> reshaped_wpos;
-        reshaped_wpos.reserve(h * w);
+    for (const auto& grid_thw : grids_thw) {
+        size_t t = grid_thw.at(0);
+        size_t h_blocks = grid_thw.at(1) / spatial_merge_size;
+        size_t w_blocks = grid_thw.at(2) / spatial_merge_size;
 
+        // The positions are ordered by the blocks of spatial_merge_size x spatial_merge_size patches
+        const float* grid_data = output_data;
         for (size_t hb = 0; hb < h_blocks; ++hb) {
             for (size_t wb = 0; wb < w_blocks; ++wb) {
                 for (size_t hs = 0; hs < spatial_merge_size; ++hs) {
                     for (size_t ws = 0; ws < spatial_merge_size; ++ws) {
-                        reshaped_wpos.push_back(wb * spatial_merge_size + ws);
+                        size_t h_idx = hb * spatial_merge_size + hs;
+                        size_t w_idx = wb * spatial_merge_size + ws;
+                        std::copy_n(freqs_data + h_idx * half_dim, half_dim, output_data);
+                        std::copy_n(freqs_data + w_idx * half_dim, half_dim, output_data + half_dim);
+                        output_data += dim;
                     }
                 }
             }
         }
 
-        // Stack and repeat for each t
-        for (size_t i = 0; i < t; ++i) {
-            for (size_t j = 0; j < reshaped_hpos.size(); ++j) {
-                all_pos_ids.push_back({reshaped_hpos[j], reshaped_wpos[j]});
-            }
-        }
-    }
-
-    // Calculate rotary embeddings for max_grid_size
-    CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_vision_embeddings_merger.get());
-    ov::InferRequest& vision_embeddings_merger = infer_request_guard.get();
-    const size_t dim = vision_embeddings_merger.get_tensor("rotary_pos_emb").get_shape().at(1);
-    const float theta = 10000.0f;
-    
-    std::vector<float> inv_freq(dim / 2);
-    for (size_t i = 0; i < dim / 2; ++i) {
-        inv_freq[i] = 1.0f / std::pow(theta, static_cast<float>(i) / static_cast<float>(dim / 2));
-    }
-
-    std::vector<std::vector<float>> freqs(max_grid_size);
-    for (size_t i = 0; i < max_grid_size; ++i) {
-        freqs[i].resize(dim / 2);
-        for (size_t j = 0; j < dim / 2; ++j) {
-            freqs[i][j] = static_cast<float>(i) * inv_freq[j];
+        // Repeat for each t
+        const size_t grid_size = output_data - grid_data;
+        for (size_t i = 1; i < t; ++i) {
+            output_data = std::copy_n(grid_data, grid_size, output_data);
         }
     }
 
-    ov::Tensor rotary_pos_emb(ov::element::f32, {all_pos_ids.size(), dim});
-    float* output_data = rotary_pos_emb.data<float>();
-
-    for (size_t i = 0; i < all_pos_ids.size(); ++i) {
-        const auto& pos = all_pos_ids.at(i);
-        size_t h_idx = pos.at(0);
-        size_t w_idx = pos.at(1);
-        std::copy_n(freqs[h_idx].begin(), dim / 2, output_data + i * dim);
-        std::copy_n(freqs[w_idx].begin(), dim / 2, output_data + i * dim + dim / 2);
-    }
-
     return rotary_pos_emb;
 }
 
@@ -675,7 +668,8 @@ ov::Tensor InputsEmbedderQwen2VL::create_position_ids(
     const std::vector<std::array<size_t, 3>>& images_grid_thw,
     const std::vector<size_t>& images_sequence,
     const size_t image_id,
-    const int64_t vision_start_token_id) {
+    const int64_t vision_start_token_id,
+    int64_t& next_position_id) {
     const size_t spatial_merge_size = m_vision_encoder->get_processor_config().merge_size;
 
     std::vector<std::array<size_t, 3>> reordered_images_grid_thw;
@@ -701,47 +695,52 @@ ov::Tensor InputsEmbedderQwen2VL::create_position_ids(
     int64_t next_pos = 0;
     size_t grid_idx = 0;
 
+    // the text tokens share the consecutive positions of the temporal, height and width dimensions
+    auto fill_text_positions = [&](size_t begin, size_t end) {
+        for (size_t dim = 0; dim < 3; ++dim) {
+            std::iota(pos_data + dim * seq_len + begin, pos_data + dim * seq_len + end, next_pos);
+        }
+        next_pos += static_cast<int64_t>(end - begin);
+    };
+
     for (size_t i = 0; i < vision_start_indices.size(); ++i) {
         size_t ed = vision_start_indices.at(i);
 
         // Process text tokens before image
         if (st < ed) {
-            for (size_t pos = st; pos < ed; ++pos) {
-                pos_data[pos] = next_pos;               // temporal
-                pos_data[seq_len + pos] = next_pos;     // height
-                pos_data[2 * seq_len + pos] = next_pos; // width
-                next_pos++;
-            }
+            fill_text_positions(st, ed);
         }
 
         // Process image start token
-        pos_data[ed] = next_pos;               // temporal
-        pos_data[seq_len + ed] = next_pos;     // height
-        pos_data[2 * seq_len + ed] = next_pos; // width
-        next_pos++;
+        fill_text_positions(ed, ed + 1);
         ed++;
 
         // Process image token with grid
         if (grid_idx < reordered_images_grid_thw.size()) {
             const auto& grid = reordered_images_grid_thw.at(grid_idx);
+            size_t llm_grid_t = grid.at(0);
             size_t llm_grid_h = grid.at(1) / spatial_merge_size;
             size_t llm_grid_w = grid.at(2) / spatial_merge_size;
-            size_t ed_image = ed + llm_grid_h * llm_grid_w;
-
-            // Fill temporal dimension
-            std::fill_n(pos_data + ed, llm_grid_h * llm_grid_w, next_pos);
-
-            // Fill height and width dimensions
-            int64_t* height_data = pos_data + seq_len + ed;
-            int64_t* width_data = pos_data + 2 * seq_len + ed;
-            for (size_t h = 0; h < llm_grid_h; ++h) {
-                std::fill_n(height_data + h * llm_grid_w, llm_grid_w, next_pos + h);
-                for (size_t w = 0; w < llm_grid_w; ++w) {
-                    width_data[h * llm_grid_w + w] = next_pos + w;
+            size_t llm_grid_size = llm_grid_h * llm_grid_w;
+            size_t ed_image = ed + llm_grid_t * llm_grid_size;
+
+            // the positions of a video advance along the temporal dimension with each group of frames
+            for (size_t t = 0; t < llm_grid_t; ++t) {
+                int64_t* temporal_data = pos_data + ed + t * llm_grid_size;
+                int64_t* height_data = pos_data + seq_len + ed + t * llm_grid_size;
+                int64_t* width_data = pos_data + 2 * seq_len + ed + t * llm_grid_size;
+                std::fill_n(temporal_data, llm_grid_size, next_pos + t);
+                // the width positions are the same for each row
+                std::iota(width_data, width_data + llm_grid_w, next_pos);
+                for (size_t h = 0; h < llm_grid_h; ++h) {
+                    std::fill_n(height_data + h * llm_grid_w, llm_grid_w, next_pos + h);
+                    if (h > 0) {
+                        std::copy_n(width_data, llm_grid_w, width_data + h * llm_grid_w);
+                    }
                 }
             }
 
-            next_pos += std::max(llm_grid_h, llm_grid_w);
+            next_pos += std::max({llm_grid_t, llm_grid_h, llm_grid_w});
             st = ed_image;
             grid_idx++;
         }
@@ -749,14 +748,10 @@ ov::Tensor InputsEmbedderQwen2VL::create_position_ids(
 
     // Process remaining text tokens
     if (st < seq_len) {
-        for (size_t pos = st; pos < seq_len; ++pos) {
-            pos_data[pos] = next_pos;               // temporal
-            pos_data[seq_len + pos] = next_pos;     // height
-            pos_data[2 * seq_len + pos] = next_pos; // width
-            next_pos++;
-        }
+        fill_text_positions(st, seq_len);
     }
 
+    next_position_id = next_pos;
     return position_ids;
 }
 
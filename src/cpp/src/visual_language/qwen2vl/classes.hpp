@@ -9,6 +9,7 @@
 
 #include "visual_language/vision_encoder.hpp"
 #include "visual_language/inputs_embedder.hpp"
+#include "visual_language/position_embedding_table.hpp"
 
 namespace ov::genai {
 
@@ -17,6 +18,12 @@ public:
     using VisionEncoder::VisionEncoder;
 
     EncodedImage encode(const ov::Tensor& image, const ov::AnyMap& config_map) override;
+
+    EncodedImage encode_video(const ov::Tensor& video, const ov::AnyMap& config_map) override;
+
+private:
+    // encodes the normalized [T, C, H, W] frames, T is a multiple of temporal_patch_size
+    EncodedImage encode_patches(const ov::Tensor& patches, const ImageSize& target_image_size, const ProcessorConfig& config);
 };
 
 class InputsEmbedderQwen2VL : public InputsEmbedder::IInputsEmbedder {
@@ -64,18 +71,24 @@ protected:
 
     bool m_with_cu_seqlens_input = false;
 
+    // Rotary frequencies of the image heights and widths seen so far, rows of rotary_pos_emb / 2
+    std::unique_ptr<PositionEmbeddingTable> m_rotary_pos_emb_table;
+
     virtual ov::Tensor run_image_embeddings_merger(
         const std::vector<EncodedImage>& images, 
         const std::vector<size_t>& images_sequence);
 
     ov::Tensor get_rotary_pos_emb(const std::vector<std::array<size_t, 3>>& grids_thw);
 
+    // M-RoPE position ids of the prompt, next_position_id is set to the position following the largest of them,
+    // so that the rope delta is known without scanning the ids
     ov::Tensor create_position_ids(
         const ov::Tensor& input_ids_tensor,
         const std::vector<std::array<size_t, 3>>& images_grid_thw,
         const std::vector<size_t>& images_sequence,
         const size_t image_id,
-        const int64_t vision_start_token_id
+        const int64_t vision_start_token_id,
+        int64_t& next_position_id
     );
 };
 
@@ -0,0 +1,73 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/// @brief Samples the frames of a video uniformly, including the first and the last ones.
+/// @param max_frames The max number of the sampled frames, 0 keeps all the frames.
+/// @param group_size The number of the sampled frames is rounded down to a multiple of it, since the frames are encoded
+/// in groups, a video of fewer frames repeats them to make a group.
+/// @return Indices of the sampled frames in increasing order.
+inline std::vector<size_t> sample_frame_indices(size_t num_frames, size_t max_frames, size_t group_size) {
+    OPENVINO_ASSERT(num_frames > 0, "Video must have at least one frame");
+    OPENVINO_ASSERT(group_size > 0, "Group size of the frames must be positive");
+    size_t num_sampled_frames = max_frames > 0 && max_frames < num_frames ? max_frames : num_frames;
+    num_sampled_frames = std::max(num_sampled_frames / group_size, size_t(1)) * group_size;
+
+    std::vector<size_t> frame_indices(num_sampled_frames, 0);
+    if (num_sampled_frames > 1) {
+        const double step = static_cast<double>(num_frames - 1) / (num_sampled_frames - 1);
+        for (size_t i = 0; i < num_sampled_frames; ++i) {
+            frame_indices[i] = static_cast<size_t>(std::round(i * step));
+        }
+    }
+    return frame_indices;
+}
+
+/// @brief Mean absolute difference of the bytes of two frames relative to 255.
+inline float get_frame_difference(const uint8_t* frame, const uint8_t* other_frame, size_t frame_size) {
+    uint64_t difference = 0;
+    for (size_t i = 0; i < frame_size; ++i) {
+        difference += static_cast<uint64_t>(std::abs(int(frame[i]) - int(other_frame[i])));
+    }
+    return frame_size > 0 ? static_cast<float>(difference) / (255.0f * frame_size) : 0.0f;
+}
+
+/// @brief Drops the groups of the sampled frames similar to the last kept group, so that a static scene takes the tokens
+/// of a single group. The groups are compared by their first frames, the first group is always kept.
+/// @param frames The frames of the video, each of frame_size bytes.
+/// @param frame_indices The sampled frames forming the groups of group_size frames.
+/// @param threshold The groups differing from the last kept group by less are dropped, see get_frame_difference().
+/// @return Indices of the frames of the kept groups.
+inline std::vector<size_t> drop_similar_frame_groups(
+    const uint8_t* frames,
+    size_t frame_size,
+    const std::vector<size_t>& frame_indices,
+    size_t group_size,
+    float threshold
+) {
+    OPENVINO_ASSERT(group_size > 0 && frame_indices.size() % group_size == 0, "Sampled frames must form whole groups");
+    std::vector<size_t> kept_frame_indices;
+    const uint8_t* last_kept_frame = nullptr;
+    for (size_t group_start = 0; group_start < frame_indices.size(); group_start += group_size) {
+        const uint8_t* frame = frames + frame_indices[group_start] * frame_size;
+        if (last_kept_frame != nullptr && get_frame_difference(frame, last_kept_frame, frame_size) < threshold) {
+            continue;
+        }
+        last_kept_frame = frame;
+        kept_frame_indices.insert(kept_frame_indices.end(), frame_indices.begin() + group_start, frame_indices.begin() + group_start + group_size);
+    }
+    return kept_frame_indices;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "openvino/runtime/tensor.hpp"
+#include "content_hash.hpp"
+#include "visual_language/vision_encoder.hpp"
+
+namespace ov::genai {
+
+/// @brief 128 bit content hash of an image and of the config it's encoded with.
+using ImageContentHash = ContentHash;
+using ImageContentHashHasher = ContentHashHasher;
+
+/// @brief Hashes the content and the shape of the image and the config it's encoded with.
+inline ImageContentHash hash_image(const ov::Tensor& image, const ov::AnyMap& config_map = {}) {
+    std::string description = image.get_element_type().get_type_name();
+    for (size_t dim : image.get_shape()) {
+        description += ',' + std::to_string(dim);
+    }
+    for (const auto& [name, value] : config_map) {
+        description += ';' + name + '=' + value.as<std::string>();
+    }
+    ImageContentHash hash;
+    hash_bytes(description.data(), description.size(), hash);
+    hash_bytes(image.data(), image.get_byte_size(), hash);
+    return hash;
+}
+
+/// @brief LRU cache of the embeddings of the images looked up by their content hash, so that an image repeated across
+/// the requests is encoded once. The embeddings of the least recently used images are dropped, once the total size of
+/// the cached tensors exceeds the budget. The cached tensors are shared with the returned embeddings, so they must not
+/// be modified.
+class VisionEmbeddingCache {
+public:
+    /// @param max_byte_size The budget of the total size of the cached tensors.
+    explicit VisionEmbeddingCache(size_t max_byte_size) : m_max_byte_size(max_byte_size) {}
+
+    /// @return The embeddings of the image with EncodedImage::is_cached set, if cached.
+    std::optional<EncodedImage> get(const ImageContentHash& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(hash);
+        if (it == m_entries.end()) {
+            return std::nullopt;
+        }
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+        EncodedImage encoded_image = it->second.encoded_image;
+        encoded_image.is_cached = true;
+        return encoded_image;
+    }
+
+    /// @brief Caches the embeddings, unless they exceed the budget alone.
+    void add(const ImageContentHash& hash, const EncodedImage& encoded_image) {
+        const size_t byte_size = get_byte_size(encoded_image);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (byte_size > m_max_byte_size || m_entries.count(hash)) {
+            return;
+        }
+        while (m_byte_size + byte_size > m_max_byte_size) {
+            auto lru_it = m_entries.find(m_lru.back());
+            m_byte_size -= lru_it->second.byte_size;
+            m_entries.erase(lru_it);
+            m_lru.pop_back();
+        }
+        m_lru.push_front(hash);
+        m_entries.emplace(hash, Entry{encoded_image, byte_size, m_lru.begin()});
+        m_byte_size += byte_size;
+    }
+
+    size_t get_byte_size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_byte_size;
+    }
+
+    static size_t get_byte_size(const EncodedImage& encoded_image) {
+        size_t byte_size = encoded_image.resized_source.get_byte_size() + encoded_image.images_features_projection.get_byte_size() +
+                           encoded_image.resampled_image.resampled_source.get_byte_size();
+        for (const auto& row : encoded_image.resampled_image.vision_embed_tensors) {
+            for (const ov::Tensor& tensor : row) {
+                byte_size += tensor.get_byte_size();
+            }
+        }
+        return byte_size;
+    }
+
+private:
+    struct Entry {
+        EncodedImage encoded_image;
+        size_t byte_size;
+        std::list<ImageContentHash>::iterator lru_position;
+    };
+
+    const size_t m_max_byte_size;
+    mutable std::mutex m_mutex;
+    // the most recently used images first
+    std::list<ImageContentHash> m_lru;
+    std::unordered_map<ImageContentHash, Entry, ImageContentHashHasher> m_entries;
+    size_t m_byte_size = 0;
+};
+
+}  // namespace ov::genai
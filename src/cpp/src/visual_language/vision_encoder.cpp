@@ -49,6 +49,60 @@ ProcessorConfig VisionEncoder::get_processor_config() const {
     return m_processor_config;
 }
 
+std::vector<EncodedImage> VisionEncoder::encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map) {
+    std::vector<EncodedImage> encoded_images;
+    encoded_images.reserve(images.size());
+    for (const ov::Tensor& image : images) {
+        encoded_images.push_back(encode(image, config_map));
+    }
+    return encoded_images;
+}
+
+EncodedImage VisionEncoder::encode_video(const ov::Tensor& video, const ov::AnyMap& config_map) {
+    OPENVINO_THROW("Video input isn't supported by the model");
+}
+
+std::vector<ov::Tensor> VisionEncoder::infer_batched(ov::InferRequest& encoder, const std::vector<ov::Tensor>& pixel_values) {
+    OPENVINO_ASSERT(!pixel_values.empty(), "Pixel values of at least one image are expected");
+    ov::Tensor batched_pixel_values = pixel_values.at(0);
+    if (pixel_values.size() > 1) {
+        ov::Shape batched_shape = pixel_values.at(0).get_shape();
+        batched_shape.at(0) = 0;
+        for (const ov::Tensor& image_pixel_values : pixel_values) {
+            ov::Shape shape = image_pixel_values.get_shape();
+            OPENVINO_ASSERT(shape.size() == batched_shape.size() && std::equal(shape.begin() + 1, shape.end(), batched_shape.begin() + 1),
+                "Pixel values of the images can be batched only if their shapes differ in the batch dimension, got ", shape, " and ", batched_shape);
+            batched_shape.at(0) += shape.at(0);
+        }
+        batched_pixel_values = ov::Tensor(pixel_values.at(0).get_element_type(), batched_shape);
+        uint8_t* batched_data = static_cast<uint8_t*>(batched_pixel_values.data());
+        for (const ov::Tensor& image_pixel_values : pixel_values) {
+            std::memcpy(batched_data, image_pixel_values.data(), image_pixel_values.get_byte_size());
+            batched_data += image_pixel_values.get_byte_size();
+        }
+    }
+
+    encoder.set_tensor("pixel_values", batched_pixel_values);
+    encoder.infer();
+
+    const ov::Tensor& infer_output = encoder.get_output_tensor();
+    ov::Shape output_shape = infer_output.get_shape();
+    OPENVINO_ASSERT(output_shape.at(0) == batched_pixel_values.get_shape().at(0),
+        "The batch of the encoder output ", output_shape.at(0), " differs from the batch of pixel values ", batched_pixel_values.get_shape().at(0));
+    const uint8_t* output_data = static_cast<const uint8_t*>(infer_output.data());
+
+    std::vector<ov::Tensor> outputs;
+    outputs.reserve(pixel_values.size());
+    for (const ov::Tensor& image_pixel_values : pixel_values) {
+        output_shape.at(0) = image_pixel_values.get_shape().at(0);
+        ov::Tensor output(infer_output.get_element_type(), output_shape);
+        std::memcpy(output.data(), output_data, output.get_byte_size());
+        output_data += output.get_byte_size();
+        outputs.push_back(std::move(output));
+    }
+    return outputs;
+}
+
 VisionEncoder::Ptr VisionEncoder::create(const std::filesystem::path& model_dir, const VLMModelType model_type, const std::string& device, const ov::AnyMap properties) {
     if (model_type == VLMModelType::MINICPM) {
         return std::make_shared<VisionEncoderMiniCPM>(model_dir, device, properties);
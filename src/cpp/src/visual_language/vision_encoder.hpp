@@ -55,6 +55,13 @@ struct EncodedImage {
   
     /// @brief Resampled image, used only by MiniCPM.
     ResampledImage resampled_image;
+
+    /// @brief Whether the embeddings are taken from the vision embedding cache.
+    bool is_cached = false;
+
+    /// @brief Number of the groups of temporal_patch_size frames of a video
+    /// encoded together, 1 for an image. Used only by Qwen2-VL and Qwen2.5-VL.
+    size_t num_temporal_patches = 1;
 };
 
 /// @brief A class used to infer embeddings of an image using
@@ -100,6 +107,26 @@ public:
     /// its slices.
     virtual EncodedImage encode(const ov::Tensor& image, const ov::AnyMap& config_map = {}) = 0;
 
+    /// @brief Compute embeddings of several images given
+    /// ProcessorConfig members. The encoders taking a batch of equally
+    /// sized tiles encode the tiles of all the images in a single
+    /// inference, the rest encode the images one by one.
+    /// @param images Images to infer embeddings for. Image shape must be
+    /// [1HWC].
+    /// @param config_map A config or its members values to follow
+    /// instead of the config obtained in constructors.
+    /// @return Resulting embeddings for each of the images.
+    virtual std::vector<EncodedImage> encode_batch(const std::vector<ov::Tensor>& images, const ov::AnyMap& config_map = {});
+
+    /// @brief Compute embeddings of a video given ProcessorConfig
+    /// members. The frames are sampled and encoded in a single inference.
+    /// Throws, if the model doesn't support videos.
+    /// @param video Frames of a video. Video shape must be [NHWC].
+    /// @param config_map A config or its members values to follow
+    /// instead of the config obtained in constructors.
+    /// @return Resulting embeddings of the sampled frames.
+    virtual EncodedImage encode_video(const ov::Tensor& video, const ov::AnyMap& config_map = {});
+
     /// @brief Gets processor config
     /// @return Processor config
     ProcessorConfig get_processor_config() const;
@@ -111,6 +138,14 @@ protected:
     /// @brief A config to follow.
     ProcessorConfig m_processor_config;
 
+    /// @brief Infers the pixel values of several images in a single
+    /// inference, concatenated along the batch dimension.
+    /// @param encoder An infer request of the encoder.
+    /// @param pixel_values Pixel values of each of the images, which
+    /// shapes differ only in the batch dimension.
+    /// @return A copy of the encoder output for each of the images.
+    static std::vector<ov::Tensor> infer_batched(ov::InferRequest& encoder, const std::vector<ov::Tensor>& pixel_values);
+
 public:
     VisionEncoder(
         const std::filesystem::path& model_dir,
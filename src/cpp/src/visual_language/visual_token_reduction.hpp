@@ -0,0 +1,144 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::genai {
+
+/// @brief The number of the visual tokens left by reduce_visual_tokens(), at least one.
+inline size_t get_num_kept_visual_tokens(size_t num_tokens, float keep_ratio) {
+    return std::clamp(static_cast<size_t>(std::round(num_tokens * keep_ratio)), size_t(1), num_tokens);
+}
+
+/// @brief Merges the most similar adjacent visual tokens of a sequence until num_kept_tokens are left, so that the
+/// prefill of the language model processes fewer image tokens. Each pass averages the non-overlapping pairs of the
+/// adjacent tokens of the highest cosine similarity, weighted by the number of the tokens already merged into them.
+/// The result is deterministic, so the same features are always reduced to the same tokens.
+/// @param protected_token The tokens equal to it, e.g. the image newline of LLaVA-Next, are never merged, so fewer
+/// tokens are merged, if the rest can't be paired. nullptr merges any tokens.
+/// @return The reduced tokens, [num_tokens, embed_dim] floats.
+inline std::vector<float> merge_similar_visual_tokens(
+    const float* tokens,
+    size_t num_tokens,
+    size_t embed_dim,
+    size_t num_kept_tokens,
+    const float* protected_token = nullptr
+) {
+    std::vector<float> merged(tokens, tokens + num_tokens * embed_dim);
+    std::vector<size_t> weights(num_tokens, 1);
+    std::vector<bool> is_protected(num_tokens, false);
+    if (protected_token != nullptr) {
+        for (size_t token_idx = 0; token_idx < num_tokens; ++token_idx) {
+            is_protected[token_idx] = std::memcmp(tokens + token_idx * embed_dim, protected_token, embed_dim * sizeof(float)) == 0;
+        }
+    }
+
+    std::vector<float> norms, similarities;
+    std::vector<size_t> pair_ids;
+    std::vector<bool> is_merged;
+    while (weights.size() > num_kept_tokens) {
+        const size_t count = weights.size();
+        norms.resize(count);
+        for (size_t token_idx = 0; token_idx < count; ++token_idx) {
+            const float* token = merged.data() + token_idx * embed_dim;
+            norms[token_idx] = std::sqrt(std::inner_product(token, token + embed_dim, token, 0.0f));
+        }
+        // the pair i consists of the tokens i and i + 1
+        similarities.assign(count - 1, 0.0f);
+        pair_ids.clear();
+        for (size_t pair_idx = 0; pair_idx + 1 < count; ++pair_idx) {
+            if (is_protected[pair_idx] || is_protected[pair_idx + 1]) {
+                continue;
+            }
+            const float* token = merged.data() + pair_idx * embed_dim;
+            const float norm_product = norms[pair_idx] * norms[pair_idx + 1];
+            const float dot = std::inner_product(token, token + embed_dim, token + embed_dim, 0.0f);
+            similarities[pair_idx] = norm_product > 0.0f ? dot / norm_product : 0.0f;
+            pair_ids.push_back(pair_idx);
+        }
+        if (pair_ids.empty()) {
+            break;
+        }
+        std::stable_sort(pair_ids.begin(), pair_ids.end(), [&](size_t lhs, size_t rhs) {
+            return similarities[lhs] > similarities[rhs];
+        });
+
+        // the first token of a merged pair takes the average, the second one is dropped
+        is_merged.assign(count, false);
+        size_t num_merged_pairs = 0;
+        for (size_t pair_idx : pair_ids) {
+            if (num_merged_pairs == count - num_kept_tokens) {
+                break;
+            }
+            if (is_merged[pair_idx] || is_merged[pair_idx + 1]) {
+                continue;
+            }
+            is_merged[pair_idx] = is_merged[pair_idx + 1] = true;
+            float* token = merged.data() + pair_idx * embed_dim;
+            const float* next_token = token + embed_dim;
+            const float weight = static_cast<float>(weights[pair_idx]), next_weight = static_cast<float>(weights[pair_idx + 1]);
+            for (size_t dim = 0; dim < embed_dim; ++dim) {
+                token[dim] = (token[dim] * weight + next_token[dim] * next_weight) / (weight + next_weight);
+            }
+            weights[pair_idx] += weights[pair_idx + 1];
+            weights[pair_idx + 1] = 0;
+            ++num_merged_pairs;
+        }
+
+        size_t kept_idx = 0;
+        for (size_t token_idx = 0; token_idx < count; ++token_idx) {
+            if (weights[token_idx] == 0) {
+                continue;
+            }
+            if (kept_idx != token_idx) {
+                std::copy_n(merged.data() + token_idx * embed_dim, embed_dim, merged.data() + kept_idx * embed_dim);
+                weights[kept_idx] = weights[token_idx];
+                is_protected[kept_idx] = is_protected[token_idx];
+            }
+            ++kept_idx;
+        }
+        merged.resize(kept_idx * embed_dim);
+        weights.resize(kept_idx);
+        is_protected.resize(kept_idx);
+    }
+    return merged;
+}
+
+/// @brief Reduces the visual tokens of each row of the features to the keep_ratio of them, see
+/// merge_similar_visual_tokens().
+/// @param features f32 [num_rows, num_tokens, embed_dim], e.g. the features of the tiles of an image.
+/// @param keep_ratio The ratio of the kept tokens in (0, 1], 1 returns the features as they are.
+/// @return f32 [num_rows, num_kept_tokens, embed_dim].
+inline ov::Tensor reduce_visual_tokens(const ov::Tensor& features, float keep_ratio, const float* protected_token = nullptr) {
+    OPENVINO_ASSERT(keep_ratio > 0.0f && keep_ratio <= 1.0f, "Visual token keep ratio must be in (0, 1], got ", keep_ratio);
+    OPENVINO_ASSERT(features.get_element_type() == ov::element::f32 && features.get_shape().size() == 3,
+                    "Visual tokens must be f32 [rows, tokens, embed_dim]");
+    const size_t num_rows = features.get_shape().at(0), num_tokens = features.get_shape().at(1), embed_dim = features.get_shape().at(2);
+    const size_t num_kept_tokens = get_num_kept_visual_tokens(num_tokens, keep_ratio);
+    if (num_kept_tokens == num_tokens) {
+        return features;
+    }
+
+    std::vector<std::vector<float>> rows(num_rows);
+    for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+        rows[row_idx] = merge_similar_visual_tokens(features.data<const float>() + row_idx * num_tokens * embed_dim,
+                                                    num_tokens, embed_dim, num_kept_tokens, protected_token);
+        OPENVINO_ASSERT(rows[row_idx].size() == rows[0].size(), "The rows of the visual tokens must be reduced to the same number of tokens");
+    }
+    ov::Tensor reduced(ov::element::f32, {num_rows, rows[0].size() / embed_dim, embed_dim});
+    for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+        std::copy(rows[row_idx].begin(), rows[row_idx].end(), reduced.data<float>() + row_idx * rows[0].size());
+    }
+    return reduced;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper/chunking.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+std::vector<WhisperChunkWindow> get_chunk_windows(const size_t num_samples,
+                                                  const size_t chunk_samples,
+                                                  const size_t stride_samples) {
+    OPENVINO_ASSERT(2 * stride_samples < chunk_samples,
+                    "The stride on both sides of a window must be shorter than the window, got stride ",
+                    stride_samples,
+                    " samples of ",
+                    chunk_samples,
+                    " samples window");
+
+    const size_t step = chunk_samples - 2 * stride_samples;
+    std::vector<WhisperChunkWindow> windows;
+    for (size_t start = 0;; start += step) {
+        const size_t end = std::min(start + chunk_samples, num_samples);
+        const bool is_last = end == num_samples;
+        windows.push_back({start, end, start == 0 ? 0 : stride_samples, is_last ? 0 : stride_samples});
+        if (is_last) {
+            break;
+        }
+    }
+    return windows;
+}
+
+std::vector<int64_t> merge_chunk_tokens(const std::vector<std::vector<int64_t>>& chunks_tokens) {
+    if (chunks_tokens.empty()) {
+        return {};
+    }
+
+    std::vector<int64_t> merged;
+    std::vector<int64_t> sequence = chunks_tokens[0];
+    for (size_t chunk = 1; chunk < chunks_tokens.size(); ++chunk) {
+        const std::vector<int64_t>& right_sequence = chunks_tokens[chunk];
+        const size_t sequence_len = sequence.size();
+        const size_t right_len = right_sequence.size();
+
+        // the overlap of the last i tokens of the sequence with the first i tokens of the right sequence
+        float best_matching = 0.0f;
+        size_t left_start = sequence_len, left_stop = sequence_len, right_start = 0, right_stop = 0;
+        for (size_t i = 1; i < sequence_len + right_len; ++i) {
+            const size_t overlap_left_start = sequence_len > i ? sequence_len - i : 0;
+            const size_t overlap_left_stop = std::min(sequence_len, sequence_len + right_len - i);
+            const size_t overlap_right_start = i > sequence_len ? i - sequence_len : 0;
+            const size_t overlap_right_stop = std::min(right_len, i);
+
+            size_t matches = 0;
+            for (size_t pos = 0; pos < overlap_left_stop - overlap_left_start; ++pos) {
+                matches += sequence[overlap_left_start + pos] == right_sequence[overlap_right_start + pos];
+            }
+
+            // the longer overlaps win the ties
+            const float matching = static_cast<float>(matches) / i + i / 10000.0f;
+            if (matches > 1 && matching > best_matching) {
+                best_matching = matching;
+                left_start = overlap_left_start;
+                left_stop = overlap_left_stop;
+                right_start = overlap_right_start;
+                right_stop = overlap_right_stop;
+            }
+        }
+
+        const size_t left_mid = (left_start + left_stop) / 2;
+        const size_t right_mid = (right_start + right_stop) / 2;
+        merged.insert(merged.end(), sequence.begin(), sequence.begin() + left_mid);
+        sequence.assign(right_sequence.begin() + right_mid, right_sequence.end());
+    }
+    merged.insert(merged.end(), sequence.begin(), sequence.end());
+
+    return merged;
+}
+
+}  // namespace genai
+}  // namespace ov
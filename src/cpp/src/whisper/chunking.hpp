@@ -0,0 +1,38 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+// the samples of a fixed stride window of the long-form audio
+struct WhisperChunkWindow {
+    size_t start;
+    size_t end;
+    // the samples shared with the previous and the next windows
+    size_t left_stride;
+    size_t right_stride;
+};
+
+/**
+ * @brief Split the audio into windows of chunk_samples, overlapping by stride_samples on each side, as the chunked
+ * pipeline of the HF transformers does. The first window has no left stride and the last one has no right stride.
+ */
+std::vector<WhisperChunkWindow> get_chunk_windows(const size_t num_samples,
+                                                  const size_t chunk_samples,
+                                                  const size_t stride_samples);
+
+/**
+ * @brief Merge the text tokens of the consecutive windows: the overlap of each pair of windows is aligned at the
+ * position with the largest share of the matching tokens, and the tokens are taken from the left window up to the
+ * middle of the aligned overlap and from the right one after it.
+ */
+std::vector<int64_t> merge_chunk_tokens(const std::vector<std::vector<int64_t>>& chunks_tokens);
+
+}  // namespace genai
+}  // namespace ov
@@ -40,91 +40,33 @@ static bool hann_window(const size_t length, const bool periodic, std::vector<fl
     return true;
 }
 
-// naive Discrete Fourier Transform
-// input is real-valued
-// output is complex-valued
-static void dft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    int N = in.size();
-
-    out.resize(N * 2);
-    const int sin_cos_step = n_fft / N;
-
-    for (int k = 0; k < N; k++) {
-        float re = 0;
-        float im = 0;
-
-        for (int n = 0; n < N; n++) {
-            int idx = (k * n * sin_cos_step) % (n_fft);  // t = 2*M_PI*k*n/N
-            re += in[n] * cos_vals[idx];                 // cos(t)
-            im -= in[n] * sin_vals[idx];                 // sin(t)
+// log10 of the mel spectrogram of a windowed frame, clamping and normalization are applied to the whole spectrogram
+static void log_mel_frame(const float* fft_in,
+                          std::vector<float>& power,
+                          const ov::genai::WhisperRealFFT& fft,
+                          ov::genai::WhisperRealFFT::Buffers& fft_buffers,
+                          const std::vector<float>& mel_filter,
+                          const std::vector<std::pair<size_t, size_t>>& mel_filter_bins,
+                          const size_t feature_size,
+                          float* log_mel,
+                          const size_t log_mel_stride) {
+    const size_t n_fft = 1 + fft.get_size() / 2;
+    power.resize(n_fft);
+
+    // modulus^2 of the frequency bins
+    fft.power_spectrum(fft_in, power.data(), fft_buffers);
+
+    // mel spectrogram, only the nonzero bins of the triangular filters are accumulated
+    for (size_t j = 0; j < feature_size; j++) {
+        const float* filter = mel_filter.data() + j * n_fft;
+        double sum = 0.0;
+        for (size_t k = mel_filter_bins[j].first; k < mel_filter_bins[j].second; k++) {
+            sum += power[k] * filter[k];
         }
 
-        out[k * 2 + 0] = re;
-        out[k * 2 + 1] = im;
-    }
-}
-
-// Cooley-Tukey FFT
-// input is real-valued
-// output is complex-valued
-static void fft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    out.resize(in.size() * 2);
-
-    int N = in.size();
-
-    if (N == 1) {
-        out[0] = in[0];
-        out[1] = 0;
-        return;
-    }
+        sum = log10(std::max(sum, 1e-10));
 
-    if (N % 2 == 1) {
-        dft(in, out, sin_vals, cos_vals, n_fft);
-        return;
-    }
-
-    std::vector<float> even;
-    std::vector<float> odd;
-
-    even.reserve(N / 2);
-    odd.reserve(N / 2);
-
-    for (int i = 0; i < N; i++) {
-        if (i % 2 == 0) {
-            even.push_back(in[i]);
-        } else {
-            odd.push_back(in[i]);
-        }
-    }
-
-    std::vector<float> even_fft;
-    std::vector<float> odd_fft;
-
-    fft(even, even_fft, sin_vals, cos_vals, n_fft);
-    fft(odd, odd_fft, sin_vals, cos_vals, n_fft);
-
-    const int sin_cos_step = n_fft / N;
-    for (int k = 0; k < N / 2; k++) {
-        int idx = k * sin_cos_step;  // t = 2*M_PI*k/N
-        float re = cos_vals[idx];    // cos(t)
-        float im = -sin_vals[idx];   // sin(t)
-
-        float re_odd = odd_fft[2 * k + 0];
-        float im_odd = odd_fft[2 * k + 1];
-
-        out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
-        out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
-
-        out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
-        out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
+        log_mel[j * log_mel_stride] = sum;
     }
 }
 
@@ -136,11 +78,12 @@ static void log_mel_spectrogram_worker_thread(int ith,
                                               int frame_step,
                                               int n_threads,
                                               const std::vector<float>& mel_filter,
-                                              WhisperFeatures& features,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_bins,
+                                              const ov::genai::WhisperRealFFT& fft,
+                                              WhisperFeatures& features) {
     std::vector<float> fft_in(frame_size, 0.0);
-    std::vector<float> fft_out(2 * frame_size);
+    std::vector<float> power;
+    ov::genai::WhisperRealFFT::Buffers fft_buffers;
     int n_fft = 1 + (frame_size / 2);
     int i = ith;
 
@@ -159,35 +102,15 @@ static void log_mel_spectrogram_worker_thread(int ith,
             std::fill(fft_in.begin() + (n_samples - offset), fft_in.end(), 0.0);
         }
 
-        // FFT
-        fft(fft_in, fft_out, sin_vals, cos_vals, frame_size);
-
-        // Calculate modulus^2 of complex numbers
-        // Use pow(fft_out[2 * j + 0], 2) + pow(fft_out[2 * j + 1], 2) causes inference quality problem? Interesting.
-        for (int j = 0; j < n_fft; j++) {
-            fft_out[j] = (fft_out[2 * j + 0] * fft_out[2 * j + 0] + fft_out[2 * j + 1] * fft_out[2 * j + 1]);
-        }
-
-        // mel spectrogram
-        for (int j = 0; j < features.feature_size; j++) {
-            double sum = 0.0;
-
-            // unroll loop (suggested by GH user @lunixbochs)
-            int k = 0;
-            for (k = 0; k < n_fft - 3; k += 4) {
-                sum += fft_out[k + 0] * mel_filter[j * n_fft + k + 0] + fft_out[k + 1] * mel_filter[j * n_fft + k + 1] +
-                       fft_out[k + 2] * mel_filter[j * n_fft + k + 2] + fft_out[k + 3] * mel_filter[j * n_fft + k + 3];
-            }
-
-            // handle n_fft remainder
-            for (; k < n_fft; k++) {
-                sum += fft_out[k] * mel_filter[j * n_fft + k];
-            }
-
-            sum = log10(std::max(sum, 1e-10));
-
-            features.data[j * features.n_frames + i] = sum;
-        }
+        log_mel_frame(fft_in.data(),
+                      power,
+                      fft,
+                      fft_buffers,
+                      mel_filter,
+                      mel_filter_bins,
+                      features.feature_size,
+                      features.data.data() + i,
+                      features.n_frames);
     }
 
     // Otherwise fft_out are all zero
@@ -199,6 +122,26 @@ static void log_mel_spectrogram_worker_thread(int ith,
     }
 }
 
+// clamping and normalization
+void normalize_log_mel(WhisperFeatures& features) {
+    double mmax = -1e20;
+    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
+        if (features.data[i] > mmax) {
+            mmax = features.data[i];
+        }
+    }
+
+    mmax -= 8.0;
+
+    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
+        if (features.data[i] < mmax) {
+            features.data[i] = mmax;
+        }
+
+        features.data[i] = (features.data[i] + 4.0) / 4.0;
+    }
+}
+
 // python implementation: https://github.com/huggingface/transformers/blob/check_gemma/src/transformers/audio_utils.py
 
 float hertz_to_mel(const float freq) {
@@ -302,19 +245,6 @@ std::vector<std::vector<float>> mel_filter_bank(const int64_t num_frequency_bins
     return mel_filters;
 }
 
-// In FFT, we frequently use sine and cosine operations with the same values.
-// We can use precalculated values to speed up the process.
-void fill_sin_cos_table(std::vector<float>& sin_vals, std::vector<float>& cos_vals, const size_t n_fft) {
-    sin_vals.resize(n_fft);
-    cos_vals.resize(n_fft);
-
-    for (size_t i = 0; i < n_fft; i++) {
-        double theta = (2 * M_PI * i) / n_fft;
-        sin_vals[i] = sinf(theta);
-        cos_vals[i] = cosf(theta);
-    }
-}
-
 std::vector<float> pad(const std::vector<float>& raw_speech,
                        const size_t minimum_length,
                        const size_t reflect_pad_size) {
@@ -343,15 +273,10 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                               const size_t n_fft,
                                               const size_t hop_length,
                                               const size_t n_threads,
+                                              const std::vector<float>& hann,
                                               const std::vector<float>& mel_filter,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
-    // Hanning window (Use cosf to eliminate difference)
-    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
-    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
-    std::vector<float> hann;
-    hann_window(n_fft, true, hann);
-
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_bins,
+                                              const ov::genai::WhisperRealFFT& fft) {
     const size_t reflect_pad_size = n_fft / 2;
     auto padded_raw_speech = pad(raw_speech, sampling_rate * 30, reflect_pad_size);
 
@@ -374,9 +299,9 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                       hop_length,
                                       n_threads,
                                       std::cref(mel_filter),
-                                      std::ref(features),
-                                      std::cref(sin_vals),
-                                      std::cref(cos_vals));
+                                      std::cref(mel_filter_bins),
+                                      std::cref(fft),
+                                      std::ref(features));
         }
 
         // main thread
@@ -388,32 +313,16 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                           hop_length,
                                           n_threads,
                                           mel_filter,
-                                          features,
-                                          sin_vals,
-                                          cos_vals);
+                                          mel_filter_bins,
+                                          fft,
+                                          features);
 
         for (int iw = 0; iw < n_threads - 1; ++iw) {
             workers[iw].join();
         }
     }
 
-    // clamping and normalization
-    double mmax = -1e20;
-    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
-        if (features.data[i] > mmax) {
-            mmax = features.data[i];
-        }
-    }
-
-    mmax -= 8.0;
-
-    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
-        if (features.data[i] < mmax) {
-            features.data[i] = mmax;
-        }
-
-        features.data[i] = (features.data[i] + 4.0) / 4.0;
-    }
+    normalize_log_mel(features);
 
     return features;
 }
@@ -442,7 +351,11 @@ std::vector<float> WhisperFeatures::get_data_with_offset(const size_t frame_offs
 
 WhisperFeatureExtractor::WhisperFeatureExtractor(const std::filesystem::path& preprocessor_json_path) {
     init_parameters(preprocessor_json_path);
-    fill_sin_cos_table(sin_vals, cos_vals, n_fft);
+    fft.emplace(n_fft);
+    // Hanning window (Use cosf to eliminate difference)
+    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
+    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
+    hann_window(n_fft, true, hann);
     init_mel_filter();
 }
 
@@ -477,6 +390,22 @@ void WhisperFeatureExtractor::init_mel_filter() {
             mel_filter[col * mel_data.size() + row] = mel_data[row][col];
         }
     }
+
+    // the triangular filters are nonzero in a narrow band of the frequency bins
+    const size_t n_bins = mel_data.size();
+    mel_filter_bins.assign(feature_size, {0, 0});
+    for (size_t j = 0; j < feature_size; j++) {
+        const float* filter = mel_filter.data() + j * n_bins;
+        size_t begin = 0;
+        while (begin < n_bins && filter[begin] == 0.0f) {
+            begin++;
+        }
+        size_t end = n_bins;
+        while (end > begin && filter[end - 1] == 0.0f) {
+            end--;
+        }
+        mel_filter_bins[j] = {begin, end};
+    }
 }
 
 WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_speech) {
@@ -487,9 +416,129 @@ WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_s
                                          n_fft,
                                          hop_length,
                                          n_threads,
+                                         hann,
                                          mel_filter,
-                                         sin_vals,
-                                         cos_vals);
+                                         mel_filter_bins,
+                                         *fft);
+}
+
+void WhisperFeatureExtractor::extract_log_mel_frame(const float* frame_samples,
+                                                    float* log_mel,
+                                                    const size_t log_mel_stride) const {
+    std::vector<float> fft_in(n_fft);
+    std::vector<float> power;
+    WhisperRealFFT::Buffers fft_buffers;
+    for (size_t i = 0; i < n_fft; i++) {
+        fft_in[i] = hann[i] * frame_samples[i];
+    }
+    log_mel_frame(fft_in.data(),
+                  power,
+                  *fft,
+                  fft_buffers,
+                  mel_filter,
+                  mel_filter_bins,
+                  feature_size,
+                  log_mel,
+                  log_mel_stride);
+}
+
+WhisperFeatureStream::WhisperFeatureStream(const WhisperFeatureExtractor& feature_extractor)
+    : m_feature_extractor(feature_extractor) {}
+
+void WhisperFeatureStream::append(const std::vector<float>& samples) {
+    m_samples.insert(m_samples.end(), samples.begin(), samples.end());
+}
+
+size_t WhisperFeatureStream::get_num_samples() const {
+    return m_samples_offset + m_samples.size() - m_first_frame * m_feature_extractor.hop_length;
+}
+
+float WhisperFeatureStream::get_sample(const int64_t sample_idx) const {
+    // reflect padding at the beginning of the stream
+    const int64_t idx = std::abs(sample_idx);
+    if (idx >= static_cast<int64_t>(m_samples_offset + m_samples.size())) {
+        // the samples not yet received are zeros as the padding of extract()
+        return 0.0f;
+    }
+    OPENVINO_ASSERT(idx >= static_cast<int64_t>(m_samples_offset), "Sample ", idx, " of the stream was dropped");
+    return m_samples[idx - m_samples_offset];
+}
+
+WhisperFeatures WhisperFeatureStream::get_features() {
+    const size_t hop_length = m_feature_extractor.hop_length;
+    const size_t n_fft = m_feature_extractor.n_fft;
+    const size_t feature_size = m_feature_extractor.feature_size;
+    const int64_t reflect_pad_size = n_fft / 2;
+    const int64_t num_received_samples = m_samples_offset + m_samples.size();
+
+    std::vector<float> frame_samples(n_fft);
+    auto get_frame_samples = [&](const size_t frame) {
+        const int64_t window_start = static_cast<int64_t>((m_first_frame + frame) * hop_length) - reflect_pad_size;
+        for (size_t i = 0; i < n_fft; i++) {
+            frame_samples[i] = get_sample(window_start + i);
+        }
+        return window_start;
+    };
+
+    // the frames which windows are received are computed once
+    size_t num_final_frames = m_frames.size() / feature_size;
+    while (static_cast<int64_t>((m_first_frame + num_final_frames) * hop_length) - reflect_pad_size +
+               static_cast<int64_t>(n_fft) <=
+           num_received_samples) {
+        get_frame_samples(num_final_frames);
+        m_frames.resize(m_frames.size() + feature_size);
+        m_feature_extractor.extract_log_mel_frame(frame_samples.data(),
+                                                  m_frames.data() + num_final_frames * feature_size,
+                                                  1);
+        ++num_final_frames;
+    }
+
+    WhisperFeatures features;
+    features.feature_size = feature_size;
+    features.n_frames = std::max(get_num_samples() / hop_length, m_feature_extractor.nb_max_frames);
+    // the frames of zero windows
+    features.data.assign(features.feature_size * features.n_frames, log10(1e-10));
+
+    for (size_t frame = 0; frame < features.n_frames; ++frame) {
+        if (frame < num_final_frames) {
+            for (size_t i = 0; i < feature_size; i++) {
+                features.data[i * features.n_frames + frame] = m_frames[frame * feature_size + i];
+            }
+            continue;
+        }
+
+        if (get_frame_samples(frame) >= num_received_samples) {
+            break;
+        }
+        m_feature_extractor.extract_log_mel_frame(frame_samples.data(),
+                                                  features.data.data() + frame,
+                                                  features.n_frames);
+    }
+
+    normalize_log_mel(features);
+
+    return features;
+}
+
+size_t WhisperFeatureStream::drop(const size_t num_samples) {
+    const size_t hop_length = m_feature_extractor.hop_length;
+    const size_t num_frames = std::min(num_samples, get_num_samples()) / hop_length;
+    const size_t feature_size = m_feature_extractor.feature_size;
+
+    const size_t num_dropped_final_frames = std::min(num_frames, m_frames.size() / feature_size);
+    m_frames.erase(m_frames.begin(), m_frames.begin() + num_dropped_final_frames * feature_size);
+    m_first_frame += num_frames;
+
+    // keep the samples of the window of the first frame
+    const size_t reflect_pad_size = m_feature_extractor.n_fft / 2;
+    const size_t first_frame_sample = m_first_frame * hop_length;
+    const size_t first_sample = first_frame_sample > reflect_pad_size ? first_frame_sample - reflect_pad_size : 0;
+    if (first_sample > m_samples_offset) {
+        m_samples.erase(m_samples.begin(), m_samples.begin() + (first_sample - m_samples_offset));
+        m_samples_offset = first_sample;
+    }
+
+    return num_frames * hop_length;
 }
 
 }  // namespace genai
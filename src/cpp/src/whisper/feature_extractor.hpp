@@ -4,9 +4,12 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "openvino/genai/visibility.hpp"
+#include "whisper/fft.hpp"
 
 namespace ov {
 namespace genai {
@@ -51,14 +54,66 @@ public:
      */
     WhisperFeatures extract(const std::vector<float>& raw_speech);
 
+    /**
+     * @brief Compute a single log-mel spectrogram frame of n_fft samples without the clamping and normalization
+     * applied to the whole spectrogram by extract()
+     *
+     * @param frame_samples n_fft samples of the frame window
+     * @param log_mel feature_size values of the frame, log_mel_stride apart
+     */
+    void extract_log_mel_frame(const float* frame_samples, float* log_mel, const size_t log_mel_stride) const;
+
 private:
-    std::vector<float> sin_vals;
-    std::vector<float> cos_vals;
+    // constructed once n_fft is read from the preprocessor config
+    std::optional<WhisperRealFFT> fft;
     std::vector<float> mel_filter;
+    // [begin, end) of the nonzero frequency bins of each mel filter
+    std::vector<std::pair<size_t, size_t>> mel_filter_bins;
+    std::vector<float> hann;
 
     void init_mel_filter();
     void init_parameters(const std::filesystem::path& preprocessor_json_path);
 };
 
+/**
+ * Log-mel spectrogram of an audio stream, extracted as the samples arrive. The frames which windows are covered by
+ * the received samples are computed once, only the frames at the end of the stream are computed again by each
+ * get_features() call with the not yet received samples as zeros. The stream keeps the samples from the dropped
+ * offset, so that the spectrogram of a sliding window of the stream is extracted incrementally.
+ */
+class WhisperFeatureStream {
+public:
+    explicit WhisperFeatureStream(const WhisperFeatureExtractor& feature_extractor);
+
+    void append(const std::vector<float>& samples);
+
+    /**
+     * @brief Features of the kept samples, padded to nb_max_frames and normalized as extract() does
+     */
+    WhisperFeatures get_features();
+
+    /**
+     * @brief Drop the first samples of the kept ones, rounded down to the hop_length
+     *
+     * @return the number of dropped samples
+     */
+    size_t drop(const size_t num_samples);
+
+    // the number of the kept samples
+    size_t get_num_samples() const;
+
+private:
+    const WhisperFeatureExtractor& m_feature_extractor;
+    std::vector<float> m_samples;
+    // the index of m_samples[0] in the stream
+    size_t m_samples_offset = 0;
+    // the index of the first kept frame in the stream
+    size_t m_first_frame = 0;
+    // [num_frames, feature_size] final frames from m_first_frame
+    std::vector<float> m_frames;
+
+    float get_sample(const int64_t sample_idx) const;
+};
+
 }  // namespace genai
 }  // namespace ov
@@ -0,0 +1,251 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include "whisper/fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+std::vector<size_t> factorize(size_t size) {
+    std::vector<size_t> radices;
+    for (size_t radix : {4, 2}) {
+        while (size % radix == 0) {
+            radices.push_back(radix);
+            size /= radix;
+        }
+    }
+    for (size_t radix = 3; size > 1; radix += 2) {
+        while (size % radix == 0) {
+            radices.push_back(radix);
+            size /= radix;
+        }
+    }
+    return radices;
+}
+
+void radix2(const float* src_re,
+            const float* src_im,
+            float* dst_re,
+            float* dst_im,
+            const float* tw_re,
+            const float* tw_im,
+            const size_t span,
+            const size_t stride) {
+    for (size_t k = 0; k < stride; ++k) {
+        const float a1_re = src_re[k + span] * tw_re[k] - src_im[k + span] * tw_im[k];
+        const float a1_im = src_re[k + span] * tw_im[k] + src_im[k + span] * tw_re[k];
+
+        dst_re[k] = src_re[k] + a1_re;
+        dst_im[k] = src_im[k] + a1_im;
+        dst_re[k + stride] = src_re[k] - a1_re;
+        dst_im[k + stride] = src_im[k] - a1_im;
+    }
+}
+
+void radix4(const float* src_re,
+            const float* src_im,
+            float* dst_re,
+            float* dst_im,
+            const float* tw_re,
+            const float* tw_im,
+            const size_t span,
+            const size_t stride) {
+    const float* tw1_re = tw_re;
+    const float* tw1_im = tw_im;
+    const float* tw2_re = tw_re + stride;
+    const float* tw2_im = tw_im + stride;
+    const float* tw3_re = tw_re + 2 * stride;
+    const float* tw3_im = tw_im + 2 * stride;
+    for (size_t k = 0; k < stride; ++k) {
+        const float a0_re = src_re[k];
+        const float a0_im = src_im[k];
+        const float a1_re = src_re[k + span] * tw1_re[k] - src_im[k + span] * tw1_im[k];
+        const float a1_im = src_re[k + span] * tw1_im[k] + src_im[k + span] * tw1_re[k];
+        const float a2_re = src_re[k + 2 * span] * tw2_re[k] - src_im[k + 2 * span] * tw2_im[k];
+        const float a2_im = src_re[k + 2 * span] * tw2_im[k] + src_im[k + 2 * span] * tw2_re[k];
+        const float a3_re = src_re[k + 3 * span] * tw3_re[k] - src_im[k + 3 * span] * tw3_im[k];
+        const float a3_im = src_re[k + 3 * span] * tw3_im[k] + src_im[k + 3 * span] * tw3_re[k];
+
+        const float t0_re = a0_re + a2_re, t0_im = a0_im + a2_im;
+        const float t1_re = a0_re - a2_re, t1_im = a0_im - a2_im;
+        const float t2_re = a1_re + a3_re, t2_im = a1_im + a3_im;
+        const float t3_re = a1_re - a3_re, t3_im = a1_im - a3_im;
+
+        dst_re[k] = t0_re + t2_re;
+        dst_im[k] = t0_im + t2_im;
+        // t1 - i * t3
+        dst_re[k + stride] = t1_re + t3_im;
+        dst_im[k + stride] = t1_im - t3_re;
+        dst_re[k + 2 * stride] = t0_re - t2_re;
+        dst_im[k + 2 * stride] = t0_im - t2_im;
+        // t1 + i * t3
+        dst_re[k + 3 * stride] = t1_re - t3_im;
+        dst_im[k + 3 * stride] = t1_im + t3_re;
+    }
+}
+
+void radix_odd(const float* src_re,
+               const float* src_im,
+               float* dst_re,
+               float* dst_im,
+               const float* tw_re,
+               const float* tw_im,
+               const float* roots_re,
+               const float* roots_im,
+               const size_t radix,
+               const size_t span,
+               const size_t stride) {
+    for (size_t q = 0; q < radix; ++q) {
+        float* out_re = dst_re + q * stride;
+        float* out_im = dst_im + q * stride;
+        std::copy_n(src_re, stride, out_re);
+        std::copy_n(src_im, stride, out_im);
+
+        for (size_t r = 1; r < radix; ++r) {
+            const float root_re = roots_re[(q * r) % radix];
+            const float root_im = roots_im[(q * r) % radix];
+            const float* in_re = src_re + r * span;
+            const float* in_im = src_im + r * span;
+            const float* w_re = tw_re + (r - 1) * stride;
+            const float* w_im = tw_im + (r - 1) * stride;
+            for (size_t k = 0; k < stride; ++k) {
+                const float a_re = in_re[k] * w_re[k] - in_im[k] * w_im[k];
+                const float a_im = in_re[k] * w_im[k] + in_im[k] * w_re[k];
+                out_re[k] += a_re * root_re - a_im * root_im;
+                out_im[k] += a_re * root_im + a_im * root_re;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+WhisperRealFFT::WhisperRealFFT(const size_t n_fft) : m_n_fft(n_fft), m_size(n_fft / 2) {
+    OPENVINO_ASSERT(n_fft >= 2 && n_fft % 2 == 0, "Real FFT size must be even, got ", n_fft);
+
+    size_t stride = 1;
+    for (size_t radix : factorize(m_size)) {
+        Stage stage;
+        stage.radix = radix;
+        stage.stride = stride;
+        // [radix - 1, stride] twiddles exp(-2 * pi * i * k * r / (stride * radix))
+        stage.twiddles_re.resize((radix - 1) * stride);
+        stage.twiddles_im.resize((radix - 1) * stride);
+        for (size_t r = 1; r < radix; ++r) {
+            for (size_t k = 0; k < stride; ++k) {
+                const double theta = -2.0 * M_PI * double(k * r) / double(stride * radix);
+                stage.twiddles_re[(r - 1) * stride + k] = static_cast<float>(std::cos(theta));
+                stage.twiddles_im[(r - 1) * stride + k] = static_cast<float>(std::sin(theta));
+            }
+        }
+        if (radix != 2 && radix != 4) {
+            stage.roots_re.resize(radix);
+            stage.roots_im.resize(radix);
+            for (size_t q = 0; q < radix; ++q) {
+                const double theta = -2.0 * M_PI * double(q) / double(radix);
+                stage.roots_re[q] = static_cast<float>(std::cos(theta));
+                stage.roots_im[q] = static_cast<float>(std::sin(theta));
+            }
+        }
+        m_stages.push_back(std::move(stage));
+        stride *= radix;
+    }
+
+    m_unpack_re.resize(m_size + 1);
+    m_unpack_im.resize(m_size + 1);
+    for (size_t k = 0; k <= m_size; ++k) {
+        const double theta = -2.0 * M_PI * double(k) / double(n_fft);
+        m_unpack_re[k] = static_cast<float>(std::cos(theta));
+        m_unpack_im[k] = static_cast<float>(std::sin(theta));
+    }
+}
+
+void WhisperRealFFT::complex_fft(Buffers& buffers) const {
+    buffers.work_re.resize(m_size);
+    buffers.work_im.resize(m_size);
+
+    float* in_re = buffers.re.data();
+    float* in_im = buffers.im.data();
+    float* out_re = buffers.work_re.data();
+    float* out_im = buffers.work_im.data();
+
+    for (const Stage& stage : m_stages) {
+        const size_t span = m_size / stage.radix;
+        const size_t num_blocks = span / stage.stride;
+        for (size_t block = 0; block < num_blocks; ++block) {
+            const float* src_re = in_re + block * stage.stride;
+            const float* src_im = in_im + block * stage.stride;
+            float* dst_re = out_re + block * stage.stride * stage.radix;
+            float* dst_im = out_im + block * stage.stride * stage.radix;
+            const float* tw_re = stage.twiddles_re.data();
+            const float* tw_im = stage.twiddles_im.data();
+            if (stage.radix == 4) {
+                radix4(src_re, src_im, dst_re, dst_im, tw_re, tw_im, span, stage.stride);
+            } else if (stage.radix == 2) {
+                radix2(src_re, src_im, dst_re, dst_im, tw_re, tw_im, span, stage.stride);
+            } else {
+                radix_odd(src_re,
+                          src_im,
+                          dst_re,
+                          dst_im,
+                          tw_re,
+                          tw_im,
+                          stage.roots_re.data(),
+                          stage.roots_im.data(),
+                          stage.radix,
+                          span,
+                          stage.stride);
+            }
+        }
+        std::swap(in_re, out_re);
+        std::swap(in_im, out_im);
+    }
+
+    if (in_re != buffers.re.data()) {
+        std::swap(buffers.re, buffers.work_re);
+        std::swap(buffers.im, buffers.work_im);
+    }
+}
+
+void WhisperRealFFT::power_spectrum(const float* samples, float* power, Buffers& buffers) const {
+    buffers.re.resize(m_size);
+    buffers.im.resize(m_size);
+    // the even samples are the real parts and the odd samples are the imaginary parts
+    for (size_t j = 0; j < m_size; ++j) {
+        buffers.re[j] = samples[2 * j];
+        buffers.im[j] = samples[2 * j + 1];
+    }
+
+    complex_fft(buffers);
+
+    const float* z_re = buffers.re.data();
+    const float* z_im = buffers.im.data();
+    // the transforms of the even and odd samples are combined into the bin k as
+    // X[k] = (Z[k] + conj(Z[m - k])) / 2 + exp(-2 * pi * i * k / n_fft) * (Z[k] - conj(Z[m - k])) / 2i
+    for (size_t k = 0; k <= m_size; ++k) {
+        const size_t idx = k == m_size ? 0 : k;
+        const size_t mirror_idx = k == 0 ? 0 : m_size - k;
+        const float even_re = 0.5f * (z_re[idx] + z_re[mirror_idx]);
+        const float even_im = 0.5f * (z_im[idx] - z_im[mirror_idx]);
+        const float odd_re = 0.5f * (z_im[idx] + z_im[mirror_idx]);
+        const float odd_im = -0.5f * (z_re[idx] - z_re[mirror_idx]);
+
+        const float x_re = even_re + m_unpack_re[k] * odd_re - m_unpack_im[k] * odd_im;
+        const float x_im = even_im + m_unpack_re[k] * odd_im + m_unpack_im[k] * odd_re;
+        power[k] = x_re * x_re + x_im * x_im;
+    }
+}
+
+}  // namespace genai
+}  // namespace ov
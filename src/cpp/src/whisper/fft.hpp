@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+/**
+ * Real FFT of a fixed size for the spectrogram frames. The samples are packed into a complex sequence of the half
+ * size, which is transformed by the iterative mixed radix Stockham FFT: radix 4 and 2 stages, then the remaining odd
+ * factors, e.g. 25 of the 400 samples window of Whisper, by the stages of their size. The twiddles of all the stages
+ * are precomputed, the complex values are stored as separate real and imaginary arrays, so that the butterflies over
+ * the contiguous values of a stage are vectorized by the compiler.
+ */
+class WhisperRealFFT {
+public:
+    // per thread buffers of the transform
+    struct Buffers {
+        std::vector<float> re;
+        std::vector<float> im;
+        std::vector<float> work_re;
+        std::vector<float> work_im;
+    };
+
+    explicit WhisperRealFFT(const size_t n_fft);
+
+    /**
+     * @brief Compute the squared magnitudes of the frequency bins of the real samples
+     *
+     * @param samples n_fft samples
+     * @param power n_fft / 2 + 1 bins
+     */
+    void power_spectrum(const float* samples, float* power, Buffers& buffers) const;
+
+    size_t get_size() const {
+        return m_n_fft;
+    }
+
+private:
+    struct Stage {
+        size_t radix;
+        // the size of the transforms combined by the stage
+        size_t stride;
+        // [radix - 1, stride] twiddles of the transforms inputs
+        std::vector<float> twiddles_re;
+        std::vector<float> twiddles_im;
+        // radix roots of unity for the odd radices
+        std::vector<float> roots_re;
+        std::vector<float> roots_im;
+    };
+
+    size_t m_n_fft;
+    // the complex transform size
+    size_t m_size;
+    std::vector<Stage> m_stages;
+    // exp(-2 * pi * i * k / n_fft) unpacking the real transform
+    std::vector<float> m_unpack_re;
+    std::vector<float> m_unpack_im;
+
+    // transforms re and im in place
+    void complex_fft(Buffers& buffers) const;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -42,6 +42,7 @@ WhisperGenerationConfig::WhisperGenerationConfig(const std::filesystem::path& js
     }
 
     read_json_param(data, "lang_to_id", lang_to_id);
+    read_json_param(data, "alignment_heads", alignment_heads);
 
     apply_chat_template = false;
 }
@@ -64,6 +65,10 @@ void WhisperGenerationConfig::update_generation_config(const ov::AnyMap& config_
     read_anymap_param(config_map, "return_timestamps", return_timestamps);
     read_anymap_param(config_map, "initial_prompt", initial_prompt);
     read_anymap_param(config_map, "hotwords", hotwords);
+    read_anymap_param(config_map, "stride_length", stride_length);
+    read_anymap_param(config_map, "vad_filter", vad_filter);
+    read_anymap_param(config_map, "word_timestamps", word_timestamps);
+    read_anymap_param(config_map, "alignment_heads", alignment_heads);
 
     GenerationConfig::update_generation_config(config_map);
 }
@@ -93,7 +98,21 @@ void WhisperGenerationConfig::validate() const {
                     num_return_sequences,
                     ".");
 
-    OPENVINO_ASSERT(!is_assisting_generation(), "Assisted generation is not supported.");
+    if (is_assisting_generation()) {
+        OPENVINO_ASSERT(!do_sample, "Assisted generation is supported for greedy decoding only.");
+        OPENVINO_ASSERT(!is_prompt_lookup(), "Prompt lookup decoding is not supported.");
+    }
+
+    if (word_timestamps) {
+        OPENVINO_ASSERT(num_beams == 1, "Word timestamps are supported for greedy and multinomial decoding only.");
+        OPENVINO_ASSERT(!is_assisting_generation(), "Word timestamps are not supported with assisted generation.");
+        OPENVINO_ASSERT(!alignment_heads.empty(),
+                        "Word timestamps require 'alignment_heads' to be provided in generation_config.json.");
+    }
+
+    if (stride_length.has_value()) {
+        OPENVINO_ASSERT(*stride_length >= 0.0f, "'stride_length' must be non-negative. Provided: ", *stride_length, ".");
+    }
 }
 }  // namespace genai
 }  // namespace ov
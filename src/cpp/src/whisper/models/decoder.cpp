@@ -12,14 +12,20 @@
 namespace ov::genai {
 std::shared_ptr<WhisperDecoder> WhisperDecoder::from_path(const std::filesystem::path& models_path,
                                                           const std::string& device,
-                                                          const ov::AnyMap& properties) {
+                                                          const ov::AnyMap& properties,
+                                                          const bool output_all_logits,
+                                                          const std::vector<std::pair<size_t, size_t>>& alignment_heads) {
     bool has_decoder_with_past = std::filesystem::exists(models_path / "openvino_decoder_with_past_model.xml");
 
+    // the decoder with past outputs the logits of all the input tokens
     if (has_decoder_with_past) {
+        OPENVINO_ASSERT(alignment_heads.empty(),
+                        "Word timestamps require the stateful decoder model, export the model with the latest "
+                        "`optimum-intel` package.");
         return std::make_shared<WhisperWithPastDecoder>(models_path, device, properties);
     }
 
-    return std::make_shared<WhisperStatefullDecoder>(models_path, device, properties);
+    return std::make_shared<WhisperStatefullDecoder>(models_path, device, properties, output_all_logits, alignment_heads);
 }
 
 std::pair<int64_t, float> WhisperDecoder::detect_language(const ov::Tensor& encoder_hidden_state,
@@ -44,13 +50,21 @@ std::pair<int64_t, float> WhisperDecoder::detect_language(const ov::Tensor& enco
 }
 
 /**
- * Encoder hidden states expected to be with batch 1
+ * Encoder hidden states expected to be with batch 1 or with the hidden states of each row of the batch.
  * Expand encoder hidden state tensor from batch 1 to requested batch_size.
  * Set new encoder hidden states tensor to infer request.
  */
 void WhisperDecoder::_set_encoder_hidden_states_tensor(const Tensor& encoder_hidden_state,
                                                        const size_t batch_size,
                                                        InferRequest& request) {
+    // hidden states of several requests decoded together, the rows may change while the batch size remains the same
+    if (encoder_hidden_state.get_shape().at(0) > 1) {
+        OPENVINO_ASSERT(encoder_hidden_state.get_shape().at(0) == batch_size,
+                        "Encoder hidden states batch doesn't match the decoder batch size");
+        request.set_tensor("encoder_hidden_states", encoder_hidden_state);
+        return;
+    }
+
     const size_t current_batch_size = request.get_tensor("encoder_hidden_states").get_shape().at(0);
     // batch hasn't changed, skip
     if (current_batch_size == batch_size) {
@@ -82,6 +96,10 @@ void WhisperDecoder::_set_encoder_hidden_states_tensor(const Tensor& encoder_hid
     request.set_tensor("encoder_hidden_states", new_encoder_hidden_states);
 }
 
+ov::Tensor WhisperDecoder::get_cross_attention_weights() {
+    OPENVINO_THROW("The decoder is created without the alignment heads, cross-attention weights are not available");
+}
+
 ov::Tensor WhisperDecoder::create_host_tensor(const element::Type element_type, const Shape& shape) {
     return ov::Tensor(element_type, shape);
 }
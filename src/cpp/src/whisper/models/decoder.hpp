@@ -11,9 +11,17 @@
 namespace ov::genai {
 class WhisperDecoder {
 public:
+    /**
+     * @param output_all_logits Whether the logits of all the input tokens are returned instead of the logits of the
+     * last one, e.g. to validate the candidates of assisted generation in a single inference.
+     * @param alignment_heads The (layer, head) pairs of the cross-attention heads whose weights are returned by
+     * get_cross_attention_weights(), for the word timestamps.
+     */
     static std::shared_ptr<WhisperDecoder> from_path(const std::filesystem::path& models_path,
                                                      const std::string& device,
-                                                     const ov::AnyMap& properties);
+                                                     const ov::AnyMap& properties,
+                                                     const bool output_all_logits = false,
+                                                     const std::vector<std::pair<size_t, size_t>>& alignment_heads = {});
 
     std::pair<int64_t, float> detect_language(const Tensor& encoder_hidden_state, const int64_t decoder_start_token_id);
 
@@ -23,6 +31,14 @@ public:
 
     virtual void reset_state() = 0;
 
+    // removes the key values of the last num_tokens tokens of the batch 1, e.g. of the rejected assisted generation
+    // candidates, so that the decoding continues from the tokens before them
+    virtual void trim_kv_cache(const size_t num_tokens) = 0;
+
+    // the [batch_size, num_alignment_heads, 1, num_frames] cross-attention weights of the last input token of the last
+    // inference, if the decoder is created with the alignment heads
+    virtual Tensor get_cross_attention_weights();
+
     virtual ~WhisperDecoder();
 
     virtual ov::Tensor create_host_tensor(const element::Type element_type, const Shape& shape);
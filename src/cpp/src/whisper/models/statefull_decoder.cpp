@@ -3,17 +3,141 @@
 
 #include "statefull_decoder.hpp"
 
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/softmax.hpp"
 #include "utils.hpp"
 
+namespace {
+// the cross-attention of each decoder layer, in the order of the layers
+std::vector<std::shared_ptr<ov::Node>> find_cross_attentions(const std::shared_ptr<ov::Model>& model) {
+    std::vector<std::shared_ptr<ov::Node>> attentions;
+    std::vector<std::shared_ptr<ov::Node>> cross_attentions;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (!ov::is_type<ov::op::v13::ScaledDotProductAttention>(node)) {
+            continue;
+        }
+        attentions.push_back(node);
+        if (node->get_friendly_name().find("encoder_attn") != std::string::npos) {
+            cross_attentions.push_back(node);
+        }
+    }
+
+    // the self-attention and the cross-attention alternate in each layer
+    if (cross_attentions.empty()) {
+        for (size_t idx = 1; idx < attentions.size(); idx += 2) {
+            cross_attentions.push_back(attentions[idx]);
+        }
+    }
+    return cross_attentions;
+}
+
+// adds the "cross_attention_weights" output of the [batch_size, num_alignment_heads, 1, num_frames] softmax of the
+// queries of the last token by the keys of the encoder hidden states, the fused attention ops don't expose them
+void add_cross_attention_weights_output(std::shared_ptr<ov::Model> model,
+                                        const std::vector<std::pair<size_t, size_t>>& alignment_heads) {
+    const std::vector<std::shared_ptr<ov::Node>> cross_attentions = find_cross_attentions(model);
+
+    std::map<size_t, std::vector<int64_t>> layer_to_heads;
+    for (const auto& [layer, head] : alignment_heads) {
+        OPENVINO_ASSERT(layer < cross_attentions.size(),
+                        "Alignment head layer ",
+                        layer,
+                        " is out of the ",
+                        cross_attentions.size(),
+                        " decoder cross-attention layers");
+        layer_to_heads[layer].push_back(static_cast<int64_t>(head));
+    }
+
+    auto i64_constant = [](const std::vector<int64_t>& values) {
+        return std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{values.size()}, values);
+    };
+    auto heads_axis = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{1});
+
+    ov::OutputVector layer_weights;
+    for (const auto& [layer, heads] : layer_to_heads) {
+        const std::shared_ptr<ov::Node>& attention = cross_attentions[layer];
+        // [batch_size, num_heads, seq_len, head_size] and [batch_size, num_heads, num_frames, head_size]
+        ov::Output<ov::Node> query = attention->input_value(0);
+        ov::Output<ov::Node> key = attention->input_value(1);
+
+        const ov::PartialShape& query_shape = query.get_partial_shape();
+        OPENVINO_ASSERT(query_shape.rank().is_static() && query_shape.rank().get_length() == 4 &&
+                            query_shape[1].is_static() && query_shape[3].is_static(),
+                        "Decoder cross-attention query is expected to have static number of heads and head size");
+        for (const int64_t head : heads) {
+            OPENVINO_ASSERT(head < query_shape[1].get_length(),
+                            "Alignment head ",
+                            head,
+                            " is out of the ",
+                            query_shape[1].get_length(),
+                            " cross-attention heads");
+        }
+
+        auto last_query = std::make_shared<ov::op::v8::Slice>(query,
+                                                              i64_constant({-1}),
+                                                              i64_constant({std::numeric_limits<int64_t>::max()}),
+                                                              i64_constant({1}),
+                                                              i64_constant({2}));
+        auto heads_idxs = i64_constant(heads);
+        auto head_query = std::make_shared<ov::op::v8::Gather>(last_query, heads_idxs, heads_axis);
+        auto head_key = std::make_shared<ov::op::v8::Gather>(key, heads_idxs, heads_axis);
+        auto scores = std::make_shared<ov::op::v0::MatMul>(head_query, head_key, false, true);
+
+        // the scale input is optional, it's 1 / sqrt(head_size) by default
+        ov::Output<ov::Node> scale;
+        if (attention->get_input_size() > 4) {
+            scale = attention->input_value(4);
+        } else {
+            const float head_scale = 1.0f / std::sqrt(static_cast<float>(query_shape[3].get_length()));
+            scale = std::make_shared<ov::op::v0::Constant>(query.get_element_type(),
+                                                           ov::Shape{},
+                                                           std::vector<float>{head_scale});
+        }
+
+        auto scaled_scores = std::make_shared<ov::op::v1::Multiply>(scores, scale);
+        std::shared_ptr<ov::Node> weights = std::make_shared<ov::op::v8::Softmax>(scaled_scores, -1);
+        if (weights->get_output_element_type(0) != ov::element::f32) {
+            weights = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+        }
+        layer_weights.push_back(weights);
+    }
+
+    auto weights = std::make_shared<ov::op::v0::Concat>(layer_weights, 1);
+    auto weights_result = std::make_shared<ov::op::v0::Result>(weights);
+    weights_result->output(0).get_tensor().set_names({"cross_attention_weights"});
+    model->add_results({weights_result});
+}
+}  // namespace
+
 namespace ov::genai {
 WhisperStatefullDecoder::WhisperStatefullDecoder(const std::filesystem::path& models_path,
                                                  const std::string& device,
-                                                 const ov::AnyMap& properties) {
+                                                 const ov::AnyMap& properties,
+                                                 const bool output_all_logits,
+                                                 const std::vector<std::pair<size_t, size_t>>& alignment_heads) {
     ov::Core core = utils::singleton_core();
 
     auto model = core.read_model(models_path / "openvino_decoder_model.xml", {}, properties);
 
-    utils::apply_slice_before_matmul_transformation(model);
+    if (!output_all_logits) {
+        utils::apply_slice_before_matmul_transformation(model);
+    }
+
+    if (!alignment_heads.empty()) {
+        add_cross_attention_weights_output(model, alignment_heads);
+    }
 
     auto compiled_model = core.compile_model(model, device, properties);
 
@@ -56,6 +180,10 @@ Tensor WhisperStatefullDecoder::wait() {
     return m_request.get_tensor("logits");
 }
 
+Tensor WhisperStatefullDecoder::get_cross_attention_weights() {
+    return m_request.get_tensor("cross_attention_weights");
+}
+
 void WhisperStatefullDecoder::reset_state() {
     m_request.reset_state();
     m_request.set_tensor("cache_position", create_host_tensor(ov::element::i64, {0}));
@@ -66,6 +194,38 @@ void WhisperStatefullDecoder::reset_state() {
     m_request.set_tensor("encoder_hidden_states", create_host_tensor(ov::element::f32, encoder_hidden_states_shape));
 };
 
+void WhisperStatefullDecoder::trim_kv_cache(const size_t num_tokens) {
+    if (num_tokens == 0) {
+        return;
+    }
+
+    ov::Tensor cache_position_tensor = m_request.get_tensor("cache_position");
+    OPENVINO_ASSERT(cache_position_tensor.get_size() != 0, "Decoder key values are empty");
+    const size_t cache_len = cache_position_tensor.data<int64_t>()[cache_position_tensor.get_size() - 1] + 1;
+    OPENVINO_ASSERT(num_tokens <= cache_len, "Cannot trim ", num_tokens, " tokens of ", cache_len, " decoder key values");
+
+    for (auto& state : m_request.query_state()) {
+        ov::Tensor old_tensor = state.get_state();
+        // [batch_size, num_heads, seq_len, head_size], the cross-attention key values have the length of the encoder
+        // hidden states and are kept
+        ov::Shape shape = old_tensor.get_shape();
+        if (shape.size() != 4 || shape[2] != cache_len) {
+            continue;
+        }
+        OPENVINO_ASSERT(shape[0] == 1, "Decoder key values are trimmed for batch 1 only");
+        shape[2] -= num_tokens;
+
+        ov::Tensor trimmed_tensor{old_tensor, ov::Coordinate{0, 0, 0, 0}, ov::Coordinate{shape}};
+        ov::Tensor new_tensor{old_tensor.get_element_type(), shape};
+        trimmed_tensor.copy_to(new_tensor);
+        state.set_state(new_tensor);
+    }
+
+    // the next tokens continue from the last kept position
+    cache_position_tensor.set_shape({1});
+    cache_position_tensor.data<int64_t>()[0] = static_cast<int64_t>(cache_len - num_tokens) - 1;
+}
+
 ov::Tensor WhisperStatefullDecoder::create_host_tensor(const element::Type element_type, const Shape& shape) {
     try {
         return m_request.get_compiled_model().get_context().create_host_tensor(element_type, shape);
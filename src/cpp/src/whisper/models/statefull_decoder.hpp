@@ -12,7 +12,9 @@ class WhisperStatefullDecoder : public WhisperDecoder {
 public:
     WhisperStatefullDecoder(const std::filesystem::path& models_path,
                             const std::string& device,
-                            const ov::AnyMap& properties);
+                            const ov::AnyMap& properties,
+                            const bool output_all_logits = false,
+                            const std::vector<std::pair<size_t, size_t>>& alignment_heads = {});
 
     void start_async(const Tensor& encoder_hidden_state, const Tensor& input_ids, const Tensor& beam_idx) override;
 
@@ -20,6 +22,10 @@ public:
 
     void reset_state() override;
 
+    void trim_kv_cache(const size_t num_tokens) override;
+
+    Tensor get_cross_attention_weights() override;
+
     ov::Tensor create_host_tensor(const element::Type element_type, const Shape& shape) override;
 
 private:
@@ -34,7 +34,10 @@ void copy_with_beam_gather(const ov::Tensor& source, ov::Tensor& dest, const ov:
     }
 }
 
-void copy_past_key_value(ov::InferRequest& source, ov::InferRequest& dest, const ov::Tensor& beam_idx) {
+void copy_past_key_value(ov::InferRequest& source,
+                         ov::InferRequest& dest,
+                         const ov::Tensor& beam_idx,
+                         const bool copy_cross_attn) {
     // source outputs:
     // present.0.decoder.key
     // present.0.decoder.value
@@ -52,6 +55,9 @@ void copy_past_key_value(ov::InferRequest& source, ov::InferRequest& dest, const
         if (source_output_name.find("present") == std::string::npos) {
             continue;
         }
+        if (!copy_cross_attn && source_output_name.find("encoder") != std::string::npos) {
+            continue;
+        }
 
         std::string dest_input_name = std::regex_replace(source_output_name, std::regex("present"), "past_key_values");
 
@@ -62,6 +68,21 @@ void copy_past_key_value(ov::InferRequest& source, ov::InferRequest& dest, const
     }
 }
 
+// reorders the rows of the cross-attention key values inputs, which the decoder with past doesn't output
+void gather_cross_attn_key_value(ov::InferRequest& request, const ov::Tensor& beam_idx) {
+    for (auto& input : request.get_compiled_model().inputs()) {
+        std::string input_name = input.get_any_name();
+        if (input_name.find("past_key_values") == std::string::npos || input_name.find("encoder") == std::string::npos) {
+            continue;
+        }
+
+        const ov::Tensor source_tensor = request.get_tensor(input_name);
+        ov::Tensor dest_tensor{source_tensor.get_element_type(), source_tensor.get_shape()};
+        copy_with_beam_gather(source_tensor, dest_tensor, beam_idx);
+        request.set_tensor(input_name, dest_tensor);
+    }
+}
+
 void link_past_key_value(ov::InferRequest& source, ov::InferRequest& dest) {
     for (auto& source_output : source.get_compiled_model().outputs()) {
         std::string source_output_name = source_output.get_any_name();
@@ -115,7 +136,7 @@ void WhisperWithPastDecoder::start_async(const Tensor& encoder_hidden_state,
         cache_position_tensor.data<int64_t>()[0] = m_cache_position;
     }
 
-    _set_past_key_value(beam_idx);
+    _set_past_key_value(beam_idx, encoder_hidden_state);
 
     request.start_async();
 }
@@ -133,12 +154,17 @@ Tensor WhisperWithPastDecoder::wait() {
     return request.get_tensor("logits");
 }
 
-void WhisperWithPastDecoder::_set_past_key_value(const Tensor& beam_idx) {
+void WhisperWithPastDecoder::_set_past_key_value(const Tensor& beam_idx, const Tensor& encoder_hidden_state) {
     const bool is_initial_step = m_cache_position == 0;
     if (is_initial_step) {
         return;
     }
 
+    if (m_past_key_value_trimmed) {
+        m_past_key_value_trimmed = false;
+        return;
+    }
+
     const size_t batch_size = beam_idx.get_shape().at(0);
     // no copy needed, just 'link' output tensor with input tensor
     const bool can_link_past_key_value = batch_size == 1 && beam_idx.data<int32_t>()[0] == 0;
@@ -147,10 +173,12 @@ void WhisperWithPastDecoder::_set_past_key_value(const Tensor& beam_idx) {
         if (can_link_past_key_value) {
             link_past_key_value(m_request_decoder, m_request_decoder_with_past);
         } else {
-            copy_past_key_value(m_request_decoder, m_request_decoder_with_past, beam_idx);
+            copy_past_key_value(m_request_decoder, m_request_decoder_with_past, beam_idx, true);
         }
 
         m_initial_past_key_value_set = true;
+        m_cross_attn_batch_size = batch_size;
+        m_cross_attn_hidden_state = encoder_hidden_state.data();
         return;
     }
 
@@ -162,15 +190,74 @@ void WhisperWithPastDecoder::_set_past_key_value(const Tensor& beam_idx) {
         link_past_key_value(m_request_decoder_with_past, m_request_decoder_with_past);
         m_past_key_value_linked = true;
     } else {
-        copy_past_key_value(m_request_decoder_with_past, m_request_decoder_with_past, beam_idx);
+        copy_past_key_value(m_request_decoder_with_past, m_request_decoder_with_past, beam_idx, false);
+    }
+
+    // The cross-attention key values are computed once per window by the initial step. The rows of the same request
+    // are equal, so they are reordered only if the rows change their requests, i.e. the batch or its encoder hidden
+    // states change.
+    if (batch_size != m_cross_attn_batch_size || encoder_hidden_state.data() != m_cross_attn_hidden_state) {
+        gather_cross_attn_key_value(m_request_decoder_with_past, beam_idx);
+        m_cross_attn_batch_size = batch_size;
+        m_cross_attn_hidden_state = encoder_hidden_state.data();
     }
 };
 
+void WhisperWithPastDecoder::trim_kv_cache(const size_t num_tokens) {
+    if (num_tokens == 0) {
+        return;
+    }
+
+    OPENVINO_ASSERT(num_tokens <= m_cache_position,
+                    "Cannot trim ",
+                    num_tokens,
+                    " tokens of ",
+                    m_cache_position,
+                    " decoder key values");
+
+    // the key values are the outputs of the last step, the decoder with past doesn't output the cross-attention ones
+    ov::InferRequest& source = m_initial_past_key_value_set ? m_request_decoder_with_past : m_request_decoder;
+    for (auto& source_output : source.get_compiled_model().outputs()) {
+        std::string source_output_name = source_output.get_any_name();
+        if (source_output_name.find("present") == std::string::npos) {
+            continue;
+        }
+
+        std::string dest_input_name = std::regex_replace(source_output_name, std::regex("present"), "past_key_values");
+        ov::Tensor source_tensor = source.get_tensor(source_output_name);
+
+        if (source_output_name.find("encoder") != std::string::npos) {
+            m_request_decoder_with_past.set_tensor(dest_input_name, source_tensor);
+            m_cross_attn_batch_size = source_tensor.get_shape().at(0);
+            m_cross_attn_hidden_state = source.get_tensor("encoder_hidden_states").data();
+            continue;
+        }
+
+        // [batch_size, num_heads, seq_len, head_size]
+        ov::Shape shape = source_tensor.get_shape();
+        OPENVINO_ASSERT(shape.size() == 4 && shape[0] == 1, "Decoder key values are trimmed for batch 1 only");
+        shape[2] -= num_tokens;
+
+        ov::Tensor trimmed_tensor{source_tensor, ov::Coordinate{0, 0, 0, 0}, ov::Coordinate{shape}};
+        ov::Tensor dest_tensor{source_tensor.get_element_type(), shape};
+        trimmed_tensor.copy_to(dest_tensor);
+        m_request_decoder_with_past.set_tensor(dest_input_name, dest_tensor);
+    }
+
+    m_cache_position -= num_tokens;
+    m_initial_past_key_value_set = true;
+    m_past_key_value_linked = false;
+    m_past_key_value_trimmed = true;
+}
+
 void WhisperWithPastDecoder::reset_state() {
     m_request_decoder_with_past.reset_state();
     m_cache_position = 0;
     m_initial_past_key_value_set = false;
     m_past_key_value_linked = false;
+    m_cross_attn_batch_size = 0;
+    m_cross_attn_hidden_state = nullptr;
+    m_past_key_value_trimmed = false;
 
     Shape encoder_hidden_states_shape{m_request_decoder_with_past.get_tensor("encoder_hidden_states").get_shape()};
     encoder_hidden_states_shape[0] = 0;
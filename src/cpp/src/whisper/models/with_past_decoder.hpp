@@ -20,14 +20,21 @@ public:
 
     void reset_state() override;
 
+    void trim_kv_cache(const size_t num_tokens) override;
+
 private:
     ov::InferRequest m_request_decoder;
     ov::InferRequest m_request_decoder_with_past;
     size_t m_cache_position = 0;
     bool m_initial_past_key_value_set = false;
     bool m_past_key_value_linked = false;
+    // the batch size and the encoder hidden states of the current cross-attention key values rows
+    size_t m_cross_attn_batch_size = 0;
+    const void* m_cross_attn_hidden_state = nullptr;
+    // the trimmed key values are set as the inputs of the next step
+    bool m_past_key_value_trimmed = false;
 
-    void _set_past_key_value(const Tensor& beam_idx);
+    void _set_past_key_value(const Tensor& beam_idx, const Tensor& encoder_hidden_state);
 };
 
 }  // namespace ov::genai
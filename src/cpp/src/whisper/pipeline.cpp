@@ -18,8 +18,14 @@
 #include "whisper/models.hpp"
 #include "whisper/pipeline_base.hpp"
 #include "whisper/pipeline_static.hpp"
+#include "whisper/streaming.hpp"
+#include "whisper/vad.hpp"
+#include "whisper/word_timestamps.hpp"
 
 namespace {
+// the candidates drafted per step, if the generation config of the pipeline with the draft decoder doesn't set them
+constexpr size_t default_num_assistant_tokens = 5;
+
 ov::genai::OptionalWhisperGenerationConfig get_config_from_map(const ov::AnyMap& config_map) {
     if (config_map.count("generation_config")) {
         return config_map.at("generation_config").as<ov::genai::WhisperGenerationConfig>();
@@ -51,17 +57,43 @@ class WhisperPipeline::WhisperPipelineStatefulImpl : public WhisperPipeline::Whi
 public:
     WhisperPipelineStatefulImpl(const std::filesystem::path& models_path,
                                 const std::string& device,
-                                const ov::AnyMap& properties)
+                                const ov::AnyMap& external_properties)
         : WhisperPipelineImplBase{models_path},
           m_sampler(m_tokenizer) {
         ov::Core core = utils::singleton_core();
 
+        ov::AnyMap properties = external_properties;
+        const std::optional<ov::Any> draft_decoder_path = utils::pop_option(properties, ov::genai::draft_decoder_path.name());
+        const std::optional<ov::Any> word_timestamps = utils::pop_option(properties, ov::genai::word_timestamps.name());
+
         ov::CompiledModel compiled_model =
             core.compile_model(models_path / "openvino_encoder_model.xml", device, properties);
         ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper encoder model");
         m_encoder = init_model(compiled_model);
 
-        m_decoder = WhisperDecoder::from_path(models_path, device, properties);
+        // the decoder computes the cross-attention weights of the alignment heads for the word timestamps
+        if (word_timestamps.has_value() && word_timestamps->as<bool>()) {
+            OPENVINO_ASSERT(!m_generation_config.alignment_heads.empty(),
+                            "Word timestamps require 'alignment_heads' to be provided in generation_config.json.");
+            m_alignment_heads = m_generation_config.alignment_heads;
+        }
+
+        // the decoder validates all the candidates of the draft decoder in a single inference
+        m_decoder =
+            WhisperDecoder::from_path(models_path, device, properties, draft_decoder_path.has_value(), m_alignment_heads);
+
+        if (draft_decoder_path.has_value()) {
+            const std::filesystem::path draft_models_path = draft_decoder_path->as<std::string>();
+            const WhisperConfig draft_model_config{draft_models_path / "config.json"};
+            OPENVINO_ASSERT(draft_model_config.max_source_positions == m_model_config.max_source_positions,
+                            "Draft decoder is expected to attend to the encoder hidden states of the same length");
+            m_draft_decoder = WhisperDecoder::from_path(draft_models_path, device, properties);
+
+            // the draft decoder is used by default
+            if (!m_generation_config.is_assisting_generation()) {
+                m_generation_config.num_assistant_tokens = default_num_assistant_tokens;
+            }
+        }
 
         // If eos_token_id was not provided, take value
         if (m_generation_config.eos_token_id == -1) {
@@ -75,6 +107,145 @@ public:
                                    OptionalWhisperGenerationConfig generation_config,
                                    const std::shared_ptr<StreamerBase> streamer) override {
         auto start_time = std::chrono::steady_clock::now();
+        WhisperGenerationConfig config = prepare_generation_config(generation_config);
+
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+
+        if (!config.vad_filter) {
+            auto generate_result = generate_speech(config, context_tokens, raw_speech_input, streamer);
+            return decode_result(generate_result, tokenization_duration_microseconds, start_time);
+        }
+
+        const WhisperPackedSpeech speech(
+            raw_speech_input,
+            detect_speech_regions(raw_speech_input, m_feature_extractor.sampling_rate),
+            m_feature_extractor.sampling_rate);
+        if (speech.get_samples().empty()) {
+            if (streamer) {
+                streamer->end();
+            }
+            auto generate_result = get_no_speech_result(config);
+            return decode_result(generate_result, tokenization_duration_microseconds, start_time);
+        }
+
+        auto generate_result = generate_speech(config, context_tokens, speech.get_samples(), streamer);
+        if (generate_result.segments.has_value()) {
+            speech.to_original_segments(*generate_result.segments);
+        }
+        if (generate_result.token_times.has_value()) {
+            for (auto& [start, end] : *generate_result.token_times) {
+                start = speech.to_original_time(start);
+                end = std::max(start, speech.to_original_time(end, true));
+            }
+        }
+        return decode_result(generate_result, tokenization_duration_microseconds, start_time);
+    }
+
+    std::vector<WhisperDecodedResults> generate_batch(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                      OptionalWhisperGenerationConfig generation_config) override {
+        auto start_time = std::chrono::steady_clock::now();
+        WhisperGenerationConfig config = prepare_generation_config(generation_config);
+
+        OPENVINO_ASSERT(!config.word_timestamps, "Word timestamps are not supported for the batch of inputs.");
+
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+
+        if (!config.vad_filter) {
+            auto generate_results = ov::genai::whisper_generate_batch(config,
+                                                                      m_model_config,
+                                                                      context_tokens,
+                                                                      raw_speech_inputs,
+                                                                      get_batch_encoder(),
+                                                                      m_decoder,
+                                                                      m_feature_extractor,
+                                                                      m_sampler);
+            std::vector<WhisperDecodedResults> results;
+            results.reserve(generate_results.size());
+            for (auto& generate_result : generate_results) {
+                results.push_back(decode_result(generate_result, tokenization_duration_microseconds, start_time));
+            }
+            return results;
+        }
+
+        // only the inputs with speech are transcribed
+        std::vector<WhisperPackedSpeech> speeches;
+        std::vector<RawSpeechInput> packed_inputs;
+        std::vector<size_t> packed_input_idxs;
+        for (const RawSpeechInput& raw_speech_input : raw_speech_inputs) {
+            speeches.emplace_back(raw_speech_input,
+                                  detect_speech_regions(raw_speech_input, m_feature_extractor.sampling_rate),
+                                  m_feature_extractor.sampling_rate);
+            if (!speeches.back().get_samples().empty()) {
+                packed_input_idxs.push_back(speeches.size() - 1);
+                packed_inputs.push_back(speeches.back().get_samples());
+            }
+        }
+
+        std::vector<WhisperGenerateResult> generate_results(raw_speech_inputs.size(), get_no_speech_result(config));
+        if (!packed_inputs.empty()) {
+            auto packed_results = ov::genai::whisper_generate_batch(config,
+                                                                    m_model_config,
+                                                                    context_tokens,
+                                                                    packed_inputs,
+                                                                    get_batch_encoder(),
+                                                                    m_decoder,
+                                                                    m_feature_extractor,
+                                                                    m_sampler);
+            for (size_t packed_idx = 0; packed_idx < packed_results.size(); ++packed_idx) {
+                const size_t input_idx = packed_input_idxs[packed_idx];
+                generate_results[input_idx] = std::move(packed_results[packed_idx]);
+                if (generate_results[input_idx].segments.has_value()) {
+                    speeches[input_idx].to_original_segments(*generate_results[input_idx].segments);
+                }
+            }
+        }
+
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(generate_results.size());
+        for (auto& generate_result : generate_results) {
+            results.push_back(decode_result(generate_result, tokenization_duration_microseconds, start_time));
+        }
+        return results;
+    }
+
+    void start_stream(OptionalWhisperGenerationConfig generation_config) override {
+        WhisperGenerationConfig config = prepare_generation_config(generation_config);
+        OPENVINO_ASSERT(!config.word_timestamps, "Word timestamps are not supported for the streaming transcription.");
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+        m_stream = std::make_unique<WhisperStreamingSession>(config,
+                                                             context_tokens,
+                                                             m_model_config,
+                                                             m_feature_extractor,
+                                                             m_encoder,
+                                                             m_decoder,
+                                                             m_sampler);
+    }
+
+    WhisperStreamingResult push_audio(const RawSpeechInput& audio_chunk) override {
+        OPENVINO_ASSERT(m_stream, "start_stream() must be called before push_audio()");
+        return decode_stream_update(m_stream->push(audio_chunk));
+    }
+
+    WhisperStreamingResult finish_stream() override {
+        OPENVINO_ASSERT(m_stream, "start_stream() must be called before finish_stream()");
+        WhisperStreamingResult result = decode_stream_update(m_stream->finish());
+        m_stream.reset();
+        return result;
+    }
+
+private:
+    WhisperStreamingResult decode_stream_update(const WhisperStreamingSession::Update& update) {
+        WhisperStreamingResult result;
+        if (!update.stable_tokens.empty()) {
+            result.stable_text = m_tokenizer.decode(update.stable_tokens);
+        }
+        if (!update.partial_tokens.empty()) {
+            result.partial_text = m_tokenizer.decode(update.partial_tokens);
+        }
+        return result;
+    }
+
+    WhisperGenerationConfig prepare_generation_config(const OptionalWhisperGenerationConfig& generation_config) {
         WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
 
         // If stop_token_ids were not provided, take value from default m_generation_config
@@ -84,18 +255,12 @@ public:
         if (config.eos_token_id == -1)
             config.set_eos_token_id(m_generation_config.eos_token_id);
         config.validate();
+        return config;
+    }
 
-        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
-
-        auto generate_result = ov::genai::whisper_generate(config,
-                                                           m_model_config,
-                                                           context_tokens,
-                                                           raw_speech_input,
-                                                           m_encoder,
-                                                           m_decoder,
-                                                           m_feature_extractor,
-                                                           streamer,
-                                                           m_sampler);
+    WhisperDecodedResults decode_result(WhisperGenerateResult& generate_result,
+                                        const float tokenization_duration_microseconds,
+                                        const std::chrono::steady_clock::time_point start_time) {
         auto decode_start_time = std::chrono::steady_clock::now();
         WhisperDecodedResults result{std::vector{m_tokenizer.decode(generate_result.output_tokens)}, std::vector{1.f}};
         generate_result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
@@ -121,6 +286,18 @@ public:
             result.chunks = chunks;
         }
 
+        if (generate_result.token_times.has_value()) {
+            decode_start_time = std::chrono::steady_clock::now();
+            result.words = group_words(generate_result.output_tokens,
+                                       *generate_result.token_times,
+                                       m_generation_config.eos_token_id,
+                                       [this](const std::vector<int64_t>& tokens) {
+                                           return m_tokenizer.decode(tokens);
+                                       });
+            result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
+                PerfMetrics::get_microsec(std::chrono::steady_clock::now() - decode_start_time));
+        }
+
         auto& metrics = result.perf_metrics;
         metrics.load_time = this->m_load_time_ms;
         auto stop_time = std::chrono::steady_clock::now();
@@ -131,10 +308,84 @@ public:
         return result;
     }
 
-private:
+    WhisperGenerateResult generate_speech(const WhisperGenerationConfig& config,
+                                          const WhisperContextTokens& context_tokens,
+                                          const RawSpeechInput& raw_speech_input,
+                                          const std::shared_ptr<StreamerBase> streamer) {
+        OPENVINO_ASSERT(!config.is_assisting_generation() || m_draft_decoder,
+                        "Assisted generation requires the pipeline to be created with 'draft_decoder_path' property.");
+        if (config.word_timestamps) {
+            OPENVINO_ASSERT(!m_alignment_heads.empty(),
+                            "Word timestamps require the pipeline to be created with 'word_timestamps' property.");
+            OPENVINO_ASSERT(config.alignment_heads == m_alignment_heads,
+                            "The alignment heads of the word timestamps cannot differ from the ones of the pipeline "
+                            "creation.");
+            OPENVINO_ASSERT(!config.stride_length.has_value(),
+                            "Word timestamps are not supported for the chunked long-form transcription.");
+        }
+        if (config.stride_length.has_value() && raw_speech_input.size() > m_feature_extractor.n_samples) {
+            return ov::genai::whisper_generate_chunked(config,
+                                                       m_model_config,
+                                                       context_tokens,
+                                                       raw_speech_input,
+                                                       get_batch_encoder(),
+                                                       m_decoder,
+                                                       m_feature_extractor,
+                                                       streamer,
+                                                       m_sampler);
+        }
+
+        return ov::genai::whisper_generate(config,
+                                           m_model_config,
+                                           context_tokens,
+                                           raw_speech_input,
+                                           m_encoder,
+                                           m_decoder,
+                                           m_feature_extractor,
+                                           streamer,
+                                           m_sampler,
+                                           config.is_assisting_generation() ? m_draft_decoder : nullptr,
+                                           raw_speech_input.size() > m_feature_extractor.n_samples ? &get_next_encoder()
+                                                                                                   : nullptr);
+    }
+
+    // the audio without speech is not transcribed
+    static WhisperGenerateResult get_no_speech_result(const WhisperGenerationConfig& config) {
+        WhisperGenerateResult result;
+        result.perf_metrics.num_input_tokens = 0;
+        result.perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+        if (config.return_timestamps) {
+            result.segments = std::vector<Segment>{};
+        }
+        return result;
+    }
+
+    ov::InferRequest& get_batch_encoder() {
+        // the encoder output of m_encoder may be a remote tensor of batch 1
+        if (!m_batch_encoder) {
+            m_batch_encoder = m_encoder.get_compiled_model().create_infer_request();
+        }
+        return m_batch_encoder;
+    }
+
+    ov::InferRequest& get_next_encoder() {
+        if (!m_next_encoder) {
+            ov::CompiledModel compiled_model = m_encoder.get_compiled_model();
+            m_next_encoder = init_model(compiled_model);
+        }
+        return m_next_encoder;
+    }
+
     ov::InferRequest m_encoder;
+    ov::InferRequest m_batch_encoder;
+    // encodes the next window of the long-form audio during the decoding of the current one
+    ov::InferRequest m_next_encoder;
     std::shared_ptr<ov::genai::WhisperDecoder> m_decoder;
+    std::shared_ptr<ov::genai::WhisperDecoder> m_draft_decoder;
+    // the heads whose cross-attention weights are computed by m_decoder, if any
+    std::vector<std::pair<size_t, size_t>> m_alignment_heads;
     Sampler m_sampler;
+    std::unique_ptr<WhisperStreamingSession> m_stream;
 };
 
 OPENVINO_SUPPRESS_DEPRECATED_START
@@ -171,6 +422,12 @@ ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::generate(const RawS
     return m_impl->generate(raw_speech_input, generation_config, base_streamer);
 }
 
+std::vector<ov::genai::WhisperDecodedResults> ov::genai::WhisperPipeline::generate(
+    const std::vector<RawSpeechInput>& raw_speech_inputs,
+    OptionalWhisperGenerationConfig generation_config) {
+    return m_impl->generate_batch(raw_speech_inputs, generation_config);
+}
+
 ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::generate(const RawSpeechInput& raw_speech_input,
                                                                       const ov::AnyMap& config_map) {
     auto config_arg = get_config_from_map(config_map);
@@ -182,6 +439,18 @@ ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::generate(const RawS
     return m_impl->generate(raw_speech_input, config, base_streamer);
 }
 
+void ov::genai::WhisperPipeline::start_stream(OptionalWhisperGenerationConfig generation_config) {
+    m_impl->start_stream(generation_config);
+}
+
+ov::genai::WhisperStreamingResult ov::genai::WhisperPipeline::push_audio(const RawSpeechInput& audio_chunk) {
+    return m_impl->push_audio(audio_chunk);
+}
+
+ov::genai::WhisperStreamingResult ov::genai::WhisperPipeline::finish_stream() {
+    return m_impl->finish_stream();
+}
+
 ov::genai::WhisperGenerationConfig ov::genai::WhisperPipeline::get_generation_config() const {
     return m_impl->m_generation_config;
 }
@@ -190,6 +459,15 @@ ov::genai::Tokenizer ov::genai::WhisperPipeline::get_tokenizer() {
     return m_impl->m_tokenizer;
 }
 
+void ov::genai::WhisperPipeline::warmup(const WarmupConfig& config) {
+    OPENVINO_ASSERT(config.max_new_tokens > 0, "WarmupConfig max_new_tokens must be positive");
+    WhisperGenerationConfig generation_config = get_generation_config();
+    generation_config.max_new_tokens = config.max_new_tokens;
+    generation_config.return_timestamps = false;
+    // a second of silence at the 16 kHz sample rate of the feature extractor, the encoder input shape is fixed
+    m_impl->generate(std::vector<float>(16000, 0.0f), generation_config, nullptr);
+}
+
 void ov::genai::WhisperPipeline::set_generation_config(const WhisperGenerationConfig& config) {
     int64_t default_eos_token_id = m_impl->m_generation_config.eos_token_id;
     auto default_stop_token_ids = m_impl->m_generation_config.stop_token_ids;
@@ -30,6 +30,31 @@ public:
                                            OptionalWhisperGenerationConfig generation_config,
                                            const std::shared_ptr<StreamerBase> streamer) = 0;
 
+    /**
+     * Transcribes the inputs one by one, the pipelines which can decode several inputs together override it.
+     */
+    virtual std::vector<WhisperDecodedResults> generate_batch(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                              OptionalWhisperGenerationConfig generation_config) {
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(raw_speech_inputs.size());
+        for (const auto& raw_speech_input : raw_speech_inputs) {
+            results.push_back(generate(raw_speech_input, generation_config, nullptr));
+        }
+        return results;
+    }
+
+    virtual void start_stream(OptionalWhisperGenerationConfig generation_config) {
+        OPENVINO_THROW("Streaming transcription is not supported by the pipeline");
+    }
+
+    virtual WhisperStreamingResult push_audio(const RawSpeechInput& audio_chunk) {
+        OPENVINO_THROW("Streaming transcription is not supported by the pipeline");
+    }
+
+    virtual WhisperStreamingResult finish_stream() {
+        OPENVINO_THROW("Streaming transcription is not supported by the pipeline");
+    }
+
     virtual ~WhisperPipelineImplBase() = default;
 };
 
@@ -34,6 +34,8 @@ using ov::genai::MicroSeconds;
 namespace {
 
 constexpr size_t MAX_PROMPT_LEN = 4;
+// NB: KV-cache sizes of decoder_with_past variants, the last one is max_sequence_length
+constexpr size_t DECODER_KVCACHE_SIZES[] = {64, 128, 448};
 
 template <typename T>
 void fill_tensor(ov::Tensor tensor, T fill_val) {
@@ -166,8 +168,8 @@ ov::Tensor decode(ov::Tensor& encoder_hidden_state,
                   ov::InferRequest& decoder,
                   const std::vector<int64_t>& init_ids,
                   ov::genai::RawPerfMetrics& raw_metrics) {
-    // NB: Fill decoder inputs
-    encoder_hidden_state.copy_to(decoder.get_tensor("encoder_hidden_states"));
+    // NB: Fill decoder inputs, the encoder output is shared with the decoder without a copy
+    decoder.set_tensor("encoder_hidden_states", encoder_hidden_state);
     set_decoder_input_ids(decoder, init_ids);
     ov::genai::utils::infer_with_perf_metrics(decoder, raw_metrics);
     // NB: Processing here only non-empty tokens
@@ -216,6 +218,35 @@ void prepare_decoder_with_past(ov::InferRequest& decoder_with_past, ov::InferReq
     update_past_key_value(decoder, decoder_with_past);
 };
 
+void switch_decoder_with_past_bucket(ov::InferRequest& source,
+                                     ov::InferRequest& dest,
+                                     ov::InferRequest& decoder,
+                                     const size_t num_positions) {
+    // NB: Keep the attention mask format of prepare_decoder_with_past: [0, ..., 0, 1, ..., 1, 0, 1],
+    // where the first num_positions are already filled KV-cache positions
+    auto padded_attention_mask = dest.get_tensor("attention_mask");
+    OPENVINO_ASSERT(padded_attention_mask.get_size() >= num_positions + 2);
+    auto* padded_mask_data = padded_attention_mask.data<float>();
+    std::fill(padded_mask_data, padded_mask_data + num_positions, 0);
+    std::fill(padded_mask_data + num_positions, padded_mask_data + padded_attention_mask.get_size() - 2, 1);
+    padded_mask_data[padded_attention_mask.get_size() - 2] = 0;
+    padded_mask_data[padded_attention_mask.get_size() - 1] = 1;
+
+    zero_past_key_values(dest);
+    set_cross_attn_key_value(decoder, dest);
+    // NB: Copy filled positions of past_key_values.*.decoder.* tensors to the larger KV-cache
+    for (auto& input : source.get_compiled_model().inputs()) {
+        std::string past_key_value_decoder_name = input.get_any_name();
+        if (past_key_value_decoder_name.find("decoder") == std::string::npos ||
+            past_key_value_decoder_name.find("past_key_values") == std::string::npos) {
+            continue;
+        }
+        auto src_kv_tensor_slice = make_tensor_slice(source.get_tensor(past_key_value_decoder_name), 2u, 0, num_positions);
+        auto dst_kv_tensor_slice = make_tensor_slice(dest.get_tensor(past_key_value_decoder_name), 2u, 0, num_positions);
+        src_kv_tensor_slice.copy_to(dst_kv_tensor_slice);
+    }
+}
+
 int64_t detect_language(ov::Tensor& encoder_hidden_state,
                         ov::InferRequest& decoder,
                         const ov::genai::WhisperGenerationConfig& config,
@@ -307,6 +338,7 @@ void stream_generated_tokens(const std::shared_ptr<ov::genai::StreamerBase> stre
 std::pair<ov::genai::EncodedResults, bool> full_decode(ov::Tensor& encoder_hidden_state,
                                                        const ov::genai::WhisperGenerationConfig& config,
                                                        ov::genai::WhisperInitializedModels& models,
+                                                       std::vector<ov::InferRequest>& decoder_with_past_buckets,
                                                        std::vector<int64_t> init_ids,
                                                        const bool return_timestamps,
                                                        ov::genai::RawPerfMetrics& raw_metrics,
@@ -327,7 +359,10 @@ std::pair<ov::genai::EncodedResults, bool> full_decode(ov::Tensor& encoder_hidde
     sampler.sample({sequence_group}, logits);
     stream_generated_tokens(streamer, handle, return_timestamps);
 
-    prepare_decoder_with_past(models.decoder_with_past, models.decoder, init_ids.size());
+    // NB: Start with the smallest KV-cache and move to the larger one when it's full,
+    // so short transcripts don't attend over the entire max_sequence_length
+    size_t bucket_idx = 0;
+    prepare_decoder_with_past(decoder_with_past_buckets[bucket_idx], models.decoder, init_ids.size());
 
     while (!sequence_group->has_finished() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
         sequence_group->schedule_tokens(1);
@@ -335,13 +370,25 @@ std::pair<ov::genai::EncodedResults, bool> full_decode(ov::Tensor& encoder_hidde
         OPENVINO_ASSERT(running_sequences.size() == 1u);
         auto last_token = running_sequences.front()->get_generated_ids().back();
         auto last_idx = running_sequences.front()->get_generated_ids().size() - 1;
+        const size_t position_id = last_idx + init_ids.size();
+
+        // NB: attention_mask has 2 more elements than past_key_values.*.decoder.* positions
+        while (bucket_idx + 1 < decoder_with_past_buckets.size() &&
+               position_id + 2 >= decoder_with_past_buckets[bucket_idx].get_tensor("attention_mask").get_size()) {
+            switch_decoder_with_past_bucket(decoder_with_past_buckets[bucket_idx],
+                                            decoder_with_past_buckets[bucket_idx + 1],
+                                            models.decoder,
+                                            position_id);
+            ++bucket_idx;
+        }
+        auto& decoder_with_past = decoder_with_past_buckets[bucket_idx];
 
-        auto logits = decode_with_past(models.decoder_with_past,
+        auto logits = decode_with_past(decoder_with_past,
                                        last_token,
-                                       last_idx + init_ids.size(),
+                                       position_id,
                                        raw_metrics);
         process_whisper_logits(logits, config, return_timestamps, running_sequences.front()->get_generated_ids());
-        update_past_key_value(models.decoder_with_past, models.decoder_with_past, last_idx + init_ids.size());
+        update_past_key_value(decoder_with_past, decoder_with_past, position_id);
 
         sampler.sample({sequence_group}, logits);
         stream_generated_tokens(streamer, handle, return_timestamps);
@@ -946,6 +993,10 @@ WhisperPipeline::StaticWhisperPipeline::StaticWhisperPipeline(const std::filesys
     : WhisperPipelineImplBase{models_path}
     , m_sampler(m_tokenizer) {
     ov::Core core = utils::singleton_core();
+    OPENVINO_ASSERT(properties.find(ov::genai::draft_decoder_path.name()) == properties.end(),
+                    "'draft_decoder_path' property is not supported on NPU device.");
+    OPENVINO_ASSERT(properties.find(ov::genai::word_timestamps.name()) == properties.end(),
+                    "'word_timestamps' property is not supported on NPU device.");
 
     auto encoder_model = core.read_model(models_path / "openvino_encoder_model.xml", {}, properties);
     reshape_to_static_encoder(encoder_model, m_feature_extractor.feature_size);
@@ -974,26 +1025,30 @@ WhisperPipeline::StaticWhisperPipeline::StaticWhisperPipeline(const std::filesys
     // "attention_mask" for "self-attention" is needed to control actual KV-cache size
     add_attention_mask_input(decoder_with_past_model);
 
-    const size_t max_sequence_length = 448;
-
     reshape_to_static(decoder_model, MAX_PROMPT_LEN, MAX_PROMPT_LEN, last_hidden_state_shape);
-    reshape_to_static(decoder_with_past_model, 1, max_sequence_length, last_hidden_state_shape, true /*with_past*/);
-
-    // Replace KV-tensors for the entire cache to tensors only for new token
-    decoder_with_past_model = redirect_new_kv_to_output(decoder_with_past_model);
 
     preprocess_encoder(encoder_model);
     preprocess_decoder(decoder_model);
-    preprocess_decoder(decoder_with_past_model);
 
     ov::CompiledModel compiled_model;
     compiled_model = core.compile_model(encoder_model, "NPU", properties);
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper encoder model");
     m_models.encoder = compiled_model.create_infer_request();
 
-    compiled_model = core.compile_model(decoder_with_past_model, "NPU", properties);
-    ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper decoder with past model");
-    m_models.decoder_with_past = compiled_model.create_infer_request();
+    // NB: decoder_with_past is compiled for each KV-cache size, the last one is max_sequence_length
+    for (const size_t kvcache_size : DECODER_KVCACHE_SIZES) {
+        auto bucket_model = decoder_with_past_model->clone();
+        reshape_to_static(bucket_model, 1, kvcache_size, last_hidden_state_shape, true /*with_past*/);
+
+        // Replace KV-tensors for the entire cache to tensors only for new token
+        bucket_model = redirect_new_kv_to_output(bucket_model);
+        preprocess_decoder(bucket_model);
+
+        compiled_model = core.compile_model(bucket_model, "NPU", properties);
+        ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper decoder with past model");
+        m_decoder_with_past_buckets.push_back(compiled_model.create_infer_request());
+    }
+    m_models.decoder_with_past = m_decoder_with_past_buckets.back();
 
     compiled_model = core.compile_model(decoder_model, "NPU", properties);
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper decoder model");
@@ -1024,6 +1079,10 @@ WhisperDecodedResults WhisperPipeline::StaticWhisperPipeline::generate(
 
     OPENVINO_ASSERT(!config.initial_prompt.has_value(), "'initial_prompt' parameter is not supported on NPU device.");
     OPENVINO_ASSERT(!config.hotwords.has_value(), "'hotwords' parameter is not supported on NPU device.");
+    OPENVINO_ASSERT(!config.stride_length.has_value(), "'stride_length' parameter is not supported on NPU device.");
+    OPENVINO_ASSERT(!config.vad_filter, "'vad_filter' parameter is not supported on NPU device.");
+    OPENVINO_ASSERT(!config.is_assisting_generation(), "Assisted generation is not supported on NPU device.");
+    OPENVINO_ASSERT(!config.word_timestamps, "Word timestamps are not supported on NPU device.");
 
     size_t max_new_tokens = config.get_max_new_tokens();
 
@@ -1080,6 +1139,7 @@ WhisperDecodedResults WhisperPipeline::StaticWhisperPipeline::generate(
         auto [results, cancelled] = full_decode(hidden_state_tensor,
                                                 config,
                                                 m_models,
+                                                m_decoder_with_past_buckets,
                                                 init_ids,
                                                 return_timestamps,
                                                 raw_metrics,
@@ -5,6 +5,7 @@
 
 #include <filesystem>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/streamer_base.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -26,6 +27,8 @@ public:
 
 private:
     WhisperInitializedModels m_models;
+    // decoder_with_past compiled for increasing KV-cache sizes, the last one is m_models.decoder_with_past
+    std::vector<ov::InferRequest> m_decoder_with_past_buckets;
     Sampler m_sampler;
 };
 
@@ -0,0 +1,181 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper/streaming.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "openvino/core/except.hpp"
+#include "whisper/whisper.hpp"
+
+namespace {
+// the previous transcription is truncated as in the decoder prompt of the reference implementation: the last
+// max_target_positions / 2 - 1 tokens
+constexpr size_t max_previous_tokens = 223;
+
+bool is_timestamp_token(const int64_t token, const ov::genai::WhisperGenerationConfig& config) {
+    return token > config.no_timestamps_token_id;
+}
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+std::vector<int64_t> WhisperLocalAgreement::insert(const std::vector<int64_t>& hypothesis) {
+    // the committed tokens replace the beginning of the hypothesis, so that they never change
+    std::vector<int64_t> new_hypothesis(m_hypothesis.begin(), m_hypothesis.begin() + m_num_committed);
+    if (hypothesis.size() > m_num_committed) {
+        new_hypothesis.insert(new_hypothesis.end(), hypothesis.begin() + m_num_committed, hypothesis.end());
+    }
+
+    size_t num_agreed = m_num_committed;
+    while (num_agreed < new_hypothesis.size() && num_agreed < m_hypothesis.size() &&
+           new_hypothesis[num_agreed] == m_hypothesis[num_agreed]) {
+        ++num_agreed;
+    }
+
+    std::vector<int64_t> committed(new_hypothesis.begin() + m_num_committed, new_hypothesis.begin() + num_agreed);
+    m_hypothesis = std::move(new_hypothesis);
+    m_num_committed = num_agreed;
+    return committed;
+}
+
+std::vector<int64_t> WhisperLocalAgreement::flush() {
+    std::vector<int64_t> committed = get_partial();
+    m_num_committed = m_hypothesis.size();
+    return committed;
+}
+
+std::vector<int64_t> WhisperLocalAgreement::drop(const size_t num_tokens) {
+    OPENVINO_ASSERT(num_tokens <= m_num_committed, "Only the committed tokens can be dropped");
+    std::vector<int64_t> dropped(m_hypothesis.begin(), m_hypothesis.begin() + num_tokens);
+    m_hypothesis.erase(m_hypothesis.begin(), m_hypothesis.begin() + num_tokens);
+    m_num_committed -= num_tokens;
+    return dropped;
+}
+
+std::vector<int64_t> WhisperLocalAgreement::get_partial() const {
+    return {m_hypothesis.begin() + m_num_committed, m_hypothesis.end()};
+}
+
+size_t WhisperLocalAgreement::get_num_committed() const {
+    return m_num_committed;
+}
+
+std::vector<int64_t> get_text_tokens(const std::vector<int64_t>& tokens, const WhisperGenerationConfig& config) {
+    std::vector<int64_t> text_tokens;
+    std::copy_if(tokens.begin(), tokens.end(), std::back_inserter(text_tokens), [&](int64_t token) {
+        return !is_timestamp_token(token, config) && token != config.eos_token_id;
+    });
+    return text_tokens;
+}
+
+std::optional<WhisperStreamCut> find_committed_cut(const std::vector<int64_t>& tokens,
+                                                   const size_t num_committed_tokens,
+                                                   const WhisperGenerationConfig& config,
+                                                   const float time_precision) {
+    const int64_t timestamp_begin = config.no_timestamps_token_id + 1;
+    std::optional<WhisperStreamCut> cut;
+    size_t num_text_tokens = 0;
+    for (int64_t token : tokens) {
+        if (token == config.eos_token_id) {
+            break;
+        }
+        if (!is_timestamp_token(token, config)) {
+            if (++num_text_tokens > num_committed_tokens) {
+                break;
+            }
+            continue;
+        }
+        // a cut without text before it doesn't trim anything
+        if (num_text_tokens > 0) {
+            cut = WhisperStreamCut{num_text_tokens, (token - timestamp_begin) * time_precision};
+        }
+    }
+    return cut;
+}
+
+WhisperStreamingSession::WhisperStreamingSession(const WhisperGenerationConfig& config,
+                                                 const WhisperContextTokens& context_tokens,
+                                                 const WhisperConfig& model_config,
+                                                 const WhisperFeatureExtractor& feature_extractor,
+                                                 ov::InferRequest& encoder,
+                                                 std::shared_ptr<WhisperDecoder> decoder,
+                                                 Sampler& sampler)
+    : m_config(config),
+      m_context_tokens(context_tokens),
+      m_feature_extractor(feature_extractor),
+      m_encoder(encoder),
+      m_decoder(decoder),
+      m_sampler(sampler),
+      // 0.02 by default
+      m_time_precision(static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions),
+      m_features(feature_extractor) {}
+
+WhisperStreamingSession::Update WhisperStreamingSession::push(const RawSpeechInput& audio_chunk) {
+    m_features.append(audio_chunk);
+    return update(false);
+}
+
+WhisperStreamingSession::Update WhisperStreamingSession::finish() {
+    if (m_features.get_num_samples() == 0) {
+        return {m_agreement.flush(), {}};
+    }
+    return update(true);
+}
+
+WhisperStreamingSession::Update WhisperStreamingSession::update(const bool is_final) {
+    WhisperFeatures features = m_features.get_features();
+    const std::vector<int64_t> prompt_tokens = get_prompt_tokens(m_context_tokens, m_config, 0);
+    const std::vector<int64_t> tokens = whisper_decode_window(m_config,
+                                                              prompt_tokens,
+                                                              features,
+                                                              m_encoder,
+                                                              m_decoder,
+                                                              m_feature_extractor,
+                                                              m_sampler,
+                                                              m_init_tokens);
+
+    Update result;
+    result.stable_tokens = m_agreement.insert(get_text_tokens(tokens, m_config));
+    if (is_final) {
+        std::vector<int64_t> committed = m_agreement.flush();
+        result.stable_tokens.insert(result.stable_tokens.end(), committed.begin(), committed.end());
+        return result;
+    }
+
+    const float buffer_seconds = static_cast<float>(m_features.get_num_samples()) / m_feature_extractor.sampling_rate;
+    if (buffer_seconds > buffer_trimming_seconds) {
+        auto cut = find_committed_cut(tokens, m_agreement.get_num_committed(), m_config, m_time_precision);
+        if (!cut.has_value() && m_features.get_num_samples() >= m_feature_extractor.n_samples) {
+            // nothing is committed in the whole window, commit the hypothesis to keep the buffer within the window
+            std::vector<int64_t> committed = m_agreement.flush();
+            result.stable_tokens.insert(result.stable_tokens.end(), committed.begin(), committed.end());
+            cut = find_committed_cut(tokens, m_agreement.get_num_committed(), m_config, m_time_precision);
+            if (!cut.has_value()) {
+                cut = WhisperStreamCut{m_agreement.get_num_committed(), static_cast<float>(m_feature_extractor.chunk_length)};
+            }
+        }
+        if (cut.has_value()) {
+            drop(*cut);
+        }
+    }
+
+    result.partial_tokens = m_agreement.get_partial();
+    return result;
+}
+
+void WhisperStreamingSession::drop(const WhisperStreamCut& cut) {
+    m_features.drop(static_cast<size_t>(cut.time * m_feature_extractor.sampling_rate));
+
+    std::vector<int64_t>& previous_tokens = m_context_tokens.initial_prompt;
+    std::vector<int64_t> dropped = m_agreement.drop(cut.num_tokens);
+    previous_tokens.insert(previous_tokens.end(), dropped.begin(), dropped.end());
+    if (previous_tokens.size() > max_previous_tokens) {
+        previous_tokens.erase(previous_tokens.begin(), previous_tokens.end() - max_previous_tokens);
+    }
+}
+
+}  // namespace genai
+}  // namespace ov
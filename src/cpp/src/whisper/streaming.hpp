@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <optional>
+
+#include "openvino/genai/whisper_generation_config.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+#include "sampling/sampler.hpp"
+#include "whisper/config.hpp"
+#include "whisper/context_tokens.hpp"
+#include "whisper/feature_extractor.hpp"
+#include "whisper/models/decoder.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * LocalAgreement-2 policy of the streaming transcription: the tokens of the audio buffer are committed once two
+ * consecutive hypotheses agree on them, the rest of the latest hypothesis is partial and may change with more audio.
+ * The committed tokens are not changed by the later hypotheses.
+ */
+class WhisperLocalAgreement {
+public:
+    /**
+     * @brief Compare the hypothesis of the buffer with the previous one
+     *
+     * @return the newly committed tokens
+     */
+    std::vector<int64_t> insert(const std::vector<int64_t>& hypothesis);
+
+    /**
+     * @brief Commit the whole latest hypothesis, e.g. at the end of the stream
+     *
+     * @return the newly committed tokens
+     */
+    std::vector<int64_t> flush();
+
+    /**
+     * @brief Forget the first committed tokens, as the buffer audio of them is dropped
+     *
+     * @return the dropped tokens
+     */
+    std::vector<int64_t> drop(const size_t num_tokens);
+
+    std::vector<int64_t> get_partial() const;
+
+    size_t get_num_committed() const;
+
+private:
+    // the committed tokens followed by the partial tokens of the latest hypothesis
+    std::vector<int64_t> m_hypothesis;
+    size_t m_num_committed = 0;
+};
+
+struct WhisperStreamCut {
+    // the number of the text tokens before the cut
+    size_t num_tokens;
+    // the offset of the cut in seconds
+    float time;
+};
+
+/**
+ * @brief The text tokens of the generated tokens without the timestamp tokens
+ */
+std::vector<int64_t> get_text_tokens(const std::vector<int64_t>& tokens, const WhisperGenerationConfig& config);
+
+/**
+ * @brief Find the latest timestamp of the generated tokens, which precedes only the committed text tokens, so that
+ * the buffer audio before it can be dropped.
+ */
+std::optional<WhisperStreamCut> find_committed_cut(const std::vector<int64_t>& tokens,
+                                                   const size_t num_committed_tokens,
+                                                   const WhisperGenerationConfig& config,
+                                                   const float time_precision);
+
+/**
+ * Transcription of an audio stream: each pushed chunk of audio is appended to the buffer, which is decoded again to
+ * update the hypothesis. The buffer is trimmed at the end of the committed segments, once it exceeds
+ * buffer_trimming_seconds, and the dropped committed tokens are passed as the previous transcription to the next
+ * windows.
+ */
+class WhisperStreamingSession {
+public:
+    struct Update {
+        std::vector<int64_t> stable_tokens;
+        std::vector<int64_t> partial_tokens;
+    };
+
+    static constexpr float buffer_trimming_seconds = 15.0f;
+
+    WhisperStreamingSession(const WhisperGenerationConfig& config,
+                            const WhisperContextTokens& context_tokens,
+                            const WhisperConfig& model_config,
+                            const WhisperFeatureExtractor& feature_extractor,
+                            ov::InferRequest& encoder,
+                            std::shared_ptr<WhisperDecoder> decoder,
+                            Sampler& sampler);
+
+    Update push(const RawSpeechInput& audio_chunk);
+
+    // decodes the rest of the buffer and commits it
+    Update finish();
+
+private:
+    WhisperGenerationConfig m_config;
+    WhisperContextTokens m_context_tokens;
+    const WhisperFeatureExtractor& m_feature_extractor;
+    ov::InferRequest& m_encoder;
+    std::shared_ptr<WhisperDecoder> m_decoder;
+    Sampler& m_sampler;
+    float m_time_precision;
+
+    WhisperFeatureStream m_features;
+    WhisperLocalAgreement m_agreement;
+    std::vector<int64_t> m_init_tokens;
+
+    Update update(const bool is_final);
+    void drop(const WhisperStreamCut& cut);
+};
+
+}  // namespace genai
+}  // namespace ov
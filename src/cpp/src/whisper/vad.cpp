@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper/vad.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+size_t to_samples(const float seconds, const size_t sampling_rate) {
+    return static_cast<size_t>(seconds * sampling_rate + 0.5f);
+}
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+std::vector<WhisperSpeechRegion> detect_speech_regions(const RawSpeechInput& raw_speech,
+                                                       const size_t sampling_rate,
+                                                       const WhisperVadParameters& parameters) {
+    OPENVINO_ASSERT(sampling_rate != 0, "Sampling Rate for Voice Activity Detection is 0");
+    if (raw_speech.empty()) {
+        return {};
+    }
+
+    const size_t frame_size = std::max<size_t>(1, to_samples(parameters.frame_length, sampling_rate));
+    const size_t num_frames = (raw_speech.size() + frame_size - 1) / frame_size;
+
+    std::vector<float> energy_db(num_frames);
+    for (size_t frame = 0; frame < num_frames; ++frame) {
+        const size_t start = frame * frame_size;
+        const size_t end = std::min(start + frame_size, raw_speech.size());
+        double sum = 0.0;
+        for (size_t i = start; i < end; ++i) {
+            sum += raw_speech[i] * raw_speech[i];
+        }
+        energy_db[frame] = static_cast<float>(10.0 * std::log10(sum / (end - start) + 1e-10));
+    }
+
+    std::vector<float> sorted_energy_db = energy_db;
+    std::nth_element(sorted_energy_db.begin(), sorted_energy_db.begin() + num_frames / 10, sorted_energy_db.end());
+    const float noise_floor_db = sorted_energy_db[num_frames / 10];
+    const float peak_db = *std::max_element(energy_db.begin(), energy_db.end());
+    // the audio without silence has no noise floor, its frames close to the peak are speech
+    const float threshold_db =
+        std::max(std::min(noise_floor_db + parameters.snr_db, peak_db - parameters.snr_db), parameters.min_energy_db);
+
+    // the speech frames, the regions separated by short silences are joined
+    const size_t min_silence_frames = to_samples(parameters.min_silence_duration, sampling_rate) / frame_size;
+    std::vector<WhisperSpeechRegion> frame_regions;
+    for (size_t frame = 0; frame < num_frames; ++frame) {
+        if (energy_db[frame] <= threshold_db) {
+            continue;
+        }
+        if (!frame_regions.empty() && frame - frame_regions.back().end <= min_silence_frames) {
+            frame_regions.back().end = frame + 1;
+        } else {
+            frame_regions.push_back({frame, frame + 1});
+        }
+    }
+
+    const size_t min_speech_samples = to_samples(parameters.min_speech_duration, sampling_rate);
+    const size_t pad_samples = to_samples(parameters.speech_pad, sampling_rate);
+    std::vector<WhisperSpeechRegion> regions;
+    for (const WhisperSpeechRegion& frame_region : frame_regions) {
+        const size_t start = frame_region.start * frame_size;
+        const size_t end = std::min(frame_region.end * frame_size, raw_speech.size());
+        if (end - start < min_speech_samples) {
+            continue;
+        }
+
+        WhisperSpeechRegion region{start > pad_samples ? start - pad_samples : 0,
+                                   std::min(end + pad_samples, raw_speech.size())};
+        if (!regions.empty() && region.start <= regions.back().end) {
+            regions.back().end = region.end;
+        } else {
+            regions.push_back(region);
+        }
+    }
+
+    return regions;
+}
+
+WhisperPackedSpeech::WhisperPackedSpeech(const RawSpeechInput& raw_speech,
+                                         std::vector<WhisperSpeechRegion> regions,
+                                         const size_t sampling_rate)
+    : m_regions(std::move(regions)),
+      m_sampling_rate(sampling_rate) {
+    for (const WhisperSpeechRegion& region : m_regions) {
+        OPENVINO_ASSERT(region.start <= region.end && region.end <= raw_speech.size(),
+                        "Speech region is out of the audio samples");
+        m_packed_starts.push_back(m_samples.size());
+        m_samples.insert(m_samples.end(), raw_speech.begin() + region.start, raw_speech.begin() + region.end);
+    }
+}
+
+float WhisperPackedSpeech::to_original_time(const float packed_time, const bool is_end) const {
+    if (m_regions.empty()) {
+        return packed_time;
+    }
+
+    const size_t packed_sample = to_samples(std::max(packed_time, 0.0f), m_sampling_rate);
+    // the region of the sample, an end at the boundary of two regions is the end of the first of them
+    auto region_it = is_end ? std::lower_bound(m_packed_starts.begin(), m_packed_starts.end(), packed_sample)
+                            : std::upper_bound(m_packed_starts.begin(), m_packed_starts.end(), packed_sample);
+    const size_t region = std::max<ptrdiff_t>(region_it - m_packed_starts.begin() - 1, 0);
+    // the times past the packed audio belong to the last region
+    const size_t original_sample = m_regions[region].start + (packed_sample - m_packed_starts[region]);
+    return static_cast<float>(std::min(original_sample, m_regions[region].end)) / m_sampling_rate;
+}
+
+void WhisperPackedSpeech::to_original_segments(std::vector<Segment>& segments) const {
+    for (Segment& segment : segments) {
+        segment.m_start = to_original_time(segment.m_start);
+        // the segment without the end timestamp keeps -1
+        if (segment.m_end >= 0.0f) {
+            segment.m_end = std::max(segment.m_start, to_original_time(segment.m_end, true));
+        }
+    }
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "whisper/whisper.hpp"
+
+namespace ov {
+namespace genai {
+
+// the samples [start, end) of a speech region of the audio
+struct WhisperSpeechRegion {
+    size_t start;
+    size_t end;
+};
+
+struct WhisperVadParameters {
+    // the energy is measured over the frames of frame_length seconds
+    float frame_length = 0.02f;
+    // a frame is speech if its energy is above the noise floor by snr_db and above min_energy_db of the full scale
+    float snr_db = 10.0f;
+    float min_energy_db = -60.0f;
+    // the speech regions separated by shorter silences are joined
+    float min_silence_duration = 0.5f;
+    // the shorter speech regions are dropped
+    float min_speech_duration = 0.25f;
+    // the regions are extended on both sides, so that the onsets and the trailing sounds of the words are kept
+    float speech_pad = 0.2f;
+};
+
+/**
+ * @brief Find the speech regions of the audio by the energy of its frames. The noise floor is the 10th percentile of
+ * the frames energy, so that the threshold adapts to the recording level.
+ */
+std::vector<WhisperSpeechRegion> detect_speech_regions(const RawSpeechInput& raw_speech,
+                                                       const size_t sampling_rate,
+                                                       const WhisperVadParameters& parameters = {});
+
+/**
+ * Speech regions of the audio packed back to back, so that the silence between them is not encoded and decoded. The
+ * times of the packed audio are mapped back to the times of the original one.
+ */
+class WhisperPackedSpeech {
+public:
+    WhisperPackedSpeech(const RawSpeechInput& raw_speech,
+                        std::vector<WhisperSpeechRegion> regions,
+                        const size_t sampling_rate);
+
+    const RawSpeechInput& get_samples() const {
+        return m_samples;
+    }
+
+    // maps the time in seconds of the packed audio to the original audio
+    float to_original_time(const float packed_time, const bool is_end = false) const;
+
+    // maps the segments of the packed audio transcription to the original audio
+    void to_original_segments(std::vector<Segment>& segments) const;
+
+private:
+    RawSpeechInput m_samples;
+    std::vector<WhisperSpeechRegion> m_regions;
+    // the start of each region in the packed samples
+    std::vector<size_t> m_packed_starts;
+    size_t m_sampling_rate;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -3,7 +3,12 @@
 
 #include "whisper.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <numeric>
 #include <openvino/openvino.hpp>
 #include <thread>
 
@@ -13,6 +18,7 @@
 #include "openvino/genai/whisper_pipeline.hpp"
 #include "sampling/sampler.hpp"
 #include "utils.hpp"
+#include "whisper/chunking.hpp"
 #include "whisper/config.hpp"
 #include "whisper/context_tokens.hpp"
 #include "whisper/feature_extractor.hpp"
@@ -21,10 +27,30 @@
 #include "whisper/models/decoder.hpp"
 #include "whisper/timestamps.hpp"
 #include "whisper/whisper_utils.hpp"
+#include "whisper/word_timestamps.hpp"
 
 using ov::genai::MicroSeconds;
 
 namespace {
+// the windows of the chunked long-form audio encoded and decoded together, bounding the memory of the hidden states
+constexpr size_t max_chunk_batch_size = 8;
+
+void process_whisper_logits(ov::Tensor logits,
+                            const size_t batch,
+                            const ov::genai::WhisperGenerationConfig& config,
+                            const bool return_timestamps,
+                            const std::vector<int64_t>& generated_ids,
+                            const bool initial_step) {
+    if (initial_step) {
+        ov::genai::do_suppress_tokens(logits, batch, config.begin_suppress_tokens);
+    }
+
+    ov::genai::do_suppress_tokens(logits, batch, config.suppress_tokens);
+
+    if (return_timestamps) {
+        ov::genai::process_whisper_timestamp_logits(logits, batch, config, generated_ids, initial_step);
+    }
+}
 
 void process_whisper_logits(ov::Tensor logits,
                             const ov::genai::WhisperGenerationConfig& config,
@@ -33,20 +59,175 @@ void process_whisper_logits(ov::Tensor logits,
     const bool initial_step = batch_to_generated_ids.empty();
     const size_t batch_size = logits.get_shape().at(0);
 
+    const std::vector<int64_t> no_generated_ids;
     for (size_t batch = 0; batch < batch_size; batch++) {
-        if (initial_step) {
-            ov::genai::do_suppress_tokens(logits, batch, config.begin_suppress_tokens);
+        const auto& generated_ids =
+            initial_step || !return_timestamps ? no_generated_ids : batch_to_generated_ids.at(batch);
+        process_whisper_logits(logits, batch, config, return_timestamps, generated_ids, initial_step);
+    }
+}
+
+// The draft decoder proposes the next tokens of the sequence, its key values hold the first num_draft_tokens tokens of
+// it. Each candidate is processed like the token generated by the decoder, so that the candidates are not rejected
+// due to the suppressed tokens and the timestamps rules.
+std::pair<std::vector<int64_t>, std::vector<float>> generate_candidates(
+    std::shared_ptr<ov::genai::WhisperDecoder> draft_decoder,
+    const ov::Tensor& encoder_hidden_state,
+    const std::vector<int64_t>& tokens,
+    const size_t prompt_len,
+    size_t& num_draft_tokens,
+    const size_t max_num_candidates,
+    const bool return_timestamps,
+    const ov::genai::WhisperGenerationConfig& config,
+    ov::genai::RawPerfMetrics& raw_metrics) {
+    std::vector<int64_t> candidates;
+    std::vector<float> log_probs;
+
+    ov::Tensor beam_idx = draft_decoder->create_host_tensor(ov::element::i32, {1});
+    beam_idx.data<int32_t>()[0] = 0;
+
+    std::vector<int64_t> generated_ids(tokens.begin() + prompt_len, tokens.end());
+    std::vector<int64_t> input_ids(tokens.begin() + num_draft_tokens, tokens.end());
+    while (candidates.size() < max_num_candidates) {
+        const ov::Tensor input_ids_tensor{ov::element::i64, {1, input_ids.size()}, input_ids.data()};
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        draft_decoder->start_async(encoder_hidden_state, input_ids_tensor, beam_idx);
+        auto logits = draft_decoder->wait();
+        raw_metrics.m_inference_durations[0] +=
+            MicroSeconds(ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start));
+        num_draft_tokens += input_ids.size();
+
+        process_whisper_logits(logits, 0, config, return_timestamps, generated_ids, generated_ids.empty());
+
+        const size_t vocab_size = logits.get_shape().back();
+        const float* logits_data = logits.data<const float>() + (logits.get_shape().at(1) - 1) * vocab_size;
+        const int64_t token = ov::genai::utils::argmax(logits, 0);
+        float sum_exp = 0.0f;
+        for (size_t i = 0; i < vocab_size; ++i) {
+            sum_exp += std::exp(logits_data[i] - logits_data[token]);
         }
+        const float log_prob = -std::log(sum_exp);
 
-        ov::genai::do_suppress_tokens(logits, batch, config.suppress_tokens);
+        candidates.push_back(token);
+        log_probs.push_back(log_prob);
+        generated_ids.push_back(token);
 
-        if (return_timestamps) {
-            const auto& generated_ids = initial_step ? std::vector<int64_t>{} : batch_to_generated_ids.at(batch);
-            ov::genai::process_whisper_timestamp_logits(logits, batch, config, generated_ids, initial_step);
+        // the less confident candidates are likely to be rejected
+        const bool is_confident = config.assistant_confidence_threshold == 0.0f ||
+                                  std::exp(log_prob) >= config.assistant_confidence_threshold;
+        if (config.stop_token_ids.count(token) || !is_confident) {
+            break;
         }
+
+        input_ids = {token};
     }
+
+    return {candidates, log_probs};
 }
 
+// The decoder validates the candidates of the draft decoder and generates one more token in a single inference. The
+// rejected candidates are removed from the key values of both decoders.
+void assisted_generation_step(std::shared_ptr<ov::genai::WhisperDecoder> decoder,
+                              std::shared_ptr<ov::genai::WhisperDecoder> draft_decoder,
+                              const ov::Tensor& encoder_hidden_state,
+                              ov::genai::Sampler& sampler,
+                              ov::genai::SequenceGroup::Ptr sequence_group,
+                              size_t& num_draft_tokens,
+                              const bool return_timestamps,
+                              const ov::genai::WhisperGenerationConfig& config,
+                              ov::genai::RawPerfMetrics& raw_metrics) {
+    ov::genai::Sequence::Ptr sequence = sequence_group->get_running_sequences().at(0);
+    const size_t generated_len = sequence->get_generated_len();
+
+    std::vector<int64_t> tokens = sequence_group->get_prompt_ids();
+    tokens.insert(tokens.end(), sequence->get_generated_ids().begin(), sequence->get_generated_ids().end());
+
+    // the decoder generates one more token after the candidates
+    size_t max_num_candidates = sequence_group->get_max_new_tokens() - generated_len - 1;
+    if (config.assistant_confidence_threshold == 0.0f) {
+        max_num_candidates = std::min(max_num_candidates, config.num_assistant_tokens);
+    }
+
+    const auto step_start = std::chrono::steady_clock::now();
+    auto [candidates, log_probs] = generate_candidates(draft_decoder,
+                                                       encoder_hidden_state,
+                                                       tokens,
+                                                       sequence_group->get_prompt_len(),
+                                                       num_draft_tokens,
+                                                       max_num_candidates,
+                                                       return_timestamps,
+                                                       config,
+                                                       raw_metrics);
+    const size_t num_candidates = candidates.size();
+
+    for (size_t i = 0; i < num_candidates; ++i) {
+        sequence->append_token(candidates[i], log_probs[i]);
+    }
+    sequence_group->set_num_validated_tokens(num_candidates);
+    sequence_group->schedule_tokens(num_candidates + 1);
+
+    ov::Tensor beam_idx = decoder->create_host_tensor(ov::element::i32, {1});
+    beam_idx.data<int32_t>()[0] = 0;
+
+    std::vector<int64_t> input_ids{tokens.back()};
+    input_ids.insert(input_ids.end(), candidates.begin(), candidates.end());
+    const ov::Tensor input_ids_tensor{ov::element::i64, {1, input_ids.size()}, input_ids.data()};
+
+    const auto infer_start = std::chrono::steady_clock::now();
+    decoder->start_async(encoder_hidden_state, input_ids_tensor, beam_idx);
+    auto logits = decoder->wait();
+    const auto infer_end = std::chrono::steady_clock::now();
+    raw_metrics.m_inference_durations[0] += MicroSeconds(ov::genai::PerfMetrics::get_microsec(infer_end - infer_start));
+
+    OPENVINO_ASSERT(logits.get_shape().at(1) == num_candidates + 1,
+                    "Decoder is expected to output the logits of all the candidates");
+
+    // the logits of each position are processed as the last ones of the sequence which ends with the candidate
+    const size_t vocab_size = logits.get_shape().back();
+    std::vector<int64_t> generated_ids = tokens;
+    generated_ids.erase(generated_ids.begin(), generated_ids.begin() + sequence_group->get_prompt_len());
+    for (size_t position = 0; position <= num_candidates; ++position) {
+        ov::Tensor position_logits{ov::element::f32, {1, 1, vocab_size}, logits.data<float>() + position * vocab_size};
+        process_whisper_logits(position_logits, 0, config, return_timestamps, generated_ids, generated_ids.empty());
+        if (position < num_candidates) {
+            generated_ids.push_back(candidates[position]);
+        }
+    }
+
+    sampler.sample({sequence_group}, logits, true);
+
+    // the accepted tokens are of the same step, each of them is counted as a generated token
+    const size_t num_generated_tokens = sequence->get_generated_len() - generated_len;
+    const auto step_ms = ov::genai::PerfMetrics::get_microsec(infer_end - step_start);
+    for (size_t i = 0; i < num_generated_tokens; ++i) {
+        raw_metrics.m_token_infer_durations.emplace_back(step_ms / num_generated_tokens);
+        raw_metrics.m_new_token_times.emplace_back(infer_end);
+        raw_metrics.m_batch_sizes.emplace_back(1);
+    }
+
+    if (sequence_group->has_finished()) {
+        return;
+    }
+
+    // the key values of the decoder end with the last candidate, the draft decoder hasn't inferred it
+    const size_t num_accepted = num_generated_tokens - 1;
+    decoder->trim_kv_cache(num_candidates - num_accepted);
+    if (num_candidates > 0) {
+        const size_t num_draft_rejected = num_candidates - 1 - std::min(num_accepted, num_candidates - 1);
+        draft_decoder->trim_kv_cache(num_draft_rejected);
+        num_draft_tokens -= num_draft_rejected;
+    }
+}
+
+// appends the [num_alignment_heads, num_frames] cross-attention weights of the token sampled by the last inference
+void append_cross_attention_weights(std::shared_ptr<ov::genai::WhisperDecoder> decoder, std::vector<float>& weights) {
+    const ov::Tensor weights_tensor = decoder->get_cross_attention_weights();
+    const float* weights_data = weights_tensor.data<float>();
+    weights.insert(weights.end(), weights_data, weights_data + weights_tensor.get_size());
+}
+
+// the cross-attention weights of each generated token are appended to cross_attention_weights, if it's set
 std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::WhisperDecoder> decoder,
                                                   const std::vector<int64_t>& input_ids,
                                                   const ov::Tensor& encoder_hidden_state,
@@ -55,7 +236,9 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
                                                   ov::genai::SequenceGroup::Ptr sequence_group,
                                                   const bool return_timestamps,
                                                   const ov::genai::WhisperGenerationConfig& config,
-                                                  ov::genai::RawPerfMetrics& raw_metrics) {
+                                                  ov::genai::RawPerfMetrics& raw_metrics,
+                                                  std::shared_ptr<ov::genai::WhisperDecoder> draft_decoder = nullptr,
+                                                  std::vector<float>* cross_attention_weights = nullptr) {
     const auto handle = std::make_shared<ov::genai::GenerationHandleImpl>(sequence_group->get_generation_stream(),
                                                                           sequence_group->get_sampling_parameters());
 
@@ -90,6 +273,10 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
     raw_metrics.m_new_token_times.emplace_back(infer_end);
     raw_metrics.m_batch_sizes.emplace_back(batch_size);
 
+    if (cross_attention_weights) {
+        append_cross_attention_weights(decoder, *cross_attention_weights);
+    }
+
     process_whisper_logits(logits, config, return_timestamps, {});
 
     // sample last token only
@@ -100,9 +287,26 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
     sampler.sample({sequence_group}, logits);
     stream_generated_tokens();
 
+    // the draft decoder infers the prompt with its first candidates
+    size_t num_draft_tokens = 0;
+
     // "Generation" phase
     while (!sequence_group->has_finished() && !sequence_group->handle_stopped() &&
            !sequence_group->handle_cancelled()) {
+        if (draft_decoder) {
+            assisted_generation_step(decoder,
+                                     draft_decoder,
+                                     encoder_hidden_state,
+                                     sampler,
+                                     sequence_group,
+                                     num_draft_tokens,
+                                     return_timestamps,
+                                     config,
+                                     raw_metrics);
+            stream_generated_tokens();
+            continue;
+        }
+
         std::map<size_t, std::vector<int64_t>> batch_to_generated_ids{};
 
         sequence_group->schedule_tokens(1);
@@ -162,6 +366,10 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
         raw_metrics.m_new_token_times.emplace_back(infer_end);
         raw_metrics.m_batch_sizes.emplace_back(total_num_tokens);
 
+        if (cross_attention_weights) {
+            append_cross_attention_weights(decoder, *cross_attention_weights);
+        }
+
         process_whisper_logits(logits, config, return_timestamps, batch_to_generated_ids);
 
         sampler.sample({sequence_group}, logits);
@@ -218,6 +426,43 @@ ov::Tensor encode(ov::InferRequest& request,
     return request.get_tensor("last_hidden_state");
 }
 
+// starts encoding of the features chunk asynchronously, the chunk is copied so that it can be released
+void start_encode(ov::InferRequest& request,
+                  const std::vector<float>& mel_data,
+                  const size_t feature_size,
+                  const size_t nb_max_frames) {
+    OPENVINO_ASSERT(mel_data.size() == feature_size * nb_max_frames,
+                    "Mel spectrogram required size: ",
+                    feature_size,
+                    " * ",
+                    nb_max_frames,
+                    ". Actual size: ",
+                    mel_data.size(),
+                    ".");
+
+    ov::Tensor input_tensor(ov::element::f32, {1, feature_size, nb_max_frames});
+    std::copy(mel_data.begin(), mel_data.end(), input_tensor.data<float>());
+
+    request.set_tensor("input_features", input_tensor);
+    request.start_async();
+}
+
+// waits for the encoding started by start_encode(), only the time of waiting is added to the inference durations
+ov::Tensor wait_encode(ov::InferRequest& request,
+                       const size_t feature_size,
+                       const size_t nb_max_frames,
+                       ov::genai::RawPerfMetrics& raw_metrics) {
+    const auto wait_start = std::chrono::steady_clock::now();
+    request.wait();
+    const auto wait_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - wait_start);
+    raw_metrics.m_inference_durations[0] += MicroSeconds(wait_ms);
+
+    // reset input tensor
+    request.set_tensor("input_features", ov::Tensor(ov::element::f32, {0, feature_size, nb_max_frames}));
+
+    return request.get_tensor("last_hidden_state");
+}
+
 std::vector<int64_t> prepare_init_tokens(ov::Tensor& encoder_hidden_state,
                                          std::shared_ptr<ov::genai::WhisperDecoder> decoder,
                                          const ov::genai::WhisperGenerationConfig& config,
@@ -258,6 +503,241 @@ std::vector<int64_t> prepare_init_tokens(ov::Tensor& encoder_hidden_state,
                                 config.no_timestamps_token_id};
 }
 
+/**
+ * Encodes the 30 seconds chunks of several requests with a single encoder inference, if the encoder model accepts
+ * a dynamic batch, otherwise one by one. The hidden states are copied out of the infer request, one [1, frames, dim]
+ * tensor per chunk.
+ */
+std::vector<ov::Tensor> encode_batch(ov::InferRequest& request,
+                                     std::vector<std::vector<float>>& mel_data,
+                                     const size_t feature_size,
+                                     const size_t nb_max_frames,
+                                     const std::vector<ov::genai::RawPerfMetrics*>& raw_metrics) {
+    const bool is_dynamic_batch =
+        request.get_compiled_model().input("input_features").get_partial_shape()[0].is_dynamic();
+    const size_t chunk_size = feature_size * nb_max_frames;
+    const size_t encoder_batch_size = is_dynamic_batch ? mel_data.size() : 1;
+
+    std::vector<ov::Tensor> hidden_states;
+    hidden_states.reserve(mel_data.size());
+    ov::Tensor input_tensor(ov::element::f32, {encoder_batch_size, feature_size, nb_max_frames});
+
+    for (size_t first_chunk = 0; first_chunk < mel_data.size(); first_chunk += encoder_batch_size) {
+        for (size_t chunk = 0; chunk < encoder_batch_size; ++chunk) {
+            OPENVINO_ASSERT(mel_data[first_chunk + chunk].size() == chunk_size,
+                            "Mel spectrogram required size: ",
+                            feature_size,
+                            " * ",
+                            nb_max_frames,
+                            ". Actual size: ",
+                            mel_data[first_chunk + chunk].size(),
+                            ".");
+            std::copy(mel_data[first_chunk + chunk].begin(),
+                      mel_data[first_chunk + chunk].end(),
+                      input_tensor.data<float>() + chunk * chunk_size);
+        }
+
+        request.set_tensor("input_features", input_tensor);
+
+        const auto infer_start = std::chrono::steady_clock::now();
+        request.infer();
+        const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+        for (size_t chunk = 0; chunk < encoder_batch_size; ++chunk) {
+            raw_metrics[first_chunk + chunk]->m_inference_durations[0] += MicroSeconds(infer_ms);
+        }
+
+        const ov::Tensor last_hidden_state = request.get_tensor("last_hidden_state");
+        ov::Shape hidden_state_shape = last_hidden_state.get_shape();
+        hidden_state_shape[0] = 1;
+        for (size_t chunk = 0; chunk < encoder_batch_size; ++chunk) {
+            ov::Tensor hidden_state(last_hidden_state.get_element_type(), hidden_state_shape);
+            std::memcpy(hidden_state.data(),
+                        static_cast<const uint8_t*>(last_hidden_state.data()) + chunk * hidden_state.get_byte_size(),
+                        hidden_state.get_byte_size());
+            hidden_states.push_back(hidden_state);
+        }
+    }
+
+    // reset input tensor
+    request.set_tensor("input_features", ov::Tensor(ov::element::f32, {0, feature_size, nb_max_frames}));
+
+    return hidden_states;
+}
+
+void add_decoder_infer_metrics(const std::vector<ov::genai::RawPerfMetrics*>& raw_metrics,
+                               const std::vector<size_t>& requests,
+                               const float infer_ms,
+                               const std::chrono::steady_clock::time_point infer_end,
+                               const size_t batch_size) {
+    for (size_t request : requests) {
+        raw_metrics[request]->m_inference_durations[0] += MicroSeconds(infer_ms);
+        raw_metrics[request]->m_token_infer_durations.emplace_back(infer_ms);
+        raw_metrics[request]->m_new_token_times.emplace_back(infer_end);
+        raw_metrics[request]->m_batch_sizes.emplace_back(batch_size);
+    }
+}
+
+/**
+ * Decodes the chunks of several requests in lockstep: each step infers the running sequences of all the unfinished
+ * requests as the rows of a single decoder batch. The prompts must be of the same length, as the decoder state has
+ * a single cache position. The finished requests leave the batch through beam_idx, which also reorders the beams of
+ * each request within its own rows.
+ */
+std::vector<std::vector<int64_t>> decode_batch(std::shared_ptr<ov::genai::WhisperDecoder> decoder,
+                                               const std::vector<std::vector<int64_t>>& prompts,
+                                               const std::vector<ov::Tensor>& encoder_hidden_states,
+                                               const std::vector<bool>& return_timestamps,
+                                               ov::genai::Sampler& sampler,
+                                               const ov::genai::WhisperGenerationConfig& config,
+                                               const std::vector<ov::genai::RawPerfMetrics*>& raw_metrics) {
+    const size_t num_requests = prompts.size();
+    const size_t prompt_len = prompts.at(0).size();
+
+    std::vector<ov::genai::SequenceGroup::Ptr> sequence_groups;
+    for (size_t request = 0; request < num_requests; ++request) {
+        OPENVINO_ASSERT(prompts[request].size() == prompt_len, "Batched prompts must be of the same length");
+        sequence_groups.push_back(std::make_shared<ov::genai::SequenceGroup>(request, prompts[request], config, 1));
+    }
+
+    // the request of each row of the decoder batch and encoder hidden states of these rows
+    std::vector<size_t> row_requests;
+    ov::Tensor rows_hidden_states;
+    auto set_row_requests = [&](std::vector<size_t>&& new_row_requests) {
+        if (new_row_requests == row_requests) {
+            return;
+        }
+        row_requests = std::move(new_row_requests);
+
+        ov::Shape shape = encoder_hidden_states.at(0).get_shape();
+        shape[0] = row_requests.size();
+        rows_hidden_states = decoder->create_host_tensor(encoder_hidden_states[0].get_element_type(), shape);
+        const size_t row_size = encoder_hidden_states[0].get_byte_size();
+        for (size_t row = 0; row < row_requests.size(); ++row) {
+            std::memcpy(static_cast<uint8_t*>(rows_hidden_states.data()) + row * row_size,
+                        encoder_hidden_states[row_requests[row]].data(),
+                        row_size);
+        }
+    };
+
+    std::vector<size_t> requests(num_requests);
+    std::iota(requests.begin(), requests.end(), 0);
+    set_row_requests(std::vector<size_t>(requests));
+
+    ov::Tensor input_ids = decoder->create_host_tensor(ov::element::i64, {num_requests, prompt_len});
+    for (size_t request = 0; request < num_requests; ++request) {
+        std::copy(prompts[request].begin(), prompts[request].end(), input_ids.data<int64_t>() + request * prompt_len);
+    }
+
+    ov::Tensor beam_idx = decoder->create_host_tensor(ov::element::i32, {num_requests});
+    std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + num_requests, 0);
+
+    auto infer_start = std::chrono::steady_clock::now();
+    decoder->start_async(rows_hidden_states, input_ids, beam_idx);
+
+    auto logits = decoder->wait();
+    auto infer_end = std::chrono::steady_clock::now();
+    add_decoder_infer_metrics(raw_metrics,
+                              requests,
+                              ov::genai::PerfMetrics::get_microsec(infer_end - infer_start),
+                              infer_end,
+                              num_requests);
+
+    const std::vector<int64_t> no_generated_ids;
+    for (size_t row = 0; row < num_requests; ++row) {
+        process_whisper_logits(logits, row, config, return_timestamps[row], no_generated_ids, true);
+    }
+
+    // sample last token only
+    const size_t output_sequence_len = logits.get_shape().at(1);
+    for (auto& sequence_group : sequence_groups) {
+        sequence_group->schedule_tokens(prompt_len);
+        sequence_group->set_output_seq_len(output_sequence_len);
+    }
+
+    sampler.sample(sequence_groups, logits);
+
+    // the first row of each request in the last inferred batch
+    std::vector<size_t> request_row_offsets = requests;
+
+    // "Generation" phase
+    while (true) {
+        std::vector<ov::genai::SequenceGroup::Ptr> running_groups;
+        std::vector<size_t> running_requests, new_row_requests, new_request_row_offsets(num_requests, 0);
+        std::vector<int64_t> new_input_ids;
+        std::vector<int32_t> next_beams;
+        std::vector<std::vector<int64_t>> rows_generated_ids;
+
+        for (size_t request = 0; request < num_requests; ++request) {
+            auto& sequence_group = sequence_groups[request];
+            if (sequence_group->has_finished()) {
+                continue;
+            }
+            running_groups.push_back(sequence_group);
+            running_requests.push_back(request);
+            new_request_row_offsets[request] = new_row_requests.size();
+
+            sequence_group->schedule_tokens(1);
+            const size_t position_id = sequence_group->get_num_processed_tokens();
+            std::map<size_t, int32_t> beam_idxs = sampler.get_beam_idxs(sequence_group);
+
+            for (auto& sequence : sequence_group->get_running_sequences()) {
+                new_input_ids.push_back(sequence->get_generated_ids()[position_id - sequence_group->get_prompt_len()]);
+                next_beams.push_back(static_cast<int32_t>(request_row_offsets[request]) + beam_idxs[sequence->get_id()]);
+                rows_generated_ids.push_back(sequence->get_generated_ids());
+                new_row_requests.push_back(request);
+            }
+        }
+
+        if (running_groups.empty()) {
+            break;
+        }
+
+        const size_t batch_size = new_row_requests.size();
+        set_row_requests(std::move(new_row_requests));
+        request_row_offsets = std::move(new_request_row_offsets);
+
+        input_ids = decoder->create_host_tensor(ov::element::i64, {batch_size, 1});
+        std::copy(new_input_ids.begin(), new_input_ids.end(), input_ids.data<int64_t>());
+        if (beam_idx.get_shape()[0] != batch_size) {
+            beam_idx.set_shape({batch_size});
+        }
+        std::copy_n(next_beams.data(), batch_size, beam_idx.data<int32_t>());
+
+        infer_start = std::chrono::steady_clock::now();
+        decoder->start_async(rows_hidden_states, input_ids, beam_idx);
+
+        logits = decoder->wait();
+        infer_end = std::chrono::steady_clock::now();
+        add_decoder_infer_metrics(raw_metrics,
+                                  running_requests,
+                                  ov::genai::PerfMetrics::get_microsec(infer_end - infer_start),
+                                  infer_end,
+                                  batch_size);
+
+        for (size_t row = 0; row < batch_size; ++row) {
+            process_whisper_logits(logits,
+                                   row,
+                                   config,
+                                   return_timestamps[row_requests[row]],
+                                   rows_generated_ids[row],
+                                   false);
+        }
+
+        sampler.sample(running_groups, logits);
+    }
+
+    // there is also check in generation config validate function
+    OPENVINO_ASSERT(config.num_return_sequences == 1);
+    std::vector<std::vector<int64_t>> tokens;
+    tokens.reserve(num_requests);
+    for (auto& sequence_group : sequence_groups) {
+        tokens.push_back(sequence_group->get_finished_sequences()[0]->get_generated_ids());
+        sampler.clear_request_info(sequence_group->get_request_id());
+    }
+
+    return tokens;
+}
+
 }  // namespace
 
 namespace ov {
@@ -271,7 +751,9 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        std::shared_ptr<WhisperDecoder> decoder,
                                        WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<StreamerBase> streamer,
-                                       Sampler& sampler) {
+                                       Sampler& sampler,
+                                       std::shared_ptr<WhisperDecoder> draft_decoder,
+                                       ov::InferRequest* next_encoder) {
     size_t max_new_tokens = config.get_max_new_tokens();
 
     WhisperGenerateResult result;
@@ -303,16 +785,50 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
     const float frame_length_in_seconds =
         static_cast<float>(feature_extractor.hop_length) / feature_extractor.sampling_rate;
 
+    // the weights of the generated tokens of the current chunk, the features of the audio are padded to 30 seconds
+    std::vector<float> cross_attention_weights;
+    const size_t num_speech_frames = raw_speech.size() / feature_extractor.hop_length;
+    auto& token_times = result.token_times;
+    if (config.word_timestamps) {
+        token_times = std::vector<std::pair<float, float>>{};
+    }
+
+    // the window following the current one is encoded by the spare encoder request during the decoding, the encoder
+    // requests swap when the seek of the next window matches it, otherwise the speculative encoding is discarded
+    ov::InferRequest* current_encoder = &encoder;
+    ov::InferRequest* spare_encoder = is_shortform ? nullptr : next_encoder;
+    std::optional<size_t> speculative_chunk_offset;
+
     for (size_t chunk_offset = 0; chunk_offset < input_features.n_frames; chunk_offset += segment_offset) {
         const float chunk_time_offset = chunk_offset * frame_length_in_seconds;
 
-        auto input_features_chunk = input_features.get_data_with_offset(chunk_offset, feature_extractor.nb_max_frames);
-
-        ov::Tensor hidden_state_tensor = encode(encoder,
-                                                input_features_chunk,
-                                                feature_extractor.feature_size,
-                                                feature_extractor.nb_max_frames,
-                                                raw_metrics);
+        ov::Tensor hidden_state_tensor;
+        if (speculative_chunk_offset == chunk_offset) {
+            hidden_state_tensor =
+                wait_encode(*spare_encoder, feature_extractor.feature_size, feature_extractor.nb_max_frames, raw_metrics);
+            std::swap(current_encoder, spare_encoder);
+        } else {
+            if (speculative_chunk_offset.has_value()) {
+                spare_encoder->wait();
+            }
+            auto input_features_chunk = input_features.get_data_with_offset(chunk_offset, feature_extractor.nb_max_frames);
+            hidden_state_tensor = encode(*current_encoder,
+                                         input_features_chunk,
+                                         feature_extractor.feature_size,
+                                         feature_extractor.nb_max_frames,
+                                         raw_metrics);
+        }
+        speculative_chunk_offset.reset();
+
+        // the seek typically advances by the whole window
+        const size_t next_chunk_offset = chunk_offset + feature_extractor.nb_max_frames;
+        if (spare_encoder && next_chunk_offset < input_features.n_frames) {
+            start_encode(*spare_encoder,
+                         input_features.get_data_with_offset(next_chunk_offset, feature_extractor.nb_max_frames),
+                         feature_extractor.feature_size,
+                         feature_extractor.nb_max_frames);
+            speculative_chunk_offset = next_chunk_offset;
+        }
 
         // prepare init_tokens just once for whole input
         if (init_tokens.empty()) {
@@ -332,10 +848,34 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                           sequence_group,
                                           return_timestamps,
                                           config,
-                                          raw_metrics);
+                                          raw_metrics,
+                                          draft_decoder,
+                                          config.word_timestamps ? &cross_attention_weights : nullptr);
         decoder->reset_state();
+        if (draft_decoder) {
+            draft_decoder->reset_state();
+        }
         std::vector<int64_t> chunk_output_tokens = result.tokens[0];
 
+        std::vector<std::pair<float, float>> chunk_token_times;
+        if (config.word_timestamps) {
+            const size_t num_heads = config.alignment_heads.size();
+            const size_t num_frames = hidden_state_tensor.get_shape().at(1);
+            // the encoder halves the features frames
+            const size_t num_audio_frames =
+                std::min(num_speech_frames - std::min(chunk_offset, num_speech_frames), feature_extractor.nb_max_frames) *
+                num_frames / feature_extractor.nb_max_frames;
+            cross_attention_weights.resize(chunk_output_tokens.size() * num_heads * num_frames);
+            chunk_token_times = ov::genai::get_token_times(cross_attention_weights,
+                                                           chunk_output_tokens.size(),
+                                                           num_heads,
+                                                           num_frames,
+                                                           num_audio_frames,
+                                                           time_precision,
+                                                           chunk_time_offset);
+            cross_attention_weights.clear();
+        }
+
         if (return_timestamps) {
             auto extracted_segments = ov::genai::extract_segments(chunk_output_tokens,
                                                                   config,
@@ -351,6 +891,14 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                  extracted_segments.non_timestamp_tokens.begin(),
                                  extracted_segments.non_timestamp_tokens.end());
 
+            if (token_times.has_value()) {
+                for (const auto& [start, end] : extracted_segments.segment_ranges) {
+                    token_times->insert(token_times->end(),
+                                        chunk_token_times.begin() + start,
+                                        chunk_token_times.begin() + end);
+                }
+            }
+
             if (streamer &&
                 streamer->write(extracted_segments.non_timestamp_tokens) != ov::genai::StreamingStatus::RUNNING) {
                 cancelled = true;
@@ -360,6 +908,9 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
             segment_offset = extracted_segments.last_offset;
         } else {
             output_tokens.insert(output_tokens.end(), chunk_output_tokens.begin(), chunk_output_tokens.end());
+            if (token_times.has_value()) {
+                token_times->insert(token_times->end(), chunk_token_times.begin(), chunk_token_times.end());
+            }
         }
 
         if (is_shortform) {
@@ -371,6 +922,10 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
         }
     }
 
+    if (speculative_chunk_offset.has_value()) {
+        spare_encoder->wait();
+    }
+
     if (streamer) {
         streamer->end();
     }
@@ -384,5 +939,318 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
 
     return result;
 }
+
+std::vector<int64_t> whisper_decode_window(const ov::genai::WhisperGenerationConfig& config,
+                                           const std::vector<int64_t>& prompt_tokens,
+                                           WhisperFeatures& input_features,
+                                           ov::InferRequest& encoder,
+                                           std::shared_ptr<WhisperDecoder> decoder,
+                                           const WhisperFeatureExtractor& feature_extractor,
+                                           Sampler& sampler,
+                                           std::vector<int64_t>& init_tokens) {
+    RawPerfMetrics raw_metrics;
+    raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+
+    auto input_features_chunk = input_features.get_data_with_offset(0, feature_extractor.nb_max_frames);
+    ov::Tensor hidden_state_tensor = encode(encoder,
+                                            input_features_chunk,
+                                            feature_extractor.feature_size,
+                                            feature_extractor.nb_max_frames,
+                                            raw_metrics);
+
+    // timestamps are generated to find the offsets of the decoded text
+    const bool return_timestamps = true;
+    if (init_tokens.empty()) {
+        init_tokens = prepare_init_tokens(hidden_state_tensor, decoder, config, return_timestamps, raw_metrics);
+    }
+
+    std::vector<int64_t> window_init_tokens = prompt_tokens;
+    window_init_tokens.insert(window_init_tokens.end(), init_tokens.begin(), init_tokens.end());
+
+    SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, window_init_tokens, config, 1);
+
+    auto [result, cancelled] = decode(decoder,
+                                      window_init_tokens,
+                                      hidden_state_tensor,
+                                      nullptr,
+                                      sampler,
+                                      sequence_group,
+                                      return_timestamps,
+                                      config,
+                                      raw_metrics);
+    decoder->reset_state();
+
+    return result.tokens[0];
+}
+
+std::vector<WhisperGenerateResult> whisper_generate_batch(const ov::genai::WhisperGenerationConfig& config,
+                                                          const ov::genai::WhisperConfig& model_config,
+                                                          const WhisperContextTokens& context_tokens,
+                                                          const std::vector<RawSpeechInput>& raw_speeches,
+                                                          ov::InferRequest& encoder,
+                                                          std::shared_ptr<WhisperDecoder> decoder,
+                                                          WhisperFeatureExtractor& feature_extractor,
+                                                          Sampler& sampler) {
+    const size_t max_new_tokens = config.get_max_new_tokens();
+    const size_t num_requests = raw_speeches.size();
+
+    // per request state of the chunked decoding
+    struct WhisperBatchRequest {
+        WhisperFeatures input_features;
+        bool is_shortform;
+        bool return_timestamps;
+        std::vector<int64_t> init_tokens;
+        std::vector<Segment> segments;
+        size_t chunk_offset = 0;
+    };
+
+    std::vector<WhisperGenerateResult> results(num_requests);
+    std::vector<WhisperBatchRequest> requests(num_requests);
+    std::vector<RawPerfMetrics*> all_raw_metrics;
+
+    for (size_t request_idx = 0; request_idx < num_requests; ++request_idx) {
+        WhisperGenerateResult& result = results[request_idx];
+        RawPerfMetrics& raw_metrics = result.perf_metrics.raw_metrics;
+        result.perf_metrics.num_input_tokens = 0;
+        raw_metrics.m_new_token_times.reserve(max_new_tokens);
+        raw_metrics.m_batch_sizes.reserve(max_new_tokens);
+        raw_metrics.m_token_infer_durations.reserve(max_new_tokens);
+        raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+        all_raw_metrics.push_back(&raw_metrics);
+
+        WhisperBatchRequest& request = requests[request_idx];
+        const auto infer_start = std::chrono::steady_clock::now();
+        request.input_features = feature_extractor.extract(raw_speeches[request_idx]);
+        const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+        result.perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(infer_ms);
+
+        request.is_shortform = request.input_features.n_frames <= feature_extractor.nb_max_frames;
+        // long-form audio processing requires timestamps to be enabled
+        request.return_timestamps = config.return_timestamps || !request.is_shortform;
+    }
+
+    // 0.02 by default
+    const float time_precision = static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions;
+
+    OPENVINO_ASSERT(feature_extractor.sampling_rate != 0, "Sampling Rate for Feature Extractor is 0");
+    const float frame_length_in_seconds =
+        static_cast<float>(feature_extractor.hop_length) / feature_extractor.sampling_rate;
+
+    // each round encodes and decodes the next chunk of all the unfinished requests
+    while (true) {
+        std::vector<size_t> active_requests;
+        for (size_t request_idx = 0; request_idx < num_requests; ++request_idx) {
+            if (requests[request_idx].chunk_offset < requests[request_idx].input_features.n_frames) {
+                active_requests.push_back(request_idx);
+            }
+        }
+        if (active_requests.empty()) {
+            break;
+        }
+
+        std::vector<std::vector<float>> input_features_chunks;
+        std::vector<RawPerfMetrics*> raw_metrics;
+        for (size_t request_idx : active_requests) {
+            const WhisperBatchRequest& request = requests[request_idx];
+            input_features_chunks.push_back(
+                request.input_features.get_data_with_offset(request.chunk_offset, feature_extractor.nb_max_frames));
+            raw_metrics.push_back(all_raw_metrics[request_idx]);
+        }
+
+        std::vector<ov::Tensor> hidden_states = encode_batch(encoder,
+                                                             input_features_chunks,
+                                                             feature_extractor.feature_size,
+                                                             feature_extractor.nb_max_frames,
+                                                             raw_metrics);
+
+        // the requests are decoded together if their prompts are of the same length
+        std::map<size_t, std::vector<size_t>> prompt_len_to_chunks;
+        std::vector<std::vector<int64_t>> chunk_init_tokens(active_requests.size());
+        for (size_t chunk = 0; chunk < active_requests.size(); ++chunk) {
+            WhisperBatchRequest& request = requests[active_requests[chunk]];
+            // prepare init_tokens just once for whole input
+            if (request.init_tokens.empty()) {
+                request.init_tokens =
+                    prepare_init_tokens(hidden_states[chunk], decoder, config, request.return_timestamps, *raw_metrics[chunk]);
+            }
+
+            chunk_init_tokens[chunk] = ov::genai::get_prompt_tokens(context_tokens, config, request.chunk_offset);
+            chunk_init_tokens[chunk].insert(chunk_init_tokens[chunk].end(),
+                                            request.init_tokens.begin(),
+                                            request.init_tokens.end());
+            prompt_len_to_chunks[chunk_init_tokens[chunk].size()].push_back(chunk);
+        }
+
+        for (const auto& [prompt_len, chunks] : prompt_len_to_chunks) {
+            std::vector<std::vector<int64_t>> prompts;
+            std::vector<ov::Tensor> group_hidden_states;
+            std::vector<bool> return_timestamps;
+            std::vector<RawPerfMetrics*> group_raw_metrics;
+            for (size_t chunk : chunks) {
+                prompts.push_back(chunk_init_tokens[chunk]);
+                group_hidden_states.push_back(hidden_states[chunk]);
+                return_timestamps.push_back(requests[active_requests[chunk]].return_timestamps);
+                group_raw_metrics.push_back(raw_metrics[chunk]);
+            }
+
+            std::vector<std::vector<int64_t>> chunks_output_tokens =
+                decode_batch(decoder, prompts, group_hidden_states, return_timestamps, sampler, config, group_raw_metrics);
+            decoder->reset_state();
+
+            for (size_t group_chunk = 0; group_chunk < chunks.size(); ++group_chunk) {
+                const size_t request_idx = active_requests[chunks[group_chunk]];
+                WhisperBatchRequest& request = requests[request_idx];
+                std::vector<int64_t>& output_tokens = results[request_idx].output_tokens;
+                const std::vector<int64_t>& chunk_output_tokens = chunks_output_tokens[group_chunk];
+                size_t segment_offset = 0;
+
+                if (request.return_timestamps) {
+                    const float chunk_time_offset = request.chunk_offset * frame_length_in_seconds;
+                    auto extracted_segments = ov::genai::extract_segments(chunk_output_tokens,
+                                                                          config,
+                                                                          feature_extractor.nb_max_frames,
+                                                                          time_precision,
+                                                                          chunk_time_offset);
+
+                    utils::filter_non_segment_metrics(*all_raw_metrics[request_idx],
+                                                      output_tokens.size(),
+                                                      extracted_segments.segment_ranges);
+
+                    request.segments.insert(request.segments.end(),
+                                            extracted_segments.segments.begin(),
+                                            extracted_segments.segments.end());
+
+                    output_tokens.insert(output_tokens.end(),
+                                         extracted_segments.non_timestamp_tokens.begin(),
+                                         extracted_segments.non_timestamp_tokens.end());
+
+                    segment_offset = extracted_segments.last_offset;
+                } else {
+                    output_tokens.insert(output_tokens.end(), chunk_output_tokens.begin(), chunk_output_tokens.end());
+                }
+
+                if (request.is_shortform) {
+                    segment_offset = request.input_features.n_frames;
+                }
+
+                request.chunk_offset += segment_offset;
+            }
+        }
+    }
+
+    // segments are returned only if return_timestamps was enabled by user
+    if (config.return_timestamps) {
+        for (size_t request_idx = 0; request_idx < num_requests; ++request_idx) {
+            results[request_idx].segments = std::move(requests[request_idx].segments);
+        }
+    }
+
+    return results;
+}
+WhisperGenerateResult whisper_generate_chunked(const ov::genai::WhisperGenerationConfig& config,
+                                               const ov::genai::WhisperConfig& model_config,
+                                               const WhisperContextTokens& context_tokens,
+                                               const RawSpeechInput& raw_speech,
+                                               ov::InferRequest& encoder,
+                                               std::shared_ptr<WhisperDecoder> decoder,
+                                               WhisperFeatureExtractor& feature_extractor,
+                                               const std::shared_ptr<StreamerBase> streamer,
+                                               Sampler& sampler) {
+    OPENVINO_ASSERT(config.stride_length.has_value(), "Chunked long-form generation requires 'stride_length'");
+    const size_t stride_samples = static_cast<size_t>(*config.stride_length * feature_extractor.sampling_rate);
+    const std::vector<WhisperChunkWindow> windows =
+        get_chunk_windows(raw_speech.size(), feature_extractor.n_samples, stride_samples);
+
+    // every window is short-form, the timestamps are generated only if requested
+    WhisperGenerateResult result;
+    RawPerfMetrics& raw_metrics = result.perf_metrics.raw_metrics;
+    result.perf_metrics.num_input_tokens = 0;
+    raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+
+    std::vector<std::vector<int64_t>> windows_tokens;
+    std::vector<Segment> segments;
+    for (size_t first_window = 0; first_window < windows.size(); first_window += max_chunk_batch_size) {
+        const size_t num_windows = std::min(max_chunk_batch_size, windows.size() - first_window);
+        std::vector<RawSpeechInput> windows_speech;
+        for (size_t window = first_window; window < first_window + num_windows; ++window) {
+            windows_speech.emplace_back(raw_speech.begin() + windows[window].start,
+                                        raw_speech.begin() + windows[window].end);
+        }
+
+        std::vector<WhisperGenerateResult> windows_results = whisper_generate_batch(config,
+                                                                                    model_config,
+                                                                                    context_tokens,
+                                                                                    windows_speech,
+                                                                                    encoder,
+                                                                                    decoder,
+                                                                                    feature_extractor,
+                                                                                    sampler);
+
+        // the windows of a batch are inferred together, the longest of them took the whole inference time
+        MicroSeconds batch_inference_duration{0.0f};
+        for (size_t batch_window = 0; batch_window < num_windows; ++batch_window) {
+            const WhisperChunkWindow& window = windows[first_window + batch_window];
+            WhisperGenerateResult& window_result = windows_results[batch_window];
+            const RawPerfMetrics& window_metrics = window_result.perf_metrics.raw_metrics;
+
+            batch_inference_duration = std::max(batch_inference_duration, window_metrics.m_inference_durations[0]);
+            raw_metrics.m_new_token_times.insert(raw_metrics.m_new_token_times.end(),
+                                                 window_metrics.m_new_token_times.begin(),
+                                                 window_metrics.m_new_token_times.end());
+            raw_metrics.m_batch_sizes.insert(raw_metrics.m_batch_sizes.end(),
+                                             window_metrics.m_batch_sizes.begin(),
+                                             window_metrics.m_batch_sizes.end());
+            raw_metrics.m_token_infer_durations.insert(raw_metrics.m_token_infer_durations.end(),
+                                                       window_metrics.m_token_infer_durations.begin(),
+                                                       window_metrics.m_token_infer_durations.end());
+            auto& features_extraction_durations = result.perf_metrics.whisper_raw_metrics.features_extraction_durations;
+            const auto& window_features_extraction_durations =
+                window_result.perf_metrics.whisper_raw_metrics.features_extraction_durations;
+            features_extraction_durations.insert(features_extraction_durations.end(),
+                                                 window_features_extraction_durations.begin(),
+                                                 window_features_extraction_durations.end());
+
+            std::vector<int64_t> text_tokens;
+            std::copy_if(window_result.output_tokens.begin(),
+                         window_result.output_tokens.end(),
+                         std::back_inserter(text_tokens),
+                         [&](int64_t token) {
+                             return token != config.eos_token_id && token <= config.no_timestamps_token_id;
+                         });
+            windows_tokens.push_back(std::move(text_tokens));
+
+            if (window_result.segments.has_value()) {
+                // the segments starting within the strides belong to the neighbour windows
+                const float window_start = static_cast<float>(window.start) / feature_extractor.sampling_rate;
+                const float keep_start =
+                    static_cast<float>(window.start + window.left_stride) / feature_extractor.sampling_rate;
+                const float keep_end =
+                    static_cast<float>(window.end - window.right_stride) / feature_extractor.sampling_rate;
+                for (Segment& segment : *window_result.segments) {
+                    segment.m_start += window_start;
+                    segment.m_end += window_start;
+                    if (segment.m_start >= keep_start && (segment.m_start < keep_end || window.right_stride == 0)) {
+                        segments.push_back(std::move(segment));
+                    }
+                }
+            }
+        }
+        raw_metrics.m_inference_durations[0] += batch_inference_duration;
+    }
+
+    std::sort(raw_metrics.m_new_token_times.begin(), raw_metrics.m_new_token_times.end());
+    result.output_tokens = merge_chunk_tokens(windows_tokens);
+
+    if (streamer) {
+        streamer->write(result.output_tokens);
+        streamer->end();
+    }
+
+    if (config.return_timestamps) {
+        result.segments = std::move(segments);
+    }
+
+    return result;
+}
 }  // namespace genai
 }  // namespace ov
@@ -26,9 +26,18 @@ struct Segment {
 struct WhisperGenerateResult {
     std::vector<int64_t> output_tokens;
     std::optional<std::vector<Segment>> segments = std::nullopt;
+    // the start and end times of each of the output tokens, if the word timestamps are requested
+    std::optional<std::vector<std::pair<float, float>>> token_times = std::nullopt;
     WhisperPerfMetrics perf_metrics;
 };
 
+/**
+ * @param draft_decoder The decoder of a smaller model sharing the encoder hidden states, if any. Its candidates are
+ * validated by the decoder, which is expected to output the logits of all the input tokens, see
+ * WhisperDecoder::from_path().
+ * @param next_encoder The second request of the encoder, if any. The next window of the long-form audio is encoded by
+ * it during the decoding of the current one.
+ */
 WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig& config,
                                        const ov::genai::WhisperConfig& model_config,
                                        const WhisperContextTokens& context_tokens,
@@ -37,7 +46,55 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        std::shared_ptr<WhisperDecoder> decoder,
                                        WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<StreamerBase> streamer,
-                                       Sampler& sampler);
+                                       Sampler& sampler,
+                                       std::shared_ptr<WhisperDecoder> draft_decoder = nullptr,
+                                       ov::InferRequest* next_encoder = nullptr);
+
+/**
+ * Decodes the first 30 seconds window of the features with the timestamps, for the streaming transcription.
+ *
+ * @param prompt_tokens Previous transcription tokens starting with <|startofprev|>, if any.
+ * @param init_tokens The init tokens of the stream, prepared by the first call, so that the language is detected once.
+ * @return The generated tokens including the timestamp tokens.
+ */
+std::vector<int64_t> whisper_decode_window(const ov::genai::WhisperGenerationConfig& config,
+                                           const std::vector<int64_t>& prompt_tokens,
+                                           WhisperFeatures& input_features,
+                                           ov::InferRequest& encoder,
+                                           std::shared_ptr<WhisperDecoder> decoder,
+                                           const WhisperFeatureExtractor& feature_extractor,
+                                           Sampler& sampler,
+                                           std::vector<int64_t>& init_tokens);
+
+/**
+ * Transcribes several audio inputs together: each round encodes the next 30 seconds chunks of all the unfinished
+ * inputs in a single encoder inference and decodes the chunks of the same prompt length in lockstep, as the rows of a
+ * single decoder batch. The results are the same as of whisper_generate() for each input.
+ */
+std::vector<WhisperGenerateResult> whisper_generate_batch(const ov::genai::WhisperGenerationConfig& config,
+                                                          const ov::genai::WhisperConfig& model_config,
+                                                          const WhisperContextTokens& context_tokens,
+                                                          const std::vector<RawSpeechInput>& raw_speeches,
+                                                          ov::InferRequest& encoder,
+                                                          std::shared_ptr<WhisperDecoder> decoder,
+                                                          WhisperFeatureExtractor& feature_extractor,
+                                                          Sampler& sampler);
+
+/**
+ * Transcribes long-form audio as fixed stride windows overlapping by config.stride_length seconds on each side instead
+ * of seeking by the timestamps of the previous window: the windows are encoded and decoded in batches by
+ * whisper_generate_batch() and their texts are merged by the tokens of the overlaps. The segments starting within
+ * the strides are left to the neighbour windows.
+ */
+WhisperGenerateResult whisper_generate_chunked(const ov::genai::WhisperGenerationConfig& config,
+                                               const ov::genai::WhisperConfig& model_config,
+                                               const WhisperContextTokens& context_tokens,
+                                               const RawSpeechInput& raw_speech,
+                                               ov::InferRequest& encoder,
+                                               std::shared_ptr<WhisperDecoder> decoder,
+                                               WhisperFeatureExtractor& feature_extractor,
+                                               const std::shared_ptr<StreamerBase> streamer,
+                                               Sampler& sampler);
 
 }  // namespace genai
 }  // namespace ov
@@ -0,0 +1,236 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper/word_timestamps.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+// the width of the median filter smoothing the attention weights over the frames, as of the OpenAI implementation
+constexpr size_t median_filter_width = 7;
+
+constexpr uint8_t diagonal_step = 0;
+constexpr uint8_t vertical_step = 1;
+constexpr uint8_t horizontal_step = 2;
+
+// the edges are padded by the reflection of the row
+void median_filter(const float* input, float* output, const size_t size, const size_t width) {
+    const size_t half_width = width / 2;
+    if (size <= half_width) {
+        std::copy_n(input, size, output);
+        return;
+    }
+
+    std::vector<float> window(width);
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t k = 0; k < width; ++k) {
+            ptrdiff_t idx = static_cast<ptrdiff_t>(i + k) - static_cast<ptrdiff_t>(half_width);
+            if (idx < 0) {
+                idx = -idx;
+            } else if (idx >= static_cast<ptrdiff_t>(size)) {
+                idx = 2 * static_cast<ptrdiff_t>(size - 1) - idx;
+            }
+            window[k] = input[idx];
+        }
+        std::nth_element(window.begin(), window.begin() + half_width, window.end());
+        output[i] = window[half_width];
+    }
+}
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+std::vector<std::pair<size_t, size_t>> dtw(const std::vector<float>& cost,
+                                           const size_t num_rows,
+                                           const size_t num_columns) {
+    OPENVINO_ASSERT(cost.size() == num_rows * num_columns, "DTW cost matrix doesn't match its shape");
+    if (num_rows == 0 || num_columns == 0) {
+        return {};
+    }
+
+    // the total costs of the paths ending at each cell, the first row and column are the borders
+    const size_t stride = num_columns + 1;
+    std::vector<float> total_cost((num_rows + 1) * stride, std::numeric_limits<float>::infinity());
+    std::vector<uint8_t> trace((num_rows + 1) * stride, diagonal_step);
+    total_cost[0] = 0.0f;
+
+    for (size_t row = 1; row <= num_rows; ++row) {
+        const float* previous = total_cost.data() + (row - 1) * stride;
+        float* current = total_cost.data() + row * stride;
+        uint8_t* current_trace = trace.data() + row * stride;
+        const float* row_cost = cost.data() + (row - 1) * num_columns - 1;
+
+        // the diagonal and vertical steps depend on the previous row only, so the loop is vectorized
+        for (size_t column = 1; column <= num_columns; ++column) {
+            const bool is_vertical = previous[column] < previous[column - 1];
+            current[column] = (is_vertical ? previous[column] : previous[column - 1]) + row_cost[column];
+            current_trace[column] = is_vertical ? vertical_step : diagonal_step;
+        }
+
+        for (size_t column = 1; column <= num_columns; ++column) {
+            const float horizontal_cost = current[column - 1] + row_cost[column];
+            if (horizontal_cost < current[column]) {
+                current[column] = horizontal_cost;
+                current_trace[column] = horizontal_step;
+            }
+        }
+    }
+
+    std::vector<std::pair<size_t, size_t>> path;
+    path.reserve(num_rows + num_columns);
+    for (size_t row = num_rows, column = num_columns; row > 0 && column > 0;) {
+        path.emplace_back(row - 1, column - 1);
+        const uint8_t step = trace[row * stride + column];
+        if (step != horizontal_step) {
+            --row;
+        }
+        if (step != vertical_step) {
+            --column;
+        }
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+std::vector<std::pair<float, float>> get_token_times(const std::vector<float>& attention_weights,
+                                                     const size_t num_tokens,
+                                                     const size_t num_heads,
+                                                     const size_t num_frames,
+                                                     const size_t num_audio_frames,
+                                                     const float time_precision,
+                                                     const float time_offset) {
+    OPENVINO_ASSERT(attention_weights.size() == num_tokens * num_heads * num_frames,
+                    "Cross-attention weights don't match the number of tokens, heads and frames");
+    if (num_tokens == 0 || num_heads == 0 || num_frames == 0) {
+        return std::vector<std::pair<float, float>>(num_tokens, {time_offset, time_offset});
+    }
+
+    const size_t num_columns = std::clamp<size_t>(num_audio_frames, 1, num_frames);
+
+    // [num_tokens, num_columns], the mean of the normalized and smoothed weights of the heads
+    std::vector<float> matrix(num_tokens * num_columns, 0.0f);
+    std::vector<float> head_weights(num_tokens * num_columns);
+    std::vector<float> mean(num_columns);
+    std::vector<float> inv_std(num_columns);
+    std::vector<float> filtered(num_columns);
+    for (size_t head = 0; head < num_heads; ++head) {
+        for (size_t token = 0; token < num_tokens; ++token) {
+            std::copy_n(attention_weights.data() + (token * num_heads + head) * num_frames,
+                        num_columns,
+                        head_weights.data() + token * num_columns);
+        }
+
+        // the weights of each frame are normalized over the tokens
+        std::fill(mean.begin(), mean.end(), 0.0f);
+        std::fill(inv_std.begin(), inv_std.end(), 0.0f);
+        for (size_t token = 0; token < num_tokens; ++token) {
+            const float* weights = head_weights.data() + token * num_columns;
+            for (size_t column = 0; column < num_columns; ++column) {
+                mean[column] += weights[column];
+            }
+        }
+        for (size_t column = 0; column < num_columns; ++column) {
+            mean[column] /= num_tokens;
+        }
+        for (size_t token = 0; token < num_tokens; ++token) {
+            const float* weights = head_weights.data() + token * num_columns;
+            for (size_t column = 0; column < num_columns; ++column) {
+                const float diff = weights[column] - mean[column];
+                inv_std[column] += diff * diff;
+            }
+        }
+        for (size_t column = 0; column < num_columns; ++column) {
+            const float std = std::sqrt(inv_std[column] / num_tokens);
+            inv_std[column] = std > 0.0f ? 1.0f / std : 0.0f;
+        }
+
+        for (size_t token = 0; token < num_tokens; ++token) {
+            float* weights = head_weights.data() + token * num_columns;
+            for (size_t column = 0; column < num_columns; ++column) {
+                weights[column] = (weights[column] - mean[column]) * inv_std[column];
+            }
+
+            median_filter(weights, filtered.data(), num_columns, median_filter_width);
+
+            float* matrix_row = matrix.data() + token * num_columns;
+            for (size_t column = 0; column < num_columns; ++column) {
+                matrix_row[column] += filtered[column] / num_heads;
+            }
+        }
+    }
+
+    // the path maximizes the attention of the tokens to their frames
+    for (float& value : matrix) {
+        value = -value;
+    }
+    const std::vector<std::pair<size_t, size_t>> path = dtw(matrix, num_tokens, num_columns);
+
+    // a token starts at the first frame of its row of the path
+    std::vector<size_t> start_frames(num_tokens, 0);
+    for (size_t i = path.size(); i > 0; --i) {
+        start_frames[path[i - 1].first] = path[i - 1].second;
+    }
+
+    std::vector<std::pair<float, float>> token_times(num_tokens);
+    for (size_t token = 0; token < num_tokens; ++token) {
+        const size_t end_frame = token + 1 < num_tokens ? start_frames[token + 1] : num_columns;
+        token_times[token] = {start_frames[token] * time_precision + time_offset,
+                              end_frame * time_precision + time_offset};
+    }
+    return token_times;
+}
+
+std::vector<WhisperWordTiming> group_words(const std::vector<int64_t>& tokens,
+                                           const std::vector<std::pair<float, float>>& token_times,
+                                           const int64_t eos_token_id,
+                                           const std::function<std::string(const std::vector<int64_t>&)>& decode) {
+    OPENVINO_ASSERT(tokens.size() == token_times.size(), "The number of token times doesn't match the tokens");
+
+    std::vector<WhisperWordTiming> words;
+    // the tokens of a character are decoded together
+    std::vector<int64_t> character_tokens;
+    size_t character_start = 0;
+
+    auto add_character = [&](const size_t character_end) {
+        const std::string text = decode(character_tokens);
+        const bool starts_word = words.empty() || (!text.empty() && text[0] == ' ');
+        if (starts_word) {
+            words.push_back({text, character_tokens, token_times[character_start].first, token_times[character_end].second});
+        } else {
+            words.back().word += text;
+            words.back().token_ids.insert(words.back().token_ids.end(), character_tokens.begin(), character_tokens.end());
+            words.back().end_ts = token_times[character_end].second;
+        }
+        character_tokens.clear();
+    };
+
+    size_t last_text_token = 0;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        if (tokens[i] >= eos_token_id) {
+            continue;
+        }
+        if (character_tokens.empty()) {
+            character_start = i;
+        }
+        character_tokens.push_back(tokens[i]);
+        last_text_token = i;
+
+        // the replacement character U+FFFD is decoded from an incomplete UTF-8 sequence
+        if (decode(character_tokens).find("\xEF\xBF\xBD") == std::string::npos) {
+            add_character(i);
+        }
+    }
+    if (!character_tokens.empty()) {
+        add_character(last_text_token);
+    }
+
+    return words;
+}
+
+}  // namespace genai
+}  // namespace ov
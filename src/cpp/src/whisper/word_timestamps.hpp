@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/genai/whisper_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Find the monotonic alignment of the rows to the columns of the cost matrix with the lowest total cost, each
+ * step of the path moves to the next row, the next column or both of them.
+ *
+ * @param cost The [num_rows, num_columns] cost matrix.
+ * @return The (row, column) pairs of the path from (0, 0) to (num_rows - 1, num_columns - 1).
+ */
+std::vector<std::pair<size_t, size_t>> dtw(const std::vector<float>& cost,
+                                           const size_t num_rows,
+                                           const size_t num_columns);
+
+/**
+ * @brief Find the start and end times of the generated tokens of a window by the cross-attention weights of the
+ * alignment heads: the weights are normalized over the tokens and smoothed over the frames by a median filter, the
+ * heads are averaged and the tokens are aligned to the frames by DTW.
+ *
+ * @param attention_weights The [num_tokens, num_heads, num_frames] weights of the query predicting each token.
+ * @param num_audio_frames The number of the encoder frames of the audio in the window, the rest is padding.
+ * @param time_precision The duration of an encoder frame in seconds.
+ * @param time_offset The start of the window in seconds.
+ */
+std::vector<std::pair<float, float>> get_token_times(const std::vector<float>& attention_weights,
+                                                     const size_t num_tokens,
+                                                     const size_t num_heads,
+                                                     const size_t num_frames,
+                                                     const size_t num_audio_frames,
+                                                     const float time_precision,
+                                                     const float time_offset);
+
+/**
+ * @brief Group the text tokens into words: a word starts with a space, the tokens of an incomplete UTF-8 character
+ * belong to the same word. The special and timestamp tokens starting from eos_token_id are skipped.
+ *
+ * @param decode Decodes the tokens into text.
+ */
+std::vector<WhisperWordTiming> group_words(const std::vector<int64_t>& tokens,
+                                           const std::vector<std::pair<float, float>>& token_times,
+                                           const int64_t eos_token_id,
+                                           const std::function<std::string(const std::vector<int64_t>&)>& decode);
+
+}  // namespace genai
+}  // namespace ov
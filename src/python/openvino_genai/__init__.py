@@ -17,8 +17,13 @@ from .py_openvino_genai import (
     PerfMetrics,
     StreamerBase,
     get_version,
+    get_compiled_model_cache_dir,
+    set_compiled_model_cache_dir,
     StreamingStatus,
-    TextStreamer
+    TextStreamer,
+    JsonEvent,
+    JsonEventType,
+    JsonStreamer
 )
 
 __version__ = get_version()
@@ -47,11 +52,13 @@ from .py_openvino_genai import (
     StructuralTagItem,
     StructuralTagsConfig,
     StructuredOutputConfig,
-    StopCriteria
+    StopCriteria,
+    WarmupConfig
 )
 
 # Tokenizers
 from .py_openvino_genai import (
+    RaggedTokenizedInputs,
     TokenizedInputs,
     Tokenizer
 )
@@ -62,7 +69,8 @@ from .py_openvino_genai import (
     WhisperPipeline,
     ChunkStreamerBase,
     WhisperRawPerfMetrics,
-    WhisperPerfMetrics
+    WhisperPerfMetrics,
+    WhisperStreamingResult
 )
 
 # Image generation
@@ -79,6 +87,7 @@ from .py_openvino_genai import (
     InpaintingPipeline,
     Scheduler,
     ImageGenerationConfig,
+    ImageGenerationHandle,
     Generator,
     CppStdGenerator,
     TorchGenerator,
@@ -88,21 +97,31 @@ from .py_openvino_genai import (
 
 # Continuous batching
 from .py_openvino_genai import (
+    AsyncEngineLoop,
+    AsyncGenerationStream,
     ContinuousBatchingPipeline,
+    EngineLoopConfig,
+    EngineStepOutput,
     GenerationFinishReason,
     GenerationResult,
     GenerationStatus,
     SchedulerConfig,
+    SchedulingPolicy,
+    StreamingTransport,
     CacheEvictionConfig,
     AggregationMode,
     SparseAttentionMode,
-    SparseAttentionConfig
+    SparseAttentionConfig,
+    KVCacheQuantizationMode,
+    KVCachePrecisionConfig,
+    calibrate_kv_cache_precisions
 )
 
 # RAG
 from .py_openvino_genai import (
     TextEmbeddingPipeline,
-    TextRerankPipeline
+    TextRerankPipeline,
+    VectorIndex
 )
 
 # Speech generation
@@ -6,6 +6,8 @@ import openvino as openvino
 from openvino_genai.py_openvino_genai import Adapter
 from openvino_genai.py_openvino_genai import AdapterConfig
 from openvino_genai.py_openvino_genai import AggregationMode
+from openvino_genai.py_openvino_genai import AsyncEngineLoop
+from openvino_genai.py_openvino_genai import AsyncGenerationStream
 from openvino_genai.py_openvino_genai import AutoencoderKL
 from openvino_genai.py_openvino_genai import CLIPTextModel
 from openvino_genai.py_openvino_genai import CLIPTextModelWithProjection
@@ -15,6 +17,8 @@ from openvino_genai.py_openvino_genai import ContinuousBatchingPipeline
 from openvino_genai.py_openvino_genai import CppStdGenerator
 from openvino_genai.py_openvino_genai import DecodedResults
 from openvino_genai.py_openvino_genai import EncodedResults
+from openvino_genai.py_openvino_genai import EngineLoopConfig
+from openvino_genai.py_openvino_genai import EngineStepOutput
 from openvino_genai.py_openvino_genai import FluxTransformer2DModel
 from openvino_genai.py_openvino_genai import GenerationConfig
 from openvino_genai.py_openvino_genai import GenerationFinishReason
@@ -23,15 +27,23 @@ from openvino_genai.py_openvino_genai import GenerationStatus
 from openvino_genai.py_openvino_genai import Generator
 from openvino_genai.py_openvino_genai import Image2ImagePipeline
 from openvino_genai.py_openvino_genai import ImageGenerationConfig
+from openvino_genai.py_openvino_genai import ImageGenerationHandle
 from openvino_genai.py_openvino_genai import ImageGenerationPerfMetrics
 from openvino_genai.py_openvino_genai import InpaintingPipeline
+from openvino_genai.py_openvino_genai import JsonEvent
+from openvino_genai.py_openvino_genai import JsonEventType
+from openvino_genai.py_openvino_genai import JsonStreamer
+from openvino_genai.py_openvino_genai import KVCachePrecisionConfig
+from openvino_genai.py_openvino_genai import KVCacheQuantizationMode
 from openvino_genai.py_openvino_genai import LLMPipeline
 from openvino_genai.py_openvino_genai import PerfMetrics
+from openvino_genai.py_openvino_genai import RaggedTokenizedInputs
 from openvino_genai.py_openvino_genai import RawImageGenerationPerfMetrics
 from openvino_genai.py_openvino_genai import RawPerfMetrics
 from openvino_genai.py_openvino_genai import SD3Transformer2DModel
 from openvino_genai.py_openvino_genai import Scheduler
 from openvino_genai.py_openvino_genai import SchedulerConfig
+from openvino_genai.py_openvino_genai import SchedulingPolicy
 from openvino_genai.py_openvino_genai import SparseAttentionConfig
 from openvino_genai.py_openvino_genai import SparseAttentionMode
 from openvino_genai.py_openvino_genai import SpeechGenerationConfig
@@ -39,6 +51,7 @@ from openvino_genai.py_openvino_genai import SpeechGenerationPerfMetrics
 from openvino_genai.py_openvino_genai import StopCriteria
 from openvino_genai.py_openvino_genai import StreamerBase
 from openvino_genai.py_openvino_genai import StreamingStatus
+from openvino_genai.py_openvino_genai import StreamingTransport
 from openvino_genai.py_openvino_genai import StructuralTagItem
 from openvino_genai.py_openvino_genai import StructuralTagsConfig
 from openvino_genai.py_openvino_genai import StructuredOutputConfig
@@ -54,13 +67,18 @@ from openvino_genai.py_openvino_genai import Tokenizer
 from openvino_genai.py_openvino_genai import TorchGenerator
 from openvino_genai.py_openvino_genai import UNet2DConditionModel
 from openvino_genai.py_openvino_genai import VLMPipeline
+from openvino_genai.py_openvino_genai import WarmupConfig
 from openvino_genai.py_openvino_genai import WhisperGenerationConfig
 from openvino_genai.py_openvino_genai import WhisperPerfMetrics
 from openvino_genai.py_openvino_genai import WhisperPipeline
 from openvino_genai.py_openvino_genai import WhisperRawPerfMetrics
+from openvino_genai.py_openvino_genai import WhisperStreamingResult
+from openvino_genai.py_openvino_genai import calibrate_kv_cache_precisions
 from openvino_genai.py_openvino_genai import draft_model
+from openvino_genai.py_openvino_genai import get_compiled_model_cache_dir
 from openvino_genai.py_openvino_genai import get_version
+from openvino_genai.py_openvino_genai import set_compiled_model_cache_dir
 import os as os
 from . import py_openvino_genai
-__all__: list[str] = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'LLMPipeline', 'PerfMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'TextEmbeddingPipeline', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMPipeline', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version', 'openvino', 'os', 'py_openvino_genai']
+__all__: list[str] = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AsyncEngineLoop', 'AsyncGenerationStream', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedResults', 'EngineLoopConfig', 'EngineStepOutput', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationHandle', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'JsonEvent', 'JsonEventType', 'JsonStreamer', 'KVCachePrecisionConfig', 'KVCacheQuantizationMode', 'LLMPipeline', 'PerfMetrics', 'RaggedTokenizedInputs', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'SchedulingPolicy', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StreamingTransport', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'TextEmbeddingPipeline', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMPipeline', 'WarmupConfig', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperStreamingResult', 'calibrate_kv_cache_precisions', 'draft_model', 'get_compiled_model_cache_dir', 'get_version', 'openvino', 'os', 'py_openvino_genai', 'set_compiled_model_cache_dir']
 __version__: str
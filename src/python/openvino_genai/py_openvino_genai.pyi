@@ -3,9 +3,11 @@ Pybind11 binding for OpenVINO GenAI library
 """
 from __future__ import annotations
 import collections.abc
+import numpy
 import openvino._pyopenvino
+import pathlib
 import typing
-__all__: list[str] = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'TextEmbeddingPipeline', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
+__all__: list[str] = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AsyncEngineLoop', 'AsyncGenerationStream', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'EngineLoopConfig', 'EngineStepOutput', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'HistogramSnapshot', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationHandle', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'JsonEvent', 'JsonEventType', 'JsonStreamer', 'KVCachePrecisionConfig', 'KVCacheQuantizationMode', 'LLMPipeline', 'MeanStdPair', 'MemoryReport', 'PerfMetrics', 'PipelineMetrics', 'PrefixCacheDigest', 'RaggedTokenizedInputs', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'RequestMetrics', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'ServingMetrics', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StreamingTransport', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'TextEmbeddingPipeline', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VectorIndex', 'WarmupConfig', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperStreamingResult', 'WhisperWordTiming', 'calibrate_kv_cache_precisions', 'draft_model', 'get_compiled_model_cache_dir', 'get_version', 'set_compiled_model_cache_dir']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -44,13 +46,16 @@ class AdapterConfig:
           MODE_STATIC
         
           MODE_FUSE
+        
+          MODE_POOL
         """
         MODE_AUTO: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_AUTO: 0>
         MODE_DYNAMIC: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_DYNAMIC: 1>
         MODE_FUSE: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_FUSE: 4>
+        MODE_POOL: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_POOL: 5>
         MODE_STATIC: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_STATIC: 3>
         MODE_STATIC_RANK: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_STATIC_RANK: 2>
-        __members__: typing.ClassVar[dict[str, AdapterConfig.Mode]]  # value = {'MODE_AUTO': <Mode.MODE_AUTO: 0>, 'MODE_DYNAMIC': <Mode.MODE_DYNAMIC: 1>, 'MODE_STATIC_RANK': <Mode.MODE_STATIC_RANK: 2>, 'MODE_STATIC': <Mode.MODE_STATIC: 3>, 'MODE_FUSE': <Mode.MODE_FUSE: 4>}
+        __members__: typing.ClassVar[dict[str, AdapterConfig.Mode]]  # value = {'MODE_AUTO': <Mode.MODE_AUTO: 0>, 'MODE_DYNAMIC': <Mode.MODE_DYNAMIC: 1>, 'MODE_STATIC_RANK': <Mode.MODE_STATIC_RANK: 2>, 'MODE_STATIC': <Mode.MODE_STATIC: 3>, 'MODE_FUSE': <Mode.MODE_FUSE: 4>, 'MODE_POOL': <Mode.MODE_POOL: 5>}
         def __eq__(self, other: typing.Any) -> bool:
             ...
         def __getstate__(self) -> int:
@@ -112,6 +117,22 @@ class AdapterConfig:
         ...
     def set_alpha(self, adapter: Adapter, alpha: typing.SupportsFloat) -> AdapterConfig:
         ...
+    @property
+    def cache_size(self) -> int:
+        """
+        Size in bytes of the host memory cache of the LoRA state tensors prepared for the recently used adapters, 0 disables the cache.
+        """
+    @cache_size.setter
+    def cache_size(self, arg1: typing.SupportsInt) -> None:
+        ...
+    @property
+    def max_rank(self) -> int:
+        """
+        Maximum total rank of the adapters applied to a layer in MODE_STATIC_RANK. The static rank is rounded up to a power of 2, not less than 8, and the adapters of a lower rank are padded with zeros.
+        """
+    @max_rank.setter
+    def max_rank(self, arg1: typing.SupportsInt) -> None:
+        ...
 class AggregationMode:
     """
     Represents the mode of per-token score aggregation when determining least important tokens for eviction from cache
@@ -153,6 +174,51 @@ class AggregationMode:
     @property
     def value(self) -> int:
         ...
+class AsyncEngineLoop:
+    """
+    
+        Runs the engine loop of ContinuousBatchingPipeline for an asyncio event loop. The engine loop thread takes GIL
+        once per step to pass the new tokens of all the requests to the event loop, where they are dispatched to the
+        streams of the requests. Has to be created, used and stopped on the thread of the running event loop, and stopped
+        before the pipeline is released.
+    
+        Example:
+            engine_loop = AsyncEngineLoop(pipe)
+            stream = engine_loop.add_request(0, prompt, generation_config)
+            async for token_ids in stream:
+                ...
+            engine_loop.stop()
+    """
+    def __init__(self, pipeline: ContinuousBatchingPipeline, config: EngineLoopConfig = ...) -> None:
+        ...
+    @typing.overload
+    def add_request(self, request_id: typing.SupportsInt, input_ids: openvino._pyopenvino.Tensor, generation_config: GenerationConfig) -> AsyncGenerationStream:
+        ...
+    @typing.overload
+    def add_request(self, request_id: typing.SupportsInt, prompt: str, generation_config: GenerationConfig) -> AsyncGenerationStream:
+        ...
+    def stop(self) -> None:
+        """
+        Stops the engine loop after the current step, the streams of the non finished requests aren't resumed then. Rethrows the exception thrown by a step of the engine loop, if any.
+        """
+class AsyncGenerationStream:
+    """
+    
+        Asynchronous iterator over the tokens of a request of AsyncEngineLoop, each iteration yields the list of all the
+        tokens generated since the previous one. The iteration ends once the request has finished.
+    """
+    def __aiter__(self) -> typing.Any:
+        ...
+    def __anext__(self) -> typing.Any:
+        ...
+    def cancel(self) -> None:
+        ...
+    def get_request_metrics(self) -> RequestMetrics:
+        ...
+    def get_status(self) -> GenerationStatus:
+        ...
+    def stop(self) -> None:
+        ...
 class AutoencoderKL:
     """
     AutoencoderKL class.
@@ -239,6 +305,14 @@ class AutoencoderKL:
         """
     def decode(self, latent: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
         ...
+    def disable_tiling(self) -> AutoencoderKL:
+        ...
+    def enable_tiling(self, tile_sample_size: typing.SupportsInt = 0) -> AutoencoderKL:
+        """
+                    Enables tiled decoding and encoding: the images, which are larger than the tile, are processed by overlapping tiles,
+                    which are blended, so the peak memory is bounded by the tile size.
+                    tile_sample_size (int): tile size in pixels, 0 selects it from the memory of the GPU device or uses 512 for other devices.
+        """
     def encode(self, image: openvino._pyopenvino.Tensor, generator: Generator) -> openvino._pyopenvino.Tensor:
         ...
     def get_config(self) -> AutoencoderKL.Config:
@@ -413,6 +487,22 @@ class ContinuousBatchingPipeline:
     @typing.overload
     def add_request(self, request_id: typing.SupportsInt, prompt: str, images: collections.abc.Sequence[openvino._pyopenvino.Tensor], generation_config: GenerationConfig) -> GenerationHandle:
         ...
+    @typing.overload
+    def add_request(self, request_id: typing.SupportsInt, input_ids: openvino._pyopenvino.Tensor, generation_config: GenerationConfig, on_completion: collections.abc.Callable[[typing.SupportsInt, GenerationHandle], None]) -> GenerationHandle:
+        ...
+    @typing.overload
+    def add_request(self, request_id: typing.SupportsInt, prompt: str, generation_config: GenerationConfig, on_completion: collections.abc.Callable[[typing.SupportsInt, GenerationHandle], None]) -> GenerationHandle:
+        ...
+    @typing.overload
+    def add_request(self, request_id: typing.SupportsInt, input_ids: openvino._pyopenvino.Tensor, generation_config: GenerationConfig, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None, on_completion: collections.abc.Callable[[typing.SupportsInt, GenerationHandle], None]) -> GenerationHandle:
+        ...
+    @typing.overload
+    def add_request(self, request_id: typing.SupportsInt, prompt: str, generation_config: GenerationConfig, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None, on_completion: collections.abc.Callable[[typing.SupportsInt, GenerationHandle], None]) -> GenerationHandle:
+        ...
+    def export_kv_blocks(self, input_ids: openvino._pyopenvino.Tensor) -> bytes:
+        """
+        Exports the KV cache blocks of the processed prompt, to be imported by another pipeline with import_kv_blocks.
+        """
     def finish_chat(self) -> None:
         ...
     @typing.overload
@@ -427,18 +517,53 @@ class ContinuousBatchingPipeline:
     @typing.overload
     def generate(self, prompts: collections.abc.Sequence[str], images: collections.abc.Sequence[collections.abc.Sequence[openvino._pyopenvino.Tensor]], generation_config: collections.abc.Sequence[GenerationConfig], streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None) -> list[GenerationResult]:
         ...
+    @typing.overload
+    def generate(self, prompts: collections.abc.Sequence[str], images: collections.abc.Sequence[collections.abc.Sequence[openvino._pyopenvino.Tensor]], videos: collections.abc.Sequence[collections.abc.Sequence[openvino._pyopenvino.Tensor]], generation_config: collections.abc.Sequence[GenerationConfig], streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None) -> list[GenerationResult]:
+        ...
     def get_config(self) -> GenerationConfig:
         ...
     def get_metrics(self) -> PipelineMetrics:
         ...
+    def get_memory_report(self) -> MemoryReport:
+        ...
+    def get_prefix_cache_digest(self) -> PrefixCacheDigest:
+        """
+        Summarizes the KV cache blocks kept by prefix caching, e.g. to be published to a router balancing the requests between the replicas.
+        """
+    def get_serving_metrics(self) -> ServingMetrics:
+        ...
     def get_tokenizer(self) -> Tokenizer:
         ...
     def has_non_finished_requests(self) -> bool:
         ...
+    def import_kv_blocks(self, kv_blocks: bytes) -> int:
+        """
+        Imports the KV cache blocks exported by export_kv_blocks into the prefix cache, returns the number of the imported blocks.
+        """
+    def shrink_kv_cache(self) -> int:
+        """
+        Moves the KV cache blocks in use to the beginning of the KV cache and releases the free blocks after them, returns the number of the blocks left.
+        """
     def start_chat(self, system_message: str = '') -> None:
         ...
+    @typing.overload
+    def start_engine_loop(self, config: EngineLoopConfig = ...) -> None:
+        """
+        Starts the background thread, which steps the pipeline while it has non finished requests. stop_engine_loop() has to be called before the pipeline is released.
+        """
+    @typing.overload
+    def start_engine_loop(self, config: EngineLoopConfig, on_step: collections.abc.Callable[[collections.abc.Sequence[EngineStepOutput]], None]) -> None:
+        """
+        Starts the engine loop, which passes the new outputs of the requests added without callbacks to on_step after each step. stop_engine_loop() has to be called before the pipeline is released.
+        """
     def step(self) -> None:
         ...
+    def stop_engine_loop(self) -> None:
+        ...
+    def warmup(self, config: WarmupConfig = ...) -> None:
+        """
+        Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.
+        """
 class CppStdGenerator(Generator):
     """
     This class wraps std::mt19937 pseudo-random generator.
@@ -500,6 +625,7 @@ class EncodedGenerationResult:
         perf_metrics: Performance metrics for each generation result.
         extended_perf_metrics: performance pipeline specifics metrics,
                                applicable for pipelines with implemented extended metrics: SpeculativeDecoding Pipeline.
+        request_metrics: latency breakdown of the request.
     """
     def __init__(self) -> None:
         ...
@@ -524,6 +650,9 @@ class EncodedGenerationResult:
     @property
     def perf_metrics(self) -> PerfMetrics:
         ...
+    @property
+    def request_metrics(self) -> RequestMetrics:
+        ...
 class EncodedResults:
     """
     
@@ -552,6 +681,55 @@ class EncodedResults:
     @property
     def tokens(self) -> list[list[int]]:
         ...
+class EngineLoopConfig:
+    """
+    
+        Limits of the engine loop of ContinuousBatchingPipeline, above which add_request blocks until some of the
+        requests are finished. A single request is always admitted.
+    
+        :param max_num_requests: Max number of non finished requests, 0 means no limit.
+        :type max_num_requests: int
+    
+        :param max_cache_usage: KV cache usage in percent, after which new requests are not admitted.
+        :type max_cache_usage: float
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def max_cache_usage(self) -> float:
+        ...
+    @max_cache_usage.setter
+    def max_cache_usage(self, arg0: typing.SupportsFloat) -> None:
+        ...
+    @property
+    def max_num_requests(self) -> int:
+        ...
+    @max_num_requests.setter
+    def max_num_requests(self, arg0: typing.SupportsInt) -> None:
+        ...
+class EngineStepOutput:
+    """
+    
+        New outputs of a request after a step of the engine loop of ContinuousBatchingPipeline.
+    
+        :param request_id: Id of the request.
+        :type request_id: int
+    
+        :param outputs: Tokens generated by the step by the sequence ids, the scores and the finish reasons are the latest ones.
+        :type outputs: dict[int, GenerationOutput]
+    
+        :param status: Status of the request after the step, the request has finished unless it's RUNNING.
+        :type status: GenerationStatus
+    """
+    @property
+    def outputs(self) -> dict[int, GenerationOutput]:
+        ...
+    @property
+    def request_id(self) -> int:
+        ...
+    @property
+    def status(self) -> GenerationStatus:
+        ...
 class ExtendedPerfMetrics:
     """
     
@@ -576,6 +754,9 @@ class ExtendedPerfMetrics:
         :param get_load_time: Returns the load time in milliseconds.
         :type get_load_time: float
     
+        :param get_model_load_times: Returns a map with the load time of each model of the pipeline in milliseconds.
+        :type get_model_load_times: dict[str, float]
+    
         :param get_num_generated_tokens: Returns the number of generated tokens.
         :type get_num_generated_tokens: int
     
@@ -625,6 +806,8 @@ class ExtendedPerfMetrics:
         ...
     def get_load_time(self) -> float:
         ...
+    def get_model_load_times(self) -> dict[str, float]:
+        ...
     def get_num_generated_tokens(self) -> int:
         ...
     def get_num_input_tokens(self) -> int:
@@ -718,6 +901,7 @@ class GenerationConfig:
         logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                         Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
         apply_chat_template: whether to apply chat_template for non-chat scenarios
+        token_healing: if set to true, the last prompt token is removed and the first generated token has to start with its text.
     
         repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
         presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -744,6 +928,13 @@ class GenerationConfig:
         top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
         do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
         num_return_sequences: the number of sequences to generate from a single prompt.
+        best_of:            the number of sequences to sample from a single prompt, of which num_return_sequences with the highest cumulative log probability are returned. 0 means num_return_sequences.
+
+        Scheduling parameters (used by ContinuousBatchingPipeline depending on SchedulerConfig.scheduling_policy):
+        priority:           priority of the request for SchedulingPolicy.PRIORITY. Requests with higher priority are scheduled first and preempted last.
+        ttft_slo_ms:        time-to-first-token objective of the request in milliseconds for SchedulingPolicy.DEADLINE. 0 means no objective.
+        tenant_id:          identifier of the tenant the request belongs to for SchedulingPolicy.FAIR_SHARE.
+        deadline_ms:        time in milliseconds since the request is added to ContinuousBatchingPipeline, after which the request is cancelled and its KV cache is released. 0 means no deadline.
     """
     adapters: openvino_genai.py_openvino_genai.AdapterConfig | None
     apply_chat_template: bool
@@ -753,6 +944,8 @@ class GenerationConfig:
     include_stop_str_in_output: bool
     stop_criteria: StopCriteria
     structured_output_config: openvino_genai.py_openvino_genai.StructuredOutputConfig | None
+    tenant_id: str
+    token_healing: bool
     @typing.overload
     def __init__(self, json_path: os.PathLike | str | bytes) -> None:
         """
@@ -784,6 +977,18 @@ class GenerationConfig:
     def assistant_confidence_threshold(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def best_of(self) -> int:
+        ...
+    @best_of.setter
+    def best_of(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def deadline_ms(self) -> int:
+        ...
+    @deadline_ms.setter
+    def deadline_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def diversity_penalty(self) -> float:
         ...
     @diversity_penalty.setter
@@ -874,6 +1079,12 @@ class GenerationConfig:
     def presence_penalty(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def priority(self) -> int:
+        ...
+    @priority.setter
+    def priority(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def repetition_penalty(self) -> float:
         ...
     @repetition_penalty.setter
@@ -915,6 +1126,12 @@ class GenerationConfig:
     @top_p.setter
     def top_p(self, arg0: typing.SupportsFloat) -> None:
         ...
+    @property
+    def ttft_slo_ms(self) -> int:
+        ...
+    @ttft_slo_ms.setter
+    def ttft_slo_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
 class GenerationFinishReason:
     """
     Members:
@@ -962,6 +1179,8 @@ class GenerationHandle:
         ...
     def drop(self) -> None:
         ...
+    def get_request_metrics(self) -> RequestMetrics:
+        ...
     def get_status(self) -> GenerationStatus:
         ...
     def read(self) -> dict[int, GenerationOutput]:
@@ -1010,6 +1229,7 @@ class GenerationResult:
         perf_metrics: Performance metrics for each generation result.
         extended_perf_metrics: performance pipeline specifics metrics,
                                applicable for pipelines with implemented extended metrics: SpeculativeDecoding Pipeline.
+        request_metrics: latency breakdown of the request.
     """
     m_status: GenerationStatus
     def __init__(self) -> None:
@@ -1039,6 +1259,9 @@ class GenerationResult:
     @property
     def perf_metrics(self) -> PerfMetrics:
         ...
+    @property
+    def request_metrics(self) -> RequestMetrics:
+        ...
 class GenerationStatus:
     """
     Members:
@@ -1091,6 +1314,47 @@ class Generator:
     """
     def __init__(self) -> None:
         ...
+class HistogramSnapshot:
+    """
+    
+        Snapshot of a latency or ratio histogram of the serving metrics.
+    
+        :param count: Number of the recorded values.
+        :type count: int
+    
+        :param sum: Sum of the recorded values.
+        :type sum: float
+    
+        :param min: Min recorded value.
+        :type min: float
+    
+        :param max: Max recorded value.
+        :type max: float
+    
+        :param buckets: Non empty buckets as pairs of the upper bound of the bucket and the number of the values in it.
+        :type buckets: list[tuple[float, int]]
+    """
+    def __init__(self) -> None:
+        ...
+    def get_mean(self) -> float:
+        ...
+    def get_percentile(self, percent: typing.SupportsFloat) -> float:
+        ...
+    @property
+    def buckets(self) -> list[tuple[float, int]]:
+        ...
+    @property
+    def count(self) -> int:
+        ...
+    @property
+    def max(self) -> float:
+        ...
+    @property
+    def min(self) -> float:
+        ...
+    @property
+    def sum(self) -> float:
+        ...
 class Image2ImagePipeline:
     """
     This class is used for generation with image-to-image models.
@@ -1175,7 +1439,9 @@ class Image2ImagePipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            feature_reuse_interval: int - number of steps between the inferences of the deep UNet blocks (DeepCache), 1 disables feature reuse,
+            mask_crop_padding: int - inpainting denoises only the bounding box of the mask padded by this number of pixels, -1 denoises the whole image
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
@@ -1208,6 +1474,12 @@ class ImageGenerationConfig:
     def validate(self) -> None:
         ...
     @property
+    def feature_reuse_interval(self) -> int:
+        ...
+    @feature_reuse_interval.setter
+    def feature_reuse_interval(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def guidance_scale(self) -> float:
         ...
     @guidance_scale.setter
@@ -1220,6 +1492,12 @@ class ImageGenerationConfig:
     def height(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def mask_crop_padding(self) -> int:
+        ...
+    @mask_crop_padding.setter
+    def mask_crop_padding(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def max_sequence_length(self) -> int:
         ...
     @max_sequence_length.setter
@@ -1255,6 +1533,20 @@ class ImageGenerationConfig:
     @width.setter
     def width(self, arg0: typing.SupportsInt) -> None:
         ...
+class ImageGenerationHandle:
+    """
+    Handle of a request added by Text2ImagePipeline.add_request().
+    """
+    def cancel(self) -> None:
+        ...
+    def get_image(self) -> openvino._pyopenvino.Tensor:
+        ...
+    def get_status(self) -> GenerationStatus:
+        ...
+    def wait(self) -> None:
+        """
+        Blocks until the request is finished or cancelled.
+        """
 class ImageGenerationPerfMetrics:
     """
     
@@ -1287,6 +1579,9 @@ class ImageGenerationPerfMetrics:
         :param get_load_time: Returns the load time in milliseconds.
         :type get_load_time: float
     
+        :param get_model_load_times: Returns a map with the load time of each model in milliseconds.
+        :type get_model_load_times: dict[str, float]
+    
         :param get_generate_duration: Returns the generate duration in milliseconds.
         :type get_generate_duration: float
     
@@ -1330,6 +1625,8 @@ class ImageGenerationPerfMetrics:
         ...
     def get_load_time(self) -> float:
         ...
+    def get_model_load_times(self) -> dict[str, float]:
+        ...
     def get_text_encoder_infer_duration(self) -> dict[str, float]:
         ...
     def get_transformer_infer_duration(self) -> MeanStdPair:
@@ -1430,7 +1727,9 @@ class InpaintingPipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            feature_reuse_interval: int - number of steps between the inferences of the deep UNet blocks (DeepCache), 1 disables feature reuse,
+            mask_crop_padding: int - inpainting denoises only the bounding box of the mask padded by this number of pixels, -1 denoises the whole image
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
@@ -1445,106 +1744,291 @@ class InpaintingPipeline:
         ...
     def set_scheduler(self, scheduler: Scheduler) -> None:
         ...
-class LLMPipeline:
+class JsonEvent:
     """
-    This class is used for generation with LLMs
+    
+    JSON event emitted by JsonStreamer.
+    
+    type: JsonEventType of the event.
+    path: JSON Pointer (RFC 6901) of the value the event belongs to, e.g. "/tool_calls/0/name", empty for the root value.
+    value: STRING_CHUNK: the characters decoded since the previous chunk of the string, the chunks add up to the string.
+           VALUE: the decoded text for strings, the JSON text for numbers, booleans and null.
+    is_string: whether the value is a string, True for STRING_CHUNK.
     """
-    def __call__(self, inputs: openvino._pyopenvino.Tensor | openvino_genai.py_openvino_genai.TokenizedInputs | str | collections.abc.Sequence[str], generation_config: openvino_genai.py_openvino_genai.GenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> openvino_genai.py_openvino_genai.EncodedResults | openvino_genai.py_openvino_genai.DecodedResults:
-        """
-            Generates sequences or tokens for LLMs. If input is a string or list of strings then resulting sequences will be already detokenized.
-        
-            :param inputs: inputs in the form of string, list of strings or tokenized input_ids
-            :type inputs: str, list[str], ov.genai.TokenizedInputs, or ov.Tensor
-        
-            :param generation_config: generation_config
-            :type generation_config: GenerationConfig or a dict
-        
-            :param streamer: streamer either as a lambda with a boolean returning flag whether generation should be stopped
-            :type : Callable[[str], bool], ov.genai.StreamerBase
-        
-            :param kwargs: arbitrary keyword arguments with keys corresponding to GenerationConfig fields.
-            :type : dict
-        
-            :return: return results in encoded, or decoded form depending on inputs type
-            :rtype: DecodedResults, EncodedResults, str
-         
-         
-            Structure to keep generation config parameters. For a selected method of decoding, only parameters from that group
-            and generic parameters are used. For example, if do_sample is set to true, then only generic parameters and random sampling parameters will
-            be used while greedy and beam search parameters will not affect decoding at all.
-        
-            Parameters:
-            max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
-                           max_new_tokens. Its effect is overridden by `max_new_tokens`, if also set.
-            max_new_tokens: the maximum numbers of tokens to generate, excluding the number of tokens in the prompt. max_new_tokens has priority over max_length.
-            min_new_tokens: set 0 probability for eos_token_id for the first eos_token_id generated tokens.
-            ignore_eos:    if set to true, then generation will not stop even if <eos> token is met.
-            eos_token_id:  token_id of <eos> (end of sentence)
-            stop_strings: a set of strings that will cause pipeline to stop generating further tokens.
-            include_stop_str_in_output: if set to true stop string that matched generation will be included in generation output (default: false)
-            stop_token_ids: a set of tokens that will cause pipeline to stop generating further tokens.
-            echo:           if set to true, the model will echo the prompt in the output.
-            logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
-                            Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
-            apply_chat_template: whether to apply chat_template for non-chat scenarios
-        
-            repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
-            presence_penalty: reduces absolute log prob if the token was generated at least once.
-            frequency_penalty: reduces absolute log prob as many times as the token was generated.
-        
-            Beam search specific parameters:
-            num_beams:         number of beams for beam search. 1 disables beam search.
-            num_beam_groups:   number of groups to divide `num_beams` into in order to ensure diversity among different groups of beams.
-            diversity_penalty: value is subtracted from a beam's score if it generates the same token as any beam from other group at a particular time.
-            length_penalty:    exponential penalty to the length that is used with beam-based generation. It is applied as an exponent to
-                the sequence length, which in turn is used to divide the score of the sequence. Since the score is the log
-                likelihood of the sequence (i.e. negative), length_penalty > 0.0 promotes longer sequences, while
-                length_penalty < 0.0 encourages shorter sequences.
-            num_return_sequences: the number of sequences to return for grouped beam search decoding.
-            no_repeat_ngram_size: if set to int > 0, all ngrams of that size can only occur once.
-            stop_criteria:        controls the stopping condition for grouped beam search. It accepts the following values:
-                "openvino_genai.StopCriteria.EARLY", where the generation stops as soon as there are `num_beams` complete candidates;
-                "openvino_genai.StopCriteria.HEURISTIC" is applied and the generation stops when is it very unlikely to find better candidates;
-                "openvino_genai.StopCriteria.NEVER", where the beam search procedure only stops when there cannot be better candidates (canonical beam search algorithm).
-        
-            Random sampling parameters:
-            temperature:        the value used to modulate token probabilities for random sampling.
-            top_p:              if set to float < 1, only the smallest set of most probable tokens with probabilities that add up to top_p or higher are kept for generation.
-            top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
-            do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
-            num_return_sequences: the number of sequences to generate from a single prompt.
-        """
-    @typing.overload
-    def __init__(self, models_path: os.PathLike | str | bytes, tokenizer: Tokenizer, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
-        """
-                    LLMPipeline class constructor for manually created openvino_genai.Tokenizer.
-                    models_path (os.PathLike): Path to the model file.
-                    tokenizer (openvino_genai.Tokenizer): tokenizer object.
-                    device (str): Device to run the model on (e.g., CPU, GPU). Default is 'CPU'.
-                    Add {"scheduler_config": ov_genai.SchedulerConfig} to config properties to create continuous batching pipeline.
-                    kwargs: Device properties.
-        """
-    @typing.overload
-    def __init__(self, models_path: os.PathLike | str | bytes, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
-        """
-                    LLMPipeline class constructor.
-                    models_path (os.PathLike): Path to the model file.
-                    device (str): Device to run the model on (e.g., CPU, GPU). Default is 'CPU'.
-                    Add {"scheduler_config": ov_genai.SchedulerConfig} to config properties to create continuous batching pipeline.
-                    kwargs: Device properties.
-        """
-    @typing.overload
-    def __init__(self, model: str, weights: openvino._pyopenvino.Tensor, tokenizer: Tokenizer, device: str, generation_config: openvino_genai.py_openvino_genai.GenerationConfig | None = None, **kwargs) -> None:
-        """
-                    LLMPipeline class constructor.
-                    model (str): Pre-read model.
-                    weights (ov.Tensor): Pre-read model weights.
-                    tokenizer (str): Genai Tokenizers.
-                    device (str): Device to run the model on (e.g., CPU, GPU).
-                    generation_config {ov_genai.GenerationConfig} Genai GenerationConfig. Default is an empty config.
-                    kwargs: Device properties.
-        """
-    def finish_chat(self) -> None:
+    @property
+    def is_string(self) -> bool:
+        ...
+    @property
+    def path(self) -> str:
+        ...
+    @property
+    def type(self) -> JsonEventType:
+        ...
+    @property
+    def value(self) -> str:
+        ...
+class JsonEventType:
+    """
+    Members:
+    
+      OBJECT_START
+    
+      OBJECT_END
+    
+      ARRAY_START
+    
+      ARRAY_END
+    
+      STRING_CHUNK
+    
+      VALUE
+    """
+    ARRAY_END: typing.ClassVar[JsonEventType]  # value = <JsonEventType.ARRAY_END: 3>
+    ARRAY_START: typing.ClassVar[JsonEventType]  # value = <JsonEventType.ARRAY_START: 2>
+    OBJECT_END: typing.ClassVar[JsonEventType]  # value = <JsonEventType.OBJECT_END: 1>
+    OBJECT_START: typing.ClassVar[JsonEventType]  # value = <JsonEventType.OBJECT_START: 0>
+    STRING_CHUNK: typing.ClassVar[JsonEventType]  # value = <JsonEventType.STRING_CHUNK: 4>
+    VALUE: typing.ClassVar[JsonEventType]  # value = <JsonEventType.VALUE: 5>
+    __members__: typing.ClassVar[dict[str, JsonEventType]]  # value = {'OBJECT_START': <JsonEventType.OBJECT_START: 0>, 'OBJECT_END': <JsonEventType.OBJECT_END: 1>, 'ARRAY_START': <JsonEventType.ARRAY_START: 2>, 'ARRAY_END': <JsonEventType.ARRAY_END: 3>, 'STRING_CHUNK': <JsonEventType.STRING_CHUNK: 4>, 'VALUE': <JsonEventType.VALUE: 5>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class JsonStreamer(StreamerBase):
+    """
+    
+    JsonStreamer decodes tokens into text as TextStreamer does and parses it into JSON events as the tokens arrive,
+    so that the fields of the generated JSON, e.g. the name of a tool call, can be used before the generation completes.
+    Meant for the generation constrained to JSON by GenerationConfig.structured_output_config. Raises if the text isn't JSON.
+    
+    tokenizer: Tokenizer object to decode tokens into text.
+    callback: User-defined callback function to process the JsonEvent-s, callback should return either boolean flag or StreamingStatus.
+    
+    """
+    def __init__(self, tokenizer: Tokenizer, callback: collections.abc.Callable[[JsonEvent], bool | openvino_genai.py_openvino_genai.StreamingStatus]) -> None:
+        ...
+    def end(self) -> None:
+        ...
+    def write(self, token: typing.SupportsInt | collections.abc.Sequence[typing.SupportsInt]) -> StreamingStatus:
+        ...
+class KVCachePrecisionConfig:
+    """
+    
+        Configuration struct for the mixed precision KV cache.
+        :param key_precisions: Precisions of the key cache of the decoder layers by the layer index. The layers past the end of the
+          list and the ones set to openvino.Type.dynamic keep the precision chosen by the plugin, e.g. by KV_CACHE_PRECISION.
+        :type key_precisions: list[openvino.Type]
+    
+        :param value_precisions: Precisions of the value cache of the decoder layers by the layer index, same as key_precisions.
+        :type value_precisions: list[openvino.Type]
+    
+        :param key_quantization_mode: Grouping of the quantized key cache values.
+        :type key_quantization_mode: openvino_genai.KVCacheQuantizationMode
+    
+        :param key_group_size: Number of the quantized key cache values sharing a scale and a zero point, 0 keeps the default of the plugin.
+        :type key_group_size: int
+    
+        :param value_group_size: Number of the quantized value cache values of a token sharing a scale and a zero point, 0 keeps the default of the plugin.
+        :type value_group_size: int
+    """
+    key_quantization_mode: KVCacheQuantizationMode
+    def __init__(self) -> None:
+        ...
+    @property
+    def key_group_size(self) -> int:
+        ...
+    @key_group_size.setter
+    def key_group_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def key_precisions(self) -> list[openvino._pyopenvino.Type]:
+        ...
+    @key_precisions.setter
+    def key_precisions(self, arg0: collections.abc.Sequence[openvino._pyopenvino.Type]) -> None:
+        ...
+    @property
+    def value_group_size(self) -> int:
+        ...
+    @value_group_size.setter
+    def value_group_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def value_precisions(self) -> list[openvino._pyopenvino.Type]:
+        ...
+    @value_precisions.setter
+    def value_precisions(self, arg0: collections.abc.Sequence[openvino._pyopenvino.Type]) -> None:
+        ...
+class KVCacheQuantizationMode:
+    """
+    Represents the grouping of the quantized key cache values sharing a scale and a zero point
+                                   :param KVCacheQuantizationMode.BY_TOKEN: The values of a token are grouped along the head size
+                                   :param KVCacheQuantizationMode.BY_CHANNEL: The values of a channel are grouped along the tokens, which keeps the outlier channels of the keys from spoiling the quantization of the other channels of the token
+    
+    Members:
+    
+      BY_TOKEN
+    
+      BY_CHANNEL
+    """
+    BY_CHANNEL: typing.ClassVar[KVCacheQuantizationMode]  # value = <KVCacheQuantizationMode.BY_CHANNEL: 1>
+    BY_TOKEN: typing.ClassVar[KVCacheQuantizationMode]  # value = <KVCacheQuantizationMode.BY_TOKEN: 0>
+    __members__: typing.ClassVar[dict[str, KVCacheQuantizationMode]]  # value = {'BY_TOKEN': <KVCacheQuantizationMode.BY_TOKEN: 0>, 'BY_CHANNEL': <KVCacheQuantizationMode.BY_CHANNEL: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class LLMPipeline:
+    """
+    This class is used for generation with LLMs
+    """
+    def __call__(self, inputs: openvino._pyopenvino.Tensor | openvino_genai.py_openvino_genai.TokenizedInputs | str | collections.abc.Sequence[str], generation_config: openvino_genai.py_openvino_genai.GenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> openvino_genai.py_openvino_genai.EncodedResults | openvino_genai.py_openvino_genai.DecodedResults:
+        """
+            Generates sequences or tokens for LLMs. If input is a string or list of strings then resulting sequences will be already detokenized.
+        
+            :param inputs: inputs in the form of string, list of strings or tokenized input_ids
+            :type inputs: str, list[str], ov.genai.TokenizedInputs, or ov.Tensor
+        
+            :param generation_config: generation_config
+            :type generation_config: GenerationConfig or a dict
+        
+            :param streamer: streamer either as a lambda with a boolean returning flag whether generation should be stopped
+            :type : Callable[[str], bool], ov.genai.StreamerBase
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to GenerationConfig fields.
+            :type : dict
+        
+            :return: return results in encoded, or decoded form depending on inputs type
+            :rtype: DecodedResults, EncodedResults, str
+         
+         
+            Structure to keep generation config parameters. For a selected method of decoding, only parameters from that group
+            and generic parameters are used. For example, if do_sample is set to true, then only generic parameters and random sampling parameters will
+            be used while greedy and beam search parameters will not affect decoding at all.
+        
+            Parameters:
+            max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
+                           max_new_tokens. Its effect is overridden by `max_new_tokens`, if also set.
+            max_new_tokens: the maximum numbers of tokens to generate, excluding the number of tokens in the prompt. max_new_tokens has priority over max_length.
+            min_new_tokens: set 0 probability for eos_token_id for the first eos_token_id generated tokens.
+            ignore_eos:    if set to true, then generation will not stop even if <eos> token is met.
+            eos_token_id:  token_id of <eos> (end of sentence)
+            stop_strings: a set of strings that will cause pipeline to stop generating further tokens.
+            include_stop_str_in_output: if set to true stop string that matched generation will be included in generation output (default: false)
+            stop_token_ids: a set of tokens that will cause pipeline to stop generating further tokens.
+            echo:           if set to true, the model will echo the prompt in the output.
+            logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
+                            Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
+            apply_chat_template: whether to apply chat_template for non-chat scenarios
+            token_healing: if set to true, the last prompt token is removed and the first generated token has to start with its text.
+        
+            repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
+            presence_penalty: reduces absolute log prob if the token was generated at least once.
+            frequency_penalty: reduces absolute log prob as many times as the token was generated.
+        
+            Beam search specific parameters:
+            num_beams:         number of beams for beam search. 1 disables beam search.
+            num_beam_groups:   number of groups to divide `num_beams` into in order to ensure diversity among different groups of beams.
+            diversity_penalty: value is subtracted from a beam's score if it generates the same token as any beam from other group at a particular time.
+            length_penalty:    exponential penalty to the length that is used with beam-based generation. It is applied as an exponent to
+                the sequence length, which in turn is used to divide the score of the sequence. Since the score is the log
+                likelihood of the sequence (i.e. negative), length_penalty > 0.0 promotes longer sequences, while
+                length_penalty < 0.0 encourages shorter sequences.
+            num_return_sequences: the number of sequences to return for grouped beam search decoding.
+            no_repeat_ngram_size: if set to int > 0, all ngrams of that size can only occur once.
+            stop_criteria:        controls the stopping condition for grouped beam search. It accepts the following values:
+                "openvino_genai.StopCriteria.EARLY", where the generation stops as soon as there are `num_beams` complete candidates;
+                "openvino_genai.StopCriteria.HEURISTIC" is applied and the generation stops when is it very unlikely to find better candidates;
+                "openvino_genai.StopCriteria.NEVER", where the beam search procedure only stops when there cannot be better candidates (canonical beam search algorithm).
+        
+            Random sampling parameters:
+            temperature:        the value used to modulate token probabilities for random sampling.
+            top_p:              if set to float < 1, only the smallest set of most probable tokens with probabilities that add up to top_p or higher are kept for generation.
+            top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
+            do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
+            num_return_sequences: the number of sequences to generate from a single prompt.
+            best_of:            the number of sequences to sample from a single prompt, of which num_return_sequences with the highest cumulative log probability are returned. 0 means num_return_sequences.
+
+            Scheduling parameters (used by ContinuousBatchingPipeline depending on SchedulerConfig.scheduling_policy):
+            priority:           priority of the request for SchedulingPolicy.PRIORITY. Requests with higher priority are scheduled first and preempted last.
+            ttft_slo_ms:        time-to-first-token objective of the request in milliseconds for SchedulingPolicy.DEADLINE. 0 means no objective.
+            tenant_id:          identifier of the tenant the request belongs to for SchedulingPolicy.FAIR_SHARE.
+            deadline_ms:        time in milliseconds since the request is added to ContinuousBatchingPipeline, after which the request is cancelled and its KV cache is released. 0 means no deadline.
+        """
+    @typing.overload
+    def __init__(self, models_path: os.PathLike | str | bytes, tokenizer: Tokenizer, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
+        """
+                    LLMPipeline class constructor for manually created openvino_genai.Tokenizer.
+                    models_path (os.PathLike): Path to the model file.
+                    tokenizer (openvino_genai.Tokenizer): tokenizer object.
+                    device (str): Device to run the model on (e.g., CPU, GPU). Default is 'CPU'.
+                    Add {"scheduler_config": ov_genai.SchedulerConfig} to config properties to create continuous batching pipeline.
+                    kwargs: Device properties.
+        """
+    @typing.overload
+    def __init__(self, models_path: os.PathLike | str | bytes, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
+        """
+                    LLMPipeline class constructor.
+                    models_path (os.PathLike): Path to the model file.
+                    device (str): Device to run the model on (e.g., CPU, GPU). Default is 'CPU'.
+                    Add {"scheduler_config": ov_genai.SchedulerConfig} to config properties to create continuous batching pipeline.
+                    kwargs: Device properties.
+        """
+    @typing.overload
+    def __init__(self, model: str, weights: openvino._pyopenvino.Tensor, tokenizer: Tokenizer, device: str, generation_config: openvino_genai.py_openvino_genai.GenerationConfig | None = None, **kwargs) -> None:
+        """
+                    LLMPipeline class constructor.
+                    model (str): Pre-read model.
+                    weights (ov.Tensor): Pre-read model weights.
+                    tokenizer (str): Genai Tokenizers.
+                    device (str): Device to run the model on (e.g., CPU, GPU).
+                    generation_config {ov_genai.GenerationConfig} Genai GenerationConfig. Default is an empty config.
+                    kwargs: Device properties.
+        """
+    def finish_chat(self) -> None:
         ...
     def generate(self, inputs: openvino._pyopenvino.Tensor | openvino_genai.py_openvino_genai.TokenizedInputs | str | collections.abc.Sequence[str], generation_config: openvino_genai.py_openvino_genai.GenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> openvino_genai.py_openvino_genai.EncodedResults | openvino_genai.py_openvino_genai.DecodedResults:
         """
@@ -1584,6 +2068,7 @@ class LLMPipeline:
             logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                             Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
             apply_chat_template: whether to apply chat_template for non-chat scenarios
+            token_healing: if set to true, the last prompt token is removed and the first generated token has to start with its text.
         
             repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
             presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -1610,15 +2095,30 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+            best_of:            the number of sequences to sample from a single prompt, of which num_return_sequences with the highest cumulative log probability are returned. 0 means num_return_sequences.
+
+            Scheduling parameters (used by ContinuousBatchingPipeline depending on SchedulerConfig.scheduling_policy):
+            priority:           priority of the request for SchedulingPolicy.PRIORITY. Requests with higher priority are scheduled first and preempted last.
+            ttft_slo_ms:        time-to-first-token objective of the request in milliseconds for SchedulingPolicy.DEADLINE. 0 means no objective.
+            tenant_id:          identifier of the tenant the request belongs to for SchedulingPolicy.FAIR_SHARE.
+            deadline_ms:        time in milliseconds since the request is added to ContinuousBatchingPipeline, after which the request is cancelled and its KV cache is released. 0 means no deadline.
         """
     def get_generation_config(self) -> GenerationConfig:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def resume_chat(self, session_id: str) -> None:
+        ...
     def set_generation_config(self, config: GenerationConfig) -> None:
         ...
     def start_chat(self, system_message: str = '') -> None:
         ...
+    def suspend_chat(self, session_id: str) -> None:
+        ...
+    def warmup(self, config: WarmupConfig = ...) -> None:
+        """
+        Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.
+        """
 class MeanStdPair:
     def __init__(self) -> None:
         ...
@@ -1630,6 +2130,57 @@ class MeanStdPair:
     @property
     def std(self) -> float:
         ...
+class MemoryReport:
+    """
+    
+        Breakdown of the memory taken by the pipeline in bytes as of the previous generation step.
+    
+        :param weights: Size of the constants of the compiled models by the model names, e.g. "language" or "draft_language".
+        :type weights: dict[str, int]
+    
+        :param kv_cache_allocated: Size of the KV cache allocated on the device.
+        :type kv_cache_allocated: int
+    
+        :param kv_cache_used: Size of the KV cache blocks used by the requests, a part of kv_cache_allocated.
+        :type kv_cache_used: int
+    
+        :param prefix_cache: Size of the free KV cache blocks holding the prefixes reusable by prefix caching, a part of kv_cache_allocated.
+        :type prefix_cache: int
+    
+        :param kv_cache_swap_space: Size of the host memory tier of the KV cache swap space.
+        :type kv_cache_swap_space: int
+    
+        :param input_buffers: Size of the host buffers staging the inputs of the models.
+        :type input_buffers: int
+    
+        :param vision_embedding_cache: Size of the cached embeddings of the images.
+        :type vision_embedding_cache: int
+    """
+    def __init__(self) -> None:
+        ...
+    def get_total_bytes(self) -> int:
+        ...
+    @property
+    def input_buffers(self) -> int:
+        ...
+    @property
+    def kv_cache_allocated(self) -> int:
+        ...
+    @property
+    def kv_cache_swap_space(self) -> int:
+        ...
+    @property
+    def kv_cache_used(self) -> int:
+        ...
+    @property
+    def prefix_cache(self) -> int:
+        ...
+    @property
+    def vision_embedding_cache(self) -> int:
+        ...
+    @property
+    def weights(self) -> dict[str, int]:
+        ...
 class PerfMetrics:
     """
     
@@ -1654,6 +2205,9 @@ class PerfMetrics:
         :param get_load_time: Returns the load time in milliseconds.
         :type get_load_time: float
     
+        :param get_model_load_times: Returns a map with the load time of each model of the pipeline in milliseconds.
+        :type get_model_load_times: dict[str, float]
+    
         :param get_num_generated_tokens: Returns the number of generated tokens.
         :type get_num_generated_tokens: int
     
@@ -1707,6 +2261,8 @@ class PerfMetrics:
         ...
     def get_load_time(self) -> float:
         ...
+    def get_model_load_times(self) -> dict[str, float]:
+        ...
     def get_num_generated_tokens(self) -> int:
         ...
     def get_num_input_tokens(self) -> int:
@@ -1734,6 +2290,12 @@ class PipelineMetrics:
         :param scheduled_requests:  Number of requests that were scheduled for processing at the previous step of the pipeline.
         :type scheduled_requests: int
     
+        :param scheduled_prompt_tokens: Number of prompt tokens that were scheduled for processing at the previous step of the pipeline.
+        :type scheduled_prompt_tokens: int
+    
+        :param scheduled_generate_tokens: Number of generation phase tokens that were scheduled for processing at the previous step of the pipeline.
+        :type scheduled_generate_tokens: int
+    
         :param cache_usage: Percentage of KV cache usage in the last generation step.
         :type cache_usage: float
     
@@ -1743,6 +2305,21 @@ class PipelineMetrics:
     
         :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
         :type avg_cache_usage: float
+    
+        :param prefix_cache_hit_rate: Percentage of the prompt tokens of all requests added to the pipeline, for which the KV cache was restored from the prefix cache
+        :type prefix_cache_hit_rate: float
+    
+        :param max_prefix_cache_hit_depth: Max number of prompt tokens restored from the prefix cache for a single request
+        :type max_prefix_cache_hit_depth: int
+    
+        :param peak_kv_cache_used_bytes: Peak size in bytes of the KV cache blocks used by the requests during the lifetime of the pipeline
+        :type peak_kv_cache_used_bytes: int
+    
+        :param peak_kv_cache_allocated_bytes: Peak size in bytes of the allocated KV cache during the lifetime of the pipeline
+        :type peak_kv_cache_allocated_bytes: int
+    
+        :param peak_memory_bytes: Peak of the total memory of the memory report during the lifetime of the pipeline
+        :type peak_memory_bytes: int
     """
     def __init__(self) -> None:
         ...
@@ -1756,19 +2333,96 @@ class PipelineMetrics:
     def max_cache_usage(self) -> float:
         ...
     @property
-    def requests(self) -> int:
+    def max_prefix_cache_hit_depth(self) -> int:
         ...
     @property
-    def scheduled_requests(self) -> int:
+    def peak_kv_cache_allocated_bytes(self) -> int:
         ...
-class RawImageGenerationPerfMetrics:
-    """
-    
-        Structure with raw performance metrics for each generation before any statistics are calculated.
-    
-        :param unet_inference_durations: Durations for each unet inference in microseconds.
-        :type unet_inference_durations: list[float]
-    
+    @property
+    def peak_kv_cache_used_bytes(self) -> int:
+        ...
+    @property
+    def peak_memory_bytes(self) -> int:
+        ...
+    @property
+    def prefix_cache_hit_rate(self) -> float:
+        ...
+    @property
+    def requests(self) -> int:
+        ...
+    @property
+    def scheduled_generate_tokens(self) -> int:
+        ...
+    @property
+    def scheduled_prompt_tokens(self) -> int:
+        ...
+    @property
+    def scheduled_requests(self) -> int:
+        ...
+class PrefixCacheDigest:
+    """
+    
+        Compact summary of the KV cache blocks kept by prefix caching of a pipeline, e.g. for a router to send a request to the replica
+        with the longest cached prefix of its prompt. The hashes of the blocks are kept in a bloom filter, which may report a block
+        not cached with a probability below 0.1%, but never misses a cached one.
+    
+        :param block_size: Number of tokens per KV cache block of the pipeline.
+        :type block_size: int
+    
+        :param num_blocks: Number of the hashes of the KV cache blocks added to the bloom filter.
+        :type num_blocks: int
+    
+        :param bloom_filter: Bits of the bloom filter.
+        :type bloom_filter: list[int]
+    """
+    @staticmethod
+    def get_block_hashes(token_ids: collections.abc.Sequence[typing.SupportsInt], block_size: typing.SupportsInt) -> list[int]:
+        """
+        Computes the hashes of the full KV cache blocks of a prompt the same way as the pipelines with this block size do.
+        """
+    @typing.overload
+    def __init__(self) -> None:
+        ...
+    @typing.overload
+    def __init__(self, block_size: typing.SupportsInt, block_hashes: collections.abc.Sequence[typing.SupportsInt]) -> None:
+        ...
+    def contains(self, block_hash: typing.SupportsInt) -> bool:
+        ...
+    def get_num_cached_blocks(self, block_hashes: collections.abc.Sequence[typing.SupportsInt]) -> int:
+        """
+        Returns the number of the leading blocks of the prompt with the block hashes likely kept by prefix caching.
+        """
+    @property
+    def block_size(self) -> int:
+        ...
+    @property
+    def bloom_filter(self) -> list[int]:
+        ...
+    @property
+    def num_blocks(self) -> int:
+        ...
+class RaggedTokenizedInputs:
+    """
+    Token ids of a batch of prompts without padding.
+    """
+    input_ids: openvino._pyopenvino.Tensor
+    offsets: openvino._pyopenvino.Tensor
+    def __init__(self, input_ids: openvino._pyopenvino.Tensor, offsets: openvino._pyopenvino.Tensor) -> None:
+        ...
+    def get_batch_size(self) -> int:
+        ...
+    def get_input_ids(self, index: typing.SupportsInt) -> openvino._pyopenvino.Tensor:
+        """
+        Returns the token ids of the prompt as a tensor of shape [1, prompt_length] sharing the memory of input_ids.
+        """
+class RawImageGenerationPerfMetrics:
+    """
+    
+        Structure with raw performance metrics for each generation before any statistics are calculated.
+    
+        :param unet_inference_durations: Durations for each unet inference in microseconds.
+        :type unet_inference_durations: list[float]
+    
         :param transformer_inference_durations: Durations for each transformer inference in microseconds.
         :type transformer_inference_durations: list[float]
     
@@ -1853,6 +2507,73 @@ class RawPerfMetrics:
     @property
     def tokenization_durations(self) -> list[float]:
         ...
+class RequestMetrics:
+    """
+    
+        Latency breakdown of a single request, e.g. to find out why the request was slow. Durations are in microseconds.
+    
+        :param queue_time: Time from adding the request to its first scheduling.
+        :type queue_time: float
+    
+        :param ttft: Time from adding the request to its first generated token.
+        :type ttft: float
+    
+        :param prefill_time: Time from the first scheduling of the request to its first generated token.
+        :type prefill_time: float
+    
+        :param total_time: Time from adding the request till it is finished.
+        :type total_time: float
+    
+        :param num_prefill_chunks: Number of steps, in which a part of the prompt was processed.
+        :type num_prefill_chunks: int
+    
+        :param num_preemptions: Number of times the request was preempted.
+        :type num_preemptions: int
+    
+        :param preempted_time: Total time the request waited to be scheduled again after preemptions.
+        :type preempted_time: float
+    
+        :param num_prefix_cache_hit_tokens: Number of prompt tokens restored by prefix caching.
+        :type num_prefix_cache_hit_tokens: int
+    
+        :param num_draft_tokens: Number of the validated candidate tokens of speculative decoding or prompt lookup.
+        :type num_draft_tokens: int
+    
+        :param num_accepted_draft_tokens: Number of the accepted candidate tokens.
+        :type num_accepted_draft_tokens: int
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def num_accepted_draft_tokens(self) -> int:
+        ...
+    @property
+    def num_draft_tokens(self) -> int:
+        ...
+    @property
+    def num_preemptions(self) -> int:
+        ...
+    @property
+    def num_prefill_chunks(self) -> int:
+        ...
+    @property
+    def num_prefix_cache_hit_tokens(self) -> int:
+        ...
+    @property
+    def preempted_time(self) -> float:
+        ...
+    @property
+    def prefill_time(self) -> float:
+        ...
+    @property
+    def queue_time(self) -> float:
+        ...
+    @property
+    def total_time(self) -> float:
+        ...
+    @property
+    def ttft(self) -> float:
+        ...
 class SD3Transformer2DModel:
     """
     SD3Transformer2DModel class.
@@ -1916,8 +2637,18 @@ class SD3Transformer2DModel:
         """
     def get_config(self) -> SD3Transformer2DModel.Config:
         ...
+    @typing.overload
     def infer(self, latent: openvino._pyopenvino.Tensor, timestep: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
         ...
+    @typing.overload
+    def infer(self, latent: openvino._pyopenvino.Tensor, timestep: openvino._pyopenvino.Tensor, guidance_scale: typing.SupportsFloat) -> openvino._pyopenvino.Tensor:
+        """
+                    Infers the model with classifier-free guidance: the latent is repeated for the unconditional and text encoder hidden states
+                    and the noise predictions are combined within the model when possible.
+                    latent (openvino.Tensor): latents with the batch of the images, not repeated for the guidance.
+                    timestep (openvino.Tensor): current timestep.
+                    guidance_scale (float): guidance scale.
+        """
     def reshape(self, batch_size: typing.SupportsInt, height: typing.SupportsInt, width: typing.SupportsInt, tokenizer_model_max_length: typing.SupportsInt) -> SD3Transformer2DModel:
         ...
     def set_hidden_states(self, tensor_name: str, encoder_hidden_states: openvino._pyopenvino.Tensor) -> None:
@@ -2046,8 +2777,30 @@ class SchedulerConfig:
             independent sequences, we consider total amount of tokens in a batch).
         num_kv_blocks:              total number of KV blocks available to scheduler logic.
         cache_size:                 total size of KV cache in GB.
+        kv_cache_memory_utilization: fraction of the total memory of the device that the pipeline may use, with the KV cache
+            taking the rest of it. When non-zero and both num_kv_blocks and cache_size are 0, num_kv_blocks is derived at
+            pipeline initialization from the memory left after inferring a dummy batch of max_num_batched_tokens tokens.
+            Must be in (0, 1] range.
         block_size:                 block size for KV cache.
         dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+        max_num_prefill_tokens_per_step: max number of prompt tokens to be scheduled at a single step, over all sequence groups.
+            Long prompts are processed in chunks of at most this size, interleaved with generation steps of running sequences.
+            Has effect only if dynamic_split_fuse is turned on. 0 means that prompt tokens are limited by max_num_batched_tokens only.
+        max_prefill_fraction:       max fraction of max_num_batched_tokens that prompt tokens can take at a step where some
+            sequences are generating. Must be in (0, 1] range. Has effect only if dynamic_split_fuse is turned on.
+        swap_space_size:            total size of the host memory swap space for KV cache blocks of preempted sequences in GB.
+            When non-zero, sequence groups that would otherwise be fully preempted get their KV cache blocks copied out
+            to host memory and restored on rescheduling instead of being recomputed.
+        swap_space_disk_size:       total size of the on-disk swap space tier in GB, used once the host memory swap space is exhausted.
+        swap_space_path:            path to the file backing the on-disk swap space tier.
+        scheduling_policy:          policy used to order sequence groups for scheduling and for choosing the preemption victims.
+        max_reordering_delay_ms:    max time in milliseconds a sequence group waits for its first scheduling before it is served
+            in order of arrival. Has effect only with SchedulingPolicy.PREFIX_CACHE_AWARE.
+        streaming_transport:        queue by which the outputs of the requests are passed to their GenerationHandle's.
+            SPSC_RING_BUFFER reduces the locking and the wakeups of the readers at high aggregate streaming rates.
+        prompt_lookup_store_size:   max number of n-grams of the outputs of completed requests kept in the store shared by all
+            the requests of prompt lookup decoding, which provides the candidates when the n-gram is not found in the
+            request's own context. 0 means that the store is not used.
     
         vLLM-like settings:
         max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -2057,6 +2810,11 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turned off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished generation its cache is released.
+        prefix_cache_path:          path to the file persisting the prefix cache across pipeline instances, e.g. process restarts.
+            The cached KV-blocks are loaded from the file at pipeline initialization, if it was saved for the same model and
+            KV-cache configuration, and are saved to it when the pipeline is destroyed. Has effect only if enable_prefix_caching is turned on.
+        kv_cache_precision_config:  precisions of the KV-cache of the individual decoder layers and grouping of the quantized values,
+            e.g. as chosen by calibrate_kv_cache_precisions for a memory budget. By default all layers use the precision chosen by the plugin.
         use_cache_eviction:         Whether to use cache eviction during generation.
         cache_eviction_config       Cache eviction configuration struct.
         use_sparse_attention        Whether to use sparse attention during prefill.
@@ -2065,7 +2823,10 @@ class SchedulerConfig:
     cache_eviction_config: CacheEvictionConfig
     dynamic_split_fuse: bool
     enable_prefix_caching: bool
+    kv_cache_precision_config: KVCachePrecisionConfig
+    scheduling_policy: SchedulingPolicy
     sparse_attention_config: SparseAttentionConfig
+    streaming_transport: StreamingTransport
     use_cache_eviction: bool
     use_sparse_attention: bool
     def __init__(self) -> None:
@@ -2077,23 +2838,181 @@ class SchedulerConfig:
     def cache_size(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def kv_cache_memory_utilization(self) -> float:
+        ...
+    @kv_cache_memory_utilization.setter
+    def kv_cache_memory_utilization(self, arg0: typing.SupportsFloat) -> None:
+        ...
+    @property
     def max_num_batched_tokens(self) -> int:
         ...
     @max_num_batched_tokens.setter
     def max_num_batched_tokens(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def max_num_prefill_tokens_per_step(self) -> int:
+        ...
+    @max_num_prefill_tokens_per_step.setter
+    def max_num_prefill_tokens_per_step(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def max_num_seqs(self) -> int:
         ...
     @max_num_seqs.setter
     def max_num_seqs(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def max_prefill_fraction(self) -> float:
+        ...
+    @max_prefill_fraction.setter
+    def max_prefill_fraction(self, arg0: typing.SupportsFloat) -> None:
+        ...
+    @property
+    def max_reordering_delay_ms(self) -> int:
+        ...
+    @max_reordering_delay_ms.setter
+    def max_reordering_delay_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def num_kv_blocks(self) -> int:
         ...
     @num_kv_blocks.setter
     def num_kv_blocks(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def prefix_cache_path(self) -> pathlib.Path:
+        ...
+    @prefix_cache_path.setter
+    def prefix_cache_path(self, arg0: os.PathLike | str | bytes) -> None:
+        ...
+    @property
+    def prompt_lookup_store_size(self) -> int:
+        ...
+    @prompt_lookup_store_size.setter
+    def prompt_lookup_store_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def swap_space_disk_size(self) -> int:
+        ...
+    @swap_space_disk_size.setter
+    def swap_space_disk_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def swap_space_path(self) -> pathlib.Path:
+        ...
+    @swap_space_path.setter
+    def swap_space_path(self, arg0: os.PathLike | str | bytes) -> None:
+        ...
+    @property
+    def swap_space_size(self) -> int:
+        ...
+    @swap_space_size.setter
+    def swap_space_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+class SchedulingPolicy:
+    """
+    Represents the policy by which the scheduler orders the sequence groups competing for the batch and the KV cache
+                                   :param SchedulingPolicy.FCFS: Sequence groups are served in order of arrival
+                                   :param SchedulingPolicy.PRIORITY: Sequence groups with higher GenerationConfig.priority are served first and preempted last
+                                   :param SchedulingPolicy.DEADLINE: Sequence groups waiting for their first token are served in order of their GenerationConfig.ttft_slo_ms deadline
+                                   :param SchedulingPolicy.FAIR_SHARE: Sequence groups of tenants (GenerationConfig.tenant_id) which were served the least tokens so far are served first
+                                   :param SchedulingPolicy.PREFIX_CACHE_AWARE: Sequence groups waiting for their first scheduling with the most prompt tokens restored from the prefix cache are served first, next to the groups sharing their first prompt block
+    
+    Members:
+    
+      FCFS
+    
+      PRIORITY
+    
+      DEADLINE
+    
+      FAIR_SHARE
+    
+      PREFIX_CACHE_AWARE
+    """
+    DEADLINE: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.DEADLINE: 2>
+    FAIR_SHARE: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.FAIR_SHARE: 3>
+    FCFS: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.FCFS: 0>
+    PREFIX_CACHE_AWARE: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.PREFIX_CACHE_AWARE: 4>
+    PRIORITY: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.PRIORITY: 1>
+    __members__: typing.ClassVar[dict[str, SchedulingPolicy]]  # value = {'FCFS': <SchedulingPolicy.FCFS: 0>, 'PRIORITY': <SchedulingPolicy.PRIORITY: 1>, 'DEADLINE': <SchedulingPolicy.DEADLINE: 2>, 'FAIR_SHARE': <SchedulingPolicy.FAIR_SHARE: 3>, 'PREFIX_CACHE_AWARE': <SchedulingPolicy.PREFIX_CACHE_AWARE: 4>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class ServingMetrics:
+    """
+    
+        Contains the distributions of the serving latencies and of the KV cache state over the lifetime of the pipeline.
+    
+        :param ttft: Time to the first token of the requests in microseconds, counted from adding a request.
+        :type ttft: HistogramSnapshot
+    
+        :param inter_token_latency: Time between the generated tokens of the requests in microseconds.
+        :type inter_token_latency: HistogramSnapshot
+    
+        :param queue_time: Time from adding a request to its first scheduling in microseconds.
+        :type queue_time: HistogramSnapshot
+    
+        :param prefix_cache_hit_ratio: Percentage of the prompt tokens of the requests restored from the prefix cache.
+        :type prefix_cache_hit_ratio: HistogramSnapshot
+    
+        :param cache_usage: KV cache usage in percent at the generation steps.
+        :type cache_usage: HistogramSnapshot
+    
+        :param num_preemptions: Number of the preemptions of the KV cache of the requests.
+        :type num_preemptions: int
+    
+        :param num_finished_requests: Number of the finished requests.
+        :type num_finished_requests: int
+    """
+    def __init__(self) -> None:
+        ...
+    def to_prometheus(self, prefix: str = 'ov_genai') -> str:
+        ...
+    @property
+    def cache_usage(self) -> HistogramSnapshot:
+        ...
+    @property
+    def inter_token_latency(self) -> HistogramSnapshot:
+        ...
+    @property
+    def num_finished_requests(self) -> int:
+        ...
+    @property
+    def num_preemptions(self) -> int:
+        ...
+    @property
+    def prefix_cache_hit_ratio(self) -> HistogramSnapshot:
+        ...
+    @property
+    def queue_time(self) -> HistogramSnapshot:
+        ...
+    @property
+    def ttft(self) -> HistogramSnapshot:
+        ...
 class SparseAttentionConfig:
     """
     
@@ -2111,11 +3030,11 @@ class SparseAttentionConfig:
            blocks)
         :type num_last_dense_tokens_in_prefill: int
     
-        :param num_retained_start_tokens_in_cache: TRISHAPE mode only - The number of tokens in the beginning of the cache
+        :param num_retained_start_tokens_in_cache: TRISHAPE mode and sparse decoding - The number of tokens in the beginning of the cache
          (least recent) to be retained when applying sparse attention. Must be a multiple of block size.
         :type num_retained_start_tokens_in_cache: int
     
-        :param num_retained_recent_tokens_in_cache: TRISHAPE mode only - The number of most recent tokens in cache to be retained when
+        :param num_retained_recent_tokens_in_cache: TRISHAPE mode and sparse decoding - The number of most recent tokens in cache to be retained when
           applying sparse attention. Must be a multiple of block size.
         :param num_retained_recent_tokens_in_cache: int
     
@@ -2135,9 +3054,32 @@ class SparseAttentionConfig:
          place.  Directly influences the overhead portion of the importance score computations - if full (dense) attention takes
          M time to be calculated, then the importance score calculation would be taking `M / xattention_stride` time as overhead.
         :type xattention_stride: int
+    
+        :param decode_threshold: Both modes - Cumulative importance score threshold for the block-sparse attention in the generation
+          stage. The importance of each KV cache block between the retained start and recent areas is the sum of the attention
+          scores of its tokens at the last densely computed generation step. Only the most important blocks with the importance
+          sum reaching this fraction of the total are attended to, the rest are skipped. The value of 1 disables sparse decoding.
+          Cannot be used together with cache eviction.
+        :type decode_threshold: float
+    
+        :param decode_dense_interval: Both modes - Every `decode_dense_interval`-th generation step of a sequence is computed with
+          dense attention to refresh the block importance scores for sparse decoding.
+        :type decode_dense_interval: int
     """
     mode: SparseAttentionMode
-    def __init__(self, mode: SparseAttentionMode = ..., num_last_dense_tokens_in_prefill: typing.SupportsInt = 100, num_retained_start_tokens_in_cache: typing.SupportsInt = 128, num_retained_recent_tokens_in_cache: typing.SupportsInt = 1920, xattention_threshold: typing.SupportsFloat = 0.8, xattention_block_size: typing.SupportsInt = 64, xattention_stride: typing.SupportsInt = 8) -> None:
+    def __init__(self, mode: SparseAttentionMode = ..., num_last_dense_tokens_in_prefill: typing.SupportsInt = 100, num_retained_start_tokens_in_cache: typing.SupportsInt = 128, num_retained_recent_tokens_in_cache: typing.SupportsInt = 1920, xattention_threshold: typing.SupportsFloat = 0.8, xattention_block_size: typing.SupportsInt = 64, xattention_stride: typing.SupportsInt = 8, decode_threshold: typing.SupportsFloat = 1.0, decode_dense_interval: typing.SupportsInt = 16) -> None:
+        ...
+    @property
+    def decode_dense_interval(self) -> int:
+        ...
+    @decode_dense_interval.setter
+    def decode_dense_interval(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def decode_threshold(self) -> float:
+        ...
+    @decode_threshold.setter
+    def decode_threshold(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
     def num_last_dense_tokens_in_prefill(self) -> int:
@@ -2390,6 +3332,47 @@ class StreamingStatus:
     @property
     def value(self) -> int:
         ...
+class StreamingTransport:
+    """
+    Represents the queue by which the outputs of a request are passed from the pipeline to its GenerationHandle
+                                   :param StreamingTransport.SYNCHRONIZED_QUEUE: A queue guarded by a mutex, the reader is notified on each push
+                                   :param StreamingTransport.SPSC_RING_BUFFER: A lock-free single-producer single-consumer ring buffer, the reader is notified only while it waits in GenerationHandle.read. The handle of a request must be read by a single thread
+    
+    Members:
+    
+      SYNCHRONIZED_QUEUE
+    
+      SPSC_RING_BUFFER
+    """
+    SPSC_RING_BUFFER: typing.ClassVar[StreamingTransport]  # value = <StreamingTransport.SPSC_RING_BUFFER: 1>
+    SYNCHRONIZED_QUEUE: typing.ClassVar[StreamingTransport]  # value = <StreamingTransport.SYNCHRONIZED_QUEUE: 0>
+    __members__: typing.ClassVar[dict[str, StreamingTransport]]  # value = {'SYNCHRONIZED_QUEUE': <StreamingTransport.SYNCHRONIZED_QUEUE: 0>, 'SPSC_RING_BUFFER': <StreamingTransport.SPSC_RING_BUFFER: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
 class StructuralTagItem:
     """
     
@@ -2659,6 +3642,14 @@ class Text2ImagePipeline:
                         vae_device (str): Device to run vae decoder on.
                         kwargs: Device properties.
         """
+    def add_request(self, prompt: str, **kwargs) -> ImageGenerationHandle:
+        """
+                        Adds a request to the batching engine of the pipeline. The requests are denoised together by step() calls.
+                        prompt (str): Input string.
+                        kwargs: Image generation parameters, 'callback' is called after each denoising step of the request.
+                        :return: Handle to get the status and the images of the request.
+                        :rtype: ImageGenerationHandle
+        """
     def decode(self, latent: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
         ...
     def generate(self, prompt: str, **kwargs) -> openvino._pyopenvino.Tensor:
@@ -2686,21 +3677,42 @@ class Text2ImagePipeline:
             generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
             adapters: LoRA adapters,
             strength: strength for image to image generation. 1.0f means initial image is fully noised,
-            max_sequence_length: int - length of t5_encoder_model input
+            max_sequence_length: int - length of t5_encoder_model input,
+            feature_reuse_interval: int - number of steps between the inferences of the deep UNet blocks (DeepCache), 1 disables feature reuse,
+            mask_crop_padding: int - inpainting denoises only the bounding box of the mask padded by this number of pixels, -1 denoises the whole image
         
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
         """
+    def generate_async(self, prompt: str, **kwargs) -> ImageGenerationHandle:
+        """
+        Input string
+                        Queues a request to the staged executor, which overlaps text encoding, denoising and VAE decoding of the queued requests.
+                        prompt (str): Input string.
+                        kwargs: Image generation parameters, 'callback' is called from the denoising thread after each step.
+                        :return: Handle to wait for the request and get its images.
+                        :rtype: ImageGenerationHandle
+        """
     def get_generation_config(self) -> ImageGenerationConfig:
         ...
     def get_performance_metrics(self) -> ImageGenerationPerfMetrics:
         ...
+    def has_non_finished_requests(self) -> bool:
+        ...
     def reshape(self, num_images_per_prompt: typing.SupportsInt, height: typing.SupportsInt, width: typing.SupportsInt, guidance_scale: typing.SupportsFloat) -> None:
         ...
     def set_generation_config(self, config: ImageGenerationConfig) -> None:
         ...
     def set_scheduler(self, scheduler: Scheduler) -> None:
         ...
+    def step(self) -> None:
+        """
+        Performs a denoising step of the requests added by add_request().
+        """
+    def warmup(self, config: WarmupConfig = ...) -> None:
+        """
+        Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.
+        """
 class Text2SpeechDecodedResults:
     """
     
@@ -2744,7 +3756,9 @@ class Text2SpeechPipeline:
                                      `Matthijs/cmu-arctic-xvectors` dataset is used by default.
             :type speaker_embedding: openvino.Tensor or None
         
-            :param properties: speech generation parameters specified as properties
+            :param properties: speech generation parameters specified as properties. The 'speech_streamer' callback receives
+                               the index of a text and the next chunk of its waveform as soon as it is vocoded, and returns
+                               StreamingStatus or None to continue. The streamed texts are decoded one by one.
             :type properties: dict
         
             :returns: raw audios of the input texts spoken in the specified speaker's voice, with a sample rate of 16 kHz
@@ -2776,7 +3790,9 @@ class Text2SpeechPipeline:
                                      `Matthijs/cmu-arctic-xvectors` dataset is used by default.
             :type speaker_embedding: openvino.Tensor or None
         
-            :param properties: speech generation parameters specified as properties
+            :param properties: speech generation parameters specified as properties. The 'speech_streamer' callback receives
+                               the index of a text and the next chunk of its waveform as soon as it is vocoded, and returns
+                               StreamingStatus or None to continue. The streamed texts are decoded one by one.
             :type properties: dict
         
             :returns: raw audios of the input texts spoken in the specified speaker's voice, with a sample rate of 16 kHz
@@ -2813,17 +3829,42 @@ class TextEmbeddingPipeline:
                 Maximum length of tokens passed to the embedding model.
             pooling_type (TextEmbeddingPipeline.PoolingType, optional):
                 Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
+            embedding_size (int, optional):
+                Number of the first dimensions of the pooled embeddings kept in the results, so Matryoshka models return
+                shorter embeddings. The truncated embeddings are normalized if the normalization is enabled.
+                If not set, all the dimensions are kept.
             normalize (bool, optional):
                 If True, L2 normalization is applied to embeddings. Defaults to True.
+            embedding_precision (TextEmbeddingPipeline.EmbeddingPrecision, optional):
+                Precision of embeddings, the quantization is done by the model. INT8 and UINT8 require the normalization.
+                Defaults to EmbeddingPrecision.F32.
             query_instruction (str, optional):
                 Instruction to use for embedding a query.
             embed_instruction (str, optional):
                 Instruction to use for embedding a document.
+            max_batch_tokens (int, optional):
+                Maximum number of tokens of a batch passed to the embedding model, including the padding. The texts are sorted by
+                length and split into batches, which are inferred by all the infer requests of the compiled model.
+                If not set, all the texts are embedded by a single batch.
+            pack_sequences (bool, optional):
+                If True, several texts are concatenated into a row of the batch instead of padding each text to the longest one.
+                The texts of a row attend to themselves only and are pooled separately. Requires the model with
+                ScaledDotProductAttention operations and the position embeddings. Defaults to False.
+            window_length (int, optional):
+                If set, the texts longer than window_length tokens are split into the overlapping windows of window_length tokens
+                instead of being truncated by max_length. embed_documents() and embed_query() pool the window embeddings of a
+                text by the mean weighted by the number of the new tokens of each window, embed_document_windows() returns the
+                embeddings of the windows. Requires EmbeddingPrecision.F32.
+            window_overlap (int, optional):
+                Number of the tokens shared by the consecutive windows of a text. Defaults to 0.
         """
         embed_instruction: str | None
+        embedding_precision: TextEmbeddingPipeline.EmbeddingPrecision
         normalize: bool
+        pack_sequences: bool
         pooling_type: TextEmbeddingPipeline.PoolingType
         query_instruction: str | None
+        window_overlap: int
         @typing.overload
         def __init__(self) -> None:
             ...
@@ -2831,22 +3872,60 @@ class TextEmbeddingPipeline:
         def __init__(self, **kwargs) -> None:
             ...
         @property
+        def embedding_size(self) -> int | None:
+            ...
+        @embedding_size.setter
+        def embedding_size(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
+        def max_batch_tokens(self) -> int | None:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
         def max_length(self) -> int | None:
             ...
         @max_length.setter
         def max_length(self, arg0: typing.SupportsInt | None) -> None:
             ...
-    class PoolingType:
+        @property
+        def window_length(self) -> int | None:
+            ...
+        @window_length.setter
+        def window_length(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+    class DocumentWindows:
+        """
+        Embeddings of the windows of the documents
+        """
+        @property
+        def document_indices(self) -> list[int]:
+            """
+            Index of the document of each window
+            """
+        @property
+        def embeddings(self) -> numpy.ndarray:
+            """
+            Embeddings of the windows, the windows of a document are consecutive and follow the order of the documents
+            """
+    class EmbeddingPrecision:
         """
         Members:
         
-          CLS : First token embeddings
+          F32 : f32 embeddings
         
-          MEAN : The average of all token embeddings
+          INT8 : int8 embeddings, the normalized values are scaled by 127
+        
+          UINT8 : uint8 embeddings, the normalized values are mapped from [-1, 1] to [0, 255]
+        
+          BINARY : uint8 embeddings of the packed sign bits, the first dimension is the most significant bit
         """
-        CLS: typing.ClassVar[TextEmbeddingPipeline.PoolingType]  # value = <PoolingType.CLS: 0>
-        MEAN: typing.ClassVar[TextEmbeddingPipeline.PoolingType]  # value = <PoolingType.MEAN: 1>
-        __members__: typing.ClassVar[dict[str, TextEmbeddingPipeline.PoolingType]]  # value = {'CLS': <PoolingType.CLS: 0>, 'MEAN': <PoolingType.MEAN: 1>}
+        BINARY: typing.ClassVar[TextEmbeddingPipeline.EmbeddingPrecision]  # value = <EmbeddingPrecision.BINARY: 3>
+        F32: typing.ClassVar[TextEmbeddingPipeline.EmbeddingPrecision]  # value = <EmbeddingPrecision.F32: 0>
+        INT8: typing.ClassVar[TextEmbeddingPipeline.EmbeddingPrecision]  # value = <EmbeddingPrecision.INT8: 1>
+        UINT8: typing.ClassVar[TextEmbeddingPipeline.EmbeddingPrecision]  # value = <EmbeddingPrecision.UINT8: 2>
+        __members__: typing.ClassVar[dict[str, TextEmbeddingPipeline.EmbeddingPrecision]]  # value = {'F32': <EmbeddingPrecision.F32: 0>, 'INT8': <EmbeddingPrecision.INT8: 1>, 'UINT8': <EmbeddingPrecision.UINT8: 2>, 'BINARY': <EmbeddingPrecision.BINARY: 3>}
         def __eq__(self, other: typing.Any) -> bool:
             ...
         def __getstate__(self) -> int:
@@ -2873,7 +3952,44 @@ class TextEmbeddingPipeline:
         @property
         def value(self) -> int:
             ...
-    def __init__(self, models_path: os.PathLike | str | bytes, device: str, config: openvino_genai.py_openvino_genai.TextEmbeddingPipeline.Config | None = None, **kwargs) -> None:
+    class PoolingType:
+        """
+        Members:
+        
+          CLS : First token embeddings
+        
+          MEAN : The average of all token embeddings
+        """
+        CLS: typing.ClassVar[TextEmbeddingPipeline.PoolingType]  # value = <PoolingType.CLS: 0>
+        MEAN: typing.ClassVar[TextEmbeddingPipeline.PoolingType]  # value = <PoolingType.MEAN: 1>
+        __members__: typing.ClassVar[dict[str, TextEmbeddingPipeline.PoolingType]]  # value = {'CLS': <PoolingType.CLS: 0>, 'MEAN': <PoolingType.MEAN: 1>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    def __init__(self, models_path: os.PathLike | str | bytes, device: str, config: openvino_genai.py_openvino_genai.TextEmbeddingPipeline.Config | None = None, **kwargs) -> None:
         """
         Constructs a pipeline from xml/bin files, tokenizer and configuration in the same dir
         models_path (os.PathLike): Path to the directory containing model xml/bin files and tokenizer
@@ -2881,11 +3997,23 @@ class TextEmbeddingPipeline:
         config: (TextEmbeddingPipeline.Config): Optional pipeline configuration
         kwargs: Plugin and/or config properties
         """
-    def embed_documents(self, texts: collections.abc.Sequence[str]) -> list[list[float]] | list[list[int]] | list[list[int]]:
+    def embed_document_windows(self, texts: collections.abc.Sequence[str]) -> TextEmbeddingPipeline.DocumentWindows:
+        """
+        Computes embeddings for the windows of a vector of texts, which are split by Config.window_length
+        """
+    @typing.overload
+    def embed_documents(self, texts: collections.abc.Sequence[str]) -> numpy.ndarray:
         """
         Computes embeddings for a vector of texts
         """
-    def embed_query(self, text: str) -> list[float] | list[int] | list[int]:
+    @typing.overload
+    def embed_documents(self, documents: collections.abc.Iterable, embeddings: openvino._pyopenvino.Tensor, chunk_size: typing.SupportsInt = 1024) -> int:
+        """
+        Computes embeddings for the documents pulled from an iterable by chunks and writes them to the rows of a caller provided
+        tensor, which can share the memory of a memory mapped numpy array. No more documents are pulled when the tensor is full.
+        Returns the number of the embedded documents.
+        """
+    def embed_query(self, text: str) -> numpy.ndarray:
         """
         Computes embeddings for a query
         """
@@ -2897,11 +4025,11 @@ class TextEmbeddingPipeline:
         """
         Asynchronously computes embeddings for a query
         """
-    def wait_embed_documents(self) -> list[list[float]] | list[list[int]] | list[list[int]]:
+    def wait_embed_documents(self) -> numpy.ndarray:
         """
         Waits computed embeddings of a vector of texts
         """
-    def wait_embed_query(self) -> list[float] | list[int] | list[int]:
+    def wait_embed_query(self) -> numpy.ndarray:
         """
         Waits computed embeddings for a query
         """
@@ -2918,6 +4046,13 @@ class TextRerankPipeline:
                 Number of documents to return sorted by score.
             max_length (int, optional):
                 Maximum length of tokens passed to the embedding model.
+            max_batch_tokens (int, optional):
+                Maximum number of tokens of a batch passed to the rerank model, including the padding. The query-text pairs are
+                sorted by length and split into batches, which are inferred by all the infer requests of the compiled model.
+                If not set, all the pairs are scored by a single batch.
+            score_cache_size (int, optional):
+                Maximum number of the cached scores of query-text pairs, the least recently used scores are evicted.
+                The cached pairs aren't passed to the rerank model. 0 disables the cache. Defaults to 0.
         """
         @typing.overload
         def __init__(self) -> None:
@@ -2926,12 +4061,24 @@ class TextRerankPipeline:
         def __init__(self, **kwargs) -> None:
             ...
         @property
+        def max_batch_tokens(self) -> int | None:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
         def max_length(self) -> int | None:
             ...
         @max_length.setter
         def max_length(self, arg0: typing.SupportsInt | None) -> None:
             ...
         @property
+        def score_cache_size(self) -> int:
+            ...
+        @score_cache_size.setter
+        def score_cache_size(self, arg0: typing.SupportsInt) -> None:
+            ...
+        @property
         def top_n(self) -> int:
             ...
         @top_n.setter
@@ -2949,6 +4096,13 @@ class TextRerankPipeline:
         """
         Reranks a vector of texts based on the query.
         """
+    def set_prefilter(self, embedding_pipeline: TextEmbeddingPipeline | None, num_candidates: typing.SupportsInt) -> None:
+        """
+        Enables the cascade mode: the texts are prefiltered by the cosine similarity of their embeddings to the embedding of the
+        query, and only 'num_candidates' most similar texts are scored by the rerank model.
+        embedding_pipeline (TextEmbeddingPipeline): Pipeline of a cheap embedding model, None disables the prefiltering
+        num_candidates (int): Number of texts passed to the rerank model, it should not be less than top_n
+        """
     def start_rerank_async(self, query: str, texts: collections.abc.Sequence[str]) -> None:
         """
         Asynchronously reranks a vector of texts based on the query.
@@ -3071,6 +4225,30 @@ class Tokenizer:
         Returns:
          TokenizedInputs object containing input_ids and attention_mask tensors.
         """
+    def encode_parallel(self, prompts: collections.abc.Sequence[str], add_special_tokens: bool = True, pad_to_max_length: bool = False, max_length: typing.SupportsInt | None = None, padding_side: str | None = None) -> list[list[int]]:
+        """
+        Encodes a large list of prompts in parallel: the prompts are sorted by length and split into shards,
+        which are encoded concurrently by the infer requests of the tokenizer, see 'num_tokenizer_infer_requests' property.
+        Args:
+         'prompts' - list of prompts to encode
+         'add_special_tokens' - whether to add special tokens like BOS, EOS, PAD. Default is True.
+         'pad_to_max_length' - whether to pad the sequence to the maximum length. Default is False.
+         'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+         'padding_side' - side to pad the sequence, can be 'left' or 'right'. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+        Returns:
+         list of token ids of each prompt without padding.
+        """
+    def encode_ragged(self, prompts: collections.abc.Sequence[str], add_special_tokens: bool = True, max_length: typing.SupportsInt | None = None) -> RaggedTokenizedInputs:
+        """
+        Encodes a list of prompts without padding: the token ids of all prompts are stored one after another,
+        the token ids of the prompt i are input_ids[0, offsets[i]:offsets[i + 1]].
+        Args:
+         'prompts' - list of prompts to encode
+         'add_special_tokens' - whether to add special tokens like BOS, EOS, PAD. Default is True.
+         'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+        Returns:
+         RaggedTokenizedInputs object containing input_ids and offsets tensors.
+        """
     def get_bos_token(self) -> str:
         ...
     def get_bos_token_id(self) -> int:
@@ -3171,14 +4349,38 @@ class UNet2DConditionModel:
         ...
     def get_config(self) -> UNet2DConditionModel.Config:
         ...
+    @typing.overload
     def infer(self, sample: openvino._pyopenvino.Tensor, timestep: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
         ...
+    @typing.overload
+    def infer(self, sample: openvino._pyopenvino.Tensor, timestep: openvino._pyopenvino.Tensor, guidance_scale: typing.SupportsFloat) -> openvino._pyopenvino.Tensor:
+        """
+                    Infers the model with classifier-free guidance: the sample is repeated for the unconditional and text encoder hidden states
+                    and the noise predictions are combined within the model when possible.
+                    sample (openvino.Tensor): latents with the batch of the images, not repeated for the guidance.
+                    timestep (openvino.Tensor): current timestep.
+                    guidance_scale (float): guidance scale.
+        """
     def reshape(self, batch_size: typing.SupportsInt, height: typing.SupportsInt, width: typing.SupportsInt, tokenizer_model_max_length: typing.SupportsInt) -> UNet2DConditionModel:
         ...
     def set_adapters(self, adapters: openvino_genai.py_openvino_genai.AdapterConfig | None) -> None:
         ...
+    def set_adapters_per_row(self, row_adapters: collections.abc.Sequence[openvino_genai.py_openvino_genai.AdapterConfig]) -> None:
+        """
+                    Applies a separate LoRA adapter config to each row of the batch of the next inference. The adapters must be passed
+                    to compile() with AdapterConfig.Mode.MODE_POOL, the configs may refer to those adapters only.
+                    row_adapters (list[AdapterConfig]): adapter configs of the rows of the model batch, including the rows of classifier-free guidance.
+        """
+    def set_feature_reuse(self, reuse_features: bool) -> None:
+        """
+                    Enables or disables feature reuse for the next infer() calls: only the shallow blocks of the model are inferred,
+                    while the deep features are taken from the last inference with disabled feature reuse.
+                    reuse_features (bool): whether to reuse the deep features.
+        """
     def set_hidden_states(self, tensor_name: str, encoder_hidden_states: openvino._pyopenvino.Tensor) -> None:
         ...
+    def supports_feature_reuse(self) -> bool:
+        ...
 class VLMDecodedResults(DecodedResults):
     """
     
@@ -3325,6 +4527,84 @@ class VLMPipeline:
             :rtype: VLMDecodedResults
         """
     @typing.overload
+    def generate(self, prompt: str, images: collections.abc.Sequence[numpy.ndarray], generation_config: GenerationConfig, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> VLMDecodedResults:
+        """
+            Generates sequences for VLMs.
+        
+            :param prompt: input prompt
+            :type prompt: str
+            The prompt can contain <ov_genai_image_i> with i replaced with
+            an actual zero based index to refer to an image. Reference to
+            images used in previous prompts isn't implemented.
+            A model's native image tag can be used instead of
+            <ov_genai_image_i>. These tags are:
+            InternVL2: <image>\\n
+            llava-1.5-7b-hf: <image>
+            LLaVA-NeXT: <image>
+            MiniCPM-V-2_6: (<image>./</image>)\\n
+            Phi-3-vision: <|image_i|>\\n - the index starts with one
+            Phi-4-multimodal-instruct: <|image_i|>\\n - the index starts with one
+            Qwen2-VL: <|vision_start|><|image_pad|><|vision_end|>
+            Qwen2.5-VL: <|vision_start|><|image_pad|><|vision_end|>
+            gemma-3-4b-it: <start_of_image>
+            If the prompt doesn't contain image tags, but images are
+            provided, the tags are prepended to the prompt.
+        
+            :param images: image or list of images
+            :type images: list[ov.Tensor] or ov.Tensor
+        
+            :param generation_config: generation_config
+            :type generation_config: GenerationConfig or a dict
+        
+            :param streamer: streamer either as a lambda with a boolean returning flag whether generation should be stopped
+            :type : Callable[[str], bool], ov.genai.StreamerBase
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to GenerationConfig fields.
+            :type : dict
+        
+            :return: return results in decoded form
+            :rtype: VLMDecodedResults
+        """
+    @typing.overload
+    def generate(self, prompt: str, images: numpy.ndarray, generation_config: GenerationConfig, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> VLMDecodedResults:
+        """
+            Generates sequences for VLMs.
+        
+            :param prompt: input prompt
+            :type prompt: str
+            The prompt can contain <ov_genai_image_i> with i replaced with
+            an actual zero based index to refer to an image. Reference to
+            images used in previous prompts isn't implemented.
+            A model's native image tag can be used instead of
+            <ov_genai_image_i>. These tags are:
+            InternVL2: <image>\\n
+            llava-1.5-7b-hf: <image>
+            LLaVA-NeXT: <image>
+            MiniCPM-V-2_6: (<image>./</image>)\\n
+            Phi-3-vision: <|image_i|>\\n - the index starts with one
+            Phi-4-multimodal-instruct: <|image_i|>\\n - the index starts with one
+            Qwen2-VL: <|vision_start|><|image_pad|><|vision_end|>
+            Qwen2.5-VL: <|vision_start|><|image_pad|><|vision_end|>
+            gemma-3-4b-it: <start_of_image>
+            If the prompt doesn't contain image tags, but images are
+            provided, the tags are prepended to the prompt.
+        
+            :param images: image or list of images
+            :type images: list[ov.Tensor] or ov.Tensor
+        
+            :param generation_config: generation_config
+            :type generation_config: GenerationConfig or a dict
+        
+            :param streamer: streamer either as a lambda with a boolean returning flag whether generation should be stopped
+            :type : Callable[[str], bool], ov.genai.StreamerBase
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to GenerationConfig fields.
+            :type : dict
+        
+            :return: return results in decoded form
+            :rtype: VLMDecodedResults
+        """
+    @typing.overload
     def generate(self, prompt: str, **kwargs) -> VLMDecodedResults:
         """
             Generates sequences for VLMs.
@@ -3354,6 +4634,7 @@ class VLMPipeline:
             Expected parameters list:
             image: ov.Tensor - input image,
             images: list[ov.Tensor] - input images,
+            videos: list[ov.Tensor] - input videos, uint8 RGB frames with [NHWC] layout each, supported by Qwen2-VL and Qwen2.5-VL,
             generation_config: GenerationConfig,
             streamer: Callable[[str], bool], ov.genai.StreamerBase - streamer either as a lambda with a boolean returning flag whether generation should be stopped
         
@@ -3370,6 +4651,10 @@ class VLMPipeline:
         ...
     def start_chat(self, system_message: str = '') -> None:
         ...
+    def warmup(self, config: WarmupConfig = ...) -> None:
+        """
+        Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.
+        """
 class VLMRawPerfMetrics:
     """
     
@@ -3377,119 +4662,337 @@ class VLMRawPerfMetrics:
     
         :param prepare_embeddings_durations: Durations of embeddings preparation.
         :type prepare_embeddings_durations: list[MicroSeconds]
-    """
-    def __init__(self) -> None:
-        ...
-    @property
-    def prepare_embeddings_durations(self) -> list[float]:
-        ...
-class WhisperDecodedResultChunk:
-    """
     
-        Structure to store decoded text with corresponding timestamps
+        :param vision_embedding_cache_hits: Number of images, which embeddings are taken from the vision embedding cache.
+        :type vision_embedding_cache_hits: int
     
-        :param start_ts chunk start time in seconds
-        :param end_ts   chunk end time in seconds
-        :param text     chunk text
+        :param vision_embedding_cache_misses: Number of images encoded with the vision embedding cache enabled.
+        :type vision_embedding_cache_misses: int
     """
     def __init__(self) -> None:
         ...
     @property
-    def end_ts(self) -> float:
+    def prepare_embeddings_durations(self) -> list[float]:
         ...
     @property
-    def start_ts(self) -> float:
+    def vision_embedding_cache_hits(self) -> int:
         ...
     @property
-    def text(self) -> str:
+    def vision_embedding_cache_misses(self) -> int:
         ...
-class WhisperDecodedResults:
-    """
-    
-        Structure to store resulting text outputs and scores.
-    
-        Parameters:
-        texts:      vector of resulting sequences.
-        scores:     scores for each sequence.
-        metrics:    performance metrics with tpot, ttft, etc. of type ov::genai::PerfMetrics.
-        shunks:     optional chunks of resulting sequences with timestamps
+class VectorIndex:
     """
-    def __str__(self) -> str:
-        ...
-    @property
-    def chunks(self) -> list[WhisperDecodedResultChunk] | None:
-        ...
-    @property
-    def perf_metrics(self) -> WhisperPerfMetrics:
-        ...
-    @property
-    def scores(self) -> list[float]:
-        ...
-    @property
-    def texts(self) -> list[str]:
-        ...
-class WhisperGenerationConfig(GenerationConfig):
+    In-process approximate nearest neighbor index of embeddings based on HNSW graph. The embeddings get sequential ids in the order they are added, starting from 0.
     """
-    
-        WhisperGenerationConfig
+    class Config:
+        """
         
-        Whisper specific parameters:
-        :param decoder_start_token_id: Corresponds to the ”<|startoftranscript|>” token.
-        :type decoder_start_token_id: int
-    
-        :param pad_token_id: Padding token id.
-        :type pad_token_id: int
-    
-        :param translate_token_id: Translate token id.
-        :type translate_token_id: int
-    
-        :param transcribe_token_id: Transcribe token id.
-        :type transcribe_token_id: int
-    
-        :param no_timestamps_token_id: No timestamps token id.
-        :type no_timestamps_token_id: int
-    
-        :param prev_sot_token_id: Corresponds to the ”<|startofprev|>” token.
-        :type prev_sot_token_id: int
-    
-        :param is_multilingual:
-        :type is_multilingual: bool
-    
-        :param begin_suppress_tokens: A list containing tokens that will be suppressed at the beginning of the sampling process.
-        :type begin_suppress_tokens: list[int]
-    
-        :param suppress_tokens: A list containing the non-speech tokens that will be suppressed during generation.
-        :type suppress_tokens: list[int]
-    
-        :param language: Language token to use for generation in the form of <|en|>.
-                         You can find all the possible language tokens in the generation_config.json lang_to_id dictionary.
-        :type language: Optional[str]
-    
-        :param lang_to_id: Language token to token_id map. Initialized from the generation_config.json lang_to_id dictionary.
-        :type lang_to_id: dict[str, int]
-    
-        :param task: Task to use for generation, either “translate” or “transcribe”
-        :type task: int
-    
-        :param return_timestamps: If `true` the pipeline will return timestamps along the text for *segments* of words in the text.
-                           For instance, if you get
-                           WhisperDecodedResultChunk
-                               start_ts = 0.5
-                               end_ts = 1.5
-                               text = " Hi there!"
-                           then it means the model predicts that the segment "Hi there!" was spoken after `0.5` and before `1.5` seconds.
-                           Note that a segment of text refers to a sequence of one or more words, rather than individual words.
-        :type return_timestamps: bool
-    
-        :param initial_prompt: Initial prompt tokens passed as a previous transcription (after `<|startofprev|>` token) to the first processing
-        window. Can be used to steer the model to use particular spellings or styles.
-    
-        Example:
-          auto result = pipeline.generate(raw_speech);
-          //  He has gone and gone for good answered Paul Icrom who...
-    
-          auto result = pipeline.generate(raw_speech, ov::genai::initial_prompt("Polychrome"));
-          //  He has gone and gone for good answered Polychrome who...
+        Structure to keep VectorIndex configuration parameters.
+        
+        Attributes:
+            metric (VectorIndex.Metric, optional):
+                Distance between the embeddings. Defaults to Metric.COSINE.
+            storage (VectorIndex.Storage, optional):
+                Storage of the embeddings. Defaults to Storage.F32.
+            max_neighbors (int, optional):
+                Maximum number of neighbors of a node on the upper levels of the graph, the bottom level has twice as many.
+                Larger values improve the recall at the cost of memory and the build time. Defaults to 16.
+            ef_construction (int, optional):
+                Number of the candidates considered for the neighbors of an added embedding. Defaults to 200.
+            ef_search (int, optional):
+                Number of the candidates considered by a search, it's increased to the number of the requested results.
+                Defaults to 64.
+        """
+        metric: VectorIndex.Metric
+        storage: VectorIndex.Storage
+        def __init__(self) -> None:
+            ...
+        @property
+        def ef_construction(self) -> int:
+            ...
+        @ef_construction.setter
+        def ef_construction(self, arg0: typing.SupportsInt) -> None:
+            ...
+        @property
+        def ef_search(self) -> int:
+            ...
+        @ef_search.setter
+        def ef_search(self, arg0: typing.SupportsInt) -> None:
+            ...
+        @property
+        def max_neighbors(self) -> int:
+            ...
+        @max_neighbors.setter
+        def max_neighbors(self, arg0: typing.SupportsInt) -> None:
+            ...
+    class Metric:
+        """
+        Members:
+        
+          L2 : Squared euclidean distance
+        
+          INNER_PRODUCT : Negated inner product
+        
+          COSINE : 1 - cosine similarity
+        """
+        COSINE: typing.ClassVar[VectorIndex.Metric]  # value = <Metric.COSINE: 2>
+        INNER_PRODUCT: typing.ClassVar[VectorIndex.Metric]  # value = <Metric.INNER_PRODUCT: 1>
+        L2: typing.ClassVar[VectorIndex.Metric]  # value = <Metric.L2: 0>
+        __members__: typing.ClassVar[dict[str, VectorIndex.Metric]]  # value = {'L2': <Metric.L2: 0>, 'INNER_PRODUCT': <Metric.INNER_PRODUCT: 1>, 'COSINE': <Metric.COSINE: 2>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    class Storage:
+        """
+        Members:
+        
+          F32 : The embeddings are stored as is
+        
+          INT8 : The embeddings are quantized to int8 with a scale per embedding
+        """
+        F32: typing.ClassVar[VectorIndex.Storage]  # value = <Storage.F32: 0>
+        INT8: typing.ClassVar[VectorIndex.Storage]  # value = <Storage.INT8: 1>
+        __members__: typing.ClassVar[dict[str, VectorIndex.Storage]]  # value = {'F32': <Storage.F32: 0>, 'INT8': <Storage.INT8: 1>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    @staticmethod
+    def load(path: os.PathLike | str | bytes) -> VectorIndex:
+        """
+        Loads the index saved by save(). The embeddings are memory mapped from the file, the file must not be modified while the index is alive.
+        """
+    def __init__(self, dimension: typing.SupportsInt, config: VectorIndex.Config | None = None) -> None:
+        ...
+    def __len__(self) -> int:
+        ...
+    @typing.overload
+    def add(self, embeddings: numpy.ndarray) -> int:
+        """
+        Adds the rows of the 2D array of embeddings, for example, the result of TextEmbeddingPipeline.embed_documents(). Returns id of the first added embedding.
+        """
+    @typing.overload
+    def add(self, embeddings: collections.abc.Sequence[collections.abc.Sequence[typing.SupportsFloat]] | collections.abc.Sequence[collections.abc.Sequence[typing.SupportsInt]] | collections.abc.Sequence[collections.abc.Sequence[typing.SupportsInt]]) -> int:
+        """
+        Adds the embeddings, for example, the results of TextEmbeddingPipeline.embed_documents(). Returns id of the first added embedding.
+        """
+    def get_config(self) -> VectorIndex.Config:
+        ...
+    def get_dimension(self) -> int:
+        ...
+    def save(self, path: os.PathLike | str | bytes) -> None:
+        """
+        Saves the index to a file.
+        """
+    @typing.overload
+    def search(self, query: numpy.ndarray, top_k: typing.SupportsInt) -> list[tuple[int, float]]:
+        """
+        Searches the nearest embeddings to the 1D array of the query embedding, for example, the result of TextEmbeddingPipeline.embed_query(). Returns ids of the nearest embeddings and their distances to the query sorted by distance.
+        """
+    @typing.overload
+    def search(self, query: collections.abc.Sequence[typing.SupportsFloat] | collections.abc.Sequence[typing.SupportsInt] | collections.abc.Sequence[typing.SupportsInt], top_k: typing.SupportsInt) -> list[tuple[int, float]]:
+        """
+        Searches the nearest embeddings to the query, for example, the result of TextEmbeddingPipeline.embed_query(). Returns ids of the nearest embeddings and their distances to the query sorted by distance.
+        """
+class WhisperDecodedResultChunk:
+class WarmupConfig:
+    """
+    
+        Structure to keep the shapes run by warmup() of the pipelines, so that the kernels for them are compiled
+        before the first real requests. A dummy prompt is generated for each combination of a length and a batch size.
+    
+        prompt_lengths: lengths of the dummy prompts in tokens, ignored by WhisperPipeline and Text2ImagePipeline.
+        batch_sizes:    numbers of the prompts generated together, the numbers of images per prompt for Text2ImagePipeline,
+                        ignored by VLMPipeline and WhisperPipeline.
+        max_new_tokens: number of the tokens generated for each prompt.
+        image_size:     side of a square dummy image passed with each prompt to VLMPipeline, 0 for text-only prompts;
+                        side of the images generated by Text2ImagePipeline, 0 for the size of its generation config.
+    """
+    @typing.overload
+    def __init__(self) -> None:
+        ...
+    @typing.overload
+    def __init__(self, **kwargs) -> None:
+        ...
+    @property
+    def batch_sizes(self) -> list[int]:
+        ...
+    @batch_sizes.setter
+    def batch_sizes(self, arg0: collections.abc.Sequence[typing.SupportsInt]) -> None:
+        ...
+    @property
+    def image_size(self) -> int:
+        ...
+    @image_size.setter
+    def image_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def max_new_tokens(self) -> int:
+        ...
+    @max_new_tokens.setter
+    def max_new_tokens(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def prompt_lengths(self) -> list[int]:
+        ...
+    @prompt_lengths.setter
+    def prompt_lengths(self, arg0: collections.abc.Sequence[typing.SupportsInt]) -> None:
+        ...
+    """
+    
+        Structure to store decoded text with corresponding timestamps
+    
+        :param start_ts chunk start time in seconds
+        :param end_ts   chunk end time in seconds
+        :param text     chunk text
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def end_ts(self) -> float:
+        ...
+    @property
+    def start_ts(self) -> float:
+        ...
+    @property
+    def text(self) -> str:
+        ...
+class WhisperDecodedResults:
+    """
+    
+        Structure to store resulting text outputs and scores.
+    
+        Parameters:
+        texts:      vector of resulting sequences.
+        scores:     scores for each sequence.
+        metrics:    performance metrics with tpot, ttft, etc. of type ov::genai::PerfMetrics.
+        shunks:     optional chunks of resulting sequences with timestamps
+        words:      optional words of the resulting sequence with timestamps
+    """
+    def __str__(self) -> str:
+        ...
+    @property
+    def chunks(self) -> list[WhisperDecodedResultChunk] | None:
+        ...
+    @property
+    def perf_metrics(self) -> WhisperPerfMetrics:
+        ...
+    @property
+    def scores(self) -> list[float]:
+        ...
+    @property
+    def texts(self) -> list[str]:
+        ...
+    @property
+    def words(self) -> list[WhisperWordTiming] | None:
+        ...
+class WhisperGenerationConfig(GenerationConfig):
+    """
+    
+        WhisperGenerationConfig
+        
+        Whisper specific parameters:
+        :param decoder_start_token_id: Corresponds to the ”<|startoftranscript|>” token.
+        :type decoder_start_token_id: int
+    
+        :param pad_token_id: Padding token id.
+        :type pad_token_id: int
+    
+        :param translate_token_id: Translate token id.
+        :type translate_token_id: int
+    
+        :param transcribe_token_id: Transcribe token id.
+        :type transcribe_token_id: int
+    
+        :param no_timestamps_token_id: No timestamps token id.
+        :type no_timestamps_token_id: int
+    
+        :param prev_sot_token_id: Corresponds to the ”<|startofprev|>” token.
+        :type prev_sot_token_id: int
+    
+        :param is_multilingual:
+        :type is_multilingual: bool
+    
+        :param begin_suppress_tokens: A list containing tokens that will be suppressed at the beginning of the sampling process.
+        :type begin_suppress_tokens: list[int]
+    
+        :param suppress_tokens: A list containing the non-speech tokens that will be suppressed during generation.
+        :type suppress_tokens: list[int]
+    
+        :param language: Language token to use for generation in the form of <|en|>.
+                         You can find all the possible language tokens in the generation_config.json lang_to_id dictionary.
+        :type language: Optional[str]
+    
+        :param lang_to_id: Language token to token_id map. Initialized from the generation_config.json lang_to_id dictionary.
+        :type lang_to_id: dict[str, int]
+    
+        :param task: Task to use for generation, either “translate” or “transcribe”
+        :type task: int
+    
+        :param return_timestamps: If `true` the pipeline will return timestamps along the text for *segments* of words in the text.
+                           For instance, if you get
+                           WhisperDecodedResultChunk
+                               start_ts = 0.5
+                               end_ts = 1.5
+                               text = " Hi there!"
+                           then it means the model predicts that the segment "Hi there!" was spoken after `0.5` and before `1.5` seconds.
+                           Note that a segment of text refers to a sequence of one or more words, rather than individual words.
+        :type return_timestamps: bool
+    
+        :param initial_prompt: Initial prompt tokens passed as a previous transcription (after `<|startofprev|>` token) to the first processing
+        window. Can be used to steer the model to use particular spellings or styles.
+    
+        Example:
+          auto result = pipeline.generate(raw_speech);
+          //  He has gone and gone for good answered Paul Icrom who...
+    
+          auto result = pipeline.generate(raw_speech, ov::genai::initial_prompt("Polychrome"));
+          //  He has gone and gone for good answered Polychrome who...
         :type initial_prompt: Optional[str]
     
         :param hotwords:  Hotwords tokens passed as a previous transcription (after `<|startofprev|>` token) to the all processing windows.
@@ -3502,6 +5005,30 @@ class WhisperGenerationConfig(GenerationConfig):
           auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
           //  He has gone and gone for good answered Polychrome who...
         :type hotwords: Optional[str]
+
+        :param stride_length: If set, long-form audio is split into 30 seconds windows which overlap by `stride_length` seconds on each side,
+        instead of seeking each next window by the timestamps of the previous one. The windows are encoded and decoded as a batch,
+        and the texts of the overlapping windows are merged by their matching tokens.
+        :type stride_length: Optional[float]
+
+        :param vad_filter: If `true`, the silence of the audio is skipped before the encoding: the speech regions are detected by the energy
+        of the audio frames and packed back to back, the timestamps of the segments are mapped back to the original audio.
+        :type vad_filter: bool
+
+        :param word_timestamps: If `true`, the pipeline returns the timestamps of each word of the text in WhisperDecodedResults.words.
+        The tokens are aligned to the audio frames by dynamic time warping of the cross-attention weights of the `alignment_heads`.
+        The pipeline must be created with the `word_timestamps=True` property.
+        :type word_timestamps: bool
+
+        :param alignment_heads: The (layer, head) pairs of the decoder cross-attention heads aligned with the speech, as of generation_config.json.
+        :type alignment_heads: list[tuple[int, int]]
+
+        :param num_assistant_tokens: The number of the tokens drafted per step by the draft decoder of the pipeline created with `draft_decoder_path`,
+        the drafted tokens are validated by the pipeline decoder in a single inference. 0 disables assisted generation unless `assistant_confidence_threshold` is set.
+        :type num_assistant_tokens: int
+
+        :param assistant_confidence_threshold: If set, the draft decoder drafts the tokens until the probability of a drafted token is below the threshold.
+        :type assistant_confidence_threshold: float
     
         Generic parameters:
         max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
@@ -3548,7 +5075,10 @@ class WhisperGenerationConfig(GenerationConfig):
     is_multilingual: bool
     language: str | None
     return_timestamps: bool
+    stride_length: float | None
     task: str | None
+    vad_filter: bool
+    word_timestamps: bool
     @typing.overload
     def __init__(self, json_path: os.PathLike | str | bytes) -> None:
         """
@@ -3560,6 +5090,12 @@ class WhisperGenerationConfig(GenerationConfig):
     def update_generation_config(self, **kwargs) -> None:
         ...
     @property
+    def alignment_heads(self) -> list[tuple[int, int]]:
+        ...
+    @alignment_heads.setter
+    def alignment_heads(self, arg0: collections.abc.Sequence[tuple[typing.SupportsInt, typing.SupportsInt]]) -> None:
+        ...
+    @property
     def begin_suppress_tokens(self) -> list[int]:
         ...
     @begin_suppress_tokens.setter
@@ -3646,8 +5182,17 @@ class WhisperPipeline:
                     WhisperPipeline class constructor.
                     models_path (os.PathLike): Path to the model file.
                     device (str): Device to run the model on (e.g., CPU, GPU).
+                    draft_decoder_path (str): Optional dir of a smaller Whisper model with the same tokenizer, e.g. distil-whisper,
+                        whose decoder drafts the tokens for assisted generation.
+                    word_timestamps (bool): Optional, whether the decoder computes the cross-attention weights of the alignment heads for
+                        the word timestamps.
         """
-    def generate(self, raw_speech_input: collections.abc.Sequence[typing.SupportsFloat], generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> WhisperDecodedResults:
+    def finish_stream(self) -> WhisperStreamingResult:
+        """
+        Finishes the stream, the rest of the transcription is returned as stable.
+        """
+    @typing.overload
+    def generate(self, raw_speech_input: numpy.ndarray | bytes, generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> WhisperDecodedResults:
         """
             High level generate that receives raw speech as a vector of floats and returns decoded output.
         
@@ -3739,6 +5284,30 @@ class WhisperPipeline:
               auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
               //  He has gone and gone for good answered Polychrome who...
             :type hotwords: Optional[str]
+
+            :param stride_length: If set, long-form audio is split into 30 seconds windows which overlap by `stride_length` seconds on each side,
+            instead of seeking each next window by the timestamps of the previous one. The windows are encoded and decoded as a batch,
+            and the texts of the overlapping windows are merged by their matching tokens.
+            :type stride_length: Optional[float]
+
+            :param vad_filter: If `true`, the silence of the audio is skipped before the encoding: the speech regions are detected by the energy
+            of the audio frames and packed back to back, the timestamps of the segments are mapped back to the original audio.
+            :type vad_filter: bool
+
+            :param word_timestamps: If `true`, the pipeline returns the timestamps of each word of the text in WhisperDecodedResults.words.
+            The tokens are aligned to the audio frames by dynamic time warping of the cross-attention weights of the `alignment_heads`.
+            The pipeline must be created with the `word_timestamps=True` property.
+            :type word_timestamps: bool
+
+            :param alignment_heads: The (layer, head) pairs of the decoder cross-attention heads aligned with the speech, as of generation_config.json.
+            :type alignment_heads: list[tuple[int, int]]
+
+            :param num_assistant_tokens: The number of the tokens drafted per step by the draft decoder of the pipeline created with `draft_decoder_path`,
+            the drafted tokens are validated by the pipeline decoder in a single inference. 0 disables assisted generation unless `assistant_confidence_threshold` is set.
+            :type num_assistant_tokens: int
+
+            :param assistant_confidence_threshold: If set, the draft decoder drafts the tokens until the probability of a drafted token is below the threshold.
+            :type assistant_confidence_threshold: float
         
             Generic parameters:
             max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
@@ -3780,30 +5349,583 @@ class WhisperPipeline:
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
         """
-    def get_generation_config(self) -> WhisperGenerationConfig:
-        ...
-    def get_tokenizer(self) -> Tokenizer:
-        ...
-    def set_generation_config(self, config: WhisperGenerationConfig) -> None:
-        ...
-class WhisperRawPerfMetrics:
-    """
-    
-        Structure with whisper specific raw performance metrics for each generation before any statistics are calculated.
-    
-        :param features_extraction_durations: Duration for each features extraction call.
-        :type features_extraction_durations: list[MicroSeconds]
-    """
-    def __init__(self) -> None:
-        ...
-    @property
-    def features_extraction_durations(self) -> list[float]:
+    @typing.overload
+    def generate(self, raw_speech_input: collections.abc.Sequence[typing.SupportsFloat], generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> WhisperDecodedResults:
+        """
+            High level generate that receives raw speech as a vector of floats and returns decoded output.
+        
+            :param raw_speech_input: inputs in the form of list of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_input: list[float]
+        
+            :param generation_config: generation_config
+            :type generation_config: WhisperGenerationConfig or a dict
+        
+            :param streamer: streamer either as a lambda with a boolean returning flag whether generation should be stopped.
+                             Streamer supported for short-form audio (< 30 seconds) with `return_timestamps=False` only
+            :type : Callable[[str], bool], ov.genai.StreamerBase
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to WhisperGenerationConfig fields.
+            :type : dict
+        
+            :return: return results in decoded form
+            :rtype: WhisperDecodedResults
+         
+         
+            WhisperGenerationConfig
+            
+            Whisper specific parameters:
+            :param decoder_start_token_id: Corresponds to the ”<|startoftranscript|>” token.
+            :type decoder_start_token_id: int
+        
+            :param pad_token_id: Padding token id.
+            :type pad_token_id: int
+        
+            :param translate_token_id: Translate token id.
+            :type translate_token_id: int
+        
+            :param transcribe_token_id: Transcribe token id.
+            :type transcribe_token_id: int
+        
+            :param no_timestamps_token_id: No timestamps token id.
+            :type no_timestamps_token_id: int
+        
+            :param prev_sot_token_id: Corresponds to the ”<|startofprev|>” token.
+            :type prev_sot_token_id: int
+        
+            :param is_multilingual:
+            :type is_multilingual: bool
+        
+            :param begin_suppress_tokens: A list containing tokens that will be suppressed at the beginning of the sampling process.
+            :type begin_suppress_tokens: list[int]
+        
+            :param suppress_tokens: A list containing the non-speech tokens that will be suppressed during generation.
+            :type suppress_tokens: list[int]
+        
+            :param language: Language token to use for generation in the form of <|en|>.
+                             You can find all the possible language tokens in the generation_config.json lang_to_id dictionary.
+            :type language: Optional[str]
+        
+            :param lang_to_id: Language token to token_id map. Initialized from the generation_config.json lang_to_id dictionary.
+            :type lang_to_id: dict[str, int]
+        
+            :param task: Task to use for generation, either “translate” or “transcribe”
+            :type task: int
+        
+            :param return_timestamps: If `true` the pipeline will return timestamps along the text for *segments* of words in the text.
+                               For instance, if you get
+                               WhisperDecodedResultChunk
+                                   start_ts = 0.5
+                                   end_ts = 1.5
+                                   text = " Hi there!"
+                               then it means the model predicts that the segment "Hi there!" was spoken after `0.5` and before `1.5` seconds.
+                               Note that a segment of text refers to a sequence of one or more words, rather than individual words.
+            :type return_timestamps: bool
+        
+            :param initial_prompt: Initial prompt tokens passed as a previous transcription (after `<|startofprev|>` token) to the first processing
+            window. Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::initial_prompt("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type initial_prompt: Optional[str]
+        
+            :param hotwords:  Hotwords tokens passed as a previous transcription (after `<|startofprev|>` token) to the all processing windows.
+            Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type hotwords: Optional[str]
+
+            :param stride_length: If set, long-form audio is split into 30 seconds windows which overlap by `stride_length` seconds on each side,
+            instead of seeking each next window by the timestamps of the previous one. The windows are encoded and decoded as a batch,
+            and the texts of the overlapping windows are merged by their matching tokens.
+            :type stride_length: Optional[float]
+
+            :param vad_filter: If `true`, the silence of the audio is skipped before the encoding: the speech regions are detected by the energy
+            of the audio frames and packed back to back, the timestamps of the segments are mapped back to the original audio.
+            :type vad_filter: bool
+
+            :param word_timestamps: If `true`, the pipeline returns the timestamps of each word of the text in WhisperDecodedResults.words.
+            The tokens are aligned to the audio frames by dynamic time warping of the cross-attention weights of the `alignment_heads`.
+            The pipeline must be created with the `word_timestamps=True` property.
+            :type word_timestamps: bool
+
+            :param alignment_heads: The (layer, head) pairs of the decoder cross-attention heads aligned with the speech, as of generation_config.json.
+            :type alignment_heads: list[tuple[int, int]]
+
+            :param num_assistant_tokens: The number of the tokens drafted per step by the draft decoder of the pipeline created with `draft_decoder_path`,
+            the drafted tokens are validated by the pipeline decoder in a single inference. 0 disables assisted generation unless `assistant_confidence_threshold` is set.
+            :type num_assistant_tokens: int
+
+            :param assistant_confidence_threshold: If set, the draft decoder drafts the tokens until the probability of a drafted token is below the threshold.
+            :type assistant_confidence_threshold: float
+        
+            Generic parameters:
+            max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
+                           max_new_tokens. Its effect is overridden by `max_new_tokens`, if also set.
+            max_new_tokens: the maximum numbers of tokens to generate, excluding the number of tokens in the prompt. max_new_tokens has priority over max_length.
+            min_new_tokens: set 0 probability for eos_token_id for the first eos_token_id generated tokens.
+            ignore_eos:    if set to true, then generation will not stop even if <eos> token is met.
+            eos_token_id:  token_id of <eos> (end of sentence)
+            stop_strings: a set of strings that will cause pipeline to stop generating further tokens.
+            include_stop_str_in_output: if set to true stop string that matched generation will be included in generation output (default: false)
+            stop_token_ids: a set of tokens that will cause pipeline to stop generating further tokens.
+            echo:           if set to true, the model will echo the prompt in the output.
+            logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
+                            Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
+        
+            repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
+            presence_penalty: reduces absolute log prob if the token was generated at least once.
+            frequency_penalty: reduces absolute log prob as many times as the token was generated.
+        
+            Beam search specific parameters:
+            num_beams:         number of beams for beam search. 1 disables beam search.
+            num_beam_groups:   number of groups to divide `num_beams` into in order to ensure diversity among different groups of beams.
+            diversity_penalty: value is subtracted from a beam's score if it generates the same token as any beam from other group at a particular time.
+            length_penalty:    exponential penalty to the length that is used with beam-based generation. It is applied as an exponent to
+                the sequence length, which in turn is used to divide the score of the sequence. Since the score is the log
+                likelihood of the sequence (i.e. negative), length_penalty > 0.0 promotes longer sequences, while
+                length_penalty < 0.0 encourages shorter sequences.
+            num_return_sequences: the number of sequences to return for grouped beam search decoding.
+            no_repeat_ngram_size: if set to int > 0, all ngrams of that size can only occur once.
+            stop_criteria:        controls the stopping condition for grouped beam search. It accepts the following values:
+                "openvino_genai.StopCriteria.EARLY", where the generation stops as soon as there are `num_beams` complete candidates;
+                "openvino_genai.StopCriteria.HEURISTIC" is applied and the generation stops when is it very unlikely to find better candidates;
+                "openvino_genai.StopCriteria.NEVER", where the beam search procedure only stops when there cannot be better candidates (canonical beam search algorithm).
+        
+            Random sampling parameters:
+            temperature:        the value used to modulate token probabilities for random sampling.
+            top_p:              if set to float < 1, only the smallest set of most probable tokens with probabilities that add up to top_p or higher are kept for generation.
+            top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
+            do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
+            num_return_sequences: the number of sequences to generate from a single prompt.
+        """
+    @typing.overload
+    def generate(self, raw_speech_inputs: collections.abc.Sequence[numpy.ndarray | bytes], generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, **kwargs) -> list[WhisperDecodedResults]:
+        """
+            Transcribes several audio inputs together, so that the encoder and decoder inferences process them as a batch.
+        
+            :param raw_speech_inputs: inputs in the form of list of lists of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_inputs: list[list[float]]
+        
+            :param generation_config: generation_config used for all the inputs
+            :type generation_config: WhisperGenerationConfig or a dict
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to WhisperGenerationConfig fields.
+            :type : dict
+        
+            :return: return results in decoded form for each input
+            :rtype: list[WhisperDecodedResults]
+         
+         
+            WhisperGenerationConfig
+            
+            Whisper specific parameters:
+            :param decoder_start_token_id: Corresponds to the ”<|startoftranscript|>” token.
+            :type decoder_start_token_id: int
+        
+            :param pad_token_id: Padding token id.
+            :type pad_token_id: int
+        
+            :param translate_token_id: Translate token id.
+            :type translate_token_id: int
+        
+            :param transcribe_token_id: Transcribe token id.
+            :type transcribe_token_id: int
+        
+            :param no_timestamps_token_id: No timestamps token id.
+            :type no_timestamps_token_id: int
+        
+            :param prev_sot_token_id: Corresponds to the ”<|startofprev|>” token.
+            :type prev_sot_token_id: int
+        
+            :param is_multilingual:
+            :type is_multilingual: bool
+        
+            :param begin_suppress_tokens: A list containing tokens that will be suppressed at the beginning of the sampling process.
+            :type begin_suppress_tokens: list[int]
+        
+            :param suppress_tokens: A list containing the non-speech tokens that will be suppressed during generation.
+            :type suppress_tokens: list[int]
+        
+            :param language: Language token to use for generation in the form of <|en|>.
+                             You can find all the possible language tokens in the generation_config.json lang_to_id dictionary.
+            :type language: Optional[str]
+        
+            :param lang_to_id: Language token to token_id map. Initialized from the generation_config.json lang_to_id dictionary.
+            :type lang_to_id: dict[str, int]
+        
+            :param task: Task to use for generation, either “translate” or “transcribe”
+            :type task: int
+        
+            :param return_timestamps: If `true` the pipeline will return timestamps along the text for *segments* of words in the text.
+                               For instance, if you get
+                               WhisperDecodedResultChunk
+                                   start_ts = 0.5
+                                   end_ts = 1.5
+                                   text = " Hi there!"
+                               then it means the model predicts that the segment "Hi there!" was spoken after `0.5` and before `1.5` seconds.
+                               Note that a segment of text refers to a sequence of one or more words, rather than individual words.
+            :type return_timestamps: bool
+        
+            :param initial_prompt: Initial prompt tokens passed as a previous transcription (after `<|startofprev|>` token) to the first processing
+            window. Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::initial_prompt("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type initial_prompt: Optional[str]
+        
+            :param hotwords:  Hotwords tokens passed as a previous transcription (after `<|startofprev|>` token) to the all processing windows.
+            Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type hotwords: Optional[str]
+
+            :param stride_length: If set, long-form audio is split into 30 seconds windows which overlap by `stride_length` seconds on each side,
+            instead of seeking each next window by the timestamps of the previous one. The windows are encoded and decoded as a batch,
+            and the texts of the overlapping windows are merged by their matching tokens.
+            :type stride_length: Optional[float]
+
+            :param vad_filter: If `true`, the silence of the audio is skipped before the encoding: the speech regions are detected by the energy
+            of the audio frames and packed back to back, the timestamps of the segments are mapped back to the original audio.
+            :type vad_filter: bool
+
+            :param word_timestamps: If `true`, the pipeline returns the timestamps of each word of the text in WhisperDecodedResults.words.
+            The tokens are aligned to the audio frames by dynamic time warping of the cross-attention weights of the `alignment_heads`.
+            The pipeline must be created with the `word_timestamps=True` property.
+            :type word_timestamps: bool
+
+            :param alignment_heads: The (layer, head) pairs of the decoder cross-attention heads aligned with the speech, as of generation_config.json.
+            :type alignment_heads: list[tuple[int, int]]
+
+            :param num_assistant_tokens: The number of the tokens drafted per step by the draft decoder of the pipeline created with `draft_decoder_path`,
+            the drafted tokens are validated by the pipeline decoder in a single inference. 0 disables assisted generation unless `assistant_confidence_threshold` is set.
+            :type num_assistant_tokens: int
+
+            :param assistant_confidence_threshold: If set, the draft decoder drafts the tokens until the probability of a drafted token is below the threshold.
+            :type assistant_confidence_threshold: float
+        
+            Generic parameters:
+            max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
+                           max_new_tokens. Its effect is overridden by `max_new_tokens`, if also set.
+            max_new_tokens: the maximum numbers of tokens to generate, excluding the number of tokens in the prompt. max_new_tokens has priority over max_length.
+            min_new_tokens: set 0 probability for eos_token_id for the first eos_token_id generated tokens.
+            ignore_eos:    if set to true, then generation will not stop even if <eos> token is met.
+            eos_token_id:  token_id of <eos> (end of sentence)
+            stop_strings: a set of strings that will cause pipeline to stop generating further tokens.
+            include_stop_str_in_output: if set to true stop string that matched generation will be included in generation output (default: false)
+            stop_token_ids: a set of tokens that will cause pipeline to stop generating further tokens.
+            echo:           if set to true, the model will echo the prompt in the output.
+            logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
+                            Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
+        
+            repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
+            presence_penalty: reduces absolute log prob if the token was generated at least once.
+            frequency_penalty: reduces absolute log prob as many times as the token was generated.
+        
+            Beam search specific parameters:
+            num_beams:         number of beams for beam search. 1 disables beam search.
+            num_beam_groups:   number of groups to divide `num_beams` into in order to ensure diversity among different groups of beams.
+            diversity_penalty: value is subtracted from a beam's score if it generates the same token as any beam from other group at a particular time.
+            length_penalty:    exponential penalty to the length that is used with beam-based generation. It is applied as an exponent to
+                the sequence length, which in turn is used to divide the score of the sequence. Since the score is the log
+                likelihood of the sequence (i.e. negative), length_penalty > 0.0 promotes longer sequences, while
+                length_penalty < 0.0 encourages shorter sequences.
+            num_return_sequences: the number of sequences to return for grouped beam search decoding.
+            no_repeat_ngram_size: if set to int > 0, all ngrams of that size can only occur once.
+            stop_criteria:        controls the stopping condition for grouped beam search. It accepts the following values:
+                "openvino_genai.StopCriteria.EARLY", where the generation stops as soon as there are `num_beams` complete candidates;
+                "openvino_genai.StopCriteria.HEURISTIC" is applied and the generation stops when is it very unlikely to find better candidates;
+                "openvino_genai.StopCriteria.NEVER", where the beam search procedure only stops when there cannot be better candidates (canonical beam search algorithm).
+        
+            Random sampling parameters:
+            temperature:        the value used to modulate token probabilities for random sampling.
+            top_p:              if set to float < 1, only the smallest set of most probable tokens with probabilities that add up to top_p or higher are kept for generation.
+            top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
+            do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
+            num_return_sequences: the number of sequences to generate from a single prompt.
+        """
+    @typing.overload
+    def generate(self, raw_speech_inputs: collections.abc.Sequence[collections.abc.Sequence[typing.SupportsFloat]], generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, **kwargs) -> list[WhisperDecodedResults]:
+        """
+            Transcribes several audio inputs together, so that the encoder and decoder inferences process them as a batch.
+        
+            :param raw_speech_inputs: inputs in the form of list of lists of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_inputs: list[list[float]]
+        
+            :param generation_config: generation_config used for all the inputs
+            :type generation_config: WhisperGenerationConfig or a dict
+        
+            :param kwargs: arbitrary keyword arguments with keys corresponding to WhisperGenerationConfig fields.
+            :type : dict
+        
+            :return: return results in decoded form for each input
+            :rtype: list[WhisperDecodedResults]
+         
+         
+            WhisperGenerationConfig
+            
+            Whisper specific parameters:
+            :param decoder_start_token_id: Corresponds to the ”<|startoftranscript|>” token.
+            :type decoder_start_token_id: int
+        
+            :param pad_token_id: Padding token id.
+            :type pad_token_id: int
+        
+            :param translate_token_id: Translate token id.
+            :type translate_token_id: int
+        
+            :param transcribe_token_id: Transcribe token id.
+            :type transcribe_token_id: int
+        
+            :param no_timestamps_token_id: No timestamps token id.
+            :type no_timestamps_token_id: int
+        
+            :param prev_sot_token_id: Corresponds to the ”<|startofprev|>” token.
+            :type prev_sot_token_id: int
+        
+            :param is_multilingual:
+            :type is_multilingual: bool
+        
+            :param begin_suppress_tokens: A list containing tokens that will be suppressed at the beginning of the sampling process.
+            :type begin_suppress_tokens: list[int]
+        
+            :param suppress_tokens: A list containing the non-speech tokens that will be suppressed during generation.
+            :type suppress_tokens: list[int]
+        
+            :param language: Language token to use for generation in the form of <|en|>.
+                             You can find all the possible language tokens in the generation_config.json lang_to_id dictionary.
+            :type language: Optional[str]
+        
+            :param lang_to_id: Language token to token_id map. Initialized from the generation_config.json lang_to_id dictionary.
+            :type lang_to_id: dict[str, int]
+        
+            :param task: Task to use for generation, either “translate” or “transcribe”
+            :type task: int
+        
+            :param return_timestamps: If `true` the pipeline will return timestamps along the text for *segments* of words in the text.
+                               For instance, if you get
+                               WhisperDecodedResultChunk
+                                   start_ts = 0.5
+                                   end_ts = 1.5
+                                   text = " Hi there!"
+                               then it means the model predicts that the segment "Hi there!" was spoken after `0.5` and before `1.5` seconds.
+                               Note that a segment of text refers to a sequence of one or more words, rather than individual words.
+            :type return_timestamps: bool
+        
+            :param initial_prompt: Initial prompt tokens passed as a previous transcription (after `<|startofprev|>` token) to the first processing
+            window. Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::initial_prompt("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type initial_prompt: Optional[str]
+        
+            :param hotwords:  Hotwords tokens passed as a previous transcription (after `<|startofprev|>` token) to the all processing windows.
+            Can be used to steer the model to use particular spellings or styles.
+        
+            Example:
+              auto result = pipeline.generate(raw_speech);
+              //  He has gone and gone for good answered Paul Icrom who...
+        
+              auto result = pipeline.generate(raw_speech, ov::genai::hotwords("Polychrome"));
+              //  He has gone and gone for good answered Polychrome who...
+            :type hotwords: Optional[str]
+
+            :param stride_length: If set, long-form audio is split into 30 seconds windows which overlap by `stride_length` seconds on each side,
+            instead of seeking each next window by the timestamps of the previous one. The windows are encoded and decoded as a batch,
+            and the texts of the overlapping windows are merged by their matching tokens.
+            :type stride_length: Optional[float]
+
+            :param vad_filter: If `true`, the silence of the audio is skipped before the encoding: the speech regions are detected by the energy
+            of the audio frames and packed back to back, the timestamps of the segments are mapped back to the original audio.
+            :type vad_filter: bool
+
+            :param word_timestamps: If `true`, the pipeline returns the timestamps of each word of the text in WhisperDecodedResults.words.
+            The tokens are aligned to the audio frames by dynamic time warping of the cross-attention weights of the `alignment_heads`.
+            The pipeline must be created with the `word_timestamps=True` property.
+            :type word_timestamps: bool
+
+            :param alignment_heads: The (layer, head) pairs of the decoder cross-attention heads aligned with the speech, as of generation_config.json.
+            :type alignment_heads: list[tuple[int, int]]
+
+            :param num_assistant_tokens: The number of the tokens drafted per step by the draft decoder of the pipeline created with `draft_decoder_path`,
+            the drafted tokens are validated by the pipeline decoder in a single inference. 0 disables assisted generation unless `assistant_confidence_threshold` is set.
+            :type num_assistant_tokens: int
+
+            :param assistant_confidence_threshold: If set, the draft decoder drafts the tokens until the probability of a drafted token is below the threshold.
+            :type assistant_confidence_threshold: float
+        
+            Generic parameters:
+            max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
+                           max_new_tokens. Its effect is overridden by `max_new_tokens`, if also set.
+            max_new_tokens: the maximum numbers of tokens to generate, excluding the number of tokens in the prompt. max_new_tokens has priority over max_length.
+            min_new_tokens: set 0 probability for eos_token_id for the first eos_token_id generated tokens.
+            ignore_eos:    if set to true, then generation will not stop even if <eos> token is met.
+            eos_token_id:  token_id of <eos> (end of sentence)
+            stop_strings: a set of strings that will cause pipeline to stop generating further tokens.
+            include_stop_str_in_output: if set to true stop string that matched generation will be included in generation output (default: false)
+            stop_token_ids: a set of tokens that will cause pipeline to stop generating further tokens.
+            echo:           if set to true, the model will echo the prompt in the output.
+            logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
+                            Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
+        
+            repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
+            presence_penalty: reduces absolute log prob if the token was generated at least once.
+            frequency_penalty: reduces absolute log prob as many times as the token was generated.
+        
+            Beam search specific parameters:
+            num_beams:         number of beams for beam search. 1 disables beam search.
+            num_beam_groups:   number of groups to divide `num_beams` into in order to ensure diversity among different groups of beams.
+            diversity_penalty: value is subtracted from a beam's score if it generates the same token as any beam from other group at a particular time.
+            length_penalty:    exponential penalty to the length that is used with beam-based generation. It is applied as an exponent to
+                the sequence length, which in turn is used to divide the score of the sequence. Since the score is the log
+                likelihood of the sequence (i.e. negative), length_penalty > 0.0 promotes longer sequences, while
+                length_penalty < 0.0 encourages shorter sequences.
+            num_return_sequences: the number of sequences to return for grouped beam search decoding.
+            no_repeat_ngram_size: if set to int > 0, all ngrams of that size can only occur once.
+            stop_criteria:        controls the stopping condition for grouped beam search. It accepts the following values:
+                "openvino_genai.StopCriteria.EARLY", where the generation stops as soon as there are `num_beams` complete candidates;
+                "openvino_genai.StopCriteria.HEURISTIC" is applied and the generation stops when is it very unlikely to find better candidates;
+                "openvino_genai.StopCriteria.NEVER", where the beam search procedure only stops when there cannot be better candidates (canonical beam search algorithm).
+        
+            Random sampling parameters:
+            temperature:        the value used to modulate token probabilities for random sampling.
+            top_p:              if set to float < 1, only the smallest set of most probable tokens with probabilities that add up to top_p or higher are kept for generation.
+            top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
+            do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
+            num_return_sequences: the number of sequences to generate from a single prompt.
+        """
+    def get_generation_config(self) -> WhisperGenerationConfig:
+        ...
+    def get_tokenizer(self) -> Tokenizer:
         ...
+    @typing.overload
+    def push_audio(self, audio_chunk: numpy.ndarray | bytes) -> WhisperStreamingResult:
+        """
+        Appends a chunk of the stream audio given by a 1D numpy array or bytes of float32 PCM samples, normalized to near [-1, 1] range with 16k Hz sampling rate, and returns the updated transcription.
+        """
+    @typing.overload
+    def push_audio(self, audio_chunk: collections.abc.Sequence[typing.SupportsFloat]) -> WhisperStreamingResult:
+        """
+        Appends a chunk of the stream audio, normalized to near [-1, 1] range with 16k Hz sampling rate, and returns the updated transcription.
+        """
+    def set_generation_config(self, config: WhisperGenerationConfig) -> None:
+        ...
+    def start_stream(self, generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, **kwargs) -> None:
+        """
+            Starts the transcription of an audio stream, e.g. for live captioning. The stream audio is pushed in chunks as it
+            arrives, each push_audio() call decodes the buffered audio again and returns the text confirmed by two consecutive
+            hypotheses as stable and the rest as partial.
+        
+            :param generation_config: generation_config of the stream
+            :type generation_config: WhisperGenerationConfig or a dict
+        """
+    def warmup(self, config: WarmupConfig = ...) -> None:
+        """
+        Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.
+        """
+class WhisperRawPerfMetrics:
+    """
+    
+        Structure with whisper specific raw performance metrics for each generation before any statistics are calculated.
+    
+        :param features_extraction_durations: Duration for each features extraction call.
+        :type features_extraction_durations: list[MicroSeconds]
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def features_extraction_durations(self) -> list[float]:
+        ...
+class WhisperStreamingResult:
+    """
+    
+        The transcription update of an audio stream after a pushed chunk of audio.
+    
+        Parameters:
+        stable_text:  the text confirmed by this update, it's not changed by the later audio and follows the previously stable text.
+        partial_text: the unconfirmed rest of the current hypothesis, it replaces the previous partial text.
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def partial_text(self) -> str:
+        ...
+    @property
+    def stable_text(self) -> str:
+        ...
+class WhisperWordTiming:
+    """
+    
+        Structure to store a word of the decoded text with its timestamps
+    
+        :param word      word text with its leading space, if any
+        :param token_ids word token ids
+        :param start_ts  word start time in seconds
+        :param end_ts    word end time in seconds
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def end_ts(self) -> float:
+        ...
+    @property
+    def start_ts(self) -> float:
+        ...
+    @property
+    def token_ids(self) -> list[int]:
+        ...
+    @property
+    def word(self) -> str:
+        ...
+def calibrate_kv_cache_precisions(num_decoder_layers: typing.SupportsInt, num_kv_heads: typing.SupportsInt, head_size: typing.SupportsInt, num_tokens: typing.SupportsInt, budget_in_bytes: typing.SupportsInt, num_f16_layers: typing.SupportsInt = 1) -> KVCachePrecisionConfig:
+    """
+    
+        Chooses the mixed precisions of the KV cache, which fit a number of tokens into a memory budget with the least quantization:
+        the value cache of the middle layers is quantized to u8 first, then their key cache to u8 by channel, then their value cache to u4.
+        The first and the last num_f16_layers layers are kept in f16. Raises if the tokens do not fit even with the lowest precisions.
+    
+        :param num_decoder_layers: Number of the decoder layers of the model.
+        :param num_kv_heads: Number of the key / value heads of each layer.
+        :param head_size: Size of each head.
+        :param num_tokens: Number of the tokens the KV cache must fit.
+        :param budget_in_bytes: Memory budget of the KV cache.
+        :param num_f16_layers: Number of the first and of the last layers kept in f16.
+        :return: KVCachePrecisionConfig with the precisions of all the layers, to be set to SchedulerConfig.kv_cache_precision_config.
+    """
 def draft_model(models_path: os.PathLike | str | bytes, device: str = '', **kwargs) -> openvino._pyopenvino.OVAny:
     """
     device on which inference will be performed
     """
+def get_compiled_model_cache_dir() -> pathlib.Path:
+    """
+    Returns the directory of the compiled models cache, empty if the caching is disabled.
+    """
 def get_version() -> str:
     """
     OpenVINO GenAI version
     """
+def set_compiled_model_cache_dir(cache_dir: os.PathLike | str | bytes) -> None:
+    """
+    Enables the caching of the compiled models in the directory for every model compiled by the library after the call, unless a pipeline sets its own CACHE_DIR. An empty path disables caching. The default directory is taken from the OPENVINO_GENAI_CACHE_DIR environment variable.
+    """
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <filesystem>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
@@ -19,17 +23,29 @@ namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::AggregationMode;
 using ov::genai::SparseAttentionMode;
+using ov::genai::SchedulingPolicy;
+using ov::genai::StreamingTransport;
 using ov::genai::CacheEvictionConfig;
 using ov::genai::SparseAttentionConfig;
+using ov::genai::KVCacheQuantizationMode;
+using ov::genai::KVCachePrecisionConfig;
 using ov::genai::ContinuousBatchingPipeline;
 using ov::genai::GenerationResult;
 using ov::genai::EncodedGenerationResult;
+using ov::genai::GenerationHandle;
 using ov::genai::GenerationHandleImpl;
+using ov::genai::RequestMetrics;
 using ov::genai::GenerationOutput;
 using ov::genai::GenerationFinishReason;
 using ov::genai::GenerationStatus;
 using ov::genai::SchedulerConfig;
 using ov::genai::PipelineMetrics;
+using ov::genai::MemoryReport;
+using ov::genai::PrefixCacheDigest;
+using ov::genai::HistogramSnapshot;
+using ov::genai::ServingMetrics;
+using ov::genai::EngineLoopConfig;
+using ov::genai::GenerationCompletionCallback;
 
 namespace {
 
@@ -58,6 +74,39 @@ auto cache_eviction_config_docstring = R"(
     :type snapkv_window_size int
 )";
 
+auto kv_cache_precision_config_docstring = R"(
+    Configuration struct for the mixed precision KV cache.
+    :param key_precisions: Precisions of the key cache of the decoder layers by the layer index. The layers past the end of the
+      list and the ones set to openvino.Type.dynamic keep the precision chosen by the plugin, e.g. by KV_CACHE_PRECISION.
+    :type key_precisions: list[openvino.Type]
+
+    :param value_precisions: Precisions of the value cache of the decoder layers by the layer index, same as key_precisions.
+    :type value_precisions: list[openvino.Type]
+
+    :param key_quantization_mode: Grouping of the quantized key cache values.
+    :type key_quantization_mode: openvino_genai.KVCacheQuantizationMode
+
+    :param key_group_size: Number of the quantized key cache values sharing a scale and a zero point, 0 keeps the default of the plugin.
+    :type key_group_size: int
+
+    :param value_group_size: Number of the quantized value cache values of a token sharing a scale and a zero point, 0 keeps the default of the plugin.
+    :type value_group_size: int
+)";
+
+auto calibrate_kv_cache_precisions_docstring = R"(
+    Chooses the mixed precisions of the KV cache, which fit a number of tokens into a memory budget with the least quantization:
+    the value cache of the middle layers is quantized to u8 first, then their key cache to u8 by channel, then their value cache to u4.
+    The first and the last num_f16_layers layers are kept in f16. Raises if the tokens do not fit even with the lowest precisions.
+
+    :param num_decoder_layers: Number of the decoder layers of the model.
+    :param num_kv_heads: Number of the key / value heads of each layer.
+    :param head_size: Size of each head.
+    :param num_tokens: Number of the tokens the KV cache must fit.
+    :param budget_in_bytes: Memory budget of the KV cache.
+    :param num_f16_layers: Number of the first and of the last layers kept in f16.
+    :return: KVCachePrecisionConfig with the precisions of all the layers, to be set to SchedulerConfig.kv_cache_precision_config.
+)";
+
 auto sparse_attention_config_docstring = R"(
     Configuration struct for the sparse attention functionality.
     :param mode: Sparse attention mode to be applied.
@@ -73,11 +122,11 @@ auto sparse_attention_config_docstring = R"(
        blocks)
     :type num_last_dense_tokens_in_prefill: int
 
-    :param num_retained_start_tokens_in_cache: TRISHAPE mode only - The number of tokens in the beginning of the cache
+    :param num_retained_start_tokens_in_cache: TRISHAPE mode and sparse decoding - The number of tokens in the beginning of the cache
      (least recent) to be retained when applying sparse attention. Must be a multiple of block size.
     :type num_retained_start_tokens_in_cache: int
 
-    :param num_retained_recent_tokens_in_cache: TRISHAPE mode only - The number of most recent tokens in cache to be retained when
+    :param num_retained_recent_tokens_in_cache: TRISHAPE mode and sparse decoding - The number of most recent tokens in cache to be retained when
       applying sparse attention. Must be a multiple of block size.
     :param num_retained_recent_tokens_in_cache: int
 
@@ -97,6 +146,17 @@ auto sparse_attention_config_docstring = R"(
      place.  Directly influences the overhead portion of the importance score computations - if full (dense) attention takes
      M time to be calculated, then the importance score calculation would be taking `M / xattention_stride` time as overhead.
     :type xattention_stride: int
+
+    :param decode_threshold: Both modes - Cumulative importance score threshold for the block-sparse attention in the generation
+      stage. The importance of each KV cache block between the retained start and recent areas is the sum of the attention
+      scores of its tokens at the last densely computed generation step. Only the most important blocks with the importance
+      sum reaching this fraction of the total are attended to, the rest are skipped. The value of 1 disables sparse decoding.
+      Cannot be used together with cache eviction.
+    :type decode_threshold: float
+
+    :param decode_dense_interval: Both modes - Every `decode_dense_interval`-th generation step of a sequence is computed with
+      dense attention to refresh the block importance scores for sparse decoding.
+    :type decode_dense_interval: int
 )";
 auto scheduler_config_docstring = R"(
     SchedulerConfig to construct ContinuousBatchingPipeline
@@ -106,8 +166,30 @@ auto scheduler_config_docstring = R"(
         independent sequences, we consider total amount of tokens in a batch).
     num_kv_blocks:              total number of KV blocks available to scheduler logic.
     cache_size:                 total size of KV cache in GB.
+    kv_cache_memory_utilization: fraction of the total memory of the device that the pipeline may use, with the KV cache
+        taking the rest of it. When non-zero and both num_kv_blocks and cache_size are 0, num_kv_blocks is derived at
+        pipeline initialization from the memory left after inferring a dummy batch of max_num_batched_tokens tokens.
+        Must be in (0, 1] range.
     block_size:                 block size for KV cache.
     dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+    max_num_prefill_tokens_per_step: max number of prompt tokens to be scheduled at a single step, over all sequence groups.
+        Long prompts are processed in chunks of at most this size, interleaved with generation steps of running sequences.
+        Has effect only if dynamic_split_fuse is turned on. 0 means that prompt tokens are limited by max_num_batched_tokens only.
+    max_prefill_fraction:       max fraction of max_num_batched_tokens that prompt tokens can take at a step where some
+        sequences are generating. Must be in (0, 1] range. Has effect only if dynamic_split_fuse is turned on.
+    swap_space_size:            total size of the host memory swap space for KV cache blocks of preempted sequences in GB.
+        When non-zero, sequence groups that would otherwise be fully preempted get their KV cache blocks copied out
+        to host memory and restored on rescheduling instead of being recomputed.
+    swap_space_disk_size:       total size of the on-disk swap space tier in GB, used once the host memory swap space is exhausted.
+    swap_space_path:            path to the file backing the on-disk swap space tier.
+    scheduling_policy:          policy used to order sequence groups for scheduling and for choosing the preemption victims.
+    max_reordering_delay_ms:    max time in milliseconds a sequence group waits for its first scheduling before it is served
+        in order of arrival. Has effect only with SchedulingPolicy.PREFIX_CACHE_AWARE.
+    streaming_transport:        queue by which the outputs of the requests are passed to their GenerationHandle's.
+        SPSC_RING_BUFFER reduces the locking and the wakeups of the readers at high aggregate streaming rates.
+    prompt_lookup_store_size:   max number of n-grams of the outputs of completed requests kept in the store shared by all
+        the requests of prompt lookup decoding, which provides the candidates when the n-gram is not found in the
+        request's own context. 0 means that the store is not used.
 
     vLLM-like settings:
     max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -117,6 +199,11 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turned off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished generation its cache is released.
+    prefix_cache_path:          path to the file persisting the prefix cache across pipeline instances, e.g. process restarts.
+        The cached KV-blocks are loaded from the file at pipeline initialization, if it was saved for the same model and
+        KV-cache configuration, and are saved to it when the pipeline is destroyed. Has effect only if enable_prefix_caching is turned on.
+    kv_cache_precision_config:  precisions of the KV-cache of the individual decoder layers and grouping of the quantized values,
+        e.g. as chosen by calibrate_kv_cache_precisions for a memory budget. By default all layers use the precision chosen by the plugin.
     use_cache_eviction:         Whether to use cache eviction during generation.
     cache_eviction_config       Cache eviction configuration struct.
     use_sparse_attention        Whether to use sparse attention during prefill.
@@ -141,6 +228,96 @@ auto generation_result_docstring = R"(
     perf_metrics: Performance metrics for each generation result.
     extended_perf_metrics: performance pipeline specifics metrics,
                            applicable for pipelines with implemented extended metrics: SpeculativeDecoding Pipeline.
+    request_metrics: latency breakdown of the request.
+)";
+
+auto request_metrics_docstring = R"(
+    Latency breakdown of a single request, e.g. to find out why the request was slow. Durations are in microseconds.
+
+    :param queue_time: Time from adding the request to its first scheduling.
+    :type queue_time: float
+
+    :param ttft: Time from adding the request to its first generated token.
+    :type ttft: float
+
+    :param prefill_time: Time from the first scheduling of the request to its first generated token.
+    :type prefill_time: float
+
+    :param total_time: Time from adding the request till it is finished.
+    :type total_time: float
+
+    :param num_prefill_chunks: Number of steps, in which a part of the prompt was processed.
+    :type num_prefill_chunks: int
+
+    :param num_preemptions: Number of times the request was preempted.
+    :type num_preemptions: int
+
+    :param preempted_time: Total time the request waited to be scheduled again after preemptions.
+    :type preempted_time: float
+
+    :param num_prefix_cache_hit_tokens: Number of prompt tokens restored by prefix caching.
+    :type num_prefix_cache_hit_tokens: int
+
+    :param num_draft_tokens: Number of the validated candidate tokens of speculative decoding or prompt lookup.
+    :type num_draft_tokens: int
+
+    :param num_accepted_draft_tokens: Number of the accepted candidate tokens.
+    :type num_accepted_draft_tokens: int
+)";
+
+auto engine_loop_config_docstring = R"(
+    Limits of the engine loop of ContinuousBatchingPipeline, above which add_request blocks until some of the
+    requests are finished. A single request is always admitted.
+
+    :param max_num_requests: Max number of non finished requests, 0 means no limit.
+    :type max_num_requests: int
+
+    :param max_cache_usage: KV cache usage in percent, after which new requests are not admitted.
+    :type max_cache_usage: float
+)";
+
+auto histogram_snapshot_docstring = R"(
+    Snapshot of a latency or ratio histogram of the serving metrics.
+
+    :param count: Number of the recorded values.
+    :type count: int
+
+    :param sum: Sum of the recorded values.
+    :type sum: float
+
+    :param min: Min recorded value.
+    :type min: float
+
+    :param max: Max recorded value.
+    :type max: float
+
+    :param buckets: Non empty buckets as pairs of the upper bound of the bucket and the number of the values in it.
+    :type buckets: list[tuple[float, int]]
+)";
+
+auto serving_metrics_docstring = R"(
+    Contains the distributions of the serving latencies and of the KV cache state over the lifetime of the pipeline.
+
+    :param ttft: Time to the first token of the requests in microseconds, counted from adding a request.
+    :type ttft: HistogramSnapshot
+
+    :param inter_token_latency: Time between the generated tokens of the requests in microseconds.
+    :type inter_token_latency: HistogramSnapshot
+
+    :param queue_time: Time from adding a request to its first scheduling in microseconds.
+    :type queue_time: HistogramSnapshot
+
+    :param prefix_cache_hit_ratio: Percentage of the prompt tokens of the requests restored from the prefix cache.
+    :type prefix_cache_hit_ratio: HistogramSnapshot
+
+    :param cache_usage: KV cache usage in percent at the generation steps.
+    :type cache_usage: HistogramSnapshot
+
+    :param num_preemptions: Number of the preemptions of the KV cache of the requests.
+    :type num_preemptions: int
+
+    :param num_finished_requests: Number of the finished requests.
+    :type num_finished_requests: int
 )";
 
 auto pipeline_metrics_docstring = R"(
@@ -153,6 +330,12 @@ auto pipeline_metrics_docstring = R"(
     :param scheduled_requests:  Number of requests that were scheduled for processing at the previous step of the pipeline.
     :type scheduled_requests: int
 
+    :param scheduled_prompt_tokens: Number of prompt tokens that were scheduled for processing at the previous step of the pipeline.
+    :type scheduled_prompt_tokens: int
+
+    :param scheduled_generate_tokens: Number of generation phase tokens that were scheduled for processing at the previous step of the pipeline.
+    :type scheduled_generate_tokens: int
+
     :param cache_usage: Percentage of KV cache usage in the last generation step.
     :type cache_usage: float
 
@@ -162,6 +345,61 @@ auto pipeline_metrics_docstring = R"(
 
     :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
     :type avg_cache_usage: float
+
+    :param prefix_cache_hit_rate: Percentage of the prompt tokens of all requests added to the pipeline, for which the KV cache was restored from the prefix cache
+    :type prefix_cache_hit_rate: float
+
+    :param max_prefix_cache_hit_depth: Max number of prompt tokens restored from the prefix cache for a single request
+    :type max_prefix_cache_hit_depth: int
+
+    :param peak_kv_cache_used_bytes: Peak size in bytes of the KV cache blocks used by the requests during the lifetime of the pipeline
+    :type peak_kv_cache_used_bytes: int
+
+    :param peak_kv_cache_allocated_bytes: Peak size in bytes of the allocated KV cache during the lifetime of the pipeline
+    :type peak_kv_cache_allocated_bytes: int
+
+    :param peak_memory_bytes: Peak of the total memory of the memory report during the lifetime of the pipeline
+    :type peak_memory_bytes: int
+)";
+
+auto memory_report_docstring = R"(
+    Breakdown of the memory taken by the pipeline in bytes as of the previous generation step.
+
+    :param weights: Size of the constants of the compiled models by the model names, e.g. "language" or "draft_language".
+    :type weights: dict[str, int]
+
+    :param kv_cache_allocated: Size of the KV cache allocated on the device.
+    :type kv_cache_allocated: int
+
+    :param kv_cache_used: Size of the KV cache blocks used by the requests, a part of kv_cache_allocated.
+    :type kv_cache_used: int
+
+    :param prefix_cache: Size of the free KV cache blocks holding the prefixes reusable by prefix caching, a part of kv_cache_allocated.
+    :type prefix_cache: int
+
+    :param kv_cache_swap_space: Size of the host memory tier of the KV cache swap space.
+    :type kv_cache_swap_space: int
+
+    :param input_buffers: Size of the host buffers staging the inputs of the models.
+    :type input_buffers: int
+
+    :param vision_embedding_cache: Size of the cached embeddings of the images.
+    :type vision_embedding_cache: int
+)";
+
+auto prefix_cache_digest_docstring = R"(
+    Compact summary of the KV cache blocks kept by prefix caching of a pipeline, e.g. for a router to send a request to the replica
+    with the longest cached prefix of its prompt. The hashes of the blocks are kept in a bloom filter, which may report a block
+    not cached with a probability below 0.1%, but never misses a cached one.
+
+    :param block_size: Number of tokens per KV cache block of the pipeline.
+    :type block_size: int
+
+    :param num_blocks: Number of the hashes of the KV cache blocks added to the bloom filter.
+    :type num_blocks: int
+
+    :param bloom_filter: Bits of the bloom filter.
+    :type bloom_filter: list[int]
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -205,6 +443,241 @@ py::object __call_cb_generate(ContinuousBatchingPipeline& pipe,
     return results;
 }
 
+std::function<ov::genai::StreamingStatus(std::string)> get_text_streamer_callback(const pyutils::PyBindStreamerVariant& py_streamer) {
+    py::gil_scoped_acquire acquire;
+    ov::genai::StreamerVariant streamer = pyutils::pystreamer_to_streamer(py_streamer);
+    auto callback = std::get_if<std::function<ov::genai::StreamingStatus(std::string)>>(&streamer);
+    OPENVINO_ASSERT(callback, "Only callable streamers are supported by add_request()");
+    return *callback;
+}
+
+auto engine_step_output_docstring = R"(
+    New outputs of a request after a step of the engine loop of ContinuousBatchingPipeline.
+
+    :param request_id: Id of the request.
+    :type request_id: int
+
+    :param outputs: Tokens generated by the step by the sequence ids, the scores and the finish reasons are the latest ones.
+    :type outputs: dict[int, GenerationOutput]
+
+    :param status: Status of the request after the step, the request has finished unless it's RUNNING.
+    :type status: GenerationStatus
+)";
+
+auto async_engine_loop_docstring = R"(
+    Runs the engine loop of ContinuousBatchingPipeline for an asyncio event loop. The engine loop thread takes GIL
+    once per step to pass the new tokens of all the requests to the event loop, where they are dispatched to the
+    streams of the requests. Has to be created, used and stopped on the thread of the running event loop, and stopped
+    before the pipeline is released.
+
+    Example:
+        engine_loop = AsyncEngineLoop(pipe)
+        stream = engine_loop.add_request(0, prompt, generation_config)
+        async for token_ids in stream:
+            ...
+        engine_loop.stop()
+)";
+
+auto async_generation_stream_docstring = R"(
+    Asynchronous iterator over the tokens of a request of AsyncEngineLoop, each iteration yields the list of all the
+    tokens generated since the previous one. The iteration ends once the request has finished.
+)";
+
+// the tokens of a request of AsyncEngineLoop, accessed with GIL on the event loop thread only
+class AsyncGenerationStream {
+public:
+    AsyncGenerationStream(GenerationHandle handle, py::object loop) : m_handle(std::move(handle)), m_loop(std::move(loop)) {}
+
+    // returns the future of the next tokens, or raises StopAsyncIteration if the request has finished
+    py::object next() {
+        OPENVINO_ASSERT(!m_tokens.empty() || !m_is_closed, "AsyncEngineLoop has been stopped before the request has finished");
+        OPENVINO_ASSERT(m_waiter.is_none() || m_waiter.attr("done")().cast<bool>(), "AsyncGenerationStream can be awaited by a single consumer only");
+        if (m_tokens.empty() && m_status != GenerationStatus::RUNNING) {
+            PyErr_SetNone(PyExc_StopAsyncIteration);
+            throw py::error_already_set();
+        }
+        m_waiter = m_loop.attr("create_future")();
+        resolve();
+        return m_waiter;
+    }
+
+    void push(const ov::genai::EngineStepOutput& step_output) {
+        for (const auto& [sequence_id, output] : step_output.outputs) {
+            m_tokens.insert(m_tokens.end(), output.generated_ids.begin(), output.generated_ids.end());
+        }
+        m_status = step_output.status;
+        resolve();
+    }
+
+    // the engine loop is stopped, so the outputs aren't pushed anymore
+    void close() {
+        m_is_closed = true;
+        resolve();
+    }
+
+    bool is_finished() const {
+        return m_status != GenerationStatus::RUNNING;
+    }
+
+    GenerationStatus get_status() const {
+        return m_status;
+    }
+
+    const GenerationHandle& get_handle() const {
+        return m_handle;
+    }
+
+private:
+    // the tokens are kept for the next iteration if the waiter has been cancelled
+    void resolve() {
+        if (m_waiter.is_none() || m_waiter.attr("done")().cast<bool>()) {
+            return;
+        }
+        if (!m_tokens.empty()) {
+            m_waiter.attr("set_result")(py::cast(std::exchange(m_tokens, {})));
+        } else if (m_status != GenerationStatus::RUNNING) {
+            m_waiter.attr("set_exception")(py::reinterpret_borrow<py::object>(PyExc_StopAsyncIteration)());
+        } else if (m_is_closed) {
+            m_waiter.attr("set_exception")(py::reinterpret_borrow<py::object>(PyExc_RuntimeError)("AsyncEngineLoop has been stopped before the request has finished"));
+        }
+    }
+
+    GenerationHandle m_handle;
+    py::object m_loop;
+    py::object m_waiter = py::none();
+    std::vector<int64_t> m_tokens;
+    GenerationStatus m_status = GenerationStatus::RUNNING;
+    bool m_is_closed = false;
+};
+
+// passes the step outputs from the engine loop thread to the streams on the event loop thread
+class AsyncStepDispatcher : public std::enable_shared_from_this<AsyncStepDispatcher> {
+public:
+    explicit AsyncStepDispatcher(py::object loop) : m_loop(std::move(loop)) {}
+
+    // the last reference may be released by the engine loop without GIL
+    ~AsyncStepDispatcher() {
+        py::gil_scoped_acquire acquire;
+        m_streams.clear();
+        m_loop = py::object();
+    }
+
+    void add_stream(uint64_t request_id, std::shared_ptr<AsyncGenerationStream> stream) {
+        m_streams[request_id] = std::move(stream);
+    }
+
+    // called on the engine loop thread once per step
+    void post(const std::vector<ov::genai::EngineStepOutput>& outputs) {
+        auto batch = std::make_shared<std::vector<ov::genai::EngineStepOutput>>(outputs);
+        std::weak_ptr<AsyncStepDispatcher> weak_self = shared_from_this();
+        py::gil_scoped_acquire acquire;
+        try {
+            m_loop.attr("call_soon_threadsafe")(py::cpp_function([weak_self, batch] {
+                if (auto self = weak_self.lock()) {
+                    self->dispatch(*batch);
+                }
+            }));
+        } catch (py::error_already_set& e) {
+            // e.g. the event loop is closed before the engine loop is stopped
+            e.discard_as_unraisable("AsyncEngineLoop step dispatch");
+        }
+    }
+
+    // closes the streams of the non finished requests after the outputs posted before
+    void close() {
+        if (m_loop.attr("is_closed")().cast<bool>()) {
+            return;
+        }
+        // the dispatcher is kept alive for the streams to be closed even if AsyncEngineLoop is released
+        m_loop.attr("call_soon")(py::cpp_function([self = shared_from_this()] {
+            for (auto& [request_id, stream] : self->m_streams) {
+                stream->close();
+            }
+            self->m_streams.clear();
+        }));
+    }
+
+private:
+    void dispatch(const std::vector<ov::genai::EngineStepOutput>& outputs) {
+        for (const auto& step_output : outputs) {
+            auto it = m_streams.find(step_output.request_id);
+            if (it == m_streams.end()) {
+                continue;
+            }
+            it->second->push(step_output);
+            if (it->second->is_finished()) {
+                m_streams.erase(it);
+            }
+        }
+    }
+
+    py::object m_loop;
+    std::unordered_map<uint64_t, std::shared_ptr<AsyncGenerationStream>> m_streams;
+};
+
+class AsyncEngineLoop {
+public:
+    AsyncEngineLoop(ContinuousBatchingPipeline& pipe, const EngineLoopConfig& config) :
+            m_pipe(pipe), m_loop(py::module_::import("asyncio").attr("get_running_loop")()) {
+        m_dispatcher = std::make_shared<AsyncStepDispatcher>(m_loop);
+        std::weak_ptr<AsyncStepDispatcher> dispatcher = m_dispatcher;
+        py::gil_scoped_release release;
+        m_pipe.start_engine_loop(config, [dispatcher](const std::vector<ov::genai::EngineStepOutput>& outputs) {
+            if (auto self = dispatcher.lock()) {
+                self->post(outputs);
+            }
+        });
+    }
+
+    ~AsyncEngineLoop() {
+        try {
+            stop();
+        } catch (const std::exception&) {
+            // the exception of the engine loop is meant for an explicit stop()
+        }
+    }
+
+    template <typename Input>
+    std::shared_ptr<AsyncGenerationStream> add_request(uint64_t request_id, const Input& input, const ov::genai::GenerationConfig& generation_config) {
+        OPENVINO_ASSERT(!m_is_stopped, "AsyncEngineLoop is stopped");
+        OPENVINO_ASSERT(generation_config.num_return_sequences == 1 && (generation_config.is_greedy_decoding() || generation_config.is_multinomial()),
+            "Currently streaming is possible only for greedy or multinomial decoding with num_return_sequences=1");
+        OPENVINO_ASSERT(m_loop.is(py::module_::import("asyncio").attr("get_running_loop")()),
+            "AsyncEngineLoop.add_request() must be called on the thread of the event loop, for which AsyncEngineLoop was created");
+        GenerationHandle handle;
+        {
+            // blocks while the limits of the engine loop are reached
+            py::gil_scoped_release release;
+            handle = m_pipe.add_request(request_id, input, generation_config);
+        }
+        // the outputs are dispatched on this thread, so none of them have been missed
+        auto stream = std::make_shared<AsyncGenerationStream>(handle, m_loop);
+        m_dispatcher->add_stream(request_id, stream);
+        return stream;
+    }
+
+    void stop() {
+        if (m_is_stopped) {
+            return;
+        }
+        m_is_stopped = true;
+        try {
+            py::gil_scoped_release release;
+            m_pipe.stop_engine_loop();
+        } catch (...) {
+            m_dispatcher->close();
+            throw;
+        }
+        m_dispatcher->close();
+    }
+
+private:
+    ContinuousBatchingPipeline& m_pipe;
+    py::object m_loop;
+    std::shared_ptr<AsyncStepDispatcher> m_dispatcher;
+    bool m_is_stopped = false;
+};
+
 } // namespace
 
 void init_continuous_batching_pipeline(py::module_& m) {
@@ -215,6 +688,19 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .value("CANCEL", ov::genai::GenerationStatus::CANCEL)
         .value("STOP", ov::genai::GenerationStatus::STOP);
 
+    py::class_<RequestMetrics>(m, "RequestMetrics", request_metrics_docstring)
+        .def(py::init<>())
+        .def_readonly("queue_time", &RequestMetrics::queue_time)
+        .def_readonly("ttft", &RequestMetrics::ttft)
+        .def_readonly("prefill_time", &RequestMetrics::prefill_time)
+        .def_readonly("total_time", &RequestMetrics::total_time)
+        .def_readonly("num_prefill_chunks", &RequestMetrics::num_prefill_chunks)
+        .def_readonly("num_preemptions", &RequestMetrics::num_preemptions)
+        .def_readonly("preempted_time", &RequestMetrics::preempted_time)
+        .def_readonly("num_prefix_cache_hit_tokens", &RequestMetrics::num_prefix_cache_hit_tokens)
+        .def_readonly("num_draft_tokens", &RequestMetrics::num_draft_tokens)
+        .def_readonly("num_accepted_draft_tokens", &RequestMetrics::num_accepted_draft_tokens);
+
     py::class_<GenerationResult>(m, "GenerationResult", generation_result_docstring)
         .def(py::init<>())
         .def_readonly("m_request_id", &GenerationResult::m_request_id)
@@ -229,6 +715,7 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("m_status", &GenerationResult::m_status)
         .def_readonly("perf_metrics", &GenerationResult::perf_metrics)
         .def_readonly("extended_perf_metrics", &GenerationResult::extended_perf_metrics)
+        .def_readonly("request_metrics", &GenerationResult::request_metrics)
         .def("__repr__",
             [](const GenerationResult &r) -> py::str {
                 std::stringstream stream;
@@ -247,7 +734,8 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("m_generation_ids", &EncodedGenerationResult::m_generation_ids)
         .def_readwrite("m_scores", &EncodedGenerationResult::m_scores)
         .def_readonly("perf_metrics", &EncodedGenerationResult::perf_metrics)
-        .def_readonly("extended_perf_metrics", &EncodedGenerationResult::extended_perf_metrics);
+        .def_readonly("extended_perf_metrics", &EncodedGenerationResult::extended_perf_metrics)
+        .def_readonly("request_metrics", &EncodedGenerationResult::request_metrics);
 
     py::enum_<ov::genai::GenerationFinishReason>(m, "GenerationFinishReason")
         .value("NONE", ov::genai::GenerationFinishReason::NONE)
@@ -266,7 +754,8 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("stop", &GenerationHandleImpl::stop)
         .def("cancel", &GenerationHandleImpl::cancel)
         .def("read", &GenerationHandleImpl::read)
-        .def("read_all", &GenerationHandleImpl::read_all);
+        .def("read_all", &GenerationHandleImpl::read_all)
+        .def("get_request_metrics", &GenerationHandleImpl::get_request_metrics);
     OPENVINO_SUPPRESS_DEPRECATED_START
     generation_handle.def("drop", &GenerationHandleImpl::drop);
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -302,33 +791,88 @@ void init_continuous_batching_pipeline(py::module_& m) {
 			.value("XATTENTION", SparseAttentionMode::XATTENTION);
 
     py::class_<SparseAttentionConfig>(m, "SparseAttentionConfig", sparse_attention_config_docstring)
-            .def(py::init<>([](SparseAttentionMode mode, size_t num_last_dense_tokens_in_prefill, size_t num_retained_start_tokens_in_cache, size_t num_retained_recent_tokens_in_cache, float xattention_threshold, size_t xattention_block_size, size_t xattention_stride) {
+            .def(py::init<>([](SparseAttentionMode mode, size_t num_last_dense_tokens_in_prefill, size_t num_retained_start_tokens_in_cache, size_t num_retained_recent_tokens_in_cache, float xattention_threshold, size_t xattention_block_size, size_t xattention_stride, float decode_threshold, size_t decode_dense_interval) {
                  // somehow pybind cannot associate enum arg with a default value with its python counterpart,
                  // hence need to use arg_v instead of arg like everywhere else
-                return SparseAttentionConfig{mode, num_last_dense_tokens_in_prefill, num_retained_start_tokens_in_cache, num_retained_recent_tokens_in_cache, xattention_threshold, xattention_block_size, xattention_stride}; }),
+                return SparseAttentionConfig{mode, num_last_dense_tokens_in_prefill, num_retained_start_tokens_in_cache, num_retained_recent_tokens_in_cache, xattention_threshold, xattention_block_size, xattention_stride, decode_threshold, decode_dense_interval}; }),
                  py::arg_v("mode", SparseAttentionMode::TRISHAPE, "SparseAttentionMode.TRISHAPE"),
                  py::arg("num_last_dense_tokens_in_prefill") = 100,
                  py::arg("num_retained_start_tokens_in_cache") = 128,
                  py::arg("num_retained_recent_tokens_in_cache") = 1920,
                  py::arg("xattention_threshold") = 0.8,
                  py::arg("xattention_block_size") = 64,
-                 py::arg("xattention_stride") = 8)
+                 py::arg("xattention_stride") = 8,
+                 py::arg("decode_threshold") = 1.0,
+                 py::arg("decode_dense_interval") = 16)
             .def_readwrite("mode", &SparseAttentionConfig::mode)
             .def_readwrite("num_last_dense_tokens_in_prefill", &SparseAttentionConfig::num_last_dense_tokens_in_prefill)
             .def_readwrite("num_retained_start_tokens_in_cache", &SparseAttentionConfig::num_retained_start_tokens_in_cache)
             .def_readwrite("num_retained_recent_tokens_in_cache", &SparseAttentionConfig::num_retained_recent_tokens_in_cache)
             .def_readwrite("xattention_threshold", &SparseAttentionConfig::xattention_threshold)
             .def_readwrite("xattention_block_size", &SparseAttentionConfig::xattention_block_size)
-            .def_readwrite("xattention_stride", &SparseAttentionConfig::xattention_stride);
+            .def_readwrite("xattention_stride", &SparseAttentionConfig::xattention_stride)
+            .def_readwrite("decode_threshold", &SparseAttentionConfig::decode_threshold)
+            .def_readwrite("decode_dense_interval", &SparseAttentionConfig::decode_dense_interval);
+
+    py::enum_<KVCacheQuantizationMode>(m, "KVCacheQuantizationMode",
+                            R"(Represents the grouping of the quantized key cache values sharing a scale and a zero point
+                               :param KVCacheQuantizationMode.BY_TOKEN: The values of a token are grouped along the head size
+                               :param KVCacheQuantizationMode.BY_CHANNEL: The values of a channel are grouped along the tokens, which keeps the outlier channels of the keys from spoiling the quantization of the other channels of the token)")
+            .value("BY_TOKEN", KVCacheQuantizationMode::BY_TOKEN)
+            .value("BY_CHANNEL", KVCacheQuantizationMode::BY_CHANNEL);
+
+    py::class_<KVCachePrecisionConfig>(m, "KVCachePrecisionConfig", kv_cache_precision_config_docstring)
+            .def(py::init<>())
+            .def_readwrite("key_precisions", &KVCachePrecisionConfig::key_precisions)
+            .def_readwrite("value_precisions", &KVCachePrecisionConfig::value_precisions)
+            .def_readwrite("key_quantization_mode", &KVCachePrecisionConfig::key_quantization_mode)
+            .def_readwrite("key_group_size", &KVCachePrecisionConfig::key_group_size)
+            .def_readwrite("value_group_size", &KVCachePrecisionConfig::value_group_size);
+
+    m.def("calibrate_kv_cache_precisions", &ov::genai::calibrate_kv_cache_precisions,
+          py::arg("num_decoder_layers"), py::arg("num_kv_heads"), py::arg("head_size"), py::arg("num_tokens"), py::arg("budget_in_bytes"),
+          py::arg("num_f16_layers") = 1, calibrate_kv_cache_precisions_docstring);
+
+    py::enum_<SchedulingPolicy>(m, "SchedulingPolicy",
+                            R"(Represents the policy by which the scheduler orders the sequence groups competing for the batch and the KV cache
+                               :param SchedulingPolicy.FCFS: Sequence groups are served in order of arrival
+                               :param SchedulingPolicy.PRIORITY: Sequence groups with higher GenerationConfig.priority are served first and preempted last
+                               :param SchedulingPolicy.DEADLINE: Sequence groups waiting for their first token are served in order of their GenerationConfig.ttft_slo_ms deadline
+                               :param SchedulingPolicy.FAIR_SHARE: Sequence groups of tenants (GenerationConfig.tenant_id) which were served the least tokens so far are served first
+                               :param SchedulingPolicy.PREFIX_CACHE_AWARE: Sequence groups waiting for their first scheduling with the most prompt tokens restored from the prefix cache are served first, next to the groups sharing their first prompt block)")
+            .value("FCFS", SchedulingPolicy::FCFS)
+            .value("PRIORITY", SchedulingPolicy::PRIORITY)
+            .value("DEADLINE", SchedulingPolicy::DEADLINE)
+            .value("FAIR_SHARE", SchedulingPolicy::FAIR_SHARE)
+            .value("PREFIX_CACHE_AWARE", SchedulingPolicy::PREFIX_CACHE_AWARE);
+
+    py::enum_<StreamingTransport>(m, "StreamingTransport",
+                            R"(Represents the queue by which the outputs of a request are passed from the pipeline to its GenerationHandle
+                               :param StreamingTransport.SYNCHRONIZED_QUEUE: A queue guarded by a mutex, the reader is notified on each push
+                               :param StreamingTransport.SPSC_RING_BUFFER: A lock-free single-producer single-consumer ring buffer, the reader is notified only while it waits in GenerationHandle.read. The handle of a request must be read by a single thread)")
+            .value("SYNCHRONIZED_QUEUE", StreamingTransport::SYNCHRONIZED_QUEUE)
+            .value("SPSC_RING_BUFFER", StreamingTransport::SPSC_RING_BUFFER);
 
     py::class_<SchedulerConfig>(m, "SchedulerConfig", scheduler_config_docstring)
         .def(py::init<>())
         .def_readwrite("max_num_batched_tokens", &SchedulerConfig::max_num_batched_tokens)
         .def_readwrite("num_kv_blocks", &SchedulerConfig::num_kv_blocks)
         .def_readwrite("cache_size", &SchedulerConfig::cache_size)
+        .def_readwrite("kv_cache_memory_utilization", &SchedulerConfig::kv_cache_memory_utilization)
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
+        .def_readwrite("max_num_prefill_tokens_per_step", &SchedulerConfig::max_num_prefill_tokens_per_step)
+        .def_readwrite("max_prefill_fraction", &SchedulerConfig::max_prefill_fraction)
+        .def_readwrite("swap_space_size", &SchedulerConfig::swap_space_size)
+        .def_readwrite("swap_space_disk_size", &SchedulerConfig::swap_space_disk_size)
+        .def_readwrite("swap_space_path", &SchedulerConfig::swap_space_path)
+        .def_readwrite("scheduling_policy", &SchedulerConfig::scheduling_policy)
+        .def_readwrite("max_reordering_delay_ms", &SchedulerConfig::max_reordering_delay_ms)
+        .def_readwrite("streaming_transport", &SchedulerConfig::streaming_transport)
+        .def_readwrite("prompt_lookup_store_size", &SchedulerConfig::prompt_lookup_store_size)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("prefix_cache_path", &SchedulerConfig::prefix_cache_path)
+        .def_readwrite("kv_cache_precision_config", &SchedulerConfig::kv_cache_precision_config)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config)
         .def_readwrite("use_sparse_attention", &SchedulerConfig::use_sparse_attention)
@@ -338,9 +882,70 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def(py::init<>())
             .def_readonly("requests", &PipelineMetrics::requests)
             .def_readonly("scheduled_requests", &PipelineMetrics::scheduled_requests)
+            .def_readonly("scheduled_prompt_tokens", &PipelineMetrics::scheduled_prompt_tokens)
+            .def_readonly("scheduled_generate_tokens", &PipelineMetrics::scheduled_generate_tokens)
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
-            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
+            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage)
+            .def_readonly("prefix_cache_hit_rate", &PipelineMetrics::prefix_cache_hit_rate)
+            .def_readonly("max_prefix_cache_hit_depth", &PipelineMetrics::max_prefix_cache_hit_depth)
+            .def_readonly("peak_kv_cache_used_bytes", &PipelineMetrics::peak_kv_cache_used_bytes)
+            .def_readonly("peak_kv_cache_allocated_bytes", &PipelineMetrics::peak_kv_cache_allocated_bytes)
+            .def_readonly("peak_memory_bytes", &PipelineMetrics::peak_memory_bytes);
+
+    py::class_<MemoryReport>(m, "MemoryReport", memory_report_docstring)
+        .def(py::init<>())
+        .def_readonly("weights", &MemoryReport::weights)
+        .def_readonly("kv_cache_allocated", &MemoryReport::kv_cache_allocated)
+        .def_readonly("kv_cache_used", &MemoryReport::kv_cache_used)
+        .def_readonly("prefix_cache", &MemoryReport::prefix_cache)
+        .def_readonly("kv_cache_swap_space", &MemoryReport::kv_cache_swap_space)
+        .def_readonly("input_buffers", &MemoryReport::input_buffers)
+        .def_readonly("vision_embedding_cache", &MemoryReport::vision_embedding_cache)
+        .def("get_total_bytes", &MemoryReport::get_total_bytes);
+
+    py::class_<PrefixCacheDigest>(m, "PrefixCacheDigest", prefix_cache_digest_docstring)
+        .def(py::init<>())
+        .def(py::init<size_t, const std::vector<uint64_t>&>(), py::arg("block_size"), py::arg("block_hashes"))
+        .def_readonly("block_size", &PrefixCacheDigest::block_size)
+        .def_readonly("num_blocks", &PrefixCacheDigest::num_blocks)
+        .def_readonly("bloom_filter", &PrefixCacheDigest::bloom_filter)
+        .def_static("get_block_hashes", &PrefixCacheDigest::get_block_hashes, py::arg("token_ids"), py::arg("block_size"),
+            "Computes the hashes of the full KV cache blocks of a prompt the same way as the pipelines with this block size do.")
+        .def("contains", &PrefixCacheDigest::contains, py::arg("block_hash"))
+        .def("get_num_cached_blocks", &PrefixCacheDigest::get_num_cached_blocks, py::arg("block_hashes"),
+            "Returns the number of the leading blocks of the prompt with the block hashes likely kept by prefix caching.");
+
+    py::class_<HistogramSnapshot>(m, "HistogramSnapshot", histogram_snapshot_docstring)
+        .def(py::init<>())
+        .def_readonly("count", &HistogramSnapshot::count)
+        .def_readonly("sum", &HistogramSnapshot::sum)
+        .def_readonly("min", &HistogramSnapshot::min)
+        .def_readonly("max", &HistogramSnapshot::max)
+        .def_readonly("buckets", &HistogramSnapshot::buckets)
+        .def("get_percentile", &HistogramSnapshot::get_percentile, py::arg("percent"))
+        .def("get_mean", &HistogramSnapshot::get_mean);
+
+    py::class_<ServingMetrics>(m, "ServingMetrics", serving_metrics_docstring)
+        .def(py::init<>())
+        .def_readonly("ttft", &ServingMetrics::ttft)
+        .def_readonly("inter_token_latency", &ServingMetrics::inter_token_latency)
+        .def_readonly("queue_time", &ServingMetrics::queue_time)
+        .def_readonly("prefix_cache_hit_ratio", &ServingMetrics::prefix_cache_hit_ratio)
+        .def_readonly("cache_usage", &ServingMetrics::cache_usage)
+        .def_readonly("num_preemptions", &ServingMetrics::num_preemptions)
+        .def_readonly("num_finished_requests", &ServingMetrics::num_finished_requests)
+        .def("to_prometheus", &ServingMetrics::to_prometheus, py::arg("prefix") = "ov_genai");
+
+    py::class_<EngineLoopConfig>(m, "EngineLoopConfig", engine_loop_config_docstring)
+        .def(py::init<>())
+        .def_readwrite("max_num_requests", &EngineLoopConfig::max_num_requests)
+        .def_readwrite("max_cache_usage", &EngineLoopConfig::max_cache_usage);
+
+    py::class_<ov::genai::EngineStepOutput>(m, "EngineStepOutput", engine_step_output_docstring)
+        .def_readonly("request_id", &ov::genai::EngineStepOutput::request_id)
+        .def_readonly("outputs", &ov::genai::EngineStepOutput::outputs)
+        .def_readonly("status", &ov::genai::EngineStepOutput::status);
 
     py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
         .def(py::init([](const std::filesystem::path& models_path, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& llm_plugin_config, 
@@ -368,14 +973,61 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("get_tokenizer", &ContinuousBatchingPipeline::get_tokenizer)
         .def("get_config", &ContinuousBatchingPipeline::get_config)
         .def("get_metrics", &ContinuousBatchingPipeline::get_metrics)
-        .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"))
-        .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"))
-        .def("add_request", py::overload_cast<uint64_t, const std::string&, const std::vector<ov::Tensor>&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("images"), py::arg("generation_config"))
+        .def("get_serving_metrics", &ContinuousBatchingPipeline::get_serving_metrics)
+        .def("get_memory_report", &ContinuousBatchingPipeline::get_memory_report)
+        .def("export_kv_blocks", [](ContinuousBatchingPipeline& pipe, const ov::Tensor& input_ids) {
+                std::vector<uint8_t> kv_blocks;
+                {
+                    py::gil_scoped_release release;
+                    kv_blocks = pipe.export_kv_blocks(input_ids);
+                }
+                return py::bytes(reinterpret_cast<const char*>(kv_blocks.data()), kv_blocks.size());
+            },
+            py::arg("input_ids"),
+            "Exports the KV cache blocks of the processed prompt, to be imported by another pipeline with import_kv_blocks.")
+        .def("import_kv_blocks", [](ContinuousBatchingPipeline& pipe, const py::bytes& kv_blocks) {
+                std::string_view data = kv_blocks;
+                std::vector<uint8_t> blocks(data.begin(), data.end());
+                py::gil_scoped_release release;
+                return pipe.import_kv_blocks(blocks);
+            },
+            py::arg("kv_blocks"),
+            "Imports the KV cache blocks exported by export_kv_blocks into the prefix cache, returns the number of the imported blocks.")
+        .def("get_prefix_cache_digest", &ContinuousBatchingPipeline::get_prefix_cache_digest, py::call_guard<py::gil_scoped_release>(),
+            "Summarizes the KV cache blocks kept by prefix caching, e.g. to be published to a router balancing the requests between the replicas.")
+        .def("shrink_kv_cache", &ContinuousBatchingPipeline::shrink_kv_cache, py::call_guard<py::gil_scoped_release>(),
+            "Moves the KV cache blocks in use to the beginning of the KV cache and releases the free blocks after them, returns the number of the blocks left.")
+        // NB: add_request blocks while the engine loop is busy, and the engine loop thread needs GIL to call the completion callbacks
+        .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"), py::call_guard<py::gil_scoped_release>())
+        .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"), py::call_guard<py::gil_scoped_release>())
+        .def("add_request", py::overload_cast<uint64_t, const std::string&, const std::vector<ov::Tensor>&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("images"), py::arg("generation_config"), py::call_guard<py::gil_scoped_release>())
+        .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&, GenerationCompletionCallback>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"), py::arg("on_completion"), py::call_guard<py::gil_scoped_release>())
+        .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&, GenerationCompletionCallback>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"), py::arg("on_completion"), py::call_guard<py::gil_scoped_release>())
+        .def("add_request", [](ContinuousBatchingPipeline& pipe, uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& generation_config,
+                               const pyutils::PyBindStreamerVariant& streamer, GenerationCompletionCallback on_completion) {
+                return pipe.add_request(request_id, input_ids, generation_config, get_text_streamer_callback(streamer), std::move(on_completion));
+            },
+            py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"), py::arg("streamer"), py::arg("on_completion"), py::call_guard<py::gil_scoped_release>())
+        .def("add_request", [](ContinuousBatchingPipeline& pipe, uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& generation_config,
+                               const pyutils::PyBindStreamerVariant& streamer, GenerationCompletionCallback on_completion) {
+                return pipe.add_request(request_id, prompt, generation_config, get_text_streamer_callback(streamer), std::move(on_completion));
+            },
+            py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"), py::arg("streamer"), py::arg("on_completion"), py::call_guard<py::gil_scoped_release>())
         .def("step", &ContinuousBatchingPipeline::step)
         .def("has_non_finished_requests", &ContinuousBatchingPipeline::has_non_finished_requests)
+        .def("start_engine_loop", py::overload_cast<const EngineLoopConfig&>(&ContinuousBatchingPipeline::start_engine_loop), py::arg("config") = EngineLoopConfig{},
+             "Starts the background thread, which steps the pipeline while it has non finished requests. "
+             "stop_engine_loop() has to be called before the pipeline is released.")
+        .def("start_engine_loop", py::overload_cast<const EngineLoopConfig&, ov::genai::EngineStepCallback>(&ContinuousBatchingPipeline::start_engine_loop),
+             py::arg("config"), py::arg("on_step"),
+             "Starts the engine loop, which passes the new outputs of the requests added without callbacks to on_step after each step. "
+             "stop_engine_loop() has to be called before the pipeline is released.")
+        .def("stop_engine_loop", &ContinuousBatchingPipeline::stop_engine_loop, py::call_guard<py::gil_scoped_release>())
 
         .def("start_chat", &ContinuousBatchingPipeline::start_chat, py::arg("system_message") = "")
         .def("finish_chat", &ContinuousBatchingPipeline::finish_chat)
+        .def("warmup", &ContinuousBatchingPipeline::warmup, py::arg("config") = ov::genai::WarmupConfig(), py::call_guard<py::gil_scoped_release>(),
+             "Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.")
 
         .def(
             "generate",
@@ -441,5 +1093,45 @@ void init_continuous_batching_pipeline(py::module_& m) {
             py::arg("images"),
             py::arg("generation_config"),
             py::arg("streamer") = std::monostate{}
+        )
+
+        .def(
+            "generate",
+            [](ContinuousBatchingPipeline& pipe,
+               const std::vector<std::string>& prompts,
+               const std::vector<std::vector<ov::Tensor>>& images,
+               const std::vector<std::vector<ov::Tensor>>& videos,
+               const std::vector<ov::genai::GenerationConfig>& generation_config,
+               const pyutils::PyBindStreamerVariant& py_streamer
+            ) -> py::typing::Union<std::vector<ov::genai::GenerationResult>> {
+                ov::genai::StreamerVariant streamer = pyutils::pystreamer_to_streamer(py_streamer);
+                std::vector<ov::genai::VLMDecodedResults> generated_results;
+                {
+                    py::gil_scoped_release rel;
+                    generated_results = pipe.generate(prompts, images, videos, generation_config, streamer);
+                }  
+                return py::cast(generated_results);
+            },
+            py::arg("prompts"),
+            py::arg("images"),
+            py::arg("videos"),
+            py::arg("generation_config"),
+            py::arg("streamer") = std::monostate{}
         );
+
+    py::class_<AsyncGenerationStream, std::shared_ptr<AsyncGenerationStream>>(m, "AsyncGenerationStream", async_generation_stream_docstring)
+        .def("__aiter__", [](py::object self) { return self; })
+        .def("__anext__", &AsyncGenerationStream::next)
+        .def("get_status", &AsyncGenerationStream::get_status)
+        .def("stop", [](AsyncGenerationStream& stream) { stream.get_handle()->stop(); })
+        .def("cancel", [](AsyncGenerationStream& stream) { stream.get_handle()->cancel(); })
+        .def("get_request_metrics", [](AsyncGenerationStream& stream) { return stream.get_handle()->get_request_metrics(); });
+
+    py::class_<AsyncEngineLoop>(m, "AsyncEngineLoop", async_engine_loop_docstring)
+        .def(py::init<ContinuousBatchingPipeline&, const EngineLoopConfig&>(), py::arg("pipeline"), py::arg("config") = EngineLoopConfig{}, py::keep_alive<1, 2>())
+        .def("add_request", &AsyncEngineLoop::add_request<ov::Tensor>, py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"))
+        .def("add_request", &AsyncEngineLoop::add_request<std::string>, py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"))
+        .def("stop", &AsyncEngineLoop::stop,
+             "Stops the engine loop after the current step, the streams of the non finished requests aren't resumed then. "
+             "Rethrows the exception thrown by a step of the engine loop, if any.");
 }
@@ -8,6 +8,7 @@
 #include <pybind11/stl/filesystem.h>
 #include <pybind11/functional.h>
 
+#include "openvino/genai/warmup_config.hpp"
 #include "py_utils.hpp"
 
 namespace py = pybind11;
@@ -18,6 +19,7 @@ using ov::genai::StructuralTagItem;
 using ov::genai::StructuralTagsConfig;
 using ov::genai::StructuredOutputConfig;
 using ov::genai::GenerationConfig;
+using ov::genai::WarmupConfig;
 
 namespace {
 
@@ -95,6 +97,7 @@ char generation_config_docstring[] = R"(
     logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                     Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
     apply_chat_template: whether to apply chat_template for non-chat scenarios
+    token_healing: if set to true, the last prompt token is removed and the first generated token has to start with its text.
 
     repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
     presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -121,6 +124,25 @@ char generation_config_docstring[] = R"(
     top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
     do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
     num_return_sequences: the number of sequences to generate from a single prompt.
+    best_of:            the number of sequences to sample from a single prompt, of which num_return_sequences with the highest cumulative log probability are returned. 0 means num_return_sequences.
+
+    Scheduling parameters (used by ContinuousBatchingPipeline depending on SchedulerConfig.scheduling_policy):
+    priority:           priority of the request for SchedulingPolicy.PRIORITY. Requests with higher priority are scheduled first and preempted last.
+    ttft_slo_ms:        time-to-first-token objective of the request in milliseconds for SchedulingPolicy.DEADLINE. 0 means no objective.
+    tenant_id:          identifier of the tenant the request belongs to for SchedulingPolicy.FAIR_SHARE.
+    deadline_ms:        time in milliseconds since the request is added to ContinuousBatchingPipeline, after which the request is cancelled and its KV cache is released. 0 means no deadline.
+)";
+
+auto warmup_config_docstring = R"(
+    Structure to keep the shapes run by warmup() of the pipelines, so that the kernels for them are compiled
+    before the first real requests. A dummy prompt is generated for each combination of a length and a batch size.
+
+    prompt_lengths: lengths of the dummy prompts in tokens, ignored by WhisperPipeline and Text2ImagePipeline.
+    batch_sizes:    numbers of the prompts generated together, the numbers of images per prompt for Text2ImagePipeline,
+                    ignored by VLMPipeline and WhisperPipeline.
+    max_new_tokens: number of the tokens generated for each prompt.
+    image_size:     side of a square dummy image passed with each prompt to VLMPipeline, 0 for text-only prompts;
+                    side of the images generated by Text2ImagePipeline, 0 for the size of its generation config.
 )";
 
 void init_generation_config(py::module_& m) {
@@ -180,6 +202,31 @@ void init_generation_config(py::module_& m) {
             }
         );
 
+    py::class_<WarmupConfig>(m, "WarmupConfig", warmup_config_docstring)
+        .def(py::init<>())
+        .def(py::init([](py::kwargs kwargs) {
+            WarmupConfig config;
+            for (const auto& [key, value] : kwargs) {
+                const std::string name = key.cast<std::string>();
+                if (name == "prompt_lengths") {
+                    config.prompt_lengths = value.cast<std::vector<size_t>>();
+                } else if (name == "batch_sizes") {
+                    config.batch_sizes = value.cast<std::vector<size_t>>();
+                } else if (name == "max_new_tokens") {
+                    config.max_new_tokens = value.cast<size_t>();
+                } else if (name == "image_size") {
+                    config.image_size = value.cast<size_t>();
+                } else {
+                    OPENVINO_THROW("Unknown WarmupConfig field: ", name);
+                }
+            }
+            return config;
+        }))
+        .def_readwrite("prompt_lengths", &WarmupConfig::prompt_lengths)
+        .def_readwrite("batch_sizes", &WarmupConfig::batch_sizes)
+        .def_readwrite("max_new_tokens", &WarmupConfig::max_new_tokens)
+        .def_readwrite("image_size", &WarmupConfig::image_size);
+
      // Binding for GenerationConfig
     py::class_<GenerationConfig>(m, "GenerationConfig", generation_config_docstring)
         .def(py::init<std::filesystem::path>(), py::arg("json_path"), "path where generation_config.json is stored")
@@ -199,6 +246,7 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("top_p", &GenerationConfig::top_p)
         .def_readwrite("top_k", &GenerationConfig::top_k)
         .def_readwrite("do_sample", &GenerationConfig::do_sample)
+        .def_readwrite("best_of", &GenerationConfig::best_of)
         .def_readwrite("repetition_penalty", &GenerationConfig::repetition_penalty)
         .def_readwrite("eos_token_id", &GenerationConfig::eos_token_id)
         .def_readwrite("presence_penalty", &GenerationConfig::presence_penalty)
@@ -215,6 +263,11 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("structured_output_config", &GenerationConfig::structured_output_config)
         .def_readwrite("adapters", &GenerationConfig::adapters)
         .def_readwrite("apply_chat_template", &GenerationConfig::apply_chat_template)
+        .def_readwrite("token_healing", &GenerationConfig::token_healing)
+        .def_readwrite("priority", &GenerationConfig::priority)
+        .def_readwrite("ttft_slo_ms", &GenerationConfig::ttft_slo_ms)
+        .def_readwrite("tenant_id", &GenerationConfig::tenant_id)
+        .def_readwrite("deadline_ms", &GenerationConfig::deadline_ms)
         .def("set_eos_token_id", &GenerationConfig::set_eos_token_id, py::arg("tokenizer_eos_token_id"))
         .def("is_beam_search", &GenerationConfig::is_beam_search)
         .def("is_greedy_decoding", &GenerationConfig::is_greedy_decoding)
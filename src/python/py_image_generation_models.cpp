@@ -244,13 +244,39 @@ void init_unet2d_condition_model(py::module_& m) {
     unet2d_condition_model.def("get_config", &ov::genai::UNet2DConditionModel::get_config)
         .def("reshape", &ov::genai::UNet2DConditionModel::reshape, py::arg("batch_size"), py::arg("height"), py::arg("width"), py::arg("tokenizer_model_max_length"))
         .def("set_adapters", &ov::genai::UNet2DConditionModel::set_adapters, py::arg("adapters"))
+        .def("set_adapters_per_row", &ov::genai::UNet2DConditionModel::set_adapters_per_row, py::arg("row_adapters"),
+            R"(
+            Applies a separate LoRA adapter config to each row of the batch of the next inference. The adapters must be passed
+            to compile() with AdapterConfig.Mode.MODE_POOL, the configs may refer to those adapters only.
+            row_adapters (list[AdapterConfig]): adapter configs of the rows of the model batch, including the rows of classifier-free guidance.
+        )")
         .def("infer", 
-            &ov::genai::UNet2DConditionModel::infer, 
+            py::overload_cast<ov::Tensor, ov::Tensor>(&ov::genai::UNet2DConditionModel::infer), 
             py::call_guard<py::gil_scoped_release>(),
             py::arg("sample"), 
             py::arg("timestep"))
+        .def("infer", 
+            py::overload_cast<ov::Tensor, ov::Tensor, float>(&ov::genai::UNet2DConditionModel::infer), 
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("sample"), 
+            py::arg("timestep"),
+            py::arg("guidance_scale"),
+            R"(
+            Infers the model with classifier-free guidance: the sample is repeated for the unconditional and text encoder hidden states
+            and the noise predictions are combined within the model when possible.
+            sample (openvino.Tensor): latents with the batch of the images, not repeated for the guidance.
+            timestep (openvino.Tensor): current timestep.
+            guidance_scale (float): guidance scale.
+        )")
         .def("set_hidden_states", &ov::genai::UNet2DConditionModel::set_hidden_states, py::arg("tensor_name"), py::arg("encoder_hidden_states"))
         .def("do_classifier_free_guidance", &ov::genai::UNet2DConditionModel::do_classifier_free_guidance, py::arg("guidance_scale"))
+        .def("supports_feature_reuse", &ov::genai::UNet2DConditionModel::supports_feature_reuse)
+        .def("set_feature_reuse", &ov::genai::UNet2DConditionModel::set_feature_reuse, py::arg("reuse_features"),
+            R"(
+            Enables or disables feature reuse for the next infer() calls: only the shallow blocks of the model are inferred,
+            while the deep features are taken from the last inference with disabled feature reuse.
+            reuse_features (bool): whether to reuse the deep features.
+        )")
         .def(
             "compile",
             [](ov::genai::UNet2DConditionModel& self,
@@ -318,10 +344,23 @@ void init_sd3_transformer_2d_model(py::module_& m) {
     sd3_transformer_2d_model.def("get_config", &ov::genai::SD3Transformer2DModel::get_config)
         .def("reshape", &ov::genai::SD3Transformer2DModel::reshape, py::arg("batch_size"), py::arg("height"), py::arg("width"), py::arg("tokenizer_model_max_length"))
         .def("infer", 
-            &ov::genai::SD3Transformer2DModel::infer, 
+            py::overload_cast<const ov::Tensor, const ov::Tensor>(&ov::genai::SD3Transformer2DModel::infer), 
             py::call_guard<py::gil_scoped_release>(),
             py::arg("latent"), 
             py::arg("timestep"))
+        .def("infer", 
+            py::overload_cast<const ov::Tensor, const ov::Tensor, float>(&ov::genai::SD3Transformer2DModel::infer), 
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("latent"), 
+            py::arg("timestep"),
+            py::arg("guidance_scale"),
+            R"(
+            Infers the model with classifier-free guidance: the latent is repeated for the unconditional and text encoder hidden states
+            and the noise predictions are combined within the model when possible.
+            latent (openvino.Tensor): latents with the batch of the images, not repeated for the guidance.
+            timestep (openvino.Tensor): current timestep.
+            guidance_scale (float): guidance scale.
+        )")
         .def("set_hidden_states", &ov::genai::SD3Transformer2DModel::set_hidden_states, py::arg("tensor_name"), py::arg("encoder_hidden_states"))
         .def(
             "compile",
@@ -508,6 +547,13 @@ void init_autoencoder_kl(py::module_& m) {
                 device (str): Device to run the model on (e.g., CPU, GPU).
                 kwargs: Device properties.
             )")
+        .def("enable_tiling", &ov::genai::AutoencoderKL::enable_tiling, py::arg("tile_sample_size") = 0,
+            R"(
+            Enables tiled decoding and encoding: the images, which are larger than the tile, are processed by overlapping tiles,
+            which are blended, so the peak memory is bounded by the tile size.
+            tile_sample_size (int): tile size in pixels, 0 selects it from the memory of the GPU device or uses 512 for other devices.
+        )")
+        .def("disable_tiling", &ov::genai::AutoencoderKL::disable_tiling)
         .def("decode", &ov::genai::AutoencoderKL::decode, py::call_guard<py::gil_scoped_release>(), py::arg("latent"))
         .def("encode", &ov::genai::AutoencoderKL::encode, py::call_guard<py::gil_scoped_release>(), py::arg("image"), py::arg("generator"))
         .def("get_config", &ov::genai::AutoencoderKL::get_config)
@@ -54,7 +54,9 @@ auto text2image_generate_docstring = R"(
     generator: openvino_genai.TorchGenerator, openvino_genai.CppStdGenerator or class inherited from openvino_genai.Generator - random generator,
     adapters: LoRA adapters,
     strength: strength for image to image generation. 1.0f means initial image is fully noised,
-    max_sequence_length: int - length of t5_encoder_model input
+    max_sequence_length: int - length of t5_encoder_model input,
+    feature_reuse_interval: int - number of steps between the inferences of the deep UNet blocks (DeepCache), 1 disables feature reuse,
+    mask_crop_padding: int - inpainting denoises only the bounding box of the mask padded by this number of pixels, -1 denoises the whole image
 
     :return: ov.Tensor with resulting images
     :rtype: ov.Tensor
@@ -103,6 +105,9 @@ auto image_generation_perf_metrics_docstring = R"(
     :param get_load_time: Returns the load time in milliseconds.
     :type get_load_time: float
 
+    :param get_model_load_times: Returns a map with the load time of each model in milliseconds.
+    :type get_model_load_times: dict[str, float]
+
     :param get_generate_duration: Returns the generate duration in milliseconds.
     :type get_generate_duration: float
 
@@ -312,6 +317,8 @@ void init_image_generation_pipelines(py::module_& m) {
         .def_readwrite("adapters", &ov::genai::ImageGenerationConfig::adapters)
         .def_readwrite("strength", &ov::genai::ImageGenerationConfig::strength)
         .def_readwrite("max_sequence_length", &ov::genai::ImageGenerationConfig::max_sequence_length)
+        .def_readwrite("feature_reuse_interval", &ov::genai::ImageGenerationConfig::feature_reuse_interval)
+        .def_readwrite("mask_crop_padding", &ov::genai::ImageGenerationConfig::mask_crop_padding)
         .def("validate", &ov::genai::ImageGenerationConfig::validate)
         .def("update_generation_config", [](
             ov::genai::ImageGenerationConfig& config,
@@ -338,6 +345,7 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("get_vae_encoder_infer_duration", &ImageGenerationPerfMetrics::get_vae_encoder_infer_duration)
         .def("get_vae_decoder_infer_duration", &ImageGenerationPerfMetrics::get_vae_decoder_infer_duration)
         .def("get_load_time", &ImageGenerationPerfMetrics::get_load_time)
+        .def("get_model_load_times", &ImageGenerationPerfMetrics::get_model_load_times)
         .def("get_generate_duration", &ImageGenerationPerfMetrics::get_generate_duration)
         .def("get_first_and_other_iter_duration",
              [](ImageGenerationPerfMetrics& self) -> py::tuple {
@@ -361,6 +369,13 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("get_unet_infer_duration", &ImageGenerationPerfMetrics::get_unet_infer_duration)
         .def_readonly("raw_metrics", &ImageGenerationPerfMetrics::raw_metrics);
 
+    py::class_<ov::genai::ImageGenerationHandleImpl, std::shared_ptr<ov::genai::ImageGenerationHandleImpl>>(m, "ImageGenerationHandle", "Handle of a request added by Text2ImagePipeline.add_request().")
+        .def("get_status", &ov::genai::ImageGenerationHandleImpl::get_status)
+        .def("cancel", &ov::genai::ImageGenerationHandleImpl::cancel)
+        .def("wait", &ov::genai::ImageGenerationHandleImpl::wait, py::call_guard<py::gil_scoped_release>(),
+            "Blocks until the request is finished or cancelled.")
+        .def("get_image", &ov::genai::ImageGenerationHandleImpl::get_image);
+
     auto text2image_pipeline = py::class_<ov::genai::Text2ImagePipeline>(m, "Text2ImagePipeline", "This class is used for generation with text-to-image models.")
         .def(py::init([](const std::filesystem::path& models_path) {
             ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
@@ -389,6 +404,8 @@ void init_image_generation_pipelines(py::module_& m) {
         )")
         .def("get_generation_config", &ov::genai::Text2ImagePipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &ov::genai::Text2ImagePipeline::set_generation_config, py::arg("config"))
+        .def("warmup", &ov::genai::Text2ImagePipeline::warmup, py::arg("config") = ov::genai::WarmupConfig(), py::call_guard<py::gil_scoped_release>(),
+             "Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.")
         .def("set_scheduler", &ov::genai::Text2ImagePipeline::set_scheduler, py::arg("scheduler"))
         .def("reshape", &ov::genai::Text2ImagePipeline::reshape, py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
         .def_static("stable_diffusion", &ov::genai::Text2ImagePipeline::stable_diffusion, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
@@ -464,6 +481,47 @@ void init_image_generation_pipelines(py::module_& m) {
             },
             py::arg("prompt"), "Input string",
             (text2image_generate_docstring + std::string(" \n ")).c_str())
+        .def(
+            "add_request",
+            [](ov::genai::Text2ImagePipeline& pipe,
+                const std::string& prompt,
+                const py::kwargs& kwargs
+            ) {
+                ov::AnyMap params = pyutils::kwargs_to_any_map(kwargs);
+                // TorchGenerator stores python object, while the requests are denoised by 'step()' without GIL
+                OPENVINO_ASSERT(!params_have_torch_generator(params), "TorchGenerator is not supported by add_request()");
+                return pipe.add_request(prompt, params);
+            },
+            py::arg("prompt"), "Input string",
+            R"(
+                Adds a request to the batching engine of the pipeline. The requests are denoised together by step() calls.
+                prompt (str): Input string.
+                kwargs: Image generation parameters, 'callback' is called after each denoising step of the request.
+                :return: Handle to get the status and the images of the request.
+                :rtype: ImageGenerationHandle
+            )")
+        .def("step", &ov::genai::Text2ImagePipeline::step, py::call_guard<py::gil_scoped_release>(),
+            "Performs a denoising step of the requests added by add_request().")
+        .def("has_non_finished_requests", &ov::genai::Text2ImagePipeline::has_non_finished_requests)
+        .def(
+            "generate_async",
+            [](ov::genai::Text2ImagePipeline& pipe,
+                const std::string& prompt,
+                const py::kwargs& kwargs
+            ) {
+                ov::AnyMap params = pyutils::kwargs_to_any_map(kwargs);
+                // TorchGenerator stores python object, while the requests are denoised in background without GIL
+                OPENVINO_ASSERT(!params_have_torch_generator(params), "TorchGenerator is not supported by generate_async()");
+                return pipe.generate_async(prompt, params);
+            },
+            py::arg("prompt"), "Input string",
+            R"(
+                Queues a request to the staged executor, which overlaps text encoding, denoising and VAE decoding of the queued requests.
+                prompt (str): Input string.
+                kwargs: Image generation parameters, 'callback' is called from the denoising thread after each step.
+                :return: Handle to wait for the request and get its images.
+                :rtype: ImageGenerationHandle
+            )")
         .def("decode", &ov::genai::Text2ImagePipeline::decode, py::arg("latent"))
         .def("get_performance_metrics", &ov::genai::Text2ImagePipeline::get_performance_metrics);
 
@@ -235,8 +235,12 @@ void init_llm_pipeline(py::module_& m) {
         .def("get_tokenizer", &LLMPipeline::get_tokenizer)
         .def("start_chat", &LLMPipeline::start_chat, py::arg("system_message") = "")
         .def("finish_chat", &LLMPipeline::finish_chat)
+        .def("suspend_chat", &LLMPipeline::suspend_chat, py::arg("session_id"))
+        .def("resume_chat", &LLMPipeline::resume_chat, py::arg("session_id"))
         .def("get_generation_config", &LLMPipeline::get_generation_config, py::return_value_policy::copy)
-        .def("set_generation_config", &LLMPipeline::set_generation_config, py::arg("config"));
+        .def("set_generation_config", &LLMPipeline::set_generation_config, py::arg("config"))
+        .def("warmup", &LLMPipeline::warmup, py::arg("config") = ov::genai::WarmupConfig(), py::call_guard<py::gil_scoped_release>(),
+             "Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.");
 
     m.def("draft_model", [](
             const std::filesystem::path& models_path,
@@ -48,7 +48,8 @@ void init_lora_adapter(py::module_& m) {
         .value("MODE_DYNAMIC", ov::genai::AdapterConfig::Mode::MODE_DYNAMIC)
         .value("MODE_STATIC_RANK", ov::genai::AdapterConfig::Mode::MODE_STATIC_RANK)
         .value("MODE_STATIC", ov::genai::AdapterConfig::Mode::MODE_STATIC)
-        .value("MODE_FUSE", ov::genai::AdapterConfig::Mode::MODE_FUSE);
+        .value("MODE_FUSE", ov::genai::AdapterConfig::Mode::MODE_FUSE)
+        .value("MODE_POOL", ov::genai::AdapterConfig::Mode::MODE_POOL);
 
     adapter_config.def(py::init([](
          ov::genai::AdapterConfig::Mode mode) {
@@ -103,5 +104,10 @@ void init_lora_adapter(py::module_& m) {
     adapter_config.def("add", static_cast<ov::genai::AdapterConfig& (ov::genai::AdapterConfig::*)(const ov::genai::Adapter&, float)>(&ov::genai::AdapterConfig::add), py::arg("adapter"), py::arg("alpha"));
     adapter_config.def("add", static_cast<ov::genai::AdapterConfig& (ov::genai::AdapterConfig::*)(const ov::genai::Adapter&)>(&ov::genai::AdapterConfig::add), py::arg("adapter"));
     adapter_config.def("get_adapters_and_alphas", &ov::genai::AdapterConfig::get_adapters_and_alphas);
+    adapter_config.def_property("cache_size", &ov::genai::AdapterConfig::get_cache_size, &ov::genai::AdapterConfig::set_cache_size,
+        "Size in bytes of the host memory cache of the LoRA state tensors prepared for the recently used adapters, 0 disables the cache.");
+    adapter_config.def_property("max_rank", &ov::genai::AdapterConfig::get_max_rank, &ov::genai::AdapterConfig::set_max_rank,
+        "Maximum total rank of the adapters applied to a layer in MODE_STATIC_RANK. The static rank is rounded up to a power of 2, "
+        "not less than 8, and the adapters of a lower rank are padded with zeros.");
     adapter_config.def("set_adapters_and_alphas", &ov::genai::AdapterConfig::set_adapters_and_alphas, py::arg("adapters"));
 }
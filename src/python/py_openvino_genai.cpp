@@ -10,6 +10,7 @@
 #include <pybind11/functional.h>
 #include <pybind11/typing.h>
 
+#include "openvino/genai/compiled_model_cache.hpp"
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/text_streamer.hpp"
 #include "openvino/genai/version.hpp"
@@ -86,6 +87,13 @@ PYBIND11_MODULE(py_openvino_genai, m) {
         return get_version().buildNumber;
     }, get_version().description);
 
+    m.def("set_compiled_model_cache_dir", &ov::genai::set_compiled_model_cache_dir, py::arg("cache_dir"),
+          "Enables the caching of the compiled models in the directory for every model compiled by the library after the call, "
+          "unless a pipeline sets its own CACHE_DIR. An empty path disables caching. "
+          "The default directory is taken from the OPENVINO_GENAI_CACHE_DIR environment variable.");
+    m.def("get_compiled_model_cache_dir", &ov::genai::get_compiled_model_cache_dir,
+          "Returns the directory of the compiled models cache, empty if the caching is disabled.");
+
     init_perf_metrics(m);
 
     py::class_<DecodedResults>(m, "DecodedResults", decoded_results_docstring)
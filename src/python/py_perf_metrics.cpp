@@ -83,6 +83,9 @@ auto perf_metrics_docstring = R"(
     :param get_load_time: Returns the load time in milliseconds.
     :type get_load_time: float
 
+    :param get_model_load_times: Returns a map with the load time of each model of the pipeline in milliseconds.
+    :type get_model_load_times: dict[str, float]
+
     :param get_num_generated_tokens: Returns the number of generated tokens.
     :type get_num_generated_tokens: int
 
@@ -210,6 +213,7 @@ void init_perf_metrics(py::module_& m) {
     py::class_<PerfMetrics>(m, "PerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
         .def("get_load_time", &PerfMetrics::get_load_time)
+        .def("get_model_load_times", &PerfMetrics::get_model_load_times)
         .def("get_grammar_compiler_init_times", &PerfMetrics::get_grammar_compiler_init_times)
         .def("get_grammar_compile_time", &PerfMetrics::get_grammar_compile_time)
         .def("get_num_generated_tokens", &PerfMetrics::get_num_generated_tokens)
@@ -229,6 +233,7 @@ void init_perf_metrics(py::module_& m) {
     py::class_<ExtendedPerfMetrics, std::shared_ptr<ExtendedPerfMetrics>>(m, "ExtendedPerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
         .def("get_load_time", &ExtendedPerfMetrics::get_load_time)
+        .def("get_model_load_times", &ExtendedPerfMetrics::get_model_load_times)
         .def("get_num_generated_tokens", &ExtendedPerfMetrics::get_num_generated_tokens)
         .def("get_num_input_tokens", &ExtendedPerfMetrics::get_num_input_tokens)
         .def("get_ttft", &ExtendedPerfMetrics::get_ttft)
@@ -9,6 +9,7 @@
 
 #include "openvino/genai/rag/text_embedding_pipeline.hpp"
 #include "openvino/genai/rag/text_rerank_pipeline.hpp"
+#include "openvino/genai/rag/vector_index.hpp"
 #include "py_utils.hpp"
 #include "tokenizer/tokenizers_path.hpp"
 
@@ -17,6 +18,7 @@ using ov::genai::EmbeddingResult;
 using ov::genai::EmbeddingResults;
 using ov::genai::TextEmbeddingPipeline;
 using ov::genai::TextRerankPipeline;
+using ov::genai::VectorIndex;
 
 namespace pyutils = ov::genai::pybind::utils;
 
@@ -29,12 +31,34 @@ Attributes:
         Maximum length of tokens passed to the embedding model.
     pooling_type (TextEmbeddingPipeline.PoolingType, optional):
         Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
+    embedding_size (int, optional):
+        Number of the first dimensions of the pooled embeddings kept in the results, so Matryoshka models return
+        shorter embeddings. The truncated embeddings are normalized if the normalization is enabled.
+        If not set, all the dimensions are kept.
     normalize (bool, optional):
         If True, L2 normalization is applied to embeddings. Defaults to True.
+    embedding_precision (TextEmbeddingPipeline.EmbeddingPrecision, optional):
+        Precision of embeddings, the quantization is done by the model. INT8 and UINT8 require the normalization.
+        Defaults to EmbeddingPrecision.F32.
     query_instruction (str, optional):
         Instruction to use for embedding a query.
     embed_instruction (str, optional):
         Instruction to use for embedding a document.
+    max_batch_tokens (int, optional):
+        Maximum number of tokens of a batch passed to the embedding model, including the padding. The texts are sorted by
+        length and split into batches, which are inferred by all the infer requests of the compiled model.
+        If not set, all the texts are embedded by a single batch.
+    pack_sequences (bool, optional):
+        If True, several texts are concatenated into a row of the batch instead of padding each text to the longest one.
+        The texts of a row attend to themselves only and are pooled separately. Requires the model with
+        ScaledDotProductAttention operations and the position embeddings. Defaults to False.
+    window_length (int, optional):
+        If set, the texts longer than window_length tokens are split into the overlapping windows of window_length tokens
+        instead of being truncated by max_length. embed_documents() and embed_query() pool the window embeddings of a
+        text by the mean weighted by the number of the new tokens of each window, embed_document_windows() returns the
+        embeddings of the windows. Requires EmbeddingPrecision.F32.
+    window_overlap (int, optional):
+        Number of the tokens shared by the consecutive windows of a text. Defaults to 0.
 )";
 
 const auto text_reranking_config_docstring = R"(
@@ -44,27 +68,92 @@ Attributes:
         Number of documents to return sorted by score.
     max_length (int, optional):
         Maximum length of tokens passed to the embedding model.
+    max_batch_tokens (int, optional):
+        Maximum number of tokens of a batch passed to the rerank model, including the padding. The query-text pairs are
+        sorted by length and split into batches, which are inferred by all the infer requests of the compiled model.
+        If not set, all the pairs are scored by a single batch.
+    score_cache_size (int, optional):
+        Maximum number of the cached scores of query-text pairs, the least recently used scores are evicted.
+        The cached pairs aren't passed to the rerank model. 0 disables the cache. Defaults to 0.
+)";
+
+const auto vector_index_config_docstring = R"(
+Structure to keep VectorIndex configuration parameters.
+
+Attributes:
+    metric (VectorIndex.Metric, optional):
+        Distance between the embeddings. Defaults to Metric.COSINE.
+    storage (VectorIndex.Storage, optional):
+        Storage of the embeddings. Defaults to Storage.F32.
+    max_neighbors (int, optional):
+        Maximum number of neighbors of a node on the upper levels of the graph, the bottom level has twice as many.
+        Larger values improve the recall at the cost of memory and the build time. Defaults to 16.
+    ef_construction (int, optional):
+        Number of the candidates considered for the neighbors of an added embedding. Defaults to 200.
+    ef_search (int, optional):
+        Number of the candidates considered by a search, it's increased to the number of the requested results.
+        Defaults to 64.
 )";
 
 }  // namespace
 
 void init_rag_pipelines(py::module_& m) {
     auto text_embedding_pipeline =
-        py::class_<TextEmbeddingPipeline>(m, "TextEmbeddingPipeline", "Text embedding pipeline")
+        py::class_<TextEmbeddingPipeline, std::shared_ptr<TextEmbeddingPipeline>>(m, "TextEmbeddingPipeline", "Text embedding pipeline")
             .def(
                 "embed_documents",
                 [](TextEmbeddingPipeline& pipe,
-                   std::vector<std::string>& texts) -> py::typing::Union<EmbeddingResults> {
+                   std::vector<std::string>& texts) -> py::array {
                     EmbeddingResults res;
                     {
                         py::gil_scoped_release rel;
                         res = pipe.embed_documents(texts);
                     }
-                    return py::cast(res);
+                    return pyutils::embeddings_to_array(std::move(res));
                 },
                 py::arg("texts"),
                 "List of texts ",
                 "Computes embeddings for a vector of texts")
+            .def(
+                "embed_documents",
+                [](TextEmbeddingPipeline& pipe,
+                   const py::iterable& documents,
+                   ov::Tensor& embeddings,
+                   size_t chunk_size) -> size_t {
+                    py::iterator it = py::iter(documents);
+                    auto next_document = [&it]() -> std::optional<std::string> {
+                        py::gil_scoped_acquire acquire;
+                        if (it == py::iterator::sentinel()) {
+                            return std::nullopt;
+                        }
+                        std::string document = it->cast<std::string>();
+                        ++it;
+                        return document;
+                    };
+
+                    py::gil_scoped_release rel;
+                    return pipe.embed_documents(next_document, embeddings, chunk_size);
+                },
+                py::arg("documents"),
+                "Iterable of texts",
+                py::arg("embeddings"),
+                "Tensor of [max_num_documents, embedding_size] shape and the element type of the embedding precision",
+                py::arg("chunk_size") = 1024,
+                "Number of documents embedded at once",
+                R"(
+Computes embeddings for the documents pulled from an iterable by chunks and writes them to the rows of a caller provided
+tensor, which can share the memory of a memory mapped numpy array. No more documents are pulled when the tensor is full.
+Returns the number of the embedded documents.
+)")
+            .def(
+                "embed_document_windows",
+                [](TextEmbeddingPipeline& pipe, std::vector<std::string>& texts) {
+                    py::gil_scoped_release rel;
+                    return pipe.embed_document_windows(texts);
+                },
+                py::arg("texts"),
+                "List of texts ",
+                "Computes embeddings for the windows of a vector of texts, which are split by Config.window_length")
             .def(
                 "start_embed_documents_async",
                 [](TextEmbeddingPipeline& pipe, std::vector<std::string>& texts) -> void {
@@ -76,24 +165,24 @@ void init_rag_pipelines(py::module_& m) {
                 "Asynchronously computes embeddings for a vector of texts")
             .def(
                 "wait_embed_documents",
-                [](TextEmbeddingPipeline& pipe) -> py::typing::Union<EmbeddingResults> {
+                [](TextEmbeddingPipeline& pipe) -> py::array {
                     EmbeddingResults res;
                     {
                         py::gil_scoped_release rel;
                         res = pipe.wait_embed_documents();
                     }
-                    return py::cast(res);
+                    return pyutils::embeddings_to_array(std::move(res));
                 },
                 "Waits computed embeddings of a vector of texts")
             .def(
                 "embed_query",
-                [](TextEmbeddingPipeline& pipe, std::string& text) -> py::typing::Union<EmbeddingResult> {
+                [](TextEmbeddingPipeline& pipe, std::string& text) -> py::array {
                     EmbeddingResult res;
                     {
                         py::gil_scoped_release rel;
                         res = pipe.embed_query(text);
                     }
-                    return py::cast(res);
+                    return pyutils::embedding_to_array(std::move(res));
                 },
                 py::arg("text"),
                 "text ",
@@ -109,13 +198,13 @@ void init_rag_pipelines(py::module_& m) {
                 "Asynchronously computes embeddings for a query")
             .def(
                 "wait_embed_query",
-                [](TextEmbeddingPipeline& pipe) -> py::typing::Union<EmbeddingResult> {
+                [](TextEmbeddingPipeline& pipe) -> py::array {
                     EmbeddingResult res;
                     {
                         py::gil_scoped_release rel;
                         res = pipe.wait_embed_query();
                     }
-                    return py::cast(res);
+                    return pyutils::embedding_to_array(std::move(res));
                 },
                 "Waits computed embeddings for a query");
 
@@ -123,6 +212,16 @@ void init_rag_pipelines(py::module_& m) {
         .value("CLS", TextEmbeddingPipeline::PoolingType::CLS, "First token embeddings")
         .value("MEAN", TextEmbeddingPipeline::PoolingType::MEAN, "The average of all token embeddings");
 
+    py::enum_<TextEmbeddingPipeline::EmbeddingPrecision>(text_embedding_pipeline, "EmbeddingPrecision")
+        .value("F32", TextEmbeddingPipeline::EmbeddingPrecision::F32, "f32 embeddings")
+        .value("INT8", TextEmbeddingPipeline::EmbeddingPrecision::INT8, "int8 embeddings, the normalized values are scaled by 127")
+        .value("UINT8",
+               TextEmbeddingPipeline::EmbeddingPrecision::UINT8,
+               "uint8 embeddings, the normalized values are mapped from [-1, 1] to [0, 255]")
+        .value("BINARY",
+               TextEmbeddingPipeline::EmbeddingPrecision::BINARY,
+               "uint8 embeddings of the packed sign bits, the first dimension is the most significant bit");
+
     py::class_<TextEmbeddingPipeline::Config>(text_embedding_pipeline, "Config", text_embedding_config_docstring)
         .def(py::init<>())
         .def(py::init([](py::kwargs kwargs) {
@@ -130,9 +229,28 @@ void init_rag_pipelines(py::module_& m) {
         }))
         .def_readwrite("max_length", &TextEmbeddingPipeline::Config::max_length)
         .def_readwrite("pooling_type", &TextEmbeddingPipeline::Config::pooling_type)
+        .def_readwrite("embedding_size", &TextEmbeddingPipeline::Config::embedding_size)
         .def_readwrite("normalize", &TextEmbeddingPipeline::Config::normalize)
+        .def_readwrite("embedding_precision", &TextEmbeddingPipeline::Config::embedding_precision)
         .def_readwrite("query_instruction", &TextEmbeddingPipeline::Config::query_instruction)
-        .def_readwrite("embed_instruction", &TextEmbeddingPipeline::Config::embed_instruction);
+        .def_readwrite("embed_instruction", &TextEmbeddingPipeline::Config::embed_instruction)
+        .def_readwrite("max_batch_tokens", &TextEmbeddingPipeline::Config::max_batch_tokens)
+        .def_readwrite("pack_sequences", &TextEmbeddingPipeline::Config::pack_sequences)
+        .def_readwrite("window_length", &TextEmbeddingPipeline::Config::window_length)
+        .def_readwrite("window_overlap", &TextEmbeddingPipeline::Config::window_overlap);
+
+    py::class_<TextEmbeddingPipeline::DocumentWindows>(text_embedding_pipeline,
+                                                       "DocumentWindows",
+                                                       "Embeddings of the windows of the documents")
+        .def_property_readonly(
+            "embeddings",
+            [](const TextEmbeddingPipeline::DocumentWindows& windows) -> py::array {
+                return pyutils::embeddings_to_array(EmbeddingResults(windows.embeddings));
+            },
+            "Embeddings of the windows, the windows of a document are consecutive and follow the order of the documents")
+        .def_readonly("document_indices",
+                      &TextEmbeddingPipeline::DocumentWindows::document_indices,
+                      "Index of the document of each window");
 
     text_embedding_pipeline.def(
         py::init([](const std::filesystem::path& models_path,
@@ -142,12 +260,12 @@ void init_rag_pipelines(py::module_& m) {
             ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
 
             if (config.has_value()) {
-                return std::make_unique<TextEmbeddingPipeline>(models_path,
+                return std::make_shared<TextEmbeddingPipeline>(models_path,
                                                                device,
                                                                *config,
                                                                pyutils::kwargs_to_any_map(kwargs));
             }
-            return std::make_unique<TextEmbeddingPipeline>(models_path, device, pyutils::kwargs_to_any_map(kwargs));
+            return std::make_shared<TextEmbeddingPipeline>(models_path, device, pyutils::kwargs_to_any_map(kwargs));
         }),
         py::arg("models_path"),
         "Path to the directory containing model xml/bin files and tokenizer",
@@ -202,7 +320,18 @@ kwargs: Plugin and/or config properties
                     }
                     return py::cast(res);
                 },
-                "Waits for reranked texts.");
+                "Waits for reranked texts.")
+            .def(
+                "set_prefilter",
+                &ov::genai::TextRerankPipeline::set_prefilter,
+                py::arg("embedding_pipeline"),
+                py::arg("num_candidates"),
+                R"(
+Enables the cascade mode: the texts are prefiltered by the cosine similarity of their embeddings to the embedding of the
+query, and only 'num_candidates' most similar texts are scored by the rerank model.
+embedding_pipeline (TextEmbeddingPipeline): Pipeline of a cheap embedding model, None disables the prefiltering
+num_candidates (int): Number of texts passed to the rerank model, it should not be less than top_n
+)");
 
     py::class_<ov::genai::TextRerankPipeline::Config>(text_rerank_pipeline, "Config", text_reranking_config_docstring)
         .def(py::init<>())
@@ -210,7 +339,9 @@ kwargs: Plugin and/or config properties
             return ov::genai::TextRerankPipeline::Config(pyutils::kwargs_to_any_map(kwargs));
         }))
         .def_readwrite("top_n", &ov::genai::TextRerankPipeline::Config::top_n)
-        .def_readwrite("max_length", &ov::genai::TextRerankPipeline::Config::max_length);
+        .def_readwrite("max_length", &ov::genai::TextRerankPipeline::Config::max_length)
+        .def_readwrite("max_batch_tokens", &ov::genai::TextRerankPipeline::Config::max_batch_tokens)
+        .def_readwrite("score_cache_size", &ov::genai::TextRerankPipeline::Config::score_cache_size);
 
     text_rerank_pipeline.def(
         py::init([](const std::filesystem::path& models_path,
@@ -242,4 +373,96 @@ device (str): Device to run the model on (e.g., CPU, GPU).
 config: (TextRerankPipeline.Config): Optional pipeline configuration
 kwargs: Plugin and/or config properties
 )");
+
+    auto vector_index = py::class_<VectorIndex>(
+        m,
+        "VectorIndex",
+        "In-process approximate nearest neighbor index of embeddings based on HNSW graph. The embeddings get sequential ids "
+        "in the order they are added, starting from 0.");
+
+    py::enum_<VectorIndex::Metric>(vector_index, "Metric")
+        .value("L2", VectorIndex::Metric::L2, "Squared euclidean distance")
+        .value("INNER_PRODUCT", VectorIndex::Metric::INNER_PRODUCT, "Negated inner product")
+        .value("COSINE", VectorIndex::Metric::COSINE, "1 - cosine similarity");
+
+    py::enum_<VectorIndex::Storage>(vector_index, "Storage")
+        .value("F32", VectorIndex::Storage::F32, "The embeddings are stored as is")
+        .value("INT8", VectorIndex::Storage::INT8, "The embeddings are quantized to int8 with a scale per embedding");
+
+    py::class_<VectorIndex::Config>(vector_index, "Config", vector_index_config_docstring)
+        .def(py::init<>())
+        .def_readwrite("metric", &VectorIndex::Config::metric)
+        .def_readwrite("storage", &VectorIndex::Config::storage)
+        .def_readwrite("max_neighbors", &VectorIndex::Config::max_neighbors)
+        .def_readwrite("ef_construction", &VectorIndex::Config::ef_construction)
+        .def_readwrite("ef_search", &VectorIndex::Config::ef_search);
+
+    vector_index
+        .def(py::init([](size_t dimension, const std::optional<VectorIndex::Config>& config) {
+                 return std::make_unique<VectorIndex>(dimension, config.value_or(VectorIndex::Config{}));
+             }),
+             py::arg("dimension"),
+             "Size of the embeddings",
+             py::arg("config") = std::nullopt,
+             "Optional index configuration")
+        .def_static(
+            "load",
+            [](const std::filesystem::path& path) {
+                return std::make_unique<VectorIndex>(VectorIndex::load(path));
+            },
+            py::arg("path"),
+            "Loads the index saved by save(). The embeddings are memory mapped from the file, the file must not be "
+            "modified while the index is alive.")
+        .def(
+            "add",
+            [](VectorIndex& index, const py::array& embeddings) -> size_t {
+                EmbeddingResults rows = pyutils::array_to_embeddings(embeddings);
+                py::gil_scoped_release rel;
+                return index.add(rows);
+            },
+            py::arg("embeddings"),
+            "Adds the rows of the 2D array of embeddings, for example, the result of "
+            "TextEmbeddingPipeline.embed_documents(). Returns id of the first added embedding.")
+        .def(
+            "add",
+            [](VectorIndex& index, const EmbeddingResults& embeddings) -> size_t {
+                py::gil_scoped_release rel;
+                return index.add(embeddings);
+            },
+            py::arg("embeddings"),
+            "Adds the embeddings, for example, the results of TextEmbeddingPipeline.embed_documents(). Returns id of the "
+            "first added embedding.")
+        .def(
+            "search",
+            [](const VectorIndex& index, const py::array& query, size_t top_k) {
+                EmbeddingResult query_embedding = pyutils::array_to_embedding(query);
+                py::gil_scoped_release rel;
+                return index.search(query_embedding, top_k);
+            },
+            py::arg("query"),
+            py::arg("top_k"),
+            "Searches the nearest embeddings to the 1D array of the query embedding, for example, the result of "
+            "TextEmbeddingPipeline.embed_query(). Returns ids of the nearest embeddings and their distances to the "
+            "query sorted by distance.")
+        .def(
+            "search",
+            [](const VectorIndex& index, const EmbeddingResult& query, size_t top_k) {
+                py::gil_scoped_release rel;
+                return index.search(query, top_k);
+            },
+            py::arg("query"),
+            py::arg("top_k"),
+            "Searches the nearest embeddings to the query, for example, the result of TextEmbeddingPipeline.embed_query(). "
+            "Returns ids of the nearest embeddings and their distances to the query sorted by distance.")
+        .def(
+            "save",
+            [](const VectorIndex& index, const std::filesystem::path& path) {
+                py::gil_scoped_release rel;
+                index.save(path);
+            },
+            py::arg("path"),
+            "Saves the index to a file.")
+        .def("__len__", &VectorIndex::size)
+        .def("get_dimension", &VectorIndex::get_dimension)
+        .def("get_config", &VectorIndex::get_config);
 }
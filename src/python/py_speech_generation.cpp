@@ -69,7 +69,9 @@ auto text_to_speech_generate_docstring = R"(
                              `Matthijs/cmu-arctic-xvectors` dataset is used by default.
     :type speaker_embedding: openvino.Tensor or None
 
-    :param properties: speech generation parameters specified as properties
+    :param properties: speech generation parameters specified as properties. The 'speech_streamer' callback receives
+                       the index of a text and the next chunk of its waveform as soon as it is vocoded, and returns
+                       StreamingStatus or None to continue. The streamed texts are decoded one by one.
     :type properties: dict
 
     :returns: raw audios of the input texts spoken in the specified speaker's voice, with a sample rate of 16 kHz
@@ -143,19 +145,14 @@ void init_speech_generation_pipeline(py::module_& m) {
                const std::string& text,
                py::object speaker_embedding,
                const py::kwargs& kwargs) -> py::typing::Union<ov::genai::Text2SpeechDecodedResults> {
-                SpeechGenerationConfig base_config = pipe.get_generation_config();
-
-                auto updated_config = update_speech_generation_config_from_kwargs(base_config, kwargs);
+                const ov::AnyMap properties = pyutils::kwargs_to_any_map(kwargs);
+                const ov::Tensor tensor =
+                    speaker_embedding.is_none() ? ov::Tensor() : speaker_embedding.cast<ov::Tensor>();
 
                 ov::genai::Text2SpeechDecodedResults res;
                 {
                     py::gil_scoped_release rel;
-                    if (speaker_embedding.is_none()) {
-                        res = pipe.generate(text);
-                    } else {
-                        const ov::Tensor& tensor = speaker_embedding.cast<ov::Tensor>();
-                        res = pipe.generate(text, tensor);
-                    }
+                    res = pipe.generate(text, tensor, properties);
                 }
                 return py::cast(res);
             },
@@ -171,19 +168,14 @@ void init_speech_generation_pipeline(py::module_& m) {
                const std::vector<std::string>& texts,
                py::object speaker_embedding,
                const py::kwargs& kwargs) -> py::typing::Union<ov::genai::Text2SpeechDecodedResults> {
-                SpeechGenerationConfig base_config = pipe.get_generation_config();
-
-                auto updated_config = update_speech_generation_config_from_kwargs(base_config, kwargs);
+                const ov::AnyMap properties = pyutils::kwargs_to_any_map(kwargs);
+                const ov::Tensor tensor =
+                    speaker_embedding.is_none() ? ov::Tensor() : speaker_embedding.cast<ov::Tensor>();
 
                 ov::genai::Text2SpeechDecodedResults res;
                 {
                     py::gil_scoped_release rel;
-                    if (speaker_embedding.is_none()) {
-                        res = pipe.generate(texts);
-                    } else {
-                        const ov::Tensor& tensor = speaker_embedding.cast<ov::Tensor>();
-                        res = pipe.generate(texts, tensor);
-                    }
+                    res = pipe.generate(texts, tensor, properties);
                 }
                 return py::cast(res);
             },
@@ -9,11 +9,15 @@
 
 #include "openvino/genai/streamer_base.hpp"
 #include "openvino/genai/text_streamer.hpp"
+#include "openvino/genai/json_streamer.hpp"
 #include "py_utils.hpp"
 
 namespace py = pybind11;
 
 using ov::genai::CallbackTypeVariant;
+using ov::genai::JsonEvent;
+using ov::genai::JsonEventType;
+using ov::genai::JsonStreamer;
 using ov::genai::StreamingStatus;
 using ov::genai::TextStreamer;
 using ov::genai::Tokenizer;
@@ -34,6 +38,26 @@ callback: User-defined callback function to process the decoded text, callback s
 
 )";
 
+auto json_event_docstring =  R"(
+JSON event emitted by JsonStreamer.
+
+type: JsonEventType of the event.
+path: JSON Pointer (RFC 6901) of the value the event belongs to, e.g. "/tool_calls/0/name", empty for the root value.
+value: STRING_CHUNK: the characters decoded since the previous chunk of the string, the chunks add up to the string.
+       VALUE: the decoded text for strings, the JSON text for numbers, booleans and null.
+is_string: whether the value is a string, True for STRING_CHUNK.
+)";
+
+auto json_streamer_docstring =  R"(
+JsonStreamer decodes tokens into text as TextStreamer does and parses it into JSON events as the tokens arrive,
+so that the fields of the generated JSON, e.g. the name of a tool call, can be used before the generation completes.
+Meant for the generation constrained to JSON by GenerationConfig.structured_output_config. Raises if the text isn't JSON.
+
+tokenizer: Tokenizer object to decode tokens into text.
+callback: User-defined callback function to process the JsonEvent-s, callback should return either boolean flag or StreamingStatus.
+
+)";
+
 class ConstructableStreamer: public StreamerBase {
     OPENVINO_SUPPRESS_DEPRECATED_START
     bool put(int64_t token) override {
@@ -105,4 +129,36 @@ void init_streamers(py::module_& m) {
             },
             py::arg("token"))
         .def("end", &TextStreamer::end);
+
+    py::enum_<JsonEventType>(m, "JsonEventType")
+        .value("OBJECT_START", JsonEventType::OBJECT_START)
+        .value("OBJECT_END", JsonEventType::OBJECT_END)
+        .value("ARRAY_START", JsonEventType::ARRAY_START)
+        .value("ARRAY_END", JsonEventType::ARRAY_END)
+        .value("STRING_CHUNK", JsonEventType::STRING_CHUNK)
+        .value("VALUE", JsonEventType::VALUE);
+
+    py::class_<JsonEvent>(m, "JsonEvent", json_event_docstring)
+        .def_readonly("type", &JsonEvent::type)
+        .def_property_readonly("path", [](const JsonEvent& self) {
+            return pyutils::handle_utf8(self.path);
+        })
+        .def_property_readonly("value", [](const JsonEvent& self) {
+            return pyutils::handle_utf8(self.value);
+        })
+        .def_readonly("is_string", &JsonEvent::is_string);
+
+    py::class_<JsonStreamer, std::shared_ptr<JsonStreamer>, StreamerBase>(m, "JsonStreamer", json_streamer_docstring)
+        .def(py::init<const Tokenizer&, std::function<CallbackTypeVariant(const JsonEvent&)>>(), py::arg("tokenizer"), py::arg("callback"))
+        .def("write",
+            [](JsonStreamer& self, std::variant<int64_t, std::vector<int64_t>> token) {
+                if (auto _token = std::get_if<int64_t>(&token)) {
+                    return self.write(*_token);
+                } else {
+                    auto tokens = std::get<std::vector<int64_t>>(token);
+                    return self.write(tokens);
+                }
+            },
+            py::arg("token"))
+        .def("end", &JsonStreamer::end);
 }
@@ -44,6 +44,28 @@ Args:
 + std::string(common_encode_docstring)
 );
 
+auto encode_parallel_docstring = R"(Encodes a large list of prompts in parallel: the prompts are sorted by length and split into shards,
+which are encoded concurrently by the infer requests of the tokenizer, see 'num_tokenizer_infer_requests' property.
+Args:
+ 'prompts' - list of prompts to encode
+ 'add_special_tokens' - whether to add special tokens like BOS, EOS, PAD. Default is True.
+ 'pad_to_max_length' - whether to pad the sequence to the maximum length. Default is False.
+ 'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+ 'padding_side' - side to pad the sequence, can be 'left' or 'right'. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+Returns:
+ list of token ids of each prompt without padding.
+)";
+
+auto encode_ragged_docstring = R"(Encodes a list of prompts without padding: the token ids of all prompts are stored one after another,
+the token ids of the prompt i are input_ids[0, offsets[i]:offsets[i + 1]].
+Args:
+ 'prompts' - list of prompts to encode
+ 'add_special_tokens' - whether to add special tokens like BOS, EOS, PAD. Default is True.
+ 'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+Returns:
+ RaggedTokenizedInputs object containing input_ids and offsets tensors.
+)";
+
 auto encode_single_prompt_docstring = (
 R"(Encodes a single prompt into tokenized input.
 Args:
@@ -74,6 +96,7 @@ namespace py = pybind11;
 namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::ChatHistory;
+using ov::genai::RaggedTokenizedInputs;
 using ov::genai::TokenizedInputs;
 using ov::genai::Tokenizer;
 
@@ -83,6 +106,14 @@ void init_tokenizer(py::module_& m) {
         .def_readwrite("input_ids", &TokenizedInputs::input_ids)
         .def_readwrite("attention_mask", &TokenizedInputs::attention_mask);
 
+    py::class_<RaggedTokenizedInputs>(m, "RaggedTokenizedInputs", "Token ids of a batch of prompts without padding.")
+        .def(py::init<ov::Tensor, ov::Tensor>(), py::arg("input_ids"), py::arg("offsets"))
+        .def_readwrite("input_ids", &RaggedTokenizedInputs::input_ids)
+        .def_readwrite("offsets", &RaggedTokenizedInputs::offsets)
+        .def("get_batch_size", &RaggedTokenizedInputs::get_batch_size)
+        .def("get_input_ids", &RaggedTokenizedInputs::get_input_ids, py::arg("index"),
+             "Returns the token ids of the prompt as a tensor of shape [1, prompt_length] sharing the memory of input_ids.");
+
     py::class_<ov::genai::Tokenizer>(m, "Tokenizer", class_docstring)
 
         .def(py::init([](const std::filesystem::path& tokenizer_path, const std::map<std::string, py::object>& properties, const py::kwargs& kwargs) {
@@ -218,6 +249,46 @@ void init_tokenizer(py::module_& m) {
             encode_list_of_lists_docstring.c_str()
         )
 
+        .def("encode_parallel", [](Tokenizer& tok, const std::vector<std::string>& prompts,
+                                   bool add_special_tokens,
+                                   bool pad_to_max_length,
+                                   std::optional<size_t> max_length,
+                                   std::optional<std::string> padding_side) {
+                ov::AnyMap tokenization_params;
+                tokenization_params[ov::genai::add_special_tokens.name()] = add_special_tokens;
+                tokenization_params[ov::genai::pad_to_max_length.name()] = pad_to_max_length;
+                if (max_length.has_value()) {
+                    tokenization_params[ov::genai::max_length.name()] = *max_length;
+                }
+                if (padding_side.has_value()) {
+                    tokenization_params[ov::genai::padding_side.name()] = *padding_side;
+                }
+                py::gil_scoped_release rel;
+                return tok.encode_parallel(prompts, tokenization_params);
+            },
+            py::arg("prompts"),
+            py::arg("add_special_tokens") = true,
+            py::arg("pad_to_max_length") = false,
+            py::arg("max_length") = std::nullopt,
+            py::arg("padding_side") = std::nullopt,
+            encode_parallel_docstring)
+
+        .def("encode_ragged", [](Tokenizer& tok, const std::vector<std::string>& prompts,
+                                 bool add_special_tokens,
+                                 std::optional<size_t> max_length) {
+                ov::AnyMap tokenization_params;
+                tokenization_params[ov::genai::add_special_tokens.name()] = add_special_tokens;
+                if (max_length.has_value()) {
+                    tokenization_params[ov::genai::max_length.name()] = *max_length;
+                }
+                py::gil_scoped_release rel;
+                return tok.encode_ragged(prompts, tokenization_params);
+            },
+            py::arg("prompts"),
+            py::arg("add_special_tokens") = true,
+            py::arg("max_length") = std::nullopt,
+            encode_ragged_docstring)
+
         .def(
             "decode",
             [](Tokenizer& tok, std::vector<int64_t>& tokens, bool skip_special_tokens) -> py::str {
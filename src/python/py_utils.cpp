@@ -9,6 +9,8 @@
 #include <pybind11/stl/filesystem.h>
 #include <pybind11/functional.h>
 
+#include <cstring>
+
 #include <openvino/runtime/auto/properties.hpp>
 
 #include "tokenizer/tokenizers_path.hpp"
@@ -18,6 +20,7 @@
 #include "openvino/genai/whisper_generation_config.hpp"
 #include "openvino/genai/whisper_pipeline.hpp"
 #include "openvino/genai/rag/text_embedding_pipeline.hpp"
+#include "openvino/genai/speech_generation/text2speech_pipeline.hpp"
 
 namespace py = pybind11;
 namespace ov::genai::pybind::utils {
@@ -144,9 +147,12 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
                 }
             }
             return structural_tags;
+        } else if (property_name == "alignment_heads") {
+            // the list of [layer, head] pairs
+            return py_obj.cast<std::vector<std::pair<size_t, size_t>>>();
         } else {
             auto _list = py_obj.cast<py::list>();
-            enum class PY_TYPE : int { UNKNOWN = 0, STR, INT, FLOAT, BOOL, PARTIAL_SHAPE, TENSOR};
+            enum class PY_TYPE : int { UNKNOWN = 0, STR, INT, FLOAT, BOOL, PARTIAL_SHAPE, TENSOR, ARRAY};
             PY_TYPE detected_type = PY_TYPE::UNKNOWN;
             for (const auto& it : _list) {
                 auto check_type = [&](PY_TYPE type) {
@@ -168,6 +174,8 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
                     check_type(PY_TYPE::PARTIAL_SHAPE);
                 } else if (py::isinstance<ov::Tensor>(it)) {
                     check_type(PY_TYPE::TENSOR);
+                } else if (py::isinstance<py::array>(it)) {
+                    check_type(PY_TYPE::ARRAY);
                 }
             }
 
@@ -187,6 +195,14 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
                 return _list.cast<std::vector<ov::PartialShape>>();
             case PY_TYPE::TENSOR:
                 return _list.cast<std::vector<ov::Tensor>>();
+            case PY_TYPE::ARRAY: {
+                // e.g. images, the tensors share the memory of the arrays
+                std::vector<ov::Tensor> tensors;
+                for (const auto& it : _list) {
+                    tensors.push_back(array_to_tensor(py::reinterpret_borrow<py::array>(it)));
+                }
+                return tensors;
+            }
             default:
                 OPENVINO_THROW("Property \"" + property_name + "\" got unsupported type.");
             }
@@ -298,6 +314,8 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
         return py::cast<ov::streams::Num>(py_obj);
     } else if (py::isinstance<ov::Tensor>(py_obj)) {
         return py::cast<ov::Tensor>(py_obj);
+    } else if (py::isinstance<py::array>(py_obj) && property_name == ov::genai::image.name()) {
+        return array_to_tensor(py::reinterpret_borrow<py::array>(py_obj));
     } else if (py::isinstance<ov::Output<ov::Node>>(py_obj)) {
         return py::cast<ov::Output<ov::Node>>(py_obj);
     } else if (py::isinstance<ov::genai::SchedulerConfig>(py_obj)) {
@@ -316,12 +334,27 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
         return py::cast<ov::genai::WhisperGenerationConfig>(py_obj);
     } else if (py::isinstance<ov::genai::TextEmbeddingPipeline::PoolingType>(py_obj)) {
         return py::cast<ov::genai::TextEmbeddingPipeline::PoolingType>(py_obj);
+    } else if (py::isinstance<ov::genai::TextEmbeddingPipeline::EmbeddingPrecision>(py_obj)) {
+        return py::cast<ov::genai::TextEmbeddingPipeline::EmbeddingPrecision>(py_obj);
     } else if (py::isinstance<ov::genai::StopCriteria>(py_obj)) {
         return py::cast<ov::genai::StopCriteria>(py_obj);
     } else if (py::isinstance<ov::genai::Generator>(py_obj)) {
         return py::cast<std::shared_ptr<ov::genai::Generator>>(py_obj);
     } else if (py::isinstance<py::function>(py_obj) && property_name == "callback") {
         return py::cast<std::function<bool(size_t, size_t, ov::Tensor&)>>(py_obj);
+    } else if (py::isinstance<py::function>(py_obj) && property_name == "preview_callback") {
+        return py::cast<std::function<void(size_t, size_t, ov::Tensor&)>>(py_obj);
+    } else if (py::isinstance<py::function>(py_obj) && property_name == "speech_streamer") {
+        auto py_callback = py::cast<std::function<std::optional<uint16_t>(size_t, ov::Tensor)>>(py_obj);
+        return ov::genai::SpeechStreamer([py_callback](size_t text_idx, const ov::Tensor& audio) {
+            py::gil_scoped_acquire acquire;
+            std::optional<uint16_t> callback_output = py_callback(text_idx, audio);
+            if (!callback_output.has_value() || *callback_output == (uint16_t)StreamingStatus::RUNNING)
+                return StreamingStatus::RUNNING;
+            else if (*callback_output == (uint16_t)StreamingStatus::CANCEL)
+                return StreamingStatus::CANCEL;
+            return StreamingStatus::STOP;
+        });
     } else if ((py::isinstance<py::function>(py_obj) || py::isinstance<ov::genai::StreamerBase>(py_obj) || py::isinstance<std::monostate>(py_obj)) && property_name == "streamer") {
         auto streamer = py::cast<ov::genai::pybind::utils::PyBindStreamerVariant>(py_obj);
         return ov::genai::streamer(pystreamer_to_streamer(streamer)).second;
@@ -427,4 +460,133 @@ ov::genai::OptionalGenerationConfig update_config_from_kwargs(const ov::genai::O
 }
 
 
+namespace {
+
+template <typename T>
+py::array_t<T> rows_to_array(const std::vector<std::vector<T>>& rows) {
+    const size_t row_size = rows.empty() ? 0 : rows.front().size();
+    py::array_t<T> array(std::vector<py::ssize_t>{static_cast<py::ssize_t>(rows.size()), static_cast<py::ssize_t>(row_size)});
+    T* data = array.mutable_data();
+    for (const auto& row : rows) {
+        OPENVINO_ASSERT(row.size() == row_size, "Embeddings have different sizes");
+        std::copy(row.begin(), row.end(), data);
+        data += row_size;
+    }
+    return array;
+}
+
+template <typename T>
+std::vector<T> row_to_vector(const py::array& array, py::ssize_t row) {
+    std::vector<T> values(array.shape(array.ndim() - 1));
+    for (size_t i = 0; i < values.size(); ++i) {
+        const auto* element = static_cast<const char*>(array.data()) + (array.ndim() == 2 ? row * array.strides(0) : 0) +
+                              i * array.strides(array.ndim() - 1);
+        values[i] = *reinterpret_cast<const T*>(element);
+    }
+    return values;
+}
+
+template <typename T>
+std::vector<std::vector<T>> rows_to_vectors(const py::array& array) {
+    std::vector<std::vector<T>> rows;
+    rows.reserve(array.shape(0));
+    for (py::ssize_t row = 0; row < array.shape(0); ++row) {
+        rows.push_back(row_to_vector<T>(array, row));
+    }
+    return rows;
+}
+
+}  // namespace
+
+py::array embedding_to_array(ov::genai::EmbeddingResult&& embedding) {
+    return std::visit([](auto&& values) -> py::array {
+        return vector_to_array(std::move(values));
+    }, std::move(embedding));
+}
+
+py::array embeddings_to_array(ov::genai::EmbeddingResults&& embeddings) {
+    return std::visit([](const auto& rows) -> py::array {
+        return rows_to_array(rows);
+    }, embeddings);
+}
+
+ov::genai::EmbeddingResult array_to_embedding(const py::array& array) {
+    OPENVINO_ASSERT(array.ndim() == 1, "Embedding array must be 1D, got ", array.ndim(), " dimensions");
+    if (array.dtype().is(py::dtype::of<float>())) {
+        return row_to_vector<float>(array, 0);
+    } else if (array.dtype().is(py::dtype::of<int8_t>())) {
+        return row_to_vector<int8_t>(array, 0);
+    } else if (array.dtype().is(py::dtype::of<uint8_t>())) {
+        return row_to_vector<uint8_t>(array, 0);
+    }
+    OPENVINO_THROW("Embedding array must be of float32, int8 or uint8 dtype");
+}
+
+ov::genai::EmbeddingResults array_to_embeddings(const py::array& array) {
+    OPENVINO_ASSERT(array.ndim() == 2, "Embeddings array must be 2D, got ", array.ndim(), " dimensions");
+    if (array.dtype().is(py::dtype::of<float>())) {
+        return rows_to_vectors<float>(array);
+    } else if (array.dtype().is(py::dtype::of<int8_t>())) {
+        return rows_to_vectors<int8_t>(array);
+    } else if (array.dtype().is(py::dtype::of<uint8_t>())) {
+        return rows_to_vectors<uint8_t>(array);
+    }
+    OPENVINO_THROW("Embeddings array must be of float32, int8 or uint8 dtype");
+}
+
+ov::Tensor array_to_tensor(const py::array& array) {
+    OPENVINO_ASSERT(array.flags() & py::array::c_style, "Array must be C-contiguous, e.g. made by numpy.ascontiguousarray()");
+    ov::element::Type element_type;
+    if (array.dtype().is(py::dtype::of<uint8_t>())) {
+        element_type = ov::element::u8;
+    } else if (array.dtype().is(py::dtype::of<int8_t>())) {
+        element_type = ov::element::i8;
+    } else if (array.dtype().is(py::dtype::of<float>())) {
+        element_type = ov::element::f32;
+    } else if (array.dtype().is(py::dtype::of<int32_t>())) {
+        element_type = ov::element::i32;
+    } else if (array.dtype().is(py::dtype::of<int64_t>())) {
+        element_type = ov::element::i64;
+    } else {
+        OPENVINO_THROW("Unsupported dtype of the array: ", py::str(array.dtype()).cast<std::string>());
+    }
+    ov::Shape shape(array.shape(), array.shape() + array.ndim());
+    return ov::Tensor(element_type, shape, const_cast<void*>(array.data()));
+}
+
 }  // namespace ov::genai::pybind::utils
+
+namespace pybind11::detail {
+
+bool type_caster<ov::genai::pybind::utils::RawSpeechBuffer>::load(handle src, bool) {
+    if (!src || !PyObject_CheckBuffer(src.ptr()) || isinstance<str>(src)) {
+        return false;
+    }
+    buffer_info info = reinterpret_borrow<buffer>(src).request();
+    if (info.ndim != 1) {
+        return false;
+    }
+    auto& samples = value.samples;
+    const auto* data = static_cast<const char*>(info.ptr);
+    if (info.format == format_descriptor<float>::format() && info.strides[0] == sizeof(float)) {
+        samples.resize(info.shape[0]);
+        std::memcpy(samples.data(), data, info.shape[0] * sizeof(float));
+    } else if (info.format == format_descriptor<float>::format() || info.format == format_descriptor<double>::format()) {
+        const bool is_double = info.format == format_descriptor<double>::format();
+        samples.resize(info.shape[0]);
+        for (py::ssize_t i = 0; i < info.shape[0]; ++i) {
+            const char* element = data + i * info.strides[0];
+            samples[i] = is_double ? static_cast<float>(*reinterpret_cast<const double*>(element)) : *reinterpret_cast<const float*>(element);
+        }
+    } else if (info.itemsize == 1 && (info.format == "B" || info.format == "b" || info.format == "c") && info.strides[0] == 1) {
+        // bytes of float32 PCM samples
+        OPENVINO_ASSERT(info.shape[0] % sizeof(float) == 0, "Size of the raw speech bytes must be a multiple of 4, got ", info.shape[0]);
+        samples.resize(info.shape[0] / sizeof(float));
+        std::memcpy(samples.data(), data, info.shape[0]);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace pybind11::detail
@@ -4,11 +4,14 @@
 #define PYBIND11_DETAILED_ERROR_MESSAGES
 
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 
 #include "openvino/genai/streamer_base.hpp"
 #include "openvino/genai/llm_pipeline.hpp"
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
 
 namespace py = pybind11;
 using ov::genai::StreamerBase;
@@ -40,4 +43,54 @@ ov::genai::OptionalGenerationConfig update_config_from_kwargs(const ov::genai::O
 
 ov::genai::StreamerVariant pystreamer_to_streamer(const PyBindStreamerVariant& py_streamer);
 
+/**
+ * Moves the vector to a numpy array, which owns it by a capsule, so that the elements aren't copied.
+ */
+template <typename T>
+py::array_t<T> vector_to_array(std::vector<T>&& values) {
+    auto owner = new std::vector<T>(std::move(values));
+    py::capsule capsule(owner, [](void* ptr) {
+        delete static_cast<std::vector<T>*>(ptr);
+    });
+    return py::array_t<T>({static_cast<py::ssize_t>(owner->size())}, {static_cast<py::ssize_t>(sizeof(T))}, owner->data(), capsule);
+}
+
+// 1D numpy array owning the embedding
+py::array embedding_to_array(ov::genai::EmbeddingResult&& embedding);
+
+// 2D numpy array of [num_embeddings, embedding_size] shape, the rows are copied to the contiguous array at once
+py::array embeddings_to_array(ov::genai::EmbeddingResults&& embeddings);
+
+// the embedding of a 1D numpy array of float32, int8 or uint8
+ov::genai::EmbeddingResult array_to_embedding(const py::array& array);
+
+// the embeddings of the rows of a 2D numpy array of float32, int8 or uint8
+ov::genai::EmbeddingResults array_to_embeddings(const py::array& array);
+
+/**
+ * Wraps the C-contiguous numpy array to a tensor sharing its memory, e.g. an image of [H, W, C] or [N, H, W, C] uint8.
+ * The array must outlive the tensor.
+ */
+ov::Tensor array_to_tensor(const py::array& array);
+
+/**
+ * Raw speech loaded from a 1D buffer, e.g. a numpy array of float32 or float64 samples, or bytes of float32 PCM samples,
+ * by a single copy to the vector taken by WhisperPipeline rather than by a conversion of each element.
+ */
+struct RawSpeechBuffer {
+    ov::genai::RawSpeechInput samples;
+};
+
 }  // namespace ov::genai::pybind::utils
+
+namespace pybind11::detail {
+
+template <>
+struct type_caster<ov::genai::pybind::utils::RawSpeechBuffer> {
+    PYBIND11_TYPE_CASTER(ov::genai::pybind::utils::RawSpeechBuffer, const_name("numpy.ndarray | bytes"));
+
+    // rejects the objects other than 1D buffers, so that they are passed to the next overloads, e.g. taking a list
+    bool load(handle src, bool);
+};
+
+}  // namespace pybind11::detail
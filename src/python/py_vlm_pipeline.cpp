@@ -87,6 +87,7 @@ auto vlm_generate_kwargs_docstring = R"(
     Expected parameters list:
     image: ov.Tensor - input image,
     images: list[ov.Tensor] - input images,
+    videos: list[ov.Tensor] - input videos, uint8 RGB frames with [NHWC] layout each, supported by Qwen2-VL and Qwen2.5-VL,
     generation_config: GenerationConfig,
     streamer: Callable[[str], bool], ov.genai.StreamerBase - streamer either as a lambda with a boolean returning flag whether generation should be stopped
 
@@ -99,6 +100,12 @@ auto raw_perf_metrics_docstring = R"(
 
     :param prepare_embeddings_durations: Durations of embeddings preparation.
     :type prepare_embeddings_durations: list[MicroSeconds]
+
+    :param vision_embedding_cache_hits: Number of images, which embeddings are taken from the vision embedding cache.
+    :type vision_embedding_cache_hits: int
+
+    :param vision_embedding_cache_misses: Number of images encoded with the vision embedding cache enabled.
+    :type vision_embedding_cache_misses: int
 )";
 
 auto perf_metrics_docstring = R"(
@@ -144,7 +151,9 @@ void init_vlm_pipeline(py::module_& m) {
         .def(py::init<>())
         .def_property_readonly("prepare_embeddings_durations", [](const ov::genai::VLMRawPerfMetrics& rw) {
             return common_utils::get_ms(rw, &ov::genai::VLMRawPerfMetrics::prepare_embeddings_durations);
-        });
+        })
+        .def_readonly("vision_embedding_cache_hits", &ov::genai::VLMRawPerfMetrics::vision_embedding_cache_hits)
+        .def_readonly("vision_embedding_cache_misses", &ov::genai::VLMRawPerfMetrics::vision_embedding_cache_misses);
 
     py::class_<ov::genai::VLMPerfMetrics, ov::genai::PerfMetrics>(m, "VLMPerfMetrics", perf_metrics_docstring)
         .def(py::init<>())
@@ -218,6 +227,8 @@ void init_vlm_pipeline(py::module_& m) {
         .def("get_tokenizer", &ov::genai::VLMPipeline::get_tokenizer)
         .def("get_generation_config", &ov::genai::VLMPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &ov::genai::VLMPipeline::set_generation_config, py::arg("config"))
+        .def("warmup", &ov::genai::VLMPipeline::warmup, py::arg("config") = ov::genai::WarmupConfig(), py::call_guard<py::gil_scoped_release>(),
+             "Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.")
         .def(
             "generate",
             [](ov::genai::VLMPipeline& pipe,
@@ -252,6 +263,44 @@ void init_vlm_pipeline(py::module_& m) {
             py::arg("streamer") = std::monostate(), "streamer",
             (vlm_generate_docstring + std::string(" \n ")).c_str()
         )
+        .def(
+            "generate",
+            [](ov::genai::VLMPipeline& pipe,
+                const std::string& prompt,
+                const std::vector<py::array>& images,
+                const ov::genai::GenerationConfig& generation_config,
+                const pyutils::PyBindStreamerVariant& streamer,
+                const py::kwargs& kwargs
+            ) -> py::typing::Union<ov::genai::VLMDecodedResults> {
+                std::vector<ov::Tensor> tensors;
+                for (const auto& image : images) {
+                    tensors.push_back(pyutils::array_to_tensor(image));
+                }
+                return call_vlm_generate(pipe, prompt, tensors, generation_config, streamer, kwargs);
+            },
+            py::arg("prompt"), "Input string",
+            py::arg("images"), "Input images as C-contiguous numpy arrays, whose memory is shared with the pipeline",
+            py::arg("generation_config"), "generation_config",
+            py::arg("streamer") = std::monostate(), "streamer",
+            (vlm_generate_docstring + std::string(" \n ")).c_str()
+        )
+        .def(
+            "generate",
+            [](ov::genai::VLMPipeline& pipe,
+                const std::string& prompt,
+                const py::array& images,
+                const ov::genai::GenerationConfig& generation_config,
+                const pyutils::PyBindStreamerVariant& streamer,
+                const py::kwargs& kwargs
+            ) -> py::typing::Union<ov::genai::VLMDecodedResults> {
+                return call_vlm_generate(pipe, prompt, {pyutils::array_to_tensor(images)}, generation_config, streamer, kwargs);
+            },
+            py::arg("prompt"), "Input string",
+            py::arg("images"), "Input image as a C-contiguous numpy array, whose memory is shared with the pipeline",
+            py::arg("generation_config"), "generation_config",
+            py::arg("streamer") = std::monostate(), "streamer",
+            (vlm_generate_docstring + std::string(" \n ")).c_str()
+        )
         .def(
             "generate",
             [](ov::genai::VLMPipeline& pipe,
@@ -31,6 +31,8 @@ using ov::genai::WhisperGenerationConfig;
 using ov::genai::WhisperPerfMetrics;
 using ov::genai::WhisperPipeline;
 using ov::genai::WhisperRawPerfMetrics;
+using ov::genai::WhisperStreamingResult;
+using ov::genai::WhisperWordTiming;
 
 namespace pyutils = ov::genai::pybind::utils;
 namespace common_utils = ov::genai::common_bindings::utils;
@@ -57,6 +59,39 @@ auto whisper_generate_docstring = R"(
     :rtype: WhisperDecodedResults
 )";
 
+auto whisper_batch_generate_docstring = R"(
+    Transcribes several audio inputs together, so that the encoder and decoder inferences process them as a batch.
+
+    :param raw_speech_inputs: inputs in the form of list of lists of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+    :type raw_speech_inputs: list[list[float]]
+
+    :param generation_config: generation_config used for all the inputs
+    :type generation_config: WhisperGenerationConfig or a dict
+
+    :param kwargs: arbitrary keyword arguments with keys corresponding to WhisperGenerationConfig fields.
+    :type : dict
+
+    :return: return results in decoded form for each input
+    :rtype: list[WhisperDecodedResults]
+)";
+
+auto whisper_streaming_result_docstring = R"(
+    The transcription update of an audio stream after a pushed chunk of audio.
+
+    Parameters:
+    stable_text:  the text confirmed by this update, it's not changed by the later audio and follows the previously stable text.
+    partial_text: the unconfirmed rest of the current hypothesis, it replaces the previous partial text.
+)";
+
+auto start_stream_docstring = R"(
+    Starts the transcription of an audio stream, e.g. for live captioning. The stream audio is pushed in chunks as it
+    arrives, each push_audio() call decodes the buffered audio again and returns the text confirmed by two consecutive
+    hypotheses as stable and the rest as partial.
+
+    :param generation_config: generation_config of the stream
+    :type generation_config: WhisperGenerationConfig or a dict
+)";
+
 auto whisper_decoded_results_docstring = R"(
     Structure to store resulting text outputs and scores.
 
@@ -65,6 +100,7 @@ auto whisper_decoded_results_docstring = R"(
     scores:     scores for each sequence.
     metrics:    performance metrics with tpot, ttft, etc. of type ov::genai::PerfMetrics.
     shunks:     optional chunks of resulting sequences with timestamps
+    words:      optional words of the resulting sequence with timestamps
 )";
 
 auto whisper_decoded_result_chunk = R"(
@@ -75,6 +111,15 @@ auto whisper_decoded_result_chunk = R"(
     :param text     chunk text
 )";
 
+auto whisper_word_timing_docstring = R"(
+    Structure to store a word of the decoded text with its timestamps
+
+    :param word      word text with its leading space, if any
+    :param token_ids word token ids
+    :param start_ts  word start time in seconds
+    :param end_ts    word end time in seconds
+)";
+
 auto whisper_generation_config_docstring = R"(
     WhisperGenerationConfig
     
@@ -148,6 +193,30 @@ auto whisper_generation_config_docstring = R"(
       //  He has gone and gone for good answered Polychrome who...
     :type hotwords: Optional[str]
 
+    :param stride_length: If set, long-form audio is split into 30 seconds windows which overlap by `stride_length` seconds on each side,
+    instead of seeking each next window by the timestamps of the previous one. The windows are encoded and decoded as a batch,
+    and the texts of the overlapping windows are merged by their matching tokens.
+    :type stride_length: Optional[float]
+
+    :param vad_filter: If `true`, the silence of the audio is skipped before the encoding: the speech regions are detected by the energy
+    of the audio frames and packed back to back, the timestamps of the segments are mapped back to the original audio.
+    :type vad_filter: bool
+
+    :param word_timestamps: If `true`, the pipeline returns the timestamps of each word of the text in WhisperDecodedResults.words.
+    The tokens are aligned to the audio frames by dynamic time warping of the cross-attention weights of the `alignment_heads`.
+    The pipeline must be created with the `word_timestamps=True` property.
+    :type word_timestamps: bool
+
+    :param alignment_heads: The (layer, head) pairs of the decoder cross-attention heads aligned with the speech, as of generation_config.json.
+    :type alignment_heads: list[tuple[int, int]]
+
+    :param num_assistant_tokens: The number of the tokens drafted per step by the draft decoder of the pipeline created with `draft_decoder_path`,
+    the drafted tokens are validated by the pipeline decoder in a single inference. 0 disables assisted generation unless `assistant_confidence_threshold` is set.
+    :type num_assistant_tokens: int
+
+    :param assistant_confidence_threshold: If set, the draft decoder drafts the tokens until the probability of a drafted token is below the threshold.
+    :type assistant_confidence_threshold: float
+
     Generic parameters:
     max_length:    the maximum length the generated tokens can have. Corresponds to the length of the input prompt +
                    max_new_tokens. Its effect is overridden by `max_new_tokens`, if also set.
@@ -284,6 +353,22 @@ py::object call_whisper_common_generate(WhisperPipeline& pipe,
     return py::cast(res);
 }
 
+py::object call_whisper_batch_generate(WhisperPipeline& pipe,
+                                       const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                       const OptionalWhisperGenerationConfig& config,
+                                       const py::kwargs& kwargs) {
+    OptionalWhisperGenerationConfig base_config = config.has_value() ? config : pipe.get_generation_config();
+
+    auto updated_config = update_whisper_config_from_kwargs(base_config, kwargs);
+
+    std::vector<ov::genai::WhisperDecodedResults> res;
+    {
+        py::gil_scoped_release rel;
+        res = pipe.generate(raw_speech_inputs, updated_config);
+    }
+    return py::cast(res);
+}
+
 }  // namespace
 
 void init_whisper_pipeline(py::module_& m) {
@@ -332,6 +417,10 @@ void init_whisper_pipeline(py::module_& m) {
         .def_readwrite("return_timestamps", &WhisperGenerationConfig::return_timestamps)
         .def_readwrite("initial_prompt", &WhisperGenerationConfig::initial_prompt)
         .def_readwrite("hotwords", &WhisperGenerationConfig::hotwords)
+        .def_readwrite("stride_length", &WhisperGenerationConfig::stride_length)
+        .def_readwrite("vad_filter", &WhisperGenerationConfig::vad_filter)
+        .def_readwrite("word_timestamps", &WhisperGenerationConfig::word_timestamps)
+        .def_readwrite("alignment_heads", &WhisperGenerationConfig::alignment_heads)
         .def("update_generation_config", [](ov::genai::WhisperGenerationConfig& config, const py::kwargs& kwargs) {
             config.update_generation_config(pyutils::kwargs_to_any_map(kwargs));
         });
@@ -355,6 +444,15 @@ void init_whisper_pipeline(py::module_& m) {
             return pyutils::handle_utf8(chunk.text);
         });
 
+    py::class_<WhisperWordTiming>(m, "WhisperWordTiming", whisper_word_timing_docstring)
+        .def(py::init<>())
+        .def_property_readonly("word", [](WhisperWordTiming& word) {
+            return pyutils::handle_utf8(word.word);
+        })
+        .def_readonly("token_ids", &WhisperWordTiming::token_ids)
+        .def_readonly("start_ts", &WhisperWordTiming::start_ts)
+        .def_readonly("end_ts", &WhisperWordTiming::end_ts);
+
     py::class_<WhisperDecodedResults>(m, "WhisperDecodedResults", whisper_decoded_results_docstring)
         .def_property_readonly("texts",
                                [](const WhisperDecodedResults& dr) -> py::typing::List<py::str> {
@@ -362,6 +460,7 @@ void init_whisper_pipeline(py::module_& m) {
                                })
         .def_readonly("scores", &WhisperDecodedResults::scores)
         .def_readonly("chunks", &WhisperDecodedResults::chunks)
+        .def_readonly("words", &WhisperDecodedResults::words)
         .def_readonly("perf_metrics", &WhisperDecodedResults::perf_metrics)
         .def("__str__", [](const WhisperDecodedResults& dr) -> py::str {
             auto valid_utf8_strings = pyutils::handle_utf8((std::vector<std::string>)dr);
@@ -377,6 +476,15 @@ void init_whisper_pipeline(py::module_& m) {
             return res;
         });
 
+    py::class_<WhisperStreamingResult>(m, "WhisperStreamingResult", whisper_streaming_result_docstring)
+        .def(py::init<>())
+        .def_property_readonly("stable_text", [](WhisperStreamingResult& result) {
+            return pyutils::handle_utf8(result.stable_text);
+        })
+        .def_property_readonly("partial_text", [](WhisperStreamingResult& result) {
+            return pyutils::handle_utf8(result.partial_text);
+        });
+
     py::class_<WhisperPipeline>(m, "WhisperPipeline", "Automatic speech recognition pipeline")
         .def(
             py::init([](const std::filesystem::path& models_path, const std::string& device, const py::kwargs& kwargs) {
@@ -392,8 +500,30 @@ void init_whisper_pipeline(py::module_& m) {
             WhisperPipeline class constructor.
             models_path (os.PathLike): Path to the model file.
             device (str): Device to run the model on (e.g., CPU, GPU).
+            draft_decoder_path (str): Optional dir of a smaller Whisper model with the same tokenizer, e.g. distil-whisper,
+                whose decoder drafts the tokens for assisted generation.
+            word_timestamps (bool): Optional, whether the decoder computes the cross-attention weights of the alignment heads for
+                the word timestamps.
         )")
 
+        .def(
+            "generate",
+            [](WhisperPipeline& pipe,
+               const pyutils::RawSpeechBuffer& raw_speech_input,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const pyutils::PyBindStreamerVariant& streamer,
+               const py::kwargs& kwargs) -> py::typing::Union<ov::genai::WhisperDecodedResults> {
+                return call_whisper_common_generate(pipe, raw_speech_input.samples, generation_config, streamer, kwargs);
+            },
+            py::arg("raw_speech_input"),
+            "1D numpy array of float32 or float64 samples, or bytes of float32 PCM samples, which are copied at once. "
+            "Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.",
+            py::arg("generation_config") = std::nullopt,
+            "generation_config",
+            py::arg("streamer") = std::monostate(),
+            "streamer",
+            (whisper_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
+
         .def(
             "generate",
             [](WhisperPipeline& pipe,
@@ -412,7 +542,73 @@ void init_whisper_pipeline(py::module_& m) {
             "streamer",
             (whisper_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
 
+        .def(
+            "generate",
+            [](WhisperPipeline& pipe,
+               std::vector<pyutils::RawSpeechBuffer>& raw_speech_inputs,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const py::kwargs& kwargs) -> py::typing::List<ov::genai::WhisperDecodedResults> {
+                std::vector<RawSpeechInput> inputs;
+                inputs.reserve(raw_speech_inputs.size());
+                for (auto& raw_speech_input : raw_speech_inputs) {
+                    inputs.push_back(std::move(raw_speech_input.samples));
+                }
+                return call_whisper_batch_generate(pipe, inputs, generation_config, kwargs);
+            },
+            py::arg("raw_speech_inputs"),
+            "2D numpy array or list of raw speech audio buffers, each is copied at once. "
+            "Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.",
+            py::arg("generation_config") = std::nullopt,
+            "generation_config",
+            (whisper_batch_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
+
+        .def(
+            "generate",
+            [](WhisperPipeline& pipe,
+               const std::vector<RawSpeechInput>& raw_speech_inputs,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const py::kwargs& kwargs) -> py::typing::List<ov::genai::WhisperDecodedResults> {
+                return call_whisper_batch_generate(pipe, raw_speech_inputs, generation_config, kwargs);
+            },
+            py::arg("raw_speech_inputs"),
+            "List of raw speech audios, each is a list of floats. "
+            "Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.",
+            py::arg("generation_config") = std::nullopt,
+            "generation_config",
+            (whisper_batch_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
+
+        .def(
+            "start_stream",
+            [](WhisperPipeline& pipe,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const py::kwargs& kwargs) {
+                OptionalWhisperGenerationConfig base_config =
+                    generation_config.has_value() ? generation_config : pipe.get_generation_config();
+                pipe.start_stream(update_whisper_config_from_kwargs(base_config, kwargs));
+            },
+            py::arg("generation_config") = std::nullopt,
+            start_stream_docstring)
+        .def("push_audio",
+             [](WhisperPipeline& pipe, const pyutils::RawSpeechBuffer& audio_chunk) {
+                 py::gil_scoped_release rel;
+                 return pipe.push_audio(audio_chunk.samples);
+             },
+             py::arg("audio_chunk"),
+             "Appends a chunk of the stream audio given by a 1D numpy array or bytes of float32 PCM samples, normalized "
+             "to near [-1, 1] range with 16k Hz sampling rate, and returns the updated transcription.")
+        .def("push_audio",
+             &WhisperPipeline::push_audio,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("audio_chunk"),
+             "Appends a chunk of the stream audio, normalized to near [-1, 1] range with 16k Hz sampling rate, "
+             "and returns the updated transcription.")
+        .def("finish_stream",
+             &WhisperPipeline::finish_stream,
+             py::call_guard<py::gil_scoped_release>(),
+             "Finishes the stream, the rest of the transcription is returned as stable.")
         .def("get_tokenizer", &WhisperPipeline::get_tokenizer)
         .def("get_generation_config", &WhisperPipeline::get_generation_config, py::return_value_policy::copy)
-        .def("set_generation_config", &WhisperPipeline::set_generation_config, py::arg("config"));
+        .def("set_generation_config", &WhisperPipeline::set_generation_config, py::arg("config"))
+        .def("warmup", &WhisperPipeline::warmup, py::arg("config") = ov::genai::WarmupConfig(), py::call_guard<py::gil_scoped_release>(),
+             "Generates dummy inputs of the shapes of the config, so that the kernels for them are compiled before the first real requests.");
 }
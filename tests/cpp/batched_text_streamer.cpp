@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/batched_text_streamer.hpp"
+
+using namespace ov::genai;
+
+TEST(TestBatchedTextStreamer, streams_are_detokenized_by_pieces) {
+    std::vector<std::string> pieces = {"Hello", " world", "\xC3", "\xA9", "!"};
+    size_t num_decode_calls = 0;
+    BatchedTextStreamer streamer([&](const std::vector<std::vector<int64_t>>& lines) {
+        ++num_decode_calls;
+        return std::vector<std::string>(lines.size());
+    }, pieces);
+
+    std::string first_text, second_text;
+    bool is_first_ended = false;
+    streamer.add_stream(0, [&](const std::string& text) { first_text += text; });
+    streamer.add_stream(1, [&](const std::string& text) { second_text += text; });
+    streamer.write({{0, {0, 2}}, {1, {4}}});
+    streamer.write({{0, {3, 1}, true, [&] { is_first_ended = true; }}, {1, {0}}});
+    streamer.end();
+
+    EXPECT_EQ(first_text, "Hello\xC3\xA9 world");
+    EXPECT_TRUE(is_first_ended);
+    EXPECT_EQ(second_text, "!Hello");
+    EXPECT_EQ(num_decode_calls, 0);
+}
+
+TEST(TestBatchedTextStreamer, streams_are_decoded_in_one_batch) {
+    // token i is decoded to the letter 'a' + i, '\n' for 25
+    auto decode_line = [](const std::vector<int64_t>& line) {
+        std::string text;
+        for (int64_t token : line) {
+            text += token == 25 ? '\n' : static_cast<char>('a' + token);
+        }
+        return text;
+    };
+    std::vector<size_t> batch_sizes;
+    BatchedTextStreamer streamer([&](const std::vector<std::vector<int64_t>>& lines) {
+        batch_sizes.push_back(lines.size());
+        std::vector<std::string> texts;
+        for (const auto& line : lines) {
+            texts.push_back(decode_line(line));
+        }
+        return texts;
+    }, {});
+
+    std::vector<std::string> first_texts, second_texts;
+    streamer.add_stream(0, [&](const std::string& text) { first_texts.push_back(text); });
+    streamer.add_stream(1, [&](const std::string& text) { second_texts.push_back(text); });
+    streamer.write({{0, {0, 1}}, {1, {2}}});
+    streamer.write({{0, {2, 3}}, {1, {3}}});
+    streamer.write({{0, {25}}, {1, {4}}});
+    streamer.write({{0, {5}, true}, {1, {5}}});
+    streamer.write({{1, {}, true}});
+    streamer.end();
+
+    EXPECT_EQ(batch_sizes, std::vector<size_t>({2, 2, 2, 2, 1}));
+    // the text of the last 3 tokens is delayed until the new line or the end of the stream
+    EXPECT_EQ(first_texts, std::vector<std::string>({"abcd\n", "f"}));
+    EXPECT_EQ(second_texts, std::vector<std::string>({"c", "def"}));
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "benchmark_helper.hpp"
+
+#include <algorithm>
+
+#include "openvino/op/concat.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/parameter.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+std::shared_ptr<ov::op::v0::Parameter> create_parameter(const std::string& name, ov::element::Type type, const ov::PartialShape& shape) {
+    auto parameter = std::make_shared<ov::op::v0::Parameter>(type, shape);
+    parameter->get_output_tensor(0).set_names({name});
+    return parameter;
+}
+}  // namespace
+
+std::shared_ptr<CacheManager> create_tiny_cache_manager(size_t num_layers) {
+    ov::NodeVector keys, values;
+    ov::ParameterVector params;
+    const ov::PartialShape shape{ov::Dimension::dynamic(), 1, 1, 1};
+    for (size_t i = 0; i < num_layers; i++) {
+        keys.push_back(create_parameter("key_cache." + std::to_string(i), ov::element::f32, shape));
+        values.push_back(create_parameter("value_cache." + std::to_string(i), ov::element::f32, shape));
+        params.push_back(std::static_pointer_cast<ov::op::v0::Parameter>(keys.back()));
+        params.push_back(std::static_pointer_cast<ov::op::v0::Parameter>(values.back()));
+    }
+    auto concat_keys = std::make_shared<ov::op::v0::Concat>(keys, 1);
+    auto concat_values = std::make_shared<ov::op::v0::Concat>(values, 1);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{concat_keys, concat_values}, params);
+    ov::InferRequest request = utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+    return std::make_shared<CacheManager>(request);
+}
+
+ov::InferRequest create_paged_attention_request() {
+    const ov::PartialShape dynamic_1d{ov::Dimension::dynamic()};
+    auto input_ids = create_parameter("input_ids", ov::element::i64, dynamic_1d);
+    ov::ParameterVector params{
+        input_ids,
+        create_parameter("position_ids", ov::element::i64, dynamic_1d),
+        create_parameter("past_lens", ov::element::i32, dynamic_1d),
+        create_parameter("subsequence_begins", ov::element::i32, dynamic_1d),
+        create_parameter("block_indices", ov::element::i32, dynamic_1d),
+        create_parameter("block_indices_begins", ov::element::i32, dynamic_1d),
+        create_parameter("max_context_len", ov::element::i32, ov::PartialShape{}),
+    };
+    auto logits = std::make_shared<ov::op::v0::Convert>(input_ids, ov::element::f32);
+    logits->get_output_tensor(0).set_names({"logits"});
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{logits}, params);
+    return utils::singleton_core().compile_model(model, "CPU").create_infer_request();
+}
+
+std::vector<SequenceGroup::Ptr> create_sequence_groups(size_t num_groups, size_t prompt_len, const GenerationConfig& config) {
+    std::vector<SequenceGroup::Ptr> sequence_groups;
+    for (size_t group_idx = 0; group_idx < num_groups; ++group_idx) {
+        TokenIds prompt_ids(prompt_len);
+        for (size_t i = 0; i < prompt_len; ++i) {
+            prompt_ids[i] = static_cast<int64_t>(group_idx * prompt_len + i);
+        }
+        sequence_groups.push_back(std::make_shared<SequenceGroup>(group_idx, prompt_ids, config, BENCHMARK_BLOCK_SIZE));
+    }
+    return sequence_groups;
+}
+
+void process_prompts(Scheduler& scheduler, std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    auto is_prompt_processed = [](const SequenceGroup::Ptr& sequence_group) {
+        return sequence_group->get_num_processed_tokens() >= sequence_group->get_prompt_len();
+    };
+    while (!std::all_of(sequence_groups.begin(), sequence_groups.end(), is_prompt_processed)) {
+        Scheduler::Output scheduler_output = scheduler.schedule(sequence_groups);
+        OPENVINO_ASSERT(scheduler_output.m_total_num_scheduled_tokens > 0, "The KV cache is too small for the benchmarked sequence groups");
+        for (uint64_t sequence_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
+            if (sequence_group->requires_sampling()) {
+                for (const auto& sequence : sequence_group->get_running_sequences()) {
+                    sequence->append_token(0, 0.0f);
+                }
+            }
+            sequence_group->finish_iteration();
+        }
+    }
+}
+
+SchedulerConfig get_benchmark_scheduler_config(size_t num_groups, size_t context_len) {
+    SchedulerConfig config;
+    config.max_num_batched_tokens = num_groups * context_len;
+    config.max_num_seqs = num_groups;
+    // room for the blocks of the generated tokens
+    config.num_kv_blocks = num_groups * (context_len / BENCHMARK_BLOCK_SIZE + 2);
+    config.dynamic_split_fuse = true;
+    return config;
+}
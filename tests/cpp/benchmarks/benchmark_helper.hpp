@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "openvino/genai/generation_config.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "continuous_batching/cache_manager.hpp"
+#include "continuous_batching/scheduler.hpp"
+#include "sequence_group.hpp"
+
+// tokens per KV cache block on CPU
+constexpr size_t BENCHMARK_BLOCK_SIZE = 32;
+
+// KV cache of num_layers layers of a single element per token, so that large batches fit in memory
+std::shared_ptr<ov::genai::CacheManager> create_tiny_cache_manager(size_t num_layers);
+
+// a model with the inputs of a paged attention LLM, which returns the converted input ids as "logits"
+ov::InferRequest create_paged_attention_request();
+
+// the prompts of the different groups are different, so that they do not share the prefix cache
+std::vector<ov::genai::SequenceGroup::Ptr> create_sequence_groups(size_t num_groups, size_t prompt_len,
+                                                                  const ov::genai::GenerationConfig& config);
+
+// schedules the prompts of the groups and appends a generated token to each sequence, so that the groups are in the generation phase
+void process_prompts(ov::genai::Scheduler& scheduler, std::vector<ov::genai::SequenceGroup::Ptr>& sequence_groups);
+
+ov::genai::SchedulerConfig get_benchmark_scheduler_config(size_t num_groups, size_t context_len);
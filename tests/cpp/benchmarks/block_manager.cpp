@@ -0,0 +1,64 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_helper.hpp"
+#include "continuous_batching/block_manager.hpp"
+
+using namespace ov::genai;
+
+// with prefix caching the freed blocks stay in the cache, so that every allocation after the first one looks up the hashed blocks
+static void BM_BlockManagerAllocateFree(benchmark::State& state) {
+    const size_t num_blocks = state.range(0);
+    const bool enable_prefix_caching = state.range(1);
+    const size_t prompt_len = num_blocks * BENCHMARK_BLOCK_SIZE;
+    BlockManager block_manager(num_blocks, enable_prefix_caching, BENCHMARK_BLOCK_SIZE);
+    SequenceGroup::Ptr sequence_group = create_sequence_groups(1, prompt_len, ov::genai::greedy())[0];
+    Sequence::Ptr sequence = sequence_group->get_sequences()[0];
+
+    for (auto _ : state) {
+        block_manager.allocate(sequence, num_blocks, prompt_len);
+        block_manager.free_sequence(sequence->get_id());
+    }
+    state.SetItemsProcessed(state.iterations() * num_blocks);
+}
+BENCHMARK(BM_BlockManagerAllocateFree)->ArgsProduct({{1, 16, 256}, {0, 1}})->ArgNames({"blocks", "prefix_caching"});
+
+static void BM_BlockManagerForkFree(benchmark::State& state) {
+    const size_t num_blocks = state.range(0);
+    BlockManager block_manager(num_blocks, false, BENCHMARK_BLOCK_SIZE);
+    SequenceGroup::Ptr sequence_group = create_sequence_groups(1, num_blocks * BENCHMARK_BLOCK_SIZE, ov::genai::beam_search())[0];
+    const uint64_t parent_id = sequence_group->get_sequences()[0]->get_id();
+    // an id, which is not taken by the sequences created by the other benchmarks
+    const uint64_t child_id = parent_id + (uint64_t{1} << 40);
+    block_manager.allocate(sequence_group->get_sequences()[0], num_blocks);
+
+    for (auto _ : state) {
+        block_manager.fork_sequence(parent_id, child_id);
+        block_manager.free_sequence(child_id);
+    }
+    state.SetItemsProcessed(state.iterations() * num_blocks);
+}
+BENCHMARK(BM_BlockManagerForkFree)->Arg(1)->Arg(16)->Arg(256)->ArgName("blocks");
+
+// restores the whole prompt from the prefix cache, the way the pipeline does when a request is added
+static void BM_BlockManagerRestoreCachedBlocks(benchmark::State& state) {
+    const size_t num_blocks = state.range(0);
+    const size_t prompt_len = num_blocks * BENCHMARK_BLOCK_SIZE;
+    BlockManager block_manager(num_blocks, true, BENCHMARK_BLOCK_SIZE);
+    SequenceGroup::Ptr sequence_group = create_sequence_groups(1, prompt_len, ov::genai::greedy())[0];
+    Sequence::Ptr sequence = sequence_group->get_sequences()[0];
+    block_manager.allocate(sequence, num_blocks, prompt_len);
+    block_manager.free_sequence(sequence->get_id());
+
+    for (auto _ : state) {
+        block_manager.restore_cached_blocks(sequence_group);
+        state.PauseTiming();
+        sequence_group->update_processed_tokens_num(0);
+        block_manager.free_sequence(sequence->get_id());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * num_blocks);
+}
+BENCHMARK(BM_BlockManagerRestoreCachedBlocks)->Arg(16)->Arg(256)->ArgName("blocks");
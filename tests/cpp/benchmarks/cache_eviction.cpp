@@ -0,0 +1,39 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "benchmark_helper.hpp"
+#include "continuous_batching/cache_eviction.hpp"
+
+using namespace ov::genai;
+
+namespace {
+constexpr size_t NUM_DECODER_LAYERS = 32;
+constexpr size_t MAX_POOL_WINDOW_SIZE = 8;
+}  // namespace
+
+// the scores of the tokens in the KV cache of all layers after a generation step
+static void BM_EvictionScoreAggregation(benchmark::State& state, AggregationMode aggregation_mode) {
+    const size_t context_len = state.range(0);
+    EvictionScoreManager score_manager(BENCHMARK_BLOCK_SIZE, NUM_DECODER_LAYERS, MAX_POOL_WINDOW_SIZE, aggregation_mode);
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    AttentionScoresForEachDecoderLayer scores;
+    for (size_t layer_idx = 0; layer_idx < NUM_DECODER_LAYERS; ++layer_idx) {
+        scores.emplace_back(ov::element::f32, ov::Shape{context_len});
+        float* scores_data = scores.back().data<float>();
+        for (size_t i = 0; i < context_len; ++i) {
+            scores_data[i] = distribution(generator);
+        }
+    }
+
+    for (auto _ : state) {
+        score_manager.register_new_token_scores(scores, {});
+    }
+    state.SetItemsProcessed(state.iterations() * context_len * NUM_DECODER_LAYERS);
+}
+BENCHMARK_CAPTURE(BM_EvictionScoreAggregation, sum, AggregationMode::SUM)->Arg(1024)->Arg(8192)->ArgName("context");
+BENCHMARK_CAPTURE(BM_EvictionScoreAggregation, norm_sum, AggregationMode::NORM_SUM)->Arg(1024)->Arg(8192)->ArgName("context");
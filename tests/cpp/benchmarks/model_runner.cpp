@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_helper.hpp"
+#include "continuous_batching/model_runner.hpp"
+
+using namespace ov::genai;
+
+// the preparation of the paged attention inputs of a generation step including the block indices, the inference of the
+// dummy model only converts the input ids
+static void BM_ModelRunnerGenerationStep(benchmark::State& state) {
+    const size_t num_groups = state.range(0);
+    const size_t context_len = state.range(1);
+    const SchedulerConfig config = get_benchmark_scheduler_config(num_groups, context_len);
+    Scheduler scheduler(BENCHMARK_BLOCK_SIZE, create_tiny_cache_manager(1), config);
+    std::vector<SequenceGroup::Ptr> sequence_groups = create_sequence_groups(num_groups, context_len, ov::genai::greedy());
+    process_prompts(scheduler, sequence_groups);
+    const Scheduler::Output scheduler_output = scheduler.schedule(sequence_groups);
+    ModelRunner model_runner(create_paged_attention_request(), BENCHMARK_BLOCK_SIZE);
+
+    for (auto _ : state) {
+        ov::Tensor logits = model_runner.forward(sequence_groups, scheduler_output);
+        benchmark::DoNotOptimize(logits);
+    }
+    state.SetItemsProcessed(state.iterations() * scheduler_output.m_total_num_scheduled_tokens);
+}
+BENCHMARK(BM_ModelRunnerGenerationStep)->ArgsProduct({{1, 32, 256}, {128, 2048}})->ArgNames({"groups", "context"});
+
+static void BM_ModelRunnerPromptStep(benchmark::State& state) {
+    const size_t num_groups = state.range(0);
+    const size_t prompt_len = state.range(1);
+    const SchedulerConfig config = get_benchmark_scheduler_config(num_groups, prompt_len);
+    Scheduler scheduler(BENCHMARK_BLOCK_SIZE, create_tiny_cache_manager(1), config);
+    std::vector<SequenceGroup::Ptr> sequence_groups = create_sequence_groups(num_groups, prompt_len, ov::genai::greedy());
+    const Scheduler::Output scheduler_output = scheduler.schedule(sequence_groups);
+    ModelRunner model_runner(create_paged_attention_request(), BENCHMARK_BLOCK_SIZE);
+
+    for (auto _ : state) {
+        ov::Tensor logits = model_runner.forward(sequence_groups, scheduler_output);
+        benchmark::DoNotOptimize(logits);
+    }
+    state.SetItemsProcessed(state.iterations() * scheduler_output.m_total_num_scheduled_tokens);
+}
+BENCHMARK(BM_ModelRunnerPromptStep)->ArgsProduct({{1, 32}, {128, 2048}})->ArgNames({"groups", "prompt"});
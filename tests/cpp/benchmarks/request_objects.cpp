@@ -0,0 +1,44 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_helper.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// tokens generated by the short requests, e.g. the labels of a classification
+constexpr size_t NUM_GENERATED_TOKENS = 4;
+}  // namespace
+
+// the lifetime of the objects of a request without the inference: the group, its handle and the sequences are created
+// as by ContinuousBatchingPipeline::add_request, the tokens are appended and the objects are freed once the request is read;
+// make_shared allocates the group and the handle on the heap for the comparison
+static void BM_RequestObjects(benchmark::State& state, bool is_pooled) {
+    const size_t prompt_len = state.range(0);
+    const size_t num_sequences = state.range(1);
+    GenerationConfig config = ov::genai::greedy();
+    config.max_new_tokens = NUM_GENERATED_TOKENS;
+    TokenIds prompt_ids(prompt_len, 1);
+    const ov::Tensor prompt(ov::element::i64, {1, prompt_len}, prompt_ids.data());
+
+    for (auto _ : state) {
+        SequenceGroup::Ptr sequence_group = is_pooled ? make_pooled<SequenceGroup>(0, prompt, config, BENCHMARK_BLOCK_SIZE)
+                                                      : std::make_shared<SequenceGroup>(0, prompt, config, BENCHMARK_BLOCK_SIZE);
+        GenerationHandle handle = is_pooled ? make_pooled<GenerationHandleImpl>(sequence_group->get_generation_stream(), config)
+                                            : std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), config);
+        for (size_t sequence_idx = 1; sequence_idx < num_sequences; ++sequence_idx) {
+            sequence_group->fork_sequence(sequence_group->get_sequences().front());
+        }
+        for (size_t token_idx = 0; token_idx < NUM_GENERATED_TOKENS; ++token_idx) {
+            for (const Sequence::Ptr& sequence : sequence_group->get_running_sequences()) {
+                sequence->append_token(static_cast<int64_t>(token_idx), 0.0f);
+            }
+        }
+        benchmark::DoNotOptimize(sequence_group->get_sequences().back()->get_generated_len());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_RequestObjects, pooled, true)->ArgsProduct({{16, 512}, {1, 4}})->ArgNames({"prompt", "sequences"});
+BENCHMARK_CAPTURE(BM_RequestObjects, make_shared, false)->ArgsProduct({{16, 512}, {1, 4}})->ArgNames({"prompt", "sequences"});
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "benchmark_helper.hpp"
+#include "sampling/sampler.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// tokens generated by the sampler per iteration
+constexpr size_t NUM_STEPS = 8;
+
+enum class Strategy { GREEDY, MULTINOMIAL, BEAM_SEARCH };
+
+GenerationConfig get_generation_config(Strategy strategy) {
+    GenerationConfig config;
+    switch (strategy) {
+    case Strategy::GREEDY:
+        config = ov::genai::greedy();
+        break;
+    case Strategy::MULTINOMIAL:
+        config = ov::genai::multinomial();
+        config.top_k = 50;
+        config.top_p = 0.9f;
+        config.num_return_sequences = 1;
+        config.min_new_tokens = 0;
+        break;
+    case Strategy::BEAM_SEARCH:
+        config = ov::genai::beam_search();
+        config.num_beam_groups = 1;
+        config.diversity_penalty = 0.0f;
+        config.num_return_sequences = 1;
+        break;
+    }
+    config.max_new_tokens = NUM_STEPS;
+    config.ignore_eos = true;
+    return config;
+}
+
+ov::Tensor get_random_logits(size_t num_rows, size_t vocab_size) {
+    ov::Tensor logits(ov::element::f32, {num_rows, 1, vocab_size});
+    std::mt19937 generator(42);
+    std::normal_distribution<float> distribution(0.0f, 4.0f);
+    float* logits_data = logits.data<float>();
+    for (size_t i = 0; i < logits.get_size(); ++i) {
+        logits_data[i] = distribution(generator);
+    }
+    return logits;
+}
+}  // namespace
+
+// NUM_STEPS tokens of the batch of the single token prompts, the logits of the steps are the same
+static void BM_Sampler(benchmark::State& state, Strategy strategy) {
+    const size_t vocab_size = state.range(0);
+    const size_t batch_size = state.range(1);
+    const GenerationConfig config = get_generation_config(strategy);
+    const ov::Tensor logits = get_random_logits(batch_size * config.num_beams, vocab_size);
+    Sampler sampler;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<SequenceGroup::Ptr> sequence_groups = create_sequence_groups(batch_size, 1, config);
+        state.ResumeTiming();
+
+        for (size_t step = 0; step < NUM_STEPS; ++step) {
+            for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+                sequence_group->schedule_tokens(1);
+            }
+            SamplerOutput sampler_output = sampler.sample(sequence_groups, logits);
+            benchmark::DoNotOptimize(sampler_output);
+            for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+                sequence_group->finish_iteration();
+            }
+        }
+
+        state.PauseTiming();
+        for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+            sampler.clear_request_info(sequence_group->get_request_id());
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_STEPS * batch_size);
+}
+BENCHMARK_CAPTURE(BM_Sampler, greedy, Strategy::GREEDY)->ArgsProduct({{32000, 151936}, {1, 32}})->ArgNames({"vocab", "batch"});
+BENCHMARK_CAPTURE(BM_Sampler, multinomial, Strategy::MULTINOMIAL)->ArgsProduct({{32000, 151936}, {1, 32}})->ArgNames({"vocab", "batch"});
+BENCHMARK_CAPTURE(BM_Sampler, beam_search, Strategy::BEAM_SEARCH)->ArgsProduct({{32000, 151936}, {1, 32}})->ArgNames({"vocab", "batch"});
@@ -0,0 +1,53 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_helper.hpp"
+
+using namespace ov::genai;
+
+// a generation step of the groups in the generation phase, the tokens are not processed, so each iteration schedules the same step
+static void BM_SchedulerGenerationStep(benchmark::State& state) {
+    const size_t num_groups = state.range(0);
+    const size_t context_len = state.range(1);
+    const SchedulerConfig config = get_benchmark_scheduler_config(num_groups, context_len);
+    Scheduler scheduler(BENCHMARK_BLOCK_SIZE, create_tiny_cache_manager(1), config);
+    std::vector<SequenceGroup::Ptr> sequence_groups = create_sequence_groups(num_groups, context_len, ov::genai::greedy());
+    process_prompts(scheduler, sequence_groups);
+
+    for (auto _ : state) {
+        for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+            sequence_group->clear_scheduled_tokens();
+        }
+        Scheduler::Output scheduler_output = scheduler.schedule(sequence_groups);
+        benchmark::DoNotOptimize(scheduler_output);
+    }
+    state.SetItemsProcessed(state.iterations() * num_groups);
+}
+BENCHMARK(BM_SchedulerGenerationStep)->ArgsProduct({{1, 32, 256}, {128, 2048}})->ArgNames({"groups", "context"});
+
+// schedules the prompts of the new groups and frees them afterwards
+static void BM_SchedulerPromptStep(benchmark::State& state) {
+    const size_t num_groups = state.range(0);
+    const size_t prompt_len = state.range(1);
+    const SchedulerConfig config = get_benchmark_scheduler_config(num_groups, prompt_len);
+    Scheduler scheduler(BENCHMARK_BLOCK_SIZE, create_tiny_cache_manager(1), config);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<SequenceGroup::Ptr> sequence_groups = create_sequence_groups(num_groups, prompt_len, ov::genai::greedy());
+        state.ResumeTiming();
+
+        Scheduler::Output scheduler_output = scheduler.schedule(sequence_groups);
+        benchmark::DoNotOptimize(scheduler_output);
+
+        state.PauseTiming();
+        for (const SequenceGroup::Ptr& sequence_group : sequence_groups) {
+            scheduler.free_sequence(sequence_group->get_sequences()[0]->get_id());
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * num_groups * prompt_len);
+}
+BENCHMARK(BM_SchedulerPromptStep)->ArgsProduct({{1, 32}, {128, 2048}})->ArgNames({"groups", "prompt"});
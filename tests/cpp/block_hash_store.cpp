@@ -7,6 +7,7 @@
 #include "continuous_batching/scheduler.hpp"
 #include <chrono>
 #include <thread>
+#include <iostream>
 
 TEST(TestBlockHashStore, general_test) {
     ov::genai::OverwritableBlocksHashStore block_hash_store(1);
@@ -52,3 +53,78 @@ TEST(TestBlockHashStore, general_test) {
     EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
     EXPECT_EQ(block_hash_store.num_blocks(), 0);
 }
+
+TEST(TestBlockHashStore, lru_overwrite_follows_timestamps) {
+    ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+    auto now = std::chrono::steady_clock::now();
+    // added in an order not matching the timestamps
+    for (size_t block_idx : {3, 0, 4, 1, 2}) {
+        auto block = std::make_shared<ov::genai::KVCacheBlock>(block_idx);
+        block->set_hash(block_idx);
+        block->set_timestamp(now + std::chrono::seconds(block_idx));
+        block_hash_store.add(ov::genai::BlocksPerLayer{block});
+    }
+    EXPECT_EQ(block_hash_store.get_block_to_restore(1)[0]->get_index(), 1);
+
+    for (int expected_block_idx : {0, 2, 3, 4}) {
+        EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), expected_block_idx);
+    }
+    EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
+}
+
+TEST(TestBlockHashStore, DISABLED_benchmark_lru_overwrite) {
+    // the per-block cost of add / restore / overwrite should stay flat as the store grows
+    for (size_t num_blocks : {1000, 10000, 100000, 1000000}) {
+        ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+        std::vector<ov::genai::KVCacheBlock::Ptr> blocks;
+        blocks.reserve(num_blocks);
+        auto base_timestamp = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < num_blocks; i++) {
+            // add in an order not matching the timestamps
+            size_t block_idx = (i * 7919) % num_blocks;
+            auto block = std::make_shared<ov::genai::KVCacheBlock>(block_idx);
+            block->set_hash(block_idx);
+            block->set_timestamp(base_timestamp + std::chrono::microseconds(block_idx));
+            blocks.push_back(block);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& block : blocks) {
+            block_hash_store.add(ov::genai::BlocksPerLayer{block});
+        }
+        // restore every fourth block
+        for (size_t block_idx = 0; block_idx < num_blocks; block_idx += 4) {
+            ASSERT_EQ(static_cast<size_t>(block_hash_store.get_block_to_restore(block_idx)[0]->get_index()), block_idx);
+        }
+        size_t expected_block_idx = 1;
+        while (block_hash_store.num_blocks() > 0) {
+            if (expected_block_idx % 4 == 0) {
+                expected_block_idx++;
+            }
+            ASSERT_EQ(static_cast<size_t>(block_hash_store.get_lru_block_to_overwrite()[0]->get_index()), expected_block_idx);
+            expected_block_idx++;
+        }
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "OverwritableBlocksHashStore with " << num_blocks << " blocks: "
+                  << static_cast<double>(duration.count()) / num_blocks << " us per block" << std::endl;
+        EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
+    }
+}
+
+TEST(TestBlockHashStore, pinned_blocks_are_overwritten_last) {
+    ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+    auto now = std::chrono::steady_clock::now();
+    for (size_t block_idx = 0; block_idx < 3; ++block_idx) {
+        auto block = std::make_shared<ov::genai::KVCacheBlock>(block_idx);
+        block->set_hash(100 + block_idx);
+        block->set_timestamp(now + std::chrono::seconds(block_idx));
+        block_hash_store.add(ov::genai::BlocksPerLayer{block});
+    }
+    block_hash_store.set_pinned_hashes({100, 101});
+
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 2);
+    // only the pinned blocks are left
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 0);
+    EXPECT_EQ(block_hash_store.get_block_to_restore(101)[0]->get_index(), 1);
+    EXPECT_EQ(block_hash_store.num_blocks(), 0);
+}
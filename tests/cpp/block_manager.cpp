@@ -112,4 +112,233 @@ TEST(TestBlockManager, CanFreeBlocksFromSequence) {
     for (auto& sequence : sequence_group->get_sequences()) {
         bm.free_sequence(sequence->get_id());
     }
-}
\ No newline at end of file
+}
+TEST(TestBlockManager, KeepsPrefixBlocksBeforeEvictedOnesCached) {
+    const size_t BLOCK_SIZE = 2;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(8, true, BLOCK_SIZE, 2);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto create_sequence_group = [&](uint64_t request_id) {
+        return std::make_shared<ov::genai::SequenceGroup>(
+                request_id,
+                ov::Tensor(ov::element::i64, {
+                        tokens.size()}, tokens.data()),
+                ov::genai::greedy(),
+                BLOCK_SIZE);
+    };
+    auto sequence_group = create_sequence_group(0);
+    bm.restore_cached_blocks(sequence_group);
+    sequence_group->schedule_tokens(tokens.size());
+    bm.append_slots(sequence_group);
+
+    size_t seq_id = sequence_group->get_sequences()[0]->get_id();
+    bm.free_blocks_from_sequence(seq_id, { {2}, {1} });
+    sequence_group->register_token_eviction(BLOCK_SIZE);
+    for (size_t layer_idx = 0; layer_idx < 2; layer_idx++) {
+        const auto& block_table = bm.get_block_table(seq_id, layer_idx);
+        ASSERT_EQ(block_table.size(), 3);
+        // blocks past the first evicted one are shifted in at least one of the layers
+        EXPECT_TRUE(block_table[0]->is_hashed());
+        EXPECT_FALSE(block_table[1]->is_hashed());
+        EXPECT_FALSE(block_table[2]->is_hashed());
+    }
+
+    // blocks allocated after the eviction are not hashed either
+    sequence_group->finish_iteration();
+    sequence_group->get_sequences()[0]->append_token(8, 1.0);
+    sequence_group->schedule_tokens(1);
+    bm.append_slots(sequence_group);
+    EXPECT_FALSE(bm.get_block_table(seq_id, 0).back()->is_hashed());
+    bm.free_sequence(seq_id);
+
+    auto new_sequence_group = create_sequence_group(1);
+    bm.restore_cached_blocks(new_sequence_group);
+    EXPECT_EQ(new_sequence_group->get_num_processed_tokens(), BLOCK_SIZE);
+    bm.free_sequence(new_sequence_group->get_sequences()[0]->get_id());
+}
+
+TEST(TestBlockManager, CanSwapOutAndSwapInSequenceGroup) {
+    const size_t BLOCK_SIZE = 4;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(6, false, BLOCK_SIZE, 2);
+    bm.set_num_swap_blocks(4);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5};
+    ov::genai::SequenceGroup::Ptr sequence_group = std::make_shared<ov::genai::SequenceGroup>(
+            0,
+            ov::Tensor(ov::element::i64, {
+                    tokens.size()}, tokens.data()),
+            ov::genai::beam_search(),
+            BLOCK_SIZE);
+    sequence_group->schedule_tokens(6);
+    bm.append_slots(sequence_group);
+    sequence_group->finish_iteration();
+
+    auto parent_sequence = sequence_group->get_running_sequences()[0];
+    auto forked_sequence = sequence_group->fork_sequence(parent_sequence);
+    bm.fork_sequence(parent_sequence->get_id(), forked_sequence->get_id());
+    ASSERT_EQ(bm.num_free_blocks(), 4);
+
+    // shared blocks only occupy a single swap block
+    ASSERT_TRUE(bm.can_swap_out(sequence_group));
+    auto swap_out_map = bm.swap_out(sequence_group);
+    ASSERT_EQ(swap_out_map.size(), 2);
+    for (const auto& layer_swap_out_map : swap_out_map) {
+        EXPECT_EQ(layer_swap_out_map.size(), 2);
+    }
+    EXPECT_EQ(bm.num_free_blocks(), 6);
+    EXPECT_EQ(bm.num_free_swap_blocks(), 2);
+    EXPECT_TRUE(bm.is_swapped_out(sequence_group));
+    EXPECT_FALSE(bm.has_block_table(parent_sequence->get_id()));
+    EXPECT_FALSE(bm.has_block_table(forked_sequence->get_id()));
+
+    EXPECT_EQ(bm.required_blocks_count_for_swap_in(sequence_group), 2);
+    auto swap_in_map = bm.swap_in(sequence_group);
+    ASSERT_EQ(swap_in_map.size(), 2);
+    for (size_t layer_idx = 0; layer_idx < swap_in_map.size(); layer_idx++) {
+        EXPECT_EQ(swap_in_map[layer_idx].size(), 2);
+        // each swap block is restored into a single fresh block
+        for (const auto& swap_block_and_block : swap_out_map[layer_idx]) {
+            EXPECT_EQ(swap_in_map[layer_idx].count(swap_block_and_block.second), 1);
+        }
+    }
+    EXPECT_FALSE(bm.is_swapped_out(sequence_group));
+    EXPECT_EQ(bm.num_free_swap_blocks(), 4);
+    EXPECT_EQ(bm.num_free_blocks(), 4);
+    for (size_t layer_idx = 0; layer_idx < 2; layer_idx++) {
+        const auto& parent_block_table = bm.get_block_table(parent_sequence->get_id(), layer_idx);
+        const auto& forked_block_table = bm.get_block_table(forked_sequence->get_id(), layer_idx);
+        ASSERT_EQ(parent_block_table.size(), 2);
+        ASSERT_EQ(forked_block_table.size(), 2);
+        for (size_t i = 0; i < parent_block_table.size(); i++) {
+            EXPECT_EQ(parent_block_table[i], forked_block_table[i]);
+            EXPECT_EQ(parent_block_table[i]->get_references_count(), 2);
+        }
+    }
+
+    for (auto& sequence : sequence_group->get_sequences()) {
+        bm.free_sequence(sequence->get_id());
+    }
+}
+
+TEST(TestBlockManager, CannotSwapOutWithoutSwapSpace) {
+    const size_t BLOCK_SIZE = 4;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(6, false, BLOCK_SIZE, 1);
+    bm.set_num_swap_blocks(1);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5};
+    ov::genai::SequenceGroup::Ptr sequence_group = std::make_shared<ov::genai::SequenceGroup>(
+            0,
+            ov::Tensor(ov::element::i64, {
+                    tokens.size()}, tokens.data()),
+            ov::genai::greedy(),
+            BLOCK_SIZE);
+    sequence_group->schedule_tokens(6);
+    bm.append_slots(sequence_group);
+    EXPECT_FALSE(bm.can_swap_out(sequence_group));
+
+    bm.free_sequence(sequence_group->get_sequences()[0]->get_id());
+}
+
+TEST(TestBlockManager, CompactsOccupiedBlocksToTheBeginning) {
+    const size_t BLOCK_SIZE = 4;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(8, false, BLOCK_SIZE, 2);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    std::vector<ov::genai::Sequence::Ptr> sequences;
+    for (uint64_t request_id = 0; request_id < 3; request_id++) {
+        ov::genai::SequenceGroup::Ptr sequence_group = std::make_shared<ov::genai::SequenceGroup>(
+                request_id,
+                ov::Tensor(ov::element::i64, {
+                        tokens.size()}, tokens.data()),
+                ov::genai::greedy(),
+                BLOCK_SIZE);
+        sequences.push_back(sequence_group->get_sequences()[0]);
+        bm.allocate(sequences.back(), 2);
+    }
+    // blocks 0, 1 are freed, blocks 4, 5 are the only ones past the 4 occupied blocks
+    bm.free_sequence(sequences[0]->get_id());
+    EXPECT_EQ(bm.get_min_number_of_kv_blocks(), 6);
+
+    auto block_copy_map = bm.compact_blocks();
+    std::map<size_t, std::list<size_t>> expected_block_copy_map = {{4, {0}}, {5, {1}}};
+    EXPECT_EQ(block_copy_map, expected_block_copy_map);
+    for (size_t layer_idx = 0; layer_idx < 2; layer_idx++) {
+        const auto& block_table = bm.get_block_table(sequences[2]->get_id(), layer_idx);
+        EXPECT_EQ(block_table[0]->get_index(), 0);
+        EXPECT_EQ(block_table[1]->get_index(), 1);
+        EXPECT_EQ(bm.get_block_table(sequences[1]->get_id(), layer_idx)[0]->get_index(), 2);
+    }
+    EXPECT_EQ(bm.get_min_number_of_kv_blocks(), 4);
+    EXPECT_TRUE(bm.compact_blocks().empty());
+
+    // the free blocks past the occupied ones are removed
+    bm.decrease_kv_blocks_number(4);
+    EXPECT_EQ(bm.get_total_number_of_kv_blocks(), 4);
+    EXPECT_EQ(bm.num_free_blocks(), 0);
+
+    bm.free_sequence(sequences[1]->get_id());
+    bm.free_sequence(sequences[2]->get_id());
+    EXPECT_EQ(bm.num_free_blocks(), 4);
+}
+
+TEST(TestBlockManager, DoesNotCompactBlocksOfDivergedLayers) {
+    const size_t BLOCK_SIZE = 4;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(8, false, BLOCK_SIZE, 2);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    ov::genai::SequenceGroup::Ptr sequence_group = std::make_shared<ov::genai::SequenceGroup>(
+            0,
+            ov::Tensor(ov::element::i64, {
+                    tokens.size()}, tokens.data()),
+            ov::genai::greedy(),
+            BLOCK_SIZE);
+    auto sequence = sequence_group->get_sequences()[0];
+    bm.allocate(sequence, 3);
+    bm.free_blocks_from_sequence(sequence->get_id(), { {0}, {1} });
+
+    EXPECT_TRUE(bm.compact_blocks().empty());
+    bm.free_sequence(sequence->get_id());
+}
+
+TEST(TestBlockManager, embeddings_hash_depends_on_all_values) {
+    const auto make_hash = [](float value, size_t position) {
+        std::vector<float> embeddings(4 * 64, 0.5f);
+        embeddings[position] = value;
+        ov::genai::SequenceGroup::Ptr sequence_group = std::make_shared<ov::genai::SequenceGroup>(
+            0,
+            ov::Tensor(ov::element::f32, {1, 4, 64}, embeddings.data()),
+            ov::genai::greedy(),
+            4);
+        return sequence_group->get_sequences()[0]->get_hash(4);
+    };
+    EXPECT_EQ(make_hash(0.5f, 0), make_hash(0.5f, 100));
+    // every value of the embeddings is hashed
+    EXPECT_NE(make_hash(0.25f, 1), make_hash(0.5f, 1));
+    EXPECT_NE(make_hash(0.25f, 4 * 64 - 1), make_hash(0.5f, 4 * 64 - 1));
+    EXPECT_NE(make_hash(0.25f, 1), make_hash(0.25f, 65));
+}
+
+TEST(TestBlockManager, tokens_hash_is_chained_to_the_prefix) {
+    const auto make_sequence_group = [](std::vector<int64_t> prompt_ids, std::vector<int64_t> generated_ids) {
+        ov::genai::SequenceGroup::Ptr sequence_group = std::make_shared<ov::genai::SequenceGroup>(
+            0,
+            ov::Tensor(ov::element::i64, {prompt_ids.size()}, prompt_ids.data()),
+            ov::genai::greedy(),
+            4);
+        for (int64_t token_id : generated_ids) {
+            sequence_group->get_sequences()[0]->append_token(token_id, 0.5f);
+        }
+        return sequence_group;
+    };
+    // the hash doesn't depend on which tokens were generated, e.g. for the history of a chat restored at the next turn
+    auto prompt = make_sequence_group({0, 1, 2, 3, 4, 5, 6, 7}, {});
+    auto generated = make_sequence_group({0, 1, 2, 3, 4, 5}, {6, 7});
+    EXPECT_EQ(prompt->get_sequences()[0]->get_hash(8), generated->get_sequences()[0]->get_hash(8));
+    EXPECT_EQ(prompt->get_sequences()[0]->get_hash(6), generated->get_sequences()[0]->get_hash(6));
+
+    // the blocks with the same tokens differ by their prefixes
+    auto other_prefix = make_sequence_group({9, 1, 2, 3, 4, 5, 6, 7}, {});
+    EXPECT_NE(prompt->get_sequences()[0]->get_hash(4), other_prefix->get_sequences()[0]->get_hash(4));
+    EXPECT_NE(prompt->get_sequences()[0]->get_hash(8), other_prefix->get_sequences()[0]->get_hash(8));
+    EXPECT_NE(prompt->get_sequences()[0]->get_hash(4), prompt->get_sequences()[0]->get_hash(8));
+}
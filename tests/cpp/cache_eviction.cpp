@@ -41,10 +41,10 @@ TEST(EvictionScoreManager, CanRegisterNewScores) {
 
 struct EvictionScoreManagerAddWithSkipsTestStruct {
     size_t block_size;
-    std::vector<double> src;
+    std::vector<float> src;
     std::set<size_t> skipped_logical_block_ids;
-    std::vector<double> dst_before;
-    std::vector<double> ref_dst_after;
+    std::vector<float> dst_before;
+    std::vector<float> ref_dst_after;
 };
 
 using EvictionScoreManagerAddWithSkipsParameterizedTest = ::testing::TestWithParam<EvictionScoreManagerAddWithSkipsTestStruct>;
@@ -165,7 +165,7 @@ TEST_P(EvictionScoreManagerAddWithSkipsParameterizedTest, CanAddWithSkips) {
     auto dst = test_struct.dst_before;
     mgr.add_with_skips(dst, test_struct.src, test_struct.skipped_logical_block_ids);
     EXPECT_EQ(dst.size(), test_struct.dst_before.size());
-    EXPECT_EQ(dst, test_struct.ref_dst_after);
+    EXPECT_THAT(dst, ::testing::Pointwise(::testing::FloatEq(), test_struct.ref_dst_after));
 }
 
 INSTANTIATE_TEST_SUITE_P(VariousInputs, EvictionScoreManagerAddWithSkipsParameterizedTest, ::testing::ValuesIn(ADD_WITH_SKIPS_TEST_CASES));
@@ -363,9 +363,10 @@ TEST_P(EvictionScoreManagerRegisterScoresParameterizedTest, ScoresAndCountersAft
     ASSERT_EQ(test_scores.size(), DEFAULT_NUM_DECODER_LAYERS);
     ASSERT_EQ(test_counters.size(), DEFAULT_NUM_DECODER_LAYERS);
 
-    float abs_tol = 1e-6;
+    // scores are accumulated in single precision
+    float abs_tol = 1e-5;
     for (size_t layer_idx = 0; layer_idx < DEFAULT_NUM_DECODER_LAYERS; layer_idx++) {
-        EXPECT_THAT(test_scores[layer_idx], ::testing::Pointwise(::testing::DoubleNear(abs_tol), test_struct.ref_scores[layer_idx]));
+        EXPECT_THAT(test_scores[layer_idx], ::testing::Pointwise(::testing::FloatNear(abs_tol), test_struct.ref_scores[layer_idx]));
         EXPECT_EQ(mgr.get_counters(), test_struct.ref_counters);
     }
 }
@@ -375,6 +376,27 @@ INSTANTIATE_TEST_SUITE_P(VariousInputs, EvictionScoreManagerRegisterScoresParame
                              return info.param.test_id;
                          });
 
+TEST(EvictionScoreManager, ParallelRegistrationMatchesSerialRegistration) {
+    constexpr size_t num_decoder_layers = 13;
+    ov::genai::EvictionScoreManager serial_mgr(DEFAULT_BLOCK_SIZE, num_decoder_layers, DEFAULT_MAX_POOL_WINDOW_SIZE, DEFAULT_AGGREGATION_MODE, 1);
+    ov::genai::EvictionScoreManager parallel_mgr(DEFAULT_BLOCK_SIZE, num_decoder_layers, DEFAULT_MAX_POOL_WINDOW_SIZE, DEFAULT_AGGREGATION_MODE, 1);
+    ThreadPool thread_pool(4);
+
+    for (size_t seq_len : {37, 38, 39, 43}) {
+        std::vector<std::vector<float>> scores(num_decoder_layers, std::vector<float>(seq_len));
+        for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+            for (size_t token_idx = 0; token_idx < seq_len; token_idx++) {
+                scores[layer_idx][token_idx] = static_cast<float>((layer_idx * 7 + token_idx * 13) % 17) / 17.0f;
+            }
+        }
+        serial_mgr.register_new_token_scores(get_layer_scores_from_2d_vector(scores), {});
+        parallel_mgr.register_new_token_scores(get_layer_scores_from_2d_vector(scores), {}, 0, &thread_pool);
+    }
+
+    EXPECT_EQ(parallel_mgr.get_scores(), serial_mgr.get_scores());
+    EXPECT_EQ(parallel_mgr.get_counters(), serial_mgr.get_counters());
+}
+
 struct EvictionScoreManagerSnapKVCounterTestStruct {
     std::string test_id;
     size_t snapkv_window_size;
@@ -548,9 +570,10 @@ TEST_P(EvictionScoreManagerRemoveScoresParameterizedTest, ScoresAndCountersAfter
     ASSERT_EQ(test_scores.size(), DEFAULT_NUM_DECODER_LAYERS);
     ASSERT_EQ(test_counters.size(), DEFAULT_NUM_DECODER_LAYERS);
 
-    float abs_tol = 1e-6;
+    // scores are accumulated in single precision
+    float abs_tol = 1e-5;
     for (size_t layer_idx = 0; layer_idx < DEFAULT_NUM_DECODER_LAYERS; layer_idx++) {
-        EXPECT_THAT(test_scores[layer_idx], ::testing::Pointwise(::testing::DoubleNear(abs_tol), test_struct.ref_scores[layer_idx]));
+        EXPECT_THAT(test_scores[layer_idx], ::testing::Pointwise(::testing::FloatNear(abs_tol), test_struct.ref_scores[layer_idx]));
         EXPECT_EQ(mgr.get_counters(), test_struct.ref_counters);
     }
 }
@@ -735,6 +758,18 @@ TEST_F(DefaultCacheEvictionAlgoTest, StartsEvictingOnceMaxSizeExceeded) {
         return (evicted_block_idx >= evictable_range.first) && (evicted_block_idx < evictable_range.second) ; }));
 }
 
+TEST_F(DefaultCacheEvictionAlgoTest, NoBlocksToRotateAtStepsWithoutEviction) {
+    algo.register_new_token_scores(get_mock_scores(num_decoder_layers, eviction_config.get_max_cache_size() + DEFAULT_BLOCK_SIZE - 1));
+    EXPECT_FALSE(ov::genai::CacheEvictionAlgorithm::has_evicted_blocks(algo.evict_logical_blocks()));
+
+    algo.register_new_token_scores(get_mock_scores(num_decoder_layers, eviction_config.get_max_cache_size() + DEFAULT_BLOCK_SIZE));
+    EXPECT_TRUE(ov::genai::CacheEvictionAlgorithm::has_evicted_blocks(algo.evict_logical_blocks()));
+
+    // the blocks evicted at the previous step aren't evicted again
+    algo.register_new_token_scores(get_mock_scores(num_decoder_layers, eviction_config.get_max_cache_size()));
+    EXPECT_FALSE(ov::genai::CacheEvictionAlgorithm::has_evicted_blocks(algo.evict_logical_blocks()));
+}
+
 using CacheEvictionAlgoConfigurationTest = ::testing::TestWithParam<size_t>;
 
 TEST_P(CacheEvictionAlgoConfigurationTest, EvictedBlocksAreLayeredAsConfigured) {
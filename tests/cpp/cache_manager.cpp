@@ -106,3 +106,200 @@ TEST(TestCacheManager, test_dynamic_cache_increase) {
     cache_manager->allocate_cache_if_needed(block_manager.get_total_number_of_kv_blocks());
     ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
 }
+
+
+void fill_block(ov::Tensor cache, size_t block_idx, uint8_t value) {
+    size_t block_size_in_bytes = cache.get_byte_size() / cache.get_shape()[0];
+    std::memset(static_cast<uint8_t*>(cache.data()) + block_idx * block_size_in_bytes, value, block_size_in_bytes);
+}
+
+bool is_block_filled_with(ov::Tensor cache, size_t block_idx, uint8_t value) {
+    size_t block_size_in_bytes = cache.get_byte_size() / cache.get_shape()[0];
+    const uint8_t* block_data = static_cast<const uint8_t*>(cache.data()) + block_idx * block_size_in_bytes;
+    return std::all_of(block_data, block_data + block_size_in_bytes, [value](uint8_t byte) { return byte == value; });
+}
+
+TEST(TestCacheManager, test_dynamic_cache_increase_in_reserved_memory) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+    ASSERT_TRUE(cache_manager->reserve_cache(400));
+
+    cache_manager->allocate_cache_if_needed(100);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 100 * block_size_in_bytes);
+    std::vector<void*> key_cache_data;
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        key_cache_data.push_back(cache_manager->get_key_cache(layer_idx).data());
+        fill_block(cache_manager->get_key_cache(layer_idx), 99, 17);
+        fill_block(cache_manager->get_value_cache(layer_idx), 99, 18);
+    }
+
+    // growing within the reserved memory keeps the blocks in place
+    cache_manager->allocate_cache_if_needed(400);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 400 * block_size_in_bytes);
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        EXPECT_EQ(cache_manager->get_key_cache(layer_idx).data(), key_cache_data[layer_idx]);
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 99, 17));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 99, 18));
+        fill_block(cache_manager->get_key_cache(layer_idx), 399, 42);
+    }
+
+    // growing beyond the reserved memory falls back to copying
+    cache_manager->allocate_cache_if_needed(500);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 500 * block_size_in_bytes);
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 99, 17));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 99, 18));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 399, 42));
+    }
+
+    // reservation is only possible before the cache is allocated
+    EXPECT_FALSE(cache_manager->reserve_cache(1000));
+}
+
+TEST(TestCacheManager, test_cache_shrink) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+
+    for (bool is_reserved : {false, true}) {
+        ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+        auto cache_manager = std::make_shared<CacheManager>(request);
+        size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+        ASSERT_EQ(cache_manager->reserve_cache(400), is_reserved);
+        if (!is_reserved) {
+            cache_manager->allocate_cache_if_needed(1);
+            ASSERT_FALSE(cache_manager->reserve_cache(400));
+        }
+
+        cache_manager->allocate_cache_if_needed(400);
+        for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+            fill_block(cache_manager->get_key_cache(layer_idx), 99, 17);
+            fill_block(cache_manager->get_value_cache(layer_idx), 99, 18);
+        }
+
+        // the blocks before the new number keep their contents
+        cache_manager->shrink_cache(100);
+        ASSERT_EQ(get_total_allocated_bytes(cache_manager), 100 * block_size_in_bytes);
+        for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+            EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 99, 17));
+            EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 99, 18));
+        }
+
+        // the shrunk cache grows again
+        cache_manager->allocate_cache_if_needed(200);
+        ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
+        for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+            EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 99, 17));
+            fill_block(cache_manager->get_key_cache(layer_idx), 199, 42);
+        }
+    }
+}
+
+TEST(TestCacheManager, test_copy_blocks) {
+    ov::Core core;
+    const size_t num_decoder_layers = 3;
+    const size_t num_kv_blocks = 8;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    cache_manager->allocate_cache_if_needed(num_kv_blocks);
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        for (size_t block_idx = 0; block_idx < num_kv_blocks; block_idx++) {
+            fill_block(cache_manager->get_key_cache(layer_idx), block_idx, block_idx);
+            fill_block(cache_manager->get_value_cache(layer_idx), block_idx, block_idx + 100);
+        }
+    }
+
+    // blocks 1, 2 are copied as a single run into 4, 5; block 0 goes into two separate blocks
+    std::map<size_t, std::list<size_t>> block_copy_map = {{0, {3, 7}}, {1, {4}}, {2, {5}}};
+    cache_manager->copy_blocks(block_copy_map);
+
+    std::vector<uint8_t> expected_blocks = {0, 1, 2, 0, 1, 2, 6, 0};
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        for (size_t block_idx = 0; block_idx < num_kv_blocks; block_idx++) {
+            EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), block_idx, expected_blocks[block_idx]));
+            EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), block_idx, expected_blocks[block_idx] + 100));
+        }
+    }
+}
+
+TEST(TestCacheManager, test_swap_out_and_swap_in) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+    const size_t num_kv_blocks = 4;
+    const std::filesystem::path swap_file_path = std::filesystem::temp_directory_path() / "test_cache_manager_swap_space.bin";
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    cache_manager->allocate_cache_if_needed(num_kv_blocks);
+    // one swap block in host memory, one in the swap file
+    cache_manager->allocate_swap_space(1, 1, swap_file_path);
+    ASSERT_EQ(cache_manager->get_num_swap_blocks(), 2);
+
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        fill_block(cache_manager->get_key_cache(layer_idx), 0, 17);
+        fill_block(cache_manager->get_value_cache(layer_idx), 0, 18);
+        fill_block(cache_manager->get_key_cache(layer_idx), 1, 42);
+        fill_block(cache_manager->get_value_cache(layer_idx), 1, 43);
+    }
+
+    std::vector<std::map<size_t, size_t>> swap_out_map(num_decoder_layers, std::map<size_t, size_t>{{0, 0}, {1, 1}});
+    cache_manager->swap_out(swap_out_map);
+
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        fill_block(cache_manager->get_key_cache(layer_idx), 0, 0);
+        fill_block(cache_manager->get_value_cache(layer_idx), 0, 0);
+        fill_block(cache_manager->get_key_cache(layer_idx), 1, 0);
+        fill_block(cache_manager->get_value_cache(layer_idx), 1, 0);
+    }
+
+    std::vector<std::map<size_t, size_t>> swap_in_map(num_decoder_layers, std::map<size_t, size_t>{{0, 3}, {1, 2}});
+    cache_manager->swap_in(swap_in_map);
+
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 3, 17));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 3, 18));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 2, 42));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 2, 43));
+    }
+
+    cache_manager.reset();
+    std::filesystem::remove(swap_file_path);
+}
+
+TEST(TestCacheManager, test_swap_of_consecutive_blocks) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+    const size_t num_kv_blocks = 6;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    cache_manager->allocate_cache_if_needed(num_kv_blocks);
+    cache_manager->allocate_swap_space(4);
+
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        for (size_t block_idx = 0; block_idx < 3; block_idx++) {
+            fill_block(cache_manager->get_key_cache(layer_idx), block_idx, 10 + block_idx);
+            fill_block(cache_manager->get_value_cache(layer_idx), block_idx, 20 + block_idx);
+        }
+    }
+
+    // a run of 2 blocks and a single block
+    std::vector<std::map<size_t, size_t>> swap_out_map(num_decoder_layers, std::map<size_t, size_t>{{0, 1}, {1, 2}, {2, 0}});
+    cache_manager->swap_out(swap_out_map);
+
+    std::vector<std::map<size_t, size_t>> swap_in_map(num_decoder_layers, std::map<size_t, size_t>{{0, 3}, {1, 4}, {2, 5}});
+    cache_manager->swap_in(swap_in_map);
+
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 3, 12));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 3, 22));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 4, 10));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 4, 20));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_key_cache(layer_idx), 5, 11));
+        EXPECT_TRUE(is_block_filled_with(cache_manager->get_value_cache(layer_idx), 5, 21));
+    }
+}
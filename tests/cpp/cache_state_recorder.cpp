@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "openvino/genai/generation_config.hpp"
+#include "continuous_batching/cache_state_recorder.hpp"
+
+using namespace ov::genai;
+
+namespace {
+class SnapshotReader {
+    const std::vector<char>& m_data;
+    size_t m_offset;
+public:
+    SnapshotReader(const std::vector<char>& data, size_t offset) : m_data(data), m_offset(offset) {}
+
+    template <typename T>
+    T read() {
+        T value;
+        EXPECT_LE(m_offset + sizeof(T), m_data.size());
+        std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return value;
+    }
+
+    size_t get_offset() const {
+        return m_offset;
+    }
+};
+}  // namespace
+
+TEST(TestCacheStateRecorder, records_block_sharing_and_evictions) {
+    const std::filesystem::path file_path = std::filesystem::temp_directory_path() / "test_cache_state_recorder.bin";
+    BlockManager block_manager(8, false, 4);
+    TokenIds prompt_ids = {0, 1, 2, 3, 4, 5, 6, 7};
+    auto sequence_group = std::make_shared<SequenceGroup>(3, ov::Tensor(ov::element::i64, {prompt_ids.size()}, prompt_ids.data()),
+                                                          ov::genai::beam_search(), 4);
+    auto sequence = sequence_group->get_sequences()[0];
+    block_manager.allocate(sequence, 2);
+    auto forked_sequence = sequence_group->fork_sequence(sequence);
+    block_manager.fork_sequence(sequence->get_id(), forked_sequence->get_id());
+
+    // the second logical block of the first sequence was evicted in the first layer
+    std::map<size_t, std::vector<std::set<size_t>>> evicted_blocks;
+    evicted_blocks[sequence->get_id()] = {std::set<size_t>{1}};
+
+    {
+        CacheStateRecorder recorder(file_path);
+        recorder.record_step(block_manager, {sequence_group}, evicted_blocks);
+        EXPECT_EQ(recorder.get_num_dropped_snapshots(), 0);
+    }
+
+    std::ifstream file(file_path, std::ios::binary);
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_GE(data.size(), 8);
+    EXPECT_EQ(std::memcmp(data.data(), CacheStateRecorder::magic, sizeof(CacheStateRecorder::magic)), 0);
+
+    SnapshotReader reader(data, sizeof(CacheStateRecorder::magic));
+    EXPECT_EQ(reader.read<uint32_t>(), CacheStateRecorder::format_version);
+    const uint32_t snapshot_size = reader.read<uint32_t>();
+    EXPECT_EQ(reader.get_offset() + snapshot_size, data.size());
+
+    EXPECT_EQ(reader.read<uint64_t>(), 0);  // step
+    reader.read<int64_t>();  // time
+    EXPECT_EQ(reader.read<uint32_t>(), 0);  // dropped snapshots
+    EXPECT_EQ(reader.read<uint32_t>(), 4);  // block size
+    EXPECT_EQ(reader.read<uint32_t>(), 8);  // total blocks
+    EXPECT_EQ(reader.read<uint32_t>(), 6);  // free blocks
+    EXPECT_EQ(reader.read<uint32_t>(), 0);  // free blocks in the hash store
+    EXPECT_EQ(reader.read<uint32_t>(), 0);  // occupied hashed blocks
+
+    EXPECT_EQ(reader.read<uint32_t>(), 1);  // sequence groups
+    EXPECT_EQ(reader.read<uint64_t>(), 3);  // request id
+    EXPECT_EQ(reader.read<uint32_t>(), 2);  // sequences
+    for (const auto& expected_sequence : {sequence, forked_sequence}) {
+        EXPECT_EQ(reader.read<uint64_t>(), expected_sequence->get_id());
+        EXPECT_EQ(reader.read<uint32_t>(), 2);
+        reader.read<uint32_t>();
+        reader.read<uint32_t>();
+    }
+
+    // both blocks are shared by the forked sequences
+    EXPECT_EQ(reader.read<uint32_t>(), 2);
+    for (size_t i = 0; i < 2; ++i) {
+        reader.read<uint32_t>();  // block index
+        EXPECT_EQ(reader.read<uint32_t>(), 2);  // reference count
+        EXPECT_EQ(reader.read<uint8_t>(), 0);  // is hashed
+    }
+
+    EXPECT_EQ(reader.read<uint32_t>(), 1);  // sequences with evicted blocks
+    EXPECT_EQ(reader.read<uint64_t>(), sequence->get_id());
+    EXPECT_EQ(reader.read<uint32_t>(), 1);
+    EXPECT_EQ(reader.read<uint32_t>(), 1);
+    EXPECT_EQ(reader.get_offset(), data.size());
+
+    file.close();
+    std::filesystem::remove(file_path);
+}
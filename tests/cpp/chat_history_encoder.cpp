@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/chat_history_encoder.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// a token per character, the encoded texts are recorded
+struct CharacterEncoder {
+    std::vector<std::string> encoded_texts;
+
+    std::vector<int64_t> operator()(const std::string& text) {
+        encoded_texts.push_back(text);
+        return std::vector<int64_t>(text.begin(), text.end());
+    }
+};
+}
+
+TEST(TestChatHistoryEncoder, only_new_messages_are_encoded) {
+    CharacterEncoder character_encoder;
+    ChatHistoryEncoder encoder([&](const std::string& text) { return character_encoder(text); });
+
+    EXPECT_EQ(encoder.encode("<u>hi<a>"), std::vector<int64_t>({'<', 'u', '>', 'h', 'i', '<', 'a', '>'}));
+    // the answer keeps its token ids without the stop token
+    encoder.add_answer("ok", {100, 101, 2}, {2});
+    std::vector<int64_t> token_ids = encoder.encode("<u>hi<a>ok</a><u>x<a>");
+    EXPECT_EQ(character_encoder.encoded_texts, std::vector<std::string>({"<u>hi<a>", "</a><u>x<a>"}));
+    EXPECT_EQ(std::vector<int64_t>(token_ids.begin() + 8, token_ids.begin() + 10), std::vector<int64_t>({100, 101}));
+    EXPECT_EQ(token_ids.size(), 10 + 11);
+}
+
+TEST(TestChatHistoryEncoder, changed_answer_is_encoded_again) {
+    CharacterEncoder character_encoder;
+    ChatHistoryEncoder encoder([&](const std::string& text) { return character_encoder(text); });
+
+    encoder.encode("<u>hi<a>");
+    encoder.add_answer(" ok ", {100}, {});
+    // the template strips the answer
+    encoder.encode("<u>hi<a>ok<u>x<a>");
+    EXPECT_EQ(character_encoder.encoded_texts.back(), "ok<u>x<a>");
+
+    // the history doesn't start with the previous one
+    encoder.encode("<s><u>y<a>");
+    EXPECT_EQ(character_encoder.encoded_texts.back(), "<s><u>y<a>");
+
+    encoder.reset();
+    EXPECT_TRUE(encoder.get_token_ids().empty());
+}
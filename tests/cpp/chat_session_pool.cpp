@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llm/chat_session_pool.hpp"
+
+using namespace ov::genai;
+
+namespace {
+struct MockSession {
+    size_t history_len = 0;
+    bool has_kv_cache = true;
+
+    void release_kv_cache() {
+        has_kv_cache = false;
+    }
+};
+}
+
+TEST(ChatSessionPoolTest, least_recently_suspended_sessions_release_kv_cache) {
+    ChatSessionPool<MockSession> pool(2);
+    pool.put("a", {1});
+    pool.put("b", {2});
+    pool.put("c", {3});
+    EXPECT_EQ(pool.size(), 3);
+    EXPECT_FALSE(pool.has_kv_cache("a"));
+    EXPECT_TRUE(pool.has_kv_cache("b"));
+    EXPECT_TRUE(pool.has_kv_cache("c"));
+
+    auto session = pool.take("a");
+    ASSERT_TRUE(session.has_value());
+    EXPECT_EQ(session->history_len, 1);
+    EXPECT_FALSE(session->has_kv_cache);
+    EXPECT_FALSE(pool.contains("a"));
+    EXPECT_FALSE(pool.take("a").has_value());
+
+    // suspending the resumed session again makes it the most recent one
+    pool.take("b");
+    pool.put("b", {4});
+    pool.put("d", {5});
+    EXPECT_FALSE(pool.has_kv_cache("c"));
+    EXPECT_TRUE(pool.has_kv_cache("b"));
+    EXPECT_TRUE(pool.take("b")->has_kv_cache);
+    EXPECT_FALSE(pool.take("c")->has_kv_cache);
+}
+
+TEST(ChatSessionPoolTest, uncompressed_snapshot_is_exact) {
+    ov::Tensor state(ov::element::f32, ov::Shape{1, 2, 3, 4});
+    for (size_t i = 0; i < state.get_size(); ++i)
+        state.data<float>()[i] = 0.37f * i - 2.f;
+
+    auto snapshot = make_kv_state_snapshot("key_values.0.key", state, false);
+    EXPECT_FALSE(snapshot.is_compressed());
+    EXPECT_EQ(snapshot.name, "key_values.0.key");
+
+    auto restored = restore_kv_state(snapshot);
+    ASSERT_EQ(restored.get_shape(), state.get_shape());
+    for (size_t i = 0; i < state.get_size(); ++i)
+        EXPECT_EQ(restored.data<float>()[i], state.data<float>()[i]);
+}
+
+TEST(ChatSessionPoolTest, compressed_snapshot_is_quantized_per_head) {
+    const size_t head_size = 8;
+    ov::Tensor state(ov::element::f32, ov::Shape{1, 2, 5, head_size});
+    for (size_t i = 0; i < state.get_size(); ++i)
+        // different ranges of values per head
+        state.data<float>()[i] = (i % head_size) * 0.1f * (1 + i / head_size) - 1.f;
+    // constant group
+    std::fill_n(state.data<float>(), head_size, 0.5f);
+
+    auto snapshot = make_kv_state_snapshot("key_values.0.value", state, true);
+    ASSERT_TRUE(snapshot.is_compressed());
+    EXPECT_EQ(snapshot.data.get_element_type(), ov::element::u8);
+    EXPECT_EQ(snapshot.scales.size(), state.get_size() / head_size);
+    EXPECT_LT(snapshot.get_byte_size(), state.get_byte_size());
+
+    auto restored = restore_kv_state(snapshot);
+    ASSERT_EQ(restored.get_element_type(), ov::element::f32);
+    ASSERT_EQ(restored.get_shape(), state.get_shape());
+    for (size_t i = 0; i < state.get_size(); ++i)
+        EXPECT_NEAR(restored.data<float>()[i], state.data<float>()[i], snapshot.scales[i / head_size] / 2 + 1e-6f);
+    EXPECT_EQ(restored.data<float>()[0], 0.5f);
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "sampling/counter_based_random.hpp"
+
+using namespace ov::genai;
+
+TEST(CounterBasedRandomTest, philox_matches_known_answers) {
+    // known answer tests of the reference Random123 implementation
+    EXPECT_EQ(philox4x32({0, 0, 0, 0}, {0, 0}), (std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(CounterBasedRandomTest, streams_are_reproducible_and_uniform) {
+    CounterBasedRandom stream(42, {1, 2, 3}), same_stream(42, {1, 2, 3}), other_stream(42, {1, 2, 4});
+    const size_t num_values = 100000;
+    double sum = 0.0;
+    size_t num_equal_to_other = 0;
+    for (size_t i = 0; i < num_values; ++i) {
+        const double value = stream.uniform(i);
+        ASSERT_GE(value, 0.0);
+        ASSERT_LT(value, 1.0);
+        ASSERT_EQ(value, same_stream.uniform(i));
+        num_equal_to_other += value == other_stream.uniform(i);
+        sum += value;
+    }
+    EXPECT_EQ(num_equal_to_other, 0);
+    EXPECT_NEAR(sum / num_values, 0.5, 0.01);
+    EXPECT_NE(CounterBasedRandom(42, {1}).uniform(0), CounterBasedRandom(43, {1}).uniform(0));
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "image_generation/device_placement.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+DeviceProfile get_profile(float text_encode_ms, float denoise_ms, float vae_decode_ms,
+                          const std::string& memory_pool, size_t memory_limit = 0) {
+    DeviceProfile profile;
+    profile.latencies_ms = {text_encode_ms, denoise_ms, vae_decode_ms};
+    profile.memory_pool = memory_pool;
+    profile.memory_limit = memory_limit;
+    return profile;
+}
+
+}  // namespace
+
+TEST(DevicePlacementTest, SelectsFastestDeviceOfEachStage) {
+    const std::map<std::string, DeviceProfile> profiles = {
+        {"CPU", get_profile(10.0f, 500.0f, 300.0f, "HOST")},
+        {"GPU", get_profile(40.0f, 50.0f, 100.0f, "GPU")},
+        {"NPU", get_profile(5.0f, 80.0f, 900.0f, "HOST")},
+    };
+    const auto placement = select_device_placement(profiles, {1, 1, 1}, 20);
+    ASSERT_TRUE(placement.has_value());
+    EXPECT_EQ(*placement, (DevicePlacement{"NPU", "GPU", "GPU"}));
+}
+
+TEST(DevicePlacementTest, RespectsSharedMemoryLimit) {
+    const std::map<std::string, DeviceProfile> profiles = {
+        {"CPU", get_profile(10.0f, 500.0f, 300.0f, "HOST", 1000)},
+        {"GPU", get_profile(40.0f, 50.0f, 100.0f, "GPU", 1000)},
+    };
+    // the denoiser and VAE don't fit GPU together, VAE is the cheaper one to move
+    const auto placement = select_device_placement(profiles, {100, 800, 300}, 20);
+    ASSERT_TRUE(placement.has_value());
+    EXPECT_EQ(*placement, (DevicePlacement{"CPU", "GPU", "CPU"}));
+
+    EXPECT_FALSE(select_device_placement(profiles, {100, 1200, 300}, 20).has_value());
+}
+
+TEST(DevicePlacementTest, SavedPlacementIsReusedForSameDevices) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "test_device_placement.json";
+    const std::vector<std::string> devices = {"CPU", "GPU"};
+    const DevicePlacement placement = {"CPU", "GPU", "CPU"};
+    save_device_placement(path, devices, placement);
+
+    EXPECT_EQ(load_device_placement(path, devices), placement);
+    EXPECT_FALSE(load_device_placement(path, {"CPU", "GPU", "NPU"}).has_value());
+    std::filesystem::remove(path);
+    EXPECT_FALSE(load_device_placement(path, devices).has_value());
+}
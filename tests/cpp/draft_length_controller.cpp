@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "speculative_decoding/draft_length_controller.hpp"
+
+using namespace ov::genai;
+
+TEST(DraftLengthControllerTest, uses_max_draft_length_without_history) {
+    DraftLengthController controller;
+    EXPECT_EQ(controller.get_draft_length(0, 5), 5);
+    controller.update_durations(0.1f, 1.f);
+    EXPECT_EQ(controller.get_draft_length(0, 5), 5);
+}
+
+TEST(DraftLengthControllerTest, shortens_draft_for_rejected_candidates) {
+    DraftLengthController controller;
+    controller.update_durations(0.2f, 1.f);
+    for (size_t i = 0; i < 10; ++i) {
+        controller.update_acceptance(0, 5, 5);
+        controller.update_acceptance(1, 5, 0);
+    }
+    EXPECT_FLOAT_EQ(controller.get_acceptance_probability(0), 1.f);
+    EXPECT_FLOAT_EQ(controller.get_acceptance_probability(1), 0.f);
+    EXPECT_EQ(controller.get_draft_length(0, 5), 5);
+    EXPECT_EQ(controller.get_draft_length(1, 5), 1);
+
+    controller.remove_request(1);
+    EXPECT_EQ(controller.get_draft_length(1, 5), 5);
+}
+
+TEST(DraftLengthControllerTest, balances_acceptance_and_draft_duration) {
+    DraftLengthController controller;
+    for (size_t i = 0; i < 20; ++i) {
+        // 1 accepted candidate of 2 evaluated ones
+        controller.update_acceptance(0, 4, 1);
+    }
+    EXPECT_NEAR(controller.get_acceptance_probability(0), 0.5f, 1e-5f);
+
+    // 1 + 0.5 + 0.25 tokens for the duration of 1.2 is the best throughput
+    controller.update_durations(0.1f, 1.f);
+    EXPECT_EQ(controller.get_draft_length(0, 10), 2);
+
+    // draft model is almost free
+    DraftLengthController fast_draft_controller;
+    fast_draft_controller.update_acceptance(0, 4, 1);
+    fast_draft_controller.update_durations(0.f, 1.f);
+    EXPECT_EQ(fast_draft_controller.get_draft_length(0, 10), 10);
+}
+
+TEST(DraftLengthControllerTest, limits_draft_length_under_load) {
+    DraftLengthController controller(64);
+    EXPECT_EQ(controller.get_max_draft_length(4), 15);
+    EXPECT_EQ(controller.get_draft_length(0, 5, 4), 5);
+    EXPECT_EQ(controller.get_draft_length(0, 5, 16), 3);
+    // speculation is backed off, as the main model step is compute-bound
+    EXPECT_EQ(controller.get_max_draft_length(32), 1);
+    EXPECT_EQ(controller.get_draft_length(0, 5, 64), 1);
+}
@@ -0,0 +1,192 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+
+#include "continuous_batching/engine_loop.hpp"
+#include "generation_stream.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// finishes each request after the given number of steps, generating the number of the remaining steps as the token
+struct MockPipeline {
+    std::mutex mutex;
+    std::vector<std::pair<GenerationStream::Ptr, size_t>> requests;
+    size_t max_num_requests = 0;
+    bool throw_on_step = false;
+
+    GenerationHandle add_request(size_t num_steps) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto stream = GenerationStream::create();
+        requests.emplace_back(stream, num_steps);
+        max_num_requests = std::max(max_num_requests, requests.size());
+        return std::make_shared<GenerationHandleImpl>(stream, GenerationConfig{});
+    }
+
+    void step() {
+        std::lock_guard<std::mutex> lock(mutex);
+        OPENVINO_ASSERT(!throw_on_step, "step has failed");
+        // the stopped requests are dropped
+        requests.erase(std::remove_if(requests.begin(), requests.end(), [](const auto& request) {
+            return request.first->get_status() != GenerationStatus::RUNNING;
+        }), requests.end());
+        for (auto& [stream, num_steps] : requests) {
+            GenerationOutput output;
+            output.generated_ids = {static_cast<int64_t>(--num_steps)};
+            stream->push({{0, output}});
+            if (num_steps == 0) {
+                stream->set_generation_status(GenerationStatus::FINISHED);
+            }
+        }
+        requests.erase(std::remove_if(requests.begin(), requests.end(), [](const auto& request) { return request.second == 0; }), requests.end());
+    }
+
+    bool has_non_finished_requests() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !requests.empty();
+    }
+
+    PipelineMetrics get_metrics() const {
+        return {};
+    }
+};
+}
+
+TEST(TestEngineLoop, requests_are_completed_within_the_limits) {
+    auto pipeline = std::make_shared<MockPipeline>();
+    EngineLoopConfig config;
+    config.max_num_requests = 2;
+    PipelineEngineLoop<MockPipeline> engine_loop(pipeline, config);
+
+    const size_t num_requests = 8;
+    std::atomic<size_t> num_completed_requests = 0;
+    std::vector<GenerationHandle> handles;
+    for (size_t request_id = 0; request_id < num_requests; ++request_id) {
+        handles.push_back(engine_loop.add_request(request_id, [&] { return pipeline->add_request(request_id % 3 + 1); },
+            [&](uint64_t, const GenerationHandle& handle) {
+                EXPECT_EQ(handle->get_status(), GenerationStatus::FINISHED);
+                ++num_completed_requests;
+            }));
+    }
+    while (num_completed_requests < num_requests) {
+        std::this_thread::yield();
+    }
+    engine_loop.stop();
+
+    EXPECT_LE(pipeline->max_num_requests, config.max_num_requests);
+    for (auto& handle : handles) {
+        EXPECT_EQ(handle->get_status(), GenerationStatus::FINISHED);
+    }
+}
+
+TEST(TestEngineLoop, step_exception_is_rethrown_on_stop) {
+    auto pipeline = std::make_shared<MockPipeline>();
+    pipeline->throw_on_step = true;
+    PipelineEngineLoop<MockPipeline> engine_loop(pipeline, {});
+
+    engine_loop.add_request(0, [&] { return pipeline->add_request(1); }, {});
+    // the loop is stopped by the exception, so new requests are rejected
+    bool is_rejected = false;
+    while (!is_rejected) {
+        try {
+            engine_loop.add_request(1, [&] { return pipeline->add_request(1); }, {});
+        } catch (const ov::Exception&) {
+            is_rejected = true;
+        }
+    }
+    EXPECT_THROW(engine_loop.stop(), ov::Exception);
+}
+
+TEST(TestEngineLoop, text_of_streamed_requests_precedes_completion) {
+    auto pipeline = std::make_shared<MockPipeline>();
+    std::vector<std::string> pieces = {"a", "b", "c", "d"};
+    auto text_streamer = std::make_shared<BatchedTextStreamer>([](const std::vector<std::vector<int64_t>>& lines) {
+        return std::vector<std::string>(lines.size());
+    }, pieces);
+    PipelineEngineLoop<MockPipeline> engine_loop(pipeline, {}, text_streamer);
+
+    std::string text;
+    std::atomic<bool> is_completed = false;
+    engine_loop.add_request(0, [&] { return pipeline->add_request(4); },
+        [&](uint64_t, const GenerationHandle& handle) {
+            EXPECT_EQ(text, "dcba");
+            is_completed = true;
+        },
+        [&](const std::string& new_text) {
+            text += new_text;
+            return StreamingStatus::RUNNING;
+        });
+    while (!is_completed) {
+        std::this_thread::yield();
+    }
+    engine_loop.stop();
+}
+
+TEST(TestEngineLoop, streamed_request_is_stopped_by_status) {
+    auto pipeline = std::make_shared<MockPipeline>();
+    std::vector<std::string> pieces(100, "a");
+    auto text_streamer = std::make_shared<BatchedTextStreamer>([](const std::vector<std::vector<int64_t>>& lines) {
+        return std::vector<std::string>(lines.size());
+    }, pieces);
+    PipelineEngineLoop<MockPipeline> engine_loop(pipeline, {}, text_streamer);
+
+    std::atomic<bool> is_completed = false;
+    auto handle = engine_loop.add_request(0, [&] { return pipeline->add_request(100); },
+        [&](uint64_t, const GenerationHandle&) { is_completed = true; },
+        [&](const std::string&) { return StreamingStatus::STOP; });
+    while (!is_completed) {
+        std::this_thread::yield();
+    }
+    engine_loop.stop();
+    EXPECT_EQ(handle->get_status(), GenerationStatus::STOP);
+}
+
+TEST(TestEngineLoop, step_callback_receives_outputs_of_requests_without_callbacks) {
+    auto pipeline = std::make_shared<MockPipeline>();
+    std::mutex mutex;
+    std::map<uint64_t, std::vector<int64_t>> tokens;
+    std::map<uint64_t, GenerationStatus> statuses;
+    PipelineEngineLoop<MockPipeline> engine_loop(pipeline, {}, nullptr, [&](const std::vector<EngineStepOutput>& outputs) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& step_output : outputs) {
+            EXPECT_EQ(statuses.count(step_output.request_id), 0);
+            for (const auto& [sequence_id, output] : step_output.outputs) {
+                auto& request_tokens = tokens[step_output.request_id];
+                request_tokens.insert(request_tokens.end(), output.generated_ids.begin(), output.generated_ids.end());
+            }
+            if (step_output.status != GenerationStatus::RUNNING) {
+                statuses[step_output.request_id] = step_output.status;
+            }
+        }
+    });
+
+    engine_loop.add_request(0, [&] { return pipeline->add_request(3); }, {});
+    engine_loop.add_request(1, [&] { return pipeline->add_request(2); }, {});
+    // the outputs of the request with the completion callback are left in its handle
+    std::atomic<bool> is_completed = false;
+    engine_loop.add_request(2, [&] { return pipeline->add_request(1); },
+        [&](uint64_t, const GenerationHandle& handle) {
+            EXPECT_TRUE(handle->can_read());
+            is_completed = true;
+        });
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (statuses.size() == 2 && is_completed) {
+                break;
+            }
+        }
+        std::this_thread::yield();
+    }
+    engine_loop.stop();
+
+    EXPECT_EQ(tokens[0], std::vector<int64_t>({2, 1, 0}));
+    EXPECT_EQ(tokens[1], std::vector<int64_t>({1, 0}));
+    EXPECT_EQ(tokens.count(2), 0);
+    EXPECT_EQ(statuses[0], GenerationStatus::FINISHED);
+    EXPECT_EQ(statuses[1], GenerationStatus::FINISHED);
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "gguf_utils/gguf_native_tokenizer.hpp"
+
+using namespace ov::genai;
+
+namespace {
+std::vector<std::string> pre_tokenize(const std::string& text, const std::vector<GGUFSplitPattern>& patterns) {
+    auto parsed_text = gguf_native::parse_text(text);
+    EXPECT_TRUE(parsed_text.has_value());
+    std::vector<std::pair<size_t, size_t>> pieces = {{0, parsed_text->code_points.size()}};
+    for (GGUFSplitPattern pattern : patterns) {
+        pieces = gguf_native::split(pattern, *parsed_text, pieces);
+    }
+    std::vector<std::string> result;
+    for (const auto& [begin, end] : pieces) {
+        result.push_back(text.substr(parsed_text->offsets[begin], parsed_text->offsets[end] - parsed_text->offsets[begin]));
+    }
+    return result;
+}
+}
+
+TEST(TestGGUFNativeTokenizer, text_is_split_like_by_the_regex) {
+    EXPECT_EQ(pre_tokenize("Hello world's  123\n\nok!!", {GGUFSplitPattern::QWEN2}),
+              std::vector<std::string>({"Hello", " world", "'s", " ", " ", "1", "2", "3", "\n\n", "ok", "!!"}));
+    EXPECT_EQ(pre_tokenize("I'll  go 42x", {GGUFSplitPattern::NUMBER, GGUFSplitPattern::GPT2}),
+              std::vector<std::string>({"I", "'ll", " ", " go", " ", "4", "2", "x"}));
+    EXPECT_EQ(pre_tokenize("a+b=12345.", {GGUFSplitPattern::PUNCTUATION, GGUFSplitPattern::GPT2, GGUFSplitPattern::NUMBERS, GGUFSplitPattern::THREE_DIGITS}),
+              std::vector<std::string>({"a", "+", "b", "=", "123", "45", "."}));
+    // "你好，世界" with the fullwidth comma
+    EXPECT_EQ(pre_tokenize("\xE4\xBD\xA0\xE5\xA5\xBD\xEF\xBC\x8C\xE4\xB8\x96\xE7\x95\x8C", {GGUFSplitPattern::QWEN2}),
+              std::vector<std::string>({"\xE4\xBD\xA0\xE5\xA5\xBD", "\xEF\xBC\x8C\xE4\xB8\x96\xE7\x95\x8C"}));
+}
+
+TEST(TestGGUFNativeTokenizer, pieces_are_merged_by_rank) {
+    std::vector<std::string> vocab = {"a", "b", "c", "ab", "abc", "bc", " ", "<s>"};
+    GGUFNativeTokenizer tokenizer(vocab, {{"a", "b"}, {"ab", "c"}, {"b", "c"}}, {7}, {GGUFSplitPattern::GPT2});
+
+    EXPECT_EQ(tokenizer.encode("abc<s>ab"), std::vector<int64_t>({4, 7, 3}));
+    // the pair of the lowest rank is merged first
+    EXPECT_EQ(tokenizer.encode("bcab"), std::vector<int64_t>({5, 3}));
+    EXPECT_EQ(tokenizer.encode("ab c"), std::vector<int64_t>({3, 6, 2}));
+
+    EXPECT_EQ(tokenizer.decode({4, 7, 3}), "abcab");
+    EXPECT_EQ(tokenizer.decode({4, 7, 3}, false), "abc<s>ab");
+    EXPECT_EQ(tokenizer.get_detokenization_pieces()[7], "");
+}
+
+TEST(TestGGUFNativeTokenizer, text_with_unknown_characters_is_not_encoded) {
+    GGUFNativeTokenizer tokenizer({"a"}, {}, {}, {GGUFSplitPattern::GPT2});
+    EXPECT_TRUE(tokenizer.encode("a").has_value());
+    // Ogham space mark is not classified natively
+    EXPECT_FALSE(tokenizer.encode("a\xE1\x9A\x80" "a").has_value());
+    // invalid UTF-8
+    EXPECT_FALSE(tokenizer.encode("a\xFF").has_value());
+}
+
+TEST(TestGGUFNativeTokenizer, last_tokens_are_kept) {
+    GGUFNativeTokenizer tokenizer({"a", "b"}, {}, {}, {GGUFSplitPattern::GPT2}, std::nullopt, 2);
+    EXPECT_EQ(tokenizer.encode("abab"), std::vector<int64_t>({0, 1}));
+}
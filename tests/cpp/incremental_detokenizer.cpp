@@ -0,0 +1,36 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/incremental_detokenizer.hpp"
+
+using namespace ov::genai;
+
+TEST(TestIncrementalDetokenizer, characters_split_across_tokens_are_emitted_once_complete) {
+    // "é" is 0xC3 0xA9, "€" is 0xE2 0x82 0xAC
+    std::vector<std::string> pieces = {"Hello", " ", "\xC3", "\xA9", "\xE2\x82", "\xAC!", ""};
+    IncrementalDetokenizer detokenizer(pieces);
+    EXPECT_EQ(detokenizer.append(0), "Hello");
+    EXPECT_EQ(detokenizer.append(1), " ");
+    EXPECT_EQ(detokenizer.append(2), "");
+    EXPECT_EQ(detokenizer.append(3), "\xC3\xA9");
+    EXPECT_EQ(detokenizer.append(6), "");
+    EXPECT_EQ(detokenizer.append(4), "");
+    EXPECT_EQ(detokenizer.append(5), "\xE2\x82\xAC!");
+    EXPECT_EQ(detokenizer.flush(), "");
+}
+
+TEST(TestIncrementalDetokenizer, invalid_bytes_are_replaced) {
+    std::vector<std::string> pieces = {"a", "\xC3", "\xA9", "\xE2\x82"};
+    IncrementalDetokenizer detokenizer(pieces);
+    // the incomplete character is interrupted by an ASCII byte
+    EXPECT_EQ(detokenizer.append(1), "");
+    EXPECT_EQ(detokenizer.append(0), "\xEF\xBF\xBD" "a");
+    // a stray continuation byte
+    EXPECT_EQ(detokenizer.append(2), "\xEF\xBF\xBD");
+    // out of vocab tokens are ignored, the character left incomplete is replaced on flush
+    EXPECT_EQ(detokenizer.append(3), "");
+    EXPECT_EQ(detokenizer.append(100), "");
+    EXPECT_EQ(detokenizer.flush(), "\xEF\xBF\xBD");
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "sampling/structured_output/json_event_parser.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+std::string to_string(const std::vector<JsonEvent>& events) {
+    std::string result;
+    for (const auto& event : events) {
+        switch (event.type) {
+        case JsonEventType::OBJECT_START: result += "{" + event.path; break;
+        case JsonEventType::OBJECT_END: result += "}" + event.path; break;
+        case JsonEventType::ARRAY_START: result += "[" + event.path; break;
+        case JsonEventType::ARRAY_END: result += "]" + event.path; break;
+        case JsonEventType::STRING_CHUNK: result += "~" + event.path + "=" + event.value; break;
+        case JsonEventType::VALUE: result += (event.is_string ? "s" : "v") + event.path + "=" + event.value; break;
+        }
+        result += ' ';
+    }
+    return result;
+}
+
+std::vector<JsonEvent> parse(const std::vector<std::string>& parts) {
+    JsonEventParser parser;
+    std::vector<JsonEvent> events;
+    for (const auto& part : parts) {
+        auto part_events = parser.feed(part);
+        events.insert(events.end(), part_events.begin(), part_events.end());
+    }
+    auto final_events = parser.finish();
+    events.insert(events.end(), final_events.begin(), final_events.end());
+    EXPECT_TRUE(parser.is_complete());
+    return events;
+}
+
+}  // namespace
+
+TEST(TestJsonEventParser, events_do_not_depend_on_the_split_of_the_text) {
+    const std::string json = R"({"name": "get_weather", "arguments": {"city": "Paris", "days": [1, 2.5e1]}, "ok": true, "a/b": null})";
+    const std::string reference = "{ s/name=get_weather {/arguments s/arguments/city=Paris [/arguments/days v/arguments/days/0=1 "
+                                  "v/arguments/days/1=2.5e1 ]/arguments/days }/arguments v/ok=true v/a~1b=null } ";
+    auto without_chunks = [](std::vector<JsonEvent> events) {
+        events.erase(std::remove_if(events.begin(), events.end(), [](const JsonEvent& event) {
+            return event.type == JsonEventType::STRING_CHUNK;
+        }), events.end());
+        return events;
+    };
+    EXPECT_EQ(to_string(without_chunks(parse({json}))), reference);
+    std::vector<std::string> chars;
+    for (char c : json) {
+        chars.emplace_back(1, c);
+    }
+    EXPECT_EQ(to_string(without_chunks(parse(chars))), reference);
+}
+
+TEST(TestJsonEventParser, strings_are_streamed_by_chunks) {
+    JsonEventParser parser;
+    EXPECT_EQ(to_string(parser.feed(R"({"text": "Hel)")), "{ ~/text=Hel ");
+    EXPECT_EQ(to_string(parser.feed(R"(lo\n\u00e9)")), "~/text=lo\n\xC3\xA9 ");
+    // the surrogate pair is decoded once it's complete
+    EXPECT_EQ(to_string(parser.feed(R"(\ud83d)")), "");
+    EXPECT_EQ(to_string(parser.feed(R"(\ude00")")), "~/text=\xF0\x9F\x98\x80 s/text=Hello\n\xC3\xA9\xF0\x9F\x98\x80 ");
+    EXPECT_FALSE(parser.is_complete());
+    EXPECT_EQ(to_string(parser.feed("}")), "} ");
+    EXPECT_TRUE(parser.is_complete());
+}
+
+TEST(TestJsonEventParser, root_values_are_parsed_one_by_one) {
+    EXPECT_EQ(to_string(parse({"1 ", "[]", "\"a\" 2"})), "v=1 [ ] ~=a s=a v=2 ");
+}
+
+TEST(TestJsonEventParser, invalid_json_throws) {
+    EXPECT_THROW(JsonEventParser().feed("Sure! {"), ov::Exception);
+    EXPECT_THROW(JsonEventParser().feed("{\"a\" 1}"), ov::Exception);
+    EXPECT_THROW(JsonEventParser().feed("[1 2]"), ov::Exception);
+    EXPECT_THROW(JsonEventParser().feed("[tru]"), ov::Exception);
+    EXPECT_THROW(JsonEventParser().feed("\"\\x\""), ov::Exception);
+}
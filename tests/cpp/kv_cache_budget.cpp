@@ -0,0 +1,22 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/kv_cache_budget.hpp"
+
+using namespace ov::genai;
+
+TEST(KVCacheBudgetTest, shares_budget_between_block_sizes) {
+    KVCacheBudget budget(1000);
+    // e.g. main model blocks take 100 bytes, draft model ones - 30 bytes
+    EXPECT_EQ(budget.allocate_blocks(6, 100), 6);
+    EXPECT_EQ(budget.get_allocated_bytes(), 600);
+    EXPECT_EQ(budget.allocate_blocks(20, 30), 13);
+    EXPECT_EQ(budget.get_allocated_bytes(), 990);
+    // the rest of the budget is not enough for a block of any pipeline
+    EXPECT_EQ(budget.allocate_blocks(1, 100), 0);
+    EXPECT_EQ(budget.allocate_blocks(1, 30), 0);
+    EXPECT_EQ(budget.get_allocated_bytes(), 990);
+    EXPECT_EQ(budget.get_total_bytes(), 1000);
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+#include "openvino/genai/kv_cache_precision.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr size_t num_layers = 8, num_kv_heads = 4, head_size = 64, num_tokens = 1024;
+// 2 bytes of each of the keys and the values of each head of each layer
+constexpr size_t f16_cache_size = 2 * 2 * num_layers * num_kv_heads * head_size * num_tokens;
+
+}  // namespace
+
+TEST(TestKVCachePrecision, generous_budget_keeps_f16) {
+    const KVCachePrecisionConfig config = calibrate_kv_cache_precisions(num_layers, num_kv_heads, head_size, num_tokens, f16_cache_size);
+    EXPECT_EQ(config.key_precisions, std::vector<ov::element::Type>(num_layers, ov::element::f16));
+    EXPECT_EQ(config.value_precisions, std::vector<ov::element::Type>(num_layers, ov::element::f16));
+    EXPECT_EQ(config.key_quantization_mode, KVCacheQuantizationMode::BY_TOKEN);
+}
+
+TEST(TestKVCachePrecision, smaller_budget_quantizes_middle_layers) {
+    const KVCachePrecisionConfig config = calibrate_kv_cache_precisions(num_layers, num_kv_heads, head_size, num_tokens, f16_cache_size * 5 / 8);
+    for (size_t layer_idx : {size_t(0), num_layers - 1}) {
+        EXPECT_EQ(config.key_precisions[layer_idx], ov::element::f16);
+        EXPECT_EQ(config.value_precisions[layer_idx], ov::element::f16);
+    }
+    // the values of the middle layers are quantized before their keys
+    EXPECT_EQ(config.value_precisions[num_layers / 2], ov::element::u4);
+    EXPECT_EQ(config.key_precisions[num_layers / 2], ov::element::u8);
+    EXPECT_EQ(config.key_quantization_mode, KVCacheQuantizationMode::BY_CHANNEL);
+}
+
+TEST(TestKVCachePrecision, tiny_budget_throws) {
+    EXPECT_THROW(calibrate_kv_cache_precisions(num_layers, num_kv_heads, head_size, num_tokens, f16_cache_size / 8), ov::Exception);
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "lm_encoding.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// left-padded batch of prompts of the given lengths, the tokens of a prompt are equal to its row index
+TokenizedInputs make_left_padded_batch(const std::vector<size_t>& lengths) {
+    const size_t max_length = *std::max_element(lengths.begin(), lengths.end());
+    TokenizedInputs inputs;
+    inputs.input_ids = ov::Tensor(ov::element::i64, {lengths.size(), max_length});
+    inputs.attention_mask = ov::Tensor(ov::element::i64, {lengths.size(), max_length});
+    for (size_t row = 0; row < lengths.size(); ++row) {
+        for (size_t column = 0; column < max_length; ++column) {
+            const bool is_padding = column < max_length - lengths[row];
+            inputs.input_ids.data<int64_t>()[row * max_length + column] = is_padding ? -1 : static_cast<int64_t>(row);
+            inputs.attention_mask.data<int64_t>()[row * max_length + column] = is_padding ? 0 : 1;
+        }
+    }
+    return inputs;
+}
+}
+
+TEST(TestPromptLengthBuckets, prompts_are_grouped_by_length) {
+    auto inputs = make_left_padded_batch({100, 3, 4, 60, 8, 2});
+    auto buckets = get_prompt_length_buckets(inputs.attention_mask, 2.0f);
+    std::vector<std::vector<size_t>> ref_buckets = {{5, 1, 2}, {4}, {3, 0}};
+    EXPECT_EQ(buckets, ref_buckets);
+
+    // a single bucket if the ratio is large enough
+    EXPECT_EQ(get_prompt_length_buckets(inputs.attention_mask, 50.0f).size(), 1);
+}
+
+TEST(TestPromptLengthBuckets, batch_rows_are_stripped_of_common_padding) {
+    auto inputs = make_left_padded_batch({100, 3, 4, 60, 8, 2});
+    auto bucket = get_batch_rows(inputs, {5, 1, 2});
+    ASSERT_EQ(bucket.input_ids.get_shape(), ov::Shape({3, 4}));
+    std::vector<int64_t> ref_input_ids = {-1, -1, 5, 5,
+                                          -1, 1, 1, 1,
+                                          2, 2, 2, 2};
+    std::vector<int64_t> ref_attention_mask = {0, 0, 1, 1,
+                                               0, 1, 1, 1,
+                                               1, 1, 1, 1};
+    EXPECT_EQ(std::vector<int64_t>(bucket.input_ids.data<int64_t>(), bucket.input_ids.data<int64_t>() + bucket.input_ids.get_size()), ref_input_ids);
+    EXPECT_EQ(std::vector<int64_t>(bucket.attention_mask.data<int64_t>(), bucket.attention_mask.data<int64_t>() + bucket.attention_mask.get_size()), ref_attention_mask);
+}
+
+TEST(TestGenerationInputs, attention_mask_and_position_ids_follow_beams) {
+    ov::Tensor attention_mask(ov::element::i64, {2, 3});
+    std::vector<int64_t> mask_data = {0, 1, 1,
+                                      1, 1, 1};
+    std::copy(mask_data.begin(), mask_data.end(), attention_mask.data<int64_t>());
+
+    GenerationInputs inputs(attention_mask);
+    inputs.append({1, 1, 0}, 1);
+    ov::Tensor mask = inputs.get_attention_mask();
+    ASSERT_EQ(mask.get_shape(), ov::Shape({3, 4}));
+    std::vector<int64_t> ref_mask = {1, 1, 1, 1,
+                                     1, 1, 1, 1,
+                                     0, 1, 1, 1};
+    EXPECT_EQ(std::vector<int64_t>(mask.data<int64_t>(), mask.data<int64_t>() + mask.get_size()), ref_mask);
+    ov::Tensor position_ids = inputs.get_position_ids();
+    ASSERT_EQ(position_ids.get_shape(), ov::Shape({3, 1}));
+    EXPECT_EQ(std::vector<int64_t>(position_ids.data<int64_t>(), position_ids.data<int64_t>() + 3), std::vector<int64_t>({3, 3, 2}));
+
+    inputs.append({2}, 1);
+    EXPECT_EQ(inputs.get_position_ids().data<int64_t>()[0], 3);
+    EXPECT_EQ(inputs.get_attention_mask().get_shape(), ov::Shape({1, 5}));
+}
+
+TEST(TestGenerationInputs, trim_removes_last_tokens) {
+    ov::Tensor attention_mask(ov::element::i64, {1, 4});
+    std::fill_n(attention_mask.data<int64_t>(), 4, 1);
+
+    GenerationInputs inputs(attention_mask);
+    // the last token and 3 candidates
+    inputs.append({0}, 4);
+    EXPECT_EQ(std::vector<int64_t>(inputs.get_position_ids().data<int64_t>(), inputs.get_position_ids().data<int64_t>() + 4),
+              std::vector<int64_t>({4, 5, 6, 7}));
+    // 1 candidate is accepted
+    inputs.trim(2);
+    EXPECT_EQ(inputs.get_sequence_length(), 6);
+    inputs.append({0}, 1);
+    EXPECT_EQ(inputs.get_position_ids().data<int64_t>()[0], 6);
+    EXPECT_EQ(inputs.get_attention_mask().get_shape(), ov::Shape({1, 7}));
+}
@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <limits>
 #include <openvino/core/except.hpp>
 
 #include "sampling/logit_processor.hpp"
+#include "sampling/vocab_prefix_index.hpp"
 
 using namespace ov::genai;
 using namespace ov::genai::LogitTransformers;
@@ -80,6 +82,38 @@ INSTANTIATE_TEST_SUITE_P(VariousInputs,
 
 
 
+TEST(TopPFilteringTest, NucleusSpanningSeveralBatches) {
+    // geometrically decaying probabilities, so that the nucleus is larger than the first batch of sorted candidates
+    std::vector<float> input(1000);
+    float probability = 0.05f, sum = 0.0f;
+    for (size_t i = 0; i < input.size(); i++, probability *= 0.99f) {
+        // shuffle the order of tokens
+        input[(i * 7) % input.size()] = probability;
+        sum += probability;
+    }
+    for (auto& value : input) {
+        value /= sum;
+    }
+    std::vector<float> sorted_input = input;
+    std::sort(sorted_input.begin(), sorted_input.end(), std::greater<float>());
+    size_t expected_size = 0;
+    float probability_sum = 0.0f;
+    while (probability_sum <= 0.9f) {
+        probability_sum += sorted_input[expected_size++];
+    }
+    ASSERT_GT(expected_size, 16);
+
+    auto logits = Logits(input.data(), input.size());
+    auto transform = TopPFilter(0.9f);
+    transform.apply(logits);
+    ASSERT_EQ(logits.m_size, expected_size);
+    ASSERT_EQ(logits.m_vector.size(), expected_size);
+    for (size_t i = 0; i < expected_size; i++) {
+        EXPECT_EQ(logits.m_vector[i].m_log_prob, sorted_input[i]);
+        EXPECT_EQ(logits.m_vector[i].m_index, (i * 7) % input.size());
+    }
+}
+
 struct TopKTestStruct {
     static inline const size_t size = 3;
 
@@ -128,6 +162,97 @@ TEST(TopKFilteringTest, FilterNotAppliedTopKGreaterThanInputSize) {
     }
 }
 
+TEST(TopKFilteringTest, LargeTopKOverLargeVocabulary) {
+    std::vector<float> input(1000);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<float>((i * 7) % input.size());
+    }
+    // both selection over the buffer and over the vector of tokens
+    for (size_t top_k : {50, 200}) {
+        auto logits = Logits(input.data(), input.size());
+        auto transform = TopKFilter(top_k);
+        transform.apply(logits);
+        ASSERT_EQ(logits.m_size, top_k);
+        ASSERT_EQ(logits.m_vector.size(), top_k);
+        for (size_t i = 0; i < top_k; i++) {
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, static_cast<float>(input.size() - 1 - i));
+        }
+    }
+}
+
+TEST(TopKFilteringTest, MaskedLogitsAreNotSelected) {
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<float> input(200, -inf);
+    input[150] = 1.0f;
+    input[7] = 3.0f;
+    input[99] = 2.0f;
+    // both selection over the buffer and over the vector of tokens
+    for (size_t top_k : {5, 100}) {
+        std::vector<float> data = input;
+        auto logits = Logits(data.data(), data.size());
+        TopKFilter(top_k).apply(logits);
+        ASSERT_EQ(logits.m_size, 3);
+        ASSERT_EQ(logits.m_vector.size(), 3);
+        EXPECT_EQ(logits.m_vector[0].m_index, 7);
+        EXPECT_EQ(logits.m_vector[1].m_index, 99);
+        EXPECT_EQ(logits.m_vector[2].m_index, 150);
+    }
+
+    std::vector<float> data = input;
+    auto logits = Logits(data.data(), data.size());
+    FusedTemperatureTopKFilter<false>(1.0, 5).apply(logits);
+    ASSERT_EQ(logits.m_size, 3);
+    ASSERT_EQ(logits.m_vector.size(), 3);
+    EXPECT_EQ(logits.m_vector[0].m_index, 7);
+    EXPECT_EQ(logits.m_vector[1].m_index, 99);
+    EXPECT_EQ(logits.m_vector[2].m_index, 150);
+}
+
+TEST(TopKFilteringTest, OneCandidateIsKeptIfAllLogitsAreMasked) {
+    std::vector<float> input(200, -std::numeric_limits<float>::infinity());
+    for (size_t top_k : {5, 100}) {
+        std::vector<float> data = input;
+        auto logits = Logits(data.data(), data.size());
+        TopKFilter(top_k).apply(logits);
+        ASSERT_EQ(logits.m_size, 1);
+        ASSERT_EQ(logits.m_vector.size(), 1);
+    }
+}
+
+TEST(FusedTemperatureTopKFilterTest, MatchesSeparateTransforms) {
+    std::vector<float> input(1000);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<float>((i * 37) % input.size()) / 100.0f;
+    }
+    for (float top_p : {1.0f, 0.3f}) {
+        for (size_t top_k : {1, 10, 64}) {
+            std::vector<float> reference_input = input, fused_input = input;
+            auto reference_logits = Logits(reference_input.data(), reference_input.size());
+            TemperatureLogitTransform(0.5).apply(reference_logits);
+            if (top_p != 1.0f) {
+                TopPFilter(top_p).apply(reference_logits);
+            }
+            TopKFilter(top_k).apply(reference_logits);
+
+            auto fused_logits = Logits(fused_input.data(), fused_input.size());
+            if (top_p != 1.0f) {
+                FusedTemperatureTopKFilter<true>(0.5, top_k, top_p).apply(fused_logits);
+            } else {
+                FusedTemperatureTopKFilter<false>(0.5, top_k).apply(fused_logits);
+            }
+            // the logits are not overwritten by the probabilities
+            EXPECT_EQ(fused_input, input);
+
+            ASSERT_EQ(fused_logits.m_size, reference_logits.m_size);
+            ASSERT_EQ(fused_logits.m_vector.size(), reference_logits.m_vector.size());
+            for (size_t i = 0; i < fused_logits.m_vector.size(); i++) {
+                EXPECT_EQ(fused_logits.m_vector[i].m_log_prob, reference_logits.m_vector[i].m_log_prob);
+                EXPECT_EQ(fused_logits.m_vector[i].m_index, reference_logits.m_vector[i].m_index);
+            }
+        }
+    }
+}
+
 struct RepetitionPenaltyTransformTestStruct {
     static inline const size_t size = 3;
 
@@ -344,3 +469,53 @@ INSTANTIATE_TEST_SUITE_P(VariousInputs,
                          EOSPenaltyTransformTest,
                          testing::ValuesIn(EOS_PENALTY_TRANSFORM_TEST_CASES));
 
+
+TEST(LogitProcessorPenaltiesTest, UseGeneratedTokensOfOwnSequence) {
+    GenerationConfig config;
+    config.frequency_penalty = 1.0f;
+    config.presence_penalty = 0.5f;
+    LogitProcessor logit_processor(config, {});
+    logit_processor.register_new_generated_token(1, 0);
+    logit_processor.register_new_generated_token(1, 0);
+    // forked sequence starts with the tokens of the parent one
+    logit_processor.fork_sequence(0, 1);
+    logit_processor.register_new_generated_token(2, 1);
+
+    std::vector<float> input{1.0f, 1.0f, 1.0f};
+    Logits logits(input.data(), input.size());
+    logit_processor.apply(logits, 0);
+    EXPECT_EQ(input, (std::vector<float>{1.0f, -1.5f, 1.0f}));
+
+    input = {1.0f, 1.0f, 1.0f};
+    logit_processor.apply(logits, 1);
+    EXPECT_EQ(input, (std::vector<float>{1.0f, -1.5f, -0.5f}));
+
+    // removed tokens are not penalized anymore
+    logit_processor.decrease_generated_token_occurance(1, 0);
+    logit_processor.decrease_generated_token_occurance(1, 0);
+    input = {1.0f, 1.0f, 1.0f};
+    logit_processor.apply(logits, 0);
+    EXPECT_EQ(input, (std::vector<float>{1.0f, 1.0f, 1.0f}));
+}
+
+TEST(LogitProcessorTokenHealingTest, FirstTokenStartsWithRemovedToken) {
+    std::vector<std::string> vocab = {"a", "hel", "hello", "he", "help", "x"};
+    VocabPrefixIndex vocab_prefix_index(vocab);
+    std::vector<int64_t> token_healing_ids = vocab_prefix_index.find_tokens_with_prefix("hel");
+    EXPECT_EQ(token_healing_ids, (std::vector<int64_t>{1, 2, 4}));
+    EXPECT_TRUE(vocab_prefix_index.find_tokens_with_prefix("z").empty());
+
+    GenerationConfig config;
+    LogitProcessor logit_processor(config, {}, nullptr, token_healing_ids);
+    std::vector<float> input(vocab.size(), 1.0f);
+    Logits logits(input.data(), input.size());
+    logit_processor.apply(logits, 0);
+    const float inf = std::numeric_limits<float>::infinity();
+    EXPECT_EQ(input, (std::vector<float>{-inf, 1.0f, 1.0f, -inf, 1.0f, -inf}));
+
+    // the next tokens are not constrained
+    logit_processor.update_generated_len(1);
+    input.assign(vocab.size(), 1.0f);
+    logit_processor.apply(logits, 0);
+    EXPECT_EQ(input, std::vector<float>(vocab.size(), 1.0f));
+}
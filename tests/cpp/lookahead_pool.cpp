@@ -0,0 +1,36 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "prompt_lookup/lookahead_pool.hpp"
+
+using namespace ov::genai;
+
+TEST(LookaheadPoolTest, returns_ngram_following_last_token) {
+    LookaheadPool pool(3);
+    pool.add_trajectory({1, 2, 3, 4});
+    EXPECT_EQ(pool.find_candidates(1, 2), std::vector<int64_t>({2, 3}));
+    EXPECT_EQ(pool.find_candidates(2, 2), std::vector<int64_t>({3, 4}));
+    // the trajectory is too short for an n-gram starting with 3
+    EXPECT_TRUE(pool.find_candidates(3, 2).empty());
+}
+
+TEST(LookaheadPoolTest, prefers_most_recent_ngram) {
+    LookaheadPool pool(2);
+    pool.add_trajectory({1, 5});
+    pool.add_trajectory({1, 6});
+    EXPECT_EQ(pool.find_candidates(1, 1), std::vector<int64_t>({6}));
+    pool.add_trajectory({1, 5});
+    EXPECT_EQ(pool.find_candidates(1, 1), std::vector<int64_t>({5}));
+}
+
+TEST(LookaheadPoolTest, keeps_most_recent_ngrams_within_bound) {
+    LookaheadPool pool(2, 2);
+    for (int64_t token : {5, 6, 7}) {
+        pool.add_trajectory({1, token});
+    }
+    EXPECT_EQ(pool.find_candidates(1, 1), std::vector<int64_t>({7}));
+    EXPECT_TRUE(pool.find_candidates(1, 0).empty());
+    EXPECT_TRUE(pool.find_candidates(7, 1).empty());
+}
@@ -0,0 +1,111 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "lora/fusion.hpp"
+
+using namespace ov::genai::utils;
+
+namespace {
+ov::Tensor get_random_tensor(const ov::Shape& shape, unsigned seed) {
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    ov::Tensor tensor(ov::element::f32, shape);
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        tensor.data<float>()[i] = distribution(engine);
+    }
+    return tensor;
+}
+
+// reference W + alpha * B x A of [out, in] shape
+std::vector<float> get_fused(const std::vector<float>& weights, const ov::Tensor& alpha, const ov::Tensor& A, const ov::Tensor& B) {
+    const size_t rank = A.get_shape()[0], in = A.get_shape()[1], out = B.get_shape()[0];
+    std::vector<float> fused = weights;
+    for (size_t row = 0; row < out; ++row) {
+        for (size_t i = 0; i < in; ++i) {
+            for (size_t r = 0; r < rank; ++r) {
+                fused[row * in + i] += alpha.data<float>()[r] * B.data<float>()[row * rank + r] * A.data<float>()[r * in + i];
+            }
+        }
+    }
+    return fused;
+}
+}  // namespace
+
+TEST(TestLoRAFusion, float_weights) {
+    const size_t out = 37, in = 24, rank = 4;
+    const ov::Tensor weights = get_random_tensor({out, in}, 1), A = get_random_tensor({rank, in}, 2), B = get_random_tensor({out, rank}, 3);
+    ov::Tensor alpha(ov::element::f32, {1, rank});
+    std::fill_n(alpha.data<float>(), rank, 0.5f);
+
+    ASSERT_TRUE(is_fusable(weights.get_shape(), alpha, A, B));
+    EXPECT_FALSE(is_fusable({in, out + 1}, alpha, A, B));
+
+    const ov::Tensor fused = fuse_lora_weights(weights, alpha, A, B);
+    ASSERT_EQ(fused.get_shape(), weights.get_shape());
+    const auto expected = get_fused({weights.data<float>(), weights.data<float>() + weights.get_size()}, alpha, A, B);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(fused.data<float>()[i], expected[i], 1e-5f);
+    }
+
+    ov::Tensor f16_weights(ov::element::f16, weights.get_shape());
+    std::copy_n(weights.data<float>(), weights.get_size(), f16_weights.data<ov::float16>());
+    const ov::Tensor f16_fused = fuse_lora_weights(f16_weights, alpha, A, B);
+    ASSERT_EQ(f16_fused.get_element_type(), ov::element::f16);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(static_cast<float>(f16_fused.data<ov::float16>()[i]), expected[i], 1e-2f);
+    }
+}
+
+TEST(TestLoRAFusion, compressed_weights) {
+    const size_t out = 20, num_groups = 3, group_size = 8, in = num_groups * group_size, rank = 2;
+    const ov::Tensor A = get_random_tensor({rank, in}, 4), B = get_random_tensor({out, rank}, 5);
+    ov::Tensor alpha(ov::element::f32, {1, rank});
+    std::fill_n(alpha.data<float>(), rank, 1.0f);
+
+    std::mt19937 engine(6);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    CompressedWeights weights{ov::Tensor(ov::element::u8, {out, num_groups, group_size}),
+                              ov::Tensor(ov::element::f32, {out, num_groups, 1}),
+                              ov::Tensor(ov::element::u8, {out, num_groups, 1})};
+    for (size_t i = 0; i < weights.weights.get_size(); ++i) {
+        weights.weights.data<uint8_t>()[i] = static_cast<uint8_t>(distribution(engine));
+    }
+    std::fill_n(weights.scales.data<float>(), weights.scales.get_size(), 0.01f);
+    std::fill_n(weights.zero_points.data<uint8_t>(), weights.zero_points.get_size(), uint8_t(128));
+
+    auto decompress = [&](const CompressedWeights& compressed, bool per_group_zero_points) {
+        std::vector<float> result(out * in);
+        for (size_t i = 0; i < result.size(); ++i) {
+            const size_t group = i / group_size;
+            const float zero_point = compressed.zero_points.data<uint8_t>()[per_group_zero_points ? group : 0];
+            result[i] = (compressed.weights.data<uint8_t>()[i] - zero_point) * compressed.scales.data<float>()[group];
+        }
+        return result;
+    };
+    const auto expected = get_fused(decompress(weights, true), alpha, A, B);
+
+    const auto fused = fuse_lora_weights(weights, alpha, A, B);
+    const auto decompressed = decompress(fused, true);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const float scale = fused.scales.data<float>()[i / group_size];
+        EXPECT_NEAR(decompressed[i], expected[i], scale);
+    }
+    // the original weights are not modified
+    EXPECT_FLOAT_EQ(weights.scales.data<float>()[0], 0.01f);
+
+    // a single zero point is kept
+    CompressedWeights shared_zero_point = weights;
+    shared_zero_point.zero_points = ov::Tensor(ov::element::u8, {1});
+    shared_zero_point.zero_points.data<uint8_t>()[0] = 128;
+    const auto fused_with_shared_zero_point = fuse_lora_weights(shared_zero_point, alpha, A, B);
+    EXPECT_EQ(fused_with_shared_zero_point.zero_points.data(), shared_zero_point.zero_points.data());
+    const auto decompressed_with_shared_zero_point = decompress(fused_with_shared_zero_point, false);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const float scale = fused_with_shared_zero_point.scales.data<float>()[i / group_size];
+        EXPECT_NEAR(decompressed_with_shared_zero_point[i], expected[i], scale);
+    }
+}
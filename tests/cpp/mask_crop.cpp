@@ -0,0 +1,82 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "image_generation/mask_crop.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// mask of [1, height, width, 1] shape with the rectangle [top, bottom) x [left, right) masked
+ov::Tensor get_mask(size_t height, size_t width, size_t top, size_t bottom, size_t left, size_t right) {
+    ov::Tensor mask(ov::element::u8, {1, height, width, 1});
+    uint8_t* data = mask.data<uint8_t>();
+    std::fill_n(data, mask.get_size(), uint8_t(0));
+    for (size_t y = top; y < bottom; ++y) {
+        std::fill_n(data + y * width + left, right - left, uint8_t(255));
+    }
+    return mask;
+}
+
+ov::Tensor get_image(size_t num_images, size_t height, size_t width, uint8_t value) {
+    ov::Tensor image(ov::element::u8, {num_images, height, width, 3});
+    std::fill_n(image.data<uint8_t>(), image.get_size(), value);
+    return image;
+}
+
+}  // namespace
+
+TEST(MaskCropTest, PadsAndAlignsBoundingBox) {
+    const ov::Tensor mask = get_mask(512, 512, 100, 120, 300, 310);
+    const auto crop = compute_mask_crop(mask, 16, 64);
+    ASSERT_TRUE(crop.has_value());
+    EXPECT_EQ(crop->height, 64);
+    EXPECT_EQ(crop->width, 64);
+    // the padded box [84, 136) x [284, 326) is grown around its center
+    EXPECT_EQ(crop->top, 78);
+    EXPECT_EQ(crop->left, 273);
+}
+
+TEST(MaskCropTest, FitsImageBorders) {
+    const ov::Tensor mask = get_mask(256, 192, 250, 256, 0, 4);
+    const auto crop = compute_mask_crop(mask, 8, 64);
+    ASSERT_TRUE(crop.has_value());
+    EXPECT_EQ(crop->top + crop->height, 256);
+    EXPECT_EQ(crop->left, 0);
+    EXPECT_EQ(crop->height, 64);
+    EXPECT_EQ(crop->width, 64);
+}
+
+TEST(MaskCropTest, EmptyMask) {
+    const ov::Tensor mask = get_mask(64, 64, 0, 0, 0, 0);
+    EXPECT_FALSE(compute_mask_crop(mask, 8, 64).has_value());
+}
+
+TEST(MaskCropTest, PastesCropWithFeathering) {
+    const size_t size = 128;
+    const ov::Tensor image = get_image(1, size, size, 0);
+    const ov::Tensor mask = get_mask(size, size, 48, 80, 48, 80);
+    const auto crop = compute_mask_crop(mask, 8, 64);
+    ASSERT_TRUE(crop.has_value());
+
+    const ov::Tensor cropped_mask = crop_image(mask, *crop);
+    const ov::Tensor inpainted = get_image(2, crop->height, crop->width, 200);
+    const ov::Tensor result = paste_mask_crop(image, inpainted, cropped_mask, *crop, 4);
+    ASSERT_EQ(result.get_shape(), ov::Shape({2, size, size, 3}));
+
+    const uint8_t* data = result.data<const uint8_t>();
+    auto pixel = [&](size_t n, size_t y, size_t x) {
+        return data[((n * size + y) * size + x) * 3];
+    };
+    for (size_t n = 0; n < 2; ++n) {
+        // inside of the mask, its border and out of the crop
+        EXPECT_EQ(pixel(n, 64, 64), 200);
+        EXPECT_EQ(pixel(n, 64, 48), 111);
+        EXPECT_EQ(pixel(n, 0, 0), 0);
+        EXPECT_EQ(pixel(n, 64, 40), 0);
+    }
+}
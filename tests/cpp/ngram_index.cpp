@@ -0,0 +1,48 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "prompt_lookup/ngram_index.hpp"
+
+using namespace ov::genai;
+
+namespace {
+NgramIndex make_index(const std::vector<int64_t>& tokens, size_t max_ngram_size) {
+    NgramIndex ngram_index(max_ngram_size);
+    for (int64_t token : tokens) {
+        ngram_index.append(token);
+    }
+    return ngram_index;
+}
+}  // namespace
+
+TEST(NgramIndexTest, returns_tokens_following_earliest_match) {
+    auto ngram_index = make_index({1, 2, 3, 1, 2, 4, 1, 2}, 2);
+    EXPECT_EQ(ngram_index.find_candidates(3), std::vector<int64_t>({3, 1, 2}));
+}
+
+TEST(NgramIndexTest, prefers_longest_ngram) {
+    auto ngram_index = make_index({2, 5, 1, 2, 6, 1, 2}, 3);
+    // "1 2" matches at position 2, "2" alone would match at position 0
+    EXPECT_EQ(ngram_index.find_candidates(2), std::vector<int64_t>({6, 1}));
+}
+
+TEST(NgramIndexTest, finds_overlapping_matches) {
+    auto ngram_index = make_index({1, 1, 2, 7, 1, 2}, 2);
+    EXPECT_EQ(ngram_index.find_candidates(1), std::vector<int64_t>({7}));
+}
+
+TEST(NgramIndexTest, does_not_match_suffix_itself) {
+    auto ngram_index = make_index({1, 2, 3}, 3);
+    EXPECT_TRUE(ngram_index.find_candidates(2).empty());
+    ngram_index.append(1);
+    EXPECT_EQ(ngram_index.find_candidates(2), std::vector<int64_t>({2, 3}));
+}
+
+TEST(NgramIndexTest, limits_number_of_candidates) {
+    auto ngram_index = make_index({4, 8, 9, 4}, 1);
+    EXPECT_EQ(ngram_index.find_candidates(1), std::vector<int64_t>({8}));
+    EXPECT_EQ(ngram_index.find_candidates(5), std::vector<int64_t>({8, 9, 4}));
+    EXPECT_TRUE(ngram_index.find_candidates(0).empty());
+}
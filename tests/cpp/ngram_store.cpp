@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "prompt_lookup/ngram_store.hpp"
+
+using namespace ov::genai;
+
+TEST(NgramStoreTest, returns_tokens_following_longest_ngram) {
+    NgramStore ngram_store(100);
+    // the prompt {1, 2} precedes the generated tokens
+    ngram_store.add({1, 2, 3, 4, 5, 2, 3, 6}, 2, 2, 3);
+    EXPECT_EQ(ngram_store.find_candidates({9, 2, 3}, 2, 3), std::vector<int64_t>({6}));
+    EXPECT_EQ(ngram_store.find_candidates({9, 1, 2}, 2, 3), std::vector<int64_t>({3, 4, 5}));
+    EXPECT_EQ(ngram_store.find_candidates({9, 4}, 2, 2), std::vector<int64_t>({5, 2}));
+    // the prompt is only the context of the n-grams
+    EXPECT_TRUE(ngram_store.find_candidates({9, 1}, 2, 2).empty());
+    EXPECT_TRUE(ngram_store.find_candidates({7}, 2, 2).empty());
+    EXPECT_TRUE(ngram_store.find_candidates({9, 4}, 2, 0).empty());
+}
+
+TEST(NgramStoreTest, evicts_least_recently_used_ngrams) {
+    NgramStore ngram_store(2);
+    ngram_store.add({1, 2}, 1, 1, 1);
+    ngram_store.add({3, 4}, 1, 1, 1);
+    EXPECT_EQ(ngram_store.find_candidates({1}, 1, 1), std::vector<int64_t>({2}));
+    ngram_store.add({5, 6}, 1, 1, 1);
+    EXPECT_EQ(ngram_store.size(), 2);
+    EXPECT_EQ(ngram_store.find_candidates({1}, 1, 1), std::vector<int64_t>({2}));
+    EXPECT_TRUE(ngram_store.find_candidates({3}, 1, 1).empty());
+    EXPECT_EQ(ngram_store.find_candidates({5}, 1, 1), std::vector<int64_t>({6}));
+}
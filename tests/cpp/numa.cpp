@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+#include "continuous_batching/numa.hpp"
+
+using namespace ov::genai;
+
+TEST(TestNuma, cpu_list_is_parsed) {
+    EXPECT_EQ(parse_cpu_list("0-3,8,10-11\n"), std::vector<size_t>({0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(parse_cpu_list("5"), std::vector<size_t>({5}));
+    EXPECT_TRUE(parse_cpu_list("").empty());
+    EXPECT_THROW(parse_cpu_list("3-1"), ov::Exception);
+    EXPECT_THROW(parse_cpu_list("a-b"), ov::Exception);
+}
+
+TEST(TestNuma, memory_is_bound_to_existing_node) {
+    std::vector<uint8_t> data(1 << 20);
+    EXPECT_FALSE(bind_memory_to_numa_node(data.data(), data.size(), 1 << 20));
+    if (get_numa_node_cpus(0).empty()) {
+        GTEST_SKIP() << "NUMA is not supported";
+    }
+    // the policy may not be permitted, e.g. in a container, but the memory stays usable
+    bind_memory_to_numa_node(data.data(), data.size(), 0);
+    data.back() = 1;
+    EXPECT_EQ(data.back(), 1);
+}
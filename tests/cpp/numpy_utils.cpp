@@ -0,0 +1,162 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "image_generation/numpy_utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+ov::Tensor get_tensor(const ov::Shape& shape, unsigned seed = 42) {
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    ov::Tensor tensor(ov::element::f32, shape);
+    float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = distribution(engine);
+    }
+    return tensor;
+}
+
+void expect_equal(const ov::Tensor& lhs, const ov::Tensor& rhs) {
+    ASSERT_EQ(lhs.get_shape(), rhs.get_shape());
+    const float* lhs_data = lhs.data<const float>();
+    const float* rhs_data = rhs.data<const float>();
+    for (size_t i = 0; i < lhs.get_size(); ++i) {
+        ASSERT_EQ(lhs_data[i], rhs_data[i]) << "at " << i;
+    }
+}
+}  // namespace
+
+TEST(TestNumpyUtils, concat_matches_pairwise_concat) {
+    const ov::Tensor latent = get_tensor({2, 4, 8, 8}, 1);
+    const ov::Tensor mask = get_tensor({2, 1, 8, 8}, 2);
+    const ov::Tensor masked_image_latent = get_tensor({2, 4, 8, 8}, 3);
+
+    const ov::Tensor expected = numpy_utils::concat(numpy_utils::concat(latent, mask, 1), masked_image_latent, 1);
+    ov::Tensor concatenated;
+    numpy_utils::concat({latent, mask, masked_image_latent}, 1, concatenated);
+    expect_equal(concatenated, expected);
+
+    // the buffer is reused by the next call of the same shape
+    const void* buffer = concatenated.data();
+    numpy_utils::concat({latent, mask, masked_image_latent}, -3, concatenated);
+    EXPECT_EQ(buffer, concatenated.data());
+    expect_equal(concatenated, expected);
+}
+
+TEST(TestNumpyUtils, concat_by_batch) {
+    const ov::Tensor tensor_1 = get_tensor({1, 3, 2}, 1);
+    const ov::Tensor tensor_2 = get_tensor({2, 3, 2}, 2);
+
+    const ov::Tensor concatenated = numpy_utils::concat(tensor_1, tensor_2, 0);
+    ASSERT_EQ(concatenated.get_shape(), ov::Shape({3, 3, 2}));
+    const float* data = concatenated.data<const float>();
+    for (size_t i = 0; i < tensor_1.get_size(); ++i) {
+        EXPECT_EQ(data[i], tensor_1.data<const float>()[i]);
+    }
+    for (size_t i = 0; i < tensor_2.get_size(); ++i) {
+        EXPECT_EQ(data[tensor_1.get_size() + i], tensor_2.data<const float>()[i]);
+    }
+}
+
+TEST(TestNumpyUtils, concat_rejects_mismatched_dimensions) {
+    ov::Tensor concatenated;
+    EXPECT_THROW(numpy_utils::concat({get_tensor({1, 4, 8, 8}), get_tensor({1, 4, 8, 4})}, 1, concatenated), ov::Exception);
+}
+
+TEST(TestNumpyUtils, repeat) {
+    const ov::Tensor input = get_tensor({1, 77, 8});
+
+    ov::Tensor repeated;
+    numpy_utils::repeat(input, 3, repeated);
+    ASSERT_EQ(repeated.get_shape(), ov::Shape({3, 77, 8}));
+    for (size_t n = 0; n < 3; ++n) {
+        for (size_t i = 0; i < input.get_size(); ++i) {
+            ASSERT_EQ(repeated.data<const float>()[n * input.get_size() + i], input.data<const float>()[i]);
+        }
+    }
+    expect_equal(numpy_utils::repeat(input, 3), repeated);
+}
+
+TEST(TestNumpyUtils, blend) {
+    const ov::Shape shape{2, 4, 8, 8};
+    const ov::Tensor image_latent = get_tensor(shape, 1);
+    const ov::Tensor mask = get_tensor({2, 1, 8, 8}, 2);
+    ov::Tensor latent = get_tensor(shape, 3);
+
+    ov::Tensor expected(ov::element::f32, shape);
+    const size_t channel_size = shape[2] * shape[3];
+    for (size_t b = 0; b < shape[0]; ++b) {
+        for (size_t c = 0; c < shape[1]; ++c) {
+            for (size_t i = 0; i < channel_size; ++i) {
+                const size_t idx = (b * shape[1] + c) * channel_size + i;
+                const float mask_value = mask.data<const float>()[b * channel_size + i];
+                expected.data<float>()[idx] = (1.0f - mask_value) * image_latent.data<const float>()[idx] +
+                                              mask_value * latent.data<const float>()[idx];
+            }
+        }
+    }
+
+    numpy_utils::blend(latent, image_latent, mask);
+    const float* latent_data = latent.data<const float>();
+    for (size_t i = 0; i < latent.get_size(); ++i) {
+        ASSERT_NEAR(latent_data[i], expected.data<const float>()[i], 1e-6f) << "at " << i;
+    }
+}
+
+TEST(TestNumpyUtils, blend_broadcasts_mask_batch) {
+    const ov::Tensor image_latent = get_tensor({2, 4, 8, 8}, 1);
+    ov::Tensor latent = get_tensor({2, 4, 8, 8}, 2);
+
+    // zero mask keeps the image latent only
+    ov::Tensor mask(ov::element::f32, {1, 1, 8, 8});
+    std::fill_n(mask.data<float>(), mask.get_size(), 0.0f);
+    numpy_utils::blend(latent, image_latent, mask);
+    expect_equal(latent, image_latent);
+
+    EXPECT_THROW(numpy_utils::blend(latent, image_latent, get_tensor({1, 1, 4, 4})), ov::Exception);
+}
+
+TEST(TestNumpyUtils, DISABLED_benchmark_inpainting_step) {
+    // SDXL inpainting latents of 1024x1024 images
+    const size_t num_steps = 50;
+    const ov::Tensor latent = get_tensor({1, 4, 128, 128}, 1);
+    const ov::Tensor mask = get_tensor({1, 1, 128, 128}, 2);
+    const ov::Tensor masked_image_latent = get_tensor({1, 4, 128, 128}, 3);
+    const ov::Tensor hidden_states = get_tensor({1, 77, 2048}, 4);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t step = 0; step < num_steps; ++step) {
+        numpy_utils::concat(numpy_utils::concat(latent, mask, 1), masked_image_latent, 1);
+        numpy_utils::repeat(hidden_states, 2);
+    }
+    const auto allocating_time = std::chrono::steady_clock::now() - start;
+
+    ov::Tensor model_input, repeated;
+    start = std::chrono::steady_clock::now();
+    for (size_t step = 0; step < num_steps; ++step) {
+        numpy_utils::concat({latent, mask, masked_image_latent}, 1, model_input);
+        numpy_utils::repeat(hidden_states, 2, repeated);
+    }
+    const auto preallocated_time = std::chrono::steady_clock::now() - start;
+
+    ov::Tensor blended = get_tensor({1, 4, 128, 128}, 5);
+    start = std::chrono::steady_clock::now();
+    for (size_t step = 0; step < num_steps; ++step) {
+        numpy_utils::blend(blended, masked_image_latent, mask);
+    }
+    const auto blend_time = std::chrono::steady_clock::now() - start;
+
+    using std::chrono::microseconds;
+    std::cout << num_steps << " steps: allocating concat / repeat "
+              << std::chrono::duration_cast<microseconds>(allocating_time).count() << " us, preallocated "
+              << std::chrono::duration_cast<microseconds>(preallocated_time).count() << " us; blend "
+              << std::chrono::duration_cast<microseconds>(blend_time).count() << " us" << std::endl;
+}
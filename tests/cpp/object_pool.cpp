@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "object_pool.hpp"
+
+using namespace ov::genai;
+
+namespace {
+struct PooledObject {
+    std::vector<int64_t> values;
+    size_t id;
+
+    explicit PooledObject(size_t id) : id(id) {}
+};
+}  // namespace
+
+TEST(TestObjectPool, memory_of_destroyed_objects_is_reused) {
+    std::shared_ptr<PooledObject> object = make_pooled<PooledObject>(1);
+    const void* address = object.get();
+    object.reset();
+
+    // the object and its control block are a single block of the pool
+    object = make_pooled<PooledObject>(2);
+    EXPECT_EQ(object.get(), address);
+    EXPECT_EQ(object->id, 2);
+}
+
+TEST(TestObjectPool, released_vectors_keep_capacity) {
+    auto& pool = VectorPool<int64_t>::get_instance();
+    std::vector<int64_t> values(100, 42);
+    const int64_t* data = values.data();
+    pool.release(std::move(values));
+
+    std::vector<int64_t> reused = pool.acquire();
+    EXPECT_TRUE(reused.empty());
+    EXPECT_GE(reused.capacity(), 100);
+    EXPECT_EQ(reused.data(), data);
+}
@@ -0,0 +1,30 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "visual_language/position_embedding_table.hpp"
+
+using namespace ov::genai;
+
+TEST(TestPositionEmbeddingTable, rows_are_computed_once) {
+    size_t num_computed_rows = 0;
+    PositionEmbeddingTable table(2, [&](size_t position, float* row) {
+        ++num_computed_rows;
+        row[0] = static_cast<float>(position);
+        row[1] = -static_cast<float>(position);
+    });
+
+    auto rows = table.get(3);
+    ASSERT_EQ(rows->size(), 6);
+    EXPECT_EQ(num_computed_rows, 3);
+    EXPECT_EQ(table.get(2), rows);
+    EXPECT_EQ(num_computed_rows, 3);
+
+    auto grown_rows = table.get(5);
+    ASSERT_EQ(grown_rows->size(), 10);
+    EXPECT_EQ(num_computed_rows, 5);
+    EXPECT_EQ(*grown_rows, std::vector<float>({0, 0, 1, -1, 2, -2, 3, -3, 4, -4}));
+    // the previously returned rows stay valid
+    EXPECT_EQ(*rows, std::vector<float>({0, 0, 1, -1, 2, -2}));
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "continuous_batching/prefix_tree.hpp"
+
+TEST(TestPrefixTree, general_test) {
+    ov::genai::PrefixTree prefix_tree;
+    EXPECT_TRUE(prefix_tree.insert(std::nullopt, {0, 1, 2, 3}, 11));
+    EXPECT_TRUE(prefix_tree.insert(11, {4, 5, 6, 7}, 12));
+    EXPECT_TRUE(prefix_tree.insert(12, {8, 9}, 13));
+    // diverging second block
+    EXPECT_TRUE(prefix_tree.insert(11, {4, 5, 6, 8}, 22));
+    // parent is unknown
+    EXPECT_FALSE(prefix_tree.insert(99, {1, 2, 3, 4}, 33));
+    EXPECT_EQ(prefix_tree.num_nodes(), 4);
+
+    auto first_block = prefix_tree.find_child(prefix_tree.root(), {0, 1, 2, 3});
+    ASSERT_NE(first_block, nullptr);
+    EXPECT_EQ(first_block->hash, 11);
+    EXPECT_EQ(prefix_tree.find_child(prefix_tree.root(), {0, 1, 2}), nullptr);
+
+    auto second_block = prefix_tree.find_child(first_block, {4, 5, 6, 8});
+    ASSERT_NE(second_block, nullptr);
+    EXPECT_EQ(second_block->hash, 22);
+
+    second_block = prefix_tree.find_child(first_block, {4, 5, 6, 7});
+    ASSERT_NE(second_block, nullptr);
+    auto partial_block = prefix_tree.find_longest_prefix_child(second_block, {8, 9, 10, 11});
+    ASSERT_NE(partial_block, nullptr);
+    EXPECT_EQ(partial_block->hash, 13);
+    EXPECT_EQ(partial_block->tokens.size(), 2);
+    EXPECT_EQ(prefix_tree.find_longest_prefix_child(second_block, {8, 10, 11, 12}), nullptr);
+
+    // erasing a block removes all blocks following it
+    prefix_tree.erase(12);
+    EXPECT_EQ(prefix_tree.num_nodes(), 2);
+    EXPECT_EQ(prefix_tree.find_child(first_block, {4, 5, 6, 7}), nullptr);
+    EXPECT_FALSE(prefix_tree.insert(12, {8, 9}, 13));
+}
+
+TEST(TestPrefixTree, updates_hash_of_same_contents) {
+    ov::genai::PrefixTree prefix_tree;
+    prefix_tree.insert(std::nullopt, {0, 1, 2, 3}, 11);
+    prefix_tree.insert(11, {4, 5}, 12);
+    prefix_tree.insert(11, {4, 5}, 42);
+    EXPECT_EQ(prefix_tree.num_nodes(), 2);
+    auto block = prefix_tree.find_longest_prefix_child(prefix_tree.find_child(prefix_tree.root(), {0, 1, 2, 3}), {4, 5, 6});
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(block->hash, 42);
+}
+
+TEST(TestPrefixTree, prune) {
+    ov::genai::PrefixTree prefix_tree;
+    prefix_tree.insert(std::nullopt, {0, 1}, 1);
+    prefix_tree.insert(1, {2, 3}, 2);
+    prefix_tree.insert(2, {4, 5}, 3);
+    prefix_tree.insert(std::nullopt, {7, 8}, 4);
+    prefix_tree.insert(4, {9, 10}, 5);
+
+    prefix_tree.prune([](size_t hash) { return hash != 2 && hash != 5; });
+    EXPECT_EQ(prefix_tree.num_nodes(), 2);
+    EXPECT_NE(prefix_tree.find_child(prefix_tree.root(), {0, 1}), nullptr);
+    EXPECT_NE(prefix_tree.find_child(prefix_tree.root(), {7, 8}), nullptr);
+    EXPECT_EQ(prefix_tree.find_child(prefix_tree.find_child(prefix_tree.root(), {0, 1}), {2, 3}), nullptr);
+}
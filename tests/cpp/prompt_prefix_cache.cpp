@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/prompt_prefix_cache.hpp"
+
+using namespace ov::genai;
+
+TEST(TestPromptPrefixCache, only_checked_prefixes_are_reused) {
+    PromptPrefixCache cache(4);
+    cache.add_candidate("<system>", true);
+    EXPECT_FALSE(cache.find("<system>Hi", true));
+    EXPECT_EQ(cache.find_candidate("<system>Hi", true), std::optional<std::string>("<system>"));
+    EXPECT_FALSE(cache.find_candidate("<system>Hi", false));
+    EXPECT_FALSE(cache.find_candidate("<user>Hi", true));
+
+    cache.set_checked("<system>", true, std::vector<int64_t>{1, 2});
+    EXPECT_FALSE(cache.find_candidate("<system>Hi", true));
+    auto match = cache.find("<system>Hi", true);
+    ASSERT_TRUE(match);
+    EXPECT_EQ(match->first, 8);
+    EXPECT_EQ(match->second, std::vector<int64_t>({1, 2}));
+
+    // the prefix which can't be reused isn't checked again
+    cache.add_candidate("<sys", true);
+    cache.set_checked("<sys", true, std::nullopt);
+    EXPECT_FALSE(cache.find_candidate("<sys>", true));
+    EXPECT_FALSE(cache.find("<sys>", true));
+}
+
+TEST(TestPromptPrefixCache, longest_prefix_is_found_and_least_recently_used_is_evicted) {
+    PromptPrefixCache cache(2);
+    cache.add_candidate("a", true);
+    cache.set_checked("a", true, std::vector<int64_t>{1});
+    cache.add_candidate("ab", true);
+    cache.set_checked("ab", true, std::vector<int64_t>{2});
+    EXPECT_EQ(cache.find("abc", true)->first, 2);
+
+    // "a" is the least recently used one
+    cache.add_candidate("x", true);
+    EXPECT_FALSE(cache.find("ax", true));
+    EXPECT_EQ(cache.find("abc", true)->first, 2);
+}
+
+TEST(TestPromptPrefixCache, boundary_window_is_not_split_inside_of_a_character) {
+    EXPECT_EQ(PromptPrefixCache::boundary_window("<system>Hi", 8, 4), std::make_pair(size_t(4), size_t(10)));
+    EXPECT_EQ(PromptPrefixCache::boundary_window("<system>Hello", 8, 2), std::make_pair(size_t(6), size_t(10)));
+    // "\xD0\x9F" is a two byte character on each side of the prefix end
+    const std::string prompt = "ab\xD0\x9F|\xD0\x9F" "cd";
+    EXPECT_EQ(PromptPrefixCache::boundary_window(prompt, 5, 1), std::make_pair(size_t(4), size_t(5)));
+    EXPECT_EQ(PromptPrefixCache::boundary_window(prompt, 5, 2), std::make_pair(size_t(4), size_t(7)));
+    EXPECT_EQ(PromptPrefixCache::boundary_window(prompt, 5, 3), std::make_pair(size_t(2), size_t(8)));
+}
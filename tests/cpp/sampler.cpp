@@ -300,3 +300,93 @@ TEST(SamplerValidationMode, prompt_phase) {
              expected{0, 1, 2, 3};
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
+
+TEST(SamplerPrepare, sets_up_logit_processors_of_scheduled_groups) {
+    auto sampling_config = ov::genai::greedy();
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+        SequenceGroup::Ptr(new SequenceGroup(1, input_tensor, sampling_config, 32)),
+    };
+    sequence_groups.front()->schedule_tokens(input_vector.size());
+
+    Sampler sampler;
+    sampler.prepare(sequence_groups);
+    EXPECT_NO_THROW(sampler.get_logit_processor(0));
+    // not scheduled group is set up on its first scheduling
+    EXPECT_THROW(sampler.get_logit_processor(1), ov::Exception);
+}
+
+TEST(SamplerDeviceGreedySampling, appends_device_sampled_tokens) {
+    auto sampling_config = ov::genai::greedy();
+    sampling_config.logprobs = 1;
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+    sequence_groups.front()->schedule_tokens(input_vector.size());
+
+    Sampler sampler;
+    // logit processors are not set up yet
+    EXPECT_FALSE(sampler.can_use_device_greedy_sampling(sequence_groups));
+    sampler.prepare(sequence_groups);
+    ASSERT_TRUE(sampler.can_use_device_greedy_sampling(sequence_groups));
+
+    // the model outputs the selected token and its log probability instead of the logits
+    std::vector<int64_t> token_ids{3};
+    std::vector<float> log_probs{-0.5f};
+    ov::Tensor token_ids_tensor(ov::element::i64, ov::Shape{1, 1, 1}, token_ids.data());
+    ov::Tensor log_probs_tensor(ov::element::f32, ov::Shape{1, 1, 1}, log_probs.data());
+    sampler.sample(sequence_groups, log_probs_tensor, false, token_ids_tensor);
+
+    const auto sequence = sequence_groups.front()->get_sequences().front();
+    ASSERT_EQ(sequence->get_generated_ids(), TokenIds{3});
+    ASSERT_EQ(sequence->get_generated_log_probs(), std::vector<float>{-0.5f});
+}
+
+TEST(SamplerDeviceGreedySampling, not_used_for_multinomial_groups) {
+    auto sampling_config = ov::genai::multinomial();
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+    sequence_groups.front()->schedule_tokens(input_vector.size());
+
+    Sampler sampler;
+    sampler.prepare(sequence_groups);
+    EXPECT_FALSE(sampler.can_use_device_greedy_sampling(sequence_groups));
+}
+
+TEST(SamplerMultinomial, results_do_not_depend_on_batch_composition) {
+    ov::genai::GenerationConfig sampling_config;
+    sampling_config.do_sample = true;
+    sampling_config.max_new_tokens = 8;
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    // uniform distribution over the vocabulary
+    const size_t vocab_size = 1000;
+
+    auto sample_request = [&](size_t num_other_requests) {
+        std::vector<SequenceGroup::Ptr> sequence_groups;
+        for (size_t request_id = 0; request_id <= num_other_requests; ++request_id) {
+            // the request of interest goes last and has the same id in all batches
+            const uint64_t id = request_id == num_other_requests ? 100 : request_id;
+            sequence_groups.push_back(SequenceGroup::Ptr(new SequenceGroup(id, input_tensor, sampling_config, 32)));
+            sequence_groups.back()->schedule_tokens(input_vector.size());
+        }
+        std::vector<float> logits(sequence_groups.size() * vocab_size, 0.0f);
+        ov::Tensor logits_tensor(ov::element::f32, ov::Shape{sequence_groups.size(), 1, vocab_size}, logits.data());
+
+        Sampler sampler;
+        sampler.set_seed(42);
+        sampler.sample(sequence_groups, logits_tensor);
+        return sequence_groups.back()->get_sequences().front()->get_generated_ids();
+    };
+
+    const auto generated_ids = sample_request(0);
+    ASSERT_EQ(generated_ids.size(), 1);
+    EXPECT_EQ(sample_request(3), generated_ids);
+}
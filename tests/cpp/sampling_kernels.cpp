@@ -0,0 +1,82 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <random>
+
+#include "sampling/sampling_kernels.hpp"
+
+using namespace ov::genai::sampling_kernels;
+
+TEST(SamplingKernelsTest, fast_exp_matches_std_exp) {
+    for (float x = -87.0f; x < 88.0f; x += 0.01f) {
+        EXPECT_NEAR(fast_exp(x), std::exp(x), std::exp(x) * 1e-6) << "x = " << x;
+    }
+    EXPECT_EQ(fast_exp(0.0f), 1.0f);
+    EXPECT_EQ(fast_exp(-100.0f), 0.0f);
+    EXPECT_EQ(fast_exp(-std::numeric_limits<float>::infinity()), 0.0f);
+}
+
+TEST(SamplingKernelsTest, reductions_match_reference) {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> distribution(0.0f, 4.0f);
+    // sizes which are and are not multiple of the chunk size
+    for (size_t size : {1, 15, 16, 17, 1000, 32001}) {
+        std::vector<float> data(size);
+        for (auto& value : data) {
+            value = distribution(rng);
+        }
+        if (size > 1) {
+            // masked out token
+            data[size / 2] = -std::numeric_limits<float>::infinity();
+        }
+
+        float max_value = *std::max_element(data.begin(), data.end());
+        EXPECT_EQ(reduce_max(data.data(), size), max_value);
+
+        double reference_sum = 0.0;
+        for (float value : data) {
+            reference_sum += std::exp((static_cast<double>(value) - max_value) * 0.5);
+        }
+        EXPECT_NEAR(sum_exp(data.data(), size, max_value, 0.5f), reference_sum, reference_sum * 1e-5);
+
+        std::vector<float> exps = data;
+        EXPECT_NEAR(exp_inplace(exps.data(), size, max_value, 0.5f), reference_sum, reference_sum * 1e-5);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_NEAR(exps[i], std::exp((data[i] - max_value) * 0.5f), 1e-6);
+        }
+    }
+}
+
+TEST(SamplingKernelsTest, top_m_matches_insertion_sort) {
+    std::mt19937 rng(42);
+    // a small range of values to get many ties
+    std::uniform_int_distribution<int> distribution(-50, 50);
+    for (size_t size : {3, 16, 33, 5003}) {
+        std::vector<float> data(size);
+        for (auto& value : data) {
+            value = static_cast<float>(distribution(rng));
+        }
+        for (size_t m : {1, 2, 5, 40}) {
+            std::vector<size_t> expected_indexes(size);
+            std::iota(expected_indexes.begin(), expected_indexes.end(), 0);
+            std::stable_sort(expected_indexes.begin(), expected_indexes.end(), [&](size_t lhs, size_t rhs) {
+                return data[lhs] > data[rhs];
+            });
+
+            std::vector<float> values(m);
+            std::vector<size_t> indexes(m);
+            top_m(data.data(), size, m, values.data(), indexes.data());
+            for (size_t i = 0; i < m; ++i) {
+                if (i < size) {
+                    EXPECT_EQ(indexes[i], expected_indexes[i]);
+                    EXPECT_EQ(values[i], data[expected_indexes[i]]);
+                } else {
+                    EXPECT_EQ(values[i], -std::numeric_limits<float>::infinity());
+                }
+            }
+        }
+    }
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <filesystem>
+
 #include <gtest/gtest.h>
 #include "openvino/runtime/core.hpp"
 #include "openvino/op/concat.hpp"
@@ -1114,3 +1116,438 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
 }
 
 
+
+TEST(TestScheduler, priority_policy_preempts_lowest_priority_group) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 6;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.scheduling_policy = SchedulingPolicy::PRIORITY;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    std::vector<int64_t> priorities = {0, 2, 1};
+    std::vector<SequenceGroup::Ptr> requests;
+    for (size_t i = 0; i < priorities.size(); ++i) {
+        auto generation_config = ov::genai::greedy();
+        generation_config.priority = priorities[i];
+        requests.push_back(std::make_shared<SequenceGroup>(i, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4));
+    }
+    auto idx0 = (*requests[0])[0]->get_id();
+
+    // schedule 3 sequence groups that use 6 kv blocks, in order of priority
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out1 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids = {1, 2, 0};
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, ref_ids);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size() * 3);
+
+    for (auto seq: requests) {
+        seq->finish_iteration();
+    }
+
+    // the group with the lowest priority should be evicted, even though it arrived first
+    auto out2 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids2 = {1, 2};
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids2);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 2);
+    EXPECT_FALSE(scheduler.has_block_table(idx0));
+}
+
+TEST(TestScheduler, deadline_and_fair_share_policies_order_prompts) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = false;
+    scheduler_config.max_num_seqs = 5;
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+
+    {
+        // the group with the closest TTFT deadline goes first, the groups without objective go last
+        scheduler_config.scheduling_policy = SchedulingPolicy::DEADLINE;
+        std::vector<size_t> ttft_slos_ms = {0, 100000, 1000};
+        std::vector<SequenceGroup::Ptr> requests;
+        for (size_t i = 0; i < ttft_slos_ms.size(); ++i) {
+            auto generation_config = ov::genai::greedy();
+            generation_config.ttft_slo_ms = ttft_slos_ms[i];
+            requests.push_back(std::make_shared<SequenceGroup>(i, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4));
+        }
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        for (uint64_t ref_id : {2, 1, 0}) {
+            auto out = scheduler.schedule(requests);
+            EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>{ref_id});
+            for (auto seq: requests) {
+                seq->finish_iteration();
+            }
+        }
+    }
+
+    {
+        // the tenant which was served less tokens goes first
+        scheduler_config.scheduling_policy = SchedulingPolicy::FAIR_SHARE;
+        std::vector<std::string> tenants = {"a", "a", "b"};
+        std::vector<SequenceGroup::Ptr> requests;
+        for (size_t i = 0; i < tenants.size(); ++i) {
+            auto generation_config = ov::genai::greedy();
+            generation_config.tenant_id = tenants[i];
+            requests.push_back(std::make_shared<SequenceGroup>(i, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4));
+        }
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        for (uint64_t ref_id : {0, 2, 1}) {
+            auto out = scheduler.schedule(requests);
+            EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>{ref_id});
+            for (auto seq: requests) {
+                seq->finish_iteration();
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, prefix_cache_aware_policy_serves_cached_prompts_first) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.enable_prefix_caching = true;
+    scheduler_config.scheduling_policy = SchedulingPolicy::PREFIX_CACHE_AWARE;
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    auto make_request = [] (uint64_t request_id, std::vector<uint64_t> tokens) {
+        return std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), ov::genai::greedy(), 4);
+    };
+    auto finish_iteration = [] (std::vector<SequenceGroup::Ptr>& requests) {
+        for (auto& request : requests) {
+            for (auto& sequence : request->get_running_sequences()) {
+                if (!request->requires_sampling()) {
+                    continue;
+                }
+                sequence->append_token(23, 0.7);
+            }
+            request->finish_iteration();
+        }
+    };
+
+    // the prompt extending the prompt of the first request, which arrived at the same time, restores its blocks once they are computed
+    std::vector<SequenceGroup::Ptr> requests = {make_request(0, {0,1,2,3,4,5,6,7}), make_request(1, {0,1,2,3,4,5,6,7,8,9,10,11})};
+    for (auto& request : requests) {
+        scheduler.restore_cached_blocks(request);
+    }
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, std::vector<uint64_t>{0});
+    finish_iteration(requests);
+
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, (std::vector<uint64_t>{0, 1}));
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 1 + 4);
+    EXPECT_EQ(requests[1]->get_request_metrics().num_prefix_cache_hit_tokens, 8);
+    finish_iteration(requests);
+
+    // the prompt with the cached prefix overtakes the prompt which arrived before it
+    requests.push_back(make_request(2, {20,21,22,23,24,25,26,27}));
+    requests.push_back(make_request(3, {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15}));
+    for (size_t request_id : {2, 3}) {
+        scheduler.restore_cached_blocks(requests[request_id]);
+    }
+    auto out3 = scheduler.schedule(requests);
+    EXPECT_EQ(out3.m_scheduled_sequence_groups_ids, (std::vector<uint64_t>{0, 1, 3, 2}));
+    EXPECT_EQ(requests[3]->get_num_scheduled_tokens(), 4);
+    EXPECT_EQ(requests[2]->get_num_scheduled_tokens(), 2);
+}
+
+TEST(TestScheduler, prefix_cache_digest_contains_cached_blocks) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.enable_prefix_caching = true;
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    EXPECT_EQ(scheduler.get_prefix_cache_digest().num_blocks, 0);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7,8,9};
+    auto sequence_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), ov::genai::greedy(), 4);
+    scheduler.restore_cached_blocks(sequence_group);
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+    scheduler.schedule(requests);
+    sequence_group->finish_iteration();
+
+    PrefixCacheDigest digest = scheduler.get_prefix_cache_digest();
+    EXPECT_EQ(digest.block_size, 4);
+    EXPECT_EQ(digest.num_blocks, 3);
+    // the full blocks of the prompts sharing the prefix are found in the digest, hashed without the pipeline
+    auto get_num_cached_blocks = [&] (std::vector<int64_t> prompt) {
+        return digest.get_num_cached_blocks(PrefixCacheDigest::get_block_hashes(prompt, digest.block_size));
+    };
+    EXPECT_EQ(get_num_cached_blocks({0,1,2,3,4,5,6,7,8,9,10,11}), 2);
+    EXPECT_EQ(get_num_cached_blocks({0,1,2,3,4,5,6,8}), 1);
+    EXPECT_EQ(get_num_cached_blocks({1,1,2,3,4,5,6,7}), 0);
+    EXPECT_EQ(get_num_cached_blocks({0,1,2}), 0);
+}
+
+TEST(TestScheduler, expired_waiting_requests_are_not_scheduled) {
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    for (bool dynamic_split_fuse : {true, false}) {
+        SchedulerConfig scheduler_config;
+        scheduler_config.max_num_batched_tokens = 32;
+        scheduler_config.num_kv_blocks = 100;
+        scheduler_config.dynamic_split_fuse = dynamic_split_fuse;
+        scheduler_config.max_num_seqs = 5;
+
+        std::vector<SequenceGroup::Ptr> requests;
+        for (size_t deadline_ms : {0, 1000}) {
+            auto generation_config = ov::genai::greedy();
+            generation_config.deadline_ms = deadline_ms;
+            requests.push_back(std::make_shared<SequenceGroup>(requests.size(), ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), generation_config, 4));
+        }
+        // the deadline of the second request has passed while it was waiting
+        requests[1]->set_arrival_time(std::chrono::steady_clock::now() - std::chrono::seconds(2));
+        EXPECT_FALSE(requests[0]->is_expired());
+        EXPECT_TRUE(requests[1]->is_expired());
+
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>{0});
+        EXPECT_FALSE(scheduler.has_block_table(requests[1]->get_sequences()[0]->get_id()));
+    }
+}
+
+TEST(TestScheduler, prefill_chunks_are_limited_per_step) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 16;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.max_num_prefill_tokens_per_step = 8;
+
+    std::vector<uint64_t> short_prompt(12), long_prompt(24);
+    std::iota(short_prompt.begin(), short_prompt.end(), 0);
+    std::iota(long_prompt.begin(), long_prompt.end(), 0);
+    std::vector<SequenceGroup::Ptr> requests = {
+        std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {short_prompt.size()}, short_prompt.data()), ov::genai::greedy(), 4)
+    };
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // prompt is split into chunks of 8 tokens, even though the whole prompt fits into a batch
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, 8);
+    EXPECT_EQ(out1.m_total_num_scheduled_prompt_tokens, 8);
+    requests[0]->finish_iteration();
+
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(out2.m_total_num_scheduled_prompt_tokens, 4);
+    requests[0]->finish_iteration();
+
+    // the long prompt is chunked alongside the generation of the first sequence
+    requests.push_back(std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {long_prompt.size()}, long_prompt.data()), ov::genai::greedy(), 4));
+    auto out3 = scheduler.schedule(requests);
+    std::vector<uint64_t> ref_ids = {0, 1};
+    EXPECT_EQ(out3.m_scheduled_sequence_groups_ids, ref_ids);
+    EXPECT_EQ(out3.m_total_num_scheduled_tokens, 9);
+    EXPECT_EQ(out3.m_total_num_scheduled_prompt_tokens, 8);
+    EXPECT_EQ(requests[1]->get_num_scheduled_tokens(), 8);
+}
+
+TEST(TestScheduler, prefill_fraction_is_applied_only_at_generation_steps) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 16;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.max_prefill_fraction = 0.25f;
+
+    std::vector<uint64_t> prompt(16);
+    std::iota(prompt.begin(), prompt.end(), 0);
+    std::vector<SequenceGroup::Ptr> requests = {
+        std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prompt.size()}, prompt.data()), ov::genai::greedy(), 4)
+    };
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // nothing is generating, so the prompt can take the whole batch
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(out1.m_total_num_scheduled_prompt_tokens, 16);
+    requests[0]->finish_iteration();
+
+    requests.push_back(std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {prompt.size()}, prompt.data()), ov::genai::greedy(), 4));
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 5);
+    EXPECT_EQ(out2.m_total_num_scheduled_prompt_tokens, 4);
+}
+
+TEST(TestScheduler, prefix_cache_is_saved_and_loaded) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.enable_prefix_caching = true;
+    const size_t num_decoder_layers = 12, fingerprint = 42;
+    const std::filesystem::path prefix_cache_path = std::filesystem::temp_directory_path() / "test_scheduler_prefix_cache.bin";
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto create_sequence_group = [&](uint64_t request_id) {
+        return std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), ov::genai::greedy(), 4);
+    };
+    auto fill_block = [](CacheManager& cache_manager, size_t layer_idx, size_t block_id, uint8_t value) {
+        std::vector<uint8_t> data(cache_manager.get_layer_block_size_in_bytes(layer_idx), value);
+        cache_manager.copy_block_from_host(layer_idx, block_id, data.data());
+    };
+    auto get_block_value = [](CacheManager& cache_manager, size_t layer_idx, size_t block_id) {
+        std::vector<uint8_t> data(cache_manager.get_layer_block_size_in_bytes(layer_idx));
+        cache_manager.copy_block_to_host(layer_idx, block_id, data.data());
+        EXPECT_TRUE(std::all_of(data.begin(), data.end(), [&](uint8_t value) { return value == data[0]; }));
+        return data[0];
+    };
+
+    size_t num_saved_blocks = 0;
+    {
+        auto cache_manager = init_cache_manager(scheduler_config);
+        Scheduler scheduler = Scheduler(4, cache_manager, scheduler_config, num_decoder_layers);
+        auto sequence_group = create_sequence_group(0);
+        scheduler.restore_cached_blocks(sequence_group);
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, tokens.size());
+
+        auto sequence = sequence_group->get_running_sequences()[0];
+        const auto& block_tables = scheduler.get_block_tables(*sequence);
+        for (size_t layer_idx = 0; layer_idx < num_decoder_layers; ++layer_idx) {
+            for (size_t logical_block_idx = 0; logical_block_idx < block_tables[layer_idx].size(); ++logical_block_idx) {
+                fill_block(*cache_manager, layer_idx, block_tables[layer_idx][logical_block_idx]->get_index(), logical_block_idx + 1);
+            }
+        }
+        sequence->append_token(23, 0.7);
+        sequence_group->finish_iteration();
+        sequence->set_status(SequenceStatus::FINISHED);
+        scheduler.free_sequence(sequence->get_id());
+
+        num_saved_blocks = scheduler.save_prefix_cache(prefix_cache_path, fingerprint);
+        EXPECT_EQ(num_saved_blocks, tokens.size() / 4);
+    }
+
+    {
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config, num_decoder_layers);
+        EXPECT_THROW(scheduler.load_prefix_cache(prefix_cache_path, fingerprint + 1), ov::Exception);
+    }
+
+    auto cache_manager = init_cache_manager(scheduler_config);
+    Scheduler scheduler = Scheduler(4, cache_manager, scheduler_config, num_decoder_layers);
+    EXPECT_EQ(scheduler.load_prefix_cache(prefix_cache_path, fingerprint), num_saved_blocks);
+    std::filesystem::remove(prefix_cache_path);
+
+    auto sequence_group = create_sequence_group(1);
+    scheduler.restore_cached_blocks(sequence_group);
+    // the whole prompt is restored, except for the last token to be processed to get logits
+    EXPECT_EQ(sequence_group->get_num_processed_tokens(), tokens.size() - 1);
+    auto sequence = sequence_group->get_not_finished_sequences()[0];
+    const auto& block_tables = scheduler.get_block_tables(*sequence);
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; ++layer_idx) {
+        ASSERT_EQ(block_tables[layer_idx].size(), num_saved_blocks);
+        for (size_t logical_block_idx = 0; logical_block_idx < num_saved_blocks; ++logical_block_idx) {
+            EXPECT_EQ(get_block_value(*cache_manager, layer_idx, block_tables[layer_idx][logical_block_idx]->get_index()), logical_block_idx + 1);
+        }
+    }
+    scheduler.free_sequence(sequence->get_id());
+}
+
+TEST(TestScheduler, prefix_blocks_are_exported_and_imported) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.enable_prefix_caching = true;
+    const size_t num_decoder_layers = 12, fingerprint = 42;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto create_sequence_group = [&](uint64_t request_id) {
+        return std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), ov::genai::greedy(), 4);
+    };
+
+    auto prefill_cache_manager = init_cache_manager(scheduler_config);
+    Scheduler prefill_scheduler = Scheduler(4, prefill_cache_manager, scheduler_config, num_decoder_layers);
+    auto sequence_group = create_sequence_group(0);
+    prefill_scheduler.restore_cached_blocks(sequence_group);
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+    prefill_scheduler.schedule(requests);
+
+    auto sequence = sequence_group->get_running_sequences()[0];
+    const auto& prefill_block_tables = prefill_scheduler.get_block_tables(*sequence);
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; ++layer_idx) {
+        for (size_t logical_block_idx = 0; logical_block_idx < prefill_block_tables[layer_idx].size(); ++logical_block_idx) {
+            std::vector<uint8_t> data(prefill_cache_manager->get_layer_block_size_in_bytes(layer_idx), logical_block_idx + 1);
+            prefill_cache_manager->copy_block_from_host(layer_idx, prefill_block_tables[layer_idx][logical_block_idx]->get_index(), data.data());
+        }
+    }
+    sequence->append_token(23, 0.7);
+    sequence_group->finish_iteration();
+    sequence->set_status(SequenceStatus::FINISHED);
+    prefill_scheduler.free_sequence(sequence->get_id());
+
+    const std::vector<uint8_t> kv_blocks = prefill_scheduler.export_prefix_blocks({0,1,2,3,4,5,6,7}, fingerprint);
+    // the blocks of a prompt not in the prefix cache aren't exported
+    const std::vector<uint8_t> no_kv_blocks = prefill_scheduler.export_prefix_blocks({7,7,7,7,7}, fingerprint);
+
+    auto decode_cache_manager = init_cache_manager(scheduler_config);
+    Scheduler decode_scheduler = Scheduler(4, decode_cache_manager, scheduler_config, num_decoder_layers);
+    EXPECT_THROW(decode_scheduler.import_prefix_blocks(kv_blocks, fingerprint + 1), ov::Exception);
+    EXPECT_EQ(decode_scheduler.import_prefix_blocks(no_kv_blocks, fingerprint), 0);
+    EXPECT_EQ(decode_scheduler.import_prefix_blocks(kv_blocks, fingerprint), 2);
+    // the blocks already in the prefix cache aren't imported again
+    EXPECT_EQ(decode_scheduler.import_prefix_blocks(kv_blocks, fingerprint), 0);
+
+    auto decode_sequence_group = create_sequence_group(1);
+    decode_scheduler.restore_cached_blocks(decode_sequence_group);
+    // the whole prompt is restored, except for the last token to be processed to get logits
+    EXPECT_EQ(decode_sequence_group->get_num_processed_tokens(), tokens.size() - 1);
+    auto decode_sequence = decode_sequence_group->get_not_finished_sequences()[0];
+    const auto& block_tables = decode_scheduler.get_block_tables(*decode_sequence);
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; ++layer_idx) {
+        ASSERT_EQ(block_tables[layer_idx].size(), 2);
+        for (size_t logical_block_idx = 0; logical_block_idx < 2; ++logical_block_idx) {
+            std::vector<uint8_t> data(decode_cache_manager->get_layer_block_size_in_bytes(layer_idx));
+            decode_cache_manager->copy_block_to_host(layer_idx, block_tables[layer_idx][logical_block_idx]->get_index(), data.data());
+            EXPECT_EQ(data[0], logical_block_idx + 1);
+        }
+    }
+    decode_scheduler.free_sequence(decode_sequence->get_id());
+}
+
+TEST(TestScheduler, out_of_window_blocks_are_released) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    const size_t block_size = 4, attention_window_size = 8;
+
+    std::vector<uint64_t> prompt(12);
+    std::iota(prompt.begin(), prompt.end(), 0);
+    std::vector<SequenceGroup::Ptr> requests = {
+        std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prompt.size()}, prompt.data()), ov::genai::greedy(), block_size)
+    };
+    const Sequence& sequence = *(*requests[0])[0];
+    Scheduler scheduler = Scheduler(block_size, init_cache_manager(scheduler_config), scheduler_config);
+
+    // the prompt isn't released, the window, a reserve block and the next block the window moves to are kept
+    size_t num_released_blocks = 0;
+    for (size_t step = 0; step < 9; ++step) {
+        auto out = scheduler.schedule(requests);
+        const std::vector<size_t> block_table = _get_indices(scheduler.get_block_tables(sequence)[0]);
+        const size_t context_len = requests[0]->get_context_len();
+        scheduler.release_out_of_window_blocks(requests, out, attention_window_size);
+
+        // the released blocks are the leading ones, the blocks of the attended tokens and the positions are kept
+        const size_t num_step_released_blocks = context_len < 16 ? 0 : (context_len - 12) / block_size - num_released_blocks;
+        const std::vector<size_t> released_block_table = _get_indices(scheduler.get_block_tables(sequence)[0]);
+        EXPECT_EQ(released_block_table, std::vector<size_t>(block_table.begin() + num_step_released_blocks, block_table.end()));
+        num_released_blocks += num_step_released_blocks;
+        EXPECT_EQ(requests[0]->get_num_evicted_tokens(), num_released_blocks * block_size);
+        EXPECT_EQ(requests[0]->get_context_len(), context_len);
+        EXPECT_GE(released_block_table.size() * block_size, attention_window_size + block_size);
+
+        requests[0]->get_running_sequences()[0]->append_token(16, 0.9);
+        requests[0]->finish_iteration();
+    }
+    // the context has grown to 20 tokens, the first two blocks are released
+    EXPECT_EQ(num_released_blocks, 2);
+    scheduler.free_sequence(sequence.get_id());
+}
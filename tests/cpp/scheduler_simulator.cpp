@@ -0,0 +1,88 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/scheduler_simulator.hpp"
+
+using namespace ov::genai;
+
+namespace {
+SchedulerSimulator::Config get_simulator_config(size_t num_kv_blocks, bool enable_prefix_caching = false) {
+    SchedulerSimulator::Config config;
+    config.scheduler_config.max_num_batched_tokens = 256;
+    config.scheduler_config.num_kv_blocks = num_kv_blocks;
+    config.scheduler_config.dynamic_split_fuse = true;
+    config.scheduler_config.enable_prefix_caching = enable_prefix_caching;
+    config.block_size = 32;
+    return config;
+}
+
+SimulatedRequest get_request(float arrival_time_ms, size_t prompt_len, size_t output_len) {
+    SimulatedRequest request;
+    request.arrival_time_ms = arrival_time_ms;
+    request.prompt_len = prompt_len;
+    request.output_len = output_len;
+    return request;
+}
+}  // namespace
+
+TEST(TestSchedulerSimulator, single_request_latencies) {
+    LinearCostModel cost_model;
+    cost_model.step_ms = 10.0f;
+    const SimulationResults results = SchedulerSimulator(get_simulator_config(16), cost_model).run({get_request(5.0f, 64, 4)});
+
+    // the prompt and the generation of 3 more tokens
+    EXPECT_EQ(results.num_steps, 4);
+    EXPECT_EQ(results.num_finished_requests, 1);
+    EXPECT_EQ(results.num_generated_tokens, 4);
+    EXPECT_EQ(results.num_preemptions, 0);
+    EXPECT_FLOAT_EQ(results.duration_ms, 40.0f);
+    EXPECT_EQ(results.ttft.count, 1);
+    EXPECT_FLOAT_EQ(results.ttft.get_percentile(50), 10.0f);
+    EXPECT_EQ(results.tpot.count, 3);
+    EXPECT_FLOAT_EQ(results.tpot.max, 10.0f);
+    EXPECT_FLOAT_EQ(results.queue_time.max, 0.0f);
+    EXPECT_FLOAT_EQ(results.e2e_latency.max, 40.0f);
+}
+
+TEST(TestSchedulerSimulator, small_kv_cache_preempts_requests) {
+    LinearCostModel cost_model;
+    cost_model.step_ms = 1.0f;
+    std::vector<SimulatedRequest> trace;
+    for (size_t i = 0; i < 4; ++i) {
+        trace.push_back(get_request(0.0f, 32, 64));
+    }
+
+    // each request needs 3 blocks at the end of the generation
+    const SimulationResults constrained = SchedulerSimulator(get_simulator_config(6), cost_model).run(trace);
+    EXPECT_EQ(constrained.num_finished_requests, 4);
+    EXPECT_EQ(constrained.num_dropped_requests, 0);
+    EXPECT_GT(constrained.num_preemptions, 0);
+    EXPECT_FLOAT_EQ(constrained.cache_usage.max, 100.0f);
+
+    const SimulationResults unconstrained = SchedulerSimulator(get_simulator_config(12), cost_model).run(trace);
+    EXPECT_EQ(unconstrained.num_finished_requests, 4);
+    EXPECT_EQ(unconstrained.num_preemptions, 0);
+    EXPECT_LT(unconstrained.duration_ms, constrained.duration_ms);
+}
+
+TEST(TestSchedulerSimulator, shared_prefix_is_restored_from_prefix_cache) {
+    std::vector<size_t> num_prompt_tokens;
+    CostModel cost_model = [&](const SimulatedStep& step) {
+        num_prompt_tokens.push_back(step.num_prompt_tokens);
+        return 1.0f;
+    };
+    std::vector<SimulatedRequest> trace = {get_request(0.0f, 96, 2), get_request(100.0f, 96, 2)};
+    for (SimulatedRequest& request : trace) {
+        request.prefix_id = 1;
+        request.prefix_len = 64;
+    }
+
+    const SimulationResults results = SchedulerSimulator(get_simulator_config(16, true), cost_model).run(trace);
+    EXPECT_EQ(results.num_finished_requests, 2);
+    ASSERT_EQ(num_prompt_tokens.size(), 4);
+    EXPECT_EQ(num_prompt_tokens[0], 96);
+    // the blocks of the shared prefix of the second request are restored
+    EXPECT_EQ(num_prompt_tokens[2], 32);
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "continuous_batching/serving_metrics.hpp"
+
+using namespace ov::genai;
+
+TEST(TestHistogram, buckets_bound_values) {
+    EXPECT_EQ(Histogram::get_bucket(0.0f), 0);
+    EXPECT_EQ(Histogram::get_bucket(1e-4f), 0);
+    EXPECT_EQ(Histogram::get_bucket(1e20f), Histogram::num_buckets - 1);
+    for (float value : {0.01f, 1.0f, 1.5f, 3.0f, 1000.0f, 123456.0f}) {
+        const size_t bucket = Histogram::get_bucket(value);
+        EXPECT_LE(value, Histogram::get_upper_bound(bucket));
+        EXPECT_GT(value, Histogram::get_upper_bound(bucket - 1) * 0.999f);
+        // the relative error of a bucket is at most 1 / num_sub_buckets
+        EXPECT_LE(Histogram::get_upper_bound(bucket), value * (1.0f + 1.0f / Histogram::num_sub_buckets));
+    }
+}
+
+TEST(TestHistogram, percentiles_of_snapshot) {
+    Histogram histogram;
+    EXPECT_EQ(histogram.get_snapshot().get_percentile(50), 0.0f);
+
+    for (size_t value = 1; value <= 100; ++value) {
+        histogram.record(static_cast<float>(value));
+    }
+    histogram.record(1000.0f, 10);
+
+    const HistogramSnapshot snapshot = histogram.get_snapshot();
+    EXPECT_EQ(snapshot.count, 110);
+    EXPECT_DOUBLE_EQ(snapshot.sum, 5050.0 + 10000.0);
+    EXPECT_EQ(snapshot.min, 1.0f);
+    EXPECT_EQ(snapshot.max, 1000.0f);
+    EXPECT_NEAR(snapshot.get_percentile(50), 55.0f, 55.0f / Histogram::num_sub_buckets);
+    EXPECT_NEAR(snapshot.get_percentile(90), 99.0f, 99.0f / Histogram::num_sub_buckets);
+    EXPECT_EQ(snapshot.get_percentile(99), 1000.0f);
+    EXPECT_LE(snapshot.get_percentile(0), 1.0f + 1.0f / Histogram::num_sub_buckets);
+}
+
+TEST(TestServingMetrics, exports_prometheus_text) {
+    ServingMetrics metrics;
+    metrics.num_preemptions = 3;
+    Histogram ttft;
+    ttft.record(2000.0f);
+    metrics.ttft = ttft.get_snapshot();
+
+    const std::string text = metrics.to_prometheus("test");
+    EXPECT_NE(text.find("# TYPE test_ttft_microseconds summary\n"), std::string::npos);
+    EXPECT_NE(text.find("test_ttft_microseconds_count 1\n"), std::string::npos);
+    EXPECT_NE(text.find("test_ttft_microseconds{quantile=\"0.5\"} 2000\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE test_preemptions_total counter\ntest_preemptions_total 3\n"), std::string::npos);
+}
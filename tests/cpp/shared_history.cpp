@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "shared_history.hpp"
+
+using namespace ov::genai;
+
+TEST(TestSharedHistory, forks_share_the_prefix_and_own_the_tail) {
+    SharedHistory<int64_t> parent;
+    std::vector<int64_t> reference;
+    for (int64_t value = 0; value < 5; ++value) {
+        parent.push_back(value);
+        reference.push_back(value);
+    }
+    SharedHistory<int64_t> child = parent.fork();
+    EXPECT_EQ(parent, reference);
+    EXPECT_EQ(child, reference);
+
+    parent.push_back(100);
+    child.push_back(200);
+    child.push_back(201);
+    EXPECT_EQ(parent, std::vector<int64_t>({0, 1, 2, 3, 4, 100}));
+    EXPECT_EQ(child, std::vector<int64_t>({0, 1, 2, 3, 4, 200, 201}));
+
+    // the values of the shared prefix are copied only to the history they are changed in
+    child.pop_back();
+    child.pop_back();
+    child.pop_back();
+    child.set(0, -1);
+    EXPECT_EQ(child, std::vector<int64_t>({-1, 1, 2, 3}));
+    EXPECT_EQ(parent, std::vector<int64_t>({0, 1, 2, 3, 4, 100}));
+    EXPECT_EQ(std::vector<int64_t>(parent.rbegin(), parent.rbegin() + 2), std::vector<int64_t>({100, 4}));
+    EXPECT_EQ(parent.back(), 100);
+}
+
+TEST(TestSharedHistory, number_of_chunks_is_logarithmic) {
+    // beam search forks a sequence after each token
+    SharedHistory<int64_t> history;
+    std::vector<int64_t> reference;
+    std::vector<SharedHistory<int64_t>> forks;
+    for (int64_t value = 0; value < 1000; ++value) {
+        history.push_back(value);
+        reference.push_back(value);
+        forks.push_back(history.fork());
+        EXPECT_LE(history.get_num_chunks(), 11);
+    }
+    EXPECT_EQ(history, reference);
+    for (size_t i = 0; i < forks.size(); ++i) {
+        ASSERT_EQ(forks[i].size(), i + 1);
+        EXPECT_EQ(forks[i].back(), static_cast<int64_t>(i));
+        EXPECT_TRUE(std::equal(forks[i].begin(), forks[i].end(), reference.begin()));
+    }
+}
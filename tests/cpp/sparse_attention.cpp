@@ -101,3 +101,53 @@ TEST_P(SparseAttentionBlockSkipperReferenceTest, CorrectBlocksAreSkipped) {
 INSTANTIATE_TEST_SUITE_P(VariousSequenceGroupStates, SparseAttentionBlockSkipperReferenceTest, ::testing::ValuesIn(SKIPPER_TEST_CASES), [](const testing::TestParamInfo<SparseAttentionBlockSkipperReferenceTest::ParamType>& info) {
       return info.param.test_id;
     });
+
+// each of the tokens of a block gets the same share of the block score
+AttentionScoresForCacheOfSubsequence get_mock_scores(const std::vector<float>& block_scores, size_t block_size) {
+    AttentionScoresForCacheOfSubsequence scores(ov::element::f32, ov::Shape{block_scores.size() * block_size});
+    float* scores_data = scores.data<float>();
+    for (size_t token_idx = 0; token_idx < scores.get_size(); token_idx++) {
+        scores_data[token_idx] = block_scores[token_idx / block_size] / block_size;
+    }
+    return scores;
+}
+
+TEST(SparseDecodingBlockSelectorTest, StepsAreDenseUntilScoresAreRegistered) {
+    auto selector = SparseDecodingBlockSelector(BLOCK_SIZE, 0.5, 4, BLOCK_SIZE, BLOCK_SIZE);
+    EXPECT_TRUE(selector.get_skipped_blocks(0, 10 * BLOCK_SIZE).empty());
+}
+
+TEST(SparseDecodingBlockSelectorTest, LeastImportantBlocksAreSkipped) {
+    const size_t block_size = 4;
+    auto selector = SparseDecodingBlockSelector(block_size, 0.75, 16, block_size, block_size);
+    // start and recent blocks are retained regardless of their scores
+    selector.register_scores(0, {get_mock_scores({0.0, 0.5, 0.05, 0.3, 0.05, 0.05, 0.05, 0.0}, block_size)});
+    EXPECT_EQ(selector.get_skipped_blocks(0, 8 * block_size), std::set<size_t>({2, 4, 5, 6}));
+    // blocks without scores and the incomplete block are not skipped
+    EXPECT_EQ(selector.get_skipped_blocks(0, 8 * block_size + 3), std::set<size_t>({2, 4, 5, 6}));
+    EXPECT_EQ(selector.get_skipped_blocks(0, 2 * block_size), std::set<size_t>());
+}
+
+TEST(SparseDecodingBlockSelectorTest, ScoresAreSummedOverLayers) {
+    const size_t block_size = 4;
+    auto selector = SparseDecodingBlockSelector(block_size, 0.5, 16, 0, 0);
+    selector.register_scores(0, {get_mock_scores({0.1, 0.6, 0.3}, block_size), get_mock_scores({0.7, 0.1, 0.2}, block_size)});
+    // block importances are 0.8, 0.7 and 0.5, so a single block would not reach the half of the total importance
+    EXPECT_EQ(selector.get_skipped_blocks(0, 3 * block_size), std::set<size_t>({2}));
+}
+
+TEST(SparseDecodingBlockSelectorTest, DenseStepsAreDonePeriodically) {
+    const size_t block_size = 4;
+    auto selector = SparseDecodingBlockSelector(block_size, 0.5, 3, 0, 0);
+    selector.register_scores(0, {get_mock_scores({0.9, 0.1}, block_size)});
+    EXPECT_EQ(selector.get_skipped_blocks(0, 2 * block_size), std::set<size_t>({1}));
+    EXPECT_EQ(selector.get_skipped_blocks(0, 2 * block_size), std::set<size_t>({1}));
+    EXPECT_TRUE(selector.get_skipped_blocks(0, 2 * block_size).empty());
+
+    // registering the scores of the dense step starts a new period
+    selector.register_scores(0, {get_mock_scores({0.1, 0.9}, block_size)});
+    EXPECT_EQ(selector.get_skipped_blocks(0, 2 * block_size), std::set<size_t>({0}));
+
+    selector.remove_sequence(0);
+    EXPECT_TRUE(selector.get_skipped_blocks(0, 2 * block_size).empty());
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "spsc_queue.hpp"
+
+TEST(TestSPSCQueue, items_are_read_in_order_across_segments) {
+    SPSCQueue<std::vector<int>, 4> queue;
+    EXPECT_TRUE(queue.empty());
+    for (int i = 0; i < 10; ++i) {
+        queue.push({i, i});
+    }
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_FALSE(queue.empty());
+        EXPECT_EQ(queue.pull(), std::vector<int>({i, i}));
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(TestSPSCQueue, waiting_consumer_is_woken_by_producer) {
+    SPSCQueue<int, 4> queue;
+    const int num_items = 10000;
+    std::thread producer([&queue] {
+        for (int i = 0; i < num_items; ++i) {
+            queue.push(i);
+            if (i % 100 == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (int i = 0; i < num_items; ++i) {
+        EXPECT_EQ(queue.pull(), i);
+    }
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+}
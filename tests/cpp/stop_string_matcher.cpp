@@ -0,0 +1,39 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "sampling/stop_string_matcher.hpp"
+
+using namespace ov::genai;
+
+TEST(StopStringMatcherTest, finds_first_ending_occurrence) {
+    StopStringMatcher matcher({"abcd", "bc", "cd", "xyz", ""}, 4);
+    EXPECT_FALSE(matcher.empty());
+    EXPECT_EQ(matcher.get_max_encoded_len(), 4);
+
+    // "bc" ends before "abcd" and "cd"
+    auto match = matcher.find("__abcd__");
+    EXPECT_EQ(match.pos, 3);
+    EXPECT_EQ(match.length, 2);
+
+    // the longer one of the stop strings ending at the same position
+    match = StopStringMatcher({"d", "bcd"}, 3).find("abcd");
+    EXPECT_EQ(match.pos, 1);
+    EXPECT_EQ(match.length, 3);
+
+    // partial matches are followed by failure links
+    match = matcher.find("xyxyz");
+    EXPECT_EQ(match.pos, 2);
+    EXPECT_EQ(match.length, 3);
+
+    EXPECT_EQ(matcher.find("ab c d xy").pos, std::string::npos);
+    EXPECT_EQ(matcher.find("").pos, std::string::npos);
+}
+
+TEST(StopStringMatcherTest, matches_nothing_without_stop_strings) {
+    StopStringMatcher matcher({""}, 0);
+    EXPECT_TRUE(matcher.empty());
+    EXPECT_EQ(matcher.find("abc").pos, std::string::npos);
+    EXPECT_EQ(StopStringMatcher().find("abc").pos, std::string::npos);
+}
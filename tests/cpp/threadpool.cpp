@@ -0,0 +1,38 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "sampling/threadpool.hpp"
+
+TEST(ThreadPoolTest, parallel_for_calls_each_index_once) {
+    for (size_t num_threads : {1, 4}) {
+        ThreadPool thread_pool(num_threads);
+        for (size_t chunk_size : {1, 3, 100}) {
+            std::vector<std::atomic<size_t>> num_calls(37);
+            thread_pool.parallel_for(num_calls.size(), [&](size_t i) { num_calls[i]++; }, chunk_size);
+            for (const auto& count : num_calls) {
+                EXPECT_EQ(count, 1);
+            }
+        }
+        // empty range
+        thread_pool.parallel_for(0, [](size_t) { FAIL(); });
+    }
+}
+
+TEST(ThreadPoolTest, parallel_for_rethrows_exception) {
+    ThreadPool thread_pool(4);
+    std::atomic<size_t> num_calls{0};
+    EXPECT_THROW(thread_pool.parallel_for(16, [&](size_t i) {
+        num_calls++;
+        if (i == 5)
+            throw std::runtime_error("error");
+    }), std::runtime_error);
+    // the remaining indexes are still processed
+    EXPECT_EQ(num_calls, 16);
+    // the pool stays usable
+    thread_pool.parallel_for(16, [&](size_t) { num_calls++; });
+    EXPECT_EQ(num_calls, 32);
+}
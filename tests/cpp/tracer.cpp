@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include "continuous_batching/tracer.hpp"
+
+using namespace ov::genai;
+
+namespace {
+size_t count_occurrences(const std::string& text, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+}  // namespace
+
+TEST(TestTracer, exports_spans_of_threads) {
+    Tracer& tracer = Tracer::instance();
+    const bool was_enabled = tracer.is_enabled();
+
+    tracer.set_enabled(false);
+    { TraceScope scope("test: disabled span"); }
+
+    tracer.set_enabled(true);
+    { TraceScope scope("test: main thread span", 42); }
+    std::thread worker([] {
+        TraceScope scope("test: worker \"thread\" span");
+    });
+    worker.join();
+    tracer.set_enabled(was_enabled);
+
+    std::stringstream stream;
+    tracer.export_chrome_trace(stream);
+    const std::string trace = stream.str();
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0);
+    EXPECT_EQ(count_occurrences(trace, "test: disabled span"), 0);
+    EXPECT_EQ(count_occurrences(trace, "\"name\":\"test: main thread span\",\"ph\":\"X\""), 1);
+    EXPECT_EQ(count_occurrences(trace, "\"args\":{\"value\":42}"), 1);
+    // the events of the finished threads are kept, the names are escaped
+    EXPECT_EQ(count_occurrences(trace, "test: worker \\\"thread\\\" span"), 1);
+}
+
+TEST(TestTracer, ring_buffer_keeps_latest_events) {
+    Tracer& tracer = Tracer::instance();
+    const auto now = std::chrono::steady_clock::now();
+    // a fresh thread, so that its buffer only has the events of this test
+    std::thread worker([&] {
+        for (size_t i = 0; i < Tracer::thread_capacity + 10; ++i) {
+            tracer.record(i < 10 ? "test: overwritten span" : "test: kept span", now, now);
+        }
+    });
+    worker.join();
+
+    std::stringstream stream;
+    tracer.export_chrome_trace(stream);
+    const std::string trace = stream.str();
+    EXPECT_EQ(count_occurrences(trace, "test: overwritten span"), 0);
+    EXPECT_EQ(count_occurrences(trace, "test: kept span"), Tracer::thread_capacity);
+}
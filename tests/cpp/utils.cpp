@@ -3,7 +3,15 @@
 //
 
 #include <gtest/gtest.h>
+#include <filesystem>
+
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
 #include "utils.hpp"
+#include "continuous_batching/paged_attention_transformations.hpp"
 
 
 using namespace ov::genai::utils;
@@ -18,4 +26,79 @@ TEST(TestIsContainer, test_is_container) {
     EXPECT_EQ(is_container<std::vector<float>>, true);
     EXPECT_EQ(is_container<map_type>, true);
     EXPECT_EQ(is_container<std::set<int64_t>>, true);
-}
\ No newline at end of file
+}
+TEST(TestPopBuckets, sorts_and_deduplicates) {
+    ov::AnyMap config{{"SEQ_LEN_BUCKETS", std::vector<int64_t>{512, 128, 512}}, {"DEVICE_ID", "0"}};
+    EXPECT_EQ(pop_buckets(config, "SEQ_LEN_BUCKETS"), (std::vector<uint32_t>{128, 512}));
+    EXPECT_EQ(config.count("SEQ_LEN_BUCKETS"), 0);
+    EXPECT_EQ(config.size(), 1);
+
+    EXPECT_TRUE(pop_buckets(config, "BATCH_BUCKETS").empty());
+
+    config["BATCH_BUCKETS"] = std::vector<int>{4, 0};
+    EXPECT_THROW(pop_buckets(config, "BATCH_BUCKETS"), ov::Exception);
+}
+
+TEST(TestModelRegistry, shares_read_and_compiled_models) {
+    const auto models_path = std::filesystem::temp_directory_path() / "test_model_registry";
+    std::filesystem::create_directories(models_path);
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 4});
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, {4}, {1.0f, 2.0f, 3.0f, 4.0f});
+        auto model = std::make_shared<ov::Model>(std::make_shared<ov::op::v1::Add>(input, weights), ov::ParameterVector{input});
+        ov::save_model(model, models_path / "openvino_model.xml", false);
+    }
+    auto get_weights_data = [](const std::shared_ptr<ov::Model>& model) {
+        for (const auto& op : model->get_ordered_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+                return constant->get_data_ptr();
+            }
+        }
+        return static_cast<const void*>(nullptr);
+    };
+
+    auto model = read_model(models_path, {});
+    auto other_model = read_model(models_path, {});
+    // the clones may be transformed independently, but share the weights
+    EXPECT_NE(model, other_model);
+    EXPECT_EQ(get_weights_data(model), get_weights_data(other_model));
+
+    auto compiled_model = compile_shared_model(model, "CPU", {});
+    EXPECT_EQ(compile_shared_model(other_model, "CPU", {}), compiled_model);
+    EXPECT_NE(compile_shared_model(other_model, "CPU", {ov::hint::num_requests(2)}), compiled_model);
+
+    compiled_model.reset();
+    model.reset();
+    other_model.reset();
+    std::filesystem::remove_all(models_path);
+}
+
+// the layers of a model after the paged attention transformations, only the sliding_window input of an attention op is read,
+// so it's mocked with a concatenation of the same inputs
+std::shared_ptr<ov::Model> get_model_with_attention_windows(const std::vector<int64_t>& layer_window_sizes) {
+    constexpr size_t num_attention_inputs = 11;
+    ov::ParameterVector params;
+    ov::NodeVector attention_ops;
+    for (size_t layer_idx = 0; layer_idx < layer_window_sizes.size(); ++layer_idx) {
+        auto key_cache = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1});
+        key_cache->set_friendly_name("key_cache." + std::to_string(layer_idx));
+        ov::OutputVector inputs{key_cache};
+        for (size_t input_idx = 1; input_idx < num_attention_inputs - 1; ++input_idx) {
+            inputs.push_back(ov::op::v0::Constant::create(ov::element::f32, {1}, {0.0f}));
+        }
+        inputs.push_back(ov::op::v0::Constant::create(ov::element::f32, {1}, {static_cast<float>(layer_window_sizes[layer_idx])}));
+        params.push_back(key_cache);
+        attention_ops.push_back(std::make_shared<ov::op::v0::Concat>(inputs, 0));
+    }
+    return std::make_shared<ov::Model>(attention_ops, params);
+}
+
+TEST(TestAttentionWindowSize, is_largest_window_of_layers) {
+    EXPECT_EQ(get_attention_window_size(get_model_with_attention_windows({4096, 4096})), 4096);
+    EXPECT_EQ(get_attention_window_size(get_model_with_attention_windows({1024, 4096})), 4096);
+}
+
+TEST(TestAttentionWindowSize, is_zero_if_local_and_global_layers_are_mixed) {
+    EXPECT_EQ(get_attention_window_size(get_model_with_attention_windows({4096, 0, 4096, 0})), 0);
+    EXPECT_EQ(get_attention_window_size(get_model_with_attention_windows({0, 0})), 0);
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+#include <random>
+
+#include "openvino/genai/rag/vector_index.hpp"
+
+using namespace ov::genai;
+
+namespace {
+std::vector<std::vector<float>> get_embeddings(size_t num_embeddings, size_t dimension, unsigned seed = 42) {
+    std::mt19937 engine(seed);
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+    std::vector<std::vector<float>> embeddings(num_embeddings, std::vector<float>(dimension));
+    for (auto& embedding : embeddings) {
+        for (float& value : embedding) {
+            value = distribution(engine);
+        }
+    }
+    return embeddings;
+}
+
+float squared_l2(const std::vector<float>& lhs, const std::vector<float>& rhs) {
+    float distance = 0.0f;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        distance += (lhs[i] - rhs[i]) * (lhs[i] - rhs[i]);
+    }
+    return distance;
+}
+
+// fraction of the exact nearest neighbors by L2 distance, which are found by the index
+float get_recall(const VectorIndex& index,
+                 const std::vector<std::vector<float>>& embeddings,
+                 const std::vector<std::vector<float>>& queries,
+                 size_t top_k) {
+    size_t num_found = 0;
+    for (const auto& query : queries) {
+        std::vector<size_t> exact(embeddings.size());
+        std::iota(exact.begin(), exact.end(), 0);
+        std::partial_sort(exact.begin(), exact.begin() + top_k, exact.end(), [&](size_t lhs, size_t rhs) {
+            return squared_l2(query, embeddings[lhs]) < squared_l2(query, embeddings[rhs]);
+        });
+        exact.resize(top_k);
+
+        for (const auto& [id, distance] : index.search(query, top_k)) {
+            num_found += std::count(exact.begin(), exact.end(), id);
+        }
+    }
+    return static_cast<float>(num_found) / (queries.size() * top_k);
+}
+}  // namespace
+
+TEST(TestVectorIndex, search_finds_nearest_neighbors) {
+    const auto embeddings = get_embeddings(2000, 32, 1);
+    const auto queries = get_embeddings(50, 32, 2);
+
+    VectorIndex index(32, {VectorIndex::Metric::L2});
+    EXPECT_EQ(index.add(EmbeddingResults{embeddings}), 0);
+    ASSERT_EQ(index.size(), embeddings.size());
+
+    EXPECT_GE(get_recall(index, embeddings, queries, 10), 0.9f);
+
+    // an embedding is the nearest to itself
+    const auto results = index.search(embeddings[123], 3);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0].first, 123);
+    EXPECT_NEAR(results[0].second, 0.0f, 1e-4f);
+    EXPECT_TRUE(std::is_sorted(results.begin(), results.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second < rhs.second;
+    }));
+}
+
+TEST(TestVectorIndex, int8_storage) {
+    const auto embeddings = get_embeddings(2000, 32, 1);
+    const auto queries = get_embeddings(50, 32, 2);
+
+    VectorIndex index(32, {VectorIndex::Metric::L2, VectorIndex::Storage::INT8});
+    index.add(EmbeddingResults{embeddings});
+
+    EXPECT_GE(get_recall(index, embeddings, queries, 10), 0.85f);
+}
+
+TEST(TestVectorIndex, cosine_metric_and_quantized_embeddings) {
+    VectorIndex index(2, {VectorIndex::Metric::COSINE});
+    index.add(EmbeddingResults{std::vector<std::vector<int8_t>>{{10, 0}, {0, 10}, {-10, -1}}});
+
+    const auto results = index.search(EmbeddingResult{std::vector<float>{3.0f, 0.1f}}, 3);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0].first, 0);
+    EXPECT_EQ(results[1].first, 1);
+    EXPECT_EQ(results[2].first, 2);
+    EXPECT_NEAR(results[2].second, 2.0f, 0.01f);
+
+    EXPECT_THROW(index.add(EmbeddingResult{std::vector<float>{1.0f}}), ov::Exception);
+}
+
+TEST(TestVectorIndex, save_and_load) {
+    const auto embeddings = get_embeddings(500, 24);
+    const auto path = std::filesystem::temp_directory_path() / "test_vector_index.bin";
+
+    for (auto storage : {VectorIndex::Storage::F32, VectorIndex::Storage::INT8}) {
+        VectorIndex index(24, {VectorIndex::Metric::INNER_PRODUCT, storage});
+        index.add(EmbeddingResults{embeddings});
+        index.save(path);
+
+        {
+            VectorIndex loaded = VectorIndex::load(path);
+            EXPECT_EQ(loaded.size(), index.size());
+            EXPECT_EQ(loaded.get_dimension(), 24);
+            EXPECT_EQ(loaded.get_config().storage, storage);
+            for (size_t i = 0; i < 10; ++i) {
+                EXPECT_EQ(loaded.search(embeddings[i], 5), index.search(embeddings[i], 5));
+            }
+
+            // the memory mapped embeddings are copied before adding new ones
+            const auto new_embedding = get_embeddings(1, 24, 7)[0];
+            EXPECT_EQ(loaded.add(new_embedding), embeddings.size());
+            EXPECT_EQ(loaded.size(), embeddings.size() + 1);
+            EXPECT_EQ(loaded.search(new_embedding, 5).size(), 5);
+        }
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "visual_language/video_sampling.hpp"
+
+using namespace ov::genai;
+
+TEST(TestVideoSampling, frames_are_sampled_uniformly_in_groups) {
+    EXPECT_EQ(sample_frame_indices(10, 4, 2), std::vector<size_t>({0, 3, 6, 9}));
+    // the number of frames is rounded down to the groups
+    EXPECT_EQ(sample_frame_indices(5, 0, 2), std::vector<size_t>({0, 1, 3, 4}));
+    EXPECT_EQ(sample_frame_indices(3, 4, 2), std::vector<size_t>({0, 2}));
+    // a single frame is repeated to make a group
+    EXPECT_EQ(sample_frame_indices(1, 4, 2), std::vector<size_t>({0, 0}));
+}
+
+TEST(TestVideoSampling, similar_frame_groups_are_dropped) {
+    // 6 frames of 4 bytes, the scene changes at the frame 4
+    std::vector<uint8_t> frames = {
+        10, 10, 10, 10,  10, 10, 10, 11,  11, 10, 10, 10,
+        10, 10, 12, 10,  200, 200, 200, 200,  200, 201, 200, 200,
+    };
+    const std::vector<size_t> frame_indices = {0, 1, 2, 3, 4, 5};
+    EXPECT_EQ(drop_similar_frame_groups(frames.data(), 4, frame_indices, 2, 0.01f), std::vector<size_t>({0, 1, 4, 5}));
+    EXPECT_EQ(drop_similar_frame_groups(frames.data(), 4, frame_indices, 2, 0.0f), frame_indices);
+    EXPECT_EQ(drop_similar_frame_groups(frames.data(), 4, frame_indices, 2, 1.0f), std::vector<size_t>({0, 1}));
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "visual_language/vision_embedding_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+ov::Tensor make_image(uint8_t value, ov::Shape shape = {1, 4, 4, 3}) {
+    ov::Tensor image(ov::element::u8, shape);
+    std::fill_n(image.data<uint8_t>(), image.get_size(), value);
+    return image;
+}
+
+EncodedImage make_encoded_image(size_t num_floats) {
+    EncodedImage encoded_image;
+    encoded_image.resized_source = ov::Tensor(ov::element::f32, {1, num_floats});
+    return encoded_image;
+}
+}
+
+TEST(TestVisionEmbeddingCache, hash_depends_on_content_shape_and_config) {
+    const ImageContentHash hash = hash_image(make_image(1));
+    EXPECT_EQ(hash_image(make_image(1)), hash);
+    EXPECT_FALSE(hash_image(make_image(2)) == hash);
+    EXPECT_FALSE(hash_image(make_image(1, {1, 3, 4, 4})) == hash);
+    EXPECT_FALSE(hash_image(make_image(1), {{"max_slice_nums", 4}}) == hash);
+}
+
+TEST(TestVisionEmbeddingCache, least_recently_used_images_are_evicted) {
+    // fits two images of 4 floats
+    VisionEmbeddingCache cache(32);
+    const ImageContentHash first = hash_image(make_image(1)), second = hash_image(make_image(2)), third = hash_image(make_image(3));
+
+    cache.add(first, make_encoded_image(4));
+    cache.add(second, make_encoded_image(4));
+    auto cached = cache.get(first);
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_TRUE(cached->is_cached);
+
+    cache.add(third, make_encoded_image(4));
+    EXPECT_TRUE(cache.get(first).has_value());
+    EXPECT_FALSE(cache.get(second).has_value());
+    EXPECT_TRUE(cache.get(third).has_value());
+    EXPECT_EQ(cache.get_byte_size(), 32);
+}
+
+TEST(TestVisionEmbeddingCache, images_over_budget_are_not_cached) {
+    VisionEmbeddingCache cache(32);
+    const ImageContentHash hash = hash_image(make_image(1));
+    cache.add(hash, make_encoded_image(9));
+    EXPECT_FALSE(cache.get(hash).has_value());
+    EXPECT_EQ(cache.get_byte_size(), 0);
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "visual_language/visual_token_reduction.hpp"
+
+using namespace ov::genai;
+
+namespace {
+ov::Tensor make_features(const std::vector<std::vector<float>>& tokens) {
+    ov::Tensor features(ov::element::f32, {1, tokens.size(), tokens.at(0).size()});
+    for (size_t token_idx = 0; token_idx < tokens.size(); ++token_idx) {
+        std::copy(tokens[token_idx].begin(), tokens[token_idx].end(), features.data<float>() + token_idx * tokens[0].size());
+    }
+    return features;
+}
+
+std::vector<float> get_token(const ov::Tensor& features, size_t token_idx) {
+    const size_t embed_dim = features.get_shape().at(2);
+    const float* token = features.data<float>() + token_idx * embed_dim;
+    return {token, token + embed_dim};
+}
+}
+
+TEST(TestVisualTokenReduction, most_similar_adjacent_tokens_are_merged) {
+    ov::Tensor features = make_features({{1, 0}, {1, 0}, {0, 1}, {0, 2}, {1, 1}});
+    ov::Tensor reduced = reduce_visual_tokens(features, 0.6f);
+    ASSERT_EQ(reduced.get_shape(), ov::Shape({1, 3, 2}));
+    EXPECT_EQ(get_token(reduced, 0), std::vector<float>({1, 0}));
+    EXPECT_EQ(get_token(reduced, 1), std::vector<float>({0, 1.5}));
+    EXPECT_EQ(get_token(reduced, 2), std::vector<float>({1, 1}));
+
+    ov::Tensor kept = reduce_visual_tokens(features, 1.0f);
+    ASSERT_EQ(kept.get_shape(), features.get_shape());
+    EXPECT_EQ(get_token(kept, 3), std::vector<float>({0, 2}));
+}
+
+TEST(TestVisualTokenReduction, merged_tokens_are_weighted_by_their_size) {
+    ov::Tensor reduced = reduce_visual_tokens(make_features({{3, 0}, {3, 0}, {0, 3}}), 0.3f);
+    ASSERT_EQ(reduced.get_shape(), ov::Shape({1, 1, 2}));
+    EXPECT_EQ(get_token(reduced, 0), std::vector<float>({2, 1}));
+}
+
+TEST(TestVisualTokenReduction, protected_tokens_are_not_merged) {
+    const std::vector<float> newline = {5, 5};
+    ov::Tensor reduced = reduce_visual_tokens(make_features({{1, 1}, newline, {1, 1}, {2, 2}, newline}), 0.2f, newline.data());
+    ASSERT_EQ(reduced.get_shape(), ov::Shape({1, 4, 2}));
+    EXPECT_EQ(get_token(reduced, 1), newline);
+    EXPECT_EQ(get_token(reduced, 2), std::vector<float>({1.5, 1.5}));
+    EXPECT_EQ(get_token(reduced, 3), newline);
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llm/weights_streamer.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// a chain of additions of the constants of the given number of layers
+std::shared_ptr<ov::Model> get_layered_model(size_t num_layers, size_t hidden_size) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, static_cast<int64_t>(hidden_size)});
+    ov::Output<ov::Node> hidden_state = input;
+    for (size_t layer = 0; layer < num_layers; ++layer) {
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, {hidden_size}, std::vector<float>(hidden_size, 1.0f));
+        weights->set_friendly_name("model.layers." + std::to_string(layer) + ".mlp.weight");
+        hidden_state = std::make_shared<ov::op::v1::Add>(hidden_state, weights);
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{hidden_state}, ov::ParameterVector{input});
+}
+}  // namespace
+
+TEST(TestWeightsStreamer, groups_constants_by_layers) {
+    // each constant spans several pages
+    const size_t hidden_size = 4096;
+    WeightsStreamer streamer(get_layered_model(3, hidden_size), {1});
+    EXPECT_EQ(streamer.get_num_layers(), 3);
+    EXPECT_GE(streamer.get_pinned_size(), hidden_size * sizeof(float));
+
+    // the whole model is read ahead while the pace is unknown
+    { WeightsStreamer::Session session(&streamer); }
+    streamer.set_forward_duration(300.0f);
+    { WeightsStreamer::Session session(&streamer); }
+    // the streaming is disabled
+    { WeightsStreamer::Session session(nullptr); }
+}
+
+TEST(TestWeightsStreamer, skips_small_constants) {
+    WeightsStreamer streamer(get_layered_model(2, 4), {});
+    EXPECT_EQ(streamer.get_num_layers(), 0);
+    { WeightsStreamer::Session session(&streamer); }
+}
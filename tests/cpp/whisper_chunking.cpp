@@ -0,0 +1,49 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+#include "whisper/chunking.hpp"
+
+using namespace ov::genai;
+
+TEST(TestWhisperChunking, windows_overlap_by_stride) {
+    const auto windows = get_chunk_windows(70, 30, 5);
+    ASSERT_EQ(windows.size(), 3);
+
+    EXPECT_EQ(windows[0].start, 0);
+    EXPECT_EQ(windows[0].end, 30);
+    EXPECT_EQ(windows[0].left_stride, 0);
+    EXPECT_EQ(windows[0].right_stride, 5);
+
+    EXPECT_EQ(windows[1].start, 20);
+    EXPECT_EQ(windows[1].end, 50);
+    EXPECT_EQ(windows[1].left_stride, 5);
+    EXPECT_EQ(windows[1].right_stride, 5);
+
+    EXPECT_EQ(windows[2].start, 40);
+    EXPECT_EQ(windows[2].end, 70);
+    EXPECT_EQ(windows[2].left_stride, 5);
+    EXPECT_EQ(windows[2].right_stride, 0);
+}
+
+TEST(TestWhisperChunking, short_audio_is_a_single_window) {
+    const auto windows = get_chunk_windows(10, 30, 5);
+    ASSERT_EQ(windows.size(), 1);
+    EXPECT_EQ(windows[0].end, 10);
+    EXPECT_EQ(windows[0].left_stride, 0);
+    EXPECT_EQ(windows[0].right_stride, 0);
+}
+
+TEST(TestWhisperChunking, stride_must_be_shorter_than_half_window) {
+    EXPECT_THROW(get_chunk_windows(100, 30, 15), ov::Exception);
+}
+
+TEST(TestWhisperChunking, overlapping_tokens_are_merged) {
+    EXPECT_EQ(merge_chunk_tokens({{1, 2, 3, 4, 5}, {3, 4, 5, 6, 7}}), std::vector<int64_t>({1, 2, 3, 4, 5, 6, 7}));
+    // a disagreement within the overlap is resolved at its middle
+    EXPECT_EQ(merge_chunk_tokens({{1, 2, 3, 4, 9}, {8, 3, 4, 5, 6}}), std::vector<int64_t>({1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(merge_chunk_tokens({{1, 2}, {3, 4}, {4, 5, 6}}), std::vector<int64_t>({1, 2, 3, 4, 4, 5, 6}));
+    EXPECT_TRUE(merge_chunk_tokens({}).empty());
+}
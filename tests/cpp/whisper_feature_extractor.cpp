@@ -0,0 +1,156 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "whisper/feature_extractor.hpp"
+#include "whisper/fft.hpp"
+
+using namespace ov::genai;
+
+namespace {
+std::vector<float> get_samples(const size_t size) {
+    std::mt19937 engine(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> samples(size);
+    for (float& sample : samples) {
+        sample = distribution(engine);
+    }
+    return samples;
+}
+
+std::vector<double> naive_power_spectrum(const std::vector<float>& samples) {
+    const size_t n_fft = samples.size();
+    std::vector<double> power(n_fft / 2 + 1);
+    for (size_t k = 0; k < power.size(); k++) {
+        double re = 0.0, im = 0.0;
+        for (size_t n = 0; n < n_fft; n++) {
+            const double theta = 2.0 * M_PI * double((k * n) % n_fft) / double(n_fft);
+            re += samples[n] * std::cos(theta);
+            im -= samples[n] * std::sin(theta);
+        }
+        power[k] = re * re + im * im;
+    }
+    return power;
+}
+
+// the recursive FFT which WhisperRealFFT replaces, kept as the reference of the benchmark
+void recursive_fft(const std::vector<float>& in, std::vector<float>& out, const std::vector<float>& sin_vals,
+                   const std::vector<float>& cos_vals, const size_t n_fft) {
+    const size_t N = in.size();
+    out.resize(N * 2);
+    const size_t sin_cos_step = n_fft / N;
+    if (N % 2 == 1) {
+        for (size_t k = 0; k < N; k++) {
+            float re = 0, im = 0;
+            for (size_t n = 0; n < N; n++) {
+                const size_t idx = (k * n * sin_cos_step) % n_fft;
+                re += in[n] * cos_vals[idx];
+                im -= in[n] * sin_vals[idx];
+            }
+            out[k * 2 + 0] = re;
+            out[k * 2 + 1] = im;
+        }
+        return;
+    }
+
+    std::vector<float> even, odd;
+    for (size_t i = 0; i < N; i++) {
+        (i % 2 == 0 ? even : odd).push_back(in[i]);
+    }
+    std::vector<float> even_fft, odd_fft;
+    recursive_fft(even, even_fft, sin_vals, cos_vals, n_fft);
+    recursive_fft(odd, odd_fft, sin_vals, cos_vals, n_fft);
+
+    for (size_t k = 0; k < N / 2; k++) {
+        const float re = cos_vals[k * sin_cos_step];
+        const float im = -sin_vals[k * sin_cos_step];
+        const float re_odd = odd_fft[2 * k + 0];
+        const float im_odd = odd_fft[2 * k + 1];
+        out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
+        out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
+        out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
+        out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
+    }
+}
+}  // namespace
+
+class WhisperRealFFTTest : public testing::TestWithParam<size_t> {};
+
+TEST_P(WhisperRealFFTTest, power_spectrum_matches_dft) {
+    const size_t n_fft = GetParam();
+    const std::vector<float> samples = get_samples(n_fft);
+    const std::vector<double> expected = naive_power_spectrum(samples);
+
+    WhisperRealFFT fft(n_fft);
+    WhisperRealFFT::Buffers buffers;
+    std::vector<float> power(n_fft / 2 + 1);
+    fft.power_spectrum(samples.data(), power.data(), buffers);
+
+    for (size_t k = 0; k < power.size(); k++) {
+        EXPECT_NEAR(power[k], expected[k], 1e-3 * std::max(1.0, expected[k])) << "bin " << k;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(WhisperRealFFTSizes,
+                         WhisperRealFFTTest,
+                         testing::Values(2, 4, 8, 30, 256, 400, 512, 1200, 2 * 7 * 11));
+
+TEST(TestWhisperFeatureExtractor, silence_features_are_constant) {
+    WhisperFeatureExtractor feature_extractor("not_existing_preprocessor_config.json");
+    const WhisperFeatures features = feature_extractor.extract(std::vector<float>(feature_extractor.sampling_rate));
+    ASSERT_EQ(features.n_frames, feature_extractor.nb_max_frames);
+    for (float value : features.data) {
+        // log10(1e-10) normalized
+        ASSERT_FLOAT_EQ(value, -1.5f);
+    }
+}
+
+TEST(TestWhisperFeatureExtractor, DISABLED_benchmark_fft) {
+    const size_t n_fft = 400;
+    const size_t num_frames = 3000;
+    const std::vector<float> samples = get_samples(n_fft);
+
+    std::vector<float> sin_vals(n_fft), cos_vals(n_fft);
+    for (size_t i = 0; i < n_fft; i++) {
+        sin_vals[i] = sinf(2 * M_PI * i / n_fft);
+        cos_vals[i] = cosf(2 * M_PI * i / n_fft);
+    }
+    std::vector<float> out;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t frame = 0; frame < num_frames; frame++) {
+        recursive_fft(samples, out, sin_vals, cos_vals, n_fft);
+    }
+    const auto recursive_time = std::chrono::steady_clock::now() - start;
+
+    WhisperRealFFT fft(n_fft);
+    WhisperRealFFT::Buffers buffers;
+    std::vector<float> power(n_fft / 2 + 1);
+    start = std::chrono::steady_clock::now();
+    for (size_t frame = 0; frame < num_frames; frame++) {
+        fft.power_spectrum(samples.data(), power.data(), buffers);
+    }
+    const auto real_fft_time = std::chrono::steady_clock::now() - start;
+
+    WhisperFeatureExtractor feature_extractor("not_existing_preprocessor_config.json");
+    const std::vector<float> audio = get_samples(feature_extractor.n_samples);
+    start = std::chrono::steady_clock::now();
+    feature_extractor.extract(audio);
+    const auto extract_time = std::chrono::steady_clock::now() - start;
+
+    using std::chrono::microseconds;
+    std::cout << num_frames << " frames of " << n_fft << " samples: recursive FFT "
+              << std::chrono::duration_cast<microseconds>(recursive_time).count() << " us, real FFT "
+              << std::chrono::duration_cast<microseconds>(real_fft_time).count() << " us; extract() of "
+              << feature_extractor.chunk_length << " s "
+              << std::chrono::duration_cast<microseconds>(extract_time).count() << " us" << std::endl;
+}
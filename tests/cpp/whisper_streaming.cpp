@@ -0,0 +1,105 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "whisper/streaming.hpp"
+
+using namespace ov::genai;
+
+namespace {
+WhisperGenerationConfig get_config() {
+    WhisperGenerationConfig config;
+    config.eos_token_id = 50257;
+    config.no_timestamps_token_id = 50363;
+    return config;
+}
+
+int64_t timestamp(float seconds) {
+    return 50364 + static_cast<int64_t>(seconds / 0.02f + 0.5f);
+}
+}  // namespace
+
+TEST(TestWhisperLocalAgreement, tokens_are_committed_when_two_hypotheses_agree) {
+    WhisperLocalAgreement agreement;
+    EXPECT_TRUE(agreement.insert({1, 2, 3}).empty());
+    EXPECT_EQ(agreement.get_partial(), std::vector<int64_t>({1, 2, 3}));
+
+    EXPECT_EQ(agreement.insert({1, 2, 4, 5}), std::vector<int64_t>({1, 2}));
+    EXPECT_EQ(agreement.get_partial(), std::vector<int64_t>({4, 5}));
+
+    EXPECT_EQ(agreement.insert({1, 2, 4, 5, 6}), std::vector<int64_t>({4, 5}));
+    EXPECT_EQ(agreement.get_num_committed(), 4);
+    EXPECT_EQ(agreement.flush(), std::vector<int64_t>({6}));
+    EXPECT_TRUE(agreement.get_partial().empty());
+}
+
+TEST(TestWhisperLocalAgreement, committed_tokens_are_not_changed) {
+    WhisperLocalAgreement agreement;
+    agreement.insert({1, 2, 3});
+    agreement.insert({1, 2, 3});
+    // the hypothesis changed the committed tokens, the rest of it is still compared with the previous one
+    EXPECT_TRUE(agreement.insert({7, 2, 3, 4}).empty());
+    EXPECT_EQ(agreement.get_partial(), std::vector<int64_t>({4}));
+    EXPECT_EQ(agreement.insert({7, 8, 9, 4}), std::vector<int64_t>({4}));
+
+    EXPECT_EQ(agreement.drop(2), std::vector<int64_t>({1, 2}));
+    EXPECT_EQ(agreement.get_num_committed(), 2);
+    EXPECT_EQ(agreement.insert({3, 4, 5}), std::vector<int64_t>());
+    EXPECT_EQ(agreement.insert({3, 4, 5}), std::vector<int64_t>({5}));
+}
+
+TEST(TestWhisperStreaming, text_tokens_exclude_timestamps_and_eos) {
+    const auto config = get_config();
+    EXPECT_EQ(get_text_tokens({timestamp(0), 10, 11, timestamp(1), timestamp(1), 12, config.eos_token_id}, config),
+              std::vector<int64_t>({10, 11, 12}));
+}
+
+TEST(TestWhisperStreaming, cut_is_at_the_last_timestamp_of_committed_tokens) {
+    const auto config = get_config();
+    const std::vector<int64_t> tokens = {
+        timestamp(0), 10, 11, timestamp(1.2f), timestamp(1.2f), 12, 13, timestamp(2.4f), timestamp(2.4f), 14, 15};
+
+    EXPECT_FALSE(find_committed_cut(tokens, 1, config, 0.02f).has_value());
+
+    auto cut = find_committed_cut(tokens, 3, config, 0.02f);
+    ASSERT_TRUE(cut.has_value());
+    EXPECT_EQ(cut->num_tokens, 2);
+    EXPECT_NEAR(cut->time, 1.2f, 1e-5f);
+
+    cut = find_committed_cut(tokens, 5, config, 0.02f);
+    ASSERT_TRUE(cut.has_value());
+    EXPECT_EQ(cut->num_tokens, 4);
+    EXPECT_NEAR(cut->time, 2.4f, 1e-5f);
+}
+
+TEST(TestWhisperFeatureStream, incremental_features_match_extracted_ones) {
+    WhisperFeatureExtractor feature_extractor("not_existing_preprocessor_config.json");
+    std::vector<float> audio(feature_extractor.sampling_rate * 3 + 123);
+    for (size_t i = 0; i < audio.size(); i++) {
+        audio[i] = 0.3f * std::sin(i * 0.05f) + 0.1f * std::cos(i * 0.37f);
+    }
+    const WhisperFeatures features = feature_extractor.extract(audio);
+
+    WhisperFeatureStream stream(feature_extractor);
+    WhisperFeatures stream_features;
+    for (size_t offset = 0; offset < audio.size(); offset += 5000) {
+        stream.append({audio.begin() + offset, audio.begin() + std::min(audio.size(), offset + 5000)});
+        stream_features = stream.get_features();
+    }
+
+    ASSERT_EQ(stream_features.n_frames, features.n_frames);
+    // the last frames of extract() are reflect padded instead of the samples to come
+    const size_t num_compared_frames = audio.size() / feature_extractor.hop_length - 2;
+    for (size_t feature = 0; feature < features.feature_size; feature++) {
+        for (size_t frame = 0; frame < num_compared_frames; frame++) {
+            ASSERT_FLOAT_EQ(stream_features.data[feature * features.n_frames + frame],
+                            features.data[feature * features.n_frames + frame]);
+        }
+    }
+
+    EXPECT_EQ(stream.drop(feature_extractor.sampling_rate + 50), feature_extractor.sampling_rate);
+    EXPECT_EQ(stream.get_num_samples(), audio.size() - feature_extractor.sampling_rate);
+}
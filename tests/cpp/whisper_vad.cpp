@@ -0,0 +1,76 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "whisper/vad.hpp"
+
+using namespace ov::genai;
+
+namespace {
+constexpr size_t sampling_rate = 16000;
+
+// speech-like tones in the low noise
+RawSpeechInput get_audio(const std::vector<std::pair<float, float>>& speech, const float duration) {
+    RawSpeechInput audio(static_cast<size_t>(duration * sampling_rate));
+    for (size_t i = 0; i < audio.size(); i++) {
+        audio[i] = 1e-4f * std::sin(i * 1.7f);
+    }
+    for (const auto& [start, end] : speech) {
+        for (size_t i = static_cast<size_t>(start * sampling_rate); i < static_cast<size_t>(end * sampling_rate); i++) {
+            audio[i] = 0.3f * std::sin(i * 0.05f) + 0.1f * std::sin(i * 0.21f);
+        }
+    }
+    return audio;
+}
+}  // namespace
+
+TEST(TestWhisperVad, speech_regions_are_padded) {
+    const auto regions = detect_speech_regions(get_audio({{1.0f, 2.0f}, {5.0f, 7.5f}}, 10.0f), sampling_rate);
+    ASSERT_EQ(regions.size(), 2);
+    EXPECT_EQ(regions[0].start, 0.8f * sampling_rate);
+    EXPECT_EQ(regions[0].end, 2.2f * sampling_rate);
+    EXPECT_EQ(regions[1].start, 4.8f * sampling_rate);
+    EXPECT_EQ(regions[1].end, 7.7f * sampling_rate);
+}
+
+TEST(TestWhisperVad, short_pauses_and_clicks) {
+    // the short pause is joined, the click is dropped
+    const auto regions =
+        detect_speech_regions(get_audio({{1.0f, 2.0f}, {2.3f, 3.0f}, {6.0f, 6.1f}}, 8.0f), sampling_rate);
+    ASSERT_EQ(regions.size(), 1);
+    EXPECT_EQ(regions[0].start, 0.8f * sampling_rate);
+    EXPECT_EQ(regions[0].end, 3.2f * sampling_rate);
+}
+
+TEST(TestWhisperVad, continuous_speech_and_silence) {
+    const auto speech_regions = detect_speech_regions(get_audio({{0.0f, 4.0f}}, 4.0f), sampling_rate);
+    ASSERT_EQ(speech_regions.size(), 1);
+    EXPECT_EQ(speech_regions[0].start, 0);
+    EXPECT_EQ(speech_regions[0].end, 4 * sampling_rate);
+
+    EXPECT_TRUE(detect_speech_regions(RawSpeechInput(4 * sampling_rate), sampling_rate).empty());
+}
+
+TEST(TestWhisperVad, packed_times_are_mapped_back) {
+    const RawSpeechInput audio(10 * sampling_rate);
+    const WhisperPackedSpeech speech(audio, {{1 * sampling_rate, 3 * sampling_rate}, {6 * sampling_rate, 7 * sampling_rate}}, sampling_rate);
+    EXPECT_EQ(speech.get_samples().size(), 3 * sampling_rate);
+
+    EXPECT_FLOAT_EQ(speech.to_original_time(0.5f), 1.5f);
+    EXPECT_FLOAT_EQ(speech.to_original_time(2.0f), 6.0f);
+    EXPECT_FLOAT_EQ(speech.to_original_time(2.0f, true), 3.0f);
+    EXPECT_FLOAT_EQ(speech.to_original_time(2.5f), 6.5f);
+    EXPECT_FLOAT_EQ(speech.to_original_time(3.5f), 7.0f);
+
+    std::vector<Segment> segments = {{0.0f, 2.0f, {}}, {2.0f, 3.0f, {}}, {2.5f, -1.0f, {}}};
+    speech.to_original_segments(segments);
+    EXPECT_FLOAT_EQ(segments[0].m_start, 1.0f);
+    EXPECT_FLOAT_EQ(segments[0].m_end, 3.0f);
+    EXPECT_FLOAT_EQ(segments[1].m_start, 6.0f);
+    EXPECT_FLOAT_EQ(segments[1].m_end, 7.0f);
+    EXPECT_FLOAT_EQ(segments[2].m_start, 6.5f);
+    EXPECT_FLOAT_EQ(segments[2].m_end, -1.0f);
+}
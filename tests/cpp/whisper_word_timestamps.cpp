@@ -0,0 +1,114 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include "openvino/core/except.hpp"
+#include "whisper/word_timestamps.hpp"
+
+using namespace ov::genai;
+
+TEST(TestWhisperWordTimestamps, dtw_follows_lowest_cost) {
+    // 2 rows by 4 columns, the first row is cheap at the columns 0 and 1, the second one at 2 and 3
+    const std::vector<float> cost = {0.0f, 0.0f, 5.0f, 5.0f,
+                                     5.0f, 5.0f, 0.0f, 0.0f};
+
+    const auto path = dtw(cost, 2, 4);
+    const std::vector<std::pair<size_t, size_t>> expected = {{0, 0}, {0, 1}, {1, 2}, {1, 3}};
+    EXPECT_EQ(path, expected);
+}
+
+TEST(TestWhisperWordTimestamps, dtw_path_is_monotonic) {
+    const std::vector<float> cost = {1.0f, 3.0f, 2.0f,
+                                     4.0f, 1.0f, 2.0f,
+                                     3.0f, 2.0f, 1.0f,
+                                     2.0f, 4.0f, 1.0f};
+
+    const auto path = dtw(cost, 4, 3);
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(path.front(), std::make_pair(size_t{0}, size_t{0}));
+    EXPECT_EQ(path.back(), std::make_pair(size_t{3}, size_t{2}));
+    for (size_t i = 1; i < path.size(); ++i) {
+        EXPECT_LE(path[i - 1].first, path[i].first);
+        EXPECT_LE(path[i - 1].second, path[i].second);
+        EXPECT_LE(path[i].first - path[i - 1].first + path[i].second - path[i - 1].second, 2);
+    }
+}
+
+TEST(TestWhisperWordTimestamps, dtw_throws_on_shape_mismatch) {
+    EXPECT_THROW(dtw(std::vector<float>(5), 2, 3), ov::Exception);
+}
+
+TEST(TestWhisperWordTimestamps, token_times_follow_attention) {
+    // 3 tokens of a single head attending to the frames [0, 10), [10, 20) and [20, 30) of the 40 audio frames
+    const size_t num_tokens = 3, num_frames = 50, num_audio_frames = 40;
+    std::vector<float> weights(num_tokens * num_frames, 0.0f);
+    for (size_t token = 0; token < num_tokens; ++token) {
+        for (size_t frame = token * 10; frame < (token + 1) * 10; ++frame) {
+            weights[token * num_frames + frame] = 1.0f;
+        }
+    }
+
+    const auto times = get_token_times(weights, num_tokens, 1, num_frames, num_audio_frames, 0.02f, 1.0f);
+    ASSERT_EQ(times.size(), num_tokens);
+    EXPECT_FLOAT_EQ(times[0].first, 1.0f);
+    EXPECT_FLOAT_EQ(times[1].first, 1.2f);
+    EXPECT_FLOAT_EQ(times[2].first, 1.4f);
+    for (size_t token = 0; token + 1 < num_tokens; ++token) {
+        EXPECT_FLOAT_EQ(times[token].second, times[token + 1].first);
+    }
+    // the last token ends at the end of the audio
+    EXPECT_FLOAT_EQ(times[2].second, 1.8f);
+}
+
+TEST(TestWhisperWordTimestamps, words_start_with_space) {
+    const std::map<int64_t, std::string> vocab = {{1, " Hello"}, {2, " wor"}, {3, "ld"}, {4, "!"}};
+    auto decode = [&vocab](const std::vector<int64_t>& tokens) {
+        std::string text;
+        for (const int64_t token : tokens) {
+            text += vocab.at(token);
+        }
+        return text;
+    };
+
+    const int64_t eos_token_id = 100;
+    const std::vector<int64_t> tokens = {1, 2, 3, 4, eos_token_id};
+    const std::vector<std::pair<float, float>> times = {{0.0f, 0.5f}, {0.5f, 0.7f}, {0.7f, 1.0f}, {1.0f, 1.1f}, {1.1f, 1.2f}};
+
+    const auto words = group_words(tokens, times, eos_token_id, decode);
+    ASSERT_EQ(words.size(), 2);
+    EXPECT_EQ(words[0].word, " Hello");
+    EXPECT_EQ(words[0].token_ids, std::vector<int64_t>{1});
+    EXPECT_FLOAT_EQ(words[0].start_ts, 0.0f);
+    EXPECT_FLOAT_EQ(words[0].end_ts, 0.5f);
+    EXPECT_EQ(words[1].word, " world!");
+    EXPECT_EQ(words[1].token_ids, (std::vector<int64_t>{2, 3, 4}));
+    EXPECT_FLOAT_EQ(words[1].start_ts, 0.5f);
+    EXPECT_FLOAT_EQ(words[1].end_ts, 1.1f);
+}
+
+TEST(TestWhisperWordTimestamps, incomplete_characters_are_joined) {
+    // the tokens 1 and 2 are the bytes of a single character
+    auto decode = [](const std::vector<int64_t>& tokens) -> std::string {
+        if (tokens == std::vector<int64_t>{1}) {
+            return " \xEF\xBF\xBD";
+        }
+        if (tokens == std::vector<int64_t>{1, 2}) {
+            return " \xC3\xA9";
+        }
+        return " a";
+    };
+
+    const std::vector<int64_t> tokens = {1, 2, 3};
+    const std::vector<std::pair<float, float>> times = {{0.0f, 0.1f}, {0.1f, 0.2f}, {0.2f, 0.3f}};
+
+    const auto words = group_words(tokens, times, 100, decode);
+    ASSERT_EQ(words.size(), 2);
+    EXPECT_EQ(words[0].word, " \xC3\xA9");
+    EXPECT_EQ(words[0].token_ids, (std::vector<int64_t>{1, 2}));
+    EXPECT_FLOAT_EQ(words[0].start_ts, 0.0f);
+    EXPECT_FLOAT_EQ(words[0].end_ts, 0.2f);
+    EXPECT_EQ(words[1].word, " a");
+}
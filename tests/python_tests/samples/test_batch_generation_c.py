@@ -0,0 +1,21 @@
+# Copyright (C) 2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+
+from conftest import SAMPLES_C_DIR
+from test_utils import run_sample
+
+class TestBatchGeneration:
+    @pytest.mark.llm
+    @pytest.mark.samples
+    @pytest.mark.parametrize("convert_model", ["TinyLlama-1.1B-Chat-v1.0"], indirect=True)
+    def test_c_sample_batch_generation(self, convert_model):
+        prompts = ["What is OpenVINO?", "Why is the sky blue?"]
+        c_sample = os.path.join(SAMPLES_C_DIR, 'batch_generation_c')
+        c_result = run_sample([c_sample, convert_model] + prompts)
+        # the sample checks that too short token rows and too small output buffer are rejected
+        assert "bytes is too small" in c_result.stdout
+        for prompt in prompts:
+            assert f"Prompt: {prompt}\nResult: " in c_result.stdout
@@ -4,7 +4,7 @@
 import os
 import pytest
 
-from conftest import SAMPLES_CPP_DIR
+from conftest import SAMPLES_CPP_DIR, SAMPLES_C_DIR
 from test_utils import run_sample
 
 class TestContinuousBatching:
@@ -32,3 +32,13 @@ class TestContinuousBatching:
         cpp_command =[cpp_sample, '-m', convert_model, '--dataset', download_test_content] + sample_args
         run_sample(cpp_command)
         
+
+    @pytest.mark.samples
+    @pytest.mark.parametrize("convert_model", ["TinyLlama-1.1B-Chat-v1.0"], indirect=True)
+    def test_c_sample_continuous_batching(self, convert_model):
+        prompts = ["What is OpenVINO?", "Why is the sky blue?"]
+        c_sample = os.path.join(SAMPLES_C_DIR, 'continuous_batching_c')
+        c_result = run_sample([c_sample, convert_model] + prompts)
+        for prompt in prompts:
+            assert f"Prompt: {prompt}\nResult: " in c_result.stdout
+        assert "Max cache usage" in c_result.stdout
@@ -1,15 +1,17 @@
 # Copyright (C) 2018-2025 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
+import asyncio
 import os
 import pytest
 import math
 import sys
+import time
 
 from pathlib import Path
 from shutil import rmtree
 
-from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, draft_model, GenerationFinishReason
+from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, draft_model, GenerationFinishReason, AsyncEngineLoop, GenerationStatus
 
 from test_sampling import RandomSamplingTestStruct, get_current_platform_ref_texts
 
@@ -243,9 +245,158 @@ def test_post_oom_health(sampling_config):
     assert (len(output))
     assert (len(output[0].m_generation_ids))
 
-#
-# Pre-emption
-#
+@pytest.mark.precommit
+def test_memory_report():
+    scheduler_config = dict_to_scheduler_config()
+    scheduler_config.num_kv_blocks = 10
+
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id)
+    cb_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, device="CPU", scheduler_config=scheduler_config)
+
+    generation_config = get_greedy()
+    generation_config.max_new_tokens = 10
+    cb_pipe.generate(["What is OpenVINO?"], [generation_config])
+
+    memory_report = cb_pipe.get_memory_report()
+    assert memory_report.weights["language"] > 0
+    assert memory_report.kv_cache_allocated > 0
+    assert memory_report.kv_cache_used <= memory_report.kv_cache_allocated
+    assert memory_report.input_buffers > 0
+    assert memory_report.get_total_bytes() >= memory_report.weights["language"] + memory_report.kv_cache_allocated
+
+    pipeline_metrics = cb_pipe.get_metrics()
+    assert 0 < pipeline_metrics.peak_kv_cache_used_bytes <= pipeline_metrics.peak_kv_cache_allocated_bytes
+    assert pipeline_metrics.peak_memory_bytes >= memory_report.get_total_bytes()
+
+@pytest.mark.precommit
+def test_kv_cache_memory_utilization_out_of_range():
+    scheduler_config = dict_to_scheduler_config()
+    scheduler_config.num_kv_blocks = 0
+    scheduler_config.kv_cache_memory_utilization = 1.5
+
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id)
+    with pytest.raises(RuntimeError, match="kv_cache_memory_utilization must be in"):
+        create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, device="CPU", scheduler_config=scheduler_config)
+
+@pytest.mark.precommit
+def test_request_metrics():
+    scheduler_config = dict_to_scheduler_config()
+    scheduler_config.enable_prefix_caching = True
+
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id)
+    cb_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, device="CPU", scheduler_config=scheduler_config)
+
+    generation_config = get_greedy()
+    generation_config.max_new_tokens = 10
+    # longer than a few KV cache blocks, so that the second request restores them from the prefix cache
+    prompt = "What is OpenVINO? " * 50
+    first = cb_pipe.generate([prompt], [generation_config])[0].request_metrics
+    assert first.num_prefill_chunks >= 1
+    assert first.num_prefix_cache_hit_tokens == 0
+    assert 0 <= first.queue_time < first.ttft <= first.total_time
+    assert first.prefill_time <= first.ttft
+
+    handle = cb_pipe.add_request(1, prompt, generation_config)
+    while cb_pipe.has_non_finished_requests():
+        cb_pipe.step()
+    second = handle.get_request_metrics()
+    assert second.num_prefix_cache_hit_tokens > 0
+    assert second.ttft <= second.total_time
+    assert second.num_draft_tokens == 0
+
+@pytest.mark.precommit
+def test_disaggregated_prefill_and_decode():
+    scheduler_config = dict_to_scheduler_config()
+    scheduler_config.enable_prefix_caching = True
+
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id)
+    prefill_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, device="CPU", scheduler_config=scheduler_config)
+    decode_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, device="CPU", scheduler_config=scheduler_config)
+
+    # longer than a few KV cache blocks, so that the decoding pipeline restores them
+    input_ids = prefill_pipe.get_tokenizer().encode("What is OpenVINO? " * 50).input_ids
+    generation_config = get_greedy()
+    generation_config.max_new_tokens = 10
+    ref_ids = prefill_pipe.generate([input_ids], [generation_config])[0].m_generation_ids
+
+    kv_blocks = prefill_pipe.export_kv_blocks(input_ids)
+    assert decode_pipe.import_kv_blocks(kv_blocks) > 0
+    # the blocks are in the prefix cache already
+    assert decode_pipe.import_kv_blocks(kv_blocks) == 0
+
+    handle = decode_pipe.add_request(0, input_ids, generation_config)
+    while decode_pipe.has_non_finished_requests():
+        decode_pipe.step()
+    assert handle.get_request_metrics().num_prefix_cache_hit_tokens > 0
+    assert handle.read_all()[0].generated_ids == ref_ids[0]
+
+@pytest.mark.precommit
+def test_cancelled_and_expired_requests_release_kv_cache():
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id)
+    cb_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, device="CPU", scheduler_config=dict_to_scheduler_config())
+
+    generation_config = get_greedy()
+    generation_config.max_new_tokens = 100
+    generation_config.ignore_eos = True
+
+    handle = cb_pipe.add_request(0, "What is OpenVINO?", generation_config)
+    cb_pipe.step()
+    assert cb_pipe.get_memory_report().kv_cache_used > 0
+    handle.cancel()
+    # the cancelled request is released before scheduling the next step
+    cb_pipe.step()
+    assert not cb_pipe.has_non_finished_requests()
+    assert cb_pipe.get_memory_report().kv_cache_used == 0
+
+    generation_config.deadline_ms = 1
+    expired_handle = cb_pipe.add_request(1, "What is OpenVINO?", generation_config)
+    time.sleep(0.01)
+    generation_config.deadline_ms = 0
+    handle = cb_pipe.add_request(2, "What is OpenVINO?", generation_config)
+    while cb_pipe.has_non_finished_requests():
+        cb_pipe.step()
+    assert expired_handle.get_status() == GenerationStatus.CANCEL
+    assert expired_handle.get_request_metrics().num_prefill_chunks == 0
+    assert handle.get_status() == GenerationStatus.FINISHED
+
+@pytest.mark.precommit
+def test_async_engine_loop():
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id)
+    cb_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, device="CPU", scheduler_config=dict_to_scheduler_config())
+
+    generation_config = get_greedy()
+    generation_config.max_new_tokens = 10
+    prompts = ["What is OpenVINO?", "How are you?", "1 2 3 4"]
+    expected = cb_pipe.generate(prompts, [generation_config] * len(prompts))
+
+    async def generate():
+        engine_loop = AsyncEngineLoop(cb_pipe)
+        streams = [engine_loop.add_request(request_id, prompt, generation_config) for request_id, prompt in enumerate(prompts)]
+
+        async def collect(stream):
+            tokens = []
+            async for new_tokens in stream:
+                assert len(new_tokens) > 0
+                tokens += new_tokens
+            assert stream.get_status() == GenerationStatus.FINISHED
+            return tokens
+
+        try:
+            return await asyncio.gather(*(collect(stream) for stream in streams))
+        finally:
+            engine_loop.stop()
+
+    tokenizer = cb_pipe.get_tokenizer()
+    for tokens, result in zip(asyncio.run(generate()), expected):
+        assert tokenizer.decode(tokens) == result.m_generation_ids[0]
+
+
 
 def get_parallel_sampling_seq_len_300() -> GenerationConfig:
     generation_config = GenerationConfig()
@@ -451,6 +602,36 @@ def test_dynamic_split_fuse_doesnt_affect_generated_text(pipeline_type):
     assert generated == reference
 
 
+@pytest.mark.precommit
+def test_overlapped_draft_model_doesnt_affect_generated_text():
+    model_id : str = "TinyLlama/TinyLlama-1.1B-Chat-v1.0"
+    _, _, models_path = download_and_convert_model(model_id)
+
+    pipe_ref = LLMPipeline(models_path, "CPU", draft_model=draft_model(models_path), overlap_draft_model=False)
+    pipe_target = LLMPipeline(models_path, "CPU", draft_model=draft_model(models_path), overlap_draft_model=True)
+
+    generation_config = GenerationConfig(do_sample=False, max_new_tokens=30, ignore_eos=True, num_assistant_tokens=5)
+
+    question = "Why is the Sun yellow?"
+    reference = pipe_ref.generate(question, generation_config=generation_config)
+    generated = pipe_target.generate(question, generation_config=generation_config)
+    assert generated == reference
+
+
+@pytest.mark.precommit
+def test_self_speculative_decoding_doesnt_affect_generated_text():
+    model_id : str = "TinyLlama/TinyLlama-1.1B-Chat-v1.0"
+    _, _, models_path = download_and_convert_model(model_id)
+
+    pipe_ref = LLMPipeline(models_path, "CPU", ATTENTION_BACKEND="PA")
+    pipe_target = LLMPipeline(models_path, "CPU", self_speculative_num_layers=4)
+
+    question = "Why is the Sun yellow?"
+    reference = pipe_ref.generate(question, GenerationConfig(do_sample=False, max_new_tokens=30, ignore_eos=True))
+    generated = pipe_target.generate(question, GenerationConfig(do_sample=False, max_new_tokens=30, ignore_eos=True, num_assistant_tokens=3))
+    assert generated == reference
+
+
 def get_data_by_pipeline_type(model_path: Path, pipeline_type: str, generation_config: GenerationConfig):
     device = "CPU"
     prompt = "Prompt example is"
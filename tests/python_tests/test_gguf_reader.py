@@ -136,3 +136,33 @@ def test_full_gguf_qwen3_pipeline(pipeline_type, model_ids):
     res_string_input_2 = ov_pipe_gguf.generate(prompt, generation_config=ov_generation_config)
 
     assert res_string_input_1 == res_string_input_2
+
+
+@pytest.mark.parametrize("model_ids", [{"gguf_model_id": "Qwen/Qwen3-0.6B-GGUF", "gguf_filename": "Qwen3-0.6B-Q8_0.gguf"}])
+@pytest.mark.precommit
+def test_gguf_cache_dir(model_ids, tmp_path):
+    gguf_full_path = download_gguf_model(model_ids["gguf_model_id"], model_ids["gguf_filename"])
+    prompt = 'Why is the Sun yellow?'
+
+    ov_generation_config = ov_genai.GenerationConfig()
+    ov_generation_config.max_new_tokens = 10
+    ov_generation_config.apply_chat_template = False
+
+    ov_pipe_gguf = ov_genai.LLMPipeline(gguf_full_path, "CPU", gguf_cache_dir=str(tmp_path))
+    res_string_input_1 = ov_pipe_gguf.generate(prompt, generation_config=ov_generation_config)
+    del ov_pipe_gguf
+    gc.collect()
+
+    cached_models = list(tmp_path.glob("*/openvino_model.xml"))
+    assert len(cached_models) == 1
+    assert cached_models[0].with_suffix(".bin").exists()
+    assert (tmp_path / "compiled").exists()
+
+    # the second pipeline reads the cached model
+    ov_pipe_cached = ov_genai.LLMPipeline(gguf_full_path, "CPU", gguf_cache_dir=str(tmp_path))
+    res_string_input_2 = ov_pipe_cached.generate(prompt, generation_config=ov_generation_config)
+    del ov_pipe_cached
+    gc.collect()
+
+    assert list(tmp_path.glob("*/openvino_model.xml")) == cached_models
+    assert res_string_input_1 == res_string_input_2
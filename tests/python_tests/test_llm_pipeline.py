@@ -102,6 +102,76 @@ def test_batch_size_switch():
     ov_pipe.generate(["a"], max_new_tokens=2)
 
 
+@pytest.mark.precommit
+@pytest.mark.parametrize("pipeline_type", [PipelineType.STATEFUL, PipelineType.PAGED_ATTENTION])
+def test_warmup_does_not_change_results(pipeline_type):
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    ov_pipe = create_ov_pipeline(models_path, pipeline_type=pipeline_type)
+
+    reference = ov_pipe.generate("Why is the Sun yellow?", max_new_tokens=10)
+    ov_pipe.warmup(ov_genai.WarmupConfig(prompt_lengths=[4, 32], batch_sizes=[1, 2]))
+    assert ov_pipe.generate("Why is the Sun yellow?", max_new_tokens=10) == reference
+
+
+@pytest.mark.precommit
+def test_chunked_prefill_batch_matches_unchunked():
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    prompts = ['Why is the Sun yellow? Describe the physics of the light scattering', 'Alan Turing was a']
+
+    reference = create_ov_pipeline(models_path, pipeline_type=PipelineType.STATEFUL).generate(prompts, max_new_tokens=10)
+    ov_config = get_default_llm_properties()
+    ov_config["prefill_chunk_size"] = 4
+    ov_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.STATEFUL, ov_config=ov_config)
+    assert ov_pipe.generate(prompts, max_new_tokens=10).texts == reference.texts
+
+
+@pytest.mark.precommit
+@pytest.mark.parametrize("pipeline_type", [PipelineType.STATEFUL, PipelineType.PAGED_ATTENTION])
+def test_concurrent_generate(pipeline_type):
+    from concurrent.futures import ThreadPoolExecutor
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    ov_pipe = create_ov_pipeline(models_path, pipeline_type=pipeline_type)
+
+    prompts = ["table is made of", "Why is the Sun yellow?", "1 + 1 =", "Alan Turing was a"]
+    references = [ov_pipe.generate(prompt, max_new_tokens=20).texts[0] for prompt in prompts]
+    with ThreadPoolExecutor(max_workers=len(prompts)) as executor:
+        results = list(executor.map(lambda prompt: ov_pipe.generate(prompt, max_new_tokens=20).texts[0], prompts * 2))
+    assert results == references * 2
+
+
+@pytest.mark.precommit
+def test_compiled_model_cache_dir(tmp_path):
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+
+    ov_genai.set_compiled_model_cache_dir(tmp_path)
+    try:
+        assert ov_genai.get_compiled_model_cache_dir() == tmp_path
+        reference = create_ov_pipeline(models_path).generate("Why is the Sun yellow?", max_new_tokens=10)
+        assert any(tmp_path.glob("*.blob"))
+        assert create_ov_pipeline(models_path).generate("Why is the Sun yellow?", max_new_tokens=10) == reference
+    finally:
+        ov_genai.set_compiled_model_cache_dir("")
+    assert ov_genai.get_compiled_model_cache_dir() == Path()
+
+
+@pytest.mark.precommit
+def test_stateful_prompt_lookup_decoding_matches_greedy():
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    ov_pipe = ov_genai.LLMPipeline(models_path, 'CPU', ATTENTION_BACKEND="SDPA")
+    prompt_lookup_pipe = ov_genai.LLMPipeline(models_path, 'CPU', ATTENTION_BACKEND="SDPA", prompt_lookup=True)
+
+    # repeated text, so that candidates are found in the prompt
+    prompt = "The cat sat on the mat. The cat sat on the mat. The cat"
+    reference = ov_pipe.generate(prompt, max_new_tokens=30)
+    generated = prompt_lookup_pipe.generate(prompt, max_new_tokens=30, num_assistant_tokens=5, max_ngram_size=3)
+    assert generated == reference
+
+
 @pytest.mark.precommit
 def test_empty_encoded_inputs_throw():
     model_id = 'katuni4ka/tiny-random-phi3'
@@ -249,6 +319,41 @@ def test_chat_scenario_several_chats_in_series():
         assert chat_history_ov == chat_history_hf
 
 
+@pytest.mark.precommit
+@pytest.mark.parametrize("max_cached_chat_sessions", [1, 2])
+def test_chat_scenario_suspend_and_resume(max_cached_chat_sessions):
+    opt_model, hf_tokenizer, models_path  = download_and_convert_model(get_chat_models_list()[0])
+    ov_config = get_default_llm_properties()
+
+    generation_config_kwargs, _ = chat_inputs[0]
+    ov_generation_config = ov_genai.GenerationConfig(**generation_config_kwargs)
+
+    ov_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.STATEFUL, ov_config=ov_config)
+    ref_answers = []
+    for session_questions in [questions[:2], questions[2:4]]:
+        ov_pipe.start_chat()
+        ref_answers.append([ov_pipe.generate(prompt, generation_config=ov_generation_config) for prompt in session_questions])
+        ov_pipe.finish_chat()
+
+    # with one cached session, the history of the other one is processed again on resume
+    ov_config["max_cached_chat_sessions"] = max_cached_chat_sessions
+    ov_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.STATEFUL, ov_config=ov_config)
+    answers = [[], []]
+    for session_id in range(2):
+        ov_pipe.start_chat()
+        answers[session_id].append(ov_pipe.generate(questions[2 * session_id], generation_config=ov_generation_config))
+        ov_pipe.suspend_chat(str(session_id))
+    for session_id in range(2):
+        ov_pipe.resume_chat(str(session_id))
+        answers[session_id].append(ov_pipe.generate(questions[2 * session_id + 1], generation_config=ov_generation_config))
+        ov_pipe.finish_chat()
+
+    assert answers == ref_answers
+
+    with pytest.raises(RuntimeError):
+        ov_pipe.resume_chat("0")
+
+
 @pytest.mark.precommit
 @pytest.mark.parametrize("model_id", get_chat_models_list())
 def test_chat_scenario_several_start(model_id):
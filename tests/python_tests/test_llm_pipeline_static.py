@@ -269,6 +269,23 @@ def test_terminate_by_out_of_memory(config, model_id):
     assert len(encoded_results.tokens[0]) == (kv_cache_size - input_len + 1)
 
 
+@pytest.mark.precommit
+@pytest.mark.parametrize("model_id", get_models_list())
+def test_prefill_buckets_long_generation_from_short_prompt(model_id):
+    _, _, model_path = download_and_convert_model(model_id)
+    prompt = 'The Sun is yellow because'
+    num_tokens = 200
+    # the smallest bucket fits the prompt but not the generation, which has to go to the largest one
+    pipeline_config = { "PREFILL_BUCKETS": [64, 256], "MIN_RESPONSE_LEN": 64 } | static_config
+
+    tokenizer = Tokenizer(model_path)
+    tokenized_input = tokenizer.encode(prompt)
+
+    pipe = LLMPipeline(model_path, "NPU", **pipeline_config)
+    encoded_results = pipe.generate(tokenized_input, max_new_tokens=num_tokens, ignore_eos=True)
+    assert len(encoded_results.tokens[0]) == num_tokens
+
+
 @pytest.mark.precommit
 @pytest.mark.parametrize("config", pipeline_configs)
 @pytest.mark.parametrize("model_id", get_models_list())
@@ -2,10 +2,12 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import numpy as np
+import openvino as ov
 import pytest
 import gc
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
-from openvino_genai import TextEmbeddingPipeline, TextRerankPipeline
+from openvino_genai import TextEmbeddingPipeline, TextRerankPipeline, VectorIndex
 from utils.hugging_face import download_and_convert_embeddings_models, download_and_convert_rerank_model
 from langchain_core.documents.base import Document
 from langchain_community.embeddings import OpenVINOBgeEmbeddings
@@ -253,6 +255,167 @@ def test_embed_documents(download_and_convert_embeddings_models, dataset_documen
     run_text_embedding_pipeline_with_ref(models_path, dataset_documents, config, "embed_documents")
 
 
+@pytest.mark.parametrize("download_and_convert_embeddings_models", EMBEDDINGS_TEST_MODELS, indirect=True)
+@pytest.mark.precommit
+def test_embed_documents_max_batch_tokens(download_and_convert_embeddings_models, dataset_documents):
+    _, _, models_path = download_and_convert_embeddings_models
+    # the short documents are embedded by other batches and reordered back to the input order
+    documents = ["short document", *dataset_documents, "another short document"]
+
+    single_batch_result = run_text_embedding_genai(
+        models_path, documents, TextEmbeddingPipeline.Config(pooling_type=TextEmbeddingPipeline.PoolingType.MEAN)
+    )
+    micro_batches_result = run_text_embedding_genai(
+        models_path,
+        documents,
+        TextEmbeddingPipeline.Config(pooling_type=TextEmbeddingPipeline.PoolingType.MEAN, max_batch_tokens=128),
+    )
+
+    max_error = np.abs(np.array(single_batch_result) - np.array(micro_batches_result)).max()
+    assert max_error < 1e-5, f"Max error: {max_error}"
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", EMBEDDINGS_TEST_MODELS, indirect=True)
+@pytest.mark.precommit
+def test_embed_documents_quantized(download_and_convert_embeddings_models, dataset_documents):
+    _, _, models_path = download_and_convert_embeddings_models
+    embeddings = np.array(run_text_embedding_genai(models_path, dataset_documents))
+
+    def embed(precision):
+        config = TextEmbeddingPipeline.Config(embedding_precision=precision)
+        return np.array(run_text_embedding_genai(models_path, dataset_documents, config))
+
+    int8_embeddings = embed(TextEmbeddingPipeline.EmbeddingPrecision.INT8)
+    assert np.abs(int8_embeddings - np.round(embeddings * 127)).max() <= 1
+
+    uint8_embeddings = embed(TextEmbeddingPipeline.EmbeddingPrecision.UINT8)
+    assert np.abs(uint8_embeddings - np.round((embeddings + 1) * 127.5)).max() <= 1
+
+    # the signs of the values close to zero may differ
+    binary_embeddings = embed(TextEmbeddingPipeline.EmbeddingPrecision.BINARY)
+    assert binary_embeddings.shape == (embeddings.shape[0], embeddings.shape[1] // 8)
+    mismatches = np.unpackbits(binary_embeddings.astype(np.uint8), axis=1) != (embeddings > 0)
+    assert np.all(np.abs(embeddings[mismatches]) < 1e-4)
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", [EMBEDDINGS_TEST_MODELS[0]], indirect=True)
+@pytest.mark.parametrize(
+    "precision,dtype",
+    [
+        (TextEmbeddingPipeline.EmbeddingPrecision.F32, np.float32),
+        (TextEmbeddingPipeline.EmbeddingPrecision.INT8, np.int8),
+        (TextEmbeddingPipeline.EmbeddingPrecision.UINT8, np.uint8),
+    ],
+    ids=["f32", "int8", "uint8"],
+)
+@pytest.mark.precommit
+def test_embeddings_are_numpy_arrays(download_and_convert_embeddings_models, dataset_documents, precision, dtype):
+    _, _, models_path = download_and_convert_embeddings_models
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", TextEmbeddingPipeline.Config(embedding_precision=precision))
+
+    embeddings = pipeline.embed_documents(dataset_documents)
+    assert isinstance(embeddings, np.ndarray) and embeddings.dtype == dtype
+    assert embeddings.ndim == 2 and embeddings.shape[0] == len(dataset_documents)
+
+    query = pipeline.embed_query(dataset_documents[0])
+    assert isinstance(query, np.ndarray) and query.dtype == dtype
+    assert query.shape == (embeddings.shape[1],)
+    # the array owns the embedding, so it outlives the next calls
+    pipeline.embed_query(dataset_documents[1])
+    assert np.array_equal(query, pipeline.embed_query(dataset_documents[0]))
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", EMBEDDINGS_TEST_MODELS, indirect=True)
+@pytest.mark.precommit
+def test_embed_documents_embedding_size(download_and_convert_embeddings_models, dataset_documents):
+    _, _, models_path = download_and_convert_embeddings_models
+    embedding_size = 64
+    embeddings = np.array(
+        run_text_embedding_genai(models_path, dataset_documents, TextEmbeddingPipeline.Config(normalize=False))
+    )
+
+    # the first dimensions are renormalized
+    truncated_embeddings = np.array(
+        run_text_embedding_genai(models_path, dataset_documents, TextEmbeddingPipeline.Config(embedding_size=embedding_size))
+    )
+    reference = embeddings[:, :embedding_size]
+    reference /= np.linalg.norm(reference, axis=1, keepdims=True)
+    assert truncated_embeddings.shape == reference.shape
+    max_error = np.abs(truncated_embeddings - reference).max()
+    assert max_error < 1e-5, f"Max error: {max_error}"
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", EMBEDDINGS_TEST_MODELS, indirect=True)
+@pytest.mark.precommit
+def test_embed_document_windows(download_and_convert_embeddings_models, dataset_documents):
+    _, _, models_path = download_and_convert_embeddings_models
+    documents = ["short document", " ".join(dataset_documents)]
+    config = TextEmbeddingPipeline.Config(window_length=64, window_overlap=16)
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", config)
+
+    windows = pipeline.embed_document_windows(documents)
+    window_embeddings = np.array(windows.embeddings)
+    assert windows.document_indices[0] == 0
+    assert len(windows.document_indices) > 2 and set(windows.document_indices[1:]) == {1}
+
+    # a short document has a single window, which is embedded as is
+    reference = np.array(run_text_embedding_genai(models_path, documents[:1]))
+    assert np.abs(window_embeddings[0] - reference[0]).max() < 1e-5
+
+    # the embedding of a long document is the normalized weighted mean of its windows
+    embeddings = np.array(pipeline.embed_documents(documents))
+    assert embeddings.shape == (len(documents), window_embeddings.shape[1])
+    assert np.abs(embeddings[0] - window_embeddings[0]).max() < 1e-5
+    assert np.abs(np.linalg.norm(embeddings[1]) - 1.0) < 1e-5
+    assert np.all(window_embeddings[1:] @ embeddings[1] > 0)
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", EMBEDDINGS_TEST_MODELS, indirect=True)
+@pytest.mark.precommit
+def test_embed_documents_iterator(download_and_convert_embeddings_models, dataset_documents):
+    _, _, models_path = download_and_convert_embeddings_models
+    pipeline = TextEmbeddingPipeline(models_path, "CPU")
+    expected = np.array(pipeline.embed_documents(dataset_documents))
+
+    # the rows past the documents stay untouched
+    embeddings = np.full((len(dataset_documents) + 2, expected.shape[1]), -1.0, dtype=np.float32)
+    num_documents = pipeline.embed_documents(
+        iter(dataset_documents), ov.Tensor(embeddings, shared_memory=True), chunk_size=3
+    )
+
+    assert num_documents == len(dataset_documents)
+    max_error = np.abs(embeddings[:num_documents] - expected).max()
+    assert max_error < 1e-5, f"Max error: {max_error}"
+    assert np.all(embeddings[num_documents:] == -1.0)
+
+    # no more documents are pulled than the tensor has rows
+    embeddings = np.zeros((2, expected.shape[1]), dtype=np.float32)
+    documents = iter(dataset_documents)
+    assert pipeline.embed_documents(documents, ov.Tensor(embeddings, shared_memory=True)) == 2
+    assert next(documents) == dataset_documents[2]
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", EMBEDDINGS_TEST_MODELS, indirect=True)
+@pytest.mark.parametrize(
+    "pooling_type", [TextEmbeddingPipeline.PoolingType.CLS, TextEmbeddingPipeline.PoolingType.MEAN], ids=["cls", "mean"]
+)
+@pytest.mark.precommit
+def test_embed_documents_pack_sequences(download_and_convert_embeddings_models, dataset_documents, pooling_type):
+    _, _, models_path = download_and_convert_embeddings_models
+    # the short documents are packed into the rows of the longer ones
+    documents = ["short document", *dataset_documents, "another short document"]
+
+    padded_result = run_text_embedding_genai(models_path, documents, TextEmbeddingPipeline.Config(pooling_type=pooling_type))
+    packed_result = run_text_embedding_genai(
+        models_path,
+        documents,
+        TextEmbeddingPipeline.Config(pooling_type=pooling_type, pack_sequences=True, max_batch_tokens=256),
+    )
+
+    max_error = np.abs(np.array(padded_result) - np.array(packed_result)).max()
+    assert max_error < 1e-4, f"Max error: {max_error}"
+
+
 @pytest.mark.parametrize("download_and_convert_embeddings_models", EMBEDDINGS_TEST_MODELS, indirect=True)
 @pytest.mark.parametrize(
     "config",
@@ -323,3 +486,100 @@ def test_rerank_constructors(download_and_convert_rerank_model):
 def test_rerank_documents(download_and_convert_rerank_model, dataset_documents, query, config):
     _, _, models_path = download_and_convert_rerank_model
     run_text_rerank_pipeline_with_ref(models_path, query, dataset_documents, config)
+
+
+@pytest.mark.parametrize("download_and_convert_rerank_model", [RERANK_TEST_MODELS[0]], indirect=True)
+@pytest.mark.precommit
+def test_rerank_documents_micro_batches_and_cache(download_and_convert_rerank_model, dataset_documents):
+    _, _, models_path = download_and_convert_rerank_model
+    query = "What are the main features of Intel Core Ultra processors?"
+
+    reference = TextRerankPipeline(models_path, "CPU", TextRerankPipeline.Config(top_n=10)).rerank(query, dataset_documents)
+
+    # the second call gets all the scores from the cache
+    reranker = TextRerankPipeline(
+        models_path, "CPU", TextRerankPipeline.Config(top_n=10, max_batch_tokens=256, score_cache_size=1000)
+    )
+    for _ in range(2):
+        result = reranker.rerank(query, dataset_documents)
+        assert [index for index, _ in result] == [index for index, _ in reference]
+        max_error = max(abs(score - reference_score) for (_, score), (_, reference_score) in zip(result, reference))
+        assert max_error < 1e-5, f"Max error: {max_error}"
+
+
+@pytest.mark.parametrize("download_and_convert_rerank_model", [RERANK_TEST_MODELS[0]], indirect=True)
+@pytest.mark.parametrize("download_and_convert_embeddings_models", [EMBEDDINGS_TEST_MODELS[0]], indirect=True)
+@pytest.mark.precommit
+def test_rerank_documents_prefilter(
+    download_and_convert_rerank_model, download_and_convert_embeddings_models, dataset_documents
+):
+    _, _, rerank_models_path = download_and_convert_rerank_model
+    _, _, embeddings_models_path = download_and_convert_embeddings_models
+    query = "What are the main features of Intel Core Ultra processors?"
+    num_candidates = 4
+
+    reranker = TextRerankPipeline(rerank_models_path, "CPU", TextRerankPipeline.Config(top_n=len(dataset_documents)))
+    scores = dict(reranker.rerank(query, dataset_documents))
+
+    reranker.set_prefilter(TextEmbeddingPipeline(embeddings_models_path, "CPU"), num_candidates)
+    result = reranker.rerank(query, dataset_documents)
+
+    # the candidates keep the scores of the rerank model
+    assert len(result) == num_candidates
+    for index, score in result:
+        assert index in scores and abs(score - scores[index]) < 1e-5
+
+    reranker.set_prefilter(None, 0)
+    assert len(reranker.rerank(query, dataset_documents)) == len(dataset_documents)
+
+
+@pytest.mark.parametrize("download_and_convert_rerank_model", [RERANK_TEST_MODELS[0]], indirect=True)
+@pytest.mark.parametrize("download_and_convert_embeddings_models", [EMBEDDINGS_TEST_MODELS[0]], indirect=True)
+@pytest.mark.precommit
+def test_concurrent_calls(download_and_convert_rerank_model, download_and_convert_embeddings_models, dataset_documents):
+    _, _, rerank_models_path = download_and_convert_rerank_model
+    _, _, embeddings_models_path = download_and_convert_embeddings_models
+    queries = ["What are the main features of Intel Core Ultra processors?", "What is OpenVINO?", "Who founded Intel?"]
+
+    embedder = TextEmbeddingPipeline(embeddings_models_path, "CPU", TextEmbeddingPipeline.Config(max_batch_tokens=256))
+    reranker = TextRerankPipeline(rerank_models_path, "CPU", TextRerankPipeline.Config(top_n=len(dataset_documents)))
+    embeddings_reference = np.array(embedder.embed_documents(dataset_documents))
+    rerank_reference = [reranker.rerank(query, dataset_documents) for query in queries]
+
+    # the calls of the threads share the infer requests of the pipelines
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        embeddings_futures = [executor.submit(embedder.embed_documents, dataset_documents) for _ in range(4)]
+        rerank_futures = [executor.submit(reranker.rerank, query, dataset_documents) for query in queries]
+
+        for future in embeddings_futures:
+            max_error = np.abs(np.array(future.result()) - embeddings_reference).max()
+            assert max_error < 1e-5, f"Max error: {max_error}"
+        for future, reference in zip(rerank_futures, rerank_reference):
+            result = future.result()
+            assert [index for index, _ in result] == [index for index, _ in reference]
+            max_error = max(abs(score - reference_score) for (_, score), (_, reference_score) in zip(result, reference))
+            assert max_error < 1e-5, f"Max error: {max_error}"
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", [EMBEDDINGS_TEST_MODELS[0]], indirect=True)
+@pytest.mark.parametrize("storage", [VectorIndex.Storage.F32, VectorIndex.Storage.INT8], ids=["f32", "int8"])
+@pytest.mark.precommit
+def test_vector_index(download_and_convert_embeddings_models, dataset_documents, storage, tmp_path):
+    _, _, models_path = download_and_convert_embeddings_models
+    pipeline = TextEmbeddingPipeline(models_path, "CPU")
+    embeddings = pipeline.embed_documents(dataset_documents)
+
+    config = VectorIndex.Config()
+    config.storage = storage
+    index = VectorIndex(len(embeddings[0]), config)
+    assert index.add(embeddings) == 0
+    assert len(index) == len(dataset_documents)
+
+    # a document is the nearest to itself
+    for document_id in range(len(dataset_documents)):
+        assert index.search(embeddings[document_id], 1)[0][0] == document_id
+
+    index.save(tmp_path / "index.bin")
+    loaded = VectorIndex.load(tmp_path / "index.bin")
+    query = pipeline.embed_query(dataset_documents[0])
+    assert loaded.search(query, 3) == index.search(query, 3)
@@ -9,7 +9,7 @@ from typing import TypedDict
 
 from openvino_genai import GenerationConfig, StopCriteria
 
-from utils.ov_genai_pipelines import generate_and_compare, run_ov_pipeline, get_main_pipeline_types
+from utils.ov_genai_pipelines import generate_and_compare, run_ov_pipeline, get_main_pipeline_types, PipelineType
 from utils.hugging_face import download_and_convert_model
 
 @pytest.mark.precommit
@@ -341,3 +341,18 @@ def test_multinomial_sampling_against_reference(test_struct: RandomSamplingTestS
 
     # Reference comparison is not performed as sampling results are non-deterministic.
     # Discrete_distribution impl depends on platform, model inference results may depend on CPU.
+
+
+@pytest.mark.precommit
+def test_best_of_returns_the_best_samples():
+    _, _, models_path = download_and_convert_model("facebook/opt-125m")
+    generation_config = GenerationConfig(do_sample=True, max_new_tokens=20, rng_seed=0, num_return_sequences=2, best_of=6)
+    results = run_ov_pipeline(models_path=models_path,
+                              prompt=["What is OpenVINO?"],
+                              generation_config=[generation_config],
+                              pipeline_type=PipelineType.CONTINUOUS_BATCHING)
+
+    # the best 2 of 6 samples are returned, ordered by the cumulative log probability
+    assert len(results[0].m_generation_ids) == 2
+    assert results[0].m_scores[0] >= results[0].m_scores[1]
+
@@ -5,7 +5,7 @@ import openvino_genai as ov_genai
 from pydantic import BaseModel, Field
 from typing import Literal
 from utils.hugging_face import download_and_convert_model
-from utils.ov_genai_pipelines import create_ov_pipeline
+from utils.ov_genai_pipelines import create_ov_pipeline, PipelineType
 import re
 
 @pytest.fixture(scope="module")
@@ -55,6 +55,29 @@ def test_structured_output_generation(ov_pipe, prompt_and_scheme):
     SchemeType.model_validate_json(res_str)
 
 
+@pytest.mark.precommit
+@pytest.mark.parametrize("ov_pipe", structured_id_models, indirect=True)
+def test_json_streamer_events_match_result(ov_pipe):
+    structured_output_config = ov_genai.StructuredOutputConfig()
+    structured_output_config.json_schema = json.dumps(Person.model_json_schema())
+
+    gen_config = ov_genai.GenerationConfig()
+    gen_config.max_new_tokens = 100
+    gen_config.structured_output_config = structured_output_config
+
+    events = []
+    streamer = ov_genai.JsonStreamer(ov_pipe.get_tokenizer(), lambda event: events.append(event) and False)
+    res_str = ov_pipe.generate("Generate a json about a person.", generation_config=gen_config, streamer=streamer)
+    person = Person.model_validate_json(str(res_str))
+
+    values = {event.path: event.value for event in events if event.type == ov_genai.JsonEventType.VALUE}
+    assert values == {"/name": person.name, "/age": str(person.age), "/city": person.city}
+    streamed_name = "".join(event.value for event in events if event.type == ov_genai.JsonEventType.STRING_CHUNK and event.path == "/name")
+    assert streamed_name == person.name
+    assert events[0].type == ov_genai.JsonEventType.OBJECT_START
+    assert events[-1].type == ov_genai.JsonEventType.OBJECT_END
+
+
 @pytest.mark.precommit
 @pytest.mark.parametrize("ov_pipe", structured_id_models, indirect=True)
 @pytest.mark.parametrize("prompt_and_regex", [
@@ -140,3 +163,29 @@ def test_structural_tags(ov_pipe, prompt_and_structural_tag):
     match = re.search(rf"{structural_tag.begin}(.*?){structural_tag.end}", res_str)
     assert match, f"Output `{res_str}` does not contain structural tag {structural_tag.begin}...{structural_tag.end}"
     RESTAPIResponse.model_validate_json(match.group(1))
+
+
+@pytest.mark.precommit
+@pytest.mark.parametrize("model_id", structured_id_models)
+@pytest.mark.parametrize("prompt_and_scheme", [
+    ("Generate a json about a person.", Person),
+    ("Generate a json about a transaction.", Transaction),
+])
+def test_jump_forward_matches_token_by_token_generation(model_id, prompt_and_scheme):
+    # the paged attention pipeline appends the tokens forced by the grammar at once, while the stateful one generates them one by one
+    prompt, SchemeType = prompt_and_scheme
+    _, _, models_path = download_and_convert_model(model_id)
+
+    structured_output_config = ov_genai.StructuredOutputConfig()
+    structured_output_config.json_schema = json.dumps(SchemeType.model_json_schema())
+
+    gen_config = ov_genai.GenerationConfig()
+    gen_config.max_new_tokens = 100
+    gen_config.do_sample = False
+    gen_config.structured_output_config = structured_output_config
+
+    results = [create_ov_pipeline(models_path, pipeline_type).generate(prompt, generation_config=gen_config)
+               for pipeline_type in (PipelineType.STATEFUL, PipelineType.PAGED_ATTENTION)]
+
+    assert results[0] == results[1]
+    SchemeType.model_validate_json(results[1])
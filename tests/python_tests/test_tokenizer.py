@@ -659,3 +659,36 @@ def test_chat_template_with_empty_output(tmp_path):
     chat_template_with_empty_output = QWEN2_VL_2B + "\n"
     with pytest.raises(Exception):
         tokenizer.apply_chat_template(conversation, add_generation_prompt=False, chat_template=chat_template_with_empty_output)
+
+
+@pytest.mark.precommit
+@pytest.mark.parametrize("model_id", get_models_list())
+def test_encode_parallel(model_id):
+    _, hf_tokenizer, models_path = download_and_convert_model(model_id)
+    ov_tokenizer = Tokenizer(models_path, {"num_tokenizer_infer_requests": 4})
+
+    batch = [
+        "1+1=",
+        "What is the previous answer?",
+        "若我有一亿美元，在人工智能盛行的今天，我怎样投资才能收益最大化？",
+        "Multiline\nstring!\nWow!",
+    ]
+    # prompts of different lengths in different order, so that they are shuffled into the shards
+    batch = [prompt * (i % 5 + 1) for i, prompt in enumerate(batch * 8)]
+    token_ids = ov_tokenizer.encode_parallel(batch)
+    assert token_ids == hf_tokenizer(batch)["input_ids"]
+
+
+@pytest.mark.precommit
+@pytest.mark.parametrize("model_id", get_models_list())
+def test_encode_ragged(model_id):
+    _, hf_tokenizer, models_path = download_and_convert_model(model_id)
+    ov_tokenizer = Tokenizer(models_path)
+
+    batch = ["1+1=" * 20, "What is the previous answer?", "Multiline\nstring!\nWow!" * 3]
+    inputs = ov_tokenizer.encode_ragged(batch)
+    ref_token_ids = hf_tokenizer(batch)["input_ids"]
+    assert inputs.get_batch_size() == len(batch)
+    assert list(inputs.offsets.data) == [0, *np.cumsum([len(ids) for ids in ref_token_ids])]
+    for i, ids in enumerate(ref_token_ids):
+        assert inputs.get_input_ids(i).data.tolist() == [ids]
@@ -284,6 +284,43 @@ def test_vlm_continuous_batching_vs_stateful(config):
             )
 
 
+@pytest.mark.precommit
+@pytest.mark.parametrize(
+    "assisting_properties",
+    [{"prompt_lookup": True}, {"self_speculative_num_layers": 1}],
+    ids=["prompt_lookup", "self_speculative"],
+)
+def test_vlm_assisted_generation_doesnt_affect_generated_text(assisting_properties):
+    models_path = get_ov_model(model_ids[0])
+    images = [get_image_by_link(image_links[0])]
+    generation_config = GenerationConfig(max_new_tokens=20, ignore_eos=True)
+
+    ref_pipe = VLMPipeline(models_path, "CPU", ATTENTION_BACKEND="PA")
+    reference = ref_pipe.generate(prompts[0], images=images, generation_config=generation_config)
+
+    generation_config.num_assistant_tokens = 3
+    if "prompt_lookup" in assisting_properties:
+        generation_config.max_ngram_size = 3
+    assisted_pipe = VLMPipeline(models_path, "CPU", **assisting_properties)
+    generated = assisted_pipe.generate(prompts[0], images=images, generation_config=generation_config)
+    assert generated.texts == reference.texts
+
+
+@pytest.mark.precommit
+@pytest.mark.parametrize("model_id", model_ids)
+def test_vlm_embeddings_lookup_in_model_doesnt_affect_generated_text(model_id):
+    models_path = get_ov_model(model_id)
+    images = [get_image_by_link(image_links[0])]
+    generation_config = GenerationConfig(max_new_tokens=20, ignore_eos=True)
+
+    ref_pipe = VLMPipeline(models_path, "CPU", ATTENTION_BACKEND="PA")
+    reference = ref_pipe.generate(prompts[0], images=images, generation_config=generation_config)
+
+    pipe = VLMPipeline(models_path, "CPU", ATTENTION_BACKEND="PA", embeddings_lookup_in_model=True)
+    generated = pipe.generate(prompts[0], images=images, generation_config=generation_config)
+    assert generated.texts == reference.texts
+
+
 
 
 @pytest.mark.precommit
@@ -410,6 +447,11 @@ def test_perf_metrics(cache, backend):
     assert perf_metrics is not None
 
     assert 0 < perf_metrics.get_load_time() < load_time
+    if backend == "SDPA":
+        # the language model and the inputs embedder are loaded concurrently
+        model_load_times = perf_metrics.get_model_load_times()
+        assert set(model_load_times) == {"language_model", "inputs_embedder"}
+        assert all(0 < model_load_time <= perf_metrics.get_load_time() for model_load_time in model_load_times.values())
     num_tokens = perf_metrics.get_num_generated_tokens()
     assert 0 < num_tokens <= max_new_tokens
     assert 0 < perf_metrics.get_num_input_tokens() < len(prompts[0]) + image_tokens_num
@@ -283,6 +283,24 @@ def test_smoke(model_descr, sample_from_dataset):
     )
 
 
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [{"language": "en", "sample_id": 0}], indirect=True)
+@pytest.mark.precommit
+def test_raw_speech_buffers(model_descr, sample_from_dataset):
+    _, _, _, genai_pipe = read_whisper_model(model_descr)
+    samples = np.asarray(sample_from_dataset, dtype=np.float32)
+    expected = genai_pipe.generate(list(map(float, samples))).texts[0]
+
+    assert genai_pipe.generate(samples).texts[0] == expected
+    assert genai_pipe.generate(samples.astype(np.float64)).texts[0] == expected
+    assert genai_pipe.generate(samples.tobytes()).texts[0] == expected
+    # a non contiguous view is copied by the strides
+    assert genai_pipe.generate(np.repeat(samples, 2)[::2]).texts[0] == expected
+
+    batched = genai_pipe.generate(np.stack([samples, samples]))
+    assert [result.texts[0] for result in batched] == [expected, expected]
+
+
 @pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
 @pytest.mark.precommit
 def test_whisper_config_constructor(model_descr):
@@ -567,6 +585,96 @@ def test_beam_search(model_descr, sample_from_dataset):
 
     compare_results(hf_result, genai_result)
 
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [*get_fixture_params_for_n_whisper_dataset_samples(n=1, long_form=True)], indirect=True)
+@pytest.mark.parametrize("config", [{"return_timestamps": False}, {"return_timestamps": True}, {"num_beams": 2}])
+@pytest.mark.precommit
+def test_batched_generate(model_descr, sample_from_dataset, config):
+    _, _, _, genai_pipe = read_whisper_model(model_descr)
+    # short-form and long-form inputs of different lengths are decoded together
+    samples = [sample_from_dataset[:10 * 16000], sample_from_dataset, sample_from_dataset[:25 * 16000]]
+    if config.get("num_beams"):
+        samples = [sample[:30 * 16000] for sample in samples]
+
+    batched_results = genai_pipe.generate(samples, **config)
+
+    assert len(batched_results) == len(samples)
+    for sample, batched_result in zip(samples, batched_results):
+        result = genai_pipe.generate(sample, **config)
+        assert batched_result.texts == result.texts
+        if config.get("return_timestamps"):
+            assert [(chunk.start_ts, chunk.end_ts, chunk.text) for chunk in batched_result.chunks] == [
+                (chunk.start_ts, chunk.end_ts, chunk.text) for chunk in result.chunks
+            ]
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [*get_fixture_params_for_n_whisper_dataset_samples(n=2, long_form=True)], indirect=True)
+@pytest.mark.precommit
+def test_chunked_longform_audio(model_descr, sample_from_dataset):
+    _, _, hf_pipe, genai_pipe = read_whisper_model(model_descr)
+
+    genai_result = genai_pipe.generate(sample_from_dataset, stride_length=5.0)
+
+    # the windows of the chunked pipeline of transformers are merged the same way
+    hf_result = hf_pipe(
+        sample_from_dataset,
+        chunk_length_s=30,
+        stride_length_s=5,
+        generate_kwargs={"language": "en"} | extra_generate_kwargs(),
+    )
+
+    assert genai_result.texts[0] == hf_result["text"]
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [{"language" : "en", "sample_id": 0}], indirect=True)
+@pytest.mark.precommit
+def test_vad_filter(model_descr, sample_from_dataset):
+    _, _, _, genai_pipe = read_whisper_model(model_descr)
+
+    silence = [0.0] * (20 * 16000)
+    padded_sample = silence + list(sample_from_dataset) + silence
+
+    result = genai_pipe.generate(sample_from_dataset, vad_filter=True, return_timestamps=True)
+    padded_result = genai_pipe.generate(padded_sample, vad_filter=True, return_timestamps=True)
+
+    # the silence is skipped and the timestamps are of the original audio
+    assert padded_result.texts == result.texts
+    assert len(padded_result.chunks) == len(result.chunks)
+    for chunk, padded_chunk in zip(result.chunks, padded_result.chunks):
+        assert padded_chunk.text == chunk.text
+        assert padded_chunk.start_ts == pytest.approx(chunk.start_ts + 20, abs=0.05)
+
+    assert genai_pipe.generate(silence, vad_filter=True).texts == [""]
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [{"language" : "en", "sample_id": 0}], indirect=True)
+@pytest.mark.precommit
+def test_streaming_transcription(model_descr, sample_from_dataset):
+    _, _, _, genai_pipe = read_whisper_model(model_descr)
+
+    # the whole audio pushed at once is the same as its transcription with timestamps
+    genai_pipe.start_stream()
+    update = genai_pipe.push_audio(sample_from_dataset)
+    assert update.stable_text == ""
+    final_update = genai_pipe.finish_stream()
+    assert final_update.partial_text == ""
+    assert final_update.stable_text == genai_pipe.generate(sample_from_dataset, return_timestamps=True).texts[0]
+
+    # the stable text is appended as the audio arrives
+    genai_pipe.start_stream()
+    stable_text = ""
+    for offset in range(0, len(sample_from_dataset), 16000):
+        update = genai_pipe.push_audio(sample_from_dataset[offset:offset + 16000])
+        stable_text += update.stable_text
+    final_update = genai_pipe.finish_stream()
+    stable_text += final_update.stable_text
+
+    assert final_update.partial_text == ""
+    assert stable_text.strip()
+
+    with pytest.raises(RuntimeError):
+        genai_pipe.push_audio(sample_from_dataset)
+
 @pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
 @pytest.mark.parametrize("sample_from_dataset", [{"language" : "en", "sample_id": 0}], indirect=True)
 @pytest.mark.precommit
@@ -810,3 +918,54 @@ def test_streamers(model_descr, sample_from_dataset, streamer_for_test):
 
     assert expected == result_handler.decode(genai_pipe.get_tokenizer())
     result_handler.reset()
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [{"language" : "en", "sample_id": 0}], indirect=True)
+@pytest.mark.parametrize("draft_stateful", [True, False])
+@pytest.mark.precommit
+def test_assisted_generation(model_descr, sample_from_dataset, draft_stateful):
+    _, path, _, genai_pipe = read_whisper_model(model_descr)
+    _, draft_path, _, _ = read_whisper_model(model_descr, stateful=draft_stateful)
+
+    assisted_pipe = ov_genai.WhisperPipeline(path, "CPU", draft_decoder_path=str(draft_path), ENABLE_MMAP=False)
+    assert assisted_pipe.get_generation_config().num_assistant_tokens > 0
+
+    # the candidates are validated by the decoder of the pipeline model, the transcription is the same
+    for config in [{"num_assistant_tokens": 3}, {"assistant_confidence_threshold": 0.4}]:
+        for return_timestamps in [False, True]:
+            expected = genai_pipe.generate(sample_from_dataset, return_timestamps=return_timestamps)
+            result = assisted_pipe.generate(sample_from_dataset, return_timestamps=return_timestamps, **config)
+            assert result.texts == expected.texts
+            if return_timestamps:
+                assert [(chunk.start_ts, chunk.end_ts, chunk.text) for chunk in result.chunks] == \
+                    [(chunk.start_ts, chunk.end_ts, chunk.text) for chunk in expected.chunks]
+
+    with pytest.raises(RuntimeError):
+        genai_pipe.generate(sample_from_dataset, num_assistant_tokens=3)
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [{"language" : "en", "sample_id": 0}], indirect=True)
+@pytest.mark.precommit
+def test_word_timestamps(model_descr, sample_from_dataset):
+    _, path, _, genai_pipe = read_whisper_model(model_descr)
+    pipe = ov_genai.WhisperPipeline(path, "CPU", word_timestamps=True, ENABLE_MMAP=False)
+    duration = len(sample_from_dataset) / 16000
+
+    for return_timestamps in [False, True]:
+        expected = genai_pipe.generate(sample_from_dataset, return_timestamps=return_timestamps)
+        result = pipe.generate(sample_from_dataset, return_timestamps=return_timestamps, word_timestamps=True)
+        assert result.texts == expected.texts
+
+        assert result.words
+        assert "".join(word.word for word in result.words).strip() == result.texts[0].strip()
+        previous_end = 0.0
+        for word in result.words:
+            assert previous_end <= word.start_ts + 1e-3
+            assert word.start_ts <= word.end_ts <= duration + 1e-3
+            previous_end = word.end_ts
+
+    assert pipe.generate(sample_from_dataset).words is None
+
+    with pytest.raises(RuntimeError):
+        genai_pipe.generate(sample_from_dataset, word_timestamps=True)
@@ -0,0 +1,162 @@
+# Copyright (C) 2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Usage:
+Run a continuous batching workload with OV_GENAI_CACHE_STATE_FILE environment variable set to the path of the snapshot
+file, the state of the KV cache is recorded to it at each generation step. The cache efficiency over the run is
+summarized by running:
+cache_snapshots.py --snapshot_file cache_state.bin [--csv per_step_stats.csv]
+
+The format of the file is described at CacheStateRecorder in src/cpp/src/continuous_batching/cache_state_recorder.hpp.
+"""
+
+import argparse
+import csv
+import pathlib
+import struct
+from dataclasses import dataclass, field
+from typing import Iterator
+
+MAGIC = b'OVCS'
+SUPPORTED_VERSION = 1
+
+
+@dataclass
+class CacheSnapshot:
+    step: int = 0
+    time_us: int = 0
+    num_dropped_before: int = 0
+    block_size: int = 0
+    num_blocks: int = 0
+    num_free_blocks: int = 0
+    num_cached_free_blocks: int = 0
+    num_hashed_occupied_blocks: int = 0
+    # request id -> sequence id -> physical block indices of the first layer
+    sequence_groups: dict[int, dict[int, list[int]]] = field(default_factory=dict)
+    # block index -> (reference count, is hashed)
+    occupied_blocks: dict[int, tuple[int, bool]] = field(default_factory=dict)
+    # sequence id -> logical block indices evicted at the step
+    evicted_blocks: dict[int, list[int]] = field(default_factory=dict)
+
+    def get_sharing_degree(self) -> float:
+        """Mean number of the sequences referencing an occupied block."""
+        if not self.occupied_blocks:
+            return 0.0
+        return sum(ref_count for ref_count, _ in self.occupied_blocks.values()) / len(self.occupied_blocks)
+
+    def get_num_shared_blocks(self) -> int:
+        return sum(1 for ref_count, _ in self.occupied_blocks.values() if ref_count > 1)
+
+    def get_num_evicted_blocks(self) -> int:
+        return sum(len(blocks) for blocks in self.evicted_blocks.values())
+
+
+class _Reader:
+    def __init__(self, data: bytes):
+        self.data = data
+        self.offset = 0
+
+    def read(self, fmt: str):
+        values = struct.unpack_from('=' + fmt, self.data, self.offset)
+        self.offset += struct.calcsize('=' + fmt)
+        return values[0] if len(values) == 1 else values
+
+    def read_array(self, count: int) -> list[int]:
+        values = struct.unpack_from(f'={count}I', self.data, self.offset)
+        self.offset += 4 * count
+        return list(values)
+
+
+def _parse_snapshot(data: bytes) -> CacheSnapshot:
+    reader = _Reader(data)
+    snapshot = CacheSnapshot()
+    (snapshot.step, snapshot.time_us, snapshot.num_dropped_before, snapshot.block_size, snapshot.num_blocks,
+     snapshot.num_free_blocks, snapshot.num_cached_free_blocks, snapshot.num_hashed_occupied_blocks) = reader.read('QqIIIIII')
+    for _ in range(reader.read('I')):
+        request_id, num_sequences = reader.read('QI')
+        sequences = snapshot.sequence_groups.setdefault(request_id, {})
+        for _ in range(num_sequences):
+            seq_id, num_blocks = reader.read('QI')
+            sequences[seq_id] = reader.read_array(num_blocks)
+    for _ in range(reader.read('I')):
+        block_idx, ref_count, is_hashed = reader.read('IIB')
+        snapshot.occupied_blocks[block_idx] = (ref_count, bool(is_hashed))
+    for _ in range(reader.read('I')):
+        seq_id, num_blocks = reader.read('QI')
+        snapshot.evicted_blocks[seq_id] = reader.read_array(num_blocks)
+    return snapshot
+
+
+def load_snapshots(snapshot_file: pathlib.Path) -> Iterator[CacheSnapshot]:
+    """Yields the snapshots of the file one by one, so that the files of long runs aren't loaded into memory at once."""
+    with open(snapshot_file, 'rb') as f:
+        magic = f.read(len(MAGIC))
+        if magic != MAGIC:
+            raise ValueError(f'{snapshot_file} is not a cache state snapshot file')
+        version, = struct.unpack('=I', f.read(4))
+        if version != SUPPORTED_VERSION:
+            raise ValueError(f'Unsupported snapshot format version {version}, expected {SUPPORTED_VERSION}')
+        while True:
+            size_bytes = f.read(4)
+            if len(size_bytes) < 4:
+                # the last snapshot may be incomplete, if the process was killed while writing it
+                return
+            size, = struct.unpack('=I', size_bytes)
+            data = f.read(size)
+            if len(data) < size:
+                return
+            yield _parse_snapshot(data)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--snapshot_file", help="File recorded with OV_GENAI_CACHE_STATE_FILE", required=True)
+    parser.add_argument("--csv", help="Path to write the per step statistics to", required=False, default=None)
+    args = parser.parse_args()
+
+    columns = ['step', 'time_us', 'num_blocks', 'used_blocks', 'cached_free_blocks', 'hashed_occupied_blocks',
+               'shared_blocks', 'sharing_degree', 'evicted_blocks', 'dropped_before']
+    csv_file = open(args.csv, 'w', newline='') if args.csv else None
+    writer = csv.writer(csv_file) if csv_file else None
+    if writer:
+        writer.writerow(columns)
+
+    num_snapshots = num_dropped = num_evicted = 0
+    sum_usage = sum_sharing_degree = sum_hashed_ratio = sum_cached_ratio = 0.0
+    peak_usage = 0.0
+    try:
+        for snapshot in load_snapshots(pathlib.Path(args.snapshot_file)):
+            used_blocks = snapshot.num_blocks - snapshot.num_free_blocks
+            usage = used_blocks / snapshot.num_blocks if snapshot.num_blocks else 0.0
+            num_snapshots += 1
+            num_dropped += snapshot.num_dropped_before
+            num_evicted += snapshot.get_num_evicted_blocks()
+            sum_usage += usage
+            peak_usage = max(peak_usage, usage)
+            sum_sharing_degree += snapshot.get_sharing_degree()
+            sum_hashed_ratio += snapshot.num_hashed_occupied_blocks / used_blocks if used_blocks else 0.0
+            sum_cached_ratio += snapshot.num_cached_free_blocks / snapshot.num_free_blocks if snapshot.num_free_blocks else 0.0
+            if writer:
+                writer.writerow([snapshot.step, snapshot.time_us, snapshot.num_blocks, used_blocks,
+                                 snapshot.num_cached_free_blocks, snapshot.num_hashed_occupied_blocks,
+                                 snapshot.get_num_shared_blocks(), f'{snapshot.get_sharing_degree():.3f}',
+                                 snapshot.get_num_evicted_blocks(), snapshot.num_dropped_before])
+    finally:
+        if csv_file:
+            csv_file.close()
+
+    if num_snapshots == 0:
+        print("No snapshots found")
+        exit(-1)
+
+    print(f"Snapshots: {num_snapshots}, dropped by the recorder: {num_dropped}")
+    print(f"Cache usage: mean {sum_usage / num_snapshots * 100:.2f}%, peak {peak_usage * 100:.2f}%")
+    print(f"Mean sharing degree of the occupied blocks: {sum_sharing_degree / num_snapshots:.3f}")
+    print(f"Mean share of the occupied blocks registered in the prefix cache: {sum_hashed_ratio / num_snapshots * 100:.2f}%")
+    print(f"Mean share of the free blocks kept in the prefix cache: {sum_cached_ratio / num_snapshots * 100:.2f}%")
+    print(f"Evicted blocks: {num_evicted}")
+
+
+if __name__ == "__main__":
+    main()
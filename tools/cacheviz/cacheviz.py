@@ -10,6 +10,8 @@ cacheviz.py --dump_folder ./debug/cache_dump/0
 
 Use "A" and "D" (or "left arrow" and "right arrow") keys to move to the previous or next steps correspondingly,
 with "Alt" modifier to move 10 steps at a time, and "Shift" modifier to move 100 steps at a time.
+
+For long runs, record the binary snapshots with OV_GENAI_CACHE_STATE_FILE instead and summarize them by cache_snapshots.py.
 """
 
 import argparse
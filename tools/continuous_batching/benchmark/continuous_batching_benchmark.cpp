@@ -1,9 +1,14 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <cstdlib>
 #include <chrono>
+#include <map>
+#include <numeric>
+#include <optional>
 #include <ostream>
 #include <random>
 #include <stdexcept>
@@ -18,6 +23,7 @@
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/lora_adapter.hpp"
 
 namespace {
 
@@ -34,24 +40,46 @@ public:
     }
 };
 
+// timings of a request of a trace, the requests of a dataset get the Poisson arrivals and the default SLOs
+struct RequestTiming {
+    // since the start of the benchmark
+    float arrival_time_ms = 0.0f;
+    // the request is cancelled this long after its arrival, if non-negative
+    float cancel_after_ms = -1.0f;
+    // objectives of the request, 0 means no objective
+    float ttft_slo_ms = 0.0f;
+    float tpot_slo_ms = 0.0f;
+};
+
 struct Dataset {
     std::vector<std::string> m_prompts;
+    // the prompts of the trace requests given by their lengths are token ids, otherwise the tensors are empty
+    std::vector<ov::Tensor> m_input_ids;
     std::vector<ov::genai::GenerationConfig> m_sampling_params;
+    std::vector<RequestTiming> m_timings;
     std::vector<size_t> m_input_lens, m_output_lens;
+    // whether the requests arrive at their arrival times rather than by the Poisson process
+    bool m_has_arrival_times = false;
+    // the LoRA adapters of the requests, which are registered in the pipeline
+    std::vector<ov::genai::Adapter> m_adapters;
 
     size_t m_total_input_len = 0;
     size_t m_total_output_len = 0;
 
     void reserve(const size_t size) {
         m_prompts.reserve(size);
+        m_input_ids.reserve(size);
         m_sampling_params.reserve(size);
+        m_timings.reserve(size);
         m_input_lens.reserve(size);
         m_output_lens.reserve(size);
     }
 
-    void push_data(std::string prompt, ov::genai::GenerationConfig sampling_params) {
+    void push_data(std::string prompt, ov::genai::GenerationConfig sampling_params, ov::Tensor input_ids = {}, RequestTiming timing = {}) {
         m_prompts.push_back(prompt);
+        m_input_ids.push_back(input_ids);
         m_sampling_params.push_back(sampling_params);
+        m_timings.push_back(timing);
     }
 
     void push_lens(size_t input_len, size_t output_len) {
@@ -139,6 +167,119 @@ Dataset filtered_dataset(const std::string& models_path, const std::string& data
     return sampled_dataset;
 }
 
+// Synthetic prompt of the given length, the requests with the same non-zero prefix_id share the first prefix_len tokens.
+// The token ids are deterministic and are below the vocabulary size of any model.
+ov::Tensor synthetic_input_ids(size_t prompt_len, size_t prefix_id, size_t prefix_len, size_t request_id) {
+    constexpr int64_t min_token_id = 100, max_token_id = 10000;
+    ov::Tensor input_ids(ov::element::i64, {1, prompt_len});
+    int64_t* data = input_ids.data<int64_t>();
+    prefix_len = prefix_id != 0 ? std::min(prefix_len, prompt_len) : 0;
+    std::mt19937_64 prefix_generator(prefix_id), generator(request_id + 1);
+    std::uniform_int_distribution<int64_t> distribution(min_token_id, max_token_id - 1);
+    for (size_t i = 0; i < prompt_len; ++i) {
+        data[i] = distribution(i < prefix_len ? prefix_generator : generator);
+    }
+    return input_ids;
+}
+
+/**
+ * Reads a trace with a request per line, e.g.
+ * {"arrival_time_ms": 150, "prompt": "What is OpenVINO?", "max_new_tokens": 64, "ttft_slo_ms": 500}
+ * {"arrival_time_ms": 210, "prompt_len": 2048, "prefix_id": 1, "prefix_len": 1536, "adapter": "lora.safetensors", "cancel_after_ms": 3000}
+ * The prompt is either a text or a synthetic one given by its length. The sampling is greedy with ignore_eos unless
+ * set: do_sample, temperature, top_p, top_k, num_return_sequences, repetition_penalty, ignore_eos; multinomial
+ * sampling is seeded by rng_seed, which defaults to the index of the request, so that the replays are deterministic.
+ * The scheduling fields are priority, tenant_id and ttft_slo_ms, which is also the TTFT objective of the request
+ * along with tpot_slo_ms.
+ */
+Dataset read_trace(const std::string& models_path, const std::string& trace_path) {
+    std::ifstream trace_file(trace_path);
+    OPENVINO_ASSERT(trace_file.is_open(), "Cannot open trace file ", trace_path);
+
+    Dataset dataset;
+    dataset.m_has_arrival_times = true;
+    std::optional<ov::genai::Tokenizer> tokenizer;
+    std::map<std::string, ov::genai::Adapter> adapters;
+
+    for (std::string line; std::getline(trace_file, line);) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+        const nlohmann::json json_request = nlohmann::json::parse(line);
+        const size_t request_id = dataset.size();
+
+        ov::genai::GenerationConfig sampling_params = ov::genai::greedy();
+        sampling_params.max_new_tokens = json_request.value("max_new_tokens", size_t{128});
+        sampling_params.ignore_eos = json_request.value("ignore_eos", true);
+        sampling_params.do_sample = json_request.value("do_sample", false);
+        sampling_params.temperature = json_request.value("temperature", sampling_params.temperature);
+        sampling_params.top_p = json_request.value("top_p", sampling_params.top_p);
+        sampling_params.top_k = json_request.value("top_k", sampling_params.top_k);
+        sampling_params.num_return_sequences = json_request.value("num_return_sequences", sampling_params.num_return_sequences);
+        sampling_params.repetition_penalty = json_request.value("repetition_penalty", sampling_params.repetition_penalty);
+        sampling_params.rng_seed = json_request.value("rng_seed", request_id);
+        sampling_params.priority = json_request.value("priority", sampling_params.priority);
+        sampling_params.tenant_id = json_request.value("tenant_id", sampling_params.tenant_id);
+        sampling_params.ttft_slo_ms = json_request.value("ttft_slo_ms", sampling_params.ttft_slo_ms);
+        if (json_request.contains("adapter")) {
+            const std::string adapter_path = json_request["adapter"].get<std::string>();
+            auto adapter = adapters.find(adapter_path);
+            if (adapter == adapters.end())
+                adapter = adapters.emplace(adapter_path, ov::genai::Adapter(adapter_path)).first;
+            sampling_params.adapters = ov::genai::AdapterConfig(adapter->second, json_request.value("adapter_alpha", 1.0f));
+        }
+
+        RequestTiming timing;
+        timing.arrival_time_ms = json_request.value("arrival_time_ms", 0.0f);
+        timing.cancel_after_ms = json_request.value("cancel_after_ms", -1.0f);
+        timing.ttft_slo_ms = static_cast<float>(sampling_params.ttft_slo_ms);
+        timing.tpot_slo_ms = json_request.value("tpot_slo_ms", 0.0f);
+
+        if (json_request.contains("prompt")) {
+            const std::string prompt = json_request["prompt"].get<std::string>();
+            if (!tokenizer)
+                tokenizer.emplace(models_path);
+            const size_t input_len = tokenizer->encode(prompt).input_ids.get_size();
+            dataset.push_data(prompt, sampling_params, {}, timing);
+            dataset.push_lens(input_len, sampling_params.max_new_tokens);
+        } else {
+            const size_t prompt_len = json_request.at("prompt_len").get<size_t>();
+            ov::Tensor input_ids = synthetic_input_ids(prompt_len, json_request.value("prefix_id", size_t{0}),
+                                                       json_request.value("prefix_len", size_t{0}), request_id);
+            dataset.push_data("", sampling_params, input_ids, timing);
+            dataset.push_lens(prompt_len, sampling_params.max_new_tokens);
+        }
+    }
+    OPENVINO_ASSERT(!dataset.empty(), "Trace file ", trace_path, " has no requests");
+
+    for (const auto& [adapter_path, adapter] : adapters)
+        dataset.m_adapters.push_back(adapter);
+    return dataset;
+}
+
+double get_percentile(std::vector<double> values, double percent) {
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    const size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * values.size()));
+    return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+}
+
+const char* get_status_name(ov::genai::GenerationStatus status) {
+    switch (status) {
+    case ov::genai::GenerationStatus::RUNNING:
+        return "running";
+    case ov::genai::GenerationStatus::FINISHED:
+        return "finished";
+    case ov::genai::GenerationStatus::IGNORED:
+        return "ignored";
+    case ov::genai::GenerationStatus::CANCEL:
+        return "cancelled";
+    case ov::genai::GenerationStatus::STOP:
+        return "stopped";
+    }
+    return "unknown";
+}
+
 class GenerationInfo {
 
     struct SequenceInfo {
@@ -154,10 +295,11 @@ class GenerationInfo {
             num_output_tokens = 0;
             ttft = std::chrono::milliseconds::zero();
             cumulated_tpot = std::chrono::milliseconds::zero();
+            mean_tpot = std::chrono::milliseconds::zero();
             this->start_time = start_time;
         }
 
-        void update() {
+        void update(size_t num_new_tokens) {
             std::chrono::steady_clock::time_point new_read_time = std::chrono::steady_clock::now();
             if (last_read_time.time_since_epoch() == std::chrono::milliseconds::zero()) {
                 ttft = std::chrono::duration_cast<std::chrono::milliseconds>(new_read_time - start_time);
@@ -166,40 +308,67 @@ class GenerationInfo {
                 mean_tpot = cumulated_tpot / num_output_tokens;
 
             }
-            num_output_tokens++;
+            // e.g. speculative decoding may read several tokens at once
+            num_output_tokens += std::max<size_t>(num_new_tokens, 1);
             last_read_time = new_read_time;
         }
     };
 
+public:
     struct GenerationMetrics {
+        size_t request_id = 0;
+        ov::genai::GenerationStatus status = ov::genai::GenerationStatus::RUNNING;
+        RequestTiming timing;
+        // since the start of the benchmark
+        std::chrono::milliseconds arrival_time = std::chrono::milliseconds::zero();
         std::chrono::milliseconds mean_ttft = std::chrono::milliseconds::zero();
         std::chrono::milliseconds mean_tpot = std::chrono::milliseconds::zero();
+        // till the last read of the outputs
+        std::chrono::milliseconds e2e_latency = std::chrono::milliseconds::zero();
         size_t num_output_tokens = 0;
-        size_t num_input_tokens;
+        size_t num_input_tokens = 0;
+
+        // the cancelled requests and the requests without objectives are not rated
+        bool has_slo() const {
+            return status != ov::genai::GenerationStatus::CANCEL && (timing.ttft_slo_ms > 0 || timing.tpot_slo_ms > 0);
+        }
+
+        bool is_slo_met() const {
+            return status == ov::genai::GenerationStatus::FINISHED &&
+                   (timing.ttft_slo_ms <= 0 || mean_ttft.count() <= timing.ttft_slo_ms) &&
+                   (timing.tpot_slo_ms <= 0 || mean_tpot.count() <= timing.tpot_slo_ms);
+        }
     };
 
+private:
     ov::genai::GenerationHandle generation_handle;
     std::chrono::steady_clock::time_point start_time;
     std::unordered_map<int64_t, SequenceInfo> sequences_info;
     bool active = true;
     size_t input_len;
+    size_t request_id;
+    RequestTiming timing;
+    std::chrono::milliseconds arrival_time;
 
 public:
-    GenerationInfo(ov::genai::GenerationHandle generation_handle, size_t input_len) : input_len(input_len)
+    GenerationInfo(ov::genai::GenerationHandle generation_handle, size_t input_len, size_t request_id, RequestTiming timing,
+                   std::chrono::steady_clock::time_point benchmark_start_time)
+        : input_len(input_len), request_id(request_id), timing(timing)
     {
         this->generation_handle = std::move(generation_handle);
         start_time = std::chrono::steady_clock::now();
+        arrival_time = std::chrono::duration_cast<std::chrono::milliseconds>(start_time - benchmark_start_time);
     }
 
-    void update_sequence(int64_t sequence_id) {
+    void update_sequence(int64_t sequence_id, size_t num_new_tokens) {
         if (sequences_info.find(sequence_id) == sequences_info.end())
             sequences_info.emplace(sequence_id, SequenceInfo(start_time));
-        sequences_info.at(sequence_id).update();
+        sequences_info.at(sequence_id).update(num_new_tokens);
     }
 
     void update(ov::genai::GenerationOutputs& outputs){
         for (auto const& output: outputs) {
-            update_sequence(output.first);
+            update_sequence(output.first, output.second.generated_ids.size());
         }
     }
 
@@ -211,8 +380,16 @@ public:
         return generation_handle->can_read();
     }
 
+    // finished, cancelled, stopped or ignored because of out of memory
     bool is_finished() {
-        return generation_handle->get_status() == ov::genai::GenerationStatus::FINISHED;
+        return generation_handle->get_status() != ov::genai::GenerationStatus::RUNNING;
+    }
+
+    // cancels the request if its time has come
+    void cancel_if_due() {
+        if (timing.cancel_after_ms >= 0 &&
+            std::chrono::steady_clock::now() - start_time >= std::chrono::duration<float, std::milli>(timing.cancel_after_ms))
+            generation_handle->cancel();
     }
 
     void set_inactive() {
@@ -225,15 +402,21 @@ public:
 
     GenerationMetrics get_metrics() {
         GenerationMetrics generation_metrics;
+        generation_metrics.request_id = request_id;
+        generation_metrics.status = generation_handle->get_status();
+        generation_metrics.timing = timing;
+        generation_metrics.arrival_time = arrival_time;
+        generation_metrics.num_input_tokens = input_len;
         if (!sequences_info.empty()) {
             for (auto& sequenceInfoPair : sequences_info) {
                 generation_metrics.mean_ttft += sequenceInfoPair.second.ttft;
                 generation_metrics.mean_tpot += sequenceInfoPair.second.mean_tpot;
                 generation_metrics.num_output_tokens += sequenceInfoPair.second.num_output_tokens;
+                generation_metrics.e2e_latency = std::max(generation_metrics.e2e_latency,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(sequenceInfoPair.second.last_read_time - start_time));
             }
             generation_metrics.mean_ttft /= sequences_info.size();
             generation_metrics.mean_tpot /= sequences_info.size();
-            generation_metrics.num_input_tokens = input_len;
         }
         return generation_metrics;
     }
@@ -259,9 +442,13 @@ public:
             // to enable dynamic speculative decoding
             // sampling_params.assistant_confidence_threshold = 0.4f;
         }
-        ov::genai::GenerationHandle generation_handle = pipe->add_request(request_id, dataset->m_prompts[request_id], sampling_params);
+        const ov::Tensor& input_ids = dataset->m_input_ids[request_id];
+        ov::genai::GenerationHandle generation_handle = input_ids
+            ? pipe->add_request(request_id, input_ids, sampling_params)
+            : pipe->add_request(request_id, dataset->m_prompts[request_id], sampling_params);
         std::lock_guard<std::mutex> lock(mutex);
-        generations_info.emplace_back(std::move(generation_handle), dataset->m_input_lens[request_id]);
+        generations_info.emplace_back(std::move(generation_handle), dataset->m_input_lens[request_id], request_id,
+                                      dataset->m_timings[request_id], start_time);
     }
 
     size_t run() {
@@ -273,45 +460,94 @@ public:
             if (generation_info.is_finished()) {
                 num_finished++;
                 generation_info.set_inactive();
-            } else if (generation_info.can_read()) {
-                auto outputs = generation_info.read();
-                generation_info.update(outputs);
+            } else {
+                generation_info.cancel_if_due();
+                if (generation_info.can_read()) {
+                    auto outputs = generation_info.read();
+                    generation_info.update(outputs);
+                }
             }
         }
         return num_finished;
     }
 
-    void print_statistics() {
-        std::chrono::seconds total_duration = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start_time);
-        std::chrono::milliseconds mean_ttft = std::chrono::milliseconds::zero();
-        std::chrono::milliseconds mean_tpot = std::chrono::milliseconds::zero();
+    // prints the statistics and returns them along with the per request timings
+    nlohmann::json print_statistics() {
+        const double total_duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        std::vector<double> ttfts, tpots, e2e_latencies;
         size_t total_input_len = 0;
         size_t total_output_len = 0;
-        
+        size_t num_rated = 0, num_slo_met = 0;
+        std::map<std::string, size_t> num_requests_by_status;
+        nlohmann::json json_requests = nlohmann::json::array();
     
         for (GenerationInfo& generation_info : generations_info){
             auto generation_metrics = generation_info.get_metrics();
-            mean_ttft += generation_metrics.mean_ttft;
-            mean_tpot += generation_metrics.mean_tpot;
+            if (generation_metrics.num_output_tokens > 0) {
+                ttfts.push_back(generation_metrics.mean_ttft.count());
+                tpots.push_back(generation_metrics.mean_tpot.count());
+                e2e_latencies.push_back(generation_metrics.e2e_latency.count());
+            }
             total_input_len += generation_metrics.num_input_tokens;
             total_output_len += generation_metrics.num_output_tokens;
+            if (generation_metrics.has_slo()) {
+                ++num_rated;
+                num_slo_met += generation_metrics.is_slo_met();
+            }
+            const char* status = get_status_name(generation_metrics.status);
+            ++num_requests_by_status[status];
+
+            nlohmann::json json_request = {
+                {"request_id", generation_metrics.request_id},
+                {"status", status},
+                {"arrival_time_ms", generation_metrics.arrival_time.count()},
+                {"num_input_tokens", generation_metrics.num_input_tokens},
+                {"num_output_tokens", generation_metrics.num_output_tokens},
+                {"ttft_ms", generation_metrics.mean_ttft.count()},
+                {"tpot_ms", generation_metrics.mean_tpot.count()},
+                {"e2e_latency_ms", generation_metrics.e2e_latency.count()}};
+            if (generation_metrics.has_slo())
+                json_request["slo_met"] = generation_metrics.is_slo_met();
+            json_requests.push_back(json_request);
         }
-        mean_ttft /= generations_info.size();
-        mean_tpot /= generations_info.size();
-        std::cout << "Benchmark duration: " << total_duration.count() << " s" << std::endl;
+        const double mean_ttft = ttfts.empty() ? 0.0 : std::accumulate(ttfts.begin(), ttfts.end(), 0.0) / ttfts.size();
+        const double mean_tpot = tpots.empty() ? 0.0 : std::accumulate(tpots.begin(), tpots.end(), 0.0) / tpots.size();
+        std::cout << "Benchmark duration: " << total_duration << " s" << std::endl;
         std::cout << "Total number of input tokens: " << total_input_len << std::endl;
         std::cout << "Total number of output tokens: " << total_output_len << std::endl;
-        std::cout << "Input throughput: " << total_input_len / total_duration.count() << " tokens / s" << std::endl;
-        std::cout << "Output throughput: " << total_output_len / total_duration.count() << " tokens / s" << std::endl;
-        std::cout << "Mean TTFT: " << mean_ttft.count() << " ms" << std::endl;
-        std::cout << "Mean TPOT: " << mean_tpot.count() << " ms" << std::endl; 
+        std::cout << "Input throughput: " << total_input_len / total_duration << " tokens / s" << std::endl;
+        std::cout << "Output throughput: " << total_output_len / total_duration << " tokens / s" << std::endl;
+        std::cout << "Mean TTFT: " << mean_ttft << " ms" << std::endl;
+        std::cout << "Mean TPOT: " << mean_tpot << " ms" << std::endl;
+        std::cout << "TTFT p50 / p90 / p99: " << get_percentile(ttfts, 50) << " / " << get_percentile(ttfts, 90) << " / " << get_percentile(ttfts, 99) << " ms" << std::endl;
+        std::cout << "TPOT p50 / p90 / p99: " << get_percentile(tpots, 50) << " / " << get_percentile(tpots, 90) << " / " << get_percentile(tpots, 99) << " ms" << std::endl;
+        for (const auto& [status, num_requests] : num_requests_by_status)
+            std::cout << "Requests " << status << ": " << num_requests << std::endl;
+        if (num_rated > 0)
+            std::cout << "SLO attainment: " << 100.0 * num_slo_met / num_rated << " % of " << num_rated << " requests" << std::endl;
+
+        nlohmann::json json_statistics = {
+            {"duration_s", total_duration},
+            {"num_input_tokens", total_input_len},
+            {"num_output_tokens", total_output_len},
+            {"output_throughput", total_output_len / total_duration},
+            {"mean_ttft_ms", mean_ttft},
+            {"mean_tpot_ms", mean_tpot},
+            {"ttft_ms", {{"p50", get_percentile(ttfts, 50)}, {"p90", get_percentile(ttfts, 90)}, {"p99", get_percentile(ttfts, 99)}}},
+            {"tpot_ms", {{"p50", get_percentile(tpots, 50)}, {"p90", get_percentile(tpots, 90)}, {"p99", get_percentile(tpots, 99)}}},
+            {"e2e_latency_ms", {{"p50", get_percentile(e2e_latencies, 50)}, {"p90", get_percentile(e2e_latencies, 90)}, {"p99", get_percentile(e2e_latencies, 99)}}},
+            {"num_requests_by_status", num_requests_by_status},
+            {"requests", json_requests}};
+        if (num_rated > 0)
+            json_statistics["slo_attainment"] = static_cast<double>(num_slo_met) / num_rated;
+        return json_statistics;
     }
 };
 
-void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled) {
+void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, size_t seed, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled) {
     double numeric_request_rate;
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    // seeded, so that the arrivals are the same for each run
+    std::mt19937 gen(seed);
     std::exponential_distribution<> distribution;
 
     if (request_rate == "inf") {
@@ -331,12 +567,21 @@ void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* data
     std::cout << "Average output len: " << dataset->get_average_output_len() << " tokens" << std::endl;
     */
 
-    std::cout << "Launching traffic simulator thread with request_rate: " << request_rate << std::endl;
-    generation_info_collector->set_start_time(std::chrono::steady_clock::now());
+    if (dataset->m_has_arrival_times) {
+        std::cout << "Launching traffic simulator thread replaying the trace" << std::endl;
+    } else {
+        std::cout << "Launching traffic simulator thread with request_rate: " << request_rate << std::endl;
+    }
+    const auto start_time = std::chrono::steady_clock::now();
+    generation_info_collector->set_start_time(start_time);
     for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
+        if (dataset->m_has_arrival_times) {
+            std::this_thread::sleep_until(start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<float, std::milli>(dataset->m_timings[request_id].arrival_time_ms)));
+        }
         std::cout << "Traffic thread adding request to the queue..." << std::endl;
         generation_info_collector->add_generation(pipe, dataset, request_id, is_speculative_decoding_enabled);
-        if (numeric_request_rate > 0)
+        if (numeric_request_rate > 0 && !dataset->m_has_arrival_times)
             std::this_thread::sleep_for(std::chrono::milliseconds(int(distribution(gen) * 1000)));
     }
     std::cout << "All requests sent, traffic simulation finished. Exiting thread." << std::endl;
@@ -354,13 +599,13 @@ void llmEngineLoop(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset
     std::cout << "All requests processed, LLM Engine loop escaped. Exiting thread." << std::endl;
 }
 
-void statisticsReporter(GenerationInfoCollector* generations_info_collector, int num_prompts) {
+void statisticsReporter(GenerationInfoCollector* generations_info_collector, int num_prompts, nlohmann::json* statistics) {
     int num_finished = 0;
     while (num_finished < num_prompts) {
         num_finished = generations_info_collector->run();
     }
     std::cout << "Benchmark finished, summarizing statistics..." << std::endl;
-    generations_info_collector->print_statistics();
+    *statistics = generations_info_collector->print_statistics();
 
     std::cout << "Exiting statistics reporter thread." << std::endl;
 }
@@ -422,6 +667,51 @@ bool parse_plugin_config_string(const std::string& config_string, ov::AnyMap& de
     return parse_plugin_config_json(node, device_config_map);
 }
 
+// applies the values of a sweep point, e.g. {"max_num_batched_tokens": 512, "scheduling_policy": "deadline"}
+void apply_scheduler_config(const nlohmann::json& node, ov::genai::SchedulerConfig& scheduler_config) {
+    OPENVINO_ASSERT(node.is_object(), "A point of the sweep must be a JSON object, got ", node.dump());
+    for (const auto& element : node.items()) {
+        const std::string& key = element.key();
+        const nlohmann::json& value = element.value();
+        if (key == "max_num_batched_tokens") {
+            scheduler_config.max_num_batched_tokens = value.get<size_t>();
+        } else if (key == "num_kv_blocks") {
+            scheduler_config.num_kv_blocks = value.get<size_t>();
+        } else if (key == "cache_size") {
+            scheduler_config.cache_size = value.get<size_t>();
+        } else if (key == "kv_cache_memory_utilization") {
+            scheduler_config.kv_cache_memory_utilization = value.get<float>();
+        } else if (key == "max_num_seqs") {
+            scheduler_config.max_num_seqs = value.get<size_t>();
+        } else if (key == "dynamic_split_fuse") {
+            scheduler_config.dynamic_split_fuse = value.get<bool>();
+        } else if (key == "enable_prefix_caching") {
+            scheduler_config.enable_prefix_caching = value.get<bool>();
+        } else if (key == "max_num_prefill_tokens_per_step") {
+            scheduler_config.max_num_prefill_tokens_per_step = value.get<size_t>();
+        } else if (key == "max_prefill_fraction") {
+            scheduler_config.max_prefill_fraction = value.get<float>();
+        } else if (key == "scheduling_policy") {
+            const std::string policy = value.get<std::string>();
+            if (policy == "fcfs") {
+                scheduler_config.scheduling_policy = ov::genai::SchedulingPolicy::FCFS;
+            } else if (policy == "priority") {
+                scheduler_config.scheduling_policy = ov::genai::SchedulingPolicy::PRIORITY;
+            } else if (policy == "deadline") {
+                scheduler_config.scheduling_policy = ov::genai::SchedulingPolicy::DEADLINE;
+            } else if (policy == "fair_share") {
+                scheduler_config.scheduling_policy = ov::genai::SchedulingPolicy::FAIR_SHARE;
+            } else if (policy == "prefix_cache_aware") {
+                scheduler_config.scheduling_policy = ov::genai::SchedulingPolicy::PREFIX_CACHE_AWARE;
+            } else {
+                OPENVINO_THROW("Unknown scheduling policy ", policy);
+            }
+        } else {
+            OPENVINO_THROW("Unsupported scheduler config field in the sweep: ", key);
+        }
+    }
+}
+
 }  // namespace
 
 int main(int argc, char* argv[]) try {
@@ -442,9 +732,16 @@ int main(int argc, char* argv[]) try {
     ("max_output_len", "Max output length", cxxopts::value<size_t>()->default_value("2048"))
     ("request_rate", "Number of requests per second. If this is inf, then all the requests are sent at time 0. Otherwise, we use Poisson process to synthesize the request arrival times.", cxxopts::value<std::string>()->default_value("inf"))
     ("cache_size", "Size of memory used for KV cache in GB. Default: 16", cxxopts::value<size_t>()->default_value("16"))
+    ("kv_cache_memory_utilization", "Fraction of the device memory the pipeline may use, the KV cache is sized to the memory left after a profile run. Overrides cache_size when non-zero. Default: 0", cxxopts::value<float>()->default_value("0"))
     ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
     ("device_config", "Plugin configuration JSON. Example: '{\"MODEL_DISTRIBUTION_POLICY\":\"TENSOR_PARALLEL\",\"PERF_COUNT\":true}' Default: {\"PERF_COUNT\":true}", cxxopts::value<std::string>()->default_value("{\"PERF_COUNT\":true}"))
     ("use_cache_eviction", "Whether to use cache eviction", cxxopts::value<bool>()->default_value("false"))
+    ("trace", "Path to .jsonl request trace to replay instead of the dataset, a request per line with its arrival time, prompt or prompt length, sampling parameters, shared prefix id, LoRA adapter, cancellation time and SLOs", cxxopts::value<std::string>()->default_value(""))
+    ("seed", "Seed of the Poisson arrivals of the dataset requests", cxxopts::value<size_t>()->default_value("42"))
+    ("ttft_slo_ms", "TTFT objective of the requests, which don't set it. 0 means no objective", cxxopts::value<float>()->default_value("0"))
+    ("tpot_slo_ms", "TPOT objective of the requests, which don't set it. 0 means no objective", cxxopts::value<float>()->default_value("0"))
+    ("sweep", "JSON array of the scheduler config values to benchmark one after another. Example: '[{\"max_num_batched_tokens\":256},{\"max_num_batched_tokens\":512,\"enable_prefix_caching\":true}]'", cxxopts::value<std::string>()->default_value("[{}]"))
+    ("output_json", "Path to write the statistics and the per request timings as JSON", cxxopts::value<std::string>()->default_value(""))
     ("h,help", "Print usage");
 
     cxxopts::ParseResult result;
@@ -473,17 +770,33 @@ int main(int argc, char* argv[]) try {
     const std::string device = result["device"].as<std::string>();
     const std::string device_config = result["device_config"].as<std::string>();
     const size_t cache_size = result["cache_size"].as<size_t>();
+    const float kv_cache_memory_utilization = result["kv_cache_memory_utilization"].as<float>();
     const bool use_cache_eviction = result["use_cache_eviction"].as<bool>();
+    const std::string trace_path = result["trace"].as<std::string>();
+    const size_t seed = result["seed"].as<size_t>();
+    const float ttft_slo_ms = result["ttft_slo_ms"].as<float>();
+    const float tpot_slo_ms = result["tpot_slo_ms"].as<float>();
+    const nlohmann::json sweep = nlohmann::json::parse(result["sweep"].as<std::string>());
+    const std::string output_json_path = result["output_json"].as<std::string>();
+    OPENVINO_ASSERT(sweep.is_array() && !sweep.empty(), "sweep must be a non empty JSON array");
 
     bool is_speculative_decoding_enabled = !draft_model_path.empty();
 
     // Create requests for generation
-    Dataset dataset = filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len);
+    Dataset dataset = trace_path.empty() ? filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len)
+                                         : read_trace(models_path, trace_path);
+    for (RequestTiming& timing : dataset.m_timings) {
+        if (timing.ttft_slo_ms <= 0)
+            timing.ttft_slo_ms = ttft_slo_ms;
+        if (timing.tpot_slo_ms <= 0)
+            timing.tpot_slo_ms = tpot_slo_ms;
+    }
 
     // Perform the first inference
     ov::genai::SchedulerConfig scheduler_config;
     scheduler_config.max_num_batched_tokens = max_batch_size,
-    scheduler_config.cache_size = cache_size,
+    scheduler_config.cache_size = kv_cache_memory_utilization > 0.0f ? 0 : cache_size,
+    scheduler_config.kv_cache_memory_utilization = kv_cache_memory_utilization,
     scheduler_config.dynamic_split_fuse = dynamic_split_fuse,
     scheduler_config.max_num_seqs = 256; // not used if dynamic_split_fuse=True
     if (use_cache_eviction) {
@@ -491,16 +804,14 @@ int main(int argc, char* argv[]) try {
         scheduler_config.cache_eviction_config = ov::genai::CacheEvictionConfig(32, 32, 128, ov::genai::AggregationMode::NORM_SUM);
     }
 
-    std::cout << "Benchmarking parameters: " << std::endl;
-    std::cout << "\tMax number of batched tokens: " << scheduler_config.max_num_batched_tokens << std::endl;
-    std::cout << "\tScheduling type: " << (scheduler_config.dynamic_split_fuse ? "dynamic split-fuse" : "vLLM") << std::endl;
-    if (!scheduler_config.dynamic_split_fuse) {
-        std::cout << "\tMax number of batched sequences: " << scheduler_config.max_num_seqs << std::endl;
-    }
     std::cout << "Dataset parameters: " << std::endl;
-    std::cout << "\tNum prompts: " << num_prompts << std::endl;
-    std::cout << "\tMax input length: " << max_input_len << std::endl;
-    std::cout << "\tMax output length: " << max_output_len << std::endl;
+    if (trace_path.empty()) {
+        std::cout << "\tNum prompts: " << num_prompts << std::endl;
+        std::cout << "\tMax input length: " << max_input_len << std::endl;
+        std::cout << "\tMax output length: " << max_output_len << std::endl;
+    } else {
+        std::cout << "\tTrace: " << trace_path << ", " << dataset.size() << " requests" << std::endl;
+    }
     std::cout << "\tTarget device: " << device << std::endl;
     std::cout << "\tPlugin configuration JSON: " << device_config << std::endl;
 
@@ -508,34 +819,65 @@ int main(int argc, char* argv[]) try {
     if (is_speculative_decoding_enabled) {
         device_config_map.insert({ ov::genai::draft_model(draft_model_path) });
     }
+    if (!dataset.m_adapters.empty()) {
+        // all adapters of the trace are registered, each request selects its own
+        device_config_map.insert({ ov::genai::adapters(ov::genai::AdapterConfig(dataset.m_adapters)) });
+    }
     if (!parse_plugin_config_string(device_config, device_config_map)) {
         std::cout << "ERROR: Wrong json parameter in device_config." << std::endl;
         return EXIT_FAILURE;
     }
-    
-    // Benchmarking
-    std::cout << "Loading models, creating pipelines, preparing environment..." << std::endl;
-    ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device, device_config_map);
 
-    std::cout << "Setup finished, launching LLM executor, traffic simulation and statistics reporter threads" << std::endl;
+    nlohmann::json json_results = nlohmann::json::array();
+    for (const nlohmann::json& sweep_point : sweep) {
+        ov::genai::SchedulerConfig point_scheduler_config = scheduler_config;
+        apply_scheduler_config(sweep_point, point_scheduler_config);
 
-    GenerationInfoCollector generation_info_collector;
+        std::cout << "Benchmarking parameters: " << std::endl;
+        std::cout << "\tMax number of batched tokens: " << point_scheduler_config.max_num_batched_tokens << std::endl;
+        std::cout << "\tScheduling type: " << (point_scheduler_config.dynamic_split_fuse ? "dynamic split-fuse" : "vLLM") << std::endl;
+        if (!point_scheduler_config.dynamic_split_fuse) {
+            std::cout << "\tMax number of batched sequences: " << point_scheduler_config.max_num_seqs << std::endl;
+        }
+        if (!sweep_point.empty()) {
+            std::cout << "\tSweep point: " << sweep_point.dump() << std::endl;
+        }
 
-    std::atomic<bool> finishGenerationThread{false};
-    if (request_rate == "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
-        trafficSimulatorThread.join();
+        // Benchmarking
+        std::cout << "Loading models, creating pipelines, preparing environment..." << std::endl;
+        ov::genai::ContinuousBatchingPipeline pipe(models_path, point_scheduler_config, device, device_config_map);
+
+        std::cout << "Setup finished, launching LLM executor, traffic simulation and statistics reporter threads" << std::endl;
+
+        GenerationInfoCollector generation_info_collector;
+        nlohmann::json statistics;
+
+        // the requests of a trace arrive at their times, so the engine has to be running by then
+        const bool send_all_at_once = request_rate == "inf" && !dataset.m_has_arrival_times;
+        std::atomic<bool> finishGenerationThread{false};
+        if (send_all_at_once) {
+            std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, seed, &generation_info_collector, is_speculative_decoding_enabled);
+            trafficSimulatorThread.join();
+        }
+
+        std::thread lmmEngineThread(llmEngineLoop, &pipe, &dataset, &finishGenerationThread);
+        std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, dataset.size(), &statistics);
+        if (!send_all_at_once) {
+            std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, seed, &generation_info_collector, is_speculative_decoding_enabled);
+            trafficSimulatorThread.join();
+        }
+        statisticsReporterThread.join();
+        finishGenerationThread = true;
+        lmmEngineThread.join();
+
+        json_results.push_back({{"scheduler_config", sweep_point}, {"statistics", statistics}});
+    }
+
+    if (!output_json_path.empty()) {
+        std::ofstream output_json(output_json_path);
+        OPENVINO_ASSERT(output_json.is_open(), "Cannot open output file ", output_json_path);
+        output_json << json_results.dump(4) << std::endl;
     }
-    
-    std::thread lmmEngineThread(llmEngineLoop, &pipe, &dataset, &finishGenerationThread);
-    std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, num_prompts);
-    if (request_rate != "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
-        trafficSimulatorThread.join();
-    }
-    statisticsReporterThread.join();
-    finishGenerationThread = true;
-    lmmEngineThread.join();
 
     std::cout << "Benchmark finished" << std::endl;
 } catch (const std::exception& error) {
@@ -0,0 +1,314 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+#include <cxxopts.hpp>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/visual_language/pipeline.hpp"
+
+#include "load_image.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct VLMRequest {
+    std::string prompt;
+    std::vector<ov::Tensor> images;
+    ov::genai::GenerationConfig sampling_params;
+};
+
+/**
+ * The dataset is a JSON list of the requests: {"prompt": "...", "images": ["image.jpg", ...], "max_new_tokens": 128}.
+ * The image paths are relative to the dataset file, "images" and "max_new_tokens" are optional. The requests are sampled
+ * with repetition, the same image file is loaded once, so that its repetitions can hit the vision embedding cache.
+ */
+std::vector<VLMRequest> sample_dataset(const std::filesystem::path& dataset_path, size_t num_prompts, size_t max_output_len) {
+    std::ifstream json_file(dataset_path);
+    OPENVINO_ASSERT(json_file.is_open(), "Cannot open dataset file ", dataset_path);
+    nlohmann::json json_dataset = nlohmann::json::parse(json_file);
+    OPENVINO_ASSERT(json_dataset.is_array() && !json_dataset.empty(), "Dataset must be a non empty JSON list of the requests");
+
+    std::map<std::filesystem::path, ov::Tensor> loaded_images;
+    std::vector<VLMRequest> dataset;
+    for (const auto& json_request : json_dataset) {
+        VLMRequest request;
+        request.prompt = json_request.at("prompt").get<std::string>();
+        for (const auto& image_path : json_request.value("images", nlohmann::json::array())) {
+            const std::filesystem::path path = dataset_path.parent_path() / image_path.get<std::string>();
+            auto it = loaded_images.find(path);
+            if (it == loaded_images.end()) {
+                it = loaded_images.emplace(path, utils::load_image(path)).first;
+            }
+            request.images.push_back(it->second);
+        }
+        request.sampling_params = ov::genai::greedy();
+        request.sampling_params.max_new_tokens = std::min(json_request.value("max_new_tokens", max_output_len), max_output_len);
+        request.sampling_params.ignore_eos = true;
+        dataset.push_back(std::move(request));
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> distribution(0, dataset.size() - 1);
+    std::vector<VLMRequest> sampled_dataset;
+    sampled_dataset.reserve(num_prompts);
+    for (size_t request_id = 0; request_id < num_prompts; ++request_id) {
+        sampled_dataset.push_back(dataset[distribution(gen)]);
+    }
+    return sampled_dataset;
+}
+
+/**
+ * Time points of a request. add_request() of a prompt with images preprocesses and encodes the images and merges their
+ * embeddings with the text ones before returning, so these stages are measured together around it.
+ */
+struct RequestTimes {
+    Clock::time_point arrival;
+    Clock::time_point embeddings_start;
+    Clock::time_point embeddings_end;
+    std::optional<Clock::time_point> first_token;
+    Clock::time_point last_token;
+    size_t num_output_tokens = 0;
+};
+
+class RequestCollector {
+    struct Request {
+        ov::genai::GenerationHandle handle;
+        RequestTimes times;
+        bool active = true;
+    };
+
+    std::mutex m_mutex;
+    std::vector<Request> m_requests;
+    size_t m_num_finished = 0;
+
+public:
+    void add(ov::genai::GenerationHandle handle, const RequestTimes& times) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests.push_back({std::move(handle), times});
+    }
+
+    // reads the new tokens of the requests, returns the number of the finished ones
+    size_t run() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (Request& request : m_requests) {
+            if (!request.active) {
+                continue;
+            }
+            if (request.handle->can_read()) {
+                const Clock::time_point now = Clock::now();
+                for (const auto& [sequence_id, output] : request.handle->read()) {
+                    request.times.num_output_tokens += output.generated_ids.size();
+                }
+                if (!request.times.first_token) {
+                    request.times.first_token = now;
+                }
+                request.times.last_token = now;
+            } else if (request.handle->get_status() != ov::genai::GenerationStatus::RUNNING) {
+                request.active = false;
+                ++m_num_finished;
+            }
+        }
+        return m_num_finished;
+    }
+
+    std::vector<RequestTimes> get_times() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<RequestTimes> times;
+        for (const Request& request : m_requests) {
+            times.push_back(request.times);
+        }
+        return times;
+    }
+};
+
+double to_ms(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// nearest rank percentile of the sorted values
+double get_percentile(const std::vector<double>& sorted_values, double percentile) {
+    const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted_values.size()));
+    return sorted_values[std::clamp(rank, size_t(1), sorted_values.size()) - 1];
+}
+
+void print_stage(const std::string& name, std::vector<double> latencies) {
+    std::cout << std::left << std::setw(52) << name << std::right << std::fixed << std::setprecision(2);
+    if (latencies.empty()) {
+        std::cout << std::setw(10) << "-" << std::endl;
+        return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    double mean = 0.0;
+    for (double latency : latencies) {
+        mean += latency / latencies.size();
+    }
+    std::cout << std::setw(10) << mean << std::setw(10) << get_percentile(latencies, 50) << std::setw(10)
+              << get_percentile(latencies, 90) << std::setw(10) << get_percentile(latencies, 99) << std::endl;
+}
+
+void print_statistics(const std::vector<RequestTimes>& requests_times, Clock::time_point start_time, Clock::time_point end_time) {
+    std::vector<double> queue, embeddings, prefill, tpot, ttft, e2e;
+    size_t total_output_len = 0;
+    for (const RequestTimes& times : requests_times) {
+        queue.push_back(to_ms(times.embeddings_start - times.arrival));
+        embeddings.push_back(to_ms(times.embeddings_end - times.embeddings_start));
+        total_output_len += times.num_output_tokens;
+        if (!times.first_token) {
+            continue;
+        }
+        prefill.push_back(to_ms(*times.first_token - times.embeddings_end));
+        ttft.push_back(to_ms(*times.first_token - times.arrival));
+        e2e.push_back(to_ms(times.last_token - times.arrival));
+        if (times.num_output_tokens > 1) {
+            tpot.push_back(to_ms(times.last_token - *times.first_token) / (times.num_output_tokens - 1));
+        }
+    }
+
+    const double duration_s = to_ms(end_time - start_time) / 1000.0;
+    std::cout << "Benchmark duration: " << duration_s << " s" << std::endl;
+    std::cout << "Total number of output tokens: " << total_output_len << std::endl;
+    std::cout << "Request throughput: " << requests_times.size() / duration_s << " requests / s" << std::endl;
+    std::cout << "Output throughput: " << total_output_len / duration_s << " tokens / s" << std::endl;
+    std::cout << std::left << std::setw(52) << "Latency, ms" << std::right << std::setw(10) << "mean" << std::setw(10) << "p50"
+              << std::setw(10) << "p90" << std::setw(10) << "p99" << std::endl;
+    print_stage("Queue before add_request", queue);
+    print_stage("Embeddings (preprocess, vision encode, merge)", embeddings);
+    print_stage("Prefill (scheduling and first token)", prefill);
+    print_stage("Decode (time per output token)", tpot);
+    print_stage("Time to first token", ttft);
+    print_stage("End to end", e2e);
+}
+
+/**
+ * Adds the requests at their arrival times, all at once for "inf" request rate or by a Poisson process otherwise. The
+ * requests not added by their arrival times, e.g. while the previous images are encoded, wait in the queue.
+ */
+void traffic_simulator(ov::genai::ContinuousBatchingPipeline* pipe, std::vector<VLMRequest>* dataset, std::string request_rate, RequestCollector* collector) {
+    double numeric_request_rate = -1.0;
+    std::mt19937 gen(42);
+    std::exponential_distribution<> distribution;
+    if (request_rate != "inf") {
+        numeric_request_rate = std::stod(request_rate);
+        if (numeric_request_rate <= 0)
+            throw std::invalid_argument("request_rate must be a positive number or inf");
+        distribution = std::exponential_distribution<>(numeric_request_rate);
+    }
+
+    std::cout << "Launching traffic simulator thread with request_rate: " << request_rate << std::endl;
+    Clock::time_point arrival = Clock::now();
+    for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
+        std::this_thread::sleep_until(arrival);
+        const VLMRequest& request = dataset->at(request_id);
+        RequestTimes times;
+        times.arrival = arrival;
+        times.embeddings_start = Clock::now();
+        ov::genai::GenerationHandle handle = pipe->add_request(request_id, request.prompt, request.images, request.sampling_params);
+        times.embeddings_end = Clock::now();
+        collector->add(std::move(handle), times);
+        if (numeric_request_rate > 0) {
+            arrival += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(distribution(gen)));
+        }
+    }
+    std::cout << "All requests sent, traffic simulation finished. Exiting thread." << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("continuous_batching_vlm_benchmark", "Help command");
+
+    options.add_options()
+    ("n,num_prompts", "A number of prompts", cxxopts::value<size_t>()->default_value("100"))
+    ("b,max_batch_size", "A maximum number of batched tokens", cxxopts::value<size_t>()->default_value("2048"))
+    ("m,model", "Path to the VLM, processor and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("dataset", "Path to dataset .json file, a list of {\"prompt\": \"...\", \"images\": [\"image.jpg\"], \"max_new_tokens\": 128}", cxxopts::value<std::string>()->default_value("./vlm_dataset.json"))
+    ("max_output_len", "Max output length", cxxopts::value<size_t>()->default_value("128"))
+    ("request_rate", "Number of requests per second. If this is inf, then all the requests are sent at time 0. Otherwise, we use Poisson process to synthesize the request arrival times.", cxxopts::value<std::string>()->default_value("inf"))
+    ("cache_size", "Size of memory used for KV cache in GB. Default: 16", cxxopts::value<size_t>()->default_value("16"))
+    ("vision_embedding_cache_size", "Size of memory used for the embeddings of the repeated images in MB. Default: 0, disabled", cxxopts::value<size_t>()->default_value("0"))
+    ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const size_t num_prompts = result["num_prompts"].as<size_t>();
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string request_rate = result["request_rate"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+
+    std::vector<VLMRequest> dataset = sample_dataset(result["dataset"].as<std::string>(), num_prompts, result["max_output_len"].as<size_t>());
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = result["max_batch_size"].as<size_t>();
+    scheduler_config.cache_size = result["cache_size"].as<size_t>();
+    scheduler_config.dynamic_split_fuse = true;
+
+    ov::AnyMap properties;
+    if (const size_t vision_embedding_cache_size = result["vision_embedding_cache_size"].as<size_t>()) {
+        properties.insert(ov::genai::vision_embedding_cache_size(vision_embedding_cache_size * 1024 * 1024));
+    }
+
+    std::cout << "Benchmarking parameters: " << std::endl;
+    std::cout << "\tMax number of batched tokens: " << scheduler_config.max_num_batched_tokens << std::endl;
+    std::cout << "\tNum prompts: " << num_prompts << std::endl;
+    std::cout << "\tRequest rate: " << request_rate << std::endl;
+    std::cout << "\tTarget device: " << device << std::endl;
+
+    std::cout << "Loading models, creating pipelines, preparing environment..." << std::endl;
+    ov::genai::ContinuousBatchingPipeline pipe(models_path, scheduler_config, device, properties);
+    pipe.start_engine_loop();
+
+    RequestCollector collector;
+    const Clock::time_point start_time = Clock::now();
+    std::thread traffic_simulator_thread(traffic_simulator, &pipe, &dataset, request_rate, &collector);
+    while (collector.run() < num_prompts) {
+        std::this_thread::yield();
+    }
+    const Clock::time_point end_time = Clock::now();
+    traffic_simulator_thread.join();
+    pipe.stop_engine_loop();
+
+    std::cout << "Benchmark finished, summarizing statistics..." << std::endl;
+    print_statistics(collector.get_times(), start_time, end_time);
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,210 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+#include <cxxopts.hpp>
+
+#include "continuous_batching/scheduler_simulator.hpp"
+
+namespace {
+
+using ov::genai::SimulatedRequest;
+
+// one JSON object per line, e.g. {"arrival_time_ms": 12.5, "prompt_len": 512, "output_len": 128, "prefix_id": 1, "prefix_len": 256}
+std::vector<SimulatedRequest> read_trace(const std::string& trace_path) {
+    std::ifstream trace_file(trace_path);
+    OPENVINO_ASSERT(trace_file.is_open(), "Cannot open trace file ", trace_path);
+    std::vector<SimulatedRequest> trace;
+    for (std::string line; std::getline(trace_file, line);) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        const nlohmann::json json_request = nlohmann::json::parse(line);
+        SimulatedRequest request;
+        request.arrival_time_ms = json_request.value("arrival_time_ms", 0.0f);
+        request.prompt_len = json_request.at("prompt_len").get<size_t>();
+        request.output_len = json_request.at("output_len").get<size_t>();
+        request.prefix_id = json_request.value("prefix_id", size_t{0});
+        request.prefix_len = json_request.value("prefix_len", size_t{0});
+        request.priority = json_request.value("priority", int64_t{0});
+        request.ttft_slo_ms = json_request.value("ttft_slo_ms", size_t{0});
+        request.tenant_id = json_request.value("tenant_id", std::string{});
+        trace.push_back(request);
+    }
+    return trace;
+}
+
+// Poisson arrivals of the requests of the same lengths, all the requests arrive at once if request_rate is "inf"
+std::vector<SimulatedRequest> generate_trace(size_t num_requests, const std::string& request_rate, size_t prompt_len, size_t output_len, size_t seed) {
+    std::mt19937 generator(seed);
+    std::exponential_distribution<float> distribution;
+    if (request_rate != "inf") {
+        const float numeric_request_rate = std::stof(request_rate);
+        if (numeric_request_rate <= 0)
+            throw std::invalid_argument("request_rate must be a positive number");
+        distribution = std::exponential_distribution<float>(numeric_request_rate / 1000.0f);
+    }
+    std::vector<SimulatedRequest> trace(num_requests);
+    float arrival_time_ms = 0.0f;
+    for (SimulatedRequest& request : trace) {
+        request.arrival_time_ms = arrival_time_ms;
+        request.prompt_len = prompt_len;
+        request.output_len = output_len;
+        if (request_rate != "inf") {
+            arrival_time_ms += distribution(generator);
+        }
+    }
+    return trace;
+}
+
+ov::genai::SchedulingPolicy get_scheduling_policy(const std::string& scheduling_policy) {
+    if (scheduling_policy == "fcfs")
+        return ov::genai::SchedulingPolicy::FCFS;
+    if (scheduling_policy == "priority")
+        return ov::genai::SchedulingPolicy::PRIORITY;
+    if (scheduling_policy == "deadline")
+        return ov::genai::SchedulingPolicy::DEADLINE;
+    if (scheduling_policy == "fair_share")
+        return ov::genai::SchedulingPolicy::FAIR_SHARE;
+    if (scheduling_policy == "prefix_cache_aware")
+        return ov::genai::SchedulingPolicy::PREFIX_CACHE_AWARE;
+    throw std::invalid_argument("Unknown scheduling policy " + scheduling_policy);
+}
+
+nlohmann::json to_json(const ov::genai::HistogramSnapshot& histogram) {
+    return {{"count", histogram.count},
+            {"mean", histogram.get_mean()},
+            {"p50", histogram.get_percentile(50)},
+            {"p90", histogram.get_percentile(90)},
+            {"p99", histogram.get_percentile(99)},
+            {"max", histogram.max}};
+}
+
+void print_histogram(const std::string& name, const ov::genai::HistogramSnapshot& histogram) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(2)
+              << " mean " << std::setw(10) << histogram.get_mean()
+              << " p50 " << std::setw(10) << histogram.get_percentile(50)
+              << " p90 " << std::setw(10) << histogram.get_percentile(90)
+              << " p99 " << std::setw(10) << histogram.get_percentile(99)
+              << " max " << std::setw(10) << histogram.max << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("scheduler_simulator", "Replays a request trace through the continuous batching scheduler in the simulated time");
+
+    options.add_options()
+    ("trace", "Path to the .jsonl trace with a request per line: arrival_time_ms, prompt_len, output_len and optional prefix_id, prefix_len, priority, ttft_slo_ms, tenant_id. If not set, a trace is generated", cxxopts::value<std::string>()->default_value(""))
+    ("n,num_requests", "A number of the generated requests", cxxopts::value<size_t>()->default_value("1000"))
+    ("request_rate", "Number of the generated requests per second. If this is inf, then all the requests are sent at time 0. Otherwise, Poisson process is used to synthesize the request arrival times.", cxxopts::value<std::string>()->default_value("inf"))
+    ("prompt_len", "Prompt length of the generated requests", cxxopts::value<size_t>()->default_value("512"))
+    ("output_len", "Output length of the generated requests", cxxopts::value<size_t>()->default_value("128"))
+    ("seed", "Seed of the generated arrival times", cxxopts::value<size_t>()->default_value("42"))
+    ("b,max_num_batched_tokens", "A maximum number of batched tokens", cxxopts::value<size_t>()->default_value("256"))
+    ("max_num_seqs", "A maximum number of scheduled sequences", cxxopts::value<size_t>()->default_value("256"))
+    ("num_kv_blocks", "Number of KV cache blocks", cxxopts::value<size_t>()->default_value("0"))
+    ("cache_size", "Size of memory used for KV cache in GB, used if num_kv_blocks is 0", cxxopts::value<size_t>()->default_value("0"))
+    ("kv_cache_bytes_per_token", "Size of the KV cache of a token over all layers in bytes, e.g. 2 * num_layers * num_kv_heads * head_size * 2 for f16 cache", cxxopts::value<size_t>()->default_value("0"))
+    ("block_size", "Number of tokens in a KV cache block, 32 on CPU and 16 on GPU", cxxopts::value<size_t>()->default_value("32"))
+    ("dynamic_split_fuse", "Whether to use dynamic split-fuse or vLLM scheduling", cxxopts::value<bool>()->default_value("true"))
+    ("max_num_prefill_tokens_per_step", "Max number of prompt tokens scheduled at a step, 0 means no limit", cxxopts::value<size_t>()->default_value("0"))
+    ("enable_prefix_caching", "Whether to use prefix caching", cxxopts::value<bool>()->default_value("false"))
+    ("partial_preemption", "Whether to preempt the KV cache of a sequence partially", cxxopts::value<bool>()->default_value("true"))
+    ("scheduling_policy", "Scheduling policy: fcfs, priority, deadline, fair_share or prefix_cache_aware", cxxopts::value<std::string>()->default_value("fcfs"))
+    ("step_ms", "Cost model: latency of a step regardless of the batch in ms", cxxopts::value<float>()->default_value("20"))
+    ("per_token_ms", "Cost model: latency per scheduled token in ms", cxxopts::value<float>()->default_value("0.1"))
+    ("per_sequence_ms", "Cost model: latency per scheduled sequence in ms", cxxopts::value<float>()->default_value("0"))
+    ("per_context_token_ms", "Cost model: latency per token in the KV cache attended by the scheduled sequences in ms", cxxopts::value<float>()->default_value("0.0001"))
+    ("output_json", "Path to write the results as JSON", cxxopts::value<std::string>()->default_value(""))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string trace_path = result["trace"].as<std::string>();
+    const std::vector<SimulatedRequest> trace = trace_path.empty()
+        ? generate_trace(result["num_requests"].as<size_t>(), result["request_rate"].as<std::string>(),
+                         result["prompt_len"].as<size_t>(), result["output_len"].as<size_t>(), result["seed"].as<size_t>())
+        : read_trace(trace_path);
+
+    ov::genai::SchedulerSimulator::Config config;
+    config.scheduler_config.max_num_batched_tokens = result["max_num_batched_tokens"].as<size_t>();
+    config.scheduler_config.max_num_seqs = result["max_num_seqs"].as<size_t>();
+    config.scheduler_config.num_kv_blocks = result["num_kv_blocks"].as<size_t>();
+    config.scheduler_config.cache_size = result["cache_size"].as<size_t>();
+    config.scheduler_config.dynamic_split_fuse = result["dynamic_split_fuse"].as<bool>();
+    config.scheduler_config.max_num_prefill_tokens_per_step = result["max_num_prefill_tokens_per_step"].as<size_t>();
+    config.scheduler_config.enable_prefix_caching = result["enable_prefix_caching"].as<bool>();
+    config.scheduler_config.scheduling_policy = get_scheduling_policy(result["scheduling_policy"].as<std::string>());
+    config.kv_cache_bytes_per_token = result["kv_cache_bytes_per_token"].as<size_t>();
+    config.block_size = result["block_size"].as<size_t>();
+    config.can_use_partial_preemption = result["partial_preemption"].as<bool>();
+
+    ov::genai::LinearCostModel cost_model;
+    cost_model.step_ms = result["step_ms"].as<float>();
+    cost_model.per_token_ms = result["per_token_ms"].as<float>();
+    cost_model.per_sequence_ms = result["per_sequence_ms"].as<float>();
+    cost_model.per_context_token_ms = result["per_context_token_ms"].as<float>();
+
+    const ov::genai::SimulationResults results = ov::genai::SchedulerSimulator(config, cost_model).run(trace);
+
+    std::cout << "Simulated " << trace.size() << " requests in " << results.num_steps << " steps, "
+              << results.duration_ms / 1000 << " s of the simulated time" << std::endl;
+    std::cout << "Finished requests: " << results.num_finished_requests << ", dropped requests: " << results.num_dropped_requests
+              << ", preemptions: " << results.num_preemptions << std::endl;
+    std::cout << "Throughput: " << (results.duration_ms > 0 ? results.num_generated_tokens * 1000 / results.duration_ms : 0.0f)
+              << " tokens/s" << std::endl;
+    print_histogram("TTFT, ms", results.ttft);
+    print_histogram("TPOT, ms", results.tpot);
+    print_histogram("Queue time, ms", results.queue_time);
+    print_histogram("E2E latency, ms", results.e2e_latency);
+    print_histogram("KV cache usage, %", results.cache_usage);
+
+    const std::string output_json_path = result["output_json"].as<std::string>();
+    if (!output_json_path.empty()) {
+        nlohmann::json json_results = {{"num_steps", results.num_steps},
+                                       {"num_finished_requests", results.num_finished_requests},
+                                       {"num_dropped_requests", results.num_dropped_requests},
+                                       {"num_preemptions", results.num_preemptions},
+                                       {"num_generated_tokens", results.num_generated_tokens},
+                                       {"duration_ms", results.duration_ms},
+                                       {"ttft_ms", to_json(results.ttft)},
+                                       {"tpot_ms", to_json(results.tpot)},
+                                       {"queue_time_ms", to_json(results.queue_time)},
+                                       {"e2e_latency_ms", to_json(results.e2e_latency)},
+                                       {"cache_usage", to_json(results.cache_usage)}};
+        std::ofstream output_json(output_json_path);
+        OPENVINO_ASSERT(output_json.is_open(), "Cannot open output file ", output_json_path);
+        output_json << json_results.dump(4) << std::endl;
+    }
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}
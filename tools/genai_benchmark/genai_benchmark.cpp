@@ -0,0 +1,460 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <cxxopts.hpp>
+
+#include "openvino/genai/image_generation/text2image_pipeline.hpp"
+#include "openvino/genai/llm_pipeline.hpp"
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
+#include "openvino/genai/rag/text_rerank_pipeline.hpp"
+#include "openvino/genai/speech_generation/text2speech_pipeline.hpp"
+#include "openvino/genai/visual_language/pipeline.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+
+namespace {
+
+// sample rate of the audio inputs of Whisper and of the speeches of Text2SpeechPipeline
+constexpr size_t SAMPLE_RATE = 16000;
+
+const std::string REFERENCE_TEXT =
+    "OpenVINO is an open-source toolkit for optimizing and deploying deep learning models. It boosts the inference "
+    "of the models converted from the popular frameworks on Intel CPUs, GPUs and NPUs. ";
+
+// the reference prompts repeat the same paragraph, so that the workloads are the same across releases
+std::string get_reference_text(size_t num_repeats) {
+    std::string text;
+    text.reserve(REFERENCE_TEXT.size() * num_repeats);
+    for (size_t i = 0; i < num_repeats; ++i) {
+        text += REFERENCE_TEXT;
+    }
+    return text;
+}
+
+std::vector<std::string> get_reference_documents(size_t num_documents) {
+    std::vector<std::string> documents;
+    documents.reserve(num_documents);
+    for (size_t i = 0; i < num_documents; ++i) {
+        documents.push_back("Document " + std::to_string(i) + ". " + get_reference_text(1 + i % 4));
+    }
+    return documents;
+}
+
+// [1, height, width, 3] u8 gradient instead of a file, so that the workload doesn't depend on an image decoder
+ov::Tensor get_reference_image(size_t height, size_t width) {
+    ov::Tensor image(ov::element::u8, {1, height, width, 3});
+    uint8_t* data = image.data<uint8_t>();
+    for (size_t h = 0; h < height; ++h) {
+        for (size_t w = 0; w < width; ++w) {
+            uint8_t* pixel = data + (h * width + w) * 3;
+            pixel[0] = static_cast<uint8_t>(255 * h / height);
+            pixel[1] = static_cast<uint8_t>(255 * w / width);
+            pixel[2] = static_cast<uint8_t>((h + w) % 256);
+        }
+    }
+    return image;
+}
+
+// an amplitude-modulated tone, Whisper transcribes little of it, but the encoder processes the same number of frames
+ov::genai::RawSpeechInput get_reference_audio(size_t num_seconds) {
+    ov::genai::RawSpeechInput audio(num_seconds * SAMPLE_RATE);
+    const float pi = 3.14159265358979f;
+    for (size_t i = 0; i < audio.size(); ++i) {
+        const float t = static_cast<float>(i) / SAMPLE_RATE;
+        audio[i] = 0.5f * std::sin(2.0f * pi * 220.0f * t) * (0.5f + 0.5f * std::sin(2.0f * pi * 3.0f * t));
+    }
+    return audio;
+}
+
+struct IterationResult {
+    double latency_ms = 0.0;
+    // tokens, images, seconds of audio or texts depending on the pipeline
+    double num_output_units = 0.0;
+    // for the pipelines generating tokens
+    std::optional<double> ttft_ms, tpot_ms;
+};
+
+struct Workload {
+    std::string name;
+    std::string description;
+    // size of the input in the units of the input, e.g. prompt tokens or seconds of audio
+    size_t input_size = 0;
+    std::function<IterationResult()> run;
+};
+
+struct Pipeline {
+    std::string output_unit;
+    std::vector<Workload> workloads;
+};
+
+class AutoStartTimer {
+    const std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+public:
+    double current_in_milli() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+    }
+};
+
+template <typename Results>
+IterationResult get_token_generation_result(Results& results, double latency_ms) {
+    IterationResult result;
+    result.latency_ms = latency_ms;
+    result.num_output_units = static_cast<double>(results.perf_metrics.get_num_generated_tokens());
+    result.ttft_ms = results.perf_metrics.get_ttft().mean;
+    result.tpot_ms = results.perf_metrics.get_tpot().mean;
+    return result;
+}
+
+size_t get_num_tokens(ov::genai::Tokenizer& tokenizer, const std::string& text) {
+    return tokenizer.encode(text).input_ids.get_shape().at(1);
+}
+
+Pipeline create_llm_pipeline(const std::string& models_path, const std::string& device) {
+    auto pipe = std::make_shared<ov::genai::LLMPipeline>(models_path, device);
+    ov::genai::Tokenizer tokenizer = pipe->get_tokenizer();
+    Pipeline pipeline{"tokens", {}};
+    for (const auto& [name, num_repeats, batch_size] : std::vector<std::tuple<std::string, size_t, size_t>>{
+             {"short_prompt", 1, 1}, {"long_prompt", 32, 1}, {"batch_8", 1, 8}}) {
+        const std::vector<std::string> prompts(batch_size, get_reference_text(num_repeats));
+        ov::genai::GenerationConfig config = pipe->get_generation_config();
+        config.max_new_tokens = 128;
+        config.ignore_eos = true;
+        pipeline.workloads.push_back({name,
+                                      std::to_string(batch_size) + " prompt(s), 128 new tokens",
+                                      get_num_tokens(tokenizer, prompts.front()),
+                                      [pipe, prompts, config]() {
+                                          AutoStartTimer timer;
+                                          auto results = pipe->generate(prompts, config);
+                                          return get_token_generation_result(results, timer.current_in_milli());
+                                      }});
+    }
+    return pipeline;
+}
+
+Pipeline create_vlm_pipeline(const std::string& models_path, const std::string& device) {
+    auto pipe = std::make_shared<ov::genai::VLMPipeline>(models_path, device);
+    ov::genai::Tokenizer tokenizer = pipe->get_tokenizer();
+    Pipeline pipeline{"tokens", {}};
+    const std::string prompt = "Describe the images.";
+    for (const auto& [name, num_images] : std::vector<std::pair<std::string, size_t>>{{"one_image", 1}, {"two_images", 2}}) {
+        const std::vector<ov::Tensor> images(num_images, get_reference_image(448, 448));
+        ov::genai::GenerationConfig config = pipe->get_generation_config();
+        config.max_new_tokens = 64;
+        config.ignore_eos = true;
+        pipeline.workloads.push_back({name,
+                                      std::to_string(num_images) + " 448x448 image(s), 64 new tokens",
+                                      get_num_tokens(tokenizer, prompt),
+                                      [pipe, prompt, images, config]() {
+                                          AutoStartTimer timer;
+                                          auto results = pipe->generate(prompt, ov::genai::images(images), ov::genai::generation_config(config));
+                                          return get_token_generation_result(results, timer.current_in_milli());
+                                      }});
+    }
+    return pipeline;
+}
+
+Pipeline create_whisper_pipeline(const std::string& models_path, const std::string& device) {
+    auto pipe = std::make_shared<ov::genai::WhisperPipeline>(models_path, device);
+    Pipeline pipeline{"tokens", {}};
+    for (const auto& [name, num_seconds] : std::vector<std::pair<std::string, size_t>>{{"audio_5s", 5}, {"audio_30s", 30}}) {
+        const ov::genai::RawSpeechInput audio = get_reference_audio(num_seconds);
+        ov::genai::WhisperGenerationConfig config = pipe->get_generation_config();
+        config.max_new_tokens = 64;
+        pipeline.workloads.push_back({name,
+                                      std::to_string(num_seconds) + " seconds of audio, up to 64 new tokens",
+                                      num_seconds,
+                                      [pipe, audio, config]() {
+                                          AutoStartTimer timer;
+                                          auto results = pipe->generate(audio, config);
+                                          return get_token_generation_result(results, timer.current_in_milli());
+                                      }});
+    }
+    return pipeline;
+}
+
+Pipeline create_text2image_pipeline(const std::string& models_path, const std::string& device) {
+    auto pipe = std::make_shared<ov::genai::Text2ImagePipeline>(models_path, device);
+    Pipeline pipeline{"images", {}};
+    const std::string prompt = "a photo of a red fox in a snowy forest, high detail";
+    for (const auto& [name, size, num_steps] : std::vector<std::tuple<std::string, int64_t, size_t>>{
+             {"512x512_20_steps", 512, 20}, {"1024x1024_20_steps", 1024, 20}}) {
+        pipeline.workloads.push_back({name,
+                                      std::to_string(size) + "x" + std::to_string(size) + " image, " + std::to_string(num_steps) + " steps",
+                                      static_cast<size_t>(size),
+                                      [pipe, prompt, size = size, num_steps = num_steps]() {
+                                          AutoStartTimer timer;
+                                          ov::Tensor image = pipe->generate(prompt,
+                                                                            ov::genai::width(size),
+                                                                            ov::genai::height(size),
+                                                                            ov::genai::num_inference_steps(num_steps),
+                                                                            ov::genai::rng_seed(42));
+                                          IterationResult result;
+                                          result.latency_ms = timer.current_in_milli();
+                                          result.num_output_units = static_cast<double>(image.get_shape().at(0));
+                                          return result;
+                                      }});
+    }
+    return pipeline;
+}
+
+Pipeline create_text2speech_pipeline(const std::string& models_path, const std::string& device) {
+    auto pipe = std::make_shared<ov::genai::Text2SpeechPipeline>(models_path, device);
+    Pipeline pipeline{"audio_seconds", {}};
+    const std::string sentence = REFERENCE_TEXT.substr(0, REFERENCE_TEXT.find('.') + 1);
+    for (const auto& [name, text] : std::vector<std::pair<std::string, std::string>>{{"one_sentence", sentence}, {"paragraph", get_reference_text(2)}}) {
+        pipeline.workloads.push_back({name,
+                                      std::to_string(text.size()) + " characters of text",
+                                      text.size(),
+                                      [pipe, text = text]() {
+                                          AutoStartTimer timer;
+                                          auto results = pipe->generate(text);
+                                          IterationResult result;
+                                          result.latency_ms = timer.current_in_milli();
+                                          result.num_output_units = static_cast<double>(results.perf_metrics.num_generated_samples) / SAMPLE_RATE;
+                                          return result;
+                                      }});
+    }
+    return pipeline;
+}
+
+Pipeline create_text_embedding_pipeline(const std::string& models_path, const std::string& device) {
+    auto pipe = std::make_shared<ov::genai::TextEmbeddingPipeline>(models_path, device);
+    Pipeline pipeline{"texts", {}};
+    const std::string query = REFERENCE_TEXT;
+    pipeline.workloads.push_back({"query", "1 query", 1, [pipe, query]() {
+                                      AutoStartTimer timer;
+                                      pipe->embed_query(query);
+                                      return IterationResult{timer.current_in_milli(), 1.0, std::nullopt, std::nullopt};
+                                  }});
+    const std::vector<std::string> documents = get_reference_documents(32);
+    pipeline.workloads.push_back({"documents_32", "32 documents", documents.size(), [pipe, documents]() {
+                                      AutoStartTimer timer;
+                                      pipe->embed_documents(documents);
+                                      return IterationResult{timer.current_in_milli(), static_cast<double>(documents.size()), std::nullopt, std::nullopt};
+                                  }});
+    return pipeline;
+}
+
+Pipeline create_text_rerank_pipeline(const std::string& models_path, const std::string& device) {
+    auto pipe = std::make_shared<ov::genai::TextRerankPipeline>(models_path, device);
+    Pipeline pipeline{"texts", {}};
+    const std::string query = "What is OpenVINO?";
+    for (size_t num_documents : {8, 32}) {
+        const std::vector<std::string> documents = get_reference_documents(num_documents);
+        pipeline.workloads.push_back({"documents_" + std::to_string(num_documents),
+                                      "1 query, " + std::to_string(num_documents) + " documents",
+                                      num_documents,
+                                      [pipe, query, documents]() {
+                                          AutoStartTimer timer;
+                                          pipe->rerank(query, documents);
+                                          return IterationResult{timer.current_in_milli(), static_cast<double>(documents.size()), std::nullopt, std::nullopt};
+                                      }});
+    }
+    return pipeline;
+}
+
+const std::vector<std::pair<std::string, std::function<Pipeline(const std::string&, const std::string&)>>> PIPELINES = {
+    {"llm", create_llm_pipeline},
+    {"vlm", create_vlm_pipeline},
+    {"whisper", create_whisper_pipeline},
+    {"text2image", create_text2image_pipeline},
+    {"text2speech", create_text2speech_pipeline},
+    {"text_embedding", create_text_embedding_pipeline},
+    {"text_rerank", create_text_rerank_pipeline},
+};
+
+// the percentiles are linearly interpolated between the closest ranks
+double get_percentile(const std::vector<double>& sorted_values, double percent) {
+    const double rank = percent / 100.0 * (sorted_values.size() - 1);
+    const size_t lower = static_cast<size_t>(std::floor(rank));
+    const size_t upper = std::min(lower + 1, sorted_values.size() - 1);
+    return sorted_values[lower] + (sorted_values[upper] - sorted_values[lower]) * (rank - lower);
+}
+
+nlohmann::json get_statistics(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    const double mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    double variance = 0.0;
+    for (double value : values) {
+        variance += (value - mean) * (value - mean);
+    }
+    return {
+        {"mean", mean},
+        {"std", std::sqrt(variance / values.size())},
+        {"min", values.front()},
+        {"p50", get_percentile(values, 50.0)},
+        {"p90", get_percentile(values, 90.0)},
+        {"p99", get_percentile(values, 99.0)},
+        {"max", values.back()},
+    };
+}
+
+void print_statistics(const std::string& name, const nlohmann::json& statistics, const std::string& unit) {
+    std::cout << "  " << std::left << std::setw(12) << name << std::right
+              << "mean " << statistics["mean"].get<double>() << " " << unit
+              << ", p50 " << statistics["p50"].get<double>()
+              << ", p90 " << statistics["p90"].get<double>()
+              << ", p99 " << statistics["p99"].get<double>() << std::endl;
+}
+
+nlohmann::json run_workload(const Workload& workload, const std::string& output_unit, size_t num_warmup, size_t num_iter) {
+    for (size_t i = 0; i < num_warmup; ++i) {
+        workload.run();
+    }
+
+    std::vector<double> latencies, ttfts, tpots;
+    double total_latency_ms = 0.0, total_output_units = 0.0;
+    for (size_t i = 0; i < num_iter; ++i) {
+        const IterationResult result = workload.run();
+        latencies.push_back(result.latency_ms);
+        total_latency_ms += result.latency_ms;
+        total_output_units += result.num_output_units;
+        if (result.ttft_ms) {
+            ttfts.push_back(*result.ttft_ms);
+        }
+        if (result.tpot_ms) {
+            tpots.push_back(*result.tpot_ms);
+        }
+    }
+
+    nlohmann::json report = {
+        {"name", workload.name},
+        {"description", workload.description},
+        {"input_size", workload.input_size},
+        {"latency_ms", get_statistics(latencies)},
+        {"throughput", total_output_units / total_latency_ms * 1000.0},
+        {"throughput_unit", output_unit + "/s"},
+    };
+    std::cout << workload.name << " (" << workload.description << ", input size " << workload.input_size << ")" << std::endl;
+    print_statistics("latency", report["latency_ms"], "ms");
+    if (!ttfts.empty()) {
+        report["ttft_ms"] = get_statistics(ttfts);
+        print_statistics("ttft", report["ttft_ms"], "ms");
+    }
+    if (!tpots.empty()) {
+        report["tpot_ms"] = get_statistics(tpots);
+        print_statistics("tpot", report["tpot_ms"], "ms/token");
+    }
+    std::cout << "  throughput  " << report["throughput"].get<double>() << " " << output_unit << "/s" << std::endl;
+    return report;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    std::string pipeline_names;
+    for (const auto& [name, _] : PIPELINES) {
+        pipeline_names += (pipeline_names.empty() ? "" : ", ") + name;
+    }
+
+    cxxopts::Options options("genai_benchmark", "Runs the fixed reference workloads of a pipeline, so that the latency and throughput can be compared between releases");
+
+    options.add_options()
+    ("pipeline", "Pipeline type, one of: " + pipeline_names, cxxopts::value<std::string>()->default_value("llm"))
+    ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
+    ("d,device", "Target device to run the model", cxxopts::value<std::string>()->default_value("CPU"))
+    ("w,workload", "Name of the reference workload to run, all workloads of the pipeline are run if empty", cxxopts::value<std::string>()->default_value(""))
+    ("nw,num_warmup", "Number of warmup iterations of each workload", cxxopts::value<size_t>()->default_value("1"))
+    ("n,num_iter", "Number of measured iterations of each workload", cxxopts::value<size_t>()->default_value("10"))
+    ("o,output", "Path to the JSON file to write the report to", cxxopts::value<std::string>()->default_value(""))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string pipeline_type = result["pipeline"].as<std::string>();
+    const std::string models_path = result["model"].as<std::string>();
+    const std::string device = result["device"].as<std::string>();
+    const std::string workload_name = result["workload"].as<std::string>();
+    const size_t num_warmup = result["num_warmup"].as<size_t>();
+    const size_t num_iter = result["num_iter"].as<size_t>();
+    const std::string output_path = result["output"].as<std::string>();
+
+    if (num_iter == 0) {
+        std::cout << "Number of iterations must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto pipeline_it = std::find_if(PIPELINES.begin(), PIPELINES.end(), [&](const auto& pipeline) {
+        return pipeline.first == pipeline_type;
+    });
+    if (pipeline_it == PIPELINES.end()) {
+        std::cout << "Unknown pipeline type " << pipeline_type << ", expected one of: " << pipeline_names << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << ov::get_openvino_version() << std::endl;
+
+    AutoStartTimer load_timer;
+    const Pipeline pipeline = pipeline_it->second(models_path, device);
+    const double load_time_ms = load_timer.current_in_milli();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Load time: " << load_time_ms << " ms" << std::endl;
+
+    nlohmann::json report = {
+        {"openvino_version", ov::get_openvino_version().buildNumber},
+        {"pipeline", pipeline_type},
+        {"model", models_path},
+        {"device", device},
+        {"num_warmup", num_warmup},
+        {"num_iter", num_iter},
+        {"load_time_ms", load_time_ms},
+        {"workloads", nlohmann::json::array()},
+    };
+    for (const Workload& workload : pipeline.workloads) {
+        if (workload_name.empty() || workload.name == workload_name) {
+            report["workloads"].push_back(run_workload(workload, pipeline.output_unit, num_warmup, num_iter));
+        }
+    }
+    if (report["workloads"].empty()) {
+        std::cout << "Unknown workload " << workload_name << " of the pipeline " << pipeline_type << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!output_path.empty()) {
+        std::ofstream output_file(output_path);
+        if (!output_file.is_open()) {
+            std::cout << "Failed to open " << output_path << std::endl;
+            return EXIT_FAILURE;
+        }
+        output_file << report.dump(4) << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}